@@ -0,0 +1,748 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Application-level benchmarks: every application is timed end-to-end and the
+// time is split into initialization (generator creation, seeding, tables),
+// generation (rocRAND calls or device API kernels) and consumption (the kernels
+// of the application that use the random values). Phases are separated by
+// device synchronizations, so phases do not overlap.
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+#include <algorithm>
+#include <functional>
+
+#include "cmdparser.hpp"
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+#include <rocrand_kernel.h>
+
+#define HIP_CHECK(condition)         \
+  {                                  \
+    hipError_t error = condition;    \
+    if(error != hipSuccess){         \
+        std::cout << "HIP error: " << error << " line: " << __LINE__ << std::endl; \
+        exit(error); \
+    } \
+  }
+
+#define ROCRAND_CHECK(condition)                 \
+  {                                              \
+    rocrand_status _status = condition;           \
+    if(_status != ROCRAND_STATUS_SUCCESS) {       \
+        std::cout << "ROCRAND error: " << _status << " line: " << __LINE__ << std::endl; \
+        exit(_status); \
+    } \
+  }
+
+typedef rocrand_rng_type rng_type_t;
+
+const unsigned int block_size = 256;
+const unsigned int max_blocks = 1024;
+
+// Times of the phases of one run in milliseconds
+struct app_times
+{
+    double init;
+    double generation;
+    double consumption;
+    // Result of the application (estimate, price...) to check that it is sane
+    double result;
+};
+
+// Measures phases by host timers, work of every phase is finished
+// (device synchronization) before the next one starts
+class phase_timer
+{
+public:
+    phase_timer()
+    {
+        HIP_CHECK(hipDeviceSynchronize());
+        m_start = std::chrono::high_resolution_clock::now();
+    }
+
+    // Returns milliseconds since the start or the previous lap
+    double lap()
+    {
+        HIP_CHECK(hipDeviceSynchronize());
+        const auto now = std::chrono::high_resolution_clock::now();
+        const std::chrono::duration<double, std::milli> elapsed = now - m_start;
+        m_start = now;
+        return elapsed.count();
+    }
+
+private:
+    std::chrono::high_resolution_clock::time_point m_start;
+};
+
+unsigned int blocks_for(const size_t size)
+{
+    return static_cast<unsigned int>(
+        std::min<size_t>(max_blocks, (size + block_size - 1) / block_size)
+    );
+}
+
+// Sum of n values by atomics of block sums (the order is not deterministic)
+template<class T>
+__global__
+void sum_kernel(const T * values, const size_t n, double * sum)
+{
+    __shared__ double block_sums[block_size];
+    const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+    double s = 0.0;
+    for(size_t i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x; i < n; i += stride)
+    {
+        s += static_cast<double>(values[i]);
+    }
+    block_sums[hipThreadIdx_x] = s;
+    __syncthreads();
+    for(unsigned int offset = block_size / 2; offset > 0; offset /= 2)
+    {
+        if(hipThreadIdx_x < offset)
+            block_sums[hipThreadIdx_x] += block_sums[hipThreadIdx_x + offset];
+        __syncthreads();
+    }
+    if(hipThreadIdx_x == 0)
+        atomicAdd(sum, block_sums[0]);
+}
+
+template<class T>
+double device_sum(const T * values, const size_t n)
+{
+    double * sum;
+    HIP_CHECK(hipMalloc((void **)&sum, sizeof(double)));
+    HIP_CHECK(hipMemset(sum, 0, sizeof(double)));
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(sum_kernel<T>),
+        dim3(blocks_for(n)), dim3(block_size), 0, 0,
+        values, n, sum
+    );
+    HIP_CHECK(hipPeekAtLastError());
+    double result;
+    HIP_CHECK(hipMemcpy(&result, sum, sizeof(double), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(sum));
+    return result;
+}
+
+// Monte Carlo pi (host API): uniform x and y, points inside the quarter circle
+// are counted
+__global__
+void pi_inside_kernel(const float * xy, const size_t points, unsigned int * inside)
+{
+    const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+    for(size_t i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x; i < points; i += stride)
+    {
+        const float x = xy[i];
+        const float y = xy[points + i];
+        inside[i] = x * x + y * y <= 1.0f ? 1 : 0;
+    }
+}
+
+app_times run_pi_host(const rng_type_t rng_type, const size_t size)
+{
+    const size_t points = size;
+    app_times times;
+    phase_timer timer;
+
+    float * xy;
+    unsigned int * inside;
+    HIP_CHECK(hipMalloc((void **)&xy, 2 * points * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&inside, points * sizeof(unsigned int)));
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_initialize_generator(generator));
+    times.init = timer.lap();
+
+    ROCRAND_CHECK(rocrand_generate_uniform(generator, xy, 2 * points));
+    times.generation = timer.lap();
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(pi_inside_kernel),
+        dim3(blocks_for(points)), dim3(block_size), 0, 0,
+        xy, points, inside
+    );
+    HIP_CHECK(hipPeekAtLastError());
+    times.result = 4.0 * device_sum(inside, points) / points;
+    times.consumption = timer.lap();
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(xy));
+    HIP_CHECK(hipFree(inside));
+    return times;
+}
+
+// Monte Carlo pi (device API): threads generate points and count those inside
+// the quarter circle, random values are not stored
+__global__
+void pi_init_kernel(rocrand_state_philox4x32_10 * states, const unsigned long long seed)
+{
+    const unsigned int id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocrand_state_philox4x32_10 state;
+    rocrand_init(seed, id, 0, &state);
+    states[id] = state;
+}
+
+__global__
+void pi_device_kernel(rocrand_state_philox4x32_10 * states, const size_t points,
+                      unsigned int * inside)
+{
+    const unsigned int id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+    rocrand_state_philox4x32_10 state = states[id];
+    unsigned int count = 0;
+    for(size_t i = id; i < points; i += stride)
+    {
+        const float2 xy = rocrand_uniform2(&state);
+        count += xy.x * xy.x + xy.y * xy.y <= 1.0f ? 1 : 0;
+    }
+    states[id] = state;
+    inside[id] = count;
+}
+
+app_times run_pi_device(const size_t size)
+{
+    const size_t points = size;
+    const unsigned int blocks = blocks_for(points);
+    const unsigned int threads = blocks * block_size;
+    app_times times;
+    phase_timer timer;
+
+    rocrand_state_philox4x32_10 * states;
+    unsigned int * inside;
+    HIP_CHECK(hipMalloc((void **)&states, threads * sizeof(rocrand_state_philox4x32_10)));
+    HIP_CHECK(hipMalloc((void **)&inside, threads * sizeof(unsigned int)));
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(pi_init_kernel),
+        dim3(blocks), dim3(block_size), 0, 0,
+        states, 1234ULL
+    );
+    HIP_CHECK(hipPeekAtLastError());
+    times.init = timer.lap();
+
+    // Generation and the test of points are fused
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(pi_device_kernel),
+        dim3(blocks), dim3(block_size), 0, 0,
+        states, points, inside
+    );
+    HIP_CHECK(hipPeekAtLastError());
+    times.generation = timer.lap();
+
+    times.result = 4.0 * device_sum(inside, threads) / points;
+    times.consumption = timer.lap();
+
+    HIP_CHECK(hipFree(states));
+    HIP_CHECK(hipFree(inside));
+    return times;
+}
+
+// Black-Scholes: paths of geometric Brownian motion from normal quasi-random
+// values (a dimension for every time step), the discounted payoff of
+// a European call is averaged. Values of step d of path p are
+// normals[d * paths + p] (quasi-random values are stored by dimension).
+__global__
+void black_scholes_kernel(const float * normals, const size_t paths,
+                          const unsigned int steps, float * payoffs)
+{
+    const float s0 = 100.0f;
+    const float strike = 100.0f;
+    const float rate = 0.05f;
+    const float volatility = 0.2f;
+    const float maturity = 1.0f;
+    const float dt = maturity / steps;
+    const float drift = (rate - 0.5f * volatility * volatility) * dt;
+    const float diffusion = volatility * sqrtf(dt);
+
+    const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+    for(size_t p = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x; p < paths; p += stride)
+    {
+        float log_s = logf(s0);
+        for(unsigned int d = 0; d < steps; d++)
+        {
+            log_s += drift + diffusion * normals[d * paths + p];
+        }
+        payoffs[p] = expf(-rate * maturity) * fmaxf(expf(log_s) - strike, 0.0f);
+    }
+}
+
+app_times run_black_scholes(const size_t size)
+{
+    const unsigned int steps = 64;
+    const size_t paths = std::max<size_t>(1, size / steps);
+    app_times times;
+    phase_timer timer;
+
+    float * normals;
+    float * payoffs;
+    HIP_CHECK(hipMalloc((void **)&normals, paths * steps * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&payoffs, paths * sizeof(float)));
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL32));
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(generator, steps));
+    ROCRAND_CHECK(rocrand_initialize_generator(generator));
+    times.init = timer.lap();
+
+    ROCRAND_CHECK(rocrand_generate_normal(generator, normals, paths * steps, 0.0f, 1.0f));
+    times.generation = timer.lap();
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(black_scholes_kernel),
+        dim3(blocks_for(paths)), dim3(block_size), 0, 0,
+        normals, paths, steps, payoffs
+    );
+    HIP_CHECK(hipPeekAtLastError());
+    times.result = device_sum(payoffs, paths) / paths;
+    times.consumption = timer.lap();
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(normals));
+    HIP_CHECK(hipFree(payoffs));
+    return times;
+}
+
+// Dropout: activations are kept with probability 1 - p and scaled by 1 / (1 - p)
+__global__
+void dropout_kernel(const float * input, const unsigned char * mask, const size_t n,
+                    const float scale, float * output)
+{
+    const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+    for(size_t i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x; i < n; i += stride)
+    {
+        output[i] = mask[i] ? input[i] * scale : 0.0f;
+    }
+}
+
+__global__
+void fill_kernel(float * values, const size_t n, const float value)
+{
+    const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+    for(size_t i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x; i < n; i += stride)
+    {
+        values[i] = value;
+    }
+}
+
+app_times run_dropout(const rng_type_t rng_type, const size_t size)
+{
+    const double p = 0.1;
+    app_times times;
+
+    float * input;
+    float * output;
+    unsigned char * mask;
+    HIP_CHECK(hipMalloc((void **)&input, size * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&output, size * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&mask, size));
+    // Activations are not a part of the benchmark
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(fill_kernel),
+        dim3(blocks_for(size)), dim3(block_size), 0, 0,
+        input, size, 1.0f
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    phase_timer timer;
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_initialize_generator(generator));
+    times.init = timer.lap();
+
+    const rocrand_status status = rocrand_generate_bernoulli_char(generator, mask, size, 1.0 - p);
+    if(status == ROCRAND_STATUS_TYPE_ERROR)
+    {
+        std::cout << "    dropout: not supported by the engine" << std::endl;
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+        HIP_CHECK(hipFree(input));
+        HIP_CHECK(hipFree(output));
+        HIP_CHECK(hipFree(mask));
+        times.result = NAN;
+        return times;
+    }
+    ROCRAND_CHECK(status);
+    times.generation = timer.lap();
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(dropout_kernel),
+        dim3(blocks_for(size)), dim3(block_size), 0, 0,
+        input, mask, size, static_cast<float>(1.0 / (1.0 - p)), output
+    );
+    HIP_CHECK(hipPeekAtLastError());
+    // The mean of outputs is 1
+    times.result = device_sum(output, size) / size;
+    times.consumption = timer.lap();
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(input));
+    HIP_CHECK(hipFree(output));
+    HIP_CHECK(hipFree(mask));
+    return times;
+}
+
+// Photon (shot) noise of 4K images: the number of photons of a pixel is
+// Poisson-distributed with the expected count of the clean image as lambda,
+// counts are converted back to normalized intensities
+__global__
+void photon_lambdas_kernel(double * lambdas, const unsigned int width,
+                           const unsigned int height, const double max_photons)
+{
+    const size_t n = static_cast<size_t>(width) * height;
+    const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+    for(size_t i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x; i < n; i += stride)
+    {
+        // Horizontal gradient from dark to bright
+        const double x = static_cast<double>(i % width) / width;
+        lambdas[i] = 0.5 + x * max_photons;
+    }
+}
+
+__global__
+void photon_image_kernel(const unsigned int * counts, const size_t n,
+                         const float inv_max_photons, float * image)
+{
+    const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+    for(size_t i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x; i < n; i += stride)
+    {
+        image[i] = fminf(counts[i] * inv_max_photons, 1.0f);
+    }
+}
+
+app_times run_photon_noise(const rng_type_t rng_type, const size_t images)
+{
+    const unsigned int width = 3840;
+    const unsigned int height = 2160;
+    const size_t pixels = static_cast<size_t>(width) * height;
+    const double max_photons = 1000.0;
+    app_times times;
+    phase_timer timer;
+
+    double * lambdas;
+    unsigned int * counts;
+    float * image;
+    HIP_CHECK(hipMalloc((void **)&lambdas, pixels * sizeof(double)));
+    HIP_CHECK(hipMalloc((void **)&counts, pixels * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&image, pixels * sizeof(float)));
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(photon_lambdas_kernel),
+        dim3(blocks_for(pixels)), dim3(block_size), 0, 0,
+        lambdas, width, height, max_photons
+    );
+    HIP_CHECK(hipPeekAtLastError());
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_initialize_generator(generator));
+    times.init = timer.lap();
+
+    times.generation = 0.0;
+    times.consumption = 0.0;
+    times.result = 0.0;
+    for(size_t i = 0; i < images; i++)
+    {
+        const rocrand_status status = rocrand_generate_poisson_array(generator, counts, lambdas, pixels);
+        if(status == ROCRAND_STATUS_TYPE_ERROR)
+        {
+            std::cout << "    photon-noise: not supported by the engine" << std::endl;
+            times.result = NAN;
+            break;
+        }
+        ROCRAND_CHECK(status);
+        times.generation += timer.lap();
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(photon_image_kernel),
+            dim3(blocks_for(pixels)), dim3(block_size), 0, 0,
+            counts, pixels, static_cast<float>(1.0 / max_photons), image
+        );
+        HIP_CHECK(hipPeekAtLastError());
+        // The mean intensity is about 0.5
+        times.result += device_sum(image, pixels) / pixels / images;
+        times.consumption += timer.lap();
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(lambdas));
+    HIP_CHECK(hipFree(counts));
+    HIP_CHECK(hipFree(image));
+    return times;
+}
+
+// Negative sampling (word2vec): negatives are drawn from the unigram
+// distribution raised to 3/4 (Zipf's law as unigram frequencies) over a large
+// vocabulary, scores are dot products of the context vector with gathered
+// embeddings of the negatives
+const unsigned int embedding_size = 16;
+
+__global__
+void negative_scores_kernel(const unsigned int * ids, const size_t n,
+                            const float * embeddings, float * scores)
+{
+    const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+    for(size_t i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x; i < n; i += stride)
+    {
+        const float * embedding = embeddings + static_cast<size_t>(ids[i]) * embedding_size;
+        float score = 0.0f;
+        for(unsigned int j = 0; j < embedding_size; j++)
+        {
+            // The context vector is all ones
+            score += embedding[j];
+        }
+        scores[i] = score;
+    }
+}
+
+app_times run_negative_sampling(const rng_type_t rng_type, const size_t size)
+{
+    const unsigned int vocabulary_size = 1 << 20;
+    app_times times;
+
+    float * embeddings;
+    unsigned int * ids;
+    float * scores;
+    HIP_CHECK(hipMalloc((void **)&embeddings, static_cast<size_t>(vocabulary_size) * embedding_size * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&ids, size * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&scores, size * sizeof(float)));
+    // Embeddings are not a part of the benchmark
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(fill_kernel),
+        dim3(blocks_for(static_cast<size_t>(vocabulary_size) * embedding_size)), dim3(block_size), 0, 0,
+        embeddings, static_cast<size_t>(vocabulary_size) * embedding_size, 1.0f / embedding_size
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    phase_timer timer;
+    std::vector<double> probabilities(vocabulary_size);
+    for(unsigned int i = 0; i < vocabulary_size; i++)
+    {
+        probabilities[i] = std::pow(1.0 / (i + 1.0), 0.75);
+    }
+    rocrand_discrete_distribution distribution;
+    ROCRAND_CHECK(rocrand_create_discrete_distribution(probabilities.data(), vocabulary_size, 0, &distribution));
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_initialize_generator(generator));
+    times.init = timer.lap();
+
+    ROCRAND_CHECK(rocrand_generate_discrete(generator, ids, size, distribution));
+    times.generation = timer.lap();
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(negative_scores_kernel),
+        dim3(blocks_for(size)), dim3(block_size), 0, 0,
+        ids, size, embeddings, scores
+    );
+    HIP_CHECK(hipPeekAtLastError());
+    // Every score is 1
+    times.result = device_sum(scores, size) / size;
+    times.consumption = timer.lap();
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    ROCRAND_CHECK(rocrand_destroy_discrete_distribution(distribution));
+    HIP_CHECK(hipFree(embeddings));
+    HIP_CHECK(hipFree(ids));
+    HIP_CHECK(hipFree(scores));
+    return times;
+}
+
+// Runs the application trials times (and once for warm-up), prints medians
+void run_app(const std::string& app, const std::string& engine,
+             std::function<app_times()> run, const size_t trials)
+{
+    // Warm-up, the application is skipped if the engine does not support it
+    if(std::isnan(run().result))
+        return;
+
+    std::vector<app_times> results;
+    for(size_t i = 0; i < trials; i++)
+    {
+        results.push_back(run());
+    }
+
+    auto median = [&results](std::function<double(const app_times&)> get)
+    {
+        std::vector<double> values;
+        for(const app_times& t : results)
+            values.push_back(get(t));
+        std::sort(values.begin(), values.end());
+        return values[values.size() / 2];
+    };
+    const double init = median([](const app_times& t) { return t.init; });
+    const double generation = median([](const app_times& t) { return t.generation; });
+    const double consumption = median([](const app_times& t) { return t.consumption; });
+
+    std::cout << std::fixed << std::setprecision(3)
+              << "    " << std::left << std::setw(20) << app << std::right
+              << "engine: " << std::setw(18) << std::left << engine << std::right
+              << "init: " << std::setw(9) << init << " ms, "
+              << "generation: " << std::setw(9) << generation << " ms, "
+              << "consumption: " << std::setw(9) << consumption << " ms, "
+              << "total: " << std::setw(9) << init + generation + consumption << " ms, "
+              << "result: " << std::setprecision(5) << results.back().result
+              << std::endl;
+}
+
+const std::vector<std::string> all_apps = {
+    "pi-host",
+    "pi-device",
+    "black-scholes",
+    "dropout",
+    "photon-noise",
+    "negative-sampling",
+};
+
+const std::vector<std::string> all_engines = {
+    "xorwow",
+    "mrg32k3a",
+    "mtgp32",
+    "philox",
+    "philox4x32_7",
+    "philox4x64",
+    "threefry2x64",
+    "threefry4x64",
+    "xoshiro128pp",
+    "pcg32",
+};
+
+int main(int argc, char *argv[])
+{
+    cli::Parser parser(argc, argv);
+
+    const std::string app_desc =
+        "space-separated list of applications:" +
+        std::accumulate(all_apps.begin(), all_apps.end(), std::string(),
+            [](std::string a, std::string b) {
+                return a + "\n      " + b;
+            }
+        ) +
+        "\n      or all";
+    const std::string engine_desc =
+        "space-separated list of pseudo-random number engines of host API applications"
+        " (black-scholes uses sobol32, pi-device uses the device API of philox):" +
+        std::accumulate(all_engines.begin(), all_engines.end(), std::string(),
+            [](std::string a, std::string b) {
+                return a + "\n      " + b;
+            }
+        ) +
+        "\n      or all";
+
+    parser.set_optional<size_t>("size", "size", 1024 * 1024 * 64, "number of random values of an application run");
+    parser.set_optional<size_t>("images", "images", 4, "number of 4K images of photon-noise");
+    parser.set_optional<size_t>("trials", "trials", 5, "number of trials");
+    parser.set_optional<std::vector<std::string>>("app", "app", {"all"}, app_desc.c_str());
+    parser.set_optional<std::vector<std::string>>("engine", "engine", {"philox"}, engine_desc.c_str());
+    parser.run_and_exit_if_error();
+
+    const size_t size = parser.get<size_t>("size");
+    const size_t images = parser.get<size_t>("images");
+    const size_t trials = std::max<size_t>(1, parser.get<size_t>("trials"));
+
+    std::vector<std::string> apps;
+    {
+        auto as = parser.get<std::vector<std::string>>("app");
+        for (auto a : all_apps)
+        {
+            if (std::find(as.begin(), as.end(), "all") != as.end()
+                || std::find(as.begin(), as.end(), a) != as.end())
+                apps.push_back(a);
+        }
+    }
+
+    std::vector<std::string> engines;
+    {
+        auto es = parser.get<std::vector<std::string>>("engine");
+        for (auto e : all_engines)
+        {
+            if (std::find(es.begin(), es.end(), "all") != es.end()
+                || std::find(es.begin(), es.end(), e) != es.end())
+                engines.push_back(e);
+        }
+    }
+
+    int version;
+    ROCRAND_CHECK(rocrand_get_version(&version));
+    int runtime_version;
+    HIP_CHECK(hipRuntimeGetVersion(&runtime_version));
+    int device_id;
+    HIP_CHECK(hipGetDevice(&device_id));
+    hipDeviceProp_t props;
+    HIP_CHECK(hipGetDeviceProperties(&props, device_id));
+
+    std::cout << "rocRAND: " << version << " ";
+    std::cout << "Runtime: " << runtime_version << " ";
+    std::cout << "Device: " << props.name;
+    std::cout << std::endl << std::endl;
+
+    for (auto app : apps)
+    {
+        std::cout << app << ":" << std::endl;
+        // Applications with a fixed engine
+        if (app == "pi-device")
+        {
+            run_app(app, "philox (device)", [=]() { return run_pi_device(size); }, trials);
+            continue;
+        }
+        if (app == "black-scholes")
+        {
+            run_app(app, "sobol32", [=]() { return run_black_scholes(size); }, trials);
+            continue;
+        }
+
+        for (auto engine : engines)
+        {
+            rng_type_t rng_type = ROCRAND_RNG_PSEUDO_XORWOW;
+            if (engine == "xorwow")
+                rng_type = ROCRAND_RNG_PSEUDO_XORWOW;
+            else if (engine == "mrg32k3a")
+                rng_type = ROCRAND_RNG_PSEUDO_MRG32K3A;
+            else if (engine == "philox")
+                rng_type = ROCRAND_RNG_PSEUDO_PHILOX4_32_10;
+            else if (engine == "philox4x32_7")
+                rng_type = ROCRAND_RNG_PSEUDO_PHILOX4_32_7;
+            else if (engine == "philox4x64")
+                rng_type = ROCRAND_RNG_PSEUDO_PHILOX4_64_10;
+            else if (engine == "threefry2x64")
+                rng_type = ROCRAND_RNG_PSEUDO_THREEFRY2_64_20;
+            else if (engine == "threefry4x64")
+                rng_type = ROCRAND_RNG_PSEUDO_THREEFRY4_64_20;
+            else if (engine == "xoshiro128pp")
+                rng_type = ROCRAND_RNG_PSEUDO_XOSHIRO128PP;
+            else if (engine == "pcg32")
+                rng_type = ROCRAND_RNG_PSEUDO_PCG32;
+            else if (engine == "mtgp32")
+                rng_type = ROCRAND_RNG_PSEUDO_MTGP32;
+
+            if (app == "pi-host")
+                run_app(app, engine, [=]() { return run_pi_host(rng_type, size); }, trials);
+            else if (app == "dropout")
+                run_app(app, engine, [=]() { return run_dropout(rng_type, size); }, trials);
+            else if (app == "photon-noise")
+                run_app(app, engine, [=]() { return run_photon_noise(rng_type, images); }, trials);
+            else if (app == "negative-sampling")
+                run_app(app, engine, [=]() { return run_negative_sampling(rng_type, size); }, trials);
+        }
+        std::cout << std::endl;
+    }
+
+    return 0;
+}
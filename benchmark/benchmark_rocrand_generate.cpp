@@ -23,9 +23,11 @@
 #include <vector>
 #include <string>
 #include <chrono>
+#include <cmath>
 #include <numeric>
 #include <utility>
 #include <algorithm>
+#include <functional>
 
 #include "cmdparser.hpp"
 
@@ -59,11 +61,197 @@ typedef rocrand_rng_type rng_type_t;
 template<typename T>
 using generate_func_type = std::function<rocrand_status(rocrand_generator, T *, size_t)>;
 
+// Result of one size of the size sweep (--sweep)
+struct sweep_result
+{
+    std::string engine;
+    std::string distribution;
+    double lambda;
+    size_t size;
+    size_t bytes;
+    size_t trials;
+    double p50_us;
+    double p99_us;
+    double gbps;
+    double launches_per_second;
+};
+
+// State of the size sweep, results are printed after all benchmarks
+struct sweep_context
+{
+    bool enabled;
+    std::string engine;
+    std::string distribution;
+    double lambda;
+    // Peak memory bandwidth of the device in GB/s
+    double peak_gbps;
+    std::vector<sweep_result> results;
+};
+
+// Nearest-rank percentile of sorted values
+double percentile(const std::vector<double>& sorted_values, const double p)
+{
+    const size_t rank = static_cast<size_t>(std::ceil(p * sorted_values.size()));
+    return sorted_values[std::max<size_t>(rank, 1) - 1];
+}
+
+// Sweeps sizes from sweep-min to sweep-max (doubling them). Latency of every call
+// is measured by events recorded around it in the generator's stream, the call is
+// finished before the next one starts. Launches per second are measured separately
+// with calls enqueued back-to-back, so they include the launch overhead.
+template<typename T>
+void run_sweep_benchmark(const cli::Parser& parser,
+                         const rng_type_t rng_type,
+                         generate_func_type<T> generate_func,
+                         sweep_context& sweep)
+{
+    const size_t min_size = parser.get<size_t>("sweep-min");
+    const size_t max_size = parser.get<size_t>("sweep-max");
+    const size_t trials = std::max<size_t>(1, parser.get<size_t>("sweep-trials"));
+    const size_t dimensions = parser.get<size_t>("dimensions");
+
+    T * data;
+    HIP_CHECK(hipMalloc((void **)&data, std::max(min_size, max_size) * sizeof(T)));
+
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreate(&stream));
+    hipEvent_t start, stop;
+    HIP_CHECK(hipEventCreate(&start));
+    HIP_CHECK(hipEventCreate(&stop));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_stream(generator, stream));
+
+    rocrand_status status = rocrand_set_quasi_random_generator_dimensions(generator, dimensions);
+    if (status != ROCRAND_STATUS_TYPE_ERROR) // If the RNG is not quasi-random
+    {
+        ROCRAND_CHECK(status);
+    }
+    ROCRAND_CHECK(rocrand_initialize_generator(generator));
+
+    std::vector<double> times(trials);
+    for (size_t size0 = std::max<size_t>(1, min_size); size0 <= max_size; size0 *= 2)
+    {
+        const size_t size = std::max<size_t>(1, size0 / dimensions) * dimensions;
+        if (size > max_size)
+            break;
+
+        // Warm-up
+        for (size_t i = 0; i < 5; i++)
+        {
+            ROCRAND_CHECK(generate_func(generator, data, size));
+        }
+        HIP_CHECK(hipStreamSynchronize(stream));
+
+        for (size_t i = 0; i < trials; i++)
+        {
+            HIP_CHECK(hipEventRecord(start, stream));
+            ROCRAND_CHECK(generate_func(generator, data, size));
+            HIP_CHECK(hipEventRecord(stop, stream));
+            HIP_CHECK(hipEventSynchronize(stop));
+            float elapsed;
+            HIP_CHECK(hipEventElapsedTime(&elapsed, start, stop));
+            times[i] = elapsed * 1e3;
+        }
+        std::sort(times.begin(), times.end());
+
+        HIP_CHECK(hipEventRecord(start, stream));
+        for (size_t i = 0; i < trials; i++)
+        {
+            ROCRAND_CHECK(generate_func(generator, data, size));
+        }
+        HIP_CHECK(hipEventRecord(stop, stream));
+        HIP_CHECK(hipEventSynchronize(stop));
+        float elapsed;
+        HIP_CHECK(hipEventElapsedTime(&elapsed, start, stop));
+
+        sweep_result result;
+        result.engine = sweep.engine;
+        result.distribution = sweep.distribution;
+        result.lambda = sweep.lambda;
+        result.size = size;
+        result.bytes = size * sizeof(T);
+        result.trials = trials;
+        result.p50_us = percentile(times, 0.5);
+        result.p99_us = percentile(times, 0.99);
+        result.gbps = result.bytes / (result.p50_us * 1e3);
+        result.launches_per_second = trials / (elapsed / 1e3);
+        sweep.results.push_back(result);
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipEventDestroy(start));
+    HIP_CHECK(hipEventDestroy(stop));
+    HIP_CHECK(hipStreamDestroy(stream));
+    HIP_CHECK(hipFree(data));
+}
+
+void print_sweep_results(const sweep_context& sweep,
+                         const std::string& format,
+                         const int version,
+                         const std::string& device_name)
+{
+    std::cout << std::fixed << std::setprecision(3);
+    if (format == "json")
+    {
+        std::cout << "{" << std::endl
+                  << "  \"rocrand_version\": " << version << "," << std::endl
+                  << "  \"device\": \"" << device_name << "\"," << std::endl
+                  << "  \"peak_gbps\": " << sweep.peak_gbps << "," << std::endl
+                  << "  \"results\": [" << std::endl;
+        for (size_t i = 0; i < sweep.results.size(); i++)
+        {
+            const sweep_result& r = sweep.results[i];
+            std::cout << "    {\"engine\": \"" << r.engine << "\""
+                      << ", \"distribution\": \"" << r.distribution << "\""
+                      << ", \"lambda\": " << r.lambda
+                      << ", \"size\": " << r.size
+                      << ", \"bytes\": " << r.bytes
+                      << ", \"trials\": " << r.trials
+                      << ", \"p50_us\": " << r.p50_us
+                      << ", \"p99_us\": " << r.p99_us
+                      << ", \"gbps\": " << r.gbps
+                      << ", \"peak_fraction\": " << r.gbps / sweep.peak_gbps
+                      << ", \"launches_per_second\": " << r.launches_per_second
+                      << "}" << (i + 1 < sweep.results.size() ? "," : "") << std::endl;
+        }
+        std::cout << "  ]" << std::endl
+                  << "}" << std::endl;
+        return;
+    }
+
+    std::cout << "engine,distribution,lambda,size,bytes,trials,"
+              << "p50_us,p99_us,gbps,peak_gbps,peak_fraction,launches_per_second" << std::endl;
+    for (const sweep_result& r : sweep.results)
+    {
+        std::cout << r.engine << ","
+                  << r.distribution << ","
+                  << r.lambda << ","
+                  << r.size << ","
+                  << r.bytes << ","
+                  << r.trials << ","
+                  << r.p50_us << ","
+                  << r.p99_us << ","
+                  << r.gbps << ","
+                  << sweep.peak_gbps << ","
+                  << r.gbps / sweep.peak_gbps << ","
+                  << r.launches_per_second << std::endl;
+    }
+}
+
 template<typename T>
 void run_benchmark(const cli::Parser& parser,
                    const rng_type_t rng_type,
-                   generate_func_type<T> generate_func)
+                   generate_func_type<T> generate_func,
+                   sweep_context& sweep)
 {
+    if (sweep.enabled)
+    {
+        run_sweep_benchmark<T>(parser, rng_type, generate_func, sweep);
+        return;
+    }
+
     const size_t size0 = parser.get<size_t>("size");
     const size_t trials = parser.get<size_t>("trials");
     const size_t dimensions = parser.get<size_t>("dimensions");
@@ -119,14 +307,18 @@ void run_benchmark(const cli::Parser& parser,
 
 void run_benchmarks(const cli::Parser& parser,
                     const rng_type_t rng_type,
-                    const std::string& distribution)
+                    const std::string& distribution,
+                    sweep_context& sweep)
 {
+    sweep.distribution = distribution;
+    sweep.lambda = 0.0;
     if (distribution == "uniform-uint")
     {
         run_benchmark<unsigned int>(parser, rng_type,
             [](rocrand_generator gen, unsigned int * data, size_t size) {
                 return rocrand_generate(gen, data, size);
-            }
+            },
+            sweep
         );
     }
     if (distribution == "uniform-uchar")
@@ -134,7 +326,8 @@ void run_benchmarks(const cli::Parser& parser,
         run_benchmark<unsigned char>(parser, rng_type,
             [](rocrand_generator gen, unsigned char * data, size_t size) {
                 return rocrand_generate_char(gen, data, size);
-            }
+            },
+            sweep
         );
     }
     if (distribution == "uniform-ushort")
@@ -142,7 +335,17 @@ void run_benchmarks(const cli::Parser& parser,
         run_benchmark<unsigned short>(parser, rng_type,
             [](rocrand_generator gen, unsigned short * data, size_t size) {
                 return rocrand_generate_short(gen, data, size);
-            }
+            },
+            sweep
+        );
+    }
+    if (distribution == "uniform-long-long")
+    {
+        run_benchmark<unsigned long long>(parser, rng_type,
+            [](rocrand_generator gen, unsigned long long * data, size_t size) {
+                return rocrand_generate_long_long(gen, data, size);
+            },
+            sweep
         );
     }
     if (distribution == "uniform-half")
@@ -150,7 +353,35 @@ void run_benchmarks(const cli::Parser& parser,
         run_benchmark<__half>(parser, rng_type,
             [](rocrand_generator gen, __half * data, size_t size) {
                 return rocrand_generate_uniform_half(gen, data, size);
-            }
+            },
+            sweep
+        );
+    }
+    if (distribution == "uniform-bfloat16")
+    {
+        run_benchmark<bfloat16>(parser, rng_type,
+            [](rocrand_generator gen, bfloat16 * data, size_t size) {
+                return rocrand_generate_uniform_bfloat16(gen, data, size);
+            },
+            sweep
+        );
+    }
+    if (distribution == "uniform-int8")
+    {
+        run_benchmark<signed char>(parser, rng_type,
+            [](rocrand_generator gen, signed char * data, size_t size) {
+                return rocrand_generate_uniform_int8(gen, data, size);
+            },
+            sweep
+        );
+    }
+    if (distribution == "uniform-fp8-e4m3")
+    {
+        run_benchmark<rocrand_fp8_e4m3>(parser, rng_type,
+            [](rocrand_generator gen, rocrand_fp8_e4m3 * data, size_t size) {
+                return rocrand_generate_uniform_fp8_e4m3(gen, data, size);
+            },
+            sweep
         );
     }
     if (distribution == "uniform-float")
@@ -158,7 +389,8 @@ void run_benchmarks(const cli::Parser& parser,
         run_benchmark<float>(parser, rng_type,
             [](rocrand_generator gen, float * data, size_t size) {
                 return rocrand_generate_uniform(gen, data, size);
-            }
+            },
+            sweep
         );
     }
     if (distribution == "uniform-double")
@@ -166,7 +398,8 @@ void run_benchmarks(const cli::Parser& parser,
         run_benchmark<double>(parser, rng_type,
             [](rocrand_generator gen, double * data, size_t size) {
                 return rocrand_generate_uniform_double(gen, data, size);
-            }
+            },
+            sweep
         );
     }
     if (distribution == "normal-half")
@@ -174,7 +407,35 @@ void run_benchmarks(const cli::Parser& parser,
         run_benchmark<__half>(parser, rng_type,
             [](rocrand_generator gen, __half * data, size_t size) {
                 return rocrand_generate_normal_half(gen, data, size, 0.0f, 1.0f);
-            }
+            },
+            sweep
+        );
+    }
+    if (distribution == "normal-bfloat16")
+    {
+        run_benchmark<bfloat16>(parser, rng_type,
+            [](rocrand_generator gen, bfloat16 * data, size_t size) {
+                return rocrand_generate_normal_bfloat16(gen, data, size, bfloat16(0.0f), bfloat16(1.0f));
+            },
+            sweep
+        );
+    }
+    if (distribution == "normal-int8")
+    {
+        run_benchmark<signed char>(parser, rng_type,
+            [](rocrand_generator gen, signed char * data, size_t size) {
+                return rocrand_generate_normal_int8(gen, data, size, 0.0f, 32.0f);
+            },
+            sweep
+        );
+    }
+    if (distribution == "normal-fp8-e4m3")
+    {
+        run_benchmark<rocrand_fp8_e4m3>(parser, rng_type,
+            [](rocrand_generator gen, rocrand_fp8_e4m3 * data, size_t size) {
+                return rocrand_generate_normal_fp8_e4m3(gen, data, size, 0.0f, 1.0f);
+            },
+            sweep
         );
     }
     if (distribution == "normal-float")
@@ -182,7 +443,8 @@ void run_benchmarks(const cli::Parser& parser,
         run_benchmark<float>(parser, rng_type,
             [](rocrand_generator gen, float * data, size_t size) {
                 return rocrand_generate_normal(gen, data, size, 0.0f, 1.0f);
-            }
+            },
+            sweep
         );
     }
     if (distribution == "normal-double")
@@ -190,7 +452,8 @@ void run_benchmarks(const cli::Parser& parser,
         run_benchmark<double>(parser, rng_type,
             [](rocrand_generator gen, double * data, size_t size) {
                 return rocrand_generate_normal_double(gen, data, size, 0.0, 1.0);
-            }
+            },
+            sweep
         );
     }
     if (distribution == "log-normal-half")
@@ -198,7 +461,8 @@ void run_benchmarks(const cli::Parser& parser,
         run_benchmark<__half>(parser, rng_type,
             [](rocrand_generator gen, __half * data, size_t size) {
                 return rocrand_generate_log_normal_half(gen, data, size, 0.0f, 1.0f);
-            }
+            },
+            sweep
         );
     }
     if (distribution == "log-normal-float")
@@ -206,7 +470,8 @@ void run_benchmarks(const cli::Parser& parser,
         run_benchmark<float>(parser, rng_type,
             [](rocrand_generator gen, float * data, size_t size) {
                 return rocrand_generate_log_normal(gen, data, size, 0.0f, 1.0f);
-            }
+            },
+            sweep
         );
     }
     if (distribution == "log-normal-double")
@@ -214,7 +479,8 @@ void run_benchmarks(const cli::Parser& parser,
         run_benchmark<double>(parser, rng_type,
             [](rocrand_generator gen, double * data, size_t size) {
                 return rocrand_generate_log_normal_double(gen, data, size, 0.0, 1.0);
-            }
+            },
+            sweep
         );
     }
     if (distribution == "poisson")
@@ -222,12 +488,17 @@ void run_benchmarks(const cli::Parser& parser,
         const auto lambdas = parser.get<std::vector<double>>("lambda");
         for (double lambda : lambdas)
         {
-            std::cout << "    " << "lambda "
-                 << std::fixed << std::setprecision(1) << lambda << std::endl;
+            sweep.lambda = lambda;
+            if (!sweep.enabled)
+            {
+                std::cout << "    " << "lambda "
+                     << std::fixed << std::setprecision(1) << lambda << std::endl;
+            }
             run_benchmark<unsigned int>(parser, rng_type,
                 [lambda](rocrand_generator gen, unsigned int * data, size_t size) {
                     return rocrand_generate_poisson(gen, data, size, lambda);
-                }
+                },
+                sweep
             );
         }
     }
@@ -238,7 +509,16 @@ const std::vector<std::string> all_engines = {
     "mrg32k3a",
     "mtgp32",
     "philox",
+    "philox4x32_7",
+    "philox4x64",
+    "threefry2x64",
+    "threefry4x64",
+    "xoshiro128pp",
+    "pcg32",
     "sobol32",
+    "scrambled_sobol32",
+    "sobol64",
+    "scrambled_sobol64",
 };
 
 const std::vector<std::string> all_distributions = {
@@ -246,10 +526,16 @@ const std::vector<std::string> all_distributions = {
     "uniform-uchar",
     "uniform-ushort",
     "uniform-half",
-    // "uniform-long-long",
+    "uniform-bfloat16",
+    "uniform-int8",
+    "uniform-fp8-e4m3",
+    "uniform-long-long",
     "uniform-float",
     "uniform-double",
     "normal-half",
+    "normal-bfloat16",
+    "normal-int8",
+    "normal-fp8-e4m3",
     "normal-float",
     "normal-double",
     "log-normal-half",
@@ -285,6 +571,11 @@ int main(int argc, char *argv[])
     parser.set_optional<std::vector<std::string>>("dis", "dis", {"uniform-uint"}, distribution_desc.c_str());
     parser.set_optional<std::vector<std::string>>("engine", "engine", {"philox"}, engine_desc.c_str());
     parser.set_optional<std::vector<double>>("lambda", "lambda", {10.0}, "space-separated list of lambdas of Poisson distribution");
+    parser.set_optional<bool>("sweep", "sweep", false, "sweep sizes and report latency percentiles instead of the throughput of one size");
+    parser.set_optional<size_t>("sweep-min", "sweep-min", 1024, "smallest number of values of the sweep");
+    parser.set_optional<size_t>("sweep-max", "sweep-max", 1024 * 1024, "largest number of values of the sweep (sizes are doubled)");
+    parser.set_optional<size_t>("sweep-trials", "sweep-trials", 1000, "number of timed calls of every size of the sweep");
+    parser.set_optional<std::string>("format", "format", "csv", "output format of the sweep: csv or json");
     parser.run_and_exit_if_error();
 
     std::vector<std::string> engines;
@@ -330,10 +621,24 @@ int main(int argc, char *argv[])
     hipDeviceProp_t props;
     HIP_CHECK(hipGetDeviceProperties(&props, device_id));
 
-    std::cout << "rocRAND: " << version << " ";
-    std::cout << "Runtime: " << runtime_version << " ";
-    std::cout << "Device: " << props.name;
-    std::cout << std::endl << std::endl;
+    sweep_context sweep;
+    sweep.enabled = parser.get<bool>("sweep");
+    // memoryClockRate is in kHz, data is transferred on both edges of the clock
+    sweep.peak_gbps = 2.0 * props.memoryClockRate * 1e3 * (props.memoryBusWidth / 8) / 1e9;
+    const std::string format = parser.get<std::string>("format");
+    if (sweep.enabled && format != "csv" && format != "json")
+    {
+        std::cout << "Wrong format" << std::endl;
+        exit(1);
+    }
+
+    if (!sweep.enabled)
+    {
+        std::cout << "rocRAND: " << version << " ";
+        std::cout << "Runtime: " << runtime_version << " ";
+        std::cout << "Device: " << props.name;
+        std::cout << std::endl << std::endl;
+    }
 
     for (auto engine : engines)
     {
@@ -344,8 +649,26 @@ int main(int argc, char *argv[])
             rng_type = ROCRAND_RNG_PSEUDO_MRG32K3A;
         else if (engine == "philox")
             rng_type = ROCRAND_RNG_PSEUDO_PHILOX4_32_10;
+        else if (engine == "philox4x32_7")
+            rng_type = ROCRAND_RNG_PSEUDO_PHILOX4_32_7;
+        else if (engine == "philox4x64")
+            rng_type = ROCRAND_RNG_PSEUDO_PHILOX4_64_10;
+        else if (engine == "threefry2x64")
+            rng_type = ROCRAND_RNG_PSEUDO_THREEFRY2_64_20;
+        else if (engine == "threefry4x64")
+            rng_type = ROCRAND_RNG_PSEUDO_THREEFRY4_64_20;
+        else if (engine == "xoshiro128pp")
+            rng_type = ROCRAND_RNG_PSEUDO_XOSHIRO128PP;
+        else if (engine == "pcg32")
+            rng_type = ROCRAND_RNG_PSEUDO_PCG32;
         else if (engine == "sobol32")
             rng_type = ROCRAND_RNG_QUASI_SOBOL32;
+        else if (engine == "scrambled_sobol32")
+            rng_type = ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32;
+        else if (engine == "sobol64")
+            rng_type = ROCRAND_RNG_QUASI_SOBOL64;
+        else if (engine == "scrambled_sobol64")
+            rng_type = ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64;
         else if (engine == "mtgp32")
             rng_type = ROCRAND_RNG_PSEUDO_MTGP32;
         else
@@ -354,15 +677,30 @@ int main(int argc, char *argv[])
             exit(1);
         }
 
+        sweep.engine = engine;
+        if (sweep.enabled)
+        {
+            for (auto distribution : distributions)
+            {
+                run_benchmarks(parser, rng_type, distribution, sweep);
+            }
+            continue;
+        }
+
         std::cout << engine << ":" << std::endl;
 
         for (auto distribution : distributions)
         {
             std::cout << "  " << distribution << ":" << std::endl;
-            run_benchmarks(parser, rng_type, distribution);
+            run_benchmarks(parser, rng_type, distribution, sweep);
         }
         std::cout << std::endl;
     }
 
+    if (sweep.enabled)
+    {
+        print_sweep_results(sweep, format, version, props.name);
+    }
+
     return 0;
 }
@@ -491,6 +491,10 @@ const std::vector<std::string> all_engines = {
     "mtgp32",
     // "mt19937",
     "philox",
+    "philox4x32_7",
+    "philox4x64",
+    "threefry2x64",
+    "threefry4x64",
     "sobol32",
     // "scrambled_sobol32",
     // "sobol64",
@@ -609,6 +613,22 @@ int main(int argc, char *argv[])
             {
                 run_benchmarks<rocrand_state_philox4x32_10>(parser, distribution);
             }
+            else if (engine == "philox4x32_7")
+            {
+                run_benchmarks<rocrand_state_philox4x32_7>(parser, distribution);
+            }
+            else if (engine == "philox4x64")
+            {
+                run_benchmarks<rocrand_state_philox4x64_10>(parser, distribution);
+            }
+            else if (engine == "threefry2x64")
+            {
+                run_benchmarks<rocrand_state_threefry2x64_20>(parser, distribution);
+            }
+            else if (engine == "threefry4x64")
+            {
+                run_benchmarks<rocrand_state_threefry4x64_20>(parser, distribution);
+            }
             else if (engine == "sobol32")
             {
                 run_benchmarks<rocrand_state_sobol32>(parser, distribution);
@@ -0,0 +1,693 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// All rocRAND benchmarks registered in Google Benchmark:
+//   host/<engine>/<distribution>/<size>  - rocrand_generate_*() of the host API
+//   host/<engine>/init                   - seed reset and initialization of a generator
+//   host/<engine>/startup/<size>         - creation, seeding and the first generate call
+//   host/<engine>/poisson-switch[-cached]/<size>
+//                                        - rocrand_generate_poisson() alternating two lambdas
+//   device/<engine>/init/<subsequence>/<offset>
+//                                        - rocrand_init() of the device API
+//   device/<engine>/<distribution>/<size> - device functions called from a kernel
+//   discrete/poisson-create/<lambda>     - rocrand_create_poisson_distribution()
+//   discrete/custom-create/<size>        - rocrand_create_discrete_distribution()
+// Cases are selected with --benchmark_filter=<regex>, all Google Benchmark
+// options (--benchmark_format=json etc.) are supported.
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <functional>
+
+#include <benchmark/benchmark.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+#include <rocrand_kernel.h>
+
+#define HIP_CHECK(condition)         \
+  {                                  \
+    hipError_t error = condition;    \
+    if(error != hipSuccess){         \
+        std::cout << "HIP error: " << error << " line: " << __LINE__ << std::endl; \
+        exit(error); \
+    } \
+  }
+
+#define ROCRAND_CHECK(condition)                 \
+  {                                              \
+    rocrand_status status = condition;           \
+    if(status != ROCRAND_STATUS_SUCCESS) {       \
+        std::cout << "ROCRAND error: " << status << " line: " << __LINE__ << std::endl; \
+        exit(status); \
+    } \
+  }
+
+// Sizes of generate cases: 64K, 1M and 16M values
+const int min_size = 1 << 16;
+const int max_size = 1 << 24;
+const int size_multiplier = 16;
+
+// Number of states of device API cases
+const size_t device_blocks = 256;
+const size_t device_threads = 256;
+
+const double poisson_lambda = 10.0;
+const double poisson_switch_lambdas[2] = { 10.0, 20.0 };
+
+template<typename T>
+using generate_func_type = std::function<rocrand_status(rocrand_generator, T *, size_t)>;
+
+// Measures time of operations enqueued in stream by events
+class event_timer
+{
+public:
+    event_timer(hipStream_t stream) : m_stream(stream)
+    {
+        HIP_CHECK(hipEventCreate(&m_start));
+        HIP_CHECK(hipEventCreate(&m_stop));
+    }
+
+    ~event_timer()
+    {
+        HIP_CHECK(hipEventDestroy(m_start));
+        HIP_CHECK(hipEventDestroy(m_stop));
+    }
+
+    void start()
+    {
+        HIP_CHECK(hipEventRecord(m_start, m_stream));
+    }
+
+    // Returns time in seconds since start()
+    double stop()
+    {
+        HIP_CHECK(hipEventRecord(m_stop, m_stream));
+        HIP_CHECK(hipEventSynchronize(m_stop));
+        float elapsed;
+        HIP_CHECK(hipEventElapsedTime(&elapsed, m_start, m_stop));
+        return elapsed / 1e3;
+    }
+
+private:
+    hipStream_t m_stream;
+    hipEvent_t m_start;
+    hipEvent_t m_stop;
+};
+
+void set_counters(benchmark::State& state, const size_t items, const size_t bytes)
+{
+    state.SetItemsProcessed(state.iterations() * items);
+    state.SetBytesProcessed(state.iterations() * bytes);
+}
+
+// Creates a generator with its own stream, returns false (and skips
+// the case) if the generator does not support the request
+template<typename T>
+bool create_generator(benchmark::State& state,
+                      const rocrand_rng_type rng_type,
+                      rocrand_generator& generator,
+                      hipStream_t& stream,
+                      T * data,
+                      const size_t size,
+                      const generate_func_type<T>& generate_func)
+{
+    HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_stream(generator, stream));
+    ROCRAND_CHECK(rocrand_initialize_generator(generator));
+    // Warm-up
+    const rocrand_status status = generate_func(generator, data, size);
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        state.SkipWithError(status == ROCRAND_STATUS_TYPE_ERROR
+            ? "Not supported by the engine" : "Generation failed");
+        return false;
+    }
+    HIP_CHECK(hipStreamSynchronize(stream));
+    return true;
+}
+
+template<typename T>
+void run_host_generate(benchmark::State& state,
+                       const rocrand_rng_type rng_type,
+                       const generate_func_type<T>& generate_func)
+{
+    const size_t size = state.range(0);
+    T * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(T)));
+
+    rocrand_generator generator;
+    hipStream_t stream;
+    if(create_generator<T>(state, rng_type, generator, stream, data, size, generate_func))
+    {
+        event_timer timer(stream);
+        for(auto _ : state)
+        {
+            timer.start();
+            ROCRAND_CHECK(generate_func(generator, data, size));
+            state.SetIterationTime(timer.stop());
+        }
+        set_counters(state, size, size * sizeof(T));
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipStreamDestroy(stream));
+    HIP_CHECK(hipFree(data));
+}
+
+// Every iteration changes the seed, so the generator initializes
+// its engines again (seed reset cost)
+void run_host_init(benchmark::State& state, const rocrand_rng_type rng_type)
+{
+    rocrand_generator generator;
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_stream(generator, stream));
+    ROCRAND_CHECK(rocrand_initialize_generator(generator));
+    HIP_CHECK(hipStreamSynchronize(stream));
+
+    unsigned long long seed = 1;
+    for(auto _ : state)
+    {
+        const auto start = std::chrono::high_resolution_clock::now();
+        const rocrand_status status = rocrand_set_seed(generator, seed++);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            state.SkipWithError("Seeds are not supported by the engine");
+            break;
+        }
+        ROCRAND_CHECK(rocrand_initialize_generator(generator));
+        HIP_CHECK(hipStreamSynchronize(stream));
+        const auto end = std::chrono::high_resolution_clock::now();
+        state.SetIterationTime(std::chrono::duration<double>(end - start).count());
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipStreamDestroy(stream));
+}
+
+// Cost of a short job: the generator is created, seeded and initialized
+// by the first call in every iteration, so skipahead of all engines is measured
+void run_host_startup(benchmark::State& state, const rocrand_rng_type rng_type)
+{
+    const size_t size = state.range(0);
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+
+    unsigned long long seed = 1;
+    for(auto _ : state)
+    {
+        const auto start = std::chrono::high_resolution_clock::now();
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+        ROCRAND_CHECK(rocrand_set_stream(generator, stream));
+        const rocrand_status status = rocrand_set_seed(generator, seed++);
+        // Quasi-random generators do not have seeds
+        if(status != ROCRAND_STATUS_TYPE_ERROR)
+        {
+            ROCRAND_CHECK(status);
+        }
+        ROCRAND_CHECK(rocrand_generate(generator, data, size));
+        HIP_CHECK(hipStreamSynchronize(stream));
+        const auto end = std::chrono::high_resolution_clock::now();
+        state.SetIterationTime(std::chrono::duration<double>(end - start).count());
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+    set_counters(state, size, size * sizeof(unsigned int));
+
+    HIP_CHECK(hipStreamDestroy(stream));
+    HIP_CHECK(hipFree(data));
+}
+
+// Alternates two lambdas, with cache_capacity = 1 tables are rebuilt
+// by every call, with 2 they are reused
+void run_host_poisson_switch(benchmark::State& state,
+                             const rocrand_rng_type rng_type,
+                             const size_t cache_capacity)
+{
+    const size_t size = state.range(0);
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+
+    rocrand_generator generator;
+    hipStream_t stream;
+    const generate_func_type<unsigned int> warmup_func =
+        [](rocrand_generator gen, unsigned int * data, size_t size) {
+            return rocrand_generate_poisson(gen, data, size, poisson_switch_lambdas[0]);
+        };
+    if(create_generator(state, rng_type, generator, stream, data, size, warmup_func))
+    {
+        ROCRAND_CHECK(rocrand_set_poisson_cache_capacity(generator, cache_capacity));
+        size_t i = 0;
+        for(auto _ : state)
+        {
+            const double lambda = poisson_switch_lambdas[i++ % 2];
+            const auto start = std::chrono::high_resolution_clock::now();
+            ROCRAND_CHECK(rocrand_generate_poisson(generator, data, size, lambda));
+            HIP_CHECK(hipStreamSynchronize(stream));
+            const auto end = std::chrono::high_resolution_clock::now();
+            state.SetIterationTime(std::chrono::duration<double>(end - start).count());
+        }
+        set_counters(state, size, size * sizeof(unsigned int));
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipStreamDestroy(stream));
+    HIP_CHECK(hipFree(data));
+}
+
+void run_poisson_create(benchmark::State& state)
+{
+    const double lambda = state.range(0);
+    for(auto _ : state)
+    {
+        const auto start = std::chrono::high_resolution_clock::now();
+        rocrand_discrete_distribution discrete_distribution;
+        ROCRAND_CHECK(rocrand_create_poisson_distribution(lambda, &discrete_distribution));
+        ROCRAND_CHECK(rocrand_destroy_discrete_distribution(discrete_distribution));
+        const auto end = std::chrono::high_resolution_clock::now();
+        state.SetIterationTime(std::chrono::duration<double>(end - start).count());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void run_custom_create(benchmark::State& state)
+{
+    const size_t size = state.range(0);
+    std::vector<double> probabilities(size);
+    for(size_t i = 0; i < size; i++)
+    {
+        probabilities[i] = static_cast<double>(i % 7 + 1);
+    }
+    double sum = 0.0;
+    for(double p : probabilities)
+    {
+        sum += p;
+    }
+    for(double& p : probabilities)
+    {
+        p /= sum;
+    }
+
+    for(auto _ : state)
+    {
+        const auto start = std::chrono::high_resolution_clock::now();
+        rocrand_discrete_distribution discrete_distribution;
+        ROCRAND_CHECK(
+            rocrand_create_discrete_distribution(
+                probabilities.data(), static_cast<unsigned int>(size), 0,
+                &discrete_distribution
+            )
+        );
+        ROCRAND_CHECK(rocrand_destroy_discrete_distribution(discrete_distribution));
+        const auto end = std::chrono::high_resolution_clock::now();
+        state.SetIterationTime(std::chrono::duration<double>(end - start).count());
+    }
+    set_counters(state, size, size * sizeof(double));
+}
+
+template<typename GeneratorState>
+__global__
+void init_kernel(GeneratorState * states,
+                 const unsigned long long seed,
+                 const unsigned long long subsequence,
+                 const unsigned long long offset)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    GeneratorState state;
+    rocrand_init(seed, subsequence + state_id, offset, &state);
+    states[state_id] = state;
+}
+
+template<typename T, typename GeneratorState, typename GenerateFunc, typename Extra>
+__global__
+void generate_kernel(GeneratorState * states,
+                     T * data,
+                     const size_t size,
+                     GenerateFunc generate_func,
+                     const Extra extra)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+    GeneratorState state = states[state_id];
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        data[index] = generate_func(&state, extra);
+        index += stride;
+    }
+    states[state_id] = state;
+}
+
+// Time of rocrand_init() depends on the distance of skipahead: states start
+// at subsequence state.range(0) + state_id and offset state.range(1)
+template<typename GeneratorState>
+void run_device_init(benchmark::State& state)
+{
+    const unsigned long long subsequence = state.range(0);
+    const unsigned long long offset = state.range(1);
+    const size_t states_size = device_blocks * device_threads;
+    GeneratorState * states;
+    HIP_CHECK(hipMalloc((void **)&states, states_size * sizeof(GeneratorState)));
+
+    event_timer timer(0);
+    unsigned long long seed = 1;
+    for(auto _ : state)
+    {
+        timer.start();
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(init_kernel),
+            dim3(device_blocks), dim3(device_threads), 0, 0,
+            states, seed++, subsequence, offset
+        );
+        HIP_CHECK(hipPeekAtLastError());
+        state.SetIterationTime(timer.stop());
+    }
+    set_counters(state, states_size, states_size * sizeof(GeneratorState));
+
+    HIP_CHECK(hipFree(states));
+}
+
+template<typename T, typename GeneratorState, typename GenerateFunc, typename Extra>
+void run_device_generate(benchmark::State& state,
+                         const GenerateFunc& generate_func,
+                         const Extra extra)
+{
+    const size_t size = state.range(0);
+    const size_t states_size = device_blocks * device_threads;
+    GeneratorState * states;
+    T * data;
+    HIP_CHECK(hipMalloc((void **)&states, states_size * sizeof(GeneratorState)));
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(T)));
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(init_kernel),
+        dim3(device_blocks), dim3(device_threads), 0, 0,
+        states, 12345ULL, 0ULL, 6789ULL
+    );
+    HIP_CHECK(hipPeekAtLastError());
+    HIP_CHECK(hipDeviceSynchronize());
+
+    event_timer timer(0);
+    for(auto _ : state)
+    {
+        timer.start();
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(generate_kernel),
+            dim3(device_blocks), dim3(device_threads), 0, 0,
+            states, data, size, generate_func, extra
+        );
+        HIP_CHECK(hipPeekAtLastError());
+        state.SetIterationTime(timer.stop());
+    }
+    set_counters(state, size, size * sizeof(T));
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(states));
+}
+
+benchmark::internal::Benchmark * configure(benchmark::internal::Benchmark * b)
+{
+    return b->UseManualTime()->Unit(benchmark::kMicrosecond);
+}
+
+benchmark::internal::Benchmark * configure_sizes(benchmark::internal::Benchmark * b)
+{
+    return configure(b)->RangeMultiplier(size_multiplier)->Range(min_size, max_size);
+}
+
+template<typename T>
+void register_host_generate(const std::string& name,
+                            const rocrand_rng_type rng_type,
+                            const generate_func_type<T> generate_func)
+{
+    configure_sizes(
+        benchmark::RegisterBenchmark(name.c_str(),
+            [rng_type, generate_func](benchmark::State& state) {
+                run_host_generate<T>(state, rng_type, generate_func);
+            }
+        )
+    );
+}
+
+void register_host_benchmarks(const std::string& engine, const rocrand_rng_type rng_type)
+{
+    const std::string prefix = "host/" + engine + "/";
+
+    register_host_generate<unsigned int>(prefix + "uniform-uint", rng_type,
+        [](rocrand_generator gen, unsigned int * data, size_t size) {
+            return rocrand_generate(gen, data, size);
+        }
+    );
+    register_host_generate<unsigned char>(prefix + "uniform-uchar", rng_type,
+        [](rocrand_generator gen, unsigned char * data, size_t size) {
+            return rocrand_generate_char(gen, data, size);
+        }
+    );
+    register_host_generate<unsigned short>(prefix + "uniform-ushort", rng_type,
+        [](rocrand_generator gen, unsigned short * data, size_t size) {
+            return rocrand_generate_short(gen, data, size);
+        }
+    );
+    register_host_generate<unsigned long long>(prefix + "uniform-long-long", rng_type,
+        [](rocrand_generator gen, unsigned long long * data, size_t size) {
+            return rocrand_generate_long_long(gen, data, size);
+        }
+    );
+    register_host_generate<__half>(prefix + "uniform-half", rng_type,
+        [](rocrand_generator gen, __half * data, size_t size) {
+            return rocrand_generate_uniform_half(gen, data, size);
+        }
+    );
+    register_host_generate<float>(prefix + "uniform-float", rng_type,
+        [](rocrand_generator gen, float * data, size_t size) {
+            return rocrand_generate_uniform(gen, data, size);
+        }
+    );
+    register_host_generate<double>(prefix + "uniform-double", rng_type,
+        [](rocrand_generator gen, double * data, size_t size) {
+            return rocrand_generate_uniform_double(gen, data, size);
+        }
+    );
+    register_host_generate<__half>(prefix + "normal-half", rng_type,
+        [](rocrand_generator gen, __half * data, size_t size) {
+            return rocrand_generate_normal_half(gen, data, size, __float2half(0.0f), __float2half(1.0f));
+        }
+    );
+    register_host_generate<float>(prefix + "normal-float", rng_type,
+        [](rocrand_generator gen, float * data, size_t size) {
+            return rocrand_generate_normal(gen, data, size, 0.0f, 1.0f);
+        }
+    );
+    register_host_generate<double>(prefix + "normal-double", rng_type,
+        [](rocrand_generator gen, double * data, size_t size) {
+            return rocrand_generate_normal_double(gen, data, size, 0.0, 1.0);
+        }
+    );
+    register_host_generate<float>(prefix + "log-normal-float", rng_type,
+        [](rocrand_generator gen, float * data, size_t size) {
+            return rocrand_generate_log_normal(gen, data, size, 0.0f, 1.0f);
+        }
+    );
+    register_host_generate<double>(prefix + "log-normal-double", rng_type,
+        [](rocrand_generator gen, double * data, size_t size) {
+            return rocrand_generate_log_normal_double(gen, data, size, 0.0, 1.0);
+        }
+    );
+    register_host_generate<unsigned int>(prefix + "poisson", rng_type,
+        [](rocrand_generator gen, unsigned int * data, size_t size) {
+            return rocrand_generate_poisson(gen, data, size, poisson_lambda);
+        }
+    );
+
+    configure(
+        benchmark::RegisterBenchmark((prefix + "init").c_str(),
+            [rng_type](benchmark::State& state) {
+                run_host_init(state, rng_type);
+            }
+        )
+    );
+    configure(
+        benchmark::RegisterBenchmark((prefix + "startup").c_str(),
+            [rng_type](benchmark::State& state) {
+                run_host_startup(state, rng_type);
+            }
+        )
+    )->Arg(1 << 10)->Arg(1 << 20);
+    configure_sizes(
+        benchmark::RegisterBenchmark((prefix + "poisson-switch").c_str(),
+            [rng_type](benchmark::State& state) {
+                run_host_poisson_switch(state, rng_type, 1);
+            }
+        )
+    );
+    configure_sizes(
+        benchmark::RegisterBenchmark((prefix + "poisson-switch-cached").c_str(),
+            [rng_type](benchmark::State& state) {
+                run_host_poisson_switch(state, rng_type, 2);
+            }
+        )
+    );
+}
+
+template<typename T, typename GeneratorState, typename GenerateFunc, typename Extra>
+void register_device_generate(const std::string& name,
+                              const GenerateFunc& generate_func,
+                              const Extra extra)
+{
+    configure_sizes(
+        benchmark::RegisterBenchmark(name.c_str(),
+            [generate_func, extra](benchmark::State& state) {
+                run_device_generate<T, GeneratorState>(state, generate_func, extra);
+            }
+        )
+    );
+}
+
+template<typename GeneratorState>
+void register_device_benchmarks(const std::string& engine)
+{
+    const std::string prefix = "device/" + engine + "/";
+
+    configure(
+        benchmark::RegisterBenchmark((prefix + "init").c_str(),
+            [](benchmark::State& state) {
+                run_device_init<GeneratorState>(state);
+            }
+        )
+    )->Args({0, 0})->Args({1 << 20, 0})->Args({1LL << 40, 0})
+     ->Args({0, 1 << 20})->Args({0, 1LL << 40})->Args({1LL << 40, 1LL << 40});
+
+    register_device_generate<unsigned int, GeneratorState>(prefix + "uniform-uint",
+        [] __device__ (GeneratorState * state, int) {
+            return rocrand(state);
+        }, 0
+    );
+    register_device_generate<float, GeneratorState>(prefix + "uniform-float",
+        [] __device__ (GeneratorState * state, int) {
+            return rocrand_uniform(state);
+        }, 0
+    );
+    register_device_generate<double, GeneratorState>(prefix + "uniform-double",
+        [] __device__ (GeneratorState * state, int) {
+            return rocrand_uniform_double(state);
+        }, 0
+    );
+    register_device_generate<float, GeneratorState>(prefix + "normal-float",
+        [] __device__ (GeneratorState * state, int) {
+            return rocrand_normal(state);
+        }, 0
+    );
+    register_device_generate<double, GeneratorState>(prefix + "normal-double",
+        [] __device__ (GeneratorState * state, int) {
+            return rocrand_normal_double(state);
+        }, 0
+    );
+    register_device_generate<float, GeneratorState>(prefix + "log-normal-float",
+        [] __device__ (GeneratorState * state, int) {
+            return rocrand_log_normal(state, 0.0f, 1.0f);
+        }, 0
+    );
+    register_device_generate<double, GeneratorState>(prefix + "log-normal-double",
+        [] __device__ (GeneratorState * state, int) {
+            return rocrand_log_normal_double(state, 0.0, 1.0);
+        }, 0
+    );
+    register_device_generate<unsigned int, GeneratorState>(prefix + "poisson",
+        [] __device__ (GeneratorState * state, double lambda) {
+            return rocrand_poisson(state, lambda);
+        }, poisson_lambda
+    );
+}
+
+struct host_engine
+{
+    const char * name;
+    rocrand_rng_type rng_type;
+};
+
+const host_engine host_engines[] = {
+    { "xorwow", ROCRAND_RNG_PSEUDO_XORWOW },
+    { "mrg32k3a", ROCRAND_RNG_PSEUDO_MRG32K3A },
+    { "mtgp32", ROCRAND_RNG_PSEUDO_MTGP32 },
+    { "philox", ROCRAND_RNG_PSEUDO_PHILOX4_32_10 },
+    { "philox4x32_7", ROCRAND_RNG_PSEUDO_PHILOX4_32_7 },
+    { "philox4x64", ROCRAND_RNG_PSEUDO_PHILOX4_64_10 },
+    { "threefry2x64", ROCRAND_RNG_PSEUDO_THREEFRY2_64_20 },
+    { "threefry4x64", ROCRAND_RNG_PSEUDO_THREEFRY4_64_20 },
+    { "xoshiro128pp", ROCRAND_RNG_PSEUDO_XOSHIRO128PP },
+    { "pcg32", ROCRAND_RNG_PSEUDO_PCG32 },
+    { "sobol32", ROCRAND_RNG_QUASI_SOBOL32 },
+    { "scrambled_sobol32", ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32 },
+    { "sobol64", ROCRAND_RNG_QUASI_SOBOL64 },
+    { "scrambled_sobol64", ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64 }
+};
+
+int main(int argc, char *argv[])
+{
+    benchmark::Initialize(&argc, argv);
+
+    int version;
+    ROCRAND_CHECK(rocrand_get_version(&version));
+    int runtime_version;
+    HIP_CHECK(hipRuntimeGetVersion(&runtime_version));
+    int device_id;
+    HIP_CHECK(hipGetDevice(&device_id));
+    hipDeviceProp_t props;
+    HIP_CHECK(hipGetDeviceProperties(&props, device_id));
+
+    // Results may be printed to stdout in a machine-readable format
+    std::cerr << "rocRAND: " << version << " ";
+    std::cerr << "Runtime: " << runtime_version << " ";
+    std::cerr << "Device: " << props.name;
+    std::cerr << std::endl << std::endl;
+
+    for(const host_engine& engine : host_engines)
+    {
+        register_host_benchmarks(engine.name, engine.rng_type);
+    }
+
+    // Engines of the device API initialized by rocrand_init(seed, subsequence, offset, state),
+    // MTGP32 and Sobol states need tables prepared on the host and are only
+    // measured through the host API
+    register_device_benchmarks<rocrand_state_xorwow>("xorwow");
+    register_device_benchmarks<rocrand_state_mrg32k3a>("mrg32k3a");
+    register_device_benchmarks<rocrand_state_philox4x32_10>("philox");
+    register_device_benchmarks<rocrand_state_philox4x32_7>("philox4x32_7");
+    register_device_benchmarks<rocrand_state_philox4x64_10>("philox4x64");
+    register_device_benchmarks<rocrand_state_threefry2x64_20>("threefry2x64");
+    register_device_benchmarks<rocrand_state_threefry4x64_20>("threefry4x64");
+
+    configure(benchmark::RegisterBenchmark("discrete/poisson-create", run_poisson_create))
+        ->Arg(10)->Arg(100)->Arg(1000);
+    configure(benchmark::RegisterBenchmark("discrete/custom-create", run_custom_create))
+        ->RangeMultiplier(16)->Range(16, 1 << 20);
+
+    benchmark::RunSpecifiedBenchmarks();
+    return 0;
+}
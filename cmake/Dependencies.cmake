@@ -34,6 +34,10 @@ endif()
 # For downloading, building, and installing required dependencies
 include(cmake/DownloadProject.cmake)
 
+# Threads are used by host-side generators
+set(THREADS_PREFER_PTHREAD_FLAG ON)
+find_package(Threads REQUIRED)
+
 # Fortran Wrapper
 if(BUILD_FORTRAN_WRAPPER)
     enable_language(Fortran)
@@ -64,6 +68,31 @@ if(BUILD_TEST)
     find_package(GTest REQUIRED)
 endif()
 
+# Benchmark dependencies
+if(BUILD_BENCHMARK)
+    if(NOT DEPENDENCIES_FORCE_DOWNLOAD)
+        find_package(benchmark QUIET)
+    endif()
+
+    if(NOT benchmark_FOUND)
+        message(STATUS "Google Benchmark not found. Downloading and building Google Benchmark.")
+        # Download, build and install Google Benchmark library
+        set(GOOGLEBENCHMARK_ROOT ${CMAKE_CURRENT_BINARY_DIR}/googlebenchmark CACHE PATH "")
+        download_project(PROJ                googlebenchmark
+                         GIT_REPOSITORY      https://github.com/google/benchmark.git
+                         GIT_TAG             v1.5.0
+                         INSTALL_DIR         ${GOOGLEBENCHMARK_ROOT}
+                         CMAKE_ARGS          -DCMAKE_BUILD_TYPE=RELEASE -DBENCHMARK_ENABLE_TESTING=OFF -DCMAKE_INSTALL_PREFIX=<INSTALL_DIR>
+                         LOG_DOWNLOAD        TRUE
+                         LOG_CONFIGURE       TRUE
+                         LOG_BUILD           TRUE
+                         LOG_INSTALL         TRUE
+                         UPDATE_DISCONNECTED TRUE
+        )
+    endif()
+    find_package(benchmark REQUIRED CONFIG PATHS ${GOOGLEBENCHMARK_ROOT})
+endif()
+
 # Find or download/install rocm-cmake project
 find_package(ROCM QUIET CONFIG PATHS /opt/rocm)
 if(NOT ROCM_FOUND)
@@ -272,6 +272,30 @@ hiprandStatus_t HIPRANDAPI
 hiprandGenerateShort(hiprandGenerator_t generator,
                      unsigned short * output_data, size_t n);
 
+/**
+ * \brief Generates uniformly distributed 64-bit unsigned integers.
+ *
+ * Generates \p n uniformly distributed 64-bit unsigned integers and
+ * saves them to \p output_data.
+ *
+ * Generated numbers are between \p 0 and \p 2^64, including \p 0 and
+ * excluding \p 2^64.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 64-bit unsigned integers to generate
+ *
+ * \return
+ * - HIPRAND_STATUS_NOT_INITIALIZED if the generator was not initialized \n
+ * - HIPRAND_STATUS_LAUNCH_FAILURE if generator failed to launch kernel \n
+ * - HIPRAND_STATUS_TYPE_ERROR if the generator does not support 64-bit
+ * integers (cuRAND backend supports them only for 64-bit quasi-random generators) \n
+ * - HIPRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+hiprandStatus_t HIPRANDAPI
+hiprandGenerateLongLong(hiprandGenerator_t generator,
+                        unsigned long long * output_data, size_t n);
+
 /**
  * \brief Generates uniformly distributed floats.
  *
@@ -310,7 +334,8 @@ hiprandGenerateUniform(hiprandGenerator_t generator,
  * \param n - Number of floats to generate
  *
  * Note: When \p generator is of type: \p HIPRAND_RNG_PSEUDO_MRG32K3A,
- * \p HIPRAND_RNG_PSEUDO_MTGP32, or \p HIPRAND_RNG_QUASI_SOBOL32,
+ * \p HIPRAND_RNG_PSEUDO_MTGP32, \p HIPRAND_RNG_QUASI_SOBOL32, or
+ * \p HIPRAND_RNG_QUASI_SCRAMBLED_SOBOL32,
  * then the returned \p double values are generated from only 32 random bits
  * each (one <tt>unsigned int</tt> value per one generated \p double).
  *
@@ -670,6 +695,43 @@ hiprandCreatePoissonDistribution(double lambda, hiprandDiscreteDistribution_t *
 hiprandStatus_t HIPRANDAPI
 hiprandDestroyDistribution(hiprandDiscreteDistribution_t discrete_distribution);
 
+/**
+ * \brief Initializes an array of device API states.
+ *
+ * Initializes \p n states of the device API in device memory \p states:
+ * the \p i-th state is equal to the state initialized by
+ * <tt>hiprand_init(seed, i, offset, &state)</tt> in a kernel.
+ * The initialization is performed asynchronously in \p stream.
+ *
+ * Supported types and types of \p states:
+ * - HIPRAND_RNG_PSEUDO_XORWOW - hiprandStateXORWOW_t \n
+ * - HIPRAND_RNG_PSEUDO_MRG32K3A - hiprandStateMRG32k3a_t \n
+ * - HIPRAND_RNG_PSEUDO_PHILOX4_32_10 - hiprandStatePhilox4_32_10_t \n
+ *
+ * Note: The function is not implemented for cuRAND.
+ *
+ * \param states - Pointer to device memory for \p n states
+ * \param n - Number of states to initialize
+ * \param seed - Seed value
+ * \param offset - Absolute offset of every state
+ * \param rng_type - Type of the states
+ * \param stream - HIP stream of the initialization kernel
+ *
+ * \return
+ * - HIPRAND_STATUS_NOT_IMPLEMENTED if the function is not implemented \n
+ * - HIPRAND_STATUS_OUT_OF_RANGE if \p states is null and \p n is not 0 \n
+ * - HIPRAND_STATUS_TYPE_ERROR if states of \p rng_type are not supported \n
+ * - HIPRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - HIPRAND_STATUS_SUCCESS if the initialization was started successfully \n
+ */
+hiprandStatus_t HIPRANDAPI
+hiprandInitStates(void * states,
+                  size_t n,
+                  unsigned long long seed,
+                  unsigned long long offset,
+                  hiprandRngType_t rng_type,
+                  hipStream_t stream);
+
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
@@ -150,14 +150,16 @@ private:
 ///
 /// \brief Produces random integer values uniformly distributed on the interval [0, 2^32 - 1].
 ///
-/// \tparam IntType - type of generated values. Only \p unsigned \p char, \p unsigned \p short and \p unsigned \p int type is supported.
+/// \tparam IntType - type of generated values. Only \p unsigned \p char, \p unsigned \p short,
+/// \p unsigned \p int and \p unsigned \p long \p long type is supported.
 template<class IntType = unsigned int>
 class uniform_int_distribution
 {
     static_assert(
         std::is_same<unsigned char, IntType>::value
         || std::is_same<unsigned short, IntType>::value
-        || std::is_same<unsigned int, IntType>::value,
+        || std::is_same<unsigned int, IntType>::value
+        || std::is_same<unsigned long long, IntType>::value,
         "Only unsigned int type is supported in uniform_int_distribution"
     );
 
@@ -202,7 +204,8 @@ public:
     /// * If generator \p g is a quasi-random number generator (`hiprand_cpp::sobol32_engine`),
     /// then \p size must be a multiple of that generator's dimension.
     ///
-    /// See also: hiprandGenerate(), hiprandGenerateChar(), hiprandGenerateShort()
+    /// See also: hiprandGenerate(), hiprandGenerateChar(), hiprandGenerateShort(),
+    /// hiprandGenerateLongLong()
     template<class Generator>
     void operator()(Generator& g, IntType * output, size_t size)
     {
@@ -242,6 +245,12 @@ private:
     {
         return hiprandGenerate(g.m_generator, output, size);
     }
+
+    template<class Generator>
+    hiprandStatus_t generate(Generator& g, unsigned long long * output, size_t size)
+    {
+        return hiprandGenerateLongLong(g.m_generator, output, size);
+    }
 };
 
 /// \class uniform_real_distribution
@@ -0,0 +1,183 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef HIPRAND_EXT_H_
+#define HIPRAND_EXT_H_
+
+#include "hiprand.h"
+
+/** \addtogroup hiprandhost
+ *
+ *  @{
+ */
+
+// Extensions of the host API, which are not part of cuRAND API.
+// On rocRAND they map to the corresponding rocRAND functions, on cuRAND
+// they are emulated where possible.
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * \brief Distributions of requests of hiprandGenerateBatch()
+ */
+typedef enum hiprandBatchDistribution {
+    HIPRAND_BATCH_UNIFORM = 0, ///< Floats as hiprandGenerateUniform()
+    HIPRAND_BATCH_UNIFORM_DOUBLE = 1, ///< Doubles as hiprandGenerateUniformDouble()
+    HIPRAND_BATCH_NORMAL = 2, ///< Floats as hiprandGenerateNormal() (mean, stddev)
+    HIPRAND_BATCH_NORMAL_DOUBLE = 3, ///< Doubles as hiprandGenerateNormalDouble() (mean, stddev)
+    HIPRAND_BATCH_POISSON = 4 ///< Unsigned integers as hiprandGeneratePoisson() (lambda)
+} hiprandBatchDistribution_t;
+
+/**
+ * \brief Request of hiprandGenerateBatch()
+ *
+ * Generates \p n values of \p distribution to device memory \p output_data
+ * (host memory for host generators), the type of values depends on the
+ * distribution. Unused parameters are ignored.
+ */
+typedef struct hiprandBatchRequest {
+    hiprandBatchDistribution_t distribution; ///< Distribution of values
+    void * output_data; ///< Pointer to memory to store generated values
+    size_t n; ///< Number of values to generate
+    double parameters[2]; ///< Parameters of the distribution (in the order listed above)
+} hiprandBatchRequest_t;
+
+/**
+ * \brief Generates values of several requests.
+ *
+ * Generates values of \p count requests \p requests, the result is the same as
+ * the result of calls of the corresponding generation functions for the requests
+ * in their order.
+ *
+ * On rocRAND many small requests cost one kernel launch (see rocrand_generate_batch()),
+ * supported generators are HIPRAND_RNG_PSEUDO_XORWOW and HIPRAND_RNG_PSEUDO_MRG32K3A.
+ * On cuRAND the requests are generated one by one by all generators.
+ *
+ * \param generator - Generator to use
+ * \param requests - Pointer to \p count requests in host memory
+ * \param count - Number of requests
+ *
+ * \return
+ * - HIPRAND_STATUS_NOT_INITIALIZED if the generator was not initialized \n
+ * - HIPRAND_STATUS_TYPE_ERROR if the generator is not supported \n
+ * - HIPRAND_STATUS_OUT_OF_RANGE if \p requests is NULL, or a request has an invalid
+ *   distribution, a NULL output pointer or a non-positive lambda \n
+ * - HIPRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - HIPRAND_STATUS_LAUNCH_FAILURE if generator failed to launch kernel \n
+ * - HIPRAND_STATUS_SUCCESS if the values were generated successfully \n
+ */
+hiprandStatus_t HIPRANDAPI
+hiprandGenerateBatch(hiprandGenerator_t generator,
+                     const hiprandBatchRequest_t * requests,
+                     size_t count);
+
+/**
+ * \brief Generates Poisson-distributed 32-bit unsigned integers with
+ * a lambda for every value.
+ *
+ * Generates \p n Poisson-distributed 32-bit unsigned integers and saves them
+ * to \p output_data, the i-th value has lambda \p lambdas[i]. Lambdas must be
+ * non-negative. \p lambdas must be in device memory, or in host memory for
+ * generators created with hiprandCreateGeneratorHost().
+ *
+ * Note: The function is not implemented for cuRAND.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param lambdas - Pointer to \p n lambdas for the Poisson distribution
+ * \param n - Number of 32-bit unsigned integers to generate
+ *
+ * \return
+ * - HIPRAND_STATUS_NOT_IMPLEMENTED if the function is not implemented \n
+ * - HIPRAND_STATUS_NOT_INITIALIZED if the generator was not initialized \n
+ * - HIPRAND_STATUS_LAUNCH_FAILURE if generator failed to launch kernel \n
+ * - HIPRAND_STATUS_TYPE_ERROR if the generator is not a pseudorandom number generator
+ * or is HIPRAND_RNG_PSEUDO_MTGP32 \n
+ * - HIPRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+hiprandStatus_t HIPRANDAPI
+hiprandGeneratePoissonArray(hiprandGenerator_t generator,
+                            unsigned int * output_data,
+                            const double * lambdas, size_t n);
+
+/**
+ * \brief Saves a checkpoint of a random number generator to host memory.
+ *
+ * Writes a binary blob with everything needed to continue the sequence
+ * of the random number generator (see rocrand_generator_save()). A generator
+ * restored by hiprandGeneratorLoad() produces the same numbers as this generator
+ * would produce after the save.
+ *
+ * If \p blob is NULL, only the required size of the blob in bytes is returned
+ * in \p blob_size.
+ *
+ * Note: The function is not implemented for cuRAND.
+ *
+ * \param generator - Generator to save
+ * \param blob - Pointer to host memory for the blob or NULL
+ * \param blob_size - Pointer to the size in bytes of \p blob, on return
+ * it contains the size of the blob
+ *
+ * \return
+ * - HIPRAND_STATUS_NOT_IMPLEMENTED if the function is not implemented \n
+ * - HIPRAND_STATUS_NOT_INITIALIZED if the generator was not initialized \n
+ * - HIPRAND_STATUS_OUT_OF_RANGE if \p blob_size is NULL or \p blob is too small \n
+ * - HIPRAND_STATUS_LAUNCH_FAILURE if generator failed to launch kernel \n
+ * - HIPRAND_STATUS_INTERNAL_ERROR if the state could not be copied \n
+ * - HIPRAND_STATUS_SUCCESS if the checkpoint was saved successfully \n
+ */
+hiprandStatus_t HIPRANDAPI
+hiprandGeneratorSave(hiprandGenerator_t generator, void * blob, size_t * blob_size);
+
+/**
+ * \brief Restores a random number generator from a checkpoint.
+ *
+ * Restores the random number generator from \p blob written by
+ * hiprandGeneratorSave() for a generator of the same type.
+ * The generator's stream is not changed.
+ *
+ * Note: The function is not implemented for cuRAND.
+ *
+ * \param generator - Generator to restore
+ * \param blob - Pointer to the blob in host memory
+ * \param blob_size - Size in bytes of \p blob
+ *
+ * \return
+ * - HIPRAND_STATUS_NOT_IMPLEMENTED if the function is not implemented \n
+ * - HIPRAND_STATUS_NOT_INITIALIZED if the generator was not initialized \n
+ * - HIPRAND_STATUS_TYPE_ERROR if the blob was saved for a generator of another type \n
+ * - HIPRAND_STATUS_VERSION_MISMATCH if the blob was saved by another version of the library \n
+ * - HIPRAND_STATUS_OUT_OF_RANGE if \p blob is NULL or is not a valid blob \n
+ * - HIPRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - HIPRAND_STATUS_INTERNAL_ERROR if the state could not be copied \n
+ * - HIPRAND_STATUS_SUCCESS if the generator was restored successfully \n
+ */
+hiprandStatus_t HIPRANDAPI
+hiprandGeneratorLoad(hiprandGenerator_t generator, const void * blob, size_t blob_size);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+#endif // HIPRAND_EXT_H_
+
+/** @} */ // end of group hiprandhost
@@ -46,6 +46,7 @@
 
 DEFINE_HIPRAND_STATE(hiprandState, rocrand_state_xorwow)
 DEFINE_HIPRAND_STATE(hiprandStateXORWOW, rocrand_state_xorwow)
+DEFINE_HIPRAND_STATE(hiprandStateXORWOWCompact, rocrand_state_xorwow_compact)
 DEFINE_HIPRAND_STATE(hiprandStatePhilox4_32_10, rocrand_state_philox4x32_10)
 DEFINE_HIPRAND_STATE(hiprandStateMRG32k3a, rocrand_state_mrg32k3a)
 DEFINE_HIPRAND_STATE(hiprandStateMtgp32, rocrand_state_mtgp32)
@@ -126,6 +127,7 @@ void check_state_type()
             StateType,
             hiprandState_t,
             hiprandStateXORWOW_t,
+            hiprandStateXORWOWCompact_t,
             hiprandStatePhilox4_32_10_t,
             hiprandStateMRG32k3a_t,
             hiprandStateMtgp32_t,
@@ -134,6 +136,20 @@ void check_state_type()
         "StateType is not a hipRAND generator state"
     );
 }
+
+template<typename StateType>
+QUALIFIERS
+void check_state_type_not_compact()
+{
+    static_assert(
+        !std::is_same<
+            StateType,
+            hiprandStateXORWOWCompact_t
+        >::value,
+        "hiprandStateXORWOWCompact_t does not save normally distributed values, "
+        "use functions generating two values"
+    );
+}
 /// \endcond
 
 /**
@@ -190,7 +206,8 @@ void hiprand_mtgp32_set_params(hiprandStateMtgp32_t * state,
 ///
 /// \tparam StateType - Pseudorandom number generator state type.
 /// \p StateType type must be one of following types:
-/// \p hiprandStateXORWOW_t, \p hiprandStatePhilox4_32_10_t, or \p hiprandStateMRG32k3a_t
+/// \p hiprandStateXORWOW_t, \p hiprandStateXORWOWCompact_t, \p hiprandStatePhilox4_32_10_t,
+/// or \p hiprandStateMRG32k3a_t
 ///
 /// \param seed - Pseudorandom number generator's seed
 /// \param subsequence - Number of subsequence to skipahead
@@ -225,6 +242,43 @@ void hiprand_init(const unsigned long long seed,
     rocrand_init(seed, subsequence, offset, state);
 }
 
+/// \brief Initializes a XORWOW state cooperatively by all threads of the block.
+///
+/// Initializes \p state to the same value as hiprand_init(). All threads of
+/// the block must call the function, every thread with its own \p subsequence
+/// and \p offset. Jump matrices are staged in \p shared once per block, so
+/// initialization of many states reads much less global memory.
+///
+/// \tparam StateType - Pseudorandom number generator state type.
+/// \p StateType type must be one of following types:
+/// \p hiprandState_t or \p hiprandStateXORWOW_t
+///
+/// \param seed - Pseudorandom number generator's seed
+/// \param subsequence - Number of subsequence to skipahead
+/// \param offset - Absolute subsequence offset, i.e. how many states from
+/// current subsequence should be skipped
+/// \param state - Pointer to a state to initialize
+/// \param shared - Pointer to <tt>XORWOW_SIZE</tt> <tt>unsigned int</tt> values
+/// of shared memory
+template<class StateType>
+QUALIFIERS
+void hiprand_init_block(const unsigned long long seed,
+                        const unsigned long long subsequence,
+                        const unsigned long long offset,
+                        StateType * state,
+                        unsigned int * shared)
+{
+    static_assert(
+        detail::is_any_of<
+            StateType,
+            hiprandState_t,
+            hiprandStateXORWOW_t
+        >::value,
+        "Used StateType is not supported"
+    );
+    rocrand_init_block(seed, subsequence, offset, state, shared);
+}
+
 /// \brief Initializes a Sobol32 state.
 ///
 /// \param direction_vectors - Pointer to array of 32 <tt>unsigned int</tt>s that
@@ -243,7 +297,8 @@ void hiprand_init(hiprandDirectionVectors32_t direction_vectors,
 ///
 /// \tparam StateType - Random number generator state type.
 /// \p StateType type must be one of following types:
-/// \p hiprandStateXORWOW_t, \p hiprandStatePhilox4_32_10_t, \p hiprandStateMRG32k3a_t,
+/// \p hiprandStateXORWOW_t, \p hiprandStateXORWOWCompact_t,
+/// \p hiprandStatePhilox4_32_10_t, \p hiprandStateMRG32k3a_t,
 /// or \p hiprandStateSobol32_t
 ///
 /// \param n - Number of states to skipahead
@@ -274,7 +329,8 @@ void skipahead(unsigned long long n, StateType * state)
 ///
 /// \tparam StateType - Random number generator state type.
 /// \p StateType type must be one of following types:
-/// \p hiprandStateXORWOW_t, \p hiprandStatePhilox4_32_10_t,
+/// \p hiprandStateXORWOW_t, \p hiprandStateXORWOWCompact_t,
+/// \p hiprandStatePhilox4_32_10_t,
 /// or \p hiprandStateMRG32k3a_t
 ///
 /// \param n - Number of subsequences to skipahead
@@ -306,7 +362,8 @@ void skipahead_sequence(unsigned long long n, StateType * state)
 ///
 /// \tparam StateType - Random number generator state type.
 /// \p StateType type must be one of following types:
-/// \p hiprandStateXORWOW_t, \p hiprandStatePhilox4_32_10_t,
+/// \p hiprandStateXORWOW_t, \p hiprandStateXORWOWCompact_t,
+/// \p hiprandStatePhilox4_32_10_t,
 /// or \p hiprandStateMRG32k3a_t
 ///
 /// \param n - Number of subsequences to skipahead
@@ -333,7 +390,8 @@ void skipahead_subsequence(unsigned long long n, StateType * state)
 ///
 /// \tparam StateType - Random number generator state type.
 /// \p StateType type must be one of following types:
-/// \p hiprandStateXORWOW_t, \p hiprandStatePhilox4_32_10_t, \p hiprandStateMRG32k3a_t,
+/// \p hiprandStateXORWOW_t, \p hiprandStateXORWOWCompact_t,
+/// \p hiprandStatePhilox4_32_10_t, \p hiprandStateMRG32k3a_t,
 /// \p hiprandStateMtgp32_t, or \p hiprandStateSobol32_t
 ///
 /// \param state - Pointer to a RNG state to use
@@ -362,7 +420,8 @@ uint4 hiprand4(hiprandStatePhilox4_32_10_t * state)
 ///
 /// \tparam StateType - Random number generator state type.
 /// \p StateType type must be one of following types:
-/// \p hiprandStateXORWOW_t, \p hiprandStatePhilox4_32_10_t, \p hiprandStateMRG32k3a_t,
+/// \p hiprandStateXORWOW_t, \p hiprandStateXORWOWCompact_t,
+/// \p hiprandStatePhilox4_32_10_t, \p hiprandStateMRG32k3a_t,
 /// \p hiprandStateMtgp32_t, or \p hiprandStateSobol32_t
 ///
 /// \param state - Pointer to a RNG state to use
@@ -386,11 +445,41 @@ float4 hiprand_uniform4(hiprandStatePhilox4_32_10_t * state)
     return rocrand_uniform4(state);
 }
 
+/// \brief Generates four uniformly distributed random <tt>float</tt> value
+/// from (0; 1] range.
+///
+/// \tparam StateType - Random number generator state type.
+/// \p StateType type must be one of following types:
+/// \p hiprandStateXORWOW_t, \p hiprandStateMRG32k3a_t, or \p hiprandStateMtgp32_t
+///
+/// Note: When \p state is of type \p hiprandStateMtgp32_t, all threads of the block
+/// must call the function (see rocrand_uniform4()).
+///
+/// \param state - Pointer to a RNG state to use
+/// \return Four uniformly distributed random <tt>float</tt> values as \p float4
+template<class StateType>
+QUALIFIERS
+float4 hiprand_uniform4(StateType * state)
+{
+    static_assert(
+        detail::is_any_of<
+            StateType,
+            hiprandState_t,
+            hiprandStateXORWOW_t,
+            hiprandStateMRG32k3a_t,
+            hiprandStateMtgp32_t
+        >::value,
+        "Used StateType is not supported"
+    );
+    return rocrand_uniform4(state);
+}
+
 /// \brief Generates uniformly distributed random <tt>double</tt> value from (0; 1] range
 ///
 /// \tparam StateType - Random number generator state type.
 /// \p StateType type must be one of following types:
-/// \p hiprandStateXORWOW_t, \p hiprandStatePhilox4_32_10_t, \p hiprandStateMRG32k3a_t,
+/// \p hiprandStateXORWOW_t, \p hiprandStateXORWOWCompact_t,
+/// \p hiprandStatePhilox4_32_10_t, \p hiprandStateMRG32k3a_t,
 /// \p hiprandStateMtgp32_t, or \p hiprandStateSobol32_t
 ///
 /// \param state - Pointer to a RNG state to use
@@ -448,6 +537,7 @@ QUALIFIERS
 float hiprand_normal(StateType * state)
 {
     check_state_type<StateType>();
+    check_state_type_not_compact<StateType>();
     return rocrand_normal(state);
 }
 
@@ -458,7 +548,8 @@ float hiprand_normal(StateType * state)
 ///
 /// \tparam StateType - Random number generator state type.
 /// \p StateType type must be one of following types:
-/// \p hiprandStateXORWOW_t, \p hiprandStatePhilox4_32_10_t,
+/// \p hiprandStateXORWOW_t, \p hiprandStateXORWOWCompact_t,
+/// \p hiprandStatePhilox4_32_10_t,
 /// or \p hiprandStateMRG32k3a_t
 ///
 /// \param state - Pointer to a RNG state to use
@@ -473,6 +564,7 @@ float2 hiprand_normal2(StateType * state)
             StateType,
             hiprandState_t,
             hiprandStateXORWOW_t,
+            hiprandStateXORWOWCompact_t,
             hiprandStatePhilox4_32_10_t,
             hiprandStateMRG32k3a_t
         >::value,
@@ -494,6 +586,37 @@ float4 hiprand_normal4(hiprandStatePhilox4_32_10_t * state)
     return rocrand_normal4(state);
 }
 
+/// \brief Generates four normally distributed random <tt>float</tt> values
+///
+/// Mean value of normal distribution is equal to 0.0, and standard deviation
+/// equals 1.0.
+///
+/// \tparam StateType - Random number generator state type.
+/// \p StateType type must be one of following types:
+/// \p hiprandStateXORWOW_t, \p hiprandStateMRG32k3a_t, or \p hiprandStateMtgp32_t
+///
+/// Note: When \p state is of type \p hiprandStateMtgp32_t, all threads of the block
+/// must call the function (see rocrand_normal4()).
+///
+/// \param state - Pointer to a RNG state to use
+/// \return Four normally distributed random <tt>float</tt> values as \p float4
+template<class StateType>
+QUALIFIERS
+float4 hiprand_normal4(StateType * state)
+{
+    static_assert(
+        detail::is_any_of<
+            StateType,
+            hiprandState_t,
+            hiprandStateXORWOW_t,
+            hiprandStateMRG32k3a_t,
+            hiprandStateMtgp32_t
+        >::value,
+        "Used StateType is not supported"
+    );
+    return rocrand_normal4(state);
+}
+
 /// \brief Generates normally distributed random <tt>double</tt> value
 ///
 /// Mean value of normal distribution is equal to 0.0, and standard deviation
@@ -511,6 +634,7 @@ QUALIFIERS
 double hiprand_normal_double(StateType * state)
 {
     check_state_type<StateType>();
+    check_state_type_not_compact<StateType>();
     return rocrand_normal_double(state);
 }
 
@@ -521,7 +645,8 @@ double hiprand_normal_double(StateType * state)
 ///
 /// \tparam StateType - Random number generator state type.
 /// \p StateType type must be one of following types:
-/// \p hiprandStateXORWOW_t, \p hiprandStatePhilox4_32_10_t,
+/// \p hiprandStateXORWOW_t, \p hiprandStateXORWOWCompact_t,
+/// \p hiprandStatePhilox4_32_10_t,
 /// or \p hiprandStateMRG32k3a_t
 ///
 /// \param state - Pointer to a RNG state to use
@@ -536,6 +661,7 @@ double2 hiprand_normal2_double(StateType * state)
             StateType,
             hiprandState_t,
             hiprandStateXORWOW_t,
+            hiprandStateXORWOWCompact_t,
             hiprandStatePhilox4_32_10_t,
             hiprandStateMRG32k3a_t
         >::value,
@@ -574,6 +700,7 @@ float hiprand_log_normal(StateType * state,
                          float mean, float stddev)
 {
     check_state_type<StateType>();
+    check_state_type_not_compact<StateType>();
     return rocrand_log_normal(state, mean, stddev);
 }
 
@@ -581,7 +708,8 @@ float hiprand_log_normal(StateType * state,
 ///
 /// \tparam StateType - Random number generator state type.
 /// \p StateType type must be one of following types:
-/// \p hiprandStateXORWOW_t, \p hiprandStatePhilox4_32_10_t,
+/// \p hiprandStateXORWOW_t, \p hiprandStateXORWOWCompact_t,
+/// \p hiprandStatePhilox4_32_10_t,
 /// or \p hiprandStateMRG32k3a_t
 ///
 /// \param state - Pointer to a RNG state to use
@@ -599,6 +727,7 @@ float2 hiprand_log_normal2(StateType * state,
             StateType,
             hiprandState_t,
             hiprandStateXORWOW_t,
+            hiprandStateXORWOWCompact_t,
             hiprandStatePhilox4_32_10_t,
             hiprandStateMRG32k3a_t
         >::value,
@@ -620,6 +749,37 @@ float4 hiprand_log_normal4(hiprandStatePhilox4_32_10_t * state,
     return rocrand_log_normal4(state, mean, stddev);
 }
 
+/// \brief Generates four log-normally distributed random <tt>float</tt> values
+///
+/// \tparam StateType - Random number generator state type.
+/// \p StateType type must be one of following types:
+/// \p hiprandStateXORWOW_t, \p hiprandStateMRG32k3a_t, or \p hiprandStateMtgp32_t
+///
+/// Note: When \p state is of type \p hiprandStateMtgp32_t, all threads of the block
+/// must call the function (see rocrand_log_normal4()).
+///
+/// \param state - Pointer to a RNG state to use
+/// \param mean - Mean value of log-normal distribution
+/// \param stddev - Standard deviation value of log-normal distribution
+/// \return Four log-normally distributed random <tt>float</tt> values as \p float4
+template<class StateType>
+QUALIFIERS
+float4 hiprand_log_normal4(StateType * state,
+                           float mean, float stddev)
+{
+    static_assert(
+        detail::is_any_of<
+            StateType,
+            hiprandState_t,
+            hiprandStateXORWOW_t,
+            hiprandStateMRG32k3a_t,
+            hiprandStateMtgp32_t
+        >::value,
+        "Used StateType is not supported"
+    );
+    return rocrand_log_normal4(state, mean, stddev);
+}
+
 /// \brief Generates log-normally distributed random <tt>double</tt> value
 ///
 /// \tparam StateType - Random number generator state type.
@@ -637,6 +797,7 @@ double hiprand_log_normal_double(StateType * state,
                                  double mean, double stddev)
 {
     check_state_type<StateType>();
+    check_state_type_not_compact<StateType>();
     return rocrand_log_normal_double(state, mean, stddev);
 }
 
@@ -644,7 +805,8 @@ double hiprand_log_normal_double(StateType * state,
 ///
 /// \tparam StateType - Random number generator state type.
 /// \p StateType type must be one of following types:
-/// \p hiprandStateXORWOW_t, \p hiprandStatePhilox4_32_10_t, \p hiprandStateMRG32k3a_t,
+/// \p hiprandStateXORWOW_t, \p hiprandStateXORWOWCompact_t,
+/// \p hiprandStatePhilox4_32_10_t, \p hiprandStateMRG32k3a_t,
 /// \p hiprandStateMtgp32_t, or \p hiprandStateSobol32_t
 ///
 /// \param state - Pointer to a RNG state to use
@@ -662,6 +824,7 @@ double2 hiprand_log_normal2_double(StateType * state,
             StateType,
             hiprandState_t,
             hiprandStateXORWOW_t,
+            hiprandStateXORWOWCompact_t,
             hiprandStatePhilox4_32_10_t,
             hiprandStateMRG32k3a_t
         >::value,
@@ -698,6 +861,7 @@ QUALIFIERS
 uint hiprand_poisson(StateType * state, double lambda)
 {
     check_state_type<StateType>();
+    check_state_type_not_compact<StateType>();
     return rocrand_poisson(state, lambda);
 }
 
@@ -717,7 +881,8 @@ uint4 hiprand_poisson4(hiprandStatePhilox4_32_10_t * state, double lambda)
 ///
 /// \tparam StateType - Random number generator state type.
 /// \p StateType type must be one of following types:
-/// \p hiprandStateXORWOW_t, \p hiprandStatePhilox4_32_10_t, \p hiprandStateMRG32k3a_t,
+/// \p hiprandStateXORWOW_t, \p hiprandStateXORWOWCompact_t,
+/// \p hiprandStatePhilox4_32_10_t, \p hiprandStateMRG32k3a_t,
 /// \p hiprandStateMtgp32_t, or \p hiprandStateSobol32_t
 ///
 /// \param state - Pointer to a RNG state to use
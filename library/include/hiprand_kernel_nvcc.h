@@ -39,6 +39,8 @@
 
 DEFINE_HIPRAND_STATE(hiprandState, curandState)
 DEFINE_HIPRAND_STATE(hiprandStateXORWOW, curandStateXORWOW)
+// cuRAND has no compact XORWOW state
+DEFINE_HIPRAND_STATE(hiprandStateXORWOWCompact, curandStateXORWOW)
 DEFINE_HIPRAND_STATE(hiprandStatePhilox4_32_10, curandStatePhilox4_32_10)
 DEFINE_HIPRAND_STATE(hiprandStateMRG32k3a, curandStateMRG32k3a)
 DEFINE_HIPRAND_STATE(hiprandStateMtgp32, curandStateMtgp32)
@@ -117,6 +119,7 @@ void check_state_type()
             StateType,
             hiprandState_t,
             hiprandStateXORWOW_t,
+            hiprandStateXORWOWCompact_t,
             hiprandStatePhilox4_32_10_t,
             hiprandStateMRG32k3a_t,
             hiprandStateMtgp32_t,
@@ -186,6 +189,26 @@ void hiprand_init(const unsigned long long seed,
     curand_init(seed, subsequence, offset, state);
 }
 
+template<class StateType>
+QUALIFIERS
+void hiprand_init_block(const unsigned long long seed,
+                        const unsigned long long subsequence,
+                        const unsigned long long offset,
+                        StateType * state,
+                        unsigned int * shared)
+{
+    static_assert(
+        detail::is_any_of<
+            StateType,
+            hiprandState_t,
+            hiprandStateXORWOW_t
+        >::value,
+        "Used StateType is not supported"
+    );
+    (void) shared;
+    curand_init(seed, subsequence, offset, state);
+}
+
 QUALIFIERS
 void hiprand_init(hiprandDirectionVectors32_t direction_vectors,
                   unsigned int offset,
@@ -280,6 +303,28 @@ float4 hiprand_uniform4(hiprandStatePhilox4_32_10_t * state)
     return curand_uniform4(state);
 }
 
+// cuRAND has four-value functions only for Philox
+template<class StateType>
+QUALIFIERS
+float4 hiprand_uniform4(StateType * state)
+{
+    static_assert(
+        detail::is_any_of<
+            StateType,
+            hiprandState_t,
+            hiprandStateXORWOW_t,
+            hiprandStateMRG32k3a_t,
+            hiprandStateMtgp32_t
+        >::value,
+        "Used StateType is not supported"
+    );
+    const float x = curand_uniform(state);
+    const float y = curand_uniform(state);
+    const float z = curand_uniform(state);
+    const float w = curand_uniform(state);
+    return make_float4(x, y, z, w);
+}
+
 template<class StateType>
 QUALIFIERS
 double hiprand_uniform_double(StateType * state)
@@ -318,6 +363,7 @@ float2 hiprand_normal2(StateType * state)
             StateType,
             hiprandState_t,
             hiprandStateXORWOW_t,
+            hiprandStateXORWOWCompact_t,
             hiprandStatePhilox4_32_10_t,
             hiprandStateMRG32k3a_t
         >::value,
@@ -332,6 +378,27 @@ float4 hiprand_normal4(hiprandStatePhilox4_32_10_t * state)
     return curand_normal4(state);
 }
 
+template<class StateType>
+QUALIFIERS
+float4 hiprand_normal4(StateType * state)
+{
+    static_assert(
+        detail::is_any_of<
+            StateType,
+            hiprandState_t,
+            hiprandStateXORWOW_t,
+            hiprandStateMRG32k3a_t,
+            hiprandStateMtgp32_t
+        >::value,
+        "Used StateType is not supported"
+    );
+    const float x = curand_normal(state);
+    const float y = curand_normal(state);
+    const float z = curand_normal(state);
+    const float w = curand_normal(state);
+    return make_float4(x, y, z, w);
+}
+
 template<class StateType>
 QUALIFIERS
 double hiprand_normal_double(StateType * state)
@@ -350,6 +417,7 @@ double2 hiprand_normal2_double(StateType * state)
             StateType,
             hiprandState_t,
             hiprandStateXORWOW_t,
+            hiprandStateXORWOWCompact_t,
             hiprandStatePhilox4_32_10_t,
             hiprandStateMRG32k3a_t
         >::value,
@@ -384,6 +452,7 @@ float2 hiprand_log_normal2(StateType * state,
             StateType,
             hiprandState_t,
             hiprandStateXORWOW_t,
+            hiprandStateXORWOWCompact_t,
             hiprandStatePhilox4_32_10_t,
             hiprandStateMRG32k3a_t
         >::value,
@@ -399,6 +468,28 @@ float4 hiprand_log_normal4(hiprandStatePhilox4_32_10_t * state,
     return curand_log_normal4(state, mean, stddev);
 }
 
+template<class StateType>
+QUALIFIERS
+float4 hiprand_log_normal4(StateType * state,
+                           float mean, float stddev)
+{
+    static_assert(
+        detail::is_any_of<
+            StateType,
+            hiprandState_t,
+            hiprandStateXORWOW_t,
+            hiprandStateMRG32k3a_t,
+            hiprandStateMtgp32_t
+        >::value,
+        "Used StateType is not supported"
+    );
+    const float x = curand_log_normal(state, mean, stddev);
+    const float y = curand_log_normal(state, mean, stddev);
+    const float z = curand_log_normal(state, mean, stddev);
+    const float w = curand_log_normal(state, mean, stddev);
+    return make_float4(x, y, z, w);
+}
+
 template<class StateType>
 QUALIFIERS
 double hiprand_log_normal_double(StateType * state,
@@ -419,6 +510,7 @@ double2 hiprand_log_normal2_double(StateType * state,
             StateType,
             hiprandState_t,
             hiprandStateXORWOW_t,
+            hiprandStateXORWOWCompact_t,
             hiprandStatePhilox4_32_10_t,
             hiprandStateMRG32k3a_t
         >::value,
@@ -28,6 +28,7 @@
 
 #include <hip/hip_runtime.h>
 #include <hip/hip_fp16.h>
+#include <hip/hip_bfloat16.h>
 
 #include "rocrand_discrete_types.h"
 
@@ -44,11 +45,73 @@
 typedef struct rocrand_generator_base_type * rocrand_generator;
 /// \endcond
 
+/// \cond ROCRAND_DOCS_TYPEDEFS
+/// rocRAND multi-device random number generator (opaque)
+typedef struct rocrand_multi_device_generator_base_type * rocrand_multi_device_generator;
+/// \endcond
+
+/// \cond ROCRAND_DOCS_TYPEDEFS
+/// rocRAND group of generators sharing memory of engines (opaque)
+typedef struct rocrand_generator_group_type * rocrand_generator_group;
+/// \endcond
+
+/// \cond ROCRAND_DOCS_TYPEDEFS
+/// rocRAND stream producer (opaque)
+typedef struct rocrand_stream_producer_base_type * rocrand_stream_producer;
+/// \endcond
+
 /// \cond ROCRAND_DOCS_TYPEDEFS
 /// rocRAND half type (derived from HIP)
 typedef __half half;
 /// \endcond
 
+/// \cond ROCRAND_DOCS_TYPEDEFS
+/// rocRAND bfloat16 type (derived from HIP)
+typedef hip_bfloat16 bfloat16;
+/// \endcond
+
+/**
+ * \brief 8-bit floating-point value in OCP FP8 E4M3 format.
+ *
+ * 1 sign bit, 4 exponent bits (bias 7) and 3 mantissa bits, no infinities:
+ * the largest finite value is 448. \p data holds the bits of the value, so
+ * the type can be reinterpreted as other FP8 E4M3 types (e.g. of HIP).
+ */
+typedef struct rocrand_fp8_e4m3
+{
+    unsigned char data;
+} rocrand_fp8_e4m3;
+
+/**
+ * \brief 8-bit floating-point value in OCP FP8 E5M2 format.
+ *
+ * 1 sign bit, 5 exponent bits (bias 15) and 2 mantissa bits,
+ * the largest finite value is 57344. \p data holds the bits of the value.
+ */
+typedef struct rocrand_fp8_e5m2
+{
+    unsigned char data;
+} rocrand_fp8_e5m2;
+
+/**
+ * \brief Ring buffer of a stream producer in device memory.
+ *
+ * Values of the stream at positions \p p in [<tt>*tail</tt>, <tt>*head</tt>)
+ * are available at <tt>data[p % capacity]</tt>
+ * (see rocrand_create_stream_producer()).
+ */
+typedef struct rocrand_ring_buffer
+{
+    /// Device memory of \p capacity values
+    unsigned int * data;
+    /// Number of values in the buffer
+    size_t capacity;
+    /// Number of values written by the producer (device memory)
+    unsigned long long * head;
+    /// Number of values read by consumers (device memory)
+    unsigned long long * tail;
+} rocrand_ring_buffer;
+
 #if defined(__cplusplus)
 extern "C" {
 #endif /* __cplusplus */
@@ -80,10 +143,128 @@ typedef enum rocrand_rng_type {
     ROCRAND_RNG_PSEUDO_MRG32K3A = 402, ///< MRG32k3a pseudorandom generator
     ROCRAND_RNG_PSEUDO_MTGP32 = 403, ///< Mersenne Twister MTGP32 pseudorandom generator
     ROCRAND_RNG_PSEUDO_PHILOX4_32_10 = 404, ///< PHILOX-4x32-10 pseudorandom generator
+    ROCRAND_RNG_PSEUDO_PHILOX4_64_10 = 405, ///< PHILOX-4x64-10 pseudorandom generator
+    ROCRAND_RNG_PSEUDO_THREEFRY2_64_20 = 406, ///< THREEFRY-2x64-20 pseudorandom generator
+    ROCRAND_RNG_PSEUDO_THREEFRY4_64_20 = 407, ///< THREEFRY-4x64-20 pseudorandom generator
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_7 = 408, ///< PHILOX-4x32-7 pseudorandom generator
+    ROCRAND_RNG_PSEUDO_XOSHIRO128PP = 409, ///< xoshiro128++ pseudorandom generator
+    ROCRAND_RNG_PSEUDO_PCG32 = 410, ///< PCG32 pseudorandom generator
     ROCRAND_RNG_QUASI_DEFAULT = 500,  ///< Default quasirandom generator
-    ROCRAND_RNG_QUASI_SOBOL32 = 501 ///< Sobol32 quasirandom generator
+    ROCRAND_RNG_QUASI_SOBOL32 = 501, ///< Sobol32 quasirandom generator
+    ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32 = 502, ///< Scrambled Sobol32 quasirandom generator
+    ROCRAND_RNG_QUASI_SOBOL64 = 503, ///< Sobol64 quasirandom generator
+    ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64 = 504, ///< Scrambled Sobol64 quasirandom generator
+    ROCRAND_RNG_QUASI_LATTICE32 = 505, ///< Rank-1 lattice sequence (base 2) quasirandom generator
+    ROCRAND_RNG_QUASI_HALTON32 = 506, ///< Halton quasirandom generator
+    ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32 = 507 ///< Scrambled Halton quasirandom generator
 } rocrand_rng_type;
 
+/**
+ * \brief rocRAND ordering of generated values
+ */
+typedef enum rocrand_ordering {
+    ROCRAND_ORDERING_PSEUDO_DEFAULT = 101, ///< Engines start at consecutive subsequences of the seed
+    ROCRAND_ORDERING_PSEUDO_SEEDED = 102, ///< Engines are seeded with hashes of the seed, no skipahead
+    ROCRAND_ORDERING_PSEUDO_DYNAMIC = 103, ///< Results do not depend on the launch configuration
+    ROCRAND_ORDERING_QUASI_DEFAULT = 201, ///< Dimension-major: all points of a dimension are contiguous
+    ROCRAND_ORDERING_QUASI_INTERLEAVED = 202 ///< Point-major: all dimensions of a point are contiguous
+} rocrand_ordering;
+
+/**
+ * \brief rocRAND method of generating normally distributed values
+ */
+typedef enum rocrand_normal_method {
+    ROCRAND_NORMAL_METHOD_BOX_MULLER = 0, ///< Box-Muller transform (default)
+    ROCRAND_NORMAL_METHOD_ZIGGURAT = 1 ///< Ziggurat rejection method
+} rocrand_normal_method;
+
+/**
+ * \brief rocRAND policy of storing generated values to device memory
+ */
+typedef enum rocrand_store_policy {
+    ROCRAND_STORE_POLICY_DEFAULT = 0, ///< Regular stores, values are kept in caches (default)
+    ROCRAND_STORE_POLICY_STREAMING = 1 ///< Non-temporal stores that bypass caches
+} rocrand_store_policy;
+
+/**
+ * \brief rocRAND precision of normal and log-normal transforms
+ */
+typedef enum rocrand_precision {
+    ROCRAND_PRECISION_DEFAULT = 0, ///< Full-precision math functions (default)
+    ROCRAND_PRECISION_FAST = 1 ///< Hardware intrinsics (__logf, __expf), lower accuracy
+} rocrand_precision;
+
+/**
+ * \brief rocRAND policy of prefetching managed output buffers
+ */
+typedef enum rocrand_managed_policy {
+    ROCRAND_MANAGED_POLICY_DEFAULT = 0, ///< Managed outputs are prefetched to the device (default)
+    ROCRAND_MANAGED_POLICY_NONE = 1, ///< Outputs are not inspected, pages migrate on demand
+    ROCRAND_MANAGED_POLICY_PREFETCH_HOST = 2 ///< Managed outputs are prefetched to the device and back to the host
+} rocrand_managed_policy;
+
+/**
+ * \brief Distributions of requests of rocrand_generate_batch()
+ */
+typedef enum rocrand_batch_distribution {
+    ROCRAND_BATCH_UNIFORM = 0, ///< Floats as rocrand_generate_uniform()
+    ROCRAND_BATCH_UNIFORM_DOUBLE = 1, ///< Doubles as rocrand_generate_uniform_double()
+    ROCRAND_BATCH_NORMAL = 2, ///< Floats as rocrand_generate_normal() (mean, stddev)
+    ROCRAND_BATCH_NORMAL_DOUBLE = 3, ///< Doubles as rocrand_generate_normal_double() (mean, stddev)
+    ROCRAND_BATCH_POISSON = 4 ///< Unsigned integers as rocrand_generate_poisson() (lambda)
+} rocrand_batch_distribution;
+
+/**
+ * \brief Output formats of rocrand_stochastic_round()
+ */
+typedef enum rocrand_round_format {
+    ROCRAND_ROUND_FORMAT_BFLOAT16 = 0, ///< bfloat16 values (16 random bits per value)
+    ROCRAND_ROUND_FORMAT_HALF = 1, ///< IEEE half-precision values (16 random bits per value)
+    ROCRAND_ROUND_FORMAT_FP8_E4M3 = 2, ///< rocrand_fp8_e4m3 values (8 random bits per value)
+    ROCRAND_ROUND_FORMAT_FP8_E5M2 = 3 ///< rocrand_fp8_e5m2 values (8 random bits per value)
+} rocrand_round_format;
+
+/**
+ * \brief Request of rocrand_generate_batch()
+ *
+ * Generates \p n values of \p distribution to device memory \p output_data
+ * (host memory for host generators), the type of values depends on the
+ * distribution. Unused parameters are ignored.
+ */
+typedef struct rocrand_batch_request {
+    rocrand_batch_distribution distribution; ///< Distribution of values
+    void * output_data; ///< Pointer to memory to store generated values
+    size_t n; ///< Number of values to generate
+    double parameters[2]; ///< Parameters of the distribution (in the order listed above)
+} rocrand_batch_request;
+
+/**
+ * \brief Counters of work done by a generator since its creation
+ * (see rocrand_get_generator_stats())
+ */
+typedef struct rocrand_generator_stats {
+    unsigned long long kernel_launches; ///< Kernels launched for initialization and generation
+    unsigned long long values_generated; ///< Values generated by all generate functions
+    unsigned long long initializations; ///< Initializations of engines (the first one and after seed or offset changes)
+    unsigned long long poisson_table_builds; ///< Tables of Poisson lambdas computed (not found in the cache)
+    unsigned long long device_bytes_allocated; ///< Device memory allocated for engines, constants and tables
+} rocrand_generator_stats;
+
+/**
+ * \brief Allocator of device memory used by generators (see rocrand_set_allocator())
+ *
+ * Memory returned by \p allocate in \p stream must be usable by work submitted
+ * to \p stream after the call. Memory passed to \p deallocate in \p stream must
+ * not be reused before work submitted to \p stream before the call is finished.
+ */
+typedef struct rocrand_allocator {
+    void * context; ///< Passed to \p allocate and \p deallocate
+    /// Allocates \p size bytes to \p *ptr, returns hipSuccess on success
+    hipError_t (*allocate)(void * context, void ** ptr, size_t size, hipStream_t stream);
+    /// Frees memory allocated by \p allocate
+    hipError_t (*deallocate)(void * context, void * ptr, hipStream_t stream);
+} rocrand_allocator;
+
 
 // Host API function
 
@@ -98,7 +279,25 @@ typedef enum rocrand_rng_type {
  * - ROCRAND_RNG_PSEUDO_MRG32K3A
  * - ROCRAND_RNG_PSEUDO_MTGP32
  * - ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_64_10
+ * - ROCRAND_RNG_PSEUDO_THREEFRY2_64_20
+ * - ROCRAND_RNG_PSEUDO_THREEFRY4_64_20
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_32_7
+ * - ROCRAND_RNG_PSEUDO_XOSHIRO128PP
+ * - ROCRAND_RNG_PSEUDO_PCG32
  * - ROCRAND_RNG_QUASI_SOBOL32
+ * - ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32
+ * - ROCRAND_RNG_QUASI_SOBOL64
+ * - ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64
+ * - ROCRAND_RNG_QUASI_LATTICE32
+ * - ROCRAND_RNG_QUASI_HALTON32
+ * - ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32
+ *
+ * ROCRAND_RNG_QUASI_LATTICE32, ROCRAND_RNG_QUASI_HALTON32 and
+ * ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32 compute every point directly from its
+ * index. They support rocrand_generate(), uniform, normal and log-normal
+ * generation (single and double precision, also to host memory), other
+ * generation functions return ROCRAND_STATUS_TYPE_ERROR.
  *
  * \param generator - Pointer to generator
  * \param rng_type - Type of generator to create
@@ -114,6 +313,144 @@ typedef enum rocrand_rng_type {
 rocrand_status ROCRANDAPI
 rocrand_create_generator(rocrand_generator * generator, rocrand_rng_type rng_type);
 
+/**
+ * \brief Creates a new host random number generator.
+ *
+ * Creates a new random number generator of type \p rng_type
+ * and returns it in \p generator. Created generator uses all host CPU
+ * threads to generate random numbers and saves them to host memory.
+ *
+ * Host generators produce exactly the same sequences of integers and uniform
+ * values as device generators of the same type created by
+ * rocrand_create_generator() with the same seed, offset and (for quasi-random
+ * generators) dimensions. Distributions computed with transcendental functions
+ * (normal, log-normal and others using \c logf, \c sinf, \c cosf or their
+ * double variants) use the host math library, their values can differ from
+ * device values in the last bits.
+ *
+ * Engines of host generators have no hand-written SIMD (SSE, AVX2 or AVX-512)
+ * implementations: each thread runs the same engine code as device kernels,
+ * at most vectorized by the compiler.
+ *
+ * Values for \p rng_type are:
+ * - ROCRAND_RNG_PSEUDO_XORWOW
+ * - ROCRAND_RNG_PSEUDO_MRG32K3A
+ * - ROCRAND_RNG_PSEUDO_MTGP32
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_64_10
+ * - ROCRAND_RNG_PSEUDO_THREEFRY2_64_20
+ * - ROCRAND_RNG_PSEUDO_THREEFRY4_64_20
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_32_7
+ * - ROCRAND_RNG_PSEUDO_XOSHIRO128PP
+ * - ROCRAND_RNG_PSEUDO_PCG32
+ * - ROCRAND_RNG_QUASI_SOBOL32
+ * - ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32
+ * - ROCRAND_RNG_QUASI_SOBOL64
+ * - ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64
+ * - ROCRAND_RNG_QUASI_LATTICE32
+ * - ROCRAND_RNG_QUASI_HALTON32
+ * - ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32
+ *
+ * \param generator - Pointer to generator
+ * \param rng_type - Type of generator to create
+ *
+ * \return
+ * - ROCRAND_STATUS_ALLOCATION_FAILED, if memory could not be allocated \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the value for \p rng_type is invalid \n
+ * - ROCRAND_STATUS_SUCCESS if generator was created successfully \n
+ *
+ */
+rocrand_status ROCRANDAPI
+rocrand_create_generator_host(rocrand_generator * generator, rocrand_rng_type rng_type);
+
+/**
+ * \brief Creates a new group of generators.
+ *
+ * Creates a group and returns it in \p group. Engines of generators created
+ * in the group (see rocrand_create_generator_in_group()) are allocated in one
+ * arena of device memory shared by the group. The arena grows on demand in
+ * chunks, so the number of device allocations grows logarithmically with
+ * the total size of engines, and releases chunks when they become unused.
+ *
+ * \param group - Pointer to group
+ *
+ * \return
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p group is NULL \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if the group could not be allocated \n
+ * - ROCRAND_STATUS_SUCCESS if the group was created successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_create_generator_group(rocrand_generator_group * group);
+
+/**
+ * \brief Destroys a group of generators.
+ *
+ * Generators created in the group remain valid, the arena is released
+ * when the group and all its generators are destroyed.
+ *
+ * \param group - Group to destroy
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the group wasn't created \n
+ * - ROCRAND_STATUS_SUCCESS if the group was destroyed successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_destroy_generator_group(rocrand_generator_group group);
+
+/**
+ * \brief Creates a new random number generator in a group.
+ *
+ * Creates a new random number generator of type \p rng_type as
+ * rocrand_create_generator() does and returns it in \p generator.
+ * Engines of the generator are allocated in the arena of \p group.
+ *
+ * When \p engines_count is not 0, the generator has \p engines_count engines
+ * instead of the default number, so low-volume generators need less memory.
+ * For ROCRAND_RNG_PSEUDO_XORWOW and ROCRAND_RNG_PSEUDO_MRG32K3A (one engine per
+ * thread) the count is rounded up to a multiple of 256 when it is greater than 256,
+ * for ROCRAND_RNG_PSEUDO_MTGP32 (one engine per block) it must not be greater than 4096.
+ * Generators of other types do not have arrays of engines, they are created
+ * as by rocrand_create_generator() and \p engines_count is ignored.
+ *
+ * The launch configuration of a generator can be changed later by
+ * rocrand_set_launch_config(), new engines are allocated in the arena too.
+ * Engines are returned to the arena after work submitted to the stream of
+ * the generator is finished, so rocrand_destroy_generator() and
+ * rocrand_set_launch_config() of generators created in groups synchronize
+ * the stream.
+ *
+ * \param generator - Pointer to generator
+ * \param rng_type - Type of generator to create
+ * \param group - Group of the generator
+ * \param engines_count - Number of engines, 0 for the default number
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the group wasn't created \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED, if memory could not be allocated \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the value for \p rng_type is invalid \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p engines_count is too large \n
+ * - ROCRAND_STATUS_SUCCESS if generator was created successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_create_generator_in_group(rocrand_generator * generator,
+                                  rocrand_rng_type rng_type,
+                                  rocrand_generator_group group,
+                                  unsigned int engines_count);
+
+/**
+ * \brief Returns the size of the arena of a group of generators.
+ *
+ * \param group - Group of generators
+ * \param bytes - Pointer to the number of bytes of device memory reserved by the arena
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the group wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p bytes is NULL \n
+ * - ROCRAND_STATUS_SUCCESS if the size was returned successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_get_generator_group_size(rocrand_generator_group group, size_t * bytes);
+
 /**
  * \brief Destroys random number generator.
  *
@@ -128,6 +465,48 @@ rocrand_create_generator(rocrand_generator * generator, rocrand_rng_type rng_typ
 rocrand_status ROCRANDAPI
 rocrand_destroy_generator(rocrand_generator generator);
 
+/**
+ * \brief Creates child generators of a generator.
+ *
+ * Creates \p count generators of the type of \p parent and returns them
+ * in \p children. Children have the launch configuration, the normal method,
+ * the ordering and the policies of \p parent and are statistically
+ * independent of it and of each other, so hierarchical simulations can spawn
+ * many generators without seeding and initializing each of them.
+ * Children are destroyed by rocrand_destroy_generator(), they are created
+ * in the group of \p parent (see rocrand_create_generator_in_group()).
+ *
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_32_10: keys of children are derived from
+ *   the seed of \p parent and the number of children created since the seed
+ *   was set, no device work is done and the state of \p parent is not changed.
+ * - ROCRAND_RNG_PSEUDO_XORWOW and ROCRAND_RNG_PSEUDO_MRG32K3A: the i-th engine
+ *   of the c-th child is the current i-th engine of \p parent skipped ahead by
+ *   (c + 1) * engines subsequences, where engines is the number of engines of
+ *   the launch configuration. All children are initialized by one kernel in
+ *   the stream of \p parent, which also skips its engines ahead past
+ *   the children, so values generated by \p parent after the split and
+ *   children of later splits do not overlap the children.
+ *
+ * Children of generators with the same seed, offset and launch configuration
+ * created by the same sequence of calls generate the same values.
+ *
+ * \param parent - Generator to split
+ * \param count - Number of children
+ * \param children - Pointer to an array of \p count generators
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p children is NULL and \p count is not 0 \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator can not be split \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if children were created successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generator_split(rocrand_generator parent,
+                        unsigned int count,
+                        rocrand_generator * children);
+
 /**
  * \brief Generates uniformly distributed 32-bit unsigned integers.
  *
@@ -200,6 +579,95 @@ rocrand_status ROCRANDAPI
 rocrand_generate_short(rocrand_generator generator,
                        unsigned short * output_data, size_t n);
 
+/**
+* \brief Generates uniformly distributed 64-bit unsigned integers.
+*
+* Generates \p n uniformly distributed 64-bit unsigned integers and
+* saves them to \p output_data.
+*
+* Generated numbers are between \p 0 and \p 2^64, including \p 0 and
+* excluding \p 2^64. For pseudo-random generators every value is built
+* from two consecutive 32-bit values of the generator's sequence (the first
+* one is the low half). Quasi-random generators produce 32-bit values,
+* which are stored in the high half of each number.
+*
+* \param generator - Generator to use
+* \param output_data - Pointer to memory to store generated numbers
+* \param n - Number of 64-bit unsigned integers to generate
+*
+* \return
+* - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+* - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+* - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+* of used quasi-random generator \n
+* - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+*/
+rocrand_status ROCRANDAPI
+rocrand_generate_long_long(rocrand_generator generator,
+                           unsigned long long * output_data, size_t n);
+
+/**
+ * \brief Generates uniformly distributed 32-bit unsigned integers in a range.
+ *
+ * Generates \p n uniformly distributed 32-bit unsigned integers from
+ * [\p lo, \p hi) and saves them to \p output_data.
+ *
+ * Pseudo-random generators other than ROCRAND_RNG_PSEUDO_MTGP32 use Lemire's
+ * multiply-shift method with rejection, which is unbiased (rejection is rare,
+ * so the number of values consumed per output is usually one, but not fixed).
+ * ROCRAND_RNG_PSEUDO_MTGP32 uses two 32-bit values per output without
+ * rejection (the bias is less than 2^-32). Quasi-random generators scale
+ * their points without rejection.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 32-bit unsigned integers to generate
+ * \param lo - Lower bound of the range (inclusive)
+ * \param hi - Upper bound of the range (exclusive)
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p hi is not greater than \p lo \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_uint_range(rocrand_generator generator,
+                                    unsigned int * output_data, size_t n,
+                                    unsigned int lo, unsigned int hi);
+
+/**
+ * \brief Generates uniformly distributed 64-bit unsigned integers in a range.
+ *
+ * Generates \p n uniformly distributed 64-bit unsigned integers from
+ * [\p lo, \p hi) and saves them to \p output_data.
+ *
+ * Methods are the same as in rocrand_generate_uniform_uint_range(): pseudo-random
+ * generators with rejection use two 32-bit values per attempt,
+ * ROCRAND_RNG_PSEUDO_MTGP32 uses four 32-bit values per output (the bias is
+ * less than 2^-64).
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 64-bit unsigned integers to generate
+ * \param lo - Lower bound of the range (inclusive)
+ * \param hi - Upper bound of the range (exclusive)
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p hi is not greater than \p lo \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_ulonglong_range(rocrand_generator generator,
+                                         unsigned long long * output_data, size_t n,
+                                         unsigned long long lo, unsigned long long hi);
+
 /**
  * \brief Generates uniformly distributed \p float values.
  *
@@ -272,6 +740,99 @@ rocrand_status ROCRANDAPI
 rocrand_generate_uniform_half(rocrand_generator generator,
                               half * output_data, size_t n);
 
+/**
+ * \brief Generates uniformly distributed bfloat16 values.
+ *
+ * Generates \p n uniformly distributed 16-bit bfloat16 floating-point
+ * values and saves them to \p output_data.
+ *
+ * Generated numbers are between \p 0.0 and \p 1.0, excluding \p 0.0 and
+ * including \p 1.0. Pseudo-random generators generate two values from every
+ * 32-bit random value and store eight values (16 bytes) at once.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>bfloat16</tt>s to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_bfloat16(rocrand_generator generator,
+                                  bfloat16 * output_data, size_t n);
+
+/**
+ * \brief Generates uniformly distributed 8-bit signed integers.
+ *
+ * Generates \p n uniformly distributed 8-bit signed integers from [-128; 127]
+ * and saves them to \p output_data (for example as noise of stochastic rounding
+ * of quantized values). Pseudo-random generators generate four values from every
+ * 32-bit random value and store sixteen values (16 bytes) at once.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 8-bit signed integers to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_int8(rocrand_generator generator,
+                              signed char * output_data, size_t n);
+
+/**
+ * \brief Generates uniformly distributed FP8 E4M3 values.
+ *
+ * Generates \p n uniformly distributed 8-bit floating-point values and saves
+ * them to \p output_data. Values are <tt>(k + 1) / 256</tt> for 8 random bits
+ * \p k rounded to the nearest FP8 E4M3 value, so they are between \p 0.0 and
+ * \p 1.0, excluding \p 0.0 and including \p 1.0. Pseudo-random generators
+ * generate four values from every 32-bit random value and store sixteen
+ * values (16 bytes) at once.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>rocrand_fp8_e4m3</tt>s to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_fp8_e4m3(rocrand_generator generator,
+                                  rocrand_fp8_e4m3 * output_data, size_t n);
+
+/**
+ * \brief Generates uniformly distributed FP8 E5M2 values.
+ *
+ * See rocrand_generate_uniform_fp8_e4m3().
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>rocrand_fp8_e5m2</tt>s to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_fp8_e5m2(rocrand_generator generator,
+                                  rocrand_fp8_e5m2 * output_data, size_t n);
+
 /**
  * \brief Generates normally distributed \p float values.
  *
@@ -345,18 +906,126 @@ rocrand_generate_normal_half(rocrand_generator generator,
                              half mean, half stddev);
 
 /**
- * \brief Generates log-normally distributed \p float values.
- *
- * Generates \p n log-normally distributed 32-bit floating-point values
- * and saves them to \p output_data.
- *
- * \param generator - Generator to use
- * \param output_data - Pointer to memory to store generated numbers
- * \param n - Number of <tt>float</tt>s to generate
- * \param mean - Mean value of log normal distribution
- * \param stddev - Standard deviation value of log normal distribution
- *
- * \return
+* \brief Generates normally distributed \p bfloat16 values.
+*
+* Generates \p n normally distributed 16-bit bfloat16 floating-point
+* numbers and saves them to \p output_data. Values are computed in single
+* precision and rounded to the nearest bfloat16. Pseudo-random generators
+* generate two values from every 32-bit random value and store eight values
+* (16 bytes) at once.
+*
+* \param generator - Generator to use
+* \param output_data - Pointer to memory to store generated numbers
+* \param n - Number of <tt>bfloat16</tt>s to generate
+* \param mean - Mean value of normal distribution
+* \param stddev - Standard deviation value of normal distribution
+*
+* \return
+* - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+* - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+* - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+* of used quasi-random generator \n
+* - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+*/
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_bfloat16(rocrand_generator generator,
+                                 bfloat16 * output_data, size_t n,
+                                 bfloat16 mean, bfloat16 stddev);
+
+/**
+ * \brief Generates normally distributed 8-bit signed integers.
+ *
+ * Generates \p n normally distributed values, computes them in single precision
+ * and saves them to \p output_data rounded to the nearest integer and saturated
+ * to [-128; 127] (for example quantized noise).
+ *
+ * Values are computed by the Box-Muller transform of pairs of 16-bit random values
+ * (whatever normal method is set), so pseudo-random generators generate two values
+ * from every 32-bit random value and store sixteen values (16 bytes) at once.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 8-bit signed integers to generate
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_int8(rocrand_generator generator,
+                             signed char * output_data, size_t n,
+                             float mean, float stddev);
+
+/**
+ * \brief Generates normally distributed FP8 E4M3 values.
+ *
+ * Generates \p n normally distributed values, computes them in single precision
+ * and saves them to \p output_data rounded to the nearest FP8 E4M3 value
+ * (values out of range saturate to -448 and 448).
+ * See rocrand_generate_normal_int8().
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>rocrand_fp8_e4m3</tt>s to generate
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_fp8_e4m3(rocrand_generator generator,
+                                 rocrand_fp8_e4m3 * output_data, size_t n,
+                                 float mean, float stddev);
+
+/**
+ * \brief Generates normally distributed FP8 E5M2 values.
+ *
+ * Generates \p n normally distributed values, computes them in single precision
+ * and saves them to \p output_data rounded to the nearest FP8 E5M2 value
+ * (values out of range saturate to -57344 and 57344).
+ * See rocrand_generate_normal_int8().
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>rocrand_fp8_e5m2</tt>s to generate
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_fp8_e5m2(rocrand_generator generator,
+                                 rocrand_fp8_e5m2 * output_data, size_t n,
+                                 float mean, float stddev);
+
+/**
+ * \brief Generates log-normally distributed \p float values.
+ *
+ * Generates \p n log-normally distributed 32-bit floating-point values
+ * and saves them to \p output_data.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>float</tt>s to generate
+ * \param mean - Mean value of log normal distribution
+ * \param stddev - Standard deviation value of log normal distribution
+ *
+ * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
  * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
  * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
@@ -417,202 +1086,3084 @@ rocrand_generate_log_normal_half(rocrand_generator generator,
                                  half mean, half stddev);
 
 /**
- * \brief Generates Poisson-distributed 32-bit unsigned integers.
+ * \brief Generates exponentially distributed \p float values.
  *
- * Generates \p n Poisson-distributed 32-bit unsigned integers and
- * saves them to \p output_data.
+ * Generates \p n exponentially distributed 32-bit floating-point values
+ * and saves them to \p output_data.
  *
  * \param generator - Generator to use
  * \param output_data - Pointer to memory to store generated numbers
- * \param n - Number of 32-bit unsigned integers to generate
- * \param lambda - lambda for the Poisson distribution
+ * \param n - Number of <tt>float</tt>s to generate
+ * \param lambda - Rate of exponential distribution (the mean is <tt>1 / lambda</tt>)
  *
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
  * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
- * - ROCRAND_STATUS_OUT_OF_RANGE if lambda is non-positive \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p lambda is non-positive \n
  * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
  * of used quasi-random generator \n
  * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
  */
 rocrand_status ROCRANDAPI
-rocrand_generate_poisson(rocrand_generator generator,
-                         unsigned int * output_data, size_t n,
-                         double lambda);
+rocrand_generate_exponential(rocrand_generator generator,
+                             float * output_data, size_t n,
+                             float lambda);
 
 /**
- * \brief Initializes the generator's state on GPU or host.
- *
- * Initializes the generator's state on GPU or host. User it not
- * required to call this function before using a generator.
+ * \brief Generates exponentially distributed \p double values.
  *
- * If rocrand_initialize() was not called for a generator, it will be
- * automatically called by functions which generates random numbers like
- * rocrand_generate(), rocrang_generate_uniform() etc.
+ * Generates \p n exponentially distributed 64-bit double-precision floating-point
+ * values and saves them to \p output_data.
  *
- * \param generator - Generator to initialize
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>double</tt>s to generate
+ * \param lambda - Rate of exponential distribution (the mean is <tt>1 / lambda</tt>)
  *
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
  * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
- * - ROCRAND_STATUS_SUCCESS if the seeds were generated successfully \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p lambda is non-positive \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
  */
 rocrand_status ROCRANDAPI
-rocrand_initialize_generator(rocrand_generator generator);
+rocrand_generate_exponential_double(rocrand_generator generator,
+                                    double * output_data, size_t n,
+                                    double lambda);
 
 /**
- * \brief Sets the current stream for kernel launches.
+ * \brief Generates gamma-distributed \p float values.
  *
- * Sets the current stream for all kernel launches of the generator.
- * All functions will use this stream.
+ * Generates \p n gamma-distributed 32-bit floating-point values
+ * and saves them to \p output_data.
  *
- * \param generator - Generator to modify
- * \param stream - Stream to use or NULL for default stream
+ * Values are sampled with Marsaglia-Tsang rejection method (the number of
+ * values consumed per output is not fixed), so only pseudo-random number
+ * generators other than ROCRAND_RNG_PSEUDO_MTGP32 are supported.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>float</tt>s to generate
+ * \param shape - Shape of gamma distribution
+ * \param scale - Scale of gamma distribution (the mean is <tt>shape * scale</tt>)
  *
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
- * - ROCRAND_STATUS_SUCCESS if stream was set successfully \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p shape or \p scale is non-positive \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not supported \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
  */
 rocrand_status ROCRANDAPI
-rocrand_set_stream(rocrand_generator generator, hipStream_t stream);
+rocrand_generate_gamma(rocrand_generator generator,
+                       float * output_data, size_t n,
+                       float shape, float scale);
 
 /**
- * \brief Sets the seed of a pseudo-random number generator.
+ * \brief Generates gamma-distributed \p double values.
  *
- * Sets the seed of the pseudo-random number generator.
- *
- * - This operation resets the generator's internal state.
- * - This operation does not change the generator's offset.
+ * Generates \p n gamma-distributed 64-bit double-precision floating-point
+ * values and saves them to \p output_data.
  *
- * For a MRG32K3a generator seed value can't be zero. If \p seed is
- * equal zero and generator's type is ROCRAND_RNG_PSEUDO_MRG32K3A,
- * value \p 12345 is used as a seed instead.
+ * See rocrand_generate_gamma() for supported generators.
  *
- * \param generator - Pseudo-random number generator
- * \param seed - New seed value
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>double</tt>s to generate
+ * \param shape - Shape of gamma distribution
+ * \param scale - Scale of gamma distribution (the mean is <tt>shape * scale</tt>)
  *
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
- * - ROCRAND_STATUS_TYPE_ERROR if the generator is a quasi-random number generator \n
- * - ROCRAND_STATUS_SUCCESS if seed was set successfully \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p shape or \p scale is non-positive \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not supported \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
  */
 rocrand_status ROCRANDAPI
-rocrand_set_seed(rocrand_generator generator, unsigned long long seed);
+rocrand_generate_gamma_double(rocrand_generator generator,
+                              double * output_data, size_t n,
+                              double shape, double scale);
 
 /**
- * \brief Sets the offset of a random number generator.
+ * \brief Generates beta-distributed \p float values.
  *
- * Sets the absolute offset of the random number generator.
+ * Generates \p n beta-distributed 32-bit floating-point values
+ * and saves them to \p output_data.
  *
- * - This operation resets the generator's internal state.
- * - This operation does not change the generator's seed.
+ * A value is <tt>x / (x + y)</tt> where \p x and \p y are gamma variates
+ * with shapes \p alpha and \p beta, see rocrand_generate_gamma() for
+ * supported generators.
  *
- * Absolute offset cannot be set if generator's type is ROCRAND_RNG_PSEUDO_MTGP32.
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>float</tt>s to generate
+ * \param alpha - First shape of beta distribution
+ * \param beta - Second shape of beta distribution
  *
- * \param generator - Random number generator
- * \param offset - New absolute offset
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p alpha or \p beta is non-positive \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not supported \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_beta(rocrand_generator generator,
+                      float * output_data, size_t n,
+                      float alpha, float beta);
+
+/**
+ * \brief Generates beta-distributed \p double values.
+ *
+ * Generates \p n beta-distributed 64-bit double-precision floating-point
+ * values and saves them to \p output_data.
+ *
+ * See rocrand_generate_beta().
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>double</tt>s to generate
+ * \param alpha - First shape of beta distribution
+ * \param beta - Second shape of beta distribution
  *
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
- * - ROCRAND_STATUS_SUCCESS if offset was successfully set \n
- * - ROCRAND_STATUS_TYPE_ERROR if generator's type is ROCRAND_RNG_PSEUDO_MTGP32
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p alpha or \p beta is non-positive \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not supported \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
  */
 rocrand_status ROCRANDAPI
-rocrand_set_offset(rocrand_generator generator, unsigned long long offset);
+rocrand_generate_beta_double(rocrand_generator generator,
+                             double * output_data, size_t n,
+                             double alpha, double beta);
 
 /**
- * \brief Set the number of dimensions of a quasi-random number generator.
+ * \brief Generates truncated normally distributed \p float values.
  *
- * Set the number of dimensions of a quasi-random number generator.
- * Supported values of \p dimensions are 1 to 20000.
+ * Generates \p n 32-bit floating-point values of the normal distribution with
+ * \p mean and \p stddev conditioned on the interval [\p lo, \p hi] and saves them
+ * to \p output_data. Bounds can be infinite for one-sided truncation.
  *
- * - This operation resets the generator's internal state.
- * - This operation does not change the generator's offset.
+ * Every value is generated in place by rejection in a thread of the generation
+ * kernel: normal values for wide intervals containing the mean, uniform proposals
+ * for narrow intervals and exponential proposals for tails (Robert's method), so
+ * fewer than 2.1 attempts per value are expected for all intervals.
  *
- * \param generator - Quasi-random number generator
- * \param dimensions - Number of dimensions
+ * See rocrand_generate_gamma() for supported generators.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>float</tt>s to generate
+ * \param mean - Mean value of the normal distribution
+ * \param stddev - Standard deviation of the normal distribution
+ * \param lo - Lower bound of the interval
+ * \param hi - Upper bound of the interval
  *
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
- * - ROCRAND_STATUS_TYPE_ERROR if the generator is not a quasi-random number generator \n
- * - ROCRAND_STATUS_OUT_OF_RANGE if \p dimensions is out of range \n
- * - ROCRAND_STATUS_SUCCESS if the number of dimensions was set successfully \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p stddev is non-positive or \p lo is not less than \p hi \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if the square of the distance from \p mean to [\p lo, \p hi]
+ *   in units of \p stddev is not finite \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not supported \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
  */
 rocrand_status ROCRANDAPI
-rocrand_set_quasi_random_generator_dimensions(rocrand_generator generator,
-                                              unsigned int dimensions);
+rocrand_generate_truncated_normal(rocrand_generator generator,
+                                  float * output_data, size_t n,
+                                  float mean, float stddev,
+                                  float lo, float hi);
 
 /**
- * \brief Returns the version number of the library.
+ * \brief Generates truncated normally distributed \p double values.
  *
- * Returns in \p version the version number of the dynamically linked
- * rocRAND library.
+ * Generates \p n truncated normally distributed 64-bit double-precision
+ * floating-point values and saves them to \p output_data.
  *
- * \param version - Version of the library
+ * See rocrand_generate_truncated_normal().
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>double</tt>s to generate
+ * \param mean - Mean value of the normal distribution
+ * \param stddev - Standard deviation of the normal distribution
+ * \param lo - Lower bound of the interval
+ * \param hi - Upper bound of the interval
  *
  * \return
- * - ROCRAND_STATUS_OUT_OF_RANGE if \p version is NULL \n
- * - ROCRAND_STATUS_SUCCESS if the version number was successfully returned \n
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p stddev is non-positive or \p lo is not less than \p hi \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if the square of the distance from \p mean to [\p lo, \p hi]
+ *   in units of \p stddev is not finite \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not supported \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
  */
 rocrand_status ROCRANDAPI
-rocrand_get_version(int * version);
+rocrand_generate_truncated_normal_double(rocrand_generator generator,
+                                         double * output_data, size_t n,
+                                         double mean, double stddev,
+                                         double lo, double hi);
 
 /**
- * \brief Construct the histogram for a Poisson distribution.
+ * \brief Generates uniformly distributed \p float values to a pitched buffer.
  *
- * Construct the histogram for the Poisson distribution with lambda \p lambda.
+ * Generates \p height rows of \p width uniformly distributed 32-bit
+ * floating-point values, the row \p r is saved to
+ * <tt>(char *)output_data + r * pitch</tt> (for example memory allocated
+ * by hipMallocPitch()). Rows get the same values as \p height consecutive
+ * rocrand_generate_uniform() calls of \p width values, padding between rows
+ * is not modified.
  *
- * \param lambda - lambda for the Poisson distribution
- * \param discrete_distribution - pointer to the histogram in device memory
+ * 3D buffers (hipMalloc3D()) with rows of slices directly following each other
+ * are generated as <tt>height * depth</tt> rows.
+ *
+ * XORWOW, MRG32K3A and stateless PHILOX4_32_10 generators generate all rows
+ * by one kernel launch, other generators generate rows one by one.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param pitch - Distance between starts of rows in bytes
+ * \param width - Number of <tt>float</tt>s in a row
+ * \param height - Number of rows
  *
  * \return
- * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
- * - ROCRAND_STATUS_OUT_OF_RANGE if \p discrete_distribution pointer was null \n
- * - ROCRAND_STATUS_OUT_OF_RANGE if lambda is non-positive \n
- * - ROCRAND_STATUS_SUCCESS if the histogram was constructed successfully \n
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p pitch is less than <tt>width * sizeof(float)</tt>
+ *   or is not a multiple of <tt>sizeof(float)</tt> \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if a row is not a multiple of the
+ *   dimension of a quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
  */
 rocrand_status ROCRANDAPI
-rocrand_create_poisson_distribution(double lambda,
-                                    rocrand_discrete_distribution * discrete_distribution);
+rocrand_generate_uniform_2d(rocrand_generator generator,
+                            float * output_data, size_t pitch,
+                            size_t width, size_t height);
 
 /**
- * \brief Construct the histogram for a custom discrete distribution.
+ * \brief Generates uniformly distributed \p double values to a pitched buffer.
  *
- * Construct the histogram for the discrete distribution of \p size
- * 32-bit unsigned integers from the range [\p offset, \p offset + \p size)
- * using \p probabilities as probabilities.
+ * Generates \p height rows of \p width uniformly distributed 64-bit
+ * double-precision floating-point values (see rocrand_generate_uniform_2d()).
  *
- * \param probabilities - probabilities of the the distribution in host memory
- * \param size - size of \p probabilities
- * \param offset - offset of values
- * \param discrete_distribution - pointer to the histogram in device memory
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param pitch - Distance between starts of rows in bytes
+ * \param width - Number of <tt>double</tt>s in a row
+ * \param height - Number of rows
  *
  * \return
- * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
- * - ROCRAND_STATUS_OUT_OF_RANGE if \p discrete_distribution pointer was null \n
- * - ROCRAND_STATUS_OUT_OF_RANGE if \p size was zero \n
- * - ROCRAND_STATUS_SUCCESS if the histogram was constructed successfully \n
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p pitch is less than <tt>width * sizeof(double)</tt>
+ *   or is not a multiple of <tt>sizeof(double)</tt> \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if a row is not a multiple of the
+ *   dimension of a quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
  */
 rocrand_status ROCRANDAPI
-rocrand_create_discrete_distribution(const double * probabilities,
-                                     unsigned int size,
-                                     unsigned int offset,
-                                     rocrand_discrete_distribution * discrete_distribution);
+rocrand_generate_uniform_double_2d(rocrand_generator generator,
+                                   double * output_data, size_t pitch,
+                                   size_t width, size_t height);
 
 /**
- * \brief Destroy the histogram array for a discrete distribution.
+ * \brief Generates normally distributed \p float values to a pitched buffer.
  *
- * Destroy the histogram array for a discrete distribution created by
- * rocrand_create_poisson_distribution.
+ * Generates \p height rows of \p width normally distributed 32-bit
+ * floating-point values (see rocrand_generate_uniform_2d()). Rows get
+ * the same values as \p height consecutive rocrand_generate_normal() calls.
  *
- * \param discrete_distribution - pointer to the histogram in device memory
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param pitch - Distance between starts of rows in bytes
+ * \param width - Number of <tt>float</tt>s in a row
+ * \param height - Number of rows
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
  *
  * \return
- * - ROCRAND_STATUS_OUT_OF_RANGE if \p discrete_distribution was null \n
- * - ROCRAND_STATUS_SUCCESS if the histogram was destroyed successfully \n
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p pitch is less than <tt>width * sizeof(float)</tt>
+ *   or is not a multiple of <tt>sizeof(float)</tt> \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if a row is not a multiple of the
+ *   dimension of a quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
  */
 rocrand_status ROCRANDAPI
-rocrand_destroy_discrete_distribution(rocrand_discrete_distribution discrete_distribution);
+rocrand_generate_normal_2d(rocrand_generator generator,
+                           float * output_data, size_t pitch,
+                           size_t width, size_t height,
+                           float mean, float stddev);
+
+/**
+ * \brief Generates normally distributed \p double values to a pitched buffer.
+ *
+ * Generates \p height rows of \p width normally distributed 64-bit
+ * double-precision floating-point values (see rocrand_generate_normal_2d()).
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param pitch - Distance between starts of rows in bytes
+ * \param width - Number of <tt>double</tt>s in a row
+ * \param height - Number of rows
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p pitch is less than <tt>width * sizeof(double)</tt>
+ *   or is not a multiple of <tt>sizeof(double)</tt> \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if a row is not a multiple of the
+ *   dimension of a quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_double_2d(rocrand_generator generator,
+                                  double * output_data, size_t pitch,
+                                  size_t width, size_t height,
+                                  double mean, double stddev);
+
+/**
+ * \brief Splits the generator into substreams for concurrent generation.
+ *
+ * Splits engines of the generator into \p count substreams of consecutive
+ * blocks of engines. Substreams generate with rocrand_generate_on() and
+ * other <tt>rocrand_generate_*_on</tt> functions in their own streams:
+ * the i-th substream uses <tt>streams[i]</tt> (the generator's stream if
+ * \p streams is NULL). A generator of the default ordering places its engines
+ * at consecutive subsequences of the seed, so substreams produce disjoint
+ * sequences without allocating more engines.
+ *
+ * Engines are initialized by this function, and calls for different
+ * substreams can be made concurrently from different host threads without
+ * locking. Calls for the same substream, other functions of the generator and
+ * work of different streams using the same substream must not overlap.
+ * Changing the seed, offset, ordering or launch configuration resets engines:
+ * substreams must be set again. \p count equal to 0 removes substreams.
+ *
+ * Supported by ROCRAND_RNG_PSEUDO_XORWOW and ROCRAND_RNG_PSEUDO_MRG32K3A
+ * generators.
+ *
+ * \param generator - Generator to modify
+ * \param count - Number of substreams, must divide the number of blocks
+ * of the launch configuration (see rocrand_get_launch_config())
+ * \param streams - Streams of substreams (\p count streams) or NULL
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if engines could not be initialized \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p count does not divide the number of blocks \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not support substreams \n
+ * - ROCRAND_STATUS_SUCCESS if substreams were set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_substreams(rocrand_generator generator,
+                       unsigned int count,
+                       const hipStream_t * streams);
+
+/**
+ * \brief Generates uniformly distributed 32-bit unsigned integers by a substream.
+ *
+ * Generates \p n uniformly distributed 32-bit unsigned integers with engines of
+ * the substream \p substream in its stream (see rocrand_set_substreams()) and
+ * saves them to \p output_data, as rocrand_generate() of a generator with these
+ * engines would.
+ *
+ * \param generator - Generator to use
+ * \param substream - Index of the substream
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>unsigned int</tt>s to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created or its engines
+ *   were reset after rocrand_set_substreams() \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p substream is not less than the number of substreams \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not support substreams \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_on(rocrand_generator generator,
+                    unsigned int substream,
+                    unsigned int * output_data, size_t n);
+
+/**
+ * \brief Generates uniformly distributed \p float values by a substream.
+ *
+ * Generates \p n uniformly distributed \p float values with engines of the
+ * substream \p substream in its stream (see rocrand_set_substreams()) and saves
+ * them to \p output_data, as rocrand_generate_uniform() of a generator with
+ * these engines would.
+ *
+ * \param generator - Generator to use
+ * \param substream - Index of the substream
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>float</tt>s to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created or its engines
+ *   were reset after rocrand_set_substreams() \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p substream is not less than the number of substreams \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not support substreams \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_on(rocrand_generator generator,
+                            unsigned int substream,
+                            float * output_data, size_t n);
+
+/**
+ * \brief Generates uniformly distributed \p double values by a substream.
+ *
+ * Generates \p n uniformly distributed \p double values with engines of the
+ * substream \p substream in its stream (see rocrand_set_substreams()) and saves
+ * them to \p output_data, as rocrand_generate_uniform_double() of a generator
+ * with these engines would.
+ *
+ * \param generator - Generator to use
+ * \param substream - Index of the substream
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>double</tt>s to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created or its engines
+ *   were reset after rocrand_set_substreams() \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p substream is not less than the number of substreams \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not support substreams \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_double_on(rocrand_generator generator,
+                                   unsigned int substream,
+                                   double * output_data, size_t n);
+
+/**
+ * \brief Generates normally distributed \p float values by a substream.
+ *
+ * Generates \p n normally distributed \p float values with engines of the
+ * substream \p substream in its stream (see rocrand_set_substreams()) and saves
+ * them to \p output_data, as rocrand_generate_normal() of a generator with
+ * these engines would.
+ *
+ * \param generator - Generator to use
+ * \param substream - Index of the substream
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>float</tt>s to generate
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created or its engines
+ *   were reset after rocrand_set_substreams() \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p substream is not less than the number of substreams \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not support substreams \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_on(rocrand_generator generator,
+                           unsigned int substream,
+                           float * output_data, size_t n,
+                           float mean, float stddev);
+
+/**
+ * \brief Generates normally distributed \p double values by a substream.
+ *
+ * Generates \p n normally distributed \p double values with engines of the
+ * substream \p substream in its stream (see rocrand_set_substreams()) and saves
+ * them to \p output_data, as rocrand_generate_normal_double() of a generator
+ * with these engines would.
+ *
+ * \param generator - Generator to use
+ * \param substream - Index of the substream
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>double</tt>s to generate
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created or its engines
+ *   were reset after rocrand_set_substreams() \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p substream is not less than the number of substreams \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not support substreams \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_double_on(rocrand_generator generator,
+                                  unsigned int substream,
+                                  double * output_data, size_t n,
+                                  double mean, double stddev);
+
+/**
+ * \brief Generates uniformly distributed 32-bit unsigned integers keyed by
+ * 64-bit counters.
+ *
+ * Generates \p n uniformly distributed 32-bit unsigned integers and saves them
+ * to \p output_data, the i-th value is the first value of the subsequence
+ * \p keys[i] of the generator's seed (the value of rocrand() of a device state
+ * initialized with <tt>rocrand_init(seed, keys[i], 0, &state)</tt>).
+ *
+ * Values are computed directly from the counter-based engine and its key,
+ * no engine states are stored or updated. The i-th value depends only on
+ * the seed and \p keys[i]: not on other keys, their order, \p n, the offset
+ * or previous generate calls, so work keyed by IDs (for example a particle
+ * and a time step) can be distributed in any way and stays reproducible.
+ * Equal keys give equal values.
+ *
+ * \p keys must be in device memory, or in host memory for generators
+ * created with rocrand_create_generator_host().
+ *
+ * Only counter-based generators are supported: ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+ * ROCRAND_RNG_PSEUDO_PHILOX4_32_7, ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
+ * ROCRAND_RNG_PSEUDO_THREEFRY2_64_20 and ROCRAND_RNG_PSEUDO_THREEFRY4_64_20.
+ *
+ * \param generator - Generator to use
+ * \param keys - Pointer to \p n keys
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>unsigned int</tt>s to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p keys or \p output_data is NULL and \p n is not 0 \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+ * ROCRAND_RNG_PSEUDO_PHILOX4_32_7, ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
+ * ROCRAND_RNG_PSEUDO_THREEFRY2_64_20 or ROCRAND_RNG_PSEUDO_THREEFRY4_64_20 \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_at(rocrand_generator generator,
+                    const unsigned long long * keys,
+                    unsigned int * output_data, size_t n);
+
+/**
+ * \brief Generates uniformly distributed \p float values keyed by 64-bit counters.
+ *
+ * Generates \p n uniformly distributed \p float values and saves them to \p output_data,
+ * the i-th value is computed from the first state of the subsequence
+ * \p keys[i] of the generator's seed, as rocrand_uniform() of a device
+ * state initialized with <tt>rocrand_init(seed, keys[i], 0, &state)</tt> would.
+ * See rocrand_generate_at().
+ *
+ * \param generator - Generator to use
+ * \param keys - Pointer to \p n keys
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>float</tt>s to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p keys or \p output_data is NULL and \p n is not 0 \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+ * ROCRAND_RNG_PSEUDO_PHILOX4_32_7, ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
+ * ROCRAND_RNG_PSEUDO_THREEFRY2_64_20 or ROCRAND_RNG_PSEUDO_THREEFRY4_64_20 \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_at(rocrand_generator generator,
+                            const unsigned long long * keys,
+                            float * output_data, size_t n);
+
+/**
+ * \brief Generates uniformly distributed \p double values keyed by 64-bit counters.
+ *
+ * Generates \p n uniformly distributed \p double values and saves them to \p output_data,
+ * the i-th value is computed from the first state of the subsequence
+ * \p keys[i] of the generator's seed, as rocrand_uniform_double() of a device
+ * state initialized with <tt>rocrand_init(seed, keys[i], 0, &state)</tt> would.
+ * See rocrand_generate_at().
+ *
+ * \param generator - Generator to use
+ * \param keys - Pointer to \p n keys
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>double</tt>s to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p keys or \p output_data is NULL and \p n is not 0 \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+ * ROCRAND_RNG_PSEUDO_PHILOX4_32_7, ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
+ * ROCRAND_RNG_PSEUDO_THREEFRY2_64_20 or ROCRAND_RNG_PSEUDO_THREEFRY4_64_20 \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_double_at(rocrand_generator generator,
+                                   const unsigned long long * keys,
+                                   double * output_data, size_t n);
+
+/**
+ * \brief Generates normally distributed \p float values keyed by 64-bit counters.
+ *
+ * Generates \p n normally distributed \p float values with the Box-Muller
+ * method and saves them to \p output_data,
+ * the i-th value is computed from the first state of the subsequence
+ * \p keys[i] of the generator's seed, like the first value of rocrand_normal2()
+ * of a device state initialized with <tt>rocrand_init(seed, keys[i], 0, &state)</tt>.
+ * See rocrand_generate_at().
+ *
+ * \param generator - Generator to use
+ * \param keys - Pointer to \p n keys
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>float</tt>s to generate
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p keys or \p output_data is NULL and \p n is not 0 \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+ * ROCRAND_RNG_PSEUDO_PHILOX4_32_7, ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
+ * ROCRAND_RNG_PSEUDO_THREEFRY2_64_20 or ROCRAND_RNG_PSEUDO_THREEFRY4_64_20 \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_at(rocrand_generator generator,
+                           const unsigned long long * keys,
+                           float * output_data, size_t n,
+                           float mean, float stddev);
+
+/**
+ * \brief Generates normally distributed \p double values keyed by 64-bit counters.
+ *
+ * Generates \p n normally distributed \p double values with the
+ * Box-Muller method and saves them to \p output_data,
+ * the i-th value is computed from the first state of the subsequence
+ * \p keys[i] of the generator's seed, like the first value of rocrand_normal_double2()
+ * of a device state initialized with <tt>rocrand_init(seed, keys[i], 0, &state)</tt>.
+ * See rocrand_generate_at().
+ *
+ * \param generator - Generator to use
+ * \param keys - Pointer to \p n keys
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>double</tt>s to generate
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p keys or \p output_data is NULL and \p n is not 0 \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+ * ROCRAND_RNG_PSEUDO_PHILOX4_32_7, ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
+ * ROCRAND_RNG_PSEUDO_THREEFRY2_64_20 or ROCRAND_RNG_PSEUDO_THREEFRY4_64_20 \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_double_at(rocrand_generator generator,
+                                  const unsigned long long * keys,
+                                  double * output_data, size_t n,
+                                  double mean, double stddev);
+
+/**
+ * \brief Generates a tile of a random matrix of uniformly distributed \p float values.
+ *
+ * Generates entries of rows [\p row, \p row + \p height) and columns
+ * [\p col, \p col + \p width) of the random matrix \p matrix_id of the
+ * generator's seed, the row \p r of the tile is saved to
+ * <tt>(char *)output_data + r * pitch</tt>. Entries are the same as
+ * rocrand_matrix_uniform4() of a matrix initialized on the device with
+ * <tt>rocrand_matrix_init(seed, matrix_id, &matrix)</tt>, so kernels can
+ * regenerate any part of the matrix instead of reading it from memory.
+ *
+ * Entries do not depend on the offset, previous generate calls or other tiles,
+ * engines of the generator are neither used nor changed.
+ *
+ * Only ROCRAND_RNG_PSEUDO_PHILOX4_32_10 generators are supported.
+ *
+ * \param generator - Generator to use
+ * \param matrix_id - Id of the matrix
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param pitch - Distance between starts of rows in bytes
+ * \param row - First row of the tile
+ * \param col - First column of the tile
+ * \param width - Number of columns of the tile
+ * \param height - Number of rows of the tile
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p pitch is less than <tt>width * sizeof(float)</tt>
+ *   or is not a multiple of <tt>sizeof(float)</tt>, if \p output_data is NULL
+ *   and the tile is not empty, or if the tile is outside of the matrix
+ *   (2^32 rows and 2^34 columns) \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not ROCRAND_RNG_PSEUDO_PHILOX4_32_10 \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_matrix_uniform(rocrand_generator generator,
+                                unsigned long long matrix_id,
+                                float * output_data, size_t pitch,
+                                unsigned long long row, unsigned long long col,
+                                size_t width, size_t height);
+
+/**
+ * \brief Generates a tile of a random matrix of normally distributed \p float values.
+ *
+ * Entries are <tt>mean + stddev * x</tt>, where \p x is the entry of
+ * rocrand_matrix_normal4(). See rocrand_generate_matrix_uniform().
+ *
+ * \param generator - Generator to use
+ * \param matrix_id - Id of the matrix
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param pitch - Distance between starts of rows in bytes
+ * \param row - First row of the tile
+ * \param col - First column of the tile
+ * \param width - Number of columns of the tile
+ * \param height - Number of rows of the tile
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p pitch is less than <tt>width * sizeof(float)</tt>
+ *   or is not a multiple of <tt>sizeof(float)</tt>, if \p output_data is NULL
+ *   and the tile is not empty, or if the tile is outside of the matrix \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not ROCRAND_RNG_PSEUDO_PHILOX4_32_10 \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_matrix_normal(rocrand_generator generator,
+                               unsigned long long matrix_id,
+                               float * output_data, size_t pitch,
+                               unsigned long long row, unsigned long long col,
+                               size_t width, size_t height,
+                               float mean, float stddev);
+
+/**
+ * \brief Generates a tile of a random matrix of Rademacher distributed \p float
+ * values (-1 or 1).
+ *
+ * Entries are the same as rocrand_matrix_rademacher4(). See rocrand_generate_matrix_uniform().
+ *
+ * \param generator - Generator to use
+ * \param matrix_id - Id of the matrix
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param pitch - Distance between starts of rows in bytes
+ * \param row - First row of the tile
+ * \param col - First column of the tile
+ * \param width - Number of columns of the tile
+ * \param height - Number of rows of the tile
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p pitch is less than <tt>width * sizeof(float)</tt>
+ *   or is not a multiple of <tt>sizeof(float)</tt>, if \p output_data is NULL
+ *   and the tile is not empty, or if the tile is outside of the matrix \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not ROCRAND_RNG_PSEUDO_PHILOX4_32_10 \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_matrix_rademacher(rocrand_generator generator,
+                                   unsigned long long matrix_id,
+                                   float * output_data, size_t pitch,
+                                   unsigned long long row, unsigned long long col,
+                                   size_t width, size_t height);
+
+/**
+ * \brief Generates Bernoulli decisions packed as bits.
+ *
+ * Generates \p n 32-bit words of Bernoulli decisions (<tt>n * 32</tt> decisions)
+ * and saves them to \p output_data. Bit \p k of word \p w is decision
+ * <tt>32 * w + k</tt>, it is 1 with probability \p p.
+ *
+ * Every decision is taken from an 8-bit slice of generated values, so \p p
+ * is rounded to the nearest multiple of 1/256. Only pseudo-random number
+ * generators are supported.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated words
+ * \param n - Number of 32-bit words to generate
+ * \param p - Probability of 1
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p p is not in [0, 1] \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is quasi-random \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_bernoulli(rocrand_generator generator,
+                           unsigned int * output_data, size_t n,
+                           double p);
+
+/**
+ * \brief Generates Bernoulli decisions as bytes.
+ *
+ * Generates \p n Bernoulli decisions and saves them to \p output_data
+ * as bytes, a byte is 1 with probability \p p and 0 otherwise.
+ *
+ * See rocrand_generate_bernoulli() for precision of \p p and supported generators.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated bytes
+ * \param n - Number of bytes to generate
+ * \param p - Probability of 1
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p p is not in [0, 1] \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is quasi-random \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_bernoulli_char(rocrand_generator generator,
+                                unsigned char * output_data, size_t n,
+                                double p);
+
+/**
+ * \brief Generates Poisson-distributed 32-bit unsigned integers.
+ *
+ * Generates \p n Poisson-distributed 32-bit unsigned integers and
+ * saves them to \p output_data.
+ *
+ * Pseudo-random number generators other than ROCRAND_RNG_PSEUDO_MTGP32 sample \p lambda
+ * of at least 4000 with a rejection method that needs no precomputed tables
+ * (the number of values consumed per output is not fixed), other generators
+ * and smaller values of \p lambda use precomputed tables.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 32-bit unsigned integers to generate
+ * \param lambda - lambda for the Poisson distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if lambda is non-positive \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_poisson(rocrand_generator generator,
+                         unsigned int * output_data, size_t n,
+                         double lambda);
+
+/**
+ * \brief Generates Poisson-distributed 32-bit unsigned integers with
+ * a lambda for every value.
+ *
+ * Generates \p n Poisson-distributed 32-bit unsigned integers and saves them
+ * to \p output_data, the i-th value has lambda \p lambdas[i]. Lambdas must be
+ * non-negative. No precomputed tables are used: small lambdas are sampled by
+ * inversion, large ones with a rejection method, so the number of generator's
+ * values consumed per output is not fixed.
+ *
+ * \p lambdas must be in device memory, or in host memory for generators
+ * created with rocrand_create_generator_host().
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param lambdas - Pointer to \p n lambdas for the Poisson distribution
+ * \param n - Number of 32-bit unsigned integers to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not a pseudo-random number generator
+ * or is ROCRAND_RNG_PSEUDO_MTGP32 \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_poisson_array(rocrand_generator generator,
+                               unsigned int * output_data,
+                               const double * lambdas, size_t n);
+
+/**
+ * \brief Generates binomially distributed 32-bit unsigned integers.
+ *
+ * Generates \p n binomially distributed 32-bit unsigned integers (numbers of
+ * successes in \p trials trials with success probability \p p) and saves them
+ * to \p output_data. No precomputed tables are used: inversion is used if
+ * trials * min(p, 1 - p) < 10 and transformed rejection (BTRS) otherwise,
+ * so the number of generator's values consumed per output is not fixed.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 32-bit unsigned integers to generate
+ * \param trials - Number of trials
+ * \param p - Success probability of a trial
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p p is not in [0, 1] \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not a pseudo-random number generator
+ * or is ROCRAND_RNG_PSEUDO_MTGP32 \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_binomial(rocrand_generator generator,
+                          unsigned int * output_data, size_t n,
+                          unsigned int trials, double p);
+
+/**
+ * \brief Generates binomially distributed 32-bit unsigned integers with
+ * parameters for every value.
+ *
+ * Generates \p n binomially distributed 32-bit unsigned integers and saves
+ * them to \p output_data, the i-th value has \p trials[i] trials with success
+ * probability \p p[i]. Probabilities must be in [0, 1]. Methods are chosen
+ * for every value like in rocrand_generate_binomial().
+ *
+ * \p trials and \p p must be in device memory, or in host memory for
+ * generators created with rocrand_create_generator_host().
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param trials - Pointer to \p n numbers of trials
+ * \param p - Pointer to \p n success probabilities
+ * \param n - Number of 32-bit unsigned integers to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p trials or \p p is NULL \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not a pseudo-random number generator
+ * or is ROCRAND_RNG_PSEUDO_MTGP32 \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_binomial_array(rocrand_generator generator,
+                                unsigned int * output_data,
+                                const unsigned int * trials, const double * p,
+                                size_t n);
+
+/**
+ * \brief Generates multinomially distributed vectors of 32-bit unsigned integers.
+ *
+ * Generates \p n vectors of \p categories counts, every vector distributes
+ * \p trials trials between categories with probabilities proportional to
+ * \p weights. Counts are stored by category: the count of category c of
+ * the i-th vector is <tt>output_data[c * n + i]</tt>, so \p output_data must
+ * have room for \p n * \p categories values. The counts of a vector are
+ * sampled by the conditional binomial method (see rocrand_generate_binomial()).
+ *
+ * \p weights must be non-negative and are normalized by their sum, they must
+ * be in device memory, or in host memory for generators created with
+ * rocrand_create_generator_host().
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated counts
+ * \param n - Number of vectors to generate
+ * \param trials - Number of trials of every vector
+ * \param weights - Pointer to \p categories weights of categories
+ * \param categories - Number of categories
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p weights is NULL or \p categories is 0 \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not a pseudo-random number generator
+ * or is ROCRAND_RNG_PSEUDO_MTGP32 \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_multinomial(rocrand_generator generator,
+                             unsigned int * output_data, size_t n,
+                             unsigned int trials, const double * weights,
+                             unsigned int categories);
+
+/**
+ * \brief Generates discrete-distributed 32-bit unsigned integers.
+ *
+ * Generates \p n 32-bit unsigned integers distributed according to
+ * the discrete distribution \p discrete_distribution and saves them
+ * to \p output_data.
+ *
+ * \p discrete_distribution can be created with
+ * rocrand_create_discrete_distribution(),
+ * rocrand_create_discrete_distribution_device() or
+ * rocrand_create_poisson_distribution(). For generators created with
+ * rocrand_create_generator_host() its tables are copied to the host on
+ * every call. Pseudo-random number generators other than ROCRAND_RNG_PSEUDO_MTGP32
+ * keep alias tables of up to 2048 values in shared memory.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 32-bit unsigned integers to generate
+ * \param discrete_distribution - Histogram of the distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p discrete_distribution was null \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_discrete(rocrand_generator generator,
+                          unsigned int * output_data, size_t n,
+                          const rocrand_discrete_distribution discrete_distribution);
+
+/**
+ * \brief Sets the number of Poisson distributions cached by a generator.
+ *
+ * rocrand_generate_poisson() computes a table of probabilities for \p lambda
+ * and copies it to the device. A generator keeps tables of up to \p capacity
+ * most recently used lambdas, so alternating between them does not recompute
+ * tables. The default capacity is 1.
+ *
+ * - This operation does not change the generator's internal state.
+ *
+ * \param generator - Generator to modify
+ * \param capacity - Maximum number of cached lambdas
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p capacity is 0 \n
+ * - ROCRAND_STATUS_SUCCESS if the capacity was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_poisson_cache_capacity(rocrand_generator generator,
+                                   size_t capacity);
+
+/**
+ * \brief Precomputes Poisson distributions for lambdas.
+ *
+ * Computes and caches tables of \p count lambdas, so subsequent
+ * rocrand_generate_poisson() calls with these lambdas do not compute them.
+ * If \p count is greater than the cache capacity (see
+ * rocrand_set_poisson_cache_capacity()), only the last lambdas are kept.
+ * Lambdas sampled without tables are skipped.
+ *
+ * rocrand_generate_poisson() calls captured into a HIP graph can only use
+ * prepared lambdas. Their tables are referenced by the graph, so they must stay
+ * cached while the graph can run.
+ *
+ * - This operation does not change the generator's internal state.
+ *
+ * \param generator - Generator to modify
+ * \param lambdas - Pointer to \p count lambdas in host memory
+ * \param count - Number of lambdas
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if a lambda is non-positive \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_SUCCESS if the distributions were computed successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_prepare_poisson(rocrand_generator generator,
+                        const double * lambdas, size_t count);
+
+/**
+ * \brief Initializes the generator's state on GPU or host.
+ *
+ * Initializes the generator's state on GPU or host. User it not
+ * required to call this function before using a generator.
+ *
+ * If rocrand_initialize() was not called for a generator, it will be
+ * automatically called by functions which generates random numbers like
+ * rocrand_generate(), rocrang_generate_uniform() etc.
+ *
+ * If ROCRAND_STATE_CACHE_DIR environment variable is set to an existing directory,
+ * initialized states of ROCRAND_RNG_PSEUDO_XORWOW, ROCRAND_RNG_PSEUDO_MRG32K3A and
+ * ROCRAND_RNG_PSEUDO_MTGP32 generators are stored in files in that directory, keyed by
+ * generator type, seed, offset and launch configuration. Later initializations
+ * with the same values (in any process) copy the states from the files instead of
+ * computing them.
+ *
+ * Generation functions can be captured into a HIP graph (by stream capture of the
+ * generator's stream or with rocrand_generate_graph_node() and similar functions)
+ * only after the generator is initialized by this function: initialization allocates
+ * memory and waits for the device, which is not allowed during capture. Poisson
+ * distributions must be computed before capture too (see rocrand_prepare_poisson()).
+ * Generation functions return ROCRAND_STATUS_ALLOCATION_FAILED instead of breaking
+ * the capture.
+ *
+ * \param generator - Generator to initialize
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if the seeds were generated successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_initialize_generator(rocrand_generator generator);
+
+/**
+ * \brief Starts initialization of the generator's state without blocking.
+ *
+ * Starts initialization of the generator's state in an internal stream and
+ * returns without waiting for it. Kernels launched by the generator in its
+ * current stream (see rocrand_set_stream()) wait for the initialization only
+ * when the state is needed, so the initialization overlaps with other work
+ * performed before the next call of a generation function.
+ *
+ * Initialization is asynchronous for ROCRAND_RNG_PSEUDO_XORWOW and
+ * ROCRAND_RNG_PSEUDO_MRG32K3A device generators, which perform expensive
+ * skipahead for every engine. For other generators this function is
+ * equivalent to rocrand_initialize_generator().
+ *
+ * States of XORWOW and MRG32K3A generators initialized with the same seed and
+ * offset are cached by the generator, so changing the seed back to a previously
+ * used value copies cached states instead of repeating the skipahead. At most
+ * 4 states of at most 16 MiB in total are cached (the memory is counted by
+ * rocrand_get_memory_usage() and freed by rocrand_generator_trim()).
+ * If ROCRAND_STATE_CACHE_DIR is set (see rocrand_initialize_generator()), the
+ * states are stored to the cache file by the next generation function, which
+ * waits for the initialization then.
+ *
+ * \param generator - Generator to initialize
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the internal stream or event could not be created \n
+ * - ROCRAND_STATUS_SUCCESS if the initialization was started successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_initialize_generator_async(rocrand_generator generator);
+
+/**
+ * \brief Sets the current stream for kernel launches.
+ *
+ * Sets the current stream for all kernel launches of the generator.
+ * All functions will use this stream.
+ *
+ * \param generator - Generator to modify
+ * \param stream - Stream to use or NULL for default stream
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_SUCCESS if stream was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_stream(rocrand_generator generator, hipStream_t stream);
+
+/**
+ * \brief Returns the current stream for kernel launches.
+ *
+ * \param generator - Generator
+ * \param stream - Pointer to the stream set by rocrand_set_stream()
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p stream is NULL \n
+ * - ROCRAND_STATUS_SUCCESS if the stream was returned successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_get_stream(rocrand_generator generator, hipStream_t * stream);
+
+/**
+ * \brief Sets the seed of a pseudo-random number generator.
+ *
+ * Sets the seed of the pseudo-random number generator.
+ *
+ * - This operation resets the generator's internal state.
+ * - This operation does not change the generator's offset.
+ *
+ * For a MRG32K3a generator seed value can't be zero. If \p seed is
+ * equal zero and generator's type is ROCRAND_RNG_PSEUDO_MRG32K3A,
+ * value \p 12345 is used as a seed instead.
+ *
+ * \param generator - Pseudo-random number generator
+ * \param seed - New seed value
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a quasi-random number generator \n
+ * - ROCRAND_STATUS_SUCCESS if seed was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_seed(rocrand_generator generator, unsigned long long seed);
+
+/**
+ * \brief Sets the offset of a random number generator.
+ *
+ * Sets the absolute offset of the random number generator.
+ *
+ * - This operation resets the generator's internal state.
+ * - This operation does not change the generator's seed.
+ *
+ * For ROCRAND_RNG_PSEUDO_MTGP32 every engine (one per block, see
+ * rocrand_set_launch_config()) skips \p offset values of its own sequence.
+ * The state is advanced with the characteristic polynomial of the engine's
+ * parameter set when the generator is initialized, so the initialization
+ * time does not depend on \p offset.
+ *
+ * \param generator - Random number generator
+ * \param offset - New absolute offset
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_SUCCESS if offset was successfully set \n
+ * - ROCRAND_STATUS_TYPE_ERROR if generator's type does not support offsets
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_offset(rocrand_generator generator, unsigned long long offset);
+
+/**
+ * \brief Set the number of dimensions of a quasi-random number generator.
+ *
+ * Set the number of dimensions of a quasi-random number generator.
+ * Supported values of \p dimensions are 1 to 20000.
+ *
+ * ROCRAND_RNG_QUASI_SOBOL32 and ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32 produce
+ * at most 2^32 points per dimension, ROCRAND_RNG_QUASI_SOBOL64 and
+ * ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64 produce 2^64 points per dimension
+ * with 64-bit values. Scrambled generators XOR all values of a dimension
+ * with a per-dimension scramble constant (random digital shift).
+ *
+ * ROCRAND_RNG_QUASI_LATTICE32 supports 1 to 1048576 dimensions (or the size
+ * of the generating vector set by rocrand_set_lattice_generating_vector()),
+ * ROCRAND_RNG_QUASI_HALTON32 and ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32
+ * support 1 to 65536 dimensions. These generators produce at most 2^32 points
+ * per dimension.
+ *
+ * - This operation resets the generator's internal state.
+ * - This operation does not change the generator's offset.
+ *
+ * \param generator - Quasi-random number generator
+ * \param dimensions - Number of dimensions
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not a quasi-random number generator \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p dimensions is out of range \n
+ * - ROCRAND_STATUS_SUCCESS if the number of dimensions was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_quasi_random_generator_dimensions(rocrand_generator generator,
+                                              unsigned int dimensions);
+
+/**
+ * \brief Sets the generating vector of a lattice quasi-random number generator.
+ *
+ * Point \p i of dimension \p d of ROCRAND_RNG_QUASI_LATTICE32 is the fractional
+ * part of phi(i) * vector[d] / 2^32, where phi(i) is the radical inverse of \p i
+ * in base 2, so the first 2^m points form a rank-1 lattice rule of 2^m points.
+ * By default the generator uses a Korobov vector (z[d] = a^d mod 2^32),
+ * vectors constructed component-by-component for an integrand can be set by
+ * this function. The number of dimensions is set to \p dimensions, it cannot
+ * be increased later.
+ *
+ * - This operation resets the generator's internal state.
+ * - This operation does not change the generator's offset.
+ *
+ * \param generator - Lattice quasi-random number generator
+ * \param vector - Pointer to \p dimensions components of the generating vector
+ * in host memory
+ * \param dimensions - Number of dimensions
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not ROCRAND_RNG_QUASI_LATTICE32 \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p vector is NULL or \p dimensions is out of range \n
+ * - ROCRAND_STATUS_SUCCESS if the generating vector was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_lattice_generating_vector(rocrand_generator generator,
+                                      const unsigned int * vector,
+                                      unsigned int dimensions);
+
+/**
+ * \brief Sets the ordering of values generated by a quasi-random number generator
+ * or the initialization of engines of a pseudo-random number generator.
+ *
+ * Sets the layout in which a quasi-random number generator stores the \p n / \p d
+ * points of \p d dimensions produced by a generate call:
+ * - ROCRAND_ORDERING_QUASI_DEFAULT - the \p j-th coordinate of the \p i-th point
+ * is stored at index \p j * (\p n / \p d) + \p i (all points of a dimension are contiguous) \n
+ * - ROCRAND_ORDERING_QUASI_INTERLEAVED - the \p j-th coordinate of the \p i-th point
+ * is stored at index \p i * \p d + \p j (all dimensions of a point are contiguous) \n
+ *
+ * The ordering changes only the layout, not the generated sequences.
+ * This operation does not change the generator's internal state.
+ *
+ * For XORWOW and MRG32k3a generators it sets how their engines are initialized:
+ * - ROCRAND_ORDERING_PSEUDO_DEFAULT - the \p i-th engine starts at the \p i-th
+ * subsequence of the seed (default) \n
+ * - ROCRAND_ORDERING_PSEUDO_SEEDED - the \p i-th engine is seeded with a hash
+ * of the seed and \p i, engines are initialized without skipping ahead, which is
+ * much faster, but sequences of engines are not guaranteed not to overlap \n
+ * - ROCRAND_ORDERING_PSEUDO_DYNAMIC - the number of engines is fixed to 131072
+ * (512 blocks of 256 threads), the \p i-th engine starts at the \p i-th subsequence
+ * of the seed and the \p k-th value (vector of values of a distribution that
+ * produces several values at once) of a generate call is produced by the engine
+ * \p k % 131072. The library chooses the block size from occupancy of the current
+ * device, rocrand_set_launch_config() may change it to any \p threads dividing
+ * 131072 and \p blocks not greater than 131072 / \p threads, without resetting
+ * the state. Threads of smaller grids run several engines one after another.
+ * The results are bitwise identical for every such launch configuration and equal
+ * to ROCRAND_ORDERING_PSEUDO_DEFAULT with the default launch configuration \n
+ *
+ * For MTGP32 generators ROCRAND_ORDERING_PSEUDO_DEFAULT runs one engine per block
+ * (default), ROCRAND_ORDERING_PSEUDO_DYNAMIC fixes the number of engines to 512
+ * and the \p i-th block runs the engines \p i, \p i + \p blocks, ..., where the
+ * number of blocks (at most 512) is chosen from occupancy or set by
+ * rocrand_set_launch_config() without resetting the state, the results do not
+ * depend on it.
+ *
+ * Setting a different pseudo-random ordering resets the generator's state.
+ *
+ * \param generator - Quasi-random or XORWOW, MRG32k3a or MTGP32 number generator
+ * \param ordering - Ordering of generated values
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not support orderings
+ *   or \p ordering is an ordering of a different kind of generator \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p ordering is not a valid ordering \n
+ * - ROCRAND_STATUS_SUCCESS if the ordering was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_ordering(rocrand_generator generator,
+                     rocrand_ordering ordering);
+
+/**
+ * \brief Sets the method used to generate normally distributed values.
+ *
+ * Sets the method used by rocrand_generate_normal() and rocrand_generate_normal_double()
+ * of a pseudo-random number generator:
+ * - ROCRAND_NORMAL_METHOD_BOX_MULLER - Box-Muller transform (default) \n
+ * - ROCRAND_NORMAL_METHOD_ZIGGURAT - ziggurat method, it is faster than Box-Muller
+ * (especially in double precision), but the number of the generator's values
+ * consumed for one normally distributed value is not fixed \n
+ *
+ * Methods produce different sequences. Log-normal distributions and multi-device
+ * generators always use the Box-Muller transform.
+ *
+ * - This operation does not change the generator's internal state.
+ *
+ * \param generator - Pseudo-random number generator
+ * \param method - Method of generating normally distributed values
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not a pseudo-random number generator
+ * or is ROCRAND_RNG_PSEUDO_MTGP32 \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p method is not a valid method \n
+ * - ROCRAND_STATUS_SUCCESS if the method was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_normal_method(rocrand_generator generator,
+                          rocrand_normal_method method);
+
+/**
+ * \brief Sets the policy of storing generated values.
+ *
+ * Sets how kernels of the generator write generated values to device memory:
+ * - ROCRAND_STORE_POLICY_DEFAULT - regular stores (default) \n
+ * - ROCRAND_STORE_POLICY_STREAMING - non-temporal (streaming) stores, values
+ * are not kept in caches, so generation of large outputs that are used much later
+ * or by another device does not evict data of kernels running at the same time \n
+ *
+ * Policies produce the same values. Host-side generators and platforms without
+ * non-temporal stores use regular stores.
+ *
+ * - This operation does not change the generator's internal state.
+ *
+ * \param generator - Generator to modify
+ * \param policy - Policy of storing generated values
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p policy is not a valid policy \n
+ * - ROCRAND_STATUS_SUCCESS if the policy was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_store_policy(rocrand_generator generator,
+                         rocrand_store_policy policy);
+
+/**
+ * \brief Sets the precision of normal and log-normal transforms.
+ *
+ * Sets which math functions single-precision normal and log-normal
+ * distributions of the generator use:
+ * - ROCRAND_PRECISION_DEFAULT - full-precision functions (default) \n
+ * - ROCRAND_PRECISION_FAST - hardware intrinsics for logarithms and exponents,
+ * values differ from the default precision in the last bits and the
+ * relative error of tails of distributions is larger \n
+ *
+ * Double-precision, half-precision and bfloat16 distributions, the Ziggurat
+ * method, rocrand_generate_batch() and host-side generators always use
+ * full-precision functions. Device functions use intrinsics when
+ * \p ROCRAND_FAST_MATH is defined before rocRAND headers are included.
+ *
+ * - This operation does not change the generator's internal state.
+ *
+ * \param generator - Generator to modify
+ * \param precision - Precision of normal and log-normal transforms
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p precision is not a valid precision \n
+ * - ROCRAND_STATUS_SUCCESS if the precision was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_precision(rocrand_generator generator,
+                      rocrand_precision precision);
+
+/**
+ * \brief Sets the policy of prefetching managed output buffers.
+ *
+ * Sets what generation functions do when their output buffer was allocated
+ * by hipMallocManaged() (memory that migrates between the host and devices):
+ * - ROCRAND_MANAGED_POLICY_DEFAULT - the buffer is prefetched to its device
+ * (hipPointerGetAttributes()) in the generator's stream (hipMemPrefetchAsync()) before values are
+ * generated, so kernels do not fault on its pages (default) \n
+ * - ROCRAND_MANAGED_POLICY_NONE - output pointers are not inspected, pages
+ * migrate on demand when kernels access them \n
+ * - ROCRAND_MANAGED_POLICY_PREFETCH_HOST - as the default policy, then the buffer
+ * is prefetched back to the host in the same stream, for values that are read
+ * by the host \n
+ *
+ * Policies produce the same values. Prefetching is a hint: it is skipped
+ * for other buffers, host-side generators, streams that are being captured
+ * and while a HIP error is pending (hipPeekAtLastError()), failures to
+ * prefetch are ignored. Functions generating to one buffer of
+ * \p n values (for example rocrand_generate_uniform() and
+ * rocrand_generate_uniform_2d()) use the policy.
+ *
+ * - This operation does not change the generator's internal state.
+ *
+ * \param generator - Generator to modify
+ * \param policy - Policy of prefetching managed output buffers
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p policy is not a valid policy \n
+ * - ROCRAND_STATUS_SUCCESS if the policy was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_managed_policy(rocrand_generator generator,
+                           rocrand_managed_policy policy);
+
+/**
+ * \brief Enables or disables stateless generation.
+ *
+ * In stateless mode a ROCRAND_RNG_PSEUDO_PHILOX4_32_10 generator does not
+ * allocate or use engines: every thread computes its values directly from
+ * the seed and counters derived from the generator's position and the index
+ * of the value. Kernels do not load or store engine states and the generator
+ * does not use device memory, so small generations have lower latency.
+ * The position starts at the generator's offset and is advanced by the number
+ * of generated values, the generated sequence does not depend on
+ * the launch configuration.
+ *
+ * Stateless and regular generators produce different sequences.
+ * The state of a stateless generator returned by rocrand_get_state() is its
+ * position (8 bytes).
+ *
+ * - This operation resets the generator's internal state.
+ *
+ * \param generator - Pseudo-random number generator
+ * \param stateless - Non-zero value to enable stateless mode, 0 to disable it
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not
+ * ROCRAND_RNG_PSEUDO_PHILOX4_32_10 \n
+ * - ROCRAND_STATUS_SUCCESS if the mode was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_stateless(rocrand_generator generator,
+                      int stateless);
+
+/**
+ * \brief Sets the launch configuration of a random number generator.
+ *
+ * Sets the number of blocks and threads per block used by the kernels of
+ * the random number generator. When both \p blocks and \p threads are 0
+ * the configuration is chosen automatically: \p threads is set to the default
+ * value and \p blocks is computed from kernel occupancy of the current device
+ * (its number of compute units multiplied by the number of simultaneously active blocks
+ * per compute unit). The chosen values can be queried with rocrand_get_launch_config().
+ *
+ * Pseudo-random number generators use a fixed mapping between threads and engines:
+ * - ROCRAND_RNG_PSEUDO_XORWOW, ROCRAND_RNG_PSEUDO_MRG32K3A, ROCRAND_RNG_PSEUDO_XOSHIRO128PP
+ * and ROCRAND_RNG_PSEUDO_PCG32 use \p blocks * \p threads engines, one per thread,
+ * \p i-th engine uses \p i-th subsequence (a stream for PCG32). \n
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_32_10, ROCRAND_RNG_PSEUDO_PHILOX4_32_7,
+ * ROCRAND_RNG_PSEUDO_PHILOX4_64_10, ROCRAND_RNG_PSEUDO_THREEFRY2_64_20 and
+ * ROCRAND_RNG_PSEUDO_THREEFRY4_64_20 use \p blocks * \p threads / 16 engines, 16 threads per engine, \p threads must be
+ * a multiple of 16. \n
+ * - ROCRAND_RNG_PSEUDO_MTGP32 uses \p blocks engines, one per block, \p threads must be
+ * equal to 256 and \p blocks must not be greater than 4096. There are 512 MTGP32
+ * parameter sets, engine \p i uses the parameter set \p i % 512 and its own seed. \n
+ *
+ * Generated sequences depend only on the launch configuration, seed and offset, so they
+ * are reproducible for the same configuration on any device. The default configuration
+ * produces the same sequences as previous versions of the library.
+ * With ROCRAND_ORDERING_PSEUDO_DYNAMIC (see rocrand_set_ordering()) XORWOW, MRG32k3a
+ * and MTGP32 generators keep their number of engines, the configuration may run
+ * fewer threads (blocks) than engines and generated sequences do not depend on it.
+ *
+ * If ROCRAND_TUNING_DIR environment variable is set to a directory with the tuning
+ * database of the current device written by the rocrand-tune tool, generators whose
+ * sequences do not depend on the configuration (Sobol generators and
+ * ROCRAND_ORDERING_PSEUDO_DYNAMIC) use the fastest configuration measured for
+ * the type and number of generated values, unless the configuration is set
+ * explicitly (not both \p blocks and \p threads are 0).
+ *
+ * For Sobol generators \p blocks is the maximum number of blocks and \p threads
+ * must be a power of 2 not less than 32 (ROCRAND_RNG_QUASI_SOBOL32,
+ * ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32) or 64 (ROCRAND_RNG_QUASI_SOBOL64,
+ * ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64); generated sequences do not depend on
+ * the configuration.
+ *
+ * - This operation resets the generator's internal state (except for quasi-random
+ * number generators).
+ * - This operation does not change the generator's seed and offset.
+ *
+ * \param generator - Random number generator
+ * \param blocks - Number of blocks
+ * \param threads - Number of threads per block
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if the configuration is not supported by the generator \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory for engines could not be allocated \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if occupancy of the current device could not be computed \n
+ * - ROCRAND_STATUS_SUCCESS if the launch configuration was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_launch_config(rocrand_generator generator,
+                          unsigned int blocks,
+                          unsigned int threads);
+
+/**
+ * \brief Returns the launch configuration of a random number generator.
+ *
+ * Returns in \p blocks and \p threads the number of blocks and threads per block
+ * used by the kernels of the random number generator, see rocrand_set_launch_config().
+ *
+ * \param generator - Random number generator
+ * \param blocks - Pointer to the number of blocks
+ * \param threads - Pointer to the number of threads per block
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p blocks or \p threads is NULL \n
+ * - ROCRAND_STATUS_SUCCESS if the launch configuration was returned successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_get_launch_config(rocrand_generator generator,
+                          unsigned int * blocks,
+                          unsigned int * threads);
+
+/**
+ * \brief Copies the state of a random number generator to host memory.
+ *
+ * Initializes the generator's state if needed and copies engines of the
+ * random number generator to host memory \p state. The state can be restored
+ * later by rocrand_set_state() in a generator of the same type and launch
+ * configuration (see rocrand_set_launch_config()), for example to checkpoint
+ * generators. The state does not include the generator's seed, offset and stream.
+ *
+ * If \p state is NULL, only the required size of the state in bytes is returned
+ * in \p state_size.
+ *
+ * \param generator - Pseudo-random number generator
+ * \param state - Pointer to host memory for the state or NULL
+ * \param state_size - Pointer to the size in bytes of \p state, on return
+ * it contains the size of the state
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a quasi-random number generator \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p state_size is NULL or \p state is too small \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the state could not be copied \n
+ * - ROCRAND_STATUS_SUCCESS if the state was copied successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_get_state(rocrand_generator generator, void * state, size_t * state_size);
+
+/**
+ * \brief Restores the state of a random number generator from host memory.
+ *
+ * Replaces engines of the random number generator with \p state returned
+ * by rocrand_get_state() of a generator with the same type and launch
+ * configuration. The generator produces the same sequence as the generator
+ * the state was copied from did after rocrand_get_state().
+ *
+ * \param generator - Pseudo-random number generator
+ * \param state - Pointer to the state in host memory
+ * \param state_size - Size in bytes of \p state
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a quasi-random number generator \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p state is NULL or \p state_size does not match
+ * the size of the generator's state \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the state could not be copied \n
+ * - ROCRAND_STATUS_SUCCESS if the state was restored successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_state(rocrand_generator generator, const void * state, size_t state_size);
+
+/**
+ * \brief Saves a checkpoint of a random number generator to host memory.
+ *
+ * Writes a compact binary blob with everything needed to continue the sequence
+ * of the random number generator: its type, seed, offset, launch configuration,
+ * engines' state and, for quasi-random number generators, the number of dimensions
+ * and the current position in the sequence. The generator is initialized if needed.
+ *
+ * A generator restored by rocrand_generator_load() produces the same numbers
+ * as this generator would produce after the save, without repeating
+ * the initialization. Blobs can be loaded only by the same version of the library.
+ *
+ * If \p blob is NULL, only the required size of the blob in bytes is returned
+ * in \p blob_size.
+ *
+ * \param generator - Random number generator
+ * \param blob - Pointer to host memory for the blob or NULL
+ * \param blob_size - Pointer to the size in bytes of \p blob, on return
+ * it contains the size of the blob
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p blob_size is NULL or \p blob is too small \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the state could not be copied \n
+ * - ROCRAND_STATUS_SUCCESS if the checkpoint was saved successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generator_save(rocrand_generator generator, void * blob, size_t * blob_size);
+
+/**
+ * \brief Restores a random number generator from a checkpoint.
+ *
+ * Restores seed, offset, launch configuration, engines' state and counters of
+ * the random number generator from \p blob written by rocrand_generator_save()
+ * for a generator of the same type. The generator's stream is not changed.
+ *
+ * \param generator - Random number generator
+ * \param blob - Pointer to the blob in host memory
+ * \param blob_size - Size in bytes of \p blob
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the blob was saved for a generator of another type \n
+ * - ROCRAND_STATUS_VERSION_MISMATCH if the blob was saved by another version of the library \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p blob is NULL or is not a valid blob \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory for engines could not be allocated \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the state could not be copied \n
+ * - ROCRAND_STATUS_SUCCESS if the generator was restored successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generator_load(rocrand_generator generator, const void * blob, size_t blob_size);
+
+/**
+ * \brief Returns counters of work done by a generator.
+ *
+ * Counters are updated on the host by every call of the generator (so
+ * they are cheap and always available) and are never reset. Kernel
+ * launches are counted when they are enqueued. Launches of host generators
+ * (created with rocrand_create_generator_host()) are not counted, because
+ * their values are generated by host threads. Device memory freed by the
+ * generator (e.g. tables evicted from the Poisson cache) is not subtracted.
+ *
+ * When the library is built with the \p ENABLE_ROCTX option, initialization
+ * of engines, generation kernels and computations of Poisson tables are
+ * also marked by roctx ranges, so they appear in rocprof timelines.
+ *
+ * \param generator - Generator to query
+ * \param stats - Pointer to counters to set
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p stats is NULL \n
+ * - ROCRAND_STATUS_SUCCESS if counters were returned successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_get_generator_stats(rocrand_generator generator, rocrand_generator_stats * stats);
+
+/**
+ * \brief Returns the size of device memory held by a generator.
+ *
+ * Counts device memory owned by the generator: engines, copies of engines of
+ * previously used seeds and offsets, cached Poisson tables, Brownian bridges
+ * and constants of quasi-random generators. Direction vectors shared by
+ * generators and temporary buffers of single calls are not counted.
+ * Host generators (created with rocrand_create_generator_host()) use no device
+ * memory and return 0.
+ *
+ * \param generator - Generator to query
+ * \param bytes - Pointer to the size in bytes to set
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p bytes is NULL \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator type is not supported \n
+ * - ROCRAND_STATUS_SUCCESS if the size was returned successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_get_memory_usage(rocrand_generator generator, size_t * bytes);
+
+/**
+ * \brief Frees device memory of an idle generator keeping its state.
+ *
+ * Initialized engines are copied to host memory and their device memory is
+ * freed, cached engines, Poisson tables, Brownian bridges and constants are
+ * freed too (see rocrand_get_memory_usage()). The next call which needs them
+ * (any generate function or rocrand_initialize_generator()) allocates the
+ * device memory again and copies the engines back, so the generated sequence
+ * continues as if the generator was not trimmed. Stateless generators
+ * (see rocrand_set_stateless()) only keep their position in the sequence.
+ * Changing the seed, offset or launch configuration of a trimmed generator
+ * discards the copy of its engines.
+ *
+ * Trimming waits for work of the generator in its stream. Substreams
+ * (see rocrand_set_substreams()) can not be used until the engines are
+ * restored by rocrand_initialize_generator(). Host generators do not use
+ * device memory and are not changed.
+ *
+ * \param generator - Generator to trim
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if host memory could not be allocated \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if engines could not be copied \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator type is not supported \n
+ * - ROCRAND_STATUS_SUCCESS if the generator was trimmed successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generator_trim(rocrand_generator generator);
+
+/**
+ * \brief Sets the allocator of device memory of generators.
+ *
+ * Sets the allocator used for buffers which generators allocate in device memory:
+ * engines, direction vectors of quasi-random generators, tables of Poisson and
+ * discrete distributions and temporary buffers. The allocator is copied and is
+ * used by all generators of the process for subsequent allocations; memory is
+ * always freed by the allocator which allocated it, so it must be valid until
+ * generators using it are destroyed.
+ *
+ * The default allocator caches memory in a HIP memory pool of every device and
+ * uses stream-ordered allocations (hipMallocFromPoolAsync() and hipFreeAsync()
+ * in generators' streams), so reused buffers do not synchronize the device.
+ * Memory is freed in the generator's current stream, work of the generator
+ * in other streams must be finished before the generator is destroyed.
+ * If memory pools are not supported, hipMalloc() and hipFree() are used.
+ *
+ * \param allocator - Pointer to the allocator, NULL restores the default allocator
+ *
+ * \return
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p allocate or \p deallocate of \p allocator is NULL \n
+ * - ROCRAND_STATUS_SUCCESS if the allocator was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_allocator(const rocrand_allocator * allocator);
+
+/**
+ * \brief Creates a new multi-device random number generator.
+ *
+ * Creates a generator of type \p rng_type which shards one logical sequence
+ * across \p device_count devices listed in \p devices. Every device owns a copy
+ * of the generator's engines (initialized for the same seed and offset) and each
+ * generation call produces on each device its own slice of values. Concatenation of
+ * the slices is identical to the output of a single-device generator of the same type,
+ * seed and offset generating the same number of values to memory allocated by hipMalloc().
+ *
+ * Supported values for \p rng_type are:
+ * - ROCRAND_RNG_PSEUDO_XORWOW
+ * - ROCRAND_RNG_PSEUDO_MRG32K3A
+ * - ROCRAND_RNG_PSEUDO_XOSHIRO128PP
+ * - ROCRAND_RNG_PSEUDO_PCG32
+ * - ROCRAND_RNG_QUASI_SOBOL32
+ * - ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32
+ * - ROCRAND_RNG_QUASI_SOBOL64
+ * - ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64
+ *
+ * ROCRAND_RNG_PSEUDO_MTGP32 has no skipahead and ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+ * ROCRAND_RNG_PSEUDO_PHILOX4_32_7, ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
+ * ROCRAND_RNG_PSEUDO_THREEFRY2_64_20 and ROCRAND_RNG_PSEUDO_THREEFRY4_64_20 use
+ * several threads per engine, so they are not supported.
+ *
+ * \param generator - Pointer to generator
+ * \param rng_type - Type of generator to create
+ * \param devices - Array of device ids
+ * \param device_count - Number of devices
+ *
+ * \return
+ * - ROCRAND_STATUS_ALLOCATION_FAILED, if memory could not be allocated \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the value for \p rng_type is invalid or not supported \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p devices is NULL, \p device_count is 0 or a device id
+ * is invalid \n
+ * - ROCRAND_STATUS_SUCCESS if generator was created successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_create_multi_device_generator(rocrand_multi_device_generator * generator,
+                                      rocrand_rng_type rng_type,
+                                      const int * devices,
+                                      unsigned int device_count);
+
+/**
+ * \brief Creates a generator of one rank's slice of a distributed sequence.
+ *
+ * Creates a multi-device generator (see rocrand_create_multi_device_generator())
+ * of generator type \p rng_type that produces on the current device only the
+ * slice of the \p rank-th of \p world_size processes of a distributed run (for
+ * example the rank and the size of an MPI communicator, see rocrand_mpi.h).
+ * When every process creates its generator with the same type, seed, offset and
+ * number of dimensions and all processes generate with the same \p n, the
+ * concatenation of the slices of ranks 0, 1, ..., \p world_size - 1 is identical
+ * to the output of a single-device generator. Engines skip values of other ranks
+ * with skipahead, so other ranks' values are not generated.
+ *
+ * Use rocrand_multi_device_get_slice() with \p device_index 0 to get the rank's
+ * slice and rocrand_multi_device_generate() (and its variants) with an array of
+ * one output pointer to generate it. Slices are contiguous blocks of the
+ * sequence (of points for quasi-random generators).
+ *
+ * Supported values for \p rng_type are the same as for
+ * rocrand_create_multi_device_generator().
+ *
+ * \param generator - Pointer to generator
+ * \param rng_type - Type of generator to create
+ * \param rank - Index of the process
+ * \param world_size - Number of processes
+ *
+ * \return
+ * - ROCRAND_STATUS_ALLOCATION_FAILED, if memory could not be allocated \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the value for \p rng_type is invalid or not supported \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p world_size is 0 or \p rank is not less than \p world_size \n
+ * - ROCRAND_STATUS_SUCCESS if generator was created successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_create_distributed_generator(rocrand_multi_device_generator * generator,
+                                     rocrand_rng_type rng_type,
+                                     unsigned int rank,
+                                     unsigned int world_size);
+
+/**
+ * \brief Destroys a multi-device random number generator.
+ *
+ * \param generator - Generator to be destroyed
+ *
+ * \return
+ * - ROCRAND_STATUS_SUCCESS if generator was destroyed successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_destroy_multi_device_generator(rocrand_multi_device_generator generator);
+
+/**
+ * \brief Sets the seed of a multi-device pseudo-random number generator.
+ *
+ * See rocrand_set_seed().
+ *
+ * \param generator - Multi-device pseudo-random number generator
+ * \param seed - New seed value
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a quasi-random number generator \n
+ * - ROCRAND_STATUS_SUCCESS if seed was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_multi_device_set_seed(rocrand_multi_device_generator generator,
+                              unsigned long long seed);
+
+/**
+ * \brief Sets the offset of a multi-device random number generator.
+ *
+ * See rocrand_set_offset().
+ *
+ * \param generator - Multi-device random number generator
+ * \param offset - New absolute offset
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_SUCCESS if offset was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_multi_device_set_offset(rocrand_multi_device_generator generator,
+                                unsigned long long offset);
+
+/**
+ * \brief Sets the number of dimensions of a multi-device quasi-random number generator.
+ *
+ * See rocrand_set_quasi_random_generator_dimensions().
+ *
+ * \param generator - Multi-device quasi-random number generator
+ * \param dimensions - Number of dimensions
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not a quasi-random number generator \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p dimensions is out of range \n
+ * - ROCRAND_STATUS_SUCCESS if the number of dimensions was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_multi_device_set_quasi_random_generator_dimensions(rocrand_multi_device_generator generator,
+                                                           unsigned int dimensions);
+
+/**
+ * \brief Returns a device's slice of a multi-device generation call.
+ *
+ * Returns in \p size the number of values the \p device_index-th device (in the list
+ * passed to rocrand_create_multi_device_generator()) produces when \p n values are
+ * generated, and in \p offset the index of its first value in the logical output.
+ *
+ * For quasi-random number generators the logical output is split by points:
+ * \p offset is the index of the first point of the slice, and the slice contains
+ * \p size / dimensions consecutive points of every dimension (stored dimension
+ * after dimension, as rocrand_generate() does).
+ *
+ * \param generator - Multi-device random number generator
+ * \param n - Number of values to generate
+ * \param device_index - Index of the device
+ * \param offset - Pointer to the index of the first value (point) of the slice
+ * \param size - Pointer to the number of values in the slice
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p device_index is invalid or \p offset or \p size is NULL \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the number of
+ * dimensions of a quasi-random number generator \n
+ * - ROCRAND_STATUS_SUCCESS if the slice was returned successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_multi_device_get_slice(rocrand_multi_device_generator generator,
+                               size_t n,
+                               unsigned int device_index,
+                               size_t * offset,
+                               size_t * size);
+
+/**
+ * \brief Generates uniformly distributed 32-bit unsigned integers on multiple devices.
+ *
+ * Generates \p n values of the logical sequence, \p outputs[i] receives the slice
+ * of the i-th device (see rocrand_multi_device_get_slice()) and must point to memory
+ * allocated by hipMalloc() on that device. Kernels run on all devices concurrently,
+ * the function does not wait for them to finish.
+ *
+ * \param generator - Multi-device random number generator
+ * \param outputs - Array of pointers to device memory, one per device
+ * \param n - Number of values to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p outputs is NULL or a pointer is not aligned \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the number of
+ * dimensions of a quasi-random number generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_multi_device_generate(rocrand_multi_device_generator generator,
+                              unsigned int * const * outputs,
+                              size_t n);
+
+/**
+ * \brief Generates uniformly distributed floats on multiple devices.
+ *
+ * See rocrand_multi_device_generate() and rocrand_generate_uniform().
+ *
+ * \param generator - Multi-device random number generator
+ * \param outputs - Array of pointers to device memory, one per device
+ * \param n - Number of values to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p outputs is NULL or a pointer is not aligned \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the number of
+ * dimensions of a quasi-random number generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_multi_device_generate_uniform(rocrand_multi_device_generator generator,
+                                      float * const * outputs,
+                                      size_t n);
+
+/**
+ * \brief Generates normally distributed floats on multiple devices.
+ *
+ * See rocrand_multi_device_generate() and rocrand_generate_normal().
+ *
+ * \param generator - Multi-device random number generator
+ * \param outputs - Array of pointers to device memory, one per device
+ * \param n - Number of values to generate
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p outputs is NULL or a pointer is not aligned \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the number of
+ * dimensions of a quasi-random number generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_multi_device_generate_normal(rocrand_multi_device_generator generator,
+                                     float * const * outputs,
+                                     size_t n,
+                                     float mean, float stddev);
+
+/**
+ * \brief Returns the version number of the library.
+ *
+ * Returns in \p version the version number of the dynamically linked
+ * rocRAND library.
+ *
+ * \param version - Version of the library
+ *
+ * \return
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p version is NULL \n
+ * - ROCRAND_STATUS_SUCCESS if the version number was successfully returned \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_get_version(int * version);
+
+/**
+ * \brief Construct the histogram for a Poisson distribution.
+ *
+ * Construct the histogram for the Poisson distribution with lambda \p lambda.
+ *
+ * \param lambda - lambda for the Poisson distribution
+ * \param discrete_distribution - pointer to the histogram in device memory
+ *
+ * \return
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p discrete_distribution pointer was null \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if lambda is non-positive \n
+ * - ROCRAND_STATUS_SUCCESS if the histogram was constructed successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_create_poisson_distribution(double lambda,
+                                    rocrand_discrete_distribution * discrete_distribution);
+
+/**
+ * \brief Construct the histogram for a custom discrete distribution.
+ *
+ * Construct the histogram for the discrete distribution of \p size
+ * 32-bit unsigned integers from the range [\p offset, \p offset + \p size)
+ * using \p probabilities as probabilities.
+ *
+ * The distribution also stores a packed alias table (\p alias_table of
+ * rocrand_discrete_distribution_st), rocrand_discrete() of the device API
+ * compares 32-bit fixed-point fractions with it instead of double
+ * probabilities. Values differ from those of library versions without
+ * the packed table when a random number falls within 2^-32 of a
+ * probability. Distributions whose \p alias_table is NULL
+ * (e.g. built by hand) are sampled with \p probability and \p alias as before.
+ *
+ * \param probabilities - probabilities of the the distribution in host memory
+ * \param size - size of \p probabilities
+ * \param offset - offset of values
+ * \param discrete_distribution - pointer to the histogram in device memory
+ *
+ * \return
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p discrete_distribution pointer was null \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p size was zero \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if a probability is negative or all probabilities are zero \n
+ * - ROCRAND_STATUS_SUCCESS if the histogram was constructed successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_create_discrete_distribution(const double * probabilities,
+                                     unsigned int size,
+                                     unsigned int offset,
+                                     rocrand_discrete_distribution * discrete_distribution);
+
+/**
+ * \brief Construct the histogram for a custom discrete distribution
+ * from probabilities in device memory.
+ *
+ * Construct the histogram for the discrete distribution of \p size
+ * 32-bit unsigned integers from the range [\p offset, \p offset + \p size)
+ * using \p probabilities as probabilities. Unlike
+ * rocrand_create_discrete_distribution(), \p probabilities are not copied
+ * to the host: the tables are built on the device (with prefix sums and
+ * partitioning kernels), which is faster for large distributions.
+ *
+ * \param probabilities - probabilities of the the distribution in device memory
+ * \param size - size of \p probabilities
+ * \param offset - offset of values
+ * \param discrete_distribution - pointer to the histogram in device memory
+ *
+ * \return
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p discrete_distribution or \p probabilities pointer was null \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p size was zero \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if a probability is negative or all probabilities are zero \n
+ * - ROCRAND_STATUS_SUCCESS if the histogram was constructed successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_create_discrete_distribution_device(const double * probabilities,
+                                            unsigned int size,
+                                            unsigned int offset,
+                                            rocrand_discrete_distribution * discrete_distribution);
+
+/**
+ * \brief Destroy the histogram array for a discrete distribution.
+ *
+ * Destroy the histogram array for a discrete distribution created by
+ * rocrand_create_poisson_distribution.
+ *
+ * \param discrete_distribution - pointer to the histogram in device memory
+ *
+ * \return
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p discrete_distribution was null \n
+ * - ROCRAND_STATUS_SUCCESS if the histogram was destroyed successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_destroy_discrete_distribution(rocrand_discrete_distribution discrete_distribution);
+
+/**
+ * \brief Initializes an array of device API states.
+ *
+ * Initializes \p n states of the device API in device memory \p states:
+ * the \p i-th state is equal to the state initialized by
+ * <tt>rocrand_init(seed, i, offset, &state)</tt> in a kernel.
+ * The initialization is performed asynchronously in \p stream.
+ *
+ * States of ROCRAND_RNG_PSEUDO_XORWOW, ROCRAND_RNG_PSEUDO_MRG32K3A and
+ * ROCRAND_RNG_PSEUDO_XOSHIRO128PP are computed cooperatively from the first
+ * state of every block of 256 states by skipping 1, 2, 4... subsequences,
+ * so \p n states cost O(\p n) jumps (multiplications by jump matrices or
+ * jump polynomials) instead of a full skipahead per state.
+ *
+ * Supported types and types of \p states:
+ * - ROCRAND_RNG_PSEUDO_XORWOW - rocrand_state_xorwow \n
+ * - ROCRAND_RNG_PSEUDO_MRG32K3A - rocrand_state_mrg32k3a \n
+ * - ROCRAND_RNG_PSEUDO_XOSHIRO128PP - rocrand_state_xoshiro128pp \n
+ * - ROCRAND_RNG_PSEUDO_PCG32 - rocrand_state_pcg32 \n
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_32_10 - rocrand_state_philox4x32_10 \n
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_32_7 - rocrand_state_philox4x32_7 \n
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_64_10 - rocrand_state_philox4x64_10 \n
+ * - ROCRAND_RNG_PSEUDO_THREEFRY2_64_20 - rocrand_state_threefry2x64_20 \n
+ * - ROCRAND_RNG_PSEUDO_THREEFRY4_64_20 - rocrand_state_threefry4x64_20 \n
+ *
+ * \param states - Pointer to device memory for \p n states
+ * \param n - Number of states to initialize
+ * \param seed - Seed value
+ * \param offset - Absolute offset of every state
+ * \param rng_type - Type of the states
+ * \param stream - HIP stream of the initialization kernel
+ *
+ * \return
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p states is null and \p n is not 0 \n
+ * - ROCRAND_STATUS_TYPE_ERROR if states of \p rng_type are not supported \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if the initialization was started successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_init_states(void * states,
+                    size_t n,
+                    unsigned long long seed,
+                    unsigned long long offset,
+                    rocrand_rng_type rng_type,
+                    hipStream_t stream);
+
+/**
+ * \brief Creates a stream producer.
+ *
+ * Creates a producer that runs a persistent kernel, which continuously refills
+ * a ring buffer in device memory with uniformly distributed 32-bit unsigned
+ * integers, so kernels consuming random numbers do not pay the launch and
+ * engine state costs of rocrand_generate() calls. Engines of the kernel stay
+ * in registers for the lifetime of the producer.
+ *
+ * The ring buffer is returned by rocrand_stream_producer_get_buffer(). Values
+ * of the stream at positions [<tt>*tail</tt>, <tt>*head</tt>) are ready to be read.
+ * Consumer kernels must read \p head with a volatile or atomic load followed by
+ * <tt>__threadfence()</tt> and, after reading values, advance \p tail with an atomic
+ * operation. The producer does not overwrite values at positions not less than
+ * \p tail, and it advances \p head in rounds of at most \p capacity / 2 values.
+ * So consumers must not wait for more than \p capacity / 2 values at once.
+ *
+ * The kernel runs in an internal non-blocking stream with one block per compute unit,
+ * so kernels in other non-blocking streams can run at the same time. Functions that
+ * wait for all work on the device (e.g. hipDeviceSynchronize() and, on some platforms,
+ * hipFree()) do not return until the producer is destroyed. The stream depends on the seed and on the number of compute units
+ * of the current device.
+ *
+ * Supported values for \p rng_type are:
+ * - ROCRAND_RNG_PSEUDO_XORWOW
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+ *
+ * \param producer - Pointer to producer
+ * \param rng_type - Type of engines of the producer
+ * \param seed - Seed value
+ * \param capacity - Number of values in the ring buffer, at least 512
+ *
+ * \return
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the value for \p rng_type is invalid or not supported \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p producer is NULL \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p capacity is less than 512 \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if the HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if the producer was created successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_create_stream_producer(rocrand_stream_producer * producer,
+                               rocrand_rng_type rng_type,
+                               unsigned long long seed,
+                               size_t capacity);
+
+/**
+ * \brief Returns the ring buffer of a stream producer.
+ *
+ * \param producer - Stream producer
+ * \param buffer - Pointer to the ring buffer description
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the producer wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p buffer is NULL \n
+ * - ROCRAND_STATUS_SUCCESS if the buffer was returned successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_stream_producer_get_buffer(rocrand_stream_producer producer,
+                                   rocrand_ring_buffer * buffer);
+
+/**
+ * \brief Stops and destroys a stream producer.
+ *
+ * Stops the persistent kernel, waits for it and releases the ring buffer.
+ * Consumer kernels must not access the buffer after this call.
+ *
+ * \param producer - Stream producer to be destroyed
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the producer wasn't created \n
+ * - ROCRAND_STATUS_SUCCESS if the producer was destroyed successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_destroy_stream_producer(rocrand_stream_producer producer);
+
+/**
+ * \brief Generates values of several requests in one kernel launch.
+ *
+ * Generates values of \p count requests \p requests, the result is the same as
+ * the result of calls of the corresponding generation functions for the requests
+ * in their order. Engines of the generator service the requests one after another,
+ * every engine generates the same values of every request as in these calls,
+ * so many small requests cost one kernel launch and one load and store of engines.
+ *
+ * Requests are passed to kernels in their arguments, so a batch needs no device
+ * memory; every 40 requests are generated by one kernel launch. Poisson tables
+ * of all lambdas of a launch are kept cached (the cache capacity is raised if
+ * needed, see rocrand_set_poisson_cache_capacity()).
+ *
+ * Supported generators are:
+ * - ROCRAND_RNG_PSEUDO_XORWOW
+ * - ROCRAND_RNG_PSEUDO_MRG32K3A
+ *
+ * \param generator - Generator to use
+ * \param requests - Pointer to \p count requests in host memory
+ * \param count - Number of requests
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not supported \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p requests is NULL, or a request has an invalid
+ *   distribution, a NULL output pointer or a non-positive lambda \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if the values were generated successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_batch(rocrand_generator generator,
+                       const rocrand_batch_request * requests,
+                       size_t count);
+
+/**
+ * \brief Generates a random permutation of indices.
+ *
+ * Generates a random permutation of 0, 1, ..., \p n - 1 to device memory
+ * \p output_data in one pass without sorting: every output index is mapped
+ * independently by a Feistel network keyed by values of the generator's
+ * sequence with Philox4x32-10 as its round function.
+ *
+ * The generator's position in the sequence advances by 8 values (the key
+ * of the permutation), so following calls produce other permutations.
+ *
+ * Supported generators are:
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated indices
+ * \param n - Number of indices, not greater than 2^32
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not supported \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p output_data is NULL or \p n is greater than 2^32 \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if the permutation was generated successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_permutation(rocrand_generator generator,
+                             unsigned int * output_data,
+                             size_t n);
+
+/**
+ * \brief Randomly shuffles an array in place.
+ *
+ * Reorders \p n elements of \p element_size bytes of \p data by a random
+ * permutation as rocrand_generate_permutation() generates it: element i
+ * becomes the element permutation(i) of the original array. Elements are copied
+ * to a temporary buffer of \p n * \p element_size bytes (allocated by
+ * the allocator of rocrand_set_allocator()) and gathered back in one pass.
+ *
+ * Supported generators are:
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+ *
+ * \param generator - Generator to use
+ * \param data - Pointer to the array to shuffle
+ * \param n - Number of elements
+ * \param element_size - Size of an element in bytes
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not supported \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p data is NULL or \p element_size is 0 \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if the array was shuffled successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_shuffle(rocrand_generator generator,
+                void * data,
+                size_t n,
+                size_t element_size);
+
+/**
+ * \brief Generates a Latin hypercube sample.
+ *
+ * Generates \p n_points points of \p dims uniformly distributed values
+ * to \p output_data. Every dimension is divided into \p n_points strata
+ * (k / \p n_points, (k + 1) / \p n_points], and every stratum of every
+ * dimension contains exactly one point: the stratum of a point in a dimension
+ * is the index of the point permuted by a Feistel network (as
+ * rocrand_generate_permutation() permutes indices) with a key of the dimension,
+ * the position in the stratum is uniformly distributed. Every value is computed
+ * independently in one kernel, no uniform values, permutations or sorts are
+ * stored.
+ *
+ * Values are stored as \p ordering selects (like outputs of quasi-random generators,
+ * see rocrand_set_ordering()):
+ * - ROCRAND_ORDERING_QUASI_DEFAULT - dimension-major, value \p j of point \p i
+ *   is \p output_data[\p j * \p n_points + \p i]
+ * - ROCRAND_ORDERING_QUASI_INTERLEAVED - point-major, value \p j of point \p i
+ *   is \p output_data[\p i * \p dims + \p j]
+ *
+ * The generator's position in the sequence advances by 8 * \p dims values
+ * (keys of the dimensions), so following calls produce other samples.
+ *
+ * Supported generators are:
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated values
+ * \param n_points - Number of points
+ * \param dims - Number of dimensions of a point (at least 1)
+ * \param ordering - Order of stored values
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not supported \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p output_data is NULL, \p dims is 0
+ *   or \p ordering is not a quasi-random ordering \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if the points were generated successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_latin_hypercube(rocrand_generator generator,
+                                 float * output_data,
+                                 size_t n_points,
+                                 unsigned int dims,
+                                 rocrand_ordering ordering);
+
+/**
+ * \brief Generates stratified uniformly distributed points.
+ *
+ * Generates \p n_points points of \p dims uniformly distributed values
+ * to \p output_data. The unit hypercube is divided into a grid of \p strata
+ * strata in every dimension, and point \p i lies in the cell \p i modulo
+ * \p strata ^ \p dims: the stratum of dimension \p j is the digit \p j (the
+ * least significant first) of \p i in base \p strata, so every \p strata ^ \p dims
+ * consecutive points contain one point of every cell. Positions in cells are
+ * uniformly distributed. \p dims = 1 and \p strata = \p n_points give one
+ * value in every one of \p n_points strata.
+ *
+ * Values are stored and the generator's position advances as with
+ * rocrand_generate_latin_hypercube().
+ *
+ * Supported generators are:
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated values
+ * \param n_points - Number of points
+ * \param dims - Number of dimensions of a point (at least 1)
+ * \param strata - Number of strata of every dimension (at least 1)
+ * \param ordering - Order of stored values
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not supported \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p output_data is NULL, \p dims or \p strata
+ *   is 0 or \p ordering is not a quasi-random ordering \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if the points were generated successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_stratified_uniform(rocrand_generator generator,
+                                    float * output_data,
+                                    size_t n_points,
+                                    unsigned int dims,
+                                    unsigned int strata,
+                                    rocrand_ordering ordering);
+
+/**
+ * \brief Selects a weighted random sample without replacement.
+ *
+ * Selects \p k distinct indices of \p n candidates, candidate i is drawn with
+ * probability proportional to \p weights[i] at every draw of a sequential
+ * sampling without replacement. Every candidate gets the Efraimidis-Spirakis key
+ * u_i^(1/weights[i]), where u_i are uniform values of the generator's sequence
+ * (as rocrand_generate_uniform() generates them), and candidates with the \p k
+ * largest keys are selected by a radix selection that reads keys a fixed number
+ * of times without sorting them. Candidates with non-positive weights are selected
+ * only if fewer than \p k candidates have positive weights.
+ *
+ * Indices are stored to \p output_data in an unspecified order. The generator's
+ * position in the sequence advances by \p n values. Values of the sequence are
+ * stored to a temporary buffer of \p n floats (allocated by the allocator of
+ * rocrand_set_allocator()).
+ *
+ * Host-side generators (rocrand_create_generator_host()) use host memory.
+ *
+ * \param generator - Generator to use
+ * \param weights - Pointer to weights of candidates
+ * \param n - Number of candidates, not greater than 2^32
+ * \param k - Number of indices to select, not greater than \p n
+ * \param output_data - Pointer to memory to store \p k selected indices
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not supported \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p weights or \p output_data is NULL,
+ *   \p k is greater than \p n or \p n is greater than 2^32 \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of
+ *   the dimension of a quasi-random generator \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if the sample was selected successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_sample_without_replacement(rocrand_generator generator,
+                                   const float * weights,
+                                   size_t n,
+                                   size_t k,
+                                   unsigned int * output_data);
+
+/**
+ * \brief Selects weighted random samples without replacement of every row of a CSR graph.
+ *
+ * Selects \p k distinct candidates of each of \p rows rows as
+ * rocrand_sample_without_replacement() does it, candidates of row r are edges
+ * row_offsets[r], ..., row_offsets[r + 1] - 1 with weights \p weights.
+ * Every row is selected by one block of threads in one launch for all rows.
+ *
+ * Indices of edges of row r are stored to \p output_data[r * \p k], ...,
+ * \p output_data[r * \p k + \p k - 1] in an unspecified order. Rows with fewer than
+ * \p k edges select all of them and the rest of their outputs are set to 0xFFFFFFFF.
+ * The generator's position in the sequence advances by \p nnz values.
+ *
+ * \param generator - Generator to use
+ * \param row_offsets - Pointer to \p rows + 1 offsets of rows, not greater than \p nnz
+ * \param rows - Number of rows
+ * \param weights - Pointer to \p nnz weights of edges
+ * \param nnz - Number of edges, not greater than 2^32
+ * \param k - Number of edges to select of every row
+ * \param output_data - Pointer to memory to store \p rows * \p k selected indices
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not supported \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if a pointer is NULL or \p nnz is greater than 2^32 \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p nnz is not a multiple of
+ *   the dimension of a quasi-random generator \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if the samples were selected successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_sample_without_replacement_csr(rocrand_generator generator,
+                                       const unsigned int * row_offsets,
+                                       size_t rows,
+                                       const float * weights,
+                                       size_t nnz,
+                                       unsigned int k,
+                                       unsigned int * output_data);
+
+/**
+ * \brief Generates multivariate normally distributed vectors.
+ *
+ * Generates \p n_vectors vectors x = mean + L z of \p dim values to device memory
+ * \p output_data (vector v is stored to \p output_data[v * \p dim], ...,
+ * \p output_data[v * \p dim + \p dim - 1]), where L is the lower triangular
+ * Cholesky factor \p factor of the covariance and z are standard normal values
+ * of the generator's sequence as rocrand_generate_normal() generates them
+ * with mean 0 and standard deviation 1. The generator's position in the sequence
+ * advances by \p n_vectors * \p dim values.
+ *
+ * ROCRAND_RNG_PSEUDO_PHILOX4_32_10 generators in the stateless mode
+ * (rocrand_set_stateless()) with the Box-Muller method compute z of tiles of
+ * vectors directly in shared memory of the kernel applying the factor. Other
+ * generators generate z to a temporary buffer of \p n_vectors * \p dim floats
+ * (allocated by the allocator of rocrand_set_allocator()).
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated vectors
+ * \param n_vectors - Number of vectors
+ * \param dim - Number of values of a vector, not greater than 8192
+ * \param factor - Pointer to \p dim * \p dim values of the row-major factor L,
+ *   values above the diagonal are not used
+ * \param mean - Pointer to \p dim values of the mean, or NULL for the zero mean
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not supported \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p output_data or \p factor is NULL,
+ *   or \p dim is greater than 8192 \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n_vectors * \p dim is not a multiple
+ *   of the dimension of a quasi-random generator \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if the vectors were generated successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_multivariate_normal(rocrand_generator generator,
+                                     float * output_data,
+                                     size_t n_vectors,
+                                     unsigned int dim,
+                                     const float * factor,
+                                     const float * mean);
+
+/**
+ * \brief Generates uniformly distributed unit vectors (directions).
+ *
+ * Generates \p n points uniformly distributed on the unit sphere S^(\p dim - 1)
+ * to device memory \p output_data (host memory for host-side generators), vector
+ * v is stored to \p output_data[v * \p dim], ..., \p output_data[v * \p dim + \p dim - 1],
+ * so vectors of 3 and 4 values can be read as packed <tt>float3</tt> and
+ * <tt>float4</tt> arrays.
+ *
+ * Vectors of 1 to 4 values are generated in one pass by the following generators
+ * with rejection methods that need no trigonometric functions (see
+ * rocrand_unit_vector3()), the number of values used by a vector is variable:
+ * - ROCRAND_RNG_PSEUDO_XORWOW
+ * - ROCRAND_RNG_PSEUDO_MRG32K3A
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_32_7
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_64_10
+ * - ROCRAND_RNG_PSEUDO_THREEFRY2_64_20
+ * - ROCRAND_RNG_PSEUDO_THREEFRY4_64_20
+ * - ROCRAND_RNG_PSEUDO_XOSHIRO128PP
+ * - ROCRAND_RNG_PSEUDO_PCG32
+ *
+ * Other pseudo-random generators and vectors of more values generate \p n * \p dim
+ * standard normal values to \p output_data (as rocrand_generate_normal() generates
+ * them) and divide every vector by its length in place. Quasi-random generators
+ * are not supported: their consecutive values are points of one dimension.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated vectors
+ * \param n - Number of vectors
+ * \param dim - Number of values of a vector (at least 1)
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p output_data is NULL or \p dim is 0 \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is quasi-random \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if the vectors were generated successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_unit_vectors(rocrand_generator generator,
+                              float * output_data,
+                              size_t n,
+                              unsigned int dim);
+
+/**
+ * \brief Converts \p float values to 16-bit or 8-bit floating-point values
+ * with stochastic rounding.
+ *
+ * Rounds \p n values of \p input_data to \p format and saves them to
+ * \p output_data (arrays of 16-bit values for ROCRAND_ROUND_FORMAT_BFLOAT16 and
+ * ROCRAND_ROUND_FORMAT_HALF, of 8-bit values for FP8 formats). A value between
+ * two neighbouring values of the format is rounded up with the probability of its
+ * distance from the lower neighbour divided by the distance between them, so
+ * rounding is unbiased. The probability is quantized to 16 random bits
+ * (bfloat16, half) or 8 random bits (FP8) taken from the 32-bit values of the
+ * generator, two or four values use one 32-bit value. Random bits are
+ * consumed inside the generation kernel, no buffer of random values is used.
+ *
+ * NaNs stay NaNs. Values beyond the largest finite value become infinities
+ * for bfloat16 and half and saturate to the largest finite value for FP8
+ * formats (as rocrand_generate_normal_fp8_e4m3() and rocrand_generate_normal_fp8_e5m2()
+ * saturate). \p input_data and \p output_data must not overlap.
+ *
+ * Supported generator types (other types return ROCRAND_STATUS_TYPE_ERROR):
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_32_7
+ * - ROCRAND_RNG_PSEUDO_MRG32K3A
+ * - ROCRAND_RNG_PSEUDO_XORWOW
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_64_10
+ * - ROCRAND_RNG_PSEUDO_THREEFRY2_64_20
+ * - ROCRAND_RNG_PSEUDO_THREEFRY4_64_20
+ * - ROCRAND_RNG_PSEUDO_XOSHIRO128PP
+ * - ROCRAND_RNG_PSEUDO_PCG32
+ *
+ * \param generator - Generator to use
+ * \param input_data - Pointer to memory with values to round
+ * \param output_data - Pointer to memory to store rounded values
+ * \param n - Number of values
+ * \param format - Format of rounded values
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p input_data or \p output_data is NULL
+ *   or \p format is not a valid format \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator type does not support stochastic rounding \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if the values were rounded successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_stochastic_round(rocrand_generator generator,
+                         const float * input_data,
+                         void * output_data,
+                         size_t n,
+                         rocrand_round_format format);
+
+/**
+ * \brief Generates quasi-random Brownian paths built with a Brownian bridge.
+ *
+ * Generates \p paths paths of a standard Brownian motion W at \p steps times
+ * \p times (t_1 < t_2 < ... < t_steps, W(0) = 0) in one kernel launch. Normally
+ * distributed values of dimensions of a point of the sequence (as rocrand_generate_normal()
+ * with mean 0 and standard deviation 1 generates them) are assigned to times in the
+ * Brownian bridge order: the first dimension defines W(t_steps), then following
+ * dimensions define midpoints of the remaining intervals level by level, so the best
+ * distributed dimensions define the large-scale shape of paths.
+ *
+ * Values are stored path-major: \p output_data[p * \p steps + k] is the increment
+ * W(t_(k+1)) - W(t_k) of path p (t_0 = 0), or W(t_(k+1)) when \p cumulative is not 0.
+ *
+ * The generator must have \p steps dimensions (see
+ * rocrand_set_quasi_random_generator_dimensions()), and the position in the sequence
+ * advances as generation of \p paths * \p steps normal values does. The bridge of
+ * \p times is cached until the next call with different times.
+ *
+ * Supported generators are:
+ * - ROCRAND_RNG_QUASI_SOBOL32
+ * - ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32
+ * - ROCRAND_RNG_QUASI_SOBOL64
+ * - ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated paths
+ * \param paths - Number of paths to generate
+ * \param times - Pointer to \p steps increasing positive times in host memory
+ * \param steps - Number of times of a path
+ * \param cumulative - Store values of paths instead of increments when not 0
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not supported \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p output_data or \p times is NULL, \p times
+ *   are not increasing positive values or \p steps is not the number of dimensions \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if the paths were generated successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_brownian_paths(rocrand_generator generator,
+                                float * output_data,
+                                size_t paths,
+                                const float * times,
+                                unsigned int steps,
+                                int cumulative);
+
+/**
+ * \brief Adds a node generating uniformly distributed 32-bit unsigned integers to a HIP graph.
+ *
+ * Adds to \p graph a node which generates \p n 32-bit unsigned integers to device memory
+ * \p output_data as rocrand_generate() does.
+ *
+ * The node contains the kernels which the generation function would launch in the
+ * generator's stream, every launch of the graph generates the next \p n values:
+ * engines are stored in device memory, so their state is advanced by the node and
+ * not by the host. The generator must not be destroyed, reinitialized or used in
+ * other streams while the graph can run. The work is recorded by stream capture
+ * into a child graph node, so one node covers generators that launch several
+ * kernels.
+ *
+ * Supported generators are device generators of types:
+ * - ROCRAND_RNG_PSEUDO_XORWOW
+ * - ROCRAND_RNG_PSEUDO_MRG32K3A
+ * - ROCRAND_RNG_PSEUDO_MTGP32
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_32_10 (not in stateless mode)
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_32_7
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_64_10
+ * - ROCRAND_RNG_PSEUDO_THREEFRY2_64_20
+ * - ROCRAND_RNG_PSEUDO_THREEFRY4_64_20
+ * - ROCRAND_RNG_PSEUDO_XOSHIRO128PP
+ * - ROCRAND_RNG_PSEUDO_PCG32
+ *
+ * Other generators compute positions of values on the host and pass them
+ * to kernels, so their nodes would generate the same values in every launch.
+ *
+ * \param generator - Generator to use
+ * \param graph - Graph to which the node is added
+ * \param node - Pointer to the added node
+ * \param dependencies - Pointer to \p dependencies_count nodes the node depends on
+ * \param dependencies_count - Number of dependencies
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 32-bit unsigned integers to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not supported \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p node is NULL \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the work could not be captured or added to \p graph \n
+ * - ROCRAND_STATUS_SUCCESS if the node was added successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_graph_node(rocrand_generator generator,
+                            hipGraph_t graph,
+                            hipGraphNode_t * node,
+                            const hipGraphNode_t * dependencies,
+                            size_t dependencies_count,
+                            unsigned int * output_data, size_t n);
+
+/**
+ * \brief Adds a node generating uniformly distributed floats to a HIP graph.
+ *
+ * Adds to \p graph a node which generates \p n uniformly distributed floats to device memory
+ * \p output_data as rocrand_generate_uniform() does.
+ *
+ * See rocrand_generate_graph_node() for supported generators and details.
+ *
+ * \param generator - Generator to use
+ * \param graph - Graph to which the node is added
+ * \param node - Pointer to the added node
+ * \param dependencies - Pointer to \p dependencies_count nodes the node depends on
+ * \param dependencies_count - Number of dependencies
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of floats to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not supported \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p node is NULL \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the work could not be captured or added to \p graph \n
+ * - ROCRAND_STATUS_SUCCESS if the node was added successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_graph_node(rocrand_generator generator,
+                                    hipGraph_t graph,
+                                    hipGraphNode_t * node,
+                                    const hipGraphNode_t * dependencies,
+                                    size_t dependencies_count,
+                                    float * output_data, size_t n);
+
+/**
+ * \brief Adds a node generating uniformly distributed doubles to a HIP graph.
+ *
+ * Adds to \p graph a node which generates \p n uniformly distributed doubles to device memory
+ * \p output_data as rocrand_generate_uniform_double() does.
+ *
+ * See rocrand_generate_graph_node() for supported generators and details.
+ *
+ * \param generator - Generator to use
+ * \param graph - Graph to which the node is added
+ * \param node - Pointer to the added node
+ * \param dependencies - Pointer to \p dependencies_count nodes the node depends on
+ * \param dependencies_count - Number of dependencies
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of doubles to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not supported \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p node is NULL \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the work could not be captured or added to \p graph \n
+ * - ROCRAND_STATUS_SUCCESS if the node was added successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_double_graph_node(rocrand_generator generator,
+                                           hipGraph_t graph,
+                                           hipGraphNode_t * node,
+                                           const hipGraphNode_t * dependencies,
+                                           size_t dependencies_count,
+                                           double * output_data, size_t n);
+
+/**
+ * \brief Adds a node generating normally distributed floats to a HIP graph.
+ *
+ * Adds to \p graph a node which generates \p n normally distributed floats to device memory
+ * \p output_data as rocrand_generate_normal() does.
+ *
+ * See rocrand_generate_graph_node() for supported generators and details.
+ *
+ * \param generator - Generator to use
+ * \param graph - Graph to which the node is added
+ * \param node - Pointer to the added node
+ * \param dependencies - Pointer to \p dependencies_count nodes the node depends on
+ * \param dependencies_count - Number of dependencies
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of floats to generate
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not supported \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p node is NULL \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the work could not be captured or added to \p graph \n
+ * - ROCRAND_STATUS_SUCCESS if the node was added successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_graph_node(rocrand_generator generator,
+                                   hipGraph_t graph,
+                                   hipGraphNode_t * node,
+                                   const hipGraphNode_t * dependencies,
+                                   size_t dependencies_count,
+                                   float * output_data, size_t n,
+                                   float mean, float stddev);
+
+/**
+ * \brief Adds a node generating normally distributed doubles to a HIP graph.
+ *
+ * Adds to \p graph a node which generates \p n normally distributed doubles to device memory
+ * \p output_data as rocrand_generate_normal_double() does.
+ *
+ * See rocrand_generate_graph_node() for supported generators and details.
+ *
+ * \param generator - Generator to use
+ * \param graph - Graph to which the node is added
+ * \param node - Pointer to the added node
+ * \param dependencies - Pointer to \p dependencies_count nodes the node depends on
+ * \param dependencies_count - Number of dependencies
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of doubles to generate
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not supported \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p node is NULL \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the work could not be captured or added to \p graph \n
+ * - ROCRAND_STATUS_SUCCESS if the node was added successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_double_graph_node(rocrand_generator generator,
+                                          hipGraph_t graph,
+                                          hipGraphNode_t * node,
+                                          const hipGraphNode_t * dependencies,
+                                          size_t dependencies_count,
+                                          double * output_data, size_t n,
+                                          double mean, double stddev);
+
+/**
+ * \brief Generates uniformly distributed 32-bit unsigned integers to host memory.
+ *
+ * Generates \p n uniformly distributed 32-bit unsigned integers to host memory
+ * \p output_data as rocrand_generate() does. Device generators generate values
+ * in chunks to device buffers which are copied to the host asynchronously in
+ * another stream, so generation of a chunk in the generator's stream overlaps
+ * copying of the previous chunk; device buffers of all \p n values are not needed.
+ * The function returns when all values are copied. Host generators (see
+ * rocrand_create_generator_host()) write to \p output_data directly.
+ *
+ * Copies overlap kernels only if \p output_data is pinned memory (allocated by
+ * hipHostMalloc() or registered by hipHostRegister()).
+ *
+ * Values are the same as values of consecutive calls of rocrand_generate() for
+ * chunks. Generators which use the number of requested values to distribute work
+ * among their engines (XORWOW, MRG32K3A, MTGP32) generate other values than one
+ * call of rocrand_generate() for \p n values. Outputs of quasi-random generators
+ * of several dimensions have the same layout as outputs of rocrand_generate().
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to host memory to store generated numbers
+ * \param n - Number of 32-bit unsigned integers to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if device buffers could not be allocated \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the number
+ *   of dimensions of a quasi-random generator \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if a copy failed \n
+ * - ROCRAND_STATUS_SUCCESS if values were generated successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_to_host(rocrand_generator generator,
+                         unsigned int * output_data, size_t n);
+
+/**
+ * \brief Generates uniformly distributed floats to host memory.
+ *
+ * Generates \p n uniformly distributed floats to host memory \p output_data
+ * as rocrand_generate_uniform() does, see rocrand_generate_to_host() for details.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to host memory to store generated numbers
+ * \param n - Number of values to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if device buffers could not be allocated \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the number
+ *   of dimensions of a quasi-random generator \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if a copy failed \n
+ * - ROCRAND_STATUS_SUCCESS if values were generated successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_to_host(rocrand_generator generator,
+                                 float * output_data, size_t n);
+
+/**
+ * \brief Generates uniformly distributed doubles to host memory.
+ *
+ * Generates \p n uniformly distributed doubles to host memory \p output_data
+ * as rocrand_generate_uniform_double() does, see rocrand_generate_to_host()
+ * for details.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to host memory to store generated numbers
+ * \param n - Number of values to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if device buffers could not be allocated \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the number
+ *   of dimensions of a quasi-random generator \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if a copy failed \n
+ * - ROCRAND_STATUS_SUCCESS if values were generated successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_double_to_host(rocrand_generator generator,
+                                        double * output_data, size_t n);
+
+/**
+ * \brief Generates normally distributed floats to host memory.
+ *
+ * Generates \p n normally distributed floats to host memory \p output_data
+ * as rocrand_generate_normal() does, see rocrand_generate_to_host() for details.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to host memory to store generated numbers
+ * \param n - Number of values to generate
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if device buffers could not be allocated \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the number
+ *   of dimensions of a quasi-random generator \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if a copy failed \n
+ * - ROCRAND_STATUS_SUCCESS if values were generated successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_to_host(rocrand_generator generator,
+                                float * output_data, size_t n,
+                                float mean, float stddev);
+
+/**
+ * \brief Generates normally distributed doubles to host memory.
+ *
+ * Generates \p n normally distributed doubles to host memory \p output_data
+ * as rocrand_generate_normal_double() does, see rocrand_generate_to_host()
+ * for details.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to host memory to store generated numbers
+ * \param n - Number of values to generate
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if device buffers could not be allocated \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the number
+ *   of dimensions of a quasi-random generator \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if a copy failed \n
+ * - ROCRAND_STATUS_SUCCESS if values were generated successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_double_to_host(rocrand_generator generator,
+                                       double * output_data, size_t n,
+                                       double mean, double stddev);
+
+/**
+ * \brief Generates Poisson-distributed 32-bit unsigned integers to host memory.
+ *
+ * Generates \p n Poisson-distributed 32-bit unsigned integers to host memory
+ * \p output_data as rocrand_generate_poisson() does, see rocrand_generate_to_host()
+ * for details.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to host memory to store generated numbers
+ * \param n - Number of values to generate
+ * \param lambda - lambda for the Poisson distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if device buffers could not be allocated \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the number
+ *   of dimensions of a quasi-random generator \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if lambda is non-positive \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if a copy failed \n
+ * - ROCRAND_STATUS_SUCCESS if values were generated successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_poisson_to_host(rocrand_generator generator,
+                                 unsigned int * output_data, size_t n,
+                                 double lambda);
 
 #if defined(__cplusplus)
 }
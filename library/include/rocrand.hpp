@@ -30,6 +30,8 @@
 #include <sstream>
 #include <type_traits>
 #include <limits>
+#include <memory>
+#include <algorithm>
 
 #include "rocrand.h"
 #include "rocrand_kernel.h"
@@ -138,19 +140,200 @@ private:
     std::string m_error_string;
 };
 
+/// \class device_span
+/// \brief A contiguous range of device memory with values of type \p T.
+///
+/// Spans are passed by value to asynchronous overloads of distributions
+/// and engines, they do not own the memory.
+template<class T>
+class device_span
+{
+public:
+    typedef T value_type;
+
+    /// Constructs an empty span
+    device_span()
+        : m_data(NULL), m_size(0)
+    {
+    }
+
+    /// \brief Constructs a span of \p size values starting at \p data.
+    /// \param data - Pointer to device memory
+    /// \param size - Number of values
+    device_span(T * data, size_t size)
+        : m_data(data), m_size(size)
+    {
+    }
+
+    /// Returns the pointer to the first value.
+    T * data() const
+    {
+        return m_data;
+    }
+
+    /// Returns the number of values.
+    size_t size() const
+    {
+        return m_size;
+    }
+
+    /// Returns \c true if the span has no values.
+    bool empty() const
+    {
+        return m_size == 0;
+    }
+
+    /// Returns the span of \p count values starting at the \p offset-th value.
+    device_span<T> subspan(size_t offset, size_t count) const
+    {
+        return device_span<T>(m_data + offset, count);
+    }
+
+private:
+    T * m_data;
+    size_t m_size;
+};
+
+/// \class generate_future
+/// \brief The result of an asynchronous generation.
+///
+/// Asynchronous overloads of distributions and engines return a future
+/// backed by a HIP event recorded after the generation, so the host waits
+/// only when the values are needed and other streams can wait for them without
+/// blocking it. Errors are reported by the future instead of thrown by the call.
+/// Copies of a future share its event.
+class generate_future
+{
+public:
+    /// Constructs a future of a finished generation with \p status.
+    generate_future(rocrand_status status = ROCRAND_STATUS_SUCCESS)
+        : m_status(status)
+    {
+    }
+
+    /// \brief Constructs a future of a generation with \p status followed by \p event.
+    ///
+    /// The future takes ownership of \p event, it is destroyed with the last copy.
+    generate_future(rocrand_status status, hipEvent_t event)
+        : m_status(status), m_event(event, hipEventDestroy)
+    {
+    }
+
+    /// \brief Returns the status of the generation.
+    ///
+    /// The status is known when the generation is submitted, kernels are
+    /// not waited for.
+    rocrand_status status() const
+    {
+        return m_status;
+    }
+
+    /// Returns \c true if the generation is finished (or has failed).
+    bool ready() const
+    {
+        return m_event == NULL || hipEventQuery(m_event.get()) != hipErrorNotReady;
+    }
+
+    /// \brief Blocks the host until the generation is finished.
+    ///
+    /// Throws rocrand_cpp::error if the generation has failed.
+    void wait() const
+    {
+        if(m_event != NULL && hipEventSynchronize(m_event.get()) != hipSuccess)
+            throw rocrand_cpp::error(ROCRAND_STATUS_INTERNAL_ERROR);
+        if(m_status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(m_status);
+    }
+
+    /// \brief Makes work submitted to \p stream after this call wait for
+    /// the generation, the host is not blocked.
+    ///
+    /// Throws rocrand_cpp::error if the generation has failed.
+    void wait(hipStream_t stream) const
+    {
+        if(m_status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(m_status);
+        if(m_event != NULL && hipStreamWaitEvent(stream, m_event.get(), 0) != hipSuccess)
+            throw rocrand_cpp::error(ROCRAND_STATUS_INTERNAL_ERROR);
+    }
+
+    /// Returns the event recorded after the generation (\p NULL for finished generations).
+    hipEvent_t event() const
+    {
+        return m_event.get();
+    }
+
+private:
+    rocrand_status m_status;
+    std::shared_ptr<typename std::remove_pointer<hipEvent_t>::type> m_event;
+};
+
+/// \cond
+namespace detail {
+
+    // Generates values by generate() (returns rocrand_status) in stream instead of
+    // the stream of generator: the generation waits for previous work of generator,
+    // its later work waits for the generation (by one event, the host is not blocked)
+    template<class Generate>
+    inline generate_future generate_async(rocrand_generator generator,
+                                          hipStream_t stream,
+                                          Generate generate)
+    {
+        hipStream_t generator_stream;
+        rocrand_status status = rocrand_get_stream(generator, &generator_stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return generate_future(status);
+
+        hipEvent_t event;
+        if(hipEventCreateWithFlags(&event, hipEventDisableTiming) != hipSuccess)
+            return generate_future(ROCRAND_STATUS_INTERNAL_ERROR);
+
+        if(stream != generator_stream)
+        {
+            if(hipEventRecord(event, generator_stream) != hipSuccess
+                || hipStreamWaitEvent(stream, event, 0) != hipSuccess)
+            {
+                hipEventDestroy(event);
+                return generate_future(ROCRAND_STATUS_INTERNAL_ERROR);
+            }
+            status = rocrand_set_stream(generator, stream);
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                hipEventDestroy(event);
+                return generate_future(status);
+            }
+        }
+        status = generate();
+        // The event is recorded even if the generation has failed, so later
+        // work of the generator is still ordered after work in stream
+        if(hipEventRecord(event, stream) != hipSuccess && status == ROCRAND_STATUS_SUCCESS)
+            status = ROCRAND_STATUS_INTERNAL_ERROR;
+        if(stream != generator_stream)
+        {
+            rocrand_set_stream(generator, generator_stream);
+            if(hipStreamWaitEvent(generator_stream, event, 0) != hipSuccess
+                && status == ROCRAND_STATUS_SUCCESS)
+                status = ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        return generate_future(status, event);
+    }
+
+} // end namespace detail
+/// \endcond
+
 /// \class uniform_int_distribution
 ///
 /// \brief Produces random integer values uniformly distributed on the interval [0, 2^32 - 1].
 ///
-/// \tparam IntType - type of generated values. Only \p unsigned \p char, \p unsigned \p short and \p unsigned \p int type is supported.
+/// \tparam IntType - type of generated values. Only \p unsigned \p char, \p unsigned \p short,
+/// \p unsigned \p int and \p unsigned \p long \p long type is supported.
 template<class IntType = unsigned int>
 class uniform_int_distribution
 {
     static_assert(
         std::is_same<unsigned char, IntType>::value
         || std::is_same<unsigned short, IntType>::value
-        || std::is_same<unsigned int, IntType>::value,
-        "Only unsigned char, unsigned short, and unsigned int types is supported in uniform_int_distribution"
+        || std::is_same<unsigned int, IntType>::value
+        || std::is_same<unsigned long long, IntType>::value,
+        "Only unsigned char, unsigned short, unsigned int, and unsigned long long types is supported in uniform_int_distribution"
     );
 
 public:
@@ -194,7 +377,8 @@ public:
     /// * If generator \p g is a quasi-random number generator (`rocrand_cpp::sobol32_engine`),
     /// then \p size must be a multiple of that generator's dimension.
     ///
-    /// See also: rocrand_generate(), rocrand_generate_char(), rocrand_generate_short()
+    /// See also: rocrand_generate(), rocrand_generate_char(), rocrand_generate_short(),
+    /// rocrand_generate_long_long()
     template<class Generator>
     void operator()(Generator& g, IntType * output, size_t size)
     {
@@ -203,6 +387,25 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
+    /// \brief Asynchronous version of operator()(): fills \p output with
+    /// uniformly distributed random integer values in \p stream.
+    ///
+    /// Values are generated in \p stream after previous work of generator \p g,
+    /// work of \p g submitted later is ordered after them. The host is not
+    /// blocked and errors are not thrown, they are reported by the returned future.
+    ///
+    /// \param g - An uniform random number generator object
+    /// \param output - Device memory to store results
+    /// \param stream - HIP stream of the generation
+    template<class Generator>
+    generate_future operator()(Generator& g, device_span<IntType> output, hipStream_t stream)
+    {
+        return detail::generate_async(
+            g.m_generator, stream,
+            [&]() { return this->generate(g, output.data(), output.size()); }
+        );
+    }
+
     /// Returns \c true if the distribution is the same as \p other.
     bool operator==(const uniform_int_distribution<IntType>& other)
     {
@@ -234,21 +437,29 @@ private:
     {
         return rocrand_generate(g.m_generator, output, size);
     }
+
+    template<class Generator>
+    rocrand_status generate(Generator& g, unsigned long long * output, size_t size)
+    {
+        return rocrand_generate_long_long(g.m_generator, output, size);
+    }
 };
 
 /// \class uniform_real_distribution
 ///
 /// \brief Produces random floating-point values uniformly distributed on the interval (0, 1].
 ///
-/// \tparam RealType - type of generated values. Only \p float, \p double and \p half types are supported.
+/// \tparam RealType - type of generated values. Only \p float, \p double, \p half
+/// and \p bfloat16 types are supported.
 template<class RealType = float>
 class uniform_real_distribution
 {
     static_assert(
         std::is_same<float, RealType>::value
         || std::is_same<double, RealType>::value
-        || std::is_same<half, RealType>::value,
-        "Only float, double, and half types are supported in uniform_real_distribution"
+        || std::is_same<half, RealType>::value
+        || std::is_same<bfloat16, RealType>::value,
+        "Only float, double, half and bfloat16 types are supported in uniform_real_distribution"
     );
 
 public:
@@ -296,7 +507,8 @@ public:
     /// * If generator \p g is a quasi-random number generator (`rocrand_cpp::sobol32_engine`),
     /// then \p size must be a multiple of that generator's dimension.
     ///
-    /// See also: rocrand_generate_uniform(), rocrand_generate_uniform_double(), rocrand_generate_uniform_half()
+    /// See also: rocrand_generate_uniform(), rocrand_generate_uniform_double(), rocrand_generate_uniform_half(),
+    /// rocrand_generate_uniform_bfloat16()
     template<class Generator>
     void operator()(Generator& g, RealType * output, size_t size)
     {
@@ -305,6 +517,25 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
+    /// \brief Asynchronous version of operator()(): fills \p output with
+    /// uniformly distributed random floating-point values in \p stream.
+    ///
+    /// Values are generated in \p stream after previous work of generator \p g,
+    /// work of \p g submitted later is ordered after them. The host is not
+    /// blocked and errors are not thrown, they are reported by the returned future.
+    ///
+    /// \param g - An uniform random number generator object
+    /// \param output - Device memory to store results
+    /// \param stream - HIP stream of the generation
+    template<class Generator>
+    generate_future operator()(Generator& g, device_span<RealType> output, hipStream_t stream)
+    {
+        return detail::generate_async(
+            g.m_generator, stream,
+            [&]() { return this->generate(g, output.data(), output.size()); }
+        );
+    }
+
     /// Returns \c true if the distribution is the same as \p other.
     bool operator==(const uniform_real_distribution<RealType>& other)
     {
@@ -336,6 +567,12 @@ private:
     {
         return rocrand_generate_uniform_half(g.m_generator, output, size);
     }
+
+    template<class Generator>
+    rocrand_status generate(Generator& g, bfloat16 * output, size_t size)
+    {
+        return rocrand_generate_uniform_bfloat16(g.m_generator, output, size);
+    }
 };
 
 /// \class normal_distribution
@@ -492,6 +729,40 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
+    /// \brief Asynchronous version of operator()(): fills \p output with
+    /// normally distributed random floating-point values in \p stream.
+    ///
+    /// Values are generated in \p stream after previous work of generator \p g,
+    /// work of \p g submitted later is ordered after them. The host is not
+    /// blocked and errors are not thrown, they are reported by the returned future.
+    ///
+    /// \param g - An uniform random number generator object
+    /// \param output - Device memory to store results
+    /// \param stream - HIP stream of the generation
+    template<class Generator>
+    generate_future operator()(Generator& g, device_span<RealType> output, hipStream_t stream)
+    {
+        return detail::generate_async(
+            g.m_generator, stream,
+            [&]() { return this->generate(g, output.data(), output.size()); }
+        );
+    }
+
+    /// \brief Asynchronous version of operator()() with parameters \p params
+    /// instead of parameters of the distribution.
+    ///
+    /// \param g - An uniform random number generator object
+    /// \param output - Device memory to store results
+    /// \param params - Distribution parameters
+    /// \param stream - HIP stream of the generation
+    template<class Generator>
+    generate_future operator()(Generator& g, device_span<RealType> output,
+                               const param_type& params, hipStream_t stream)
+    {
+        normal_distribution<RealType> distribution(params);
+        return distribution(g, output, stream);
+    }
+
     /// \brief Returns \c true if the distribution is the same as \p other.
     ///
     /// Two distribution are equal, if their parameters are equal.
@@ -691,6 +962,40 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
+    /// \brief Asynchronous version of operator()(): fills \p output with
+    /// log-normally distributed random floating-point values in \p stream.
+    ///
+    /// Values are generated in \p stream after previous work of generator \p g,
+    /// work of \p g submitted later is ordered after them. The host is not
+    /// blocked and errors are not thrown, they are reported by the returned future.
+    ///
+    /// \param g - An uniform random number generator object
+    /// \param output - Device memory to store results
+    /// \param stream - HIP stream of the generation
+    template<class Generator>
+    generate_future operator()(Generator& g, device_span<RealType> output, hipStream_t stream)
+    {
+        return detail::generate_async(
+            g.m_generator, stream,
+            [&]() { return this->generate(g, output.data(), output.size()); }
+        );
+    }
+
+    /// \brief Asynchronous version of operator()() with parameters \p params
+    /// instead of parameters of the distribution.
+    ///
+    /// \param g - An uniform random number generator object
+    /// \param output - Device memory to store results
+    /// \param params - Distribution parameters
+    /// \param stream - HIP stream of the generation
+    template<class Generator>
+    generate_future operator()(Generator& g, device_span<RealType> output,
+                               const param_type& params, hipStream_t stream)
+    {
+        lognormal_distribution<RealType> distribution(params);
+        return distribution(g, output, stream);
+    }
+
     /// \brief Returns \c true if the distribution is the same as \p other.
     ///
     /// Two distribution are equal, if their parameters are equal.
@@ -872,6 +1177,40 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
+    /// \brief Asynchronous version of operator()(): fills \p output with
+    /// random integer values with Poisson distribution in \p stream.
+    ///
+    /// Values are generated in \p stream after previous work of generator \p g,
+    /// work of \p g submitted later is ordered after them. The host is not
+    /// blocked and errors are not thrown, they are reported by the returned future.
+    ///
+    /// \param g - An uniform random number generator object
+    /// \param output - Device memory to store results
+    /// \param stream - HIP stream of the generation
+    template<class Generator>
+    generate_future operator()(Generator& g, device_span<IntType> output, hipStream_t stream)
+    {
+        return detail::generate_async(
+            g.m_generator, stream,
+            [&]() { return rocrand_generate_poisson(g.m_generator, output.data(), output.size(), this->mean()); }
+        );
+    }
+
+    /// \brief Asynchronous version of operator()() with parameters \p params
+    /// instead of parameters of the distribution.
+    ///
+    /// \param g - An uniform random number generator object
+    /// \param output - Device memory to store results
+    /// \param params - Distribution parameters
+    /// \param stream - HIP stream of the generation
+    template<class Generator>
+    generate_future operator()(Generator& g, device_span<IntType> output,
+                               const param_type& params, hipStream_t stream)
+    {
+        poisson_distribution<IntType> distribution(params);
+        return distribution(g, output, stream);
+    }
+
     /// \brief Returns \c true if the distribution is the same as \p other.
     ///
     /// Two distribution are equal, if their parameters are equal.
@@ -892,113 +1231,641 @@ private:
     param_type m_params;
 };
 
-/// \brief Pseudorandom number engine based Philox algorithm.
-///
-/// philox4x32_10_engine implements
-/// a <a href="https://en.wikipedia.org/wiki/Counter-based_random_number_generator_(CBRNG)">
-/// Counter-based random number generator</a> called Philox, which was developed by
-/// a group at D. E. Shaw Research.
-/// It generates random numbers of type \p unsigned \p int on the interval [0; 2^32 - 1].
-/// Random numbers are generated in sets of four.
-template<unsigned long long DefaultSeed = ROCRAND_PHILOX4x32_DEFAULT_SEED>
-class philox4x32_10_engine
-{
-public:
-    /// \typedef result_type
-    /// Type of values generated by the random number engine.
-    typedef unsigned int result_type;
-    /// \typedef offset_type
-    /// Pseudo-random number engine offset type.
-    /// Offset represents a number of the random number engine's states
-    /// that should be skipped before first value is generated.
-    ///
-    /// See also: offset()
-    typedef unsigned long long offset_type;
-    /// \typedef seed_type
-    /// Pseudo-random number engine seed type definition.
-    ///
-    /// See also: seed()
-    typedef unsigned long long seed_type;
-    /// \brief The default seed equal to \p DefaultSeed.
-    static constexpr seed_type default_seed = DefaultSeed;
+/// \cond
+namespace detail {
 
-    /// \brief Constructs the pseudo-random number engine.
-    ///
-    /// \param seed_value - seed value to use in the initialization of the internal state, see also seed()
-    /// \param offset_value - number of internal states that should be skipped, see also offset()
-    ///
-    /// See also: rocrand_create_generator()
-    philox4x32_10_engine(seed_type seed_value = DefaultSeed,
-                         offset_type offset_value = 0)
+    // Vector of N values of T, aligned to its size if the size is a power
+    // of two not greater than 16 bytes (so it is stored with one instruction)
+    template<class T, unsigned int N,
+             size_t Size = sizeof(T) * N,
+             bool IsAligned = (Size & (Size - 1)) == 0 && Size <= 16>
+    struct transform_vec_type
     {
-        rocrand_status status;
-        status = rocrand_create_generator(&m_generator, this->type());
-        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
-        if(offset_value > 0)
+        T data[N];
+    };
+
+    template<class T, unsigned int N, size_t Size>
+    struct alignas(Size) transform_vec_type<T, N, Size, true>
+    {
+        T data[N];
+    };
+
+    // Generates values with Philox states keyed by a random 64-bit key,
+    // every thread uses its own subsequence. Like generate kernels of
+    // the library, full vectors of output_width values are stored aligned,
+    // head and tail are saved by the thread that would save the next vector.
+    template<class T, class Transform>
+    __global__
+    void transform_kernel(const unsigned long long * key,
+                          T * data, const size_t n,
+                          Transform transform)
+    {
+        constexpr unsigned int input_width = Transform::input_width;
+        constexpr unsigned int output_width = Transform::output_width;
+
+        using vec_type = transform_vec_type<T, output_width>;
+
+        const unsigned int thread_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        rocrand_state_philox4x32_10 state;
+        rocrand_init(*key, thread_id, 0, &state);
+
+        unsigned int input[input_width];
+        T output[output_width];
+
+        const uintptr_t uintptr = reinterpret_cast<uintptr_t>(data);
+        const size_t misalignment =
+            alignof(vec_type) == alignof(T)
+                ? 0
+                : (output_width - uintptr / sizeof(T) % output_width) % output_width;
+        const size_t head_size = n < misalignment ? n : misalignment;
+        const size_t tail_size = (n - head_size) % output_width;
+        const size_t vec_n = (n - head_size) / output_width;
+
+        vec_type * vec_data = reinterpret_cast<vec_type *>(data + head_size);
+        size_t index = thread_id;
+        while(index < vec_n)
         {
-            this->offset(offset_value);
+            for(unsigned int i = 0; i < input_width; i++)
+            {
+                input[i] = rocrand(&state);
+            }
+            transform(input, output);
+
+            vec_type v;
+            for(unsigned int o = 0; o < output_width; o++)
+            {
+                v.data[o] = output[o];
+            }
+            vec_data[index] = v;
+            index += stride;
         }
-        this->seed(seed_value);
-    }
 
-    /// \brief Constructs the pseudo-random number engine.
-    ///
-    /// The pseudo-random number engine will be created using \p generator.
-    /// The constructed engine take ownership over \p generator, and sets
-    /// passed reference to \p NULL. The lifetime of \p generator is now
-    /// bound to the lifetime of the engine.
-    ///
-    /// \param generator - rocRAND generator
-    philox4x32_10_engine(rocrand_generator& generator)
-        : m_generator(generator)
-    {
-        if(generator == NULL)
+        if(index == vec_n)
         {
-            throw rocrand_cpp::error(ROCRAND_STATUS_NOT_CREATED);
+            if(head_size > 0)
+            {
+                for(unsigned int i = 0; i < input_width; i++)
+                {
+                    input[i] = rocrand(&state);
+                }
+                transform(input, output);
+
+                for(unsigned int o = 0; o < output_width; o++)
+                {
+                    if(o < head_size)
+                    {
+                        data[o] = output[o];
+                    }
+                }
+            }
+
+            if(tail_size > 0)
+            {
+                for(unsigned int i = 0; i < input_width; i++)
+                {
+                    input[i] = rocrand(&state);
+                }
+                transform(input, output);
+
+                for(unsigned int o = 0; o < output_width; o++)
+                {
+                    if(o < tail_size)
+                    {
+                        data[n - tail_size + o] = output[o];
+                    }
+                }
+            }
         }
-        generator = NULL;
     }
 
-    /// Destructs the engine.
-    ///
-    /// See also: rocrand_destroy_generator()
-    ~philox4x32_10_engine() noexcept(false)
+} // end namespace detail
+/// \endcond
+
+/// \class transform_distribution
+///
+/// \brief Produces values of a user-defined transform of random 32-bit values.
+///
+/// The transform is applied inside the generation kernel, so values are
+/// written to memory only once (without a second pass over the output).
+///
+/// \tparam T - type of generated values.
+/// \tparam Transform - type of the transform, it must have:
+/// * <tt>static constexpr unsigned int input_width</tt> - number of random
+/// 32-bit values consumed by one call,
+/// * <tt>static constexpr unsigned int output_width</tt> - number of values
+/// produced by one call,
+/// * <tt>__device__ void operator()(const unsigned int (&input)[input_width],
+/// T (&output)[output_width]) const</tt>.
+///
+/// The kernel is compiled in the user's code (header-only), values are
+/// generated by Philox 4x32-10 device states keyed by a 64-bit value drawn
+/// from the engine on every call, so consecutive calls produce different
+/// values and the sequence depends on the engine's seed.
+///
+/// Example:
+/// \code
+/// struct exponential_transform
+/// {
+///     static constexpr unsigned int input_width = 1;
+///     static constexpr unsigned int output_width = 1;
+///
+///     __device__
+///     void operator()(const unsigned int (&input)[1], float (&output)[1]) const
+///     {
+///         output[0] = -logf(rocrand_device::detail::uniform_distribution(input[0]));
+///     }
+/// };
+///
+/// rocrand_cpp::xorwow engine;
+/// rocrand_cpp::transform_distribution<float, exponential_transform> dist;
+/// dist(engine, output, size);
+/// \endcode
+template<class T, class Transform>
+class transform_distribution
+{
+public:
+    typedef T result_type;
+
+    /// \brief Constructs a new distribution object.
+    /// \param transform - Transform to apply
+    /// \param stream - HIP stream of the generation kernel, the key of every call
+    /// is generated by the engine in this stream (ordered after previous work of the engine)
+    transform_distribution(const Transform& transform = Transform(),
+                           hipStream_t stream = 0)
+        : m_transform(transform), m_stream(stream)
     {
-        rocrand_status status = rocrand_destroy_generator(m_generator);
-        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
-    /// \brief Sets the random number engine's \p hipStream for kernel launches.
-    /// \param value - new \p hipStream to use
-    void stream(hipStream_t value)
+    /// Resets distribution's internal state if there is any.
+    void reset()
     {
-        rocrand_status status = rocrand_set_stream(m_generator, value);
-        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
-    /// \brief Sets the offset of a random number engine.
-    ///
-    /// Offset represents a number of the random number engine's states
-    /// that should be skipped before first value is generated.
-    ///
-    /// - This operation resets the engine's internal state.
-    /// - This operation does not change the engine's seed or the number of dimensions.
-    ///
-    /// \param value - New absolute offset
-    ///
-    /// See also: rocrand_set_offset()
-    void offset(offset_type value)
+    /// Returns the transform.
+    Transform transform() const
     {
-        rocrand_status status = rocrand_set_offset(this->m_generator, value);
-        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        return m_transform;
     }
 
-    /// \brief Sets the seed of the pseudo-random number engine.
+    /// \brief Fills \p output with transformed random values.
     ///
-    /// - This operation resets the engine's internal state.
-    /// - This operation does not change the engine's offset.
+    /// Generates \p size values with the transform and stores them
+    /// into the device memory referenced by \p output pointer.
     ///
-    /// \param value - New seed value
+    /// \param g - An uniform pseudo-random number generator object
+    /// \param output - Pointer to device memory to store results
+    /// \param size - Number of values to generate
+    ///
+    /// Requirements:
+    /// * The device memory pointed by \p output must have been previously allocated
+    /// and be large enough to store at least \p size values of \p T type.
+    /// * \p g must be a pseudo-random number generator.
+    template<class Generator>
+    void operator()(Generator& g, T * output, size_t size)
+    {
+        static_assert(
+            Generator::type() != ROCRAND_RNG_QUASI_SOBOL32,
+            "Quasi-random engines can not be used in transform_distribution"
+        );
+
+        if(m_key == NULL)
+        {
+            unsigned long long * key;
+            if(hipMalloc(&key, sizeof(unsigned long long)) != hipSuccess)
+            {
+                throw rocrand_cpp::error(ROCRAND_STATUS_ALLOCATION_FAILED);
+            }
+            m_key = std::shared_ptr<unsigned long long>(
+                key, [](unsigned long long * p) { hipFree(p); }
+            );
+        }
+
+        // The key is written in m_stream, so it is ordered before the kernel
+        // and after kernels of previous calls, which read the previous key
+        unsigned long long * key = m_key.get();
+        rocrand_status status = detail::generate_async(
+            g.m_generator, m_stream,
+            [&]() { return rocrand_generate_long_long(g.m_generator, key, 1); }
+        ).status();
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        if(size == 0)
+        {
+            return;
+        }
+
+        const unsigned int threads = 256;
+        const size_t vectors = (size + Transform::output_width - 1) / Transform::output_width;
+        const unsigned int blocks = static_cast<unsigned int>(
+            std::min<size_t>(1024, (vectors + threads - 1) / threads)
+        );
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(detail::transform_kernel<T, Transform>),
+            dim3(blocks), dim3(threads), 0, m_stream,
+            m_key.get(), output, size, m_transform
+        );
+        if(hipPeekAtLastError() != hipSuccess)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_LAUNCH_FAILURE);
+        }
+    }
+
+private:
+    Transform m_transform;
+    hipStream_t m_stream;
+    // Key of Philox states in device memory, shared by copies
+    std::shared_ptr<unsigned long long> m_key;
+};
+
+/// \cond
+namespace detail {
+
+    // Tree reduction of value of all threads of the block, the result
+    // is returned to thread 0
+    template<unsigned int BlockSize, class T, class Reduce>
+    __device__
+    T block_reduce(T value, const Reduce& reduce)
+    {
+        __shared__ T shared[BlockSize];
+        const unsigned int t = hipThreadIdx_x;
+        shared[t] = value;
+        __syncthreads();
+        for(unsigned int s = BlockSize / 2; s > 0; s >>= 1)
+        {
+            if(t < s)
+            {
+                shared[t] = reduce(shared[t], shared[t + s]);
+            }
+            __syncthreads();
+        }
+        return shared[0];
+    }
+
+    // Every thread reduces mapped values of its own Philox subsequence
+    // (like transform_kernel), then one partial per block is stored
+    template<unsigned int BlockSize, class T, class Map, class Reduce>
+    __global__
+    __launch_bounds__(BlockSize)
+    void transform_reduce_kernel(const unsigned long long * key,
+                                 const size_t n,
+                                 Map map, Reduce reduce, T init,
+                                 T * partials)
+    {
+        constexpr unsigned int input_width = Map::input_width;
+
+        const unsigned int thread_id = hipBlockIdx_x * BlockSize + hipThreadIdx_x;
+        const unsigned int stride = hipGridDim_x * BlockSize;
+
+        rocrand_state_philox4x32_10 state;
+        rocrand_init(*key, thread_id, 0, &state);
+
+        unsigned int input[input_width];
+        T value = init;
+        for(size_t index = thread_id; index < n; index += stride)
+        {
+            for(unsigned int i = 0; i < input_width; i++)
+            {
+                input[i] = rocrand(&state);
+            }
+            value = reduce(value, map(input));
+        }
+
+        value = block_reduce<BlockSize>(value, reduce);
+        if(hipThreadIdx_x == 0)
+        {
+            partials[hipBlockIdx_x] = value;
+        }
+    }
+
+    template<unsigned int BlockSize, class T, class Reduce>
+    __global__
+    __launch_bounds__(BlockSize)
+    void transform_reduce_partials_kernel(const T * partials,
+                                          const unsigned int partials_count,
+                                          Reduce reduce, T init,
+                                          T * result)
+    {
+        T value = init;
+        for(unsigned int i = hipThreadIdx_x; i < partials_count; i += BlockSize)
+        {
+            value = reduce(value, partials[i]);
+        }
+
+        value = block_reduce<BlockSize>(value, reduce);
+        if(hipThreadIdx_x == 0)
+        {
+            *result = value;
+        }
+    }
+
+} // end namespace detail
+/// \endcond
+
+/// \class transform_reduce
+///
+/// \brief Reduces a user-defined map of random 32-bit values without storing them.
+///
+/// Random values are consumed inside the kernel where they are generated:
+/// every thread reduces its mapped values, blocks write one partial each and
+/// the partials are reduced by another kernel. Memory traffic does not depend
+/// on the number of samples and no output buffer is needed.
+///
+/// \tparam T - type of mapped values and the result, it must be trivially
+/// constructible and copyable (it is kept in shared memory).
+/// \tparam Map - type of the map, it must have:
+/// * <tt>static constexpr unsigned int input_width</tt> - number of random
+/// 32-bit values consumed by one sample,
+/// * <tt>__device__ T operator()(const unsigned int (&input)[input_width]) const</tt>.
+/// \tparam Reduce - type of the reduction, it must have
+/// <tt>__device__ T operator()(const T& a, const T& b) const</tt>, which is
+/// associative and commutative, with the initial value as its identity.
+///
+/// Like transform_distribution, the kernels are compiled in the user's code
+/// and samples are generated by Philox 4x32-10 device states keyed by
+/// a 64-bit value drawn from the engine on every call. The order of
+/// the reduction is fixed, so results of the same engine state are the same.
+///
+/// Example:
+/// \code
+/// struct inside_circle
+/// {
+///     static constexpr unsigned int input_width = 2;
+///
+///     __device__
+///     unsigned long long operator()(const unsigned int (&input)[2]) const
+///     {
+///         const float x = rocrand_device::detail::uniform_distribution(input[0]);
+///         const float y = rocrand_device::detail::uniform_distribution(input[1]);
+///         return x * x + y * y <= 1.0f ? 1 : 0;
+///     }
+/// };
+///
+/// struct sum
+/// {
+///     __device__
+///     unsigned long long operator()(const unsigned long long& a,
+///                                   const unsigned long long& b) const
+///     {
+///         return a + b;
+///     }
+/// };
+///
+/// rocrand_cpp::philox4x32_10 engine;
+/// rocrand_cpp::transform_reduce<unsigned long long, inside_circle, sum> pi;
+/// const double estimate = 4.0 * pi(engine, samples) / samples;
+/// \endcode
+template<class T, class Map, class Reduce>
+class transform_reduce
+{
+public:
+    typedef T result_type;
+
+    /// \brief Constructs a new reduction object.
+    /// \param map - Map to apply to random values
+    /// \param reduce - Reduction of mapped values
+    /// \param init - Initial value of the reduction (identity of \p reduce)
+    /// \param stream - HIP stream of the kernels, the key of every call
+    /// is generated by the engine in this stream (ordered after previous work of the engine)
+    transform_reduce(const Map& map = Map(),
+                     const Reduce& reduce = Reduce(),
+                     const T& init = T(),
+                     hipStream_t stream = 0)
+        : m_map(map), m_reduce(reduce), m_init(init), m_stream(stream)
+    {
+    }
+
+    /// Resets internal state if there is any.
+    void reset()
+    {
+    }
+
+    /// \brief Reduces \p size mapped samples into device memory.
+    ///
+    /// Stores the reduction of \p size samples into the device memory
+    /// referenced by \p result, the call does not wait for the kernels.
+    /// If \p size is 0, the initial value is stored.
+    ///
+    /// \param g - An uniform pseudo-random number generator object
+    /// \param size - Number of samples
+    /// \param result - Pointer to device memory to store the result
+    ///
+    /// Requirements:
+    /// * \p g must be a pseudo-random number generator.
+    template<class Generator>
+    void operator()(Generator& g, size_t size, T * result)
+    {
+        static_assert(
+            Generator::type() != ROCRAND_RNG_QUASI_SOBOL32,
+            "Quasi-random engines can not be used in transform_reduce"
+        );
+
+        allocate();
+
+        unsigned int blocks = 0;
+        if(size > 0)
+        {
+            // Like in transform_distribution, the key is written in m_stream
+            unsigned long long * key = m_key.get();
+            rocrand_status status = detail::generate_async(
+                g.m_generator, m_stream,
+                [&]() { return rocrand_generate_long_long(g.m_generator, key, 1); }
+            ).status();
+            if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+
+            blocks = static_cast<unsigned int>(
+                std::min<size_t>(static_cast<size_t>(s_max_blocks), (size + s_threads - 1) / s_threads)
+            );
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(detail::transform_reduce_kernel<s_threads, T, Map, Reduce>),
+                dim3(blocks), dim3(s_threads), 0, m_stream,
+                m_key.get(), size, m_map, m_reduce, m_init, partials()
+            );
+            if(hipPeekAtLastError() != hipSuccess)
+            {
+                throw rocrand_cpp::error(ROCRAND_STATUS_LAUNCH_FAILURE);
+            }
+        }
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(detail::transform_reduce_partials_kernel<s_threads, T, Reduce>),
+            dim3(1), dim3(s_threads), 0, m_stream,
+            partials(), blocks, m_reduce, m_init, result
+        );
+        if(hipPeekAtLastError() != hipSuccess)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_LAUNCH_FAILURE);
+        }
+    }
+
+    /// \brief Returns the reduction of \p size mapped samples.
+    ///
+    /// Waits for the kernels and copies the result to the host.
+    ///
+    /// \param g - An uniform pseudo-random number generator object
+    /// \param size - Number of samples
+    template<class Generator>
+    T operator()(Generator& g, size_t size)
+    {
+        allocate();
+        (*this)(g, size, partials() + s_max_blocks);
+        T result;
+        if(hipMemcpyAsync(&result, partials() + s_max_blocks, sizeof(T),
+                          hipMemcpyDeviceToHost, m_stream) != hipSuccess
+           || hipStreamSynchronize(m_stream) != hipSuccess)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_INTERNAL_ERROR);
+        }
+        return result;
+    }
+
+private:
+    static constexpr unsigned int s_threads = 256;
+    static constexpr unsigned int s_max_blocks = 1024;
+    static constexpr size_t s_partials_offset =
+        (sizeof(unsigned long long) + alignof(T) - 1) / alignof(T) * alignof(T);
+    static constexpr size_t s_buffer_size = s_partials_offset + sizeof(T) * (s_max_blocks + 1);
+
+    // Allocates the key and partials of blocks, the last value is
+    // the result of the host-side operator()
+    void allocate()
+    {
+        if(m_key != NULL)
+        {
+            return;
+        }
+        void * buffer;
+        if(hipMalloc(&buffer, s_buffer_size) != hipSuccess)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_ALLOCATION_FAILED);
+        }
+        m_key = std::shared_ptr<unsigned long long>(
+            static_cast<unsigned long long *>(buffer),
+            [](unsigned long long * p) { hipFree(p); }
+        );
+    }
+
+    T * partials() const
+    {
+        return reinterpret_cast<T *>(
+            reinterpret_cast<char *>(m_key.get()) + s_partials_offset
+        );
+    }
+
+    Map m_map;
+    Reduce m_reduce;
+    T m_init;
+    hipStream_t m_stream;
+    // Key of Philox states followed by partials in device memory, shared by copies
+    std::shared_ptr<unsigned long long> m_key;
+};
+
+/// \brief Pseudorandom number engine based Philox algorithm.
+///
+/// philox4x32_10_engine implements
+/// a <a href="https://en.wikipedia.org/wiki/Counter-based_random_number_generator_(CBRNG)">
+/// Counter-based random number generator</a> called Philox, which was developed by
+/// a group at D. E. Shaw Research.
+/// It generates random numbers of type \p unsigned \p int on the interval [0; 2^32 - 1].
+/// Random numbers are generated in sets of four.
+template<unsigned long long DefaultSeed = ROCRAND_PHILOX4x32_DEFAULT_SEED>
+class philox4x32_10_engine
+{
+public:
+    /// \typedef result_type
+    /// Type of values generated by the random number engine.
+    typedef unsigned int result_type;
+    /// \typedef offset_type
+    /// Pseudo-random number engine offset type.
+    /// Offset represents a number of the random number engine's states
+    /// that should be skipped before first value is generated.
+    ///
+    /// See also: offset()
+    typedef unsigned long long offset_type;
+    /// \typedef seed_type
+    /// Pseudo-random number engine seed type definition.
+    ///
+    /// See also: seed()
+    typedef unsigned long long seed_type;
+    /// \brief The default seed equal to \p DefaultSeed.
+    static constexpr seed_type default_seed = DefaultSeed;
+
+    /// \brief Constructs the pseudo-random number engine.
+    ///
+    /// \param seed_value - seed value to use in the initialization of the internal state, see also seed()
+    /// \param offset_value - number of internal states that should be skipped, see also offset()
+    ///
+    /// See also: rocrand_create_generator()
+    philox4x32_10_engine(seed_type seed_value = DefaultSeed,
+                         offset_type offset_value = 0)
+    {
+        rocrand_status status;
+        status = rocrand_create_generator(&m_generator, this->type());
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        if(offset_value > 0)
+        {
+            this->offset(offset_value);
+        }
+        this->seed(seed_value);
+    }
+
+    /// \brief Constructs the pseudo-random number engine.
+    ///
+    /// The pseudo-random number engine will be created using \p generator.
+    /// The constructed engine take ownership over \p generator, and sets
+    /// passed reference to \p NULL. The lifetime of \p generator is now
+    /// bound to the lifetime of the engine.
+    ///
+    /// \param generator - rocRAND generator
+    philox4x32_10_engine(rocrand_generator& generator)
+        : m_generator(generator)
+    {
+        if(generator == NULL)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_NOT_CREATED);
+        }
+        generator = NULL;
+    }
+
+    /// Destructs the engine.
+    ///
+    /// See also: rocrand_destroy_generator()
+    ~philox4x32_10_engine() noexcept(false)
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \brief Sets the random number engine's \p hipStream for kernel launches.
+    /// \param value - new \p hipStream to use
+    void stream(hipStream_t value)
+    {
+        rocrand_status status = rocrand_set_stream(m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \brief Sets the offset of a random number engine.
+    ///
+    /// Offset represents a number of the random number engine's states
+    /// that should be skipped before first value is generated.
+    ///
+    /// - This operation resets the engine's internal state.
+    /// - This operation does not change the engine's seed or the number of dimensions.
+    ///
+    /// \param value - New absolute offset
+    ///
+    /// See also: rocrand_set_offset()
+    void offset(offset_type value)
+    {
+        rocrand_status status = rocrand_set_offset(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \brief Sets the seed of the pseudo-random number engine.
+    ///
+    /// - This operation resets the engine's internal state.
+    /// - This operation does not change the engine's offset.
+    ///
+    /// \param value - New seed value
     ///
     /// See also: rocrand_set_seed()
     void seed(seed_type value)
@@ -1007,19 +1874,736 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
-    /// \brief Fills \p output with uniformly distributed random integer values.
-    ///
-    /// Generates \p size random integer values uniformly distributed
-    /// on the interval [0, 2^32 - 1], and stores them into the device memory
-    /// referenced by \p output pointer.
-    ///
-    /// \param output - Pointer to device memory to store results
-    /// \param size - Number of values to generate
-    ///
-    /// The device memory pointed by \p output must have been previously allocated
-    /// and be large enough to store at least \p size values of \p IntType type.
-    ///
-    /// See also: rocrand_generate()
+    /// \brief Fills \p output with uniformly distributed random integer values.
+    ///
+    /// Generates \p size random integer values uniformly distributed
+    /// on the interval [0, 2^32 - 1], and stores them into the device memory
+    /// referenced by \p output pointer.
+    ///
+    /// \param output - Pointer to device memory to store results
+    /// \param size - Number of values to generate
+    ///
+    /// The device memory pointed by \p output must have been previously allocated
+    /// and be large enough to store at least \p size values of \p IntType type.
+    ///
+    /// See also: rocrand_generate()
+    template<class Generator>
+    void operator()(result_type * output, size_t size)
+    {
+        rocrand_status status;
+        status = rocrand_generate(m_generator, output, size);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \brief Asynchronous version of operator()(): fills \p output with uniformly
+    /// distributed random integer values in \p stream.
+    ///
+    /// Values are generated in \p stream after previous work of the engine,
+    /// work of the engine submitted later is ordered after them. The host is not
+    /// blocked and errors are not thrown, they are reported by the returned future.
+    ///
+    /// \param output - Device memory to store results
+    /// \param stream - HIP stream of the generation
+    ///
+    /// See also: rocrand_generate()
+    generate_future operator()(device_span<result_type> output, hipStream_t stream)
+    {
+        rocrand_generator generator = m_generator;
+        return detail::generate_async(
+            generator, stream,
+            [&]() { return rocrand_generate(generator, output.data(), output.size()); }
+        );
+    }
+
+    /// Returns the smallest possible value that can be generated by the engine.
+    result_type min() const
+    {
+        return 0;
+    }
+
+    /// Returns the largest possible value that can be generated by the engine.
+    result_type max() const
+    {
+        return std::numeric_limits<unsigned int>::max();
+    }
+
+    /// Returns type of the rocRAND pseudo-random number generator associated with the engine.
+    static constexpr rocrand_rng_type type()
+    {
+        return ROCRAND_RNG_PSEUDO_PHILOX4_32_10;
+    }
+
+private:
+    rocrand_generator m_generator;
+
+    /// \cond
+    template<class T>
+    friend class ::rocrand_cpp::uniform_int_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::uniform_real_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::normal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::lognormal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::poisson_distribution;
+
+    template<class T, class Transform>
+    friend class ::rocrand_cpp::transform_distribution;
+
+    template<class T, class Map, class Reduce>
+    friend class ::rocrand_cpp::transform_reduce;
+    /// \endcond
+};
+
+/// \cond
+template<unsigned long long DefaultSeed>
+constexpr typename philox4x32_10_engine<DefaultSeed>::seed_type philox4x32_10_engine<DefaultSeed>::default_seed;
+/// \endcond
+
+/// \brief Pseudorandom number engine based Philox4x32-7 algorithm.
+///
+/// philox4x32_7_engine implements Philox-4x32-7 counter-based random number
+/// generator: Philox-4x32-10 with 7 rounds instead of 10, which is still
+/// Crush-resistant and is about 30% cheaper to compute.
+/// It generates random numbers of type \p unsigned \p int on the interval [0; 2^32 - 1].
+template<unsigned long long DefaultSeed = ROCRAND_PHILOX4x32_DEFAULT_SEED>
+class philox4x32_7_engine
+{
+public:
+    /// \copydoc philox4x32_10_engine::result_type
+    typedef unsigned int result_type;
+    /// \copydoc philox4x32_10_engine::offset_type
+    typedef unsigned long long offset_type;
+    /// \copydoc philox4x32_10_engine::seed_type
+    typedef unsigned long long seed_type;
+    /// \copydoc philox4x32_10_engine::default_seed
+    static constexpr seed_type default_seed = DefaultSeed;
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(seed_type, offset_type)
+    philox4x32_7_engine(seed_type seed_value = DefaultSeed,
+                        offset_type offset_value = 0)
+    {
+        rocrand_status status;
+        status = rocrand_create_generator(&m_generator, this->type());
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        if(offset_value > 0)
+        {
+            this->offset(offset_value);
+        }
+        this->seed(seed_value);
+    }
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
+    philox4x32_7_engine(rocrand_generator& generator)
+        : m_generator(generator)
+    {
+        if(generator == NULL)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_NOT_CREATED);
+        }
+        generator = NULL;
+    }
+
+    /// \copydoc philox4x32_10_engine::~philox4x32_10_engine()
+    ~philox4x32_7_engine() noexcept(false)
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::stream()
+    void stream(hipStream_t value)
+    {
+        rocrand_status status = rocrand_set_stream(m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::offset()
+    void offset(offset_type value)
+    {
+        rocrand_status status = rocrand_set_offset(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::seed()
+    void seed(seed_type value)
+    {
+        rocrand_status status = rocrand_set_seed(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::operator()()
+    template<class Generator>
+    void operator()(result_type * output, size_t size)
+    {
+        rocrand_status status;
+        status = rocrand_generate(m_generator, output, size);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::operator()(device_span<result_type>,hipStream_t)
+    generate_future operator()(device_span<result_type> output, hipStream_t stream)
+    {
+        rocrand_generator generator = m_generator;
+        return detail::generate_async(
+            generator, stream,
+            [&]() { return rocrand_generate(generator, output.data(), output.size()); }
+        );
+    }
+
+    /// \copydoc philox4x32_10_engine::min()
+    result_type min() const
+    {
+        return 0;
+    }
+
+    /// \copydoc philox4x32_10_engine::max()
+    result_type max() const
+    {
+        return std::numeric_limits<unsigned int>::max();
+    }
+
+    /// \copydoc philox4x32_10_engine::type()
+    static constexpr rocrand_rng_type type()
+    {
+        return ROCRAND_RNG_PSEUDO_PHILOX4_32_7;
+    }
+
+private:
+    rocrand_generator m_generator;
+
+    /// \cond
+    template<class T>
+    friend class ::rocrand_cpp::uniform_int_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::uniform_real_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::normal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::lognormal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::poisson_distribution;
+
+    template<class T, class Transform>
+    friend class ::rocrand_cpp::transform_distribution;
+
+    template<class T, class Map, class Reduce>
+    friend class ::rocrand_cpp::transform_reduce;
+    /// \endcond
+};
+
+/// \cond
+template<unsigned long long DefaultSeed>
+constexpr typename philox4x32_7_engine<DefaultSeed>::seed_type philox4x32_7_engine<DefaultSeed>::default_seed;
+/// \endcond
+
+/// \brief Pseudorandom number engine based Philox4x64-10 algorithm.
+///
+/// philox4x64_10_engine implements Philox-4x64-10 counter-based random number
+/// generator with 64-bit words, which was developed by a group at D. E. Shaw Research.
+/// It generates random numbers of type \p unsigned \p int on the interval [0; 2^32 - 1],
+/// every 64-bit output of the algorithm is split into two numbers.
+template<unsigned long long DefaultSeed = ROCRAND_PHILOX4x64_DEFAULT_SEED>
+class philox4x64_10_engine
+{
+public:
+    /// \copydoc philox4x32_10_engine::result_type
+    typedef unsigned int result_type;
+    /// \copydoc philox4x32_10_engine::offset_type
+    typedef unsigned long long offset_type;
+    /// \copydoc philox4x32_10_engine::seed_type
+    typedef unsigned long long seed_type;
+    /// \copydoc philox4x32_10_engine::default_seed
+    static constexpr seed_type default_seed = DefaultSeed;
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(seed_type, offset_type)
+    philox4x64_10_engine(seed_type seed_value = DefaultSeed,
+                         offset_type offset_value = 0)
+    {
+        rocrand_status status;
+        status = rocrand_create_generator(&m_generator, this->type());
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        if(offset_value > 0)
+        {
+            this->offset(offset_value);
+        }
+        this->seed(seed_value);
+    }
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
+    philox4x64_10_engine(rocrand_generator& generator)
+        : m_generator(generator)
+    {
+        if(generator == NULL)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_NOT_CREATED);
+        }
+        generator = NULL;
+    }
+
+    /// \copydoc philox4x32_10_engine::~philox4x32_10_engine()
+    ~philox4x64_10_engine() noexcept(false)
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::stream()
+    void stream(hipStream_t value)
+    {
+        rocrand_status status = rocrand_set_stream(m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::offset()
+    void offset(offset_type value)
+    {
+        rocrand_status status = rocrand_set_offset(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::seed()
+    void seed(seed_type value)
+    {
+        rocrand_status status = rocrand_set_seed(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::operator()()
+    template<class Generator>
+    void operator()(result_type * output, size_t size)
+    {
+        rocrand_status status;
+        status = rocrand_generate(m_generator, output, size);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::operator()(device_span<result_type>,hipStream_t)
+    generate_future operator()(device_span<result_type> output, hipStream_t stream)
+    {
+        rocrand_generator generator = m_generator;
+        return detail::generate_async(
+            generator, stream,
+            [&]() { return rocrand_generate(generator, output.data(), output.size()); }
+        );
+    }
+
+    /// \copydoc philox4x32_10_engine::min()
+    result_type min() const
+    {
+        return 0;
+    }
+
+    /// \copydoc philox4x32_10_engine::max()
+    result_type max() const
+    {
+        return std::numeric_limits<unsigned int>::max();
+    }
+
+    /// \copydoc philox4x32_10_engine::type()
+    static constexpr rocrand_rng_type type()
+    {
+        return ROCRAND_RNG_PSEUDO_PHILOX4_64_10;
+    }
+
+private:
+    rocrand_generator m_generator;
+
+    /// \cond
+    template<class T>
+    friend class ::rocrand_cpp::uniform_int_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::uniform_real_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::normal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::lognormal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::poisson_distribution;
+
+    template<class T, class Transform>
+    friend class ::rocrand_cpp::transform_distribution;
+
+    template<class T, class Map, class Reduce>
+    friend class ::rocrand_cpp::transform_reduce;
+    /// \endcond
+};
+
+/// \cond
+template<unsigned long long DefaultSeed>
+constexpr typename philox4x64_10_engine<DefaultSeed>::seed_type philox4x64_10_engine<DefaultSeed>::default_seed;
+/// \endcond
+
+/// \brief Pseudorandom number engine based Threefry2x64-20 algorithm.
+///
+/// threefry2x64_20_engine implements Threefry-2x64-20 counter-based random number
+/// generator (based on Threefish block cipher), which was developed by a group
+/// at D. E. Shaw Research.
+/// It generates random numbers of type \p unsigned \p int on the interval [0; 2^32 - 1],
+/// every 64-bit output of the algorithm is split into two numbers.
+template<unsigned long long DefaultSeed = ROCRAND_THREEFRY2x64_DEFAULT_SEED>
+class threefry2x64_20_engine
+{
+public:
+    /// \copydoc philox4x32_10_engine::result_type
+    typedef unsigned int result_type;
+    /// \copydoc philox4x32_10_engine::offset_type
+    typedef unsigned long long offset_type;
+    /// \copydoc philox4x32_10_engine::seed_type
+    typedef unsigned long long seed_type;
+    /// \copydoc philox4x32_10_engine::default_seed
+    static constexpr seed_type default_seed = DefaultSeed;
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(seed_type, offset_type)
+    threefry2x64_20_engine(seed_type seed_value = DefaultSeed,
+                           offset_type offset_value = 0)
+    {
+        rocrand_status status;
+        status = rocrand_create_generator(&m_generator, this->type());
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        if(offset_value > 0)
+        {
+            this->offset(offset_value);
+        }
+        this->seed(seed_value);
+    }
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
+    threefry2x64_20_engine(rocrand_generator& generator)
+        : m_generator(generator)
+    {
+        if(generator == NULL)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_NOT_CREATED);
+        }
+        generator = NULL;
+    }
+
+    /// \copydoc philox4x32_10_engine::~philox4x32_10_engine()
+    ~threefry2x64_20_engine() noexcept(false)
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::stream()
+    void stream(hipStream_t value)
+    {
+        rocrand_status status = rocrand_set_stream(m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::offset()
+    void offset(offset_type value)
+    {
+        rocrand_status status = rocrand_set_offset(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::seed()
+    void seed(seed_type value)
+    {
+        rocrand_status status = rocrand_set_seed(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::operator()()
+    template<class Generator>
+    void operator()(result_type * output, size_t size)
+    {
+        rocrand_status status;
+        status = rocrand_generate(m_generator, output, size);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::operator()(device_span<result_type>,hipStream_t)
+    generate_future operator()(device_span<result_type> output, hipStream_t stream)
+    {
+        rocrand_generator generator = m_generator;
+        return detail::generate_async(
+            generator, stream,
+            [&]() { return rocrand_generate(generator, output.data(), output.size()); }
+        );
+    }
+
+    /// \copydoc philox4x32_10_engine::min()
+    result_type min() const
+    {
+        return 0;
+    }
+
+    /// \copydoc philox4x32_10_engine::max()
+    result_type max() const
+    {
+        return std::numeric_limits<unsigned int>::max();
+    }
+
+    /// \copydoc philox4x32_10_engine::type()
+    static constexpr rocrand_rng_type type()
+    {
+        return ROCRAND_RNG_PSEUDO_THREEFRY2_64_20;
+    }
+
+private:
+    rocrand_generator m_generator;
+
+    /// \cond
+    template<class T>
+    friend class ::rocrand_cpp::uniform_int_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::uniform_real_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::normal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::lognormal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::poisson_distribution;
+
+    template<class T, class Transform>
+    friend class ::rocrand_cpp::transform_distribution;
+
+    template<class T, class Map, class Reduce>
+    friend class ::rocrand_cpp::transform_reduce;
+    /// \endcond
+};
+
+/// \cond
+template<unsigned long long DefaultSeed>
+constexpr typename threefry2x64_20_engine<DefaultSeed>::seed_type threefry2x64_20_engine<DefaultSeed>::default_seed;
+/// \endcond
+
+/// \brief Pseudorandom number engine based Threefry4x64-20 algorithm.
+///
+/// threefry4x64_20_engine implements Threefry-4x64-20 counter-based random number
+/// generator (based on Threefish block cipher), which was developed by a group
+/// at D. E. Shaw Research.
+/// It generates random numbers of type \p unsigned \p int on the interval [0; 2^32 - 1],
+/// every 64-bit output of the algorithm is split into two numbers.
+template<unsigned long long DefaultSeed = ROCRAND_THREEFRY4x64_DEFAULT_SEED>
+class threefry4x64_20_engine
+{
+public:
+    /// \copydoc philox4x32_10_engine::result_type
+    typedef unsigned int result_type;
+    /// \copydoc philox4x32_10_engine::offset_type
+    typedef unsigned long long offset_type;
+    /// \copydoc philox4x32_10_engine::seed_type
+    typedef unsigned long long seed_type;
+    /// \copydoc philox4x32_10_engine::default_seed
+    static constexpr seed_type default_seed = DefaultSeed;
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(seed_type, offset_type)
+    threefry4x64_20_engine(seed_type seed_value = DefaultSeed,
+                           offset_type offset_value = 0)
+    {
+        rocrand_status status;
+        status = rocrand_create_generator(&m_generator, this->type());
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        if(offset_value > 0)
+        {
+            this->offset(offset_value);
+        }
+        this->seed(seed_value);
+    }
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
+    threefry4x64_20_engine(rocrand_generator& generator)
+        : m_generator(generator)
+    {
+        if(generator == NULL)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_NOT_CREATED);
+        }
+        generator = NULL;
+    }
+
+    /// \copydoc philox4x32_10_engine::~philox4x32_10_engine()
+    ~threefry4x64_20_engine() noexcept(false)
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::stream()
+    void stream(hipStream_t value)
+    {
+        rocrand_status status = rocrand_set_stream(m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::offset()
+    void offset(offset_type value)
+    {
+        rocrand_status status = rocrand_set_offset(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::seed()
+    void seed(seed_type value)
+    {
+        rocrand_status status = rocrand_set_seed(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::operator()()
+    template<class Generator>
+    void operator()(result_type * output, size_t size)
+    {
+        rocrand_status status;
+        status = rocrand_generate(m_generator, output, size);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::operator()(device_span<result_type>,hipStream_t)
+    generate_future operator()(device_span<result_type> output, hipStream_t stream)
+    {
+        rocrand_generator generator = m_generator;
+        return detail::generate_async(
+            generator, stream,
+            [&]() { return rocrand_generate(generator, output.data(), output.size()); }
+        );
+    }
+
+    /// \copydoc philox4x32_10_engine::min()
+    result_type min() const
+    {
+        return 0;
+    }
+
+    /// \copydoc philox4x32_10_engine::max()
+    result_type max() const
+    {
+        return std::numeric_limits<unsigned int>::max();
+    }
+
+    /// \copydoc philox4x32_10_engine::type()
+    static constexpr rocrand_rng_type type()
+    {
+        return ROCRAND_RNG_PSEUDO_THREEFRY4_64_20;
+    }
+
+private:
+    rocrand_generator m_generator;
+
+    /// \cond
+    template<class T>
+    friend class ::rocrand_cpp::uniform_int_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::uniform_real_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::normal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::lognormal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::poisson_distribution;
+
+    template<class T, class Transform>
+    friend class ::rocrand_cpp::transform_distribution;
+
+    template<class T, class Map, class Reduce>
+    friend class ::rocrand_cpp::transform_reduce;
+    /// \endcond
+};
+
+/// \cond
+template<unsigned long long DefaultSeed>
+constexpr typename threefry4x64_20_engine<DefaultSeed>::seed_type threefry4x64_20_engine<DefaultSeed>::default_seed;
+/// \endcond
+
+/// \brief Pseudorandom number engine based XORWOW algorithm.
+///
+/// xorwow_engine is a <a href="https://en.wikipedia.org/wiki/Xorshift">xorshift</a> pseudorandom
+/// number engine based on XORWOW algorithm, which was presented by George Marsaglia in
+/// "Xorshift RNGs" paper published in Journal of Statistical Software. It produces random numbers
+/// of type \p unsigned \p int on the interval [0; 2^32 - 1].
+template<unsigned long long DefaultSeed = ROCRAND_XORWOW_DEFAULT_SEED>
+class xorwow_engine
+{
+public:
+    /// \copydoc philox4x32_10_engine::result_type
+    typedef unsigned int result_type;
+    /// \copydoc philox4x32_10_engine::offset_type
+    typedef unsigned long long offset_type;
+    /// \copydoc philox4x32_10_engine::seed_type
+    typedef unsigned long long seed_type;
+    /// \copydoc philox4x32_10_engine::default_seed
+    static constexpr seed_type default_seed = DefaultSeed;
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(seed_type, offset_type)
+    xorwow_engine(seed_type seed_value = DefaultSeed,
+                  offset_type offset_value = 0)
+    {
+        rocrand_status status;
+        status = rocrand_create_generator(&m_generator, this->type());
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        if(offset_value > 0)
+        {
+            this->offset(offset_value);
+        }
+        this->seed(seed_value);
+    }
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
+    xorwow_engine(rocrand_generator& generator)
+        : m_generator(generator)
+    {
+        if(generator == NULL)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_NOT_CREATED);
+        }
+        generator = NULL;
+    }
+
+    /// \copydoc philox4x32_10_engine::~philox4x32_10_engine()
+    ~xorwow_engine() noexcept(false)
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::stream()
+    void stream(hipStream_t value)
+    {
+        rocrand_status status = rocrand_set_stream(m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::offset()
+    void offset(offset_type value)
+    {
+        rocrand_status status = rocrand_set_offset(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::seed()
+    void seed(seed_type value)
+    {
+        rocrand_status status = rocrand_set_seed(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::operator()()
     template<class Generator>
     void operator()(result_type * output, size_t size)
     {
@@ -1028,22 +2612,32 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
-    /// Returns the smallest possible value that can be generated by the engine.
+    /// \copydoc philox4x32_10_engine::operator()(device_span<result_type>,hipStream_t)
+    generate_future operator()(device_span<result_type> output, hipStream_t stream)
+    {
+        rocrand_generator generator = m_generator;
+        return detail::generate_async(
+            generator, stream,
+            [&]() { return rocrand_generate(generator, output.data(), output.size()); }
+        );
+    }
+
+    /// \copydoc philox4x32_10_engine::min()
     result_type min() const
     {
         return 0;
     }
 
-    /// Returns the largest possible value that can be generated by the engine.
+    /// \copydoc philox4x32_10_engine::max()
     result_type max() const
     {
         return std::numeric_limits<unsigned int>::max();
     }
 
-    /// Returns type of the rocRAND pseudo-random number generator associated with the engine.
+    /// \copydoc philox4x32_10_engine::type()
     static constexpr rocrand_rng_type type()
     {
-        return ROCRAND_RNG_PSEUDO_PHILOX4_32_10;
+        return ROCRAND_RNG_PSEUDO_XORWOW;
     }
 
 private:
@@ -1064,22 +2658,28 @@ private:
 
     template<class T>
     friend class ::rocrand_cpp::poisson_distribution;
+
+    template<class T, class Transform>
+    friend class ::rocrand_cpp::transform_distribution;
+
+    template<class T, class Map, class Reduce>
+    friend class ::rocrand_cpp::transform_reduce;
     /// \endcond
 };
 
 /// \cond
 template<unsigned long long DefaultSeed>
-constexpr typename philox4x32_10_engine<DefaultSeed>::seed_type philox4x32_10_engine<DefaultSeed>::default_seed;
+constexpr typename xorwow_engine<DefaultSeed>::seed_type xorwow_engine<DefaultSeed>::default_seed;
 /// \endcond
 
-/// \brief Pseudorandom number engine based XORWOW algorithm.
+/// \brief Pseudorandom number engine based on xoshiro128++ algorithm.
 ///
-/// xorwow_engine is a <a href="https://en.wikipedia.org/wiki/Xorshift">xorshift</a> pseudorandom
-/// number engine based on XORWOW algorithm, which was presented by George Marsaglia in
-/// "Xorshift RNGs" paper published in Journal of Statistical Software. It produces random numbers
+/// xoshiro128pp_engine is an implementation of xoshiro128++ pseudorandom number generator
+/// created by David Blackman and Sebastiano Vigna. Its state is 16 bytes and skipping ahead
+/// uses precomputed jump polynomials instead of jump matrices. It produces random numbers
 /// of type \p unsigned \p int on the interval [0; 2^32 - 1].
-template<unsigned long long DefaultSeed = ROCRAND_XORWOW_DEFAULT_SEED>
-class xorwow_engine
+template<unsigned long long DefaultSeed = ROCRAND_XOSHIRO128PP_DEFAULT_SEED>
+class xoshiro128pp_engine
 {
 public:
     /// \copydoc philox4x32_10_engine::result_type
@@ -1092,7 +2692,7 @@ public:
     static constexpr seed_type default_seed = DefaultSeed;
 
     /// \copydoc philox4x32_10_engine::philox4x32_10_engine(seed_type, offset_type)
-    xorwow_engine(seed_type seed_value = DefaultSeed,
+    xoshiro128pp_engine(seed_type seed_value = DefaultSeed,
                   offset_type offset_value = 0)
     {
         rocrand_status status;
@@ -1106,7 +2706,7 @@ public:
     }
 
     /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
-    xorwow_engine(rocrand_generator& generator)
+    xoshiro128pp_engine(rocrand_generator& generator)
         : m_generator(generator)
     {
         if(generator == NULL)
@@ -1117,7 +2717,7 @@ public:
     }
 
     /// \copydoc philox4x32_10_engine::~philox4x32_10_engine()
-    ~xorwow_engine() noexcept(false)
+    ~xoshiro128pp_engine() noexcept(false)
     {
         rocrand_status status = rocrand_destroy_generator(m_generator);
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
@@ -1153,6 +2753,16 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
+    /// \copydoc philox4x32_10_engine::operator()(device_span<result_type>,hipStream_t)
+    generate_future operator()(device_span<result_type> output, hipStream_t stream)
+    {
+        rocrand_generator generator = m_generator;
+        return detail::generate_async(
+            generator, stream,
+            [&]() { return rocrand_generate(generator, output.data(), output.size()); }
+        );
+    }
+
     /// \copydoc philox4x32_10_engine::min()
     result_type min() const
     {
@@ -1168,7 +2778,7 @@ public:
     /// \copydoc philox4x32_10_engine::type()
     static constexpr rocrand_rng_type type()
     {
-        return ROCRAND_RNG_PSEUDO_XORWOW;
+        return ROCRAND_RNG_PSEUDO_XOSHIRO128PP;
     }
 
 private:
@@ -1189,12 +2799,159 @@ private:
 
     template<class T>
     friend class ::rocrand_cpp::poisson_distribution;
+
+    template<class T, class Transform>
+    friend class ::rocrand_cpp::transform_distribution;
+
+    template<class T, class Map, class Reduce>
+    friend class ::rocrand_cpp::transform_reduce;
     /// \endcond
 };
 
 /// \cond
 template<unsigned long long DefaultSeed>
-constexpr typename xorwow_engine<DefaultSeed>::seed_type xorwow_engine<DefaultSeed>::default_seed;
+constexpr typename xoshiro128pp_engine<DefaultSeed>::seed_type xoshiro128pp_engine<DefaultSeed>::default_seed;
+/// \endcond
+
+/// \brief Pseudorandom number engine based on PCG32 algorithm.
+///
+/// pcg32_engine is an implementation of PCG32 (XSH RR variant) pseudorandom number generator
+/// created by Melissa O'Neill, a 64-bit linear congruential generator with a permuted
+/// output. Its state is 16 bytes. It produces random numbers of type \p unsigned \p int
+/// on the interval [0; 2^32 - 1].
+template<unsigned long long DefaultSeed = ROCRAND_PCG32_DEFAULT_SEED>
+class pcg32_engine
+{
+public:
+    /// \copydoc philox4x32_10_engine::result_type
+    typedef unsigned int result_type;
+    /// \copydoc philox4x32_10_engine::offset_type
+    typedef unsigned long long offset_type;
+    /// \copydoc philox4x32_10_engine::seed_type
+    typedef unsigned long long seed_type;
+    /// \copydoc philox4x32_10_engine::default_seed
+    static constexpr seed_type default_seed = DefaultSeed;
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(seed_type, offset_type)
+    pcg32_engine(seed_type seed_value = DefaultSeed,
+                  offset_type offset_value = 0)
+    {
+        rocrand_status status;
+        status = rocrand_create_generator(&m_generator, this->type());
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        if(offset_value > 0)
+        {
+            this->offset(offset_value);
+        }
+        this->seed(seed_value);
+    }
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
+    pcg32_engine(rocrand_generator& generator)
+        : m_generator(generator)
+    {
+        if(generator == NULL)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_NOT_CREATED);
+        }
+        generator = NULL;
+    }
+
+    /// \copydoc philox4x32_10_engine::~philox4x32_10_engine()
+    ~pcg32_engine() noexcept(false)
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::stream()
+    void stream(hipStream_t value)
+    {
+        rocrand_status status = rocrand_set_stream(m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::offset()
+    void offset(offset_type value)
+    {
+        rocrand_status status = rocrand_set_offset(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::seed()
+    void seed(seed_type value)
+    {
+        rocrand_status status = rocrand_set_seed(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::operator()()
+    template<class Generator>
+    void operator()(result_type * output, size_t size)
+    {
+        rocrand_status status;
+        status = rocrand_generate(m_generator, output, size);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::operator()(device_span<result_type>,hipStream_t)
+    generate_future operator()(device_span<result_type> output, hipStream_t stream)
+    {
+        rocrand_generator generator = m_generator;
+        return detail::generate_async(
+            generator, stream,
+            [&]() { return rocrand_generate(generator, output.data(), output.size()); }
+        );
+    }
+
+    /// \copydoc philox4x32_10_engine::min()
+    result_type min() const
+    {
+        return 0;
+    }
+
+    /// \copydoc philox4x32_10_engine::max()
+    result_type max() const
+    {
+        return std::numeric_limits<unsigned int>::max();
+    }
+
+    /// \copydoc philox4x32_10_engine::type()
+    static constexpr rocrand_rng_type type()
+    {
+        return ROCRAND_RNG_PSEUDO_PCG32;
+    }
+
+private:
+    rocrand_generator m_generator;
+
+    /// \cond
+    template<class T>
+    friend class ::rocrand_cpp::uniform_int_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::uniform_real_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::normal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::lognormal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::poisson_distribution;
+
+    template<class T, class Transform>
+    friend class ::rocrand_cpp::transform_distribution;
+
+    template<class T, class Map, class Reduce>
+    friend class ::rocrand_cpp::transform_reduce;
+    /// \endcond
+};
+
+/// \cond
+template<unsigned long long DefaultSeed>
+constexpr typename pcg32_engine<DefaultSeed>::seed_type pcg32_engine<DefaultSeed>::default_seed;
 /// \endcond
 
 /// \brief Pseudorandom number engine based MRG32k3a CMRG.
@@ -1277,6 +3034,16 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
+    /// \copydoc philox4x32_10_engine::operator()(device_span<result_type>,hipStream_t)
+    generate_future operator()(device_span<result_type> output, hipStream_t stream)
+    {
+        rocrand_generator generator = m_generator;
+        return detail::generate_async(
+            generator, stream,
+            [&]() { return rocrand_generate(generator, output.data(), output.size()); }
+        );
+    }
+
     /// \copydoc philox4x32_10_engine::min()
     result_type min() const
     {
@@ -1313,6 +3080,12 @@ private:
 
     template<class T>
     friend class ::rocrand_cpp::poisson_distribution;
+
+    template<class T, class Transform>
+    friend class ::rocrand_cpp::transform_distribution;
+
+    template<class T, class Map, class Reduce>
+    friend class ::rocrand_cpp::transform_reduce;
     /// \endcond
 };
 
@@ -1346,7 +3119,7 @@ public:
 
     /// \brief Constructs the pseudo-random number engine.
     ///
-    /// MTGP32 engine does not accept offset.
+    /// MTGP32 engine does not accept offset in the constructor, see offset().
     ///
     /// \param seed_value - seed value to use in the initialization of the internal state, see also seed()
     ///
@@ -1384,6 +3157,13 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
+    /// \copydoc philox4x32_10_engine::offset()
+    void offset(offset_type value)
+    {
+        rocrand_status status = rocrand_set_offset(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
     /// \copydoc philox4x32_10_engine::seed()
     void seed(seed_type value)
     {
@@ -1400,6 +3180,16 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
+    /// \copydoc philox4x32_10_engine::operator()(device_span<result_type>,hipStream_t)
+    generate_future operator()(device_span<result_type> output, hipStream_t stream)
+    {
+        rocrand_generator generator = m_generator;
+        return detail::generate_async(
+            generator, stream,
+            [&]() { return rocrand_generate(generator, output.data(), output.size()); }
+        );
+    }
+
     /// \copydoc philox4x32_10_engine::min()
     result_type min() const
     {
@@ -1436,6 +3226,12 @@ private:
 
     template<class T>
     friend class ::rocrand_cpp::poisson_distribution;
+
+    template<class T, class Transform>
+    friend class ::rocrand_cpp::transform_distribution;
+
+    template<class T, class Map, class Reduce>
+    friend class ::rocrand_cpp::transform_reduce;
     /// \endcond
 };
 
@@ -1557,6 +3353,16 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
+    /// \copydoc philox4x32_10_engine::operator()(device_span<result_type>,hipStream_t)
+    generate_future operator()(device_span<result_type> output, hipStream_t stream)
+    {
+        rocrand_generator generator = m_generator;
+        return detail::generate_async(
+            generator, stream,
+            [&]() { return rocrand_generate(generator, output.data(), output.size()); }
+        );
+    }
+
     /// \copydoc philox4x32_10_engine::min()
     result_type min() const
     {
@@ -1593,6 +3399,12 @@ private:
 
     template<class T>
     friend class ::rocrand_cpp::poisson_distribution;
+
+    template<class T, class Transform>
+    friend class ::rocrand_cpp::transform_distribution;
+
+    template<class T, class Map, class Reduce>
+    friend class ::rocrand_cpp::transform_reduce;
     /// \endcond
 };
 
@@ -1605,9 +3417,27 @@ sobol32_engine<DefaultNumDimensions>::default_num_dimensions;
 /// \typedef philox4x32_10;
 /// \brief Typedef of rocrand_cpp::philox4x32_10_engine PRNG engine with default seed (#ROCRAND_PHILOX4x32_DEFAULT_SEED).
 typedef philox4x32_10_engine<> philox4x32_10;
+/// \typedef philox4x32_7;
+/// \brief Typedef of rocrand_cpp::philox4x32_7_engine PRNG engine with default seed (#ROCRAND_PHILOX4x32_DEFAULT_SEED).
+typedef philox4x32_7_engine<> philox4x32_7;
+/// \typedef philox4x64_10;
+/// \brief Typedef of rocrand_cpp::philox4x64_10_engine PRNG engine with default seed (#ROCRAND_PHILOX4x64_DEFAULT_SEED).
+typedef philox4x64_10_engine<> philox4x64_10;
+/// \typedef threefry2x64_20;
+/// \brief Typedef of rocrand_cpp::threefry2x64_20_engine PRNG engine with default seed (#ROCRAND_THREEFRY2x64_DEFAULT_SEED).
+typedef threefry2x64_20_engine<> threefry2x64_20;
+/// \typedef threefry4x64_20;
+/// \brief Typedef of rocrand_cpp::threefry4x64_20_engine PRNG engine with default seed (#ROCRAND_THREEFRY4x64_DEFAULT_SEED).
+typedef threefry4x64_20_engine<> threefry4x64_20;
 /// \typedef xorwow
 /// \brief Typedef of rocrand_cpp::xorwow_engine PRNG engine with default seed (#ROCRAND_XORWOW_DEFAULT_SEED).
 typedef xorwow_engine<> xorwow;
+/// \typedef xoshiro128pp
+/// \brief Typedef of rocrand_cpp::xoshiro128pp_engine PRNG engine with default seed (#ROCRAND_XOSHIRO128PP_DEFAULT_SEED).
+typedef xoshiro128pp_engine<> xoshiro128pp;
+/// \typedef pcg32
+/// \brief Typedef of rocrand_cpp::pcg32_engine PRNG engine with default seed (#ROCRAND_PCG32_DEFAULT_SEED).
+typedef pcg32_engine<> pcg32;
 /// \typedef mrg32k3a
 /// \brief Typedef of rocrand_cpp::mrg32k3a_engine PRNG engine with default seed (#ROCRAND_MRG32K3A_DEFAULT_SEED).
 typedef mrg32k3a_engine<> mrg32k3a;
@@ -0,0 +1,620 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_BINOMIAL_H_
+#define ROCRAND_BINOMIAL_H_
+
+#ifndef FQUALIFIERS
+#define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+#include <math.h>
+
+#include "rocrand_philox4x32_10.h"
+#include "rocrand_philox4x32_7.h"
+#include "rocrand_philox4x64_10.h"
+#include "rocrand_threefry2x64_20.h"
+#include "rocrand_threefry4x64_20.h"
+#include "rocrand_mrg32k3a.h"
+#include "rocrand_xorwow.h"
+#include "rocrand_xoshiro128pp.h"
+#include "rocrand_pcg32.h"
+
+#include "rocrand_uniform.h"
+#include "rocrand_poisson.h"
+
+namespace rocrand_device {
+namespace detail {
+
+// Inversion is used for n * min(p, 1 - p) below the threshold, BTRS above
+constexpr double binomial_threshold_btrs = 10.0;
+
+template<class State>
+FQUALIFIERS
+unsigned int binomial_distribution_inversion(State& state, unsigned int n, double p)
+{
+    // Sequential search from 0 (algorithm BINV, V. Kachitvichyanukul,
+    // B. W. Schmeiser), the expected number of iterations is n * p + 1,
+    // so it is used only for small n * p. p <= 0.5.
+    const double q = 1.0 - p;
+    const double s = p / q;
+    const double a = (n + 1.0) * s;
+    const double r0 = exp(n * log1p(-p));
+    while (true)
+    {
+        double r = r0;
+        double u = rocrand_uniform_double(state);
+        unsigned int k = 0;
+        while (u > r)
+        {
+            u -= r;
+            k++;
+            // Rounding errors can leave u above the total probability
+            if (k > n)
+            {
+                break;
+            }
+            r *= a / k - s;
+        }
+        if (k <= n)
+        {
+            return k;
+        }
+    }
+}
+
+template<class State>
+FQUALIFIERS
+unsigned int binomial_distribution_btrs(State& state, unsigned int n, double p)
+{
+    // Transformed rejection with squeeze BTRS, W. Hoermann, for n * p >= 10.
+    // Like PTRS of the Poisson distribution, a value needs two uniform values
+    // with a high probability. p <= 0.5.
+    const double q = 1.0 - p;
+    const double spq = sqrt(n * p * q);
+    const double b = 1.15 + 2.53 * spq;
+    const double a = -0.0873 + 0.0248 * b + 0.01 * p;
+    const double c = n * p + 0.5;
+    const double v_r = 0.92 - 4.2 / b;
+    const double alpha = (2.83 + 5.1 / b) * spq;
+    const double log_pq = log(p / q);
+    const double m = floor((n + 1.0) * p);
+    const double h = lgamma_approx(m + 1.0) + lgamma_approx(n - m + 1.0);
+
+    while (true)
+    {
+        const double u = rocrand_uniform_double(state) - 0.5;
+        double v = rocrand_uniform_double(state);
+        const double us = 0.5 - fabs(u);
+        const double k = floor((2.0 * a / us + b) * u + c);
+        if (k < 0.0 || k > n)
+        {
+            continue;
+        }
+        // Squeeze: most values are accepted without logarithms
+        if (us >= 0.07 && v <= v_r)
+        {
+            return static_cast<unsigned int>(k);
+        }
+        v = log(v * alpha / (a / (us * us) + b));
+        const double rhs = h - lgamma_approx(k + 1.0) - lgamma_approx(n - k + 1.0) + (k - m) * log_pq;
+        if (v <= rhs)
+        {
+            return static_cast<unsigned int>(k);
+        }
+    }
+}
+
+template<class State>
+FQUALIFIERS
+unsigned int binomial_distribution(State& state, unsigned int n, double p)
+{
+    if (n == 0 || p <= 0.0)
+    {
+        return 0;
+    }
+    if (p >= 1.0)
+    {
+        return n;
+    }
+    // Both methods need p <= 0.5, the distribution of 1 - p is mirrored
+    const bool mirrored = p > 0.5;
+    const double pp = mirrored ? 1.0 - p : p;
+    const unsigned int k = n * pp < binomial_threshold_btrs
+        ? binomial_distribution_inversion(state, n, pp)
+        : binomial_distribution_btrs(state, n, pp);
+    return mirrored ? n - k : k;
+}
+
+// Conditional binomial method: the count of category c is binomial with the
+// remaining trials and the probability of c relative to the remaining
+// categories. Weights are normalized, they do not need to sum to 1.
+// Returns the count of the last category.
+template<class State>
+FQUALIFIERS
+unsigned int multinomial_distribution(State& state,
+                              unsigned int n,
+                              const double * weights,
+                              unsigned int categories,
+                              unsigned int * counts,
+                              size_t stride)
+{
+    double remaining_weight = 0.0;
+    for (unsigned int c = 0; c < categories; c++)
+    {
+        remaining_weight += weights[c];
+    }
+    unsigned int remaining = n;
+    for (unsigned int c = 0; c + 1 < categories; c++)
+    {
+        unsigned int k = 0;
+        if (remaining > 0 && remaining_weight > 0.0)
+        {
+            k = binomial_distribution(state, remaining, weights[c] / remaining_weight);
+        }
+        counts[c * stride] = k;
+        remaining -= k;
+        remaining_weight -= weights[c];
+    }
+    counts[(categories - 1) * stride] = remaining;
+    return remaining;
+}
+
+} // end namespace detail
+} // end namespace rocrand_device
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using Philox generator.
+ *
+ * Generates and returns the number of successes in \p n trials with success
+ * probability \p p using Philox generator in \p state. State is incremented
+ * by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param p - Success probability of a trial
+ *
+ * \return Binomially distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_binomial(rocrand_state_philox4x32_10 * state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution(state, n, p);
+}
+
+/**
+ * \brief Generates a multinomially distributed vector using Philox generator.
+ *
+ * Distributes \p n trials between \p categories categories with probabilities
+ * proportional to \p weights and saves the count of the c-th category to
+ * \p counts[c] using Philox generator in \p state. Weights do not need to be
+ * normalized. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param weights - Pointer to \p categories non-negative weights
+ * \param categories - Number of categories (at least 1)
+ * \param counts - Pointer to memory to store \p categories counts
+ */
+FQUALIFIERS
+void rocrand_multinomial(rocrand_state_philox4x32_10 * state,
+                         unsigned int n,
+                         const double * weights,
+                         unsigned int categories,
+                         unsigned int * counts)
+{
+    rocrand_device::detail::multinomial_distribution(state, n, weights, categories, counts, 1);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using Philox4x32-7 generator.
+ *
+ * Generates and returns the number of successes in \p n trials with success
+ * probability \p p using Philox4x32-7 generator in \p state. State is incremented
+ * by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param p - Success probability of a trial
+ *
+ * \return Binomially distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_binomial(rocrand_state_philox4x32_7 * state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution(state, n, p);
+}
+
+/**
+ * \brief Generates a multinomially distributed vector using Philox4x32-7 generator.
+ *
+ * Distributes \p n trials between \p categories categories with probabilities
+ * proportional to \p weights and saves the count of the c-th category to
+ * \p counts[c] using Philox4x32-7 generator in \p state. Weights do not need to be
+ * normalized. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param weights - Pointer to \p categories non-negative weights
+ * \param categories - Number of categories (at least 1)
+ * \param counts - Pointer to memory to store \p categories counts
+ */
+FQUALIFIERS
+void rocrand_multinomial(rocrand_state_philox4x32_7 * state,
+                         unsigned int n,
+                         const double * weights,
+                         unsigned int categories,
+                         unsigned int * counts)
+{
+    rocrand_device::detail::multinomial_distribution(state, n, weights, categories, counts, 1);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using Philox4x64 generator.
+ *
+ * Generates and returns the number of successes in \p n trials with success
+ * probability \p p using Philox4x64 generator in \p state. State is incremented
+ * by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param p - Success probability of a trial
+ *
+ * \return Binomially distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_binomial(rocrand_state_philox4x64_10 * state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution(state, n, p);
+}
+
+/**
+ * \brief Generates a multinomially distributed vector using Philox4x64 generator.
+ *
+ * Distributes \p n trials between \p categories categories with probabilities
+ * proportional to \p weights and saves the count of the c-th category to
+ * \p counts[c] using Philox4x64 generator in \p state. Weights do not need to be
+ * normalized. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param weights - Pointer to \p categories non-negative weights
+ * \param categories - Number of categories (at least 1)
+ * \param counts - Pointer to memory to store \p categories counts
+ */
+FQUALIFIERS
+void rocrand_multinomial(rocrand_state_philox4x64_10 * state,
+                         unsigned int n,
+                         const double * weights,
+                         unsigned int categories,
+                         unsigned int * counts)
+{
+    rocrand_device::detail::multinomial_distribution(state, n, weights, categories, counts, 1);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using Threefry2x64 generator.
+ *
+ * Generates and returns the number of successes in \p n trials with success
+ * probability \p p using Threefry2x64 generator in \p state. State is incremented
+ * by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param p - Success probability of a trial
+ *
+ * \return Binomially distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_binomial(rocrand_state_threefry2x64_20 * state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution(state, n, p);
+}
+
+/**
+ * \brief Generates a multinomially distributed vector using Threefry2x64 generator.
+ *
+ * Distributes \p n trials between \p categories categories with probabilities
+ * proportional to \p weights and saves the count of the c-th category to
+ * \p counts[c] using Threefry2x64 generator in \p state. Weights do not need to be
+ * normalized. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param weights - Pointer to \p categories non-negative weights
+ * \param categories - Number of categories (at least 1)
+ * \param counts - Pointer to memory to store \p categories counts
+ */
+FQUALIFIERS
+void rocrand_multinomial(rocrand_state_threefry2x64_20 * state,
+                         unsigned int n,
+                         const double * weights,
+                         unsigned int categories,
+                         unsigned int * counts)
+{
+    rocrand_device::detail::multinomial_distribution(state, n, weights, categories, counts, 1);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using Threefry4x64 generator.
+ *
+ * Generates and returns the number of successes in \p n trials with success
+ * probability \p p using Threefry4x64 generator in \p state. State is incremented
+ * by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param p - Success probability of a trial
+ *
+ * \return Binomially distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_binomial(rocrand_state_threefry4x64_20 * state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution(state, n, p);
+}
+
+/**
+ * \brief Generates a multinomially distributed vector using Threefry4x64 generator.
+ *
+ * Distributes \p n trials between \p categories categories with probabilities
+ * proportional to \p weights and saves the count of the c-th category to
+ * \p counts[c] using Threefry4x64 generator in \p state. Weights do not need to be
+ * normalized. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param weights - Pointer to \p categories non-negative weights
+ * \param categories - Number of categories (at least 1)
+ * \param counts - Pointer to memory to store \p categories counts
+ */
+FQUALIFIERS
+void rocrand_multinomial(rocrand_state_threefry4x64_20 * state,
+                         unsigned int n,
+                         const double * weights,
+                         unsigned int categories,
+                         unsigned int * counts)
+{
+    rocrand_device::detail::multinomial_distribution(state, n, weights, categories, counts, 1);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using MRG32K3A generator.
+ *
+ * Generates and returns the number of successes in \p n trials with success
+ * probability \p p using MRG32K3A generator in \p state. State is incremented
+ * by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param p - Success probability of a trial
+ *
+ * \return Binomially distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_binomial(rocrand_state_mrg32k3a * state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution(state, n, p);
+}
+
+/**
+ * \brief Generates a multinomially distributed vector using MRG32K3A generator.
+ *
+ * Distributes \p n trials between \p categories categories with probabilities
+ * proportional to \p weights and saves the count of the c-th category to
+ * \p counts[c] using MRG32K3A generator in \p state. Weights do not need to be
+ * normalized. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param weights - Pointer to \p categories non-negative weights
+ * \param categories - Number of categories (at least 1)
+ * \param counts - Pointer to memory to store \p categories counts
+ */
+FQUALIFIERS
+void rocrand_multinomial(rocrand_state_mrg32k3a * state,
+                         unsigned int n,
+                         const double * weights,
+                         unsigned int categories,
+                         unsigned int * counts)
+{
+    rocrand_device::detail::multinomial_distribution(state, n, weights, categories, counts, 1);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using XORWOW generator.
+ *
+ * Generates and returns the number of successes in \p n trials with success
+ * probability \p p using XORWOW generator in \p state. State is incremented
+ * by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param p - Success probability of a trial
+ *
+ * \return Binomially distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_binomial(rocrand_state_xorwow * state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution(state, n, p);
+}
+
+/**
+ * \brief Generates a multinomially distributed vector using XORWOW generator.
+ *
+ * Distributes \p n trials between \p categories categories with probabilities
+ * proportional to \p weights and saves the count of the c-th category to
+ * \p counts[c] using XORWOW generator in \p state. Weights do not need to be
+ * normalized. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param weights - Pointer to \p categories non-negative weights
+ * \param categories - Number of categories (at least 1)
+ * \param counts - Pointer to memory to store \p categories counts
+ */
+FQUALIFIERS
+void rocrand_multinomial(rocrand_state_xorwow * state,
+                         unsigned int n,
+                         const double * weights,
+                         unsigned int categories,
+                         unsigned int * counts)
+{
+    rocrand_device::detail::multinomial_distribution(state, n, weights, categories, counts, 1);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using compact XORWOW generator.
+ *
+ * Generates and returns the number of successes in \p n trials with success
+ * probability \p p using compact XORWOW generator in \p state. State is incremented
+ * by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param p - Success probability of a trial
+ *
+ * \return Binomially distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_binomial(rocrand_state_xorwow_compact * state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution(state, n, p);
+}
+
+/**
+ * \brief Generates a multinomially distributed vector using compact XORWOW generator.
+ *
+ * Distributes \p n trials between \p categories categories with probabilities
+ * proportional to \p weights and saves the count of the c-th category to
+ * \p counts[c] using compact XORWOW generator in \p state. Weights do not need to be
+ * normalized. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param weights - Pointer to \p categories non-negative weights
+ * \param categories - Number of categories (at least 1)
+ * \param counts - Pointer to memory to store \p categories counts
+ */
+FQUALIFIERS
+void rocrand_multinomial(rocrand_state_xorwow_compact * state,
+                         unsigned int n,
+                         const double * weights,
+                         unsigned int categories,
+                         unsigned int * counts)
+{
+    rocrand_device::detail::multinomial_distribution(state, n, weights, categories, counts, 1);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using xoshiro128++ generator.
+ *
+ * Generates and returns the number of successes in \p n trials with success
+ * probability \p p using xoshiro128++ generator in \p state. State is incremented
+ * by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param p - Success probability of a trial
+ *
+ * \return Binomially distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_binomial(rocrand_state_xoshiro128pp * state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution(state, n, p);
+}
+
+/**
+ * \brief Generates a multinomially distributed vector using xoshiro128++ generator.
+ *
+ * Distributes \p n trials between \p categories categories with probabilities
+ * proportional to \p weights and saves the count of the c-th category to
+ * \p counts[c] using xoshiro128++ generator in \p state. Weights do not need to be
+ * normalized. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param weights - Pointer to \p categories non-negative weights
+ * \param categories - Number of categories (at least 1)
+ * \param counts - Pointer to memory to store \p categories counts
+ */
+FQUALIFIERS
+void rocrand_multinomial(rocrand_state_xoshiro128pp * state,
+                         unsigned int n,
+                         const double * weights,
+                         unsigned int categories,
+                         unsigned int * counts)
+{
+    rocrand_device::detail::multinomial_distribution(state, n, weights, categories, counts, 1);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using PCG32 generator.
+ *
+ * Generates and returns the number of successes in \p n trials with success
+ * probability \p p using PCG32 generator in \p state. State is incremented
+ * by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param p - Success probability of a trial
+ *
+ * \return Binomially distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_binomial(rocrand_state_pcg32 * state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution(state, n, p);
+}
+
+/**
+ * \brief Generates a multinomially distributed vector using PCG32 generator.
+ *
+ * Distributes \p n trials between \p categories categories with probabilities
+ * proportional to \p weights and saves the count of the c-th category to
+ * \p counts[c] using PCG32 generator in \p state. Weights do not need to be
+ * normalized. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param n - Number of trials
+ * \param weights - Pointer to \p categories non-negative weights
+ * \param categories - Number of categories (at least 1)
+ * \param counts - Pointer to memory to store \p categories counts
+ */
+FQUALIFIERS
+void rocrand_multinomial(rocrand_state_pcg32 * state,
+                         unsigned int n,
+                         const double * weights,
+                         unsigned int categories,
+                         unsigned int * counts)
+{
+    rocrand_device::detail::multinomial_distribution(state, n, weights, categories, counts, 1);
+}
+
+#endif // ROCRAND_BINOMIAL_H_
+
+/** @} */ // end of group rocranddevice
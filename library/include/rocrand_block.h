@@ -0,0 +1,391 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_BLOCK_H_
+#define ROCRAND_BLOCK_H_
+
+#ifndef FQUALIFIERS
+#define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS
+
+#include <stdint.h>
+
+#include "rocrand_philox4x32_10.h"
+#include "rocrand_uniform.h"
+#include "rocrand_normal.h"
+
+namespace rocrand_device {
+namespace detail {
+
+// Exposes Philox rounds of a counter, block primitives have no per-thread engines
+struct philox4x32_10_block_rounds : public philox4x32_10_engine
+{
+    FQUALIFIERS
+    static uint4 generate(uint4 counter, uint2 key)
+    {
+        return rounds(counter, key);
+    }
+};
+
+FQUALIFIERS
+uint4 add_counter(uint4 counter, unsigned long long n)
+{
+    const unsigned int lo = static_cast<unsigned int>(n);
+    const unsigned int hi = static_cast<unsigned int>(n >> 32);
+    const uint4 temp = counter;
+    counter.x += lo;
+    counter.y += hi + (counter.x < temp.x ? 1 : 0);
+    counter.z += (counter.y < temp.y ? 1 : 0);
+    counter.w += (counter.z < temp.z ? 1 : 0);
+    return counter;
+}
+
+// Distributions of block primitives: Width values of T from one Philox output
+// (16 bytes for all of them, so vectors of Width values are stored at once)
+struct block_uint_distribution
+{
+    typedef unsigned int value_type;
+    typedef uint4 vec_type;
+    static constexpr unsigned int width = 4;
+
+    FQUALIFIERS
+    uint4 operator()(uint4 v) const
+    {
+        return v;
+    }
+};
+
+struct block_uniform_distribution
+{
+    typedef float value_type;
+    typedef float4 vec_type;
+    static constexpr unsigned int width = 4;
+
+    FQUALIFIERS
+    float4 operator()(uint4 v) const
+    {
+        return uniform_distribution4(v);
+    }
+};
+
+struct block_uniform_double_distribution
+{
+    typedef double value_type;
+    typedef double2 vec_type;
+    static constexpr unsigned int width = 2;
+
+    FQUALIFIERS
+    double2 operator()(uint4 v) const
+    {
+        return uniform_distribution_double2(v);
+    }
+};
+
+struct block_normal_distribution
+{
+    typedef float value_type;
+    typedef float4 vec_type;
+    static constexpr unsigned int width = 4;
+
+    FQUALIFIERS
+    float4 operator()(uint4 v) const
+    {
+        return normal_distribution4(v);
+    }
+};
+
+// Value k of a fill is the (k % width)-th value of the Philox output of
+// counter + k / width, threads compute outputs t, t + BlockSize, ...
+template<unsigned int BlockSize, unsigned int Size, class Distribution>
+FQUALIFIERS
+void block_fill(typename Distribution::value_type * tile,
+                uint4& counter, const uint2 key,
+                Distribution distribution)
+{
+    typedef typename Distribution::value_type T;
+    typedef typename Distribution::vec_type vec_type;
+    constexpr unsigned int width = Distribution::width;
+    constexpr unsigned int outputs = (Size + width - 1) / width;
+
+    const bool vectorized = Size % width == 0
+        && reinterpret_cast<uintptr_t>(tile) % sizeof(vec_type) == 0;
+    for(unsigned int i = hipThreadIdx_x; i < outputs; i += BlockSize)
+    {
+        const uint4 bits = philox4x32_10_block_rounds::generate(add_counter(counter, i), key);
+        vec_type v = distribution(bits);
+        if(vectorized)
+        {
+            reinterpret_cast<vec_type *>(tile)[i] = v;
+        }
+        else
+        {
+            const T * values = reinterpret_cast<const T *>(&v);
+            for(unsigned int j = 0; j < width; j++)
+            {
+                if(i * width + j < Size)
+                    tile[i * width + j] = values[j];
+            }
+        }
+    }
+    counter = add_counter(counter, outputs);
+}
+
+// The same values as block_fill() of BlockSize * ItemsPerThread values,
+// thread t gets values t * ItemsPerThread, ..., t * ItemsPerThread + ItemsPerThread - 1
+template<unsigned int BlockSize, unsigned int ItemsPerThread, class Distribution>
+FQUALIFIERS
+void block_generate(typename Distribution::value_type (&items)[ItemsPerThread],
+                    uint4& counter, const uint2 key,
+                    Distribution distribution)
+{
+    typedef typename Distribution::value_type T;
+    typedef typename Distribution::vec_type vec_type;
+    constexpr unsigned int width = Distribution::width;
+    constexpr unsigned int outputs = (BlockSize * ItemsPerThread + width - 1) / width;
+
+    const unsigned int first = hipThreadIdx_x * ItemsPerThread;
+    vec_type v;
+    for(unsigned int i = 0; i < ItemsPerThread; i++)
+    {
+        const unsigned int k = first + i;
+        if(i == 0 || k % width == 0)
+        {
+            v = distribution(
+                philox4x32_10_block_rounds::generate(add_counter(counter, k / width), key)
+            );
+        }
+        items[i] = reinterpret_cast<const T *>(&v)[k % width];
+    }
+    counter = add_counter(counter, outputs);
+}
+
+} // end namespace detail
+} // end namespace rocrand_device
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+/**
+ * \brief Philox state shared by all threads of a block.
+ *
+ * Every thread of the block holds the same state (it is not stored in memory),
+ * block primitives called by all threads with the same state advance it equally.
+ */
+typedef struct rocrand_block_state_philox4x32_10
+{
+    uint4 counter;
+    uint2 key;
+} rocrand_block_state_philox4x32_10;
+
+/**
+ * \brief Initializes Philox state of a block.
+ *
+ * Initializes \p state with the given \p seed, \p subsequence and \p offset
+ * (rounded down to a multiple of 4). Values generated by block primitives are
+ * consecutive values of the Philox sequence of rocrand_init() with the same
+ * arguments (each call starts at a multiple of 4 values, 2 for doubles).
+ *
+ * \param seed - Value to use as a seed
+ * \param subsequence - Subsequence to start at (e.g. block index)
+ * \param offset - Absolute offset into subsequence
+ * \param state - Pointer to state to initialize
+ */
+FQUALIFIERS
+void rocrand_block_init(const unsigned long long seed,
+                        const unsigned long long subsequence,
+                        const unsigned long long offset,
+                        rocrand_block_state_philox4x32_10 * state)
+{
+    state->key = uint2 {
+        static_cast<unsigned int>(seed), static_cast<unsigned int>(seed >> 32)
+    };
+    state->counter = rocrand_device::detail::add_counter(uint4 { 0, 0, 0, 0 }, offset / 4);
+    state->counter.z += static_cast<unsigned int>(subsequence);
+    state->counter.w += static_cast<unsigned int>(subsequence >> 32)
+        + (state->counter.z < static_cast<unsigned int>(subsequence) ? 1 : 0);
+}
+
+/**
+ * \brief Updates Philox state of a block to skip ahead by \p offset elements
+ * (rounded down to a multiple of 4).
+ *
+ * \param offset - Number of elements to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void rocrand_block_skipahead(unsigned long long offset,
+                             rocrand_block_state_philox4x32_10 * state)
+{
+    state->counter = rocrand_device::detail::add_counter(state->counter, offset / 4);
+}
+
+/**
+ * \brief Fills a tile with uniformly distributed random <tt>unsigned int</tt>
+ * values from [0; 2^32 - 1] range.
+ *
+ * All \p BlockSize threads of the block must call it with the same \p state and
+ * \p tile of \p Size values (usually in shared memory). Value \p k of the tile is
+ * the \p k -th value of the block's sequence, threads compute and store 4 consecutive
+ * values at once (striped arrangement of 16-byte vectors, they are stored as vectors
+ * when \p tile is aligned to 16 bytes and \p Size is a multiple of 4).
+ * Threads must be synchronized (__syncthreads()) before reading values stored
+ * by other threads. State is incremented by \p Size positions rounded up to
+ * a multiple of 4.
+ *
+ * \tparam BlockSize - Number of threads of the block (hipBlockDim_x)
+ * \tparam Size - Number of values of the tile
+ *
+ * \param tile - Pointer to the tile
+ * \param state - Pointer to the state of the block
+ */
+template<unsigned int BlockSize, unsigned int Size>
+FQUALIFIERS
+void rocrand_block_fill(unsigned int * tile,
+                        rocrand_block_state_philox4x32_10 * state)
+{
+    rocrand_device::detail::block_fill<BlockSize, Size>(
+        tile, state->counter, state->key,
+        rocrand_device::detail::block_uint_distribution()
+    );
+}
+
+/**
+ * \brief Fills a tile with uniformly distributed random <tt>float</tt> values
+ * from (0; 1] range.
+ *
+ * See rocrand_block_fill().
+ *
+ * \tparam BlockSize - Number of threads of the block (hipBlockDim_x)
+ * \tparam Size - Number of values of the tile
+ *
+ * \param tile - Pointer to the tile
+ * \param state - Pointer to the state of the block
+ */
+template<unsigned int BlockSize, unsigned int Size>
+FQUALIFIERS
+void rocrand_block_fill_uniform(float * tile,
+                                rocrand_block_state_philox4x32_10 * state)
+{
+    rocrand_device::detail::block_fill<BlockSize, Size>(
+        tile, state->counter, state->key,
+        rocrand_device::detail::block_uniform_distribution()
+    );
+}
+
+/**
+ * \brief Fills a tile with uniformly distributed random <tt>double</tt> values
+ * from (0; 1] range.
+ *
+ * See rocrand_block_fill(), each double uses 2 values of the sequence.
+ *
+ * \tparam BlockSize - Number of threads of the block (hipBlockDim_x)
+ * \tparam Size - Number of values of the tile
+ *
+ * \param tile - Pointer to the tile
+ * \param state - Pointer to the state of the block
+ */
+template<unsigned int BlockSize, unsigned int Size>
+FQUALIFIERS
+void rocrand_block_fill_uniform_double(double * tile,
+                                       rocrand_block_state_philox4x32_10 * state)
+{
+    rocrand_device::detail::block_fill<BlockSize, Size>(
+        tile, state->counter, state->key,
+        rocrand_device::detail::block_uniform_double_distribution()
+    );
+}
+
+/**
+ * \brief Fills a tile with normally distributed random <tt>float</tt> values
+ * with mean 0 and standard deviation 1.
+ *
+ * See rocrand_block_fill(), pairs of values are produced by the Box-Muller transform.
+ *
+ * \tparam BlockSize - Number of threads of the block (hipBlockDim_x)
+ * \tparam Size - Number of values of the tile
+ *
+ * \param tile - Pointer to the tile
+ * \param state - Pointer to the state of the block
+ */
+template<unsigned int BlockSize, unsigned int Size>
+FQUALIFIERS
+void rocrand_block_fill_normal(float * tile,
+                               rocrand_block_state_philox4x32_10 * state)
+{
+    rocrand_device::detail::block_fill<BlockSize, Size>(
+        tile, state->counter, state->key,
+        rocrand_device::detail::block_normal_distribution()
+    );
+}
+
+/**
+ * \brief Generates uniformly distributed random <tt>unsigned int</tt> values
+ * from [0; 2^32 - 1] range to registers of threads of a block.
+ *
+ * All \p BlockSize threads of the block must call it with the same \p state.
+ * Thread \p t gets values \p t * \p ItemsPerThread, ..., \p t * \p ItemsPerThread
+ * + \p ItemsPerThread - 1 (blocked arrangement) of rocrand_block_fill() of
+ * \p BlockSize * \p ItemsPerThread values, without memory accesses.
+ *
+ * \tparam BlockSize - Number of threads of the block (hipBlockDim_x)
+ * \tparam ItemsPerThread - Number of values of every thread
+ *
+ * \param items - Values of the thread
+ * \param state - Pointer to the state of the block
+ */
+template<unsigned int BlockSize, unsigned int ItemsPerThread>
+FQUALIFIERS
+void rocrand_block_generate(unsigned int (&items)[ItemsPerThread],
+                            rocrand_block_state_philox4x32_10 * state)
+{
+    rocrand_device::detail::block_generate<BlockSize>(
+        items, state->counter, state->key,
+        rocrand_device::detail::block_uint_distribution()
+    );
+}
+
+/**
+ * \brief Generates uniformly distributed random <tt>float</tt> values
+ * from (0; 1] range to registers of threads of a block.
+ *
+ * See rocrand_block_generate().
+ *
+ * \tparam BlockSize - Number of threads of the block (hipBlockDim_x)
+ * \tparam ItemsPerThread - Number of values of every thread
+ *
+ * \param items - Values of the thread
+ * \param state - Pointer to the state of the block
+ */
+template<unsigned int BlockSize, unsigned int ItemsPerThread>
+FQUALIFIERS
+void rocrand_block_generate_uniform(float (&items)[ItemsPerThread],
+                                    rocrand_block_state_philox4x32_10 * state)
+{
+    rocrand_device::detail::block_generate<BlockSize>(
+        items, state->counter, state->key,
+        rocrand_device::detail::block_uniform_distribution()
+    );
+}
+
+#endif // ROCRAND_BLOCK_H_
+
+/** @} */ // end of group rocranddevice
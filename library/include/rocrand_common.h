@@ -34,6 +34,7 @@
 #define ROCRAND_SQRT2_DOUBLE (1.4142135623730951)
 
 #include <math.h>
+#include <stddef.h>
 
 #ifndef FQUALIFIERS
 #define FQUALIFIERS __forceinline__ __device__
@@ -43,6 +44,23 @@
 #define ROCRAND_HALF_MATH_SUPPORTED
 #endif
 
+// By default every translation unit that includes the device API has its own copy
+// of precomputed device tables (jump matrices of XORWOW and MRG32k3a, ziggurat tables).
+// If ROCRAND_EXTERN_DEVICE_TABLES is defined, the headers only declare the tables
+// and exactly one translation unit of the program must also define
+// ROCRAND_DEFINE_DEVICE_TABLES before including rocrand_kernel.h, so the tables
+// are defined once. This mode requires relocatable device code (-fgpu-rdc for
+// HIP-Clang, -rdc=true for nvcc).
+#if defined(ROCRAND_EXTERN_DEVICE_TABLES)
+#define ROCRAND_DEVICE_TABLE extern
+#if defined(ROCRAND_DEFINE_DEVICE_TABLES)
+#define ROCRAND_DEVICE_TABLE_DEFINITIONS
+#endif
+#else
+#define ROCRAND_DEVICE_TABLE static
+#define ROCRAND_DEVICE_TABLE_DEFINITIONS
+#endif
+
 namespace rocrand_device {
 namespace detail {
 
@@ -125,7 +143,105 @@ struct engine_boxmuller_helper
     }
 };
 
+// Structure-of-arrays storage of states: word w of the state index is stored
+// at buffer[w * states_size + index], so consecutive threads loading or storing
+// consecutive states access consecutive words (coalesced memory transactions).
+template<class State>
+union state_soa_words
+{
+    static_assert(sizeof(State) % sizeof(unsigned int) == 0,
+                  "State must consist of 32-bit words");
+
+    unsigned int words[sizeof(State) / sizeof(unsigned int)];
+    State state;
+
+    // Members are copied word by word
+    FQUALIFIERS state_soa_words() { }
+    FQUALIFIERS ~state_soa_words() { }
+};
+
+template<class State>
+FQUALIFIERS
+State load_state_soa(const void * buffer, const size_t states_size, const size_t index)
+{
+    const unsigned int * words = static_cast<const unsigned int *>(buffer);
+    state_soa_words<State> s;
+    for(unsigned int w = 0; w < sizeof(State) / sizeof(unsigned int); w++)
+    {
+        s.words[w] = words[w * states_size + index];
+    }
+    return s.state;
+}
+
+template<class State>
+FQUALIFIERS
+void store_state_soa(void * buffer, const size_t states_size, const size_t index,
+                     const State& state)
+{
+    unsigned int * words = static_cast<unsigned int *>(buffer);
+    state_soa_words<State> s;
+    s.state = state;
+    for(unsigned int w = 0; w < sizeof(State) / sizeof(unsigned int); w++)
+    {
+        words[w * states_size + index] = s.words[w];
+    }
+}
+
 } // end namespace detail
 } // end namespace rocrand_device
 
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+/**
+ * \brief Loads a state from a structure-of-arrays buffer.
+ *
+ * Loads the state \p index of \p states_size states stored in \p buffer
+ * as a structure of arrays: the i-th 32-bit word of the state \p index is
+ * the word <tt>i * states_size + index</tt> of \p buffer. When consecutive
+ * threads load consecutive states, memory accesses are coalesced, unlike loads
+ * of arrays of states. The buffer has the same size as an array of
+ * \p states_size states. Can be used with all states except
+ * rocrand_state_mtgp32.
+ *
+ * \param buffer - Pointer to the buffer of states
+ * \param states_size - Number of states in the buffer
+ * \param index - Index of the state to load
+ * \param state - Pointer to the loaded state
+ */
+template<class State>
+FQUALIFIERS
+void rocrand_load_state_soa(const void * buffer,
+                            const size_t states_size,
+                            const size_t index,
+                            State * state)
+{
+    *state = rocrand_device::detail::load_state_soa<State>(buffer, states_size, index);
+}
+
+/**
+ * \brief Stores a state to a structure-of-arrays buffer.
+ *
+ * Stores \p state as the state \p index of \p states_size states of
+ * \p buffer (see rocrand_load_state_soa()).
+ *
+ * \param buffer - Pointer to the buffer of states
+ * \param states_size - Number of states in the buffer
+ * \param index - Index of the state to store
+ * \param state - Pointer to the state to store
+ */
+template<class State>
+FQUALIFIERS
+void rocrand_store_state_soa(void * buffer,
+                             const size_t states_size,
+                             const size_t index,
+                             const State * state)
+{
+    rocrand_device::detail::store_state_soa(buffer, states_size, index, *state);
+}
+
+/** @} */ // end of group rocranddevice
+
 #endif // ROCRAND_COMMON_H_
@@ -28,9 +28,18 @@
 #include <math.h>
 
 #include "rocrand_philox4x32_10.h"
+#include "rocrand_philox4x32_7.h"
+#include "rocrand_philox4x64_10.h"
+#include "rocrand_threefry2x64_20.h"
+#include "rocrand_threefry4x64_20.h"
 #include "rocrand_mrg32k3a.h"
 #include "rocrand_xorwow.h"
+#include "rocrand_xoshiro128pp.h"
+#include "rocrand_pcg32.h"
 #include "rocrand_sobol32.h"
+#include "rocrand_scrambled_sobol32.h"
+#include "rocrand_sobol64.h"
+#include "rocrand_scrambled_sobol64.h"
 #include "rocrand_mtgp32.h"
 
 #include "rocrand_uniform.h"
@@ -64,18 +73,30 @@ unsigned int discrete_alias(const double x, const rocrand_discrete_distribution_
 FQUALIFIERS
 unsigned int discrete_alias(const unsigned int r, const rocrand_discrete_distribution_st& dis)
 {
-    const double x = r * ROCRAND_2POW32_INV_DOUBLE;
-    return discrete_alias(x, dis);
+    if (dis.alias_table == NULL)
+    {
+        // Distributions without the packed table (e.g. built by hand)
+        const double x = r * ROCRAND_2POW32_INV_DOUBLE;
+        return discrete_alias(x, dis);
+    }
+
+    // Calculate value using packed Alias table
+
+    // The high 32 bits of r * size are the index, the low 32 bits are
+    // the fraction compared with the fixed-point probability
+    const unsigned long long nr = static_cast<unsigned long long>(r) * dis.size;
+    const unsigned int i = static_cast<unsigned int>(nr >> 32);
+    const unsigned int y = static_cast<unsigned int>(nr);
+    const unsigned long long entry = dis.alias_table[i];
+    return dis.offset + (y < static_cast<unsigned int>(entry) ? i : static_cast<unsigned int>(entry >> 32));
 }
 
 FQUALIFIERS
-unsigned int discrete_cdf(const double x, const rocrand_discrete_distribution_st& dis)
+unsigned int discrete_cdf_search(const double x, const rocrand_discrete_distribution_st& dis,
+                                 unsigned int min, unsigned int max)
 {
-    // Calculate value using binary search in CDF
-
-    unsigned int min = 0;
-    unsigned int max = dis.size - 1;
-    do
+    // Binary search in CDF: the first index in [min, max) with x <= cdf[index], or max
+    while (min != max)
     {
         const unsigned int center = (min + max) / 2;
         const double p = dis.cdf[center];
@@ -88,16 +109,39 @@ unsigned int discrete_cdf(const double x, const rocrand_discrete_distribution_st
             max = center;
         }
     }
-    while (min != max);
+    return min;
+}
+
+FQUALIFIERS
+unsigned int discrete_cdf(const double x, const rocrand_discrete_distribution_st& dis)
+{
+    // Calculate value using binary search in CDF
+
+    if (dis.guide == NULL)
+    {
+        return dis.offset + discrete_cdf_search(x, dis, 0, dis.size - 1);
+    }
 
-    return dis.offset + min;
+    // The guide table narrows the range, usually to one or two values
+    // x is [0, 1), the product is exact (power of 2)
+    const unsigned int j = static_cast<unsigned int>(x * static_cast<double>(1ULL << dis.guide_bits));
+    return dis.offset + discrete_cdf_search(x, dis, dis.guide[j], dis.guide[j + 1]);
 }
 
 FQUALIFIERS
 unsigned int discrete_cdf(const unsigned int r, const rocrand_discrete_distribution_st& dis)
 {
     const double x = r * ROCRAND_2POW32_INV_DOUBLE;
-    return discrete_cdf(x, dis);
+    if (dis.guide == NULL)
+    {
+        return dis.offset + discrete_cdf_search(x, dis, 0, dis.size - 1);
+    }
+
+    // The top guide_bits bits of r are floor(x * 2^guide_bits)
+    const unsigned int j = static_cast<unsigned int>(
+        (static_cast<unsigned long long>(r) << dis.guide_bits) >> 32
+    );
+    return dis.offset + discrete_cdf_search(x, dis, dis.guide[j], dis.guide[j + 1]);
 }
 
 } // end namespace detail
@@ -126,6 +170,24 @@ unsigned int rocrand_discrete(rocrand_state_philox4x32_10 * state, const rocrand
     return rocrand_device::detail::discrete_alias(rocrand(state), *discrete_distribution);
 }
 
+/**
+ * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
+ *
+ * Returns a <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using Philox4x32-7 generator in \p state, and increments
+ * the position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return <tt>unsigned int</tt> value distributed according to \p discrete_distribution
+ */
+FQUALIFIERS
+unsigned int rocrand_discrete(rocrand_state_philox4x32_7 * state, const rocrand_discrete_distribution discrete_distribution)
+{
+    return rocrand_device::detail::discrete_alias(rocrand(state), *discrete_distribution);
+}
+
 /**
  * \brief Returns four discrete distributed <tt>unsigned int</tt> values.
  *
@@ -150,6 +212,156 @@ uint4 rocrand_discrete4(rocrand_state_philox4x32_10 * state, const rocrand_discr
     };
 }
 
+/**
+ * \brief Returns four discrete distributed <tt>unsigned int</tt> values.
+ *
+ * Returns four <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using Philox4x32-7 generator in \p state, and increments
+ * the position of the generator by four.
+ *
+ * \param state - Pointer to a state to use
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return Four <tt>unsigned int</tt> values distributed according to \p discrete_distribution as \p uint4
+ */
+FQUALIFIERS
+uint4 rocrand_discrete4(rocrand_state_philox4x32_7 * state, const rocrand_discrete_distribution discrete_distribution)
+{
+    const uint4 u4 = rocrand4(state);
+    return uint4 {
+        rocrand_device::detail::discrete_alias(u4.x, *discrete_distribution),
+        rocrand_device::detail::discrete_alias(u4.y, *discrete_distribution),
+        rocrand_device::detail::discrete_alias(u4.z, *discrete_distribution),
+        rocrand_device::detail::discrete_alias(u4.w, *discrete_distribution)
+    };
+}
+
+/**
+ * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
+ *
+ * Returns a <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using Philox4x64 generator in \p state, and increments
+ * the position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return <tt>unsigned int</tt> value distributed according to \p discrete_distribution
+ */
+FQUALIFIERS
+unsigned int rocrand_discrete(rocrand_state_philox4x64_10 * state, const rocrand_discrete_distribution discrete_distribution)
+{
+    return rocrand_device::detail::discrete_alias(rocrand(state), *discrete_distribution);
+}
+
+/**
+ * \brief Returns four discrete distributed <tt>unsigned int</tt> values.
+ *
+ * Returns four <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using Philox4x64 generator in \p state, and increments
+ * the position of the generator by four.
+ *
+ * \param state - Pointer to a state to use
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return Four <tt>unsigned int</tt> values distributed according to \p discrete_distribution as \p uint4
+ */
+FQUALIFIERS
+uint4 rocrand_discrete4(rocrand_state_philox4x64_10 * state, const rocrand_discrete_distribution discrete_distribution)
+{
+    const uint4 u4 = rocrand4(state);
+    return uint4 {
+        rocrand_device::detail::discrete_alias(u4.x, *discrete_distribution),
+        rocrand_device::detail::discrete_alias(u4.y, *discrete_distribution),
+        rocrand_device::detail::discrete_alias(u4.z, *discrete_distribution),
+        rocrand_device::detail::discrete_alias(u4.w, *discrete_distribution)
+    };
+}
+
+/**
+ * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
+ *
+ * Returns a <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using Threefry2x64 generator in \p state, and increments
+ * the position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return <tt>unsigned int</tt> value distributed according to \p discrete_distribution
+ */
+FQUALIFIERS
+unsigned int rocrand_discrete(rocrand_state_threefry2x64_20 * state, const rocrand_discrete_distribution discrete_distribution)
+{
+    return rocrand_device::detail::discrete_alias(rocrand(state), *discrete_distribution);
+}
+
+/**
+ * \brief Returns four discrete distributed <tt>unsigned int</tt> values.
+ *
+ * Returns four <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using Threefry2x64 generator in \p state, and increments
+ * the position of the generator by four.
+ *
+ * \param state - Pointer to a state to use
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return Four <tt>unsigned int</tt> values distributed according to \p discrete_distribution as \p uint4
+ */
+FQUALIFIERS
+uint4 rocrand_discrete4(rocrand_state_threefry2x64_20 * state, const rocrand_discrete_distribution discrete_distribution)
+{
+    const uint4 u4 = rocrand4(state);
+    return uint4 {
+        rocrand_device::detail::discrete_alias(u4.x, *discrete_distribution),
+        rocrand_device::detail::discrete_alias(u4.y, *discrete_distribution),
+        rocrand_device::detail::discrete_alias(u4.z, *discrete_distribution),
+        rocrand_device::detail::discrete_alias(u4.w, *discrete_distribution)
+    };
+}
+
+/**
+ * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
+ *
+ * Returns a <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using Threefry4x64 generator in \p state, and increments
+ * the position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return <tt>unsigned int</tt> value distributed according to \p discrete_distribution
+ */
+FQUALIFIERS
+unsigned int rocrand_discrete(rocrand_state_threefry4x64_20 * state, const rocrand_discrete_distribution discrete_distribution)
+{
+    return rocrand_device::detail::discrete_alias(rocrand(state), *discrete_distribution);
+}
+
+/**
+ * \brief Returns four discrete distributed <tt>unsigned int</tt> values.
+ *
+ * Returns four <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using Threefry4x64 generator in \p state, and increments
+ * the position of the generator by four.
+ *
+ * \param state - Pointer to a state to use
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return Four <tt>unsigned int</tt> values distributed according to \p discrete_distribution as \p uint4
+ */
+FQUALIFIERS
+uint4 rocrand_discrete4(rocrand_state_threefry4x64_20 * state, const rocrand_discrete_distribution discrete_distribution)
+{
+    const uint4 u4 = rocrand4(state);
+    return uint4 {
+        rocrand_device::detail::discrete_alias(u4.x, *discrete_distribution),
+        rocrand_device::detail::discrete_alias(u4.y, *discrete_distribution),
+        rocrand_device::detail::discrete_alias(u4.z, *discrete_distribution),
+        rocrand_device::detail::discrete_alias(u4.w, *discrete_distribution)
+    };
+}
+
 /**
  * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
  *
@@ -186,6 +398,62 @@ unsigned int rocrand_discrete(rocrand_state_xorwow * state, const rocrand_discre
     return rocrand_device::detail::discrete_alias(rocrand(state), *discrete_distribution);
 }
 
+/**
+ * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
+ *
+ * Returns a <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using compact XORWOW generator in \p state, and increments
+ * the position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return <tt>unsigned int</tt> value distributed according to \p discrete_distribution
+ */
+FQUALIFIERS
+unsigned int rocrand_discrete(rocrand_state_xorwow_compact * state, const rocrand_discrete_distribution discrete_distribution)
+{
+    return rocrand_device::detail::discrete_alias(rocrand(state), *discrete_distribution);
+}
+
+/**
+ * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
+ *
+ * Returns a <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using xoshiro128++
+ * generator in \p state, and increments
+ * the position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return <tt>unsigned int</tt> value distributed according to \p discrete_distribution
+ */
+FQUALIFIERS
+unsigned int rocrand_discrete(rocrand_state_xoshiro128pp * state, const rocrand_discrete_distribution discrete_distribution)
+{
+    return rocrand_device::detail::discrete_alias(rocrand(state), *discrete_distribution);
+}
+
+/**
+ * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
+ *
+ * Returns a <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using PCG32
+ * generator in \p state, and increments
+ * the position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return <tt>unsigned int</tt> value distributed according to \p discrete_distribution
+ */
+FQUALIFIERS
+unsigned int rocrand_discrete(rocrand_state_pcg32 * state, const rocrand_discrete_distribution discrete_distribution)
+{
+    return rocrand_device::detail::discrete_alias(rocrand(state), *discrete_distribution);
+}
+
 /**
  * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
  *
@@ -222,6 +490,78 @@ unsigned int rocrand_discrete(rocrand_state_sobol32 * state, const rocrand_discr
     return rocrand_device::detail::discrete_cdf(rocrand(state), *discrete_distribution);
 }
 
+/**
+ * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
+ *
+ * Returns a <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using SOBOL32 generator in block state \p state, and increments
+ * the position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return <tt>unsigned int</tt> value distributed according to \p discrete_distribution
+ */
+FQUALIFIERS
+unsigned int rocrand_discrete(rocrand_state_sobol32_block * state, const rocrand_discrete_distribution discrete_distribution)
+{
+    return rocrand_device::detail::discrete_cdf(rocrand(state), *discrete_distribution);
+}
+
+/**
+ * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
+ *
+ * Returns a <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using SCRAMBLED_SOBOL32 generator in \p state, and increments
+ * the position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return <tt>unsigned int</tt> value distributed according to \p discrete_distribution
+ */
+FQUALIFIERS
+unsigned int rocrand_discrete(rocrand_state_scrambled_sobol32 * state, const rocrand_discrete_distribution discrete_distribution)
+{
+    return rocrand_device::detail::discrete_cdf(rocrand(state), *discrete_distribution);
+}
+
+/**
+ * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
+ *
+ * Returns a <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using SOBOL64 generator in \p state, and increments
+ * the position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return <tt>unsigned int</tt> value distributed according to \p discrete_distribution
+ */
+FQUALIFIERS
+unsigned int rocrand_discrete(rocrand_state_sobol64 * state, const rocrand_discrete_distribution discrete_distribution)
+{
+    return rocrand_device::detail::discrete_cdf(static_cast<unsigned int>(rocrand(state) >> 32), *discrete_distribution);
+}
+
+/**
+ * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
+ *
+ * Returns a <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using SCRAMBLED_SOBOL64 generator in \p state, and increments
+ * the position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ * \param discrete_distribution - Related discrete distribution
+ *
+ * \return <tt>unsigned int</tt> value distributed according to \p discrete_distribution
+ */
+FQUALIFIERS
+unsigned int rocrand_discrete(rocrand_state_scrambled_sobol64 * state, const rocrand_discrete_distribution discrete_distribution)
+{
+    return rocrand_device::detail::discrete_cdf(static_cast<unsigned int>(rocrand(state) >> 32), *discrete_distribution);
+}
+
 #endif // ROCRAND_DISCRETE_H_
 
 /** @} */ // end of group rocranddevice
@@ -32,6 +32,21 @@ struct rocrand_discrete_distribution_st
 
     // Cumulative distribution function
     double * cdf;
+
+    // Members below are appended after the original ones, so code built
+    // against older headers reads the same layout of the fields above
+
+    // Packed alias table: alias (high 32 bits) and probability
+    // (0.32 fixed point, low 32 bits) of each value, so sampling does
+    // only one 8-byte load (NULL: alias and probability are used)
+    unsigned long long * alias_table;
+
+    // Guide table of CDF: guide[j] (j in [0, 2^guide_bits]) is the first
+    // index with cdf[index] >= j / 2^guide_bits (or size - 1), so the search
+    // for x starts in [guide[j], guide[j + 1]] with j = floor(x * 2^guide_bits)
+    // (NULL: the whole CDF is searched)
+    unsigned int * guide;
+    unsigned int guide_bits;
 };
 
 typedef struct rocrand_discrete_distribution_st * rocrand_discrete_distribution;
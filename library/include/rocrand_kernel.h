@@ -27,15 +27,28 @@
 
 #include "rocrand_common.h"
 #include "rocrand_philox4x32_10.h"
+#include "rocrand_philox4x32_7.h"
+#include "rocrand_philox4x64_10.h"
+#include "rocrand_threefry2x64_20.h"
+#include "rocrand_threefry4x64_20.h"
 #include "rocrand_mrg32k3a.h"
 #include "rocrand_xorwow.h"
+#include "rocrand_xoshiro128pp.h"
+#include "rocrand_pcg32.h"
 #include "rocrand_sobol32.h"
+#include "rocrand_scrambled_sobol32.h"
+#include "rocrand_sobol64.h"
+#include "rocrand_scrambled_sobol64.h"
 #include "rocrand_mtgp32.h"
 
 #include "rocrand_uniform.h"
 #include "rocrand_normal.h"
 #include "rocrand_log_normal.h"
 #include "rocrand_poisson.h"
+#include "rocrand_binomial.h"
+#include "rocrand_unit_vector.h"
 #include "rocrand_discrete.h"
+#include "rocrand_block.h"
+#include "rocrand_matrix.h"
 
 #endif // ROCRAND_KERNEL_H_
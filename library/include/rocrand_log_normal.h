@@ -33,9 +33,18 @@
 #include <math.h>
 
 #include "rocrand_philox4x32_10.h"
+#include "rocrand_philox4x32_7.h"
+#include "rocrand_philox4x64_10.h"
+#include "rocrand_threefry2x64_20.h"
+#include "rocrand_threefry4x64_20.h"
 #include "rocrand_mrg32k3a.h"
 #include "rocrand_xorwow.h"
+#include "rocrand_xoshiro128pp.h"
+#include "rocrand_pcg32.h"
 #include "rocrand_sobol32.h"
+#include "rocrand_scrambled_sobol32.h"
+#include "rocrand_sobol64.h"
+#include "rocrand_scrambled_sobol64.h"
 #include "rocrand_mtgp32.h"
 
 #include "rocrand_normal.h"
@@ -63,11 +72,42 @@ float rocrand_log_normal(rocrand_state_philox4x32_10 * state, float mean, float
 
     if(bm_helper::has_float(state))
     {
-        return expf(mean + (stddev * bm_helper::get_float(state)));
+        return rocrand_device::detail::normal_expf(mean + (stddev * bm_helper::get_float(state)));
     }
     float2 r = rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
     bm_helper::save_float(state, r.y);
-    return expf(mean + (stddev * r.x));
+    return rocrand_device::detail::normal_expf(mean + (stddev * r.x));
+}
+#endif // ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns a log-normally distributed \p float value.
+ *
+ * Generates and returns a log-normally distributed \p float value using Philox4x32-7
+ * generator in \p state, and increments position of the generator by one.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, returns first of them, and saves
+ * the second to be returned on the next call.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p float value
+ */
+#ifndef ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
+FQUALIFIERS
+float rocrand_log_normal(rocrand_state_philox4x32_7 * state, float mean, float stddev)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_philox4x32_7> bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return rocrand_device::detail::normal_expf(mean + (stddev * bm_helper::get_float(state)));
+    }
+    float2 r = rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+    bm_helper::save_float(state, r.y);
+    return rocrand_device::detail::normal_expf(mean + (stddev * r.x));
 }
 #endif // ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
 
@@ -90,8 +130,32 @@ float2 rocrand_log_normal2(rocrand_state_philox4x32_10 * state, float mean, floa
 {
     float2 r = rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
     return float2 {
-        expf(mean + (stddev * r.x)),
-        expf(mean + (stddev * r.y))
+        rocrand_device::detail::normal_expf(mean + (stddev * r.x)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.y))
+    };
+}
+
+/**
+ * \brief Returns two log-normally distributed \p float values.
+ *
+ * Generates and returns two log-normally distributed \p float values using Philox4x32-7
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p float value as \p float2
+ */
+FQUALIFIERS
+float2 rocrand_log_normal2(rocrand_state_philox4x32_7 * state, float mean, float stddev)
+{
+    float2 r = rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+    return float2 {
+        rocrand_device::detail::normal_expf(mean + (stddev * r.x)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.y))
     };
 }
 
@@ -114,10 +178,36 @@ float4 rocrand_log_normal4(rocrand_state_philox4x32_10 * state, float mean, floa
 {
     float4 r = rocrand_device::detail::normal_distribution4(rocrand4(state));
     return float4 {
-        expf(mean + (stddev * r.x)),
-        expf(mean + (stddev * r.y)),
-        expf(mean + (stddev * r.z)),
-        expf(mean + (stddev * r.w))
+        rocrand_device::detail::normal_expf(mean + (stddev * r.x)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.y)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.z)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.w))
+    };
+}
+
+/**
+ * \brief Returns four log-normally distributed \p float values.
+ *
+ * Generates and returns four log-normally distributed \p float values using Philox4x32-7
+ * generator in \p state, and increments position of the generator by four.
+ * The function uses the Box-Muller transform method to generate four normally distributed
+ * values, transforms them to log-normally distributed values, and returns them.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Four log-normally distributed \p float value as \p float4
+ */
+FQUALIFIERS
+float4 rocrand_log_normal4(rocrand_state_philox4x32_7 * state, float mean, float stddev)
+{
+    float4 r = rocrand_device::detail::normal_distribution4(rocrand4(state));
+    return float4 {
+        rocrand_device::detail::normal_expf(mean + (stddev * r.x)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.y)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.z)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.w))
     };
 }
 
@@ -152,6 +242,37 @@ double rocrand_log_normal_double(rocrand_state_philox4x32_10 * state, double mea
 }
 #endif // ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
 
+/**
+ * \brief Returns a log-normally distributed \p double values.
+ *
+ * Generates and returns a log-normally distributed \p double value using Philox4x32-7
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * \p double values, transforms them to log-normally distributed \p double values, returns
+ * first of them, and saves the second to be returned on the next call.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p double value
+ */
+#ifndef ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
+FQUALIFIERS
+double rocrand_log_normal_double(rocrand_state_philox4x32_7 * state, double mean, double stddev)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_philox4x32_7> bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return exp(mean + (stddev * bm_helper::get_double(state)));
+    }
+    double2 r = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+    bm_helper::save_double(state, r.y);
+    return exp(mean + r.x * stddev);
+}
+#endif // ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
+
 /**
  * \brief Returns two log-normally distributed \p double values.
  *
@@ -176,6 +297,30 @@ double2 rocrand_log_normal_double2(rocrand_state_philox4x32_10 * state, double m
     };
 }
 
+/**
+ * \brief Returns two log-normally distributed \p double values.
+ *
+ * Generates and returns two log-normally distributed \p double values using Philox4x32-7
+ * generator in \p state, and increments position of the generator by four.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p double values as \p double2
+ */
+FQUALIFIERS
+double2 rocrand_log_normal_double2(rocrand_state_philox4x32_7 * state, double mean, double stddev)
+{
+    double2 r = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+    return double2 {
+        exp(mean + (stddev * r.x)),
+        exp(mean + (stddev * r.y))
+    };
+}
+
 /**
  * \brief Returns four log-normally distributed \p double values.
  *
@@ -201,14 +346,39 @@ double4 rocrand_log_normal_double4(rocrand_state_philox4x32_10 * state, double m
     };
 }
 
+/**
+ * \brief Returns four log-normally distributed \p double values.
+ *
+ * Generates and returns four log-normally distributed \p double values using Philox4x32-7
+ * generator in \p state, and increments position of the generator by eight.
+ * The function uses the Box-Muller transform method to generate four normally distributed
+ * values, transforms them to log-normally distributed values, and returns them.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Four log-normally distributed \p double values as \p double4
+ */
+FQUALIFIERS
+double4 rocrand_log_normal_double4(rocrand_state_philox4x32_7 * state, double mean, double stddev)
+{
+    double2 r1, r2;
+    r1 = rocrand_log_normal_double2(state, mean, stddev);
+    r2 = rocrand_log_normal_double2(state, mean, stddev);
+    return double4 {
+        r1.x, r1.y, r2.x, r2.y
+    };
+}
+
 /**
  * \brief Returns a log-normally distributed \p float value.
  *
- * Generates and returns a log-normally distributed \p float value using MRG32k3a
+ * Generates and returns a log-normally distributed \p float value using Philox4x64
  * generator in \p state, and increments position of the generator by one.
  * The function uses the Box-Muller transform method to generate two normally distributed
- * values, transforms them to log-normally distributed values, returns first of them,
- * and saves the second to be returned on the next call.
+ * values, transforms them to log-normally distributed values, returns first of them, and saves
+ * the second to be returned on the next call.
  *
  * \param state  - Pointer to a state to use
  * \param mean   - Mean of the related log-normal distribution
@@ -216,26 +386,26 @@ double4 rocrand_log_normal_double4(rocrand_state_philox4x32_10 * state, double m
  *
  * \return Log-normally distributed \p float value
  */
-#ifndef ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
+#ifndef ROCRAND_DETAIL_PHILOX4X64_BM_NOT_IN_STATE
 FQUALIFIERS
-float rocrand_log_normal(rocrand_state_mrg32k3a * state, float mean, float stddev)
+float rocrand_log_normal(rocrand_state_philox4x64_10 * state, float mean, float stddev)
 {
-    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_mrg32k3a> bm_helper;
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_philox4x64_10> bm_helper;
 
     if(bm_helper::has_float(state))
     {
-        return expf(mean + (stddev * bm_helper::get_float(state)));
+        return rocrand_device::detail::normal_expf(mean + (stddev * bm_helper::get_float(state)));
     }
-    float2 r = rocrand_device::detail::mrg_normal_distribution2(rocrand(state), rocrand(state));
+    float2 r = rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
     bm_helper::save_float(state, r.y);
-    return expf(mean + (stddev * r.x));
+    return rocrand_device::detail::normal_expf(mean + (stddev * r.x));
 }
-#endif // ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
+#endif // ROCRAND_DETAIL_PHILOX4X64_BM_NOT_IN_STATE
 
 /**
  * \brief Returns two log-normally distributed \p float values.
  *
- * Generates and returns two log-normally distributed \p float values using MRG32k3a
+ * Generates and returns two log-normally distributed \p float values using Philox4x64
  * generator in \p state, and increments position of the generator by two.
  * The function uses the Box-Muller transform method to generate two normally distributed
  * values, transforms them to log-normally distributed values, and returns both.
@@ -247,20 +417,46 @@ float rocrand_log_normal(rocrand_state_mrg32k3a * state, float mean, float stdde
  * \return Two log-normally distributed \p float value as \p float2
  */
 FQUALIFIERS
-float2 rocrand_log_normal2(rocrand_state_mrg32k3a * state, float mean, float stddev)
+float2 rocrand_log_normal2(rocrand_state_philox4x64_10 * state, float mean, float stddev)
 {
-    float2 r = rocrand_device::detail::mrg_normal_distribution2(rocrand(state), rocrand(state));
+    float2 r = rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
     return float2 {
-        expf(mean + (stddev * r.x)),
-        expf(mean + (stddev * r.y))
+        rocrand_device::detail::normal_expf(mean + (stddev * r.x)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.y))
     };
 }
 
 /**
- * \brief Returns a log-normally distributed \p double value.
+ * \brief Returns four log-normally distributed \p float values.
  *
- * Generates and returns a log-normally distributed \p double value using MRG32k3a
- * generator in \p state, and increments position of the generator by one.
+ * Generates and returns four log-normally distributed \p float values using Philox4x64
+ * generator in \p state, and increments position of the generator by four.
+ * The function uses the Box-Muller transform method to generate four normally distributed
+ * values, transforms them to log-normally distributed values, and returns them.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Four log-normally distributed \p float value as \p float4
+ */
+FQUALIFIERS
+float4 rocrand_log_normal4(rocrand_state_philox4x64_10 * state, float mean, float stddev)
+{
+    float4 r = rocrand_device::detail::normal_distribution4(rocrand4(state));
+    return float4 {
+        rocrand_device::detail::normal_expf(mean + (stddev * r.x)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.y)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.z)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.w))
+    };
+}
+
+/**
+ * \brief Returns a log-normally distributed \p double values.
+ *
+ * Generates and returns a log-normally distributed \p double value using Philox4x64
+ * generator in \p state, and increments position of the generator by two.
  * The function uses the Box-Muller transform method to generate two normally distributed
  * \p double values, transforms them to log-normally distributed \p double values, returns
  * first of them, and saves the second to be returned on the next call.
@@ -271,27 +467,27 @@ float2 rocrand_log_normal2(rocrand_state_mrg32k3a * state, float mean, float std
  *
  * \return Log-normally distributed \p double value
  */
-#ifndef ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
+#ifndef ROCRAND_DETAIL_PHILOX4X64_BM_NOT_IN_STATE
 FQUALIFIERS
-double rocrand_log_normal_double(rocrand_state_mrg32k3a * state, double mean, double stddev)
+double rocrand_log_normal_double(rocrand_state_philox4x64_10 * state, double mean, double stddev)
 {
-    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_mrg32k3a> bm_helper;
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_philox4x64_10> bm_helper;
 
     if(bm_helper::has_double(state))
     {
         return exp(mean + (stddev * bm_helper::get_double(state)));
     }
-    double2 r = rocrand_device::detail::mrg_normal_distribution_double2(rocrand(state), rocrand(state));
+    double2 r = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
     bm_helper::save_double(state, r.y);
     return exp(mean + r.x * stddev);
 }
-#endif // ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
+#endif // ROCRAND_DETAIL_PHILOX4X64_BM_NOT_IN_STATE
 
 /**
  * \brief Returns two log-normally distributed \p double values.
  *
- * Generates and returns two log-normally distributed \p double values using MRG32k3a
- * generator in \p state, and increments position of the generator by two.
+ * Generates and returns two log-normally distributed \p double values using Philox4x64
+ * generator in \p state, and increments position of the generator by four.
  * The function uses the Box-Muller transform method to generate two normally distributed
  * values, transforms them to log-normally distributed values, and returns both.
  *
@@ -302,23 +498,48 @@ double rocrand_log_normal_double(rocrand_state_mrg32k3a * state, double mean, do
  * \return Two log-normally distributed \p double values as \p double2
  */
 FQUALIFIERS
-double2 rocrand_log_normal_double2(rocrand_state_mrg32k3a * state, double mean, double stddev)
+double2 rocrand_log_normal_double2(rocrand_state_philox4x64_10 * state, double mean, double stddev)
 {
-    double2 r = rocrand_device::detail::mrg_normal_distribution_double2(rocrand(state), rocrand(state));
+    double2 r = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
     return double2 {
         exp(mean + (stddev * r.x)),
         exp(mean + (stddev * r.y))
     };
 }
 
+/**
+ * \brief Returns four log-normally distributed \p double values.
+ *
+ * Generates and returns four log-normally distributed \p double values using Philox4x64
+ * generator in \p state, and increments position of the generator by eight.
+ * The function uses the Box-Muller transform method to generate four normally distributed
+ * values, transforms them to log-normally distributed values, and returns them.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Four log-normally distributed \p double values as \p double4
+ */
+FQUALIFIERS
+double4 rocrand_log_normal_double4(rocrand_state_philox4x64_10 * state, double mean, double stddev)
+{
+    double2 r1, r2;
+    r1 = rocrand_log_normal_double2(state, mean, stddev);
+    r2 = rocrand_log_normal_double2(state, mean, stddev);
+    return double4 {
+        r1.x, r1.y, r2.x, r2.y
+    };
+}
+
 /**
  * \brief Returns a log-normally distributed \p float value.
  *
- * Generates and returns a log-normally distributed \p float value using XORWOW
+ * Generates and returns a log-normally distributed \p float value using Threefry2x64
  * generator in \p state, and increments position of the generator by one.
  * The function uses the Box-Muller transform method to generate two normally distributed
- * values, transforms them to log-normally distributed values, returns first of them,
- * and saves the second to be returned on the next call.
+ * values, transforms them to log-normally distributed values, returns first of them, and saves
+ * the second to be returned on the next call.
  *
  * \param state  - Pointer to a state to use
  * \param mean   - Mean of the related log-normal distribution
@@ -326,26 +547,26 @@ double2 rocrand_log_normal_double2(rocrand_state_mrg32k3a * state, double mean,
  *
  * \return Log-normally distributed \p float value
  */
-#ifndef ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+#ifndef ROCRAND_DETAIL_THREEFRY2X64_BM_NOT_IN_STATE
 FQUALIFIERS
-float rocrand_log_normal(rocrand_state_xorwow * state, float mean, float stddev)
+float rocrand_log_normal(rocrand_state_threefry2x64_20 * state, float mean, float stddev)
 {
-    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_xorwow> bm_helper;
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry2x64_20> bm_helper;
 
     if(bm_helper::has_float(state))
     {
-        return expf(mean + (stddev * bm_helper::get_float(state)));
+        return rocrand_device::detail::normal_expf(mean + (stddev * bm_helper::get_float(state)));
     }
     float2 r = rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
     bm_helper::save_float(state, r.y);
-    return expf(mean + (stddev * r.x));
+    return rocrand_device::detail::normal_expf(mean + (stddev * r.x));
 }
-#endif // ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+#endif // ROCRAND_DETAIL_THREEFRY2X64_BM_NOT_IN_STATE
 
 /**
  * \brief Returns two log-normally distributed \p float values.
  *
- * Generates and returns two log-normally distributed \p float values using XORWOW
+ * Generates and returns two log-normally distributed \p float values using Threefry2x64
  * generator in \p state, and increments position of the generator by two.
  * The function uses the Box-Muller transform method to generate two normally distributed
  * values, transforms them to log-normally distributed values, and returns both.
@@ -357,19 +578,45 @@ float rocrand_log_normal(rocrand_state_xorwow * state, float mean, float stddev)
  * \return Two log-normally distributed \p float value as \p float2
  */
 FQUALIFIERS
-float2 rocrand_log_normal2(rocrand_state_xorwow * state, float mean, float stddev)
+float2 rocrand_log_normal2(rocrand_state_threefry2x64_20 * state, float mean, float stddev)
 {
     float2 r = rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
     return float2 {
-        expf(mean + (stddev * r.x)),
-        expf(mean + (stddev * r.y))
+        rocrand_device::detail::normal_expf(mean + (stddev * r.x)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.y))
     };
 }
 
 /**
- * \brief Returns a log-normally distributed \p double value.
+ * \brief Returns four log-normally distributed \p float values.
  *
- * Generates and returns a log-normally distributed \p double value using XORWOW
+ * Generates and returns four log-normally distributed \p float values using Threefry2x64
+ * generator in \p state, and increments position of the generator by four.
+ * The function uses the Box-Muller transform method to generate four normally distributed
+ * values, transforms them to log-normally distributed values, and returns them.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Four log-normally distributed \p float value as \p float4
+ */
+FQUALIFIERS
+float4 rocrand_log_normal4(rocrand_state_threefry2x64_20 * state, float mean, float stddev)
+{
+    float4 r = rocrand_device::detail::normal_distribution4(rocrand4(state));
+    return float4 {
+        rocrand_device::detail::normal_expf(mean + (stddev * r.x)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.y)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.z)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.w))
+    };
+}
+
+/**
+ * \brief Returns a log-normally distributed \p double values.
+ *
+ * Generates and returns a log-normally distributed \p double value using Threefry2x64
  * generator in \p state, and increments position of the generator by two.
  * The function uses the Box-Muller transform method to generate two normally distributed
  * \p double values, transforms them to log-normally distributed \p double values, returns
@@ -381,31 +628,581 @@ float2 rocrand_log_normal2(rocrand_state_xorwow * state, float mean, float stdde
  *
  * \return Log-normally distributed \p double value
  */
-#ifndef ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+#ifndef ROCRAND_DETAIL_THREEFRY2X64_BM_NOT_IN_STATE
 FQUALIFIERS
-double rocrand_log_normal_double(rocrand_state_xorwow * state, double mean, double stddev)
+double rocrand_log_normal_double(rocrand_state_threefry2x64_20 * state, double mean, double stddev)
 {
-    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_xorwow> bm_helper;
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry2x64_20> bm_helper;
 
     if(bm_helper::has_double(state))
     {
         return exp(mean + (stddev * bm_helper::get_double(state)));
     }
-    double2 r = rocrand_device::detail::normal_distribution_double2(
-        uint4 { rocrand(state), rocrand(state), rocrand(state), rocrand(state) }
-    );
+    double2 r = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
     bm_helper::save_double(state, r.y);
-    return exp(mean + (stddev * r.x));
+    return exp(mean + r.x * stddev);
+}
+#endif // ROCRAND_DETAIL_THREEFRY2X64_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two log-normally distributed \p double values.
+ *
+ * Generates and returns two log-normally distributed \p double values using Threefry2x64
+ * generator in \p state, and increments position of the generator by four.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p double values as \p double2
+ */
+FQUALIFIERS
+double2 rocrand_log_normal_double2(rocrand_state_threefry2x64_20 * state, double mean, double stddev)
+{
+    double2 r = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+    return double2 {
+        exp(mean + (stddev * r.x)),
+        exp(mean + (stddev * r.y))
+    };
+}
+
+/**
+ * \brief Returns four log-normally distributed \p double values.
+ *
+ * Generates and returns four log-normally distributed \p double values using Threefry2x64
+ * generator in \p state, and increments position of the generator by eight.
+ * The function uses the Box-Muller transform method to generate four normally distributed
+ * values, transforms them to log-normally distributed values, and returns them.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Four log-normally distributed \p double values as \p double4
+ */
+FQUALIFIERS
+double4 rocrand_log_normal_double4(rocrand_state_threefry2x64_20 * state, double mean, double stddev)
+{
+    double2 r1, r2;
+    r1 = rocrand_log_normal_double2(state, mean, stddev);
+    r2 = rocrand_log_normal_double2(state, mean, stddev);
+    return double4 {
+        r1.x, r1.y, r2.x, r2.y
+    };
+}
+
+/**
+ * \brief Returns a log-normally distributed \p float value.
+ *
+ * Generates and returns a log-normally distributed \p float value using Threefry4x64
+ * generator in \p state, and increments position of the generator by one.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, returns first of them, and saves
+ * the second to be returned on the next call.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p float value
+ */
+#ifndef ROCRAND_DETAIL_THREEFRY4X64_BM_NOT_IN_STATE
+FQUALIFIERS
+float rocrand_log_normal(rocrand_state_threefry4x64_20 * state, float mean, float stddev)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry4x64_20> bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return rocrand_device::detail::normal_expf(mean + (stddev * bm_helper::get_float(state)));
+    }
+    float2 r = rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+    bm_helper::save_float(state, r.y);
+    return rocrand_device::detail::normal_expf(mean + (stddev * r.x));
+}
+#endif // ROCRAND_DETAIL_THREEFRY4X64_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two log-normally distributed \p float values.
+ *
+ * Generates and returns two log-normally distributed \p float values using Threefry4x64
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p float value as \p float2
+ */
+FQUALIFIERS
+float2 rocrand_log_normal2(rocrand_state_threefry4x64_20 * state, float mean, float stddev)
+{
+    float2 r = rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+    return float2 {
+        rocrand_device::detail::normal_expf(mean + (stddev * r.x)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.y))
+    };
+}
+
+/**
+ * \brief Returns four log-normally distributed \p float values.
+ *
+ * Generates and returns four log-normally distributed \p float values using Threefry4x64
+ * generator in \p state, and increments position of the generator by four.
+ * The function uses the Box-Muller transform method to generate four normally distributed
+ * values, transforms them to log-normally distributed values, and returns them.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Four log-normally distributed \p float value as \p float4
+ */
+FQUALIFIERS
+float4 rocrand_log_normal4(rocrand_state_threefry4x64_20 * state, float mean, float stddev)
+{
+    float4 r = rocrand_device::detail::normal_distribution4(rocrand4(state));
+    return float4 {
+        rocrand_device::detail::normal_expf(mean + (stddev * r.x)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.y)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.z)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.w))
+    };
+}
+
+/**
+ * \brief Returns a log-normally distributed \p double values.
+ *
+ * Generates and returns a log-normally distributed \p double value using Threefry4x64
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * \p double values, transforms them to log-normally distributed \p double values, returns
+ * first of them, and saves the second to be returned on the next call.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p double value
+ */
+#ifndef ROCRAND_DETAIL_THREEFRY4X64_BM_NOT_IN_STATE
+FQUALIFIERS
+double rocrand_log_normal_double(rocrand_state_threefry4x64_20 * state, double mean, double stddev)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry4x64_20> bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return exp(mean + (stddev * bm_helper::get_double(state)));
+    }
+    double2 r = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+    bm_helper::save_double(state, r.y);
+    return exp(mean + r.x * stddev);
+}
+#endif // ROCRAND_DETAIL_THREEFRY4X64_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two log-normally distributed \p double values.
+ *
+ * Generates and returns two log-normally distributed \p double values using Threefry4x64
+ * generator in \p state, and increments position of the generator by four.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p double values as \p double2
+ */
+FQUALIFIERS
+double2 rocrand_log_normal_double2(rocrand_state_threefry4x64_20 * state, double mean, double stddev)
+{
+    double2 r = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+    return double2 {
+        exp(mean + (stddev * r.x)),
+        exp(mean + (stddev * r.y))
+    };
+}
+
+/**
+ * \brief Returns four log-normally distributed \p double values.
+ *
+ * Generates and returns four log-normally distributed \p double values using Threefry4x64
+ * generator in \p state, and increments position of the generator by eight.
+ * The function uses the Box-Muller transform method to generate four normally distributed
+ * values, transforms them to log-normally distributed values, and returns them.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Four log-normally distributed \p double values as \p double4
+ */
+FQUALIFIERS
+double4 rocrand_log_normal_double4(rocrand_state_threefry4x64_20 * state, double mean, double stddev)
+{
+    double2 r1, r2;
+    r1 = rocrand_log_normal_double2(state, mean, stddev);
+    r2 = rocrand_log_normal_double2(state, mean, stddev);
+    return double4 {
+        r1.x, r1.y, r2.x, r2.y
+    };
+}
+
+/**
+ * \brief Returns a log-normally distributed \p float value.
+ *
+ * Generates and returns a log-normally distributed \p float value using MRG32k3a
+ * generator in \p state, and increments position of the generator by one.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, returns first of them,
+ * and saves the second to be returned on the next call.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p float value
+ */
+#ifndef ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
+FQUALIFIERS
+float rocrand_log_normal(rocrand_state_mrg32k3a * state, float mean, float stddev)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_mrg32k3a> bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return rocrand_device::detail::normal_expf(mean + (stddev * bm_helper::get_float(state)));
+    }
+    float2 r = rocrand_device::detail::mrg_normal_distribution2(rocrand(state), rocrand(state));
+    bm_helper::save_float(state, r.y);
+    return rocrand_device::detail::normal_expf(mean + (stddev * r.x));
+}
+#endif // ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two log-normally distributed \p float values.
+ *
+ * Generates and returns two log-normally distributed \p float values using MRG32k3a
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p float value as \p float2
+ */
+FQUALIFIERS
+float2 rocrand_log_normal2(rocrand_state_mrg32k3a * state, float mean, float stddev)
+{
+    float2 r = rocrand_device::detail::mrg_normal_distribution2(rocrand(state), rocrand(state));
+    return float2 {
+        rocrand_device::detail::normal_expf(mean + (stddev * r.x)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.y))
+    };
+}
+
+/**
+ * \brief Returns four log-normally distributed \p float values.
+ *
+ * Generates and returns four log-normally distributed \p float values using MRG32k3a
+ * generator in \p state, and increments position of the generator by four.
+ * The function generates four normally distributed values with rocrand_normal4(),
+ * transforms them to log-normally distributed values, and returns them.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Four log-normally distributed \p float value as \p float4
+ */
+FQUALIFIERS
+float4 rocrand_log_normal4(rocrand_state_mrg32k3a * state, float mean, float stddev)
+{
+    float4 r = rocrand_normal4(state);
+    return float4 {
+        rocrand_device::detail::normal_expf(mean + (stddev * r.x)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.y)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.z)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.w))
+    };
+}
+
+/**
+ * \brief Returns a log-normally distributed \p double value.
+ *
+ * Generates and returns a log-normally distributed \p double value using MRG32k3a
+ * generator in \p state, and increments position of the generator by one.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * \p double values, transforms them to log-normally distributed \p double values, returns
+ * first of them, and saves the second to be returned on the next call.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p double value
+ */
+#ifndef ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
+FQUALIFIERS
+double rocrand_log_normal_double(rocrand_state_mrg32k3a * state, double mean, double stddev)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_mrg32k3a> bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return exp(mean + (stddev * bm_helper::get_double(state)));
+    }
+    double2 r = rocrand_device::detail::mrg_normal_distribution_double2(rocrand(state), rocrand(state));
+    bm_helper::save_double(state, r.y);
+    return exp(mean + r.x * stddev);
+}
+#endif // ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two log-normally distributed \p double values.
+ *
+ * Generates and returns two log-normally distributed \p double values using MRG32k3a
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p double values as \p double2
+ */
+FQUALIFIERS
+double2 rocrand_log_normal_double2(rocrand_state_mrg32k3a * state, double mean, double stddev)
+{
+    double2 r = rocrand_device::detail::mrg_normal_distribution_double2(rocrand(state), rocrand(state));
+    return double2 {
+        exp(mean + (stddev * r.x)),
+        exp(mean + (stddev * r.y))
+    };
+}
+
+/**
+ * \brief Returns a log-normally distributed \p float value.
+ *
+ * Generates and returns a log-normally distributed \p float value using XORWOW
+ * generator in \p state, and increments position of the generator by one.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, returns first of them,
+ * and saves the second to be returned on the next call.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p float value
+ */
+#ifndef ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+FQUALIFIERS
+float rocrand_log_normal(rocrand_state_xorwow * state, float mean, float stddev)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_xorwow> bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return rocrand_device::detail::normal_expf(mean + (stddev * bm_helper::get_float(state)));
+    }
+    float2 r = rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+    bm_helper::save_float(state, r.y);
+    return rocrand_device::detail::normal_expf(mean + (stddev * r.x));
+}
+#endif // ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two log-normally distributed \p float values.
+ *
+ * Generates and returns two log-normally distributed \p float values using XORWOW
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p float value as \p float2
+ */
+FQUALIFIERS
+float2 rocrand_log_normal2(rocrand_state_xorwow * state, float mean, float stddev)
+{
+    float2 r = rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+    return float2 {
+        rocrand_device::detail::normal_expf(mean + (stddev * r.x)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.y))
+    };
+}
+
+/**
+ * \brief Returns four log-normally distributed \p float values.
+ *
+ * Generates and returns four log-normally distributed \p float values using XORWOW
+ * generator in \p state, and increments position of the generator by four.
+ * The function generates four normally distributed values with rocrand_normal4(),
+ * transforms them to log-normally distributed values, and returns them.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Four log-normally distributed \p float value as \p float4
+ */
+FQUALIFIERS
+float4 rocrand_log_normal4(rocrand_state_xorwow * state, float mean, float stddev)
+{
+    float4 r = rocrand_normal4(state);
+    return float4 {
+        rocrand_device::detail::normal_expf(mean + (stddev * r.x)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.y)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.z)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.w))
+    };
+}
+
+/**
+ * \brief Returns a log-normally distributed \p double value.
+ *
+ * Generates and returns a log-normally distributed \p double value using XORWOW
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * \p double values, transforms them to log-normally distributed \p double values, returns
+ * first of them, and saves the second to be returned on the next call.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p double value
+ */
+#ifndef ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+FQUALIFIERS
+double rocrand_log_normal_double(rocrand_state_xorwow * state, double mean, double stddev)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_xorwow> bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return exp(mean + (stddev * bm_helper::get_double(state)));
+    }
+    double2 r = rocrand_device::detail::normal_distribution_double2(
+        uint4 { rocrand(state), rocrand(state), rocrand(state), rocrand(state) }
+    );
+    bm_helper::save_double(state, r.y);
+    return exp(mean + (stddev * r.x));
+}
+#endif // ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two log-normally distributed \p double values.
+ *
+ * Generates and returns two log-normally distributed \p double values using XORWOW
+ * generator in \p state, and increments position of the generator by four.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p double values as \p double2
+ */
+FQUALIFIERS
+double2 rocrand_log_normal_double2(rocrand_state_xorwow * state, double mean, double stddev)
+{
+    double2 r = rocrand_device::detail::normal_distribution_double2(
+        uint4 { rocrand(state), rocrand(state), rocrand(state), rocrand(state) }
+    );
+    return double2 {
+        exp(mean + (stddev * r.x)),
+        exp(mean + (stddev * r.y))
+    };
+}
+
+/**
+ * \brief Returns two log-normally distributed \p float values.
+ *
+ * Generates and returns two log-normally distributed \p float values using compact
+ * XORWOW generator in \p state, and increments position of the generator by two.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p float value as \p float2
+ */
+FQUALIFIERS
+float2 rocrand_log_normal2(rocrand_state_xorwow_compact * state, float mean, float stddev)
+{
+    float2 r = rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+    return float2 {
+        rocrand_device::detail::normal_expf(mean + (stddev * r.x)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.y))
+    };
 }
-#endif // ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
 
 /**
  * \brief Returns two log-normally distributed \p double values.
  *
- * Generates and returns two log-normally distributed \p double values using XORWOW
+ * Generates and returns two log-normally distributed \p double values using compact
+ * XORWOW generator in \p state, and increments position of the generator by four.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p double values as \p double2
+ */
+FQUALIFIERS
+double2 rocrand_log_normal_double2(rocrand_state_xorwow_compact * state, double mean, double stddev)
+{
+    double2 r = rocrand_device::detail::normal_distribution_double2(
+        uint4 { rocrand(state), rocrand(state), rocrand(state), rocrand(state) }
+    );
+    return double2 {
+        exp(mean + (stddev * r.x)),
+        exp(mean + (stddev * r.y))
+    };
+}
+
+/**
+ * \brief Returns two log-normally distributed \p float values.
+ *
+ * Generates and returns two log-normally distributed \p float values using xoshiro128++
+ * generator in \p state, and increments position of the generator by two.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p float value as \p float2
+ */
+FQUALIFIERS
+float2 rocrand_log_normal2(rocrand_state_xoshiro128pp * state, float mean, float stddev)
+{
+    float2 r = rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+    return float2 {
+        rocrand_device::detail::normal_expf(mean + (stddev * r.x)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.y))
+    };
+}
+
+/**
+ * \brief Returns two log-normally distributed \p double values.
+ *
+ * Generates and returns two log-normally distributed \p double values using xoshiro128++
  * generator in \p state, and increments position of the generator by four.
- * The function uses the Box-Muller transform method to generate two normally distributed
- * values, transforms them to log-normally distributed values, and returns both.
  *
  * \param state  - Pointer to a state to use
  * \param mean   - Mean of the related log-normal distribution
@@ -414,7 +1211,53 @@ double rocrand_log_normal_double(rocrand_state_xorwow * state, double mean, doub
  * \return Two log-normally distributed \p double values as \p double2
  */
 FQUALIFIERS
-double2 rocrand_log_normal_double2(rocrand_state_xorwow * state, double mean, double stddev)
+double2 rocrand_log_normal_double2(rocrand_state_xoshiro128pp * state, double mean, double stddev)
+{
+    double2 r = rocrand_device::detail::normal_distribution_double2(
+        uint4 { rocrand(state), rocrand(state), rocrand(state), rocrand(state) }
+    );
+    return double2 {
+        exp(mean + (stddev * r.x)),
+        exp(mean + (stddev * r.y))
+    };
+}
+
+/**
+ * \brief Returns two log-normally distributed \p float values.
+ *
+ * Generates and returns two log-normally distributed \p float values using PCG32
+ * generator in \p state, and increments position of the generator by two.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p float value as \p float2
+ */
+FQUALIFIERS
+float2 rocrand_log_normal2(rocrand_state_pcg32 * state, float mean, float stddev)
+{
+    float2 r = rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+    return float2 {
+        rocrand_device::detail::normal_expf(mean + (stddev * r.x)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.y))
+    };
+}
+
+/**
+ * \brief Returns two log-normally distributed \p double values.
+ *
+ * Generates and returns two log-normally distributed \p double values using PCG32
+ * generator in \p state, and increments position of the generator by four.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p double values as \p double2
+ */
+FQUALIFIERS
+double2 rocrand_log_normal_double2(rocrand_state_pcg32 * state, double mean, double stddev)
 {
     double2 r = rocrand_device::detail::normal_distribution_double2(
         uint4 { rocrand(state), rocrand(state), rocrand(state), rocrand(state) }
@@ -441,7 +1284,34 @@ FQUALIFIERS
 float rocrand_log_normal(rocrand_state_mtgp32 * state, float mean, float stddev)
 {
     float r = rocrand_device::detail::normal_distribution(rocrand(state));
-    return expf(mean + (stddev * r));
+    return rocrand_device::detail::normal_expf(mean + (stddev * r));
+}
+
+/**
+ * \brief Returns four log-normally distributed \p float values.
+ *
+ * Generates and returns four log-normally distributed \p float values using MTGP32
+ * generator in \p state, and increments position of the generator by four.
+ * The function generates four normally distributed values with rocrand_normal4(),
+ * transforms them to log-normally distributed values, and returns them.
+ * The function must be called by all threads of the block.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Four log-normally distributed \p float value as \p float4
+ */
+FQUALIFIERS
+float4 rocrand_log_normal4(rocrand_state_mtgp32 * state, float mean, float stddev)
+{
+    float4 r = rocrand_normal4(state);
+    return float4 {
+        rocrand_device::detail::normal_expf(mean + (stddev * r.x)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.y)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.z)),
+        rocrand_device::detail::normal_expf(mean + (stddev * r.w))
+    };
 }
 
 /**
@@ -479,7 +1349,26 @@ FQUALIFIERS
 float rocrand_log_normal(rocrand_state_sobol32 * state, float mean, float stddev)
 {
     float r = rocrand_device::detail::normal_distribution(rocrand(state));
-    return expf(mean + (stddev * r));
+    return rocrand_device::detail::normal_expf(mean + (stddev * r));
+}
+
+/**
+ * \brief Returns a log-normally distributed \p float value.
+ *
+ * Generates and returns a log-normally distributed \p float value using SOBOL32
+ * generator in block state \p state, and increments position of the generator by one.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_log_normal(rocrand_state_sobol32_block * state, float mean, float stddev)
+{
+    float r = rocrand_device::detail::normal_distribution(rocrand(state));
+    return rocrand_device::detail::normal_expf(mean + (stddev * r));
 }
 
 /**
@@ -501,6 +1390,138 @@ double rocrand_log_normal_double(rocrand_state_sobol32 * state, double mean, dou
     return exp(mean + (stddev * r));
 }
 
+/**
+ * \brief Returns a log-normally distributed \p double value.
+ *
+ * Generates and returns a log-normally distributed \p double value using SOBOL32
+ * generator in block state \p state, and increments position of the generator by one.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_log_normal_double(rocrand_state_sobol32_block * state, double mean, double stddev)
+{
+    double r = rocrand_device::detail::normal_distribution_double(rocrand(state));
+    return exp(mean + (stddev * r));
+}
+
+/**
+ * \brief Returns a log-normally distributed \p float value.
+ *
+ * Generates and returns a log-normally distributed \p float value using SCRAMBLED_SOBOL32
+ * generator in \p state, and increments position of the generator by one.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_log_normal(rocrand_state_scrambled_sobol32 * state, float mean, float stddev)
+{
+    float r = rocrand_device::detail::normal_distribution(rocrand(state));
+    return rocrand_device::detail::normal_expf(mean + (stddev * r));
+}
+
+/**
+ * \brief Returns a log-normally distributed \p double value.
+ *
+ * Generates and returns a log-normally distributed \p double value using SCRAMBLED_SOBOL32
+ * generator in \p state, and increments position of the generator by one.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_log_normal_double(rocrand_state_scrambled_sobol32 * state, double mean, double stddev)
+{
+    double r = rocrand_device::detail::normal_distribution_double(rocrand(state));
+    return exp(mean + (stddev * r));
+}
+
+/**
+ * \brief Returns a log-normally distributed \p float value.
+ *
+ * Generates and returns a log-normally distributed \p float value using SOBOL64
+ * generator in \p state, and increments position of the generator by one.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_log_normal(rocrand_state_sobol64 * state, float mean, float stddev)
+{
+    float r = rocrand_device::detail::normal_distribution(static_cast<unsigned int>(rocrand(state) >> 32));
+    return rocrand_device::detail::normal_expf(mean + (stddev * r));
+}
+
+/**
+ * \brief Returns a log-normally distributed \p double value.
+ *
+ * Generates and returns a log-normally distributed \p double value using SOBOL64
+ * generator in \p state, and increments position of the generator by one.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_log_normal_double(rocrand_state_sobol64 * state, double mean, double stddev)
+{
+    double r = rocrand_device::detail::normal_distribution_double(rocrand(state));
+    return exp(mean + (stddev * r));
+}
+
+/**
+ * \brief Returns a log-normally distributed \p float value.
+ *
+ * Generates and returns a log-normally distributed \p float value using SCRAMBLED_SOBOL64
+ * generator in \p state, and increments position of the generator by one.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_log_normal(rocrand_state_scrambled_sobol64 * state, float mean, float stddev)
+{
+    float r = rocrand_device::detail::normal_distribution(static_cast<unsigned int>(rocrand(state) >> 32));
+    return rocrand_device::detail::normal_expf(mean + (stddev * r));
+}
+
+/**
+ * \brief Returns a log-normally distributed \p double value.
+ *
+ * Generates and returns a log-normally distributed \p double value using SCRAMBLED_SOBOL64
+ * generator in \p state, and increments position of the generator by one.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_log_normal_double(rocrand_state_scrambled_sobol64 * state, double mean, double stddev)
+{
+    double r = rocrand_device::detail::normal_distribution_double(rocrand(state));
+    return exp(mean + (stddev * r));
+}
 
 #endif // ROCRAND_LOG_NORMAL_H_
 
@@ -0,0 +1,344 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_MATRIX_H_
+#define ROCRAND_MATRIX_H_
+
+#ifndef FQUALIFIERS
+#define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS
+
+#include "rocrand_block.h"
+#include "rocrand_uniform.h"
+#include "rocrand_normal.h"
+
+namespace rocrand_device {
+namespace detail {
+
+// Rademacher values (-1 or 1) from the highest bits of 4 values
+FQUALIFIERS
+float4 rademacher_distribution4(uint4 v)
+{
+    return float4 {
+        (v.x >> 31) != 0 ? -1.0f : 1.0f,
+        (v.y >> 31) != 0 ? -1.0f : 1.0f,
+        (v.z >> 31) != 0 ? -1.0f : 1.0f,
+        (v.w >> 31) != 0 ? -1.0f : 1.0f
+    };
+}
+
+// Distributions of matrix entries: 4 float entries of 4 consecutive columns
+struct matrix_uniform_distribution
+{
+    FQUALIFIERS
+    float4 operator()(uint4 v) const
+    {
+        return uniform_distribution4(v);
+    }
+};
+
+struct matrix_normal_distribution
+{
+    FQUALIFIERS
+    float4 operator()(uint4 v) const
+    {
+        return normal_distribution4(v);
+    }
+};
+
+struct matrix_rademacher_distribution
+{
+    FQUALIFIERS
+    float4 operator()(uint4 v) const
+    {
+        return rademacher_distribution4(v);
+    }
+};
+
+FQUALIFIERS
+float vec_element(const float4 v, const unsigned int i)
+{
+    return i == 0 ? v.x : (i == 1 ? v.y : (i == 2 ? v.z : v.w));
+}
+
+// Entries of columns 4 * col4, ..., 4 * col4 + 3 of the row are values of
+// the Philox output of the counter { col4, row, matrix_id } and the seed
+FQUALIFIERS
+uint4 matrix_values(const uint2 key,
+                    const unsigned long long matrix_id,
+                    const unsigned int row,
+                    const unsigned int col4)
+{
+    const uint4 counter = {
+        col4,
+        row,
+        static_cast<unsigned int>(matrix_id),
+        static_cast<unsigned int>(matrix_id >> 32)
+    };
+    return philox4x32_10_block_rounds::generate(counter, key);
+}
+
+// Tile of Rows x Cols entries starting at (row, col), one Philox output is
+// computed for every 4 consecutive columns of a row
+template<unsigned int Rows, unsigned int Cols, class Distribution>
+FQUALIFIERS
+void matrix_tile(const uint2 key,
+                 const unsigned long long matrix_id,
+                 const unsigned int row,
+                 const unsigned long long col,
+                 float (&tile)[Rows][Cols],
+                 Distribution distribution)
+{
+    for(unsigned int r = 0; r < Rows; r++)
+    {
+        unsigned long long c = col;
+        unsigned int j = 0;
+        while(j < Cols)
+        {
+            const float4 v = distribution(
+                matrix_values(key, matrix_id, row + r, static_cast<unsigned int>(c / 4))
+            );
+            for(unsigned int i = static_cast<unsigned int>(c % 4); i < 4 && j < Cols; i++, j++, c++)
+            {
+                tile[r][j] = vec_element(v, i);
+            }
+        }
+    }
+}
+
+} // end namespace detail
+} // end namespace rocrand_device
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+/**
+ * \brief Random matrix defined by a seed and a matrix id.
+ *
+ * Entries of the matrix are computed directly from Philox counters, so any
+ * entry or tile can be regenerated at any time (for example in registers of
+ * a GEMM kernel using a random projection) and the matrix never has to be
+ * stored in memory. The matrix has 2^32 rows and 2^34 columns.
+ */
+typedef struct rocrand_matrix_philox4x32_10
+{
+    uint2 key;
+    unsigned long long matrix_id;
+} rocrand_matrix_philox4x32_10;
+
+/**
+ * \brief Initializes a random matrix.
+ *
+ * Entries of matrices with equal \p seed and \p matrix_id are equal, they are
+ * the same as entries generated by rocrand_generate_matrix_uniform(),
+ * rocrand_generate_matrix_normal() and rocrand_generate_matrix_rademacher()
+ * with a ROCRAND_RNG_PSEUDO_PHILOX4_32_10 generator with the seed \p seed.
+ *
+ * \param seed - Value to use as a seed
+ * \param matrix_id - Id of the matrix of the seed
+ * \param matrix - Pointer to matrix to initialize
+ */
+FQUALIFIERS
+void rocrand_matrix_init(const unsigned long long seed,
+                         const unsigned long long matrix_id,
+                         rocrand_matrix_philox4x32_10 * matrix)
+{
+    matrix->key = uint2 {
+        static_cast<unsigned int>(seed), static_cast<unsigned int>(seed >> 32)
+    };
+    matrix->matrix_id = matrix_id;
+}
+
+/**
+ * \brief Returns 4 random <tt>unsigned int</tt> entries of a matrix.
+ *
+ * Returns entries (\p row, 4 * \p col4), ..., (\p row, 4 * \p col4 + 3),
+ * they are computed by one Philox call. Uniform, normal and Rademacher
+ * entries of the matrix are computed from these values.
+ *
+ * \param matrix - Pointer to the matrix
+ * \param row - Row of the entries
+ * \param col4 - Column of the first entry divided by 4
+ *
+ * \return Four entries of the matrix as \p uint4
+ */
+FQUALIFIERS
+uint4 rocrand_matrix4(const rocrand_matrix_philox4x32_10 * matrix,
+                      const unsigned int row,
+                      const unsigned int col4)
+{
+    return rocrand_device::detail::matrix_values(matrix->key, matrix->matrix_id, row, col4);
+}
+
+/**
+ * \brief Returns 4 uniformly distributed random \p float entries from (0; 1] range
+ * of a matrix.
+ *
+ * See rocrand_matrix4().
+ *
+ * \param matrix - Pointer to the matrix
+ * \param row - Row of the entries
+ * \param col4 - Column of the first entry divided by 4
+ *
+ * \return Four entries of the matrix as \p float4
+ */
+FQUALIFIERS
+float4 rocrand_matrix_uniform4(const rocrand_matrix_philox4x32_10 * matrix,
+                               const unsigned int row,
+                               const unsigned int col4)
+{
+    return rocrand_device::detail::matrix_uniform_distribution()(
+        rocrand_matrix4(matrix, row, col4)
+    );
+}
+
+/**
+ * \brief Returns 4 normally distributed random \p float entries of a matrix.
+ *
+ * Entries have mean \p 0.0 and standard deviation \p 1.0, pairs of
+ * columns 4 * \p col4 + {0, 1} and 4 * \p col4 + {2, 3} are computed by the Box-Muller
+ * transform. See rocrand_matrix4().
+ *
+ * \param matrix - Pointer to the matrix
+ * \param row - Row of the entries
+ * \param col4 - Column of the first entry divided by 4
+ *
+ * \return Four entries of the matrix as \p float4
+ */
+FQUALIFIERS
+float4 rocrand_matrix_normal4(const rocrand_matrix_philox4x32_10 * matrix,
+                              const unsigned int row,
+                              const unsigned int col4)
+{
+    return rocrand_device::detail::matrix_normal_distribution()(
+        rocrand_matrix4(matrix, row, col4)
+    );
+}
+
+/**
+ * \brief Returns 4 Rademacher distributed random \p float entries (-1 or 1)
+ * of a matrix.
+ *
+ * See rocrand_matrix4().
+ *
+ * \param matrix - Pointer to the matrix
+ * \param row - Row of the entries
+ * \param col4 - Column of the first entry divided by 4
+ *
+ * \return Four entries of the matrix as \p float4
+ */
+FQUALIFIERS
+float4 rocrand_matrix_rademacher4(const rocrand_matrix_philox4x32_10 * matrix,
+                                  const unsigned int row,
+                                  const unsigned int col4)
+{
+    return rocrand_device::detail::matrix_rademacher_distribution()(
+        rocrand_matrix4(matrix, row, col4)
+    );
+}
+
+/**
+ * \brief Computes a tile of uniformly distributed random \p float entries
+ * from (0; 1] range of a matrix.
+ *
+ * Sets \p tile[r][c] to the entry (\p row + r, \p col + c) of the matrix,
+ * one Philox call is made for every 4 consecutive columns of a row
+ * (\p col and \p Cols should be multiples of 4 to avoid redundant calls).
+ *
+ * \tparam Rows - Number of rows of the tile
+ * \tparam Cols - Number of columns of the tile
+ *
+ * \param matrix - Pointer to the matrix
+ * \param row - Row of the first entry of the tile
+ * \param col - Column of the first entry of the tile
+ * \param tile - Entries of the tile
+ */
+template<unsigned int Rows, unsigned int Cols>
+FQUALIFIERS
+void rocrand_matrix_tile_uniform(const rocrand_matrix_philox4x32_10 * matrix,
+                                 const unsigned int row,
+                                 const unsigned long long col,
+                                 float (&tile)[Rows][Cols])
+{
+    rocrand_device::detail::matrix_tile(
+        matrix->key, matrix->matrix_id, row, col, tile,
+        rocrand_device::detail::matrix_uniform_distribution()
+    );
+}
+
+/**
+ * \brief Computes a tile of normally distributed random \p float entries
+ * of a matrix.
+ *
+ * See rocrand_matrix_normal4() and rocrand_matrix_tile_uniform().
+ *
+ * \tparam Rows - Number of rows of the tile
+ * \tparam Cols - Number of columns of the tile
+ *
+ * \param matrix - Pointer to the matrix
+ * \param row - Row of the first entry of the tile
+ * \param col - Column of the first entry of the tile
+ * \param tile - Entries of the tile
+ */
+template<unsigned int Rows, unsigned int Cols>
+FQUALIFIERS
+void rocrand_matrix_tile_normal(const rocrand_matrix_philox4x32_10 * matrix,
+                                const unsigned int row,
+                                const unsigned long long col,
+                                float (&tile)[Rows][Cols])
+{
+    rocrand_device::detail::matrix_tile(
+        matrix->key, matrix->matrix_id, row, col, tile,
+        rocrand_device::detail::matrix_normal_distribution()
+    );
+}
+
+/**
+ * \brief Computes a tile of Rademacher distributed random \p float entries
+ * (-1 or 1) of a matrix.
+ *
+ * See rocrand_matrix_tile_uniform().
+ *
+ * \tparam Rows - Number of rows of the tile
+ * \tparam Cols - Number of columns of the tile
+ *
+ * \param matrix - Pointer to the matrix
+ * \param row - Row of the first entry of the tile
+ * \param col - Column of the first entry of the tile
+ * \param tile - Entries of the tile
+ */
+template<unsigned int Rows, unsigned int Cols>
+FQUALIFIERS
+void rocrand_matrix_tile_rademacher(const rocrand_matrix_philox4x32_10 * matrix,
+                                    const unsigned int row,
+                                    const unsigned long long col,
+                                    float (&tile)[Rows][Cols])
+{
+    rocrand_device::detail::matrix_tile(
+        matrix->key, matrix->matrix_id, row, col, tile,
+        rocrand_device::detail::matrix_rademacher_distribution()
+    );
+}
+
+#endif // ROCRAND_MATRIX_H_
+
+/** @} */ // end of group rocranddevice
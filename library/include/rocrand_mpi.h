@@ -0,0 +1,73 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_MPI_H_
+#define ROCRAND_MPI_H_
+
+#include <mpi.h>
+
+#include "rocrand.h"
+
+/** \addtogroup rocrandhost
+ *
+ *  @{
+ */
+
+// Helpers for MPI applications. The header is optional: it is not included by
+// rocrand.h and needs only MPI headers and the MPI library of the application,
+// the rocRAND library itself does not depend on MPI.
+
+/**
+ * \brief Creates a generator of the calling rank's slice of a distributed sequence.
+ *
+ * Creates a generator with rocrand_create_distributed_generator(), the rank and
+ * the number of processes are those of the calling process in \p comm.
+ * If all ranks of \p comm create generators of the same type and set the
+ * same seed, offset and number of dimensions, a cluster-wide run produces the
+ * same values as a single-device one (see rocrand_create_distributed_generator()).
+ *
+ * \param generator - Pointer to generator
+ * \param rng_type - Type of generator to create
+ * \param comm - MPI communicator
+ *
+ * \return
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the rank or the size of \p comm could not be queried \n
+ * - Otherwise the status of rocrand_create_distributed_generator() \n
+ */
+static inline rocrand_status
+rocrand_create_mpi_generator(rocrand_multi_device_generator * generator,
+                             rocrand_rng_type rng_type,
+                             MPI_Comm comm)
+{
+    int rank, world_size;
+    if(MPI_Comm_rank(comm, &rank) != MPI_SUCCESS
+        || MPI_Comm_size(comm, &world_size) != MPI_SUCCESS)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    return rocrand_create_distributed_generator(
+        generator, rng_type,
+        (unsigned int)rank, (unsigned int)world_size
+    );
+}
+
+/** @} */ // end of group rocrandhost
+
+#endif // ROCRAND_MPI_H_
@@ -28,6 +28,11 @@
 #include "rocrand_common.h"
 #include "rocrand_mrg32k3a_precomputed.h"
 
+// Headers generated without --radix-log2 contain binary jump matrices
+#ifndef MRG32K3A_JUMP_LOG2
+#define MRG32K3A_JUMP_LOG2 1
+#endif
+
 // Thomas Bradley, Parallelisation Techniques for Random Number Generators
 // https://www.nag.co.uk/IndustryArticles/gpu_gems_article.pdf
 
@@ -227,42 +232,22 @@ protected:
     FQUALIFIERS
     void discard_subsequence_impl(unsigned long long subsequence)
     {
-        int i = 0;
-
-        while(subsequence > 0) {
-            if (subsequence & 1) {
-                #if defined(__HIP_DEVICE_COMPILE__)
-                mod_mat_vec_m1(d_A1P67 + i, m_state.g1);
-                mod_mat_vec_m2(d_A2P67 + i, m_state.g2);
-                #else
-                mod_mat_vec_m1(h_A1P67 + i, m_state.g1);
-                mod_mat_vec_m2(h_A2P67 + i, m_state.g2);
-                #endif
-            }
-            subsequence >>= 1;
-            i += 9;
-        }
+        #if defined(__HIP_DEVICE_COMPILE__)
+        jump(subsequence, d_A1P67, d_A2P67);
+        #else
+        jump(subsequence, h_A1P67, h_A2P67);
+        #endif
     }
 
     // DOES NOT CALCULATE NEW ULONGLONG
     FQUALIFIERS
     void discard_sequence_impl(unsigned long long sequence)
     {
-        int i = 0;
-
-        while(sequence > 0) {
-            if (sequence & 1) {
-                #if defined(__HIP_DEVICE_COMPILE__)
-                mod_mat_vec_m1(d_A1P127 + i, m_state.g1);
-                mod_mat_vec_m2(d_A2P127 + i, m_state.g2);
-                #else
-                mod_mat_vec_m1(h_A1P127 + i, m_state.g1);
-                mod_mat_vec_m2(h_A2P127 + i, m_state.g2);
-                #endif
-            }
-            sequence >>= 1;
-            i += 9;
-        }
+        #if defined(__HIP_DEVICE_COMPILE__)
+        jump(sequence, d_A1P127, d_A2P127);
+        #else
+        jump(sequence, h_A1P127, h_A2P127);
+        #endif
     }
 
     // Advances the internal state by offset times.
@@ -270,21 +255,11 @@ protected:
     FQUALIFIERS
     void discard_state(unsigned long long offset)
     {
-        int i = 0;
-
-        while(offset > 0) {
-            if (offset & 1) {
-                #if defined(__HIP_DEVICE_COMPILE__)
-                mod_mat_vec_m1(d_A1 + i, m_state.g1);
-                mod_mat_vec_m2(d_A2 + i, m_state.g2);
-                #else
-                mod_mat_vec_m1(h_A1 + i, m_state.g1);
-                mod_mat_vec_m2(h_A2 + i, m_state.g2);
-                #endif
-            }
-            offset >>= 1;
-            i += 9;
-        }
+        #if defined(__HIP_DEVICE_COMPILE__)
+        jump(offset, d_A1, d_A2);
+        #else
+        jump(offset, h_A1, h_A2);
+        #endif
     }
 
     // Advances the internal state to the next state
@@ -296,6 +271,29 @@ protected:
     }
 
 private:
+    // Applies A1^v and A2^v to the state. v is processed digit by digit in radix
+    // 2^MRG32K3A_JUMP_LOG2, the tables contain A^(d * radix^k) for all digits
+    // d in [1, radix) of all positions k (see tools/mrg32k3a_precomputed_generator),
+    // so every nonzero digit needs one multiplication.
+    FQUALIFIERS
+    void jump(unsigned long long v,
+              const unsigned long long * A1,
+              const unsigned long long * A2)
+    {
+        constexpr unsigned int digits = (1U << MRG32K3A_JUMP_LOG2) - 1;
+        int i = 0;
+
+        while(v > 0) {
+            const unsigned int digit = static_cast<unsigned int>(v) & digits;
+            if (digit > 0) {
+                mod_mat_vec_m1(A1 + i + (digit - 1) * 9, m_state.g1);
+                mod_mat_vec_m2(A2 + i + (digit - 1) * 9, m_state.g2);
+            }
+            v >>= MRG32K3A_JUMP_LOG2;
+            i += 9 * digits;
+        }
+    }
+
     FQUALIFIERS
     void mod_mat_vec_m1(const unsigned long long * A,
                         unsigned int * s)
@@ -26,8 +26,11 @@
 
 #define MRG323A_DIM 64
 #define MRG323A_N 576
+#define MRG32K3A_JUMP_LOG2 1
 
-static const __device__ unsigned long long d_A1[MRG323A_N] =
+ROCRAND_DEVICE_TABLE const __device__ unsigned long long d_A1[MRG323A_N]
+#if defined(ROCRAND_DEVICE_TABLE_DEFINITIONS)
+    =
     {
         0, 1, 0, 0, 0, 1, 4294156359, 1403580, 0,
         0, 0, 1, 4294156359, 1403580, 0, 0, 4294156359, 1403580,
@@ -94,7 +97,9 @@ static const __device__ unsigned long long d_A1[MRG323A_N] =
         599407451, 2806239788, 1742216102, 975123999, 764869161, 2806239788, 2729710367, 1845257036, 764869161,
         967330218, 3464884028, 3444447102, 580449578, 1343714307, 3464884028, 1775329096, 4027221761, 1343714307,
 
-    };
+    }
+#endif
+    ;
 
 static const unsigned long long h_A1[MRG323A_N] =
     {
@@ -165,7 +170,9 @@ static const unsigned long long h_A1[MRG323A_N] =
 
     };
 
-static const __device__ unsigned long long d_A2[MRG323A_N] =
+ROCRAND_DEVICE_TABLE const __device__ unsigned long long d_A2[MRG323A_N]
+#if defined(ROCRAND_DEVICE_TABLE_DEFINITIONS)
+    =
     {
         0, 1, 0, 0, 0, 1, 4293573854, 0, 527612,
         0, 0, 1, 4293573854, 0, 527612, 2706407399, 4293573854, 3497978192,
@@ -232,7 +239,9 @@ static const __device__ unsigned long long d_A2[MRG323A_N] =
         3035321857, 3971176093, 226779704, 3361614254, 3035321857, 2807125404, 326640887, 3361614254, 3147308542,
         1774298149, 4179629947, 3145006948, 1688753503, 1774298149, 94869516, 2327946901, 1688753503, 2786835219,
 
-    };
+    }
+#endif
+    ;
 
 static const unsigned long long h_A2[MRG323A_N] =
     {
@@ -303,7 +312,9 @@ static const unsigned long long h_A2[MRG323A_N] =
 
     };
 
-static const __device__ unsigned long long d_A1P67[MRG323A_N] =
+ROCRAND_DEVICE_TABLE const __device__ unsigned long long d_A1P67[MRG323A_N]
+#if defined(ROCRAND_DEVICE_TABLE_DEFINITIONS)
+    =
     {
         82758667, 1871391091, 4127413238, 3672831523, 69195019, 1871391091, 3672091415, 3528743235, 69195019,
         3361372532, 2329303404, 99651939, 2008671965, 2931758910, 2329303404, 1113529483, 2374097189, 2931758910,
@@ -370,7 +381,9 @@ static const __device__ unsigned long long d_A1P67[MRG323A_N] =
         3027706760, 3786576552, 2698781808, 2810527099, 90498489, 3786576552, 4220122612, 1855245979, 90498489,
         3739389517, 1110440720, 917457922, 2163873618, 3707591763, 1110440720, 2667061910, 2533383962, 3707591763,
 
-    };
+    }
+#endif
+    ;
 
 static const unsigned long long h_A1P67[MRG323A_N] =
     {
@@ -441,7 +454,9 @@ static const unsigned long long h_A1P67[MRG323A_N] =
 
     };
 
-static const __device__ unsigned long long d_A2P67[MRG323A_N] =
+ROCRAND_DEVICE_TABLE const __device__ unsigned long long d_A2P67[MRG323A_N]
+#if defined(ROCRAND_DEVICE_TABLE_DEFINITIONS)
+    =
     {
         1511326704, 3759209742, 1610795712, 4292754251, 1511326704, 3889917532, 3859662829, 4292754251, 3708466080,
         972103006, 964807713, 878035866, 4248550197, 972103006, 1926628839, 1448629089, 4248550197, 3196114006,
@@ -508,7 +523,9 @@ static const __device__ unsigned long long d_A2P67[MRG323A_N] =
         3524411799, 932865240, 1838275365, 1789634890, 3524411799, 4130736474, 2252266098, 1789634890, 3048775967,
         1773339925, 948403862, 1999624391, 983864203, 1773339925, 3734776305, 314407045, 983864203, 2648614071,
 
-    };
+    }
+#endif
+    ;
 
 static const unsigned long long h_A2P67[MRG323A_N] =
     {
@@ -579,7 +596,9 @@ static const unsigned long long h_A2P67[MRG323A_N] =
 
     };
 
-static const __device__ unsigned long long d_A1P127[MRG323A_N] =
+ROCRAND_DEVICE_TABLE const __device__ unsigned long long d_A1P127[MRG323A_N]
+#if defined(ROCRAND_DEVICE_TABLE_DEFINITIONS)
+    =
     {
         2427906178, 3580155704, 949770784, 226153695, 1230515664, 3580155704, 1988835001, 986791581, 1230515664,
         1774047142, 3199155377, 3106427820, 1901920839, 4290900039, 3199155377, 4178980191, 280623348, 4290900039,
@@ -646,7 +665,9 @@ static const __device__ unsigned long long d_A1P127[MRG323A_N] =
         3827747418, 3897287251, 4106993377, 1527779946, 3221052941, 3897287251, 4178727866, 4281160673, 3221052941,
         1174358892, 2835476193, 959978619, 850076464, 3774782533, 2835476193, 3880910680, 3237990203, 3774782533,
 
-    };
+    }
+#endif
+    ;
 
 static const unsigned long long h_A1P127[MRG323A_N] =
     {
@@ -717,7 +738,9 @@ static const unsigned long long h_A1P127[MRG323A_N] =
 
     };
 
-static const __device__ unsigned long long d_A2P127[MRG323A_N] =
+ROCRAND_DEVICE_TABLE const __device__ unsigned long long d_A2P127[MRG323A_N]
+#if defined(ROCRAND_DEVICE_TABLE_DEFINITIONS)
+    =
     {
         1464411153, 277697599, 1610723613, 32183930, 1464411153, 1022607788, 2824425944, 32183930, 2093834863,
         3492361727, 1027004383, 3167429889, 3674905362, 3492361727, 3572939265, 4270409313, 3674905362, 698814233,
@@ -784,7 +807,9 @@ static const __device__ unsigned long long d_A2P127[MRG323A_N] =
         3377318569, 1927835240, 2556102508, 3022040116, 3377318569, 2549406364, 2387074241, 3022040116, 1477293711,
         257306870, 1748489735, 547809226, 3708493374, 257306870, 4183546362, 4435502, 3708493374, 1607696753,
 
-    };
+    }
+#endif
+    ;
 
 static const unsigned long long h_A2P127[MRG323A_N] =
     {
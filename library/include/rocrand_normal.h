@@ -33,23 +33,68 @@
 #include <math.h>
 
 #include "rocrand_philox4x32_10.h"
+#include "rocrand_philox4x32_7.h"
+#include "rocrand_philox4x64_10.h"
+#include "rocrand_threefry2x64_20.h"
+#include "rocrand_threefry4x64_20.h"
 #include "rocrand_mrg32k3a.h"
 #include "rocrand_xorwow.h"
+#include "rocrand_xoshiro128pp.h"
+#include "rocrand_pcg32.h"
 #include "rocrand_sobol32.h"
+#include "rocrand_scrambled_sobol32.h"
+#include "rocrand_sobol64.h"
+#include "rocrand_scrambled_sobol64.h"
 #include "rocrand_mtgp32.h"
 
 #include "rocrand_uniform.h"
+#include "rocrand_normal_ziggurat_precomputed.h"
+
+// Define ROCRAND_FAST_MATH before including rocRAND headers to make
+// single-precision normal and log-normal device functions use hardware
+// intrinsics (__logf, __expf) instead of full-precision functions.
+#if defined(ROCRAND_FAST_MATH)
+    #define ROCRAND_DETAIL_FAST_MATH true
+#else
+    #define ROCRAND_DETAIL_FAST_MATH false
+#endif
 
 namespace rocrand_device {
 namespace detail {
 
+// Natural logarithm (of x in [0, 1]) and exponent of single-precision
+// transforms, FastMath versions use intrinsics on the device
+template<bool FastMath>
+FQUALIFIERS
+float normal_logf(float x)
+{
+    #ifdef __HIP_DEVICE_COMPILE__
+    if(FastMath)
+        // The absolute error of __logf near 1 can make the result positive
+        return fminf(__logf(x), 0.0f);
+    #endif
+    return logf(x);
+}
+
+template<bool FastMath = ROCRAND_DETAIL_FAST_MATH>
+FQUALIFIERS
+float normal_expf(float x)
+{
+    #ifdef __HIP_DEVICE_COMPILE__
+    if(FastMath)
+        return __expf(x);
+    #endif
+    return expf(x);
+}
+
+template<bool FastMath = ROCRAND_DETAIL_FAST_MATH>
 FQUALIFIERS
 float2 box_muller(unsigned int x, unsigned int y)
 {
     float2 result;
     float u = ROCRAND_2POW32_INV + (x * ROCRAND_2POW32_INV);
     float v = ROCRAND_2POW32_INV_2PI + (y * ROCRAND_2POW32_INV_2PI);
-    float s = sqrtf(-2.0f * logf(u));
+    float s = sqrtf(-2.0f * normal_logf<FastMath>(u));
     #ifdef __HIP_DEVICE_COMPILE__
         __sincosf(v, &result.x, &result.y);
         result.x *= s;
@@ -115,13 +160,14 @@ __half2 box_muller_half(unsigned short x, unsigned short y)
     #endif
 }
 
+template<bool FastMath = ROCRAND_DETAIL_FAST_MATH>
 FQUALIFIERS
 float2 mrg_box_muller(unsigned int x, unsigned int y)
 {
     float2 result;
     float u = rocrand_device::detail::mrg_uniform_distribution(x);
     float v = rocrand_device::detail::mrg_uniform_distribution(y) * ROCRAND_2PI;
-    float s = sqrtf(-2.0f * logf(u));
+    float s = sqrtf(-2.0f * normal_logf<FastMath>(u));
     #ifdef __HIP_DEVICE_COMPILE__
         __sincosf(v, &result.x, &result.y);
         result.x *= s;
@@ -151,6 +197,8 @@ double2 mrg_box_muller_double(unsigned int x, unsigned int y)
     return result;
 }
 
+// FastMath version uses the intrinsic logarithm
+template<bool FastMath = ROCRAND_DETAIL_FAST_MATH>
 FQUALIFIERS
 float roc_f_erfinv(float x)
 {
@@ -158,7 +206,7 @@ float roc_f_erfinv(float x)
     sgn = (x < 0.0f) ? -1.0f : 1.0f;
 
     x = (1.0f - x) * (1.0f + x);
-    lnx = logf(x);
+    lnx = normal_logf<FastMath>(x);
 
     #ifdef __HIP_DEVICE_COMPILE__
     if (isnan(lnx))
@@ -207,25 +255,28 @@ double roc_d_erfinv(double x)
     return(sgn * sqrt(-tt1 + sqrt(tt1 * tt1 - tt2)));
 }
 
+template<bool FastMath = ROCRAND_DETAIL_FAST_MATH>
 FQUALIFIERS
 float normal_distribution(unsigned int x)
 {
     float p = ::rocrand_device::detail::uniform_distribution(x);
-    float v = ROCRAND_SQRT2 * ::rocrand_device::detail::roc_f_erfinv(2.0f * p - 1.0f);
+    float v = ROCRAND_SQRT2 * ::rocrand_device::detail::roc_f_erfinv<FastMath>(2.0f * p - 1.0f);
     return v;
 }
 
+template<bool FastMath = ROCRAND_DETAIL_FAST_MATH>
 FQUALIFIERS
 float2 normal_distribution2(unsigned int v1, unsigned int v2)
 {
-    return ::rocrand_device::detail::box_muller(v1, v2);
+    return ::rocrand_device::detail::box_muller<FastMath>(v1, v2);
 }
 
+template<bool FastMath = ROCRAND_DETAIL_FAST_MATH>
 FQUALIFIERS
 float4 normal_distribution4(uint4 v)
 {
-    float2 r1 = ::rocrand_device::detail::box_muller(v.x, v.y);
-    float2 r2 = ::rocrand_device::detail::box_muller(v.z, v.w);
+    float2 r1 = ::rocrand_device::detail::box_muller<FastMath>(v.x, v.y);
+    float2 r2 = ::rocrand_device::detail::box_muller<FastMath>(v.z, v.w);
     return float4{
         r1.x,
         r1.y,
@@ -242,6 +293,14 @@ double normal_distribution_double(unsigned int x)
     return v;
 }
 
+FQUALIFIERS
+double normal_distribution_double(unsigned long long x)
+{
+    double p = ::rocrand_device::detail::uniform_distribution_double(x);
+    double v = ROCRAND_SQRT2 * ::rocrand_device::detail::roc_d_erfinv(2.0 * p - 1.0);
+    return v;
+}
+
 FQUALIFIERS
 double2 normal_distribution_double2(uint4 v)
 {
@@ -257,10 +316,11 @@ __half2 normal_distribution_half2(unsigned int v)
     );
 }
 
+template<bool FastMath = ROCRAND_DETAIL_FAST_MATH>
 FQUALIFIERS
 float2 mrg_normal_distribution2(unsigned int v1, unsigned int v2)
 {
-    return ::rocrand_device::detail::mrg_box_muller(v1, v2);
+    return ::rocrand_device::detail::mrg_box_muller<FastMath>(v1, v2);
 }
 
 FQUALIFIERS
@@ -279,6 +339,125 @@ __half2 mrg_normal_distribution_half2(unsigned int v)
     );
 }
 
+// Ziggurat method (Marsaglia and Tsang) with 128 layers: the low 7 bits
+// of a value select a layer, bit 7 is the sign and the highest 24 bits
+// are x. Generator is any engine returning uniform 32-bit values.
+// Rejections are rare (about 1.2%), so the number of consumed values varies.
+template<class Generator>
+FQUALIFIERS
+float ziggurat_normal(Generator& generator)
+{
+    #ifdef __HIP_DEVICE_COMPILE__
+    const unsigned int * k = d_ziggurat_k32;
+    const float * w = d_ziggurat_w32;
+    const float * f = d_ziggurat_f32;
+    #else
+    const unsigned int * k = h_ziggurat_k32;
+    const float * w = h_ziggurat_w32;
+    const float * f = h_ziggurat_f32;
+    #endif
+    while(true)
+    {
+        const unsigned int v = generator();
+        const unsigned int i = v & (ROCRAND_ZIGGURAT_LAYERS - 1);
+        const float sign = (v & ROCRAND_ZIGGURAT_LAYERS) ? -1.0f : 1.0f;
+        const unsigned int j = v >> 8;
+        const float x = j * w[i];
+        if(j < k[i])
+        {
+            return sign * x;
+        }
+        if(i == 0)
+        {
+            // Tail: x > R
+            float xx, yy;
+            do
+            {
+                xx = -logf(uniform_distribution(generator())) / static_cast<float>(ROCRAND_ZIGGURAT_R);
+                yy = -logf(uniform_distribution(generator()));
+            } while(yy + yy < xx * xx);
+            return sign * (static_cast<float>(ROCRAND_ZIGGURAT_R) + xx);
+        }
+        // Wedge
+        if(f[i] + uniform_distribution(generator()) * (f[i - 1] - f[i]) < expf(-0.5f * x * x))
+        {
+            return sign * x;
+        }
+    }
+}
+
+// Uniform double from two consecutive values of generator
+template<class Generator>
+FQUALIFIERS
+double next_uniform_double(Generator& generator)
+{
+    const unsigned int v1 = generator();
+    const unsigned int v2 = generator();
+    return uniform_distribution_double(v1, v2);
+}
+
+// Double precision version of ziggurat_normal, uses 53 bits of two
+// 32-bit values for x.
+template<class Generator>
+FQUALIFIERS
+double ziggurat_normal_double(Generator& generator)
+{
+    #ifdef __HIP_DEVICE_COMPILE__
+    const unsigned long long * k = d_ziggurat_k64;
+    const double * w = d_ziggurat_w64;
+    const double * f = d_ziggurat_f64;
+    #else
+    const unsigned long long * k = h_ziggurat_k64;
+    const double * w = h_ziggurat_w64;
+    const double * f = h_ziggurat_f64;
+    #endif
+    while(true)
+    {
+        const unsigned int lo = generator();
+        const unsigned int hi = generator();
+        const unsigned int i = lo & (ROCRAND_ZIGGURAT_LAYERS - 1);
+        const double sign = (lo & ROCRAND_ZIGGURAT_LAYERS) ? -1.0 : 1.0;
+        const unsigned long long j =
+            ((static_cast<unsigned long long>(hi) << 32) | lo) >> 11;
+        const double x = j * w[i];
+        if(j < k[i])
+        {
+            return sign * x;
+        }
+        if(i == 0)
+        {
+            // Tail: x > R
+            double xx, yy;
+            do
+            {
+                xx = -log(next_uniform_double(generator)) / ROCRAND_ZIGGURAT_R;
+                yy = -log(next_uniform_double(generator));
+            } while(yy + yy < xx * xx);
+            return sign * (ROCRAND_ZIGGURAT_R + xx);
+        }
+        // Wedge
+        const double u = next_uniform_double(generator);
+        if(f[i] + u * (f[i - 1] - f[i]) < exp(-0.5 * x * x))
+        {
+            return sign * x;
+        }
+    }
+}
+
+// Adapts MRG32K3A engine (values in [1, ROCRAND_MRG32K3A_M1]) to uniform
+// 32-bit values for ziggurat_normal.
+template<class Engine>
+struct mrg_ziggurat_source
+{
+    Engine& engine;
+
+    FQUALIFIERS
+    unsigned int operator()()
+    {
+        return mrg_uniform_distribution_uint(engine());
+    }
+};
+
 } // end namespace detail
 } // end namespace rocrand_device
 
@@ -312,6 +491,36 @@ float rocrand_normal(rocrand_state_philox4x32_10 * state)
 }
 #endif // ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
 
+/**
+ * \brief Returns a normally distributed \p float value.
+ *
+ * Generates and returns a normally distributed \p float value using Philox4x32-7
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+#ifndef ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
+FQUALIFIERS
+float rocrand_normal(rocrand_state_philox4x32_7 * state)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_philox4x32_7> bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return bm_helper::get_float(state);
+    }
+    float2 r = rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+    bm_helper::save_float(state, r.y);
+    return r.x;
+}
+#endif // ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
+
 /**
  * \brief Returns two normally distributed \p float values.
  *
@@ -332,6 +541,26 @@ float2 rocrand_normal2(rocrand_state_philox4x32_10 * state)
     return rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
 }
 
+/**
+ * \brief Returns two normally distributed \p float values.
+ *
+ * Generates and returns two normally distributed \p float values using Philox4x32-7
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p float value as \p float2
+ */
+FQUALIFIERS
+float2 rocrand_normal2(rocrand_state_philox4x32_7 * state)
+{
+    return rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+}
+
 /**
  * \brief Returns four normally distributed \p float values.
  *
@@ -352,6 +581,26 @@ float4 rocrand_normal4(rocrand_state_philox4x32_10 * state)
     return rocrand_device::detail::normal_distribution4(rocrand4(state));
 }
 
+/**
+ * \brief Returns four normally distributed \p float values.
+ *
+ * Generates and returns four normally distributed \p float values using Philox4x32-7
+ * generator in \p state, and increments position of the generator by four.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate four normally
+ * distributed values, and returns them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four normally distributed \p float value as \p float4
+ */
+FQUALIFIERS
+float4 rocrand_normal4(rocrand_state_philox4x32_7 * state)
+{
+    return rocrand_device::detail::normal_distribution4(rocrand4(state));
+}
+
 /**
  * \brief Returns a normally distributed \p double value.
  *
@@ -382,6 +631,36 @@ double rocrand_normal_double(rocrand_state_philox4x32_10 * state)
 }
 #endif // ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
 
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p double value using Philox4x32-7
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+#ifndef ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
+FQUALIFIERS
+double rocrand_normal_double(rocrand_state_philox4x32_7 * state)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_philox4x32_7> bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return bm_helper::get_double(state);
+    }
+    double2 r = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+    bm_helper::save_double(state, r.y);
+    return r.x;
+}
+#endif // ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
+
 /**
  * \brief Returns two normally distributed \p double values.
  *
@@ -402,6 +681,26 @@ double2 rocrand_normal_double2(rocrand_state_philox4x32_10 * state)
     return rocrand_device::detail::normal_distribution_double2(rocrand4(state));
 }
 
+/**
+ * \brief Returns two normally distributed \p double values.
+ *
+ * Generates and returns two normally distributed \p double values using Philox4x32-7
+ * generator in \p state, and increments position of the generator by four.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p double values as \p double2
+ */
+FQUALIFIERS
+double2 rocrand_normal_double2(rocrand_state_philox4x32_7 * state)
+{
+    return rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+}
+
 /**
  * \brief Returns four normally distributed \p double values.
  *
@@ -427,10 +726,35 @@ double4 rocrand_normal_double4(rocrand_state_philox4x32_10 * state)
     };
 }
 
+/**
+ * \brief Returns four normally distributed \p double values.
+ *
+ * Generates and returns four normally distributed \p double values using Philox4x32-7
+ * generator in \p state, and increments position of the generator by eight.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate four normally
+ * distributed values, and returns them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four normally distributed \p double values as \p double4
+ */
+FQUALIFIERS
+double4 rocrand_normal_double4(rocrand_state_philox4x32_7 * state)
+{
+    double2 r1, r2;
+    r1 = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+    r2 = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+    return double4 {
+        r1.x, r1.y, r2.x, r2.y
+    };
+}
+
 /**
  * \brief Returns a normally distributed \p float value.
  *
- * Generates and returns a normally distributed \p float value using MRG32k3a
+ * Generates and returns a normally distributed \p float value using Philox4x64
  * generator in \p state, and increments position of the generator by one.
  * Used normal distribution has mean value equal to 0.0f, and standard deviation
  * equal to 1.0f.
@@ -441,26 +765,26 @@ double4 rocrand_normal_double4(rocrand_state_philox4x32_10 * state)
  *
  * \return Normally distributed \p float value
  */
-#ifndef ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
+#ifndef ROCRAND_DETAIL_PHILOX4X64_BM_NOT_IN_STATE
 FQUALIFIERS
-float rocrand_normal(rocrand_state_mrg32k3a * state)
+float rocrand_normal(rocrand_state_philox4x64_10 * state)
 {
-    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_mrg32k3a> bm_helper;
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_philox4x64_10> bm_helper;
 
     if(bm_helper::has_float(state))
     {
         return bm_helper::get_float(state);
     }
-    float2 r = rocrand_device::detail::mrg_normal_distribution2(rocrand(state), rocrand(state));
+    float2 r = rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
     bm_helper::save_float(state, r.y);
     return r.x;
 }
-#endif // ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
+#endif // ROCRAND_DETAIL_PHILOX4X64_BM_NOT_IN_STATE
 
 /**
  * \brief Returns two normally distributed \p float values.
  *
- * Generates and returns two normally distributed \p float values using MRG32k3a
+ * Generates and returns two normally distributed \p float values using Philox4x64
  * generator in \p state, and increments position of the generator by two.
  * Used normal distribution has mean value equal to 0.0f, and standard deviation
  * equal to 1.0f.
@@ -472,16 +796,36 @@ float rocrand_normal(rocrand_state_mrg32k3a * state)
  * \return Two normally distributed \p float value as \p float2
  */
 FQUALIFIERS
-float2 rocrand_normal2(rocrand_state_mrg32k3a * state)
+float2 rocrand_normal2(rocrand_state_philox4x64_10 * state)
 {
-    return rocrand_device::detail::mrg_normal_distribution2(rocrand(state), rocrand(state));
+    return rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+}
+
+/**
+ * \brief Returns four normally distributed \p float values.
+ *
+ * Generates and returns four normally distributed \p float values using Philox4x64
+ * generator in \p state, and increments position of the generator by four.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate four normally
+ * distributed values, and returns them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four normally distributed \p float value as \p float4
+ */
+FQUALIFIERS
+float4 rocrand_normal4(rocrand_state_philox4x64_10 * state)
+{
+    return rocrand_device::detail::normal_distribution4(rocrand4(state));
 }
 
 /**
  * \brief Returns a normally distributed \p double value.
  *
- * Generates and returns a normally distributed \p double value using MRG32k3a
- * generator in \p state, and increments position of the generator by one.
+ * Generates and returns a normally distributed \p double value using Philox4x64
+ * generator in \p state, and increments position of the generator by two.
  * Used normal distribution has mean value equal to 0.0f, and standard deviation
  * equal to 1.0f.
  * The function uses the Box-Muller transform method to generate two normally distributed
@@ -491,27 +835,27 @@ float2 rocrand_normal2(rocrand_state_mrg32k3a * state)
  *
  * \return Normally distributed \p double value
  */
-#ifndef ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
+#ifndef ROCRAND_DETAIL_PHILOX4X64_BM_NOT_IN_STATE
 FQUALIFIERS
-double rocrand_normal_double(rocrand_state_mrg32k3a * state)
+double rocrand_normal_double(rocrand_state_philox4x64_10 * state)
 {
-    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_mrg32k3a> bm_helper;
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_philox4x64_10> bm_helper;
 
     if(bm_helper::has_double(state))
     {
         return bm_helper::get_double(state);
     }
-    double2 r = rocrand_device::detail::mrg_normal_distribution_double2(rocrand(state), rocrand(state));
+    double2 r = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
     bm_helper::save_double(state, r.y);
     return r.x;
 }
-#endif // ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
+#endif // ROCRAND_DETAIL_PHILOX4X64_BM_NOT_IN_STATE
 
 /**
  * \brief Returns two normally distributed \p double values.
  *
- * Generates and returns two normally distributed \p double values using MRG32k3a
- * generator in \p state, and increments position of the generator by two.
+ * Generates and returns two normally distributed \p double values using Philox4x64
+ * generator in \p state, and increments position of the generator by four.
  * Used normal distribution has mean value equal to 0.0f, and standard deviation
  * equal to 1.0f.
  * The function uses the Box-Muller transform method to generate two normally
@@ -519,18 +863,43 @@ double rocrand_normal_double(rocrand_state_mrg32k3a * state)
  *
  * \param state - Pointer to a state to use
  *
- * \return Two normally distributed \p double value as \p double2
+ * \return Two normally distributed \p double values as \p double2
  */
 FQUALIFIERS
-double2 rocrand_normal_double2(rocrand_state_mrg32k3a * state)
+double2 rocrand_normal_double2(rocrand_state_philox4x64_10 * state)
 {
-    return rocrand_device::detail::mrg_normal_distribution_double2(rocrand(state), rocrand(state));
+    return rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+}
+
+/**
+ * \brief Returns four normally distributed \p double values.
+ *
+ * Generates and returns four normally distributed \p double values using Philox4x64
+ * generator in \p state, and increments position of the generator by eight.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate four normally
+ * distributed values, and returns them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four normally distributed \p double values as \p double4
+ */
+FQUALIFIERS
+double4 rocrand_normal_double4(rocrand_state_philox4x64_10 * state)
+{
+    double2 r1, r2;
+    r1 = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+    r2 = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+    return double4 {
+        r1.x, r1.y, r2.x, r2.y
+    };
 }
 
 /**
  * \brief Returns a normally distributed \p float value.
  *
- * Generates and returns a normally distributed \p float value using XORWOW
+ * Generates and returns a normally distributed \p float value using Threefry2x64
  * generator in \p state, and increments position of the generator by one.
  * Used normal distribution has mean value equal to 0.0f, and standard deviation
  * equal to 1.0f.
@@ -541,11 +910,11 @@ double2 rocrand_normal_double2(rocrand_state_mrg32k3a * state)
  *
  * \return Normally distributed \p float value
  */
-#ifndef ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+#ifndef ROCRAND_DETAIL_THREEFRY2X64_BM_NOT_IN_STATE
 FQUALIFIERS
-float rocrand_normal(rocrand_state_xorwow * state)
+float rocrand_normal(rocrand_state_threefry2x64_20 * state)
 {
-    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_xorwow> bm_helper;
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry2x64_20> bm_helper;
 
     if(bm_helper::has_float(state))
     {
@@ -555,12 +924,12 @@ float rocrand_normal(rocrand_state_xorwow * state)
     bm_helper::save_float(state, r.y);
     return r.x;
 }
-#endif // ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+#endif // ROCRAND_DETAIL_THREEFRY2X64_BM_NOT_IN_STATE
 
 /**
  * \brief Returns two normally distributed \p float values.
  *
- * Generates and returns two normally distributed \p float values using XORWOW
+ * Generates and returns two normally distributed \p float values using Threefry2x64
  * generator in \p state, and increments position of the generator by two.
  * Used normal distribution has mean value equal to 0.0f, and standard deviation
  * equal to 1.0f.
@@ -569,18 +938,38 @@ float rocrand_normal(rocrand_state_xorwow * state)
  *
  * \param state - Pointer to a state to use
  *
- * \return Two normally distributed \p float values as \p float2
+ * \return Two normally distributed \p float value as \p float2
  */
 FQUALIFIERS
-float2 rocrand_normal2(rocrand_state_xorwow * state)
+float2 rocrand_normal2(rocrand_state_threefry2x64_20 * state)
 {
     return rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
 }
 
+/**
+ * \brief Returns four normally distributed \p float values.
+ *
+ * Generates and returns four normally distributed \p float values using Threefry2x64
+ * generator in \p state, and increments position of the generator by four.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate four normally
+ * distributed values, and returns them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four normally distributed \p float value as \p float4
+ */
+FQUALIFIERS
+float4 rocrand_normal4(rocrand_state_threefry2x64_20 * state)
+{
+    return rocrand_device::detail::normal_distribution4(rocrand4(state));
+}
+
 /**
  * \brief Returns a normally distributed \p double value.
  *
- * Generates and returns a normally distributed \p double value using XORWOW
+ * Generates and returns a normally distributed \p double value using Threefry2x64
  * generator in \p state, and increments position of the generator by two.
  * Used normal distribution has mean value equal to 0.0f, and standard deviation
  * equal to 1.0f.
@@ -591,28 +980,26 @@ float2 rocrand_normal2(rocrand_state_xorwow * state)
  *
  * \return Normally distributed \p double value
  */
-#ifndef ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+#ifndef ROCRAND_DETAIL_THREEFRY2X64_BM_NOT_IN_STATE
 FQUALIFIERS
-double rocrand_normal_double(rocrand_state_xorwow * state)
+double rocrand_normal_double(rocrand_state_threefry2x64_20 * state)
 {
-    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_xorwow> bm_helper;
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry2x64_20> bm_helper;
 
     if(bm_helper::has_double(state))
     {
         return bm_helper::get_double(state);
     }
-    double2 r = rocrand_device::detail::normal_distribution_double2(
-        uint4 { rocrand(state), rocrand(state), rocrand(state), rocrand(state) }
-    );
+    double2 r = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
     bm_helper::save_double(state, r.y);
     return r.x;
 }
-#endif // ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+#endif // ROCRAND_DETAIL_THREEFRY2X64_BM_NOT_IN_STATE
 
 /**
  * \brief Returns two normally distributed \p double values.
  *
- * Generates and returns two normally distributed \p double values using XORWOW
+ * Generates and returns two normally distributed \p double values using Threefry2x64
  * generator in \p state, and increments position of the generator by four.
  * Used normal distribution has mean value equal to 0.0f, and standard deviation
  * equal to 1.0f.
@@ -621,86 +1008,1177 @@ double rocrand_normal_double(rocrand_state_xorwow * state)
  *
  * \param state - Pointer to a state to use
  *
- * \return Two normally distributed \p double value as \p double2
+ * \return Two normally distributed \p double values as \p double2
  */
 FQUALIFIERS
-double2 rocrand_normal_double2(rocrand_state_xorwow * state)
+double2 rocrand_normal_double2(rocrand_state_threefry2x64_20 * state)
 {
-    return rocrand_device::detail::normal_distribution_double2(
-        uint4 { rocrand(state), rocrand(state), rocrand(state), rocrand(state) }
-    );
+    return rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+}
+
+/**
+ * \brief Returns four normally distributed \p double values.
+ *
+ * Generates and returns four normally distributed \p double values using Threefry2x64
+ * generator in \p state, and increments position of the generator by eight.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate four normally
+ * distributed values, and returns them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four normally distributed \p double values as \p double4
+ */
+FQUALIFIERS
+double4 rocrand_normal_double4(rocrand_state_threefry2x64_20 * state)
+{
+    double2 r1, r2;
+    r1 = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+    r2 = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+    return double4 {
+        r1.x, r1.y, r2.x, r2.y
+    };
 }
 
 /**
  * \brief Returns a normally distributed \p float value.
  *
- * Generates and returns a normally distributed \p float value using MTGP32
+ * Generates and returns a normally distributed \p float value using Threefry4x64
  * generator in \p state, and increments position of the generator by one.
  * Used normal distribution has mean value equal to 0.0f, and standard deviation
  * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
  *
  * \param state - Pointer to a state to use
  *
  * \return Normally distributed \p float value
  */
+#ifndef ROCRAND_DETAIL_THREEFRY4X64_BM_NOT_IN_STATE
 FQUALIFIERS
-float rocrand_normal(rocrand_state_mtgp32 * state)
+float rocrand_normal(rocrand_state_threefry4x64_20 * state)
 {
-    return rocrand_device::detail::normal_distribution(rocrand(state));
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry4x64_20> bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return bm_helper::get_float(state);
+    }
+    float2 r = rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+    bm_helper::save_float(state, r.y);
+    return r.x;
+}
+#endif // ROCRAND_DETAIL_THREEFRY4X64_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two normally distributed \p float values.
+ *
+ * Generates and returns two normally distributed \p float values using Threefry4x64
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p float value as \p float2
+ */
+FQUALIFIERS
+float2 rocrand_normal2(rocrand_state_threefry4x64_20 * state)
+{
+    return rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+}
+
+/**
+ * \brief Returns four normally distributed \p float values.
+ *
+ * Generates and returns four normally distributed \p float values using Threefry4x64
+ * generator in \p state, and increments position of the generator by four.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate four normally
+ * distributed values, and returns them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four normally distributed \p float value as \p float4
+ */
+FQUALIFIERS
+float4 rocrand_normal4(rocrand_state_threefry4x64_20 * state)
+{
+    return rocrand_device::detail::normal_distribution4(rocrand4(state));
 }
 
 /**
  * \brief Returns a normally distributed \p double value.
  *
- * Generates and returns a normally distributed \p double value using MRG32k3a
- * generator in \p state, and increments position of the generator by one.
+ * Generates and returns a normally distributed \p double value using Threefry4x64
+ * generator in \p state, and increments position of the generator by two.
  * Used normal distribution has mean value equal to 0.0f, and standard deviation
  * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
  *
  * \param state - Pointer to a state to use
  *
  * \return Normally distributed \p double value
  */
+#ifndef ROCRAND_DETAIL_THREEFRY4X64_BM_NOT_IN_STATE
 FQUALIFIERS
-double rocrand_normal_double(rocrand_state_mtgp32 * state)
+double rocrand_normal_double(rocrand_state_threefry4x64_20 * state)
 {
-    return rocrand_device::detail::normal_distribution_double(rocrand(state));
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry4x64_20> bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return bm_helper::get_double(state);
+    }
+    double2 r = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+    bm_helper::save_double(state, r.y);
+    return r.x;
+}
+#endif // ROCRAND_DETAIL_THREEFRY4X64_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two normally distributed \p double values.
+ *
+ * Generates and returns two normally distributed \p double values using Threefry4x64
+ * generator in \p state, and increments position of the generator by four.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p double values as \p double2
+ */
+FQUALIFIERS
+double2 rocrand_normal_double2(rocrand_state_threefry4x64_20 * state)
+{
+    return rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+}
+
+/**
+ * \brief Returns four normally distributed \p double values.
+ *
+ * Generates and returns four normally distributed \p double values using Threefry4x64
+ * generator in \p state, and increments position of the generator by eight.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate four normally
+ * distributed values, and returns them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four normally distributed \p double values as \p double4
+ */
+FQUALIFIERS
+double4 rocrand_normal_double4(rocrand_state_threefry4x64_20 * state)
+{
+    double2 r1, r2;
+    r1 = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+    r2 = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+    return double4 {
+        r1.x, r1.y, r2.x, r2.y
+    };
 }
 
 /**
  * \brief Returns a normally distributed \p float value.
  *
- * Generates and returns a normally distributed \p float value using SOBOL32
+ * Generates and returns a normally distributed \p float value using MRG32k3a
  * generator in \p state, and increments position of the generator by one.
  * Used normal distribution has mean value equal to 0.0f, and standard deviation
  * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
  *
  * \param state - Pointer to a state to use
  *
  * \return Normally distributed \p float value
  */
+#ifndef ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
 FQUALIFIERS
-float rocrand_normal(rocrand_state_sobol32 * state)
+float rocrand_normal(rocrand_state_mrg32k3a * state)
 {
-    return rocrand_device::detail::normal_distribution(rocrand(state));
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_mrg32k3a> bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return bm_helper::get_float(state);
+    }
+    float2 r = rocrand_device::detail::mrg_normal_distribution2(rocrand(state), rocrand(state));
+    bm_helper::save_float(state, r.y);
+    return r.x;
+}
+#endif // ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two normally distributed \p float values.
+ *
+ * Generates and returns two normally distributed \p float values using MRG32k3a
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p float value as \p float2
+ */
+FQUALIFIERS
+float2 rocrand_normal2(rocrand_state_mrg32k3a * state)
+{
+    return rocrand_device::detail::mrg_normal_distribution2(rocrand(state), rocrand(state));
+}
+
+/**
+ * \brief Returns four normally distributed \p float values.
+ *
+ * Generates and returns four normally distributed \p float values using MRG32k3a
+ * generator in \p state, and increments position of the generator by four.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate four normally
+ * distributed values, the values are the same as returned by two calls of
+ * rocrand_normal2().
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four normally distributed \p float value as \p float4
+ */
+FQUALIFIERS
+float4 rocrand_normal4(rocrand_state_mrg32k3a * state)
+{
+    const uint4 v = rocrand_device::detail::rocrand4_local(state);
+    const float2 r1 = rocrand_device::detail::mrg_normal_distribution2(v.x, v.y);
+    const float2 r2 = rocrand_device::detail::mrg_normal_distribution2(v.z, v.w);
+    return float4 { r1.x, r1.y, r2.x, r2.y };
 }
 
 /**
  * \brief Returns a normally distributed \p double value.
  *
- * Generates and returns a normally distributed \p double value using SOBOL32
+ * Generates and returns a normally distributed \p double value using MRG32k3a
  * generator in \p state, and increments position of the generator by one.
  * Used normal distribution has mean value equal to 0.0f, and standard deviation
  * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
  *
  * \param state - Pointer to a state to use
  *
  * \return Normally distributed \p double value
  */
+#ifndef ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
+FQUALIFIERS
+double rocrand_normal_double(rocrand_state_mrg32k3a * state)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_mrg32k3a> bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return bm_helper::get_double(state);
+    }
+    double2 r = rocrand_device::detail::mrg_normal_distribution_double2(rocrand(state), rocrand(state));
+    bm_helper::save_double(state, r.y);
+    return r.x;
+}
+#endif // ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two normally distributed \p double values.
+ *
+ * Generates and returns two normally distributed \p double values using MRG32k3a
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p double value as \p double2
+ */
 FQUALIFIERS
-double rocrand_normal_double(rocrand_state_sobol32 * state)
+double2 rocrand_normal_double2(rocrand_state_mrg32k3a * state)
 {
-    return rocrand_device::detail::normal_distribution_double(rocrand(state));
+    return rocrand_device::detail::mrg_normal_distribution_double2(rocrand(state), rocrand(state));
+}
+
+/**
+ * \brief Returns a normally distributed \p float value.
+ *
+ * Generates and returns a normally distributed \p float value using XORWOW
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+#ifndef ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+FQUALIFIERS
+float rocrand_normal(rocrand_state_xorwow * state)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_xorwow> bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return bm_helper::get_float(state);
+    }
+    float2 r = rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+    bm_helper::save_float(state, r.y);
+    return r.x;
+}
+#endif // ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two normally distributed \p float values.
+ *
+ * Generates and returns two normally distributed \p float values using XORWOW
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p float values as \p float2
+ */
+FQUALIFIERS
+float2 rocrand_normal2(rocrand_state_xorwow * state)
+{
+    return rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+}
+
+/**
+ * \brief Returns four normally distributed \p float values.
+ *
+ * Generates and returns four normally distributed \p float values using XORWOW
+ * generator in \p state, and increments position of the generator by four.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate four normally
+ * distributed values, the values are the same as returned by two calls of
+ * rocrand_normal2().
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four normally distributed \p float values as \p float4
+ */
+FQUALIFIERS
+float4 rocrand_normal4(rocrand_state_xorwow * state)
+{
+    return rocrand_device::detail::normal_distribution4(rocrand_device::detail::rocrand4_local(state));
+}
+
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p double value using XORWOW
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+#ifndef ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+FQUALIFIERS
+double rocrand_normal_double(rocrand_state_xorwow * state)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_xorwow> bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return bm_helper::get_double(state);
+    }
+    double2 r = rocrand_device::detail::normal_distribution_double2(
+        uint4 { rocrand(state), rocrand(state), rocrand(state), rocrand(state) }
+    );
+    bm_helper::save_double(state, r.y);
+    return r.x;
+}
+#endif // ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two normally distributed \p double values.
+ *
+ * Generates and returns two normally distributed \p double values using XORWOW
+ * generator in \p state, and increments position of the generator by four.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p double value as \p double2
+ */
+FQUALIFIERS
+double2 rocrand_normal_double2(rocrand_state_xorwow * state)
+{
+    return rocrand_device::detail::normal_distribution_double2(
+        uint4 { rocrand(state), rocrand(state), rocrand(state), rocrand(state) }
+    );
+}
+
+/**
+ * \brief Returns two normally distributed \p float values.
+ *
+ * Generates and returns two normally distributed \p float values using compact
+ * XORWOW generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The compact state has no room for a saved value, so normally distributed values
+ * are generated in pairs by the Box-Muller transform.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p float values as \p float2
+ */
+FQUALIFIERS
+float2 rocrand_normal2(rocrand_state_xorwow_compact * state)
+{
+    return rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+}
+
+/**
+ * \brief Returns two normally distributed \p double values.
+ *
+ * Generates and returns two normally distributed \p double values using compact
+ * XORWOW generator in \p state, and increments position of the generator by four.
+ * Used normal distribution has mean value equal to 0.0, and standard deviation
+ * equal to 1.0.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p double value as \p double2
+ */
+FQUALIFIERS
+double2 rocrand_normal_double2(rocrand_state_xorwow_compact * state)
+{
+    return rocrand_device::detail::normal_distribution_double2(
+        uint4 { rocrand(state), rocrand(state), rocrand(state), rocrand(state) }
+    );
+}
+
+/**
+ * \brief Returns a normally distributed \p float value.
+ *
+ * Generates and returns a normally distributed \p float value using MTGP32
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_normal(rocrand_state_mtgp32 * state)
+{
+    return rocrand_device::detail::normal_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns four normally distributed \p float values.
+ *
+ * Generates and returns four normally distributed \p float values using MTGP32
+ * generator in \p state, and increments position of the generator by four.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The values are the same as returned by four calls of rocrand_normal(), the
+ * function must be called by all threads of the block.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four normally distributed \p float values as \p float4
+ */
+FQUALIFIERS
+float4 rocrand_normal4(rocrand_state_mtgp32 * state)
+{
+    const uint4 v = state->next4();
+    return float4 {
+        rocrand_device::detail::normal_distribution(v.x),
+        rocrand_device::detail::normal_distribution(v.y),
+        rocrand_device::detail::normal_distribution(v.z),
+        rocrand_device::detail::normal_distribution(v.w)
+    };
+}
+
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p double value using MRG32k3a
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_normal_double(rocrand_state_mtgp32 * state)
+{
+    return rocrand_device::detail::normal_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns a normally distributed \p float value.
+ *
+ * Generates and returns a normally distributed \p float value using SOBOL32
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_normal(rocrand_state_sobol32 * state)
+{
+    return rocrand_device::detail::normal_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns a normally distributed \p float value.
+ *
+ * Generates and returns a normally distributed \p float value using SOBOL32
+ * generator in block state \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_normal(rocrand_state_sobol32_block * state)
+{
+    return rocrand_device::detail::normal_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p double value using SOBOL32
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_normal_double(rocrand_state_sobol32 * state)
+{
+    return rocrand_device::detail::normal_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p double value using SOBOL32
+ * generator in block state \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_normal_double(rocrand_state_sobol32_block * state)
+{
+    return rocrand_device::detail::normal_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns a normally distributed \p float value.
+ *
+ * Generates and returns a normally distributed \p float value using SCRAMBLED_SOBOL32
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_normal(rocrand_state_scrambled_sobol32 * state)
+{
+    return rocrand_device::detail::normal_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p double value using SCRAMBLED_SOBOL32
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_normal_double(rocrand_state_scrambled_sobol32 * state)
+{
+    return rocrand_device::detail::normal_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns a normally distributed \p float value.
+ *
+ * Generates and returns a normally distributed \p float value using SOBOL64
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_normal(rocrand_state_sobol64 * state)
+{
+    return rocrand_device::detail::normal_distribution(static_cast<unsigned int>(rocrand(state) >> 32));
+}
+
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p double value using SOBOL64
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_normal_double(rocrand_state_sobol64 * state)
+{
+    return rocrand_device::detail::normal_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns a normally distributed \p float value.
+ *
+ * Generates and returns a normally distributed \p float value using SCRAMBLED_SOBOL64
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_normal(rocrand_state_scrambled_sobol64 * state)
+{
+    return rocrand_device::detail::normal_distribution(static_cast<unsigned int>(rocrand(state) >> 32));
+}
+
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p double value using SCRAMBLED_SOBOL64
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_normal_double(rocrand_state_scrambled_sobol64 * state)
+{
+    return rocrand_device::detail::normal_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns a normally distributed \p float value using the ziggurat method.
+ *
+ * Generates and returns a normally distributed \p float value using Philox
+ * generator in \p state. Used normal distribution has mean value equal to 0.0f,
+ * and standard deviation equal to 1.0f.
+ * The function uses the ziggurat method, which usually needs one value
+ * of the generator; rejected samples consume more values, so the position of the generator
+ * is incremented by a variable number.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_normal_ziggurat(rocrand_state_philox4x32_10 * state)
+{
+    return rocrand_device::detail::ziggurat_normal(*state);
+}
+
+/**
+ * \brief Returns a normally distributed \p float value using the ziggurat method.
+ *
+ * Generates and returns a normally distributed \p float value using Philox4x32-7
+ * generator in \p state. Used normal distribution has mean value equal to 0.0f,
+ * and standard deviation equal to 1.0f.
+ * The function uses the ziggurat method, which usually needs one value
+ * of the generator; rejected samples consume more values, so the position of the generator
+ * is incremented by a variable number.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_normal_ziggurat(rocrand_state_philox4x32_7 * state)
+{
+    return rocrand_device::detail::ziggurat_normal(*state);
+}
+
+/**
+ * \brief Returns a normally distributed \p double value using the ziggurat method.
+ *
+ * Generates and returns a normally distributed \p double value using Philox
+ * generator in \p state. Used normal distribution has mean value equal to 0.0,
+ * and standard deviation equal to 1.0.
+ * The function uses the ziggurat method, which usually needs two values
+ * of the generator; rejected samples consume more values, so the position of the generator
+ * is incremented by a variable number.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_normal_double_ziggurat(rocrand_state_philox4x32_10 * state)
+{
+    return rocrand_device::detail::ziggurat_normal_double(*state);
+}
+
+/**
+ * \brief Returns a normally distributed \p double value using the ziggurat method.
+ *
+ * Generates and returns a normally distributed \p double value using Philox4x32-7
+ * generator in \p state. Used normal distribution has mean value equal to 0.0,
+ * and standard deviation equal to 1.0.
+ * The function uses the ziggurat method, which usually needs two values
+ * of the generator; rejected samples consume more values, so the position of the generator
+ * is incremented by a variable number.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_normal_double_ziggurat(rocrand_state_philox4x32_7 * state)
+{
+    return rocrand_device::detail::ziggurat_normal_double(*state);
+}
+
+/**
+ * \brief Returns a normally distributed \p float value using the ziggurat method.
+ *
+ * Generates and returns a normally distributed \p float value using Philox4x64
+ * generator in \p state. Used normal distribution has mean value equal to 0.0f,
+ * and standard deviation equal to 1.0f.
+ * The function uses the ziggurat method, which usually needs one value
+ * of the generator; rejected samples consume more values, so the position of the generator
+ * is incremented by a variable number.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_normal_ziggurat(rocrand_state_philox4x64_10 * state)
+{
+    return rocrand_device::detail::ziggurat_normal(*state);
+}
+
+/**
+ * \brief Returns a normally distributed \p double value using the ziggurat method.
+ *
+ * Generates and returns a normally distributed \p double value using Philox4x64
+ * generator in \p state. Used normal distribution has mean value equal to 0.0,
+ * and standard deviation equal to 1.0.
+ * The function uses the ziggurat method, which usually needs two values
+ * of the generator; rejected samples consume more values, so the position of the generator
+ * is incremented by a variable number.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_normal_double_ziggurat(rocrand_state_philox4x64_10 * state)
+{
+    return rocrand_device::detail::ziggurat_normal_double(*state);
+}
+
+/**
+ * \brief Returns a normally distributed \p float value using the ziggurat method.
+ *
+ * Generates and returns a normally distributed \p float value using Threefry2x64
+ * generator in \p state. Used normal distribution has mean value equal to 0.0f,
+ * and standard deviation equal to 1.0f.
+ * The function uses the ziggurat method, which usually needs one value
+ * of the generator; rejected samples consume more values, so the position of the generator
+ * is incremented by a variable number.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_normal_ziggurat(rocrand_state_threefry2x64_20 * state)
+{
+    return rocrand_device::detail::ziggurat_normal(*state);
+}
+
+/**
+ * \brief Returns a normally distributed \p double value using the ziggurat method.
+ *
+ * Generates and returns a normally distributed \p double value using Threefry2x64
+ * generator in \p state. Used normal distribution has mean value equal to 0.0,
+ * and standard deviation equal to 1.0.
+ * The function uses the ziggurat method, which usually needs two values
+ * of the generator; rejected samples consume more values, so the position of the generator
+ * is incremented by a variable number.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_normal_double_ziggurat(rocrand_state_threefry2x64_20 * state)
+{
+    return rocrand_device::detail::ziggurat_normal_double(*state);
+}
+
+/**
+ * \brief Returns a normally distributed \p float value using the ziggurat method.
+ *
+ * Generates and returns a normally distributed \p float value using Threefry4x64
+ * generator in \p state. Used normal distribution has mean value equal to 0.0f,
+ * and standard deviation equal to 1.0f.
+ * The function uses the ziggurat method, which usually needs one value
+ * of the generator; rejected samples consume more values, so the position of the generator
+ * is incremented by a variable number.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_normal_ziggurat(rocrand_state_threefry4x64_20 * state)
+{
+    return rocrand_device::detail::ziggurat_normal(*state);
+}
+
+/**
+ * \brief Returns a normally distributed \p double value using the ziggurat method.
+ *
+ * Generates and returns a normally distributed \p double value using Threefry4x64
+ * generator in \p state. Used normal distribution has mean value equal to 0.0,
+ * and standard deviation equal to 1.0.
+ * The function uses the ziggurat method, which usually needs two values
+ * of the generator; rejected samples consume more values, so the position of the generator
+ * is incremented by a variable number.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_normal_double_ziggurat(rocrand_state_threefry4x64_20 * state)
+{
+    return rocrand_device::detail::ziggurat_normal_double(*state);
+}
+
+/**
+ * \brief Returns a normally distributed \p float value using the ziggurat method.
+ *
+ * Generates and returns a normally distributed \p float value using MRG32K3A
+ * generator in \p state. Used normal distribution has mean value equal to 0.0f,
+ * and standard deviation equal to 1.0f.
+ * The function uses the ziggurat method, which usually needs one value
+ * of the generator; rejected samples consume more values, so the position of the generator
+ * is incremented by a variable number.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_normal_ziggurat(rocrand_state_mrg32k3a * state)
+{
+    rocrand_device::detail::mrg_ziggurat_source<rocrand_state_mrg32k3a> source = { *state };
+    return rocrand_device::detail::ziggurat_normal(source);
+}
+
+/**
+ * \brief Returns a normally distributed \p double value using the ziggurat method.
+ *
+ * Generates and returns a normally distributed \p double value using MRG32K3A
+ * generator in \p state. Used normal distribution has mean value equal to 0.0,
+ * and standard deviation equal to 1.0.
+ * The function uses the ziggurat method, which usually needs two values
+ * of the generator; rejected samples consume more values, so the position of the generator
+ * is incremented by a variable number.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_normal_double_ziggurat(rocrand_state_mrg32k3a * state)
+{
+    rocrand_device::detail::mrg_ziggurat_source<rocrand_state_mrg32k3a> source = { *state };
+    return rocrand_device::detail::ziggurat_normal_double(source);
+}
+
+/**
+ * \brief Returns a normally distributed \p float value using the ziggurat method.
+ *
+ * Generates and returns a normally distributed \p float value using XORWOW
+ * generator in \p state. Used normal distribution has mean value equal to 0.0f,
+ * and standard deviation equal to 1.0f.
+ * The function uses the ziggurat method, which usually needs one value
+ * of the generator; rejected samples consume more values, so the position of the generator
+ * is incremented by a variable number.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_normal_ziggurat(rocrand_state_xorwow * state)
+{
+    return rocrand_device::detail::ziggurat_normal(*state);
+}
+
+/**
+ * \brief Returns a normally distributed \p double value using the ziggurat method.
+ *
+ * Generates and returns a normally distributed \p double value using XORWOW
+ * generator in \p state. Used normal distribution has mean value equal to 0.0,
+ * and standard deviation equal to 1.0.
+ * The function uses the ziggurat method, which usually needs two values
+ * of the generator; rejected samples consume more values, so the position of the generator
+ * is incremented by a variable number.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_normal_double_ziggurat(rocrand_state_xorwow * state)
+{
+    return rocrand_device::detail::ziggurat_normal_double(*state);
+}
+
+/**
+ * \brief Returns a normally distributed \p float value using the ziggurat method.
+ *
+ * Generates and returns a normally distributed \p float value using compact XORWOW
+ * generator in \p state (see rocrand_normal_ziggurat(rocrand_state_xorwow *)).
+ * The ziggurat method does not need a saved value, so single values are available
+ * for the compact state.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_normal_ziggurat(rocrand_state_xorwow_compact * state)
+{
+    return rocrand_device::detail::ziggurat_normal(*state);
+}
+
+/**
+ * \brief Returns a normally distributed \p double value using the ziggurat method.
+ *
+ * Generates and returns a normally distributed \p double value using compact XORWOW
+ * generator in \p state (see rocrand_normal_double_ziggurat(rocrand_state_xorwow *)).
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_normal_double_ziggurat(rocrand_state_xorwow_compact * state)
+{
+    return rocrand_device::detail::ziggurat_normal_double(*state);
+}
+
+/**
+ * \brief Returns two normally distributed \p float values.
+ *
+ * Generates and returns two normally distributed \p float values using xoshiro128++
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The state has no room for a saved value, so normally distributed values
+ * are generated in pairs by the Box-Muller transform.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p float values as \p float2
+ */
+FQUALIFIERS
+float2 rocrand_normal2(rocrand_state_xoshiro128pp * state)
+{
+    return rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+}
+
+/**
+ * \brief Returns two normally distributed \p double values.
+ *
+ * Generates and returns two normally distributed \p double values using xoshiro128++
+ * generator in \p state, and increments position of the generator by four.
+ * Used normal distribution has mean value equal to 0.0, and standard deviation
+ * equal to 1.0.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p double value as \p double2
+ */
+FQUALIFIERS
+double2 rocrand_normal_double2(rocrand_state_xoshiro128pp * state)
+{
+    return rocrand_device::detail::normal_distribution_double2(
+        uint4 { rocrand(state), rocrand(state), rocrand(state), rocrand(state) }
+    );
+}
+
+/**
+ * \brief Returns a normally distributed \p float value using the ziggurat method.
+ *
+ * Generates and returns a normally distributed \p float value using xoshiro128++
+ * generator in \p state (see rocrand_normal_ziggurat(rocrand_state_xorwow *)).
+ * The ziggurat method does not need a saved value, so single values are available
+ * for the state.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_normal_ziggurat(rocrand_state_xoshiro128pp * state)
+{
+    return rocrand_device::detail::ziggurat_normal(*state);
+}
+
+/**
+ * \brief Returns a normally distributed \p double value using the ziggurat method.
+ *
+ * Generates and returns a normally distributed \p double value using xoshiro128++
+ * generator in \p state (see rocrand_normal_double_ziggurat(rocrand_state_xorwow *)).
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_normal_double_ziggurat(rocrand_state_xoshiro128pp * state)
+{
+    return rocrand_device::detail::ziggurat_normal_double(*state);
+}
+
+/**
+ * \brief Returns two normally distributed \p float values.
+ *
+ * Generates and returns two normally distributed \p float values using PCG32
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The state has no room for a saved value, so normally distributed values
+ * are generated in pairs by the Box-Muller transform.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p float values as \p float2
+ */
+FQUALIFIERS
+float2 rocrand_normal2(rocrand_state_pcg32 * state)
+{
+    return rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+}
+
+/**
+ * \brief Returns two normally distributed \p double values.
+ *
+ * Generates and returns two normally distributed \p double values using PCG32
+ * generator in \p state, and increments position of the generator by four.
+ * Used normal distribution has mean value equal to 0.0, and standard deviation
+ * equal to 1.0.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p double value as \p double2
+ */
+FQUALIFIERS
+double2 rocrand_normal_double2(rocrand_state_pcg32 * state)
+{
+    return rocrand_device::detail::normal_distribution_double2(
+        uint4 { rocrand(state), rocrand(state), rocrand(state), rocrand(state) }
+    );
+}
+
+/**
+ * \brief Returns a normally distributed \p float value using the ziggurat method.
+ *
+ * Generates and returns a normally distributed \p float value using PCG32
+ * generator in \p state (see rocrand_normal_ziggurat(rocrand_state_xorwow *)).
+ * The ziggurat method does not need a saved value, so single values are available
+ * for the state.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_normal_ziggurat(rocrand_state_pcg32 * state)
+{
+    return rocrand_device::detail::ziggurat_normal(*state);
+}
+
+/**
+ * \brief Returns a normally distributed \p double value using the ziggurat method.
+ *
+ * Generates and returns a normally distributed \p double value using PCG32
+ * generator in \p state (see rocrand_normal_double_ziggurat(rocrand_state_xorwow *)).
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_normal_double_ziggurat(rocrand_state_pcg32 * state)
+{
+    return rocrand_device::detail::ziggurat_normal_double(*state);
 }
 
 #endif // ROCRAND_NORMAL_H_
@@ -0,0 +1,486 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_NORMAL_ZIGGURAT_PRECOMPUTED_H_
+#define ROCRAND_NORMAL_ZIGGURAT_PRECOMPUTED_H_
+
+// Auto-generated file. Do not edit!
+// Generated by tools/normal_ziggurat_generator
+
+#define ROCRAND_ZIGGURAT_LAYERS 128
+#define ROCRAND_ZIGGURAT_R 3.442619855899
+
+ROCRAND_DEVICE_TABLE const __constant__ unsigned int d_ziggurat_k32[ROCRAND_ZIGGURAT_LAYERS]
+#if defined(ROCRAND_DEVICE_TABLE_DEFINITIONS)
+    =
+    {
+        15555140U, 0U, 12590646U, 14272655U,
+        14988941U, 15384586U, 15635011U, 15807563U,
+        15933579U, 16029596U, 16105157U, 16166149U,
+        16216401U, 16258510U, 16294297U, 16325080U,
+        16351833U, 16375293U, 16396028U, 16414481U,
+        16431004U, 16445882U, 16459345U, 16471580U,
+        16482746U, 16492973U, 16502371U, 16511033U,
+        16519041U, 16526461U, 16533355U, 16539771U,
+        16545757U, 16551350U, 16556586U, 16561495U,
+        16566103U, 16570436U, 16574514U, 16578356U,
+        16581979U, 16585400U, 16588632U, 16591687U,
+        16594578U, 16597313U, 16599904U, 16602357U,
+        16604681U, 16606884U, 16608971U, 16610948U,
+        16612821U, 16614596U, 16616275U, 16617864U,
+        16619366U, 16620785U, 16622124U, 16623386U,
+        16624574U, 16625689U, 16626734U, 16627712U,
+        16628623U, 16629469U, 16630252U, 16630973U,
+        16631633U, 16632232U, 16632772U, 16633253U,
+        16633676U, 16634040U, 16634345U, 16634592U,
+        16634780U, 16634909U, 16634978U, 16634986U,
+        16634933U, 16634816U, 16634636U, 16634389U,
+        16634074U, 16633688U, 16633230U, 16632697U,
+        16632084U, 16631389U, 16630608U, 16629736U,
+        16628767U, 16627697U, 16626519U, 16625225U,
+        16623807U, 16622256U, 16620562U, 16618713U,
+        16616695U, 16614493U, 16612090U, 16609464U,
+        16606592U, 16603448U, 16599998U, 16596205U,
+        16592024U, 16587401U, 16582272U, 16576558U,
+        16570162U, 16562964U, 16554811U, 16545510U,
+        16534808U, 16522367U, 16507732U, 16490264U,
+        16469044U, 16442689U, 16409025U, 16364393U,
+        16302110U, 16208407U, 16049218U, 15707337U,
+    }
+#endif
+    ;
+
+static const unsigned int h_ziggurat_k32[ROCRAND_ZIGGURAT_LAYERS] =
+    {
+        15555140U, 0U, 12590646U, 14272655U,
+        14988941U, 15384586U, 15635011U, 15807563U,
+        15933579U, 16029596U, 16105157U, 16166149U,
+        16216401U, 16258510U, 16294297U, 16325080U,
+        16351833U, 16375293U, 16396028U, 16414481U,
+        16431004U, 16445882U, 16459345U, 16471580U,
+        16482746U, 16492973U, 16502371U, 16511033U,
+        16519041U, 16526461U, 16533355U, 16539771U,
+        16545757U, 16551350U, 16556586U, 16561495U,
+        16566103U, 16570436U, 16574514U, 16578356U,
+        16581979U, 16585400U, 16588632U, 16591687U,
+        16594578U, 16597313U, 16599904U, 16602357U,
+        16604681U, 16606884U, 16608971U, 16610948U,
+        16612821U, 16614596U, 16616275U, 16617864U,
+        16619366U, 16620785U, 16622124U, 16623386U,
+        16624574U, 16625689U, 16626734U, 16627712U,
+        16628623U, 16629469U, 16630252U, 16630973U,
+        16631633U, 16632232U, 16632772U, 16633253U,
+        16633676U, 16634040U, 16634345U, 16634592U,
+        16634780U, 16634909U, 16634978U, 16634986U,
+        16634933U, 16634816U, 16634636U, 16634389U,
+        16634074U, 16633688U, 16633230U, 16632697U,
+        16632084U, 16631389U, 16630608U, 16629736U,
+        16628767U, 16627697U, 16626519U, 16625225U,
+        16623807U, 16622256U, 16620562U, 16618713U,
+        16616695U, 16614493U, 16612090U, 16609464U,
+        16606592U, 16603448U, 16599998U, 16596205U,
+        16592024U, 16587401U, 16582272U, 16576558U,
+        16570162U, 16562964U, 16554811U, 16545510U,
+        16534808U, 16522367U, 16507732U, 16490264U,
+        16469044U, 16442689U, 16409025U, 16364393U,
+        16302110U, 16208407U, 16049218U, 15707337U,
+    };
+
+ROCRAND_DEVICE_TABLE const __constant__ float d_ziggurat_w32[ROCRAND_ZIGGURAT_LAYERS]
+#if defined(ROCRAND_DEVICE_TABLE_DEFINITIONS)
+    =
+    {
+        2.21317187e-07f, 1.62315884e-08f, 2.16288227e-08f, 2.54242412e-08f,
+        2.84575127e-08f, 3.10335182e-08f, 3.33006488e-08f, 3.53433456e-08f,
+        3.72146724e-08f, 3.89503621e-08f, 4.05757379e-08f, 4.21094663e-08f,
+        4.35657448e-08f, 4.49556508e-08f, 4.62880127e-08f, 4.75699938e-08f,
+        4.88074962e-08f, 5.00054487e-08f, 5.11680152e-08f, 5.22987502e-08f,
+        5.34007163e-08f, 5.44765741e-08f, 5.55286525e-08f, 5.65590039e-08f,
+        5.75694489e-08f, 5.85616114e-08f, 5.95369478e-08f, 6.04967711e-08f,
+        6.14422700e-08f, 6.23745263e-08f, 6.32945278e-08f, 6.42031804e-08f,
+        6.51013182e-08f, 6.59897117e-08f, 6.68690755e-08f, 6.77400739e-08f,
+        6.86033274e-08f, 6.94594166e-08f, 7.03088870e-08f, 7.11522524e-08f,
+        7.19899982e-08f, 7.28225845e-08f, 7.36504485e-08f, 7.44740069e-08f,
+        7.52936579e-08f, 7.61097833e-08f, 7.69227500e-08f, 7.77329117e-08f,
+        7.85406103e-08f, 7.93461770e-08f, 8.01499338e-08f, 8.09521946e-08f,
+        8.17532660e-08f, 8.25534485e-08f, 8.33530375e-08f, 8.41523237e-08f,
+        8.49515947e-08f, 8.57511352e-08f, 8.65512277e-08f, 8.73521541e-08f,
+        8.81541954e-08f, 8.89576330e-08f, 8.97627495e-08f, 9.05698290e-08f,
+        9.13791584e-08f, 9.21910274e-08f, 9.30057301e-08f, 9.38235650e-08f,
+        9.46448365e-08f, 9.54698551e-08f, 9.62989387e-08f, 9.71324134e-08f,
+        9.79706142e-08f, 9.88138867e-08f, 9.96625873e-08f, 1.00517085e-07f,
+        1.01377762e-07f, 1.02245017e-07f, 1.03119264e-07f, 1.04000934e-07f,
+        1.04890479e-07f, 1.05788374e-07f, 1.06695115e-07f, 1.07611225e-07f,
+        1.08537257e-07f, 1.09473792e-07f, 1.10421450e-07f, 1.11380884e-07f,
+        1.12352791e-07f, 1.13337913e-07f, 1.14337045e-07f, 1.15351035e-07f,
+        1.16380795e-07f, 1.17427305e-07f, 1.18491624e-07f, 1.19574897e-07f,
+        1.20678364e-07f, 1.21803375e-07f, 1.22951405e-07f, 1.24124064e-07f,
+        1.25323125e-07f, 1.26550538e-07f, 1.27808463e-07f, 1.29099297e-07f,
+        1.30425717e-07f, 1.31790722e-07f, 1.33197689e-07f, 1.34650443e-07f,
+        1.36153344e-07f, 1.37711387e-07f, 1.39330342e-07f, 1.41016923e-07f,
+        1.42779009e-07f, 1.44625941e-07f, 1.46568905e-07f, 1.48621471e-07f,
+        1.50800328e-07f, 1.53126337e-07f, 1.55626073e-07f, 1.58334161e-07f,
+        1.61296938e-07f, 1.64578520e-07f, 1.68271384e-07f, 1.72516346e-07f,
+        1.77544132e-07f, 1.83774761e-07f, 1.92110836e-07f, 2.05196134e-07f,
+    }
+#endif
+    ;
+
+static const float h_ziggurat_w32[ROCRAND_ZIGGURAT_LAYERS] =
+    {
+        2.21317187e-07f, 1.62315884e-08f, 2.16288227e-08f, 2.54242412e-08f,
+        2.84575127e-08f, 3.10335182e-08f, 3.33006488e-08f, 3.53433456e-08f,
+        3.72146724e-08f, 3.89503621e-08f, 4.05757379e-08f, 4.21094663e-08f,
+        4.35657448e-08f, 4.49556508e-08f, 4.62880127e-08f, 4.75699938e-08f,
+        4.88074962e-08f, 5.00054487e-08f, 5.11680152e-08f, 5.22987502e-08f,
+        5.34007163e-08f, 5.44765741e-08f, 5.55286525e-08f, 5.65590039e-08f,
+        5.75694489e-08f, 5.85616114e-08f, 5.95369478e-08f, 6.04967711e-08f,
+        6.14422700e-08f, 6.23745263e-08f, 6.32945278e-08f, 6.42031804e-08f,
+        6.51013182e-08f, 6.59897117e-08f, 6.68690755e-08f, 6.77400739e-08f,
+        6.86033274e-08f, 6.94594166e-08f, 7.03088870e-08f, 7.11522524e-08f,
+        7.19899982e-08f, 7.28225845e-08f, 7.36504485e-08f, 7.44740069e-08f,
+        7.52936579e-08f, 7.61097833e-08f, 7.69227500e-08f, 7.77329117e-08f,
+        7.85406103e-08f, 7.93461770e-08f, 8.01499338e-08f, 8.09521946e-08f,
+        8.17532660e-08f, 8.25534485e-08f, 8.33530375e-08f, 8.41523237e-08f,
+        8.49515947e-08f, 8.57511352e-08f, 8.65512277e-08f, 8.73521541e-08f,
+        8.81541954e-08f, 8.89576330e-08f, 8.97627495e-08f, 9.05698290e-08f,
+        9.13791584e-08f, 9.21910274e-08f, 9.30057301e-08f, 9.38235650e-08f,
+        9.46448365e-08f, 9.54698551e-08f, 9.62989387e-08f, 9.71324134e-08f,
+        9.79706142e-08f, 9.88138867e-08f, 9.96625873e-08f, 1.00517085e-07f,
+        1.01377762e-07f, 1.02245017e-07f, 1.03119264e-07f, 1.04000934e-07f,
+        1.04890479e-07f, 1.05788374e-07f, 1.06695115e-07f, 1.07611225e-07f,
+        1.08537257e-07f, 1.09473792e-07f, 1.10421450e-07f, 1.11380884e-07f,
+        1.12352791e-07f, 1.13337913e-07f, 1.14337045e-07f, 1.15351035e-07f,
+        1.16380795e-07f, 1.17427305e-07f, 1.18491624e-07f, 1.19574897e-07f,
+        1.20678364e-07f, 1.21803375e-07f, 1.22951405e-07f, 1.24124064e-07f,
+        1.25323125e-07f, 1.26550538e-07f, 1.27808463e-07f, 1.29099297e-07f,
+        1.30425717e-07f, 1.31790722e-07f, 1.33197689e-07f, 1.34650443e-07f,
+        1.36153344e-07f, 1.37711387e-07f, 1.39330342e-07f, 1.41016923e-07f,
+        1.42779009e-07f, 1.44625941e-07f, 1.46568905e-07f, 1.48621471e-07f,
+        1.50800328e-07f, 1.53126337e-07f, 1.55626073e-07f, 1.58334161e-07f,
+        1.61296938e-07f, 1.64578520e-07f, 1.68271384e-07f, 1.72516346e-07f,
+        1.77544132e-07f, 1.83774761e-07f, 1.92110836e-07f, 2.05196134e-07f,
+    };
+
+ROCRAND_DEVICE_TABLE const __constant__ float d_ziggurat_f32[ROCRAND_ZIGGURAT_LAYERS]
+#if defined(ROCRAND_DEVICE_TABLE_DEFINITIONS)
+    =
+    {
+        1.00000000e+00f, 9.63599693e-01f, 9.36282682e-01f, 9.13043648e-01f,
+        8.92281651e-01f, 8.73243049e-01f, 8.55500608e-01f, 8.38783605e-01f,
+        8.22907211e-01f, 8.07738295e-01f, 7.93177012e-01f, 7.79146086e-01f,
+        7.65584174e-01f, 7.52441559e-01f, 7.39677244e-01f, 7.27256918e-01f,
+        7.15151507e-01f, 7.03336099e-01f, 6.91789143e-01f, 6.80491841e-01f,
+        6.69427667e-01f, 6.58582000e-01f, 6.47941821e-01f, 6.37495477e-01f,
+        6.27232485e-01f, 6.17143371e-01f, 6.07219537e-01f, 5.97453151e-01f,
+        5.87837054e-01f, 5.78364681e-01f, 5.69029991e-01f, 5.59827413e-01f,
+        5.50751793e-01f, 5.41798355e-01f, 5.32962659e-01f, 5.24240573e-01f,
+        5.15628238e-01f, 5.07122051e-01f, 4.98718635e-01f, 4.90414825e-01f,
+        4.82207646e-01f, 4.74094301e-01f, 4.66072153e-01f, 4.58138716e-01f,
+        4.50291644e-01f, 4.42528715e-01f, 4.34847830e-01f, 4.27246998e-01f,
+        4.19724332e-01f, 4.12278040e-01f, 4.04906421e-01f, 3.97607856e-01f,
+        3.90380808e-01f, 3.83223811e-01f, 3.76135470e-01f, 3.69114454e-01f,
+        3.62159495e-01f, 3.55269385e-01f, 3.48442968e-01f, 3.41679141e-01f,
+        3.34976853e-01f, 3.28335098e-01f, 3.21752916e-01f, 3.15229388e-01f,
+        3.08763638e-01f, 3.02354828e-01f, 2.96002157e-01f, 2.89704860e-01f,
+        2.83462208e-01f, 2.77273503e-01f, 2.71138079e-01f, 2.65055302e-01f,
+        2.59024567e-01f, 2.53045299e-01f, 2.47116948e-01f, 2.41238994e-01f,
+        2.35410942e-01f, 2.29632325e-01f, 2.23902699e-01f, 2.18221647e-01f,
+        2.12588773e-01f, 2.07003709e-01f, 2.01466110e-01f, 1.95975653e-01f,
+        1.90532040e-01f, 1.85134997e-01f, 1.79784272e-01f, 1.74479638e-01f,
+        1.69220892e-01f, 1.64007855e-01f, 1.58840371e-01f, 1.53718312e-01f,
+        1.48641574e-01f, 1.43610080e-01f, 1.38623780e-01f, 1.33682653e-01f,
+        1.28786706e-01f, 1.23935980e-01f, 1.19130547e-01f, 1.14370512e-01f,
+        1.09656021e-01f, 1.04987255e-01f, 1.00364441e-01f, 9.57878491e-02f,
+        9.12578008e-02f, 8.67746719e-02f, 8.23388982e-02f, 7.79509825e-02f,
+        7.36115019e-02f, 6.93211174e-02f, 6.50805852e-02f, 6.08907703e-02f,
+        5.67526635e-02f, 5.26674019e-02f, 4.86362959e-02f, 4.46608622e-02f,
+        4.07428681e-02f, 3.68843888e-02f, 3.30878861e-02f, 2.93563174e-02f,
+        2.56932919e-02f, 2.21033046e-02f, 1.85921027e-02f, 1.51672980e-02f,
+        1.18394787e-02f, 8.62448441e-03f, 5.54899522e-03f, 2.66962908e-03f,
+    }
+#endif
+    ;
+
+static const float h_ziggurat_f32[ROCRAND_ZIGGURAT_LAYERS] =
+    {
+        1.00000000e+00f, 9.63599693e-01f, 9.36282682e-01f, 9.13043648e-01f,
+        8.92281651e-01f, 8.73243049e-01f, 8.55500608e-01f, 8.38783605e-01f,
+        8.22907211e-01f, 8.07738295e-01f, 7.93177012e-01f, 7.79146086e-01f,
+        7.65584174e-01f, 7.52441559e-01f, 7.39677244e-01f, 7.27256918e-01f,
+        7.15151507e-01f, 7.03336099e-01f, 6.91789143e-01f, 6.80491841e-01f,
+        6.69427667e-01f, 6.58582000e-01f, 6.47941821e-01f, 6.37495477e-01f,
+        6.27232485e-01f, 6.17143371e-01f, 6.07219537e-01f, 5.97453151e-01f,
+        5.87837054e-01f, 5.78364681e-01f, 5.69029991e-01f, 5.59827413e-01f,
+        5.50751793e-01f, 5.41798355e-01f, 5.32962659e-01f, 5.24240573e-01f,
+        5.15628238e-01f, 5.07122051e-01f, 4.98718635e-01f, 4.90414825e-01f,
+        4.82207646e-01f, 4.74094301e-01f, 4.66072153e-01f, 4.58138716e-01f,
+        4.50291644e-01f, 4.42528715e-01f, 4.34847830e-01f, 4.27246998e-01f,
+        4.19724332e-01f, 4.12278040e-01f, 4.04906421e-01f, 3.97607856e-01f,
+        3.90380808e-01f, 3.83223811e-01f, 3.76135470e-01f, 3.69114454e-01f,
+        3.62159495e-01f, 3.55269385e-01f, 3.48442968e-01f, 3.41679141e-01f,
+        3.34976853e-01f, 3.28335098e-01f, 3.21752916e-01f, 3.15229388e-01f,
+        3.08763638e-01f, 3.02354828e-01f, 2.96002157e-01f, 2.89704860e-01f,
+        2.83462208e-01f, 2.77273503e-01f, 2.71138079e-01f, 2.65055302e-01f,
+        2.59024567e-01f, 2.53045299e-01f, 2.47116948e-01f, 2.41238994e-01f,
+        2.35410942e-01f, 2.29632325e-01f, 2.23902699e-01f, 2.18221647e-01f,
+        2.12588773e-01f, 2.07003709e-01f, 2.01466110e-01f, 1.95975653e-01f,
+        1.90532040e-01f, 1.85134997e-01f, 1.79784272e-01f, 1.74479638e-01f,
+        1.69220892e-01f, 1.64007855e-01f, 1.58840371e-01f, 1.53718312e-01f,
+        1.48641574e-01f, 1.43610080e-01f, 1.38623780e-01f, 1.33682653e-01f,
+        1.28786706e-01f, 1.23935980e-01f, 1.19130547e-01f, 1.14370512e-01f,
+        1.09656021e-01f, 1.04987255e-01f, 1.00364441e-01f, 9.57878491e-02f,
+        9.12578008e-02f, 8.67746719e-02f, 8.23388982e-02f, 7.79509825e-02f,
+        7.36115019e-02f, 6.93211174e-02f, 6.50805852e-02f, 6.08907703e-02f,
+        5.67526635e-02f, 5.26674019e-02f, 4.86362959e-02f, 4.46608622e-02f,
+        4.07428681e-02f, 3.68843888e-02f, 3.30878861e-02f, 2.93563174e-02f,
+        2.56932919e-02f, 2.21033046e-02f, 1.85921027e-02f, 1.51672980e-02f,
+        1.18394787e-02f, 8.62448441e-03f, 5.54899522e-03f, 2.66962908e-03f,
+    };
+
+ROCRAND_DEVICE_TABLE const __constant__ unsigned long long d_ziggurat_k64[ROCRAND_ZIGGURAT_LAYERS]
+#if defined(ROCRAND_DEVICE_TABLE_DEFINITIONS)
+    =
+    {
+        8351102274452508ULL, 0ULL, 6759551952566828ULL, 7662573469566167ULL,
+        8047126567441105ULL, 8259536838386980ULL, 8393983065371854ULL, 8486621022240569ULL,
+        8554275373649060ULL, 8605824214024733ULL, 8646390457358823ULL, 8679135317313479ULL,
+        8706114288268560ULL, 8728721234883406ULL, 8747934524364677ULL, 8764460971287767ULL,
+        8778823859819918ULL, 8791418834681182ULL, 8802550552536503ULL, 8812457397257276ULL,
+        8821328558359813ULL, 8829316089474252ULL, 8836543587138336ULL, 8843112545225683ULL,
+        8849107079942569ULL, 8854597492686141ULL, 8859642990979875ULL, 8864293790715872ULL,
+        8868592757779167ULL, 8872576702609580ULL, 8876277410359159ULL, 8879722467550060ULL,
+        8882935930618173ULL, 8885938870518822ULL, 8888749819382260ULL, 8891385139160551ULL,
+        8893859327698747ULL, 8896185274269541ULL, 8898374474033763ULL, 8900437208916404ULL,
+        8902382700865921ULL, 8904219242281779ULL, 8905954307469686ULL, 8907594648254903ULL,
+        8909146376306227ULL, 8910615034262604ULL, 8912005657384986ULL, 8913322827158353ULL,
+        8914570718027662ULL, 8915753138255073ULL, 8916873565725229ULL, 8917935179393317ULL,
+        8918940886961730ULL, 8919893349280828ULL, 8920795001894133ULL, 8921648074085459ULL,
+        8922454605732769ULL, 8923216462229077ULL, 8923935347693140ULL, 8924612816660687ULL,
+        8925250284419639ULL, 8925849036129327ULL, 8926410234843490ULL, 8926934928539257ULL,
+        8927424056238948ULL, 8927878453297973ULL, 8928298855920025ULL, 8928685904949916ULL,
+        8929040148984441ULL, 8929362046832535ULL, 8929651969347272ULL, 8929910200643991ULL,
+        8930136938710698ULL, 8930332295408727ULL, 8930496295853339ULL, 8930628877155235ULL,
+        8930729886494664ULL, 8930799078489741ULL, 8930836111809436ULL, 8930840544969162ULL,
+        8930811831232705ULL, 8930749312527813ULL, 8930652212263775ULL, 8930519626917003ULL,
+        8930350516224262ULL, 8930143691791883ULL, 8929897803891708ULL, 8929611326169320ULL,
+        8929282537935327ULL, 8928909503643699ULL, 8928490049079407ULL, 8928021733676853ULL,
+        8927501818265807ULL, 8926927227386036ULL, 8926294505116890ULL, 8925599763122263ULL,
+        8924838619299159ULL, 8924006125019160ULL, 8923096678438398ULL, 8922103920685314ULL,
+        8921020610864137ULL, 8919838474662843ULL, 8918548019824895ULL, 8917138309688771ULL,
+        8915596683208440ULL, 8913908406036187ULL, 8912056231924693ULL, 8910019846210725ULL,
+        8907775152445216ULL, 8905293347731794ULL, 8902539709494988ULL, 8899471982132675ULL,
+        8896038199566179ULL, 8892173697663238ULL, 8887796938997365ULL, 8882803555753490ULL,
+        8877057648535482ULL, 8870378731389162ULL, 8862521528037470ULL, 8853143551576412ULL,
+        8841750799172912ULL, 8827601958366750ULL, 8809528315256632ULL, 8785566778453576ULL,
+        8752128774404123ULL, 8701822634880684ULL, 8616358801204842ULL, 8432812766515877ULL,
+    }
+#endif
+    ;
+
+static const unsigned long long h_ziggurat_k64[ROCRAND_ZIGGURAT_LAYERS] =
+    {
+        8351102274452508ULL, 0ULL, 6759551952566828ULL, 7662573469566167ULL,
+        8047126567441105ULL, 8259536838386980ULL, 8393983065371854ULL, 8486621022240569ULL,
+        8554275373649060ULL, 8605824214024733ULL, 8646390457358823ULL, 8679135317313479ULL,
+        8706114288268560ULL, 8728721234883406ULL, 8747934524364677ULL, 8764460971287767ULL,
+        8778823859819918ULL, 8791418834681182ULL, 8802550552536503ULL, 8812457397257276ULL,
+        8821328558359813ULL, 8829316089474252ULL, 8836543587138336ULL, 8843112545225683ULL,
+        8849107079942569ULL, 8854597492686141ULL, 8859642990979875ULL, 8864293790715872ULL,
+        8868592757779167ULL, 8872576702609580ULL, 8876277410359159ULL, 8879722467550060ULL,
+        8882935930618173ULL, 8885938870518822ULL, 8888749819382260ULL, 8891385139160551ULL,
+        8893859327698747ULL, 8896185274269541ULL, 8898374474033763ULL, 8900437208916404ULL,
+        8902382700865921ULL, 8904219242281779ULL, 8905954307469686ULL, 8907594648254903ULL,
+        8909146376306227ULL, 8910615034262604ULL, 8912005657384986ULL, 8913322827158353ULL,
+        8914570718027662ULL, 8915753138255073ULL, 8916873565725229ULL, 8917935179393317ULL,
+        8918940886961730ULL, 8919893349280828ULL, 8920795001894133ULL, 8921648074085459ULL,
+        8922454605732769ULL, 8923216462229077ULL, 8923935347693140ULL, 8924612816660687ULL,
+        8925250284419639ULL, 8925849036129327ULL, 8926410234843490ULL, 8926934928539257ULL,
+        8927424056238948ULL, 8927878453297973ULL, 8928298855920025ULL, 8928685904949916ULL,
+        8929040148984441ULL, 8929362046832535ULL, 8929651969347272ULL, 8929910200643991ULL,
+        8930136938710698ULL, 8930332295408727ULL, 8930496295853339ULL, 8930628877155235ULL,
+        8930729886494664ULL, 8930799078489741ULL, 8930836111809436ULL, 8930840544969162ULL,
+        8930811831232705ULL, 8930749312527813ULL, 8930652212263775ULL, 8930519626917003ULL,
+        8930350516224262ULL, 8930143691791883ULL, 8929897803891708ULL, 8929611326169320ULL,
+        8929282537935327ULL, 8928909503643699ULL, 8928490049079407ULL, 8928021733676853ULL,
+        8927501818265807ULL, 8926927227386036ULL, 8926294505116890ULL, 8925599763122263ULL,
+        8924838619299159ULL, 8924006125019160ULL, 8923096678438398ULL, 8922103920685314ULL,
+        8921020610864137ULL, 8919838474662843ULL, 8918548019824895ULL, 8917138309688771ULL,
+        8915596683208440ULL, 8913908406036187ULL, 8912056231924693ULL, 8910019846210725ULL,
+        8907775152445216ULL, 8905293347731794ULL, 8902539709494988ULL, 8899471982132675ULL,
+        8896038199566179ULL, 8892173697663238ULL, 8887796938997365ULL, 8882803555753490ULL,
+        8877057648535482ULL, 8870378731389162ULL, 8862521528037470ULL, 8853143551576412ULL,
+        8841750799172912ULL, 8827601958366750ULL, 8809528315256632ULL, 8785566778453576ULL,
+        8752128774404123ULL, 8701822634880684ULL, 8616358801204842ULL, 8432812766515877ULL,
+    };
+
+ROCRAND_DEVICE_TABLE const __constant__ double d_ziggurat_w64[ROCRAND_ZIGGURAT_LAYERS]
+#if defined(ROCRAND_DEVICE_TABLE_DEFINITIONS)
+    =
+    {
+        4.1223538435525812e-16, 3.0233689420227381e-17, 4.0286821778259037e-17, 4.7356339555927634e-17,
+        5.3006247979401443e-17, 5.7804432214375905e-17, 6.2027292014674524e-17, 6.5832111148127696e-17,
+        6.9317729038514380e-17, 7.2550703082981921e-17, 7.5578201327214309e-17, 7.8434993093282775e-17,
+        8.1147523216805083e-17, 8.3736424955521812e-17, 8.6218142391598136e-17, 8.8606018149756393e-17,
+        9.0911046102299173e-17, 9.3142406487342437e-17, 9.5307855296079461e-17, 9.7414013423882078e-17,
+        9.9466585255051807e-17, 1.0147052653930774e-16, 1.0343017515958534e-16, 1.0534935429699110e-16,
+        1.0723145476023117e-16, 1.0907950137755427e-16, 1.1089620704984652e-16, 1.1268401714518455e-16,
+        1.1444514625626929e-16, 1.1618160886284673e-16, 1.1789524508807565e-16, 1.1958774247454654e-16,
+        1.2126065450726865e-16, 1.2291541645992707e-16, 1.2455335902467500e-16, 1.2617572009578453e-16,
+        1.2778365500719257e-16, 1.2937824546863097e-16, 1.3096050740113282e-16, 1.3253139783765702e-16,
+        1.3409182102641051e-16, 1.3564263385168408e-16, 1.3718465066851597e-16, 1.3871864763238163e-16,
+        1.4024536659269714e-16, 1.4176551860868896e-16, 1.4327978713770611e-16, 1.4478883093900381e-16,
+        1.4629328673014940e-16, 1.4779377162828234e-16, 1.4929088540433453e-16, 1.5078521257484892e-16,
+        1.5227732435311620e-16, 1.5376778047889170e-16, 1.5525713094388696e-16, 1.5674591762849307e-16,
+        1.5823467586373964e-16, 1.5972393593128425e-16, 1.6121422451323115e-16, 1.6270606610277005e-16,
+        1.6419998438598455e-16, 1.6569650360469007e-16, 1.6719614990980977e-16, 1.6869945271457559e-16,
+        1.7020694605674366e-16, 1.7171916997903533e-16, 1.7323667193715668e-16, 1.7476000824501172e-16,
+        1.7628974556711247e-16, 1.7782646246870833e-16, 1.7937075103481966e-16, 1.8092321857017629e-16,
+        1.8248448939304966e-16, 1.8405520673714627e-16, 1.8563603477712573e-16, 1.8722766079494933e-16,
+        1.8883079750619153e-16, 1.9044618556770157e-16, 1.9207459629063997e-16, 1.9371683458599954e-16,
+        1.9537374217333172e-16, 1.9704620108763262e-16, 1.9873513752431485e-16, 2.0044152606804335e-16,
+        2.0216639435811915e-16, 2.0391082825126858e-16, 2.0567597755239862e-16, 2.0746306239543960e-16,
+        2.0927338037021825e-16, 2.1110831450789626e-16, 2.1296934225750839e-16, 2.1485804561034680e-16,
+        2.1677612255838814e-16, 2.1872540010895730e-16, 2.2070784912205031e-16, 2.2272560129138154e-16,
+        2.2478096865812088e-16, 2.2687646613118362e-16, 2.2901483759477734e-16, 2.3119908631930210e-16,
+        2.3343251056453936e-16, 2.3571874548644356e-16, 2.3806181274736934e-16, 2.4046617960725951e-16,
+        2.4293682977250525e-16, 2.4547934894577659e-16, 2.4810002892017056e-16, 2.5080599529094783e-16,
+        2.5360536556079079e-16, 2.5650744680513903e-16, 2.5952298547285278e-16, 2.6266448684060678e-16,
+        2.6594662894242197e-16, 2.6938680680974045e-16, 2.7300585985344022e-16, 2.7682906212859981e-16,
+        2.8088749908104253e-16, 2.8522002825381171e-16, 2.8987615068663511e-16, 2.9492035605442441e-16,
+        3.0043895961304960e-16, 3.0655138121140367e-16, 3.1342987655823666e-16, 3.2133673577811369e-16,
+        3.3070171630542378e-16, 3.4230716685810990e-16, 3.5783431602056009e-16, 3.8220758290508083e-16,
+    }
+#endif
+    ;
+
+static const double h_ziggurat_w64[ROCRAND_ZIGGURAT_LAYERS] =
+    {
+        4.1223538435525812e-16, 3.0233689420227381e-17, 4.0286821778259037e-17, 4.7356339555927634e-17,
+        5.3006247979401443e-17, 5.7804432214375905e-17, 6.2027292014674524e-17, 6.5832111148127696e-17,
+        6.9317729038514380e-17, 7.2550703082981921e-17, 7.5578201327214309e-17, 7.8434993093282775e-17,
+        8.1147523216805083e-17, 8.3736424955521812e-17, 8.6218142391598136e-17, 8.8606018149756393e-17,
+        9.0911046102299173e-17, 9.3142406487342437e-17, 9.5307855296079461e-17, 9.7414013423882078e-17,
+        9.9466585255051807e-17, 1.0147052653930774e-16, 1.0343017515958534e-16, 1.0534935429699110e-16,
+        1.0723145476023117e-16, 1.0907950137755427e-16, 1.1089620704984652e-16, 1.1268401714518455e-16,
+        1.1444514625626929e-16, 1.1618160886284673e-16, 1.1789524508807565e-16, 1.1958774247454654e-16,
+        1.2126065450726865e-16, 1.2291541645992707e-16, 1.2455335902467500e-16, 1.2617572009578453e-16,
+        1.2778365500719257e-16, 1.2937824546863097e-16, 1.3096050740113282e-16, 1.3253139783765702e-16,
+        1.3409182102641051e-16, 1.3564263385168408e-16, 1.3718465066851597e-16, 1.3871864763238163e-16,
+        1.4024536659269714e-16, 1.4176551860868896e-16, 1.4327978713770611e-16, 1.4478883093900381e-16,
+        1.4629328673014940e-16, 1.4779377162828234e-16, 1.4929088540433453e-16, 1.5078521257484892e-16,
+        1.5227732435311620e-16, 1.5376778047889170e-16, 1.5525713094388696e-16, 1.5674591762849307e-16,
+        1.5823467586373964e-16, 1.5972393593128425e-16, 1.6121422451323115e-16, 1.6270606610277005e-16,
+        1.6419998438598455e-16, 1.6569650360469007e-16, 1.6719614990980977e-16, 1.6869945271457559e-16,
+        1.7020694605674366e-16, 1.7171916997903533e-16, 1.7323667193715668e-16, 1.7476000824501172e-16,
+        1.7628974556711247e-16, 1.7782646246870833e-16, 1.7937075103481966e-16, 1.8092321857017629e-16,
+        1.8248448939304966e-16, 1.8405520673714627e-16, 1.8563603477712573e-16, 1.8722766079494933e-16,
+        1.8883079750619153e-16, 1.9044618556770157e-16, 1.9207459629063997e-16, 1.9371683458599954e-16,
+        1.9537374217333172e-16, 1.9704620108763262e-16, 1.9873513752431485e-16, 2.0044152606804335e-16,
+        2.0216639435811915e-16, 2.0391082825126858e-16, 2.0567597755239862e-16, 2.0746306239543960e-16,
+        2.0927338037021825e-16, 2.1110831450789626e-16, 2.1296934225750839e-16, 2.1485804561034680e-16,
+        2.1677612255838814e-16, 2.1872540010895730e-16, 2.2070784912205031e-16, 2.2272560129138154e-16,
+        2.2478096865812088e-16, 2.2687646613118362e-16, 2.2901483759477734e-16, 2.3119908631930210e-16,
+        2.3343251056453936e-16, 2.3571874548644356e-16, 2.3806181274736934e-16, 2.4046617960725951e-16,
+        2.4293682977250525e-16, 2.4547934894577659e-16, 2.4810002892017056e-16, 2.5080599529094783e-16,
+        2.5360536556079079e-16, 2.5650744680513903e-16, 2.5952298547285278e-16, 2.6266448684060678e-16,
+        2.6594662894242197e-16, 2.6938680680974045e-16, 2.7300585985344022e-16, 2.7682906212859981e-16,
+        2.8088749908104253e-16, 2.8522002825381171e-16, 2.8987615068663511e-16, 2.9492035605442441e-16,
+        3.0043895961304960e-16, 3.0655138121140367e-16, 3.1342987655823666e-16, 3.2133673577811369e-16,
+        3.3070171630542378e-16, 3.4230716685810990e-16, 3.5783431602056009e-16, 3.8220758290508083e-16,
+    };
+
+ROCRAND_DEVICE_TABLE const __constant__ double d_ziggurat_f64[ROCRAND_ZIGGURAT_LAYERS]
+#if defined(ROCRAND_DEVICE_TABLE_DEFINITIONS)
+    =
+    {
+        1.0000000000000000e+00, 9.6359969312709193e-01, 9.3628268168506433e-01, 9.1304364797174439e-01,
+        8.9228165078402991e-01, 8.7324304891007306e-01, 8.5550060786945392e-01, 8.3878360529599281e-01,
+        8.2290721138141203e-01, 8.0773829468296346e-01, 7.9317701177130790e-01, 7.7914608592969044e-01,
+        7.6558417389770719e-01, 7.5244155917461400e-01, 7.3967724367264985e-01, 7.2725691834418733e-01,
+        7.1515150741050106e-01, 7.0333609901616047e-01, 6.9178914343667741e-01, 6.8049184099733632e-01,
+        6.6942766734889256e-01, 6.5858200005009018e-01, 6.4794182111022459e-01, 6.3749547733504437e-01,
+        6.2723248524992929e-01, 6.1714337081888288e-01, 6.0721953662512222e-01, 5.9745315094451855e-01,
+        5.8783705443470835e-01, 5.7836468111976489e-01, 5.6902999106795262e-01, 5.5982741270408839e-01,
+        5.5075179311460596e-01, 5.4179835502542681e-01, 5.3296265938383750e-01, 5.2424057267298546e-01,
+        5.1562823824400326e-01, 5.0712205107557037e-01, 4.9871863547098094e-01, 4.9041482528384556e-01,
+        4.8220764632948657e-01, 4.7409430069301826e-01, 4.6607215268945741e-01, 4.5813871626787330e-01,
+        4.5029164368204047e-01, 4.4252871527546970e-01, 4.3484783024999207e-01, 4.2724699830499729e-01,
+        4.1972433204957557e-01, 4.1227804010266223e-01, 4.0490642080722414e-01, 3.9760785649387452e-01,
+        3.9038080823731571e-01, 3.8322381105590226e-01, 3.7613546951056366e-01, 3.6911445366447327e-01,
+        3.6215949536931859e-01, 3.5526938484791817e-01, 3.4844296754632759e-01, 3.4167914123155141e-01,
+        3.3497685331359004e-01, 3.2833509837285104e-01, 3.2175291587598566e-01, 3.1522938806501165e-01,
+        3.0876363800618187e-01, 3.0235482778648428e-01, 2.9600215684693372e-01, 2.8970486044296058e-01,
+        2.8346220822323366e-01, 2.7727350291918880e-01, 2.7113807913838523e-01, 2.6505530225558971e-01,
+        2.5902456739620531e-01, 2.5304529850732621e-01, 2.4711694751232190e-01, 2.4123899354544033e-01,
+        2.3541094226347959e-01, 2.2963232523211664e-01, 2.2390269938500893e-01, 2.1822164655430587e-01,
+        2.1258877307173075e-01, 2.0700370943992698e-01, 2.0146611007431413e-01, 1.9597565311627820e-01,
+        1.9053204031913761e-01, 1.8513499700899264e-01, 1.7978427212329588e-01, 1.7447963833078988e-01,
+        1.6922089223736536e-01, 1.6400785468342067e-01, 1.5884037113947960e-01, 1.5371831220818198e-01,
+        1.4864157424234255e-01, 1.4361008009062807e-01, 1.3862377998459492e-01, 1.3368265258343965e-01,
+        1.2878670619594342e-01, 1.2393598020286800e-01, 1.1913054670765098e-01, 1.1437051244886615e-01,
+        1.0965602101484047e-01, 1.0498725540942145e-01, 1.0036444102865601e-01, 9.5787849121731541e-02,
+        9.1257800826830389e-02, 8.6774671894780307e-02, 8.2338898242235775e-02, 7.7950982513973481e-02,
+        7.3611501884113430e-02, 6.9321117393577928e-02, 6.5080585213068054e-02, 6.0890770348040423e-02,
+        5.6752663481049855e-02, 5.2667401903051015e-02, 4.8636295859867814e-02, 4.4660862200491441e-02,
+        4.0742868074444184e-02, 3.6884388786656226e-02, 3.3087886146225763e-02, 2.9356317440006853e-02,
+        2.5693291935934285e-02, 2.2103304615927097e-02, 1.8592102737011294e-02, 1.5167298010546573e-02,
+        1.1839478657884872e-02, 8.6244844128598922e-03, 5.5489952207713488e-03, 2.6696290838809253e-03,
+    }
+#endif
+    ;
+
+static const double h_ziggurat_f64[ROCRAND_ZIGGURAT_LAYERS] =
+    {
+        1.0000000000000000e+00, 9.6359969312709193e-01, 9.3628268168506433e-01, 9.1304364797174439e-01,
+        8.9228165078402991e-01, 8.7324304891007306e-01, 8.5550060786945392e-01, 8.3878360529599281e-01,
+        8.2290721138141203e-01, 8.0773829468296346e-01, 7.9317701177130790e-01, 7.7914608592969044e-01,
+        7.6558417389770719e-01, 7.5244155917461400e-01, 7.3967724367264985e-01, 7.2725691834418733e-01,
+        7.1515150741050106e-01, 7.0333609901616047e-01, 6.9178914343667741e-01, 6.8049184099733632e-01,
+        6.6942766734889256e-01, 6.5858200005009018e-01, 6.4794182111022459e-01, 6.3749547733504437e-01,
+        6.2723248524992929e-01, 6.1714337081888288e-01, 6.0721953662512222e-01, 5.9745315094451855e-01,
+        5.8783705443470835e-01, 5.7836468111976489e-01, 5.6902999106795262e-01, 5.5982741270408839e-01,
+        5.5075179311460596e-01, 5.4179835502542681e-01, 5.3296265938383750e-01, 5.2424057267298546e-01,
+        5.1562823824400326e-01, 5.0712205107557037e-01, 4.9871863547098094e-01, 4.9041482528384556e-01,
+        4.8220764632948657e-01, 4.7409430069301826e-01, 4.6607215268945741e-01, 4.5813871626787330e-01,
+        4.5029164368204047e-01, 4.4252871527546970e-01, 4.3484783024999207e-01, 4.2724699830499729e-01,
+        4.1972433204957557e-01, 4.1227804010266223e-01, 4.0490642080722414e-01, 3.9760785649387452e-01,
+        3.9038080823731571e-01, 3.8322381105590226e-01, 3.7613546951056366e-01, 3.6911445366447327e-01,
+        3.6215949536931859e-01, 3.5526938484791817e-01, 3.4844296754632759e-01, 3.4167914123155141e-01,
+        3.3497685331359004e-01, 3.2833509837285104e-01, 3.2175291587598566e-01, 3.1522938806501165e-01,
+        3.0876363800618187e-01, 3.0235482778648428e-01, 2.9600215684693372e-01, 2.8970486044296058e-01,
+        2.8346220822323366e-01, 2.7727350291918880e-01, 2.7113807913838523e-01, 2.6505530225558971e-01,
+        2.5902456739620531e-01, 2.5304529850732621e-01, 2.4711694751232190e-01, 2.4123899354544033e-01,
+        2.3541094226347959e-01, 2.2963232523211664e-01, 2.2390269938500893e-01, 2.1822164655430587e-01,
+        2.1258877307173075e-01, 2.0700370943992698e-01, 2.0146611007431413e-01, 1.9597565311627820e-01,
+        1.9053204031913761e-01, 1.8513499700899264e-01, 1.7978427212329588e-01, 1.7447963833078988e-01,
+        1.6922089223736536e-01, 1.6400785468342067e-01, 1.5884037113947960e-01, 1.5371831220818198e-01,
+        1.4864157424234255e-01, 1.4361008009062807e-01, 1.3862377998459492e-01, 1.3368265258343965e-01,
+        1.2878670619594342e-01, 1.2393598020286800e-01, 1.1913054670765098e-01, 1.1437051244886615e-01,
+        1.0965602101484047e-01, 1.0498725540942145e-01, 1.0036444102865601e-01, 9.5787849121731541e-02,
+        9.1257800826830389e-02, 8.6774671894780307e-02, 8.2338898242235775e-02, 7.7950982513973481e-02,
+        7.3611501884113430e-02, 6.9321117393577928e-02, 6.5080585213068054e-02, 6.0890770348040423e-02,
+        5.6752663481049855e-02, 5.2667401903051015e-02, 4.8636295859867814e-02, 4.4660862200491441e-02,
+        4.0742868074444184e-02, 3.6884388786656226e-02, 3.3087886146225763e-02, 2.9356317440006853e-02,
+        2.5693291935934285e-02, 2.2103304615927097e-02, 1.8592102737011294e-02, 1.5167298010546573e-02,
+        1.1839478657884872e-02, 8.6244844128598922e-03, 5.5489952207713488e-03, 2.6696290838809253e-03,
+    };
+
+#endif // ROCRAND_NORMAL_ZIGGURAT_PRECOMPUTED_H_
@@ -0,0 +1,275 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_PCG32_H_
+#define ROCRAND_PCG32_H_
+
+#ifndef FQUALIFIERS
+#define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS_
+
+#include "rocrand_common.h"
+
+// M. E. O'Neill, PCG: A Family of Simple Fast Space-Efficient Statistically
+// Good Algorithms for Random Number Generation, 2014
+// https://www.pcg-random.org/
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+ /**
+ * \def ROCRAND_PCG32_DEFAULT_SEED
+ * \brief Default seed for PCG32 PRNG.
+ */
+ #define ROCRAND_PCG32_DEFAULT_SEED 0ULL
+ /** @} */ // end of group rocranddevice
+
+#define ROCRAND_PCG32_MULTIPLIER 6364136223846793005ULL
+
+namespace rocrand_device {
+namespace detail {
+
+struct pcg32_state
+{
+    // State of the 64-bit LCG
+    unsigned long long state;
+    // Odd increment of the LCG, it selects the stream
+    unsigned long long inc;
+};
+
+} // end detail namespace
+
+class pcg32_engine
+{
+public:
+    typedef detail::pcg32_state pcg32_state;
+
+    FQUALIFIERS
+    pcg32_engine() : pcg32_engine(ROCRAND_PCG32_DEFAULT_SEED, 0, 0) { }
+
+    /// Initializes the internal state of the PRNG using
+    /// seed value \p seed, goes to \p subsequence -th stream,
+    /// and skips \p offset random numbers.
+    ///
+    /// Stream 0 is the stream of pcg32_srandom_r(seed, 0) of the reference
+    /// implementation, every stream is 2^64 numbers long.
+    FQUALIFIERS
+    pcg32_engine(const unsigned long long seed,
+                 const unsigned long long subsequence,
+                 const unsigned long long offset)
+    {
+        m_state.state = 0;
+        m_state.inc = 1;
+        next();
+        m_state.state += seed;
+        next();
+
+        discard(offset);
+        discard_subsequence(subsequence);
+    }
+
+    /// Advances the internal state to skip \p offset numbers
+    /// (O(log(offset)) LCG advance).
+    FQUALIFIERS
+    void discard(unsigned long long offset)
+    {
+        // x(n + offset) = mult * x(n) + plus, the sequence of powers
+        // (mult, plus) of one step is squared for every bit of offset
+        unsigned long long mult = 1;
+        unsigned long long plus = 0;
+        unsigned long long cur_mult = ROCRAND_PCG32_MULTIPLIER;
+        unsigned long long cur_plus = m_state.inc;
+        for(; offset > 0; offset >>= 1)
+        {
+            if(offset & 1)
+            {
+                mult *= cur_mult;
+                plus = plus * cur_mult + cur_plus;
+            }
+            cur_plus = (cur_mult + 1) * cur_plus;
+            cur_mult *= cur_mult;
+        }
+        m_state.state = mult * m_state.state + plus;
+    }
+
+    /// Advances the internal state to skip \p subsequence subsequences
+    /// (streams), streams start at pseudo-random offsets of one sequence.
+    FQUALIFIERS
+    void discard_subsequence(unsigned long long subsequence)
+    {
+        // The stream with the increment c is the stream with the increment 1
+        // multiplied by c: x(n + 1) * c = mult * (x(n) * c) + c, so the state
+        // is moved to the new stream by multiplying it by new_inc / inc.
+        // Multiplied streams at the same position are correlated, so the
+        // stream of c is also moved by stream_offset(c) numbers of the stream
+        // of increment 1.
+        const unsigned long long new_inc = m_state.inc + (subsequence << 1);
+        // Inverse of the odd increment modulo 2^64, every Newton iteration
+        // doubles the number of correct bits (3 bits at the start)
+        unsigned long long inv = m_state.inc;
+        for(unsigned int i = 0; i < 5; i++)
+        {
+            inv *= 2 - m_state.inc * inv;
+        }
+        const unsigned long long old_offset = stream_offset(m_state.inc);
+        m_state.state = m_state.state * inv * new_inc;
+        m_state.inc = new_inc;
+        discard(stream_offset(new_inc) - old_offset);
+    }
+
+    FQUALIFIERS
+    unsigned int operator()()
+    {
+        return next();
+    }
+
+    FQUALIFIERS
+    unsigned int next()
+    {
+        const unsigned long long old_state = m_state.state;
+        m_state.state = old_state * ROCRAND_PCG32_MULTIPLIER + m_state.inc;
+        // XSH RR output function
+        const unsigned int xorshifted =
+            static_cast<unsigned int>(((old_state >> 18) ^ old_state) >> 27);
+        const unsigned int rot = static_cast<unsigned int>(old_state >> 59);
+        return (xorshifted >> rot) | (xorshifted << ((32 - rot) & 31));
+    }
+
+protected:
+    // Offset of the stream of the increment inc (see discard_subsequence()),
+    // the finalizer of SplitMix64 of the stream number, 0 for stream 0
+    FQUALIFIERS
+    static unsigned long long stream_offset(unsigned long long inc)
+    {
+        unsigned long long z = inc >> 1;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+    // State
+    pcg32_state m_state;
+}; // pcg32_engine class
+
+} // end namespace rocrand_device
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+/// \cond ROCRAND_KERNEL_DOCS_TYPEDEFS
+typedef rocrand_device::pcg32_engine rocrand_state_pcg32;
+/// \endcond
+
+/**
+ * \brief Initializes PCG32 state.
+ *
+ * Initializes the PCG32 generator \p state with the given
+ * \p seed, \p subsequence, and \p offset.
+ *
+ * The state is 16 bytes (a 64-bit LCG state and its increment) and has no
+ * room for saved normally distributed values, so they are generated in pairs
+ * (like with rocrand_state_xorwow_compact). Subsequences are streams
+ * (increments of the LCG) starting at pseudo-random offsets, skipping ahead
+ * by subsequences needs one modular inverse and 64 multiplications and
+ * skipping ahead by offsets needs O(log(offset)) multiplications.
+ *
+ * \param seed - Value to use as a seed
+ * \param subsequence - Stream to start at
+ * \param offset - Absolute offset into the stream
+ * \param state - Pointer to state to initialize
+ */
+FQUALIFIERS
+void rocrand_init(const unsigned long long seed,
+                  const unsigned long long subsequence,
+                  const unsigned long long offset,
+                  rocrand_state_pcg32 * state)
+{
+    *state = rocrand_state_pcg32(seed, subsequence, offset);
+}
+
+/**
+ * \brief Returns uniformly distributed random <tt>unsigned int</tt> value
+ * from [0; 2^32 - 1] range.
+ *
+ * Generates and returns uniformly distributed random <tt>unsigned int</tt>
+ * value from [0; 2^32 - 1] range using PCG32 generator in \p state.
+ * State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Pseudorandom value (32-bit) as an <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand(rocrand_state_pcg32 * state)
+{
+    return state->next();
+}
+
+/**
+ * \brief Updates PCG32 state to skip ahead by \p offset elements.
+ *
+ * Updates the PCG32 state in \p state to skip ahead by \p offset elements.
+ *
+ * \param offset - Number of elements to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead(unsigned long long offset, rocrand_state_pcg32 * state)
+{
+    return state->discard(offset);
+}
+
+/**
+ * \brief Updates PCG32 state to skip ahead by \p subsequence subsequences.
+ *
+ * Updates the PCG32 \p state to skip ahead by \p subsequence subsequences.
+ * Each subsequence is a stream of 2^64 numbers, the position in the stream
+ * does not change.
+ *
+ * \param subsequence - Number of subsequences to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead_subsequence(unsigned long long subsequence, rocrand_state_pcg32 * state)
+{
+    return state->discard_subsequence(subsequence);
+}
+
+/**
+ * \brief Updates PCG32 state to skip ahead by \p sequence sequences.
+ *
+ * Updates the PCG32 \p state skipping \p sequence sequences ahead,
+ * for PCG32 a sequence is a stream (see skipahead_subsequence()).
+ *
+ * \param sequence - Number of sequences to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead_sequence(unsigned long long sequence, rocrand_state_pcg32 * state)
+{
+    return state->discard_subsequence(sequence);
+}
+
+#endif // ROCRAND_PCG32_H_
+
+/** @} */ // end of group rocranddevice
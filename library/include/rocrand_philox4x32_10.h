@@ -90,9 +90,14 @@ unsigned int mulhilo32(unsigned int x, unsigned int y, unsigned int& z)
 
 } // end detail namespace
 
-class philox4x32_10_engine
+// Philox4x32 engine with Rounds rounds, philox4x32_10_engine and
+// philox4x32_7_engine share everything except the number of rounds
+template<unsigned int Rounds>
+class philox4x32_engine
 {
 public:
+    static_assert(Rounds > 0, "Philox4x32 requires at least one round");
+
     struct philox4x32_10_state
     {
         uint4 counter;
@@ -117,7 +122,7 @@ public:
     };
 
     FQUALIFIERS
-    philox4x32_10_engine()
+    philox4x32_engine()
     {
         this->seed(ROCRAND_PHILOX4x32_DEFAULT_SEED, 0, 0);
     }
@@ -128,15 +133,15 @@ public:
     ///
     /// A subsequence is 4 * 2^64 numbers long.
     FQUALIFIERS
-    philox4x32_10_engine(const unsigned long long seed,
-                         const unsigned long long subsequence,
-                         const unsigned long long offset)
+    philox4x32_engine(const unsigned long long seed,
+                      const unsigned long long subsequence,
+                      const unsigned long long offset)
     {
         this->seed(seed, subsequence, offset);
     }
 
     FQUALIFIERS
-    ~philox4x32_10_engine() { }
+    ~philox4x32_engine() { }
 
     /// Reinitializes the internal state of the PRNG using new
     /// seed value \p seed_value, skips \p subsequence subsequences
@@ -158,7 +163,7 @@ public:
     void discard(unsigned long long offset)
     {
         this->discard_impl(offset);
-        this->m_state.result = this->ten_rounds(m_state.counter, m_state.key);
+        this->m_state.result = this->rounds(m_state.counter, m_state.key);
     }
 
     /// Advances the internal state to skip \p subsequence subsequences.
@@ -167,7 +172,7 @@ public:
     void discard_subsequence(unsigned long long subsequence)
     {
         this->discard_subsequence_impl(subsequence);
-        m_state.result = this->ten_rounds(m_state.counter, m_state.key);
+        m_state.result = this->rounds(m_state.counter, m_state.key);
     }
 
     FQUALIFIERS
@@ -183,7 +188,7 @@ public:
         #endif
         this->discard_subsequence_impl(subsequence);
         this->discard_impl(offset);
-        m_state.result = this->ten_rounds(m_state.counter, m_state.key);
+        m_state.result = this->rounds(m_state.counter, m_state.key);
     }
 
     FQUALIFIERS
@@ -205,7 +210,7 @@ public:
         {
             m_state.substate = 0;
             this->discard_state();
-            m_state.result = this->ten_rounds(m_state.counter, m_state.key);
+            m_state.result = this->rounds(m_state.counter, m_state.key);
         }
         return ret;
     }
@@ -215,7 +220,7 @@ public:
     {
         uint4 ret = m_state.result;
         this->discard_state();
-        m_state.result = this->ten_rounds(m_state.counter, m_state.key);
+        m_state.result = this->rounds(m_state.counter, m_state.key);
         switch(m_state.substate)
         {
             case 0:
@@ -288,26 +293,22 @@ protected:
         m_state.counter.w += add;
     }
 
-    // 10 Philox4x32 rounds
+    // Rounds Philox4x32 rounds
     FQUALIFIERS
-    uint4 ten_rounds(uint4 counter, uint2 key)
+    static uint4 rounds(uint4 counter, uint2 key)
     {
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 1
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 2
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 3
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 4
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 5
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 6
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 7
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 8
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 9
-        return this->single_round(counter, key);                        // 10
+        #pragma unroll
+        for(unsigned int i = 0; i < Rounds - 1; i++)
+        {
+            counter = single_round(counter, key); key = bumpkey(key);
+        }
+        return single_round(counter, key);
     }
 
 private:
     // Single Philox4x32 round
     FQUALIFIERS
-    uint4 single_round(uint4 counter, uint2 key)
+    static uint4 single_round(uint4 counter, uint2 key)
     {
         // Source: Random123
         unsigned int hi0;
@@ -323,7 +324,7 @@ private:
     }
 
     FQUALIFIERS
-    uint2 bumpkey(uint2 key)
+    static uint2 bumpkey(uint2 key)
     {
         key.x += ROCRAND_PHILOX_W32_0;
         key.y += ROCRAND_PHILOX_W32_1;
@@ -335,10 +336,13 @@ protected:
     philox4x32_10_state m_state;
 
     #ifndef ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
-    friend struct detail::engine_boxmuller_helper<philox4x32_10_engine>;
+    friend struct detail::engine_boxmuller_helper<philox4x32_engine>;
     #endif
 
-}; // philox4x32_10_engine class
+}; // philox4x32_engine class
+
+typedef philox4x32_engine<10> philox4x32_10_engine;
+typedef philox4x32_engine<7> philox4x32_7_engine;
 
 } // end namespace rocrand_device
 
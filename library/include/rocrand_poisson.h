@@ -33,9 +33,16 @@
 #include <math.h>
 
 #include "rocrand_philox4x32_10.h"
+#include "rocrand_philox4x32_7.h"
+#include "rocrand_philox4x64_10.h"
+#include "rocrand_threefry2x64_20.h"
+#include "rocrand_threefry4x64_20.h"
 #include "rocrand_mrg32k3a.h"
 #include "rocrand_xorwow.h"
 #include "rocrand_sobol32.h"
+#include "rocrand_scrambled_sobol32.h"
+#include "rocrand_sobol64.h"
+#include "rocrand_scrambled_sobol64.h"
 #include "rocrand_mtgp32.h"
 
 #include "rocrand_uniform.h"
@@ -44,29 +51,10 @@
 namespace rocrand_device {
 namespace detail {
 
+constexpr double lambda_threshold_ptrs  = 10.0;
 constexpr double lambda_threshold_small = 64.0;
 constexpr double lambda_threshold_huge  = 4000.0;
 
-template<class State>
-FQUALIFIERS
-unsigned int poisson_distribution_small(State& state, double lambda)
-{
-    // Knuth's method
-
-    const double limit = exp(-lambda);
-    unsigned int k = 0;
-    double product = 1.0;
-
-    do
-    {
-        k++;
-        product *= rocrand_uniform_double(state);
-    }
-    while (product > limit);
-
-    return k - 1;
-}
-
 FQUALIFIERS
 double lgamma_approx(const double x)
 {
@@ -100,6 +88,71 @@ double lgamma_approx(const double x)
     return (log_sqrt_2_pi + log(sum) - g) + (z + 0.5) * log((z + g + 0.5) / e);
 }
 
+template<class State>
+FQUALIFIERS
+unsigned int poisson_distribution_ptrs(State& state, double lambda)
+{
+    // Transformed rejection with squeeze PTRS, W. Hoermann, valid for lambda >= 10.
+    // A value needs two uniform values with probability of at least 0.87,
+    // so the number of iterations hardly depends on lambda and differs little
+    // between threads (Knuth's method needs lambda + 1 values).
+
+    const double sqrt_lambda = sqrt(lambda);
+    const double log_lambda = log(lambda);
+    const double b = 0.931 + 2.53 * sqrt_lambda;
+    const double a = -0.059 + 0.02483 * b;
+    const double log_inv_alpha = log(1.1239 + 1.1328 / (b - 3.4));
+    const double v_r = 0.9277 - 3.6224 / (b - 2.0);
+
+    while (true)
+    {
+        const double u = rocrand_uniform_double(state) - 0.5;
+        const double v = rocrand_uniform_double(state);
+        const double us = 0.5 - fabs(u);
+        const double k = floor((2.0 * a / us + b) * u + lambda + 0.43);
+        // Squeeze: most values are accepted without logarithms
+        if (us >= 0.07 && v <= v_r)
+        {
+            return static_cast<unsigned int>(k);
+        }
+        if (k < 0.0 || (us < 0.013 && v > us))
+        {
+            continue;
+        }
+        const double lhs = log(v) + log_inv_alpha - log(a / (us * us) + b);
+        const double rhs = -lambda + k * log_lambda - lgamma_approx(k + 1.0);
+        if (lhs <= rhs)
+        {
+            return static_cast<unsigned int>(k);
+        }
+    }
+}
+
+template<class State>
+FQUALIFIERS
+unsigned int poisson_distribution_small(State& state, double lambda)
+{
+    if (lambda >= lambda_threshold_ptrs)
+    {
+        return poisson_distribution_ptrs(state, lambda);
+    }
+
+    // Knuth's method
+
+    const double limit = exp(-lambda);
+    unsigned int k = 0;
+    double product = 1.0;
+
+    do
+    {
+        k++;
+        product *= rocrand_uniform_double(state);
+    }
+    while (product > limit);
+
+    return k - 1;
+}
+
 template<class State>
 FQUALIFIERS
 unsigned int poisson_distribution_large(State& state, double lambda)
@@ -234,6 +287,23 @@ unsigned int rocrand_poisson(rocrand_state_philox4x32_10 * state, double lambda)
     return rocrand_device::detail::poisson_distribution(state, lambda);
 }
 
+/**
+ * \brief Returns a Poisson-distributed <tt>unsigned int</tt> using Philox4x32-7 generator.
+ *
+ * Generates and returns Poisson-distributed distributed random <tt>unsigned int</tt>
+ * values using Philox4x32-7 generator in \p state. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param lambda - Lambda parameter of the Poisson distribution
+ *
+ * \return Poisson-distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_poisson(rocrand_state_philox4x32_7 * state, double lambda)
+{
+    return rocrand_device::detail::poisson_distribution(state, lambda);
+}
+
 /**
  * \brief Returns four Poisson-distributed <tt>unsigned int</tt> values using Philox generator.
  *
@@ -255,8 +325,153 @@ uint4 rocrand_poisson4(rocrand_state_philox4x32_10 * state, double lambda)
         rocrand_device::detail::poisson_distribution(state, lambda)
     };
 }
+
+/**
+ * \brief Returns four Poisson-distributed <tt>unsigned int</tt> values using Philox4x32-7 generator.
+ *
+ * Generates and returns Poisson-distributed distributed random <tt>unsigned int</tt>
+ * values using Philox4x32-7 generator in \p state. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param lambda - Lambda parameter of the Poisson distribution
+ *
+ * \return Four Poisson-distributed <tt>unsigned int</tt> values as \p uint4
+ */
+FQUALIFIERS
+uint4 rocrand_poisson4(rocrand_state_philox4x32_7 * state, double lambda)
+{
+    return uint4 {
+        rocrand_device::detail::poisson_distribution(state, lambda),
+        rocrand_device::detail::poisson_distribution(state, lambda),
+        rocrand_device::detail::poisson_distribution(state, lambda),
+        rocrand_device::detail::poisson_distribution(state, lambda)
+    };
+}
 #endif // ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
 
+/**
+ * \brief Returns a Poisson-distributed <tt>unsigned int</tt> using Philox4x64 generator.
+ *
+ * Generates and returns Poisson-distributed distributed random <tt>unsigned int</tt>
+ * values using Philox4x64 generator in \p state. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param lambda - Lambda parameter of the Poisson distribution
+ *
+ * \return Poisson-distributed <tt>unsigned int</tt>
+ */
+#ifndef ROCRAND_DETAIL_PHILOX4X64_BM_NOT_IN_STATE
+FQUALIFIERS
+unsigned int rocrand_poisson(rocrand_state_philox4x64_10 * state, double lambda)
+{
+    return rocrand_device::detail::poisson_distribution(state, lambda);
+}
+
+/**
+ * \brief Returns four Poisson-distributed <tt>unsigned int</tt> values using Philox4x64 generator.
+ *
+ * Generates and returns Poisson-distributed distributed random <tt>unsigned int</tt>
+ * values using Philox4x64 generator in \p state. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param lambda - Lambda parameter of the Poisson distribution
+ *
+ * \return Four Poisson-distributed <tt>unsigned int</tt> values as \p uint4
+ */
+FQUALIFIERS
+uint4 rocrand_poisson4(rocrand_state_philox4x64_10 * state, double lambda)
+{
+    return uint4 {
+        rocrand_device::detail::poisson_distribution(state, lambda),
+        rocrand_device::detail::poisson_distribution(state, lambda),
+        rocrand_device::detail::poisson_distribution(state, lambda),
+        rocrand_device::detail::poisson_distribution(state, lambda)
+    };
+}
+#endif // ROCRAND_DETAIL_PHILOX4X64_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns a Poisson-distributed <tt>unsigned int</tt> using Threefry2x64 generator.
+ *
+ * Generates and returns Poisson-distributed distributed random <tt>unsigned int</tt>
+ * values using Threefry2x64 generator in \p state. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param lambda - Lambda parameter of the Poisson distribution
+ *
+ * \return Poisson-distributed <tt>unsigned int</tt>
+ */
+#ifndef ROCRAND_DETAIL_THREEFRY2X64_BM_NOT_IN_STATE
+FQUALIFIERS
+unsigned int rocrand_poisson(rocrand_state_threefry2x64_20 * state, double lambda)
+{
+    return rocrand_device::detail::poisson_distribution(state, lambda);
+}
+
+/**
+ * \brief Returns four Poisson-distributed <tt>unsigned int</tt> values using Threefry2x64 generator.
+ *
+ * Generates and returns Poisson-distributed distributed random <tt>unsigned int</tt>
+ * values using Threefry2x64 generator in \p state. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param lambda - Lambda parameter of the Poisson distribution
+ *
+ * \return Four Poisson-distributed <tt>unsigned int</tt> values as \p uint4
+ */
+FQUALIFIERS
+uint4 rocrand_poisson4(rocrand_state_threefry2x64_20 * state, double lambda)
+{
+    return uint4 {
+        rocrand_device::detail::poisson_distribution(state, lambda),
+        rocrand_device::detail::poisson_distribution(state, lambda),
+        rocrand_device::detail::poisson_distribution(state, lambda),
+        rocrand_device::detail::poisson_distribution(state, lambda)
+    };
+}
+#endif // ROCRAND_DETAIL_THREEFRY2X64_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns a Poisson-distributed <tt>unsigned int</tt> using Threefry4x64 generator.
+ *
+ * Generates and returns Poisson-distributed distributed random <tt>unsigned int</tt>
+ * values using Threefry4x64 generator in \p state. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param lambda - Lambda parameter of the Poisson distribution
+ *
+ * \return Poisson-distributed <tt>unsigned int</tt>
+ */
+#ifndef ROCRAND_DETAIL_THREEFRY4X64_BM_NOT_IN_STATE
+FQUALIFIERS
+unsigned int rocrand_poisson(rocrand_state_threefry4x64_20 * state, double lambda)
+{
+    return rocrand_device::detail::poisson_distribution(state, lambda);
+}
+
+/**
+ * \brief Returns four Poisson-distributed <tt>unsigned int</tt> values using Threefry4x64 generator.
+ *
+ * Generates and returns Poisson-distributed distributed random <tt>unsigned int</tt>
+ * values using Threefry4x64 generator in \p state. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param lambda - Lambda parameter of the Poisson distribution
+ *
+ * \return Four Poisson-distributed <tt>unsigned int</tt> values as \p uint4
+ */
+FQUALIFIERS
+uint4 rocrand_poisson4(rocrand_state_threefry4x64_20 * state, double lambda)
+{
+    return uint4 {
+        rocrand_device::detail::poisson_distribution(state, lambda),
+        rocrand_device::detail::poisson_distribution(state, lambda),
+        rocrand_device::detail::poisson_distribution(state, lambda),
+        rocrand_device::detail::poisson_distribution(state, lambda)
+    };
+}
+#endif // ROCRAND_DETAIL_THREEFRY4X64_BM_NOT_IN_STATE
+
 /**
  * \brief Returns a Poisson-distributed <tt>unsigned int</tt> using MRG32k3a generator.
  *
@@ -329,6 +544,74 @@ unsigned int rocrand_poisson(rocrand_state_sobol32 * state, double lambda)
     return rocrand_device::detail::poisson_distribution_inv(state, lambda);
 }
 
+/**
+ * \brief Returns a Poisson-distributed <tt>unsigned int</tt> using SOBOL32 generator (block state).
+ *
+ * Generates and returns Poisson-distributed distributed random <tt>unsigned int</tt>
+ * values using SOBOL32 generator in block state \p state. State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ * \param lambda - Lambda parameter of the Poisson distribution
+ *
+ * \return Poisson-distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_poisson(rocrand_state_sobol32_block * state, double lambda)
+{
+    return rocrand_device::detail::poisson_distribution_inv(state, lambda);
+}
+
+/**
+ * \brief Returns a Poisson-distributed <tt>unsigned int</tt> using SCRAMBLED_SOBOL32 generator.
+ *
+ * Generates and returns Poisson-distributed distributed random <tt>unsigned int</tt>
+ * values using SCRAMBLED_SOBOL32 generator in \p state. State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ * \param lambda - Lambda parameter of the Poisson distribution
+ *
+ * \return Poisson-distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_poisson(rocrand_state_scrambled_sobol32 * state, double lambda)
+{
+    return rocrand_device::detail::poisson_distribution_inv(state, lambda);
+}
+
+/**
+ * \brief Returns a Poisson-distributed <tt>unsigned int</tt> using SOBOL64 generator.
+ *
+ * Generates and returns Poisson-distributed distributed random <tt>unsigned int</tt>
+ * values using SOBOL64 generator in \p state. State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ * \param lambda - Lambda parameter of the Poisson distribution
+ *
+ * \return Poisson-distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_poisson(rocrand_state_sobol64 * state, double lambda)
+{
+    return rocrand_device::detail::poisson_distribution_inv(state, lambda);
+}
+
+/**
+ * \brief Returns a Poisson-distributed <tt>unsigned int</tt> using SCRAMBLED_SOBOL64 generator.
+ *
+ * Generates and returns Poisson-distributed distributed random <tt>unsigned int</tt>
+ * values using SCRAMBLED_SOBOL64 generator in \p state. State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ * \param lambda - Lambda parameter of the Poisson distribution
+ *
+ * \return Poisson-distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_poisson(rocrand_state_scrambled_sobol64 * state, double lambda)
+{
+    return rocrand_device::detail::poisson_distribution_inv(state, lambda);
+}
+
 #endif // ROCRAND_POISSON_H_
 
 /** @} */ // end of group rocranddevice
@@ -0,0 +1,1290 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_SCRAMBLED_SOBOL_PRECOMPUTED_H_
+#define ROCRAND_SCRAMBLED_SOBOL_PRECOMPUTED_H_
+
+// Auto-generated file. Do not edit!
+// Generated by tools/sobol_direction_vector_generator
+
+#define SCRAMBLED_SOBOL_DIM 20000
+
+static const unsigned int h_scrambled_sobol32_constants[SCRAMBLED_SOBOL_DIM] =
+    {
+        0xd091bb5c, 0x22ae9ef6, 0xe7e1faee, 0xd5c31f79, 0x2082352c, 0xf807b7df, 0xe9d30005, 0x3895afe1, 0xa1e24bba, 0x4ee4092b, 0x18f86863, 0x8c16a625, 0x474ba8c4, 0x3039cd1a, 0x8c006d5f, 0xfe2d7810, 0xf51f2ae7, 0xff1816e4, 0xf702ef59, 0xf7badafa, 0x285954a1, 0xb9d09511, 0xf878c4b3, 0xfb2a0137, 0xf508e4aa, 0x1c1fe652, 0x7c419418, 0xcc50aa59, 0xccdf2e5c, 0x4c0a1f3b, 0x2452a9dc, 0x01397d8d,
+        0x6bf88c31, 0x1cca797a, 0xea6da4ae, 0xa3c78807, 0xcace1969, 0xe0e0d4ad, 0xf5a14bab, 0x80f00988, 0xa7de9f4c, 0xcc450cba, 0x0924668f, 0x5c7dc380, 0xd96089c5, 0x3640ac4c, 0xef1a2e6d, 0xae6d9426, 0xadc1965b, 0x6613ba46, 0xc1fb41c2, 0xbd9b0ecd, 0xbe3dedfc, 0x7989c8ee, 0x6468fd6e, 0x6c0df032, 0xa7cd6634, 0x2c826d8b, 0x2bd2e412, 0x4d4a2dbe, 0xb4bf6fa7, 0xcc1a8959, 0x08263282, 0x51097330,
+        0x46e46cb0, 0xdf577ec2, 0x0bd1e364, 0x262c5564, 0x18dda0c9, 0xfe7b45d9, 0xd2ce21c9, 0xd268409a, 0xb1e049e1, 0x200bfa47, 0x512d6e73, 0xc3851eee, 0xf341c081, 0x7d973e48, 0x08d17554, 0xa9e20d28, 0x70518ce6, 0x203ac303, 0x61add0ab, 0x35d0430c, 0xc3f8e892, 0x0d1c8509, 0xcb92388e, 0x095436bf, 0x2fd6e208, 0x68a29af9, 0x7d61330b, 0x753ec6fc, 0x7211efea, 0x7cd15133, 0xa574c4ff, 0xcb41f198,
+        0xb598eef6, 0xebbe7347, 0xc1332568, 0xceba5a70, 0x46a99459, 0xb4ad9f11, 0xae00feaa, 0x00b8b573, 0xa7b480b6, 0xb5f0b06c, 0x29a0ec27, 0xa4daa010, 0x1e76a1c5, 0x74be9133, 0x7f94c950, 0xc61f6ed6, 0xf5b1c7a1, 0x92e195f8, 0x572384d4, 0xe0732c88, 0x95d41b68, 0xcee496c3, 0x394bbd52, 0x048cd47c, 0xc05309be, 0xd23d2d63, 0x414de9c5, 0xd2229f23, 0x818666a3, 0xf0a8b109, 0xb2f6b127, 0x69a48341,
+        0xe4123c56, 0x6c548c8f, 0xf5941f61, 0x94b993aa, 0x8c165134, 0x2876763c, 0x237ce42e, 0xc300d11b, 0x263821ca, 0x3aeb8202, 0x41ec0f84, 0xcf4ac36d, 0xd7393ee6, 0xfd0fc06a, 0x4118a30a, 0x551b54a4, 0xd074f86f, 0x4cc1c54a, 0x3e57a703, 0x03774cda, 0xede43895, 0x379ce627, 0x59988939, 0xe8490ddc, 0x325410e1, 0xd9352f6a, 0x4047080a, 0xf47c081d, 0x9db51a85, 0xc765d71f, 0x79297527, 0xfcca2773,
+        0x5a065b97, 0x114dee4f, 0xd4b12f5f, 0xcb29360a, 0x95d3de16, 0x983162a8, 0x8cbaafb3, 0xbb98b27f, 0xeacd3439, 0xb1fac842, 0x492cbef1, 0xae08ab78, 0xc1d7dfd0, 0x646f1d40, 0xc0f463c4, 0x8fc23a81, 0x6164e623, 0x3543f2bc, 0x915cc253, 0x8701d0df, 0x136b2fdd, 0x677a359e, 0x0dcfacd0, 0x5a4ea31e, 0x87e25935, 0x97c34e42, 0xc77780f0, 0x5b396fba, 0xef1b52e6, 0xf7080941, 0x2141888b, 0x278946b0,
+        0x919e6d64, 0x6518b459, 0x7829fc22, 0x6325d30e, 0x030c0399, 0xba19b463, 0x564dab75, 0x63794f97, 0x2984c787, 0xed702bbe, 0xcb563b4d, 0x6fa56696, 0x4fabc9ed, 0xdcd87a48, 0x874df295, 0x9ecfe9f0, 0x2a67f49f, 0x1e9aa4e1, 0x9a1b7d08, 0x78d22934, 0x43521602, 0x5718a361, 0xa771ba44, 0x87a3b97c, 0xb0705c82, 0xb7526048, 0xbf86dcd7, 0xfd066ea4, 0x7356b1bb, 0xb872426d, 0x1575515d, 0xe99eadb3,
+        0x3a9e3c0f, 0x8168599c, 0xe9d07a32, 0x8eeab382, 0x27023ee8, 0x80d10fac, 0xd368bdc2, 0x7664b5a7, 0x89d0cf46, 0x8bed7368, 0xff02af49, 0x7294e430, 0x14034fbb, 0xdabd4cc4, 0x71535cf8, 0x9aaeea20, 0x1b4d989d, 0x7fa09780, 0xf63ef3d2, 0xfadc6788, 0x012fb568, 0x08c904fa, 0xc660883f, 0xfa1cce2a, 0xd13ac8b8, 0x5cf9c9b3, 0xde62c6bd, 0xadf500ad, 0x159d967e, 0x58a2c06c, 0x665827cb, 0xdb1aa208,
+        0x4286ddf1, 0x0b8905b4, 0xccd149a4, 0xa8fd9757, 0x6e7122f0, 0xbffc21b1, 0xe9203368, 0x220c0724, 0x2e8d86cb, 0xfb7bfb5e, 0x43889687, 0x1869325b, 0x25420afc, 0x485d46db, 0x22d56381, 0xcd572d60, 0xde89ef2b, 0x13dac708, 0x9467851d, 0xa09c428d, 0x8cc3a36c, 0x0212714e, 0x251bc1f6, 0xae274af0, 0xda603f48, 0x88afd714, 0x9f3f014d, 0x704c7830, 0x59d803fb, 0x3315c9dc, 0x83645273, 0x23540e0e,
+        0x66dce437, 0x61e09244, 0x13728d90, 0xc32e0a94, 0x3d6b2529, 0x0a5c5094, 0x1f91d464, 0x40c1b904, 0x2f1494b9, 0x8138ac02, 0x3d6d8755, 0xd2963cf5, 0x6ad203b6, 0xfb5234e0, 0x0cb62703, 0xd2cdf95b, 0xe718672d, 0x4d448df1, 0xf1dd92d7, 0x0c4613a1, 0x7da944f1, 0x3f72f0c3, 0x7d3fa930, 0x8b4742bc, 0x5674c771, 0xe3420514, 0xe669edd5, 0x5805de29, 0x5e86f504, 0x088449f4, 0x1c77c8a0, 0x29b1fccc,
+        0xc7be9961, 0xe09aebe7, 0x63c5ecb9, 0x35d657e1, 0x3ddf7ae4, 0x45d3249c, 0x6766c940, 0x7e10ad9c, 0x18b13e7f, 0x39320ca2, 0x21c90078, 0x7d84661c, 0xf12a3a21, 0xf4772b41, 0xf4c53bab, 0xa6e76b3b, 0x9340ded2, 0xc1ebc21f, 0x0f4db654, 0x6f6c42e3, 0x3c1a8943, 0x8d899f74, 0x5a6899ba, 0x0d9b6827, 0xd239c5cb, 0x5290106a, 0x03f17adb, 0x67acdc26, 0x0b039b90, 0xe88f1afa, 0x2b42ee31, 0xcf239e4d,
+        0xa62c6e93, 0x421fae11, 0xbb522891, 0x213d9f32, 0xa5d2adeb, 0x7e4aab21, 0x736fbc75, 0x60e56773, 0x8c08c64d, 0xb7eda589, 0x4bdbae33, 0x49ad9663, 0xbea4300c, 0x9f997956, 0x305f5b0c, 0xcfd6f924, 0xafd083db, 0x500085e0, 0x2efa9644, 0x62bdecbd, 0x5e5501a5, 0x580bc7bb, 0xa02889ad, 0xd0d63dcd, 0xc7bcfc3c, 0xab56454f, 0x14c4a882, 0x612197c7, 0xedec3d2f, 0x75600d88, 0xc6951b28, 0x4db9a52d,
+        0x7c9e604d, 0xe91ac974, 0x6f946da2, 0x7d160cf0, 0x72606b78, 0xc17b7257, 0x4e6ceb4e, 0x1ba9f219, 0x822d9f9a, 0x64c24df6, 0x82c1eccb, 0xdec48f52, 0xd1500cb6, 0x5c615e22, 0xcb7a1247, 0xeac83d5e, 0xa4f2087e, 0x8b36d663, 0x60ec8b7d, 0x23e07770, 0xcfc3bcb6, 0x332ade50, 0x886741fc, 0xf2ecc125, 0x59c94057, 0xfd77d893, 0xf062680f, 0x3d759e10, 0xe03dc9c3, 0x043ab169, 0x8cd70bce, 0x637c48af,
+        0x9f5a86f9, 0xc799b8ed, 0x96488fc2, 0x7a04f3e1, 0x352e9955, 0x8a467bfe, 0x4d1e7adb, 0x04b931c9, 0x788e6ea0, 0xe67267f5, 0x3b0145b6, 0x31ca7310, 0xd8249eec, 0xe2d0c5d1, 0x31dc1298, 0x70f4055d, 0x39d60297, 0x25d81f3b, 0x2bb385c9, 0x3d500890, 0x3a48350d, 0xccb6120b, 0x6f89f2f9, 0x791783d6, 0x4fa4664e, 0x16fea67f, 0xec629bbf, 0xa5014386, 0x6e221244, 0xa21075d9, 0x2f501f52, 0x959a12f4,
+        0xe7a64774, 0xba060582, 0xfad0ca2f, 0x5ac9908f, 0x7059c853, 0xae2f213e, 0x1c724f28, 0xb51305fc, 0x42108734, 0x298e5c9d, 0x68a1dd2b, 0x223c8c36, 0x984b1bef, 0x73161b54, 0x43204f20, 0x0ac40f25, 0x9a53eca9, 0xcc200dd8, 0xb6123cc0, 0x2ae4efad, 0x38c464c2, 0xd4ca75a4, 0x1e0f1559, 0x5330cf6e, 0x4bf2f32b, 0xa7e130fd, 0x519b7462, 0x6b919194, 0x6c963148, 0xc82b32bb, 0x82030024, 0x1cfa2fa0,
+        0x15e45ce2, 0xfe584a91, 0x4332093f, 0x2e7b9117, 0xcd0f4b4d, 0xc34f792c, 0x077afaf5, 0x44136041, 0xedc96297, 0x3e7fd864, 0xbaf6f6ba, 0x19c9ff6e, 0x7d157a58, 0x5825dfde, 0x941a37e0, 0x4818babb, 0x3cbe9dc1, 0xf7f8d0ce, 0x75771de9, 0x36b9cf69, 0xf68cf878, 0x9b1e1c75, 0x8bfb75ae, 0x39ff446d, 0x85692875, 0x309da59f, 0x3b49c509, 0x66cd636e, 0x7d286708, 0x69cd6a2e, 0x9fc266e3, 0x2b8f1988,
+        0xaddbd3af, 0x4c8ea8e7, 0x65407c37, 0xa2ef9aa6, 0x5e10541b, 0x26cd9065, 0xfcec6367, 0xc4ed1ef8, 0x09a9410f, 0xe24bc427, 0xe29a5edd, 0xf58f8c10, 0xe9cd2a63, 0x049ffdb7, 0xcbd2b4cc, 0x95356bb0, 0x19453535, 0xc4508ca2, 0x4309fd7e, 0x53ea8de9, 0x55d9f238, 0x210a7aea, 0xae02a6ab, 0x4abdf123, 0x22f5256b, 0xd8dc2d8e, 0xb8a25d9d, 0x3b13600f, 0x1b54beda, 0x808164b1, 0xa75ca457, 0x0068b861,
+        0x7e822ee1, 0x0335be36, 0xc76fef0e, 0x495dbce8, 0xb70cab9d, 0x19445725, 0xe75a3b16, 0x627f5136, 0xe4137f41, 0x5af821c1, 0x558bb5a6, 0xb85003e7, 0xb2e101c2, 0x10c101fc, 0x32a3aa3d, 0x838c4690, 0x07d18800, 0x6c89d813, 0xbe7ba68d, 0xb096d0b9, 0x8001786a, 0x41026a58, 0x7adc2d65, 0x66c9fc5f, 0xe79be068, 0x43b4bc3b, 0x9c203868, 0xef2b0be2, 0x9e1f6267, 0x78f76a0a, 0xdc04692d, 0x9c6500f3,
+        0xce348e12, 0x7d07e7ee, 0x93a40579, 0x83b78de9, 0x2ed401c8, 0x3eb994dd, 0x3d6c2f3d, 0x553fd4da, 0xe2f27231, 0x809ad218, 0x0757306e, 0x989740b3, 0x7d6a2d71, 0x4f66622b, 0x2afd45f7, 0xf687016b, 0xfa8ad0b3, 0x3b7e96f2, 0xb6732508, 0xbf351d33, 0x801ee898, 0x5291851f, 0x78993f7e, 0x5177a95e, 0x0f432e84, 0xf3d5350c, 0xae95b5e0, 0x88e37a7b, 0x0adcc451, 0xdf2e9f5b, 0x124a3fe8, 0xef421e88,
+        0x858ad803, 0xaac7fd11, 0x18c34c95, 0x4a2915bb, 0xd1722f1a, 0x10c6360b, 0xd14ac42f, 0x3b5d0d66, 0xb8f1cd0d, 0xb468c613, 0x265d94fd, 0x31f28f03, 0xa8dbe3dd, 0x6c16811b, 0x84c2a353, 0xefa14dff, 0xf914dc58, 0x246858c1, 0xa6244e68, 0xa4a782a4, 0xcce276f9, 0x7904f936, 0x742c1628, 0x6fdad5d1, 0x6eb135b6, 0x3e8bbb60, 0xd347c3df, 0x8183ef4e, 0x155e4713, 0xe82d7cf3, 0x22177ec5, 0x1395c3b0,
+        0x2c633227, 0xb6c26847, 0x64147fff, 0x9e012434, 0xd4d54d85, 0x3067d25f, 0xcda949fd, 0x65a09982, 0x0f7b0a12, 0x4714fddd, 0x6635c1c5, 0xdbac6554, 0x86e1558d, 0xe8b0113e, 0x6ab35ea6, 0x9e06008a, 0xa827f848, 0x2e4a226e, 0xa0c2dcab, 0x83d89830, 0x4abf77e8, 0xd31b1042, 0x6e80b0f7, 0x5bfcafb4, 0x03f6f6ce, 0xd0ed0b8a, 0xfbeb99af, 0x4b1b7def, 0x2acb8c9c, 0x2c0fe9b1, 0x1b30fe94, 0x7e277559,
+        0x5f563ea0, 0x3200cdd8, 0x32b7e32a, 0xdd43417d, 0x7d5c2b5b, 0x344643f9, 0x56e90a5f, 0x9dc40517, 0xf39e0dc7, 0xe0c7ebbf, 0xeb9ae161, 0x6478daa3, 0x0d7c3d4e, 0xf252e312, 0xbce444b9, 0x2aacbcdb, 0x44e502aa, 0xf8ccf513, 0x6c3ef465, 0x906000da, 0x8c41446a, 0x992eb47b, 0xf1573608, 0x2197c153, 0x6af14701, 0x911852c9, 0xfba9538f, 0x8debdd8c, 0x4d2c26d1, 0x4f7c4522, 0xb37b354f, 0x1ee2d92c,
+        0xaa952ed2, 0xbcdfdbf3, 0x8a043123, 0x3e232325, 0xb2b70b0d, 0xd2a6e5a6, 0xaaa192d4, 0x2f7b5a6e, 0x2d9a16b1, 0x500b9889, 0x20c58d24, 0xe1b8c1bc, 0xffc3bb81, 0xac993839, 0x2bce9702, 0xbd429acc, 0x08588715, 0x1002d574, 0x8faaca38, 0x21ae04bc, 0xe1c200dd, 0x17072760, 0xab4f12b3, 0x0220e53e, 0x30c03c0a, 0x74ddddc9, 0x5e71509d, 0xa261b3d2, 0x75f22283, 0x879e8c26, 0xfb4c9fe6, 0x7f745ef0,
+        0x280a27b6, 0x55f6d9e0, 0xdb038ae1, 0x40b907f0, 0xa50f49f3, 0x3bd2275a, 0x6053602f, 0x2c546996, 0x30e06018, 0x9892367a, 0x6da1fcf7, 0xba15ab48, 0x7b65cc3d, 0xe0a8a155, 0x1ee06716, 0xb5086b7b, 0x96e9f667, 0x3c19993c, 0x39e76f8f, 0x7a5dede2, 0x62766632, 0x04a986ae, 0x953e9871, 0xbf5118f1, 0x40765da0, 0xa79bf6f2, 0x4a5a51cc, 0x13fc31f4, 0x9df9ab13, 0x79076552, 0x43e97309, 0xff18fd70,
+        0xd30a52a7, 0x88378b0f, 0xfb8fd412, 0xe6417027, 0xbaf195a7, 0xc5dcd5cd, 0x580852da, 0x3429986e, 0x95859146, 0xe838454a, 0x1b96c004, 0x5ff3b74d, 0xe803cf9c, 0xd91c5a75, 0xe130fc96, 0x53a28fd0, 0xd158c194, 0x53a50385, 0x42bf11f5, 0xa8c206f5, 0x9827bb23, 0x96363ad9, 0x05c362a9, 0x0c8a29c4, 0x6cddcb78, 0xc51c7848, 0x500e585a, 0x7de37864, 0x2957106e, 0x7cf9a0ab, 0x2dc39ee9, 0x6ddb3d2b,
+        0x6c423c98, 0x650ce024, 0x181f69eb, 0xc6c5ad24, 0x9938d8c1, 0xf98980e3, 0x788e7de8, 0xbf9e08bc, 0xb229bbe9, 0xa26eb92b, 0xb32bd9ac, 0x127a67ca, 0xa376c062, 0xa22418d6, 0x089a42d0, 0x876757b3, 0x119d46da, 0x4bd1a4a8, 0x51d149d4, 0x5348afee, 0x87e6b8af, 0xa191134a, 0xa789c0f8, 0xfe97e849, 0x6859bb5c, 0x841bb5db, 0xd1ea4a06, 0xb975cfca, 0xb7e65f3f, 0x3eddfc98, 0xf7f96715, 0x55142d20,
+        0x88057fbb, 0xbfa4d8d4, 0x533cbf5e, 0xaed6e43f, 0x1b0a83f1, 0xae67ccf0, 0x9c67c962, 0x142f0382, 0xc75f956a, 0x757cd939, 0x6c67691a, 0xb2b9c0a8, 0x174031e8, 0x1160e67b, 0x443779d1, 0x11b3299a, 0x27560be1, 0x86ec4732, 0x47eff6b9, 0x4315a14c, 0x70a96b74, 0x7bbe7982, 0x86f2d3ae, 0x217c7787, 0x7519c371, 0x182d452c, 0xe0185a62, 0x1ed1557a, 0x849f1010, 0xf8474049, 0xf1914086, 0xc19bac85,
+        0xa340e755, 0x44a73507, 0xf52b6e09, 0xb9937043, 0x3d9ef9f4, 0x6a6f6972, 0xad1659e7, 0x7987252a, 0x4a0022c0, 0x0e3168c9, 0xabfb9eb5, 0x9d1e560e, 0xb1f4ba47, 0x7d993809, 0x1167f948, 0xe78baa36, 0x4139ed77, 0xef6a33d1, 0x395aafe9, 0xeb142d32, 0xaaf715e6, 0x4dc77e33, 0xd82a1596, 0xca441c2b, 0x582eb04f, 0x39ea0a16, 0xc7d022df, 0x72ee825e, 0xace28fef, 0x82967f6a, 0x01b81854, 0x3b0ab1a1,
+        0x9a27d844, 0xb63dd19c, 0x63036fc5, 0xfc051613, 0xea7e66eb, 0xa7bc0e30, 0x004b6f8a, 0x45cd80de, 0x76631166, 0x78116769, 0x6ca2239f, 0x00c4afde, 0x75fe9d74, 0x7248d6c0, 0xc5293013, 0xf88fcbbb, 0x528d833b, 0x4dfe6d59, 0xc8e4aca6, 0x371162e7, 0x78aadccb, 0x3f61bc3b, 0x0927bf11, 0xce739311, 0x2d061b1e, 0x7c82d0fa, 0xb8c52266, 0x68520ba8, 0x793660d8, 0x37337b3e, 0x2718bc8d, 0x8a4df5f5,
+        0x5753f130, 0xb9181dce, 0x9b7ddc13, 0x48a02a1b, 0x31163787, 0x8af902aa, 0xbd098a99, 0xc18447b7, 0x3e2b642e, 0x54fc76a4, 0xeadc525a, 0xcd405695, 0x44e13850, 0xdb691951, 0xc3f7cf36, 0x03cff145, 0x304c26ac, 0xe28b9a3e, 0x49997af9, 0x97d48bb6, 0x17533654, 0x16125513, 0x9382753b, 0xecc4ab75, 0xaef0e4a3, 0xe9e9869f, 0x8bed86b3, 0xfb12e042, 0x6cfc90a6, 0xe667d955, 0xa4fa33b5, 0xf3207eb6,
+        0xa5ca44c1, 0xef3cd4b0, 0xadd40ac4, 0x02218a17, 0xa2c2eaef, 0xc71d8276, 0xf1f6ee43, 0x06a53db2, 0x357cc25f, 0x967f1c3e, 0xb5937c41, 0xa6580857, 0x3c799b6c, 0x54074de7, 0x1e90c0a2, 0x1c6fb273, 0x9b78456a, 0x1fd05538, 0x733c3941, 0xf9527f4f, 0x756f08b1, 0x8881ba01, 0xa975360d, 0xa98c82e2, 0xc5316e71, 0xb5505f48, 0x59a7e348, 0x1198da00, 0xa9797612, 0x34b98139, 0x6a895e81, 0x6ef53f4e,
+        0xd788ab48, 0x02dd8470, 0xd53a0971, 0x11bb305a, 0x41a61df7, 0x57d2e616, 0x9d0bc340, 0x4fee4f80, 0x950e47fd, 0xfe246148, 0x8a6de4b1, 0x44e1667c, 0xdeb47481, 0xdb68b174, 0x43c88eeb, 0x5b095122, 0x516d4d70, 0xbf2c34bb, 0x1e84d803, 0xd8488020, 0xf098aa0e, 0x37966595, 0xa542e32c, 0xf7071b23, 0x7abe1a18, 0xb65241f9, 0xa3aa46bd, 0xfb901f13, 0x8b7283ce, 0xc288bdbe, 0xa5b63487, 0x3179830d,
+        0x8b3c1bc4, 0x5a434e63, 0xb89682f5, 0x3240bd3b, 0x85c24093, 0xd5026757, 0xfe636d0b, 0xf3dd402a, 0x37fb3118, 0xc4725d1c, 0x1b159878, 0xdca9fce6, 0x1c15220f, 0x74a660f2, 0x10478634, 0x552ac4a2, 0x67928dfe, 0xd6983478, 0x72c89121, 0x8de72e4b, 0x5da6210b, 0x1ef10bd2, 0xc3750a52, 0x3651ac43, 0xa0bdd13c, 0x7dc1db18, 0xc5a081b5, 0x68df2306, 0xeecf7dd5, 0xc26f5850, 0xf9058b66, 0x5b688fa4,
+        0x3128c503, 0xc593c55d, 0x238d4264, 0xfb463b64, 0xb23e82a1, 0xd89e0dfb, 0x180496cb, 0xd5a9c34a, 0x8680e729, 0x5e007521, 0x87c4a39b, 0x0cf5d266, 0xdc73a894, 0xf9be67af, 0x7c1f5901, 0xd7b3ee93, 0x64b98e4c, 0xde94f4bd, 0xabe2e950, 0x1353dd82, 0xbdc314aa, 0x0849cc4a, 0x8522289d, 0x9d2aa285, 0x5903b29b, 0xbc558b0f, 0x2666385d, 0x9d933aed, 0x960a212d, 0xa9a21ff8, 0x431bf48b, 0xf38610c1,
+        0x0b6157e8, 0x44113444, 0xc1434e70, 0xeb5cdceb, 0x3e272e6c, 0x1e4f3c74, 0x71414726, 0x502512f8, 0xb0136766, 0xdf42f470, 0x5bf66147, 0x3bd012c2, 0xbc80c87d, 0xcedcebe7, 0x650b8c8d, 0x8e78dda9, 0xaef45791, 0xf18f4402, 0xb43c73df, 0x80f2b5cb, 0x713aed7a, 0xaa9a4b05, 0x05030a1c, 0x2728c323, 0x54b31a1a, 0xf925855f, 0x6c9f8c13, 0xa23e8c4c, 0x45307142, 0x2dbbfdff, 0x32721e2e, 0x12fb05d7,
+        0xd25c51c0, 0x7eb6aacd, 0x6e0f5443, 0xc935faad, 0xe344f51b, 0x76f54059, 0x64249192, 0xe20e5ce9, 0xc4e4ae3a, 0xa5b9f7db, 0x659420e6, 0xe73accd8, 0xcefac7bd, 0x01877c9f, 0xc14cbb80, 0xb18d4444, 0x609cfe97, 0x95c86f58, 0x374d0405, 0x1af8f529, 0xca582092, 0xfd859ad0, 0xf30594c3, 0x3ae0c1e2, 0x53db540f, 0x553972a2, 0xabd7fb48, 0xb07b6500, 0x704b0980, 0xf61fab85, 0xd5604b93, 0x3a0265ee,
+        0xc4d3a1d4, 0xec9b15b3, 0x2ad120d2, 0xe051ab9e, 0xdcaac0bf, 0x6e86cf38, 0xfd6842e6, 0x788c13c3, 0x83b14164, 0x8fe5f2b8, 0xe2603da2, 0xd66df6b1, 0x9688e031, 0x25f79219, 0x279dd996, 0xa3a7bc28, 0x332a35b5, 0xfedf3a56, 0x682e3122, 0xa3af54fb, 0xbfab2d85, 0x708445de, 0xd3597601, 0x0744757a, 0xca3b0466, 0x154960a2, 0x518ace1f, 0x87c624d3, 0x88b86d2d, 0xc831404e, 0x170701f7, 0xbc94c80f,
+        0x1c98bf7b, 0x30ae63a0, 0x22e41189, 0x43071c8e, 0xadbc2855, 0x73c65029, 0x7ec3ebd0, 0x75c45269, 0x3090dc7e, 0xac737bdb, 0x7eb8b3a1, 0x2d4ccbea, 0x25c9a708, 0x3015ae7f, 0x0e12c930, 0x18b35c18, 0xd9c84e4a, 0x52e9723d, 0x8f80d443, 0x2b9a8465, 0xedfad8cb, 0x0654f8e1, 0xb258c807, 0xd4a504c5, 0x9531c9f2, 0x3ead12af, 0xd0bddf2c, 0x245c67ff, 0xe1070e24, 0x27cb0b77, 0xfd294fc9, 0x4d921c60,
+        0x00223c00, 0x08983206, 0xdd8d6226, 0x68c7305d, 0x9cd127ee, 0xc87aca8d, 0xfd6d6067, 0x7180d254, 0x87160a9b, 0x047a1b7e, 0x7ac20b63, 0x49292a07, 0xcd251dc0, 0xf38ebbf4, 0x3a53ea35, 0x2bdb4d2a, 0x7f831b9e, 0x181a340d, 0xe69e44d6, 0x461f148f, 0x931cff63, 0x338c963f, 0xd85d98f4, 0xc0cc3bc3, 0xbd1787b8, 0xcd066f08, 0x96033f1d, 0x96099d00, 0x3f29fe61, 0x7f3b0868, 0xaa9a40d3, 0x974a05c7,
+        0x155f212f, 0x919c523d, 0xa03ee693, 0x2f62953a, 0xa933a98d, 0xe6d2f835, 0xbad10485, 0x064326b7, 0xe40854bd, 0x43ae2d36, 0xfb78395d, 0xc852eb99, 0xc4df1702, 0x998613fc, 0x94d9ad59, 0x8e642285, 0xeda5ecc0, 0x18b65ebc, 0x9480cd5b, 0xed41ea5b, 0x0458fe6b, 0x65fcf92e, 0x1ef0a732, 0x0a371440, 0xdcda9c1d, 0x95ca3690, 0x7bfadb36, 0x69c8743b, 0xd848763a, 0x21291a12, 0x359b925b, 0x9be36cb7,
+        0x8d62f724, 0x0e2f1d68, 0xa1400984, 0xd929e929, 0x0830903e, 0x73ba7602, 0x9d5ddbce, 0x7c29e6fd, 0x5cc6ff75, 0x11443271, 0x0cae2adf, 0x3893d773, 0x7d547564, 0xa4f51632, 0x31485c61, 0xf9d01d4f, 0x1f826a8c, 0xf308198e, 0x349b440f, 0xbc89760f, 0x25820045, 0x6bbd0ff5, 0x306708b5, 0xaf8c40a9, 0x0aeb44a5, 0xafabdb75, 0xa29c54bf, 0x3b344417, 0x48286d1a, 0xfea98ee7, 0x89e178c9, 0x6f83070f,
+        0xb1f6347d, 0xbe6931ab, 0x7fc61130, 0x568a7ae6, 0x892a4212, 0x5ce80c3d, 0x71f78613, 0xfd68fd21, 0x1fba068e, 0xb99ebae3, 0x7d880e21, 0xd666d5ff, 0xda5e1640, 0x65e5a64b, 0xdfb9b4db, 0xda08bb6d, 0x4532027e, 0x2bee2b2c, 0x355db93f, 0xf2886e17, 0x90a28047, 0x59d45cd2, 0xa3eb79d5, 0x628767f7, 0x6ac268df, 0x6654b503, 0x34bacfae, 0xb7e6dcb7, 0xf2abbeba, 0xd5feb0f3, 0x15029e4d, 0xf36c7e94,
+        0x1b0fc5e8, 0x106116c3, 0x245cce9c, 0xaa1e5ac6, 0x2a9d26d7, 0x2d22c0b8, 0x9ef7254f, 0x5ef71ba3, 0x92dea4ac, 0x2b1c419c, 0x0d54fa1a, 0x1cfada02, 0xee6336c4, 0x270f0d9a, 0xba899262, 0x65409689, 0xbce330c8, 0x657f64dc, 0x103b470f, 0x0728ae6b, 0xdc45d525, 0x7335508f, 0xef352c92, 0x193a2a5a, 0xfc01871e, 0xea8024ad, 0xdbe36a04, 0x77608d53, 0xc91a64d5, 0xbfc6e79b, 0x836cb3d0, 0xbab552d8,
+        0x2d775ac2, 0xbc7e9caf, 0x6609f616, 0xa8138c73, 0x2249518c, 0x373ee1ff, 0x07e860a2, 0x0d2e9f40, 0xf06b9740, 0x0f06de19, 0x4d2264ed, 0x6be1514f, 0x4ba81ae2, 0xcf770e97, 0x553b4ff6, 0x511b0eee, 0x7791c7c8, 0xe253d494, 0xa5f054a6, 0x68bb4f55, 0x06755aa1, 0x3399e4ea, 0xd79ada44, 0x06872554, 0x8f1cc1d3, 0x11023da7, 0xdaa64b53, 0xad285725, 0x590e9c63, 0x14c15ce9, 0x722ecd7c, 0x54545077,
+        0x0de2a38c, 0x5e9cc7bc, 0x2d56eb5d, 0xcbfed9fe, 0xa9adca03, 0x2d2e229e, 0x54b13590, 0x17bbdf33, 0xe603301f, 0x0f42e5dc, 0x1e3f6b50, 0x4972b692, 0xfd08f50f, 0xb74ada18, 0x8a3c4458, 0x7e58c228, 0xb4f88a37, 0xe7b63daf, 0xffdeaec9, 0x6790ca12, 0x49b07ea2, 0x113f92c9, 0x6a1e2620, 0x60019d8d, 0x76ffc013, 0xd93c71ed, 0xc392b0eb, 0x5d5d8276, 0xd175d1ff, 0x24822a91, 0x19a81e7e, 0x6bf48086,
+        0x2d991284, 0xde745487, 0x5c11089e, 0xff3e1aec, 0x0e8432df, 0x88a01229, 0x859a4cb5, 0x65024cf6, 0x55fa32c3, 0x550f6841, 0x2cf8a548, 0x0b04217c, 0x357d8768, 0xdb4496b7, 0xe7b824d1, 0x2e41e744, 0xace66fb9, 0x55543535, 0x77ed882b, 0x6e6de4f5, 0xe981839f, 0x53d47730, 0x1aa080a4, 0x40a9c1d9, 0xbedc1b91, 0x21ae3f49, 0xbc7c0625, 0x172c6e63, 0x8fd6266d, 0xf3bfa71c, 0x2f275830, 0x4790391c,
+        0x98e2d7d3, 0x9402391d, 0x4cc8aba3, 0x5a5edcc0, 0x2255e170, 0x51247215, 0x366d0ddc, 0xc6d870ac, 0xe51ae5dd, 0x5ec415b2, 0x124abb52, 0x310541ec, 0x3e139975, 0x02d281c6, 0x0dc2d905, 0x646c19ac, 0x7114b24f, 0xe81bbe41, 0x03668716, 0xfcbe970f, 0xe5ae5507, 0xb57c01bc, 0x325830f8, 0xa350df89, 0x17e7214a, 0x9efd6dd4, 0x4eaf98cb, 0xecd302cb, 0x74c031ec, 0xe178b217, 0x1a07016b, 0x04fad3ca,
+        0xfed1dc60, 0xb86c7970, 0x55040935, 0x9750cf8c, 0x4c1eebc5, 0x0e7783ce, 0x0fe2320f, 0xa386f8f1, 0x4c59b785, 0x4be58f35, 0x0bddad32, 0x76ed671d, 0x8163bd16, 0xf2abc08a, 0xc2ecce9d, 0x8d4b720c, 0xa18dcda5, 0x80df7f8f, 0x170323bb, 0x222256de, 0x14b3664f, 0xb68f620f, 0xc6f93c4c, 0xecd35ca7, 0xe7b6e901, 0xe74ef9ad, 0x88a54754, 0xa2e40e63, 0x1bf187ca, 0x578b485f, 0xd3683585, 0xa9e52fec,
+        0x568d927d, 0xa8dc3a09, 0x4b41d16e, 0x453b707e, 0xbf0e658a, 0xa46c783f, 0x02a56ba2, 0x6de39386, 0x0c670b73, 0xcd5dcf9b, 0xaafc8d1a, 0x5509fb61, 0x9a7ce0ab, 0xb5e3c317, 0x86aea6b7, 0xa77ec27a, 0xbace3d0c, 0x3d9b957c, 0xb50e9075, 0xeb4b4481, 0xc8085396, 0x9a9514e0, 0x49b8dbf9, 0x621c603a, 0xb149c6b1, 0xc7b64df4, 0x8e81ea1d, 0x7eb8a175, 0x658262f3, 0xe2935501, 0x0fc467e4, 0x65e283f7,
+        0xc7b99565, 0x4726ee02, 0x566be57d, 0x3e16356e, 0x9b9d19b7, 0x0061bbbe, 0xbdc2d35a, 0x651de231, 0x1ad50a77, 0x33b61972, 0x20bd4af2, 0xc5a6b0fe, 0x8caea916, 0x9bc3d23a, 0x7c37fe8e, 0xc7704699, 0xe3f636db, 0x7fd82ae7, 0xcc88a93d, 0x626f5384, 0xbbfdc6e4, 0xd4aac7fd, 0x0d241625, 0x20c1cd84, 0x12a89c78, 0x3fea0c3e, 0x16a9bc57, 0x80ce9bdd, 0xcc60b8e6, 0x20d276cb, 0xf168fb2c, 0xfa8b34eb,
+        0xaf07fbcd, 0xba141b80, 0x21d0304c, 0x3930ada6, 0xb90479a1, 0xaebd5e13, 0x1c40202e, 0x72de8777, 0x1e1402f2, 0xac0c0dc2, 0xa40616f0, 0xe8cc2e4f, 0x542d2b18, 0xd6b91d93, 0xa760399f, 0x363e6252, 0xbfc71451, 0xf37955b9, 0x954ba8e0, 0xe0bd814c, 0xbd72c22d, 0xb585a23a, 0x3c1d9dc8, 0xf880ac8a, 0xbc262d6c, 0x6c43ca6e, 0xf8792500, 0xd657bf17, 0xddef24cb, 0x17e3c607, 0x16137752, 0xac65b025,
+        0x5dceca5b, 0x192ed0ed, 0x5e83d012, 0xb28ecf43, 0xaf5e06bd, 0x374895e4, 0x9912b3fd, 0xc71fde34, 0xca13c16e, 0x14ab277d, 0x5e1e8061, 0x67c1d12f, 0x34be3de4, 0x351e17ed, 0x162fc765, 0x15c4b379, 0xc59d7614, 0x84e92585, 0x34a715cb, 0xfa7e24ee, 0x6365c519, 0x2a84e35f, 0x8d415b88, 0xeb2124bc, 0x3a9cae21, 0x4e043871, 0xa456387e, 0x94b52a84, 0x7c06e7c7, 0xd8085e5f, 0x26df592b, 0x6358b3f9,
+        0xc82cb19c, 0x018a1a7f, 0x19c15612, 0x028a1af1, 0x4b47ee7c, 0x32c88faf, 0x3cc47a70, 0x64b4b01a, 0x87e73e85, 0x324f2c6e, 0x176c75fc, 0xd5d37d33, 0x67c2c057, 0xc79cf98b, 0x1ad73437, 0x13c39a23, 0x1cbea45c, 0x4a9a7e53, 0xc8d04433, 0x4685deff, 0x4aa45a27, 0x9f281fb6, 0x9a812ade, 0xebd1e00f, 0xf6e4676c, 0x39b5049d, 0x6eb75633, 0x48e85c91, 0xb1db47b4, 0x15aa8ed3, 0xc212cb53, 0x53ea8253,
+        0x6ec1a5cf, 0x0d565978, 0xa7ceb820, 0x9c62ead7, 0x1c18e837, 0x8b691ea8, 0xef0ae2b2, 0x5910390c, 0x2ffd6e67, 0x86e7481c, 0x44244bde, 0xfff6e8f1, 0xcc3e9a8d, 0xdaf19f53, 0x7cd399c0, 0xe7289cea, 0xc4da72e4, 0x20f9655b, 0x6560b2b8, 0x9da640d1, 0x45df5103, 0xd49142d0, 0x0988357a, 0xfce27b2c, 0xac5d0e24, 0xa5474262, 0x6df7efbb, 0xc015c711, 0x73a52eaa, 0xc1e3203f, 0x9c1f996a, 0xaaa93160,
+        0x0f350df4, 0x8a3f3e0d, 0x50d904b0, 0xbaf1f8f2, 0xc5d11e0e, 0xc79d2874, 0xb2496eb7, 0x7d17f8d5, 0x2015c514, 0x9800916d, 0x21519ae5, 0xf798a8f2, 0x17a4672d, 0x14108f18, 0x020082d2, 0x0900d865, 0x6c50e584, 0x5f493e14, 0xa7d3a4da, 0x13f22216, 0xb9117347, 0xc8c0818f, 0x87fd551c, 0x7a2487e2, 0x1bdb7e09, 0x70ce9889, 0xa1bb70f6, 0x48239825, 0x20624b99, 0x844d5547, 0x2261b391, 0x5e2c1cac,
+        0x193d7667, 0x1e2e22f6, 0x245be5c1, 0x993f7cda, 0x2b128462, 0x043ec379, 0x323d5e92, 0x77c03ecc, 0x51465aca, 0x1b441d0d, 0x51017db1, 0x56b6f38e, 0x37b23aa1, 0x163e8d8f, 0x4044474c, 0x34853b65, 0xe4969009, 0x848d2a8c, 0xb4066fe1, 0x7a0e33b6, 0x8e44d787, 0x090239e1, 0x2f370b6e, 0xda675280, 0x3647a734, 0xf35b6e15, 0x13cd0012, 0xda59fa7c, 0xe9eed2d0, 0xfaf4f631, 0xb4eb49c1, 0xdcc02ddc,
+        0x8ecb41ee, 0xd2412d51, 0x503ce1c1, 0xeb2af3ff, 0x2a8c511e, 0x9925b74c, 0x9f5bfae1, 0xd3a77d84, 0xfce94a64, 0x89a08e3c, 0x2ba16ec6, 0xe9c371f3, 0x41feac41, 0x2af3c7fa, 0x6594a3e7, 0x04d5e266, 0x12f1523a, 0xdb4397cb, 0xaf20eb6a, 0xd76476e2, 0x6702ebf4, 0xc9c69f17, 0xfb9b1675, 0xbac1ba06, 0x66f58780, 0xbc0b4da9, 0x9ee45b58, 0x962276e7, 0x2784c798, 0x902fd5ac, 0x619fd6da, 0xec9a80c4,
+        0x29401365, 0x9af0d2db, 0xc213a805, 0x19f03fa3, 0xdf01237f, 0x9e77bce4, 0x59cc8126, 0xbbdba2c9, 0xaf7f44a8, 0x4a7ca0e0, 0x4b4d532e, 0x51916628, 0x87d7527f, 0x92eaa3ca, 0xd519b2f1, 0xa429dc54, 0x98f51e10, 0x0e301d60, 0x55d6f69e, 0xfadbb1fb, 0x4c9a02c8, 0xcae25d94, 0x73dd1ac7, 0xa3a150ff, 0x6c328167, 0x53070d6e, 0x5c0f28cf, 0xf9017e68, 0x8eee01c7, 0x81571412, 0xbe1773e9, 0xebe3b6f7,
+        0x6ca1345b, 0x91d2145a, 0x6dea42c2, 0x7243c56a, 0x1ff7a935, 0xf6e735ba, 0x06414ec1, 0x1ec536ac, 0x4a4994c0, 0xfc23f7f6, 0x51490760, 0x3adf4d48, 0xa7583c9b, 0x98d4b9a9, 0xf4f9c0ab, 0x92024f3e, 0xef8c0ee4, 0xc3bfb04f, 0x753809fe, 0x6984ccb2, 0x3d8ffe15, 0x0e4e7760, 0xc38ed0c1, 0x818953f4, 0xc2634781, 0x2c0ae592, 0xbd9b1c94, 0x876e3f07, 0xbe625be6, 0x88d61be0, 0x1b1d99a9, 0xaec470e3,
+        0xae7abe82, 0x78f1065d, 0x76983ecc, 0x54b0410c, 0x365053e1, 0x5fe0365d, 0x1938863b, 0x234f1c62, 0xd2d5c6d9, 0xbab9490b, 0x2ccd7029, 0x544cf732, 0x29dfb7a6, 0xa916f8bc, 0xaa7e2376, 0x10517fc4, 0xe4f6b3a9, 0xe84a6d7a, 0x843d28ad, 0x1acae058, 0xb3e44c7a, 0x19688a51, 0x2751b2f8, 0x647c34b3, 0xf415c320, 0xaa694f1e, 0x8a77610d, 0x7edf8973, 0xae030a7e, 0x765f54d0, 0x095c31a1, 0x3616dcb8,
+        0xcf27fbd6, 0x68d52d36, 0xbfa57c96, 0x1b93d549, 0x1ec49391, 0x7d4425d4, 0x86695c39, 0x1ca06ed6, 0x5369d527, 0x5bcd20c6, 0x8be41c5c, 0x4a68d9c3, 0x661d0c8d, 0x53eaef35, 0x6a438f62, 0x424fb511, 0x2e44d46f, 0x8b92b330, 0x41610693, 0x11d3638a, 0x0541d53f, 0x04707e4b, 0xec760158, 0x228a1066, 0xa758e029, 0xe583a350, 0xeebfc341, 0xbe08da53, 0x29dbf25c, 0x9a89abf7, 0xebcd0799, 0xf3f04ba6,
+        0xcb6eb2fe, 0xea069391, 0x93d01b24, 0x3e0abf05, 0x70a62c38, 0xe6ede86a, 0x41f2f950, 0x717133d1, 0xc07f8f0e, 0x900bf22e, 0x3a8a155c, 0x59e41e60, 0x106e90b0, 0x0963bc2f, 0xc46fb4e8, 0x90541acd, 0xabd3e80c, 0x58e16226, 0xb7182aca, 0xc58f9082, 0xa45e1929, 0xa1541882, 0x6b46bfb4, 0xe48200ee, 0x6408fbd0, 0xdcab9be7, 0xd0ee8ece, 0x566dbeca, 0x5142f3cf, 0xa9ed9c83, 0xd085ada0, 0xaf324efc,
+        0xca00b8d5, 0x666bb61a, 0xda2df775, 0x04b55856, 0x817166c9, 0x010bc7b3, 0xa2bab478, 0x63ea9a9a, 0xf36dd0eb, 0xfffc2bd5, 0x71a7a299, 0x33376ddf, 0x0f5d64be, 0xa0c76885, 0xdde35221, 0xeb6335d3, 0xa19595bd, 0xda4ff304, 0x5ae61b4f, 0xd3ed74d8, 0xff3b9b30, 0xec71c819, 0x39634da8, 0x469f649c, 0xa707088c, 0xa51f5b76, 0x9ae0aaba, 0x6b0e612b, 0x6322842e, 0xfdf6bac0, 0x246660a7, 0x7882c7d4,
+        0x066f3f17, 0xace2d0e7, 0x6bce032b, 0xeeeeb979, 0x2f213246, 0x9233ce13, 0xb9cc687c, 0x703733ba, 0x5ed016cb, 0x51ee8b31, 0xd7707b46, 0xea5bd791, 0xbbf67a05, 0xfb6b6fcf, 0x922ec070, 0x479ac0a2, 0x2d465f93, 0x05101e8b, 0xf5171e9f, 0x5617ab37, 0x43ec2503, 0xe2da9003, 0xecb15570, 0x1c7be16c, 0x3949047b, 0x4fe44d8c, 0x5fa1e0b9, 0x865aebcd, 0x16666c57, 0x1e8f5de9, 0xa3dead8e, 0xc2c8cd0f,
+        0x2e3ce889, 0x500a0ae9, 0x0b887832, 0x49fb0cac, 0xb921e5a5, 0x53684e81, 0x58f1ac65, 0x69625c78, 0xa91e2f26, 0x436b3301, 0x6245367e, 0x7c85ea07, 0xa099c7c1, 0x3a09933c, 0x058ad79a, 0xee69bc61, 0xe91b1d72, 0x0b676e23, 0xccf1697a, 0xf9fa436c, 0xbeefdc5e, 0xc8726697, 0xd0282955, 0x735586ec, 0x62205cec, 0x36c6413a, 0x9e060308, 0x1a64a160, 0x9353a181, 0x8b847e72, 0x87b177e7, 0x893d0273,
+        0x466af8a4, 0xaafdc83b, 0x3fa625d1, 0x14b17e29, 0x739e9922, 0xa59332da, 0x3a4b6351, 0x254f6141, 0xcdf0686e, 0x67310e80, 0xfc7153d5, 0xeb1eda59, 0x07ad8d65, 0x6c66fd97, 0x892149cb, 0xa46ec92a, 0x164ab140, 0x9d9b82fb, 0xcd55dd49, 0xccb5ab98, 0xfd3899c0, 0x7157b906, 0x112363df, 0xb3436262, 0xf07c692d, 0xd1ae2ee0, 0x04a74860, 0x43eeb0da, 0xaf100c24, 0x0e42b551, 0xc8a2f426, 0xb51ddbf5,
+        0x88bd3d50, 0xccf86b3e, 0xe2a6eaa2, 0xf7a1528b, 0xe6252f59, 0xfdf71ba0, 0xa03d72c1, 0x0ad01711, 0x234b61cb, 0xec5af39a, 0x37c1d87e, 0x1015004e, 0x2ea0cc20, 0x61a94d4c, 0x0ab4b4f6, 0x20b23117, 0x1b608754, 0x706cd381, 0x9dcf3d8f, 0x0233c6f9, 0xf08d9fa2, 0xdfbeae3f, 0x5abd9c4d, 0xe3135b87, 0x691efce3, 0x84bc1ca1, 0xfbfe52c9, 0x4e477293, 0xf2117a59, 0x657a2c5d, 0xad3895ec, 0x67136e10,
+        0xfd016092, 0x39964727, 0xc44f0fcc, 0x8d21f76f, 0x5631ec59, 0x49306e03, 0xa991db89, 0x5f0907dd, 0x3e819dd3, 0x0ca9643e, 0x4ba65cfa, 0xd06badb5, 0xae202b6a, 0x9f0d6c09, 0x8720f852, 0x4f9165c8, 0x695e314e, 0x3aa61704, 0x9a467f8b, 0x6e49d108, 0xc0221507, 0xb979edd0, 0x95626e10, 0xdcb07ff6, 0x8d424628, 0xae9ede39, 0x9564e24c, 0x93c4565d, 0x8306a14f, 0xcd4dcd33, 0x1524cc0a, 0x2ac663cd,
+        0xb835bf9c, 0xa332d3f4, 0xff04163b, 0xfdd83fd0, 0x5ac2c28b, 0xe8ccf1a1, 0xf8a46af9, 0x7950c3f4, 0x58b0ddb1, 0x9c32b2f7, 0xe2f489d4, 0xe5d72a24, 0x7466e1ee, 0xb665212d, 0x69d65eeb, 0x6cf25d12, 0x37bd49f4, 0x871490cc, 0x202ae62e, 0x3a84d2b8, 0x4f1506c1, 0xe50348d9, 0xb9e1faeb, 0x1bd95560, 0xc86a4dc2, 0xf32d2d80, 0xb19c10a2, 0x65e893f6, 0x02826688, 0x072d0b3f, 0xd7dcd444, 0x7272f590,
+        0xec1df337, 0x34b6fc63, 0xc55d4161, 0xe40fb6d2, 0x0aebc191, 0xf0beae67, 0x60d0ce95, 0x13733aa0, 0xb44f9a00, 0x2376c0fc, 0xbac15dee, 0x839521e3, 0x396a38cf, 0xddf962fc, 0x44e0c54e, 0xce67bdf6, 0xac4bc52d, 0xd70d4086, 0x7a3cedb8, 0xeaa801cb, 0x9fabe0ea, 0xd314b265, 0x3c87a7ab, 0xa7fb2732, 0x2d57fb70, 0xe751ecd5, 0xd4638254, 0x474f8b57, 0xc454fa7a, 0xd3018121, 0xef39f7c1, 0xaeec97c4,
+        0x1b9e9b60, 0xb7823b4e, 0x2ea6762c, 0xc7e7d0c4, 0x195e4ee5, 0xa989eb1d, 0x7d612906, 0xc034e4b8, 0x317886b7, 0x33bf82ef, 0xe5592669, 0x919bc0c1, 0x195df06b, 0xa60b3eba, 0x0b4e6f4a, 0xb2a35ec4, 0x8eaae525, 0xa3349626, 0xc5c23c8d, 0xcf23293f, 0x4fdb4da2, 0xca1217c2, 0x2dd1cbb6, 0xb9b24fa8, 0x56c5cca6, 0x06f088da, 0x35cc1aae, 0xf3fe3e73, 0x82995b06, 0x22e8f255, 0xe8077e17, 0x357b6ea0,
+        0xa10128dc, 0x217739d5, 0x19fe1ff3, 0xdf139f6b, 0x640f0e97, 0xe3911f11, 0x0dfb5adf, 0x01a16f0f, 0x805413b6, 0xb202e6ac, 0x6e85475c, 0xd1de7cf5, 0xff601d6d, 0xa7878a40, 0xcfc52fc9, 0x75caf69e, 0x7c53aae4, 0xbbad9deb, 0xe4fa872c, 0x9123f46a, 0x233640f9, 0x719b0cc0, 0x63d75cbc, 0x869300ff, 0xed6737a5, 0x90df28bb, 0xeae0e02b, 0xa4124873, 0xb6acc95f, 0x9895bb6d, 0x9e4b5bc2, 0xc4674c7c,
+        0x57e1b718, 0xad9867ae, 0xef9f7cbd, 0x225be46f, 0x1ff1310f, 0x403674c3, 0xbb07a479, 0x54d3a8db, 0xa57f8b99, 0x2ef7a531, 0xd54972d5, 0x98606d22, 0x65f5d2e4, 0xc638a025, 0xbff4593e, 0x5825ad31, 0xd5d102e5, 0x4b9db004, 0x528cc3b5, 0xe76896d0, 0x8d61047c, 0x79f11591, 0xfaa834f2, 0x92ea54f8, 0x8c9f7be6, 0x45d19b01, 0x5496a458, 0x28b16b5f, 0x9e95b019, 0xb2539ba7, 0x5c52ada5, 0x31917eed,
+        0xc1aa9c10, 0x239f3650, 0x69f5665a, 0x1b5071d8, 0x7e0a5431, 0x4d6e9edc, 0xb1dab156, 0x4b5ffa5e, 0xf905168c, 0x0107916c, 0x53e7bfd6, 0x235e1d66, 0xd67a44f1, 0xbe751c65, 0xbd33d662, 0x2c2c67df, 0xf444c6f6, 0xa6a13630, 0x082c14de, 0xcdc679c0, 0x5b5bc40c, 0x84e2b396, 0xa9a3ae9c, 0x16a924e3, 0x48107c6b, 0xb286b612, 0x3afa6277, 0xdd7204d3, 0xb60c854a, 0x749224bb, 0x9fe402a9, 0xe3a0f034,
+        0x973220e5, 0x883213b9, 0xa9127665, 0x52cb8521, 0x0c2c8b1f, 0x2e5e42b0, 0x5949f600, 0x8f237ba2, 0x738b0e70, 0x3fe27659, 0x3dabf323, 0x60973e9f, 0xb70d30b4, 0x1a332012, 0xdb2ec337, 0xfca68fdf, 0x4810e379, 0x40da2a07, 0xbb2625a6, 0x6b045f0b, 0x23446dc7, 0x6fca1bef, 0xd63376c1, 0xbb77285f, 0x237b66f7, 0x62436e29, 0x9694e3e7, 0x4b95c832, 0x5dbc73b8, 0xd94bafa9, 0xce87cb2f, 0x2071414d,
+        0x80f7c703, 0x7a181bfc, 0x7d560df3, 0xc8fd096c, 0xe08643c0, 0xff7f9eb4, 0x5a678073, 0xcb623af1, 0x730ebbb9, 0x06fd1a16, 0xf6a9ebb6, 0xf5958a6d, 0x0ad40741, 0x55e2dfe5, 0xf913cc2a, 0x0c098e92, 0x306fdc0f, 0x9b1ebc77, 0xaac86546, 0xf95bcf9a, 0x9620e80a, 0xb0ff9409, 0xacd42ada, 0xacab0448, 0x5c6bf0e0, 0x336863de, 0x9eca9125, 0x357a2119, 0xcfa79581, 0xdd047645, 0x04ee0ede, 0xdd93db8f,
+        0x1578bbe7, 0xb89b520d, 0xf98c9a32, 0x0529bd60, 0xa6bed7d2, 0x5fe9220c, 0x3b3266c6, 0x5031e030, 0x674b320f, 0x7f90ef75, 0x1f3cbc8d, 0xbaabc2c5, 0x44b8681c, 0xb70661c8, 0x420234f7, 0x20428a16, 0x54e8034b, 0xccf4fe02, 0x26f8cefe, 0x54ae7c8b, 0x591707b5, 0x69e7d7a4, 0x1f25023e, 0x5444cd23, 0xe257daca, 0x9d8ba71f, 0x1822a0e2, 0x505c3d77, 0xee172475, 0xc8aa0b7d, 0x66262c22, 0xaba28198,
+        0x0c22809f, 0x89951216, 0x57a5ca39, 0xb8bd1796, 0xbc684722, 0xbad30960, 0xcb704a2a, 0xa3b515aa, 0x8b7ef3fe, 0xa2ddf00f, 0xafac574a, 0x1a1d5519, 0xe4c51cd2, 0x1d5e7a17, 0x0e06d5a8, 0x8e5b3ed3, 0x4dbcc089, 0x778ae5ee, 0x0bd335ac, 0xbe5cdb35, 0x320ac3e1, 0x177b0e82, 0xb85cc92e, 0xcc0c6fb7, 0xb8c4d288, 0x8baef279, 0xe0b7709f, 0xf8709ced, 0x951a53a7, 0x34afa17c, 0x12185e55, 0xe699ec0c,
+        0xec38fcf8, 0xbc30980b, 0xcce52f6e, 0xca3b9729, 0x4933d034, 0x65c1786d, 0x8b2d8366, 0xe8baf276, 0xfc1a4bbb, 0x1d556ec4, 0xb736ad8d, 0x262fc8de, 0xd6c6b637, 0x36f7123e, 0x6eea2a11, 0x2167f02b, 0x787adc86, 0x11c1517d, 0x8f8aea1e, 0x16eb7779, 0x44e32ee3, 0x98c43010, 0xbfbfac9c, 0xf4fa4075, 0x80feca0b, 0x1eefbaff, 0xa595516e, 0xdb06b095, 0x4ec86a02, 0xd27db2b8, 0x23837536, 0x78d74fc2,
+        0x79bf25da, 0xac2fbb0a, 0x5cca21a2, 0x29fc4d57, 0xc9c1cd34, 0xc414e2c9, 0xc7c17796, 0x3dd8efd7, 0xab239dc4, 0x89906d14, 0x222d4f06, 0xb914b4b5, 0x0584afc7, 0x349a2eda, 0x8f51b879, 0x95892f34, 0x4d0279aa, 0x24fc7eca, 0xf07d27b1, 0x750cbd8b, 0xfb1c8026, 0x6aca3bb5, 0x495ff422, 0x65575686, 0xcd028ef7, 0x73710096, 0xe5678dbe, 0x9fd1b530, 0x98f7806f, 0x8f6324dc, 0xe24eeba1, 0xc8676293,
+        0xf19863f6, 0x4d1de71a, 0x8c959fd3, 0xce6b4c17, 0xba778f08, 0xb3c2a9fc, 0x93a66e87, 0x57f96772, 0x069e9871, 0x05465986, 0x724fdab2, 0x6312c49c, 0xa5740b9a, 0x514b7948, 0x856d8e8e, 0x227410a0, 0x5f4fe1ea, 0x6f7a5c51, 0xefe80ead, 0xbf143d23, 0xd45c436e, 0x02662bda, 0xd95daa60, 0xff4d8388, 0x5f5e676f, 0x4811e68f, 0x97daf1ba, 0xf870c7af, 0xdf5f9ad6, 0xc99e15de, 0xeef9f614, 0xfa694b2f,
+        0xab207991, 0x27696e0c, 0x34ef4d57, 0x634fdd2c, 0xa762c08f, 0xeb084d11, 0x1271f868, 0x80f33888, 0x681f414f, 0x75b1bd04, 0xaabc0664, 0x1e60f64c, 0xef08a51f, 0x997c83df, 0xcf9a6bc4, 0xd93a5b53, 0x7c0b5b15, 0x26eab470, 0xc1ba50e5, 0xa40aab3c, 0x6ac39f39, 0xb5a45ded, 0xf8c6f782, 0x14cc9a3d, 0xfcebe8fb, 0xb87e8e2a, 0xdd38c5c5, 0x00dda5ea, 0x638de300, 0xdbe93654, 0x7469f5c1, 0xfc68f121,
+        0x3f26e470, 0x31945ad9, 0xc8cff3b3, 0x5620c800, 0xe201a538, 0x9d43e80e, 0xe9e9023d, 0xe903750e, 0x8eebc2c0, 0x0675d1f6, 0x994f6b8e, 0x1f4cd75a, 0x261cc8f9, 0x27e253f2, 0xe6539f66, 0xbecf4148, 0x734cfe61, 0x19d559be, 0x34a6f158, 0x1d842a32, 0xe64f86e5, 0xf067712a, 0xc338ce50, 0x801590f8, 0xe1ea9f69, 0x2b9ddd8c, 0x48f27f54, 0xdb3cc749, 0xac5889d8, 0x5509cd68, 0xaa0e3f66, 0x86ec9d32,
+        0x1f70cdb6, 0x720e2342, 0x68460523, 0x50b2cc69, 0x467934af, 0x2754dae3, 0xb777ab07, 0x509f9247, 0x488be0e7, 0xda59043d, 0xe56d49c3, 0x670ca230, 0xd39aac9b, 0xf067b9a7, 0x63d8c707, 0x68df5306, 0x7f769128, 0xc4e81c25, 0xb1dec0d1, 0x5cf468b3, 0xd59934fd, 0xa429d26f, 0x9c10b0fd, 0xde9f89ee, 0x9321f971, 0xed64b019, 0x53777ffc, 0x69d78350, 0x74d83e14, 0xedfc1fa0, 0xb6bb4eba, 0x701fdd6d,
+        0xe2685e79, 0xcf05bac9, 0xb889ff5b, 0x5a5be0fa, 0x04c3ce8f, 0x55e6b1c6, 0xacbe2683, 0x536947d0, 0x70421d41, 0x18d36cc6, 0x7014fbb7, 0xb86248d3, 0x1df62005, 0x01a32245, 0xd08efaa3, 0x690f06bf, 0x5329b9c8, 0xe6c423cd, 0x3f08ce45, 0x0ff2c3b8, 0x57bc0dbc, 0xe50ce83a, 0x602d5c20, 0x75a4bb03, 0x8beaf300, 0x565e548a, 0x8fd9ffc4, 0x6c49006c, 0x65549b00, 0x37c2650a, 0x65ebe7d3, 0x18eb1e32,
+        0x83ef1b22, 0x3f8da73e, 0xa853ebed, 0x73627ca0, 0xf36f2db5, 0x6e89f1fe, 0xb8ebd50d, 0x6ace6b9b, 0x666ba04b, 0x70fc6976, 0xd4f58535, 0x2735c3c9, 0x2263ff60, 0x0296e262, 0x0f7ac01b, 0xbfcf5e0a, 0x159136e7, 0xf3ce91d4, 0x29f53d7e, 0xe8c39289, 0x530013aa, 0x12ff51a4, 0x4d3df757, 0x835f1a89, 0x02fd8691, 0x171e0df3, 0x8a37386a, 0x08393eb7, 0x186a584d, 0x1e24c526, 0x2581ff69, 0x266151ee,
+        0xa1927847, 0xda4c2e72, 0xdbfc6c3b, 0x3ef9a58b, 0xf96696b0, 0xe9cef112, 0x92227788, 0xca5842c9, 0xff319347, 0xf4e140c5, 0x8db4e684, 0x591e1765, 0x83f515cc, 0xafe31ba4, 0x54a7947a, 0x966a5055, 0x6e149911, 0x6a910ba6, 0x7de703b5, 0xf992286d, 0x122f7c99, 0x01acba73, 0xe342e09e, 0x90b7ba7c, 0x108bd3af, 0xbe4aca2e, 0x6fa9d12e, 0xbefd7fb0, 0xd39dfdc8, 0x46b1ad06, 0x65003992, 0xef593901,
+        0x9d0cb098, 0xcebb8891, 0xd192706a, 0x82cfd92d, 0xe2e04ca2, 0x6abed3fd, 0xee5d54f7, 0x27dd1397, 0x30d7433f, 0xfe39732a, 0x42327256, 0x495b7f8e, 0xe5da8691, 0x44b7c36d, 0x97e6901f, 0xc86a9c55, 0x80fba9f1, 0x0f91c44c, 0x9ce116d6, 0xb5ca9d96, 0xd1c5a7fe, 0xa001d676, 0x8829e375, 0xe08cbb9d, 0x33bb3190, 0x5817aac6, 0x74325cbf, 0xb7ba3eed, 0x6d8b91fa, 0x71d4cff6, 0xf74f3bbe, 0x2e5af513,
+        0x9ebbed9a, 0x99c84083, 0xb2051378, 0x6ba38233, 0xb85cb54d, 0x02d47b19, 0x58ce1f87, 0x4b66652b, 0x84597be9, 0xa4030f9f, 0x8e838a1b, 0xb2ce4cef, 0x28101216, 0xc099f5bd, 0x8fe2e7aa, 0x71a7bfe5, 0xb1dea0d0, 0xdefe0f4f, 0x6d2c30b7, 0x1896cb67, 0xd615d16b, 0xdb55e007, 0xbb3c2ecf, 0x4f102904, 0x5c2afe97, 0x7a6cee4e, 0x7447431c, 0x9464399b, 0x62ea72ce, 0x4faa4393, 0xc68abfc1, 0x05d0f501,
+        0xbbf930fb, 0x8a8d0b6a, 0x6e26b042, 0xc64b79ab, 0xb199c4c3, 0x4b5e2792, 0xf1f982d9, 0xb90362aa, 0xc8c377ae, 0x8ee64411, 0xb4a05b6d, 0xbd350709, 0x1bfd5424, 0x38b88434, 0x63d27ecb, 0xe18f2357, 0x97458845, 0x61241470, 0x7599ee43, 0x539a2bc4, 0x0ce314c5, 0xa5cc8ee4, 0x3a8b44eb, 0xf2f1defe, 0xd58d6a19, 0x7f5cd65f, 0x04014a6e, 0x1be682bd, 0xdd1c27b0, 0xf4eb22de, 0x13fc554f, 0xecd4fb7c,
+        0xab466007, 0x6040564b, 0x800dd978, 0x77026d80, 0x37ce7111, 0x62e6d76a, 0x9255687b, 0xf3eb45c9, 0x1f47c9d4, 0x39230375, 0xabd18cd2, 0xe6ed1eae, 0x997e7043, 0x02bbd7bd, 0x0e547419, 0xaab0c2d6, 0x0e6c7ee1, 0xf0035b7e, 0x270a482d, 0x045bb460, 0x0505e2e4, 0x00910812, 0x6f67aa24, 0x064c8450, 0xd50c7779, 0x9af2d732, 0x9e0d4842, 0x1a231262, 0x85273399, 0x6393f1d9, 0xdd2677d3, 0x2c6d8ec1,
+        0x1902bb1f, 0x9b201e55, 0xe8761be6, 0x9dfbbdce, 0x1ba6fb7b, 0x45ea5267, 0x8459e65e, 0x4150b1dc, 0x24a5df99, 0x08986603, 0x8f32e8f4, 0x56868ec3, 0x012c2154, 0xb8a763b3, 0xc4454561, 0xf416f30d, 0xd9450218, 0x1b9d3f4a, 0xeab4cc6d, 0xe022c7fa, 0xfca9f3f8, 0x7315341e, 0x81506727, 0x42d2e804, 0x457be328, 0xc26743f8, 0x19cac905, 0xce0e43f5, 0x82026188, 0x3dcc2da9, 0x95ea7ad1, 0x59079ed5,
+        0xc34c9198, 0xbbd0fe56, 0x153d0a42, 0x45c12572, 0xa95e5e3c, 0xe3963d79, 0x8458bc86, 0xc70d49c4, 0x2bc9cd9d, 0x4a8a1922, 0xf0455409, 0x25abc32c, 0x9729e7da, 0x7552fc44, 0x70cd6f33, 0xbacf46bf, 0xf121995d, 0xc95cb308, 0xa7e9f7cc, 0xb7fda22c, 0x73b2b6c8, 0x46ba203d, 0xd6f66900, 0x04365608, 0x885a0392, 0x61aa956c, 0x8dcb8afd, 0x8a01e5d9, 0xae18c64e, 0x56c26f09, 0x5e002853, 0xd6134fe0,
+        0x3d422633, 0x7ebaf78d, 0x94345463, 0xd7fbb830, 0xddec4f4d, 0xe9274abe, 0x68228590, 0x8f2d85d5, 0x1cd45884, 0x5de5625d, 0x719fe176, 0xc9aa0f8c, 0x4cd8e28d, 0x4fdd45ff, 0x66c149fc, 0x916baef6, 0xd5575093, 0x15ac8268, 0x6754355a, 0x12ba1279, 0x63e291e0, 0xefa816c6, 0x5c4660e4, 0x87892170, 0x23e7c671, 0xa9353c67, 0x4297e460, 0xa3520c22, 0x163983b4, 0x98243e7a, 0x6decfbc6, 0xfe2f2613,
+        0x41dd48cc, 0xd3486877, 0x4c2c96f0, 0x9d6c12c2, 0x6cc38541, 0xbd9d6ec6, 0x1e845dfe, 0x85481f55, 0x7ebcb4a8, 0xb86f32da, 0xb4d71ab7, 0x1f746f7c, 0x3e5ad30f, 0xaeba94b3, 0xc8fa5a47, 0xb7cbf943, 0x12f788c0, 0xacbcbe1a, 0x64d58b5a, 0xaa951393, 0x00de6fea, 0x790adc59, 0x387e47e6, 0x0eae9f19, 0x00553bf7, 0x60483763, 0x306e1421, 0x9fec657f, 0x2479d5d3, 0x1d42a654, 0x44a0a0e3, 0x889e90fc,
+        0x2cc5b9ea, 0xa793a03a, 0x237e7fbc, 0xf4e9f14f, 0x9950913e, 0xf4998ea1, 0xe6abbb09, 0xe5ad2d4c, 0xf07b3130, 0xe7f9bb88, 0x389f8b7f, 0x25229883, 0x7b9059f9, 0x6057ef1c, 0x604243b0, 0xaea260a6, 0x861672cb, 0x88875552, 0x43ceb0a3, 0xb72ee312, 0x117fdbd4, 0xd2f0fe8c, 0x6fb321b0, 0x01172405, 0x2c81a1fa, 0xae57f3fd, 0x06aef49c, 0xbdbf63a2, 0xf465cb88, 0xeb049e7e, 0x6e3b92c6, 0x948a782e,
+        0xf628b3e5, 0x055969dc, 0xc32d986e, 0xd6510a20, 0x01e19a1f, 0x98d952c6, 0xae170325, 0x46573ddf, 0xb4b9305c, 0x50af1430, 0xa5272913, 0x017eb639, 0x8d642d9a, 0x7b5b3a86, 0x37d5f940, 0x2b215c18, 0xc5b9cac4, 0x6006e5d6, 0x3a601079, 0x8367b551, 0x5ef0fd6f, 0xf9d919e1, 0xe413e945, 0x2af41d90, 0xdb3b844c, 0xddf09e6c, 0x6705e285, 0xba186e84, 0x5169b372, 0x6935c73e, 0x9bcf881c, 0xae1cfe4a,
+        0xe9028deb, 0x5d065c14, 0xe8baa8b6, 0x4ba9474d, 0x9772bb29, 0x7607fb26, 0x55236652, 0xb0ba22d0, 0xda6260cb, 0x26e8cd8d, 0x7140fd12, 0x1372e9e9, 0xe783d736, 0x973c6f09, 0x087e7216, 0x7bb883c0, 0x884d1a0a, 0xcee62a97, 0xb76c5eb2, 0xf741bd96, 0x2de6b9c9, 0x1a9ddede, 0x5627059a, 0xb2bdf814, 0x300df4bd, 0x7954ff88, 0x5269d1fa, 0x1bb66494, 0x67632757, 0x3807e49c, 0x8c6ed748, 0x6c964cb9,
+        0x0c7a21e5, 0x306c557f, 0x8d7fda6d, 0x1b9d7095, 0x465a0a5b, 0x62c2517b, 0x3dd30ee8, 0x156680d1, 0x3e3ec330, 0x8dd978fb, 0x2776fe7f, 0x0470523d, 0xf4d7b3c3, 0xff1c3f94, 0xef8780f1, 0xffcb1b3e, 0xd19744f6, 0xa494621d, 0xba6f5e4e, 0x9a96bc4e, 0x2d01ff42, 0xb992b75e, 0x5c4145bb, 0xc69967f2, 0x30548a3f, 0x3277a968, 0x004e89db, 0x19e28add, 0x5100de96, 0x3a614579, 0xb31a1952, 0x62695467,
+        0xa010b92d, 0xb43043b9, 0x8b061f78, 0x565f26a5, 0x7064bdf8, 0xf237fdfa, 0x4994d54e, 0xce878198, 0x806cbb22, 0x89bda905, 0xc2f4b0d8, 0xcec1e63f, 0xc32d2c80, 0x1e099fca, 0x9378665d, 0x4cc39ae8, 0xbf66d4ee, 0x60d888cd, 0xa541bfda, 0xbd08ca94, 0x1f8b5072, 0xcb760515, 0x812037dd, 0xca2aa1c5, 0x58e61e01, 0x6a718d71, 0x1796fd85, 0xe51ecd29, 0x25d9767d, 0xaf7200f9, 0x32bb3fe0, 0x091b38d2,
+        0xac19e6f1, 0xdfa16750, 0x6e778443, 0x93600ac7, 0xb1c4747a, 0x127a4362, 0x41bca205, 0xaae746d3, 0x027f8aed, 0xd0e105cf, 0x8843b417, 0x735e20ef, 0x47863b59, 0xcc369500, 0xf23c23ba, 0x5edb6ea8, 0xe80caa60, 0xcab80e9d, 0x6486f9fb, 0x9b9e9703, 0x065ce9bd, 0x03fc3a43, 0xabe3483c, 0x54e0b4cd, 0xd650d08c, 0xa0ed8c22, 0xf8b43355, 0x34fb4cd1, 0x0e93274e, 0x88172718, 0x73486bea, 0x0266d421,
+        0x951cc618, 0x86c9f18a, 0xafc77ef6, 0x6bab159c, 0xb82cbea5, 0x80918dc6, 0xa6691204, 0xd4b1c5b4, 0xba17127e, 0x79403d8a, 0x5fb47b0d, 0x53bfcf90, 0x94e2902e, 0xdab5e182, 0x1db9f15b, 0xf6c80dfe, 0x0ec26fba, 0x5f1dff7e, 0xfad1e4c1, 0x55e13bd9, 0x48ea3520, 0x7fedf53e, 0x98503c4c, 0x9ac8301b, 0xf6502f7a, 0x8d6e990c, 0x2f8f2a1c, 0x6d2e1d96, 0x316b0eae, 0x8393d727, 0x5775fce4, 0x8293a1b0,
+        0xeed26595, 0x085df1a4, 0x6402c9b2, 0x2b0d3a23, 0x45f187b2, 0xcca51e85, 0x26e600f2, 0xd551b577, 0x65a8ecd1, 0xa448c505, 0x5fedcfd6, 0x250e648a, 0x2190bbce, 0x1631d366, 0x6f5ed418, 0xbe52153c, 0x176d683b, 0x62a70010, 0x9d58313a, 0xdf3e9a59, 0x02cf8692, 0xd2a16315, 0x92c13159, 0x31ab3bc3, 0xca2bbc66, 0x4729b7da, 0x3c40ff20, 0x89fbf9da, 0x72b16b9b, 0x0a54c41a, 0x91c1752c, 0xc7599d7d,
+        0x0fb80157, 0x148806f0, 0x7f0cc9c1, 0xa9886000, 0xa46ec563, 0x7221a391, 0x38a4def9, 0x94f8c88c, 0xd64954c2, 0x53b934d7, 0xf89862f7, 0x4802832a, 0xd8abe4d7, 0x06e7f569, 0x81892e31, 0x56bfe594, 0x47646444, 0xec2a8e0a, 0xbf224e67, 0x330f5d76, 0x3ca77828, 0xd98c4754, 0xf5149481, 0x9c45b92a, 0x9ec95c95, 0xcfc229a1, 0x99aac7ab, 0x5fdb3f81, 0x2c2fcf04, 0x0dc0bf74, 0x1720f6b4, 0xed00df20,
+        0x4158dd1b, 0xe212b768, 0xdbcb4754, 0x088a8d60, 0xe93bb0ae, 0xf673f098, 0xb31b32d4, 0xab4ba05a, 0xb9a58d00, 0x13b1956f, 0x3ad9d077, 0x33fd2ec6, 0x93783d5d, 0x1d2f111d, 0xcf8552d0, 0x81d2070e, 0x67624779, 0x5f540e29, 0xfd0a5b19, 0xb5a4110e, 0x170a298b, 0x78612863, 0x52293111, 0x3955344d, 0x82ebb227, 0xd8e22b66, 0x0f83e610, 0xd2b84bec, 0xb9c6af0f, 0x55da35fd, 0x8e7a7012, 0x13cbe37c,
+        0x87842166, 0x67c416e3, 0xd479ba9e, 0x4eb26a62, 0xdbd7a1dc, 0x73dd13c9, 0xc9fdcca2, 0x69da1e65, 0x515d81cf, 0x5abc56c9, 0x73c3de2d, 0x075b02cb, 0xc092033e, 0x1401fcaf, 0x1c1fe59d, 0x8a4179fe, 0x1c181365, 0x60c56a0a, 0x4517189a, 0x2aae360c, 0x864ea212, 0x85e6382c, 0xf8ffa93b, 0xb04cdbdd, 0xb5dd57f3, 0xb083443f, 0x4fd60db0, 0x4aba625c, 0x4a9cef35, 0x7b76f635, 0xd9b104a7, 0xcf804835,
+        0xe961b9b8, 0xfcc5608a, 0xa3a79a19, 0x0d4effba, 0x415ff2a7, 0x30544c0b, 0x16b2cdf6, 0x99b02d0b, 0xd697eb0c, 0x714b0f1b, 0x95b01e92, 0x98c9305c, 0xf2b74112, 0x5c9f66e2, 0x0f9f978a, 0x37ef0e9d, 0x95ab0d7d, 0x6e687a9e, 0x48fcd7e1, 0x7dd50f86, 0xd3e64162, 0xb67554a7, 0x30e47cdf, 0x2632b919, 0x7149a4c8, 0x194ac163, 0x64b69dc7, 0x8dc02d7b, 0xd39a5a2b, 0x7db4c47e, 0xad476c91, 0x4f67f9f5,
+        0x352578f1, 0x99b2f455, 0x516f4fbd, 0x9c25b7b0, 0x22416fda, 0x6f99cc0e, 0xabe4fdf0, 0x764953ef, 0x922c789f, 0xdb59e8a5, 0x2b75dabf, 0xe42c5235, 0x25ccc4cc, 0xef7517ac, 0x79e05c42, 0x21fb1f95, 0xe8796662, 0x22870161, 0x8d5b57ac, 0x8b4cab9d, 0x086ebfb7, 0x90c17879, 0x0dc9f5ef, 0x9c0f7f96, 0xce189fb5, 0x6efb342e, 0x738d4d71, 0x798126b8, 0x61f51a69, 0x8f2e8d53, 0xca2616e9, 0xd6b75ed4,
+        0x5d41e77c, 0xf6e9227c, 0x884815c2, 0xc6c8cc53, 0xb62f225a, 0x31595951, 0xdf1915d0, 0x40316465, 0x54250088, 0xe55659c4, 0xa66e228b, 0x4cfd07fe, 0xf98edc8c, 0xf50b2e53, 0x137298d9, 0xa292e6b9, 0x9646e353, 0xe5f71f24, 0x69f47724, 0x618a5c33, 0x4f239093, 0xcd663fbf, 0x438aa0b6, 0x9f6ec78e, 0xc23e819e, 0x2e9eced4, 0xfec67973, 0xdb454cdb, 0x2fc32563, 0x57a32ac8, 0xc7f922f0, 0x2e416fe7,
+        0x321fd118, 0x290fa6e1, 0xfe0b3cce, 0xbd9972b0, 0xcd6103a9, 0x27cd4c25, 0x6c9a1f2e, 0x28feba85, 0xba96d284, 0x6422393d, 0x7f9419ad, 0x9643c590, 0xcf19fc6a, 0xa337b438, 0x5b442b7c, 0x10437218, 0x12c014fe, 0x5e3e583d, 0x974b375a, 0x64f7a765, 0xe90211d0, 0xb18e70b1, 0x319aa4e0, 0xb750b8fe, 0x6eafa7c8, 0xa3df32c4, 0xbfc8ee91, 0xbe9e5a0c, 0x0a07fe91, 0xc54b9ba4, 0xf2425ac0, 0x14d1103e,
+        0xc3801850, 0x6fb53386, 0x8f0edd1a, 0xa62b93a1, 0x2f1054c4, 0x50a592dc, 0x7f7992d4, 0x9cb4e6c8, 0x8491877a, 0xeb0fd8fa, 0xfe86b5af, 0xf7f1348d, 0xdad78f52, 0xae70a6c9, 0xf6601adf, 0x34d5f4a7, 0xadcf13e4, 0xabc1bdd7, 0x674bddf8, 0xa6714648, 0xef5aca18, 0xaca12c6a, 0x7abf7fde, 0x536e71cb, 0x3b56b1f9, 0x7ca44a38, 0x6573471f, 0xc895e904, 0xb47ff503, 0xc60ba332, 0x8efdb985, 0x92954ace,
+        0xc1b28cb7, 0x9bed4bae, 0xfed7d8ac, 0xf2422334, 0xf661e790, 0x732f3214, 0x88fa286d, 0x31ecb769, 0xf6c03144, 0xee8eea83, 0x1d99a855, 0xcd3cf0a2, 0x0d2bb724, 0x06deb863, 0x4de9d009, 0x00a639cf, 0x948773a6, 0xa608ae75, 0x87ed4949, 0x710d4017, 0xe6b592d6, 0xa6afb271, 0x8a61833c, 0xef8f8ddd, 0x6e96481e, 0x21159dd2, 0x8aec3949, 0x1d4370c5, 0xb660d107, 0xa06ae123, 0x0444cb55, 0x15fce682,
+        0xcd0926a6, 0x18f9b729, 0x247b7db9, 0xcf61ba04, 0x7a7d4d84, 0xa8b586b3, 0x41bff62a, 0xb543cbbb, 0x5e7ccaeb, 0xe5d352ae, 0xa9696cec, 0x245b9a6a, 0x2b6b7ba0, 0x97327971, 0x475e63b1, 0xd376beff, 0x32bea9d1, 0xe654ba38, 0x31f0353c, 0xfeb11a54, 0x53abc36a, 0x05982375, 0xe15dd27f, 0x7e12ff9d, 0x789a21a8, 0xfa9e336b, 0x676a8967, 0x507a8fce, 0x2de21d2a, 0x8d385164, 0xf80b77ef, 0x95d61b84,
+        0x684f04f3, 0x63703d90, 0xd8305372, 0xae3ea8e3, 0x9d85f205, 0x84ae2028, 0x60699573, 0x3bb1fe11, 0xe08efba8, 0x70683f62, 0xc8ec16a7, 0x9aef378f, 0x77073e71, 0x87c4b258, 0xd060caba, 0xc327edeb, 0xe6006f57, 0xd3c5bea1, 0x6de293db, 0x06e30f9e, 0x55969cf1, 0x1af1db8d, 0x98bddd56, 0xc6c37068, 0xe6e8dea0, 0x057f8af8, 0xb3baa06b, 0xbcf2fdaa, 0x60a0e5d7, 0x38d257eb, 0xbc261253, 0x7dc95f88,
+        0xf4401490, 0x4754a6e2, 0x8af5ccc3, 0xc4f5262b, 0x8a44602c, 0xb2e60fe3, 0x4fa4e189, 0xfc8e6851, 0x123c6dd6, 0x6615ce11, 0x2e96459a, 0xd8039532, 0x17ce1f4b, 0x7e65c7de, 0x76a73b3a, 0xc97de704, 0x02639d86, 0x8f9722ae, 0xea3f2357, 0xef2eb1cb, 0xa48ab8e1, 0xeace87d8, 0x005cffc3, 0xc490439f, 0x07c7544a, 0x3d2a6f7b, 0x355e4de7, 0xba4a1126, 0x7478a94a, 0x4c91d22f, 0x209481b3, 0xd82f4c38,
+        0x0236bc25, 0x04fab43f, 0xba21e394, 0x242c5622, 0x5aa76077, 0x85814bd7, 0xc7cb4e33, 0xb639c3b2, 0x6fc8bac1, 0x5b3cf6cb, 0x6fc20df6, 0x099c3da7, 0x0c993c28, 0x414e5aae, 0x0cb4ad23, 0x0ee99fa2, 0x17525749, 0x9078b040, 0x9812cf8a, 0xb552ca2c, 0x3db7af4c, 0x244dd81a, 0xd763f72c, 0x46ae9580, 0xdb724bbe, 0x9bdd020e, 0xf6af4a04, 0x48e6b489, 0x7d288958, 0x84a645b8, 0x38663e32, 0x275db211,
+        0x39e8cf38, 0xd3e330c6, 0x896aece9, 0x8a319eba, 0xc3199f26, 0xa8352468, 0x58fa293e, 0x42bb0cd7, 0x761348da, 0xd3b4490e, 0xa3aab8d1, 0xd19d869b, 0xead688f9, 0x37b8c511, 0x295cd1f1, 0xc650ed2d, 0xb733e1d3, 0x0612842c, 0x93e6b1e2, 0x56fe57cb, 0x6eecae9a, 0x4406fe84, 0xe25dbc30, 0x48ff2646, 0x649f0a2e, 0x97d5781b, 0x2dd150cd, 0x5aa96822, 0xa2222658, 0x3777d4fa, 0x9fbe801a, 0xaba8bbff,
+        0x53f3fb1d, 0x0ffc245b, 0xcd8f2283, 0x5ee74a51, 0xffddc7e0, 0x5f56908c, 0xfb21627e, 0xfa59b049, 0x20857e33, 0xc0e2d2cb, 0x3b74170d, 0xbdcb17ab, 0x060cc6fd, 0xfb5dfa30, 0x9b80b416, 0xe1995975, 0x1c5dfff0, 0x58298154, 0x684f4438, 0x66417da1, 0xe252db96, 0x5e1f3663, 0x8c526e04, 0x09054d59, 0x5e76fc59, 0x94cc5713, 0x35562995, 0x737d8c41, 0x70e1a889, 0xc08122a2, 0xf4c94575, 0x114060c5,
+        0x1fc02995, 0xbee0cde1, 0x7883f0b7, 0x4942540a, 0xdb5d8ed6, 0x3f189c03, 0x0b1ba348, 0x82b46479, 0xb10e586f, 0x9dd8cc88, 0xfa9ecaa7, 0x1507595e, 0x48843eb1, 0xc03e35bf, 0x223f705c, 0xc28c7150, 0xaf6e7d5c, 0x495356f2, 0xe8d20382, 0x31228736, 0x9c61e8dd, 0xebd08c5a, 0xe66545d8, 0x2d2254a6, 0x3184dfc7, 0xb42af5dc, 0xc121f838, 0x4652fcca, 0x58a48ad3, 0xafb7c4d7, 0x6b2b08fa, 0xfda306e5,
+        0x27dd413a, 0xd5b414ec, 0xd1aa05b5, 0x9af729d8, 0x9ffafd0d, 0x14ce3f1e, 0xbd124bb6, 0xc7806ae7, 0xce1bd8e7, 0xe4516e28, 0x11358111, 0x5e45c0e9, 0xf366fe98, 0x15f58bec, 0x7f6134ee, 0xeca72421, 0xc1513dfc, 0xa32d358b, 0xbe0e4227, 0xd7894910, 0xd4c4e862, 0x534e6c26, 0x28108149, 0x4c721d25, 0x75122f25, 0x778d1d08, 0x9e3bd58b, 0x42ef1669, 0xeea3916b, 0xfe6bcdfd, 0xd5c857ad, 0xa80399ea,
+        0xe53a79bd, 0xf613e5cd, 0x951fef0d, 0xe61b5bf3, 0x952ee510, 0x5960f344, 0xdadc6d28, 0x23063e60, 0x08ecf574, 0x0baa0076, 0xe2aae429, 0x8aa09e9f, 0x68610be7, 0x22c38ef9, 0x0950553c, 0x777bef48, 0xbf038d3c, 0xa04a1df3, 0x27a2dbb8, 0xd6d8d7ff, 0x24d72d14, 0xea3e9f2a, 0x9b2021eb, 0x65ecc71b, 0x4125a815, 0xb545d858, 0x52fbc519, 0xeae317e0, 0x66dbc50f, 0x1fdc8861, 0x680814fb, 0xeb13f1be,
+        0x62dd6c3d, 0x30fe3456, 0x9c1bf8ec, 0x5366bf1d, 0x2ab959bb, 0x9edbd0e4, 0x3026cd42, 0xb8155c4f, 0x183998f6, 0xea8605fe, 0x52bc55f3, 0x4034c52e, 0xc5044df4, 0x529d170d, 0x3bef2843, 0x5fbadf4f, 0xbd889775, 0x38fdb93c, 0xb15c8c35, 0x6bca7d0b, 0xd2f6ca20, 0x7e09a776, 0xd3f6562c, 0x7b02b91e, 0x4b1a292f, 0x9216cb4e, 0x4f32d29a, 0xd4c08497, 0x85e547f4, 0x392278df, 0x5346cb78, 0xb17b83b3,
+        0xd4f3a162, 0xcfae7d02, 0xcf6f7aa3, 0xd2e96342, 0x8e97703a, 0x20f6c2dc, 0x43519c69, 0x27298162, 0xae399631, 0x6d48c5c2, 0x3bd0b153, 0x5242b6b1, 0x74d84afc, 0x70a022c9, 0x6272f9c9, 0xd8690408, 0x89e1c8a5, 0x664adc1d, 0xfde04b98, 0x46d32915, 0xc1561fc7, 0x73d37c5b, 0xfaff16d7, 0x4c1082c4, 0x3c1ab71a, 0x9a860b34, 0x874fa5ed, 0xfab2b7f0, 0x0d2ae9db, 0x3f3dcb89, 0xc1c29754, 0x18303ad9,
+        0x9a1b5897, 0x880e6b3f, 0xdb6f6887, 0xa6ace660, 0xfcffbb13, 0x43fbfbaf, 0xedf2b1de, 0x19a9a890, 0x68d5f871, 0xf2bf230f, 0x001660ce, 0x487a51ce, 0x8a77007c, 0x9b0f9246, 0x352dd587, 0x1ece7750, 0x3822f801, 0xfe583563, 0x53680a0b, 0x5a3427e2, 0x1890240e, 0xb332e717, 0xbf5e5dae, 0xae99e23a, 0xbf9e4863, 0xa623520f, 0x8b15abe0, 0x88497d1a, 0x568fd6e6, 0x4988404a, 0xd513d1b8, 0x002929ca,
+        0x8d755ecd, 0x4a6866cb, 0xf5218bae, 0x9ee4ee3c, 0xe490b97d, 0x99ffe192, 0x5b43d234, 0x83bac1be, 0x8be0fe8e, 0xa6fb2eb9, 0x58c02287, 0xfe1481e1, 0x9f7000e3, 0x8de8726c, 0xcbef9865, 0x54afd3d6, 0xbef1a852, 0xa831ca73, 0x2023247c, 0xc10e6b70, 0xd28869e3, 0x1ba6b2ec, 0x06704364, 0x28e847f4, 0x6a1802d1, 0xd0b1585b, 0xbb3d8519, 0x97f39335, 0xc808207c, 0x090a2606, 0x5e067328, 0x0e2a5083,
+        0xbeafa8f4, 0x533268ed, 0xe46b9f55, 0xc5f8cbd2, 0x3e1b417c, 0x4fc2a2ac, 0x212d4476, 0xa70fd8c9, 0x399e0c6d, 0xc8f47898, 0x599a8302, 0xfa0650e4, 0x497e609c, 0x852e5cee, 0xed6fdaa7, 0x122491e9, 0x0d22e5e5, 0xdae77e5b, 0x97b90229, 0x584d8dec, 0x29b3be0c, 0x47ea8da8, 0xd6a1c2a5, 0x8c2fde93, 0x2ae545f3, 0x5ac20a8e, 0x80903834, 0x99b7d39d, 0xffd40e81, 0x32c0e2ff, 0x5afbf69a, 0x5bae3bda,
+        0x0c0d48f2, 0x3710089b, 0x36b275d1, 0x4c4df09a, 0x65d8c8ea, 0x58b92602, 0x556b4735, 0x1397f392, 0x3ac73b44, 0x2f0ec08d, 0xefa59262, 0x5bfa0ef0, 0xaee575cc, 0x7a3e4833, 0xf64d16fd, 0xbd47ee85, 0x701f0283, 0xd3aa1ee6, 0xf0b9e73a, 0x4fbe282b, 0x017e5ba2, 0xc9dc5417, 0x9c3d14ca, 0xf55a1e46, 0xcd134d01, 0x0e4dad26, 0x3ba4ad86, 0x14ab1c54, 0xeeb64477, 0x1d000d91, 0xc3653077, 0x92803d5d,
+        0xd3923263, 0x8689c580, 0x92ce827e, 0xf4099f6e, 0xcae6a1dd, 0x3671ec91, 0x543c0b39, 0xb95494d7, 0x3934cdd0, 0xbae16c27, 0x4ff88d33, 0x1584a36d, 0x95a354b8, 0x4031c6bf, 0xd47540d6, 0x716729f9, 0x4a5bbff5, 0xaf481352, 0x670dcde5, 0xe62d9d96, 0xdcafc989, 0x006346c3, 0x9d5f9223, 0xbde5c1d8, 0xfdbe7b8b, 0xf891788f, 0x34259c00, 0x393bdea5, 0xd3c3f978, 0xf6665635, 0xad054457, 0xf030b354,
+        0x3fbb2714, 0x416b8906, 0x79cd1628, 0xd02f20a5, 0x6629cb59, 0x3b7b9c1e, 0x9974c8f3, 0xde8d8d37, 0xccef0f59, 0xd6a5e703, 0x1ae5c976, 0xc4363c7c, 0xd24a0914, 0xfa9e62b5, 0xd7516f0c, 0x454313a3, 0x5ac0ebcb, 0xaf6bddc4, 0x6e19084c, 0x278be084, 0x927e44f7, 0xc4919342, 0xb3693ffe, 0x171fad0a, 0xbe127f63, 0xe43c48fa, 0xc204b216, 0xc895871a, 0x639df15f, 0x8bb3b42c, 0x6de6c493, 0x2953a037,
+        0xf4d300fa, 0x1d5b71bb, 0x92ae406a, 0x1fc4e267, 0xd9876261, 0x8c791fa5, 0x46be910b, 0x7f3aaaa0, 0x9f5099a5, 0xb4ddb9fb, 0x969edf1a, 0x8d13b1ba, 0xf6a5de8b, 0x7af2537a, 0x15fdb812, 0x8c2e4c99, 0x8020b21c, 0x18fc590f, 0x8586e6a6, 0x53ec44ef, 0x17151e70, 0xf436cfe8, 0xe79838f5, 0x8073c921, 0xe2675023, 0xfec08616, 0x7061a069, 0xb1b21143, 0xc81ef931, 0x082ee456, 0x2601cddc, 0x11227752,
+        0x9eac41be, 0x8900bab8, 0x42b83bd8, 0x1c7f7069, 0x72168698, 0x2b234d25, 0xd8105a0e, 0xdcffa585, 0x323a7c5e, 0x6a1eda8d, 0x4dc93858, 0x7555161f, 0x7bb9315f, 0xd60694d7, 0x567ad9bb, 0x04f7bc38, 0xcc69913c, 0xe0ea773a, 0xfccbfc4a, 0xc5282a47, 0x28b7573e, 0x7054e664, 0x3ca4274f, 0x5050d80d, 0xb3c5c7ba, 0x5ae4df99, 0x601ee92d, 0x7ee2bb8b, 0xf944b975, 0xc78d25bf, 0xf8e90441, 0x9b354f0b,
+        0xa4c96521, 0xb61c84eb, 0xdc2f70a8, 0x1b51d239, 0x66e1d484, 0x9a0029b4, 0xa1c6376b, 0xf52fd80f, 0xfc3877e8, 0x48dc72e3, 0x8f39e95d, 0x4c87b4d8, 0xeeffe12d, 0xd2d17421, 0xb8686989, 0x7d5a1ed2, 0x7be9f2a7, 0xfdb4f329, 0xa3978abf, 0x618b52c1, 0xe33c2b7f, 0x6dc2202f, 0x32e06977, 0x11816a9b, 0x6536b96c, 0x04a1cd0b, 0xfdff3346, 0xe0ee1118, 0x670083e0, 0xe1dc665b, 0xa8aad172, 0xf7ba20af,
+        0xe6bec034, 0x35f42574, 0xfed15708, 0x896dfb8d, 0xa735b56c, 0x99ff7d24, 0x1bc27d59, 0xfaad0e16, 0x093ec4f5, 0x298ad608, 0x9e3b3a25, 0xcd34fba7, 0x91305f7c, 0xb3b39177, 0xf64350cd, 0xc97422a7, 0xbf00c48a, 0xf42ab3c9, 0xa99aa7b0, 0x7ed14aab, 0x85f7dc97, 0xa1206432, 0x42886e63, 0xfb24abac, 0xf6453936, 0xbee2effb, 0x8a4acfd9, 0x924d4348, 0x07bfc90c, 0x8f75b955, 0xb241aa38, 0x40a91ff5,
+        0x850c1e24, 0xebc89647, 0x0f1ca065, 0x10596e2d, 0xe3d96a38, 0x0fc2fa71, 0x54882247, 0xc54f028b, 0x3acdb28c, 0xe5aaf94e, 0x1d2bbcf6, 0xd657f616, 0x4f98a187, 0x2eef3d54, 0x3a7a8a6d, 0x4760ee24, 0xa6e9495d, 0x7240dd41, 0x10efdead, 0x9b97c136, 0x4682abc8, 0x065bbbb2, 0x48255ef4, 0xfd662448, 0xe14c05b0, 0xdeb10eb6, 0x71bfa266, 0x39dd8427, 0xc183967f, 0xdf130322, 0x9a71a18f, 0xdf60c30d,
+        0xc8841ddc, 0x89c4da33, 0x1d2a8efe, 0x791700e3, 0xfa8329be, 0x5e786ef0, 0xd93da1be, 0xc56e916b, 0x0cf72b21, 0xd9372423, 0x775900c7, 0xebba6310, 0x535e0344, 0xade594ff, 0xa1551f80, 0x0d2a04ce, 0x3af4e2ce, 0x85c5227d, 0x94735768, 0x9d7ad19b, 0x9a6873c8, 0xf55206d2, 0x9991ad2e, 0x513fd6b4, 0x72cc2b6a, 0x46e87b04, 0x09118305, 0x692655e3, 0x83895e77, 0xc58323a7, 0x686100ff, 0xf340081f,
+        0x1ba8e7a0, 0x8dcf5922, 0x75ba68c3, 0x144700f2, 0x736d0d43, 0xcaf1e69d, 0x8d178877, 0xae4a9f70, 0xce2efa3e, 0x8cda3f8f, 0xb36ae916, 0x701f6fec, 0xdf4ad370, 0x9e06d89b, 0x0d5c770c, 0x1e51df7a, 0x383d08cb, 0x803a114f, 0x75ab194b, 0x4a5e401c, 0xf5627534, 0x7bee52b1, 0xca40698a, 0xd4aaaa6d, 0x73ae0df5, 0x5dd7b5c5, 0x555b8cac, 0xa34fe55b, 0x0f20decb, 0x9a767510, 0xbdabf849, 0x6ae330cf,
+        0x81bd4932, 0x94e1d49f, 0x332e4fdb, 0xb895213b, 0x6d5c8e71, 0xd8564c0e, 0x2b2f4921, 0xf1c754fc, 0xc06f0e9e, 0x226869a2, 0x5e4c3db9, 0x11ff8966, 0xf11af890, 0xaac4deb6, 0x04656b64, 0x6cce57a1, 0xd43d021b, 0x76158551, 0xa0684435, 0x0b369c5b, 0x89eb4aa6, 0x3b794ac2, 0xa687ab1a, 0xde0b93be, 0xba046494, 0xec839792, 0x1830671d, 0x5f144140, 0xe0a8af76, 0x9d633a9b, 0x03ad3cc4, 0x54633b9d,
+        0x4b576aa7, 0xeb73ac1c, 0x2e0ee6c1, 0x39ea8c27, 0xed219f0b, 0x230f413d, 0x117445ee, 0x53315f7a, 0x94c28684, 0xc3037eaa, 0xa31c57b2, 0x7ad16d35, 0xa6b9952c, 0x0871719c, 0xdd57de5c, 0x19ddd2fd, 0x0e52e7ae, 0x5f73fc3b, 0xd11d6ba6, 0x876aaaf5, 0x8767767b, 0xb8008976, 0xb1c0f55e, 0xaea945af, 0x36602adf, 0x98537472, 0x8b146513, 0x0db9da6d, 0xb3d85e47, 0xcd68bf90, 0xf4d8e53c, 0x4195688b,
+        0x71cd83fc, 0x19e09811, 0x15dca1c7, 0xd3eace4b, 0x0eadd810, 0x5380086a, 0xa123aad2, 0x21fd1059, 0xcbd2642b, 0x62f72ad6, 0xb0f1ea57, 0x4f3c29d4, 0x58661899, 0xba206103, 0xf26293ae, 0xe622563c, 0x852b315f, 0xa3502268, 0xf42d1734, 0x2dca9696, 0x12d729ee, 0x07657833, 0x35000ba0, 0xb19bb226, 0xc6683912, 0x5457e774, 0xea08368c, 0x5525e408, 0xc8553d3e, 0xfb08eae0, 0x4ba82104, 0x5b05b77c,
+        0x26df5c72, 0xdb06924b, 0xd910a9fc, 0xda2d0030, 0xc8ec3b08, 0x06e25de2, 0x45553696, 0xe3bb5076, 0x3a51cd7a, 0x36e97b18, 0x522e93df, 0xd53ae31c, 0xd45e298e, 0x9f3dcb82, 0xd27a8848, 0x29514ddd, 0x92184579, 0x99a96bdb, 0x92636d51, 0x93e44e17, 0x49387e4a, 0xb38bc93b, 0xb2fa6ab1, 0xe5e0cef5, 0xcbd78f88, 0x0c98c62f, 0x710bfafc, 0xd3873030, 0x723b2fa9, 0x996d6ded, 0x7735a6dd, 0x773cec1b,
+        0x476f1caa, 0xbd2cd4cb, 0xace56582, 0xc8ffb708, 0xe7568ef2, 0x9a4b3b28, 0xe895272e, 0xf8fb7097, 0xbf484c97, 0x35b34e53, 0x42b0e1d8, 0x993e786c, 0xb08c1b05, 0x099e77ae, 0x21bfa798, 0x669e3103, 0x1f9dc035, 0x1ebd1429, 0x30df0260, 0x3b2f77af, 0x254eb2e2, 0x4a830d1a, 0x95c56b07, 0xd2807db4, 0x12c7d4fa, 0x5d662e0a, 0xd283f8a9, 0x376ed66b, 0xb9102b42, 0xa2f429e8, 0xed050848, 0x5030cbd8,
+        0x7e1d9020, 0x692000a3, 0xa7a667c9, 0xbc687ae9, 0xe3df21cf, 0xd9fa4fab, 0x89dccff7, 0x133b832d, 0x483e990d, 0x0451a3ce, 0xf9d85a1c, 0xaca3647b, 0x09532eb1, 0xef60015d, 0x5384c3a9, 0x5e550ae0, 0xf9176bbe, 0xe974f534, 0x5d72c724, 0x9d4a272e, 0x4f246df5, 0x75d4a41f, 0x1ef41d2c, 0x8ba431ed, 0xea6f9f1c, 0x2d3a9617, 0x22aeb300, 0xf5c851ce, 0x5505ad86, 0xde8db308, 0xe5c13e1a, 0x15669be2,
+        0x7fe8fb73, 0xc2b92839, 0x9d8387bf, 0xef6a7c90, 0x954833dd, 0x1947ffc8, 0xb2c0c4fa, 0x9958bb89, 0x07825302, 0x66c2a854, 0x872351cd, 0xffb25218, 0x0835ed17, 0x93b52efa, 0xd3bf9967, 0x4dc16c9a, 0x5709560f, 0x2f74c5a8, 0xd8c20cb2, 0x2c741386, 0x3efe6a5f, 0x3a17b23c, 0x94dc9c41, 0xbea652ae, 0xf00b9798, 0x4ebb6811, 0x0c3bc9a1, 0xcfaa7e8d, 0x0dd17ac6, 0xc6ce752f, 0x05473921, 0xb2067f8f,
+        0xae75602a, 0xdb31fac7, 0x993fb806, 0xc2bd4067, 0x1d31128f, 0x280d4c6f, 0xcbd6bc25, 0xe7ad2b46, 0x9e2b74db, 0x0c9eed1f, 0x11f98377, 0xaa1651ab, 0x11bc4443, 0x4bd722e8, 0x22d1614d, 0xb119e711, 0xc9f4c812, 0x903379cb, 0x17a76cf9, 0x17de93c6, 0x3ce4f812, 0xd348838f, 0x3e5fb5a9, 0x436c0bbc, 0x1ad5a0ea, 0x3a1d4eee, 0xdbbd01a8, 0x4ce92770, 0xb2bd385f, 0x4e875736, 0xbbd6864e, 0x1081290b,
+        0xa6892cd7, 0x68a47875, 0x842a4ed6, 0x5f193154, 0x538e2c28, 0xf012cc3a, 0xa96a2a29, 0x937ab976, 0x1e18c583, 0x3cb5eef5, 0x25d75cae, 0x7d83a86b, 0x050f4c0b, 0x42a755c8, 0xf6dbd2ba, 0x2b84d545, 0xf86a5bca, 0x389305ca, 0x1fb55278, 0xdbb1492b, 0x77a82eea, 0xd68ce11c, 0xa81d192d, 0x1d60517f, 0x4a4999f6, 0x73acd677, 0xc129503d, 0x79b8c5c1, 0x8ee0d305, 0xcf26f9e1, 0x6d83d0d3, 0x3ad00613,
+        0x4466d46b, 0x4d6d0972, 0xc0f4d8ec, 0x61bc45d0, 0xe5fbfdbe, 0x3b32e5f3, 0xba7b4ee3, 0x3685213f, 0x6826051c, 0x5af24967, 0xf035779a, 0x39aac846, 0x4163b19d, 0xabaac0da, 0x887d62dc, 0xcec111c1, 0xf46ad0b7, 0x7fb4b1a5, 0x448b1a5b, 0x04c21ceb, 0x40058bab, 0x95519f9c, 0xed7bf588, 0xd68e0a0b, 0x118e9ce7, 0x010747ed, 0x4ca580ee, 0xa58266db, 0x977204aa, 0xe06df822, 0x340b69a9, 0x64e1b851,
+        0xa2c93ddf, 0x3a5c40ba, 0xcc61fe47, 0x1bd7238e, 0x806f7ae8, 0x622f4f91, 0xa69b9fdc, 0x3dee882a, 0xcbc3b4b0, 0xc069eae7, 0x3bbe6201, 0xece4b3ba, 0x99d094b7, 0x35ed23f8, 0x1cca5597, 0xe97e2445, 0x840937de, 0x27032279, 0xd67cba20, 0xf45d9913, 0xebb8e699, 0x42ad8eb0, 0x7f8bdd84, 0xb7b76567, 0x471185db, 0x190d1e6a, 0xa70b8c49, 0x9b358211, 0xead41825, 0x57decc25, 0x8284d6a0, 0x18734e03,
+        0xf9649ce6, 0x97ca7d71, 0x3280df73, 0x63fac25e, 0x1c769e79, 0xe9702614, 0x4c1f6920, 0xaabf53b3, 0x657baf71, 0x2e206b0e, 0x6bb6a4f1, 0xdcb407e5, 0x4fbcd94f, 0xd4f2e30a, 0xb19fb4a1, 0xfda7a0b2, 0x1784e986, 0xba98e4f5, 0x66ef4781, 0xe6dd03cc, 0x4b90f802, 0xddb9b2a7, 0x4e7692b3, 0x51fb297e, 0x1b060de7, 0x21e4f028, 0x980515ed, 0xe8864060, 0x4860d48b, 0xdf9ab7ca, 0x27bc9aaf, 0x4c89c110,
+        0x002b2a99, 0xddee285e, 0x4899b588, 0x8d2d5191, 0x8d01f118, 0x328c5758, 0xdef37220, 0x742f3580, 0x0ad11edb, 0xbf9386ef, 0xe79bdc13, 0xd2f62763, 0x21878492, 0x4c7eb549, 0xd56f42b0, 0x2f561d1e, 0xcceb7ec0, 0x9d63d230, 0xeafa3080, 0x8644de6a, 0x2326553d, 0x152b6929, 0x81362306, 0xe925f244, 0x67ab5be6, 0x22bbb768, 0x2c6f39a9, 0x2a4d1605, 0x933f3bbc, 0xa5f4e069, 0x9b311939, 0x9530d181,
+        0x36e5ea8a, 0x0ed336fd, 0x851a47be, 0xfcd2ce6e, 0xfd3b47eb, 0xf08c2dfc, 0x7d6b1487, 0x030a5bd9, 0xb1e335fb, 0xa751f6af, 0x6952f0dc, 0xebed954b, 0x08e720fa, 0x0b1e85ec, 0x4af70244, 0x20f92427, 0xcd2b4921, 0x2b3b3a34, 0x58b45ab5, 0xebbd116c, 0x15543196, 0xd207edcf, 0x82d7ddf3, 0xdfd08b35, 0x5de8cb46, 0x8e7247ff, 0xbd4e8771, 0x0c6ea650, 0x86555f01, 0x983a76ba, 0xcdf51491, 0x4d13672c,
+        0xd1211754, 0x6e094b07, 0x308133e8, 0xcae8b344, 0x1faa5fd0, 0xbfb1695f, 0xd22cd346, 0x1b2e4324, 0xa34d422f, 0x4129ae8f, 0x04206d7c, 0x2f378747, 0xe55d4841, 0x834cd36e, 0x83ef9eb6, 0x3c0918ae, 0x8b65ca3b, 0x693698a5, 0x9b3fcbe7, 0x5abb475f, 0xc2abf2be, 0x728a3ebf, 0xdaf8032d, 0xcb93d83c, 0x6203aab7, 0x420a9e7c, 0x15ab91b1, 0xc5f38ba3, 0xbbdf1edd, 0xcd62b65f, 0x54fd40b7, 0xf1f13eab,
+        0xd6f9d342, 0xa8f1472a, 0x5f294239, 0xd8bc83cb, 0xd405ea7b, 0xd6bcec1d, 0x2d30532a, 0x543280de, 0x212836a5, 0x7a9c61c1, 0xe1400ce0, 0x562d47d7, 0x0b48c51c, 0x79a3b756, 0xafcce218, 0xa71189c8, 0xbbd88a9a, 0x2b0ba9d9, 0x6fea887c, 0x456d67d2, 0x613d1f85, 0x6eee3bba, 0xfacad46b, 0xcb649b4d, 0x66246eca, 0xab7d0aa9, 0x70b016fe, 0x87500e61, 0x28248fd1, 0x66106f54, 0x5376fb8f, 0xdb853630,
+        0x50665cd9, 0x8491d9fc, 0xe4fdfed7, 0xcdc0a53e, 0x3f3cfa12, 0x1a15143d, 0x4f88a8e6, 0xa72fb3d1, 0x68aba1f4, 0xe3238b99, 0xb54033aa, 0x99bc1082, 0x24c56ee7, 0xaa0d8a40, 0xdf0ef689, 0x21b6cfdb, 0x1549b478, 0x88348ed6, 0x76347368, 0x98ef5371, 0x07c79339, 0xb6419152, 0xc0d1c003, 0x3a83b39c, 0xb335ff17, 0x9b7958d6, 0x36ea465a, 0x4eed3f06, 0xae0e3bd1, 0x25c31147, 0x8eaabba6, 0x6ee84636,
+        0xd9c617a9, 0x902c5d22, 0x8efe25ff, 0x3fbd8aff, 0xe6daa389, 0x5bd3b5dc, 0x6b658323, 0x16a3196a, 0x5bae4cb5, 0xd7fe7cc1, 0x7d2e4932, 0x9a60835e, 0x4186bc26, 0x04f2ca9b, 0xedde0997, 0x362a20be, 0x777d5ffd, 0x21c0730f, 0x4106a888, 0x988dfef0, 0x6e645517, 0x43ee08fc, 0xb3d901a3, 0xf64c70ea, 0x66ff1713, 0xc9a6cf8e, 0x2e8d1256, 0x37c503ae, 0xdb3345ef, 0x681ba46e, 0x958e3634, 0x0d57be75,
+        0x5fa2dbf5, 0x70b79b5f, 0x38c0f944, 0x609311fb, 0x380fff8a, 0xecb5a892, 0x85b10671, 0xfda33ce9, 0x6ef4ca63, 0xde302802, 0xbdc61938, 0x1117dd29, 0x1208fca7, 0x96ed0f14, 0xd8ead81c, 0xb110c6c1, 0xae0ca194, 0x64fbf26e, 0x22fb981d, 0xcc0633aa, 0xdbc03ef3, 0x76150fef, 0x33285440, 0x308f1a16, 0x9b7aa10b, 0x6c4289d8, 0x8b04fef4, 0xe86b6bed, 0x298e1c76, 0x5ce72a38, 0x01727aa3, 0xf5d09ccc,
+        0xc5800ce5, 0xa366c480, 0xc3c91e0c, 0x34091aa7, 0x6bcb3372, 0xcdeffdd8, 0x0e8b4f1b, 0x121b9bd1, 0x95f383df, 0xe217182d, 0x2c957023, 0x3a2b1ca4, 0xba863a65, 0x7531aea1, 0x88c74c5d, 0xd0567908, 0x40c8d23e, 0xbd6c3d38, 0xeac43b3c, 0x33b3974c, 0xc219096a, 0x29120c46, 0xe3147238, 0x8bbae118, 0x119cc1d1, 0x3752130a, 0x2efbb436, 0x6d7cdbf1, 0xbcb0cb29, 0x11cd6bf6, 0xb25be780, 0x9624e470,
+        0xc6e901c4, 0x79d9eb1d, 0x807cbe19, 0x9820951c, 0x6ced5c35, 0x86958ac0, 0x9c7a095a, 0xf6364562, 0xdb13ddc2, 0xf1e0b624, 0xabb95bf7, 0xea923d89, 0x860a20d8, 0xa3d775aa, 0x4c7f2aad, 0x6f9a999c, 0xb4375146, 0x519df7f6, 0x61b1401b, 0xc15c7d94, 0x9153cdd1, 0x9fe5d231, 0xe34adb0a, 0x33a804f3, 0xd7cb8640, 0x635ea76b, 0xe617a98d, 0x17ee2706, 0xf06281bb, 0x84d8c899, 0xd0c05bbe, 0xf61fe8c7,
+        0x0058fc91, 0xb1d62960, 0x00ca8d44, 0x6772f991, 0x16645b27, 0xcc1229db, 0x42bf0713, 0xb4c31769, 0x05d6223c, 0xc65c5578, 0x6c90d28a, 0xdc02bdad, 0x575008bd, 0x3a360e7c, 0x8a962bd8, 0xf8f0c12d, 0xed196ac6, 0x0215c090, 0x4c6a75ae, 0x97f2b94a, 0x568cb98e, 0xe6ede417, 0xdc06e363, 0x402039fa, 0x57299622, 0x4de0fd1e, 0x235bdbc3, 0xb0156c3b, 0x81ff1ccd, 0x11758a9d, 0xdb4dd6d6, 0x01404879,
+        0x62626088, 0xa1b4c53a, 0xb218ccea, 0x96d3f46c, 0xa0be5405, 0x250eb289, 0x734ca35e, 0xcb941c92, 0x793f068d, 0x20e88292, 0xf31ff4bc, 0x08cf06c0, 0x156018af, 0x097283d2, 0x47a2de2a, 0xdf01dee5, 0x726f1229, 0x7552f763, 0x966b120b, 0x176f1ca7, 0xe0aca19d, 0x12bf8141, 0x7816f8c0, 0x075c9e6a, 0x6ffaa82e, 0xfe70c3ef, 0xbf05f9fc, 0x4fad6ea4, 0x77c8fae2, 0xa0cd9c43, 0xdc5f2e6f, 0x425df870,
+        0x776d54da, 0x62f5034b, 0x7f83c68f, 0x91768ed6, 0x7cc84146, 0xfe41fabf, 0x3abe772e, 0x97f7a697, 0x15e6c04c, 0x425fa005, 0x11400862, 0x41f88eba, 0xe36d9698, 0xd8636423, 0x3bb0e0a2, 0x037b48b9, 0xdc918a27, 0x5c0a7dd5, 0xb6344560, 0x1f1384bd, 0xdf70ac13, 0xe524b9e9, 0xf020e656, 0x3a6adcb0, 0x23c2ad24, 0x97b4f060, 0x64d6a3d8, 0x8032a1c5, 0xfb062a6d, 0x2a651e0b, 0xa51138ab, 0x321b5ef4,
+        0xe57b1c63, 0xf48dc28d, 0x7b7373ab, 0x63e728b9, 0x039b9a92, 0x884b9ee9, 0x9f75160e, 0xa5596b8c, 0x3b2910c2, 0x968e7a1d, 0x8705e992, 0x27671084, 0xb99912b2, 0xdf234d3c, 0x9b7f99f3, 0x7054eb08, 0x969f2efc, 0x9608ed3b, 0x6ef595f9, 0x771c9f79, 0x3e821d75, 0x01757b1d, 0x6dd05896, 0x160e9b45, 0x029afd4c, 0xf4faef97, 0x9bdbb8e6, 0xa5fda8e1, 0xf53ddcaa, 0x3d7f2d0e, 0x186f2ef7, 0x894ca74d,
+        0x091c7692, 0x8e1c91a5, 0xe2e04def, 0x1db02c26, 0x3f378c8a, 0xf79cc39b, 0x024841cf, 0x986691da, 0xd09e9d74, 0x55bbf22f, 0x23f7c56b, 0x28aac31e, 0xe13eed54, 0x8ef11b89, 0x186a9ceb, 0x88737d74, 0x5a4160fd, 0xc5e61af0, 0x97ea6913, 0x5b5e430e, 0x95ce76af, 0xfbe1cafe, 0xaaed313f, 0x6a76d626, 0xa5e51ae1, 0x10af10aa, 0x6ef14673, 0x9a89c733, 0x23c73af2, 0x1d496da3, 0xc07e73d4, 0x2d33edff,
+        0x3de5bd4b, 0x187e9468, 0xa6848094, 0x6b5f6da2, 0xdb7cddd3, 0x7dc830b7, 0x15994d80, 0xef18a30b, 0xf8dad5c3, 0xb2d259d3, 0x080dc227, 0x12e2a70b, 0xd5dd1291, 0xb8b8d510, 0xd5f14f55, 0xd9cbcaad, 0x0cc37618, 0x8deab272, 0x8bbf32df, 0xb4303521, 0xf1739409, 0xff269865, 0x524c0f25, 0x0d173208, 0xce749bca, 0x1cd0ee0d, 0x99f544d5, 0x8d53cff4, 0xca249119, 0xcfa564dd, 0xcc9763e0, 0xa7be5c54,
+        0x0cb046c3, 0x3989e0b5, 0x487fb4be, 0x34f32e17, 0xa748f257, 0x42bc5e36, 0x7d5a0d78, 0xf3fa9d1f, 0xf90cd81b, 0xee6a2af4, 0xbf9d08e4, 0x25e6814e, 0x915e0980, 0xfb9c1763, 0x4c88ea5a, 0xc5cc1a9a, 0x41906915, 0xeec540ed, 0xe2f5d847, 0x3685a806, 0x72618a96, 0xabd04e7a, 0xd0e48a67, 0x36e17136, 0x192ca226, 0x37c2c54c, 0xdc0e5116, 0x5441854f, 0x0712b1c1, 0xb3c90a7c, 0xe62f1da4, 0xb8f3d577,
+        0xe6622c40, 0x3a278e8d, 0x862bcfa0, 0xd78c90e4, 0x1ec5653b, 0x7e8443c2, 0x2d83e9fe, 0x0e63c194, 0xb4c377a1, 0x0ef94cb0, 0xd4d3fe33, 0xa724aad7, 0x08eade88, 0x4110a5ba, 0xc201b7be, 0xe600cf99, 0xf5054dad, 0xf8f25769, 0x57c65cb6, 0x8564a2b9, 0xa363f092, 0x96dace7c, 0x57cf3a8a, 0xc600f767, 0x376aab5b, 0xf8fcdf1f, 0xc94471b5, 0xe986ed62, 0xb91c6c70, 0x8282965d, 0x4761fc9e, 0x475112f0,
+        0x951a39eb, 0x13961d1c, 0x6bc708f5, 0x733ac18b, 0x1791d09e, 0xa3f5cf33, 0x0626a785, 0xf8ea2f52, 0x7dbbbb3b, 0xee5f1c39, 0x473c81ec, 0x38dc8e87, 0x56fa534a, 0xa4e25bd6, 0x498fbe64, 0xbb15c0c4, 0x2bc05061, 0xf16ab5be, 0x66361ed5, 0xeaa685a2, 0xb299299c, 0x04c2f11c, 0x3424239d, 0xa37ab701, 0xaa945f75, 0x642af038, 0x716cc767, 0xdfcd18cb, 0x6eec7049, 0x19462537, 0x2cdc7df5, 0xd06eb82c,
+        0x3175b4f8, 0x542e066c, 0x9dcdc9df, 0x9fd63d0f, 0x44dde10c, 0x98bf07f3, 0x8f470d9f, 0x64aa7dd8, 0xf1dd5d0c, 0xd2f3df38, 0xb6e79cf4, 0xabb0da91, 0xade156ca, 0xf5bdbf54, 0xf599f724, 0xe90d1dd6, 0xc67c4f25, 0xcaa4e1ce, 0x9b93fe9a, 0xaa018231, 0xf2b0485f, 0xcef0cf82, 0x0f44ac6f, 0x363c6497, 0x44ca5518, 0x76cb48ab, 0xfc971022, 0xc416d981, 0xc5af5734, 0x20c24f3e, 0x79b0d1c1, 0x22a753f6,
+        0xae4f6ee8, 0x57b8a79c, 0x6abc3c69, 0x87f84830, 0x6151755e, 0x5036a524, 0x3698e366, 0x124407bf, 0x62083958, 0xddd13318, 0x07984e5c, 0x33daa03e, 0x78ea0892, 0x3dfbde8d, 0x5557e991, 0x9afd5eab, 0xf9d0f71b, 0x7cfdcf0d, 0x8e318c35, 0xc92bc43d, 0xd8a75ae4, 0x76215402, 0x6876d96f, 0x192e7620, 0x7646d294, 0x3c88e37a, 0xd388d64b, 0xb400df1a, 0xfdbf7e24, 0x7903b62c, 0x86216efa, 0x1339ea1f,
+        0xece96e96, 0xbbd50e86, 0xbd30896f, 0x32202ba7, 0x91431883, 0xf034ed76, 0xf801d00c, 0xdb7b159f, 0xd31264db, 0xdd8bc3e6, 0xf5a8f42b, 0x31df565d, 0xa576ef96, 0x67d7c390, 0x612bba58, 0xd3287e88, 0x7a00cc51, 0xe3dc7833, 0xe9719c50, 0xd1f82248, 0x03cd7655, 0xc5f0ad3b, 0x281d1693, 0x2ad59568, 0x78b8ac1c, 0xfc51a49d, 0x8b0180ea, 0x9ae141c8, 0x0f47e94c, 0xbfb13356, 0xa874ac89, 0x93989310,
+        0xe3bf23aa, 0x2b0a4b45, 0x1c10e1ff, 0x4eb87e74, 0x7011e61d, 0xc5143753, 0x47bd28ba, 0xf1bfb47d, 0xfc391a3a, 0x93dc3080, 0x9bd79c5d, 0x994082a6, 0x40f5b549, 0x08ce28e1, 0x21f309fb, 0x5640e6f8, 0x8b8570dd, 0x3f8b9a2f, 0xd3eaf55a, 0xe957baa9, 0xd6460b00, 0x04b833b8, 0xd556564f, 0x096df739, 0x3426b1ce, 0xbfdcca32, 0x8b5ef55f, 0xad18ab53, 0xdffc3f11, 0x372e544c, 0x1ef9dc81, 0xa74b93fa,
+        0xdb39cdc7, 0x862d1a93, 0xe657b896, 0xf9589fb3, 0x37c60221, 0xf1f8119f, 0x13b4e6aa, 0xe22bc29d, 0x79662a3f, 0x6c4bd791, 0xd5c45c3f, 0x44bcb2ab, 0x782a2c27, 0x61cbf5b5, 0x69ecd3ae, 0x2927e9e0, 0x80b3faa3, 0x4b601d99, 0x201cd555, 0x6e7b049b, 0x21dd7372, 0xd3a134e8, 0xded77932, 0xca097772, 0x9a5af162, 0x6e789398, 0x43ead05a, 0xe7c98ff8, 0xdd63b3b2, 0x76ba478e, 0x0ee042e1, 0x75483328,
+        0x752f5bc1, 0x710b102e, 0xb8e2bb3e, 0x921b1772, 0x56c8a5f6, 0xebd0b5f2, 0x66b65829, 0xa008d4a0, 0x86e8252b, 0x0aa5d1de, 0xe4eca1ad, 0xe4528020, 0xc742a4ff, 0x1f96efcb, 0x11c21346, 0x06ec1c20, 0x475e6c45, 0x08771ed7, 0x611e61b0, 0x48864d63, 0xdd5b2e16, 0xa3b6a861, 0x6b8285c4, 0xa1e1585d, 0x3d689c31, 0x7d8ed6ae, 0x98ffe2ee, 0x526d7471, 0x7aba3f2f, 0xd83b45cf, 0xe6073590, 0x32470bfa,
+        0xef491acb, 0x40df060a, 0xd1610810, 0x9861c3d1, 0xb57b0f0f, 0x81cae7ad, 0xbe43b402, 0x5cd08a6a, 0xe653615e, 0xde66192c, 0x10b38e5a, 0x6178a0a2, 0x55fe4643, 0x3a5506f9, 0x011c1a78, 0x98a50431, 0xd3fe12c5, 0x6be77097, 0x81e748f0, 0x72cdf3b4, 0x5dbcd256, 0x424572fd, 0x3a050f6b, 0xfa0ed65f, 0x88eabb09, 0xeca8d78b, 0x4a1bae3a, 0x0ea4119a, 0x1180c141, 0x8433db40, 0x15c0a49b, 0x6a9d0d8d,
+        0x117eb20f, 0x254ae6fd, 0x68e9bbed, 0x69b37147, 0x1f95ec08, 0xcfa1ebe7, 0x71698915, 0x888ea907, 0xe620ea2e, 0x1ab12c11, 0x5a8815f6, 0x5a1373e7, 0x1ec3fe49, 0x29621237, 0x91b14281, 0xd0970ad9, 0xe0022502, 0x755b24e7, 0x593c35bc, 0x76ebdb84, 0x0abb55d6, 0x08c9f9cb, 0x2470602d, 0xbd8f46ff, 0x139b969f, 0x47379517, 0xbd932683, 0x56ed04c3, 0x74ded4b9, 0x5d1946d2, 0xab12630b, 0xd6d63321,
+        0xb301ca66, 0x9492ff51, 0x9244775b, 0xec6a8fe9, 0xa0f20bfb, 0xf74217d3, 0xe0b522f0, 0xbef68154, 0xa98fe22e, 0xa13585d7, 0xe01b1b5a, 0x0bcdd82a, 0x77af320e, 0x11de6b72, 0x242e991f, 0x9b9eba84, 0x1171428a, 0x0c5b8064, 0xb6d89730, 0x1918eea0, 0x4ed82c15, 0xf55dedbb, 0xabd166e8, 0x66097b97, 0xa7050d56, 0x3af0e484, 0x87f2d100, 0x8a2b03a4, 0xb711412a, 0x14784981, 0x813b44d3, 0xe475cd19,
+        0x7ced86a6, 0x29fdd1c2, 0x7f7254dd, 0xbfd69faf, 0xef9c1815, 0x3b124590, 0x63a7f6f4, 0x0457e7d4, 0x1dfd39a2, 0xfd79bbdf, 0x3d8c65f5, 0x2bf4dce9, 0xaf5629d3, 0x097a6b14, 0xd6d95320, 0x6dd88d4b, 0xf85b6606, 0x757ef1ce, 0x37155b0d, 0x90b0c1b3, 0xc2a5dc9f, 0x74c7bd1f, 0x9587c3a9, 0x6d200ca4, 0x6727d5a0, 0x3c521a05, 0x829200e6, 0x5279f281, 0x7ee28a17, 0xfb5fb9ed, 0xa6c0137d, 0x069665dd,
+        0xbe6386aa, 0x07eb1695, 0x4d4cd284, 0x96858b66, 0x16f0cedf, 0x5831f51b, 0xd372794a, 0x7728528a, 0x63bbf96f, 0x321efdd6, 0xc67a60fb, 0xe9c20955, 0x2deb221a, 0x714325f6, 0x1bff18a9, 0x1982dc97, 0xe7b874f6, 0x9e713d20, 0xe0588a18, 0xad4faef9, 0xfff267d7, 0x7897ec12, 0xdd3fcb96, 0x603d477a, 0x0970ce34, 0x41557e18, 0x8b704ee1, 0xd903293a, 0xff63c625, 0x6382b696, 0x82d16e20, 0x73cf0994,
+        0xdf9e7e63, 0xa269edff, 0x11fa08c4, 0x794c9a0c, 0xfccf56b4, 0x91acd7d9, 0xec36f291, 0x1bdd659a, 0x9073674e, 0xa0bc46a2, 0x6e744c15, 0x8ff87008, 0x567cfb35, 0xf74385dc, 0xb88154b9, 0x00850a04, 0x037eee73, 0x21d1a897, 0x5fc268b5, 0x35a93439, 0xec351929, 0xf0b1fff8, 0x8be61707, 0xc1b8f78a, 0x7950a649, 0xfcb6a957, 0x7f1d11c7, 0xbf8dab2c, 0x4f18ba87, 0x89f9f5bf, 0xf36a1702, 0xd83dcc75,
+        0xfb63e96a, 0x11ee4fe3, 0x8378df1a, 0xf12e5b9a, 0xfe1a5dd4, 0x4570e678, 0x74b22c46, 0x03a99d46, 0x6d1103f2, 0x118656f2, 0x36953e60, 0x2fafedbb, 0x3178cc58, 0x334d44f9, 0xd52f61cc, 0xe061bcbe, 0xba04e39d, 0x96e8a7fb, 0x879d69f9, 0x742d52a3, 0xd43ea292, 0xea6ceaa5, 0x830a33fc, 0x320d1a19, 0x8d4d5f16, 0xf26ca926, 0x3699d6a8, 0xe43b98cd, 0x967b698e, 0xefc34ccf, 0x248c2173, 0xbf88b022,
+        0x0d5e8574, 0x40b9e440, 0xaeed4465, 0xeab20792, 0x9bca8dd6, 0x8b99b348, 0x383b5f1b, 0x820f2538, 0x6801f659, 0xc9a3edcc, 0xa141a5aa, 0x31f6a2a8, 0x8e28a3f6, 0xbb527595, 0x20a9056f, 0xd8de9ad5, 0x2b5094ef, 0xa7fd2df2, 0x00417f61, 0xa1030b09, 0x6b0cb210, 0xd1a64580, 0x7d0d65a9, 0xfab5a1d9, 0x28ed2a08, 0xe7e9e8f9, 0xaab5eed6, 0xc719039f, 0x04966dfe, 0x380f2429, 0x1ea30b55, 0x7319288a,
+        0xf3be7bf6, 0xba99596f, 0xf9d190c8, 0xd69a9fdc, 0x07ea03f5, 0x2469f1bc, 0x7e6f0a53, 0xf812d39c, 0xdcdb5b64, 0xef22658f, 0x3e2d21e0, 0x39a7747d, 0xd592bab1, 0xe99b410d, 0xd0478334, 0x5d78c18d, 0xa10461bf, 0x008c29a5, 0x0092aeb4, 0xecf74315, 0x6135968b, 0x75156b58, 0xe78721b7, 0xc6024691, 0xae2b86da, 0xb9db1145, 0x60fa8d71, 0xeb7f73a2, 0xa1c7c8b8, 0x782846d5, 0x3e46e95d, 0x98ff6dc7,
+        0x92482082, 0x385d79ec, 0xfb5293a5, 0x874b9b9a, 0xd984c2de, 0x19966c24, 0x488fcc4d, 0x9e34f986, 0xaeb58bae, 0x2dbeee95, 0x5bae0c8a, 0xe3b44961, 0xfca73b8b, 0xc443b620, 0x15802020, 0xccae1c1e, 0x40140bfb, 0x5f5bbe18, 0xcfb46974, 0x53fc66af, 0x159cc0b7, 0x31772b28, 0x88004289, 0x01221751, 0xccf5a0a2, 0x3eeeaab5, 0xbd23850d, 0xec9af5c2, 0x2444067f, 0x5b9fa606, 0x7019d687, 0x667752ae,
+        0x59b2873e, 0x8568c1df, 0x7a7ecfcd, 0xed7496e3, 0x966011ba, 0xc8bccc3c, 0x255385a1, 0x244e9e43, 0xe7c3bf31, 0x31757b14, 0xa3e3c520, 0x7d64c105, 0x29b66876, 0x147ed6ab, 0x90df843e, 0xc67f48ae, 0xee7e6537, 0x45f179b3, 0xc8795d76, 0x9ee4532b, 0xaf893136, 0xa4e6aa2f, 0x775a25b0, 0x2e1f809d, 0x42a434f9, 0x5b8ed623, 0x91bb8f10, 0x8b6fad99, 0x3faf6f38, 0x2a77df2a, 0x51bdbfc4, 0x2924df1e,
+        0xe92a55de, 0x43f6e6cd, 0xe29dc7cc, 0xaead9d57, 0xcb6a3672, 0x3451866c, 0xed01df09, 0xe0c84d6e, 0x2dc87472, 0xde67b90c, 0x847d93b0, 0x1014498f, 0xa0836bb6, 0x032b3f31, 0xe9c65178, 0xb76e7a57, 0xa9f9d2da, 0x7e8f2b29, 0x63a22415, 0x74bac1f3, 0xbd712311, 0x47cba27a, 0xd15084b1, 0x3425fc2a, 0x99b0325c, 0x2822a7db, 0x15c25e0a, 0xe25c636f, 0xec1fa77c, 0x4f15f1e7, 0x0db89611, 0xff5f9215,
+        0x86eb1b6f, 0xbf66e167, 0x1e6d2b0c, 0xc0d58514, 0x61510d1d, 0x771c2fc8, 0xd015cae9, 0xd365db17, 0x3e7d11f4, 0x33bd9d81, 0xe26985ff, 0xe52fa38b, 0xb670052f, 0xa8b7da86, 0x60ce561e, 0x34c531c4, 0x3fb93217, 0xa47c0ecd, 0x40bb05e9, 0x33ca5463, 0xc46a139e, 0x1478285d, 0x0cc3bf9e, 0xecc22b37, 0xaf6f1258, 0x919fa401, 0x9eca8c0e, 0x4880b447, 0xbf26b944, 0x9121dd8b, 0xfa2d6d04, 0xcbceb2ba,
+        0x624827e8, 0x6af566c9, 0x429cd598, 0xc16329f7, 0xe0a1d7ef, 0x8355ed5b, 0xce5c4e69, 0x74ebe4c9, 0x760c07f7, 0xa9333bb8, 0x174943e2, 0x16968123, 0x9073ebf5, 0xb59b1542, 0x2ff8533c, 0xa5c93c66, 0x881ccf17, 0x3855518d, 0x5ae376aa, 0xd00e2dc2, 0x5095a6c3, 0xd1f5fac4, 0xba0bba9a, 0xca9c6947, 0x8409b0b7, 0x2ec8b16a, 0xca67b434, 0xda444dc4, 0x3459a03f, 0xa9b0d18a, 0xad985c2f, 0x12b48e29,
+        0x0d6fb15e, 0x49251eef, 0xcd19a1d7, 0x3672ad06, 0xadb6ac9c, 0xfe8fbf6b, 0xf22da470, 0x46e04540, 0x17705abe, 0xeaa39dfe, 0xe88f6ada, 0x2084b7de, 0x828c4849, 0x051d7762, 0x9d6a51e0, 0x73c342f1, 0x50ea0ac2, 0x7819e4e9, 0x13d63839, 0xb7aa45d4, 0xd9c1d7e0, 0x58072e10, 0x24ffb728, 0x15e31c8f, 0x5ed82820, 0x58a7279e, 0x9f550b8c, 0x132807ad, 0xff5f8fa4, 0xe80ae452, 0x8470aa4f, 0x288aaec7,
+        0xfd92249e, 0xdb2274e0, 0x39fe2981, 0xe0c10d46, 0x65e3aaf4, 0xda81706c, 0xb2525352, 0xe6f5e839, 0x108c4be0, 0xdebb5b72, 0xbf66bfcc, 0xe65350ea, 0x6b9f5cdf, 0xbaf42ea6, 0xcfb27f99, 0xd4c77932, 0x612dcfd9, 0xfe302631, 0x51ae6da6, 0xe84bf945, 0xfc6dd7a9, 0xde36ba52, 0xb7dab43e, 0x63e64eb9, 0x69c66267, 0xa2792428, 0x193fd4cb, 0x5ad71d09, 0xbc0c110b, 0xdc8b77e4, 0xa326815c, 0x54d388d5,
+        0x12e74d04, 0xed40dad3, 0x1ed99f9c, 0x4cc785f2, 0xfb49e383, 0xf9633863, 0x7f2e3f2d, 0xa9b48b4b, 0x05bce6aa, 0xc66f3660, 0x0dc7e78b, 0x32895caf, 0x24104e23, 0x0c817f0b, 0xe4babb90, 0x25ebf13a, 0x773ffbfc, 0xded47d48, 0x8f944ebd, 0x2032cabe, 0x7e94b0e0, 0x8a7d91ec, 0x115a63c6, 0x41850a2b, 0xe5cc29fd, 0x76e65d2d, 0x49df6a95, 0x233dc1a3, 0x44e04096, 0x33acb2e4, 0x981d1c1e, 0x3793a694,
+        0x79d33533, 0x6964d808, 0x5e49a1df, 0xba3fa4d5, 0xa7d620f2, 0x049e7031, 0xf02de6cd, 0xe02f96c3, 0x9ed42f4d, 0xd474b22c, 0x48683549, 0x7bd97089, 0x3486c222, 0x766fa555, 0x706b1752, 0xb808d1dd, 0x06f9decf, 0x920424c9, 0xe04d9dd9, 0xe1bcc066, 0x9c2f0174, 0x2a55f057, 0x341ea15e, 0xb864e237, 0x851944d1, 0xf8eb637b, 0x0dc76de0, 0x8bb7e3a2, 0xdcb850cd, 0x1d5a9d82, 0x71642a8f, 0x87ba78f3,
+        0x8c4a540c, 0x0552459f, 0x911dca9b, 0xef585dc9, 0xae2e5dbb, 0xdd056ea9, 0x5f12aa89, 0xfac22ce2, 0x1406cbfa, 0x9c7c8b06, 0x74d366a4, 0x4ca996df, 0x0c3f7dc3, 0x2809ec41, 0xbcfe6908, 0x26631c82, 0x09ba77ea, 0xbdc99a31, 0xf4495b2d, 0x2c236fc7, 0xbe0c1d0a, 0x0fcfab85, 0xeffcb1f3, 0x00b6df21, 0x836bd260, 0xdbee3a9c, 0x3dabefd3, 0xcbe8059d, 0x428d15ae, 0x1179cc76, 0xc24c2166, 0x8bc93189,
+        0xfe4bb61c, 0xe35719d8, 0x5b51117e, 0x51c4f204, 0xc0bb4a9f, 0xf098c36a, 0x1c2c2378, 0x40953419, 0x98d7f4d5, 0x3b69d357, 0x6e3b7cb5, 0x79885089, 0xbb10560a, 0x17f41ad0, 0x42dc7102, 0x38c8d24d, 0x184550e4, 0x9e7ce796, 0x737257c4, 0xf190a4f5, 0xa3dbec42, 0x84d348f3, 0x21cd4bcd, 0x13366fe5, 0x73ec2ba2, 0xb7ea9ca6, 0xa6f68d8d, 0x5f929fb0, 0xd3b629bd, 0x1f1b8ca5, 0x4ede20dc, 0xb28a70fb,
+        0x67014cb4, 0x676cfe50, 0xe25cfbd4, 0x4425f5e6, 0xb3592ddd, 0x1f79efdd, 0x3deb57bb, 0xebbd2038, 0xc2845676, 0xf7ceb353, 0x4a7a1bfd, 0x767bd873, 0x4706395a, 0x8476ba51, 0x019047f7, 0x71ff49f7, 0x5fed11c8, 0x055609f5, 0x6fdad3b7, 0x1e5a9379, 0x4de68126, 0x1f2edcbe, 0x4a75d287, 0xbd5b48aa, 0x3e158c6b, 0xfb42fe62, 0xefca7f2a, 0xfdf60e74, 0xdc356d6b, 0xc5861dfa, 0x65b0c047, 0x9d051120,
+        0x7abb35d0, 0xf26206e8, 0x90a3957a, 0xf1ae79d2, 0x7d57b24f, 0x0cb81c2e, 0x45126010, 0x5350b310, 0xfd5f9c3b, 0x2d909be5, 0x2f055ecc, 0xa443a67c, 0xdc9588f0, 0xef6acb4d, 0x085a9ba3, 0xafda4c86, 0x54fb3361, 0x2e282455, 0xbfade21a, 0x9eedac29, 0xa4f5335a, 0x043c70a4, 0x2b532dde, 0xd6a5015f, 0xf3c3b6ac, 0x357f77e6, 0x8b13c21f, 0xaf330fa1, 0x405ca22b, 0x8ee742ea, 0x941d5091, 0xe98a1cfa,
+        0xea5cacb7, 0x28d028ed, 0xe545d047, 0xf19c708c, 0x7b858dbf, 0xee01bf70, 0x71576820, 0xe9041e46, 0x4fcf2c23, 0x622e2233, 0x0e290b19, 0xcd6ff36f, 0xc0f87f6d, 0x36462a8a, 0x21c74f44, 0xf2e6f30f, 0x5b1db642, 0x2b16d639, 0x6557ccb2, 0x5f087860, 0xe2b184f2, 0x3fdaa475, 0x056ff465, 0xf5b45ff1, 0xd815ac93, 0x6173915f, 0x49beff6c, 0x513bb992, 0x40167896, 0xea3e7ec0, 0x7d0672a3, 0x03b796ed,
+        0xbaa21c66, 0x0813e5bc, 0x33dea619, 0x1555623a, 0x375de08a, 0xea05b486, 0xf9f10f00, 0x577816fb, 0x97de4d04, 0x3aa72eee, 0x4ded6492, 0xa59318ff, 0xf7bb6041, 0x5c8cffff, 0xe55e4766, 0x06cfde8d, 0x30a58275, 0xc1d652a9, 0x0075ebb7, 0x29ba2465, 0xb6362672, 0x2f55f08f, 0xde2357d3, 0x21d917b3, 0x1e496d40, 0xdce6015b, 0x09fd68e7, 0x46b3cd92, 0x992346c6, 0x1aefe4f2, 0x9ab44a33, 0xb9bdc804,
+        0x8434ea15, 0xcbc78526, 0x01ec015e, 0xb877d4c6, 0xb05defd4, 0xcddfba5f, 0xf22e642b, 0x6d5c6c64, 0xdfa015d1, 0x83053410, 0x1cffaf83, 0x17faacb8, 0x5ac50e72, 0x64b0697c, 0x3def9277, 0xb9eaa4bb, 0x8f7200e0, 0xc4ffc5e3, 0x9cdbaf06, 0x42653aeb, 0x4d01d318, 0xb5d18970, 0xcc5303eb, 0x8055260a, 0xcbaf2b66, 0x7104fbdc, 0xc7f5a9a8, 0x49f2fd77, 0x59e1963f, 0xe72e3b1f, 0x0de66e64, 0x7a13f278,
+        0xb56daa77, 0x83998d9b, 0xfe308ef8, 0x7559f25a, 0x29980f0e, 0xb213a527, 0x1d12aee0, 0xf42ee73c, 0xe9b23439, 0x9c09c806, 0x7b4ddf26, 0x94b8cf35, 0xda0ff473, 0x934febe6, 0xcf5682d4, 0x874ad847, 0x2fcf7935, 0xb6d6b029, 0x3f487d60, 0x226358b5, 0x0ddf51ef, 0x2bd82cfc, 0x9be4e5e0, 0x1ff394ae, 0xc6f8b441, 0xc79f7349, 0x82d51891, 0xe7317fbc, 0x071aa134, 0xd2c57f8b, 0xfd89e3d6, 0x5627e643,
+        0x803d9947, 0x6e427ea3, 0x54fdc990, 0x66d19eb4, 0x2c839afb, 0xfb197d73, 0xa029b4fb, 0x78813eba, 0x933c0954, 0x8d8c7e5e, 0xc040940d, 0x127c7477, 0x274d0201, 0x82e492e3, 0x5b5667de, 0xe84f290c, 0x24d9f5ac, 0x5a526007, 0xd9c16c59, 0xe80b7065, 0x567ea188, 0xe7756a46, 0x46734710, 0x05f507a5, 0x0189ef77, 0x27a42563, 0xcd4a1a50, 0x7bdd7490, 0x7f562620, 0xddb164be, 0x89b01180, 0x2effa07b,
+        0xdef41f98, 0x57673003, 0xb90c46b7, 0x7c5edf83, 0xab07adfe, 0xdbb0705a, 0x2dc7a86d, 0xfc7b82cc, 0x8ced4379, 0xce4a60e7, 0xf5ba5f9c, 0x39ae9f58, 0x9894e059, 0xa71b6ed2, 0xcefe7d74, 0x74c2a72e, 0xfc0a4fea, 0xcff05b78, 0xe2cbf1ce, 0x8bc10404, 0x36be0595, 0xb85d1cb2, 0x08dd8414, 0x265d3961, 0x737cd949, 0x54317ae3, 0x03880a5d, 0x11cc407e, 0x79451b96, 0x7a50e89e, 0xf381a709, 0x65d81a6f,
+        0x3fbb5636, 0x3a6fa4f8, 0x62ec9ace, 0x567ac803, 0x6e726aeb, 0x9138d9fe, 0xd4b4fa15, 0x357bf7a5, 0xd31c0dd7, 0x88966816, 0x73f7b78e, 0x87bbb7ef, 0x616c643c, 0x60af0f40, 0xed05b898, 0x3f2a635e, 0xbda7ed8a, 0x7ad278b0, 0xbcd58561, 0x36645c59, 0xf2691625, 0xfe86d1ae, 0x8295e4f2, 0x84401eff, 0xcab89831, 0x0c1e117d, 0x73c1a489, 0x24f7fcf9, 0xd9651631, 0x25d3ab0f, 0x63f3464b, 0xdf21f58b,
+        0xbd063e3c, 0xc86ebbc8, 0xf9f7e084, 0xb3097943, 0x85f6ed5e, 0xa87df30d, 0x6e0eeded, 0x0725cbd1, 0x35084ffc, 0x2e7d9b88, 0x52ca6ec7, 0x62ae794c, 0x1c61fd90, 0xcfa80b30, 0x600dc427, 0x00cd5349, 0x5474964d, 0x899b8c33, 0x57943445, 0xf2f25be1, 0xd12eb37e, 0xba792043, 0x881c8744, 0xe34f82e4, 0x8568413d, 0x5c8fb5b8, 0xc639293c, 0xe8956037, 0x1ec98a6b, 0xdb692b9d, 0xa01d804a, 0x5e1cad09,
+        0x58bdf7c7, 0xfd20bd1e, 0x55a99da3, 0xb651a730, 0x931a123c, 0x9bb089b1, 0xdd2b0461, 0x510bff37, 0x32d5079b, 0x6954765f, 0xac25bf0d, 0x89f5ee27, 0xe6de6ba2, 0xa6ee160e, 0x32fbf707, 0x6e8914c7, 0x4c5c599a, 0xe37ac19a, 0x7f1bf3cf, 0x94a88122, 0xe3d0c394, 0x1d42fbd7, 0x805cb4fb, 0x09c8760d, 0x46e928ea, 0xa8cb4fb7, 0x88b17bac, 0x96725e4c, 0x930204d6, 0x6a03f095, 0x69ad8c93, 0xe84b5a87,
+        0x03c78d34, 0x4755ab3c, 0xb3e864f6, 0x3c08a635, 0x81ba2e7d, 0x57d280aa, 0x619aa7a5, 0x7e89da79, 0x109f5a6f, 0x16192c1b, 0x5bcbe574, 0xa051f8d0, 0x3bf7e3bd, 0x8dc969f8, 0x3418d768, 0x9e17b76c, 0xd053dbd2, 0xbebe2128, 0x64b8213f, 0x44cac8ea, 0x0db71a3f, 0xb5d26332, 0x6003615c, 0xb7f28f18, 0xc66604aa, 0xb4cb6f76, 0x2a50f1eb, 0x1df9066a, 0xe9872d69, 0xcc86706b, 0x51b7785c, 0xcc84a493,
+        0x546c70a6, 0xd152826a, 0x3448c9e6, 0x9de19016, 0xc4682f4f, 0xce15a06f, 0x11e9c2b5, 0x12cdddda, 0xf3356cdd, 0x067745ae, 0x28806fad, 0xe0a87c79, 0x49548439, 0x6222317a, 0xafe7b186, 0x9f65a614, 0x24226507, 0xa2e243af, 0x83181c44, 0xc45b30ba, 0xb8a8e1b8, 0x539ef063, 0xedc8cb66, 0xc449a6f9, 0xbb6b2863, 0x68c3a378, 0xbff60a25, 0xb053165f, 0x684618e4, 0xb2dcdd3b, 0x3d4f53e0, 0x41b5575e,
+        0x855674ea, 0x64b3a458, 0x38157426, 0x87b1ad1e, 0xd7a6bbc6, 0x8e543136, 0xa9b5f89d, 0xde8a23e3, 0xd0f4cbad, 0x7d0c9ced, 0xcb3b8ff7, 0xcbbd74e9, 0x7817474b, 0x9d1b1df6, 0x4f3d0765, 0x7c4bec82, 0xb0053188, 0x6bd6a6f6, 0xfca258fa, 0x4b8ef1c1, 0xc51a62f8, 0x870e7e1e, 0xd45f690c, 0x7094df03, 0xb4c1f880, 0xfe80dd10, 0x9867f7b7, 0x81adc38b, 0xc0bc5bbe, 0xde13095b, 0x7f292fa4, 0xa502f680,
+        0xdd795572, 0x3d77c69e, 0x116a4348, 0x8c109fe9, 0xf7f2a06e, 0x8f1b64b0, 0x194817fd, 0xd1831c5d, 0x8c06b0ac, 0xcfe4e7c0, 0x67290922, 0xa2b6ac16, 0x1b66fbcd, 0x766b9b48, 0xb962f459, 0x18abb12b, 0x9d1a4946, 0x74fc3d8b, 0xc8709a70, 0xe562f176, 0x910e0be8, 0x369e5ff1, 0xcfb29cda, 0x2a1da0d5, 0x93a79522, 0x86dbcadf, 0xf1abe5a3, 0x90274e83, 0xdf177ce7, 0x7dde0eb2, 0x81f237f9, 0x14005ac7,
+        0xc9f050a1, 0x0072231a, 0x79188934, 0xe55c6d1f, 0xd42c590e, 0xef045019, 0x528e2757, 0x124e4c6f, 0xf9e4bd5b, 0x273ddbfc, 0x4738d6a2, 0xba87ddfc, 0x12a50a30, 0x267c662f, 0xc05030a5, 0x99a0b391, 0xd4c8c711, 0x30034b4c, 0xec1e597b, 0x55b2982e, 0x53b7dd34, 0xa82c7ce5, 0xcdd77ba6, 0x93ae2cf6, 0x89cac609, 0xd4b23f86, 0x769a7e46, 0x1066319c, 0xd21cb028, 0xecd63ada, 0xf3b02508, 0x87890b1a,
+        0x13869ea4, 0xedb8d23c, 0xb56b7789, 0x22773f02, 0x3c2423a3, 0x89f6ab4c, 0x661e04ea, 0x7761f83c, 0x44a3cd70, 0x6694be73, 0xd51f97a0, 0xe2193b6f, 0xfed0d164, 0x55dad64f, 0xa6561483, 0xabcce151, 0xb43640bf, 0x9a1810c4, 0xeeab6c34, 0x09db312c, 0xb009ff5c, 0xa7c1d4b3, 0x917fa466, 0xa9ed407b, 0x617f395a, 0x187cc435, 0xa273cd1d, 0xafc94cd4, 0x5cfc8d0a, 0x448edc35, 0x6859bf62, 0xca0cf9eb,
+        0x5e631afb, 0x366b07b2, 0x77e8fb30, 0x6ae880e4, 0x80dfbac9, 0x4a10f821, 0xe918df75, 0xf9ebff8b, 0x34d8a9c2, 0xc57eb17c, 0x56aebaf0, 0xfcf95f21, 0x92f9e597, 0x91e29e97, 0x7ca79abd, 0xb5b1d43f, 0x4320c891, 0x7f72260b, 0x94603cb2, 0xc2df4d22, 0xe0da1586, 0x3229cf65, 0x0f9a6f0e, 0x5e9a4232, 0x70dd47b5, 0xfd0ca72e, 0x1591eea1, 0x815d9761, 0x90305721, 0x110b5319, 0x8a104210, 0xc5e99fe7,
+        0xc49f7153, 0x58cc1e14, 0x3babcdd8, 0xc0e1a4f9, 0x965d56c5, 0x973529c7, 0x757f4fa7, 0x9dc3fcbe, 0xdc6948fe, 0xb4db6ee9, 0xa92c8de3, 0x2d5f6390, 0x5a97d32c, 0xa95f5922, 0x58e13381, 0x18969b6b, 0x40f3ab70, 0x3ec03e8b, 0xf3d8e265, 0x872faa5c, 0x4c56e67d, 0x576dd67a, 0x288d4ce5, 0xdc5cff35, 0x5c7df6df, 0x164576d9, 0xbddb676e, 0xdd8d0fb7, 0xb4b5dcf6, 0x8a947109, 0xb36dab79, 0x0407757a,
+        0x01980368, 0x0a980f1b, 0x5fd51d06, 0x170caf24, 0xe6c86aaf, 0xd2cb3c19, 0x517f0bec, 0x8b8a535b, 0x98da6d3b, 0x61a955f4, 0x4c3c4e05, 0xccffecce, 0x2000f142, 0x39370ab5, 0x636b46e5, 0x80c941e4, 0xd153fbea, 0x35a98674, 0xfb2e54b1, 0xcad6beff, 0xdcab5db5, 0x405790b7, 0x15754913, 0x5a97ff9c, 0x56744b00, 0x0fb85ac2, 0x3c72f608, 0x3999cd1b, 0x515bb1b8, 0x1d4a4583, 0xfc04cf8e, 0x50e4b915,
+        0x8c5a2b83, 0xff97e27f, 0xbfceee3e, 0xbb500784, 0xd783986e, 0x25c44296, 0x2ab948a2, 0x4c62f009, 0xe73167b6, 0x47f4d561, 0x1ae96a3f, 0x9822b862, 0xbebe6bc5, 0x8d819a0c, 0xbab81e91, 0x5d12537c, 0xb7ac1663, 0xe780a163, 0x22289586, 0xb540a2d4, 0x721f3a4d, 0xaeb621d5, 0x823fe14f, 0x35830321, 0x87ce362e, 0x8f4b6146, 0xdc166a95, 0x501b9e55, 0xad7f612d, 0xb9cdfe47, 0xce4b6a83, 0x3b1cc3b9,
+        0x87ff8846, 0xf4766282, 0xf4b596ed, 0xa9cf29e5, 0x1111bd92, 0x039c41b9, 0x8aa0ecf7, 0x50bc5993, 0x481ae46c, 0x5f1de2c5, 0x7b1c48c5, 0x8a9a305c, 0xaf533b84, 0xb8dd34dd, 0x35506bea, 0xc7ff5ab2, 0x9bb0705b, 0x25b76267, 0x5380481d, 0xc8bdc000, 0xe17f33da, 0x375622c3, 0x2226262d, 0xeec82ab8, 0x1a376587, 0xe35fc221, 0xf588af63, 0xa0021feb, 0x272495ed, 0x00c51722, 0x270cbc5b, 0xad98b146,
+        0x27d24b4f, 0xf4174cfa, 0x16ee052d, 0xc2584cad, 0x74552b12, 0x2dcdfe57, 0xab3cbf80, 0x28718ed2, 0xd4d02fe4, 0x08b32799, 0xca4cd981, 0xa98e4c81, 0xb6743900, 0x1b598fcb, 0x78fc2662, 0x629aeb91, 0xb566087c, 0xe6fb80b1, 0xf54362de, 0xd4d691b1, 0x817a81d1, 0xd97c44d4, 0x4e17f615, 0x0ea6e2c9, 0xca3110c8, 0xa38e56cd, 0x3c83db30, 0x2e7bddbb, 0x3bfb453a, 0xf2249978, 0x76f68a27, 0x7bf69d35,
+        0x9e902225, 0x365f5c6f, 0x9d863a5c, 0x0fe514ca, 0x1f6447a6, 0x772116bf, 0x1fb0eed1, 0x1cf97f34, 0x48d24dfd, 0x8559783e, 0xbc58fc24, 0xbf4cb705, 0x694b7ce0, 0x1722b4e0, 0xd438285b, 0x316b164f, 0xef63a383, 0x13b15028, 0x66293b85, 0x2dd702af, 0x0d5db981, 0xd11e6789, 0x9239408d, 0xe85a015d, 0xbf674cb2, 0x6e08b7ac, 0x51fb7b5d, 0xc67f8c3b, 0x7e30f18e, 0x4d27794e, 0x38be3c29, 0x1c5714f7,
+        0xf0743e65, 0xb59a400a, 0x7b785c0f, 0x23d7f1ba, 0x8a3d2eec, 0xe8bb8c12, 0x389732b4, 0xae34a9bc, 0x188fda08, 0x284ac302, 0x0f670024, 0x80597501, 0xd1cb5572, 0x4545388d, 0xc57f9a3e, 0x42f98e48, 0x32191d97, 0x6592994a, 0xe526769c, 0xfee4bd54, 0xaf2e4b44, 0xe5721d24, 0xa8271747, 0x5b9c093d, 0xfd899f46, 0xb7b629f6, 0x08a00671, 0xecc96881, 0x6c9bdcd8, 0x0d8ad067, 0x7d6f91e7, 0x5236ef43,
+        0x95608c84, 0x4dd06639, 0x15512a9f, 0x54dcd80f, 0xa8ffe4d4, 0x9075e2e3, 0x0d63dff9, 0xe4f38018, 0x8e8c7237, 0x2c16ccef, 0xb6474967, 0x37afcbbf, 0x7ce7b5fb, 0x96e7414b, 0x9e1b136d, 0x813cbc2b, 0x36ba2082, 0x61c4da5f, 0xa549e2d5, 0xaf760cbc, 0x6171c5fd, 0x8455f8f7, 0x1a8cecb0, 0xc63943a2, 0x60a49856, 0x5798246e, 0x434ad884, 0x5d32d2ac, 0x3dc4e4dd, 0xbab83ef3, 0x9f77f346, 0xc200cedf,
+        0x85de981b, 0x2518def9, 0x69c9f2fa, 0x75526191, 0x37c13809, 0x2f4d8b66, 0xdbca2b79, 0xdb2bf71d, 0xdc6b0974, 0x8c1068b6, 0x48b03a2f, 0x05d60bc2, 0x9d8a62dc, 0x034ae867, 0xc78c9fb9, 0xeff62aa4, 0xf470df89, 0xb9c27935, 0xeb6b1e46, 0x5eb2a304, 0x6283482c, 0x6dff30c2, 0x29a2f902, 0x231a17b1, 0xcbf7e6a5, 0x57d3810a, 0x1d231f61, 0x42033023, 0x28a8b58c, 0x84f7ef8c, 0x5b178d37, 0x52696449,
+        0xd906b49b, 0x67de50c6, 0x9531261a, 0x2e54ded4, 0x960fbd42, 0x6ed031a8, 0xed03b7eb, 0x5f78bd1b, 0x93385457, 0x838dbf39, 0x028de0f4, 0x486d4a0b, 0xcf33599c, 0x65b43515, 0x9bdadd50, 0xcfcdaf75, 0x7adb9f62, 0xd0f37879, 0x44b87e98, 0x26587765, 0x42129adf, 0x43d3732d, 0x7b2370f1, 0x0f08a8c9, 0x3a330d2d, 0x75a5a099, 0x0c713354, 0x0bacc78c, 0x2b536e7c, 0xd498fd1a, 0x42298993, 0x3c7cbcdc,
+        0x32aa3bd5, 0x460688ba, 0x9b0eb35d, 0xf0a40d0f, 0xd2de3def, 0xd4059c63, 0xcf847640, 0x929518b5, 0xcd5f67b4, 0x9be9dd90, 0xb546eb0f, 0x8c37881a, 0xdc002fff, 0x191af2df, 0xc7f527af, 0x61d2a893, 0x342c07c8, 0x5235810f, 0xfe4bbe5f, 0x213ec560, 0x17f7c6fe, 0x767623d7, 0xa68eefc9, 0xc209e291, 0x3715cf18, 0x7453e683, 0x3e6e77a2, 0xb09a4721, 0x56f5c7a6, 0x6d2abb10, 0x32a71b36, 0xcca56fec,
+        0x81bfd516, 0x49610a59, 0xf364e017, 0x526fadb3, 0x6504fa90, 0x4b07e57f, 0x959f7cce, 0xf6a0025c, 0x9b460678, 0x195e33c1, 0xb6f2d5b2, 0xf3b2b490, 0x66cb162d, 0x1d710928, 0xdbd32cd1, 0x04bd480f, 0xeba4e75f, 0xf6bd049f, 0xc036fa21, 0xd780e271, 0x491c89a6, 0xce914836, 0xcbfc1e81, 0xaf53464c, 0x248c4d2d, 0x5b24385b, 0x812a3387, 0x3ed321ba, 0x9c560ba1, 0x5d6872d6, 0xb42c05dc, 0xcaee5d79,
+        0x622290db, 0x97d96428, 0xba8aff6e, 0x4a4232a1, 0xe32516b2, 0xd7b15ba7, 0x0e4c135f, 0xcb16ba12, 0x23622564, 0x78ca3bcf, 0xdcf1d397, 0x8f9669a7, 0x6bf793df, 0xae05da86, 0x694be2c7, 0x002bf11a, 0xf58a497e, 0x8fdf1ba4, 0xc010134a, 0xaa60910a, 0xfb22a06a, 0xd9b9ce09, 0x3bc7b106, 0xe217e83e, 0x18a25121, 0x431dec87, 0x6273fab5, 0x0226c542, 0x8011dca6, 0x2b13c419, 0x91fc49ef, 0x1945bb79,
+        0xfa04874c, 0x01fc0a31, 0x7e2bc1cd, 0xa0fe2727, 0x66a04267, 0x85715f6a, 0xfeb7ae90, 0x52da6e8c, 0x42d0c3e3, 0xb14fc5f4, 0xaa52b866, 0x0ecc141c, 0xf6d98583, 0x3b329769, 0xabd08df3, 0x3f5fc400, 0x4c96b92f, 0x815ed44c, 0x87f7e875, 0xb5add359, 0x005fe405, 0x0c1c6b3c, 0xe23ffbdf, 0x07a0cd6f, 0x6785b340, 0x91566a9d, 0x4d1bcf3c, 0x7b9539be, 0xf35950b4, 0x7a3b3f61, 0x75ed0a27, 0xe641e9a9,
+        0x49a3446f, 0x6599a91b, 0x15aa1772, 0x2872a089, 0x9509d604, 0x171f824f, 0x272f828f, 0xcc79a7a0, 0x12b64ef7, 0xb42c9746, 0x949fe4af, 0x4d958b82, 0x4979cc72, 0xf81ef868, 0x5ca6cb6d, 0x7226041d, 0xb98e1c62, 0x9a5387ae, 0xdbba5073, 0x5a9a555d, 0x591100b2, 0x0000cbb6, 0xf634f5c5, 0x0f9210c4, 0xf41d19fb, 0x97a77d26, 0x34bedd80, 0x99eb8e6b, 0xc4abb1fa, 0x883b9dc4, 0x9d937f4c, 0x6c7beb7f,
+        0xeb3e811a, 0x795558ee, 0x9a3fe1c1, 0x3c212772, 0xb3bf54b7, 0xbeb798a1, 0xbe617b4e, 0xdba585c8, 0x62961001, 0xa338b412, 0x40628d76, 0x2a9c9008, 0x0969160e, 0x706db5af, 0x78dd0b60, 0x84b009cd, 0xa52375dc, 0x517a0844, 0x476a92fc, 0x94c038a5, 0x8492885a, 0xbe399f4c, 0x3ee4024f, 0x14095518, 0x4c297eeb, 0x3b9198b3, 0xa685784b, 0xeaf3d56e, 0xe4325a1b, 0x38af8e0b, 0xdc717936, 0x87207c27,
+        0x35bcfe84, 0xad0cfd87, 0x662b04ce, 0x12fc0c39, 0xe34c4d49, 0x2190c460, 0x41abd1cb, 0xed142ba1, 0xf7804f41, 0xc3d3d5b2, 0x9e8118a0, 0x30fe44fe, 0x2a5419a4, 0x1e42780c, 0xd381c79a, 0x8661baaf, 0xa7db80c4, 0x4f3aff51, 0x8be45112, 0x4ac68427, 0x40571dbc, 0x66d5c7b0, 0x0a47b055, 0xb31f7ac4, 0x3bbe7da6, 0xa58e7dec, 0x5c71e5b0, 0xdad86352, 0xa22a1beb, 0x96eacca3, 0xfc70ecc7, 0x0f5f36ae,
+        0x350837d8, 0x62bbad89, 0xc1d040df, 0x8a787004, 0xe2e6663c, 0x231b2df1, 0x78e40e51, 0xd5df72d2, 0x28ae8e9c, 0x6afec3a7, 0xcf98813d, 0x70100370, 0x79fc696b, 0xf1ad8fc7, 0x1dc5051a, 0x5f707341, 0xe02f39f2, 0x02beaf54, 0xa29b9307, 0xb5441947, 0x18e76e2a, 0xa6dfdf8c, 0xe88f7cfe, 0xd78fd985, 0x08f6cf55, 0xd9c838ab, 0x0a2d092c, 0xa1ec7c87, 0xfd12c90f, 0x558a3650, 0xafa998f5, 0x24088140,
+        0x606eb3e0, 0x9c882bbb, 0x811b64e7, 0x62ce51e5, 0xc37473f4, 0x69672acb, 0x0c830f08, 0x2e22199b, 0xb9d66517, 0xc2a90eca, 0xb38a3c4c, 0x9b90b35e, 0x7579de8a, 0x0a64a064, 0x951145c5, 0x48bf3688, 0x56ce96d3, 0xb7677419, 0x2bae1b64, 0x5c83ef20, 0x663189e7, 0xb4412c2c, 0xeb7684bd, 0x5165e0c2, 0x39de1d34, 0x055d0e44, 0x5c6aef4d, 0x8cd8efec, 0x53167ee0, 0xf27b5dd0, 0x1565a33e, 0x65e06da0,
+        0x833e0c68, 0x24f990f5, 0xd536a105, 0x8366071b, 0xe794c00c, 0x7de5c0c1, 0xb93d94fd, 0x55be231c, 0x620c03be, 0x5f0076e7, 0x4c4ad897, 0x28e4a21a, 0xb114039c, 0x2d432ff8, 0xe165a015, 0x52252091, 0xecaf32b6, 0x46624414, 0x14ccfb4a, 0xe76775a5, 0x7b90757b, 0x6203aeb2, 0x20d5fa89, 0x5caa9a33, 0x40bec92e, 0x2dde5a1d, 0xe24b4d8a, 0xd579c0d3, 0x323f3435, 0x59b0ff90, 0x1f110861, 0xd2c344b4,
+        0x8b2f984b, 0xbf4e29ca, 0x508afc48, 0x02084eb2, 0x61cd6ee4, 0x9f9bbe0b, 0xcaa25121, 0x7b96c5ca, 0xd6d4776e, 0x20cc3902, 0xae23f8d8, 0x38d6714f, 0x6abb6696, 0x92bc1d0c, 0xa4946d3e, 0x515cec65, 0x36ce0ac1, 0x085c3ca9, 0x9e0575ac, 0x1cf7e1f9, 0xacd953b8, 0x8fa62978, 0x99dcacd9, 0x942e5096, 0x58a7bd5d, 0xcfec4be7, 0x5d49686d, 0xba687d53, 0x2be62f04, 0x86feaa53, 0xcb9cd0d7, 0x95a8161e,
+        0x7e1f6b2e, 0xa133c3e4, 0x5ac8902e, 0xd59606a4, 0xc66a6936, 0x524bb12d, 0x3c9f3d6e, 0x2f04d289, 0xd8470146, 0x10a9b6e4, 0xd107e948, 0xdfc2d6dd, 0xd8a26c04, 0x64cca13c, 0x5ec490c0, 0x0ef3dc9a, 0x621b54a4, 0x0747397a, 0xdc806f1c, 0xee9cbee1, 0x76c2c0b9, 0xddf7f1e6, 0x920f72b0, 0xca484290, 0xb1ffa087, 0x207b7754, 0xf5feaca3, 0x339a12af, 0x8bdb2ac6, 0xda2806b3, 0xa2f6aeb0, 0x624fe587,
+        0x9226028b, 0xd63bb769, 0xed5738bf, 0xfa56f3ec, 0xdd1fbd89, 0x4e37916a, 0x2b7a95c4, 0x6062eba7, 0x2dbf3829, 0xb0cc322d, 0x3e564d5d, 0xfaff8fa2, 0xc0749c92, 0xfe5ebf78, 0x32fa7867, 0x6518958e, 0xfba1fd53, 0x3695bd12, 0xb5aae1c0, 0x58fce3c0, 0x2ce9620f, 0xdc55e6dc, 0xdbb960a5, 0xf36ff610, 0xe8cf30f0, 0x123a22f9, 0xf62f8d25, 0xb99b0ae6, 0x9212d26f, 0xe1407765, 0x9018da7b, 0x6f9f5e6b,
+        0x2d39ab22, 0x85118919, 0x83807891, 0x67a02e81, 0x8c68a7d5, 0x6d8b3874, 0x2a4f9f59, 0xd68fb13c, 0x7e6fc62d, 0x81c05dd8, 0x88fd71ee, 0xdaaed651, 0x32e506b6, 0x4d84c7e4, 0x9f87ff79, 0x92decf52, 0x06bc9b0c, 0x5903c0f1, 0x519c48c4, 0x86a8325b, 0x8872a858, 0x889cbfe2, 0x53a77198, 0x9d9ec6ef, 0x9a292715, 0xc317b308, 0x5ca79f92, 0x5e36be83, 0x228a28aa, 0x4d871dea, 0xe9efae8d, 0x43085871,
+        0xa3fba9e9, 0xcaa5fa7c, 0xa8a56c12, 0xa4e3d7ec, 0xace272d3, 0xb7c81ed8, 0xbe9b558c, 0xc3ffee58, 0xd798f30f, 0x7219e2e6, 0x8443a4e7, 0x346f8807, 0x26e0de18, 0x103f9999, 0x617336cc, 0x06943431, 0xd22e53db, 0xb4914c91, 0x2bde8933, 0xa7d035f2, 0x5479429e, 0x916c8624, 0xf76ab549, 0x4234073a, 0xce693115, 0x6848ac9f, 0x38e14efc, 0x26b75b1c, 0xfff121b1, 0x0b267284, 0x10512deb, 0x28cad1dd,
+        0x6cec7622, 0x6973cccd, 0x6782b486, 0x1e0091d9, 0x66799829, 0x68d0191d, 0x1ca6f653, 0xfa0fb4df, 0x6c9fa16b, 0xf32b3afa, 0x9d1157cc, 0x652bf0e0, 0xfcf1959f, 0xe61c31aa, 0x384b6ad9, 0xebd83157, 0x5aa50eab, 0xce0eb363, 0x44286d83, 0x1f823a71, 0x4a9f9d79, 0xd5d46bbb, 0x303a4c1f, 0x3d9459db, 0x05da20c2, 0xbef7982a, 0x730c2713, 0x413c26c5, 0x3e5f3423, 0x34f88dd0, 0xde64dcf1, 0x16995602,
+        0x8753090d, 0x33d60d71, 0xea04c326, 0x5a580bb6, 0xf9537cea, 0x9871a83a, 0x95de79d8, 0x157925a5, 0x1e752ba1, 0x8ce67aae, 0xed313d6f, 0x011b504d, 0x97f39950, 0x4ff5e76f, 0xe2349cc9, 0xa72cf2b5, 0x6caa7464, 0x0faf5c82, 0x9b753859, 0xa502df68, 0x121d8ff4, 0x43e70890, 0xecbde2c1, 0xa164db45, 0xa45f5119, 0x6e1b66c1, 0x1ac07d83, 0x0080e989, 0xb341f343, 0x7aaee906, 0x65536ea2, 0xbf769db8,
+        0x15bc514d, 0xbee6841f, 0x36e8164e, 0x4e850fb1, 0x3fb148cd, 0xc1aa89c9, 0x3a05f0a7, 0x2775d7fc, 0xb3f8189e, 0x22f01a9e, 0xc11024d2, 0x8da2a82c, 0x8c1afa10, 0x8fdbcb62, 0x8db116f9, 0x1bf77f73, 0xa16d37e7, 0x70e5592f, 0xfc46e801, 0xf09d28a0, 0xa2600e75, 0x530208e8, 0x99b77582, 0x1427fb30, 0xe8c079f8, 0xb4de9358, 0x9222598e, 0x0f1032a6, 0x55de1471, 0xc176d986, 0xf5071264, 0x355489eb,
+        0x709ecd29, 0xf794689b, 0x99feb216, 0x3268243c, 0xb8631d2e, 0xbbe18951, 0xadc46acb, 0xd5b246a5, 0x36775fdd, 0xf294aab8, 0x14e544e0, 0xf3483dd6, 0x46444847, 0x825a4ce6, 0xde15af48, 0xd46acf92, 0x8f320652, 0xba117dde, 0x76f1d87a, 0xcb01778b, 0x6e28332f, 0x42545375, 0xc623f0ec, 0xb06acd1f, 0xa767542f, 0x3cb349bd, 0xa860f212, 0x7b6fe642, 0x2938aa71, 0xf94f6e95, 0x6eb03f6f, 0x5a2bab50,
+        0x814d5241, 0xafc5f7a7, 0x6015c6a8, 0xfdd1689b, 0x7af9acbc, 0x0c489ba4, 0x57a8edd6, 0xb2ae6ff5, 0xc6f311a3, 0x84d5e342, 0x624a2517, 0xe3b691ff, 0xb6288fc3, 0xf97cd45b, 0x7b1e73b2, 0x426b0f23, 0xbaab8e18, 0xb737a312, 0xf003e1db, 0xeb48a9c5, 0x846ac8d5, 0xb5588b6c, 0xe72f8375, 0xab212405, 0x37db790a, 0xb170d9f1, 0xdf8b4d62, 0xe237f6b8, 0x152b5d31, 0x7206e6cf, 0x7724adb3, 0x2cf13d3f,
+        0x059d315a, 0xfe23851a, 0xceeb7961, 0x032a21e7, 0x2de0ac80, 0x083f21cb, 0x2a57257c, 0x99ff569e, 0x2e7d9082, 0xc2696045, 0xb101fc9c, 0x95713127, 0x36b934ab, 0xe14ba58c, 0x4c509985, 0xfc0966b8, 0xc4b19ca0, 0xc7e963cc, 0x804b5f63, 0x1722bac3, 0xe8d2af93, 0x067e6ce1, 0x0ecf72b8, 0x35ee4a62, 0x6fcef97d, 0x8225387f, 0x927f4960, 0xc9abf1fa, 0x90a83ddd, 0x5a4aef32, 0xd2e5a46e, 0xf11f1f14,
+        0x20480348, 0x20d0259d, 0x4cd4740e, 0x03e84114, 0x008b11be, 0x5a145b01, 0xf37bc58f, 0xa8fd5053, 0xc42c31e8, 0x83a70265, 0xc0557835, 0xaf93031e, 0x238ca545, 0xf0ad6d3e, 0x596d016f, 0x5c07b048, 0x26be4156, 0x2f28e9f5, 0x7f291606, 0xe2eaf417, 0xcf03d590, 0x20c1b292, 0xa203b064, 0x93e8dded, 0xb03b1486, 0xf8dd9978, 0xa3badfb1, 0x8978acc0, 0xbab4d42a, 0x13d3bd3a, 0xdc1ed93e, 0x5ea936e9,
+        0xa08025cd, 0x95184c9e, 0x2e3b3c61, 0xc4af3be3, 0x92c437d3, 0x18a62974, 0x29df78b3, 0xe33727f7, 0xe7f301bc, 0x663f31a1, 0x13ccbc8a, 0xe5d555e8, 0x56aa34fd, 0x975ed2de, 0x94a35a16, 0x0c6f7157, 0x79a902e0, 0x1ab5bc85, 0xce297ba7, 0xf9198f2a, 0x87e11383, 0x275905c8, 0x3a310280, 0x43928351, 0xb5a0ceb5, 0x6bc72f19, 0x260cc863, 0x991623e2, 0xa87a4d52, 0x9a952f36, 0xa24cae32, 0x2b61b1a0,
+        0x3ab3d08f, 0x1682bf45, 0x2ea67edd, 0x3017071c, 0x2a9613fc, 0xa2af64a4, 0x264ca679, 0xee047166, 0x33e740f2, 0x153a7e15, 0xf4782fc1, 0x22838a2d, 0x041291a4, 0x175d0813, 0xf51fa910, 0x9b7cc5f9, 0x0693c501, 0x2b65a391, 0xf89ab552, 0xd657f2f8, 0x4c2f3aef, 0x98de7958, 0x866b306d, 0xba0f4114, 0xdcc2433f, 0xbae5a2da, 0xe57acab8, 0x82d8beae, 0x3062fee1, 0x50b7c575, 0xa924eaaa, 0xd88905b8,
+        0xf0f482c4, 0x013341b4, 0xf9c7f129, 0x99d611e5, 0x1ba1a515, 0x6e5fa10e, 0x2dcc56f3, 0xed150653, 0xbf1dfe8a, 0x62838711, 0x0ca9f80a, 0xb3a639a8, 0x123fb9c8, 0xe5dc5cbc, 0x7d375479, 0xf1953890, 0xd992a424, 0xba5fa925, 0xff3e1bb5, 0x51b376b5, 0x011fdfd7, 0x7b13563f, 0x8ae852a4, 0x05980ad9, 0xdc815066, 0x416d5483, 0xe8bd55c8, 0x4cee1a90, 0xd868e4e6, 0xd519b72b, 0xe0fdd024, 0xc6e8bbf6,
+        0xbf05cc97, 0x9cc4d54e, 0x1e13c8b0, 0xaca72651, 0x824f4845, 0xd0640e42, 0x2b388ee5, 0xc5da39b9, 0xd4c3b93b, 0xac716f9a, 0xed921e8d, 0xc034e34f, 0x2b6354d5, 0xf887d06d, 0xe23c9bf5, 0x3eca7751, 0x634afb89, 0x7e1c8da1, 0x61f0127e, 0xc0f04bef, 0x457df04e, 0xb6bc40f9, 0xde2d96fb, 0x99d03fc1, 0xbdd31afe, 0x1cfecc92, 0x72a7c98c, 0x45590978, 0xb5aae47c, 0x32d47182, 0xf1bfb1e4, 0x453b2968,
+        0x2c92fd24, 0x61ad88d4, 0x3e9ddcb6, 0x82cc9c35, 0xa413ee59, 0xe2a70e66, 0xcf013aa7, 0xe93914e1, 0xda7685ac, 0xa091004e, 0x65eb09d6, 0x0be1965e, 0x1d910096, 0x9bb1f30d, 0x148d4acd, 0xf2daa732, 0x5c479b0f, 0xfc11b7ad, 0xd4332778, 0x996ba8ea, 0x36f0a971, 0x2ee6131f, 0xca819e6c, 0x07f8a7aa, 0xa799a750, 0x13aff3f8, 0x06b18892, 0xdaa7e996, 0xc928a278, 0xcf39f0bb, 0xec2d1779, 0xdf90b323,
+        0x7e083bb8, 0xe774c97e, 0xd581c9a1, 0x79bf6bd2, 0x21a06527, 0x3611f171, 0xc2812b77, 0x462988c6, 0xecfd0bd7, 0xe5b50fde, 0xd52c52d4, 0xb9832bd1, 0x42681d5c, 0x733fa515, 0x36889831, 0xa1401868, 0x85b66bf6, 0x4c653398, 0x65b931ff, 0x4703f598, 0x7aa6f056, 0x7a173aa9, 0xfe707817, 0x5aebfe2c, 0x9abf19a8, 0x3a648b0c, 0xf1e58874, 0xad775d39, 0x7d8d9ee2, 0xd4c7e8ce, 0x701d4404, 0x3cf0da32,
+        0xc5ccc17a, 0x73dbc526, 0xbe7b2584, 0x24bf27c9, 0x71622926, 0xa9cd0a78, 0x0d91694e, 0xa1bc4092, 0x167b7e1a, 0x643e7cfc, 0xcc48ceda, 0x37241178, 0xa7d43f17, 0x9d9e85b4, 0x08472487, 0x84674665, 0x8e9bee96, 0x39564345, 0xb844ea39, 0x4ef9aaba, 0x1c43b3ba, 0x7be1e6ed, 0x377633c0, 0x9f1aa148, 0xcf9f055f, 0xb3bd9089, 0x237f5850, 0xe100962d, 0xe1c4256a, 0x0c232971, 0xec6e2b89, 0x47dbffb6,
+        0x0343f2d8, 0xa9c9527e, 0x608d825e, 0x09a0aac3, 0x2af5b4fc, 0xa05ccba6, 0x8a4c0a97, 0x42390f2c, 0x1a068ca0, 0x09f95b7f, 0x0a0d7376, 0xa312a059, 0xeee81a6a, 0x15f0a6de, 0xf8ba3ef8, 0x0fafdffc, 0x5c65c75c, 0xd283f262, 0xa4eaa527, 0xa8ad5d63, 0x1164fe8e, 0x82c01919, 0x3539b875, 0xc868e085, 0x0a237a4e, 0x5594a4c1, 0x7827ee81, 0xa2f4ac35, 0x266cbd2b, 0x18951441, 0xfdc64a4f, 0xb646c0ad,
+        0x6d53f551, 0x07d8d248, 0xf493443e, 0x0e2b9527, 0xb96840fe, 0x598cda89, 0x94b551ba, 0xd8f57297, 0x8a4e5792, 0xde389f72, 0xb497cb2f, 0xf826e8f5, 0x014992b6, 0x4a827d67, 0xc852f423, 0xf5a51fdd, 0xed46ab41, 0x1d66f540, 0x021faa01, 0x499a06dc, 0xd31ad7d8, 0x98dad16f, 0xc4701f9c, 0xd1d1f3fb, 0xff445d10, 0x9942b963, 0x3a4778d0, 0x1a9783f5, 0xeb671e34, 0xb72ce1d5, 0xa45a111d, 0x2a2a83ab,
+        0x1af64370, 0xabec1e4f, 0x44a63190, 0x93a8419e, 0xc38b43de, 0x9f9bba2e, 0xce35e9d5, 0xf657b15d, 0x1ab05310, 0x79ae7e05, 0x78421c62, 0xa97e730a, 0x381470a1, 0x496b8b3c, 0xec3695c6, 0xd2e49a7f, 0x5200a9f8, 0xe56c8b1a, 0xdb87fda1, 0xacce4d94, 0x42854fa0, 0x5c6d386c, 0xe0c8bbbd, 0x36091a31, 0x30324e78, 0xc96b5320, 0xc25a86e7, 0xf5f00dbd, 0x081cca21, 0xdceba3b8, 0xa47056d3, 0x44e46ed8,
+        0x911e73b1, 0xfae29876, 0x605c602d, 0xfce1d0fd, 0x36699208, 0x9418a49e, 0xcacaca6f, 0x38c2f347, 0x253bc8a7, 0x7469bdaf, 0x7d387088, 0x5c1af8b8, 0x0349dbc7, 0xf5b95af9, 0x2fc5ce3c, 0xfcdea80c, 0x7c38102c, 0x7cfaac3c, 0xd695fbfb, 0x90a8419f, 0x241c4f2a, 0xd80f8664, 0xbb729280, 0x7412a807, 0xb0e9c2f1, 0x5bf89f6f, 0x08d48234, 0x0f6d47df, 0x7d25bfe6, 0x3ce21251, 0xf8ad0ab7, 0xda296f44,
+        0x1cc99d1d, 0xa59c5734, 0xbe43420e, 0x3108ae60, 0xa3777289, 0x185dceb7, 0x981c5f0c, 0x9862244a, 0x7fa5b980, 0xca032633, 0x915ecab6, 0xc4b39219, 0x6d2f61ed, 0x98c1c167, 0x13846d97, 0xbc998d9f, 0x4a63e31a, 0x6a0c0ff9, 0x8fb3a74b, 0xb2ccd498, 0xa222247d, 0x2f3b7966, 0xee4753b2, 0x1424daf0, 0xfa4f144c, 0xdaf2d002, 0x17f5f16e, 0xc0e9bd5c, 0xa9677601, 0xc729def5, 0x9a4f532f, 0x11a3f3f2,
+        0x794c20bc, 0x165b1906, 0x5b339d88, 0xe01cd7fd, 0x79bf8233, 0xebfa86b6, 0xabc81954, 0xbb621659, 0xf5ab4ed0, 0x06d08b01, 0x16ce39e7, 0xb7817627, 0xcc38d992, 0x7d63b1f8, 0x973d1449, 0x678f93a0, 0xe985b9fa, 0xd83d79e6, 0x19e39c65, 0x6a50085d, 0x4b155b90, 0x9d162be9, 0x0d34e272, 0xb7ddda67, 0x810e8b77, 0x05470bd7, 0xc4b445ee, 0xab8dc875, 0x4871badf, 0x40afd3ca, 0x39b13598, 0x2c0ad34b,
+        0x54cf65f5, 0x24a4ba67, 0x740847cd, 0x99546433, 0xbcc53d4f, 0xcc7de804, 0x8287ddd1, 0x1d324fe8, 0x61ec7332, 0xc221334a, 0xe7cdbf82, 0x1b7c58c8, 0xf71b21c2, 0x0048d06e, 0xa0d6211f, 0xa2dbbe78, 0x21cccb62, 0xab81ec2c, 0x9e49067e, 0xe7d7781a, 0x620d9b00, 0x2558eae9, 0xfdbedf9f, 0xce761c29, 0x496d8345, 0x7d215fcd, 0xb4c8f630, 0x366a193d, 0x890340ef, 0x934c377e, 0x31764746, 0x9fd58980,
+        0xb07ed192, 0xd9785dc7, 0x0cea9e6e, 0xe43b727f, 0x2f3712fc, 0xf990316e, 0x0bb04380, 0x71011f86, 0xe2921476, 0x96f589a9, 0xd6fcc3c0, 0x72f03d94, 0x1e3f6c18, 0x8e49941c, 0x6910f2ab, 0x33660f98, 0x1ec74d09, 0x306ea97e, 0x9274a7cb, 0x8b2aec16, 0xf30b3b58, 0xdb049906, 0x41a27539, 0xa40f04ad, 0xfd67d228, 0xbb53616d, 0x598d0517, 0x814ea4d7, 0x3561b8ff, 0x42da3fb4, 0xaa73a61a, 0xa972a97b,
+        0xf92d1e6d, 0x18ce89cc, 0x9f694165, 0x45dd200d, 0x104404f2, 0x94b9ac03, 0x5f9e5216, 0xf0200348, 0x2a8f75f7, 0x5ce0c9e5, 0x3b350a56, 0x2df7ea36, 0x0d5d8b86, 0x248711f9, 0xe6d98095, 0x09f7b99e, 0xcb152a3d, 0x9a1d92c4, 0x5f7dddf1, 0x312d9d09, 0xd5018984, 0x2099eefd, 0xc0fb4d20, 0x792e913c, 0x9f326b92, 0x0aa10dcd, 0x64e34a7c, 0x5a96f846, 0x5bf9a3f5, 0xb4d1531a, 0x16bf08f2, 0x6d9c9d8c,
+        0x577824ed, 0x236ba3b2, 0x8c75ad10, 0x8e5eae01, 0x75e6703d, 0xdd0eae48, 0xa53c5df9, 0x1840631e, 0x83761a1d, 0x987790c0, 0xd07e40db, 0x3bcef3d9, 0x18e0ffb5, 0x1b7a060d, 0x76b5ee95, 0x8d79353a, 0x96fe4772, 0x63b08578, 0x2fea8242, 0x0d8bb2d2, 0x9c8021f3, 0x56f37aab, 0x0d4c11db, 0xba21c446, 0x9362d754, 0xf846e21c, 0xd7a3e71b, 0x1281f2f9, 0x7fee0a83, 0xcd52cedf, 0x7063ef45, 0xf502dcf6,
+        0x26289aee, 0x0e381325, 0x073d5265, 0xa5f85baf, 0xc1b51c77, 0xca1cba62, 0xcbcd9e59, 0x3c2117e4, 0x4b26758e, 0xeca55eb4, 0x1d7e3072, 0xb3687dce, 0x6006015a, 0x80c60b4a, 0xd4326173, 0x3705b6c3, 0xd77eab81, 0x50466071, 0xaa4d1137, 0x8bdc0229, 0xf5cbbbdb, 0x201c09ed, 0xf1702c90, 0xba8a1508, 0x1cd9dfb7, 0xd0688061, 0xa5f62a83, 0x86a632a0, 0x7b15f972, 0x6dfada77, 0x11078018, 0x236e1fb2,
+        0xe5d455ce, 0x27992bcb, 0x7f4a7959, 0x32f640c8, 0xc5742431, 0xd1ec81a0, 0x0f73e632, 0x4a511807, 0x43306997, 0xa2d4ba81, 0xa6ac7b78, 0x70093e19, 0x2233dda6, 0x4ffef5fc, 0xa377bbc8, 0x054d2ad8, 0x628ba161, 0x9daa1141, 0xc404cacf, 0xc30cf9c6, 0xa7257b71, 0x6f3fc2c9, 0x61a94477, 0x995c3213, 0x4cce0494, 0x887fe62c, 0x571362c0, 0x57d20078, 0xeb3ec4f2, 0xf4d9da76, 0x74cde6f8, 0x0b19b3eb,
+        0x71477af8, 0x9fe8a7a0, 0x7445859d, 0xcc71eadb, 0xf1fe0077, 0x97a15bde, 0x38182dfe, 0xf9181e5e, 0xe1e52656, 0x7367f459, 0x05168e42, 0x1835dc7d, 0x577de744, 0x23676fd1, 0xc41a5fe9, 0x58c47652, 0x57c1fbbc, 0xf7c9ce43, 0x9e6a18bd, 0xa3302f2f, 0x73f931f9, 0x1ca51556, 0x029a043b, 0x6f6edeae, 0x995d6225, 0x2f7b5fd4, 0x9a00621e, 0xf4112612, 0xa64038d2, 0xcaa5613c, 0x57bc8a16, 0xa4d72f33,
+        0x7e48dc2e, 0x4eaea509, 0xb3a77516, 0x8063f523, 0xe3470810, 0x138c0c63, 0x0e18457a, 0x05083792, 0x192e3fa4, 0x861e114e, 0xa6582a21, 0x28dfd691, 0xc39a2664, 0x0d7c1b77, 0xfceae091, 0x7fa0c43d, 0x20154902, 0xc4105f94, 0x5d4e6051, 0x5d11acb9, 0xad1d6a4c, 0x52aacf7a, 0x6031b019, 0x04abd125, 0xdd0b9d90, 0xf270158a, 0x4abefd1d, 0x256b2d5d, 0x222b6aa4, 0xfb25cf69, 0xac32d2f1, 0xc8d3bb89,
+        0x33dc9bfe, 0xdc0bb1ea, 0xde570316, 0xa2d238cb, 0xc04bd8b5, 0x1dad9a4d, 0x6b5c76e4, 0xca9f3051, 0x000f24b1, 0x0bcc43ec, 0x2643415a, 0x93a8b84d, 0x461a013e, 0xcd3ebd81, 0xdf573ef9, 0xe54311fb, 0x99eb9841, 0x7e4544d2, 0x52396807, 0x661adf80, 0x48c76e58, 0x8a273a56, 0x6f70db42, 0x6a3351b9, 0xe75cc0c1, 0x8253251c, 0xecd3b933, 0xd4837732, 0x815ad883, 0xe91e14e0, 0xa0a93394, 0x9308c845,
+        0xb821ae53, 0x172887f1, 0x061f278c, 0x9b248d27, 0x932ec6c0, 0x2bdf848e, 0x0be9aed6, 0x0a55e055, 0x6c2b044b, 0xf12c42c0, 0x77bd6eba, 0xdbbe1dc5, 0x05caf290, 0xf8ba3f31, 0x10a8b147, 0x21a22492, 0xec886705, 0x26f8cf4e, 0x88bd9639, 0xa042644a, 0x5de65f9e, 0xb50e58f1, 0x5d2b93af, 0x550d9a0b, 0x26c06ca8, 0x819a17cc, 0x264cbfc5, 0x329f1bf6, 0x59ce2a79, 0xb799739f, 0x5601dfd2, 0x0bb0b28a,
+        0xc8b60c90, 0x3705051d, 0x7c9af0e4, 0x1ceaa2c1, 0x76fd00b5, 0x444f13a6, 0x2199c46a, 0x44ff863e, 0xe2ea8d27, 0x575937fb, 0xacafcbb2, 0x12cbca30, 0xd5cd05bc, 0x21fc2ff7, 0xa80f97f3, 0x14118789, 0xfbe1fbb4, 0x2040a3a9, 0xfad3825a, 0x85cd0019, 0x400a0731, 0x23317c07, 0x9fe3dd96, 0xce07008a, 0xba6e1870, 0x7808addc, 0x7f8816ff, 0xdf49ee6e, 0xd98e58de, 0xf08630a5, 0x30e003ea, 0x8622f77f,
+        0x1fc7e327, 0x10f7635a, 0x00b6df8a, 0x02ce05b8, 0x2727e9f8, 0xf66e8957, 0x88bec39d, 0x452ed78a, 0x82b8e24b, 0x5265e465, 0x629d8214, 0x2fde2829, 0x4f833fce, 0x57b97d33, 0x00e9028d, 0x144602d7, 0xd0b3ba8f, 0xc7775ecb, 0xa36f6447, 0xf7e5e4c0, 0x72c65ea2, 0x0cfd35f9, 0x3e7c67ae, 0x858d07be, 0xcdaaa519, 0xf39b5a25, 0xd2efc189, 0x6c0161ab, 0xda292a9c, 0xc8fe3fc8, 0x779dcfbb, 0x04af1258,
+        0xf87fba5f, 0xc06af102, 0xd75bc493, 0x63cfcbbe, 0x141bbc3d, 0xcb9de220, 0x3cd347c3, 0xe0f0d313, 0xd14c534b, 0x29b014c4, 0x67e46411, 0x0ef6fa66, 0x77603cd3, 0xcae8eca8, 0xf397e0b0, 0x4cf59e53, 0xf70a9660, 0xa88438b9, 0xc3e9b582, 0x17682e6f, 0x9314a22b, 0x22019b92, 0xea7a0fec, 0xef2c60f8, 0x7ed4a88a, 0x491095f4, 0x2a7fc98a, 0x125420c3, 0x53749547, 0x98cde7fc, 0x4be33c83, 0xa552a8b8,
+        0x8eeca673, 0x14404186, 0x114628fe, 0x32be98d3, 0x11a88833, 0xccfe44b4, 0x2ab264e5, 0xb41a731b, 0xf28b506e, 0x07c15ec6, 0xcfa37d86, 0x9ec6869a, 0xb5e06c84, 0xf4dd9ef9, 0xf8620348, 0xe3f3e62a, 0xff98e5e8, 0x3d6391c9, 0xfcc9d68d, 0xaa1efee2, 0x266c12fb, 0x81470a74, 0xf55edde5, 0x78485e45, 0x87cc2a05, 0x62a1f98f, 0x12f7558f, 0x0a1d221d, 0x4fd37eaf, 0x4437b531, 0xe529e997, 0x4353d8f4,
+        0xd5b36051, 0x2fe12206, 0x0099ed84, 0xa6a582be, 0xa3e4cacf, 0xfed8055d, 0xcd9d5f9a, 0x65bda44d, 0x3ec0e3ab, 0x06144a74, 0x106a508e, 0x430c5f74, 0x435db02c, 0x8cf982df, 0x1a4be1aa, 0x820f350a, 0x7bd50282, 0x80ead2d5, 0x6b3c030c, 0xdf1dbddb, 0x619c2802, 0x5e69df13, 0xe30309e8, 0x01b21ba7, 0x6ba9a844, 0x22825330, 0x48aa4112, 0x13be5e4f, 0x0c559969, 0xae7a8af7, 0x381b4312, 0x3bbbf581,
+        0x3d3aa3a2, 0x33ee01c5, 0x077d7bf6, 0xa7a48aef, 0xb3caa5f6, 0xcfcae578, 0x01f4674c, 0xd04628df, 0x9c654c2f, 0xb1ffcb2c, 0x68788e40, 0x898a58af, 0x3fbaf837, 0x162ba4cc, 0xa70799b6, 0xc94f8404, 0x51fdadeb, 0x21a81d5a, 0x1a8a41b3, 0x01bb4acb, 0x891ac7e1, 0x568a454e, 0x2a34efa6, 0x5c2df9f5, 0xe22909e2, 0x750a152c, 0xaa9ced31, 0xf77dd29b, 0xd905a6fa, 0x319d1c8c, 0xc33dc177, 0x34eb221a,
+        0xce987461, 0x4b4f6984, 0xa2092bdf, 0xeb617543, 0xb5de907e, 0x2badf9ae, 0xb04c40e4, 0x93aafadb, 0x5229a387, 0xba70e5c8, 0x881a1daf, 0x06c9a629, 0xdf89a3a8, 0x17fe188d, 0x0df64fe7, 0x1e37775d, 0x801a43fe, 0x2dd88e86, 0x6ec991ea, 0x6a7d38b8, 0xe77f0eaa, 0x7f47c2e9, 0xa153b23c, 0xa6e3d9eb, 0xfba8430b, 0x44d4d3b3, 0x95cfb064, 0xfedc072c, 0xd733f46d, 0x7728cd73, 0x78042e0d, 0x7c07b953,
+        0x8b93b0d5, 0x58abfb9e, 0x2dd9c48a, 0x302eeda9, 0xa26c14fd, 0x718cb88f, 0xf6847752, 0xfcd3c59b, 0x88b52010, 0x70cbb07e, 0x7ac7fffb, 0x42317c86, 0xcb2db35b, 0x7453978a, 0x17bc160a, 0xb34d2d82, 0xe17c143e, 0x775ea621, 0x00fddb23, 0x22cd75d5, 0x82f3921c, 0x8f97c34e, 0xadafcae1, 0x877708d3, 0x90d4d667, 0xc7dea4a9, 0x7a7c4407, 0x821282bc, 0x520d2136, 0xbc829a4f, 0x9a012220, 0xc27fc663,
+        0xe9c460c8, 0x65f0dd3d, 0xaeb97cc5, 0xade601dc, 0xf25d1fed, 0x83c0b6cf, 0x195de5a9, 0x9bef4665, 0x82d2caa7, 0x248fc351, 0x1c315efe, 0x9b955e2c, 0x8b964846, 0x571f58aa, 0xb05445cf, 0x70463688, 0x25bd1eb3, 0x3e4c4ccf, 0xc70e3d78, 0xd95cb693, 0x662838b8, 0xdcfa0bf1, 0xe5f6fc44, 0x1b6844dd, 0x4e9a6d7a, 0x27946afe, 0x0fa10c5f, 0x23b9ced3, 0x382f42d1, 0x5e9fce9f, 0x15348a07, 0x9cafbe30,
+        0xf34d1bd9, 0x954cca08, 0x0430de12, 0xe7f26c56, 0x1d5ae918, 0x933b1d9d, 0x032d4c4e, 0xc0ac44c3, 0x375aac9b, 0xddf1552a, 0x02ecea16, 0xf43e9eb6, 0xa4778e05, 0xc80baf10, 0x845984a9, 0x4ceebbd3, 0x3edbd983, 0xbf771a66, 0x31996cf2, 0xc9bad83a, 0x17434b4c, 0x8a83d029, 0x5e523173, 0x3a7718de, 0x01feb745, 0xc2a0faa2, 0x9a4aa223, 0xba4dc3e7, 0x7a963962, 0xc9debd77, 0x4ee0cd09, 0x26be8dfd,
+        0xbe93e944, 0x61fedff2, 0xd6df9825, 0x08a206e1, 0x432ebd0b, 0x1682b03e, 0x83a51b06, 0x3de4db66, 0x725fca1e, 0x55ac5623, 0x57599d11, 0xb9f3fa27, 0xd6d1ff5d, 0x8e41f9fa, 0xfb84a0f9, 0x54446b6b, 0xa05ffa55, 0x01b82694, 0x2e680cb4, 0x8a9d1871, 0x1f7e0b02, 0x8208b08b, 0x9478d451, 0x84db18bf, 0x541aec29, 0x1a4da0de, 0x44a7dca3, 0x9ebb091a, 0x8cdc7857, 0x5eb3fe60, 0x2e365af7, 0xab811bae,
+        0xadb1a4a2, 0x2de91ac5, 0x0e4199de, 0xa3554fec, 0x08b7f8b9, 0xec534517, 0x49594616, 0x076ebc5c, 0x13cfd584, 0x4856aa52, 0xe68be7c2, 0xb2a686e8, 0xd8bb2ade, 0xba17489b, 0x654c7eb7, 0xf68a04ca, 0x2b51b10a, 0x741591eb, 0x6e321f71, 0x8200f10f, 0x6a8d459a, 0xaf4f4ca8, 0xba903e51, 0xf8d331b2, 0x680ea8a4, 0xacfd9c9a, 0xf3a9a744, 0x61097ac4, 0xe977d9a1, 0x7a2b2caa, 0xf38fe372, 0xf2e116b8,
+        0x589388e5, 0x52d6b536, 0x4a4d71dd, 0x44a152a6, 0xe2fed22c, 0xcddfb251, 0x35c4940c, 0x581379e6, 0x21812018, 0xe38b7238, 0x85408766, 0xc8e1e34b, 0xe7cc6837, 0x0eb8641e, 0x670c38bb, 0xac52a894, 0x373c213d, 0x0e9980de, 0x1428455f, 0x8b95fcd3, 0xeedd02c2, 0xbbeeab78, 0x9a55ca7e, 0x308411af, 0x60a353a3, 0xd3a2daa1, 0xaa38f265, 0x504a18fc, 0xcaccfb3d, 0x6ffa69f4, 0x555fbd68, 0xfa5c5b43,
+        0xb1521775, 0x0cc90f1f, 0x342d43ba, 0x1eb457c3, 0xf56e410e, 0xa49f033e, 0xb63aa6f2, 0x03eea534, 0x2aba63e4, 0x9549bc1c, 0x7159d842, 0x2fcd3f0b, 0xa20bddd3, 0x958e9624, 0xee12540d, 0xe2bcbc57, 0x87823c07, 0x12975c23, 0xa060a0a9, 0xd519117a, 0xae4a2619, 0xfcea9efe, 0xec56ac44, 0x0db2a333, 0x2720237e, 0x557dfde1, 0x67dd5167, 0x227d0d13, 0x4ffe6d4d, 0x9e847000, 0xb1a35cbb, 0xa76bb2d4,
+        0xe4041ec1, 0xb9863ff6, 0x7d9c9cda, 0x4a619ef4, 0xce4a731a, 0x9a58d00c, 0x53918013, 0xbd12ff22, 0x8cc4e120, 0x888a14ae, 0x63875ec3, 0x1c6abb3c, 0xe59695ed, 0xc26ff2f4, 0xad1634bb, 0x20b1b321, 0xd411d285, 0x497ee776, 0x1c2ec869, 0x0558abc8, 0x477b714c, 0x708d4c48, 0xc483cdcf, 0x172dff06, 0x374f7c2b, 0x7185c042, 0x08b84ba4, 0x743d4d48, 0x6fc1dd6f, 0xde7ac1cc, 0xefd64cc8, 0xa81d46da,
+        0x43184335, 0x1f400f17, 0x91dad748, 0x86ed2b17, 0x5c0bab09, 0xc862ee3d, 0x06dee579, 0xcd4c8773, 0x801b78e0, 0x084d1b6f, 0xd3b73fb5, 0xeae282f5, 0x424cac08, 0x1305f016, 0x0bbf1eb9, 0x5712113a, 0x3f18c34f, 0xb7f27c29, 0xa925bdf3, 0x44c818ea, 0x5454319b, 0x52a9a0a4, 0xa8d4befd, 0xf9166ce9, 0x03543d13, 0x0386e39b, 0xb7d34b82, 0x45e74761, 0x64205cde, 0x57c0e1b9, 0x0893cce8, 0xd3f49e01,
+        0x67f0a015, 0xdb4d1a83, 0xb75feffd, 0x8f7d26df, 0xebdcb41a, 0x50d0cc24, 0xfbe874aa, 0x60379db3, 0xfbc1786f, 0x37d793f6, 0xe57450f7, 0x64a5350c, 0xdd9eb9bb, 0xeaa316f0, 0xcd0bc731, 0xe85e91d1, 0x8e13180e, 0x88e2a3f1, 0x6b3b347b, 0xf64fb6cf, 0x208b19d9, 0x032fab68, 0xa7953990, 0xd6a0eb4a, 0xdd2ccde6, 0x91849bd4, 0x464c154a, 0x0a5c4b25, 0xd714fbdb, 0xd2ed971f, 0x121d0410, 0x21423b9d,
+        0x60f88476, 0xb3005c39, 0x44a6c08c, 0x20c2dbdc, 0x2725d7ac, 0x2df857a6, 0xa1893025, 0xfc757334, 0x50fdf0aa, 0x083422bb, 0xf5885abe, 0xbe9341ba, 0x7fa9193b, 0xd9484a62, 0xbd157280, 0xff0fdeee, 0x0343f487, 0xe5d8e8a6, 0x9af86d3b, 0x99a909bb, 0x93925044, 0xab1fe279, 0xceb060c8, 0xfa1a59cb, 0xa7abfcac, 0x212cb8a8, 0xe0d39367, 0xdc343f37, 0xe701e96a, 0xdc8f373f, 0x26f8bb9f, 0x26487466,
+        0x314cedb7, 0xb58f1754, 0xca7d6152, 0x76c7c142, 0x0f8a5ebb, 0x2abcd52e, 0x63cbb711, 0x156ec6c4, 0x4cca8ff5, 0x6fc1af73, 0xbbf336f2, 0x00fdb862, 0x1aad7536, 0x46a02f97, 0xcae63a32, 0x35403004, 0xc860ec92, 0x560414e9, 0x884b370d, 0xc6b90efc, 0x40dbb2ed, 0xb3e5f712, 0x122a1465, 0x3102ac99, 0xa034a5ba, 0x48dc1b61, 0x0651864e, 0xd82b85dc, 0x0fe2045b, 0x62537585, 0x212e4030, 0xc870d633,
+        0x735b718e, 0xfcbc3f35, 0xac1e33aa, 0x6c9bb854, 0xdb2a1459, 0xfc518768, 0x7f9a1e85, 0x601d5151, 0x0c7d2425, 0x4b181059, 0x50575156, 0x50a422d4, 0xa441f0b6, 0x8ba1a03e, 0xc950a294, 0xa2afbe38, 0x4a05c45f, 0x3e8329b9, 0x7f744729, 0x3d00edb7, 0xd184ee4a, 0xac485908, 0x985a53e0, 0x4ab2e11e, 0x89531f81, 0x409608c2, 0x54b41a2b, 0x30b31b49, 0x696487d4, 0xcea949b9, 0xcb43fe38, 0xa4928645,
+        0x57dc7e61, 0x9672bf1d, 0x766d6533, 0x0f1c8af6, 0x5e29b102, 0xff2795cf, 0xadf8571c, 0x942e8fa2, 0x9159f769, 0xa9e9c0c8, 0xa6dad8ee, 0x735d9aca, 0x7db9a162, 0x7cc87d06, 0x66015bc3, 0xfe250d33, 0x7a3c67bb, 0xb005b0d2, 0x110be2ff, 0x772a093c, 0x693929ae, 0xb16c6dfa, 0xf8166919, 0xe3074d78, 0xc7dd554d, 0xf7c9be73, 0xbaa0ea98, 0xb0bd4c47, 0xc401add9, 0x1f5b1694, 0xc1af4784, 0x8afa46d4,
+        0xd7e09052, 0x0b2c241f, 0xc528ffd1, 0x9aab04a3, 0xfa8985d6, 0x56335b20, 0x1c820d62, 0x5ef4f585, 0x65654c62, 0x298dfdc4, 0x7df7afc7, 0x9808bad1, 0x42127d33, 0x4674ab91, 0x09769e4b, 0x3c9ea4c6, 0xf9710df6, 0x621a8e9a, 0xb9f70d96, 0x76ea4a66, 0x25e105f2, 0x5bb86037, 0x25dc6af7, 0x7956dc02, 0xb46f5a24, 0x38c46163, 0x6188ca82, 0xf5a73cd4, 0x138fb349, 0x6ddc8997, 0x692cd53b, 0x699ee1a9,
+        0x249b0771, 0x4b992e2e, 0xcc860766, 0x6e5ce7da, 0xee24be47, 0xeebc5be1, 0x01354bb8, 0x9914ac11, 0xa6690f2e, 0xf2445c95, 0xadb44daf, 0x4bf56e56, 0x40ed6d29, 0x980753ed, 0xd7dab44d, 0x6b2294b7, 0x4b40e1cc, 0xccf730fc, 0x06e05278, 0xbbf29019, 0x17e2fa61, 0x68fe8ae1, 0xcc423086, 0x2fbaa806, 0xb61e7b92, 0x2f41f4e6, 0xc88d58da, 0xa089481a, 0x9fb964f3, 0xba6c0245, 0xd34e6d69, 0xb508d15a,
+        0x08f73d7c, 0xcca044fb, 0x67cd3534, 0x8ac4cee8, 0x3fea4ab1, 0x16349b7e, 0x7b1c0e2c, 0x7cd23ceb, 0xe17eac55, 0x6bd061f4, 0x47daf5cc, 0x807171a7, 0x99616745, 0x58fd82bb, 0x06b6c198, 0xbe55b3de, 0x27bb1980, 0x600d7221, 0xd57b2ed3, 0x6c0b895a, 0x31e48805, 0xf45d6dd5, 0xd46cfd1f, 0xcb12a4bb, 0x568c12f1, 0x790d017c, 0xabce4b43, 0x8051c34d, 0x0d67e115, 0x5e4a799e, 0xbbfbadc8, 0x8a3e8a23,
+        0x7fde09ad, 0x657e90a0, 0xf17c1ad5, 0x6db0731f, 0x4a2e8676, 0x5ca71618, 0x60664399, 0xf737c636, 0x1d1f1257, 0x304871c9, 0xf70074b9, 0xc9f006d7, 0x6eb913ec, 0xe28d69bc, 0x15a5ef00, 0xb5af44cc, 0xb7781af1, 0xcf362e15, 0x81bcd141, 0xa905db94, 0x53fd8eea, 0x370e199e, 0xc0e6f546, 0x35f781c6, 0xd6047a56, 0x5f7ece5d, 0x40f38e1e, 0x5beaec10, 0x88d013f4, 0x8a3ab96f, 0x6f66fd08, 0xdf7f8bf6,
+        0x285f4c93, 0x21a628c9, 0x99b922c1, 0xdd10edb3, 0xeffcc5f7, 0x1f989b37, 0x1b9610e9, 0x9d9eba8a, 0xe6652ee6, 0x695766b4, 0x8ceb4607, 0x760c45d9, 0x6d673f6f, 0x8cfe7aa4, 0x27026e0d, 0xd790345a, 0x3f5f2cca, 0x08682b36, 0x7286c2f8, 0x11aa316d, 0x88647eda, 0x86121f20, 0x5aca6ab8, 0x7a69d3ce, 0xc5eada3b, 0x961ab7b4, 0xe1b5daf0, 0xc29867b4, 0xbbed7594, 0xeddb6b28, 0x680bf0f5, 0x52dc8ba1,
+        0x9aab7543, 0x8a64bbce, 0xa41f75fb, 0x717197fe, 0x20a1aaae, 0x2015c59c, 0x7f06705a, 0x7b5b8fbc, 0x4f7aeb61, 0x82808e88, 0x941d74dc, 0x057c8ef5, 0xf1905ae7, 0xa65c75d2, 0x6d4bea06, 0x59abffdd, 0x087b1b12, 0x1b24d9be, 0xedef60f0, 0x8970f331, 0xeccba314, 0x36d7b9b1, 0x5bba008e, 0xab5489e9, 0x428ea59f, 0x7f5e1f4d, 0xc96fa225, 0xe3467485, 0x82f70ddc, 0x644346a4, 0x9001c78d, 0x775f7b63,
+        0xaf4ea4f2, 0x2c026f66, 0x17a74dbb, 0x1a3d9c49, 0xdf6155cc, 0x74e5209d, 0xf164606f, 0xeda02500, 0x18ba664e, 0xf97f9e38, 0xd88bc197, 0x017a04fb, 0xe8ce26bf, 0x47759f9c, 0x02e740da, 0x1e6d988b, 0x861011d0, 0xb08a685d, 0xa67d0737, 0x0bc963b2, 0x6298e2aa, 0xebe85038, 0xa638a8b7, 0xdd29802a, 0xc34a5d83, 0xd968b13f, 0x9360280c, 0x767391fe, 0xa1c57406, 0x6b7b4bca, 0x473860aa, 0x527da3e1,
+        0xd6ff851a, 0x8f518bef, 0x6d450e59, 0x0eb0fa1f, 0xa1b2011f, 0x9377e49a, 0xd55e179d, 0x9f6b96c0, 0x452adfe2, 0x10a21138, 0x669ae089, 0x3094cbf3, 0x8de3a10a, 0x20987af0, 0x71a128f6, 0xbb634523, 0x172369e0, 0x81864331, 0xbe8fc617, 0x312f5946, 0x08597c63, 0x80cd7193, 0x6e039b61, 0xcdf51e11, 0x098a0559, 0x7db900f8, 0xf9cde1b8, 0x66672c63, 0x85b8117c, 0xb27eb429, 0xe8dd82b7, 0x0c4f72e3,
+        0x621c8933, 0x43529fa7, 0xe26b7637, 0xc30a6992, 0x4148d59e, 0x1fd9ec4b, 0xe8b77d81, 0x6ca05cb2, 0xe501e9c2, 0x7403cda4, 0x6605386f, 0xeacb5e25, 0xa0014f84, 0x99da23ac, 0x914e0e51, 0x2bbb79c5, 0xe4febb1c, 0xeef4dd06, 0x36d391ef, 0x9c45f2ed, 0x00fce9f8, 0x88c6608f, 0xe16dc971, 0x04c2c0e4, 0x3c30ee76, 0xa8a5fc1c, 0x3eaf72ae, 0x476cbafa, 0xa4132387, 0x4afee603, 0x4df550f8, 0xfcf950cb,
+        0xd35be2bc, 0x8face50f, 0xe2396c7d, 0x0ae72ed6, 0xf203f65e, 0x88900784, 0x640b29df, 0x6f044bdd, 0xcd234fdd, 0x7c85898f, 0x2838938b, 0x8d0ac2f8, 0xa00ad6e4, 0x2e159b82, 0xb2f0b420, 0xf3e2cb82, 0x15fb81ac, 0x1bf51a6f, 0x87fb6269, 0x6b6fd2ff, 0xe3791874, 0xc7504530, 0x437f9d84, 0x91ee357c, 0x3c1ae76e, 0xc60cdbfe, 0xd6f3c6a3, 0x6767acf3, 0x7edbb606, 0xec411052, 0x27017b64, 0x8607beeb,
+        0x3b139f3f, 0x9147b859, 0xa86fabb0, 0x3f9eda61, 0x901d6285, 0xb6191e36, 0x4ab549d4, 0x21e0cc16, 0x9f4f6139, 0x2be9f52d, 0xb74593a0, 0x5d298ea4, 0x47ddfd3c, 0x92c61309, 0x698abbc9, 0xa7e52bd2, 0x5cb98379, 0xec4de414, 0xc8094eab, 0xded97110, 0x22af4929, 0x9ef63224, 0xe6ee071f, 0xbdace80b, 0x4a259739, 0x64b45780, 0x7fe3073a, 0xd8cb2007, 0xc8996135, 0x9579f7c0, 0xad53f07e, 0xc5302a75,
+        0x265a0fcb, 0x07e82708, 0xb255a76e, 0xd5b94759, 0x2106ffa9, 0x87c1cbea, 0xf229893a, 0x81c8ee36, 0xe2ebe30f, 0x7a47a961, 0x83d757a6, 0x0ed7c4c4, 0xadedbb56, 0x43245962, 0xfa0f2133, 0x36c3891f, 0x201e2b83, 0x05b518f1, 0xc093002d, 0x3df8f240, 0xd3b9ac8e, 0x39ab1dc4, 0xc80bd16b, 0x1174e9f2, 0x30ddafb4, 0xd8cc787a, 0x6dbb7046, 0xdcdc87d7, 0x03b36ff4, 0xc0917074, 0x5345e8f6, 0x3f50d6c1,
+        0x227bd503, 0x3d3dada0, 0x73551cdd, 0x2f6c1e37, 0x92809c15, 0xeb8059f4, 0xcac209b4, 0x6e4e81ce, 0x6b73dbd3, 0x2651330e, 0x885450b9, 0x0ef43d92, 0xecfaf686, 0x4c30ee7e, 0xe62a3a27, 0x8c3df325, 0x8b7a3390, 0xe188c5a8, 0xe6b00f2d, 0x3cfe1677, 0x0d4483eb, 0x1e6a8baa, 0xcf00931e, 0xe98de70d, 0x55bc4e64, 0xbda9929b, 0x3a8afa0d, 0x6dd7d80d, 0xd288eccf, 0x2013ea05, 0x5925e6db, 0x00e79ed8,
+        0x2a5c47f7, 0x5c731ee9, 0x0733c2fe, 0x941f3eef, 0xf4931cfe, 0x4ba26844, 0xae278820, 0xb4628bf0, 0xdc4dcc66, 0xd75a2da5, 0xf0686ed8, 0x02985300, 0xae21310f, 0x81ed8110, 0xeadc4875, 0x213e61fa, 0x41b68b8f, 0xdd68966f, 0xe2b7dea2, 0xe0eff6aa, 0xeb87ec85, 0xf3d351bb, 0x4cd0f52d, 0x2d7664a2, 0x12c9bfce, 0x1efa8262, 0xc4743e52, 0xad2a1c96, 0x15bf6da1, 0x66e75b8f, 0xba904870, 0x02ccef89,
+        0x72a8e55d, 0x5b6915aa, 0xa6b83b75, 0xf0a4bf4b, 0x2b647965, 0xf73752a1, 0x880d0eaf, 0xb8fcbd66, 0xa240c5ea, 0x30f55505, 0x039bcbb9, 0xa7c0657a, 0x786a416e, 0xee5814df, 0xe2e64258, 0x1e198140, 0x1d30f7b2, 0x90692c58, 0x714a6060, 0xebc608ef, 0xa8d8216e, 0x0e65db05, 0x4b763dc6, 0x585b1ba5, 0xf34b57fa, 0x9d442eac, 0xb1bcbe51, 0xbada5be3, 0x34f145cf, 0x313bc035, 0x8e04e751, 0xf84bf345,
+        0xe118651d, 0x7870e9cf, 0x8ecfc2ed, 0xcbb57764, 0xc098f70d, 0x40233e96, 0xe51837e7, 0x1e526307, 0xd783198e, 0x3d228b81, 0x217fd2d5, 0xa36b4f9e, 0x306c646d, 0x3e6eabfe, 0x2754f0ad, 0x085f3bb7, 0x0766203f, 0x968c2e33, 0x02536349, 0x6f474f80, 0x98b10fb2, 0xab4c0b6b, 0x9beaa81b, 0x8f08e846, 0xeb3e90e3, 0x401b728b, 0xbbcb88e0, 0x1bc070a2, 0x4d17f768, 0xb4817ace, 0x7eddf809, 0xa157ed3d,
+        0x4216f8d1, 0x77b23aeb, 0xbb9c57f3, 0xaca53a5a, 0x1de40842, 0xb9700a1d, 0xbefc947f, 0x9d2f56b6, 0xcf4e56c2, 0x1d0343bd, 0xbec7a279, 0x85744854, 0x564f0633, 0xa174c088, 0x9596526c, 0x49ade57f, 0x780d3edf, 0x1168b129, 0x16570056, 0xa8b8f410, 0xd426d352, 0x17dcc951, 0xaf9a1284, 0x4cdf6c3e, 0x446f6a37, 0x884d22cf, 0xf830132c, 0x5f790338, 0x2f0bd360, 0xf262cb02, 0x4cc8edb2, 0x363e3eb3,
+        0x694369a6, 0xd0f1a9d7, 0x3c8a8e28, 0x64259816, 0x31ef2546, 0x3e9b9fba, 0xb493bc8e, 0x4ad78a65, 0x2e386915, 0x66c1f5a4, 0x85b79c21, 0x80c9f880, 0x4bd1eaa2, 0x3814a889, 0x7678dfa7, 0x9ae628de, 0xecdc0802, 0xd6b14458, 0x374482c3, 0x2dc88aac, 0x00421e29, 0x618bc9f3, 0xe81758c1, 0x244a42c4, 0xae173a93, 0xe30dd406, 0x83d3e1aa, 0x57d9c05c, 0x85a64e66, 0x155365f6, 0x1a58df2a, 0xdf416f65,
+        0xff338f57, 0x3651128d, 0x5be5617b, 0x5bfa5576, 0xa00fe635, 0x0e9dcf27, 0x64b3ab0b, 0xc0080c40, 0x01f62a9d, 0x06a72753, 0x8b97cb1a, 0xf55ae965, 0x82550eac, 0xc26b4cf4, 0x3f2ce74a, 0x00fb1511, 0x0b9f064c, 0xa084768c, 0xd77b99a9, 0xee8d3e2a, 0x0c5a1b40, 0x513502f5, 0x50fa615d, 0x7e7003a3, 0xc88e2d1d, 0x064d1b1f, 0xf8ef35da, 0xb8bd86e3, 0x96228292, 0x786c319b, 0xc72de1bf, 0xbc25e4c2,
+        0xba4a6122, 0x9055262c, 0xa6a7120e, 0xde48deb6, 0xaa2435bf, 0xffcb5174, 0xf053df64, 0xeb0a1caa, 0x88fb15e3, 0xc7ae64f7, 0x66002be9, 0x6fe2d592, 0xaba31d1a, 0x0a729207, 0x70c6dde2, 0xe852cdf9, 0x220406d0, 0xfa7f8bf6, 0x706fa83c, 0x2d864fdc, 0x8c325090, 0x9fa4d180, 0x6527a854, 0x9dba6189, 0x65f5275e, 0x3b2f5ac8, 0xc0586298, 0xe3d5cdac, 0x85b8c099, 0xaade9593, 0x7d8d04e2, 0x834809ea,
+        0x16b3a9a3, 0x1da1eb86, 0x4037d002, 0x42412e7c, 0x72933a7d, 0x2ef5994f, 0xa35167d7, 0x0661f61d, 0xb59e34e2, 0x2a7c2d0f, 0xfe1c54f1, 0x91cdb91a, 0xeea452aa, 0x845f9d24, 0x179c5a26, 0x75bbb502, 0xf41b3209, 0xb5d9a11e, 0x29acf9f1, 0x746a60d6, 0xf86fbe89, 0xf08df7df, 0x98d56dc7, 0x368e659d, 0x3d7f865b, 0x21fd38ce, 0x11fedd15, 0xdce9764f, 0x4ccf8050, 0x32c2daab, 0xd0447932, 0xe3bdb9e6,
+        0x13a34237, 0x07c83ec6, 0x5abebfa7, 0x81c7e20a, 0x21cb76ed, 0xa26c5e0b, 0x287e75c0, 0x99718ee3, 0x0fe8de8d, 0x11ea54a3, 0xb3ac03ae, 0x2606f57c, 0x1623aa16, 0xe545671a, 0x9de5c4b6, 0xf41458d8, 0x2c7c4b7f, 0x1763f89a, 0xa6c23853, 0xed0d99d8, 0x7faa9158, 0x92a4482e, 0x48d5b14d, 0x36109910, 0xd49f903b, 0x19f082b3, 0xd1800887, 0x1cfea9d9, 0xf02bdeb5, 0xd9d53c58, 0x00155efc, 0xe8ede37f,
+        0xa3f08c5f, 0xc41a3950, 0x01e21003, 0x5f50c0f8, 0x1b3e69fd, 0x26ca8dee, 0x1b56e0ea, 0x829ab0a4, 0x5dfadbbf, 0xcb5b60af, 0x3d56ee2a, 0x2f1e12c6, 0x589ca4e8, 0x70f89fe6, 0x3fe715eb, 0x2bd0a866, 0x6316a59f, 0xd592ffd9, 0x6bc92bab, 0x7afc6867, 0xa3dc1af6, 0x7e55e4c1, 0xc99d1242, 0xb5baca78, 0x451e5ad2, 0x1c6cd106, 0xd80f3a5b, 0xedbfd0ab, 0xbd8f55e8, 0xa63342ea, 0xd37b6ad6, 0xadfabd04,
+        0x2ea426ab, 0x807af6b7, 0x10c06cf2, 0xc748e485, 0x9c3fea2f, 0x770a7ba9, 0xb398f708, 0x2206a0d8, 0x1c92fa6d, 0xcf6f4f8a, 0x1887e760, 0xa91e27b6, 0x990ba246, 0xa47f16b6, 0xcfee79ef, 0x91c1b592, 0xd08831ee, 0xcc2bcf94, 0x16e5575f, 0x42c14f68, 0xbb3514df, 0x5d151880, 0xe7632519, 0x19411674, 0x73c57667, 0x026ae626, 0x1218966b, 0x5186259f, 0x3dc467a0, 0xca087d04, 0xbb5b8226, 0x88390e62,
+        0x0a5da89b, 0xa8258fe5, 0x6cad861d, 0xb7036097, 0x8a4b892b, 0x9d3d98c0, 0xf42e0fbe, 0x4e27ea1d, 0x357ad8db, 0x0e546631, 0x1dc7f0a8, 0xa6124a21, 0xa56eada9, 0x4cf29382, 0x1bc0d449, 0x293403af, 0xfbc6745f, 0xa9d07b33, 0x3f93799b, 0x9a42302f, 0x9b3a20ff, 0x1dae2e3d, 0xd112f0e6, 0xfb20516e, 0xd47e6ed3, 0x886dbcf2, 0x7d31ae86, 0x1aaf243c, 0xc2bf1641, 0x295cb3ea, 0xea448369, 0xf5109fcd,
+        0xe6a64b70, 0x9d5d13ee, 0x36d844f5, 0xdabd43a7, 0x8c0c3251, 0xb8b84a9c, 0xc8e2b867, 0xade5f2d1, 0x31c6e43c, 0xe67e8b4e, 0xbf3420a5, 0x0c88127b, 0x79be2f06, 0x6a8e43da, 0x95506f3d, 0x9bdff257, 0x42b34771, 0x94b6a84c, 0x15b6eca1, 0xd0a551c1, 0x4c526f22, 0xed96b489, 0xeac8fd46, 0xd49f0541, 0x7873e157, 0xd022f7f1, 0x44fbd35a, 0xc3cdd5c2, 0xc3520871, 0xf254af85, 0xc5ad122f, 0x95278f79,
+        0x0573e46a, 0x27beb386, 0xe146c673, 0x6daafd95, 0xcc54e184, 0xac18e934, 0x52fc7e2b, 0xd090bcb3, 0xab467ea5, 0x884b2741, 0x4bd9ea2f, 0x28c97b5d, 0xee11565b, 0x73854f3a, 0x482e8f17, 0xf5ca0edb, 0x2b3bb7c1, 0x0efbdda0, 0xbec33d0d, 0x930b42ea, 0x7a257a03, 0x9c30b2ce, 0xa748242b, 0xae2d1743, 0xf771853d, 0xac898f68, 0x502291cd, 0x457f278c, 0x13918945, 0x5b6a2ed2, 0xca9a2ec2, 0xee24b123,
+        0x5d89cdee, 0x8c45a14a, 0x95c912c5, 0xad0fd07f, 0x2eef2785, 0x29b61252, 0x13b0f5b6, 0xab1db60a, 0x2756716c, 0x66e5e99f, 0xd3ae2513, 0xbd0e2a4f, 0x4d0b8040, 0x38f74c42, 0x62464100, 0x10209d98, 0xa6977ba6, 0x321afd51, 0xd13f31c2, 0xabb63604, 0xc42a05fc, 0x01c9ec77, 0x5fc9f83a, 0x36389094, 0x309ad3c1, 0x67316e00, 0xa581239c, 0xbbc1a07f, 0x00ec46e7, 0xc79bfd0d, 0x486b5773, 0xef48c160,
+        0xa37b5411, 0xed4c59d4, 0x97923313, 0xe1865b9d, 0x5346273a, 0xfeeff3ef, 0xfd2be8db, 0x0aaf5009, 0x1f8c6260, 0x4baab2f7, 0xbc626f3e, 0x3294811a, 0x28180d81, 0x9af03c32, 0x6f450d96, 0x0ae18bda, 0xd50de433, 0xe08d6d55, 0x5c23086b, 0x9fbab761, 0x1384563a, 0x876abd17, 0x8e92ac31, 0x6a1bfa77, 0x46204a91, 0x535d6f64, 0x21ce55f3, 0x0759e239, 0xb31c9482, 0x36788d7e, 0x7c64438b, 0xb60a39d4,
+        0x2ec67e1c, 0x0d8a6cd9, 0x19e9322c, 0x5b3c0ab9, 0x339b07c2, 0x673c6e90, 0x227eb6f0, 0x6b16cc8a, 0x52e3d89a, 0x99c25c00, 0xf356eb8b, 0xb7968cb5, 0x8839b556, 0xd860927c, 0x3f6854a7, 0x3ed92944, 0x6ff15620, 0x358f4a2d, 0xab49564a, 0x16efee69, 0x8c35c921, 0xf59dddc2, 0x9beafedc, 0x7493b4d0, 0xdcf66642, 0x7a9608b1, 0x61754a3c, 0x71a2b158, 0xbfbb8e2f, 0x150a110f, 0x281d4816, 0x273159e5,
+        0x0ee133d4, 0xc7d20ca1, 0x56f70914, 0xa28410ab, 0xd1327920, 0xd39bbf3f, 0x60a6f6ce, 0x72aeaa1a, 0xf8fca30b, 0x3d04bd07, 0x9af628be, 0xf40dd84a, 0x5696a53b, 0xaadc6ee3, 0xed905749, 0xd3b38686, 0xe5ff292f, 0x3f8adccb, 0xd9c7e601, 0x5a14c5f4, 0x41bd1d7c, 0xad7a1a29, 0x49163bbf, 0x7bdf847f, 0xc7aa99d7, 0x4744c279, 0xb38ea33f, 0xf70ab602, 0x7e154065, 0x9fa156dd, 0xf7b912ce, 0xa8e5e763,
+        0x79e5b831, 0xee1dfa7a, 0xfeb220df, 0x163caefa, 0x7d968f97, 0x079fc06c, 0x80e25278, 0x07faee0f, 0xc4ce4c91, 0xc0fe2a57, 0x63598132, 0x74a2ee68, 0x7408cc8e, 0x0291f5e7, 0x2202b7a6, 0xc2cc1fcf, 0xc22d7882, 0x0cfd84cb, 0x90b35e38, 0x131eca3a, 0xa60d0c4e, 0xa17902a3, 0xcc4d888b, 0x0b6a85ac, 0x386f4bc9, 0x4d19c7b2, 0xdb9ebadf, 0x2a128edd, 0xe79c507e, 0xfb85c7bd, 0x4ac1d0b2, 0x80548a95,
+        0xb9d299ac, 0xc3349235, 0x56e5eb94, 0xa4503710, 0x45ce6fd2, 0xbc92d6c1, 0x2b971d93, 0x979079f3, 0xa9fd193c, 0x9e76de55, 0x892d9316, 0x06a1bc93, 0xd44083c8, 0x60751ef5, 0x4471d775, 0x048a4efb, 0x2d188b85, 0xa635cefd, 0x6e623acc, 0x71997a9f, 0x79c48746, 0x7c2d6f53, 0xc9043cdd, 0x3cc426b4, 0x21726200, 0x8e94fdb0, 0x0d25a635, 0xc2979624, 0xa0a443a5, 0xa4f5e2b8, 0x0772483e, 0x1f5b0a02,
+        0x22dda67d, 0x12882068, 0xb1ce654b, 0x6d010c44, 0x84038947, 0x0c02aa6e, 0x8ae6ae79, 0xb5177f6a, 0xcef8c662, 0xb30ae578, 0xcb2f01fb, 0xa67af80d, 0x807a5c9f, 0x2e232072, 0x46d15bc6, 0x4c8d8a8e, 0x1ea25c82, 0x841ea1b6, 0xe2f81226, 0x04ace8fa, 0xf864dbf8, 0xe3f69516, 0xf1496796, 0x4b735c6b, 0xa35c5d89, 0x1e629a0e, 0x1730ea88, 0x62dbd2ed, 0x1320122f, 0x71e3bc8d, 0x2eb51ad4, 0x20db1521,
+        0x081caeae, 0xffe11105, 0xb9956d09, 0x35eb865a, 0x24e79765, 0xf133adff, 0xa2cc1996, 0x7fd8ce5c, 0xca33730d, 0xcb038705, 0x90f5f71a, 0x2058c816, 0x609e32fc, 0x613f8a96, 0xd25377ba, 0xc7c1f89f, 0x4e0cab9c, 0x3f432627, 0x51c26f64, 0x8924ae56, 0xc8f47125, 0x8c0efcd7, 0x80f4df14, 0x17b76be5, 0x42d0ae95, 0x6023ef4c, 0xbb838411, 0xaafbdce2, 0x29b716d3, 0x151d2f07, 0xebcb95e4, 0xa0ae0784,
+        0x38e3a31b, 0x44686594, 0x15676183, 0x155c88d7, 0x12de1aec, 0x17e54c3e, 0xc501567e, 0x11edbecf, 0xd1534806, 0xc2bde5fe, 0xbd8c8721, 0x19396dd2, 0xc21c97a4, 0x7949c02b, 0xf610dfc6, 0x653baaaa, 0x7767a05d, 0xb20b9606, 0xc9789a0c, 0x903e4b6b, 0x6c2d6c1d, 0x1dd0e0be, 0xf1984957, 0xddaf3378, 0x005623e6, 0x82fccc87, 0xfb345fb1, 0x0ebfb966, 0x91f83ee7, 0xab12f9c9, 0x58b24b49, 0xa1b0e00e,
+        0x8eb88537, 0x243052f6, 0x4cbeb0af, 0xa8aecd22, 0x28b8ff0f, 0xd37191f2, 0xaa4e3c68, 0x3a3ff13d, 0xaf27e9f8, 0x0ffb3648, 0xcadb570a, 0x42a4185a, 0x593f7372, 0xf2af61fc, 0x4004e5cf, 0x8a7571be, 0x58522445, 0x86c57ac9, 0x542143fc, 0xf60e5cc8, 0xed6fb11b, 0xfa473715, 0xc18df690, 0x165dda36, 0x49ca01dd, 0x8005a2c8, 0x9b2e9aaf, 0xbc6997ce, 0xc41a801d, 0xd9652964, 0xd89d70ad, 0x30c0d92b,
+        0xe6e83d44, 0x45d1506c, 0x98804366, 0xe6c1ffc9, 0x118b95bf, 0x9dc26ef2, 0x37d1b0dc, 0x63f4989a, 0xde918e16, 0x70259288, 0x6a0a2e66, 0x47ecda88, 0xa94500c6, 0x1d4addc6, 0xc8927677, 0x30c36023, 0x3f75750c, 0xbf0298ac, 0x8deed0d5, 0x9d9808e4, 0x3ac61bd8, 0x1df8f294, 0x01c508e8, 0x796beb70, 0xc4427ad3, 0x17955069, 0x0596dd34, 0x2509cf6a, 0x64a26d37, 0xdc9d19b2, 0x40a678be, 0xef3aeebb,
+        0x34478f7b, 0x356c1cc9, 0xa98b25bc, 0x640fa6e0, 0xea2c8963, 0xb0077103, 0x01c45d92, 0x46891606, 0xbf159741, 0x143faaff, 0xccb739ba, 0x243363a3, 0xe86582f8, 0x59f27aa2, 0xf97dad73, 0x601c571a, 0x1eaf5fb4, 0x732da2b7, 0x84db33d8, 0x8be7fda2, 0xd26cf0e5, 0xb2b12e49, 0xa313ed0d, 0xbb4210fa, 0xf433787f, 0x80ca6f97, 0xf269c459, 0x65d56e97, 0xf77370ec, 0xe6be54f7, 0x113d77e9, 0xf88064d1,
+        0x700247a8, 0xed0f0a92, 0x52229116, 0x2cf93561, 0x22513c51, 0xb654bb3f, 0x22742c2a, 0x15f91947, 0xce5295f9, 0xdada2907, 0x8656f36e, 0x4d7c0d27, 0xf1bad334, 0x3d56a6c1, 0xfd03dae7, 0x93ea65e5, 0x68eed324, 0x8a1cf060, 0x5f062b27, 0x87fd2610, 0x3a131c0d, 0xe01f0b5b, 0x722f15b9, 0xe9373bb1, 0x44271699, 0x7ec2ac5e, 0x75875759, 0xee6a0587, 0x6ed2e231, 0x94462a84, 0x4276ae63, 0x7c7292d7,
+        0x223b1d3f, 0x8377a13b, 0x6b528daf, 0xdb367cce, 0x81c19c44, 0x3b5d4bdf, 0x5306ef13, 0xe81f17c2, 0xaf47c3ee, 0x2debb38f, 0x716e938e, 0x576f5176, 0x6f879d96, 0xbfd087dc, 0xcb0396de, 0x825eeab9, 0xd0c84d52, 0xfeb3b413, 0xc08a7472, 0x94b8c48b, 0xca0cad7a, 0x413050fb, 0x8053105a, 0xac6008cb, 0x8e206706, 0x4a842f87, 0xa178d09e, 0xd292f3b5, 0x1915d17f, 0x13049eeb, 0x3ee4a24c, 0xf699c638,
+        0x9da029bc, 0xababbeeb, 0x4e11db1e, 0xa417ee75, 0xc457fd22, 0x17441e48, 0x44692039, 0xa20d2151, 0x0a1d15da, 0x65f8faa1, 0x4beb78ea, 0xfdfb8260, 0x8e6def41, 0xe5568c07, 0xf81543a7, 0xc5b1946f, 0xb06a7a21, 0x097e758c, 0xb7c71341, 0x43da06b9, 0x8f1c8857, 0x508431ea, 0x8889e6bc, 0xfd9b0a5e, 0xe02f72a3, 0xfab2ccfa, 0x64a21be0, 0xfed7c933, 0x7543dff8, 0xb0be0f57, 0x354f8ec6, 0x4745d20b,
+        0xc1dca760, 0x693b59b4, 0x8bf4023e, 0xf015a866, 0x5b7dcafb, 0x462f194a, 0xb3749756, 0xaa798106, 0x1bf60174, 0x5a1f36dc, 0x01b13e3a, 0xfcf12ba2, 0x98e8ca11, 0x14a3026e, 0xa8bfc347, 0x0393248f, 0x947b4d3a, 0x5585268b, 0xe8f296b3, 0xb35dea8a, 0xa2d14c8c, 0xbaff929a, 0x868b2eaa, 0x10ce7dc1, 0x4276a876, 0xf2e41c21, 0x0d1988a4, 0x8e72c36d, 0xbb611574, 0x585c5761, 0x2a0f003b, 0x3812b232,
+        0x47c81930, 0x0aa9cf3c, 0x4269d65d, 0xa5fbc327, 0x8c0e7b12, 0xb4ad108b, 0x8a9091f6, 0xf1aa8cc9, 0xc9c1c900, 0xf84b78df, 0xde9e7823, 0xe3fbdae7, 0xc99c4192, 0xaa777010, 0xf82c6c87, 0x473aa0f5, 0x2e332864, 0xa8aa89b6, 0xee3bbbc6, 0x77f1b631, 0x0b8f12d5, 0x37934f0a, 0x3d9af7e7, 0xf9d44afe, 0x024452c7, 0x056dbd4d, 0xabed8dc8, 0x50a1797e, 0xe7a1d6fe, 0xff4d33e2, 0x9289e007, 0xd08d5ca6,
+        0x27cc4fad, 0x2e0e1ebf, 0x809b26eb, 0x9376da32, 0x9156f12f, 0x085ef8c9, 0x30329426, 0xfc802752, 0x52fe8a09, 0xc08ef027, 0xb74e393f, 0x51a8d266, 0x8d8cbc7c, 0x02a9c1fb, 0x246c936c, 0xdaaa3111, 0x615f8196, 0xc223f5f3, 0x65858ff6, 0x163f2377, 0x93a55815, 0x09f75475, 0x04f77f22, 0x9d19a200, 0x93dc497c, 0x8fcaa196, 0xeea46726, 0xa092d65a, 0x1b5c03a7, 0xbfab3b86, 0xbb6e2aa3, 0x2c4e81a2,
+        0xf8742e78, 0x6ffe768e, 0x9bdfec3f, 0x9db1969d, 0xb83c016b, 0x62ea099e, 0x4d812d30, 0x4e60fa5c, 0x75827dde, 0xd59745fd, 0x0c4b9a6e, 0x571fb851, 0x62a66f98, 0x0960c86d, 0x5c9971d8, 0xbcbefd9c, 0x499f1bcd, 0x812cc4f6, 0xd11415e7, 0xd706d59f, 0x7355cf30, 0x4b1dc52a, 0xce7f7806, 0x36cd2bbe, 0xca48c61e, 0x10e929df, 0x486fed46, 0xdbdb45e3, 0x117cb6d7, 0xcf4615d5, 0x0e0ff0bc, 0x8a15d0f2,
+        0xa334af1a, 0x33662e28, 0x6c9dfac2, 0xbbef32df, 0xe7d0e70d, 0x2ba8d5c8, 0x6ad58a8e, 0xd8ebc6cf, 0x27705dd3, 0xb2e41bac, 0x8a3d6456, 0x4e0fee37, 0xefe5384c, 0x56070501, 0xa93459e0, 0x1f7d24c3, 0x6508453b, 0x251defb2, 0x424d345b, 0x245e5b97, 0xd910c57c, 0xa7a23923, 0xf1ef31fb, 0x36062f14, 0x60830fa6, 0x9dd38ff3, 0x11394634, 0x8242ae01, 0x2e7c248e, 0x701a3eb6, 0x9364320c, 0xd0ce913e,
+        0x2f96295b, 0x9c405a68, 0x4a9c5c11, 0x2a44ed92, 0x762f9e66, 0x882be7dc, 0x58d38373, 0xccc06c7e, 0x51734efb, 0x99f965d2, 0x75bcf62d, 0xf31cc296, 0x3c639c11, 0x38db5b17, 0x071ac1fb, 0x6ec13260, 0xa89067c6, 0xda27842c, 0x28a759b0, 0x6314f5d9, 0xcd7b4bcb, 0x9883cdf8, 0x6898af1b, 0xaeb2c654, 0x53cff443, 0x2624c51d, 0xbefad23b, 0xec453d9c, 0xbf10eb6c, 0x09834043, 0x2c885002, 0x0ea7602b,
+        0x1e176a94, 0x3d2755cd, 0x2c8db93a, 0x1c16347c, 0xa09de300, 0x84483e4b, 0xd7861ea9, 0x53499129, 0x8294ca25, 0xdeb39d06, 0x2a6f7e37, 0x17a07fd7, 0xb6dcb618, 0x1b28b35a, 0xe83398b9, 0x1f286dcf, 0x37f216fa, 0x183b214e, 0xdef7544c, 0xb6bb624e, 0x363ae17b, 0x0f948eeb, 0xd62fac6a, 0x619f5d66, 0xdbfb320d, 0x6348372a, 0x85fc10ef, 0x4f17c6c1, 0x7a3472a0, 0xad8eac1c, 0xe3cf618c, 0x4203d48f,
+        0x10a8d575, 0xc452fd84, 0x826bb760, 0xa26296d0, 0x9eec9d53, 0x01f2452c, 0xbbcb136b, 0x1bc38fab, 0x3ae10873, 0x8ece0948, 0x0599652f, 0x76a39a81, 0x2394c691, 0xfe2451de, 0xc4fe70bc, 0x3406b555, 0xf84287f5, 0x46667ee5, 0x6304f566, 0xb8eeece0, 0xfe51489b, 0xe0ed2f4e, 0x538e85a6, 0xaa884d00, 0x231cfc41, 0xa5b5d4ed, 0x627f36c0, 0x0f7713b0, 0x9008e6f9, 0x21d29cc0, 0xa24309d4, 0xe88548ec,
+        0x8aa6b742, 0x73c73738, 0x50a368af, 0xc348da59, 0x28c9a2df, 0xd31c9a7d, 0x2711db90, 0x21642916, 0x230f34b7, 0xaec8aa0e, 0xb5b5a82e, 0x9ae90a3a, 0x77015b9e, 0x76df58ea, 0x1cff570b, 0xdfd9526e, 0xb36ccbe8, 0x28a32bdd, 0x2e139245, 0x71bb9e36, 0xcdbd30f6, 0xd24548b0, 0x8392a091, 0xad9db849, 0x8c6674c3, 0xddb2af56, 0x35355066, 0x63de962e, 0xc8dad108, 0x29906e0d, 0x86c8065a, 0x51bd7f3d,
+        0x922e9640, 0x7dd8b690, 0x6c0adcf0, 0xc2ebb542, 0xb89db325, 0x73347685, 0x12b93133, 0xf4853e32, 0x9848deff, 0x24cc0e4c, 0xdcaa8c7d, 0x729127d7, 0x72e4a05a, 0xacc90b16, 0xa70f4fc6, 0xb0f99ccd, 0x4db06a08, 0x7ca28640, 0x9b812f59, 0x1d02a991, 0x47662459, 0x5f8b574e, 0xccb01e1f, 0xb20bb91f, 0xcbd1bd51, 0x1ccb018a, 0xf43f0a14, 0x7ce81ddd, 0x71c02560, 0x03bc8714, 0x74f645a6, 0x13985137,
+        0x998d9db7, 0x844db588, 0xd7b61060, 0xc87ed668, 0x07fcc0a2, 0xe862d29e, 0x2ff0ef8f, 0xee1234ce, 0xf18f670d, 0x6f3eaa21, 0xf2ab066e, 0xc8f30644, 0x73f6c8e7, 0xce8723e5, 0xcf92b8d1, 0xce05761c, 0xedcb06eb, 0xe7e0379a, 0xac37333c, 0x0a65eed0, 0x5f512b17, 0xa262aa13, 0x67dbac36, 0xe724e5c2, 0x7056c3a5, 0xc664af98, 0xadbbf423, 0xd3cffe7f, 0x770ed95b, 0xe2597e72, 0xf4091ec8, 0xd46837ce,
+        0x5acd7caf, 0x49da054c, 0x56ca1224, 0xd2814c8e, 0xe5571591, 0x138decad, 0x8ba19457, 0xeab45e32, 0xbfd10ed4, 0x2ae9696a, 0x1ff7f3ac, 0xf2817a1c, 0x74073267, 0x89ec4517, 0x1322c77e, 0xcc7ebbf7, 0xa9d0b0ca, 0x0bef89e0, 0xb4228384, 0xaedcade0, 0xeb40583c, 0x6c324e16, 0xa8fa78eb, 0xdcb92496, 0xb0aab743, 0x58fc9bec, 0xda8da17f, 0x3fb5cc8f, 0x77c86859, 0x255e7673, 0x755edbf8, 0x060d575d,
+        0xce5cd81c, 0x921a4ad9, 0xd323f20a, 0x9367b6a2, 0x30c06ba2, 0x195b8a7d, 0x069284ea, 0xb0e20dcc, 0x0e8b6cd6, 0xea03b3b6, 0x24976d0c, 0xd657cced, 0x2be2193d, 0x7dbe6626, 0xa0375d02, 0xa17fd04e, 0x078e4f05, 0x1f454101, 0x78eac463, 0x80b6836b, 0xadae6ced, 0x377aa058, 0x1d62cf57, 0xa40cfb3f, 0x3c6eaf62, 0x8aa3067d, 0x4a012fb6, 0xa12e26e3, 0x2c39c1af, 0x51828844, 0x52de6781, 0x54a7bb0a,
+        0xcd158d24, 0x5d520cdd, 0x4cb4cb54, 0x575486cf, 0xc68f6842, 0x56da243e, 0x8d826399, 0xfbcd6da4, 0x8e0046c5, 0x9e016176, 0xbb0bb354, 0xc84ed19f, 0xc60c46a6, 0xffbd1cb1, 0xe69dea60, 0xa88ce680, 0x235eec3a, 0xcf6b75e6, 0xcb489e5a, 0x2719d559, 0x307d6501, 0xbdab8e6f, 0x076add63, 0xca9ac642, 0x209c7272, 0x8cef6504, 0x223c807e, 0xf77e33bb, 0x20d8fca5, 0x7d28f0f4, 0xef6d2f8e, 0x828961e7,
+        0x45f267bf, 0x396d1417, 0xf1536d77, 0xf8b53a52, 0xa35dd4cc, 0x6df9733d, 0xdf5e2e0f, 0x637f3769, 0x5df8830a, 0x0a68ad78, 0x3c77ba65, 0x098fedac, 0x2ff41691, 0x5520278d, 0x8bafab8f, 0x9f95d66e, 0x414f4fc1, 0xf8e71c99, 0x4e4a74ba, 0xcf0a1789, 0x03fafe8a, 0x40ce6b00, 0x96659eb1, 0x2e47ccc7, 0xf66a38a6, 0x8ea544d7, 0xd98f9df1, 0xf9d95a7b, 0x02086001, 0xa265c566, 0xa24f7f7e, 0x5b847d32,
+        0x5bfa80fc, 0xda7d078c, 0x1d3302c0, 0x6b55fdca, 0x8a730b20, 0x576fe950, 0x6a9a9771, 0xf31ae10a, 0x8460912d, 0x79749661, 0xe2d8f2ed, 0x320cfa71, 0x263ecf70, 0x618e79e2, 0x6f46f5e2, 0x495d58f5, 0x0f1d2ad3, 0xb4c58f6a, 0x618b2f82, 0x8afd3131, 0xb8ed3486, 0xd283db50, 0x1859bbd5, 0xcc24cdd2, 0xaaccfd6a, 0x49b9c7d9, 0x4be0e808, 0xfc5eacfd, 0x993b68d2, 0x413d18bb, 0x26dfc5a0, 0x10426ee1,
+        0x6fb668f3, 0xcf5ca4c8, 0x033f25b9, 0x8ff23bc1, 0x3aa13f7c, 0x94135052, 0x4380828d, 0x04df9705, 0x82ea2460, 0xfad7e789, 0x370fcda1, 0x026f12ee, 0x589aa6bc, 0xc5ca8f3f, 0xbf70f0de, 0xee47c2a6, 0x69e2f6f4, 0x435c84d4, 0x0e45ccc4, 0x242e2e04, 0x63d8e24b, 0xfd49fc39, 0x7977c799, 0x77f6420b, 0xd34837e6, 0x6fd89631, 0x4dbb95cf, 0x3d657698, 0xd260d6a3, 0x64679511, 0x90d0639c, 0x9ac7cba7,
+        0x0debf432, 0x0f8e7c8b, 0x42904a0b, 0x97241719, 0x96cf7d86, 0x32f83463, 0x7acfd273, 0xe8ccc9ef, 0x32dac447, 0x7a3a86a8, 0x3d2fef06, 0x7d7d79b3, 0xc7bac28a, 0x2ed086c6, 0x9e0805df, 0xd2472613, 0x24e5a00e, 0x05cfbd3b, 0xb7546d89, 0xb204c202, 0x66c9201d, 0xa1723904, 0x765ee335, 0x7f822fb5, 0xb5106ef5, 0xf7eb9a90, 0x66b5bbf9, 0xf0ffc83d, 0x03aec2fe, 0xc7df3935, 0x131ba2dd, 0x7c78bf36,
+        0x97503e66, 0x88d037d6, 0x722d27cd, 0xbc5a83ff, 0xed3701ec, 0xfbbd6597, 0x184aee5c, 0x9db1dd26, 0x601b7212, 0x308823b4, 0x8bc694ef, 0x052f8776, 0x1c96f429, 0xa082d7cb, 0xe78ae711, 0x61e00574, 0xa21e70e2, 0xf2643fe2, 0xe7c90ea2, 0xb18ba84e, 0xa16beacd, 0xec4665cc, 0x03a476d7, 0xfec476fa, 0x5104b03d, 0x8099c3fb, 0x1ca38f9f, 0x544589dc, 0xa1247efa, 0x4ee55234, 0x0f8aa788, 0x2a3978f8,
+        0xac8aee66, 0x1e94a71b, 0x7a3972b7, 0x75c4c732, 0x4e383ff4, 0x6cbdcf6b, 0x842e65ec, 0xc575db9b, 0xb4ffcdbf, 0x53e4759a, 0xd048cf25, 0xa7a28fc8, 0x50d8d0bc, 0xe1220da2, 0x4fb17ff9, 0x7c712292, 0x58506769, 0xda32966b, 0xaa92f50d, 0xe80b93f6, 0xdc6f30a2, 0xce12f4d8, 0xc303f703, 0xbe62fed3, 0xe036e42f, 0xa262bf75, 0xdf094a31, 0x02e72b5c, 0x2c3bfdf8, 0x517b5095, 0xd9a8477e, 0x2f977c56,
+        0xf5a79571, 0xae6c0f2a, 0xc52c4906, 0x2bfedfcb, 0xe0010192, 0x53e4de4d, 0x1142027a, 0xa27e35cb, 0xa5942ca1, 0xb65cd01f, 0x52f7fe9b, 0x0514459f, 0xa3edc67f, 0xb9ba1aa4, 0xe1375d13, 0x9405b38c, 0x5fa6b7fc, 0xe767cdf4, 0xc448e994, 0xf3d7d050, 0x2b07ba2d, 0x6e6cba3a, 0x850cad4d, 0x37abc54c, 0xa0a0ee42, 0x4e8e89d8, 0xb6c30c18, 0xe56727b6, 0x4e6ff9a2, 0x209c5dd9, 0x4380ff90, 0xbae6e697,
+        0xea7f34a6, 0x97d8e187, 0x9d72e2bf, 0x85f0d224, 0x17da5204, 0xdc9bcf4c, 0xa0b0c39f, 0x55bd0096, 0x3128bf82, 0xf1dc9af6, 0xc6e7286d, 0x6fc8e8c4, 0xdd4fe7a0, 0xb1227222, 0x55659add, 0x0ad0fc3e, 0x22aa7df1, 0x544b0e50, 0xc3f5a7c1, 0xd9878a87, 0x5190ab62, 0x6c26edfd, 0x409bf19d, 0x90c56dd7, 0x333816ff, 0xc77bb980, 0x11aaa13a, 0x97d30a87, 0x8d4a058d, 0xed513574, 0x676032c8, 0x9a25daaa,
+        0xc00796ca, 0x85c0b816, 0x7cb80ec8, 0xd10f213f, 0x628157fe, 0x2810400e, 0x0fb877d2, 0xb8e77180, 0x36b47c5d, 0x64246e10, 0x8b3b48f4, 0x4c5528d1, 0x69200142, 0xdf7c36f1, 0xe6a58643, 0x8715d648, 0x0e68fdaa, 0xc3b4def3, 0x7189d278, 0x899f9088, 0x89ae14eb, 0x7cda76b7, 0x2251cbb1, 0x3156de7e, 0x8a7b846b, 0x66d335c9, 0xdb7c7b4f, 0xda8463e9, 0x32b14408, 0x9c568653, 0x27d5ff86, 0x0806a0c8,
+        0x0fb67407, 0x8bb243e3, 0xa93c2511, 0xd59a2383, 0x04c32499, 0x55b6d197, 0x4a85b8da, 0xc2845a33, 0xf94c84b7, 0x7a8fd369, 0xc3bf7a17, 0x824c5d0d, 0x3e6211ef, 0x767a9cea, 0xae9f2860, 0xf2459a20, 0x234a6eee, 0x282f7cbb, 0xa13b566b, 0x041c9eb7, 0xdb655082, 0xe95311dc, 0xe6592eea, 0xf321cdb2, 0x592eabea, 0x745d73ff, 0x7c7ed333, 0x3f081525, 0xadf4dbb3, 0xf518cb71, 0xb4415516, 0x78eaee7d,
+        0x75fc7f4d, 0xf7c6d83d, 0x5d40f306, 0x1a57c441, 0x47bf7622, 0xa24a41b4, 0x1382223a, 0xeee05c87, 0x71d2f12a, 0x6d076a3c, 0x2a6bba4e, 0xa36d46ab, 0x661469b2, 0x432f3be5, 0xebab6fc0, 0xf6132776, 0x82e6cf77, 0x792936cc, 0xea053b42, 0xa77b185f, 0x1788fb88, 0x65c4e24e, 0xfe37af29, 0x5b838bdc, 0x18afdfa5, 0xc4653fd3, 0x502a6f37, 0x1891ec51, 0xc90e57f9, 0x08023843, 0x9a36e72e, 0xf884a245,
+        0x7745c501, 0xa7fc6268, 0x4c5255fb, 0xee5a992e, 0x22179c8b, 0x91c3fda1, 0x4b85b4f4, 0x9f54c12c, 0x2aa81298, 0x7eacc867, 0x512db94e, 0x8604d488, 0x1c1e7409, 0x500f12c4, 0xd503b775, 0xad1b0a82, 0xf8ba4d87, 0x016ff6ad, 0x37e0a041, 0x4633c5ba, 0xb4c180ee, 0x1317a378, 0x09fccd27, 0x282b9ddd, 0x9dc58479, 0x4c32f664, 0xab5b7342, 0x2d29ab21, 0x09860a3d, 0x343759a0, 0x00da88b9, 0x4d1609f5,
+        0x24788b33, 0xefd2a76f, 0xdcc69ab7, 0x4e9f6890, 0x46aa635a, 0xd533188c, 0x881cefcd, 0x17be6265, 0x85b04b9d, 0xadec1354, 0x914f6517, 0x12e6fb6f, 0x55419f05, 0xb2ffd3be, 0x69d5aadb, 0x5d7e1bf3, 0x6a12b86f, 0xa350f3bc, 0xfbe24c52, 0x6aa3dbe8, 0x0ec800b4, 0x5dd91253, 0x6583d5b0, 0x32e04ded, 0xca93fc45, 0xa858baf8, 0x981c89d1, 0xd35c4786, 0x4f3f86c9, 0xf419f5bd, 0xe6dc8e31, 0x3199ff22,
+        0x17d72b80, 0xfceea475, 0x51abc33d, 0x65ce6b2c, 0xe30fea88, 0xbfc5bb17, 0xa84d713f, 0x8651968c, 0xaf3c7fbb, 0xcb3d4343, 0x7954b277, 0xa2c450c8, 0x242893d8, 0x09c0fcbd, 0xf36fd027, 0x1a7efa2e, 0xe1f3c912, 0xf8023194, 0x6ffbf8f6, 0xcbc15fd3, 0xd5bfba9f, 0xcbfd1653, 0x533c990d, 0x8098c6b9, 0x5e1d9bf8, 0x8c39c828, 0xcb7a9971, 0x407560d8, 0x196c4bce, 0x43be4114, 0xf3a7f4ca, 0x38b5fb4d,
+        0x0060985c, 0x959483fc, 0x4b9f0fe5, 0xbc85e494, 0x0c678471, 0xee995676, 0x71576f1a, 0x690d12dc, 0xca335f32, 0x0b602f3e, 0xe9dc7ca2, 0x80277a97, 0x88835b9c, 0xa4b35b0c, 0xcdd7f423, 0x8490b872, 0x900a8252, 0xb3336978, 0xc0397078, 0x64193715, 0x025cebb8, 0x318444d3, 0x7a0e9265, 0x8fa7f9d9, 0x4015988e, 0x4d31da9c, 0x4ed3bb2b, 0x0e005f00, 0xf789f9e7, 0xe33bda95, 0x357433de, 0xe01eae23,
+        0x853dee92, 0x20113ec1, 0x39bd642d, 0x0c04df0a, 0x9133e135, 0xf3b65752, 0xff87a513, 0xa462e8d4, 0x21c1ed26, 0xe5e46741, 0xf465af5a, 0x335225ac, 0x1fb66fc9, 0x24be4b98, 0x2fad4e87, 0xd7f9861e, 0xa581338a, 0xf5d7d119, 0x20cfb045, 0x61bbf3b0, 0x14d16ba0, 0x221d8864, 0xa8c31ab3, 0x74250af7, 0x07039c7f, 0x8abf4de8, 0xfc34be53, 0x89eb3f4b, 0x8a1197db, 0x5d0a7208, 0x5fb3a52a, 0x2af29894,
+        0xb4ec93cc, 0xb7587bfd, 0xf2898d46, 0x277cf094, 0x61dcedb4, 0x3a49ab2c, 0xb1627478, 0xf4f9ce06, 0x9a21587b, 0xa4fb1da3, 0xc6774a00, 0xbcd806d7, 0x97827258, 0x705c62c3, 0x604d51e7, 0x1a1ba8ff, 0xd9c42551, 0xe50f5ccf, 0x39c9c81d, 0x6fcd0fe4, 0xcc05755f, 0x3ba6a653, 0xff3397f3, 0xc01a5b84, 0x4803fc60, 0x2c06d215, 0xb5db871b, 0x7b71b807, 0xaa25fb9e, 0x2fbd1ed1, 0x6a32a956, 0xc1dc752f,
+        0x7f8e9dd0, 0x36cb03f2, 0xf2f9ba12, 0x137d6e9b, 0xf403b6c1, 0xe9173770, 0xbba0dca9, 0xb1587e6f, 0x627a6391, 0x3a4643ec, 0x0a42dc9e, 0xcbd978f4, 0x953b22a1, 0x7a8211aa, 0x909101f2, 0xbe686aa8, 0x5aed3f7a, 0xf0656f9b, 0xe154d75a, 0x60eaa0bd, 0x9fe134e2, 0x84a533cd, 0x9fbf7b94, 0xddcdf6ea, 0x4bb5b580, 0x4c63cca1, 0x131e3947, 0x1d60533d, 0x4b3050e2, 0x446f6428, 0x3c17e871, 0xc62a4ac3,
+        0x588cbb08, 0x967a6818, 0xd936aa0a, 0x38ec41e1, 0x290da3de, 0xfc97e944, 0x2869ccbc, 0xea9cc2d5, 0x82377e76, 0x7f5dbf90, 0x9a71ef31, 0x873101a7, 0x29514fc3, 0x6b081695, 0xa2ad2273, 0xbaa6bad7, 0xd80c7d40, 0xa877f854, 0xc842cb90, 0x4fd041a4, 0x43ba9edc, 0xfc95aea0, 0x50901c79, 0xb9571520, 0x2ee5e7b6, 0x63a67cfa, 0x728d9bb2, 0xfb551a46, 0x53a135af, 0xb54ccce4, 0x47a20a5b, 0xb2279aaa,
+        0xee881458, 0xd1f31ffe, 0x66523de2, 0x91115766, 0x6121e058, 0x0fedcc61, 0x97c4c8fd, 0x80e35aa2, 0x1189a77d, 0xbd9b6fdd, 0x348a749a, 0xb51fec76, 0xb93f0c3f, 0x39e4f057, 0x933cdfb2, 0xdbd74248, 0x33426ff7, 0xb5bc5d90, 0xd7ee53e1, 0x8e458efe, 0x6c7991de, 0x0564de56, 0x8b74cc8f, 0x868ea0d6, 0x8728ded7, 0xb78bb2c7, 0x2f6339e3, 0x2462904f, 0x14e99df6, 0xcfffd4d2, 0x76ced6e7, 0xa7e1a2fe,
+        0x07d2701f, 0x92f63de6, 0x6f5b1f3e, 0x579d59a8, 0x8ed03cea, 0xa3bb6a2d, 0xa38739dc, 0x15204dd4, 0x08c278e9, 0x785cf472, 0xb5bc0931, 0x24406de5, 0x2b58d065, 0xa855a1c8, 0x97e7e9e0, 0x63aa1cf0, 0x9baa246e, 0xf2d0e6c7, 0xc5b95b90, 0xf6e2e041, 0x0e67f288, 0xd9ee1311, 0xdacf4476, 0x49b2e8c6, 0x6260752a, 0x14a10c4e, 0x664d6dbc, 0x03d7f235, 0x534e8f75, 0x8aa80795, 0x8e2e0bd6, 0xc87a7b48,
+        0x4ba0a6fe, 0x0f45fd4b, 0x5dba0a49, 0xd9312e16, 0x595b3b37, 0xa2f1bb9f, 0xa1565d04, 0xdd825aed, 0xaa18e04d, 0x7936f933, 0xfdfa0694, 0x4201ff70, 0xf1c1a8ec, 0x04c35167, 0x59b065ca, 0x07850452, 0x31685035, 0xab85228c, 0xeb69579b, 0x03f09e0f, 0x49e7b8e6, 0x1657e0dc, 0x8d051f82, 0xced5ee77, 0xeb58d3fa, 0x38717a4b, 0x170d6b89, 0x0d1b2249, 0x41f86281, 0x32198b18, 0x6d5303c6, 0xa16c6e51,
+        0x93e5ac63, 0x66e66099, 0xe64708bb, 0xe8ce85f0, 0x37dda247, 0x811202ad, 0xf78f66da, 0x700540ab, 0x6f19675a, 0x8dda7294, 0xc8ea1f56, 0x859d99ec, 0x8675b9a1, 0x4b2dcb5c, 0x54ce8f40, 0x866c3752, 0x6e7cebd5, 0xb00998b0, 0xb7c86633, 0xd0fe7ac6, 0xea8cdfe1, 0x7db5a432, 0xe3d8dfc6, 0x522a0226, 0x227c18a6, 0x1a6a2236, 0x1eb29a24, 0x966f9896, 0xe4b94c50, 0x08b27255, 0xa7309d3c, 0x9a8bffef,
+        0x0a4fa9fd, 0xf09b6e87, 0x813510ad, 0xe9e35198, 0xe4fae6f0, 0xedf30800, 0x62bf19c7, 0x1f609f83, 0x4ac3e972, 0x8115bc4f, 0x3be9d20a, 0xb0ccc3c3, 0x337159e9, 0xf891673d, 0x615bbcea, 0xc1c3d3d8, 0x98442ab4, 0x8787717f, 0x44b4f160, 0xc96a6123, 0x9f5866af, 0x3717ae0d, 0xcdf81f85, 0x5b0035dd, 0x1a9ddc56, 0x18a225d1, 0xbaaf7e3e, 0x3cf1d9da, 0xa60a02ea, 0xb15720c8, 0x7982f73d, 0x21a1cc0d,
+        0xeed353f7, 0xd54d9c68, 0x18b08862, 0x857192ad, 0x995f1239, 0x697eaa6c, 0x3bcae59a, 0x9ca4e3d6, 0x0846ab8a, 0x1aa9e839, 0x9471a803, 0xf19460f3, 0xd79a4c54, 0x886fb6a0, 0x8e90cd1d, 0x79cf2a3e, 0xd702925c, 0xb383936a, 0x3477c087, 0x8528d77f, 0x9f0a8f62, 0x6abace12, 0x2c8ca20e, 0x1e16c4df, 0x4a1f4812, 0xa463b071, 0x04bc9ba6, 0xf099d98e, 0xb3954460, 0xafc98538, 0xf3bc4284, 0xc41d36d7,
+        0xbfbf136f, 0x335b197f, 0xc1b8e2dd, 0xee888c5c, 0x8ac65999, 0x146f2a7d, 0x483545b2, 0xf3732699, 0x3eb01e32, 0x980cd7d5, 0x494c2693, 0xae7066d5, 0xf68ffa08, 0x4cb8a709, 0x3b0ed9b1, 0x26bb497c, 0x898de565, 0x513013f2, 0x347b6bb3, 0xd57a8654, 0x6f1d549d, 0x69b43d31, 0x246800e0, 0xd6d61d2c, 0x60264201, 0xf318c808, 0xcb26ca18, 0x5b8ff9e7, 0xd014afba, 0xf0cb5c0c, 0xe75ed742, 0x0d508210,
+        0x8a561074, 0x4e5a90af, 0xd15f7d66, 0x950d3e86, 0xb55acb0d, 0x9d2891f2, 0x0b0fbc32, 0xee01b825, 0x255cb730, 0xe7152c1d, 0x3bbbe2c3, 0x838f8fe9, 0x3f27cd44, 0x9aeba1f3, 0x2b97a643, 0xe1096427, 0x3c2caf5d, 0x59ca0277, 0x46849df9, 0xc44b054c, 0xf39c7de4, 0x50779e57, 0x58bf6dfc, 0xbb6258b5, 0x4c1d4a41, 0xfa2ffc7a, 0x678879c5, 0xcec4ed5c, 0x4d5f6e8e, 0x9b556765, 0xc1df23ac, 0x08e701d1,
+        0x5c182d0a, 0x1f869f62, 0x1ff96b0b, 0xbae69418, 0x9dffad17, 0xe4c281c5, 0x5b0352b5, 0x56522b92, 0x5ce98456, 0xcff62468, 0x118872ce, 0x311da578, 0xddfe520a, 0x3d027a96, 0x7538af6a, 0x5b930ff2, 0x13de9a19, 0xa95d4274, 0xe7a8ea4e, 0xee2a1e68, 0x481d38b8, 0x1b705b3c, 0x9d27192c, 0x4c867381, 0xa96f85b4, 0x3f1b11d7, 0x3334cfcc, 0xce2dc675, 0xf5c1a848, 0x6045cb4b, 0xaa4462d7, 0x1944eeef,
+        0x8a92a05d, 0x9c033999, 0xde74be7c, 0xa8587009, 0x8e9aa9bc, 0x6ab38f59, 0x057a58d1, 0xa47c1f0d, 0x7b90f3f0, 0x0651e344, 0xced8249f, 0xb06b6b83, 0xbc6b1c0e, 0xe97cc44c, 0x92828a74, 0xa86d28bb, 0x024cd4ca, 0x9afed27f, 0xb7e13a79, 0xe63e6a3d, 0x730d9f1a, 0x0b558669, 0xa8dca50d, 0x0dcd18d7, 0xc0d24318, 0xe7749c62, 0xce036044, 0x11210ad6, 0x0776bd79, 0xffab8183, 0xc7a21ab6, 0xe55fa0ff,
+        0x913de1c0, 0xe64db753, 0x137c610d, 0xb8132173, 0x406a49b7, 0x92f11661, 0x222a1374, 0x9f5f4bbe, 0x90815cf4, 0x4c03272f, 0x8a7dbfcf, 0xabaa1f91, 0x11a4d619, 0x1d999789, 0xfd09ce2a, 0x4d4063bc, 0x4047ca60, 0x86840930, 0x50c2d693, 0x2b121828, 0x4cf7da9c, 0x93629dbd, 0x0ac31216, 0x309aca4b, 0x87248a21, 0x30780644, 0x418aadf6, 0xf4a4ed82, 0x68a137da, 0x98bf59b2, 0xf2903050, 0x2a96acf5,
+        0xeb55ff6f, 0x2f5a6f07, 0x1f09d346, 0xe96623cb, 0x9789b255, 0xd12030b3, 0x5c122a33, 0x8d6671d0, 0xb8247fd9, 0x36255c3f, 0x860771a0, 0xfe3f4f59, 0x42c6a15a, 0x1122f0a9, 0x7e3a7205, 0x2e425384, 0xdb180fd4, 0x221c43c5, 0xb972b0a8, 0x8baee5c9, 0x32f8e488, 0x54dcd679, 0x2843e31c, 0xb5d5b9dc, 0x5ed77bd2, 0x8b5db9ee, 0xdcbddbbf, 0x6c4bb9e4, 0xaf4c9a89, 0x2a0c6305, 0xa25acadb, 0x75ef4787,
+        0x242dc36d, 0x0e7cf05e, 0x144d26ed, 0x287b147b, 0xe04b0fb7, 0xf17081be, 0x6ba13732, 0x110274e3, 0x7cd785b2, 0x6357ef3e, 0x75d7e436, 0xfd9d529b, 0x84036c85, 0xd2d7fc2d, 0x45a16ca6, 0x149f14c3, 0x3b48d0e4, 0xb6bf211c, 0xe647dd87, 0x0e6c7436, 0xe8a06342, 0x9f33fc33, 0x9a88569b, 0x267b5d4f, 0x5d802342, 0xf12db18d, 0x993d3a37, 0x01177ff3, 0xab21f928, 0xf807555f, 0xe50226f7, 0xd55c1467,
+        0x165b9ee8, 0x97ad4a55, 0x89fc950f, 0x740db4c9, 0x6daee510, 0xf8ff3ee4, 0x9dfdc56b, 0xda8267f1, 0x8f127d55, 0x706c69cf, 0x39d159d9, 0x3cc695ac, 0x1ac1cab2, 0xd7733b5f, 0x028de548, 0x5364ac41, 0x0f24abc9, 0x13a198b8, 0x5299589b, 0x1a75cd37, 0xc78bc5af, 0xc74eb3e8, 0x55e1ecb7, 0xa5965105, 0x9e9c0c74, 0x82a077c3, 0xfe2dc227, 0x296429b8, 0xa5e3b390, 0x1b89e004, 0x8a2ebf97, 0x3b83e121,
+        0x3b750c29, 0x458c9b3b, 0xbd65a505, 0x9e1fae9e, 0xe395008a, 0xc69b4ef6, 0xdc1c5a4d, 0x112b19ee, 0x98d8f9d4, 0x8671837a, 0xa79dd629, 0x19dddb9a, 0xea3e5b6a, 0x548a35de, 0x6ee51603, 0xe434a6a2, 0x4a2dc2ce, 0x500da3ed, 0xa1c309c6, 0xbe20c123, 0x4ba0c405, 0x18ee4204, 0x9f3d4757, 0xfe62a5c4, 0x0c2b337a, 0x8bf3ba4c, 0xfe9ec105, 0x62fb9026, 0x34ee7eda, 0x54011645, 0x9b7c3450, 0x41fe2a8e,
+        0x58fe4d1c, 0x7f96b185, 0xb7bd9dce, 0x8ecad0a0, 0x072a9190, 0x7a250d8f, 0x111c8ab7, 0x52208f2c, 0xed541348, 0xb2adb951, 0x167835d8, 0x4b9b9781, 0x55181277, 0xc5505879, 0x86b3ca81, 0x4ce811a8, 0x3f23f03c, 0x852be386, 0x8afb756d, 0x9874f346, 0xc7e6f48c, 0xc6bd13f2, 0x859a1562, 0x841779d8, 0xee944559, 0xbc65e89d, 0x25a92176, 0xc2b07718, 0x6ab12826, 0x98f31e8b, 0x47c145fe, 0xbb730e11,
+        0x991d1a2b, 0xaecca24e, 0x09566a84, 0x6542dcaa, 0x104dc23b, 0xbe6aebb3, 0x52a86d83, 0x4143cc1c, 0x192f55dd, 0xd50d79e3, 0x2b880b61, 0x657a8e6c, 0x5f049734, 0xc94718d2, 0x0a2dd14f, 0xa65a5839, 0xb590d0a2, 0x6348c2bd, 0xa42ef287, 0x3d6d246a, 0x2c8f40bc, 0x2eca3823, 0x0fe9309d, 0x87f4d4d4, 0x681ad4fd, 0x76506a20, 0x768b4ab6, 0xd628d433, 0x33e27664, 0xfe9560d2, 0xde9ad244, 0xa003007d,
+        0x99129ea2, 0xd22fc522, 0x05e4371a, 0xa9625978, 0xe640cf8d, 0xe412a509, 0x73f446cb, 0x8d464085, 0x0edacda8, 0x92eb067b, 0x1b347840, 0x4a61324e, 0xff98ccd6, 0x3427687d, 0xddc7a1ef, 0xd3085e22, 0x9d7e2090, 0x456c0a65, 0x06e5d577, 0x7d5385cc, 0x5290d7ef, 0x61ad46e1, 0x76ba0a1e, 0x6b965a4a, 0x19593184, 0x09197c67, 0x922c4767, 0x70586dc9, 0x536c8ccd, 0xc120bffe, 0x7353772f, 0xe7fdd0ad,
+        0x93ed9227, 0x51cedb89, 0x1328ff19, 0xeb76e723, 0x0eae0241, 0xcd10753d, 0x4d0b7b15, 0xeef5d3b5, 0x858f8604, 0xa92f69bc, 0x8fd7620e, 0x8ee55afe, 0x3dd6889a, 0x6db1e5f7, 0xe9a80758, 0x87f2ae42, 0xd3635233, 0x9c5a357e, 0x71cdc243, 0x88065fd4, 0xfb6873a1, 0xfd0f6b64, 0x940957d0, 0x468a9f60, 0x3c032dad, 0x13684040, 0xcf82daf5, 0x869d7f82, 0x7386b433, 0x10d559c9, 0x3ffdfab6, 0xfd00db7b,
+        0xf4978dc7, 0xc3661b1d, 0x2484bbbc, 0x78894a94, 0x83375a8e, 0xf6122f14, 0xf8d015e2, 0xc0c5051a, 0xa5f8571c, 0xcd446c0a, 0x9d5b1435, 0x8bc98c5f, 0x783b01b7, 0xdf775ace, 0x93e96f9e, 0x853907b6, 0xe94bd2c2, 0xd8da910a, 0x604ff8e6, 0xac71d86b, 0x3a905413, 0x049ed2b7, 0x6c6c2032, 0xf78e058f, 0x460a66e0, 0x286b2aff, 0x71cf1133, 0x829b99bc, 0xa0a4d378, 0xe18424e7, 0x88de3fd6, 0x58419da3,
+        0x62ac564a, 0xfcb6c25e, 0xdf9a6ce8, 0xd1ea8f2d, 0x4ce3a788, 0xce38e757, 0x666858e3, 0x901dc0b2, 0x8489872b, 0xd59062ad, 0x0fd3be87, 0xb3e25a46, 0x3b3ae1cc, 0xae094c85, 0x1e55190b, 0x964f5ced, 0x1949a5f5, 0xfc9860b9, 0xe3e91785, 0xf00bce2d, 0x088c2fd2, 0x1b587a7c, 0xd6caff56, 0x5354c9b4, 0x81dc3b77, 0x4b7aecbe, 0x1d1c8554, 0x5a6e5cd1, 0x7d8dd8a6, 0xc8efd892, 0x99750331, 0xc0185fe5,
+        0x17186790, 0x6a950f46, 0xfa6ce3e6, 0x55ea8b46, 0xa72c3cef, 0xff2cc8fc, 0x760cc14f, 0x5554a22a, 0xdd1f406d, 0x2173f6c1, 0x4348c416, 0xe93b14b6, 0xd2ef3c4b, 0x251dd7e7, 0x5437b9cb, 0x038b3e8c, 0xf0f91246, 0xa7eb4313, 0x3e7dddd4, 0xad8dc09f, 0xf5052bfe, 0xd0e45b67, 0x82c56cd5, 0x2a697c9b, 0x90884e22, 0xfda5eecd, 0xfe642e3d, 0x75dec249, 0xc55f340c, 0xc0b84b96, 0x50555294, 0xdc8e867c,
+        0x0ed0bd87, 0x375d0cf1, 0x0b486b9a, 0x33ca875e, 0xd01d1883, 0x99cacdbb, 0x697da265, 0x1ab5ab61, 0x6258847b, 0xb35fd0cb, 0x85eb9ed0, 0xa24af179, 0xe463dfe4, 0x5fb05a2a, 0x67ea6a51, 0x212b3aff, 0x9ab93b13, 0x77cff382, 0x18450ba2, 0xf444ac74, 0x5602de78, 0xc0b2a623, 0x25145acb, 0x7a4540aa, 0x3eb07d80, 0x55646eeb, 0x61044950, 0xfa898140, 0x4533aa8a, 0x29a786c5, 0x37318415, 0x236087be,
+        0xa23c33a8, 0xe31f1969, 0xccba28df, 0xdf232985, 0x35612cca, 0xec19b906, 0xe5710bb9, 0xd16fd62f, 0xbee6d0c6, 0xeb6b6d37, 0x89509497, 0x5a26a220, 0xf84fa386, 0x94939796, 0x909c2ef3, 0xafc82730, 0x37ba867d, 0xa5108fb9, 0xdb965ff3, 0x85b11784, 0xdcabfcb2, 0xf9f13d44, 0x50349298, 0xc4b3229b, 0x53b53cb0, 0xf5840937, 0xd70b1e5a, 0x93af2dca, 0x7e16a0fd, 0x89bb8a24, 0x0d497b3f, 0x7deb6af4,
+        0xc72c363a, 0xd27e4552, 0x6d3a66cf, 0x39baea74, 0x47ab94ee, 0xa5761583, 0x5560c7ff, 0x9d87f50d, 0x5defc6ca, 0xad16dc79, 0xcb7783fa, 0x87c27713, 0x09e7a3b6, 0x555a6a35, 0xba07006c, 0x37acaf73, 0xdf683fba, 0x63630da8, 0x492b285b, 0xbd877e50, 0xa82745ee, 0x3bb2f796, 0x3b5cebf0, 0xf975ed1b, 0x9f385f84, 0xf46a5cac, 0x133b4faa, 0x5f7a7055, 0xf77d502a, 0x23e5c540, 0x9c26fdb0, 0xb9ef55ea,
+        0x623b287d, 0xa03114f3, 0x07d36bb5, 0x85faebf2, 0xdb896b0f, 0xac5ded12, 0x9a81ce73, 0x17817949, 0xd90c1187, 0xe0c0c82a, 0x812e87de, 0x2ae9cd96, 0x020671da, 0xa54b6f5c, 0xeb486134, 0xbebb1601, 0x6923f30e, 0x8d207be3, 0xbb7c5257, 0xbb9a3d99, 0x26aed5f0, 0x37aa35c5, 0xd0b320d2, 0x2fdafe8b, 0xe8dbb633, 0x359f55d5, 0xc7273ca6, 0xa79ca05f, 0xc1d2d274, 0x2ff1d5d0, 0x67bb066b, 0x00390adf,
+        0xb3afca01, 0x42e68aaf, 0x90c20c47, 0x40d086b2, 0x95b14806, 0xa259373f, 0x584c52a9, 0xde21b586, 0xb448a12c, 0x634a8e65, 0x292e5cab, 0x84228a3c, 0x00633795, 0xb2636df1, 0x8fdf49b1, 0x8227eb49, 0x8be66236, 0xa3577e20, 0x8d030c53, 0xb60282fd, 0xb1cd295a, 0x0bd9f472, 0xed7040b9, 0xc4dad83b, 0xf1b7c458, 0x6912fe3b, 0xe73c43ef, 0xd908a126, 0x9aa6b5a8, 0x3adffc24, 0xed1c152f, 0x3bd7b00f,
+        0x1df030b8, 0x1a259c0d, 0x573ec49a, 0x16b5de44, 0x09672a8f, 0xafac4c85, 0x89d29b55, 0x282196d2, 0xbcbb06cf, 0xb772a03f, 0x2e64991a, 0x919868c3, 0x6d1e8056, 0x7b4fabc4, 0x19218902, 0x27a22fa5, 0x4d9feda8, 0xc29e8503, 0xc7b61d83, 0x8a145c16, 0x89763cf8, 0x28726f50, 0xc4e1dd94, 0x674e71dd, 0xa391cf8d, 0x6fb01617, 0xe4a55d17, 0x4ca647d3, 0x0f8967a0, 0xe9a9e86b, 0x2cff5d37, 0x85264532,
+        0x6a94b994, 0x363ffd78, 0xbd62ff83, 0x16e62a39, 0xe498af7c, 0x746c6614, 0x069e5282, 0x12589f85, 0x233754b2, 0x2021004d, 0x6c90fe6d, 0xae4c0f6c, 0xc3baa617, 0x5e39f6e9, 0x864183fe, 0xce2a6646, 0xc125b0ac, 0xd1078437, 0x2b77e935, 0x49c5a8cd, 0xac37d65e, 0x4c33ac40, 0x9e6006a4, 0x8d65d325, 0x01c0aa46, 0x92b90b1e, 0xbd7f6b9b, 0x0eaf6068, 0xfde2605c, 0xa0b25be2, 0x20d07e5a, 0x8a5579a2,
+        0x5c4f26cb, 0xd7126d8c, 0x30ea2d75, 0x8f52084b, 0xb6e2c3c0, 0xec485947, 0x2d88b155, 0x237a8185, 0xfca21eb7, 0x1a4ab303, 0x045a0e15, 0x97e71b0f, 0x0a3019e4, 0xba620454, 0xcde89b0c, 0x8eac6650, 0xdc1b58e9, 0x1f38320c, 0x90f5ecf3, 0xc8374a26, 0xc10d8755, 0xb1af51a7, 0x84feeb67, 0x9b65644b, 0x95fdd5ee, 0x1e04cea7, 0x30d3e13b, 0x6d5e1c43, 0x80e18a3d, 0x68b8eb8b, 0x0d08bdd6, 0x5129abbd,
+        0x0e5c4a7a, 0x331f39c6, 0x55cf7f2a, 0x72d5ab02, 0xa182f975, 0x0922b86a, 0xe458a864, 0xc1e93c1c, 0xac63b8b5, 0x3e2b06a5, 0xaf6da93a, 0x3fc81af4, 0xb21c54ad, 0x692797f0, 0xccc1c0b1, 0xbda93ca2, 0xa91d6b94, 0xa5863dbe, 0x851a9084, 0x883b2f86, 0x54ecad7b, 0x5a400cdd, 0xef25f16c, 0x130246f9, 0x3f191cec, 0xfc28ec86, 0x82de6ba2, 0xac81d601, 0xbd857907, 0xb873a6c8, 0x4111306f, 0x064333a8,
+        0xd8783e3c, 0x20f0d762, 0x89c47cee, 0xd5274b23, 0xe8feae9c, 0x15a8cd6d, 0x59c7e536, 0x909cfb99, 0xef717397, 0xb3302c23, 0xed7f05c8, 0x06b20979, 0x967387e3, 0x1dfbf63f, 0x1a0d1557, 0x79159670, 0x5deb94f0, 0x165cc705, 0x469dd004, 0xfb7b3165, 0x441ef74f, 0x0e85dbdd, 0x39fe6fdf, 0xd48f9647, 0x00568f13, 0x19c2ba7f, 0xe49c219f, 0x821d6a06, 0x741869b5, 0x138080e3, 0x94136634, 0x2fae0485,
+        0x50cb865b, 0x5e67efe2, 0xfe77e3d3, 0x90a6b5a6, 0xfbe06771, 0x6d04b015, 0xf6ec9c56, 0x7d09503e, 0xaa905bc2, 0xa18687c7, 0xb9e5808b, 0x9a0345fd, 0x5583d01c, 0xbadf1e70, 0x85d46f88, 0xf5ccdc17, 0x45fa8d2f, 0xe40db014, 0xb7e7b033, 0x0a1aa83d, 0xc72c2884, 0xc2286d41, 0x14c09fee, 0x5e06359b, 0x38b979eb, 0x03f523dc, 0x3436b07e, 0xe4c953b6, 0x9fc4f8c2, 0xe2399fd4, 0xb9a70ad4, 0xf0fd5f76,
+        0xd598e42b, 0x98f0b2e7, 0x04d653f8, 0x3b5cf612, 0x33bdfb24, 0x4c619648, 0x781679fa, 0x900edd09, 0x60de81a2, 0x8c59f07a, 0x57240b3e, 0x90b4882e, 0x10588d1b, 0xf501b567, 0xc2e6e964, 0x50ec9fcc, 0x6714dcc9, 0x4e42a9f8, 0xac9e402b, 0xbb7fcbe7, 0x8d134b50, 0xeac8a6cd, 0x0d2c4be4, 0xfc74f80c, 0x4eb80dd9, 0x1bfdf37d, 0xf7276372, 0x211199c3, 0xee7527d5, 0x4fa756dd, 0x60c65c0b, 0x5c0e8829,
+        0x9e1fa22a, 0xd100e773, 0x90023026, 0xb13969bc, 0xd49fa07c, 0x6a138ad4, 0xf52bbe8d, 0xcbfe9e11, 0x135456aa, 0x3c5fe1e7, 0xe355910a, 0xefe3a6e0, 0x8ffc8bb7, 0x99246904, 0x31c141ed, 0x5d3c1c46, 0x38b12142, 0x7350b687, 0xb4ace326, 0x01e6a21b, 0x98c55b96, 0x1526525f, 0x96177fc4, 0xde5ccd35, 0xf7ef3b83, 0x250b3904, 0x94ed230f, 0xd19e699f, 0x198c8307, 0x5957eebd, 0x2aa67b9a, 0x3797eb5d,
+        0x1a22d1a6, 0x2de17710, 0x2570734a, 0x20cab4f9, 0xabebab2a, 0x3726c610, 0xa3cd6b14, 0x50f58019, 0x5f57ee18, 0x26da1ed4, 0x29b20aec, 0x77882d11, 0x63b78133, 0x76be8628, 0xcccb43a2, 0x32a0c82e, 0x6658e14f, 0x10548653, 0xc14f7be2, 0xf3a48251, 0x4b92e8c6, 0xbc299836, 0xa3d76d6f, 0x39daea27, 0xe29709b9, 0x79c47f4c, 0x35ab2f46, 0x774feadf, 0x7af8a48f, 0x6fff1290, 0x1cecc0a6, 0x8461715f,
+        0x21e2fa08, 0x574c6f7b, 0x106273be, 0x916020c6, 0x144cd59a, 0x4147d16d, 0xa080116b, 0x72ae5c27, 0x694d2edc, 0x64584dab, 0xa37a9d19, 0xc763dd40, 0xdb47513b, 0x7148cc69, 0xc379a756, 0x13627a43, 0xf9e5a421, 0x1e4a8c15, 0xc812d326, 0x621e2926, 0xef826164, 0xef58d383, 0xbd39138f, 0x8697f43c, 0x40ed399e, 0xf8c01f27, 0xb820c971, 0x1205c188, 0xb18a0afe, 0x9aed257b, 0xc5f83b1a, 0x9a280be1,
+        0xbf499e68, 0x9033417f, 0x51819792, 0x64eb94fb, 0x82ab9a6e, 0x60b9c0e6, 0xc5e7af59, 0x0f523da8, 0x92a409db, 0x77f01131, 0xf42f890b, 0xd3baeec8, 0x2bec298f, 0xe23a5352, 0xe8408f3f, 0x39f79839, 0xc09173a9, 0xdc9438c4, 0x4942c7ae, 0x6825f6e6, 0xa09df6cd, 0xb6581dbf, 0x767be412, 0x4d45d42b, 0x2122ee3e, 0x6aadf97a, 0x8ca4793a, 0x35acd13f, 0xf831c344, 0xa1dbe433, 0x71301e7b, 0xfd5b17cc,
+        0x9749697b, 0xfdc1fc43, 0x1c688bc1, 0x71159b53, 0x3329850e, 0x7f3b19f1, 0x29b803e5, 0xa95626e0, 0x0970cc96, 0x81a1c2e5, 0x45d14898, 0xc46c19b9, 0x3aea08e2, 0x92a990d9, 0x5bc995b3, 0x837fb718, 0x22644873, 0xd44a7ac8, 0xffa3e54f, 0x0ab20cc7, 0x83761a4e, 0x671d6d46, 0x6349e53c, 0xd5b0f495, 0x3ff659a5, 0x818ba0b3, 0x5d606a2a, 0xf67aa44d, 0x6628a285, 0x8473c516, 0xed220bfc, 0x67a4685b,
+        0x7ed75061, 0x0936790e, 0x9bf3ade9, 0xb4634aa3, 0x013b20b4, 0x0dc47fa2, 0x9675646d, 0x6e3d2137, 0xc707c6ee, 0xf4894a6f, 0xa83d2837, 0xcee44b37, 0x873fa1aa, 0xd720cd8a, 0xd365debd, 0x92780b9b, 0xf6620f26, 0xe055cfa6, 0x50510852, 0x691f704e, 0xcc0dc438, 0x6fdfdac1, 0x490147e1, 0xb0c71373, 0x03d0269b, 0x5a40fb7e, 0x181a32c3, 0x20499d9f, 0x54273122, 0x00f4c2c8, 0x4e399835, 0x81beb206,
+        0x049d193b, 0xc09b2bad, 0x29866cb6, 0xdd6f79e7, 0x71a94b2d, 0x08afd9dd, 0xc44b0a6e, 0x4351aa9f, 0xae66c9f9, 0xcd73e423, 0xb6ebe115, 0x35092675, 0x75b43315, 0xd30034c8, 0xeb552cae, 0x0f81ae46, 0xfd2b655c, 0xe8682570, 0xeebef246, 0xd78bb37c, 0x762664f3, 0x1a9332ce, 0xe7a8faad, 0x9d44bc50, 0x62ee7eca, 0xf0812fed, 0x9a5f4afa, 0x97ee56bd, 0x8f71110e, 0x4de7aa21, 0xd888f45b, 0x40078775,
+        0x48e8fa3a, 0xf390a13b, 0xa9cf3da7, 0xb2f82f8c, 0x9a2d9797, 0x1f73acc8, 0xa80df4b1, 0x39567b47, 0x4f57d71e, 0xef28d9df, 0x54e69bc8, 0x492fb659, 0x302db327, 0xe4d8e6a0, 0x19c6634f, 0x297d0487, 0x495c4140, 0xd67f1ca6, 0x5ad5e423, 0x4e8c8b8f, 0x8927adbe, 0xdd7c29cf, 0xfda73aed, 0x23e22269, 0x0736add5, 0x44af2976, 0xb5a3e3ff, 0x145bcd10, 0xe7b85ecb, 0x627fbaf7, 0xdda6fe8b, 0x5e60842b,
+        0x1e81e179, 0xc6ea8a90, 0xf48cea69, 0x1da5c9bb, 0x70dedfd1, 0x6f04fcd9, 0xe031d253, 0xa9aa9bac, 0xdd6d7892, 0x58d4cc53, 0x5aeb25ef, 0x4e15462b, 0xa192d050, 0x36bb48cb, 0xdd531994, 0x14faf8b3, 0x055fb6ce, 0xe9a7ce08, 0x13aa7e0a, 0x16940935, 0x60705b5a, 0x89493c98, 0x26318e47, 0x8d990e72, 0x08ba92ed, 0xdfa8ec98, 0xc8418455, 0x783fa499, 0x53c6555c, 0xa1da3a30, 0xd14620f5, 0xaa7c44ee,
+        0x2c724c4d, 0x756f7e84, 0xad160d3f, 0xef314870, 0xe0275a74, 0x2b7d3b73, 0xc1d4f0f0, 0x3e897e45, 0x3ac8c025, 0xb3bbe469, 0x5be3baa4, 0x0f7fe1a5, 0x5cf8526f, 0x994ac3aa, 0x447726c2, 0xc3fd08ad, 0x56597942, 0x66c125f1, 0x16430d86, 0xb89137fe, 0x739969c7, 0x8c6c77e3, 0x7464dc8e, 0xce7e18ca, 0x076edf10, 0x257b84cc, 0xa3191ba7, 0xda404b5b, 0x0f38b0e1, 0x4c1faf01, 0x2b506fd8, 0x033c3a63,
+        0xaf472be0, 0x6efba892, 0x8df81f84, 0xb73ea70f, 0x018b9065, 0xe146a0f0, 0x49bff2c4, 0xa7f26ad4, 0x60699d89, 0x8f7e9404, 0x25809150, 0x1b2dc003, 0x1314a294, 0x87352198, 0x75f33ed2, 0x0a15a548, 0x5ed22a9e, 0x10bce129, 0xd316338e, 0xb9f94f0c, 0x899befc5, 0x79cbfe6c, 0xd148bbe0, 0x41b5792c, 0x75db849b, 0x8f61ccde, 0x0397b840, 0xae7a54cc, 0x0146944e, 0x78f4c514, 0x2a8dd6a9, 0x43cc9dd1,
+        0x5dae2af2, 0x8b33ebf6, 0xb7dca45b, 0x5ff801ba, 0x28cffcd7, 0x515bfa3b, 0x475d913f, 0x6e68a055, 0xa51aafa0, 0x25f8ff82, 0x49863608, 0x5fb67d6e, 0x526a1001, 0xfd307d6b, 0x27c96531, 0x1d6a1fbe, 0x633de437, 0xf8e041cb, 0xe54ec457, 0x24797288, 0xe344b09f, 0x01e9d400, 0x64c3d7dc, 0x8f3552c1, 0xaceacc69, 0x82e11b6f, 0x40911c0e, 0x2af95329, 0xf33264e9, 0xdc5ceec6, 0x9feb2bc9, 0x05bd5e8e,
+        0x34fa8a47, 0x8475e2e0, 0x1c125c48, 0x9629808a, 0x90db8537, 0x1870e9bb, 0x463ab6ba, 0x274ff873, 0x1237e2e8, 0x856680f0, 0x2890222e, 0x137b0f78, 0x0cad5ca6, 0xa52ef10e, 0xae4e65a9, 0xaff6c17a, 0xc8212608, 0xfdc81db5, 0xceaf7c53, 0x4eb955b2, 0x43da8d72, 0x139df938, 0xe559a9b2, 0x996dc899, 0x9ba4f9ee, 0x63e4d190, 0x03afc5f2, 0xd7e93a5d, 0x581244a1, 0x06777734, 0x889e4085, 0x49ac0dae,
+        0xa0b50c43, 0xd0b66568, 0x725d603e, 0x808d3e2d, 0xcfa49e8d, 0xaf624710, 0x2513727f, 0xadd6228f, 0xf98e6ae1, 0xea44be72, 0xd5714ca3, 0xbff26f3d, 0x5710deb2, 0x1a9bb444, 0x9dc1d7f3, 0x5355d23c, 0x4dc2f6c3, 0xd2a78b36, 0x16d70a9a, 0x440314bb, 0x8582b704, 0xa0ef7449, 0xd3464e4f, 0x7c72f599, 0xc390b1ec, 0x9e5f337d, 0xf2987d51, 0xdeb706e0, 0x55635aaf, 0x30817db3, 0x63c5e518, 0x34eae6da,
+        0x26817543, 0xffb37461, 0x556da738, 0x2a1568ec, 0x8dbde55f, 0x6565865a, 0x8ce0107d, 0x03aae96d, 0x29115a88, 0x2d134694, 0x1df9934d, 0x94358754, 0x660766ba, 0xbf4056df, 0xd4d58435, 0xfcb66ced, 0x2f5c3d2c, 0x766219c1, 0x80337edb, 0x96931d8f, 0x20562546, 0x816ea216, 0xdd584a5e, 0x8893f8dc, 0xc442e441, 0x76c7aa3d, 0x9079793d, 0x54b339c9, 0x63bad19c, 0x00308720, 0x7d79a965, 0x93d978ad,
+        0xe30c2583, 0xb208e5ce, 0xe7b13e8a, 0x156a7d88, 0x7f966b29, 0x3f45a9b7, 0x877b6ac5, 0xdba3dc4f, 0xe8e2257a, 0xae2483d8, 0x941f0702, 0xfab1506e, 0xc699da52, 0x077048c3, 0xa9512888, 0x9f87a263, 0x783b74e2, 0x8ca559cc, 0x3842b0cf, 0x9fa448f3, 0x9a435229, 0xa375934d, 0x2f2b98e9, 0xe95f2cce, 0x328fff3e, 0x46189a34, 0xdcab8474, 0x74716c03, 0x202a8cad, 0x2aaed027, 0xa544bf6a, 0x2a34bf09,
+        0x6ff41614, 0x998ccfef, 0x9cd3af81, 0x52261ff8, 0xbccba5c2, 0x260816a3, 0x4da3b8c1, 0x58ebb552, 0x0affee9c, 0xdaa363ae, 0xd5e3d24f, 0x7d536370, 0x5e8afb06, 0xcaa4f369, 0xa94d887c, 0x258640a1, 0xe54de684, 0x51e20928, 0x462b5b24, 0xdf79ccd2, 0xff76465f, 0x5d419725, 0xd5982ee3, 0x32f43830, 0xca957fea, 0xcc3c6813, 0xa817c533, 0xdda2055c, 0x8b2e27b9, 0x6bbd002d, 0x62fd8c2e, 0x861533ef,
+        0xd27dcd50, 0xad4ee64e, 0x9867d7a8, 0xdbf855eb, 0xc819a55d, 0x2caf6f01, 0xfcd83d44, 0xf143aa54, 0xc9cb005d, 0x2ec7cb46, 0xda5905f7, 0x9211978e, 0x7c511f47, 0x9f15526d, 0xdfae7a5d, 0xe0c96f17, 0x557700bc, 0x013bdc47, 0x348fa3e9, 0x951874e8, 0x7e8e2f46, 0x76f6c609, 0x07fd4f7a, 0xa88a86b2, 0xd3dbeabb, 0xb37b9ddc, 0x43a6601f, 0xe6a71ffa, 0xad7098b0, 0x1c4a8589, 0xcb3ab167, 0x82921b9a,
+        0xae8d51c1, 0x6033af2a, 0xa6982850, 0x53635426, 0x3cc26d66, 0x8f7407d7, 0x7a371d44, 0x50a2086e, 0xefb92c53, 0x3bb8ac7f, 0x3db8f5aa, 0x76014d76, 0x35887cb3, 0xc9f88909, 0x45c0ba17, 0x7f10d7f0, 0xc69bf865, 0x8184a1cd, 0x54d760f3, 0x1eb35071, 0x9a631a8a, 0x3db89c55, 0x2f1b991c, 0xf1acbdaf, 0x1663b41d, 0x2ba903f4, 0x4f151408, 0xa8623dc4, 0x3b1ad8c2, 0xdc7d029b, 0xe8c07b9c, 0x70896781,
+        0xefd7a710, 0x4ca8bed6, 0x0829363e, 0x9373c7e6, 0x97f940b5, 0x6160bbca, 0x0b37a005, 0x3ad09d4e, 0x6cc66ed7, 0x40c0c1d0, 0x858659c2, 0x3a0776c0, 0xd7207bfb, 0xe6b8ea70, 0xa001f1fa, 0x7723c9d3, 0x41551800, 0x628e550a, 0xe799d851, 0x360d72a7, 0xc46dcff4, 0x8efbfc65, 0x900ad8a0, 0x403d9974, 0xe5abda84, 0xf3b42d26, 0x5e3a73c0, 0x0f7098ff, 0x56758a12, 0x6d703dcb, 0x9e6d4df8, 0xd89e7ffc,
+        0x163ec786, 0x85e3059c, 0x60209b35, 0x90acf756, 0x2ff834b0, 0x23d4e93c, 0xcf7ead49, 0xd048d303, 0xb926cb22, 0x86f701d5, 0xacb7702b, 0x9c616828, 0xe9faafa0, 0x4179e8b1, 0xd22a7e5e, 0x6bf8f39f, 0x8c7937c8, 0x022ec883, 0x03fa88b2, 0x74ab4c71, 0x183d5d75, 0xc4d71360, 0x83c73311, 0x59b22dae, 0xf3d5e6ff, 0xa9b8a5f9, 0xd7d2dbc8, 0x4f942b82, 0xef5cf677, 0x4e51ce2b, 0xf931998b, 0xb0590bcd,
+        0x5f5de3ae, 0xb1dc3806, 0x52268c35, 0xa025f432, 0xc882ef33, 0xb66259b6, 0x36542994, 0x547b0ea0, 0xf58affbf, 0xdfb49cbe, 0xee23bdc0, 0x37c4f92c, 0x5da07286, 0xdd0d50b7, 0x584c2da9, 0x4edddcfd, 0xb1539546, 0x6405fa52, 0xb77359d3, 0x8ff5a84b, 0xcce34fb6, 0xb6211f3a, 0x97fac9da, 0xa6064a1c, 0x18e07622, 0x56b3b6ce, 0x8f3bfe33, 0x1b0118e4, 0x0b07f190, 0x94ddd3d0, 0xc1f42715, 0x426600c7,
+        0xa8dea918, 0xa380a6ca, 0x99762a96, 0x176e14d9, 0x3a1c53e8, 0x969079ab, 0xb6b5fbf3, 0xf7c394ae, 0xb978fd73, 0xd0d0a59a, 0x581eab2d, 0xd70dc986, 0x08625ba9, 0x6fe825cd, 0xd7f7354a, 0x746142b1, 0xc5326363, 0x43527a38, 0x827833bc, 0xacfdadb1, 0xb4fb8bbf, 0x0e137a4b, 0xca8a5f86, 0x4dc0f8b9, 0x54a6b99f, 0x589c5f04, 0xe9e69d3a, 0xaee341d6, 0x93a2efb4, 0xd5f2b575, 0x49b46c19, 0xa55b4d77,
+        0x44514161, 0x3a288fce, 0xe3e2b782, 0xb4f0f720, 0x5db8ceb6, 0xe1f2f846, 0x2667689c, 0x7caffb60, 0xf2428619, 0x5bb7b48d, 0xa69d24ac, 0x3a4a995c, 0xfb7269f1, 0xd7b92b4b, 0x319f15c7, 0x051443f5, 0xd4287993, 0x2f3ffb4d, 0x7e69d051, 0x83c24ac5, 0x973d4309, 0xde02ec62, 0x0b7df2c9, 0x9d1bdc68, 0x90805453, 0xb5c4364b, 0xa22ff59e, 0xf4fbb214, 0x7f83774c, 0x7bcb4024, 0x0f437e8e, 0x047c1c98,
+        0x83e1bc1e, 0x2260add3, 0x0d9e2ef8, 0xdb28d68c, 0xd7f842e3, 0xa5178aca, 0x983c79a6, 0xa5e95444, 0xb0e69c3b, 0x713e7c04, 0xa5b0a741, 0xd2a43ac1, 0x9f99c0dd, 0x48eac148, 0xf4300f16, 0x83022730, 0x2d4c339a, 0x9b7f1eea, 0x79936315, 0x78897277, 0xd7a7c349, 0x86995394, 0x7f38ff3c, 0xdf734027, 0xc32cf4d0, 0x51efd7e2, 0x2e0c6f9d, 0xe76acbac, 0xb10e24a9, 0x282796cd, 0xea17bf5d, 0x5db4905e,
+        0x29a3eaa3, 0xfc59231c, 0x6d97b51f, 0x8e781be8, 0x0ab6cdd9, 0x6628faec, 0x39ca81ad, 0xae7b633f, 0xaa88d496, 0xa29b204d, 0xdf10754d, 0x75e56558, 0x58401df2, 0x1275a20d, 0x06f9f575, 0x0a562f03, 0xe7c09acb, 0xd2feb973, 0x78978906, 0x7899d8cf, 0xe9142b92, 0x0675b4e5, 0x53f67b8c, 0x347f8d74, 0xb0ec297f, 0x60bd6562, 0x04777882, 0x57207a38, 0x832929d0, 0x24ebb90a, 0x54f1bdb3, 0xecc790f7,
+        0x560b7733, 0x0c9aab77, 0xf40e7526, 0x19852ff0, 0xc0211f41, 0xff0bcedc, 0x557c0eec, 0x650a7371, 0xa20153b4, 0xbd04d7b6, 0x6a613408, 0xef0ae3cd, 0x93957da9, 0x0c79f388, 0xf5a1d393, 0xf86e0428, 0x9da83ad2, 0x1b5b21c6, 0x268c45e8, 0x22669d42, 0xd698e885, 0x77d93f98, 0xb9e5fa1d, 0xc189e961, 0x1bdd582f, 0xb6ff8a25, 0x294e55a1, 0x2c01ab31, 0x4c08ddcb, 0x4093de3c, 0x6c6fe61d, 0x919ef7a3,
+        0x87462ad3, 0xaa4a9c3a, 0x466cc81f, 0x54f59846, 0xd3f4ee18, 0x11d5b1c3, 0xcaf3f0c9, 0x1d52bf5f, 0x46145922, 0xace7826d, 0x9d9e25f5, 0x8c6c49eb, 0x19ff3a6a, 0x6ca65c5e, 0xab82b580, 0xe1ae4a99, 0x58eefbc1, 0x141474f4, 0xab641051, 0xc9d73ed0, 0x4b98ed62, 0xe18d70c0, 0xae3086fd, 0xcdb99fb0, 0x64ce4fd5, 0x5c2fe801, 0x644e34cf, 0x02347ed4, 0x34fb8c12, 0x06569d80, 0xb97a29bf, 0x79e8991f,
+        0xd1bdfee9, 0xf3469e66, 0xed2d3ed8, 0x39a35f7b, 0x839d5e3a, 0x387e0586, 0x3171d6a4, 0x501791b7, 0x9a57b6cb, 0x0445cf72, 0x32bbefdb, 0x90475a13, 0x690f7cfa, 0x0739a4d4, 0xda631c74, 0x611d2a41, 0x6dd84de4, 0x0e033787, 0xecf7f5e0, 0x6b5afaf3, 0x5f820565, 0xb81fee43, 0xb2c04635, 0x40d00e31, 0x96b027d4, 0xacac0421, 0x19d25d1d, 0x9e980154, 0x6992b7fa, 0xf772fb47, 0xecb9ada3, 0x4b9bb794,
+        0x0e388e40, 0x591280a7, 0x6250f0a7, 0x118d80d5, 0x3d9a9730, 0xae86d728, 0x3a51aa35, 0xa4710bd6, 0x5b6c3dd4, 0xfbbedc08, 0xec91fc5f, 0x2f0a3df1, 0x80a3bb4c, 0x5e300c69, 0xcda0fb7b, 0x0e5df67e, 0x59ab6d82, 0xabe2ddfb, 0x756c3792, 0x7b917041, 0xf37b1222, 0x2a7fe128, 0x220b32d1, 0x9e14d244, 0x11ffa7d4, 0x25f3f109, 0xb4c1c0d4, 0xe48f27b4, 0xee8412a1, 0xb8ee712f, 0x1be0ee30, 0x40018d49,
+        0xa6d59abf, 0x7270c4c4, 0x25645408, 0x9fd10cd9, 0xb1a78deb, 0x968f54c9, 0xa02836f6, 0x09d64e1b, 0x0b3174f5, 0x41b87130, 0xcc44bc73, 0x2214ddc3, 0xfc784de3, 0x5c3e21c8, 0x6fce822c, 0x5494cdcd, 0x584175e1, 0xf5fddc40, 0x0c7e8ec4, 0x53ce9a18, 0x39a6e5d4, 0xd5df02c8, 0x94bd433d, 0xe3fef183, 0x99f3bbe0, 0x93b92bc5, 0x40a50bcf, 0x86c68206, 0xa782ef40, 0xe2b14318, 0x0f626cc9, 0x4f1bb916,
+        0xf0c501de, 0x955f678b, 0x17b01569, 0xeb20f389, 0x557f93e0, 0x1feb215a, 0xa6ab306a, 0xe569492e, 0x81004be4, 0x84a9255f, 0x87eab5cf, 0x1cfcb26f, 0x610e40a0, 0xc70cc07e, 0xc4d71da4, 0xfe58e751, 0x4852a891, 0x3a359578, 0xa636bcfd, 0xdb91beed, 0xec143d23, 0x702b7fe1, 0x54a6e9ac, 0x338ae579, 0xd03d8be0, 0xd9a51757, 0xc9a27c89, 0x1adef963, 0x1fd3990f, 0xbaf5613e, 0x284a8ce7, 0x1316862f,
+        0x6a3d53a1, 0x22e6569d, 0xaff50ac0, 0x974a3f92, 0xa85f487b, 0xd5226a40, 0xae13015a, 0xb507ec76, 0x02672a42, 0x762ec1d1, 0x20ec8e89, 0xc230eeaa, 0xc38f5e55, 0xe820b419, 0xd787c62b, 0x4e5393c1, 0xbf3805f5, 0x20ed4ae4, 0xf1cc4a2b, 0x9ca65ee9, 0xeb72643d, 0xd0d87248, 0x391b659b, 0x6aa4d4f6, 0x82801a20, 0xcb39bc80, 0xc9a95768, 0x1884ee17, 0x85bf689a, 0xee586fc1, 0x9e0d660e, 0x238beaa8,
+        0x8ee8dccc, 0x92d6b724, 0xbb224b13, 0xdc63079b, 0x103b1ee6, 0xfad5bb16, 0x7e27421a, 0x04c12efd, 0x3adc4d5c, 0x064d671b, 0x565f430b, 0x714f9d5c, 0x8d3827b0, 0x6a919280, 0xbe622f2e, 0x3f302578, 0x698cdb3a, 0x8c672c13, 0x81f34672, 0x4c42e1b0, 0x21045559, 0xd2e51010, 0x36ff782e, 0xb7a6bce5, 0x4af6e23b, 0x27653b64, 0x7330f5ea, 0x9710a841, 0x3d8320f4, 0xc293229f, 0x43653c41, 0xe5552568,
+        0xe43ec17b, 0x1b169421, 0x960d4292, 0x1b24baeb, 0xf04cfadd, 0x84d28634, 0x9e3a7b89, 0xd971f251, 0x402f1f7b, 0xdb1ae7ab, 0x1a3fe4ff, 0xf2a0997f, 0x8bde8135, 0x7a56ebda, 0x71513900, 0xbae49945, 0xb1068bd9, 0x721359d7, 0xc26a9fc8, 0x9f131411, 0x6640779b, 0x3280222c, 0x9142012f, 0x4023b0ad, 0x34a125e3, 0x5131dc36, 0xf18b175d, 0x6485c73d, 0x83474bdd, 0xbfdbb644, 0x46b818ff, 0x4c4d1e49,
+        0x3aa8e3c4, 0x219c4529, 0xf3f31ddd, 0xbdb786be, 0xb07de229, 0x62df693c, 0xb537261b, 0x344fcf40, 0xa82c08cb, 0x3cc959e5, 0xc76a6927, 0x1e83dc6d, 0x9499a703, 0xf66db933, 0x80d3b0bd, 0x31d73478, 0xe0f488e1, 0xd585d697, 0x649852d8, 0x42bc6a0c, 0x3e1d5c50, 0x8e33a58c, 0x4818aede, 0x2c88123f, 0xe79f12a0, 0x74dce9e9, 0xb3e285ef, 0xb47e7035, 0xda61dc3b, 0x910d87fd, 0x60f16a2e, 0x256b1eef,
+        0xa20db4b0, 0x0b4f1889, 0x08141bf1, 0xb5fe29b9, 0xeb875178, 0x43206130, 0x784154e9, 0xa1936755, 0x85186008, 0x6c32d0ff, 0xc42d07db, 0xb13f5979, 0x56124a82, 0x207cd425, 0xa0408f96, 0x98c61072, 0x53afd989, 0xc49098e6, 0x4fa4b2ca, 0x6c4c0adf, 0xa56564cf, 0xabd3c8cd, 0x6f066a2f, 0x8847bc3a, 0x1a56c5d0, 0xb93ff5ec, 0x3c7463d9, 0x35831a22, 0xf8c6c1d9, 0xf9f998c1, 0xb2eaf0ff, 0x53003a39,
+        0xa8d1bb64, 0x127d0bb2, 0x537b1d89, 0x4a33a0b4, 0x05130c8f, 0xb0a1d77b, 0x920a7de7, 0x2e7ea132, 0x094d3e71, 0xfc89f16c, 0x43c62e3f, 0xb89078eb, 0x30cefda9, 0xdc59b1e0, 0x73054cd1, 0xc7fb33fb, 0xc4c695e5, 0xbc601ef5, 0xa0c06d27, 0xbe62bd8b, 0x509032d7, 0x4dcd4f0c, 0x4ac356b1, 0xff5712f6, 0x140767b6, 0x0f6229a8, 0x2c0482cf, 0xa503d874, 0xb8a5d430, 0x2fa1e934, 0x16e61a5d, 0x1582a2a8,
+        0xeaf5bd96, 0x96e081ca, 0x6dff4f01, 0x2032af6a, 0x1468b7d2, 0xa57e117e, 0x92780974, 0x0a50c8e0, 0xd4ef07dd, 0x3d08c424, 0x58ed18a1, 0x8c3c22a9, 0xc7a6ce5e, 0x40a3cdcb, 0xb555b85d, 0x1e6e884a, 0x9747ff92, 0xc8c689ba, 0x6082a8b3, 0x60e660d9, 0x64d1b788, 0x0da2a235, 0x6da5a61d, 0x2b964fb0, 0x6c4b6809, 0x2000155d, 0x380b6bf9, 0xeae38e8e, 0x7f2bf7d2, 0xf3ece267, 0x0a34e6dd, 0x5bf9ec26,
+        0x9097d07b, 0x31d3379a, 0x0c94a214, 0x5b58b94f, 0xdf4dd2da, 0xa83a5de2, 0xdc2a9537, 0x45dc2e25, 0x5698128b, 0x92d72dcc, 0xf95a0f79, 0xce169759, 0xf46c2283, 0x5507cb4b, 0xfd164407, 0x24a7f392, 0x28602f7b, 0xf83d3452, 0x00bf41cd, 0x588f723f, 0x3f88b8d0, 0x6a33d356, 0x58a67821, 0x3b968f38, 0x3bbc15ec, 0xe3046a56, 0xc18215a7, 0x59a01387, 0x39d6658c, 0x2d137e2c, 0x72cd2d3c, 0x89f6d463,
+        0x426af580, 0x455305ff, 0x5885fd4f, 0x0137db4f, 0xe7280e31, 0x9771b1f7, 0x03405d32, 0xaeabdcc7, 0x21d95a97, 0x5d7930d3, 0x635812e8, 0xc7e7a98b, 0xd732f05b, 0x1e86d31e, 0x36989ecd, 0xa2b2ea2e, 0xef6b8586, 0x00e661d1, 0xf844d678, 0x7c2bd41a, 0x6010f1d0, 0xc7c965bc, 0xfc1ff8b1, 0x165c2ca1, 0x1f410210, 0x8c4685a4, 0xc2ce1bd8, 0xbdd841ce, 0x94510c1a, 0xccff7e0d, 0x9f041d61, 0xdcc480ac,
+        0x7d6a5d41, 0x171db298, 0x386f6f34, 0xa23b9a74, 0x24e5fb4d, 0xd4432d13, 0xa29ae00a, 0x0bf72df7, 0xcd6b1d6b, 0x4ba72819, 0xab6dbd8d, 0xca976574, 0x78baf8b9, 0x7c5a7b9b, 0xf1c95143, 0xab40a145, 0x976b4a49, 0x34083ef3, 0x3a0c2437, 0x1743f53f, 0xaf106150, 0x014551ac, 0x5215a67f, 0x99d548a8, 0xbfb92035, 0x6838fc2d, 0xff865026, 0x832e6898, 0x450d3eab, 0xa1025bad, 0xee8f022b, 0x4e80ad32,
+        0xb2466c1c, 0x0f539edd, 0x1862e985, 0x94cace15, 0x3ef17a9c, 0x55ba9e94, 0xef45b7a6, 0x06f1b451, 0x7ad3236e, 0xb03c0438, 0xe1ed569f, 0xa5ddee50, 0xc7800773, 0x4b38bd40, 0x04ae40b6, 0x78b40972, 0xc550a45e, 0x49cc99c7, 0xaf907be7, 0xa42e813b, 0xde1f6da5, 0xde22adb4, 0x949c4828, 0x09be0cbc, 0xa0486722, 0x3804549c, 0x1c742467, 0xbfa74678, 0x36b4aa28, 0x1d9f4aa0, 0x094f8768, 0x8adc3f51,
+        0x71cdb245, 0x619fdd50, 0x539ace40, 0xd46dfe82, 0x498c1d48, 0xf8400f26, 0x7f177a5d, 0x0f14b9ec, 0x2e843b44, 0x5ff9d6cd, 0xef0cfbe7, 0x7472c104, 0xf0afb87a, 0xe75be429, 0x976a1fef, 0x202e75b7, 0x0034fe52, 0xe5ff18bf, 0xe72b6e2a, 0x9756b679, 0xaed21271, 0x1a1f1579, 0x12e7e66a, 0xd869f644, 0xff130851, 0x7bed0143, 0x50804076, 0x9461ac49, 0xcf290819, 0x0f207281, 0x7621a07b, 0xeb42c91c,
+        0x964ee73f, 0xb9ad30d6, 0x7a43b303, 0xb415ba4c, 0x8d6d99ef, 0x543c85e8, 0x2ce18b74, 0x8e7ebdd0, 0x9655ae03, 0x195968bc, 0x27a112b7, 0xcc3833d9, 0x72092dae, 0x32ce51d8, 0x89a18eb7, 0xe1cf294c, 0x763f15fc, 0xfeb77149, 0xd58836dc, 0x07b54aca, 0xff05261f, 0x14e25200, 0xf8e5003a, 0x667c983f, 0xbef53a3e, 0xa47b4c1b, 0x333060f6, 0xedcaf1fd, 0x094cdf6b, 0x84bf970d, 0x30485b24, 0x3231cbc8,
+        0x93da2485, 0xf1ca558e, 0xa0d674c9, 0x6312c2c4, 0x5d61e0df, 0x5e1ddd48, 0xa2f5772e, 0xc9880641, 0xe42bcecd, 0xedb4ef88, 0x40e691b5, 0xcfa2144a, 0x494ed864, 0xbadef5aa, 0x201b788a, 0xe21f7a28, 0x87509c5f, 0xdbd1aeae, 0xd21dbe97, 0x53452976, 0x4cbe15ab, 0x2a52fb1e, 0xc9a55350, 0xb051a77b, 0x6fe00e57, 0xa934f138, 0x8cf02bae, 0xe00563f5, 0xfc71ff8a, 0x3812550b, 0xb0957c83, 0x81c1aab4,
+        0xf85ae24b, 0x0230f239, 0x18913798, 0xccb9c121, 0xe5e95f6a, 0xa3c0afba, 0x0ef62065, 0x3712a6e8, 0x1f91c745, 0x0ef427b0, 0xa1773e1e, 0x4419b446, 0x5ebf2893, 0x679697c9, 0x51cf7d04, 0x83057a58, 0xcbb29fb2, 0x50b4b7e4, 0x4d3c86c0, 0x59814731, 0x9b829be6, 0xa963b7c0, 0x7643d000, 0xe06e77f3, 0x4ae75ac9, 0x390a90ca, 0xd51968aa, 0x134b71d2, 0x920dfd26, 0xc37ed7e1, 0x120cd1dc, 0xd8f082f1,
+        0x442d00db, 0x16dadc34, 0x2bbe73e3, 0x8eadd873, 0x8f704eaf, 0x2aa3cb3e, 0x33bc3402, 0x4ea636a1, 0x7e0be1e5, 0x2a47e1d4, 0xbab7d2ac, 0xf092321a, 0xf47aa490, 0xadd2afb3, 0xc32a924a, 0x7daf1e3f, 0x147f5872, 0xb16a7938, 0xf030e78e, 0x930de5f8, 0xf9771e39, 0x4465fd45, 0x9b6b96da, 0x4b49f3e0, 0xf51e63b1, 0xed78a55b, 0x54a5839e, 0x657aa382, 0xe6b60915, 0xd3db66a2, 0x0017f63e, 0x30d92af1,
+        0x7bb83d56, 0x32e8c434, 0x25c0e7bf, 0x84026b19, 0x50a35255, 0x3c3c5a22, 0x2bdf4306, 0xa2b9c7e6, 0x97c8bfbd, 0xf86e760a, 0xa858ffac, 0x47750ca3, 0x59559e61, 0xcc306e5c, 0x0dbeda87, 0x85f5f08d, 0x0c133438, 0xf710dd65, 0x0e4cb294, 0x3cd6ec44, 0x124e9c2f, 0x93b30101, 0x0403500a, 0x076aea40, 0xf943071e, 0x27aef125, 0xbc1ba34b, 0x6cdc5517, 0xc09c57ff, 0xca301d82, 0x08873d8f, 0xcb7ad8c2,
+        0x1e1b6f2a, 0xd7130968, 0x42e4c570, 0x33d3334e, 0xe4b31c3e, 0x4eb155d8, 0xf8d8ffb1, 0x6059216a, 0xfe7ba057, 0x78b1c8e0, 0x58c6fc1e, 0x5b0caad0, 0x4ad45008, 0x8688de6b, 0x2fef7238, 0x90155eda, 0xbe3ef82d, 0x4485df1d, 0xb7d01334, 0x9ec4d7b3, 0x305b6797, 0xe3b35a91, 0x6f168c42, 0x3a1c16b0, 0x0babfdf9, 0x0cdc7109, 0xa7cd1c03, 0xb5de9330, 0xc7f261c2, 0xc0540a40, 0xdce70adc, 0x903fbb7b,
+        0xc90ce2db, 0x22be9fb9, 0x6ef959ed, 0xfa1e7d66, 0x590ad023, 0x84904c0b, 0x0e2df1ac, 0x5f7d6673, 0xd1c6ea12, 0xa73eb824, 0x1b2575b2, 0x4552bfa8, 0x018e118a, 0xb9ac68ce, 0x46692cea, 0xa9ae690d, 0xf15975c7, 0x8e931093, 0xac9c427b, 0x16d1e03d, 0x62ba823e, 0x89c48971, 0xdb60d507, 0x01796549, 0xacc152fd, 0x41af95e2, 0x9bac3d54, 0xbff1f991, 0x707e3639, 0x7845d84f, 0xf616c977, 0xe4835ef1,
+        0xd2aa0010, 0x8e9688ee, 0x02b01724, 0xe705f1fe, 0x2440fe98, 0x60141fdd, 0x7b996ceb, 0x2cafe2e1, 0x94a368d0, 0xf9155470, 0x4b01532c, 0x13725cf7, 0x705995fd, 0x039690c9, 0x65f4b516, 0x88db2b44, 0x232673b0, 0xa64e7892, 0xf3e830e5, 0xdc164209, 0x5c2be323, 0x1476a64c, 0xd64426a4, 0xfdd8a705, 0x0a94fa79, 0x2fc75a2b, 0x6c80295a, 0x95d5aa2d, 0x135d029a, 0x80a4103f, 0x50562bf0, 0xd88ed2c6,
+        0xf22beb4e, 0x3425a05a, 0xdac0bd14, 0x3bd139b7, 0x2c6c8911, 0x62737187, 0x892faaa4, 0xc71bfb01, 0x4b7ddbfe, 0x3c79a28c, 0xe722a139, 0x36d4d681, 0x14d5ce3b, 0x29d96a7c, 0xc997f462, 0xef4dd3df, 0x2ca608f5, 0xde76213c, 0xb8512173, 0x11ff0c80, 0x3b64c9db, 0xf36f898b, 0x3506f640, 0x5337be35, 0x37546f1b, 0xb02fc37c, 0xfa0714a9, 0x8c96dc3c, 0x61c0db5e, 0x133c2186, 0xa2a24b06, 0x4e0412b2,
+        0x0beb9ef0, 0x872216a0, 0x3b68d54e, 0xa3514b4c, 0xdff58a15, 0x06c51bcc, 0x75cbe6fb, 0x5b5b2905, 0x00c8c62f, 0xf682f622, 0x77066426, 0xbaef1cd0, 0xd2f66024, 0x356c7c1d, 0xdf33e49b, 0x8280abef, 0x4d133853, 0xd95a5da0, 0x3c6ad65b, 0xa9d5d5cc, 0xd4e25038, 0x13e29eb4, 0x70108e13, 0x2f8cb814, 0x81d07953, 0x28e82a92, 0x2f7b431d, 0x6cd07225, 0x26c89c5d, 0x65235647, 0xe82469f7, 0x0a8d3983,
+        0xfe24db97, 0x86dff7c1, 0x63dc6090, 0x85d8f22a, 0xd3a9db2e, 0x96c233c3, 0xf43d1fc5, 0x7bdd2268, 0xe4d2d556, 0x65a6d9db, 0xd74c2f9c, 0xd23b3e6f, 0xaeebb5ef, 0x30fd80d6, 0x2bfad6ed, 0xe3c25b00, 0x3cd0299d, 0x844b7b42, 0x6f2d4fff, 0x4a36a57b, 0x066a79b4, 0x7efbc15e, 0x44c605e3, 0x44c6c57c, 0xfaebb904, 0x60619926, 0x500c9cde, 0xc5f45290, 0x925e50c6, 0x6dd3908e, 0x9c95f5f6, 0x56d14862,
+        0xe6cb32d4, 0xd8349849, 0x6562df47, 0x4fc3cc63, 0xb15927d8, 0x93d2a057, 0x34592ec1, 0xc5bf9371, 0x10171ec7, 0x334ea120, 0x9f54ae88, 0x61aa7fb4, 0xb0220d0f, 0x6ae3a7c2, 0x4bfa1c53, 0x482d78e6, 0x9251e069, 0xb38b84f0, 0x50f3f62f, 0xa8f139c5, 0xcf3b42da, 0x2a5202af, 0x5d913fcd, 0xeb93d37f, 0xb2e3e525, 0x0fb628c6, 0xa228340b, 0x5f0e95c7, 0xf6eea7e8, 0x806a9e14, 0x33676918, 0xab2e266b,
+        0x99222d27, 0x3ebadd18, 0x156d96a1, 0xc4514fba, 0x8b5ec327, 0x6f195a31, 0xd89d3b01, 0x443124fc, 0x0a6b34b6, 0x485e01bb, 0x5450f749, 0x0d0d4e37, 0xb597f07f, 0xf6875da5, 0xdc3d5569, 0xd80f3d5f, 0x803ae458, 0x451a4ca7, 0xfea89069, 0x7ac2ca7e, 0x6dbb5c3b, 0x41567b67, 0x4470bd08, 0xaebfd6bf, 0x79135fd7, 0xb39940cf, 0x292d28db, 0xe900d91e, 0x28ad86ee, 0x4f5b8a2e, 0x44b20f29, 0x62042fd5,
+        0xc1d29ede, 0xeec2411e, 0x9bf2d441, 0x3528d26b, 0xf788ec42, 0xcf10f3d7, 0xc5f85987, 0x1ef47d47, 0x92a740be, 0xe17cff1f, 0x7341d8e6, 0xd4ba3201, 0x497c9293, 0xc67ae15e, 0xc09c6876, 0x0284ba1d, 0x1827db5c, 0x06dc5e31, 0x1b564f80, 0xba750e68, 0xbc21fd26, 0x3f4dddb3, 0x5ac68b02, 0x0b3c38ac, 0x94a46753, 0x8cffb664, 0x4c81ca2d, 0x5b52884b, 0xb6b3cb5d, 0x89b9661c, 0x5c48d2d7, 0xcba01066,
+        0xb7ecf6a0, 0x1e9bafdd, 0xfecd895b, 0x124a1f3f, 0x156d5eb7, 0xecda7a4d, 0x77dc576b, 0xb9a904af, 0x18037a36, 0x44688d2a, 0xb9a4c571, 0x09176af8, 0xe97bcf6c, 0x5d27308d, 0x161f4189, 0xece75d7d, 0x851b8054, 0xf41d78fd, 0x8d7939a0, 0x62a0f115, 0xaf65ed67, 0x2cd7ae3d, 0x4cb62d08, 0x2ce1408e, 0x9a14a861, 0x9138462c, 0x32d126e0, 0x290b4c1b, 0xa821411e, 0x1e468d83, 0xb2c7873d, 0xf53d5173,
+        0x75ad9d13, 0x437e2202, 0x285c59fc, 0x858be1bf, 0x6bfa27c0, 0x119e6d8e, 0x989704c8, 0xd5e8da31, 0x52845131, 0x1907cd8d, 0xd4aaa4da, 0xe6209915, 0x1f6848fc, 0x0cb29793, 0x404d60e1, 0x228b20e8, 0xf0070bd7, 0xac399477, 0xa7bbb9aa, 0x2e564f74, 0xc0bec45b, 0x3a0482de, 0xcf946ca5, 0xcb2f91b0, 0x0c65b186, 0x16e5f627, 0x6a2a60cb, 0x3e184a43, 0xb9b9a686, 0xb4a4e33d, 0x23986377, 0x40d21934,
+        0xa1ef45c6, 0x273df35c, 0x3f307a3e, 0xd8ecabdb, 0xd7086c44, 0x183d8689, 0xd6300f0f, 0xfc6d7013, 0x73fc8dd1, 0x9be9654f, 0x650ee885, 0xb2ab3fb0, 0xf62b1c11, 0xa4be6598, 0x0217f929, 0x2d875a35, 0x660013e0, 0xabc520f1, 0x7cdea4cc, 0x62c302d4, 0x9e3e35f1, 0xe9a4ae7e, 0x11ec2cc7, 0x57561ec4, 0x24873215, 0x645cc062, 0xa77b6581, 0x315823fa, 0x37e3cb1f, 0x020e47d1, 0x1e7f6e04, 0xd08b52c4,
+        0x0b0b0875, 0xaf154061, 0x2a620546, 0xea8bdef6, 0x82d7d634, 0x26154156, 0xde0546f3, 0x0e8cea03, 0xc429a9e1, 0x559284c4, 0x228c24d5, 0x736e1f4d, 0x109ea423, 0xd9b1d0e7, 0xac255a21, 0x99ee4c61, 0x7b71e9b8, 0xdd54d9c8, 0x7ed3b55e, 0xb52f2c3b, 0x5040773d, 0x3e67751f, 0x52d0f5bd, 0x256a4e50, 0xe8badd15, 0xda847948, 0x734942cc, 0x8147b866, 0xbfa69890, 0x36e6e0ea, 0x2f6cc310, 0xfd01945d,
+        0x15bd7306, 0xa38227bb, 0x34ffddb8, 0x618163de, 0x8f1518d6, 0x54678441, 0xa965332a, 0x4263708e, 0xf07045f8, 0xf4b0868f, 0x0a4d854c, 0xb24424d1, 0x29e585e0, 0xe90f1d43, 0x7028d9ee, 0xd6abce36, 0x535ef3bf, 0xe5f47303, 0x1705cea0, 0x57cdbe5b, 0xcf711b9c, 0x7f4bfe44, 0x66497f3f, 0xc9584270, 0xa7c2ad92, 0x7b2e5f70, 0x911ca7d0, 0x7d97f5d9, 0x00cc9827, 0x8a95db37, 0xa6bef875, 0xe79be95a,
+        0x512d4aa5, 0x14cd664b, 0x44143d73, 0x6de05db5, 0x75dfeef7, 0xb55d8e4d, 0x9f8779a9, 0x88721d66, 0xcd464433, 0xa88818af, 0x8fa873bb, 0x2006224d, 0x06598f97, 0xa6999c8b, 0xcb25775b, 0x6e398ec2, 0x45e92629, 0x4edae3d9, 0xd2aa515b, 0xf404dc44, 0xb0452043, 0x8b668975, 0x9a9959c6, 0xfa510cc3, 0x630f294d, 0x7bff4a84, 0x10c6ec8a, 0x2f1e9bc2, 0xffa3d0fd, 0xc52d053d, 0xa93a2c4f, 0x196c3267,
+        0x3aab0920, 0x639cbff4, 0x179dfee0, 0x8727760c, 0x3db0c717, 0x8745b9e4, 0xe70ece32, 0x7505d3a9, 0x37a41e38, 0x3aa18985, 0x7ac200cd, 0x73375a46, 0xe8c32ee1, 0xb1a75b0d, 0x319bb9eb, 0x1e45bba4, 0x72af50dc, 0xb5cfb315, 0x9e28257f, 0xf6518f8b, 0x981e586f, 0x3a5aacca, 0xaa76edf0, 0x6ae562b4, 0x4486b073, 0x1e2cbbfe, 0x6c828f5b, 0x4873cdf4, 0xcca07bf4, 0xefbaaeec, 0xeeac0da3, 0xdb59ce22,
+        0x783f82d0, 0x0bf7d379, 0x4e69e607, 0xbc950375, 0x707aac20, 0x1884b95c, 0x4e8e6130, 0x796bd3e8, 0x46674018, 0x884d9d0f, 0x2384f2de, 0xf07685e0, 0x2aa2dadf, 0xda188904, 0x7e73560a, 0xe166434c, 0x162a5654, 0x1bfd6266, 0xed45509b, 0x8164e30a, 0x26028a16, 0xecb6443f, 0x29152a27, 0x66bd3701, 0xb7bcbba1, 0x47dd9433, 0xacc5e227, 0x625b91a5, 0x5bc7efcc, 0x826e16fd, 0x17283fd6, 0x5180a910,
+        0x021c8b31, 0xe010988f, 0x5f6e7246, 0xad106176, 0xc9ce7f2b, 0x1e6c03f1, 0x728156c0, 0x46179483, 0x198100cd, 0x9830d317, 0xce4af310, 0x8306158a, 0xa8d20aae, 0xd95e6d81, 0x73ce2201, 0xbcd549b2, 0x888a6f95, 0x529ecc9a, 0x86d38012, 0x686eb2fd, 0xa132c737, 0x13d144cf, 0xa5853f04, 0xec580991, 0x311bd1b2, 0x0c6d821b, 0xcd3e4fe2, 0xec147194, 0x325279e0, 0xafb0f5a4, 0x694a8a3d, 0xa69aa3f1,
+        0x3c566679, 0x7cca79e2, 0x45af417f, 0x744a2cd4, 0x02381933, 0x94ba5d95, 0xeda3cfd8, 0x65685227, 0x852d1ac6, 0xaf2fd7d3, 0x76d0ef9b, 0xa08c5818, 0x86060b57, 0xc176c30f, 0x5639517e, 0xce54ba9b, 0x5516c97c, 0x40ac8f20, 0xfd006f58, 0x294b4b05, 0x794582ce, 0x578756a2, 0xbf324745, 0x3736b61d, 0xab826bf6, 0xb48c03c2, 0xcbabeac4, 0x9c0ad52c, 0x45c567e5, 0x4a2e4a20, 0x48aea97f, 0x9a6f36e2,
+        0xb79e12a5, 0x242859d2, 0x2f4460cf, 0x792ca0eb, 0xd56d9549, 0x9fbbc035, 0x2b6f2a8b, 0x8cbd1889, 0xf4093836, 0x4eb395b8, 0xb8f8e88e, 0xfed435fb, 0x225e1a79, 0x9f3cfdee, 0xda644501, 0x9338199c, 0xee836a7d, 0x0dd89db3, 0x906e6815, 0x27ec2896, 0x66194921, 0x4a714c3c, 0x710cdc8d, 0x87ffdd76, 0xb3a15941, 0xcfcf5b64, 0x42922d67, 0x637a06b2, 0x074db4d7, 0x104cb62c, 0xf2add97a, 0xfde65e18,
+        0xff04edc5, 0x892910a8, 0xc78c3736, 0xb62aae63, 0xfd49693e, 0x30b5d6a9, 0x7cd04551, 0x3526ad13, 0x20c378be, 0xdbb7c966, 0x76e0c604, 0xeec3b282, 0xbe1a6906, 0x849d614a, 0xac6364ab, 0xb5f83be2, 0xdfbd1ee4, 0xcb1862cb, 0xc21cb2ab, 0xddec5e2a, 0x9dff3256, 0xb5e5e382, 0x465a6be8, 0x51efbe83, 0x561ce424, 0x23007e59, 0xd5f1fa6d, 0x19a5d2bf, 0x62c9731b, 0xc32e71e4, 0x149197ab, 0x09567ac9,
+        0xdd96efe5, 0xbb704be1, 0x6f74acac, 0x37ee3a5d, 0x2c0d7dfb, 0xe066e509, 0x011991c0, 0xd1842a47, 0xa70a085c, 0x1da9cc74, 0x5ea3faa4, 0xa9b2419d, 0x60480979, 0x89f0e19d, 0x70fbd1da, 0x4c677e8c, 0x8420b140, 0x47daeae9, 0x4cd44fa6, 0xe8c916a5, 0x7a734c56, 0x0cf02bc2, 0x01996546, 0xd2bae200, 0x2be3390e, 0x6eaf6874, 0x4db5f0a6, 0x3369a161, 0xbe953ac8, 0x0bd151f3, 0x94b56d11, 0x99be8886,
+        0xb3825056, 0xfa06ce06, 0xcdfe7cc5, 0xf1893cf5, 0xda1bb47d, 0x0fa29c35, 0x1e22f5fd, 0x3dfd8e6a, 0xa8426e48, 0x9602d7cc, 0xc0c16d74, 0xe41b98b1, 0xb3beb649, 0xf24a645d, 0x9ae90b03, 0x07c05a8a, 0x09cbd77f, 0x857f6d49, 0x31f55b29, 0xc86eeaa0, 0x54a78e4b, 0x3de30573, 0xa490bad1, 0xa7150e34, 0x37a7c8b5, 0x38f64c21, 0x13b05c7b, 0xab972fb0, 0xfb07e778, 0x673f9a3e, 0x34ee27d5, 0x1ad9efcd,
+        0xfbb67db6, 0x374810e0, 0x9c41465b, 0xba6a440d, 0x3f7b85bb, 0xea48d2cf, 0x8498e40a, 0x7fb1af35, 0xb67c1899, 0x86981b68, 0x4286c6df, 0x6f61b707, 0x1d5c0fe6, 0x27a37ec9, 0x8cb723c0, 0xfbbd201d, 0x3809f234, 0xaa5fbe82, 0x4feabd23, 0xa65509f6, 0xf91f3fe9, 0x6b32cc82, 0x4f271bb3, 0x2743cc08, 0xf23d46dc, 0x08fa9226, 0x691a951d, 0xf0e45132, 0x02a53907, 0x852ea17f, 0x4f60ae8c, 0x56911cd2,
+        0x27bba2ba, 0x1e28f43f, 0xfe7c3173, 0xfe6213e7, 0x7342e07d, 0x1984da7e, 0x8b936ced, 0xd2f2e9fe, 0x43282cf4, 0x3ac6f070, 0xe1ee38fc, 0x5f3bd71d, 0x1a6235c4, 0xeaaa7b1e, 0xd2d50127, 0x0dbd547a, 0x6d5b6372, 0xfef4d1f5, 0xeb9bb586, 0x465ddac2, 0x872bce0e, 0x5022c102, 0xdeef04d2, 0xd0a9b5e0, 0x5a51cf3f, 0x69e7e5b2, 0x66706362, 0x8746d306, 0x99117970, 0xe1badb43, 0xe9593d3f, 0x598dad4a,
+        0x220b6fe2, 0x8fc11485, 0x0acb7bd7, 0xf5b06197, 0x66aa7d43, 0x2e386573, 0x98804c80, 0x5c90a0c6, 0xeb701a31, 0xa63d5958, 0x4b34e44f, 0x0f8e3606, 0x8b87b2cd, 0x35c602f7, 0xc81c4c1e, 0x4ca8e5cf, 0x53d074cd, 0xa3652ae6, 0x1863241f, 0x5556f862, 0x71121c97, 0xb9d66f0f, 0x07719404, 0xafb40a93, 0xace66243, 0x71309062, 0x1c912fd2, 0x61d5fd69, 0x331ba01a, 0xeaf5ec85, 0x87b8aabf, 0x2f6f5738,
+        0xa09a754d, 0xae334511, 0x5fa40765, 0x2a9ec86f, 0x9b408b9c, 0xe5391b0d, 0xd8acedcf, 0x3e8b0e3e, 0xb3b2b662, 0x95cede6a, 0x64936280, 0x2f17a251, 0x9265fc0a, 0xaa6cdbc2, 0x3ff12be2, 0x401c7e9e, 0xba33653f, 0xfc86f9c4, 0x57e46b35, 0xd8a86b0f, 0x142166f6, 0x66f44fe9, 0x4d5f018b, 0x863a3676, 0x4ce72d4f, 0x9c01a3a0, 0x05f1d306, 0x6203126d, 0x2d15d2d0, 0xb9d5bb05, 0xdc652c92, 0xdfa5f546,
+        0xa7ec383d, 0x002437b0, 0xdb460c57, 0xcbc3e357, 0x455c5aac, 0xbe9b7a79, 0xe55cd57f, 0x6334aaa8, 0x3573498c, 0x8fed199f, 0xf6d3b9c1, 0x900156e5, 0x6a1380ba, 0x972ad034, 0x3ac4c929, 0x6ebef7b3, 0xd180b593, 0xc498dfc2, 0x5c46065d, 0xbceed3a9, 0x8063e195, 0xf6de97a7, 0xbf67923c, 0x75fe4ad4, 0xd4f41d2f, 0x051841ea, 0x64fc0cd9, 0xf8b3bee9, 0x18bd28d6, 0xebb1ed95, 0x43f0b474, 0x9275d4de,
+        0xcabce88a, 0x49220464, 0xefd61b1a, 0x52ff2ca8, 0x9179651a, 0xa4d19c5c, 0xf0222e5f, 0x3a0b45c7, 0x98e54544, 0x9172381c, 0xfcea6b93, 0x78cfd095, 0xc329456d, 0xf40136e7, 0x2f84859e, 0x2a47d7de, 0x844b0a0e, 0x0d8d2df3, 0xa3e101fb, 0xcb2aa33d, 0xde7390fe, 0x9c82aeb4, 0x99a15b94, 0x173a31d6, 0xffea551c, 0xdceab6df, 0x2111b2bd, 0x8d3573eb, 0x4b1a56b2, 0x546b5556, 0x7a14c455, 0x10fc855b,
+        0x212c5078, 0xa4e104b2, 0x3a664ca7, 0x3075be74, 0x2e5abcdc, 0x63366125, 0xac093687, 0x0902fec9, 0x5366a2b5, 0x1445774e, 0xca63f1a8, 0xb99a4f7c, 0x8bc79134, 0xcaa60e62, 0x3b05c121, 0xc74c7749, 0xafcfaa5b, 0x4a289b4f, 0x0c90ad70, 0x40f9962c, 0x9295d14e, 0x6f1fc4a5, 0xfe67350e, 0xe45e31f4, 0x5ceb89d7, 0x88ce5077, 0x8f08513d, 0x99488d1d, 0xed623edb, 0x62f2c4d2, 0x42874418, 0xc866d082,
+        0xd51d154a, 0xaf92d828, 0x2cd50d37, 0x0e5427f4, 0xe13d5692, 0x3f0ec461, 0x47960346, 0x4f939047, 0xd977424f, 0xe40ff14f, 0xce84f0da, 0xb6b2e4de, 0x306a8197, 0x40eb6285, 0xfa82d6ff, 0xb214dfaa, 0x40f44bdc, 0x0bd49128, 0xc74ecc98, 0x72eeadce, 0xcf8f937c, 0x010f6652, 0x7f79d839, 0x4c1fc6f7, 0xea6cd506, 0xe2feecef, 0x19da0ea3, 0xb4cc836d, 0x22c5667b, 0xc59a2beb, 0xdbbaa64f, 0x4438e0d9,
+        0x04c60405, 0xd4c18959, 0xba73b3d8, 0xa46196f3, 0xd1107d73, 0xc32ad231, 0x1dc09f8e, 0xb511d43a, 0x7d1207e8, 0x6e7e1330, 0x58f260e1, 0xb89f3de3, 0xc61db86f, 0x972fd541, 0x49088d2b, 0x7697732b, 0xd30ba9a4, 0x53848655, 0x2c4dbb2c, 0x493f4422, 0xdd17bced, 0x77cd76aa, 0xed11ecc1, 0x05eaef42, 0x30ec2ca8, 0xb379c145, 0x0ce3e6b9, 0x59b79ec4, 0x8c672f57, 0x0c7a8974, 0x026fc3c1, 0xbe07074e,
+        0xd40fa420, 0x6a752548, 0xe8965db4, 0xa52216fe, 0xb48e53dc, 0x8a8b4b03, 0x3e4ae525, 0xd38c9a1e, 0x96d7e1b5, 0x6373d8f3, 0xf05bbf66, 0xe880e878, 0xe53f9eb8, 0x87d0a3d3, 0x9b31a3e7, 0xe9c6fc60, 0xcad94e5d, 0x792d5c98, 0xd60f1339, 0xbc04b671, 0x8f656803, 0x88182531, 0x002d8dfe, 0x469e81cf, 0x40539136, 0x108dd29d, 0x6e942efb, 0x1b12cc32, 0x6e3f4421, 0xb613cbc9, 0xe00f45d1, 0x009b5207,
+        0x1150ead3, 0x76100b25, 0x570421bf, 0x1628dcc1, 0x2d53f082, 0x4b266d1a, 0x3efc29ad, 0xa8d60881, 0xba5260ca, 0x6167c7b6, 0x49c7cbb3, 0x61f3cbf8, 0x3cc26c60, 0xa39f9a67, 0x23c0b173, 0xb1986202, 0x3881c78c, 0xe32bc226, 0xd14abda4, 0x3d5cdd24, 0x60d39e95, 0x792a0aeb, 0xaa5f348f, 0xadc5fef7, 0xef9175b6, 0x6a10c179, 0x6d2ddddc, 0xa66625e6, 0x9aebc485, 0xfd90fe1e, 0xf836af46, 0xf9b50891,
+        0x5d59c3d1, 0x538c61d0, 0xaa193c82, 0x65889a0d, 0x5093ca02, 0x1f870f9e, 0xe2be45e3, 0x72b57b58, 0x4ba8d1c8, 0x30e1988d, 0x4b9d1c89, 0x3505db5b, 0xe83687d2, 0x1e4975ee, 0x7e2daf39, 0x7e29b3b8, 0x35071abf, 0x49614983, 0x069c1719, 0xd736ecc3, 0x2b92d013, 0xca5d0463, 0x4d6630bf, 0x669d8582, 0xf620e807, 0x22065253, 0xc89dc609, 0x52ae77d8, 0xac5a8908, 0x85b8af0e, 0xd7399318, 0x7b25abcb,
+        0x6bbd1b25, 0x56c9ad00, 0xb4282186, 0x2bb622b5, 0x7b359986, 0x90441e08, 0xd211449c, 0x14de405a, 0x6ff8cdec, 0x7700ac23, 0xdc273ef1, 0x709a6e35, 0x024716d0, 0x87bc6e42, 0xfefbe52b, 0xde6e4cda, 0x467393b9, 0x0d3ae7f6, 0x0894880b, 0x5f0cbc09, 0x26f005d2, 0x8f5a375c, 0x7ac6d056, 0x346f97b0, 0xe38b2bf8, 0x930409e2, 0x488e2785, 0xcec1d9e4, 0xc8bc8c8b, 0x1750ab2f, 0x2b9ed7c2, 0x557dd80d,
+        0xbb360dc4, 0xc34bfa2e, 0x3f229bc5, 0x3e6fa6aa, 0x14f386f6, 0x2dacc1e4, 0xda583a28, 0xf9edd396, 0xafc1e1fa, 0x181cba89, 0xf546bcc8, 0x6fbde914, 0xfc2c9aae, 0x3167022e, 0x88e394d3, 0xf896a5bb, 0xe7ee55b5, 0x92984981, 0x7a05a4cb, 0xe2becbab, 0xe3c17ec9, 0x1455c338, 0x061b0497, 0x8d7c5ca2, 0x20f41c5b, 0x8f8a69b4, 0xbd9a98a9, 0x87768bfd, 0x6419e660, 0x8c86a76e, 0x64c4d5b4, 0xb44f96c2,
+        0x9a12bbb4, 0xaf37c627, 0x061d5ba6, 0xf16a172a, 0x633e67de, 0x8999435f, 0x0e86ea0a, 0x503fe928, 0xb087b24a, 0x542de5f7, 0x853856ac, 0x1854c0f4, 0x137a66ff, 0xa5d09bf8, 0x6800a399, 0x09dae24d, 0x6e226e5f, 0x8bc067a5, 0xa8c8b07e, 0x8f50ece2, 0x37e87bf3, 0x4184ee3b, 0x14c239f2, 0x8aa58bf9, 0x77b954ba, 0x4978856e, 0xba8a3ac6, 0x3f98c090, 0x9d2e0b7b, 0x867d627b, 0xe68d92fa, 0x1fe82b6c,
+        0x40b625e5, 0xb02690a4, 0x38582aaa, 0x7d2bd1f1, 0x3c5db756, 0x57cf69fa, 0xcf64a5da, 0x320c20bf, 0xb3d11476, 0x1479ad3e, 0xe0e5b1d0, 0x06dd8751, 0xb604d4f2, 0xe09d9319, 0xa93c8df7, 0xc7872261, 0x7088258d, 0x71fdf319, 0x90133dda, 0x5a4e8a35, 0xfd850af8, 0xd6e1d4e6, 0xf5129f7a, 0x851e6575, 0x5639b8dd, 0x67698107, 0x27cbf36d, 0xef322ba8, 0x6ac5b27a, 0xddf58f30, 0x8df234b5, 0x5293e544,
+        0x079dd5af, 0xc98bd6bf, 0xdde07641, 0xa17218ec, 0xe4f854f2, 0xa4c6ca0e, 0x7f47de63, 0xc46ebd70, 0x3593d54e, 0x127e7540, 0xb8ba96e5, 0x96c7af7a, 0xb3209838, 0xa8110fdc, 0x75f387d4, 0x8d84ec94, 0x2babfc75, 0x21d29b75, 0xcb5bed73, 0x05fb1aea, 0xe374b64c, 0xdffbd07f, 0x247bd4c3, 0xc0e5e224, 0xf08e5158, 0xb7c57593, 0x00111875, 0x63694ff1, 0x70558694, 0x495bcc11, 0x02dbe40e, 0xaeb38047,
+        0x3c093540, 0x8520148c, 0xb4fceabf, 0x693f161c, 0xb1b4c171, 0xf4fe29fe, 0x43def589, 0xa905e186, 0x539a5439, 0x09b572fe, 0x17de2de1, 0x3304bf0b, 0x0aa64158, 0x94c63474, 0xc2602f1b, 0xd08b1b32, 0x532af994, 0x674e87a8, 0x85961d52, 0x143c9e96, 0xf3aeec8f, 0xdb08c33e, 0xab422b79, 0x343c2ba8, 0x791e7fa0, 0x072a7d1d, 0xa63d40f8, 0xe0e5061e, 0xaa671d9d, 0x164489bd, 0x3aeaf14f, 0xd3db8eed,
+        0xce0d3fff, 0x4e2aa848, 0x80b6855a, 0x7b805382, 0x6f1c9242, 0x12c5e825, 0xb5833991, 0xa79713b8, 0x8e25c7d9, 0xa034f464, 0x4147edb9, 0x426cf506, 0x13405826, 0x6e4f69aa, 0x96cf69d4, 0xfe189182, 0xac9b20d9, 0xd5ab1bcc, 0x96880c1b, 0x47cedbb0, 0x88a0b614, 0x65bf9ee2, 0x78fd62fb, 0x8eb81a3c, 0x52e54a6b, 0x021ddcc3, 0x6e551aab, 0x7d24ae15, 0xc3d05781, 0xefcf1541, 0xff182d88, 0x491e3b9f,
+        0x43d83d1d, 0x1c498a27, 0xcac4e72e, 0x57935456, 0x2275c0a3, 0x1c6d1f2d, 0x0918e5a6, 0x1a533671, 0x7435d653, 0x602194d2, 0x901f43c9, 0x8f72801b, 0x3b1b229d, 0x3934fe0b, 0x250f2664, 0xbfc7b994, 0xad5626e1, 0xd59b2f96, 0x5aa45d63, 0x7ee2b4a6, 0x82ae5034, 0x3fe9ae42, 0xb1d84b90, 0x7a109ca0, 0x98651e74, 0x0570b904, 0x81907960, 0xab0331c2, 0xc6c21a0a, 0x1074a88d, 0xaf697277, 0x775085a2,
+        0x51ca55c3, 0x88edbc32, 0xd50750e2, 0x09d71d62, 0xa92b9a11, 0xafe8f203, 0x964a1a4f, 0xbfa325cb, 0x04e252f2, 0x86231e5b, 0xd6425b71, 0x97e01aa5, 0x1d2ef6df, 0x63d992c5, 0xd725cb40, 0xf4c1cd76, 0x56662f74, 0xc0716dc8, 0x6def7e53, 0x82d43bed, 0xcb351425, 0xab4617df, 0x243dc42a, 0xb08daccc, 0x9bac8fe6, 0xcb9ae33d, 0xee3db0db, 0x22df8536, 0xa2edfa7e, 0xb98467e7, 0x0c3ab2ad, 0x1d2f4d3f,
+        0xb2c6cfda, 0x463497f1, 0x41d1ee06, 0xbe043453, 0xb0deebd8, 0x1bfabd2b, 0x5cf95962, 0xbe4cf497, 0x8ab8ecb2, 0xd546094c, 0x38de4af2, 0x758fb4db, 0xe7ce0490, 0x088c8e35, 0x5fa064dd, 0xb6e7a428, 0x142d517d, 0x3479a43c, 0x07eb0635, 0xdcc768d2, 0xa07c923d, 0xaba2adf4, 0xefdf02f9, 0xbbee848d, 0x51e74788, 0x808f9269, 0xbec3c552, 0xf6dbb5f4, 0x49f73647, 0x058a0e4a, 0x1fd5aab1, 0x3dc23f1c,
+        0x839acfdd, 0xf66d2601, 0x6333fa48, 0xa6d308d5, 0xfa862b78, 0x16fc9fef, 0x4ab49129, 0xc3f0f080, 0x97a3c33f, 0x14533aec, 0x92446a6a, 0xbecbf45e, 0x9da8bd1f, 0x0a0fba82, 0x8f9813b1, 0xdc839826, 0x47a4dd90, 0x2e405027, 0x26df9e1a, 0xc90b0c4b, 0xbba6b527, 0x164e08bf, 0x0a29aeab, 0x368f54fd, 0xcd371e96, 0xaaf05c50, 0x680aeffa, 0x8f5d660d, 0xd47ba12f, 0x5de9af23, 0xf895c804, 0xa8b5beb6,
+        0x6c27d976, 0xcfb4ff0b, 0x0dccb541, 0x127fc9e1, 0xc97b3de0, 0xb5f2d02b, 0xa14cba56, 0x504cfb64, 0x8241fcb6, 0xc854d353, 0x9153e140, 0x3991aa8d, 0x4f2721e7, 0xb5ea58b4, 0xbf444d8d, 0xc9a7fffa, 0x562f67cf, 0x6c3c682d, 0xe2238327, 0x727b933c, 0x556a7974, 0x74cfbc82, 0xcbc79c5e, 0xe3692023, 0xce065032, 0x07af234c, 0x0cdc7118, 0xfdf747d0, 0x670a9396, 0x2b7f1562, 0xf716cca9, 0x64d19f8c,
+        0x6a148ab0, 0xace6436e, 0x549d314c, 0xb33e6242, 0xa2e94c76, 0x8fc463c3, 0xdba78ce6, 0xc180cdf5, 0xc9ccfaad, 0x5ad980bb, 0x89d53890, 0x767d0335, 0xbdde1d51, 0x3b36549f, 0xbd5e547c, 0x3dd308d7, 0x71de0f24, 0x8df5e000, 0xd9b475ff, 0x0b18cb73, 0x7e99d620, 0x4bc5c764, 0xf2ba73d5, 0x1bd11a6e, 0xcc3bd8d2, 0x3818f8f2, 0x220f35be, 0xb6f3bf48, 0x3cde7a9a, 0x38801da8, 0x20b27c25, 0x90cdc3b9,
+        0x88bc1d4b, 0x6cd7c5c8, 0x0e83ac80, 0xe94b6856, 0x77f487f5, 0xae414d19, 0xfb916d8a, 0x3f9d5fd8, 0xaea60bc6, 0x4d9213e0, 0xdef3597b, 0xb135f727, 0x7f07a7c7, 0xb44b8992, 0x49a43b0f, 0x579049cb, 0x2eda5a83, 0xf5b688dc, 0xf61272f4, 0xf4c9e8a1, 0xc19a5a34, 0x0b3031be, 0xf34a5ddc, 0x4b2d1188, 0xabd82194, 0x83e724ec, 0x2fa14677, 0x0e1000bd, 0x4a331524, 0x19dd98b9, 0x0ee6b528, 0xf4aff28a,
+        0x0b47ec88, 0x40e09515, 0x47912afc, 0x2eca846c, 0x2ba3e5a5, 0x331859d2, 0xad567656, 0xc2832ea8, 0xe704dc9c, 0x0be1c1a7, 0x5a1bd74d, 0x98fb7a28, 0x19a3fd05, 0x77e8dc28, 0xcb0231c3, 0x61135010, 0x77eb3013, 0x58ba6fc1, 0xaff597e8, 0x26687349, 0xaede3c16, 0x2c8f4178, 0x6be338f7, 0x195e1d08, 0xa8caabe5, 0xd4699ac8, 0xa22847de, 0x22d3375f, 0x866ff815, 0x2a361266, 0x30f7d221, 0x9a8a78a8,
+        0x830c45b4, 0x93b3a66d, 0xbf929268, 0xaac8be8c, 0x6b79c6d6, 0xe87d30c6, 0xbccb7394, 0x210a8a97, 0xafbc5977, 0x97080b35, 0xf4aa75a6, 0xfe753efb, 0x4ed2f528, 0xad1f05b6, 0x57a1079e, 0x10576f52, 0x6314a1cb, 0xb1bf4d44, 0x06b376df, 0x8ba9515c, 0xa23018e5, 0x13cfc56d, 0x90b44b03, 0xe5073aff, 0x5d9227fd, 0x63662e9b, 0x6be4b7bd, 0x01b81597, 0x7652c1c3, 0x648ba582, 0x507f0f59, 0x1e14973a,
+        0x39c4f6e4, 0x826964e6, 0x1dae0a20, 0x2bdf4448, 0x224b9a4b, 0x554841a2, 0xf24f5c5d, 0x1b5b00f9, 0x7e10165c, 0x988f0fb6, 0xbf8aedbb, 0x11405deb, 0x4f99724e, 0xab820e41, 0x01f8f928, 0xd0a67c52, 0x9d9961da, 0x005704a8, 0x5b89ed28, 0x310aafc2, 0xa619a97d, 0xc7114e90, 0xd891f6b0, 0x9038a965, 0x19f248b7, 0xd7c1440f, 0x969af2fc, 0x94b5f8e7, 0x9516ffdc, 0x2eb49e53, 0x8594ee6f, 0x3ae18c37,
+        0x7460a799, 0x50b1d3fc, 0xf779c843, 0xc5d1da6b, 0x2eabab22, 0xa7bd8598, 0x8f345298, 0x96d06d35, 0xa060a1de, 0x9db3ebc7, 0x07b6996a, 0xc75f1157, 0xa46c01cc, 0x80ada4b9, 0xd691ba51, 0xcc5bdfe0, 0x6527a258, 0x665f2e7f, 0x6ff5a89e, 0xda5da7cc, 0x15bae0b9, 0x9e7a72f3, 0x94d52766, 0xac588277, 0xdf268cd2, 0x6a9fffae, 0x34f7dca1, 0xcb55afef, 0x18385ceb, 0x92a0cd51, 0x301da2a6, 0x2e381269,
+        0xaaf75692, 0x01701a4f, 0xbb7fefbd, 0xe051e432, 0xa189e694, 0xcb650fe7, 0x77dc5bca, 0x5b727f82, 0x507a0cbe, 0xd68f412d, 0xa43728cc, 0x00d900cf, 0x8fe0fe83, 0xf92f1673, 0xa9e9fda4, 0x8f4d2f37, 0x1ff7f123, 0x2e41e3ce, 0xac8d0b8e, 0x110a45dc, 0xae28e157, 0x1878075e, 0xee1c5a9f, 0x80c6650e, 0xd42d86e9, 0xddddd226, 0x2d97fc11, 0xf5458084, 0xf3016f10, 0x500147bf, 0x331a7bbb, 0x3deba618,
+        0x37b9eb7e, 0xdab23456, 0x022e7e7d, 0x0e9d3660, 0x4cf5dd10, 0x55d7596d, 0x4643b84f, 0x3aa84161, 0x96217c53, 0xa59860fe, 0x65847cc4, 0x389b473e, 0x2fb8179a, 0xcc831a67, 0x648f9d88, 0x8ce73433, 0x27937626, 0xf1716031, 0xd511e782, 0xdeab42d5, 0x265626ed, 0x29a0f5f6, 0xadf6b93e, 0xb5865e27, 0xc005e5a5, 0x611fafc0, 0x03cfd4e9, 0x1280541c, 0x246a4431, 0xcaede78c, 0x07d90bab, 0x8d5ebea8,
+        0xcf06ab5c, 0x5d0cfa94, 0x0c11c1eb, 0x018f20b0, 0xaa8ade9a, 0x6d33cadf, 0x74be8abe, 0x65f54e78, 0xcd912bbc, 0x9eb8d2da, 0x5bc2a6e5, 0x90eb7207, 0x067c4aa6, 0xf9975770, 0x37f564be, 0xb49331af, 0xb5fe84c8, 0xaf1bbcaf, 0x8c86129f, 0xc97bd20e, 0xdea433d6, 0xe7d68813, 0xbd24556c, 0x16088a55, 0x1a6d4a2e, 0xd5fa85b5, 0xf8afd8d5, 0xeccf2bc3, 0xbd1c44e0, 0xd4876e42, 0x038c2b95, 0x7a1f3e88,
+        0xaddaeaeb, 0x0e19adfb, 0x7c49e831, 0x7fa37eed, 0x08e34d43, 0x1e970f3c, 0x1d4bea32, 0xdc071eb6, 0x139db411, 0x425247b0, 0x9b9a65fe, 0x58ec801c, 0x3bc46b00, 0x386aa8d3, 0x245adca8, 0x4d9b3fda, 0x87b96e49, 0x1e0e81d0, 0xee283a66, 0xf8f2481d, 0x9ded5701, 0x39fb5b37, 0xb09cc1a7, 0xbf67cf8d, 0x3c03556c, 0x3588b955, 0x34f3b81a, 0xedffa3f8, 0x0990d5f0, 0x50b1b6bd, 0xa9d24942, 0x918392c5,
+        0x81db6f77, 0xfcb0bd16, 0x7c5d6b06, 0x91f05a4f, 0xdc980b43, 0x4c965501, 0xf72bfc15, 0xd32dcc20, 0xc27ae896, 0xab076555, 0x3f26626e, 0x1132b985, 0xad1fdd42, 0x22dae1d6, 0xc261d77c, 0xa6ae709a, 0x9610892a, 0x04b02c04, 0xd28b6131, 0xd79fb5c0, 0xed451177, 0x7271002e, 0xa337952c, 0xce356a6c, 0x04d91cb8, 0x8bccd169, 0x2f30f281, 0xb0fe1cdf, 0x06d87aa2, 0x3bf9492f, 0xef5c12a7, 0x4eea4fb3,
+        0x7c060d92, 0x2081ea09, 0xcb7710f8, 0xfb2218d1, 0x74f32926, 0x6aca4b66, 0x7e847f87, 0x28293aba, 0x6cfb96e0, 0x7b75869c, 0xe44b2e0f, 0x8e30eef1, 0xdfd1264e, 0x6c4457a5, 0xa2162487, 0x14679e95, 0x4ad2d13b, 0x4e04a60b, 0x4aab6e89, 0x2751ddc7, 0x3ed91754, 0x15e672ea, 0xb4502528, 0x92bd9588, 0xc64cf6a1, 0xaa9173dc, 0xd2996c68, 0xe8e9c7c0, 0xce6271c2, 0x9666c2de, 0x40f72204, 0xcf1617d3,
+        0xcced8f05, 0x93a24d70, 0xa1349741, 0x07dcf87e, 0x3b43afc9, 0x5fd359c7, 0x618e3f32, 0x2122e2bd, 0x740505c7, 0x802ae127, 0x8024abdd, 0x9e406356, 0x8a62e599, 0x9d5f618c, 0x585b6eea, 0x05b57152, 0x4a9b289f, 0x3be782cc, 0xb41a7319, 0xf85563c3, 0xef1fc346, 0x92786d8b, 0x981bd637, 0xf582ed18, 0x97d4cc11, 0x03fd1327, 0xbd1d7a0a, 0xf7c1fb53, 0x5f658b32, 0x72ad8236, 0x740986f9, 0xfbcd9270,
+        0x82666fd4, 0xf801a37a, 0xedbffe4d, 0x48991f3b, 0x7366d47d, 0x37e95145, 0xa32eee7e, 0xbcf788f8, 0x7598deba, 0x528d9be5, 0x8dc429b5, 0xc45f267c, 0x0a8e393b, 0xccdd104c, 0xcd5d1f2a, 0xd976a551, 0xabe82fa3, 0xf6d01058, 0x3348ab4e, 0xa0e50e2c, 0x03bbeeb3, 0xe8e88caf, 0xc35ed927, 0xfa061274, 0x91487366, 0x05a233cd, 0xa77a8e26, 0xf8754b4d, 0xa27e5892, 0xd0ac89e5, 0xbbfd1061, 0x253c57e9,
+        0xe327d5a5, 0x7cefe593, 0xaa790354, 0x70c4bdbf, 0x1ee487c5, 0xd4e411e4, 0xb6b76023, 0x877ea152, 0x727d7aec, 0xfbbb8f67, 0xa4176b60, 0x13c413d0, 0xa61e0e8f, 0x174178d2, 0xadaa029e, 0x2e3659cc, 0x0f0f5417, 0x0f2f7d26, 0x3955004f, 0x37d69ba8, 0x2b00d736, 0x8b022ebf, 0xedb41a69, 0x59ac5c75, 0x83e62d8a, 0xf987bb0c, 0xac618d34, 0x5d56601c, 0xaaf4f499, 0xf99b142f, 0x14daa7f8, 0x68e1e980,
+        0x399e6a28, 0xc3e96fc2, 0x48c09fc0, 0x04aca439, 0xe9ec6b70, 0x209480b9, 0x3aa66668, 0x893ca648, 0x3fa59656, 0x79f23126, 0xad216405, 0x7c99abea, 0xa6037bf5, 0x3a455b12, 0xb4242a8f, 0x66baeb46, 0xd64c668b, 0x36869ef3, 0xba300d05, 0xd808a611, 0x04f9a6eb, 0xa50c5253, 0x957068dd, 0x233d55d5, 0xebbe9569, 0x05b75478, 0x177835ae, 0xc5e8b54c, 0x8df7af26, 0x22b8c41d, 0xee491788, 0x53847b70,
+        0x330f5903, 0xe7743d76, 0x867b583d, 0x20efb79b, 0x2071f966, 0x1a747e6c, 0xbfac9759, 0x6e0e613e, 0x508e2097, 0xf8ed96b8, 0x2feaa4cd, 0xa56db4c6, 0xfafb2cd9, 0x634f4bda, 0xb67bd6ca, 0x444f7d97, 0xd35dcc20, 0xc7c407f6, 0xaee77e6c, 0xdd9097bd, 0xb07ca2e6, 0x8c4b90d0, 0x87e77b5a, 0xb611eab9, 0x3058b758, 0xc9d5399e, 0x7e364705, 0x07a9e8be, 0x8f3e013a, 0x9bb9125b, 0xd40a2d0d, 0x1adb6699,
+        0x33ef327b, 0x7f517b8c, 0x871a6052, 0x8f8f3973, 0xceccb707, 0xf2799588, 0x5ae82032, 0xb14030c4, 0x8c39ac8f, 0x4117c922, 0xb7aa01a0, 0x04da92ea, 0x33d7d9bc, 0x80e7ca3c, 0xa4cd4085, 0x5634f8d5, 0x0005d565, 0x85e6c396, 0x835f9116, 0x57ffe7fd, 0x91e05078, 0x7c5fbf0f, 0x01cd2823, 0xe041f49d, 0xe4791319, 0xf36bba86, 0xd54c2d0d, 0xc3325d38, 0xc6713e46, 0xd03e35e0, 0xc9c341da, 0x782c3f63,
+        0x5fa63023, 0x642567a6, 0x26fdeaf2, 0x9a060875, 0x5a2dbb34, 0x8751fda1, 0xa5252336, 0x9b1905b8, 0xee936806, 0xd19a87f5, 0x17e3e325, 0x52727f1a, 0xbd208a2c, 0xffb62ee9, 0x0e260079, 0x4bb00ae0, 0xc1d52332, 0x8303ae12, 0x76a73d1a, 0x3207f018, 0x0b856949, 0xcb3c26ae, 0xd78f3ec2, 0xfe82c0d1, 0x2a2a8973, 0xa4d353cb, 0x1d757c4e, 0x291e5de2, 0x4585037e, 0x31b1a5c5, 0x507b9ea4, 0x34ece743,
+        0x9b28b09c, 0x33ba7f89, 0xad6e7555, 0x2a838909, 0xfcd61f7c, 0xcb1c535c, 0xfe465624, 0x71bcc06f, 0xc1ede6db, 0xada11cee, 0x466a4e79, 0x74b8808b, 0xf43a3ebd, 0x4b1eb8a5, 0x693cb1d5, 0x42c267a2, 0x37749fa4, 0x08da0576, 0xa10eab33, 0xc8c68b6e, 0x03ce7516, 0x5232b654, 0x0b15b1d0, 0xec29472d, 0x2e25a8da, 0x10d26037, 0x3351ae30, 0x6c6d3725, 0xb827d131, 0xb6e7f8e8, 0x715fc4ac, 0xd856d797,
+        0xd872347f, 0xc5203ab3, 0x63c948a2, 0xde69fd94, 0xd669d223, 0x2a2494d6, 0xbf985d7f, 0x31fc4435, 0x9577ead1, 0xdbbe0384, 0x291b59f9, 0x6fd17ef7, 0x87621213, 0x3882cbe9, 0x767199b2, 0x964c8df0, 0x6129c90f, 0xdf29516e, 0x17ddebb0, 0x03304891, 0x42575b34, 0x33d15b5f, 0x55f963fd, 0x2ca619ca, 0x60075a9f, 0xfddc7024, 0x257145d5, 0x9ab77953, 0x5117d4a0, 0x9f7c185d, 0x47fe6378, 0x119631b2,
+        0xd1f39f2a, 0x83f5b092, 0x57933002, 0xaca332a4, 0xdf3b885f, 0xc692bc20, 0x449d9481, 0xf64ae0df, 0xc682b237, 0xfd8744a9, 0x9bf51ee5, 0x1e435f7e, 0x04999b01, 0xd47ffd3b, 0xb396411d, 0x9e84168c, 0x040857d6, 0xd8fb130f, 0xaf139ea3, 0x2a75dbaf, 0xe0be2948, 0xf7a3a8fa, 0x6e8ad7b2, 0x50301b5d, 0xa19fb077, 0xab69bbfb, 0x9606c414, 0xff94b660, 0x3a379f89, 0x13af16cf, 0xc8df211d, 0x71a30cf8,
+        0x49a2885f, 0x258885af, 0xeca3e139, 0x37c6ff67, 0x4c68ddcf, 0xe4e8040d, 0x894b2a66, 0x2fd39a9d, 0x5569ebe6, 0x243ad62c, 0x3cbf4c1d, 0x77cedc42, 0x8b94cc43, 0x30e5a97a, 0x1b9148e4, 0xae5fe3d0, 0x231c9c44, 0xd57e0d1f, 0x182c6635, 0xa3c295ec, 0x4f96119b, 0xc9294359, 0xd008f03b, 0x63947735, 0x8378843c, 0xa98e62a4, 0xddd16614, 0x975adc1e, 0xfb0135a4, 0x36e5a972, 0x539f81fb, 0x69815e75,
+        0x3838cfa1, 0xe143067a, 0x84aa4fa9, 0x1998a69b, 0x5a5e9773, 0x4be5c004, 0xdc06b1b7, 0x9714c8b3, 0x4290b6bd, 0x7e7da08f, 0xd7fe19fe, 0xd8df8c21, 0x95327b9f, 0x7f166cd1, 0xb82af608, 0x3a0e65ee, 0x57f12c82, 0xd776b8ec, 0x025fc68c, 0x376bfd48, 0x31442c2e, 0x0121d47a, 0x81e42a77, 0x714ae247, 0x0634b68c, 0x7f11c542, 0x8ccf8413, 0x4023a6db, 0x46b40056, 0x99bd57cc, 0xb23cdd26, 0x3c4876f0,
+        0xe1a0568a, 0x5984830b, 0x06518532, 0xbbafccd6, 0x57594e6d, 0xd7c06467, 0x6be13e1d, 0x9ac795a0, 0x147b9c7e, 0xee593233, 0x145087e5, 0xf9b30da8, 0x12873ff0, 0xba85f0a7, 0xe67cbf8d, 0x42ed98f2, 0xf82496ad, 0x9afb25cf, 0x642cb155, 0xf657cdfc, 0x50471d05, 0x4f573ab7, 0x8da5f56b, 0x921cb0ad, 0xcac3a974, 0x6a4aaa08, 0xcc5e4fda, 0x76203624, 0xdcfe82e3, 0xfd9468c8, 0xcc474057, 0x1c5cb105,
+        0x01a1e273, 0x4b41c00b, 0xeb7ea7da, 0xf1ae3c8a, 0x04992c7f, 0x37c35b54, 0x0787d6ac, 0x184892e0, 0xb621b670, 0xcbd3b545, 0x89d58316, 0xd7238711, 0x864b6ff4, 0x6978f6da, 0x8092cbd8, 0x5f0ff039, 0x10cfe9b7, 0x80fe4eb7, 0x3ae3f127, 0xde56fe29, 0x1df65ab0, 0xcf441d3c, 0xfd61a2ee, 0x1a9d9c16, 0x120d5e6c, 0x383cd58e, 0x0f5db5d3, 0xb9236a85, 0xa95d1dfd, 0x76ccf8cf, 0x58142b9b, 0x1ebbdb5e,
+        0x20e6403f, 0x9e1c342b, 0xa31b52b8, 0x3abc3d9e, 0xbf19d948, 0x2674231f, 0xce25ff7f, 0x1f0f53b2, 0x44def644, 0x5f30d8c3, 0x6f194c6c, 0xeedee5b6, 0x66dcca2e, 0xd0f5f869, 0x9baf377f, 0x197d07ed, 0xc524739f, 0x2cc4a250, 0xf0ed800a, 0xacb2a24a, 0x21a7ad25, 0x20e00a67, 0x41770b6e, 0x5a374e0c, 0x60d8fa22, 0x16eecd3c, 0xfe65767b, 0x4a6977ba, 0x574894b2, 0x55d67d04, 0xe6490be0, 0x48042258,
+        0x3ccb985c, 0x6b09cf93, 0x3851fda0, 0x7ed7566a, 0xfdb72ed9, 0xaaca0303, 0xf37b9ef3, 0x2dfdba5d, 0xa3622c84, 0xc21c79da, 0x810eb81e, 0x1d1753d5, 0x5bada4db, 0xc87f0487, 0xc4b94712, 0xcff19c70, 0xc8cc0198, 0xbb205251, 0x07672d13, 0xadd88c2f, 0x0d6cc9f6, 0x5a0ef74c, 0x52cb962d, 0x38a1fde5, 0xccb8433f, 0xe4ad32e2, 0xa156bce8, 0x7aa8c0a1, 0xfb98a07f, 0x645e44b6, 0x28830e12, 0x212fd1b5,
+        0x9dde7e48, 0xc1d7e2e4, 0x4f081774, 0x8c6362f8, 0x15c7b46d, 0xd50a04f6, 0xe077e6f3, 0x043a1585, 0x973835a6, 0x00909e34, 0x4d997a53, 0xcee81977, 0x2b06a478, 0x46e3b4d2, 0x570229a0, 0x997e4cbf, 0x1144260b, 0x27d2f75d, 0xa74b1c74, 0x96207d68, 0x3e897fd6, 0xc0042bd6, 0xc206ede1, 0x46b23079, 0x4c8c31ea, 0x16dbac2a, 0x6b37774f, 0x73de3f16, 0x0e4b04de, 0x31eeeab1, 0x07e63322, 0x2607a3df,
+        0x2fc3bb74, 0x3c6db08e, 0x455a1296, 0xbd9fc4a4, 0x10f55214, 0x1ee7cb68, 0x555fd7a2, 0xb46582b3, 0x0cc69c94, 0x95446b3f, 0x19ef5a91, 0xcf3316f3, 0x12660eb3, 0xfe14d5e5, 0xe78e2a40, 0x1264f8b6, 0x4fd1fb2a, 0xeabbeae6, 0x977e2b08, 0x4e43a061, 0x60ac0a79, 0x8a6cf78a, 0xf399b006, 0x2a1164fe, 0xbe0d9c5a, 0x1bff689c, 0xe3188cfb, 0xb2c9875b, 0x99514223, 0x4ee0c82a, 0xb08b9532, 0x6e526f27,
+        0x6420361e, 0x9c265c1c, 0x392876c5, 0x90d17908, 0x219a41dc, 0xdb240bb3, 0x2c278a0d, 0xc6d68a5f, 0xf047f3a1, 0xbdbda43f, 0x08d3cf32, 0x6ae3c42b, 0xe12aa5bb, 0x1256602c, 0x85b74076, 0x7edd4ced, 0xcee94cb3, 0x420870d2, 0x729495cd, 0xcad3400e, 0x58b6c6f6, 0x264cf61b, 0xc1d4a1f6, 0x51795207, 0x5c36ea16, 0x445cf5d7, 0x8e7dc674, 0xcaa061f4, 0xe3833c75, 0xa7995d0e, 0xd714fa99, 0x2893ee91,
+        0x3e789131, 0x48a37550, 0x6f84acca, 0xcb213d92, 0xd41c0a2d, 0xcc76bea5, 0x27178fe2, 0xe9949b8e, 0xc20944e0, 0x0ec6bab3, 0xe062dc3d, 0xc2014904, 0x808b2be4, 0xeebf0c02, 0x91fd0030, 0x6d96f3ab, 0xd9fab8b4, 0x67525409, 0xfc118bc9, 0xde392be6, 0xca4b6f73, 0x8fe83905, 0x59c65b6b, 0xb03698fa, 0x807cd5e2, 0x77a0fb00, 0x4155979c, 0x6b5a82d2, 0x8286f2df, 0x0a4b2a68, 0x14206e32, 0xf52d39cb,
+        0x0e4f6a2d, 0x448d68aa, 0xa28e9093, 0xc42bfa58, 0x9ded6123, 0xc140ac44, 0x14db71eb, 0x87efd419, 0x9c098c4a, 0xdb97ef07, 0x8b6f88f1, 0xd4d17879, 0xdb1dae31, 0x7508f855, 0xa4874d79, 0x1464c8d0, 0x4589ba92, 0xc3bd7102, 0x1b5402e1, 0x456064c7, 0x0f7dcec8, 0x6ce18abd, 0x9f33b99b, 0x30a89040, 0xb2f6413a, 0xc92f4ed6, 0x4662785c, 0x2cf4281e, 0x6c062dfd, 0xc473f92f, 0x5da68e6b, 0xc1b5712b,
+        0x15085a81, 0xeca53079, 0x11dc6ecd, 0x759c970f, 0x1ef29f53, 0x0aada564, 0xad87c623, 0x29374f10, 0x380c3493, 0x7a04fd8b, 0x3cbe60bf, 0xd960c86d, 0x0235e0e5, 0x430728ed, 0xba23f65a, 0x9e638efe, 0x8f9fefae, 0xd6761525, 0x8d4e13a6, 0x68e4d098, 0xbe045487, 0x8a5559e3, 0xd31b29ef, 0x5fd53d40, 0x64b583f6, 0xf6626b90, 0x22cd33e2, 0xdd5786c5, 0x321c3a01, 0xdf0f17db, 0xb8658710, 0xc1f5babe,
+        0xab6d31d5, 0x69a5ab96, 0x0f524de3, 0x860ca596, 0x625ff639, 0xa38a8ad4, 0x7dc1a369, 0xfe058105, 0xc62f7685, 0x00fdad4d, 0x25d6f3b3, 0x722b7ec4, 0x7c4bf32b, 0xc8baca94, 0x1263c5d4, 0x2f346f53, 0xc995e761, 0xb358b55b, 0x64cba0b7, 0xdc7a4cf0, 0x3c7512ca, 0xa419f4a5, 0x14a014fb, 0xdb6ea820, 0x1439a7ec, 0x7c584b6f, 0xed6bf6b8, 0xfba30fca, 0x3468399b, 0x34a22e9f, 0xf4e2770e, 0x8c3d0553,
+        0x56f95536, 0x8cb3769a, 0xf5c05d0e, 0x41381a92, 0x57d86ba6, 0xb08a4e14, 0x103c7aab, 0x1ecb80ed, 0x9ccb0c05, 0x85582ec9, 0x8e3cadd6, 0x70aa2be6, 0xe80d1bc3, 0x22f3f304, 0x338380ec, 0x21bea97f, 0xc9a648df, 0x2fcdc382, 0x59041e38, 0xd897650b, 0xf8dee0a6, 0x24c34c4f, 0xd6078836, 0x31ec9e1c, 0xb638e2d8, 0x149b3754, 0x3703a79b, 0xab28b8f0, 0x03f460a5, 0x97bde0c7, 0x35c56c9b, 0x37b2eb1b,
+        0x8955fe5c, 0x97b73dd5, 0x1bc3e882, 0xb8fbc586, 0xda902050, 0x1653a3c5, 0xe92d8a1f, 0xb8b27422, 0x556f04bf, 0x6deed5ca, 0x7819c54f, 0xdcf4a4a2, 0x00bdd95b, 0x37317ce1, 0x4f97af0d, 0x79b47e4e, 0x7c378608, 0xba31adac, 0x431d45a0, 0xabaaad6e, 0xaee06afb, 0xf332095f, 0xe94377a2, 0x2b254a52, 0x920c64e1, 0x90197b0a, 0x43e9426e, 0x0d462a6c, 0xedb05404, 0xb186944e, 0x10725810, 0xe462eedd,
+        0xa0554e79, 0x6a33fe75, 0xf2c264cb, 0x185fc648, 0x84325b5c, 0x69c0e2d7, 0xf4ea8700, 0x726234a8, 0x45a32f75, 0x99cebed8, 0x86e8d1aa, 0x4396f971, 0xe943e837, 0x91da3825, 0x36f59b9a, 0x849e0afa, 0xd3a8338d, 0xb4e0ccc5, 0x236971fa, 0xe22709d6, 0x70107a67, 0xa9591bc1, 0xe0128681, 0xb180e8a3, 0xb44dcf92, 0x6327ba2d, 0x7f3cd89c, 0x248fff8a, 0x9c0e8a41, 0x4a4d5fc9, 0x13ec8fe8, 0x3c30f3fa,
+        0x3dce8872, 0xf5a36ead, 0x0699ca56, 0xd098775d, 0xd8b2b66d, 0x24d953cd, 0x03ce0c51, 0xba850c37, 0x8ce80e3d, 0xff74b5fa, 0x1ea2c4d1, 0xde093a66, 0x9683d57f, 0xf416e5b4, 0x9f49376a, 0x437245b1, 0xbf3c8d58, 0x02910a6c, 0x4f57728f, 0x3301a26e, 0xeaa00378, 0x7b85d3b6, 0xc8429531, 0x79b580dc, 0x19de3382, 0x81091a69, 0x47f677d1, 0x4c85abc5, 0xe8524404, 0x089db4a3, 0x1c703558, 0x0708a6c0,
+        0xca319c9f, 0xab035c42, 0x1a2efe2d, 0x8686fee4, 0xc497f889, 0x30aedd98, 0xa97c76de, 0xd31c02bf, 0xc5e9bfaf, 0x0f629f77, 0xee9655d8, 0x0133cdd1, 0x2d484c58, 0x2e165112, 0x053a5c42, 0x6dfcba78, 0xd5695c39, 0xe5e83443, 0x79233706, 0xeb3efbea, 0x1bd03df6, 0x8bac1bd3, 0x16cc4489, 0x4eda8d2e, 0x1d7921e7, 0xae4b51da, 0x2b0044eb, 0x6c38eae5, 0xf8f67004, 0x10a47333, 0x493788d6, 0x1a247cde,
+        0x9959a17e, 0x2ebc8107, 0xda2a66a2, 0x4699a3f5, 0x3eaa32a6, 0x5dcf1301, 0xba27b550, 0x9283edc9, 0x669a3849, 0x2b054187, 0x4f8384c2, 0x1b1ec565, 0xa75f60d5, 0x3c278d53, 0x644ea80d, 0x1d2b6709, 0x1e8cce78, 0x1984e089, 0xfa817a00, 0xa113aacc, 0x84ac2651, 0x60ce56dc, 0x81fd2071, 0x6b8865ef, 0x5334a25f, 0x47ef94de, 0x328066ab, 0xe18a466a, 0xdce68c23, 0x9aa05705, 0x4493042b, 0xc4aacc8f,
+        0x89e6fcb9, 0x7582c253, 0x8d2cd8d8, 0x0a74bda9, 0xf6980250, 0x533eedb9, 0x4502e6bd, 0x0aa9f145, 0x440613e7, 0x9d5faec4, 0x4f5b7d99, 0x7895d0a9, 0x8eab0eca, 0x4de6fde3, 0x60d1037b, 0x1b658a3b, 0x3eea756f, 0xf5943561, 0xad1a1313, 0xf6b69a83, 0x42e42f26, 0x33e13c67, 0xf623f692, 0xf05126d4, 0x7f613023, 0xf923c282, 0x6d827c4a, 0x9fb8dbdf, 0x915ad24e, 0x0f26bc62, 0x9cf016b4, 0x30ae722b,
+        0xce971c32, 0x26a97e03, 0xe17b058c, 0xfdf7634a, 0x28f4568b, 0xf477c676, 0x16d44c81, 0x523c002e, 0x502996d6, 0xa85b714b, 0x9b7b782c, 0x70df3efb, 0x60f5004e, 0x815e2180, 0xecf05ef3, 0x11400c87, 0x0e986f8b, 0x84bb4fea, 0xfe77d3b3, 0x49185102, 0xaabdc3a9, 0x1c45b4fa, 0x9dfd8a23, 0x6c3d679b, 0x25dbd781, 0x9dfd79c1, 0x076c4b37, 0x0fc82244, 0x928d6a5b, 0x4473028f, 0x07acdf27, 0x1e43a6f7,
+        0xb6271730, 0xb40e8b24, 0x36cb378c, 0x41a2e19e, 0x4153eef5, 0x8a72c869, 0xf56659e2, 0x082dfa76, 0x2e906136, 0x6c75e590, 0xcc67a6be, 0x8c5966cf, 0x0a403c30, 0x8f1fc81a, 0x4f25116e, 0xb30ffa46, 0xf7935efc, 0xcee66482, 0x44597822, 0xa7e551e1, 0x1f333cae, 0x0e530888, 0x9b7d1c93, 0x5b7fc32c, 0xa535d14c, 0x51f8d1fd, 0xdfda4ac6, 0xffd9967c, 0xe5b75dab, 0x9f24e79d, 0x0d9d0b77, 0x0bb110d6,
+        0xc26f754c, 0x5994de8f, 0xdbe12149, 0xbaf1895a, 0x7b52361c, 0x6368ab20, 0x13398604, 0xf4572eee, 0x173981a4, 0x037e95c3, 0x33415836, 0xcd4922a1, 0xc73dcbf2, 0x398dc319, 0x68437944, 0x0c68d1f9, 0xd3b90059, 0x89664ef5, 0x25e13a95, 0x71faf9f5, 0xbba04d47, 0xe49c0fa8, 0x265f4e31, 0x911ef3d8, 0xd6a35eee, 0xd3802214, 0x8b9d2b08, 0xbabb729c, 0xf60f1d6c, 0x5bfad953, 0x1353a849, 0x947dcad6,
+        0xef0fb494, 0x324a3d8e, 0x5c033761, 0xc886ca86, 0x112259bb, 0xa1e99598, 0xf7476afb, 0x6458f8a9, 0xa6428ba2, 0x67d61a1c, 0x6bad8b5b, 0x3236d2df, 0x98b056fc, 0x4bd7aac3, 0x58dac9aa, 0x8623f4d4, 0x37b660c3, 0xe0845d6f, 0x09aff797, 0xd76e98c2, 0x2746e391, 0xe40283a1, 0x5f95fa7a, 0xab2b1c63, 0xe076f30d, 0x2639b8b3, 0x70ef1883, 0x2633c4bc, 0xa344e1d0, 0x07035f6f, 0x63474c6c, 0xbf32907e,
+        0xd6527aa9, 0x06af14fe, 0xc42d5e73, 0x7e433225, 0x20264a64, 0x32d4c003, 0x17b8a3e2, 0x8251487b, 0xa90a9e72, 0x96bb7017, 0x60af018a, 0xecfa7812, 0x1b984778, 0xf3610255, 0x9fb21354, 0x325b0ce2, 0x9f2136fe, 0xe317f113, 0xe9606a70, 0x22905154, 0x9b2b736b, 0x9d27f651, 0x7c3f9b72, 0xef73c2b9, 0x93a54c3f, 0x1dfc3f2b, 0xfb6afb43, 0xbd83dcc1, 0x84c0e434, 0x5441ed25, 0x59448435, 0x4867d87c,
+        0xfb9da6b8, 0x71e1f54f, 0xfdf462c6, 0x4afcf981, 0xe56a92d5, 0xcc1d72e9, 0xbdd83583, 0xbc6ddb16, 0xaa2c2e14, 0x96962c2b, 0xbbbda843, 0xf7c7825b, 0x6f983630, 0x5b0e0f78, 0x664e4b4e, 0x72e0c1ac, 0x37c7b7ea, 0x6f205044, 0xe1b280df, 0xd65db48b, 0xf12b7a31, 0xede67c67, 0xf2eeb4b6, 0x44380640, 0x1b3fd661, 0x183edfdb, 0x0ed7789e, 0x65ae21ac, 0x29e9d023, 0x621ca1f5, 0x870887f3, 0x389f65d9,
+        0x11db02cf, 0x79cff82f, 0x0298e973, 0x86b75a57, 0x1778578f, 0xaa0232ea, 0x9b80dc7e, 0xc6fe0f6d, 0x0e5b9e67, 0xd87317a0, 0xa8794508, 0x823d2586, 0x9368eeac, 0xf2d38a1f, 0x12e6dfd3, 0x53d3c0d6, 0x3dd77b65, 0xa8cc409c, 0x59e7eaf3, 0xb698d427, 0x2071f230, 0x22bf1989, 0xbd49e260, 0xa004110c, 0x721812ae, 0x5fa99f4c, 0x048231f6, 0x25982b08, 0xae846f12, 0x69a53c52, 0xe17e46f0, 0x5a6af424,
+        0x23cb4f7d, 0xdfa814c9, 0xcf941d14, 0xb5851f5f, 0x40bb694f, 0xc5a5f2cb, 0x063e234c, 0xc1f6e167, 0x87dd8024, 0x50faff1d, 0xef52a2c1, 0x5cc41a16, 0xc4f2b661, 0xd60726b2, 0x679dd8fb, 0xc335affc, 0xb7c274ed, 0x8688aca3, 0x7b37f584, 0xfcbb1b5e, 0x70f0e58c, 0x8dcd4edf, 0xf13e8f37, 0x5c87a0b6, 0x942ad200, 0x7c6f1544, 0xc89aa53b, 0x965f3c91, 0xb6fd9854, 0x45e45a91, 0x246500cb, 0x276c4dae,
+        0xb1631be3, 0x6f530ce5, 0x64c62d8b, 0x16a043bc, 0x20b56487, 0x8ffec489, 0xa4124f9e, 0x16a6e145, 0x7f5cb742, 0x789705e2, 0x106080cb, 0x0df4eee5, 0x86068831, 0xe6454bd1, 0x5085aee2, 0xd7374dfa, 0xdada32d7, 0xee00df3b, 0x024ed072, 0x8c40c254, 0x33dca459, 0xeabc6c01, 0xe16f4876, 0x686f83c8, 0x37d21ae9, 0x65e57867, 0x51541c64, 0x9e832bc2, 0x580e0116, 0xc175ee8a, 0xccd1df59, 0x7907d82b,
+        0x92329776, 0x209ccb11, 0xd030654b, 0x1cf0b45b, 0x160fddd6, 0xd4d44089, 0x312fec16, 0xf5eee744, 0xa127058e, 0x210ccc64, 0x10595aef, 0xcc87c3f4, 0xbe32c724, 0xff90c756, 0x9a784064, 0x8162d673, 0xcc66d7ae, 0xcf35d5c8, 0x291cbcc4, 0xebcc6c21, 0xbce9089c, 0x42a65923, 0xc1cd5789, 0x2d113806, 0xe19d9a99, 0x7a0a84b1, 0x6de2ce48, 0xe372a261, 0x2ffedf09, 0xcf4a9c11, 0x4d9379f2, 0xa7dda0e0,
+        0x521d229c, 0x756b6b94, 0x712759c6, 0xf249e5c7, 0x5ca47afe, 0x1a6ddc11, 0xa0275352, 0x34aa27da, 0xf056efb0, 0xdf42f051, 0x49728ab2, 0xb86b7f1f, 0x3e9e11de, 0x5d035fb8, 0xebbd159e, 0xc5d1ebcc, 0xed1c8790, 0xf5c52e79, 0x4f584ef7, 0xb40c159a, 0x1393e38d, 0xd509b3d6, 0xc7e79e47, 0x2576da55, 0x217883fa, 0x2d6cb50c, 0x7623ac32, 0x335c2ff3, 0x70aeed49, 0x2030d45d, 0x9ae166bb, 0x7f2900af,
+        0x20846ad2, 0x9edaa378, 0x995af4f4, 0x4d9cf510, 0x21d2fd1a, 0x0b328b60, 0x1d86b2ce, 0xb5ad63e2, 0x70ea2ec1, 0x4e5f893a, 0x4566c57e, 0xd7ea6e40, 0xf1b0fdd9, 0xfb3046e0, 0x8442b79d, 0x7b659340, 0x71fea7cd, 0x2743e2fa, 0x4effa1c8, 0x0d5219fc, 0x78378b40, 0xb5215265, 0xc7899650, 0xcee5841f, 0x2b3751ec, 0xc6802c77, 0x05bf58ad, 0x1db960ad, 0xb56f45d2, 0xe175992b, 0x9aeb179d, 0xd33b5a48,
+        0x69e6efca, 0x42aa1f4c, 0xea2e61d0, 0x8dc06004, 0x7a2884e5, 0xcfc03262, 0xea8d8220, 0x45b98659, 0x7f35485f, 0x083853c3, 0xed741f41, 0xc6a7fa7f, 0xb422789d, 0xc0139e33, 0xb1d415f1, 0x93cc8961, 0x012d0be2, 0x236ca2f0, 0x8a4bcfe8, 0x5b3d87fc, 0x69b86d79, 0xe7879700, 0xa0cd1f40, 0x7a0e75ea, 0x8b2527d8, 0xfcc6c450, 0x374ba533, 0xe69edca0, 0x8d56be14, 0xed2a522e, 0xdcdd1b78, 0x07ddcb75,
+        0x0143b413, 0xa294b6e8, 0x200583e8, 0x7f227279, 0xc66b08b9, 0xedcb94f5, 0x05380a47, 0x0b84b7d2, 0x248394f3, 0x86f73ace, 0x52066fce, 0x332a605e, 0xe79db2cf, 0x80fb875d, 0x9d394cfc, 0xae7ffae4, 0x0411e2fa, 0xdaf9066d, 0x4fb78b5a, 0x74358a2e, 0x31598191, 0xea540b35, 0x468511ee, 0x65771283, 0x06d67b8b, 0xbd6f7f8d, 0xd4a4d562, 0x34ee67e0, 0xc3a7bcd0, 0xb6d3fb16, 0xb89dc1d1, 0xb22cc5fa,
+        0xd29d9b0c, 0x812658dc, 0xc3b925db, 0xdcfb20d0, 0x1edd7a9d, 0x3c4c2ed2, 0x62638e2b, 0xd0e575e9, 0x0725f9a4, 0x75efb3f2, 0x00557d98, 0xb988354c, 0x01ca9e86, 0x65f8af6d, 0x2af3e870, 0x6c56e337, 0x2682f4af, 0xaead2f03, 0x83f76a23, 0x9ad283c8, 0x6b3be25c, 0xd9a48cbd, 0x98041a69, 0xdabe7551, 0x46e83883, 0xc6e12b81, 0x97c383ad, 0xa8620de1, 0x95cbc08d, 0x4691646a, 0x1f208b29, 0xcdef29aa,
+        0x141eb618, 0xdacbcbf0, 0x08357e5e, 0xe5bcd06c, 0x2b0d15b0, 0x31d3b385, 0x86301539, 0x9b146e26, 0xd763ef95, 0x1877a2a7, 0x4e710464, 0xe92e41b6, 0x30efe5d1, 0x137f740c, 0x10abaa49, 0xeb51b0a4, 0xf22db669, 0xbccf0c08, 0x3ea8ffa9, 0x80a48161, 0xa01a7d00, 0x79cc350a, 0x34e88dfc, 0xf06436bd, 0x3de2e04c, 0x2d0db3db, 0xbe5049b5, 0xb946d4e3, 0x27efddb4, 0x9fcc8b9e, 0xd2bb6b3a, 0x1ad5452b,
+        0x180f6db0, 0x7339c1c7, 0xfad40608, 0x1254df87, 0xa7397993, 0x8aa9483d, 0x48bbb718, 0x01da4ad0, 0xde02f7e9, 0xe2da37b4, 0x07b73ea0, 0x989830e9, 0xc2ccdb9f, 0x36f78e2f, 0xe56bda8e, 0xd45c2e76, 0x9e6e91a1, 0x5dac2442, 0xb882c6e9, 0x89ae4b0a, 0x76bedfb3, 0xe998a2e5, 0xc246617f, 0x971ad04a, 0x01d40e68, 0xa7014444, 0x318849e7, 0xaafe3e0d, 0x1769622b, 0x617b77a1, 0x2afda141, 0x9a9feb69,
+        0xf1372c1b, 0xef5e412f, 0xd97463d1, 0xe4bf5235, 0x2324fbd2, 0x2282f47b, 0xa9254d19, 0x67ab3e68, 0x09da75d8, 0xa3e55c77, 0x25ee03be, 0x3334017d, 0x2f4cb35f, 0x06b08586, 0xa53670a3, 0x39854ec5, 0xdb47137d, 0x95302a29, 0xda76d485, 0x24553f0d, 0x7e794766, 0x91523590, 0xc7e79594, 0xd13f9a11, 0x464fb66d, 0x04c62d9e, 0xf7a632f9, 0x140d6aa6, 0xfd93549e, 0xc47648e1, 0x159e73eb, 0x6c210f0e,
+        0x546d5777, 0x1f1618df, 0x44af3a43, 0xc89e0fe9, 0x3746b7a8, 0xf17aba32, 0xc45b89a7, 0xab8b750c, 0x5d743523, 0x9884864b, 0x276dad1f, 0xe37f1329, 0x2a3ee1b4, 0x7e61f5b1, 0xe4b3804d, 0x555e5ecb, 0xf21f47f2, 0x161d7f4a, 0x8478be1d, 0xfbc5e738, 0x04b41e75, 0x8febb733, 0x6b57a04a, 0xfb524623, 0x1f40f8f4, 0x5870e200, 0xf3ac4d0b, 0x777f5d07, 0x452a8a19, 0x71136ca8, 0xe4c6754a, 0x3dad4fc8,
+        0xe52b4877, 0xcbf12ab1, 0xc6894533, 0xe1fb97c2, 0xe8a87d0a, 0x1956294a, 0x04452a4c, 0x61f6492f, 0xf593f213, 0xe79cfa71, 0x1343c1bf, 0x82b3dd7b, 0x48fe81ae, 0x88347ed5, 0x7cf53ea2, 0x13195611, 0xf87763be, 0x1c0001a4, 0x916fdf5b, 0xbda7f252, 0x4622eb9f, 0xa13eacaf, 0x210b9b61, 0x62264eb9, 0x27baaaa8, 0xce014243, 0x44d0da3b, 0x1f966744, 0x6f1360c7, 0xcedd2d38, 0x6559edfa, 0x12198691,
+        0x6cdcf431, 0xe815e9dd, 0x9d489d72, 0xd0f1e035, 0x7261d6a9, 0x5fd41fb2, 0x0313f63f, 0x0d59c8ce, 0x08c5fa20, 0xa53aeb78, 0x6615d1ed, 0x66eb1f15, 0xfabd3d9c, 0x98d3031d, 0x8af2e75b, 0x19bfc912, 0xe992329d, 0x5a93ed89, 0x52fc15f6, 0x3d2a1ba4, 0x4a5f4a7e, 0x936757ba, 0xe1046e1c, 0xa977b653, 0xc775fe7b, 0x3fe859ef, 0x64f83105, 0xf453a533, 0xe1e01d49, 0xa45741cd, 0x6cf89be7, 0x87fa584b,
+        0x77648c26, 0x31a61a05, 0x6cc84a4f, 0x0251bf47, 0x7488a539, 0x9b04bfd2, 0xb207581f, 0x166da4f1, 0x1877d094, 0xa010cc2f, 0xbbc40e2d, 0x4a80bc67, 0x2148d3f1, 0xfc0217cc, 0x7f1c8174, 0xe3978473, 0x4278fa78, 0xdbb8c6f3, 0x9777778c, 0xe5063563, 0x3a452f44, 0xaba4449b, 0xf4829828, 0x2dc72956, 0x1021641b, 0x1dc5a8ea, 0x2ee94934, 0x7859e771, 0x9fce52be, 0x3fe89844, 0x4a9991a7, 0x24727b78,
+        0x231eb716, 0x166e9c85, 0x305df18a, 0x26b7c2a5, 0xf4e4dafc, 0x2af3bcbc, 0x4beed5f7, 0x4f103ddd, 0x3cb953ec, 0x000a3cc9, 0xa9001573, 0x7c854cdb, 0x01198a6a, 0x0d57c7a3, 0x1402d959, 0x2b975164, 0x4f40ebc4, 0x06a5d2f3, 0x395624ff, 0x6fd53667, 0xb1fe7c7c, 0x5f4cd18c, 0xb34265ce, 0x1140d986, 0xda109100, 0x4eb5e2fa, 0x8f1e8783, 0xcb0904d7, 0x92014d83, 0xda258f2f, 0x87ea64e6, 0xf970404d,
+        0xdbdff9bd, 0xcc763e3e, 0x7243b88b, 0x4b161c56, 0x622545d9, 0x80d67ece, 0x98696e1c, 0x75b46cb8, 0x4e171985, 0x367806f4, 0x19e2330f, 0x911535a5, 0x5f376b11, 0xda3e7b95, 0x38df2ba1, 0x33f57846, 0xa4aa801b, 0x8ef4fe9c, 0xc6d2f14f, 0x2e6b709f, 0x6e16b63e, 0x7877a4d2, 0x9efde369, 0x2e979fa1, 0x47716fc3, 0xbe2c6fbc, 0x7a6156cb, 0xd3eaaae1, 0x5092e7a6, 0x1f7aa14e, 0xd3c16831, 0x3ab4ac47,
+        0xbe3fd11b, 0xa1c276d3, 0x24f1940a, 0x1a12f442, 0x1179d22a, 0xd3414b6b, 0x883a19af, 0x2c9179d4, 0xbe73da6d, 0xdf9ba373, 0xd5f2a36e, 0x9114a520, 0xb87d5e82, 0x6ef29402, 0xe33b3c45, 0x59f5571e, 0x29b0c254, 0x68b221df, 0x3384745a, 0xc7310067, 0xe1c83b29, 0x0db5f14f, 0x7642f0ce, 0xbf0270b7, 0x2fe27f7b, 0xb0bfb75d, 0xb991e226, 0x84f4e5a8, 0xe2308177, 0xa4abcf5d, 0xcc4a773d, 0x0511463a,
+        0xd7cd08c9, 0x041ef25b, 0x89bd66ae, 0x8dab2bb2, 0x35a7a135, 0x50fc8f58, 0x87cb461b, 0x028fae44, 0xd7e2aa7e, 0x5465adb4, 0x37208acc, 0xbd310117, 0xb77b58c4, 0xd04a3ac7, 0xdcd7d4bc, 0x9be09796, 0x78a4c767, 0x7a77531f, 0x75e39799, 0x73a77af4, 0xf1498763, 0x81f7e7b1, 0xa0db0f5f, 0xaa17a765, 0xce6f5a8c, 0x16344d19, 0x66cb56c8, 0x198381ff, 0x5246e651, 0xd72d711e, 0x60f96f3e, 0xaccadb20,
+        0xb80e6278, 0x2d684cad, 0x316ca531, 0x79289b61, 0x7d6fc605, 0x7f5bc15e, 0x1eead5c0, 0x2f3996b3, 0x23d1ca38, 0xac66f8e6, 0xf27b657b, 0xa7a5c807, 0xa1858163, 0xfc07ccf9, 0x704bbd1a, 0x947d81c0, 0xb52fdd8b, 0xf186c38f, 0x8796e7ad, 0x6ba883b9, 0xa705737d, 0x8198dac7, 0xc73715b2, 0x1a17adf2, 0x9e366b75, 0x598279c0, 0x8088cc08, 0xfa7eab37, 0x7c415ec3, 0x03236e49, 0x1c32c475, 0x2ae2ed3c,
+        0xeaa302e7, 0x6d606a10, 0x6ec0179f, 0xd1351eda, 0x6d4fc214, 0x017bbfc2, 0x077f4bdd, 0x4584e055, 0x82ab4d4b, 0x7a7c13e3, 0xf6b53b36, 0x8b648db4, 0x467d5b14, 0xe4ced47b, 0xbe503641, 0x777f1cb8, 0x1de6c588, 0xb265dfa3, 0xc4f2d84b, 0x32aa9a86, 0xc406315e, 0xf58efeae, 0x8a6fa84a, 0x7dfe169c, 0x2b5870df, 0x9de7f2c4, 0xee1c600c, 0xbce0d846, 0x354d272f, 0xa46f19c8, 0x050f08bf, 0x14151a44,
+        0x9a0330c5, 0xccd81696, 0x9b7cab81, 0x9d461e30, 0x7806dff3, 0x52f6d496, 0x98a801d0, 0x5ef4c168, 0xb9349718, 0x302c8584, 0x6879f08c, 0x29726756, 0x98fd38bf, 0x651023a7, 0x6cfb4e4c, 0xe51212d3, 0x1f31031b, 0x13d2166d, 0x59968a80, 0x97d01678, 0x8bf7853e, 0x21da4a00, 0x20899196, 0x64aa2a95, 0x14dcf5df, 0x20981e12, 0x4a19dd8b, 0x01b23c2b, 0xad43d412, 0x34b9405d, 0x7500b7f2, 0xdebfe830,
+        0x7fcc8f46, 0x8357f855, 0x0ef86e33, 0x151b40c4, 0x12d7d9ee, 0xa2df1a57, 0x567f17b6, 0xace0f54b, 0x5608c25b, 0xa53c1d92, 0xfc26510e, 0x76831699, 0xc06d0bf1, 0xc02e9ff3, 0xa5830e98, 0x9cdcc79f, 0xe2037691, 0x88681d44, 0x830b37e0, 0xfdfa7108, 0x604ed3c5, 0xd88bd5e5, 0xe23e3c65, 0x42d3b56c, 0x3eea3f2c, 0x61b7f1cd, 0x29fc1e6b, 0x48c986ca, 0xa89a430d, 0x98d66989, 0x4170325c, 0x4c5fe4f6,
+        0x2858af7d, 0x7ddbc9f3, 0x46cfa2e7, 0x9f21b63f, 0x4c782d3e, 0x86f0eab1, 0x0182f23e, 0x691dbe8c, 0x3a88effb, 0x663b309c, 0xab8cd6ed, 0x81b80a5f, 0xfb4e6fd1, 0xd4d28082, 0x4192f776, 0x4e0142e5, 0x9e82195d, 0xe6ba5de9, 0xf8c9d13b, 0xaf2d7484, 0x7dfeef88, 0x34d8deda, 0x4d101a0c, 0x2d187609, 0x98db58ef, 0x3da7886c, 0x8b1b22d6, 0xdfb46468, 0x2138a826, 0x415ec74b, 0x8d5e3fc0, 0x3e2c1819,
+        0x2629120f, 0x2143b06a, 0x4230427b, 0xd602a5bb, 0x8759a9a3, 0xc3f6c7db, 0xd039749b, 0x70600fbc, 0xb7f1dc25, 0x660ffe43, 0x8035b1dc, 0x3b764f28, 0xe4dbf5d1, 0x265e6ed6, 0xf3622b7e, 0x4dc580bc, 0x765cec5a, 0xadea769c, 0x499ffaf7, 0x1ad7ba7a, 0xed2664f3, 0x201f7974, 0x7f0f5d7a, 0x45a90831, 0xe098b3a2, 0xe4621601, 0x3696c2b9, 0xd5462e58, 0x1d4966fb, 0xb5d749bc, 0x1fd32461, 0x6d1bba60,
+        0x92f86a55, 0x2b99e4f4, 0x77642bb7, 0x23c3bec8, 0x5fc0fed5, 0x2c87a899, 0xc12e7567, 0xa9beb5b2, 0x74a256f6, 0x99e48da0, 0xb4be45c2, 0x556c6174, 0xedf43b2b, 0xb08ad988, 0xd20a0a51, 0xa522b6b3, 0x0a33723f, 0x0948a926, 0xf7582369, 0xded4cfe3, 0xe351e355, 0x556dfa7e, 0xa386adec, 0x2051fc45, 0x02cde34f, 0x3e1b6488, 0xfa2da021, 0xa21c194d, 0x62b1fb49, 0x073997ed, 0x66500a76, 0x0b94a913,
+        0x82a23d9d, 0x6f72780e, 0x8d37a547, 0xcfe9e8a2, 0xf57a0a79, 0xe0e0f5fc, 0xdafb96b3, 0xb1dbc5b7, 0x7a095de1, 0x9a476147, 0xe0b884fe, 0xc7b4197d, 0x63cf08dd, 0x887af180, 0x0c95ea33, 0x4b16f19b, 0x4eb40c16, 0x4b15815e, 0x51f942d6, 0x951b2393, 0x76177782, 0x8afcf627, 0x7cf65286, 0xf5b4a2a7, 0xb4ed009e, 0xbc26f4f0, 0x5e072da8, 0xedd3d0bf, 0xf1022c29, 0x44783d52, 0x44a7f010, 0x11e35aec,
+        0xbed23e28, 0x38b988f1, 0xe8b9075d, 0xd4f0d5ba, 0x95a53c4b, 0x1d57d807, 0xe81099a5, 0x0eb2777e, 0x0e82c829, 0x1b2baaa6, 0x8e864860, 0xc10427d6, 0x00c21362, 0x1cb88acc, 0x27353f88, 0xd818958b, 0x6851597d, 0x2a0499bd, 0x3bc31bd6, 0x603e2987, 0x890a52c0, 0x59c7e81c, 0x4fc56c25, 0xdb833f90, 0xb569104a, 0xc2634db5, 0x96499986, 0x7c7a3c2b, 0x3d3ba313, 0xe3b38c96, 0x10662a5f, 0xd401e28d,
+        0x00dccdb9, 0x7ca49b5d, 0x306713fc, 0x7adf63f1, 0x7dbf867a, 0x0f51ff69, 0x9dd0e70e, 0x8f40d8b8, 0x1f6e3fbc, 0x89881ec8, 0x220e5ac6, 0xe2225a3a, 0x506e27ab, 0x628338f8, 0x167dacda, 0xc49303f4, 0x68a6ae0e, 0x5ebe53c3, 0x4846108f, 0xed3777bd, 0xa16e5f00, 0x972e2635, 0x3841e406, 0x45c13b8e, 0xa77d2ca8, 0x00c97760, 0x31872579, 0x5881da5e, 0x1837b570, 0x4c2958ed, 0xeb19a638, 0xc4074c97,
+        0x8ee8ca54, 0x174c1e0c, 0x6aea89d5, 0x9426d1b2, 0x1c464659, 0x97321936, 0x8d80a86d, 0xfbb514b1, 0x1c7ce23d, 0x6c8a7a89, 0x3c6bf7b0, 0xd11fd96f, 0x237ed63d, 0x30901f15, 0x5407895f, 0xb53b8b0f, 0x58b06de1, 0xbf1043fa, 0xedc2ff9c, 0xb56aab4f, 0xe368b860, 0x208df8a9, 0xca405aee, 0xdb4aaf53, 0x13107cc4, 0xfa6a2e52, 0x6b77d5dd, 0x9ac8be2b, 0x658fba56, 0x168444c2, 0x69b5d28e, 0xab80b81d,
+        0xf9550f1b, 0x9c68a55f, 0x3ce6b29d, 0x31ddec29, 0x1bcba995, 0x378d55c1, 0xccceb522, 0x0982923f, 0x0b78d644, 0x66407d0f, 0xf5bfb27f, 0xa0af000f, 0xcd388eeb, 0x937517dc, 0xf5e99cc8, 0xe7f60580, 0xc4081af0, 0x38d8f1d9, 0x9bb518ef, 0x2c0881ca, 0xfd31d474, 0x576a2acb, 0x9003ad38, 0x3d962664, 0x7ef284e5, 0xddbfdd45, 0x40c7504c, 0xb22a4b0e, 0x322a8392, 0x58f0b2dc, 0x7e23d98a, 0xe8b05abe,
+        0xb5fc830c, 0x848fc7bc, 0xfcd49403, 0x33e29998, 0x55a9a23d, 0xba5ca4ef, 0x385cbf97, 0x21cab695, 0x58644b78, 0xf458e83a, 0x17738214, 0x7e92d714, 0xa1b09b93, 0x41074e24, 0x60d0f150, 0x515cd827, 0xe32a37a4, 0x9a1a8f28, 0x6d30e716, 0xf618a7db, 0xe409c3e2, 0x423dcdb8, 0x39671bf6, 0x2a08cf43, 0xcc039371, 0x194fdf9d, 0xdbb851d7, 0x99f47538, 0x6d562e20, 0x581ed95d, 0x96bf820d, 0x518893da,
+        0x17799e0c, 0xfbd6a0e0, 0x40263372, 0x2c0e1d23, 0x9801672b, 0x3b8e4c95, 0x8544b071, 0xeef4d2bb, 0xe9ff71e6, 0xbdb2bb4e, 0xa9cd8dbe, 0x38e198a7, 0x7fe93aa4, 0xdd138cff, 0xa2826d0d, 0xb5e91b2f, 0x161bb889, 0x83844b22, 0x0a725723, 0x08b26e8e, 0xc0667bc7, 0x310df541, 0x52e1b86b, 0x118ad2e2, 0x110587ff, 0xf129903a, 0xec5a9099, 0x2258d37a, 0x0dea92a0, 0x7f126f14, 0x1164af6d, 0x74493382,
+        0x92d32641, 0xf53e5e49, 0x706f5153, 0xbc37860c, 0x0701a363, 0x1f2f4ae6, 0x0cb917f1, 0x9e144bb8, 0x3d11ccca, 0x4c465e88, 0x2096d17e, 0xf6e50002, 0xa15d3aa4, 0x655f24e2, 0x79f64777, 0x88aff273, 0x1c28c6a2, 0x93fc9817, 0x6f7873a9, 0x7e8e78d5, 0xe6e1826a, 0xfe80238e, 0x90da7f9f, 0x962b71c0, 0xbb0b75c6, 0x2329601f, 0xfb2032e8, 0x931b2c72, 0x9694db3a, 0xcf509f2d, 0x80cf3033, 0x7fea9629,
+        0x8816864e, 0x46986df7, 0x9b35a381, 0x7a421fef, 0xc3aa48c5, 0xbf580021, 0x99c27e25, 0x796e46f9, 0xb8fb6261, 0xec051867, 0x6f6a3f32, 0x21ec8814, 0xa582a353, 0xf3652391, 0x2d3be9a2, 0x1d54cae6, 0xe060bcf5, 0x44049cca, 0x406ec35b, 0xddad83e9, 0x5b428ba5, 0x861ac36f, 0x4da811ae, 0x5a3cf8ec, 0xf7bf186e, 0xb41b218b, 0x313a050a, 0x8f51079b, 0x190da495, 0x80e6c641, 0xb19c379b, 0x13a4d1be,
+        0x18950f72, 0x79a8d8b0, 0x330afc4f, 0x9debe235, 0x9b67f442, 0xcf194d2c, 0xb5af9e0f, 0x12317a12, 0xe3f99c61, 0x99f6a525, 0x9a46b6fa, 0xab2cc6ed, 0xdcc9becb, 0xbaf1ce3e, 0xad0b87f1, 0xd673b109, 0xc8f5a97d, 0xf4a062a0, 0x8961c648, 0x9f35bc0b, 0x01237799, 0xc72196d5, 0x32d82dec, 0x3c78280c, 0x705042df, 0xc26dbdf6, 0x8eec2cfc, 0x8d41ad49, 0x6297d8b3, 0xc01dee54, 0xa59886cc, 0xa5dca2d2,
+        0x95eebd05, 0x6f3b2ec4, 0xc42e4516, 0xfeb21916, 0x2cb4dc55, 0xb8d96ab2, 0x80cc1f8a, 0x4d2e1d85, 0x61f6fc15, 0x8169eef7, 0xfa29aa52, 0x606a3130, 0xefa32d0b, 0x0eb94524, 0xe48a68b6, 0x36ee0913, 0x718b28c2, 0x31181303, 0xc0640bf2, 0xa6a67117, 0xe8cea510, 0xacea6f0f, 0x5f91c1c0, 0xf052cf5f, 0x1dc538f1, 0x4ac2e00e, 0x866e54a1, 0x6b840aa6, 0x5753fa0a, 0xcd027ec5, 0xd97276b4, 0x9ffe399f,
+        0x2facdef8, 0x05962c52, 0x35704fb4, 0xb0e5681a, 0x87ca5226, 0x613086c7, 0x1593b741, 0x2c5d4bb8, 0x3da3133a, 0xf3eb9903, 0xa2720a80, 0x76b11c42, 0x1c6f7836, 0x165b8151, 0x9b7af0c5, 0x9f98485e, 0xe3c7275e, 0x7a070d13, 0x7d9d9376, 0xe3e3056d, 0x50420ac5, 0x97772522, 0xc31ba1f4, 0x0f8c13d1, 0xf45bd711, 0x2fba8054, 0xa558a3ba, 0x7004ac1c, 0x7c3de70f, 0x68a33e98, 0x702caff1, 0x0b9c6591,
+        0x2fb6bc05, 0x8b5039e6, 0x71713fc9, 0x4af9d85c, 0x7cf56b44, 0x9921668a, 0xdc731c8c, 0x20cebb66, 0xb769a6e8, 0xa5ef63c6, 0x9ece1f5b, 0x26c71db0, 0x16fb67b8, 0x3180a561, 0x1c9c6657, 0xa271819e, 0x9359d1c1, 0x0d0ce612, 0x762f2ee7, 0xf2628ad9, 0x8ba2914b, 0x912678e7, 0x09bb2bcd, 0xe8e810bc, 0x944c1952, 0xffe9dfe7, 0xa104b1be, 0x4e34f2b4, 0x7b5f97ac, 0xe6a21b5c, 0x29184be5, 0x0cd62b69,
+        0xc11ef96a, 0x49ccc6f5, 0xcb228d19, 0x03dc1b7b, 0x4a972ce9, 0x99f77fb0, 0x81f29e27, 0x1abc5df8, 0x3ced129d, 0xa7ed1307, 0x3153c786, 0x57347f34, 0xcf06c5aa, 0xe4e75641, 0x11118019, 0xcc6bbba3, 0x32240adf, 0xbd26907a, 0xf98b4df5, 0xf2c0c995, 0x9339208a, 0x0f17f3fb, 0x954d7c6b, 0xde1647a2, 0xf3349e71, 0x7bdf35a9, 0x199c2b58, 0xe1491e69, 0xe0f4b2e9, 0xda55c4b0, 0xe4361b92, 0x641220af,
+        0x36cb1d36, 0xa8655d1f, 0x2abd6629, 0x0492e377, 0xa5687afa, 0x79d68215, 0x2e2afeba, 0x643073a2, 0x1dd6388f, 0x205aa485, 0x5d86882a, 0xb4b0669c, 0x67020db9, 0x19ae26ce, 0x16fdc7e4, 0x1c527acc, 0xaf0b6ca7, 0x8d2f696e, 0x8c0142e1, 0x33780446, 0xfc67cb24, 0x6ecfc9f0, 0x3676c188, 0x5e4c85ab, 0xeb42f6b0, 0x47374ee4, 0xaa4808dd, 0x8dd8027b, 0xbe5497b8, 0x5f1e3897, 0x60e295ce, 0x036969ee,
+        0x798a6ade, 0x8e10b1ff, 0x1b33f7d9, 0x96bad78d, 0xe23fad2c, 0x7e663b0f, 0x71f2491c, 0x9bc41eaa, 0xab110329, 0x4ae5cc2a, 0xba6c59da, 0x8da0c016, 0x491feb58, 0x0cbc5e1e, 0x97fbdad7, 0x25fe131f, 0x5edb11f7, 0x9474b077, 0xcbaee850, 0xba72e555, 0x12d3280f, 0x3bc974e6, 0xfe240dbb, 0x5f5ab50f, 0xc6a9dc6d, 0xaf783fd9, 0x01e307c7, 0x0e641624, 0xe3921f95, 0xe8d009c5, 0xdd374b56, 0xbf820e7e,
+        0xb29580f2, 0x16d9dd5b, 0xe28ed74f, 0xaee2e7cd, 0x77347b34, 0x247a162f, 0x5f1e7464, 0x0eefeceb, 0x1540e76a, 0x08cb6b15, 0xff49b730, 0x0f76fb17, 0xdead2b64, 0x5c61433a, 0x00049ade, 0x3995ade9, 0xae12f44d, 0xc75ec487, 0xa7a63847, 0x75cb9122, 0x696c945c, 0xdc55bfaa, 0x79f3471f, 0x53dcb283, 0x6365ba84, 0x44fa9aaa, 0x73ba02a4, 0xd2b0d72f, 0x06d9bb80, 0xd4d90d78, 0x6cdf9195, 0x85ee361a,
+        0x1b160e3c, 0xcd41de77, 0x0b095700, 0x005b289a, 0x8e5e066b, 0x303bf9fe, 0x9c7d4ec2, 0x726760cd, 0xbd241c46, 0x81cd9bc2, 0x41c5763d, 0x704ab04e, 0xb9ec1b11, 0x7e6180cb, 0xb697be8f, 0x330303e8, 0x80f6b62a, 0x8fef46d4, 0xe48c8c1f, 0xd3872c72, 0xc785c9fe, 0x684d84f2, 0x7eaf27c7, 0xf8b5d8eb, 0xc2f22220, 0x6287522d, 0xaac37108, 0xb673edaf, 0xfa658fc7, 0x9f2630a0, 0x1df85ad6, 0xa6fb3a8f,
+        0xde8bf81d, 0x313b9cee, 0x915ef590, 0x7ad188fa, 0x1ec23bb7, 0x4c43fce4, 0xf8678257, 0x009d5731, 0xd7080dcc, 0x83f8651c, 0x0ff3fbde, 0xb0a81da5, 0x472fc35f, 0xbda90cb5, 0x68dd82ca, 0x096142c0, 0xa0768a1a, 0x8a162360, 0xeb4a573f, 0x1d9bd052, 0x6a476196, 0xad93cce3, 0xb624dffb, 0x00f44e87, 0xf88b3f71, 0x626871d7, 0x6f7b183b, 0xa37b023b, 0xa2a8640c, 0xe52c6d47, 0xe6cc4fda, 0x37d8416f,
+        0xdf201bc2, 0x8bef939e, 0x248907ff, 0xed0c212b, 0x335a5c7f, 0xbe94fabf, 0x9ef52337, 0x4b9eea60, 0xc6685016, 0xb23fe0ca, 0x3f2f01b2, 0xa0280b8a, 0x5e946b80, 0x419659fc, 0x575229ae, 0x703d1dd3, 0x74d5f15d, 0x1ae7a44c, 0x2bbb1a40, 0x13358389, 0xbee00842, 0x80ebe210, 0x191514a4, 0xb4719287, 0xe3e8b23f, 0xeaf97975, 0x15041f8f, 0x8dfd4be0, 0xc811de56, 0xa3a6d554, 0xd942f346, 0x91fc3b50,
+        0x736cb322, 0x96c4e746, 0x9af698cb, 0x22de5559, 0x5abe8c65, 0x80aff5e7, 0xc254147c, 0x7ccafeec, 0x96e59881, 0xa36b23d5, 0x9c8fd951, 0x376bf541, 0xd7da082c, 0x5533970b, 0x74fd28c5, 0x31da97d3, 0xe1fe81a8, 0x841b4722, 0x7e5ac6ec, 0xa62b3e84, 0x9f7323c6, 0xf38b56e5, 0x8fea0d7f, 0x0e75f714, 0xb8bec46e, 0x482bfbdb, 0x8bf91cd2, 0xb506079d, 0xc8d1271b, 0x37885ff6, 0x72442a2c, 0xffd46cd5,
+        0xe972cce7, 0x73812825, 0x162a91ac, 0x0431dc00, 0xffba5bd7, 0x47ef62de, 0xba42c132, 0x40da991e, 0x8ef3bd43, 0xfa2910b0, 0x24901f50, 0x87fcfd6b, 0xd66f5fb5, 0xc176a9b5, 0xb9a9cf5c, 0xaeb0eddb, 0x6ad96529, 0xa6653d70, 0x45ee8380, 0xb76bc375, 0x5090ad1f, 0x3502c555, 0x94ea0816, 0xdb9c3260, 0xb079c888, 0x446f1025, 0xdd266de1, 0x2ac1b308, 0x35fad67b, 0x2dda5992, 0x81ba7942, 0xf96920ed,
+        0x6cd00f52, 0x423cb9b6, 0x3d5cfc1b, 0x4bf1292d, 0xc1ed0b36, 0x8c6c2285, 0xcababd3b, 0x0ed4696d, 0x62c90644, 0x78204ead, 0x516c02f6, 0x3f205792, 0x7b1de92e, 0x17bf8151, 0x474c29e6, 0x84b7000c, 0x28750f03, 0x5d7fd801, 0x653975b3, 0x02f7a311, 0x4913a5d3, 0x2955f428, 0x3e389120, 0x0b0ac121, 0xa47c2b1e, 0x844412bf, 0xf4f8f43a, 0xb34b43ad, 0x2fb3af7a, 0x5c901e7d, 0xe8d619a1, 0xd76eab45,
+        0x9198f941, 0x305f2b7a, 0x318a4bb6, 0x407dd095, 0xb448f873, 0x87f9e7ad, 0xa6cde946, 0x5b31997c, 0x54f73268, 0x8a17e6a6, 0x8585863d, 0xf6adb602, 0x0656e58a, 0x7b56bfcf, 0x05b3ad98, 0xeed93b17, 0xcc6c175b, 0x08737a58, 0x1b99958c, 0x689bbed5, 0xb055a89d, 0x947d53f9, 0xc668156c, 0x3f94cf2f, 0xca9f58de, 0x9d1d28e5, 0xb59fc348, 0x806d409d, 0xf2504ec0, 0x231aaad5, 0x4c4b06a6, 0x13a3d7a7,
+        0xfeee21c2, 0xd5d8f51c, 0x8df04179, 0xe32f5ce7, 0xa7f56a5b, 0x59391e59, 0xf20260cc, 0x7706d498, 0x3981d34c, 0xb09bd885, 0xfb44c50e, 0xfa00db4a, 0x2baddb2a, 0xaa2caf46, 0xf0e951e6, 0x8bfba924, 0xf4fb54e2, 0x74929615, 0x2ccdc3e2, 0x36c8e087, 0x0de73f6a, 0xd1bab992, 0x44a94f0a, 0xb92255ee, 0x8bc74acf, 0x9c86aca9, 0xc6729f02, 0x216f1ef8, 0x9a8ffa5d, 0x7d90696e, 0x50ebae31, 0x59a42c49,
+        0x6ef03182, 0x0589e32e, 0xd7c05eaf, 0xeb85302e, 0xa04a3be9, 0x979be27f, 0x45c5b59f, 0x06e0048e, 0x83b88734, 0x102832d1, 0xe36e372f, 0x52364b79, 0x2c9ea8a1, 0x07e397c2, 0xd1efff61, 0x5d5aa9e2, 0x2e629744, 0x568d356a, 0x18e645b1, 0x25a1b673, 0x08043f5f, 0x225fb0a3, 0x029ae291, 0xab06b04a, 0xf7aa98fc, 0x7e5cba0a, 0xe3566da9, 0x88a5311c, 0x0cb82e37, 0x198b6e11, 0xab92ae6b, 0x815ed3b6,
+        0xfa03dae4, 0x6e9fdf98, 0x38635c50, 0x7e6bb6b6, 0x1584dd4c, 0x4abfdedb, 0x5bde9296, 0x751234fb, 0xbbb1e487, 0xc61b210b, 0x9a261fb1, 0x6b494733, 0x738d0987, 0x8fba350d, 0xe9ad7fea, 0x61c72d27, 0x00d039ae, 0x40ffdae1, 0x829495b9, 0xe91d0fbe, 0x24fb641d, 0x768292a1, 0x8130bc56, 0xbfbe5d1b, 0x917684fb, 0xf0b836a2, 0xa465449f, 0x40b5da18, 0x34f99d6f, 0x8a2d5440, 0x57168176, 0x599a27a9,
+        0x53d55a75, 0x17261c6d, 0x9d6e564f, 0x1fd5d42c, 0x975835ff, 0x2021d3ea, 0xb01bcb4d, 0x0c37a00c, 0x2a9bab09, 0x4259ef26, 0xa6f8613a, 0xaa673867, 0xc4c57002, 0xb7f78ec6, 0x6550f1e6, 0x2dbe8119, 0x65719173, 0x9146820d, 0xb12eca91, 0x5ee0bbb8, 0x3cd82329, 0x85ab3433, 0xf2e9fa2c, 0xb55e6feb, 0x22c0aa84, 0x3de70b88, 0x82f2adc2, 0x2f89887a, 0x0a9b34d3, 0x22722b8f, 0x4ffa133b, 0x4d7f880f,
+        0x525f85ef, 0x0554db01, 0xf2c54019, 0x45f30174, 0x351450b4, 0x1458741b, 0x7d458dac, 0x7bc5a848, 0x71d63d1f, 0x73c373b9, 0xd2231e47, 0xadbf8432, 0x04799551, 0xc56157d2, 0xc9dc24c1, 0x30729759, 0x8a7139d0, 0x2dbd935f, 0x0ba457f9, 0x89296511, 0x838bb3fe, 0x38901c6d, 0x721468e5, 0x12bebf52, 0x7dca1782, 0x85397c97, 0xa8ee8466, 0xb413512e, 0x815ff1a8, 0x6afa4fc6, 0xbdea8481, 0x6faa5d4f,
+        0xf1a02148, 0xb5a95707, 0xcca091fc, 0x48f5e9f3, 0x700ed6bd, 0x2fe369d0, 0x171ebc56, 0x23b70c05, 0xeefe509e, 0xc9081efd, 0x60dd44ea, 0x847fda62, 0xc248bbde, 0xbffa0606, 0xcdc567b9, 0x6c0dbd55, 0xcde26dc3, 0x4141e262, 0x9885ed94, 0xc01b02a4, 0x533258d0, 0x8c791c7f, 0xbf93baaf, 0x81c7289b, 0x79fa0e15, 0xe2a78d22, 0x83fdbf09, 0x0f4d9263, 0x7ae77b9b, 0x1e875626, 0x6c8c5e08, 0xf759fe59,
+        0x2d0f7cf8, 0xa9864cc0, 0x47d28eb5, 0x2d9a2459, 0xe0af101c, 0x8e7b8658, 0xdfb4fe02, 0xee07c469, 0x7d558dd9, 0xb3b94f4f, 0x9b3545d7, 0xf70e4db0, 0xb7ba5b06, 0x3294b38d, 0x23d8946f, 0xd87b0901, 0x9542ff11, 0x4423a488, 0x31eb860a, 0x792c76e1, 0x1036e685, 0xa7769fac, 0x105bdc3b, 0x1dddcc1f, 0xf09b1135, 0xb24bc923, 0x852acdbe, 0xd5b45c8b, 0x266e00d3, 0x7fcebe11, 0xa587123b, 0xe2588cd5,
+        0x9572bf4f, 0xf6bbca52, 0x4ff51b38, 0x1f680389, 0xac11a398, 0x8c91c538, 0x65a579dc, 0x68a45805, 0x38322f46, 0xd622c0fb, 0x3da66e37, 0xe132cc29, 0x62e98708, 0x0d91088f, 0x089389d5, 0x36792ae2, 0x58c2d2e4, 0x98e34a27, 0x8d52a036, 0x0885ed81, 0x8ef5ed24, 0x53d5f8a5, 0x111ac599, 0xa53d9c45, 0x94fa00dc, 0xb2e383a5, 0x79d1cf92, 0xb4f420c9, 0xa9749515, 0xbb28ecec, 0xc93db0ed, 0x794e5de6,
+        0x30a5a982, 0xc97d48e2, 0xf6256cc9, 0x13e13fd7, 0x88f9c7a5, 0xd468571d, 0xea1dd1c2, 0x84e1c9ea, 0xa54a3b85, 0x109f64bf, 0x2749c571, 0x3b7ec431, 0x0d5bccbe, 0xd79a5203, 0x03da5e2c, 0x39b2a03c, 0x3244d168, 0xbb673b22, 0x871826fd, 0xf23dfb3c, 0x25cdd41c, 0xb27ed1b3, 0x12b8e3de, 0x8e962ce1, 0x8e09ee81, 0x5b6ab0cd, 0xfb355833, 0xba561d3f, 0x29b1444d, 0x5a7461c6, 0x2816d12c, 0xdae70d0b,
+        0x29e65153, 0xfdaa47ee, 0x1417e536, 0x399e7921, 0xb7e91c5a, 0x53dba622, 0x723e7139, 0x8a9c539d, 0x82972cfe, 0x3c47f02f, 0x9aeab0d8, 0xfb435198, 0xe210f85b, 0xb2d00103, 0x1f35db70, 0xe8598630, 0x4a4e2b3a, 0x3698dfe4, 0x0ff5a60b, 0x204c7059, 0x24be95c1, 0x2d3588c9, 0x11662d77, 0xf771e6cb, 0x2f61d650, 0xc401927f, 0xc4c80a1e, 0xd3f4776e, 0xe5ce2aed, 0x2377b0b6, 0x84ad74bb, 0xe562a6b2,
+        0xd839cc97, 0x372e71c8, 0x3a8fca69, 0xe743a00e, 0x6da9db2f, 0x3e6de88c, 0x5e48541e, 0x6d4b754b, 0xb23030ba, 0xb26eeb37, 0xf1c2eeb7, 0x92152535, 0x37c764a0, 0x81c186c6, 0xc0c4db55, 0xcb3ab1ea, 0x851422ca, 0x6ef3bb8d, 0xc2943e4b, 0xe3ae32d5, 0xe180a9f7, 0x5bd057d7, 0x3ccb5e96, 0xa1ec1c9b, 0xf08fc2f3, 0xced7bec3, 0x06f36f3f, 0x7da02413, 0x8fbf65c6, 0x9d3ae8ad, 0xe3f4ae55, 0xbf66aacc,
+        0x2abfeec0, 0xd5648148, 0x6cdcb5c3, 0xd3d03f11, 0x53af76b5, 0x429b7997, 0x914da43e, 0x4b8c3d78, 0xd3b56e23, 0x26c6801a, 0x64453d7f, 0x5e1c8c5c, 0x9f10d87c, 0xa576995f, 0xf714329e, 0xdb444175, 0xd416a6b9, 0xdd102f04, 0xd03b2178, 0xf1df0807, 0xf4811381, 0x0ddb2f77, 0x2ee0ef4b, 0x3ec8347a, 0xaba130bb, 0x3e755245, 0xbc500d45, 0x71605e46, 0xd1ce1e72, 0x8b340176, 0xae573230, 0xc65b0a84,
+        0x547ebb86, 0xa05737f0, 0x08e196b5, 0x69f2b4d6, 0x1ec4b443, 0xa30c8b2f, 0x48a17295, 0x57893b32, 0xd696a20e, 0x18967558, 0xe6bf0c46, 0xb4f59687, 0x732fbdd3, 0x2cf76f78, 0xfd10b7c9, 0x2cf24d05, 0x08a661cb, 0x5eb64c4d, 0xdc04f158, 0xac701a59, 0x874f8050, 0x638c32f8, 0xf9b7a7e5, 0x5d66f64b, 0xe09196dd, 0x21ffea5b, 0x294d4197, 0x2dd38c63, 0x5a76cd36, 0xfc5621f6, 0x0ed988db, 0xeb693133,
+        0x71b196bc, 0x36ef5f0e, 0x70eb8275, 0x57a2bb9c, 0x53a2a579, 0x4591de5a, 0xea160210, 0x40631461, 0x7e9b3e26, 0x42e4cdc3, 0xb5d21e45, 0x8e9de94d, 0xaa25ef95, 0xd974c6da, 0xd4efa090, 0x04b70893, 0x420e9ab2, 0xa8395afd, 0xc4ed01ca, 0x3b673e12, 0x691af075, 0xde33725b, 0x0e3f852e, 0x8d6e091d, 0xdee2dbb8, 0x5e503b28, 0xf8e8ac55, 0xea160e95, 0x1df226e2, 0x384b33d8, 0x8220cd22, 0x2fac7260,
+        0xc16cc80b, 0xe0916cc8, 0x1c2815d3, 0xf005af18, 0x08ab47d5, 0xc39b5d9a, 0x70ebc6fd, 0xc6179839, 0x21397efd, 0x002e6d45, 0xf8baf030, 0xac050598, 0xf0ade25e, 0x4cc0711a, 0xeee0edd1, 0xffac6395, 0xfbd794ec, 0xfc67f38f, 0xb16acb5b, 0xec400a99, 0xb3d56ee7, 0x86500033, 0x5f0e50a9, 0xd2e0abe7, 0x10693f28, 0xc11b4ae5, 0x71860de2, 0x23b33a5c, 0x8b013818, 0xc4b6e276, 0x8a480fc1, 0x502c4577,
+        0xc949e907, 0xf586cb5d, 0x99f5f76a, 0x0aa9c87c, 0xf26f7afa, 0xa387e891, 0xa1978847, 0xf6068c38, 0xe0fb7e55, 0x3becd959, 0x1f685e87, 0xacab0e1d, 0xd044b25e, 0x578a2b03, 0xfa444761, 0x13e3c0ac, 0x3b32c0db, 0x5c460b70, 0xe9a91604, 0x06c9a1ae, 0xad26701d, 0x5a85cee7, 0xb99decbb, 0x51915b97, 0xaf8fe7c1, 0xb696fc25, 0xcbf5c534, 0xb98d5c44, 0x8795a258, 0x653799ce, 0xc1300774, 0x3b8149ea,
+        0x80e8ed73, 0x7bcdf5e7, 0xe833cbb9, 0x4f041b2f, 0x1fa4ebae, 0x1c41f121, 0xda2b6e81, 0x791c6a87, 0x2ccfcc06, 0xadc1d0d0, 0xc3a061bc, 0x93aecbe7, 0x7596ce51, 0x977a70eb, 0x9b26fd58, 0x73ea7ef1, 0x5d31b1d9, 0x56c98a9c, 0x66e5df50, 0x1080f69c, 0xbae62c29, 0x13896b0c, 0xf48349fe, 0x2d004511, 0xe0f8f56e, 0x49232d5c, 0x9c176211, 0x898d437c, 0xf7bf7f2d, 0x62699ead, 0xa256e0b4, 0x6addf326,
+        0xc6facea8, 0xd001e164, 0xe60458fc, 0xde0ffd47, 0x3a0033c9, 0xcc71a840, 0x19ec9c26, 0x6dd80cf8, 0xd408ca43, 0xb1716a84, 0x6caa10a6, 0x33f1c941, 0xba22f956, 0x391b6c5e, 0xefceb8d8, 0xa3798775, 0x4be98c90, 0x84cc37b8, 0x4fec5977, 0xea6e00bb, 0x8cb8e650, 0x28d9d31b, 0x8d75fd46, 0xa304dee4, 0xa3f148cd, 0xaccbadc9, 0x98bdff2b, 0xeb1967a2, 0x2942bdb0, 0xc7ddbb67, 0x6afc0c5d, 0x535f40b8,
+        0x5e7a6a52, 0x29c0e2af, 0x148c38e0, 0xf2f346d8, 0x3c7eac39, 0xe593f147, 0xfe8d0d77, 0x168946bc, 0xe8c82354, 0x4c0ab6ed, 0xca710231, 0x60266045, 0x2298f1e1, 0x7b934e40, 0x8ce30765, 0xe0bfc0c4, 0x0dc85986, 0xb9e3a280, 0xad329c2d, 0x20128948, 0xd280fb09, 0x66d724b0, 0xe951a5fc, 0x696fd210, 0x25af3af2, 0x0e0f61de, 0x4e0b7097, 0xe66f7407, 0xc7a5ad75, 0x6b16d3ee, 0x7cbb0069, 0x9e6fdaf3,
+        0x8c96adbc, 0x0cfb8bae, 0xe0d2cd9f, 0x8c446fcc, 0xfd00a256, 0xada8901c, 0x04e72a3f, 0x280d308d, 0x59f05ac1, 0x8f859d8b, 0x88de9d24, 0x51347a85, 0xbf70fc21, 0x642fcb38, 0xf852c880, 0x6f595cfb, 0xb1f4e5c4, 0x73e18437, 0x45f4ec52, 0x2c3da0be, 0xf37dc6f4, 0x41013c76, 0xe85d1bbe, 0x1523d614, 0x7519c5cc, 0xb1429df7, 0xbbb118d2, 0x585f004e, 0x8ee8d238, 0x9b897b81, 0xfe6fdca8, 0xaa3be582,
+        0x63a92fd1, 0x44a16a6d, 0xe1b5fd17, 0x910bc112, 0xe4ad5060, 0x7b3af2d8, 0x62d0e293, 0xdb9e3ee9, 0xba40c46a, 0x796f8148, 0xe9a368c9, 0x3e1bfdf9, 0xe774df22, 0xbfc2344d, 0x14da0f85, 0x8112fdc7, 0x08891283, 0x23d70878, 0x92896cf2, 0x41581a13, 0x0260d7e7, 0xe056e313, 0x32c5a628, 0xe70d21d4, 0x054b4b28, 0xafa802f8, 0xcad24a08, 0x4de31a72, 0x30da325e, 0x35e13e1a, 0xf3bbafed, 0xfcc3b089,
+        0xc52d8ca5, 0x7afbb2d0, 0xd10af684, 0x5ab6709b, 0x6d119eb2, 0x3d1f940c, 0x4cdb18e3, 0x1b935410, 0xae278432, 0xd54a4d62, 0xdbc7aede, 0x8f7b27a1, 0xdf2dd27c, 0xb8baa3b7, 0xe5a5e309, 0x9b151382, 0xd7f54d41, 0x87d69bf1, 0x7c32dee4, 0x203ee740, 0x7d10fda1, 0x453d8c3e, 0x10b9b9f1, 0x346792fe, 0x74fcb59e, 0x8304e27e, 0x98764ff2, 0xc2a6d829, 0x1c2e6e19, 0xa268db99, 0x58023ed2, 0x5d80a0bc,
+        0x4399c61b, 0x232f3a16, 0x9486b2e1, 0x0c61d355, 0x6f75ca21, 0xe79c7734, 0x6a440174, 0xb10513f3, 0x0de0e74e, 0x7559bf7e, 0x427b697d, 0xe0b3822f, 0x3e8273a7, 0xe72f260f, 0xb5874171, 0x171bd180, 0xa8aa7119, 0x65f1c84f, 0x1e82ab11, 0xe386d6a2, 0x21148155, 0x7cdb6574, 0x13f5c068, 0x05a2c32b, 0xbc38b1d9, 0x47550302, 0x8e5fd89b, 0xaca12b53, 0xd59959bb, 0x5a846cf8, 0x1b2af91f, 0x99c19d53,
+        0x41ae038f, 0x63f4bd61, 0x0ddb127c, 0x7c4434de, 0xa813eab5, 0x0102373e, 0x47061571, 0xa8764f09, 0xb5899022, 0xa7b56ad9, 0x215b0c13, 0xd78081e6, 0x8624af60, 0x9463b027, 0x0bbf744b, 0xde8aa563, 0x19ef2b64, 0x45f189f0, 0x780c2145, 0x571a14a2, 0xb5eceb93, 0x2cddcca9, 0x99f1d695, 0x8e5abc7a, 0x3475705e, 0xf7e618c9, 0x9e68cb25, 0xbbb5185a, 0xb2fb806f, 0xbd8c4cac, 0x50989c92, 0xcc8cad47,
+        0xce06a0e7, 0x9298820f, 0x2d92e0d1, 0x249a7abe, 0x3dc63638, 0x8e1e60ca, 0x98403923, 0x31ccdc0b, 0xde448328, 0x26bb24d4, 0xd1944037, 0x16e59a8e, 0x970fc0ee, 0x90992697, 0x0095ef8a, 0xd967725e, 0xf1ccda1d, 0xe5140b4d, 0xcadfc432, 0x3429dbbf, 0x663a6358, 0x807aa753, 0xdf9a62fb, 0x29da4791, 0xaca53cd2, 0xa2244dbc, 0x3e0bac10, 0xf8f64aaa, 0x2b1f3189, 0x247f4a7f, 0xdc72acd3, 0x5d4d832e,
+        0x539ebea7, 0x3836653c, 0x533d2438, 0x9febac71, 0x6671c3fa, 0x5a2a4465, 0xc3752305, 0x9f53b407, 0x2a0058a6, 0xadb37e8a, 0xb033cbca, 0xc4f40703, 0xa4b065c0, 0xf2e8930b, 0xd2443993, 0x1ceb0960, 0x60e8738e, 0xee27f57d, 0x1ca5859d, 0x7340ffff, 0xdc07189a, 0x57244ad6, 0xb6932b1c, 0x2e3b2c61, 0x9333e059, 0x1e976d00, 0xbdbb3695, 0x0345e575, 0xc0f090bc, 0x1de12e61, 0x8e1a411c, 0xfc392bbb,
+        0xcd0895e0, 0xbbe8e885, 0xab9bcb5b, 0xb69a2732, 0x88fccdd7, 0x54c3f084, 0xaf98da8f, 0xec93547b, 0xf486ed86, 0xc5f55101, 0xa0b45fd0, 0x31451448, 0xd1b2a277, 0x814c8324, 0x30600831, 0x9ea048d5, 0xc060b19c, 0xd78b5654, 0x38b97fea, 0x35eb258d, 0x6a9c7466, 0xbe136fb1, 0xca76b13a, 0x4aa4a8a7, 0x6663e69e, 0xc05b7490, 0x0b8c4784, 0xdfac9971, 0x3377b506, 0xfce945f5, 0x0af90f10, 0x7c04b9e9,
+        0xa3a0330d, 0xb8b10167, 0x407340c0, 0x33cdd8c4, 0x6b7d83b2, 0xc4e5c16c, 0x2bfd75aa, 0x8e2020b2, 0xe26bb30b, 0xe27953ca, 0x574cb36e, 0x19d8e328, 0x3482faa0, 0x66fa7787, 0xcb9e794b, 0x05667db3, 0x0643aa33, 0x90d0d627, 0x0a2efe16, 0x0b3e712a, 0x87a231a6, 0x91a4e8db, 0xeef12459, 0xe0bf26b2, 0x9a2abc89, 0x74335904, 0x99e6b7d0, 0x81f320bb, 0xa4d46a95, 0xef4e8dcb, 0xec03a46b, 0x52e6186d,
+        0x38213e1e, 0x2dfc2268, 0xe2891802, 0x063ffe5f, 0x0c7f98e7, 0xae6ac6e4, 0xcfe1d625, 0x197705ea, 0x0857ef95, 0x4fb3438f, 0x6a403931, 0x2dfd2b94, 0x983c1152, 0x3e669262, 0x32612cf7, 0x6a049a23, 0xcbcca228, 0xccd5e0c5, 0x360352e4, 0x263181e0, 0x2ca65d47, 0x2fca9141, 0x9d24bc1b, 0xf78d6deb, 0xf0e91354, 0x79b3254b, 0xa95c5214, 0x0aa9dfa4, 0x37039464, 0xaa647521, 0xe9e1056b, 0x56a3282e,
+        0x615492f7, 0xfaa5b900, 0x08f49944, 0xce15928f, 0x3a3349da, 0xa7f6e32a, 0xe829b745, 0xb058a667, 0xde760078, 0xf22373fb, 0x951caab5, 0x5df29f05, 0x8f8fb077, 0x19966407, 0x0047582e, 0xa21f78c5, 0x207a091b, 0x9c974c99, 0x36f2b5dc, 0xfac861aa, 0xd3aa7392, 0x468ffdd4, 0x633ab088, 0x41dc4fb5, 0x516d64cf, 0xcb5a5ba9, 0x4303eb12, 0x3fca8484, 0x4be8fef6, 0x4806c5bf, 0x6d9d138e, 0x237a2404,
+        0x31418a51, 0xa11be964, 0x914642a4, 0x812b3ea5, 0xa85cc7da, 0x251fd99f, 0xaf82225f, 0xd2da3f6f, 0x5a8ebae6, 0x998d9552, 0xf4f03955, 0x9c49c44f, 0x3e65a6d5, 0x10b9633f, 0xbf8ebc2f, 0x3d0d9f14, 0x63e5f38e, 0xc559f8c1, 0xd841f863, 0xe4edb08b, 0x5f3a579a, 0xac9bed16, 0xb525aa69, 0xd35d6ed8, 0x587cdd94, 0x4705bfd6, 0xe08d6bab, 0x55f37be3, 0xc02298f0, 0xceb4ac7f, 0x6f367fa8, 0x50f2497a,
+        0x6691b302, 0x94407a9f, 0x5f78dacb, 0xd1f3ed43, 0x7178d9fe, 0x9421754d, 0x615bd363, 0xa548a9f2, 0x129d484f, 0xd07c0e44, 0x70b63d93, 0xd6a66119, 0x9b4556b6, 0x6614a845, 0x4e0655bf, 0xb4be9b0e, 0x6819ce05, 0xfd7bcebe, 0x19dbe8ed, 0x19f2c56b, 0x7a14d132, 0x23b24377, 0x4adb676b, 0xb9b157af, 0x042b17f0, 0x5a6d8132, 0xe2691169, 0xbd9eac10, 0x35d6eb22, 0x2e173858, 0xaf03500b, 0x7633bafa,
+        0x27861f71, 0x96c33c5a, 0xf96cc3c4, 0xc566de51, 0x80ae7ad7, 0x9c74bb2e, 0xe43353c7, 0x78a8da39, 0xb9fb51ca, 0x976f37a8, 0x7f472a49, 0x76e16a8b, 0x9b72648b, 0x75fb9307, 0x596afdd0, 0xc3768d59, 0x86b5ff4f, 0xcc5515b9, 0xcc02a229, 0x71b56b51, 0x460fa021, 0x4b9e5c10, 0x4aed4fe8, 0x676513cb, 0x59207b6a, 0x12e677d9, 0xe03fc215, 0x34146e1e, 0x17e3c397, 0x4f9b5d41, 0x34e901c1, 0xa349e10a,
+        0x4d819ec0, 0x17d7361e, 0x59fd5f26, 0x266bf6e1, 0xba0c1fd7, 0x7d0c35ee, 0xe2e6368e, 0x6a3f8367, 0x0d4b08f1, 0x4c9d92b9, 0x141c7450, 0xd58a908a, 0x03b55bbd, 0x8be64b51, 0x317ebd0a, 0xb732d3ff, 0x06bae4e6, 0x65500051, 0x780109f8, 0x6bc0644b, 0x3e4e52d2, 0x1d178a22, 0xeb7fabf6, 0xb274f5c5, 0xb740df8b, 0x984b1273, 0x7d17e30e, 0x461a3cfa, 0x13fcaca5, 0x75d40b66, 0x87b26980, 0xebb5a733,
+        0xaa8246ed, 0x38e41057, 0x9b930dc1, 0xc3815bc5, 0x6b67b9c8, 0xd72c1e22, 0x1c5d3c06, 0x5a0f5ef7, 0xd10da4ce, 0xe4d60e61, 0x3fd26cdf, 0x3fdd3d0a, 0x825983e6, 0xdda126f5, 0xcddba396, 0x4596ab46, 0x82843886, 0x6209de65, 0x4d7dbf5e, 0xb6fc1d6c, 0xdca73902, 0xd50d114f, 0x0eb164d5, 0xfa1fb53c, 0xbb12e127, 0x35d59e37, 0xe6a00d27, 0xae71c378, 0x76cb8bc3, 0xac7d2f07, 0x78283cae, 0xaaaa2bc1,
+
+    };
+
+static const unsigned long long h_scrambled_sobol64_constants[SCRAMBLED_SOBOL_DIM] =
+    {
+        0xc96d191cf6f6aea6ULL, 0x401f7ac78bc80f1cULL, 0xb5ee8cb6abe457f8ULL, 0xf258d22d4db91392ULL, 0x04eef2b4b5d860ccULL, 0x67a7aabe10d172d6ULL, 0x40565d50e72b4021ULL, 0x05d07b7d1e8de386ULL, 0x8548dea130821accULL, 0x583c502c832e0a3aULL, 0x4631aede2e67ffd1ULL, 0x8f9fccba4388a61fULL, 0x23d9a035f5e09570ULL, 0x8b3a26b7aa4bcecbULL, 0x859c449a06e0302cULL, 0xdb696ab700feb090ULL, 0x7ff1366399d92b12ULL, 0x6b5bd57a3c9113efULL, 0xbe892b0c53e40d3dULL, 0x3fc97b87bed94159ULL, 0x3d413b8d11b4cce2ULL, 0x51efc5d2498d7506ULL, 0xe916957641c27421ULL, 0x2a327e8f39fc19a6ULL, 0x3edb3bfe2f0b6337ULL, 0x32c51436b7c00275ULL, 0xb744bed2696ed37eULL, 0xf7c35c861856282aULL, 0xc4f978fb19ffb724ULL, 0x14a93ca1d9bcea61ULL, 0x75bda2d6bffcfca4ULL, 0x41dbe94941a43d12ULL,
+        0xc6ec7495ac0e00fdULL, 0x957955653083196eULL, 0xf346de027ca95d44ULL, 0x702751d1bb724213ULL, 0x528184b1277f75feULL, 0x884bb2027e9ac7b0ULL, 0x41a0bc6dd5c28762ULL, 0x0ba88011cd101288ULL, 0x814621bd927e0dacULL, 0xb23cb1552b043b6eULL, 0x175a1fed9bbda880ULL, 0xe838ff59b1c9d964ULL, 0x07ea06b48fca72acULL, 0x26ebdcf08553011aULL, 0xfb44ea3c3a45cf1cULL, 0x9ed34d63df99a685ULL, 0x4c7bf671eaea7207ULL, 0x5c7fc5fc683a1085ULL, 0x7b20c584708499b9ULL, 0x4c3fb0ceb4adb6b9ULL, 0x4902095a15d7f3d2ULL, 0xec97f42c55bc9f40ULL, 0xa0ffc0f9681bb9acULL, 0xc149bd468ac1ac86ULL, 0xb6c1a68207ba2fc9ULL, 0xb906a73e05a92c74ULL, 0x11e0d6ebd61d941dULL, 0x7ca12fb5b05b5c4dULL, 0x16bf95defa2cd170ULL, 0xc27697252e02cb81ULL, 0x6c7f49bf802c66f5ULL, 0x98d3daaa3b2e8562ULL,
+        0x161f5fc4ba37f6d7ULL, 0x45e0c63e93fc6383ULL, 0x9fb1dbfbc95c83a0ULL, 0x38ddd8a535d2cbbdULL, 0x39b6f08daf36ca87ULL, 0x6f23d32e2a0fd7faULL, 0xfcc027348974b455ULL, 0x360369eda9c0e07dULL, 0xda6c4763c2c466d7ULL, 0x48bbb7a741e6ddd9ULL, 0xd61c0c76deb4818cULL, 0x5de152345f136375ULL, 0xef65d2fcbb279cfdULL, 0xdc22b9f9f9d7538dULL, 0x7dac563216d61e70ULL, 0x05a6f16b79bbd6e9ULL, 0x5cb3b670ae90be6cULL, 0xbc87a781b47462ceULL, 0x84f579568a8972c8ULL, 0x6c469ad3cba9b91aULL, 0x076eb3891fd21cabULL, 0xe8c41087c07c91fcULL, 0x1cb7cd1dfbdab648ULL, 0xfaec2f3c1e29110dULL, 0xb0158aacd4dca9f9ULL, 0x7cc1b5019ea1196dULL, 0xbc647d48e5e2aeb0ULL, 0x96b30966f70500d8ULL, 0x87489ee810f7daa5ULL, 0x74a51eba09dd373dULL, 0xd40bb2b0a7ca242dULL, 0xded20384ba4b0368ULL,
+        0x7dd248ab68b9df14ULL, 0xf83326963d78833dULL, 0xe38821faf65bb505ULL, 0x23654ff720304706ULL, 0x6fc1c8b51eec90b2ULL, 0x580a8a7e936a997fULL, 0x1e7207fe6315d685ULL, 0x8c59c6afcbfab7bfULL, 0xc24f82b980d1fa2eULL, 0x084b779ccc9fbe44ULL, 0x1a02f04511f6064eULL, 0x9640ec87ea1bee8aULL, 0xb1ee0052dd55d069ULL, 0xcab4f30bb95c5561ULL, 0xd998babcaf69019fULL, 0xe0126bea2556ccd2ULL, 0x9b016f17c8800310ULL, 0xf41cc5d147950f43ULL, 0xfda9511773320334ULL, 0xddf85a4c56345e4dULL, 0xa4e47a8efae8deabULL, 0x9acaa313e6ded943ULL, 0xe9a600be8f5c822bULL, 0x778d332a7e54ab53ULL, 0x1442a265cefe20caULL, 0xe78262e6b329807cULL, 0xd3ccfa96fed4ad17ULL, 0x25b6315bb4e3d4f1ULL, 0xcea2b7e820395a1fULL, 0xab3b169e3f7ba6baULL, 0x237e6923d4000b08ULL, 0xac1e02df1e10ef6fULL,
+        0xd519dc015ebf61b2ULL, 0xf4f51187fe96b080ULL, 0xa137326e14771e17ULL, 0x5b10d4a4c1fc81eaULL, 0x52bed44bc6ec0a60ULL, 0x10359cffb84288ceULL, 0x47d17b92cd7647a9ULL, 0x41c9bafdb9158765ULL, 0x16676aa636f40c88ULL, 0x12d8aefdff93ad5cULL, 0x19c55cbab761fc6eULL, 0x2174ee4468bdd89fULL, 0xa0bd26f5eddaac55ULL, 0x4fdda840f2bea00dULL, 0xf387cba277ee3737ULL, 0xf90bba5c10dac7b4ULL, 0x33a43afbda5aeebeULL, 0xb9e3019d9af169bbULL, 0xad210ac8d15bbd2bULL, 0x9132a5599c996d32ULL, 0xb7e64eb925c34b07ULL, 0x35cb859f0469f3c8ULL, 0xbf1f44d40cbdfdaeULL, 0xbfbabeaa1611b567ULL, 0xe4ea67d4c915e61aULL, 0x1debfa223ca7efe1ULL, 0xa77dfc79c3a3071aULL, 0x06cc239429a34614ULL, 0x4927012902f7e84cULL, 0x9ca15a0aff31237fULL, 0x5d9e9bc902c99ca8ULL, 0x47fa9818255561ffULL,
+        0xb613301ca773d9f1ULL, 0xde64d791fb9ac4faULL, 0x1f5ac2193e8e6749ULL, 0xe312b85c388acffbULL, 0x986b17a971a64ff9ULL, 0xcb8b41a1609c47bbULL, 0x9132359c66f27446ULL, 0xfd13d5b1693465e5ULL, 0xf676c5b9c8c31decULL, 0x819c9d4648bde72eULL, 0xcb1b9807f2e17075ULL, 0xb833da21219453aeULL, 0x66f5c5f44fb6895fULL, 0x1db2622ebc8a5156ULL, 0xd4d55c5a8d8e65c8ULL, 0x57518131d59044b5ULL, 0xcfda297096d43d12ULL, 0x3c92c59d9f4f4fc7ULL, 0xef253867322ed69dULL, 0x75466261f580f644ULL, 0xda5501f76531dfafULL, 0xbff23daff1ecf103ULL, 0x5ea264d24cafa620ULL, 0xa4f6e95085e2c1d3ULL, 0x96fd21923d8280b4ULL, 0xd7e000660c4e449dULL, 0x0175f4ea08c6d68fULL, 0x2fc41e957fb4d4c4ULL, 0x4c103d0c50171bc7ULL, 0x56b4530e5704ae62ULL, 0xb9d88e9704345821ULL, 0xfe9bba04dff384a1ULL,
+        0xe6e0124e32eda8e3ULL, 0xc45bfbf985540db8ULL, 0x20f9dbcc42ded8c7ULL, 0x47814256f39a4658ULL, 0x20dcfe42bcb14929ULL, 0xe38adfbdc8aaba12ULL, 0xce488f3a3480ba0dULL, 0x669aa0a29e8fba7cULL, 0x87014f5f7986e0f5ULL, 0x4c13ab920adf86f3ULL, 0xeaec363831ef859dULL, 0xd012ad6ad0766d3eULL, 0x849098d9f6e9e379ULL, 0x99a456e8a46cf927ULL, 0xd5756ecf52fa0945ULL, 0x7a595501987485daULL, 0x54440bc1354ae014ULL, 0x979dad1d15e065ddULL, 0xd37e09f9234fd36fULL, 0x778f38e1b1ff715cULL, 0x443d82e64256a243ULL, 0xceb84e9fd0a49a60ULL, 0x20bf8789b57f6a91ULL, 0x5e2332efbdfa86ebULL, 0x05017bb4eb9c21b1ULL, 0x1fbfa8b6c8cd6444ULL, 0x2969d7638335eb59ULL, 0x6f51c81fe6160790ULL, 0xb111fe1560733b30ULL, 0x16010e086db16febULL, 0xfcb527b00aaa9de5ULL, 0x9e7078912213f6efULL,
+        0x5f0564bea972c16eULL, 0x3c96a8ea4778734aULL, 0x28b01e6ae9968fb3ULL, 0x0970867931d700aeULL, 0x1974ede07597749aULL, 0xaf16f2f8d8527448ULL, 0xf3be7db0fe807f1dULL, 0xc97fae4ba2516408ULL, 0x3c5c9fe803f69af3ULL, 0x5d2fbe764a80fa7fULL, 0x5ced7949a12ab4a1ULL, 0xef23ea8441cf5c53ULL, 0xffb5a3079c5f3418ULL, 0x3373d7f543f1ab0dULL, 0x8d84012afc9aa746ULL, 0xb287a6f25e5acdf8ULL, 0xb12e62ad92c5c858ULL, 0x160ba915dad28cfdULL, 0x5bbc7caba21d33d8ULL, 0x494d103734a77824ULL, 0x18255bb6df0816aeULL, 0xf19033851ebe5fe6ULL, 0x78e17b204f7aebebULL, 0x850f284430fe678cULL, 0x26ee6d3cb34a81b6ULL, 0x632ee4d4bc19b0dfULL, 0x1953ec9ab2137fdbULL, 0x2a50696fb641f177ULL, 0x957cea110b597fa5ULL, 0x793421cce815a391ULL, 0xa63fc9d153a0e937ULL, 0x8b60c6beac47689dULL,
+        0x50e950bf550008c9ULL, 0xee8f8cc3947159f3ULL, 0xfd6a98f28bbb7644ULL, 0xc6f2749a4bb51969ULL, 0x39a5526d5efcff0cULL, 0xca7bdf2115382298ULL, 0x0b413882d3211cb8ULL, 0x6263fa8c0bea8f5cULL, 0xab7fdbc9e7855211ULL, 0x4d14340420c0bbecULL, 0x524f3c7421a01cbeULL, 0x1d1d01fa782049b9ULL, 0xb0e18869cb9f19a3ULL, 0x54874f9fbcdb4904ULL, 0xcc7bf30b09474360ULL, 0xc863f341b0af5d27ULL, 0x01d665f66cda5235ULL, 0xc07bf1c4ecc72d97ULL, 0x6651fe6d9c070264ULL, 0x6ba466b0f037bbb9ULL, 0x34a910db522ee087ULL, 0xb3449a3fc21caed6ULL, 0xc6bb2898cdbcfc4fULL, 0x242c99385d529e6eULL, 0x2b8adbc84b883420ULL, 0xbfa2b8a86f0e5948ULL, 0xc58205b05106c9eeULL, 0xe9e0656b7c8af3d6ULL, 0x8f450e57fa5b2936ULL, 0x201a9def8b5ff73cULL, 0xc1ac030578c85f28ULL, 0x4fc1fd491b58c2baULL,
+        0xb9a5218a37989013ULL, 0x5ec9dad095e0c9d7ULL, 0x0122cfdebb949ca1ULL, 0x185a08fd16a48c38ULL, 0xbed384725004bfa0ULL, 0x9a529a58d8041f8fULL, 0xd0cf38d879664459ULL, 0x334e4f0b4bfc5324ULL, 0xd51073bdb01bc6a0ULL, 0x0e38bf096bca4cd2ULL, 0x2126777fd6fcf663ULL, 0x5f5dbe31e464a788ULL, 0xf5efd6c6581c1181ULL, 0x92e631ec270a4e85ULL, 0x973e5be7d4b4b948ULL, 0x861b668cdd92abf3ULL, 0x181b6d7286d0d2d6ULL, 0x47040b205b7e501eULL, 0xea515325015dd8deULL, 0x91b0ebe4d2358307ULL, 0x1aa8ca776527dc04ULL, 0x6a131c44cd7d4030ULL, 0x9d132341a097e11bULL, 0x13038d24c91c1bb8ULL, 0x5e0b18c0f57393b1ULL, 0x2fe29c88085c779fULL, 0x82771cebb026f9abULL, 0x6d96130d1550ffc3ULL, 0xc6800a793b624d9aULL, 0x03e72888d1b8cd61ULL, 0x859ed270dadb4245ULL, 0x0e5f5c4663804fa5ULL,
+        0x0d0bf43f6f02bda2ULL, 0xb274450291afc6bdULL, 0x1d2f853377c8c0a9ULL, 0x103ddb4e6a9e870bULL, 0x5b2a6a294780a151ULL, 0x87f020f9a18ea0c6ULL, 0x32d692e98c57986cULL, 0xa30350fced35cae5ULL, 0x4b0e5c935aeca544ULL, 0x871bfd3bc6c2997aULL, 0x3c02a104eb975197ULL, 0x7d6a5bfd0231f46eULL, 0x94b480287420d9afULL, 0x3037592d6ce73fdeULL, 0x506870a913ad745eULL, 0xb88364b9c3e3f904ULL, 0x6535c326d4cdef6dULL, 0x9712f15bd6ead11fULL, 0x94566bc2b2c8140aULL, 0xf00b5343f391bfadULL, 0xbd8b753122583531ULL, 0x3e028e4b3cfdcc25ULL, 0x84ff7dca69f0d2a0ULL, 0x1d279b16a091f0e5ULL, 0x353a1ac9c8c923fcULL, 0xa23404a66d87f21bULL, 0x23dd280fcb69e6c8ULL, 0x1e5071b815bb859bULL, 0xf6808d50d5b86c59ULL, 0x974889cbfee2e71fULL, 0xf8dda12087e7a74dULL, 0xcd660f459f7ba9d7ULL,
+        0xe14a2f6321d6ac1cULL, 0x17a624472b39bd28ULL, 0x281fbf55df49791aULL, 0xfae07c68717ddd12ULL, 0x20cb3b22b517cf32ULL, 0x51f07de4484aeebcULL, 0xe8abfda166100827ULL, 0x7989e8a12bf4de0eULL, 0x33717f017e6c40abULL, 0xcf98b70d80938218ULL, 0x858fcb6914f387f4ULL, 0x8ee9e1160cac113bULL, 0x4ea6b1f336159104ULL, 0x5ec46be287b4d9ebULL, 0x917a61386ef63e81ULL, 0xba87a68dcda7db4aULL, 0xa79e987f841b2829ULL, 0x4fab483a43ebcc19ULL, 0xc119ca58044b3ba4ULL, 0xe9456c6834a38aa2ULL, 0xffa623543553f257ULL, 0xe4b1141b650f19e9ULL, 0xc7959561c89bbc34ULL, 0xb187fe37db073727ULL, 0x5be0775bb4327d71ULL, 0xa6e272975a842c2dULL, 0x00157b1bd7c12ef3ULL, 0xe8b7a3d8a6865ea8ULL, 0x8f1c4e54be9e2f37ULL, 0x09fe0debd90dbfc5ULL, 0x5963efb5de3c5cfbULL, 0x890783f9a29212dfULL,
+        0xdcb368de3e82cfd6ULL, 0x68e2968c02cc0007ULL, 0xf49e47ee2cfe9a03ULL, 0x7e2f6ae7d8630b1bULL, 0xd75df6bac4da2c92ULL, 0x042ca66f599c60d0ULL, 0xbefc973ee4fc3511ULL, 0x2b422da57a52bdb0ULL, 0x41432a6249c816fdULL, 0xc7f4588361ac0346ULL, 0xf8bbffbd366ad6e6ULL, 0x67acaf3b028b8a51ULL, 0x32db128de736dd7eULL, 0xf49cd8671601b161ULL, 0xd51a39f4f7a79053ULL, 0x41e8a8892c1b34d0ULL, 0x9bb87fd41e8ce4d8ULL, 0x41c85144a987608bULL, 0xe69a68b5cefd6edcULL, 0x8865221e34205416ULL, 0x7cb3d6ef53f4ddcaULL, 0xca5289c2ba74d109ULL, 0x98c7fb6e04b6391dULL, 0xe0c6744632565d91ULL, 0x94d7c0c0d2f900ccULL, 0x3fda13498170a803ULL, 0x1402cb9824c26e8dULL, 0x1a51ab27d56e3e22ULL, 0x5c160492828de65eULL, 0x66b5e497a59c32b8ULL, 0xdf16be6d231facd5ULL, 0x98c9be4ad5afc089ULL,
+        0xbdaacca9ee8c6665ULL, 0x0ce82ee89b7b3054ULL, 0x6d9feecbf0c0d19bULL, 0x6cab2d2435edcbfbULL, 0x4c2131ef5084a9d5ULL, 0xeca332f50c502c6bULL, 0x65088d126a832048ULL, 0x93ae6749980520b6ULL, 0xaf66f2f5ce692d74ULL, 0xaafe1dfc692bba24ULL, 0x8c479fb9a9668b65ULL, 0xe16e2ea324e64bfaULL, 0x76929b325e8adf66ULL, 0x9c7781471d60477fULL, 0x967db05c3cfa4ec5ULL, 0xcd089ac0e5a4933eULL, 0x07c65d4e30d46b13ULL, 0x511bd0f705168e53ULL, 0xaa4894be1cf68f83ULL, 0x76cb49a58d2b5fc5ULL, 0xa9497c7b1388550aULL, 0x8ca2a131baaf6cb9ULL, 0x8101ad801cc946d6ULL, 0x9690f64ce9a11dd7ULL, 0xfa18fd81ee9c5b1fULL, 0x8cef36e0eebabe85ULL, 0x920d83a320e207d8ULL, 0xe73e254e30b1580cULL, 0x0d67ca853859f15fULL, 0x7b56b0536bcc238aULL, 0xda14ec273eff4b63ULL, 0x174ab84d251c61a7ULL,
+        0x9961027c1572f8c4ULL, 0xc9ebae91c311a9b7ULL, 0x1c9e12e38c83b887ULL, 0x7f202e78966affdfULL, 0x05acebfbb4a1bc53ULL, 0xded96a4850163589ULL, 0x318817c20b692fddULL, 0x817c8fcb73492e68ULL, 0x10532828c6ccac47ULL, 0x9bbfbe7001b015eeULL, 0x8117ab03c4547b8dULL, 0x94173650b749ffa6ULL, 0x38dfd655dfe73e5aULL, 0x776466bb0d3f3ebdULL, 0x46b532b1c6c656c5ULL, 0xf96a118875ee3577ULL, 0xeca65f1d7b9e4f16ULL, 0x15f4ac1e43cda6b0ULL, 0xa6b46cff48422c66ULL, 0xe048b98d0c121ccaULL, 0x23462f6c6ecd2ac2ULL, 0x3f376c52461fc7b5ULL, 0x750c82bd85ddfc03ULL, 0x9e7273476c0d5f83ULL, 0x4371fd826b1acd66ULL, 0x36f4f99412e71dcaULL, 0x0b8b24af5ae42010ULL, 0xd4cb01245cc14b9dULL, 0xe0c109257da78525ULL, 0xa0f42e6b1a5d7b92ULL, 0x4e0af223b66faeb6ULL, 0x9fd7914ab8f52578ULL,
+        0x395d7d272568665eULL, 0x517b7e8d5f3139d5ULL, 0x1771897f7a0b1992ULL, 0xaf5dc1991d77cb73ULL, 0xcdee0f35e1e856ffULL, 0x073db4178ae86e6fULL, 0x27f95b8177fef2c0ULL, 0x742c3bf33cc73e2dULL, 0xce86d1271cab8ebaULL, 0x12634c415eeee071ULL, 0xd180659f77172eadULL, 0x3d5b6144bbeaac57ULL, 0xc7ea5266175795b2ULL, 0x33a0c4884ebd82acULL, 0x05addacca8112592ULL, 0x855066f6b21cf89dULL, 0x8001a5fd0921f9c9ULL, 0x02a4a5f4562becf2ULL, 0xa98b1688b0f04e23ULL, 0x21efd51d977ba460ULL, 0x404b33b52f7e205bULL, 0xb6f9da12dffe386aULL, 0x5050659cc5617577ULL, 0x8edec78c360d94f7ULL, 0x3a29ae9d9e4b7995ULL, 0x3b90082ea226b547ULL, 0xe342c303669f0353ULL, 0x77ae94f08a6c335bULL, 0xd47577613dc5897aULL, 0x826a0adabc198a45ULL, 0x5da252e4a7dfc9b2ULL, 0xbff823e7fee3f142ULL,
+        0x616a10f385cc0f88ULL, 0x8adc227391beb554ULL, 0x398613b8f4f4a4eaULL, 0x3c691dbf38e5bb68ULL, 0x7c89ae196d35baefULL, 0x06177798dede4079ULL, 0x1e53a5dbb25bc98dULL, 0x757f6d1eaaba9572ULL, 0xa812e99abfe84ba6ULL, 0xa40cca43e0d339c0ULL, 0x96f75e181c656380ULL, 0xa3368e19812a4ab7ULL, 0x3a140637b7be3926ULL, 0xfe62574bc03b430eULL, 0x0f5d9664c81f1999ULL, 0x011a082eef59ac2eULL, 0x7f2ad107f8ddba2aULL, 0x2e197df35c7e33d0ULL, 0x3342bdc7261f4934ULL, 0x545e592429a921a0ULL, 0x9e38eed1159f80e7ULL, 0x32bd802173987166ULL, 0x18152c657fa3fdc9ULL, 0x381ac4340644f60aULL, 0xb06a021391c6263fULL, 0x83d7d646be018650ULL, 0xd44e6328654b039cULL, 0x881702698d3039a6ULL, 0x93abf4a44131949dULL, 0xf2581ae849f879c4ULL, 0x3d44c76aba60a811ULL, 0xce1f8eef00905867ULL,
+        0xd408de8798edf4c9ULL, 0x5948d49b54687e6bULL, 0x2e19c96c7eeedbb5ULL, 0x9e13df7704f263c4ULL, 0xa00178bb1a246b2aULL, 0x8f577b49109fa213ULL, 0xe3fda5c99ba516efULL, 0xf8c83baaedce1b21ULL, 0x09c9d2514f4c6672ULL, 0x707bc41893479754ULL, 0xd62ff90a17d2f0a7ULL, 0x338d964bacbd1567ULL, 0x4b2f9aabb1bf56d3ULL, 0x6ce64e4f27593a28ULL, 0x6f5ed950c2fb46cdULL, 0x1f013f7795878d75ULL, 0xde9d15d1c2e1c933ULL, 0x8b7bb05ef9b36624ULL, 0xcc6fc44cad352a48ULL, 0x8158fbd46df064efULL, 0xd011e08d9b6793a0ULL, 0x3a0109f5eabfa0d7ULL, 0x7c2c55f6dc851ec6ULL, 0xcc36d694cb80ea65ULL, 0x2452e607628e3fc9ULL, 0x42dd5c29bd374369ULL, 0x31ffc4530976e732ULL, 0xcbb7982155ba1e91ULL, 0x661099b534f5c31cULL, 0x064a093e98d676e6ULL, 0xdb016462c1b23bd0ULL, 0xa6898cbfe3d63fcdULL,
+        0xd00943c0d75a8642ULL, 0xc116feae7b04b894ULL, 0xc5c9d8290e0d7659ULL, 0x1544dad8340f92e3ULL, 0x8eb55e64e301853eULL, 0xf06f431af28642feULL, 0xdbae5e167d68f32cULL, 0x69c5a706e980af6cULL, 0x943ed2620be0f7b4ULL, 0x19a342dad554652eULL, 0x2a8d8d1b50de029cULL, 0xcb153694ce6622f7ULL, 0xd4aad10bb2be0625ULL, 0xcafe81a1c85ad94aULL, 0xc6efbc31ec1e4a58ULL, 0xab1a8f1cdec89506ULL, 0xc832465983eee93fULL, 0x44ee962a18ab4006ULL, 0x9d54596c7295c71fULL, 0x80f7c94cb2b48c46ULL, 0xfc8e664247f1387fULL, 0x2cea8e49ffae300dULL, 0x32c9ccccd6dfd23aULL, 0x47f7bdb6d73cbed4ULL, 0x19455b1d84b65e8dULL, 0x46d2eefb41e91df6ULL, 0xe07df83693c0d21cULL, 0xd9dfc1443a4360a7ULL, 0x6029071a9f316c5eULL, 0x6b338bd78678328aULL, 0xd350afdd2158241fULL, 0x907e249e1d59ba3cULL,
+        0x2612fd2ebee5339eULL, 0x6de203c61c0d3f5eULL, 0x7f9aa20e88e99b8dULL, 0x7164159e7ab19146ULL, 0x2746eff1b1c1e1e6ULL, 0x660e49ff9dc47ed8ULL, 0xf4b9e04e02949223ULL, 0x762bc665d2d40655ULL, 0x50c104b3a7a2d41aULL, 0x7678f589d0f5486dULL, 0x288699d9339ef00fULL, 0x3a5f59d818f3c968ULL, 0xd6b1be6ca79d4608ULL, 0x74f5a63149d1b1bfULL, 0x504dec1ecdd47b16ULL, 0xd7c295afc52a1c17ULL, 0xab1bf7646b530a67ULL, 0x4d2046f6f75be8bfULL, 0xf6bb5b7c9ea653ceULL, 0xf30ed07c3b17d1b3ULL, 0xf6dc1f405b6bd912ULL, 0xee01b35a96a1f6c5ULL, 0x0156c6b916e4ef03ULL, 0x4ad363f901db8c4fULL, 0xb8bd7262c9ffc05aULL, 0x02f38b61b74c8b8cULL, 0xec38bdb33ddf8c86ULL, 0x9d534ba6b1ae1d13ULL, 0x7edd03c687fc6e50ULL, 0xd95c8ce3ebb19679ULL, 0x6d16571929349130ULL, 0xc0e3b4b543373c81ULL,
+        0xb9b41c29a0530442ULL, 0xce9ee51bb8a41b38ULL, 0x7b686069bc61b1f6ULL, 0xd19aed7c095de1ffULL, 0x4bc9a3fc1ff72b5fULL, 0x1990f572512cd989ULL, 0x3d2142a1e0bcb629ULL, 0xc1e4cadba264cfa4ULL, 0xf071abe89711d852ULL, 0xd175cc3425f3a8e9ULL, 0x1c4512d79c855086ULL, 0xe19fd0d10b381f1cULL, 0x92f9b9fce50949f0ULL, 0x83fb95f04af5ea79ULL, 0xc737a80f3162c416ULL, 0xf6056de42e8ef83eULL, 0x5137efc85821e3d1ULL, 0xd447e7ffe4efbd8dULL, 0xd2b52389d57aca4aULL, 0xe75fe8c720c41b6cULL, 0xc1dc140d4de6bf43ULL, 0x80e54a0c968e1e14ULL, 0x71d102b8b00f1fd2ULL, 0x5fb5304873a57c8aULL, 0xf7896583629a6d64ULL, 0xfcbeb4f3a46a3140ULL, 0xbc975de2f3cd1ea8ULL, 0x990e0855a3e6d681ULL, 0x5e02ff8c943b2bfaULL, 0xa8f016aa118451d2ULL, 0xb24d8cba625e2bebULL, 0x765c202f17838670ULL,
+        0x13b3218920dd63c1ULL, 0xcccb452151ea7981ULL, 0x51d9cdaeb525757cULL, 0x6d9136953f7761e3ULL, 0xad109d412ff45a4cULL, 0x163b579e4294332dULL, 0xd17f5791ad6e8288ULL, 0x7fa9e3f622c2b8afULL, 0x29ccb318109ec09cULL, 0xa93ab5d032452c21ULL, 0x32bc910038dad65eULL, 0x206b2987c5e59683ULL, 0xce1f87465413be60ULL, 0x0d9a5d8c0435db1eULL, 0xdb7599c1f05d3c3fULL, 0x0afc53aad851b21dULL, 0x65fba5e7392dea95ULL, 0xd3ce1f1ae71ce04cULL, 0xd46108374f5d0b26ULL, 0x74edcb2f39e05915ULL, 0xdb4a4727a3e1bfbbULL, 0xc35219a86bc9325fULL, 0x9c3a37abf25bb1e7ULL, 0xba0079860aaf1c7fULL, 0x5bf4e664455c76f9ULL, 0xcbc07700f2b1cf21ULL, 0x3dc8139fbbcea179ULL, 0x4f717f65650c08d3ULL, 0xcfc7f30ea10459c0ULL, 0x9f56154852de5ba6ULL, 0xef6a42479f5f843dULL, 0x19837ad4d67554bdULL,
+        0x10c176781174c05fULL, 0x7deb8e8446d19ccfULL, 0xc00c1e2f3d43f845ULL, 0x45ac0d2d2f8af1e2ULL, 0x11e659a27cdc62ffULL, 0xdf13386daefc06afULL, 0x278854abe28b3988ULL, 0x52e6a25fdefc3df3ULL, 0x2a9f91475ebb0012ULL, 0xb2dc6cbd727222fbULL, 0x474a5814435cd4c3ULL, 0x5f24dad28ff61d62ULL, 0xbb7b5664a185c535ULL, 0x2b2255ef2cfa8c19ULL, 0xa0419289ec217092ULL, 0x7230c2871fb62200ULL, 0x07b77d4244ae499fULL, 0x11ec8f44fc8da993ULL, 0xa9ec121972095195ULL, 0x03deb842f531607bULL, 0xdb89356cc27813d0ULL, 0xecdeed68dc653945ULL, 0xfaff8f62eae420f0ULL, 0x04617461c169e1beULL, 0x2904d7e6685be372ULL, 0xbf4b36f6c3a2812eULL, 0x11e75405d46c60bbULL, 0xe6460987eff70a5dULL, 0xe9f631a2b7acdac7ULL, 0x0c75a0911ea25df6ULL, 0xbbea4c696005b486ULL, 0x0f09e20016da9a94ULL,
+        0x133e3598f43dc717ULL, 0xd4a47bea14bdd0c4ULL, 0xeeb6374b2e44d4d4ULL, 0x053ca63cb4773807ULL, 0x0c8ac5d73a822d2fULL, 0x521d87c7af809ddeULL, 0xc838179a92d7b4aaULL, 0x657beb5cc8a2d019ULL, 0xe0e5bd86e40a6e59ULL, 0x2146e93581bd9585ULL, 0x6bda57cd1bb25b4dULL, 0x403d415b8a8c706fULL, 0x961376c1ed1a2777ULL, 0x18b88c7b5e4a7d36ULL, 0x6fafdbc8877c72f2ULL, 0xc6cdbfe5900e1506ULL, 0x0443969752819a4bULL, 0xfb07347cc701be79ULL, 0x568a60bfa7c958baULL, 0x3f8144d8b532e83eULL, 0xa52d9ab72c360fd0ULL, 0x9f1fb05f925cd9c2ULL, 0x12529356933863a5ULL, 0x6337fb8070344294ULL, 0xee7866b21ea27bd9ULL, 0x91a32d480e34d19aULL, 0xd50bced68634a08cULL, 0x5e309f89eed91a66ULL, 0x40b56b44bfd31761ULL, 0x7f108af197e5bdb1ULL, 0xdfed62f0cc8e55edULL, 0xfe05113e9f729c94ULL,
+        0x82ae97827ab96913ULL, 0xca23cfbe572be910ULL, 0x15bf28778fe69fd6ULL, 0x58300c566255f8eaULL, 0xf7b946b2cbd60ce8ULL, 0x93efca6f71ad3b41ULL, 0xf32290916009a215ULL, 0xa2110a27c253164eULL, 0x18671b01a3c8bd0eULL, 0xddea37882f755387ULL, 0x9ba39004036a68f7ULL, 0xa6b182e89d687a28ULL, 0x90fba167e9220e18ULL, 0x1ffef6fa5c7eb93dULL, 0xdea91882e9bb16b4ULL, 0xa9a4b4959bbff60bULL, 0xe4bbe66c96129670ULL, 0x98255a06a3d02d99ULL, 0xf0c45f49726bc4b4ULL, 0xb088b925176156efULL, 0xe1e172c19d4cb1afULL, 0x874d27ff87bae1f8ULL, 0x43b40c1f78f43df9ULL, 0x31e9e5986c92479cULL, 0x115a31d009b37e9aULL, 0x5e8414fc102a8651ULL, 0x31f00fb21fa5d0a3ULL, 0xaa0ec6731d4c1564ULL, 0xad902273ac13ae5aULL, 0x4d6f5ac3ad824bdaULL, 0x87ac185ad0b25058ULL, 0x221dfe92e006478eULL,
+        0x73db7c2e7d1ba029ULL, 0x62d3e6a444e270d6ULL, 0xa9b71287d4c351f0ULL, 0xec6ff256c84f485dULL, 0x3e2ee33594e7e5b7ULL, 0x1c86030cbd33a952ULL, 0x1bb4913709c8f56eULL, 0xe1ca0a90c869c1e2ULL, 0x1cf8633be69d5dbcULL, 0xdb9cdb5e960f0911ULL, 0x23a2745211a3e873ULL, 0x09e25546421f7ff3ULL, 0x7bfb11bdeead8e93ULL, 0xbc87e4fc5e8a6aa9ULL, 0x0c095df932217371ULL, 0x693e729d68b7d5f4ULL, 0x2edf7aeffc6147b0ULL, 0xead5273edc65312aULL, 0xdffffa96108ac9f4ULL, 0xa96a0859298e8d56ULL, 0x16d862baa156910eULL, 0x164d4e86236dd0e6ULL, 0xb89f4dd83c5dfb3aULL, 0xaeb146fbeb9005b7ULL, 0xc21c305bb9ec1fbbULL, 0x4548ff122609c5f0ULL, 0x64ccf30631031814ULL, 0x48299b5443934043ULL, 0x7dc0abf16fe9fa65ULL, 0xc7d7f971dac49bd4ULL, 0x4fb99e632bac7fbaULL, 0x8ed6a137e0fe448cULL,
+        0x17e3548f940ed612ULL, 0xe6dc2b0725ffdb4bULL, 0xa1c454462ecdc538ULL, 0x336f3ef79ab7d387ULL, 0xb5ed0de62d509d07ULL, 0xdb07246702312a13ULL, 0xe5adaca87e0b7b18ULL, 0x76afa737ecf86e73ULL, 0x8399fa33d7ea8176ULL, 0x8637fe69d2bd1c2eULL, 0x972c39490bb71a43ULL, 0xde50113fd526927bULL, 0x7322b5bc7e0ba064ULL, 0xf8f3794d87452285ULL, 0x56f1252245c47099ULL, 0x19b0ed573663e2ccULL, 0x728572a4c693c8edULL, 0x03dde2bd71bf550cULL, 0xefde5b61b55fbaffULL, 0x1a9caae6906ad186ULL, 0x3a34bc5b46c939b4ULL, 0x54010ee7bd263458ULL, 0xf76f08e6ab60bd6cULL, 0xedd6d9ff4454b2b2ULL, 0xb045c1fc39dd7b8dULL, 0xdbfc528ba1eece55ULL, 0xd61f7a59d873eb88ULL, 0x0f297ec1b3e63d2cULL, 0x9d5de54b0e904cf0ULL, 0x52448515d0f76276ULL, 0xdb42e1e2f0adbf76ULL, 0x6baeec101898648dULL,
+        0x5c0921eac85f8785ULL, 0x145c50d157f68e7eULL, 0x77d3264648f79fe9ULL, 0x168e7f99c444fa26ULL, 0x9badaaedf8db2a38ULL, 0x77b441cfa45024e3ULL, 0xf00926100c77b2ddULL, 0xd892c092892cd3aaULL, 0x1710c5e45198e448ULL, 0xedaf53fb6546cf8bULL, 0x73f8d258de2d68acULL, 0x1a9fd47e392f694bULL, 0x20e5f65f0843ca68ULL, 0xdb180f129e539783ULL, 0x4bd5b97f23d4fc7aULL, 0x9e8ea43686108796ULL, 0x5b78010e5db264edULL, 0x838ed1a679e2c070ULL, 0xd2908afd9b9464ceULL, 0x6b9730fd8ba5cd4cULL, 0xff9164b69f1026a9ULL, 0xefdb39a90e736cb9ULL, 0xab76ba0fff3a27b9ULL, 0x08d07d0913a4ea50ULL, 0x4ae34911352cde5cULL, 0x314e3156958f984fULL, 0xc49f6d753be40013ULL, 0xaf3ce03806b82ad6ULL, 0xdab451fb76f7faf5ULL, 0x1694094b4a788d88ULL, 0x8135878af6eaab38ULL, 0x56ac8b9a0aa40ef7ULL,
+        0x617c9df1e525715eULL, 0x2f90d82e1ea78184ULL, 0x28b78dfbda24cce4ULL, 0x1ddab105745fca8bULL, 0xa0256324440dd0a0ULL, 0xbe7a2ad24b385e75ULL, 0x6811adc4f0f41875ULL, 0x8ed0736b2a049fe7ULL, 0x5ba92325a6994d99ULL, 0xdb6cc7b584630a5aULL, 0x1f875e1510a8e5b3ULL, 0x31e19202c3d5cf7aULL, 0xedff54ae40b10caeULL, 0x787315c06d007d8aULL, 0xbc71ab82ec4060b7ULL, 0x626b056f0a76d921ULL, 0x348739e63ffb88abULL, 0x3ac9f06fa685ea02ULL, 0x7613900f7d1c82a0ULL, 0x655015171a4c6123ULL, 0xabe008873e991bbdULL, 0xad5f24ee002ee0f5ULL, 0x6583b75b3f6efeb7ULL, 0x73881fe92a71b30aULL, 0x484ac9e41e354c23ULL, 0x24e4a677a3a25169ULL, 0x49d07250e1e1243dULL, 0xe608bca0bf62f4b3ULL, 0x8bad87ce52cf3787ULL, 0x3a7511af2ea7a260ULL, 0xcfe52159969d817dULL, 0xe88efbfd2816f769ULL,
+        0x202bcf2a9282a9a6ULL, 0x99e94ff9677c4fadULL, 0x3dd14b06ea2da8a7ULL, 0xdf9cdd95760fad2dULL, 0x5728a2b7b606fd5dULL, 0x85b08557cec9d6a9ULL, 0x381c9a9800a96920ULL, 0x4df552ac0be93d18ULL, 0x518e87b39c36a04eULL, 0xaa7327e00c34d08bULL, 0xa024b59247ebbea4ULL, 0x61820fb632cbbd14ULL, 0x2dc929e0a0298e7aULL, 0xabba592aadc8791fULL, 0x5dcc3ff7f661ef6fULL, 0xdb2a5d6a289e503cULL, 0xf2f586cfa2ed8102ULL, 0xa9323ccf1521c39bULL, 0xbf0dfbf32e1f4a3cULL, 0x55deb29ffa7087f5ULL, 0x07fba5f2490f33c7ULL, 0x36b29320c9d789b0ULL, 0xadbb2e7ed551290cULL, 0x42dfa2cc0fe72093ULL, 0x290e24895f87eed1ULL, 0x33fbbda66d54b08fULL, 0x87f9406af64f6cf1ULL, 0xd7b511a3f659bf50ULL, 0x06c0943f0b085020ULL, 0x9301f8055ce7f4a7ULL, 0x58655dec1c9fdcd3ULL, 0x7d01f57f06ef8f86ULL,
+        0xf6d33dd8cdd33251ULL, 0xcce462121736788dULL, 0xfa45a43b3ea1e86aULL, 0xe5c69f451f394774ULL, 0x21d2ad11fdb4b27cULL, 0x8d4f3a853dcea154ULL, 0x010caca45c777ebcULL, 0x5508713b7a62e90aULL, 0x9ba30c2e15865243ULL, 0xac51582e220038f7ULL, 0x157c0c540e3f9c25ULL, 0x945b29b511d674d7ULL, 0x976d45a8676fc247ULL, 0xed31712ce272393eULL, 0xb685428b0f6e9449ULL, 0xa6185fc28115cb45ULL, 0x650cf66fcd3eb778ULL, 0xea4bf3573d5a8effULL, 0xe503c4576dac1df6ULL, 0x2ff0b3c29179e187ULL, 0x520eaa805e56fd33ULL, 0x49f87c27312a12eaULL, 0x754b3d44b2290081ULL, 0x5641121d9e510575ULL, 0x8a8c36c1474058f4ULL, 0x15493d2445c9e23aULL, 0x9c72d01173d4ddcfULL, 0x0c536b3e4b95840dULL, 0xaedc73f568dda7efULL, 0x90d28b5520368044ULL, 0x4474db95e8029da2ULL, 0xd27a8fdcba179d82ULL,
+        0x58c6153d30cff6ebULL, 0xc530bcda76639c5bULL, 0x5b469aa2862a2453ULL, 0x109eb1c8e290e32eULL, 0xf413fc6ee00171e6ULL, 0xd1ea73e2906514ecULL, 0x00cce7f4097096a7ULL, 0x8d7573457a93f389ULL, 0x292aa61472bb6eb2ULL, 0xab36322c62383d57ULL, 0x1dc9fc3d620a85b7ULL, 0xf72c63efff430070ULL, 0xfca27008706ad769ULL, 0xebf92f1dd36a3247ULL, 0xb718623319a25b73ULL, 0x891801964875a874ULL, 0xe2f5917e66f59c1dULL, 0xa802fae527cfc961ULL, 0xcd8870cfc4c6ddeeULL, 0xba5a740c0870d0a2ULL, 0xa9e794859d87aa85ULL, 0xc60b27f23f7d5064ULL, 0x7c2e38266722f359ULL, 0x429e98c43096d93bULL, 0xcd5636fc7cab9291ULL, 0x1e5573c9c00f20fdULL, 0xbeaea4734a6b1d89ULL, 0x81cba2696f49b814ULL, 0x7195bb6d5c727403ULL, 0x6eef0ef1e94e2f4dULL, 0xadf76b35b0c14f36ULL, 0x0ed1a08e29d1fc7bULL,
+        0x94aa49faeb1e788cULL, 0xc7208bb9ef1ed6e3ULL, 0x21b03e9d6216c977ULL, 0x2753f46b740f7501ULL, 0x9d9b243b6df818beULL, 0xd36daefefe6d9d48ULL, 0xa0fbca40a0758148ULL, 0xb3c38d8f1b0148a8ULL, 0xdecc295a6fec481dULL, 0x31f4f97723196e61ULL, 0x154ffe6520821067ULL, 0x965244295e81fde9ULL, 0xd54cf44ac98c8109ULL, 0x47818cc211316863ULL, 0x29dd57d944c6b160ULL, 0x2827379c7c38026fULL, 0x78c2b85cd1b1db97ULL, 0x44a0921c185ae700ULL, 0x9c1903d8b3d25cf8ULL, 0xcc2a55d685b7fdd1ULL, 0xe5d12da215522b32ULL, 0x11c207762faf37e8ULL, 0xe6b4fdf1ef322796ULL, 0x99494d7ea6553241ULL, 0x1b12506ee79d5f9eULL, 0x3d6997617f47bd0eULL, 0xc638e3b26b69430aULL, 0x3621d25926ae713bULL, 0xa1bd51db58013328ULL, 0x785b3dfc03fa5ccfULL, 0x155415e52ee77c99ULL, 0x9a122481b3fb9662ULL,
+        0x3d921ff77c56b054ULL, 0x9af103d05565d293ULL, 0x06c7dd6f71ff72a5ULL, 0x22f335a17d3b57d7ULL, 0x740b635c1850b52cULL, 0xcdd041dc8afea7d8ULL, 0x9af5cc5c11f15aa1ULL, 0x67e02ce1e23620d0ULL, 0xcc688c9320a18efaULL, 0xba32c8113444b361ULL, 0x17bdd8d05bb135cdULL, 0xc2e5b833f74387beULL, 0xcba628a3e7bc8478ULL, 0x06411e551b514463ULL, 0xdeb5454f91d8ce7fULL, 0x46c7cfc912c4d146ULL, 0x8e391406d078b97eULL, 0x0badd4fb9b35cf43ULL, 0xf7de3876d6c8a5b1ULL, 0x8ea760cc08f22220ULL, 0x55c12f0dc350e6e3ULL, 0xafba3878ca85698dULL, 0x1715ba000704fad3ULL, 0xe107fc6ef2712513ULL, 0x99ea529fa6640798ULL, 0x73d6ea80593f18e4ULL, 0xf21a1cbf53f5660dULL, 0xc379582c3c676158ULL, 0xf52adf3553272377ULL, 0xd44f7779ed804d16ULL, 0xc2ba96a93e06e2bfULL, 0x1cf1c1e7d6839c4bULL,
+        0x1643324fe5884b8cULL, 0x982d907d96a7aa05ULL, 0x903f629d142f8205ULL, 0xb9707d61e4378e44ULL, 0xa9344600ee5b2d7cULL, 0x24c19a439a58aabbULL, 0x91a5ee52caee8bfcULL, 0xf94f995e67240aa2ULL, 0x1a746a04446a0f90ULL, 0xa1c21abb817f758eULL, 0xe7fa0a9f6b16947aULL, 0x14f7d00b7aac0cf6ULL, 0x26984034a73bc12aULL, 0x06294f4726a1637fULL, 0x0d26aca89aa9f894ULL, 0x387a83000cb0b8fbULL, 0x5ef20c3ba1187ed0ULL, 0xd550b91b67b6bc47ULL, 0x9416979152e04f1fULL, 0xe23b7a4aa2b0b0a8ULL, 0x1bc37d26b6ab6bb2ULL, 0x02d5a9765a4edac6ULL, 0xb2e47c500daf6f91ULL, 0x3a2d191391e06a95ULL, 0x6c8ddea4a31a9959ULL, 0x4c986169e1f530c1ULL, 0x506c70f29136f0b2ULL, 0xe771636a1c9bc27aULL, 0xab7e58e0cfb5afe6ULL, 0x6a657e0450b5a4d0ULL, 0x3e14850b0219ab12ULL, 0xf64914899976c62dULL,
+        0x6f0010c6f1dbbd7aULL, 0x83cfefe08f96e9a4ULL, 0xa238c70ca602d53fULL, 0x9825eec4b25eab88ULL, 0x451dfbc011de5478ULL, 0xb4586d29993eaa7aULL, 0xbab0a83b8235fe6bULL, 0x855d68f22fc064a3ULL, 0xc47114708d3c5012ULL, 0xfdcdfb7a6168e39aULL, 0xfbc116e3ec32cb90ULL, 0xd05607039da58b0eULL, 0x05eec1a053a8ede0ULL, 0x4adabac263ad4c68ULL, 0x0153df85ad38c6a2ULL, 0x23f92f25c504425bULL, 0xadb208663a4e4b37ULL, 0x9322c43db29f5984ULL, 0xeff1b87767f3b8abULL, 0xf4d75d064c99b39fULL, 0xb5b0ce92ab9f2183ULL, 0x2596173c247915beULL, 0xb0fac23b58110d56ULL, 0xf458f18e0c0f7e5dULL, 0xb06c8edae516554aULL, 0x8de6a6eb0bfe7ebeULL, 0x28714cc57fe1f4cbULL, 0x5f55944410963356ULL, 0x3673b9fa26e68ab6ULL, 0xf33ba5f177a486a1ULL, 0xbcfd4eb616fbd7ddULL, 0xac35c4fedec25dadULL,
+        0x6a04d53faf102762ULL, 0x983cfb282c00fb2cULL, 0x5b601d80f0609b94ULL, 0x90ebbe0f86b6915aULL, 0x6cbaed5167347db5ULL, 0x34f9c47d09f65226ULL, 0x84b28eb3d042ead3ULL, 0x72cbe06d126bbb7eULL, 0xb78fcf8c4f931f66ULL, 0xcb1691ad97dd1a12ULL, 0xc5f7ff4a0c00da07ULL, 0xa0b4d810eb638090ULL, 0x2ea2d9caac64bb4fULL, 0x61219d6fe53dab0aULL, 0x86a520c4a39905a9ULL, 0x662ef94f7a77dd3bULL, 0xf0ae4d5b520ee0caULL, 0xc500c98a899ca51dULL, 0x0e9629146af0346aULL, 0xec433b151e73960bULL, 0xdc8fceff655bb146ULL, 0x115116f393480df8ULL, 0xf250ddd3ac5f9afbULL, 0x0ff7ff96cde0ccb8ULL, 0xc1d6c8b422f56127ULL, 0xdc5d5ad2824b832eULL, 0x41ebc7c1713b842cULL, 0xc241f1c6faf8ca7aULL, 0xfd36a34eef714ee5ULL, 0x95bde1beae31667eULL, 0x77e900d1d1130c3cULL, 0x5281720a661f1b3cULL,
+        0xe5c5348ad9809312ULL, 0x5e25f62d5460ad2fULL, 0xdec572d17479fa33ULL, 0x4e1cc24c5360d8b1ULL, 0x569d4ee57e3ba6a5ULL, 0xf4bc660f3f6ba190ULL, 0xf5c9c88b983e5799ULL, 0x365d3d3f2d8b5728ULL, 0xa0ff888dbbd63acaULL, 0x4dd5cc4e319589b7ULL, 0x434deca5ba7ec69cULL, 0x6a12d8879612cba5ULL, 0xd42a580df3d6466cULL, 0x184f8a958d136498ULL, 0xa19c210d914b129dULL, 0xca93d0d6ec7a0c42ULL, 0x440542ef31b87dbcULL, 0xc0ed791e497cb2e9ULL, 0x17a670e1a200b7c9ULL, 0x3cb548cf388501d2ULL, 0x1059a5bda7d29f5eULL, 0xf148323f277c02acULL, 0x80d043700542536bULL, 0x6b1138edeb2575e5ULL, 0xa27092e1d90e4151ULL, 0x847463583da3a90aULL, 0xf9c8d4f1ff085b21ULL, 0xc9d61303b41aa605ULL, 0xc70f2e5b84750ca2ULL, 0xc10bef3abe9f4165ULL, 0x36ba33b4bbefeb3bULL, 0x708bae50abfea6a4ULL,
+        0x000d76209998a72aULL, 0x5d2f4dd420562b30ULL, 0xe556001245048c45ULL, 0x94eaa837fbb38107ULL, 0xdeec3c6e41d794f7ULL, 0xc5579625e9ba40f7ULL, 0x385d2fdfb258a44aULL, 0xcdf1fa5b4dcfc365ULL, 0x564ed7b820247e13ULL, 0xc260344981e76508ULL, 0x748cb1e582e883f2ULL, 0x3b0292b3b4f527e1ULL, 0xfd30563095631b91ULL, 0xfa690fa50c4ceb57ULL, 0x76177054a0b03547ULL, 0x83aa8d7db0638f67ULL, 0xaed485834ce8c0c0ULL, 0x0d5d4036abaa8830ULL, 0xf621df71d18b50bbULL, 0x8b59e0ad9625f508ULL, 0xbcd4270919648441ULL, 0xb5d1cbd1dea7326cULL, 0x346c91497086cee1ULL, 0x61e404ed7fe5f21bULL, 0xbe8e065d7ab88020ULL, 0x604e3d3db1afc242ULL, 0x6e3a6d1c929da939ULL, 0xf69e2f6f0edc8a50ULL, 0x175e51de78fea7d5ULL, 0x3214060165f5cb70ULL, 0x2e4d2c962b75f815ULL, 0x64d47937156316adULL,
+        0x48bb34d2605b26d8ULL, 0xe378042a73a848bcULL, 0xe43bc1e98832ada2ULL, 0x1298aa7565a64f01ULL, 0x4d02553cf3166f93ULL, 0xbeda6b17e3ccf839ULL, 0x066d61398b69efa4ULL, 0x1279a80bdbbedf65ULL, 0x57cc9e84fc4465c5ULL, 0xa838479febb3c3a7ULL, 0xf431ff9101e291ccULL, 0x86c3cdb246140a24ULL, 0x5285009f8ec69954ULL, 0x9d717025edc4a045ULL, 0xe3008b55b94a7785ULL, 0x97bed4d39c83efc9ULL, 0xf030f3f94fa93699ULL, 0x8c25ee393b62e70cULL, 0xe911eae7c12ee882ULL, 0x250a862fc3648ae7ULL, 0x02e511eaa6d6c50cULL, 0x95087df26031cd55ULL, 0x7fd48e6a132d16dcULL, 0x85ced53ffd07f2feULL, 0x58a30ecdde244e56ULL, 0x18b1567de6e4b4aaULL, 0x0842b265011bf59cULL, 0x2bf2d4160fcc6846ULL, 0x5b8158fdf826e846ULL, 0x5b6ea08deb9ae6e3ULL, 0x4994fab9cc10ccacULL, 0xe38db5fd71e5f0b6ULL,
+        0x6de7d6b83270f543ULL, 0xe5d9635d9767b598ULL, 0xa814763a7e844413ULL, 0x3e6ddfb580bc67abULL, 0x8a7f82a6c4e72493ULL, 0x27cb293e0245d4f7ULL, 0x06acc52260a8e77bULL, 0x63e5ce49bf1a45a7ULL, 0x08a951150a866960ULL, 0x858c3fe3cecd1f83ULL, 0x71b29477d5b46039ULL, 0xbf2cf15a3694e8feULL, 0x2f29b222866509e6ULL, 0xdf3f31a41664c86eULL, 0x8f6e2b9d89115543ULL, 0x5f1c7b021bae12efULL, 0x29aa5836a1cb3bedULL, 0xb99550d797560c4bULL, 0x499bf024241ed31cULL, 0x9722c05b9987cac1ULL, 0x41f006003d3f35d9ULL, 0xe33ef4635ff16247ULL, 0x8518e2f82cae4697ULL, 0x994c15a306b06461ULL, 0x28f9cd352f50c43fULL, 0xa2c8159c1f015802ULL, 0x379b930bc8cd70caULL, 0xf59e3130d26a9c33ULL, 0xe525b0c4f0a687d9ULL, 0xdf99659dd8697c5bULL, 0x8496bea4c15a8c8dULL, 0xc1b83207626f15e6ULL,
+        0x3c68b7f7fb6ebb84ULL, 0x43c1c315f3bbd39bULL, 0x1efbfecfb09d9aaaULL, 0x82b1d0c47584b5d0ULL, 0x32c0288dca21c282ULL, 0x8f015c51f7e0be0dULL, 0x9013f04ec4e2f851ULL, 0x933c52ad82ef4894ULL, 0xe651f43945e9c32fULL, 0x4db528008d194228ULL, 0xef855210eca9bca1ULL, 0xbd8adcf3d46347b7ULL, 0xd0ff95e0f326c2c4ULL, 0x7d25bd53c4a9f43bULL, 0x7482b485f624c1d1ULL, 0xd8e91fa499f80719ULL, 0x4870e3f6efaf80c7ULL, 0x350bd096453c42cdULL, 0x80c2cdd2d364069dULL, 0x09f1da1c46734264ULL, 0x99db99f4b18ec617ULL, 0x79c4e4407b44ca9dULL, 0x1a3e9d07bb3a63fdULL, 0xbc9f8125d1d2e65aULL, 0x41890c21b157d3cbULL, 0x26b01e2459211a8fULL, 0x04b3be5bbe6d5e2dULL, 0x72453bef6ae1b030ULL, 0xd9331b989f8ec784ULL, 0x6fdb441d6afa4386ULL, 0x60c043001b2c79fcULL, 0x4d1f1831323c3b87ULL,
+        0x07113da1143ce402ULL, 0x1990fe897357314eULL, 0x8e31519ed9b2efe6ULL, 0x852833cd9c33fa50ULL, 0x9a2116c9fcbd7338ULL, 0xdce3d417f6855e58ULL, 0x80396b8706f37d00ULL, 0x6be7b857acab6179ULL, 0xea345cac3e70971bULL, 0xe75b19495b8e698eULL, 0x207608c994cc6d49ULL, 0x0cd068a5f3f65ea7ULL, 0xf1438685b81087e8ULL, 0x1685cb8b3b6954e3ULL, 0xd2ce77f0a63691f7ULL, 0xb5b0b68d159ba4ccULL, 0x5e110a392c0ae680ULL, 0x89ae777020840be7ULL, 0xdd4af2b5ca214ef0ULL, 0xd54148972705a30fULL, 0x6481a9d4a0883940ULL, 0xab1fb5dd83eafe9aULL, 0xc359b8f97ffc292bULL, 0x90aeff7a7d4efee2ULL, 0x0eca3cd077998eb4ULL, 0x6919d68c7c7e2bd4ULL, 0xa69e7f0765d09583ULL, 0x8bce0c872b4ab358ULL, 0x0f9942da7f7733f6ULL, 0x0e16359508c9f963ULL, 0x9ed0a10b79290e96ULL, 0x4fb4c4ed0df90456ULL,
+        0x12a731980c81ed85ULL, 0x9943e61ee191d2b9ULL, 0x87b315b5195a5765ULL, 0x28e9c4ff4f3009a1ULL, 0x81c8be4b5e76ce63ULL, 0x5d68425644b4e5bfULL, 0x01d4b4eafdb25a30ULL, 0xc48d2c825606b9d0ULL, 0x2f1d501a09ec9d87ULL, 0x3b33371b8ecfbbcbULL, 0x105af392c416c542ULL, 0x9e68bd1b0fe9f96aULL, 0xd20707aaa896b52fULL, 0xbdde5756a2a22fa8ULL, 0x72566ada7b03d985ULL, 0xa60c265f2df1fe3eULL, 0xcf694beaa4ce5406ULL, 0x131fee58ead2239aULL, 0x503720a7d1944813ULL, 0x02f69638e7ca8402ULL, 0x414299e3c035c752ULL, 0xc23b4c9e8a10db37ULL, 0xa53e8d46dbfc7f4eULL, 0xe57b37cf4216d3a5ULL, 0xc45647be4b8c8a42ULL, 0xe1879c85976cb403ULL, 0x7edc379b83ad4f34ULL, 0xa9aab44eb4880c01ULL, 0xed197ffed1851593ULL, 0x9b4609c1d1da2bb6ULL, 0x058b9ae3065b8a24ULL, 0xba803d8057a7f4beULL,
+        0x9bcc8d98a2cad363ULL, 0x5713e8750ea57b0aULL, 0xd7e4e9aab7e4759aULL, 0x0d0df4e3b20aa5a5ULL, 0xd290d6160c5756eaULL, 0x7079d0fad42aa390ULL, 0xecde2214fa46d6baULL, 0xe717d1d187acd85dULL, 0x6e4f06ad5c949a71ULL, 0xcf4c58d662f8feb8ULL, 0x21a3c299130a364aULL, 0xd35728bca31fa1efULL, 0xa4309877b91cf14dULL, 0x1a02172fc1c19079ULL, 0xd588c307b293f83fULL, 0x54dd4e212dd3668cULL, 0xf733c83561577bb7ULL, 0x95ba68431cdd6848ULL, 0x845092006d31e3d5ULL, 0xdcda3279c33ff4dcULL, 0xaba00b53edfb1582ULL, 0x7605fbfd9e699f10ULL, 0x1dc71f795f6724c1ULL, 0x4c262c8fcdd2cc8cULL, 0x845cc9f017d5e1faULL, 0x371c83a40e5c262eULL, 0x774ecd80346a57cbULL, 0x4c0883b165cb81a1ULL, 0xad24c19c48f53225ULL, 0x4b37a4b5b240f7b5ULL, 0xb1a2eb7a7a947394ULL, 0x3b82cfca0c0ae80dULL,
+        0x2b050faa8f562eabULL, 0xec68c15ca744a784ULL, 0xe1f611db7476c600ULL, 0x406242ae10b98225ULL, 0x357a67fead8199e9ULL, 0x8d464478847a56b5ULL, 0xf9b41b6c7c104d19ULL, 0x3e6c1cc77ac0767bULL, 0xc0433cb892905d82ULL, 0xf43abf90815e2b86ULL, 0x9a38d5f709b8d402ULL, 0xbe2ce82847637816ULL, 0x1095a6d9ac33220cULL, 0x2c160350862cd63bULL, 0xd47bda4cf863d6ffULL, 0x4e4254d989a2e08fULL, 0x47554b6dd50295b7ULL, 0x4af8116c1b6bf6a8ULL, 0xb7cc5b708141c2e1ULL, 0x1cd14c4ca9fe1cd1ULL, 0x02adcf5f7fe66293ULL, 0x37adb10a41a07726ULL, 0x24ff294f9390eb42ULL, 0x785cac5492eb3274ULL, 0x652763c2dbfce9ecULL, 0xfa1f603fbc0d2844ULL, 0x2a80cc9c9842de27ULL, 0xddd46a6be4bbb12eULL, 0x747fd9fa79084ff5ULL, 0xc887c6eaaaff78dfULL, 0xb2aa2dbce591927bULL, 0x7027f8490d9a6858ULL,
+        0x4154f3792fc24540ULL, 0xc51f3481977e3303ULL, 0x7157495977821831ULL, 0x8abcb6e64e357ccfULL, 0x255878867b2b8031ULL, 0x5450bccc71acd238ULL, 0xa78bc0cd95372cf1ULL, 0x26565277620a66edULL, 0x62e6144c7c226f3cULL, 0x72a6eea0e5427f38ULL, 0x029f26a34bf44c8dULL, 0x96c21042ab06912bULL, 0xdfc451ac92d26456ULL, 0xf59ec6dfe0c9950eULL, 0xb3a2df3b6950705aULL, 0xb5440e85c347cffeULL, 0x5912812f8a8cb1c0ULL, 0xdf2e4dbce67eb2aeULL, 0x45c1a372f53d879aULL, 0x58872587d69fafdaULL, 0xb81b1432fc8e46b9ULL, 0xa5e4d3cb694191ccULL, 0xb2f7e205bfb57a30ULL, 0xc98cb34627692445ULL, 0xe731762cc04555c7ULL, 0xd1c37862be10cb0fULL, 0x5ea648eca1935b40ULL, 0xb34ea5139f1c4378ULL, 0x947fbf5bb0f71a58ULL, 0x7aef44da7029a3d4ULL, 0x7085e07692b32dbfULL, 0x06551dced227f6feULL,
+        0x4ffd513e1322df9bULL, 0x93a46514bd0675c8ULL, 0x5c0d8d9d923e0ef0ULL, 0x8fe7c63dfb79cc15ULL, 0xdfb27d72a849bf87ULL, 0x0a5cd05f7976861dULL, 0x4e2d09e23d920470ULL, 0x6fbee02809fa1493ULL, 0x64a3e9f5ff6d017fULL, 0x4a22bb43727681eaULL, 0xa3651bd6d186dc12ULL, 0x1bb566b3480cb754ULL, 0x42f0e83ed063791dULL, 0xc1385c85bd90b6ccULL, 0x02df7caa666d8566ULL, 0x80eac91a90ff0f91ULL, 0xe552dec353b71788ULL, 0x0e47e861141d6751ULL, 0xa9aa2fb211e76361ULL, 0x2a92cb48b6832fdbULL, 0x36b8b78568122cc0ULL, 0x6cd9a6a07b3a2f06ULL, 0x3d0013bcaf55921cULL, 0x06b2c62b7d4a64d4ULL, 0x0c32d421c7eef584ULL, 0x126750ecbc1f7fb9ULL, 0xc60e727e48fddbd2ULL, 0xa16df8140910e802ULL, 0x6a61583c64d4e20aULL, 0x7504c06395623a8dULL, 0x52fee2d0e148f370ULL, 0x2fabab6db9bb30e1ULL,
+        0xbef4096096c6a4dcULL, 0xb31754d06709bd34ULL, 0xd7dd37ebebb0f475ULL, 0xcc744803b4dccfe2ULL, 0xa759dc326cb45510ULL, 0x0220e3ece3ec83fcULL, 0x80d10eef494fb53eULL, 0x7f913e5347e92e3fULL, 0x525554a5db249bd3ULL, 0x17b145999b611d9dULL, 0x81f47088d0feb233ULL, 0xab1fea6b66af9b19ULL, 0x9cec7a42833e1829ULL, 0xce7c67e33fe5f381ULL, 0xb943379f7e5a5cc2ULL, 0xe27beb05faa91907ULL, 0x377542d130673657ULL, 0xee796d5dda271fbdULL, 0x8fdb350012175248ULL, 0xde0d0e6d41715153ULL, 0x4ee66411b8c7938eULL, 0xd37144ffc6cdda89ULL, 0xa2bc6c4644155ffbULL, 0x3d1f8961b11294c1ULL, 0x3e2bdf29812042f9ULL, 0xc8dc460ce1531b25ULL, 0xdbdf07bb63348458ULL, 0x33a3e5cc916e7ae5ULL, 0x4af2750be9cf0528ULL, 0xc1cc3a1cfb5e9e4aULL, 0xcadfb76e09c686eaULL, 0xa79dbe5a8cdd4bc5ULL,
+        0xe08d837026f12befULL, 0x6590a81cdff52507ULL, 0x23c078adcd415170ULL, 0xb094ad58b603cf95ULL, 0x1302e9492d5d5f76ULL, 0x2da01bd07f2cf94dULL, 0xd6b998868d82f77eULL, 0x1582472f656f5efdULL, 0xcfe4c7ef1a15a9f1ULL, 0x3f0c4f9b4e494da5ULL, 0xc1514aa1e6278f62ULL, 0x61cd18d96719337eULL, 0x40b36f63f0f1be90ULL, 0xd3d727b6fb8e0811ULL, 0x4c9b1b6eb424588bULL, 0x19bde7e3cf9851d5ULL, 0x16be6579c51c7c79ULL, 0x17e61ae25b5ef843ULL, 0x82917247e64608faULL, 0x3cf83223203597cbULL, 0x3a13d610f140d988ULL, 0xf4d0128310b7462cULL, 0x7c2952f6e2776a28ULL, 0x42c9f1b54ccea5ddULL, 0xbc912da080f2d379ULL, 0x363744172984bb45ULL, 0xb6d4c638594e0f03ULL, 0x9c6a3d1feea99196ULL, 0xb40ace0bd9ae6b0aULL, 0x383c04cc5f2621a9ULL, 0x545d4c42398b6117ULL, 0x633cf0cec68e7f60ULL,
+        0x598b70ee87c22faaULL, 0x5c32b333e1d3baf3ULL, 0x7ff0bdaabc44cba4ULL, 0x6f01def021f4a276ULL, 0x9e191861bbec9d3bULL, 0xa40cc84a36b285f5ULL, 0x5184d9c14825d7edULL, 0xe02788823a12f21fULL, 0x538571e4d46b6ae5ULL, 0x030df96d9b720987ULL, 0x60990b8079db6946ULL, 0x3e46e16dc8f2419dULL, 0x0cc17efc43afd271ULL, 0xd48ad7891db92dc6ULL, 0x017328a50bcc7565ULL, 0xe1cc8084d735eee5ULL, 0x3dcd66033d5b61caULL, 0xf7ca448ec6f31476ULL, 0x443160b8054d3d3aULL, 0xe2995d5a26c3fb1bULL, 0xa6e97ac6f11f456bULL, 0x73aac969cc3af182ULL, 0x8281fb1c10c59038ULL, 0x4d428ad112195d09ULL, 0x9400e21e451bf9f9ULL, 0x3974b57a07f8ec06ULL, 0x4155d84bc508e71aULL, 0x55b2cc81de33cf02ULL, 0x1763f0f6bca0d40aULL, 0x040217bf68e3f8f9ULL, 0xfff219d7a1d6ac3eULL, 0x142a3b51968454e6ULL,
+        0xdfc2ad292fca7f7dULL, 0xa80188907fef561bULL, 0x64bc1722c5b6b6b9ULL, 0x6ee7633142821a15ULL, 0xfb86c1b47d03bca4ULL, 0xb28b5bafc5d0e314ULL, 0xd891fbf970950119ULL, 0xab7f8aa4a17fc2ebULL, 0xc48766062d9da83dULL, 0xac18a237376b10b6ULL, 0x6e1dbaaace5e99cbULL, 0x25d9468114873f8dULL, 0x8e08453621a3ddaeULL, 0x99b40c88736d51afULL, 0x2471182edaad1438ULL, 0x928fd157ffeba505ULL, 0x4bf0e8419aee727fULL, 0x80ec81795708ee66ULL, 0x01af8da95c790af9ULL, 0xf8cf91cb19378d12ULL, 0xf099d1d8601c515cULL, 0x650d455d11251071ULL, 0x0d65cf9a19542d2fULL, 0x66d370a4f6a0df88ULL, 0xb3dbb6ae09854234ULL, 0x743457f933da8967ULL, 0x1107a3e9663e5ebcULL, 0xd410aaa814eae7e6ULL, 0x84700dc4107c5245ULL, 0xb1bfd1aebe27742eULL, 0x8f076aff678c6a74ULL, 0x4137465a26e2bb13ULL,
+        0xe7c556fb3c3e1bd9ULL, 0x79f4de7a4af9efe8ULL, 0x2bacb608a9333af7ULL, 0xd1feee677ab3acc1ULL, 0xc160f14586f9abd8ULL, 0x69befc8e0281250aULL, 0xfaa746a51c7a53b0ULL, 0x52d170cb821e59feULL, 0xbb00c7db69e7295cULL, 0xfc6492bf36504fe3ULL, 0x8accf9571f38a3adULL, 0xf4da1c3b19cbd492ULL, 0xa4c0a4f29d469c07ULL, 0x5f40359050a9198aULL, 0x2006ab59f50d9ea4ULL, 0xac899d5a9f2a00c6ULL, 0xb0a37fa0cae9b1ffULL, 0xef2016e3938dbe94ULL, 0x95374451c8716dacULL, 0xdb3e4a986f133f7dULL, 0x2e4b516efd75d9a3ULL, 0xcb6babfae2d134e9ULL, 0xc089ee967d0a1dbdULL, 0xd4cf0c627b35d364ULL, 0xeafd6fa12fee5aafULL, 0xdbc1ce323d88e173ULL, 0xbb73d1cb04aa771eULL, 0xf67b27189b3ab9a9ULL, 0x73d9590bc6a69387ULL, 0x2f6446f855b77eb1ULL, 0x8b0740e536e71f91ULL, 0xd3785b11dc72ac95ULL,
+        0x3b2beb089245c03cULL, 0x36ac33cfe387a5c1ULL, 0x335c1080d6877bdeULL, 0xc02b8a3a8ee31e1fULL, 0xfad23b85dd337cc8ULL, 0xf093a83e55a08725ULL, 0xcf14776c5a87a6ceULL, 0x1980158e0e63d33aULL, 0x70dd47d767152639ULL, 0xbc55028c5a7280b7ULL, 0xd34ca5f9de8902acULL, 0x80b1834537303dd2ULL, 0x9327bc4c916fb7c1ULL, 0xa59c13078275a3f1ULL, 0x0a03662caf0835f9ULL, 0x44014eb77d631af7ULL, 0xfd604bdf8d9648f0ULL, 0x25da10666e3d9a1dULL, 0x3b18e74125cd250fULL, 0x0e776bc9af4bba54ULL, 0x748226391d28dd6cULL, 0xf2b713bbb8475c04ULL, 0x70c094f27a67a31bULL, 0x628f5bf7d5f3f328ULL, 0x393fccdc91158e38ULL, 0xc46dcf100938a458ULL, 0x992d1d8753f260d1ULL, 0x21a167d271cd0543ULL, 0x7bec9a84895dfe27ULL, 0xdaac23babca59c6cULL, 0xe3b2ec130b8d4646ULL, 0x3215b7df68437d84ULL,
+        0xe25cca1c16196b62ULL, 0x1d9cb8e07cef51b0ULL, 0x5d258c58b7a22279ULL, 0x5e091cbe0df427d0ULL, 0x7e325a7c3fd0b436ULL, 0x79759bc19efb6cbcULL, 0x5c2a4268bfe016f3ULL, 0x99291cce397765f5ULL, 0x8c7a455c1fff2d90ULL, 0xce0ebe03991b882bULL, 0xed6dc2f673b77528ULL, 0x14da7a0e9752573fULL, 0xcf0e98ab29920698ULL, 0x468a6a58ce501585ULL, 0x97916452000cb811ULL, 0x7e1224505e9bee4aULL, 0x7d0ae61cca8bf606ULL, 0x3cbd4fdca554b8deULL, 0xbb460fc8bff3f28eULL, 0x3c3dd5be8ea703f6ULL, 0x79051e63496f50b9ULL, 0xef670e6e1f151683ULL, 0x053bb25d2a24c22eULL, 0x30951feec173d923ULL, 0xc37cc524ac7a5492ULL, 0xa862957ee1a2ca01ULL, 0xac1d268e48c82e20ULL, 0x3f891a231a14e230ULL, 0xd845ae5a49cac026ULL, 0xd4b10f472fce7ae2ULL, 0x9f34110b98f62ba9ULL, 0x1090293089dde29eULL,
+        0xbbd63b3c5dafab89ULL, 0x0a78529557897893ULL, 0xe9460aa2050882c6ULL, 0x195118299485be2aULL, 0xfad788b9732fa33eULL, 0x14cc1f06126b3dd1ULL, 0x9acce5a63016decfULL, 0xde4bdb08bb6f0c89ULL, 0xadbd12b39761eefcULL, 0x67ef0402578b327fULL, 0xda36baff8a15edd9ULL, 0xe0ce2ff795f1f65cULL, 0xb9109d36e2d40264ULL, 0xba30d48016d8f34eULL, 0x62541b85876327c6ULL, 0x8e384c689f39d975ULL, 0x05388e36c954db15ULL, 0x6edd5b1427334201ULL, 0x0e86e3ae0c3d3540ULL, 0x8709e78f28118060ULL, 0xe02d373dc7af462dULL, 0x29de72abea0a26c0ULL, 0xb80258d46db97066ULL, 0xe51faf28258ed07fULL, 0xf4e9c0c86b09ba99ULL, 0x28bc275cab2dab53ULL, 0x210cae0f621d19c5ULL, 0xd78bd004d4dd79f8ULL, 0x7519f9ae26a7685fULL, 0x33f740ce6ae8a1beULL, 0x8e6fa5a932b3f0c0ULL, 0x67c7e2b1b35405ceULL,
+        0x74cbd483b0bc4e83ULL, 0x3081f34ad0b4a91dULL, 0x1ec314c81f4e56c8ULL, 0xcb4604f6ccc7e5a6ULL, 0x42037b70a4c7bd8eULL, 0x8bfcb38e1fec9d68ULL, 0x396d5b5241e673adULL, 0x38d6c4177275ea9aULL, 0x234854504396448eULL, 0x6e28f9443c81e7a0ULL, 0xe2d318e282290b80ULL, 0x2b53e4acc81b6ccaULL, 0x0b11e4cc45604bf8ULL, 0x5ee56f34bcb3bf9aULL, 0xdf330f768ca08910ULL, 0x2a71bcb53f26118cULL, 0xd6f2a5b7f092215fULL, 0x99c0bc90669749fdULL, 0x78851d22494ac32cULL, 0x69231c5f9ab2565dULL, 0xf475a1c881d261a3ULL, 0x271eaf1878f1b36eULL, 0xbab4dc48a3e36b7fULL, 0x06bae1615e42ea3bULL, 0x72b650edaa5a0d22ULL, 0xa7d032f7d97f4595ULL, 0x16ea7cda6e56ef7aULL, 0x86b8e6857e2978a3ULL, 0x14b8620ab8ec83dfULL, 0x236f6cf520b437a5ULL, 0x3eb7c77d1f096d7dULL, 0x85f0fcd7715d2f28ULL,
+        0xf631dd3f576e1e40ULL, 0x1dfa30d0e3725281ULL, 0xaefea72876d64292ULL, 0x5e1d1f1dc8599444ULL, 0xd432d740dc80afe7ULL, 0x283c734b7c45db41ULL, 0x3a7aa824defadef8ULL, 0x53ef5af5f4daeb73ULL, 0xf63993c93d9a3e87ULL, 0x05a537f85f2e74daULL, 0x11852a328ed8d171ULL, 0x6d0d95b190d7152eULL, 0xad00f84bf8d6c58bULL, 0x58d284ee3e0c42deULL, 0x6d92ae1776febcaeULL, 0xcea3248bc22f844bULL, 0x62f32f9f99b3f556ULL, 0x838702d8d5bd481eULL, 0x3a5be4c3dccc437cULL, 0x625807f926d1a56dULL, 0xcaab5e0eb7648958ULL, 0x8c34fe8781738b7cULL, 0x91f40eb7b33dffc6ULL, 0x4c126379ccdfc066ULL, 0x64f6cf9ed7872505ULL, 0x1f336fd3ad3974a2ULL, 0x862cf8dd640d7c87ULL, 0x1a65ba35a41da8bcULL, 0x5b2129ca6ee0a7fcULL, 0x1c5555db160eaa2bULL, 0x4e57adddaae16676ULL, 0xa7317c4875d2b29cULL,
+        0x2969e853e40e8928ULL, 0x8abca60b50f49be4ULL, 0x9522b84368242a1aULL, 0x024d059e3d0f421cULL, 0x9e56c7754ef5830aULL, 0xcba6f4a07345e6c9ULL, 0x84aad3539db721c2ULL, 0x9f69173baa7bcca8ULL, 0xe04c28ebcf72cfb3ULL, 0x9457f39ae110090aULL, 0x3c13d94382a6a1aaULL, 0xb9f9fa18c47b4da8ULL, 0xd8829eb6afe1176dULL, 0x546ae9d025d1d74cULL, 0xc72b9629c8f13dc7ULL, 0xd5a15d54bbf8dff8ULL, 0x0a825d2f06b50186ULL, 0xd020e5acfad053e1ULL, 0x4cc4faaac41d11c5ULL, 0xfd402459c92d7a19ULL, 0xfefff56306f3884aULL, 0x6451e997d1ec58a8ULL, 0x8ebcd457ada4f53bULL, 0x2895a77f6413d640ULL, 0x682f4f28cc51b2f6ULL, 0xb89f1aa83ab73027ULL, 0xf2ea01ca6b601747ULL, 0xb5143c36628624f0ULL, 0x3e1421630567391eULL, 0x55a2232330e976e6ULL, 0xfe9fea23fb7da228ULL, 0x01861ff0b7eb92dfULL,
+        0xa135cd5d2b4a198eULL, 0x52beed779e7379f9ULL, 0xc879e03fb30345a4ULL, 0x497f7aac0deae784ULL, 0x6c1def8046bb545bULL, 0xbcd973eaed232b4bULL, 0xc67ea436f6e31f0dULL, 0x99b7be217fe6f933ULL, 0x748ae0b8fe85d86bULL, 0x4753944277effa38ULL, 0x064747e69df8703aULL, 0x2b3c9d3dfe9bc16bULL, 0x73decedebd93475aULL, 0x4c54f860d07e27a9ULL, 0xeb63edbd4ff41150ULL, 0xdef527b3e2cda5aaULL, 0x6cd1d5188c660bd5ULL, 0x646de008194c1bc5ULL, 0x52db5591f5cbc9c8ULL, 0xe90aff9bc9ec3a52ULL, 0xef3554f3e87ddce5ULL, 0xc452424e6c936acbULL, 0xab4472aa0c4745c6ULL, 0xa50072b4eb329671ULL, 0xbfce32dfe515ff75ULL, 0x07baa4d177fd58e1ULL, 0x1c9be3de172999abULL, 0xbfa17dd2afb07984ULL, 0xf591cce50177dfb1ULL, 0x62f9257c7543731cULL, 0x08da0592fb09326fULL, 0xa5af8e3cc1ba89b7ULL,
+        0x2548771b04f607e9ULL, 0xa8354c506b4af17fULL, 0xef50e3779fb997dcULL, 0x5f4118f83dbde45cULL, 0x5287a334ae0e7e71ULL, 0x396e4f80e39bded9ULL, 0x9b02234b19fe542dULL, 0x4f45044680c22fc0ULL, 0x3368e2c37ec65481ULL, 0x691451f5ed965415ULL, 0xd98ee5c70435cbedULL, 0x8858807157ee8959ULL, 0x8811332dda161000ULL, 0x4f4e1f757082f1f9ULL, 0x58d111ea11898f7cULL, 0x16478aea2ebd4bb9ULL, 0x6d312c4bb30b9ae0ULL, 0x73bc9efbfee48458ULL, 0x4858acc8f3a1fcb9ULL, 0x81ee0deba4a71fbaULL, 0x77ce5ed5682132d8ULL, 0x4e5fe2540f5bb47dULL, 0xff34129b45a562b2ULL, 0x468bf9c83e79b8a9ULL, 0xd79af964f370ab8dULL, 0x7bb856de749b5dc7ULL, 0xb1dff0ff976b6574ULL, 0x89675b11d3e43b79ULL, 0xc84d77ad8c2f9c57ULL, 0x9c31e2e8b7e5ea38ULL, 0x55c3642a4117d154ULL, 0xb11aeb7c786fba1eULL,
+        0xc6a92fc9d323ba1dULL, 0x59e9569a4d45b977ULL, 0x1fe9c8a23d638d5dULL, 0x1725560dc3905c82ULL, 0x8d03af5ad93cbd28ULL, 0x2d4848573d4a9ef8ULL, 0x2172aba54acd5114ULL, 0xbfd775315f133c63ULL, 0x2b8b107c491043f7ULL, 0x02b897ed48b9c330ULL, 0x3ac8e601a6cd82dcULL, 0xdf707783568b896dULL, 0x9bd8384f8b312409ULL, 0xc5e15989c53c3eaaULL, 0xb85061582aae4e0bULL, 0x627a7a2c6f09ca29ULL, 0x126c24aadeb8bef4ULL, 0x358176a5e25460e7ULL, 0xe3059d065f13dec0ULL, 0x3436388ba1954f09ULL, 0x6d5bbc9e75ad68a9ULL, 0x98573174b31ac2adULL, 0xd5563bc054c4013eULL, 0x604dbd111972a5aaULL, 0x471777fdc9bd186bULL, 0xa3c192fd2c3c158bULL, 0xf780fb59a9644591ULL, 0x12f103eb8fed619bULL, 0x41e21cb35afb58cbULL, 0xfde2062b26cfb3c3ULL, 0x5a90aad248fad821ULL, 0x24f3af1074e55227ULL,
+        0xab1fb59ffd2bdfa1ULL, 0xbbd42641377a77dcULL, 0x0cad124b4391c4ccULL, 0xfcf2af030fe33293ULL, 0x4640e966f7589991ULL, 0x3f1c8f8a32fcfc92ULL, 0xb841ae541b865b1cULL, 0xa5664f61fde0f3b2ULL, 0xe6b4f309f4533790ULL, 0x7e683a526d01b533ULL, 0x32a4a3775e612253ULL, 0x0591a3e741ab6068ULL, 0x56590b2ff8106665ULL, 0x9689bc6ce033bcacULL, 0xfe8b74670b78ee4bULL, 0x51d469a49aa35fa5ULL, 0x255d601280549b0fULL, 0x8de44f53f5b7a5b1ULL, 0xd04bb72cd982ad92ULL, 0x75db5b816f5c867fULL, 0x26bcb462dd06eea6ULL, 0xeb00551f4dc7a932ULL, 0xd8e29f8637e6adb4ULL, 0x43fd6dc010c70f19ULL, 0x9bc39a234c1fbab1ULL, 0xce0695aaf6f9fdcaULL, 0xbb1b79f753f4d2f4ULL, 0x51013e540d2c46f8ULL, 0x4a111776e301016aULL, 0xe29c667a88e5d5deULL, 0x6dab357af7c487c8ULL, 0xc11e16d4cd7f490eULL,
+        0x2d799b058c50ccffULL, 0x65b51db3b7a24a10ULL, 0x3af1e036457ace98ULL, 0x5c0c1c012a868197ULL, 0x1248fbb8ea0f65f7ULL, 0x6381fb11e07b6381ULL, 0x701ee219c1236e96ULL, 0x51e95770e7a683cdULL, 0x09832b6fea0b3954ULL, 0x091e4171d6b3c426ULL, 0x7ef88db84a0ca5b5ULL, 0xc514de23a2ea4b0eULL, 0xdca72972dc328aa0ULL, 0xdb2e359036439712ULL, 0x39ec545b7221a49eULL, 0x18eae344524c953bULL, 0xab33e779891ef151ULL, 0x11e1a5fc3bcf0d7bULL, 0x49a192f5b7347039ULL, 0x8528fc25eb40a6a3ULL, 0xf733b284b4d1ef2cULL, 0x09a14be3d4157ad1ULL, 0xd32c6e06a064d472ULL, 0x0062e94d02b5be16ULL, 0x3bd082c3778bd6dfULL, 0x5080cca20da4cd0cULL, 0xe53840d1562f24afULL, 0x8f00bc8295247b06ULL, 0xba3984fb56abbabcULL, 0x918173f04f818d61ULL, 0x00e00e4488fff130ULL, 0x78b45eed7cbc3189ULL,
+        0x257fd0c725779befULL, 0xa60af68c36479af9ULL, 0xb865b352f57585eaULL, 0x005ac7c3da88983bULL, 0xf673f24fa93b06ddULL, 0x44379bbba8a74525ULL, 0xeaa7a8c48893d8b1ULL, 0xa3f3a03e5f1bbee9ULL, 0x062513623c84e5c5ULL, 0x050e73c8654acb85ULL, 0x1844d4b13365722aULL, 0x088f5390b2e174bbULL, 0x46bbc7aaa909e294ULL, 0x0f976c27dd026bd7ULL, 0xc3f4e4f49a1ed4aeULL, 0xb2ce9be9114989e9ULL, 0xd856759e48f5870cULL, 0xe232769b37d766cbULL, 0x76f2c50748666e78ULL, 0xb28956ba155678a3ULL, 0x184475217bfc0712ULL, 0x7cc9f0e409f59f06ULL, 0x58315afa8f0b0e3dULL, 0x3ff526bc5e62b012ULL, 0xf27717ca8b333e33ULL, 0x9ec04e6fd4755d1eULL, 0xe075b3da873fec8aULL, 0xb09a35b666131ec8ULL, 0xc3d8863b91a491beULL, 0x4ff57d4c1d0f4185ULL, 0x9e7af3178b7bcb6bULL, 0xe53047470d978478ULL,
+        0x7b09d90ac36fbe0eULL, 0xac47394edf7562caULL, 0x9eaa20ddb691ef6dULL, 0xbb01d1a9844b6e47ULL, 0x99ad7e522d24c14dULL, 0x649ffd92e358b986ULL, 0x020be65fe7a16e28ULL, 0xe3a973528035b5b4ULL, 0x30c07b538539de29ULL, 0x0d0de3585ab5a752ULL, 0xdf0ed225aae7a9f1ULL, 0x067a2d32db4efdfdULL, 0xc7326ca56c161cfdULL, 0x60cc0953f2f0c217ULL, 0xfc1659ee842b70b1ULL, 0x5fa0fa16a953f6acULL, 0x53ec7067be3002d8ULL, 0x1fe88370bcab9e1dULL, 0x6b39a24b8096881fULL, 0x1e36d88750ee44a3ULL, 0x2b2384e57c039c67ULL, 0xed03e88029840ccaULL, 0xa776303694b516f5ULL, 0xa1557c772fbf5d71ULL, 0x5c515d14b117cb4dULL, 0x07db56244bb28117ULL, 0xf9b5f8d89dbccb6bULL, 0x0f36be5d73e7eaf4ULL, 0x92acdd20f0aefc6bULL, 0x42b22667412831d5ULL, 0x2885ecbfcecbbb12ULL, 0x228f066531a879ceULL,
+        0xe837b584e1542d24ULL, 0xd3ee4e1cdb1f791dULL, 0x3c3cf5d592bc1ea6ULL, 0x5dd63411f8fdeac5ULL, 0x24098dc4c9f9349bULL, 0x0977f0ac4eac854cULL, 0xea52c7e4ac57d8c2ULL, 0x7584fad2659d12adULL, 0x19468bf6fe6a343dULL, 0x7f777d82119a54eeULL, 0x7cdf0689daf6b0f0ULL, 0xd6a6f2fa9567592fULL, 0xd6424d132edbb1b2ULL, 0x1750948f2be0e5faULL, 0x7049ae4b328a39c4ULL, 0xedd16c405c7ad602ULL, 0xdbc1028de0e7c104ULL, 0x074ddf3fdab79b5bULL, 0x8251d337d547ae74ULL, 0x060069db7e66142eULL, 0xcf23db03c7899098ULL, 0xc7606bdee780c626ULL, 0xc5425c1516ad7b66ULL, 0x002781b9cf89b4ecULL, 0x6c31d2b88bb1673dULL, 0xd058c219a42057e1ULL, 0xe9e2bc3824a47885ULL, 0xa9fba68fa6a1c516ULL, 0xec46f95f23681398ULL, 0x65a3bd504913b952ULL, 0xfa809da3d5a0a767ULL, 0x4f8a20c0a62d4c27ULL,
+        0xc696d36b2a15fbfbULL, 0x83a43f39fc8e2266ULL, 0xda2e7de644ded617ULL, 0x223a928a5d3f526bULL, 0xcf6d972acf854c5cULL, 0xaf8f271811b54498ULL, 0x6d1327526e582dd8ULL, 0xfc7ab53249765b18ULL, 0x994084f2fa0991a9ULL, 0x5f8567a53cba2930ULL, 0xeb9637569b16c51bULL, 0x5f5180429f54f79dULL, 0x831cc3d890ca059cULL, 0x8603590565613df0ULL, 0xa05e0d5c6bd40015ULL, 0x522fe3430210bcd8ULL, 0x8574a0c2cf7e1a40ULL, 0x1f2e2e784099abe9ULL, 0xc57c3b46d51ea4f1ULL, 0x02f3a1c2aaa0ce8fULL, 0xf3c6dfbaf26e9c35ULL, 0x2e08176fb8db47d8ULL, 0x7e497c6178e610f3ULL, 0xf9b333e2820a0d30ULL, 0x342948e88a5e424aULL, 0x3d8a11d52c1e920bULL, 0x46d8b18acbb169ceULL, 0x333922512076e692ULL, 0xdeb3cd6887ffd3c3ULL, 0xf44c74dc06d206aaULL, 0xc0e6fdf5b51816d9ULL, 0xa48f0737241d5453ULL,
+        0xb9cdf653221d1d6bULL, 0xbeaa2c419975ef69ULL, 0x129094fcdbd2fba7ULL, 0xf298a63307154ceaULL, 0xcd1e5cc65bccbb45ULL, 0x7c6a081596ea8ec9ULL, 0x64cdb77233bef81bULL, 0x60ce5c5a5f3e7677ULL, 0xe1e29f2961ca8764ULL, 0x4c0359b9d8c50178ULL, 0xa3f84d5677936923ULL, 0xfbcd9c070149c24cULL, 0x97f239d832731be8ULL, 0x75e0422d4b831c75ULL, 0x249452fd4994730dULL, 0xf60b14ead07e79a3ULL, 0x7787ca13ce2f951dULL, 0x718103543c2860e5ULL, 0x4c9237a226b69f7fULL, 0x3d6c11378fab3143ULL, 0x99f88f3aefe31d80ULL, 0x4ee7d111631ee0a1ULL, 0xa02373826b60e1e1ULL, 0x5f7e42fbcf23e3daULL, 0x19ddc0e698836420ULL, 0x971b8987a2a70ee3ULL, 0xa2a6d3b44a39a578ULL, 0x46000a8dfbf6d5ceULL, 0x2fddba1baaed0aa3ULL, 0xc00806a8703fe9e3ULL, 0xabb666d5e2a0d9f1ULL, 0x20d02fde3a14c4f4ULL,
+        0xed20c523733d2a8eULL, 0x2a0bcd4ef6195650ULL, 0x5951374610db68e5ULL, 0x58d6d837dc1ad288ULL, 0xf3d0e7ccba3c31faULL, 0x714f731ab5ace70dULL, 0x268f3ee6aacdaddcULL, 0x02675093f2e76882ULL, 0xbeae4c935551a9a8ULL, 0xe2a46b9ee14e91d8ULL, 0xa22dc8746ab7217eULL, 0x70b593f9a932817dULL, 0x42c4fbbf97b610deULL, 0x9ab55e56e5012cf3ULL, 0xbbb9dc2ecbb5598aULL, 0xd3aabfb3455c9849ULL, 0xff95ff355ca1b184ULL, 0x3b352220af0659c2ULL, 0x992cecbf9abdf9d9ULL, 0x456e81fd9495a468ULL, 0xf7bdd7eb1d122a02ULL, 0x2fab5f61888d2854ULL, 0x5880011d7e6df211ULL, 0xdc03f9828a166322ULL, 0xf462aa67b2bb31ceULL, 0xf896f141c4c85704ULL, 0xb3f851d41274c9f5ULL, 0x44dce6ecf96b7cddULL, 0x41827b8820fc0803ULL, 0x7af56a6908f00d71ULL, 0x870fdb79068cae22ULL, 0xdf69b41d33105df0ULL,
+        0xa1fa2341222965f8ULL, 0xeb9b568fdc59efa1ULL, 0xd70ba8233547e940ULL, 0x01766437438c1457ULL, 0xa0b3d75342c2f9fdULL, 0xff625b361b2d883fULL, 0x381cc63659044cbbULL, 0x1b447263778e5f22ULL, 0xb41ad95d58930cbbULL, 0x0bca59dba91e583eULL, 0xb81bd3d0e4fe3edaULL, 0x2808c4dac2b560adULL, 0xd7b3044e41cbace1ULL, 0x7833aa848f091c8cULL, 0x1d10828cf56d06f6ULL, 0x2ea1487f3b0f6088ULL, 0xf767b506ca10f1deULL, 0xc0cbecb99e270242ULL, 0xfdc14f077a3e91f0ULL, 0x86e2eb27a758faacULL, 0x956f4dc8d150f124ULL, 0xf7f346aac5ee649bULL, 0x052100e8aeb25725ULL, 0x4642f64b415cb85dULL, 0x5f6751b7517b1145ULL, 0xba396f2a2f3ae711ULL, 0xdf200e34b6c20fb4ULL, 0x99fe10feddf847c0ULL, 0xfdc0c8cf26765a2aULL, 0xffe025d378617b7fULL, 0xefd6cd7612bc5f79ULL, 0x2a5d51e1b23aec3eULL,
+        0xfd8a7b4910678d01ULL, 0x9467287b980129e3ULL, 0xb0cb6dd74a6a5b95ULL, 0xe7e2e127864d2748ULL, 0x65df74cb4153dc69ULL, 0x31cd2443e22ae6bdULL, 0xb6c4387cf82e4b35ULL, 0xea2d54c5c9ea1777ULL, 0x0da07a0e7c671cecULL, 0x23fe421f09f56b89ULL, 0xd2c41d0668ac95f9ULL, 0x3356c508bfa1e7baULL, 0x2d060983f42a84a9ULL, 0x13350cd75c9fd034ULL, 0xc2981adcab57dc9fULL, 0x03264e28bf39b124ULL, 0x689215437127ea1aULL, 0xa08d1657366818c8ULL, 0x72280daa6a2accd7ULL, 0x4e12f8819e4d6854ULL, 0x41959fc042ef13adULL, 0xbc8e37e717ddcfb0ULL, 0x11c463de274da4a1ULL, 0x3053a6ab65f8b2feULL, 0xa6d84231662a5463ULL, 0xb144ad73a3d3a371ULL, 0xeb419051469721a8ULL, 0xc35e2fd5a21e7a28ULL, 0x4672c7d5b9973c40ULL, 0x458cd4fc09268ea4ULL, 0x27d8b6324f23511bULL, 0xe37bae4f2c676f4aULL,
+        0x4c67d47a5278de75ULL, 0x26c19f343690e62fULL, 0xa4f270f4c49b28a3ULL, 0x372f67ec58d321d2ULL, 0x9fce39dbd969d6fbULL, 0x9d23d3f54abdda45ULL, 0xfe090bfc33b136e1ULL, 0x4f8d8dfdf5827f37ULL, 0x8ecdce586018aa5fULL, 0x57aad0f8811271c1ULL, 0x98d8dd7e61d2c080ULL, 0x1a62ab16af0015dfULL, 0x9ffbfb6377f38d9cULL, 0xc08da139ea53e5d6ULL, 0x8543aa20b0ee248bULL, 0x586416582157fdc2ULL, 0xc9f95da991d8e8a3ULL, 0x0da6bff609cb42e0ULL, 0x3846b27166af791eULL, 0x07226d284b1363cbULL, 0x9f079d3aafbf27aaULL, 0x19c85d9a36ce9387ULL, 0x21ab9e65f0d548f0ULL, 0xb6ba5a5797b573f6ULL, 0x0f75dfda7ed956edULL, 0xe6497ab7bb2d76d4ULL, 0xfaae157459f4ad5fULL, 0x445709e5e6551754ULL, 0x81ab447d2297d0ecULL, 0x717ca91aceaed660ULL, 0xfe352a2d809817ddULL, 0xc5a0c31b64739a54ULL,
+        0x5ce39d48543a997bULL, 0x4c9601bef3722849ULL, 0x63ef6f703b749452ULL, 0xe8399bcf414ca1bbULL, 0x11e5e7c2ef32dc72ULL, 0x71fe885d9b2cb940ULL, 0x22f1214a6f53ac58ULL, 0x11022e9e7d077253ULL, 0xcf2d751a7ff37e22ULL, 0x72eb7ecab252b99eULL, 0xf425e63008de344bULL, 0x89ab8046b51cd1abULL, 0xa4cb3a9953141197ULL, 0xe8ab4fbb15f20cf5ULL, 0x3abbca9e64722608ULL, 0x2f1f475b2c29b4c7ULL, 0x549ddd2410b90fceULL, 0x277591b294ee46ffULL, 0xea7ac0fd19b6c438ULL, 0xb6dd374957b998d1ULL, 0x47fbb795b1873ae1ULL, 0xb02eca620530a103ULL, 0x75f1d640ab81baf8ULL, 0xa9afef3dc2498490ULL, 0x1080995024508667ULL, 0x92fe3ba51c3f632dULL, 0x9dbb0977c9461a16ULL, 0xe04d7834c744effbULL, 0xa63baadaad0a5804ULL, 0x55f4277f5ce76abcULL, 0x4f531ef09ca82a01ULL, 0xc1f1121e6988bddbULL,
+        0x4270297adff58445ULL, 0x6b0e1928258d7a8bULL, 0x4953f3c6c02d1438ULL, 0xcdd020608598b869ULL, 0x8ebc6eda7020ae6bULL, 0x2c9ff05ffd986921ULL, 0x771f46c95965dff5ULL, 0x03f6c1b92a8ad29bULL, 0x39bdd43a1d3c9109ULL, 0x61c1f3dfddcd15c3ULL, 0x6c0fab7743d99f44ULL, 0xe9c20ea5318ee350ULL, 0xc54e572b46ae09b9ULL, 0x0122d624ef9742f8ULL, 0xfb770ee351420e01ULL, 0x746ffcac2cd70feaULL, 0x67f0686c86b029e9ULL, 0x152a56326b16515eULL, 0xdd9fcb9cb761f342ULL, 0x4adb0e0e853b6216ULL, 0x20ab2a3cfab212e3ULL, 0x21ee6dffbcc0ff2fULL, 0x92b78d7e5abe1d23ULL, 0x2910d8a693116e29ULL, 0xd0d6452f711d3292ULL, 0x6721317ec479e5f4ULL, 0x3a764cf3bf6e6044ULL, 0xc0bccdf1fb6ee4fcULL, 0x55368db32f250c2eULL, 0x99c8a773b29100bfULL, 0x3ba29c90aba7554fULL, 0xd0b74165d48a29f4ULL,
+        0x89cb2eb27999c235ULL, 0xa6bb9d7d088f98d2ULL, 0x66b99dbbeeddc60fULL, 0x3fc50ffa2f1945e7ULL, 0x6d95eae1871e115aULL, 0xffd49ed18b70f14bULL, 0x4806b5af908aee11ULL, 0x8540692674184c3eULL, 0x741c34068ed8b6d1ULL, 0x19a31c28090ef8b7ULL, 0x5bc345dfbcfae1d3ULL, 0x8459c344f92ff279ULL, 0x8fba3f599b36c51cULL, 0xbbb9b523bec3ac75ULL, 0x356c292a16e76054ULL, 0x7e2034936efcc179ULL, 0xb7270be379b8ce80ULL, 0xbeee82a8fb444849ULL, 0x1fd9f18707116ddbULL, 0xff535ba7f029925eULL, 0x07f155468e841dabULL, 0x6eb1fb55dd721146ULL, 0x99e75fe8685d5d74ULL, 0x774a3f2f17e9406eULL, 0x7011c9b3610db02fULL, 0xd02040a666f3899cULL, 0x3ba325deba85e378ULL, 0x70b4fb41eece96adULL, 0x28104af45cfee863ULL, 0x865dd93dcbe82a16ULL, 0x7960c9d9f29709a0ULL, 0x87c4ce911c165a38ULL,
+        0x1d3f1d34a18b1744ULL, 0xc216805f3e9d78fbULL, 0x8a7519cc7c269692ULL, 0xa5f7817aef5caedeULL, 0xa10ae599dc4b138eULL, 0x39eab2e10fa6215eULL, 0x9b6714e905464ea9ULL, 0x211c49d7d4b479ffULL, 0xc84991989f2868d6ULL, 0xaff542e73a602f5fULL, 0xa888d97ac584bcc4ULL, 0x1533a5b2e6a96491ULL, 0x5ebbda13102c9d2cULL, 0xcd6ccdaa779b6f4bULL, 0x7548bdf9df3ac49dULL, 0xdd553f63bc6ce823ULL, 0x053b2914c589fd8fULL, 0xf99f1e15f985724bULL, 0xd795a60872dca804ULL, 0xeb2a5e583fa861eaULL, 0x425c6deb4c7570b5ULL, 0xfa2d2be90ffc3962ULL, 0x3e32b759d6379e13ULL, 0x7992b8a77dfa7a2bULL, 0xc6c8b37d60ba4c07ULL, 0xa2da7aea5364a080ULL, 0x104f6f7e9d9a574dULL, 0x9d3aac4edfcf2de2ULL, 0xff21b11ab0231adbULL, 0x2a166b5121fdbe42ULL, 0x1ea9a9e764e57cb0ULL, 0x53f2c8951dd1fd9cULL,
+        0xe6202b21d9c0ffecULL, 0x1219ebcadfb3346aULL, 0xfb8fa260a1b768c0ULL, 0xe0db9f8a087f0d03ULL, 0x0018250e81730cbcULL, 0xbe7a94de3bc5aabbULL, 0xd1bc74159f9597f4ULL, 0x8e2d34931cd00081ULL, 0xec60c56157cb469fULL, 0x83256617927f5a6aULL, 0x45bf5e09a24bc97eULL, 0xf01a0a230a3f0fd3ULL, 0x054161ad527fef0fULL, 0xf597ae825eca7de7ULL, 0x37cf2dca9a724d7cULL, 0xc76b671068c9b176ULL, 0x2888b472cba0e1b3ULL, 0x20af1b55ba94a40dULL, 0xd8d1307d40e37223ULL, 0xb965ca706d3f103fULL, 0x73a4867d37b9d955ULL, 0x5010b3ecf91acce0ULL, 0xae2116dbe0902210ULL, 0x52357ff30c3a27f8ULL, 0x3a5d88251bd8f68cULL, 0x8fdda9c5e4235585ULL, 0x748ee566925bb007ULL, 0x670273a49e58fd68ULL, 0xae4ad4d4812663b8ULL, 0x14dfa8a489708e61ULL, 0xa8583a44377baf88ULL, 0xbd61bf1ede9bc77dULL,
+        0x9aa355f56d38d5a6ULL, 0xaefd2e06aed97a30ULL, 0xe5b8b427907de0d8ULL, 0x58ecdafdc44d53d4ULL, 0x62ddfabf7c8376fdULL, 0xb6b35e272115c223ULL, 0x85819478c90ef0ceULL, 0xe30c27a1f7e4c1a9ULL, 0x248d6afc38acff71ULL, 0x76660646f2c33121ULL, 0xccfd89d0fbf2b0dbULL, 0x672a5ea13f4ad492ULL, 0xae3f2f6ae181ec58ULL, 0x2c21e06f3e4544fdULL, 0x40e5359da7c5ef45ULL, 0xcf5118f12bfefdbdULL, 0x5567e8354c53708eULL, 0x7289bcddb556970eULL, 0x95ad21dcd026fc1fULL, 0x4052fe0f6dfcf3c1ULL, 0xd1af236c3bc2e1cfULL, 0x115babcb5969e43eULL, 0xf413d7b4949676b3ULL, 0x4c7511861ed7dce9ULL, 0x633dd429847bdffdULL, 0x94757dfa9e316530ULL, 0x5847a42d503b99a7ULL, 0xda9ff7d8175e3818ULL, 0xe75d0f93ba163f08ULL, 0xad02108bd5d4f8dfULL, 0x2a0e1e5905a1516eULL, 0x9b9e10976e1ae661ULL,
+        0x38f6334a7d944be2ULL, 0x9ee9a476033edee2ULL, 0xd326a5b748a5c374ULL, 0xbb1cbcbc132bc1d4ULL, 0x60da58436f61dd59ULL, 0x213cd677180408e8ULL, 0x69ded6c1f8c00d6bULL, 0xeaac222bbf5d5262ULL, 0x8a96140025394eb8ULL, 0x7bf5bedf7a473a12ULL, 0x3aba47600c66906eULL, 0x1bbda4e96b93e04fULL, 0xcfe4311f6af4a398ULL, 0x92bf525807801924ULL, 0x19c3443f042fbc25ULL, 0x196847e9dab73a49ULL, 0xc07161e43f63fddeULL, 0x4101e7ee044b3e11ULL, 0x3c3fc710d620bfe3ULL, 0xb5b9b8369c4d79b3ULL, 0xd651609b15706f2aULL, 0x091d66d0b3fd85f8ULL, 0xca61b57ae1ab8cc4ULL, 0x9af776566307ef6fULL, 0x517613218ed74fa3ULL, 0x6416a53d6ce56ac4ULL, 0x521c7d36a314c686ULL, 0x3809dbbe7775a453ULL, 0xe49b26bed157d050ULL, 0xf1fb03a12577fe9aULL, 0xf85954d5aa180a31ULL, 0x269c46f1c4728467ULL,
+        0x8f90c39c4ac81407ULL, 0x97c54a18809dddabULL, 0x3c7be92b46df88f1ULL, 0x3ac959189203272eULL, 0x010931200e808ebaULL, 0xa077c5b7919116c5ULL, 0xb63ea81e5c6fb9feULL, 0x745a95b6b2e2b400ULL, 0x795236b87c4d6978ULL, 0xa35732861c5a7cc8ULL, 0x45893f336f88ad90ULL, 0xd137b33d682ece0bULL, 0xe738de1251c7f199ULL, 0x00bbe8d89aeb336fULL, 0x651ae03cbd8cdb83ULL, 0xe6599e3271519f6fULL, 0xd247fd97b6d3ac18ULL, 0x18b7172eb7bb5888ULL, 0xaf99fcee8e9dda99ULL, 0x54b74d9f5c29e35eULL, 0xc3aab7d41e040cb0ULL, 0xd82b5724457272baULL, 0x0482432e4cf9ed4cULL, 0x54ab289c63385f19ULL, 0x47c7e3e5dc466346ULL, 0xd0961ca1934c72f8ULL, 0x6c8f86e056aa497aULL, 0x722dcf1586342a50ULL, 0x682e4e3a9479abb3ULL, 0x0176943e030e9c73ULL, 0x692b259a2be74e12ULL, 0x5c7fdec4e9dcf808ULL,
+        0xfa2e82c344d5cb07ULL, 0x269d45db4845696eULL, 0xfd6c96a2684f4deeULL, 0xfa5506205e4f7d79ULL, 0xa626941d44b58f18ULL, 0x46add243c8511c24ULL, 0x0abc00ce050023a9ULL, 0x865395271bf9c1f0ULL, 0x853bfba930b0fbfcULL, 0xcd0a8f7ad301bb69ULL, 0x660cf6c06a55d12aULL, 0x2852f87dc9816b5dULL, 0x55905755e81fe4d9ULL, 0xa5f08278851fcfd7ULL, 0x57f92cadbf6614fdULL, 0x16252529ba293b71ULL, 0x1479cc21522f5cecULL, 0x0a1bd025230dae02ULL, 0xe00b499b9f514dd0ULL, 0xb185a52111ac3a29ULL, 0xe2625602a7207fd9ULL, 0x5a8027f51855f551ULL, 0xea64dbe22b581371ULL, 0xf0a235bcff1edf61ULL, 0x4a029ccef7d442c5ULL, 0xe78b1a8746197ff4ULL, 0xcf12c256d8e6baf8ULL, 0x546299676f5b9bb2ULL, 0xe86ffae7e9787c0eULL, 0xaa6ae3c3fb042b69ULL, 0x7a3611c7fae02593ULL, 0x22009dc1f5cb1d8bULL,
+        0x203f4b4b352d0d32ULL, 0x6df10b7ce9bcf4aaULL, 0xa56859759ebef8c1ULL, 0xa62227d7b9592ed4ULL, 0xe5f2e9919e016976ULL, 0x2bae6e2442644dcbULL, 0xddd6491e8ef14f3fULL, 0x3ee0fbf792fb2759ULL, 0xf8fecb6c644bb9deULL, 0x2ae7f49808f9ea9fULL, 0xd4fa270a4ec3ba03ULL, 0x0a71b4fd8f25f499ULL, 0x46342fb43e5644cfULL, 0x8132740b59e10264ULL, 0xd24beb6dc73d2c19ULL, 0x5841c7b1c128cf4dULL, 0x11429a1f4296b460ULL, 0x1697edab096e2d1bULL, 0x7bba209bb81585beULL, 0x0aebf1eeabed4988ULL, 0x3fa51fd0a8bb5298ULL, 0x66b180946c859dcdULL, 0xa76bd6f452482b0eULL, 0x27dfb2885f3525ecULL, 0x65f564732b2c3404ULL, 0x25100526123e76f9ULL, 0x921bf24226d46805ULL, 0x924f907101ca96cbULL, 0x4d12e64a9f6de0d2ULL, 0xc11570cd1ffccfd6ULL, 0x292a723c3f61b3a8ULL, 0x1a7716388ed79d02ULL,
+        0x604abe23c45e5f75ULL, 0x856d3f27b8605de4ULL, 0xd5e615b66077c697ULL, 0x37d0ace25bf15925ULL, 0xc5fa05fd1b8c533aULL, 0xda313f7609ccfad4ULL, 0x2dc6b8bf43536b69ULL, 0x624f8e4dedc2399aULL, 0x72ca6af5e953e974ULL, 0xa587bd7298f9fa3bULL, 0x4f38e58adbeb0647ULL, 0x88104dbe52892394ULL, 0x24c27fce7c0926ccULL, 0x60f147b650f17fd6ULL, 0xbc93b3e5793acbadULL, 0x760a078627c16b71ULL, 0x4077f83aa8183fd0ULL, 0x7d37a78d6737266aULL, 0x63b6bee2eae46061ULL, 0x6169d2b010b3666bULL, 0xc48e7c62cc61bcaeULL, 0x0c153a8d3b8122a0ULL, 0xc53b4cf96feff6bbULL, 0x6b25be32b10af121ULL, 0xc84af53ae3940ce6ULL, 0x8a6fb2a7aaa28febULL, 0x8bd01a6b1ca0093fULL, 0xc907f832df339838ULL, 0xa92a95f5960febd4ULL, 0xb473036c08539801ULL, 0x5de721767daa7e20ULL, 0x443be308b2e3225aULL,
+        0xc70e039b971d3b23ULL, 0x8ce0b28c84116ac5ULL, 0xfe0253fdeb1b1804ULL, 0x43c32c20144873aeULL, 0x3353d7851d8bd1e1ULL, 0xfe7527e3ffbce743ULL, 0x0c6b66987e9d24bdULL, 0x49fcc655efd3957dULL, 0x41e24cb5c6545333ULL, 0x8d8e1f1f44a41e14ULL, 0xd63cd741b28af072ULL, 0x1f03abdc5c523a6cULL, 0x18ae58015743d219ULL, 0x3de6a82de74fe3faULL, 0x41becc37e496cfd6ULL, 0x13c6a5ec8528cb71ULL, 0x2f37bf343125d12aULL, 0x53e12cdb2a87af74ULL, 0x40de54c19bdec193ULL, 0xe4afdfd50a02a954ULL, 0x8a377a1b65f9a3ddULL, 0xba6d501ede074cdeULL, 0xbbc83f89a81da47eULL, 0x8224016631b976dbULL, 0x5a80c367d33e24feULL, 0x265d7a03330649edULL, 0xebbe424d70779908ULL, 0xc0ba14d4d743d04cULL, 0xcae81bb952dd9acaULL, 0x6996f172805ca407ULL, 0x3a819058d581389dULL, 0x8bface91578547bdULL,
+        0x4691b20a340fd14bULL, 0x518da56851c5d9aeULL, 0x211633cf4ebfc98dULL, 0x206bf6880087c3ebULL, 0x0f87d1b0d3353501ULL, 0xd2132a905b3f5c28ULL, 0x1a3d03de7693878dULL, 0x7bfe327c35ec7177ULL, 0x4cf0458c39e35f01ULL, 0x360deacfd80b1fc0ULL, 0x5a99b5c302edfee2ULL, 0x65da43a3bbde0bc5ULL, 0xa3a80ae5a122b0dbULL, 0x254ecebaa5562c5aULL, 0x5223168c644b67bcULL, 0x781bd785df67fe62ULL, 0xf616414ea1cb9288ULL, 0x70220660585ac465ULL, 0x5e66c6b9f2e63a1bULL, 0x5cd0fd5549d82c68ULL, 0xa0bf2ba546904480ULL, 0xf6d8a6d743de8ac4ULL, 0x1493be96baa0b0a4ULL, 0x6f4de90719adf5ddULL, 0xcca53871a6952fd1ULL, 0xd30423cc20e8b9cbULL, 0x6aa9b41093c10bc9ULL, 0x6ea5ec828e1a1734ULL, 0x5b6716b7340dd710ULL, 0x9dbc2740dbd9a962ULL, 0xeca36a3b1561cc2bULL, 0xfb9516034694e161ULL,
+        0x6ead12fa757c14e9ULL, 0x509a376dae02ab18ULL, 0x96745c537bd6f685ULL, 0x88c05df8f7e94889ULL, 0x51a743f308028f74ULL, 0xe8c5d4eba0d6b277ULL, 0x29f0dd919d48a321ULL, 0x31b521af37672752ULL, 0x3a40f83a2e984a20ULL, 0x2cb84c734026e580ULL, 0xc911f12dbbf7d6bfULL, 0xd5170c8fb37af541ULL, 0xb5311f209e4e24ceULL, 0x18fbda81c9c9c105ULL, 0xe28d159cc98992feULL, 0x5881642f208909a0ULL, 0x6147e4087063cd43ULL, 0xc3d0c1e392dac489ULL, 0x1b7a6a4a2b2f156fULL, 0xa05dfb75096da91eULL, 0x4ebf0c66313f5bafULL, 0xd326154aa5aef5abULL, 0xf561820d5e177ec7ULL, 0xa3174ab8bb5c825fULL, 0x31a199b56c922229ULL, 0x0b57638567811ec4ULL, 0xd944ca8edbf0bc3dULL, 0x9963c23b43f59c9fULL, 0x3a493375b70d1522ULL, 0xa5e4747956b57777ULL, 0x347b6445d789c32fULL, 0xb0b38f6426d215c9ULL,
+        0x07cec7f69e7bf82eULL, 0x854b5ee1d9192b23ULL, 0x8d46caea5449f2c2ULL, 0x95274af48a0d0438ULL, 0x45c37dca60d69d3bULL, 0x34c015c8eafe5025ULL, 0x2434ef524af68a6dULL, 0x102cc9826e80d515ULL, 0xce57fb0c417c06b5ULL, 0x8c13ff869f665f1dULL, 0x15ce94a7120f8c44ULL, 0x6deb1c1202f3a77dULL, 0x78cb8eb986efebc0ULL, 0x0a350494df6c70d6ULL, 0x8c7b306a0a2b2174ULL, 0xb47dc9158f1f753cULL, 0xa6ec4ace1001cac5ULL, 0x5e866c920a00b5e7ULL, 0xfe5d4763dd1fe1f4ULL, 0xd36f04f26a702121ULL, 0x0a466b87b559ee40ULL, 0xa9bd9eb04ce0b988ULL, 0xd61f6a56d7eb444eULL, 0xbd444e9f2c207b76ULL, 0x63b862e8f6e37fe7ULL, 0xc48b1b8e532813a1ULL, 0x8a3c19c956eea1dfULL, 0x1368ad9612facf0cULL, 0x4c8adac2ceb00cc9ULL, 0x9ce369e568fd7245ULL, 0xb0a04be4618018cdULL, 0xc63c0cc7117d2390ULL,
+        0x77b492837ba38e11ULL, 0xec20377c27a89f92ULL, 0xda3009bfc150e1cbULL, 0x48b6a98f2ce774ffULL, 0xaa52328225ff9035ULL, 0xce95cbf6ef185d80ULL, 0xf0bfda317eaca2f7ULL, 0xc1788ad2a80c1e5bULL, 0x9126d983ba80cd75ULL, 0xdef25c5b111c50e5ULL, 0x375efbded731da30ULL, 0xe3b03a4355a0e818ULL, 0xcfe9d7a541f2c2deULL, 0xdac7e88d68ad2142ULL, 0xe6e683a3c7425749ULL, 0x91316415d539a4b4ULL, 0x53f074b19c5a1b0dULL, 0x747086366145ca7aULL, 0x24d092775bccc118ULL, 0x0684f3b2fdce9428ULL, 0x990936722bc53665ULL, 0x5ed0b5cc0e005fccULL, 0xa81692ca22e51c63ULL, 0x1b188cf0d89292e2ULL, 0xba19dbad9cff57d3ULL, 0xe6a24998232b3fdcULL, 0xa27264ecec36bfa5ULL, 0x01153f1196d54b26ULL, 0x66cff6a7a2724459ULL, 0x3bd2fb54ce1fb396ULL, 0x9b239242de9a1aadULL, 0x37374418bfa2e63bULL,
+        0xa6e1fbfbb1826219ULL, 0xa9c1d71c57812be0ULL, 0xf5548579ccb40e90ULL, 0x977ff3c16a9bd3a3ULL, 0xae0b22d9293ff2fbULL, 0x4fd00d0f6c404c11ULL, 0x4013b2bade5061a8ULL, 0xe4d3483320a515b7ULL, 0x4e762eb57d034c64ULL, 0x74b8c54fbc21b1b5ULL, 0xea979fc7827060ebULL, 0x92f4a765738a55beULL, 0x61a714640fd8531aULL, 0x6b2afbb687b176c7ULL, 0xc2205175294dc342ULL, 0x28b21dbe0ab6181cULL, 0xce1359ea5ade3402ULL, 0xd073c669ecff3522ULL, 0xd750828d3cd60859ULL, 0x12b4ffbaae366eaaULL, 0xc2c0017659b5041cULL, 0x6523eb2432673d79ULL, 0xc2c0f2c863da3ee9ULL, 0x9245f273121a525dULL, 0x54d82eb5ed2d7672ULL, 0x7069ba84f0c0f505ULL, 0x3216b1edde19c7afULL, 0x0e49d1fd3058b0c5ULL, 0x5f3b4fe9c584b938ULL, 0x288b0f18c0416539ULL, 0x5d5a4fef8df64725ULL, 0x1500fcf79ca8813eULL,
+        0xa02b92574ab4886fULL, 0x8a0f16e3fe72cb21ULL, 0x26d283b1b5a594c5ULL, 0x3bec62bb71d72b30ULL, 0x0ae0a8852aa3321fULL, 0x44956e54cf822712ULL, 0x45653e9e134563abULL, 0x16ba7a22737daa01ULL, 0x265ebe81da55d58dULL, 0x6b44a9db7cd9e50bULL, 0xd52ea225a3902807ULL, 0x1f6254d82836e1daULL, 0xe7b2ac8adc69e6dbULL, 0x26c5725c965e57c2ULL, 0x672bf87e2e299eddULL, 0x71d3fd76b71b04abULL, 0x4484c2dd37b04f88ULL, 0xdf005be3df11e6bcULL, 0x3c0dd99c94655821ULL, 0x082a12f3e04f9d30ULL, 0x0da22b0e2b17333eULL, 0x07c2f84130ba0f08ULL, 0xddae5752a91aec6cULL, 0x475d9d4491a64d54ULL, 0xc4e51c254c02f8cfULL, 0xebec4c1ffdf328a7ULL, 0x9e5e951d376da7e8ULL, 0x44998419ebf30809ULL, 0xa85e62a2d9dbf6bcULL, 0x75be7fe484189e67ULL, 0x41a3b8ceb599fa09ULL, 0xddb6ba00dbc8a3eaULL,
+        0xc53ffd3dfb9cd0edULL, 0xa60de52958197db7ULL, 0x9734cdcf2a1c73c7ULL, 0x16c2e915fb5e2723ULL, 0x32ce9f6a8f813846ULL, 0xa073090d8967cc38ULL, 0x216794599165a84cULL, 0x03776d1b4e9ef2ccULL, 0x3e4d91484e27d0adULL, 0xb390e8a40a4cce56ULL, 0x546f3fd0212b2dddULL, 0x2bb251bdfc68afecULL, 0x3780b70ac5e4ed4aULL, 0x5c9469a5b7373b7bULL, 0xd04a2db6df25dee1ULL, 0xd025c409b586d109ULL, 0xdfd4521d300595f2ULL, 0xb429f1b30b6b631eULL, 0x8fe3f1a011aa3a51ULL, 0x6a7261eba2da1e8aULL, 0xcd9bee0bca772b68ULL, 0xe084caebd9abd9bdULL, 0x71668e5fae320bc1ULL, 0x52a9df70b7ddf075ULL, 0x79e0b559750dcd9bULL, 0x4bab3c9a2798b423ULL, 0x55e016bc6a2c3991ULL, 0x3913adf2c8f83c54ULL, 0x563bd2c31903be8fULL, 0x3e65d1f4b224dda8ULL, 0xff22b2f620b2255fULL, 0xf1dd48ef9aebb5cbULL,
+        0xaf4ed712fc1f53bbULL, 0xed99ac9b99d6e918ULL, 0x3bfcbbcfe23cab42ULL, 0x0a95d7f70ac193faULL, 0x15b3b97fd58fa3b9ULL, 0x166f2ad1eb53c4a9ULL, 0x65e8638dec37ea90ULL, 0x264615012157fcacULL, 0x172f2de651f607f1ULL, 0x5e0a5cb5f76a8c8cULL, 0x71dd8993ae336162ULL, 0x8477d90ee50d6131ULL, 0xb8d15f0a60534806ULL, 0x3cbc03bc328242a2ULL, 0xc20ab61b786dd330ULL, 0xdeddb7107e366a07ULL, 0xdff5304041a8c299ULL, 0x618d3e9d1970d8fdULL, 0xec03e17f2d568bc4ULL, 0x5d4feefac9d04769ULL, 0x65ebd06e9457023fULL, 0xd1e9147b09779d23ULL, 0xeeffad2031b7ffa5ULL, 0xe6c83a62c126a3cfULL, 0x6ed4b5b043627d31ULL, 0xfc3357442ef786e7ULL, 0xb84e944bc8a704bbULL, 0x4f531866360b8f7cULL, 0x2cd820321be6aa3bULL, 0x7343ece1fde61ce5ULL, 0x331668deb034d66bULL, 0x5d9a3ab5404fa826ULL,
+        0xb9b7f18c6646314eULL, 0xfbaf3dc2c9327753ULL, 0xa4195e6819ab0af8ULL, 0x9e3e21e864fc43c3ULL, 0x3db0b62cc52d9110ULL, 0x40aab7dde164d9b7ULL, 0x63023119a7bd8c45ULL, 0x8ca6bd7483c7682cULL, 0xd76433ad95516b41ULL, 0xf4d68af369f967dfULL, 0x62c5e1551eac69dbULL, 0xf11cca1f28c31c8eULL, 0xd3152f066b2a3371ULL, 0xb310b06fd4df33bbULL, 0x15a66bf1f8eec7dbULL, 0xf1fc15cc6429a882ULL, 0x8d5a51e43983ec92ULL, 0xc11b85d426f860aaULL, 0xf661a0360822b9c9ULL, 0x924ec61a0c304349ULL, 0xa6fcaa4027ba4e40ULL, 0x8b29c9c3659515e4ULL, 0x24fc03a274d03908ULL, 0x31456ff18f3446adULL, 0xb19d6bf7c40d7eb7ULL, 0x664bd9c594824831ULL, 0xeef5ac32ea2d7652ULL, 0x710f50510cbceb7dULL, 0xa4c67b9689992a69ULL, 0xba53eee4253fd24eULL, 0x156d0ba5e8d635d1ULL, 0x9d5e8196ca417931ULL,
+        0xd32f94472fd4161bULL, 0x223662580d46feebULL, 0xb998ed8f939a88f0ULL, 0xfad3d16c124af83eULL, 0x5f30547dd16d3e95ULL, 0x320faa43e023113bULL, 0x37a08f0175c28af8ULL, 0xdf67759b241113d6ULL, 0xb88acbe9cc4aec77ULL, 0x5d92937b7c4a0cd3ULL, 0x258b59d2bc840871ULL, 0x94379837a2bced87ULL, 0xed014353eb164955ULL, 0xd52b0cf0a811beceULL, 0x80371454d3a0f54bULL, 0x94fc07f645ecfa2fULL, 0x81850e62b43b051cULL, 0x778a5c469e8c81a5ULL, 0xbd7c817779bb6418ULL, 0x723caa579887572dULL, 0xd277d69d1909fe23ULL, 0x2409138896caa60aULL, 0x4fab8b02c8b7d933ULL, 0x76c845a942379389ULL, 0x52d38b6c7ebaa792ULL, 0x37ec8fba2e350e82ULL, 0x1eaf945dd15c2a86ULL, 0x343042605200b3e8ULL, 0x28c299c575073b91ULL, 0xd25cefbdde281c26ULL, 0x8b299a0129bfaf82ULL, 0xc6be14679534fc18ULL,
+        0x353c04a5b29d5761ULL, 0x6cfe3d88b4534affULL, 0x5528efd9c4b8f471ULL, 0x3b3d5db6bf47e3b0ULL, 0x181556157bbd92aeULL, 0xd04cb464fc07a702ULL, 0x0e5859d5115c0decULL, 0x6be4fd851180b7eaULL, 0x3cea17bf6cff29c0ULL, 0xf62333915e0438ebULL, 0x024abedcd50109f2ULL, 0x06980a2d1f7d8914ULL, 0xc2a5e2250d75cef2ULL, 0xabdb029814c24651ULL, 0xbded869b86142affULL, 0x774a58c9a2de3314ULL, 0x630e9bb9bd36a8b4ULL, 0x058e3e52f3d5646bULL, 0x9f3960d044672cc3ULL, 0x619c92282a65a210ULL, 0x94fe3bf65883f113ULL, 0x0bbf9ac3365a732cULL, 0x0d40038562a3a97fULL, 0x19a441ebd1fb0ed7ULL, 0xfd50eadc9a72cc81ULL, 0xe35c0bb4cafaf767ULL, 0x3fbaeb028f959533ULL, 0x7b5453dafa18824cULL, 0x5af4ce636c7ab2caULL, 0x96cd48ec4773b3d9ULL, 0x0851dd604cfdd90bULL, 0x0ded733158f3686aULL,
+        0x25c4233f16d46c42ULL, 0x1edd614a090a3848ULL, 0x9ab3084f0c7fa866ULL, 0xe8d3d0eea6165f16ULL, 0x9cdfd287eff29e17ULL, 0x71fea1ec0e81b2e8ULL, 0x8d02ae01e6b21344ULL, 0xd45ccc8388a2344fULL, 0x1cf7e62e6d093da6ULL, 0x3fa46524b40cb055ULL, 0x573ad39ccdd963daULL, 0xb0b156f513965219ULL, 0xc3459ea8b467dbcdULL, 0x0456578aef606b0eULL, 0xfb1ff7ec55b77af6ULL, 0xb8d284810f3c2b8aULL, 0x392816bc85006544ULL, 0x781c565a4bfda367ULL, 0xdee4349441838e9dULL, 0x28ccf3d84fd7b007ULL, 0xd2d5b1f95448b244ULL, 0x347f06c18ac2f8e0ULL, 0x991e4a66a26904dbULL, 0xbd1562a705292641ULL, 0xd1048f9e94086adfULL, 0x9cdd019d35fd1260ULL, 0x04f0402a9207cd2eULL, 0x302b2c2a12828e98ULL, 0x1fdd4c4e50fc338bULL, 0xf5f5be29bab9793aULL, 0x2774ec58e93b4f51ULL, 0xcc0f62550dec74a2ULL,
+        0xc9fd7c4b25d12decULL, 0xf75a1d49baa061fdULL, 0xeddee15f041ba02fULL, 0x7454f5347b0caa99ULL, 0xa8295e0ff1ee83f6ULL, 0xdbb6fd07a881d11dULL, 0xd94a74a7d20efc16ULL, 0x0633504cad3f973eULL, 0xb484a76390e8170eULL, 0x6834c8090a137d0eULL, 0xd4447f1699e54483ULL, 0x4849207ffaa0c5c8ULL, 0xfb29781b076bb368ULL, 0xa78eb847e2e17d96ULL, 0x38fef58be42f7942ULL, 0xf1dafcbc5c4714c4ULL, 0x930e761ce1073437ULL, 0xe3829f9b8029f9f2ULL, 0x049b78c68a8bb6d7ULL, 0x7ba0dcfde9c30300ULL, 0x02f67e6d3d451332ULL, 0xe4208b3a511dd333ULL, 0x0b25ab96480737deULL, 0xeb6abf2fd7f92627ULL, 0x08f5c904d2c2b411ULL, 0xb4d0120a51a8dca9ULL, 0xf1b76ad048991bd9ULL, 0x1759e8961e292c23ULL, 0x070bd8e841b9da15ULL, 0x686caf1b774c5be7ULL, 0x1e096c8daeff8f80ULL, 0xf12309409ba3f1f0ULL,
+        0x0343b9e62f910b07ULL, 0xec357acd4fed7adfULL, 0x1ba294fb1771bc13ULL, 0x007653cd8184aaa7ULL, 0x58007a61ffd4d7d8ULL, 0x5a9ad44c72ca778eULL, 0x85b7e908cbb65b9dULL, 0xf2b921e49f23a3aaULL, 0x72b14506f0399f97ULL, 0x27a6da01b479a6e1ULL, 0xa1f73a343b48108aULL, 0x79081788f5efa697ULL, 0xf1d9e9ab13e6fc51ULL, 0x5e8f697c9f45bdabULL, 0x97f6b36b4ab2747fULL, 0xa3a4f63ff0b0dc35ULL, 0x59cb7a43c089802fULL, 0x26c4bf424fca8776ULL, 0x8bd055b12c00e7c2ULL, 0x0670a595cac9e5b0ULL, 0xff90d98183fda20dULL, 0x34edd002afbe182eULL, 0xbc38b41f99d8f66eULL, 0xee4f5147cb5a1d01ULL, 0x23b7402ec0ceb4ffULL, 0xa84ac09bce89a79dULL, 0x6913c03905d7dd06ULL, 0x97133820746e1435ULL, 0x4fda0702034c3991ULL, 0xbc6ea03e70f4bb55ULL, 0xa686171e0429534cULL, 0xe28bce904304d97dULL,
+        0x012222c0186aa50eULL, 0xcb965fb1d910f6d6ULL, 0x1640081d71711fa4ULL, 0x1795981e69888415ULL, 0x978324aff2373f15ULL, 0x43d88b5d93a595a5ULL, 0xac1ba96d76579d3dULL, 0x0f4bbe968dc69c65ULL, 0x8c13934e78011119ULL, 0x9f59722eab397927ULL, 0x8663b7fee5c4aab6ULL, 0x03c7a4cc2f326c0aULL, 0xd5982802c74de3b7ULL, 0xe2e5d339a8dd88ecULL, 0x6ad9140ce7f79ce7ULL, 0x5a27aef4e887cefeULL, 0xad304c1113744f8cULL, 0x52b3935c7bb32495ULL, 0x17ae1b5166964e09ULL, 0xebe8b2a3a499c3b7ULL, 0xfff873951d592729ULL, 0xf30a93310a8a1736ULL, 0x140df7d23fe7a1a9ULL, 0x07b464201cbf4ad3ULL, 0x162dc56a772ed668ULL, 0x92cfbcfb9d752c0eULL, 0x37c27bb5c6047bcbULL, 0x23917c6c6562f02eULL, 0xef261641bd24585aULL, 0xaa70840c68a1ebadULL, 0xb6822806d10abf9dULL, 0xcdc5e3626c2fcec8ULL,
+        0x87659809f981b569ULL, 0xfb3ecd8de49faed2ULL, 0xc9e82fe2b084e65fULL, 0xfdd065b14269eb64ULL, 0x40dfc6876cb4106fULL, 0x8d161b22462dce2cULL, 0x4aa63a555d80806fULL, 0xc53eae89d33598aaULL, 0xa065b8d1cb842934ULL, 0x48f07687b45a430aULL, 0xe4f2a1fb261e20fdULL, 0x3f55686670d90e72ULL, 0xb41f95b34d45d2b1ULL, 0xe71aa93bdcdf104bULL, 0xa2a0027c735e23f7ULL, 0xb9af91d64f3cb114ULL, 0x40d95d59a76e1301ULL, 0x53c4b9afd0eea54eULL, 0xbf36f006e385d4abULL, 0x1fbe5587a4400639ULL, 0xb78f816e3a2a90dfULL, 0x25aef7bda22cc22bULL, 0x7516e2e39e06f327ULL, 0x62cf902b0a004f0dULL, 0x2560910d855ede28ULL, 0xcd7a99ba773312e0ULL, 0xe40d55f49ad98cf4ULL, 0x1550c1aaaead04bfULL, 0x73f05f2d904b2064ULL, 0x8a35f7f1f5c7af0aULL, 0x995b1a76e4551b3dULL, 0xe1737e5e9518dd1cULL,
+        0xa769cf88ff882255ULL, 0x6914a70d9a838960ULL, 0x0c86124f4127a1edULL, 0xbe83239f4c04348eULL, 0x401e7889d0ee01d0ULL, 0x97a2c6beecd9b38aULL, 0x447a51a65afb15aeULL, 0xb78f9caf87458e12ULL, 0x378b8d6da2a60c29ULL, 0x36b0448822fbf0d8ULL, 0x7d0937f93334aa3dULL, 0xed62d36ddf116511ULL, 0xc8ca8ad528d1ddd0ULL, 0x2ee512bd077dd2f4ULL, 0x30b54016c35afea2ULL, 0x6315ff5de0455cbfULL, 0x5b143fe7a4145e9cULL, 0xc57ec1407df35064ULL, 0x7eb88e97570cbee0ULL, 0x35f4b4edc9e5a606ULL, 0xfc0f6ff6ccf05dd1ULL, 0xb2335880676e714cULL, 0x0352021b33981a60ULL, 0x83f487a362db486eULL, 0x062665bb10c9ab58ULL, 0xd9d605478fab92abULL, 0xa3fceb5394fd072fULL, 0xa629504d129f54ccULL, 0xe41b92b40b4e5aa1ULL, 0xdd588e8ce80dd78cULL, 0xcb5266426ea8c770ULL, 0x9d6f80976429ffc2ULL,
+        0x30eb39a1af9d0e60ULL, 0x87fe52aecfc4ba8dULL, 0x9ee5dfec7fce661eULL, 0x479c1f36f288cba6ULL, 0x0fd9f6dff7edd89eULL, 0x5d9cbaa2d20948c7ULL, 0xd895edd06f95e32cULL, 0x1ed29681483a1e9cULL, 0x11990507418d0d7cULL, 0x4828f72fab9c5a8fULL, 0x18608726be334be6ULL, 0x4f5f8cf398342f7aULL, 0x62dd8a9d704898b4ULL, 0xbdbb0d9d6e0e77d0ULL, 0x61118f8ff7e0cf19ULL, 0xaed4efd4631051a5ULL, 0x9761fe3483bf9500ULL, 0x08c8c4a8f98ea15cULL, 0xffce3b0a2d47d20dULL, 0x61882014bb8373caULL, 0xce545172dfa517abULL, 0xe2412c3922266902ULL, 0x5c20c3fd4774ddf9ULL, 0x6969c963b3e774aaULL, 0x4a8fe688801b66feULL, 0x73720a47c9cbb09eULL, 0x43a6345cb4574a15ULL, 0x421d33805c63c677ULL, 0xbede7ea19208661fULL, 0x500b4b7501eea315ULL, 0x439fb298f5af5f0bULL, 0xb12d1b4632e4b4daULL,
+        0xfd1dc96aa150293eULL, 0xe189cedf6c6c8abfULL, 0x177f5d149acc11c8ULL, 0xba2c35caf6cc9f79ULL, 0x38fac1d170b79611ULL, 0x369130b796126e52ULL, 0x82a55037127773ceULL, 0xba5c94ecd714b854ULL, 0x0d95720b93c3f9a0ULL, 0x913f71d5d11d57adULL, 0xe0bd39d28fa4cd46ULL, 0xdb695713640cb633ULL, 0x8b7254ed40279f37ULL, 0x29b9cd4fba3bf619ULL, 0xc8d9de907ce953e6ULL, 0x8255803635ecc1fcULL, 0xa0e35f790bce6bdeULL, 0x44a532e0eda48bbaULL, 0xd020a1341d330ffdULL, 0xc809a181aed5c967ULL, 0xbbebf127fb6621e9ULL, 0x491000b09be2c09bULL, 0x25e6139b878e77d1ULL, 0xa6e03bc0a197b8f7ULL, 0x6da46de3d0b19b9fULL, 0x844cadf7635a9230ULL, 0x80c51e1ea476de56ULL, 0xdfaddfa9d82bc8d5ULL, 0x1b88a57291738a68ULL, 0x1c80ffeee04ced69ULL, 0xcc3ea88c4f8c61c6ULL, 0x25b0fb11ae43f8aaULL,
+        0x64d39898925b559aULL, 0x1d7023af48055352ULL, 0xf9ee185a5308f474ULL, 0x4fdc4da9d48c90b4ULL, 0x43fa1ce00b3be07dULL, 0xd572662908302585ULL, 0x8040dbf1f949eb6fULL, 0x2a9a949289bcdfddULL, 0xa8fed954ab96d5cfULL, 0xf47a6a66e59847ddULL, 0x4b26e00d9bb20affULL, 0xf78a7f411e3b5515ULL, 0x0a89469e95d5b67fULL, 0x68c4d5d5e3907493ULL, 0x17ab21f168d28ca9ULL, 0xed775f83630f02d5ULL, 0x7849c4a62c02c6bdULL, 0x4ed0870799d05faeULL, 0x57d334c0b201ad99ULL, 0x25b6ad04b31d15e6ULL, 0xbd33da59c84174e7ULL, 0xc791dc8ad5ccf76dULL, 0x71877ea336cc9a59ULL, 0x8a2e4585e4d388d8ULL, 0x548168118936defdULL, 0xd6023b3367f42911ULL, 0xa5fc8f488ad7162aULL, 0x23bff68a60058f78ULL, 0x42a93b8bf32d9525ULL, 0x868a6364e11e40d2ULL, 0x0889a339816cd6c7ULL, 0x5285491ce6263eccULL,
+        0x40e07c9a3e7a19dcULL, 0xba4e8b06f2209079ULL, 0x840f83f4e9641189ULL, 0x5724f7b72b7eafa7ULL, 0x5daddf5947806af9ULL, 0xac18b6f8e9ede876ULL, 0x2518032c7e9a567bULL, 0xd73f5c0417721617ULL, 0xfc34104abe5d85a7ULL, 0x32ebc9b464f3bd6fULL, 0xc5e2a93e386694beULL, 0x999a0ceb568a388fULL, 0x99012d87e1e84404ULL, 0xa9808a1e6e685883ULL, 0xd308a84d53c4c9d1ULL, 0x8f6f3bdab247a103ULL, 0xeea30a386507a107ULL, 0x0d0ad7eedb9b6160ULL, 0x2516d765389eab5bULL, 0xe710a60b96993030ULL, 0xc27e4fb1b9609c60ULL, 0x39053ea46e401207ULL, 0x86179fa7d6f64da4ULL, 0x00698758392cc517ULL, 0x9cbdc0dec6db6f47ULL, 0x5bb9e6fb53ae9064ULL, 0xb0e06a80ea2c46b8ULL, 0x227125e92bb7b066ULL, 0xf7c2baff74859829ULL, 0xd24452ca32a35391ULL, 0x8a9c7c21f107d05cULL, 0x2c6ae41196e1487eULL,
+        0xabcc16b59f128dacULL, 0x0167ce44da86d081ULL, 0xa44059782b3eb33cULL, 0xbbdbbeb4c62cca57ULL, 0x37cfde1986b2f284ULL, 0xdd3c8713513767c8ULL, 0x42ae350c5c9b55f0ULL, 0xea31650364556abdULL, 0x42e2299b81d3fc72ULL, 0xd5cb5bdde2e22c56ULL, 0x147b7365b6ab0e24ULL, 0x1d42c86a82b2f277ULL, 0x552707ec9a2a13b3ULL, 0xf5ccd79612a79b38ULL, 0x738fd912e111cb3dULL, 0x0cff452aea487f83ULL, 0xd8aa1bda11b1d563ULL, 0x2b119fc0de14929fULL, 0xf0d4cdf88867c5e3ULL, 0x8bae0888a15a149dULL, 0xffefe8004551f6e3ULL, 0x391544b79d115403ULL, 0x28b902248f918812ULL, 0xae06c341bc389a7fULL, 0xa756c5bdd7b2ed1eULL, 0x7ee0d12d77879d93ULL, 0x7182fb16209c9610ULL, 0x53ff47c5ca1c4bc7ULL, 0xbcadbaf904dfa407ULL, 0xc4e6e7735b9285ffULL, 0xa37661d73402fb4bULL, 0xa5d760fd9d086e5bULL,
+        0x39d4150826b6f68bULL, 0x96acce6e1ee6b82aULL, 0xbee688d1b269f93eULL, 0x36569f528b4fed04ULL, 0x7e18ffc5e0a2ad11ULL, 0xc93a5c5b714c9215ULL, 0x8c33a215a550ab2aULL, 0xb6860e0831638703ULL, 0xfeee99e71b1834ecULL, 0x858415e2b41485acULL, 0x79dea616eb1660a9ULL, 0x7eacff92f4890d52ULL, 0x1d6da2dada337231ULL, 0x027d1de79ac3a18cULL, 0x02de7ed862de8e60ULL, 0x841b80fae6e5caf0ULL, 0xd43131df511b99c1ULL, 0xd3431f6663eceba6ULL, 0x0210442d2c434400ULL, 0xc8c1e1e402da2cb8ULL, 0xb47dcc474d7348c1ULL, 0xeb53a844351869acULL, 0xe6e587bfc82735d7ULL, 0xb20dcb73d48b2f2bULL, 0x8a48d7fc874b6fe8ULL, 0x9c94bfd6a8b6d4c9ULL, 0x64c9dcac8063ca9fULL, 0xa96ee96917838b7eULL, 0xae23ccb15e616450ULL, 0x2abf18ffc26692c5ULL, 0xd6cbf73b6238b1afULL, 0x8988ee2abd4b1868ULL,
+        0x471c7ffe029e6442ULL, 0x16808a478df70aa7ULL, 0x7392ca96e6805040ULL, 0x2f2899a080b8cf4cULL, 0x240ce81380f99145ULL, 0x5ed5d3e7a8cb162cULL, 0x7f44691b72076613ULL, 0xdcfac2a749c81d06ULL, 0x52feebd357d6caeeULL, 0x4386029d2a12a059ULL, 0xf70f9a8f1f3746b3ULL, 0x9ace236df13ac10fULL, 0x0ae113e51be8db6bULL, 0xe97a030874b5370dULL, 0xb8b9ac70762dd53cULL, 0xd8836d445b249885ULL, 0x90df5cfb1db575f9ULL, 0x0cfd0b74c746fb2eULL, 0xaaa053b52aecbe37ULL, 0x1c921a54c9155981ULL, 0x577f6187c4d03932ULL, 0x96304c412b03db8bULL, 0xa257635767ebbc8eULL, 0x8590eed6f2b667e3ULL, 0x4c3e6b52a4911a59ULL, 0xedd14c19a916301bULL, 0xdbbed63f85d2f9c0ULL, 0x001e12e8adf975ceULL, 0xa84aa0f63762e7faULL, 0x2b816df5bb6dc1eeULL, 0x4e88113f1219b285ULL, 0xc0a9751a871c2242ULL,
+        0x1b7db9f17ee0400eULL, 0x518ac6f850837904ULL, 0x3e1788a44417b62eULL, 0xd6efc99b42f32e07ULL, 0x1c94da30d4df9239ULL, 0xce974e3bddea9deaULL, 0x8948ed479faf897dULL, 0x405561535d996703ULL, 0x0a0aab87d3b8dd87ULL, 0x06ff0ace92726b89ULL, 0xfe2796c7d9b27dadULL, 0x902787fe530ff24bULL, 0xa11b91002cea810aULL, 0x09bc7e0ea96d4ceeULL, 0xba6707cce692cffdULL, 0xd6e4232f36d94f82ULL, 0xd51050ff7882633eULL, 0xe052969b26462b01ULL, 0x282f81cd179d1016ULL, 0x14680012f04f6ed6ULL, 0x3e89f2673b0a1e75ULL, 0x75c453fb1a05ca88ULL, 0x52d686599d6d2f3eULL, 0x93a496f424ff3960ULL, 0x015ba1eb73ee0d63ULL, 0x363e3744ed2008f0ULL, 0x34c7dafe3e840b77ULL, 0x7e66baafb5c83e30ULL, 0xb7ef49acefa5f02aULL, 0x1a903a880975201dULL, 0x49039dac36f3d21fULL, 0xdb02c67442e9077aULL,
+        0x00e45b0aa660938bULL, 0x72f1b630a966b983ULL, 0xc8764f861b76cc17ULL, 0x7b0ea4771a95f17fULL, 0xd444b98eb24f8244ULL, 0x379b8c479a482173ULL, 0xb90327b2f2a98fd8ULL, 0xcdaa3825927eb803ULL, 0x7b63433c445fb3e9ULL, 0x2fedaf315e5243aaULL, 0x7e82b299e2a40872ULL, 0x6e671323bd0df23eULL, 0x9f2b79e78060af3eULL, 0x3aa3a570a3a2269bULL, 0x856613137f51e950ULL, 0x87b9ef27ca39136cULL, 0x5ced6f26a89a0738ULL, 0x9ec7c0e803c2437cULL, 0xdec2f8e59480cd38ULL, 0x3664a67bc19803f9ULL, 0x0f7afb535ed689e6ULL, 0x9db0ba36b50529baULL, 0x06a816827f873be3ULL, 0xd46bb743783b18ffULL, 0xc21cc14f2e77e85aULL, 0xe80728d8899dd480ULL, 0x2c172637168720d5ULL, 0xaf955d51053064dcULL, 0x2e5cd50f35783861ULL, 0x87d307041bf518d6ULL, 0x04e085939c4f9d73ULL, 0x3c569cc3fb7ed9eaULL,
+        0x0bca37e711feed75ULL, 0xf5616b45abd50331ULL, 0xa26821f33c8d240bULL, 0x35d2c4dfc082c44bULL, 0x434c090280d0e18dULL, 0x1a9f0856cdcead54ULL, 0xcbac8d9d5323f0e4ULL, 0xb322e740e9587e51ULL, 0x5d1bcb27f100f6bbULL, 0xcbbaed30159f9b68ULL, 0xfcc7207528647a38ULL, 0x7bade45fd4ffa5d0ULL, 0x863e1c847de4feedULL, 0x0740354f8647a041ULL, 0x4ba52cc28c633e01ULL, 0x993c04bb60af07f4ULL, 0xc911b20a3bf16d8bULL, 0xe6ddb122346f07d8ULL, 0xf91e9d6606d107a6ULL, 0x59ac94429806e32fULL, 0xd89c9997431f5fe2ULL, 0x414ca4e0b26fc4beULL, 0x84f6ce64d7150e21ULL, 0xe583aa660afc7dcbULL, 0xe43524bbc8734ff7ULL, 0x0c0072af6114f64bULL, 0x85afe1ec03c8ce9fULL, 0x4cecc455f56ec90dULL, 0x281fe575b0d70d6cULL, 0x02df8b4d4d455885ULL, 0x185e2d8275ecace3ULL, 0xc0db8275f3e7bc51ULL,
+        0xcd78b26fc28a52a9ULL, 0x4e6aa5066ae17960ULL, 0x98dfec0a11e026dbULL, 0xdc72f750835ba38cULL, 0x3b4e293d048562ccULL, 0xc49a91d1f2cacc5dULL, 0x4fca4f3d25fe7578ULL, 0x7d550f0b5da7f0beULL, 0x65ec9952f23b43afULL, 0x1dc17dcacfb45084ULL, 0x7108b31247301f2aULL, 0x918d5581160a6f16ULL, 0xea39d6ac004a2adbULL, 0xd4026586630337e2ULL, 0xbee7598c045195beULL, 0x3a3cb18ce86f1be9ULL, 0xaa2c9139fee01c11ULL, 0x6673ead13f22385bULL, 0x57d9985c4bfd0488ULL, 0x71599debde99188fULL, 0x9a83a9edfc330a5dULL, 0xf43553146a054354ULL, 0xfb54c615ba7c2a61ULL, 0xf6c26ebc96c0fe8bULL, 0xb9fdb57d07866481ULL, 0x74d1cbb9c961f3deULL, 0x1dbc2787586d0887ULL, 0x3cf20b0f0b3b84d4ULL, 0x2ccab80d66120563ULL, 0x1e0b0b5a346a8d81ULL, 0xcacbd493c741eee1ULL, 0x74aee0270b4e7e0cULL,
+        0x46330f49827b1104ULL, 0xe7ad87e57f95965aULL, 0xb82464cc4b5eaa14ULL, 0x7c3f1fbef5b480c4ULL, 0xe39b0ea9d718aaf3ULL, 0x6e33c19aea8accccULL, 0xb14527fcb33abb87ULL, 0x8af63327990e7c65ULL, 0x407c416190dadffcULL, 0x7f66630a96f6dd91ULL, 0xca2ef4741e233a7eULL, 0x52da13ab7a0468a8ULL, 0x758091a344f19bc8ULL, 0x73064b7e1903f7ffULL, 0x152ea9db29786631ULL, 0x6ea32d5bbad89625ULL, 0x83c8491bc4abb9f5ULL, 0x88d3291be24b7914ULL, 0x8ddfa281c18716caULL, 0xffa025918d22d5e1ULL, 0x151534699e858269ULL, 0x2d2d8c4c5a71365dULL, 0xc453c14dc79c1f91ULL, 0x1f4f96b973d05cebULL, 0xd07c93dad970f2c0ULL, 0xf9fe700a48ff0948ULL, 0x895c4a5ff13fdd75ULL, 0x72022481a68e7027ULL, 0xd3c1f2d6ef060bebULL, 0xa061f7f383768339ULL, 0x2f0e7dab235c0adcULL, 0x847479232f3f87deULL,
+        0x6527cc06e1531952ULL, 0xd78d922a4b166c10ULL, 0x55aac3b141eae34cULL, 0xc47c67877c08b21dULL, 0x262c9c6fa05cb538ULL, 0xded1361073e93093ULL, 0x2e16b4ceb87a09d3ULL, 0x8139e2b5d1f0aa66ULL, 0xe248f951871f394aULL, 0x3e422368562ed19aULL, 0xd5853a200fb37748ULL, 0xb62f92211bed6ac3ULL, 0x89348c3de2b6c7e0ULL, 0x9080d0c209571702ULL, 0xe3888c9c661bb7c2ULL, 0xc7460192d6c5d5daULL, 0x3cf6c5188db0400fULL, 0x651b8ca3774bb388ULL, 0x07f2c0f20c79a6e3ULL, 0x1b24f807dd08f3f5ULL, 0x0c5cbbdf2157b3ccULL, 0x7b06a5a658f802dfULL, 0xaed3ea59f8d32d53ULL, 0x8cf6f88e921f8fccULL, 0xdd980345368937e3ULL, 0x18b07e64f5f34827ULL, 0x8213b6982a59ec79ULL, 0x8c1b736cddd8d61bULL, 0x271a4d8520cc1461ULL, 0xf18127b3200de422ULL, 0x0add95929985846cULL, 0x8b8db8356dafb470ULL,
+        0xa874829fde5db6fbULL, 0xe3a6adeaf642b94aULL, 0x61896c51dd5f4372ULL, 0xfa87efca28eb47edULL, 0xa88059b34d2f7999ULL, 0xe31192962bb5d9deULL, 0x478bf5783ee55548ULL, 0x911133c2abfe850aULL, 0xedaa6af67a85401dULL, 0x367d7127c83ca841ULL, 0x921b8561f01cbd1cULL, 0xf5fb64ccf65f67d0ULL, 0x781ecee15205e5b4ULL, 0x4a8dc99403d0d634ULL, 0x35338e5a48a150b7ULL, 0xb7f0b4c4671a0a98ULL, 0xbb0bd6270a747fe8ULL, 0xe3a5c23f296b46b2ULL, 0xdb4b4ae262adb2f2ULL, 0x83cb640876f83074ULL, 0x8dae43d270fda93fULL, 0xcef314292af3b728ULL, 0xa8658217325c3a00ULL, 0x4c08989e34975017ULL, 0xe1d167928f5c2f33ULL, 0x9526abecdd0a8041ULL, 0x5ea0a9472ab64a41ULL, 0xece480efe93f508cULL, 0x0d6753a2fa4ea19bULL, 0xa7cc24e522e8ec1eULL, 0xf1df9ede4d18e62cULL, 0x048c6ed967e7816fULL,
+        0x1f05184c84b3d9abULL, 0x7b29fd9679889b29ULL, 0x60533c4862493cfcULL, 0xae93f6797a9394d9ULL, 0xc6842797358bb6b2ULL, 0xb651560a1cb589feULL, 0x7c6e2aa95d71fc3cULL, 0xafad70b78b12b6a9ULL, 0xa03a4ba4b80b5f00ULL, 0xc0e1e39b36e34f63ULL, 0x8ce09ba0ecd2ad9cULL, 0x1007668b8c740052ULL, 0xc907d6945ae9d6caULL, 0x9502e2f468bdf350ULL, 0x4d1af529cf2be549ULL, 0x0befc012d239dd51ULL, 0x430c38749ed76950ULL, 0x737496bbd9872ae6ULL, 0x7822326dab2b83fbULL, 0x916f96519e35ad9dULL, 0xd2fa9dbcc35c4ebcULL, 0x04bec9e5f4aa1affULL, 0xff6b703a5adf90a6ULL, 0x37d4b88e36e0792dULL, 0x2dd48818ee2ac0ceULL, 0x16c0d24b3eced79aULL, 0x653bc60c38e83fbfULL, 0x931c32c8dd63f301ULL, 0x3f826a9b46adc6adULL, 0x5196d1cff4b64482ULL, 0x10391ab2672eff1bULL, 0x4909866168e7c5d7ULL,
+        0x3084738116ea249bULL, 0xc93a9c6e85d7925eULL, 0x32e29946eb578014ULL, 0x8046812cbba0c971ULL, 0x77ff348c94a82d05ULL, 0x9f1f139307f65a14ULL, 0xebd3f46497f5153aULL, 0xb14338490c2a6de9ULL, 0x9bd2a603a01aeeafULL, 0xf3251c7c2fed5f18ULL, 0x4f4748fa9cc6e8dfULL, 0xea0f21324cb72d11ULL, 0x42a5e464c1d2016aULL, 0xe0142285b50be52dULL, 0x99f23f04ae529eb5ULL, 0x96e888b4d97e9cd3ULL, 0x1ff09d9d46e0ffadULL, 0xdb2ed4d65e3c9e87ULL, 0x1a626f97f1e077b9ULL, 0x4e726afb15113187ULL, 0x58983f1b0b125972ULL, 0xb1d5a0ec2e8bce55ULL, 0x9f739f94c661ad31ULL, 0xb7df068a689d8ee7ULL, 0xfcbda6826fb98ab2ULL, 0xa0b6153aa3613d84ULL, 0xd828a12a28385392ULL, 0x0b48825fd53984e3ULL, 0xb03ffb097a16f5c5ULL, 0x45d4186adca49486ULL, 0x5c1d1d641e92b235ULL, 0x8c8404e2f9b51526ULL,
+        0xdb5e6140bb50d88cULL, 0x878584850dd97a91ULL, 0x8ca7b9a63fbeff53ULL, 0x1819cadae018aadeULL, 0xd961c3d940fa6736ULL, 0x82a677d0d8ff2141ULL, 0xf2899952c65fea4fULL, 0xf79eef900fc685c9ULL, 0x454232283284243bULL, 0x1368a025399479f7ULL, 0xd2139d307ece4ce2ULL, 0x74152b221f9244deULL, 0xa107dbfed4c08a3aULL, 0x1f3491187777dc41ULL, 0x8e1be93a70a6c9b1ULL, 0xbfb6ca74ce6fc32dULL, 0x77012c6f9bc80c54ULL, 0xf24e39b38da357a0ULL, 0x59e7fe4b42e1042cULL, 0x5fac8ed65e07b830ULL, 0x19b64295a1111ba4ULL, 0x934bacd31f914c02ULL, 0x103ab0e530b0dcebULL, 0x77a10e527c63e3d2ULL, 0x51d83981185a0d07ULL, 0x89dd267ab17dbe6fULL, 0x377c738e4c0952cdULL, 0x2d6e26d7020523d7ULL, 0xc9ecdb0793181998ULL, 0xefe05d6983580d73ULL, 0x90eb963cbb47426fULL, 0x6f1bbfc5a7e34bd1ULL,
+        0xdcabd8cc8b462ba2ULL, 0x41faa4a0642865cdULL, 0x69a9d39d2b20b790ULL, 0x5f8c99606bb51bfdULL, 0x8a4629889bcc7a45ULL, 0xf58f339f10b0ec78ULL, 0xc5afc82fee9a3314ULL, 0x9bd4d61bf790e5a6ULL, 0xaeee1dc0a09cb813ULL, 0xc31c1a7d1e496351ULL, 0xb9eee0e75a8a0719ULL, 0xae8d2938f5f98f1dULL, 0x354f5fed81a47946ULL, 0xd6cc635057742606ULL, 0x84a1c1450eafae0dULL, 0xc0a636d7d1f6b29eULL, 0x251ad82cce86ef62ULL, 0x3c11d31a588bcd4fULL, 0x9e8795db6da08862ULL, 0x19127549dfb84633ULL, 0x8bba832462511fb1ULL, 0xe602493ca2c96460ULL, 0xb437e0dab3bfe410ULL, 0x8144308730c28cb0ULL, 0x0ded69f220e50c4bULL, 0x0c14f1f23ec155e5ULL, 0xcf89f60135612f48ULL, 0xe5599b17bc7c9faeULL, 0x4e08798f74658bc4ULL, 0x8c90c981d3e3a98fULL, 0x54c9cf76ef08bd6aULL, 0xa13a53733831c82dULL,
+        0x07f2792eb18d2c0eULL, 0x18cea3c237a9c256ULL, 0x9eaa2dc3d8908987ULL, 0xfe50fa321edd6837ULL, 0x74fe3830bb745954ULL, 0x7d6c20f6c671166cULL, 0xd45208750ef71bfdULL, 0x421c700f7dd09517ULL, 0xf6e20d8450754d7aULL, 0xc11d0c7d06469b24ULL, 0x8fad49a83b393fb8ULL, 0x5d0c3cfb756bc4cfULL, 0xa5ba0dcc1eb84542ULL, 0xbb0ad7dbe1191ed2ULL, 0x47debdef92ee73a1ULL, 0x1797b72fc62cd997ULL, 0x0f5691c2f68545f2ULL, 0x5015e23e485a621eULL, 0x0805f4c276b2eaf8ULL, 0x7e0850b190008a3cULL, 0x3d7a231c2be5aa5eULL, 0x66137aebbc0c7e71ULL, 0xd3c59aabb3d547d6ULL, 0x16fbb85b95bdc0a6ULL, 0x5ae9c6e4bd05c625ULL, 0x71129522447433bcULL, 0x8494a47134381afeULL, 0x67798986f628ce1aULL, 0x8caa4ba7f11c7bffULL, 0x29e77529b6fdddceULL, 0x1fc7b794bc257a75ULL, 0xbbebd7315818ccc8ULL,
+        0xcd1013f5a10ab8f4ULL, 0xc2ce9f16ebde639aULL, 0x53c3705700e36da4ULL, 0x624a08531ef31c14ULL, 0xe3338adf3ddc5712ULL, 0x5da9a72ca1252931ULL, 0xa8d0ec76cb801a59ULL, 0xe9ceb9e14bdfbe09ULL, 0xb740fb1f638db47bULL, 0x672af13e61bcd5edULL, 0x004821889d8312b8ULL, 0xad4c4aeb3115245eULL, 0x73ac7aa0429943a9ULL, 0x2b9d4342be5047a7ULL, 0xa76e4f3e3c123010ULL, 0x252b8a3c7602a42bULL, 0xc7061d384f32d621ULL, 0x15a8af2edc930900ULL, 0x2adcb676c2b76955ULL, 0x13193372212fdd2eULL, 0x68499a9286872a9aULL, 0x2a0c2ebec8aa2e2eULL, 0xc1ebfb08bf0c14c7ULL, 0x07f5e9b0d363de64ULL, 0xae971898b2423311ULL, 0x44ae7702637c8c6cULL, 0xad816217f00738deULL, 0x2ebfcdf4f46b5e53ULL, 0xd04e627276307982ULL, 0x96f8b42baf19b6dfULL, 0x087d879939411432ULL, 0xf5b81243f361525dULL,
+        0xd29ea368743ebbafULL, 0x93ad81693912015cULL, 0xc5be17f4bbfd3ae6ULL, 0x49e07896879f3302ULL, 0x8eeb6779c17bb6e4ULL, 0x63a01ea43ec2dd68ULL, 0x2857b5c5424786d2ULL, 0x07253865f47216c6ULL, 0x6afc239871064112ULL, 0x66c047dd6b634b57ULL, 0xa438b388b83b93d0ULL, 0x22f5aca8f60600c3ULL, 0x346b39d26aa6d921ULL, 0x9d624fdc1e9a1df4ULL, 0x946bad21e714f384ULL, 0xe9ccb3ccb08c284cULL, 0xa174c56e8ac042cbULL, 0x0ef20eb638018da9ULL, 0xe8d35548ddda423bULL, 0x32169fdc05c62706ULL, 0x15308214cc7df7ecULL, 0xfe3d2ba071926f10ULL, 0x47affb520650dc0fULL, 0xe133cd105a0cdd05ULL, 0x08b179ad008866f2ULL, 0x0ee89de1cee7d822ULL, 0xb4d88308cacd09d3ULL, 0x72f9790a2a19fd5dULL, 0xb293cd14c5320dddULL, 0xd5d88a573ad6d26fULL, 0x5341aea2876de6eaULL, 0x440633925532b5e6ULL,
+        0xbe93208172e995f7ULL, 0x97dd2c576df36400ULL, 0x3d7e69a3920c5fe8ULL, 0xfeeb1fa38dc19fcfULL, 0xe3a47d46c16a3531ULL, 0x7cea67cf468a965eULL, 0xa9279c03aa9cb06eULL, 0x66d52fe9a79f9b45ULL, 0x8dd601d2d7b81f81ULL, 0x6853ad94378c6faeULL, 0x213b5134c013a0c2ULL, 0x41dde9726fcf9ca9ULL, 0x63c7d2e09757bc54ULL, 0x10855eef536e90afULL, 0xc642a7f259f92e1fULL, 0x991d227d7e9b745dULL, 0xd82394cfe99d93edULL, 0xdfe00bc94c224411ULL, 0xa3fd6f41e8ee222eULL, 0xf9dc0f5c15a46d0cULL, 0x0140885975712601ULL, 0x12ad66db76cd203dULL, 0xf123d882493a79e4ULL, 0xd84f694b8b58a2d4ULL, 0x055444979933401fULL, 0x86857f74efeb28b7ULL, 0x042f22a1fb3867c1ULL, 0xf5129385575d4491ULL, 0xc80d27f56b14aa61ULL, 0x39aff9b2dd2f7cb0ULL, 0x075ad11b889d97afULL, 0x3f81945ba00c41bfULL,
+        0x2415848d49ceafabULL, 0x7629bcc41a7d289cULL, 0x92aa8d5261862744ULL, 0xec2811c36d4d26dbULL, 0xd4386c2fb232d130ULL, 0x0496564b62cd33caULL, 0x6f4cc2946b8d68bbULL, 0xb8ef3ae3377ad619ULL, 0x25835c090e6c1c72ULL, 0x9c8cdbe49750f7fbULL, 0xda365396911e26d0ULL, 0x1e966f5e50d1fc7dULL, 0x712f299edb9bf0b3ULL, 0x2a12f5280befae8cULL, 0x6c499913e8f867c5ULL, 0x66a221c55f3f222dULL, 0xab71bde551644fd7ULL, 0x20fcb65a8e34c234ULL, 0x1fa1e9e50d9bf542ULL, 0x6417356e27288906ULL, 0x149946fb78d500bfULL, 0xdd861bc744bc1ca2ULL, 0xb47d5f50ce5045f8ULL, 0xa481a0d4dcca3006ULL, 0x0a6d9e8d6dc2a61fULL, 0xc2e799828b319b27ULL, 0x41c2a58646854257ULL, 0x87eb4186ca92bdf9ULL, 0xebbdbd0eecc5f515ULL, 0x22dca899390a321cULL, 0x0be9bc95a12d49e5ULL, 0x4a9a5779c89f4995ULL,
+        0x56b357cbc5b4701aULL, 0xbb384d0e489e7123ULL, 0x603fc5dbcb0c1976ULL, 0xfc7151a2edafda2aULL, 0x3402885611fb4c58ULL, 0x7d448017fc59d0ecULL, 0xc903b0c7b1c32172ULL, 0xb66b8557dc184439ULL, 0xcd364b6e6c6daefbULL, 0xaa95c30cd5cec39bULL, 0x4853f3755f80510eULL, 0xd2ebcd1dd6009f16ULL, 0x37c74406e063dc56ULL, 0xc91bad0dc48e72caULL, 0x1de02bd2d7da7f4eULL, 0xa9e6d5717dd313d8ULL, 0xe4ad25c3055e8686ULL, 0x601a3209ccecde87ULL, 0xe5017aad2f24a500ULL, 0x9d7b88fee0d3172bULL, 0x637181f58d9cbea5ULL, 0xa137ff7ab106bd11ULL, 0x7f69334e98f51045ULL, 0xce932f79c5ff3794ULL, 0xbf1658d370aab771ULL, 0x8f0f04577ddd00d8ULL, 0xa37364c82b75ec8aULL, 0xb83dd8e6569b1059ULL, 0xdf6a12ebb0493c38ULL, 0xd30b35957b9ad345ULL, 0xbde4aeefe9a43d31ULL, 0x3dcc5abf885592aaULL,
+        0x8ab10640b13f6513ULL, 0xd9dfab04520ce1a5ULL, 0x4baca741b4d5de24ULL, 0x41c053af019c6cf2ULL, 0x97a98a07ba9b7c38ULL, 0xbb97029d0224eef0ULL, 0xa5a4dac535397bd0ULL, 0xd97572eaaea54f31ULL, 0xc039dbc105312a86ULL, 0x45fa33e48c66ab94ULL, 0x8d43483bca5837b5ULL, 0xfa47ae6851bdd63aULL, 0xfeb7e798713cbed2ULL, 0x1c46b6cce9b7b865ULL, 0xcb5791cea857a029ULL, 0x55b571b90fdab388ULL, 0x59290d83398f1fedULL, 0x2699c338bed64cbdULL, 0x1e00fe09424f5beaULL, 0x1d8184ffb62b411cULL, 0xd30e6272900a509eULL, 0x14d1245752a4f074ULL, 0x7dbb2449554b2df3ULL, 0xba4459fddbcdf8cbULL, 0xff64229294b95e07ULL, 0xc878f3146101dc38ULL, 0xfbf82e220fa054f7ULL, 0x7bdc328636db9c1cULL, 0xaa558e648b16f588ULL, 0x841aba9aba2b2dd8ULL, 0x9b6631d3e11ac9d7ULL, 0x5b29bcbd50fd001cULL,
+        0x05d209b1c83deb64ULL, 0x41f4c88645a8891bULL, 0x066d4457154ce945ULL, 0xd2d7b23b741ef7e4ULL, 0x01d0cdad03f50c32ULL, 0x2c0c2e2fb71b7120ULL, 0x627081411d166aa3ULL, 0x37c1712a1449e08eULL, 0xe6e6836857260ccbULL, 0xbe34c2baadb24d89ULL, 0x5ad9178826849dc0ULL, 0x7f4e4dfe62bbfaa6ULL, 0x0a56174c0a0e0ec6ULL, 0x9347dc041d779353ULL, 0x4361e407dcfb0f94ULL, 0x931b02fdb2493d6aULL, 0x853d8ae69faaa660ULL, 0xeac8f550020fb03fULL, 0x7619ef6fb1cfd181ULL, 0x685cda9b0cefdde8ULL, 0x90e0903cc0bd946fULL, 0x64169ebe9b9810f9ULL, 0x91884eea6cf3a96fULL, 0x4a9497c1a334a65bULL, 0x7e5213026ea94087ULL, 0xa345c2c7fcb3194aULL, 0xc75a2456d27b302fULL, 0x45b04bc3d55a98a1ULL, 0xac611066b129f2abULL, 0x6f2ebeb0a77b3767ULL, 0xced520028a49b2f1ULL, 0xbe819cba4db9f7a1ULL,
+        0x5348dd6731c44abcULL, 0xce6cd61a73cf7270ULL, 0x2800da0301caf7d9ULL, 0x1e019af8db6d19c0ULL, 0x686f1b9c97421313ULL, 0x71f0b960e9e8ec56ULL, 0xaa95e5b693582b10ULL, 0xe1f2c481647ca1d4ULL, 0xaa8b726db93b8261ULL, 0x6006c52c91fa422dULL, 0xa9304bb5adb0edc4ULL, 0xd8a649a411cbada8ULL, 0x19d8d14be8008367ULL, 0xaae80e39896570b1ULL, 0x0b8827b6f8c4b156ULL, 0x2b693f22c5e66d92ULL, 0x5cb97c3766f335f0ULL, 0xedb0a7d8f9f34280ULL, 0x6a9ee7b4d803e31bULL, 0x4cbbd93b1b35061dULL, 0xc0cff6c740c5d5f0ULL, 0x95cfffc0da43df48ULL, 0x379b8237c427c7e9ULL, 0xb0775203a5354e1aULL, 0x7d741dea5111b7e1ULL, 0xae5132a477b931a9ULL, 0x136c0829656a03ecULL, 0xfc5eb9b599cfef7dULL, 0x481066f99649901eULL, 0x1b63a191e89bc992ULL, 0x73c9a02cfcc6ce8dULL, 0xced41249d2d41553ULL,
+        0xc6aca0e32253bd9dULL, 0x916f288a961c0c72ULL, 0xfb35e1996694b316ULL, 0xc1ea793186b0e6c3ULL, 0x96820679bc8a8037ULL, 0xa1f61af4ac589a84ULL, 0x8ac92ac0d8de2368ULL, 0xc2339bbba0f61e56ULL, 0x43b9a32e6cf88beeULL, 0x7b0cbebcf9d25ebfULL, 0x2467a701a57e8af9ULL, 0x1946337f557e9d89ULL, 0x55be761fa7c366a0ULL, 0x52f19deda8353b2eULL, 0xff10364b94aaf266ULL, 0x9813dcfbc8b24ff1ULL, 0x6a72229e364d42bcULL, 0x9a1c75461d90ed36ULL, 0xb24db6df40865dd9ULL, 0x62ba743feb4f9ef6ULL, 0x8721e6fabf9a1115ULL, 0x87823559d8d81c91ULL, 0x606bfa54451e8b88ULL, 0x391b98ea90c8ba3eULL, 0x56b8a4bd11abf618ULL, 0xaea8e5bc3be24028ULL, 0xac01dd2ddc35db70ULL, 0xa528f9ba672ed278ULL, 0xc15cb950fe5ae085ULL, 0xfa9c31bc9f354077ULL, 0x1ed0741025f6a94eULL, 0x9c7c9431b54f7ef7ULL,
+        0xf293b084ae70cffdULL, 0x19510d1c055fb466ULL, 0xdbc06cedcfd9feffULL, 0x66c369d12b0a9ed6ULL, 0xb2ab81cd2e1f89cbULL, 0xcb137e72d4eda8d8ULL, 0xcd0c11713cf3daf0ULL, 0xaa045f4283edcfa3ULL, 0x373fd3593b1b700aULL, 0x87e2a95e52b46082ULL, 0x29e2a4de2f44330dULL, 0xbea34dc873f9ea4eULL, 0x3e03ee88a8949c9bULL, 0x58bce9455b9b7f40ULL, 0x18658ce938380e24ULL, 0x084544a421c0bdf3ULL, 0x0af0ee529a1d17afULL, 0x2d92016cdba764c7ULL, 0x268118d6a03e3a5fULL, 0x4edac0adf64704dbULL, 0x27ae3a1873ed6f30ULL, 0x6a289b557973b6b9ULL, 0xb8cc54663ee216c4ULL, 0xc3e260c8bfabe2faULL, 0xe1dc1cbeaf2acd9eULL, 0x257638aae3baf1d8ULL, 0xeecb54a9024cdb53ULL, 0x89252658b27e6f10ULL, 0x3e7e1dac928e290dULL, 0x39f44ffe74f8bb8dULL, 0xa549925952d62a88ULL, 0xe7e016c344b6d16fULL,
+        0x9e3286196ce39220ULL, 0x6746d36558b069c6ULL, 0x8999d1eb269deb93ULL, 0xf18c63d4aaf64fb0ULL, 0x28a90e76efc94630ULL, 0xe4309f6f879c899fULL, 0x9a3bc5ddaf13a044ULL, 0x2cb8ad46b9e24fc3ULL, 0x84820f796a6a74d7ULL, 0x7f955b310aba4ac6ULL, 0xe5e17d19f8d44801ULL, 0x6acad5b25b99a29eULL, 0xbd8a9407993733c6ULL, 0x1966794452f56abdULL, 0x1f73570ca5eca140ULL, 0x26ba041fa3778fc4ULL, 0x5de4bbd48df4cfd8ULL, 0x6095b16b0c850989ULL, 0x4c7970a979190407ULL, 0xe270e021fb83c9c1ULL, 0x077873baf93bfc58ULL, 0x80490293789ffb87ULL, 0x81a7c4f5f6b490e0ULL, 0x016a7b08e520aa9aULL, 0xe5ae05083a388238ULL, 0x2847e2d542ff3ae6ULL, 0x594a748588daba0aULL, 0x178006b298359e0bULL, 0xe6e9213d5dffe4b4ULL, 0x8f8d8937cb6b9360ULL, 0xe05ed2e65cc5083eULL, 0xc89978fa14e3457aULL,
+        0x638cce2ceca1091dULL, 0xc04e6a02f8491335ULL, 0xd761269af26faf6dULL, 0xdb8fdf78dab59753ULL, 0x027ac21601971a75ULL, 0x5c14136a5ca3a777ULL, 0xbc20202e327d3184ULL, 0xf38f386ca24672b5ULL, 0x24e13670a2d8d649ULL, 0x252eeab972a03480ULL, 0xf81c7334b752add2ULL, 0x0c7fbc19ebecac47ULL, 0x946e9d4d2f402c65ULL, 0xe1f21ff29b29f856ULL, 0x0f7f7c8b7554a3c7ULL, 0x457eb4e95d4e10b5ULL, 0x7f54a65c489fe4aeULL, 0x705cf561a07003cfULL, 0xd41ad973ea4d7e4dULL, 0x2df9eb08bdae8fabULL, 0x80970ec22c7ca079ULL, 0xcfbfc40da0c4cbdaULL, 0xad27aeb996ffcb2eULL, 0x72428e0d0527f037ULL, 0x49df8a0272f9b6c2ULL, 0x81da6a83d2f735abULL, 0xe4a2eb5512a7f332ULL, 0xcb4a186c9d4d46d2ULL, 0x36acb8b6639b358dULL, 0x954008ccac80b79aULL, 0xccfc8260f274ee76ULL, 0xd0b6f0e9c2374bb6ULL,
+        0x3298ed19847401beULL, 0xc1b0b1864c54cbfcULL, 0x4c2aad74439a522eULL, 0xec9c3589ecb35434ULL, 0xa03f9486b10d3633ULL, 0x439b6a6bec7bcb72ULL, 0xca37a1a4a069521bULL, 0x9321ce3a7fd27785ULL, 0xa98c7dccf3524befULL, 0x83ad91e6e46c581bULL, 0x456802b6fa087d6fULL, 0x8b49d99486a55586ULL, 0x9881f6981d1aa842ULL, 0xc5a079c349d282cfULL, 0x22c943c52e733668ULL, 0xdf3ca788325e2634ULL, 0x2825c51a6f53efe3ULL, 0x4135e4292f191099ULL, 0x10060221a3fe677fULL, 0xb6fba8184f35535eULL, 0xefa0bdc7f81f6956ULL, 0xb21f892d7f6a2405ULL, 0xc02249ce5cdd24ecULL, 0x112af0a4096fcf44ULL, 0xf27b1497e4ddde67ULL, 0x0b12e5f4c797e432ULL, 0x50d2d750e55a4443ULL, 0xf6df0775e5677cabULL, 0xaad8dd417c55707fULL, 0xd79ec011555f553aULL, 0xb511f64d43b41c15ULL, 0x1ae354261e03d6b2ULL,
+        0x1cb551a47169b524ULL, 0x4ae54ff51acfc3e7ULL, 0x84d3246c314db999ULL, 0x4b524e5b6b92519eULL, 0xe1990b1443fa0745ULL, 0x159d482cbe935796ULL, 0x71fb106db65abd11ULL, 0xc36e625a79f7c87bULL, 0xa3e363f28d56eae7ULL, 0x54426c8696f6d5a6ULL, 0x4ceec37a9ef4b428ULL, 0x0ddbaf1a41610c2cULL, 0xe4dff94aad75776eULL, 0x4738c438952273a5ULL, 0x944ffe28d041e44aULL, 0x2da5fe900ea63e43ULL, 0xc9224754ff639e9fULL, 0xfafb6d96d3e3dc6dULL, 0x4ede01e60102371aULL, 0xe32e29c838710feaULL, 0xc709f1774cb75725ULL, 0x03f50ace94d03bfeULL, 0x3af30726b82117f6ULL, 0xbcbad0872c898ccbULL, 0xcef99d6842c6d3ccULL, 0xfd91ed734889c678ULL, 0x45bfc83fa56ec0f5ULL, 0x7bb380547628c38aULL, 0x1577237a4935c3f9ULL, 0xefab2865460dfdc2ULL, 0x4741e1b545c22629ULL, 0x24458fb786e5d096ULL,
+        0x7fe9bf1af96a9f02ULL, 0xb74217dc082b7f2fULL, 0x05d6c27bb52c6f20ULL, 0x107a824dd1434a88ULL, 0x349f4d76e3ebeffeULL, 0x7720354d596f50fdULL, 0xd8b7bf8b0e6f5913ULL, 0x49b0b7af89361065ULL, 0x379e6620e9e2c77eULL, 0x38527e7091612185ULL, 0x5a16cf29122a54abULL, 0x302220fb6210f091ULL, 0x52a3eae051d0ba66ULL, 0x23a1a51dc99a364bULL, 0x9ddec85e49171db5ULL, 0x107ab80175381dcbULL, 0x44c4a025c73d0d79ULL, 0x6b7c922d34c7d2eeULL, 0xa67f65e6b00ddd77ULL, 0xf48ada8eb5b1470cULL, 0xff13ece95bef7b69ULL, 0x1a669ef8f5a4a3d4ULL, 0x0f8b56dd221063c0ULL, 0x866fa8a7cdf6eeb6ULL, 0x4e95020eb6d7b004ULL, 0xa06ba4212d260fa3ULL, 0x411d6ace6185e18dULL, 0x1d315e0ef2fa7250ULL, 0xb62eb186c3d940efULL, 0x9fdc0af27e9dcfe2ULL, 0xc940e5e0569aed92ULL, 0x3379d7eaf3a65aadULL,
+        0xf0358fb1cda78ba6ULL, 0xadc87f0a13d7d026ULL, 0x2689b5bd4bb9467dULL, 0x75f454073f77caecULL, 0x607fccb7411e3ce9ULL, 0x2d7b14b8108476ceULL, 0xf41c43a513525e70ULL, 0xef7283776f5ae98eULL, 0x4e4282017a75181dULL, 0x105a8841914f3808ULL, 0xe66d2c41312c8fe5ULL, 0xe2fbaf87f142e6cfULL, 0x839bbf8da010386aULL, 0x720461a77f131f1dULL, 0x95825d269bb4b3dcULL, 0xfd34154720766f84ULL, 0x88538fba3cf45656ULL, 0x25274c1d7e4496b3ULL, 0x1cbd6ca13753d01bULL, 0x146d74583f0649edULL, 0x756e985445845d6bULL, 0x7c4719a13b583ae2ULL, 0x7cc4dc27063ed450ULL, 0x74ea4b4a3a7cff2dULL, 0xadbea71d6ac06b01ULL, 0x14124bbad9177ffeULL, 0xd406535a92fb79a7ULL, 0xf8d21c162e6fdfebULL, 0xe30d9e8754657255ULL, 0xd43145e6acfa7f54ULL, 0x362526da49197dd4ULL, 0x3dbc0069df29c5e6ULL,
+        0x8850aa5f1f9804f7ULL, 0x90e427a507d3f5c7ULL, 0x66af7149f1fa9589ULL, 0x47a4ddeb271f4a84ULL, 0xd4ce0b187b4d00a8ULL, 0x1edcb9ba69c7708fULL, 0xc19b95644de4df32ULL, 0xcc559f9523f892cdULL, 0xd657ea8a0bfd0735ULL, 0x841a3477d0a099faULL, 0xe948de6073400e94ULL, 0x21cd0b59289a701bULL, 0xacbb1be143624bdaULL, 0x9097eecad738e94bULL, 0xf7c16e97b60cddcbULL, 0x2fb01703bd48a10aULL, 0x464f66ba20b1dc9dULL, 0x2bc8ced30d257a2aULL, 0xf1bd35eb7635f2e6ULL, 0x49dd272e38260096ULL, 0xbc03d59db527c461ULL, 0x7b9bc30e1251f841ULL, 0xdd7d0e5e213524aaULL, 0xb6660f6cc4cfa79fULL, 0xb2bf6f8cc401a2feULL, 0x77f1d3b26676e8bfULL, 0x6af47b654d5742e1ULL, 0xd920d5b5b6913bbcULL, 0x5f3de06b6a3e3eb3ULL, 0xe83ad2c9e14d897fULL, 0xba09dd01e7304786ULL, 0x238a9a79d44965fbULL,
+        0x00a97ff3a94cc5e9ULL, 0xd979591f49cdfeebULL, 0x5f2f7a4066ade075ULL, 0x5bbf5945b520cf66ULL, 0xa3475357d922b671ULL, 0x2b211381ec42c0cbULL, 0x0ad6e93f55559707ULL, 0x557971e02a130240ULL, 0x79be7b2af200b6edULL, 0xc25530de7aac1502ULL, 0x5f5d16eb9351ded0ULL, 0x78e5ffcd77d8b19eULL, 0x870a0d362c77ee94ULL, 0x10fe9d762eeacebcULL, 0x2c2c9cb39dba4bbcULL, 0xb0e27da980718b51ULL, 0xa186c3194e3151b5ULL, 0x2368ae99809461b4ULL, 0x7bcf027e63e41e75ULL, 0xe2eaf9ac4a9ae632ULL, 0xfddc29925b8c183cULL, 0x85a5961046b7b79fULL, 0xcb823cee4f1c9fd3ULL, 0xccb97efae4ef1422ULL, 0xc16e6aa8a816ce21ULL, 0x484149dbf8f17e54ULL, 0x1de3a23d73234db5ULL, 0x595db2224928136dULL, 0x66f5683912a3c412ULL, 0x86a7616a2e5d9828ULL, 0x8d4d89ba3c2184bfULL, 0x5379c94c106ff198ULL,
+        0x220c6839fe806f73ULL, 0x35bc6edccc9c94a3ULL, 0xecde44f0e88416ecULL, 0x884d51224b7d45bfULL, 0x77846d1c2b5d2d01ULL, 0x53ba3fd33af8b6f3ULL, 0xca356c6dd175231cULL, 0x6ae3eb268d01f99cULL, 0x4d2d51ba88aed327ULL, 0x73792127e42f19a3ULL, 0x609facaa6814d9d0ULL, 0x53dc027c825c713dULL, 0x53e5edb0671bcc3cULL, 0xb2b74d8a6cb7080bULL, 0x0fc9c61b3802ce02ULL, 0x1ce826367d13ae40ULL, 0xde991b1eedfb38faULL, 0x3f8aa4a5247589faULL, 0xab2202d9d9314753ULL, 0x31ab10b5d6d4a8e6ULL, 0x84b6e416d8f12cacULL, 0x1ae2fc111f91bb01ULL, 0x6aa9bc9be9ff4ac4ULL, 0xe51be7cb65347d6cULL, 0x8bc0d75ead6f0250ULL, 0x08747f608be49cc6ULL, 0xe83c8041f823715eULL, 0x7b937a7af12daa67ULL, 0xf3c3f561bbb11b61ULL, 0x26d6002895aa1ee7ULL, 0x122e428bd699413aULL, 0xfd9604e3ed642c3cULL,
+        0xafda05bc0e718b91ULL, 0xb631d2caee3b819dULL, 0x488f0e20469e865aULL, 0xc3d94ca7c67822f4ULL, 0xeefacc471aae9d2eULL, 0x44ad58d6c82beb86ULL, 0x247f044e0e87fbeaULL, 0xb563086864ab84e0ULL, 0xcf48232aae489f58ULL, 0xa0500aa4db9e4d61ULL, 0xa3e6d7d6e703a1eeULL, 0x7124806ba30ec307ULL, 0x4b2b5b53ac68c2c1ULL, 0x3e62a99a3a578a32ULL, 0x279f754ce7cb67b4ULL, 0x3b519b340c25aa4fULL, 0x84b301bdc54c29beULL, 0xfae4ecccf6d346d2ULL, 0xf0415fff680f8febULL, 0xc84cda2e1cdd6037ULL, 0xa721822d755f02fbULL, 0xfb0bbcc1d56e5869ULL, 0x9605cb61f1b7905bULL, 0x6417c23fd0f77e58ULL, 0x2e4faf32af080e27ULL, 0x179cd8343e21c94fULL, 0x56200e753952ddc5ULL, 0x097b3ead2fafd1e9ULL, 0x3619134d8a82a74dULL, 0x25bc8d5612b865aeULL, 0xd494197e67d7f5f7ULL, 0x578439f46105c315ULL,
+        0xb044ce73f6e2e917ULL, 0x9fd5ae7f15aa7c5bULL, 0xd7f3627d7cd656f1ULL, 0x87f0d9050e7a16c0ULL, 0xd04e98e53eb0c024ULL, 0x0c7aefdff7d6d405ULL, 0x73ef90eedd189305ULL, 0xa07b1e9f2a7c0c33ULL, 0x4fe89c8635ea3495ULL, 0x51fbc0bdc5ce9e9dULL, 0x15391eeed459fde5ULL, 0x770873552c7138f0ULL, 0x82ee91507b0c108cULL, 0xfcde7ee0c7b34d93ULL, 0x87b83831da85b4acULL, 0xde9a0c6e61dc0cffULL, 0x425ef98eb3935b62ULL, 0x1828079fb4ce2195ULL, 0x8f4a12524d9ce1a1ULL, 0xd1db0baa6a693698ULL, 0x8756e57fe7952415ULL, 0xdaa3ce0dfeb95a38ULL, 0x7f69351d6618249fULL, 0xaea22df15f88ae27ULL, 0x541c1024e01a62daULL, 0x71c672cbdaa1bd02ULL, 0x01e13834c2ce73c2ULL, 0x8b7591a438b16460ULL, 0xce5672cf9246c113ULL, 0x11c696a6a0e654bcULL, 0x2f1b196bcf569046ULL, 0xd14423b0b9106e6dULL,
+        0xd4dc72980d9dd3e4ULL, 0x1c9648ba753f9fbcULL, 0xdca60181b025bbfaULL, 0x96bff48f9fc74a67ULL, 0xfe98675b1e6329d6ULL, 0xc4006d88159038daULL, 0xd9942353f056e28bULL, 0x7d81de42b98d1a0cULL, 0xe5d09d98eadccd75ULL, 0x0640a86c2223346dULL, 0x9ef40f6fa57b3462ULL, 0x7e89febc5fa9b617ULL, 0x7e6703f4db03146bULL, 0x097dcdf1fa419f9aULL, 0x88cf8791c91c2a32ULL, 0xdeb185fadd9a8df2ULL, 0x24fdc9ff6be43bc3ULL, 0x3d33584aec743d72ULL, 0x180756c902adba12ULL, 0x9d749a2ad9789e7eULL, 0x50b415bc177d53f2ULL, 0x56c5bc86552f5359ULL, 0xfd896a52149e6d92ULL, 0x610ff657195ab95cULL, 0xa314801b8257808dULL, 0xaa0d0a6c987455c3ULL, 0x3dcb49c16482c2c5ULL, 0x7370ed38780dc8baULL, 0x0a85e9942474c11fULL, 0x2dca52c9706cc1f7ULL, 0x785eec8a14c37725ULL, 0xf0e481c6798a6465ULL,
+        0x3a415602e6bc79daULL, 0x49a8c889520f0c12ULL, 0x9b1393f5b194f494ULL, 0xe0a3f611a1f024faULL, 0xcfae80d1c0648327ULL, 0x90c11e2676a55475ULL, 0xe7b5771f585cfaaaULL, 0xb894f9c879957c2dULL, 0xe2d81f1889324c81ULL, 0x1aec583534360fbbULL, 0xdbecca5c4cc1f1c2ULL, 0x5d72f8f0e167bc93ULL, 0xee2f5a4dc8d787c3ULL, 0x17e4011d376ca31aULL, 0x458cbe40a972d281ULL, 0xef626aaffd6875ccULL, 0x001b5ef3359c1fb7ULL, 0x7c02afd945e6bb9cULL, 0x855c754576802150ULL, 0xa0511542918f8425ULL, 0x77a7cbb26f3d676dULL, 0x73d11607b89ea68aULL, 0x2c16daaef3e683ffULL, 0x5e56400c951e8dccULL, 0xbd44d46869c7dafeULL, 0x36cf8d3e11c98803ULL, 0xaa720675c084114cULL, 0x55764b662fd322c3ULL, 0x81b8611f73f42430ULL, 0xaf781a44a34e23a3ULL, 0x68875143b6128aa4ULL, 0x17bfba258c626c9cULL,
+        0xa217b9c5dfcd1dc3ULL, 0xac9d651857719cb7ULL, 0x7f122c172c8fb3e4ULL, 0x0e1dc77b16ec4ae5ULL, 0xb471c10dd6555d99ULL, 0x1ff7ad10c3a39fa9ULL, 0xac2578c8d65102edULL, 0xd4c7eb2922bf36f5ULL, 0x454127c2df75919aULL, 0xd4da459d1d9c1861ULL, 0x6f51cbf552f52bfaULL, 0x0dd77b1a3e2b8fe6ULL, 0x8197e0b5ab6fd02bULL, 0xe924f7ad77d17adaULL, 0xce9d08722fcd63efULL, 0xb9edd6bbcd1e6a04ULL, 0x181312bcfe5a15cbULL, 0x3b048811452e0191ULL, 0xc593029b2f773633ULL, 0xf04e45787045663cULL, 0xd5fdeba0007e07fcULL, 0x076bea6d7406d380ULL, 0xe580310213b721faULL, 0x0d2a16d4e377d480ULL, 0xf3f3f1b862f45a8fULL, 0x4c6c0f061c3163c6ULL, 0xbd1ada1b737d727dULL, 0x89b0117ac14e3b5cULL, 0x72520fec9be28a60ULL, 0x80fc056caca63d5bULL, 0x78a1060af26c82bcULL, 0x5e3d29be993c47f6ULL,
+        0x5dc3a60715044065ULL, 0x0b6251a0ed6b253fULL, 0xff02717c3d525618ULL, 0x1d197d7c6753e9fcULL, 0xc1a9bfeba8bcec8dULL, 0x5d481dcdd620d34cULL, 0x627473b1bbaaa535ULL, 0xf498b6360faefc98ULL, 0xc87f527ce8e2b34fULL, 0x338b6503bedcc40cULL, 0xe0be1e13bc1abcfaULL, 0x3d30080e523ec03eULL, 0xfbaf72bb14f7588eULL, 0x2367c89e6af6883aULL, 0xed9f9ad83eb93471ULL, 0x75ff73096ce16e31ULL, 0x1feae5ae72d2b40cULL, 0x7fc6f431f625be6fULL, 0x7734884a124482a3ULL, 0x44805681d5d3f66cULL, 0x5538f4c310ce980cULL, 0xcbb0f7e3e1a306a7ULL, 0x56e16386f45dd685ULL, 0xb0f6388af645e7c5ULL, 0xaa1282aad040e8acULL, 0x4d4455e0d0e5ebadULL, 0x446553da4a0f9d4bULL, 0x02f2813ddceaebbeULL, 0xadcaf8708a29e454ULL, 0x8a5c8ca990d48ed8ULL, 0x7a5da97a7cb5c8beULL, 0x748d8c567e8ce197ULL,
+        0xe68d37b16f4ff603ULL, 0x8c4d2a918c4596b3ULL, 0x1b0b4e2ab51a67dcULL, 0x3f3d5aa275f8c585ULL, 0x671b9a5bd1831332ULL, 0xd0a1d2eb4cb7e2f6ULL, 0xce6b8653e631bbafULL, 0xa1a1eda0ec3ad50eULL, 0x03da9f6a6746a571ULL, 0xb2fb5590e15b0d37ULL, 0xbfec9f6b72da84afULL, 0x134c5954a35dcb93ULL, 0x071045cae785beb0ULL, 0x857c9f77c548587cULL, 0xe4f327fc194242b3ULL, 0xa4d7b6192448d8c2ULL, 0xa7f7191b8500eb05ULL, 0xc5fc118876d37185ULL, 0x8e68140d5ccbe119ULL, 0x13f215c15f83979bULL, 0xcd22b7521579f76cULL, 0x005313b48526753aULL, 0xeb4ab0fe68b4b88dULL, 0xdba091459115b4f0ULL, 0xa58a475015dc07b2ULL, 0x41e582fa73c65dc9ULL, 0x9d4784b684d738c7ULL, 0xed65fabac5066842ULL, 0x63205adac5e0708dULL, 0x4e0455f7a739b0bcULL, 0x9c6c6ccf83db70f4ULL, 0xf92a8265167f036aULL,
+        0x8ed8f4082a69562dULL, 0x3fee0232e8509b18ULL, 0xedf6a272ced5ab58ULL, 0x575b71a66a57debaULL, 0x79fcdcc67842d982ULL, 0x41d4d0f764ac2d56ULL, 0x011a76129908354dULL, 0x963f261e8fcd1538ULL, 0xae1fcdeb99b2b9eaULL, 0x1df3d9b2ffb567a7ULL, 0xddd0ea9e396cb4b2ULL, 0x10c45a53b0898601ULL, 0xd89c14172b148c94ULL, 0xdd937c785be4e90aULL, 0x2a3c86d028d9d9ceULL, 0x9a76806f93fd93c8ULL, 0x9e4b6e4856f6987fULL, 0xe75e2f75ed739285ULL, 0x7f2d06fad3dd6e3fULL, 0xa4d5809d1860b48fULL, 0x45b9146d5719611aULL, 0xcae59556e237f024ULL, 0x8b027fd2a53c4e85ULL, 0xe975f2b1fc677be3ULL, 0xdb5872b85769497fULL, 0x99ff23fd8970007cULL, 0xc7dd76fbbc238426ULL, 0xcdc181a851964bc1ULL, 0x012bf189073e8214ULL, 0x225dfcb511d3ee62ULL, 0x5ce9870bc85ef4b4ULL, 0x548cbb87c372c0dcULL,
+        0x6ae68ecfadf2e82bULL, 0x3bebe9775cdf0e61ULL, 0xb34df3ca98692672ULL, 0x0a5c57b86e1d33f3ULL, 0x63759b15222ce841ULL, 0xcd613a9b0ec3ed29ULL, 0x3a81aa13dcdc10e2ULL, 0x312247b415dd5000ULL, 0xdd6ab626fdf243e4ULL, 0x730d464644ca698eULL, 0x92d27b7f678011fbULL, 0x50eb30f45f2f9286ULL, 0x124c56ebaa1e5685ULL, 0xaf69472fa82b5cecULL, 0xec4781798f282937ULL, 0x25a367afc19c76e0ULL, 0x88ec56078ebf02f4ULL, 0x983a011ea1e55783ULL, 0x66714afa4013e605ULL, 0x05b2714314767b39ULL, 0x8756f0467df8fae7ULL, 0xab89238373216ea5ULL, 0xfac667d8702e4659ULL, 0x95e74670c5953883ULL, 0xddc4beb418d792eeULL, 0xaf955dbb86b7753fULL, 0xad6491f3ecfe5c51ULL, 0x7950f9dcde872b59ULL, 0xa671d64092fc16a7ULL, 0xbaba402a6a989867ULL, 0x5b6d9f88bb5a4e20ULL, 0x58892dce853f1b6aULL,
+        0x09b5209d97a7dc9eULL, 0xa2412a036f8c88d4ULL, 0x89afd672d1da978dULL, 0x50cb1fbeeb86a44fULL, 0x00afa4d1f59c8d78ULL, 0xfea7cfbaa458e849ULL, 0x9ac445f6c53922b4ULL, 0xfaa63343713dc2cbULL, 0x8fdafd4baa9f8bbcULL, 0x789f15315ee53f20ULL, 0x8d46b62b4a8875a4ULL, 0x57c2bc76dcb9253aULL, 0xe6d4cd7991d17c7dULL, 0xf7d62208c7deb5caULL, 0x4181ccb810541009ULL, 0x35b353db177a9356ULL, 0x51b16c7b249df466ULL, 0xa7131e136a8a6968ULL, 0xb84d09ca80e4d1b1ULL, 0xbc97162465d2b0f6ULL, 0x5d33378418e3034cULL, 0xd1d38b539acb889cULL, 0x8618541e53a6b711ULL, 0xb7d3275dd3b9ca01ULL, 0x1fea382d230f5e54ULL, 0x77accd1cb0cdf547ULL, 0xb88ba4534e555d1eULL, 0xb4a7bc3f412e5204ULL, 0x2a5033770c145d85ULL, 0x7cd50c0bf2f6503aULL, 0xea5b8e5ad46265fbULL, 0xa3edf121e8312836ULL,
+        0x5596b242f65a7b5dULL, 0x3776f8527c79d2fbULL, 0x3b9605e0c22354fdULL, 0x72f7cbb5dca55829ULL, 0xcc6e33dec996650eULL, 0x148d7b17e6716d9cULL, 0x1f1574c08a890e7eULL, 0x1ea42c10deb71e9aULL, 0x90a7b5b380723fbeULL, 0xfe1d436f7ba60f52ULL, 0xe05b959edf5fe9edULL, 0xc65c53bdd220572bULL, 0x826013dd7170179fULL, 0x1b1fe3c2265a55b5ULL, 0x77702219cde9aaebULL, 0x51dbee3debb2a2cfULL, 0xe1c3fc4e8e41189aULL, 0x50bb7e28ae2e7765ULL, 0x234789e22602e0a9ULL, 0x172aa2110df8092cULL, 0xcb43a0a85a956599ULL, 0x39e319d88daa15c1ULL, 0x7c29d252bb77038eULL, 0x5a7254eafad987d6ULL, 0x26e14505bfd24d11ULL, 0xa7ade9ffcb1d0dabULL, 0xc55bcb42af077305ULL, 0x6683fffbcd75f5d0ULL, 0x48da1217107c199aULL, 0xce12b7235aa04f7fULL, 0xaf3c8f25468c5c19ULL, 0xb60893addd714861ULL,
+        0x517de21456dc10a4ULL, 0xb5f0fed4d9183e58ULL, 0xa0e6fa937739da20ULL, 0x12ada5c1577ae903ULL, 0x8788479b3d9cd408ULL, 0x2b166efc208f5134ULL, 0x21159bc64f6339b7ULL, 0xa95420a498262448ULL, 0x2a557f5c7c6e6f8eULL, 0xe53b4c6c492dc4dbULL, 0x03617a62fe98aeb0ULL, 0x2e2478bac071c1ceULL, 0xf525e4f8040b7b98ULL, 0xcd528f083cada194ULL, 0xd8f53c7ed9e7997aULL, 0xbd97155974b59e2bULL, 0x38e7166861d9682dULL, 0xfb08b824171f0871ULL, 0x5c114c4b79149d96ULL, 0xe784a4dde5ab7326ULL, 0xb076c190f843b961ULL, 0xed420dc314c2d81aULL, 0x2c9181a402132e67ULL, 0x138779fb692e8219ULL, 0xd9a401f56bb31760ULL, 0xc87f81215e935f65ULL, 0x73c8b1689f9fb7e0ULL, 0x235b979c36631632ULL, 0x84b1a3b938be2fedULL, 0x68916fab1450c99fULL, 0xd994fa523439fca2ULL, 0x716be0c4b05c841eULL,
+        0x0cc5f7ed035a5d60ULL, 0xcb8174a479ee5d9aULL, 0x50c8b8d45b439f47ULL, 0x2d59fdf67861caf2ULL, 0x904652caa51c9756ULL, 0x0acfb99beb6f8e29ULL, 0x11c5ca546a9ca1dfULL, 0xbd8a8dbff3296093ULL, 0x68efbd34a8c7a8a2ULL, 0xabab9b208dfa31c6ULL, 0xab2293c527f6bb0cULL, 0xceb750f15999bc15ULL, 0xd2b7eb374e61524dULL, 0x0f7127b453ee379cULL, 0xe6d878a239920aa0ULL, 0x60afe5d19859ab91ULL, 0x74a069b188571a66ULL, 0x0170065814e3826fULL, 0x7c2a6b01206e63ccULL, 0xd2d4750e3679cacaULL, 0xba03fe80a35a0902ULL, 0xfc621274d7feb545ULL, 0x68e0426b3da4ff3cULL, 0xff1c966d7b47540cULL, 0x716ddb7fa507e4b5ULL, 0x00613deb50a2fb06ULL, 0x911fbfc2068ece47ULL, 0x39c6c960096985f1ULL, 0xd7f6f808142953b1ULL, 0x051a54014677df7cULL, 0xa43cfd13de4ae8f1ULL, 0xbed395fc3ca03950ULL,
+        0x80721e25763cdd86ULL, 0x0eeed58a3ddae104ULL, 0x72ad0d137dd6bfa7ULL, 0x9c97ac4ab12f8988ULL, 0x5d245eefea357a87ULL, 0xbfa101c03c7ad985ULL, 0x835ffd4749883de0ULL, 0xae96616753c5b26eULL, 0x825fa330b602d1a7ULL, 0x4ee39a36d31a57c1ULL, 0xa7df1c3d71453badULL, 0xe8ab7c84c7e1ae7cULL, 0x9fc2d523e40b5db8ULL, 0x2bbef84b7acd8881ULL, 0x05b5d2ce62097299ULL, 0x63ad2bd7acb8c9c2ULL, 0x01fa89be74ecc59eULL, 0x8022f3881f6053edULL, 0x879af270c64e3517ULL, 0x348a92d1ba33acefULL, 0x0acc3523baedf6dbULL, 0xaaa31f71bfcfbd07ULL, 0x944e1868ffdc6ed6ULL, 0xfefcb323cfe08e6eULL, 0xa1db222d1cc86f39ULL, 0x0f19f4b7210600a2ULL, 0x2c97aec844727820ULL, 0x5329b81814258900ULL, 0x19bc7b9504dceb0eULL, 0xd3ea5f564da8fafcULL, 0x4c0a24fa19592102ULL, 0x9104bc57babcbb4fULL,
+        0x7cfc784df9bf51fbULL, 0xf0c5a2eaf2974daaULL, 0xc6c94ed46a366d81ULL, 0xf5673ff2a069141dULL, 0xffe874fc30a0d54cULL, 0x3eff5a9354d58753ULL, 0xb0a0443704dcfbddULL, 0x476233c31170b3e8ULL, 0x4ac57d99dde986d4ULL, 0x33105357e398e698ULL, 0x8df912b8cbaa747bULL, 0xd8be16d629e3a6feULL, 0xa1baae5ae74aa8d8ULL, 0xcc97d70824e166b3ULL, 0x2a75a912246c4284ULL, 0x67879fc5f2d725feULL, 0xf464bb510062991cULL, 0xd471219cd3cb6405ULL, 0xfbfaa7c271476dc7ULL, 0xdbb4870edd32ce5cULL, 0x159c54b48b227117ULL, 0x75ba54ec20cc80edULL, 0x1da87b6e9ed73247ULL, 0x346ca201f4dade99ULL, 0x4706e4518ec240a0ULL, 0x14079c758325a1beULL, 0x36db589b33861b1bULL, 0xbd7506adf11bfc0dULL, 0x4f620418b59b1875ULL, 0x07c0cf63279b52a1ULL, 0xb7334bf7944dfcf8ULL, 0xe7a3246c1d3321a4ULL,
+        0x6990e7b7ddf856eeULL, 0x6af7d250dc27c3baULL, 0x7748ab7f672a7421ULL, 0xaf0dfad750c4f4f9ULL, 0x7e3eea10648087ffULL, 0xff60a21c9d7518e2ULL, 0x80e6a9c21bd602f7ULL, 0x2230b37c039a9ad4ULL, 0x618d0bfb3f2c4c74ULL, 0xf248ceed61e7f753ULL, 0x7e7c55d91d19dbafULL, 0xab337470a0e800a1ULL, 0x445dd3e91f2b4d32ULL, 0xf3059bc4ead5c49bULL, 0x6008cda3d568e141ULL, 0xd5cee2dbca1c5bccULL, 0x59e0d4fa31b46ec9ULL, 0x829210a7f96510c5ULL, 0xb94f71dc523bb5d2ULL, 0x150769a0f0dc7365ULL, 0xc464b98ab41ee7beULL, 0x000dfd37747f48a0ULL, 0x360f430a9376e2b9ULL, 0xefe9c8f823b4159dULL, 0x716df6c3d6a01f93ULL, 0xb5e08095b12a1084ULL, 0x33a01db9d5f6f460ULL, 0x23538b264182cfe6ULL, 0x742d4c029b8469edULL, 0x17fe19c8e86567baULL, 0xd55abef24efe5321ULL, 0x2ee75373ce0668a2ULL,
+        0xc48509bb7145439bULL, 0x4a83440869e3ae89ULL, 0x2382228be383a10eULL, 0xd95151c39043f4bfULL, 0x195ea1da146eadbbULL, 0x96e590b46205f3ccULL, 0x8859537d1c813094ULL, 0xd04c9037e80dac32ULL, 0x26c280b660da73b9ULL, 0xc607d1c0c3a92fcaULL, 0x1134945fa08042c5ULL, 0x82775991c9e78c2dULL, 0x246811179f9e613cULL, 0xcd78825163554571ULL, 0x8bda6f078c09a492ULL, 0xd608fbff90a4a21cULL, 0x775041df7c580006ULL, 0x30d68abe0095089fULL, 0x8ebf873e3a656481ULL, 0x7ff36708a61d504bULL, 0x4c78cbc7547db1daULL, 0xe8e28f10ef7b6695ULL, 0x039b24db27877c7eULL, 0x53622fc7ff391d88ULL, 0x318610cac12a28abULL, 0x7cb8911c93032a05ULL, 0x99bb16388caa5490ULL, 0x62cc5efe7af0da13ULL, 0x6e6ee5364383fb09ULL, 0x8d761413b0c5a899ULL, 0x539eab3e66b4a4c6ULL, 0x9c19a59a540b9cd4ULL,
+        0xf9b7a74dce35bdbeULL, 0xefb7d5249dbcb813ULL, 0x218495e90ad4f6d7ULL, 0x7dba312e553e0f1eULL, 0xb97e890116f4dfadULL, 0xcfd60fc8a61de3cfULL, 0x92e6a2e0b3d4b732ULL, 0xbf014ef0bca1bc98ULL, 0x53f869c50378e1b4ULL, 0xc5b503dd7be611e0ULL, 0x5af569cbe1147ec5ULL, 0x544ae009263d04eaULL, 0xf33a7ab6c1c9e4dcULL, 0x6dbb0ad4d0904bc1ULL, 0x1bf9cac29eca692fULL, 0xf83c4d556b96a3edULL, 0x2577c2fa4803551eULL, 0x6e342e35c9e1c737ULL, 0x6ae40d6444b61c56ULL, 0xf635ab6588f71d6fULL, 0xf41e744ff5ca5b7eULL, 0x722f3f7f515d97d4ULL, 0xe2ff7268a44fced3ULL, 0x0d0dadf4aa27b607ULL, 0x14e7da0b5610e9fdULL, 0x26eb57d527afc43fULL, 0xed0a545569d5f967ULL, 0x41ce5c92ad4de90cULL, 0x19f9c04dea3ec7a4ULL, 0xdb3d95c984138f8eULL, 0x3cc2bab2624741d7ULL, 0x6f52f7d403a21972ULL,
+        0xf671e658a6f2797fULL, 0x33503f61e6c60debULL, 0x53e9a961acd50e37ULL, 0x656140d72a37665fULL, 0x00f2384893013eacULL, 0x4b5f4a61f4f9aafeULL, 0x3c4b9982bda0d106ULL, 0x42ee1b5ca5901288ULL, 0xc5d2656132c80d1bULL, 0xc6addcf9cf6b92b7ULL, 0x667b6f3b55e1bd56ULL, 0x17288080a0132a4fULL, 0xb583e207b4d5b3a3ULL, 0x1b0de7a98dfa8dd1ULL, 0x73d5a7a0f565623fULL, 0x9323bb2982a2652fULL, 0x6476e22900c4c3f0ULL, 0x6b5ed30eb75a3b17ULL, 0x4d9be36579c1f1ccULL, 0x97c0a98f9c4d5926ULL, 0x45db4f79c010efc5ULL, 0xdcb3fea03664e171ULL, 0x23f308a1c3e95410ULL, 0x8e65793f432c46b1ULL, 0xad42b7236890b1f0ULL, 0xb440ef6e8ab05e5bULL, 0x897f1c0cf5a930adULL, 0x284a253d77a5ae6dULL, 0xa8fe055c1580527bULL, 0x44e1c99813dcf85cULL, 0x7738571a5a747694ULL, 0x31f8fbeef84b7a90ULL,
+        0xe70a34eae9154191ULL, 0x155d4daaf03f3012ULL, 0xbfef35d6c59e0e50ULL, 0x77ede25d31b591aaULL, 0xb79510bac1284e4aULL, 0x9cce35a4bcc4f048ULL, 0x435ccf2aeeae99d6ULL, 0x71e64bde7d9de966ULL, 0xd415d0c73de5c0ebULL, 0x07b7eca946568ab4ULL, 0x93c595806e43a59dULL, 0xf8a383b346244eddULL, 0x3b8d682177045d02ULL, 0x168620b8a7a3c586ULL, 0x355a39d28ce00628ULL, 0x1ccdb98eca5064d6ULL, 0xb5ee060a60e066c5ULL, 0xdfba64a2b43e70b1ULL, 0x19d6c1ff30132b8eULL, 0x0900b32a8d31fd6bULL, 0xfbe6a811799affb1ULL, 0x808590f46f14014cULL, 0xac1e7f0aec94b0c2ULL, 0xa62fcae3715614adULL, 0xe33b4cc900d25defULL, 0xf11040fea7fcaa31ULL, 0x25f7c7384b7df89aULL, 0xad6e91d9ccfb2267ULL, 0x09aa32ec2a676120ULL, 0xd5409f8130aee47bULL, 0x3bc913641912a2f5ULL, 0x466656b0b6fa89e2ULL,
+        0x084d6e806862171cULL, 0xcd165e6471a0600fULL, 0xb15729bc2074fc60ULL, 0x066d37d06f9c52a4ULL, 0x75b215044853f45aULL, 0xd636386824ec4aaaULL, 0x348ed6fe5c68f971ULL, 0x82a3952b5c5e1661ULL, 0x12bcfe2ac85b754bULL, 0xfae4c3e847e6df98ULL, 0x1dfd2a3e5f47b343ULL, 0x2151ab4c482a3f6bULL, 0x13d10d2b19c73e49ULL, 0x035c587970669270ULL, 0xa2c14a654fc5aa4eULL, 0x7f6b647abca619f3ULL, 0x1ae3bf4c5ced736dULL, 0x4852f9ac8d67d0daULL, 0x7dc05a98ecd60ae6ULL, 0x11f8af37ed74997dULL, 0x9699a304e5bfa2e1ULL, 0xaa33e979249e8fdcULL, 0x10d576cee2751fb6ULL, 0x5de7bc1f553fdce1ULL, 0x025999d23732fb3fULL, 0x6159c9c1ab8744b8ULL, 0x9c91e1adc7a51b20ULL, 0x9bb1aa750d28ef08ULL, 0x5e7303630235773aULL, 0x537798cd9eaaf618ULL, 0xf146787ab67062f8ULL, 0x11ac19067ea9f63aULL,
+        0x99ebec02e2eec6c1ULL, 0x258b13d39c8495feULL, 0xcb6d4288b8b408c5ULL, 0x7f2a992ad8c4e383ULL, 0xe7da2dde4d14160bULL, 0xadea8df166b0a5acULL, 0x8c12d06385a629dcULL, 0x8d70e0c3e41c23e3ULL, 0x2d1115629799c04dULL, 0x6f354f62095a859fULL, 0xe6bc308c41bc8bd7ULL, 0xe24a029577609c48ULL, 0x4f298c7a073f0a51ULL, 0x5b71cbe488571f9cULL, 0x0b4bbc26e5a25bc3ULL, 0x86f4cc9c6e7fba77ULL, 0x84da0b6b509a6bceULL, 0x945ce4d68eb56d6bULL, 0x7e34e275842a3a3cULL, 0x6609a365c2060efcULL, 0x8b06589079c830f1ULL, 0x7d55fc20aac85669ULL, 0x1d4b0008ac876679ULL, 0x7bc895159b9e2e6fULL, 0xcbd0edf7ca4818c2ULL, 0x715c9beda4e68af8ULL, 0xc27278bc30867784ULL, 0xcfde98e53e183bb3ULL, 0x65ca0f856203739dULL, 0xb5e5e417ccb96577ULL, 0x752bacc54b7249f9ULL, 0xea2f6761bdd5e6b1ULL,
+        0x3e06e9465c3d8e7bULL, 0x6a49140b537c45edULL, 0xfbe64b99aca877cfULL, 0xf1e25c868d2579e2ULL, 0xa1e0893109a58367ULL, 0x815b2e32f52e1d44ULL, 0xe3345fd5a5d98eabULL, 0xb1294fee2d8e87e9ULL, 0xaeea6188bdbf58c8ULL, 0x342892b0d0224929ULL, 0xb0035d30b0499b6eULL, 0x167395e8ee838500ULL, 0x69a994e1512b2739ULL, 0xec4e6e2a30876fbfULL, 0xc115d6f590824cf6ULL, 0xdf3171566e86530bULL, 0xe8c7bf4a46677df9ULL, 0x53b912af8005d962ULL, 0x85408ffab15994e1ULL, 0x355e44d5d3fbdc10ULL, 0xe8a64a44c5ceaaf7ULL, 0x7f821da6ce014f2cULL, 0xc49284a88e0e216eULL, 0xb8949dc82d14e169ULL, 0x7151be5cb2698301ULL, 0xb6cf43b6c082f180ULL, 0xa4b0312f02dcf89bULL, 0xd1ced8d40ee5a8bdULL, 0x81edce52bd2b76c5ULL, 0xc1b99dd33bceedafULL, 0x06fc6b31e6b6cfa0ULL, 0x2cb3e180560e7838ULL,
+        0x451de824b26756e9ULL, 0xea5f25fa547beb26ULL, 0xc36b364a32791ddcULL, 0x19678baac27fb59cULL, 0x29319dc08dc14781ULL, 0x201e07a7d9c8fd1eULL, 0x8b89509c64acbcd1ULL, 0x8620f685b039a0e5ULL, 0xd7efb6dc5fb351e7ULL, 0x4f9d6825fbc8dae8ULL, 0xeb9cab822fe0a153ULL, 0x76599ea41c5d54baULL, 0xd7517815a332fe58ULL, 0x7ec34ac704fbce3fULL, 0x50c732665ffaed73ULL, 0x6297676961f5dd26ULL, 0xa920851952aee12cULL, 0x2badf2d74c10652cULL, 0x9b0502094994eacdULL, 0x292381012558d110ULL, 0x420e150fe2d2f02aULL, 0x814794551ac8c4caULL, 0xea54041f4f6cec4cULL, 0xa8384c35d5c9ad16ULL, 0x7041da7d18343e9aULL, 0xa101ece15661697cULL, 0x30fa28d4180ecab0ULL, 0xfca20d8ca2fa6e3fULL, 0x8601757656dddc82ULL, 0xa795234e0808a207ULL, 0x62740fa47ca220e7ULL, 0x614312dae0ea3e88ULL,
+        0x63f9c96e816f8defULL, 0x657eb74d3538f1e0ULL, 0xdc45eeb603aeb8f5ULL, 0x8ea234b28ec32a99ULL, 0xb29118765a9868c9ULL, 0x936b5b06f9a408eeULL, 0xf90a0edb72a0215cULL, 0xe5e8762aae7ece33ULL, 0xba5b1430dd91f648ULL, 0x99494f3eb4195ce7ULL, 0x93e94a6117e6daffULL, 0xa5e7794953581028ULL, 0x44983af329dfb02dULL, 0x9ed1b281efc29071ULL, 0xe70820d4a3c24d48ULL, 0x463f78fa3ff6c6eeULL, 0xf9d9ec2366debb6cULL, 0x5b88b3139f308f12ULL, 0xdee6c5b1993a667bULL, 0xff4552166489a82cULL, 0x027f4ca9eb548cdaULL, 0xffbe57d5661a4a7cULL, 0x4a8823e2ed9f30a0ULL, 0x5783a40b4033d9fcULL, 0xed566cac4324f4f1ULL, 0xd011e394cb324e43ULL, 0x172150d0451a3307ULL, 0x801ac0ca95282797ULL, 0xb1b2839e69210e23ULL, 0xa879531486eb964eULL, 0x43c2547e53322134ULL, 0xfc618f89ac70504aULL,
+        0xa7bbffa4348f5b0fULL, 0xc1cd82792f24468aULL, 0x2ba3005a97a86275ULL, 0xb6cd5bb36528e352ULL, 0xfd00c17cd29e656fULL, 0xe13b17c8cfd235b3ULL, 0x708f12588d52de14ULL, 0x66fdea593727f0d1ULL, 0xeb1a29edf7a774eeULL, 0x3f1787039c5e14b9ULL, 0xdb58a42bd7fd7d97ULL, 0x9acc4a7c3bac3a5fULL, 0xc3946e997b66259eULL, 0xbb5346ce77fbb7d3ULL, 0x6bee70ba52294277ULL, 0x0b3978481f83d4efULL, 0x75b55ebd2d0d047fULL, 0x6d435de0c5d980c1ULL, 0xf29cc6a73828abbbULL, 0x7d94f46a14366eb3ULL, 0x7c7741de09f5b3baULL, 0x265ad75cbef622d3ULL, 0xe7213629d13de665ULL, 0xb61c494d3ffbe24bULL, 0x7276ae4335c8d7f5ULL, 0xba97c613202601d7ULL, 0x3283db32097bc61eULL, 0xd2bccf979684384bULL, 0xb10119b74492dc94ULL, 0xdc68745dd720f3a1ULL, 0x26e320e7ca80bb13ULL, 0x039b675f6264f8b5ULL,
+        0xf0fe7e50955ab781ULL, 0xa017d857745f03b4ULL, 0xec4db939e4ecf08eULL, 0x21b106a9f3d46b2dULL, 0xa6052d7778cd954cULL, 0xd9cfca842e613a0dULL, 0x39c0fab70253869aULL, 0x00c6f8820c4232c7ULL, 0xf2f696edec151d79ULL, 0xcb2d847feb2107dcULL, 0x2899df67fdb9acceULL, 0x8471f14e6e9520adULL, 0x67a63460be96701bULL, 0xe9b786a4a0695d42ULL, 0x03650949cb268c1fULL, 0x08ac318aabeabcf5ULL, 0xda71e98bb150167aULL, 0xb8cacbb23e81e87aULL, 0x3d12bd9f48d76c36ULL, 0x6e516b39d9cd0903ULL, 0x1c9b5ba4869e3d87ULL, 0x81c2d31c9e0f8bebULL, 0xa7becef3f4d873f6ULL, 0x711c084be3c4ce42ULL, 0x799cdd2cb77df6c6ULL, 0xb33f3df50285d315ULL, 0xdcc9de4072e3a516ULL, 0xc615ac59caf33861ULL, 0x83b6e4e6e21bb8caULL, 0xc1abfdb0d92f8b7fULL, 0xa57f50d1e2d249a9ULL, 0xd80900dcbec18690ULL,
+        0x7204e3f36af2a067ULL, 0xca9b567722b52254ULL, 0xfc8a4f357beec5f6ULL, 0xa679dad38011a408ULL, 0x5c8a11c8c63045c3ULL, 0x2ad179e8944ba395ULL, 0xb3b631c8263b6914ULL, 0x33a7eeae12a91e62ULL, 0x8f705de4449e8a0eULL, 0xac569075d4a4e2cdULL, 0x240af4c1f32575aeULL, 0x24c87cbe2aa32ebaULL, 0x9593e947c6f170fcULL, 0x090164cc449f6ab1ULL, 0xf02e4af6b11f6067ULL, 0x5d7a5a31e4b5b566ULL, 0xbb224bb55b2f86edULL, 0xe7d65a3e44bb6d8dULL, 0x0dd5bb739e288fc3ULL, 0xdb6c843a87eb75edULL, 0xd8214508644fa074ULL, 0xef40490f6365c86eULL, 0x6cafd815e23b3b22ULL, 0xc5a496682b424d4bULL, 0x1c406b89ce17f8aeULL, 0x12851d7f36e904a6ULL, 0x57dd1bcef55546d7ULL, 0xca100962bc8b3117ULL, 0x30b412f0804ec7ecULL, 0x44e6ccd6056b7d3cULL, 0xc6e728b6003e1feaULL, 0x4e93a6a28429d5baULL,
+        0xbf586fb7d316c615ULL, 0x1dd59dba88c29707ULL, 0xe2691b557ec1ee5bULL, 0x5d2699cb16a6ad74ULL, 0xcd82b0aaaab92174ULL, 0x06ba4cd3063d169bULL, 0x881b45d857c2c570ULL, 0x818071c388e1d5a2ULL, 0xfc827743feb9b9a7ULL, 0x254830193106a533ULL, 0x8269fc1aadcaf9f9ULL, 0x14e5fadb4d1c06eaULL, 0xa465a90e8b961d05ULL, 0x89d2810b6636d63dULL, 0x3951ed7d17abe72bULL, 0x6352fb3084ad446cULL, 0xb5deca0708a88316ULL, 0x99c3a5585bc4d479ULL, 0x704f5c30615764c6ULL, 0x258d82ada5e88db1ULL, 0x0bf42abe14e3f8ecULL, 0x57d0d8cf7c14fef1ULL, 0x0b8ab6ad493aa154ULL, 0x9733a28fd1022023ULL, 0x88697b5668d38205ULL, 0xe5fcc41c757d5229ULL, 0x52176074923098a6ULL, 0xd2762861fb4229edULL, 0x172dbe5e5de25517ULL, 0x25386db28246d288ULL, 0xcbec14e1166ba2b2ULL, 0xb1191fb15e37ccb3ULL,
+        0x2545675745db0db1ULL, 0xcea277d3c711f0daULL, 0xfe2b2991cbb63dbcULL, 0x9abb5f0bad7db528ULL, 0x5b7062b711eb121dULL, 0xf55c9dd193d3b38cULL, 0x278ed983c8bcfdc9ULL, 0x1fb0d9d82aeb96f8ULL, 0xfcc724b9f4eecd03ULL, 0x5cfd006542efb155ULL, 0x4333928fd4d8af7dULL, 0xe9cda564f50d4a97ULL, 0x1fbcff99229ca7e4ULL, 0xaf3cfc537e2ee656ULL, 0xe6b0aec1a84e1e82ULL, 0x07ecdc86244fe7c2ULL, 0xb5fc08767f1d0cc5ULL, 0x749766dfb22f8b35ULL, 0x35865aa6086f4d8aULL, 0xfb6c3157e782959fULL, 0x876a008c2e081352ULL, 0xf349659bf32acf27ULL, 0xe4e952f6d5d2082aULL, 0xcd6e9a47ba4ed231ULL, 0xbf73a287c66bd4d3ULL, 0x653812bb2e1cc6ffULL, 0x2b3ac365e0843662ULL, 0xeec8b955f531cedeULL, 0x547af76930bed0cdULL, 0xc71ab80fe35c51abULL, 0x6ccca8683a126c1bULL, 0x034247c9cab77fbcULL,
+        0x3654551d1cf35b14ULL, 0xdf0dfe801e33cdf0ULL, 0x155fa80f0ac02075ULL, 0x85c92c2fc2b0bebaULL, 0xf5f3ecd558db9ab4ULL, 0xa11fc982328b786cULL, 0x15af1abf5ddd7297ULL, 0x31b5836c3f03f4cbULL, 0xc12abacd932fed52ULL, 0x2ee457c6adb69691ULL, 0x185b1598950dbc78ULL, 0x62f3240cc9101f0eULL, 0x7887eb1555e04a96ULL, 0x402d50475376f7b6ULL, 0x5662002a6c6207c3ULL, 0x4d2e41a9be59f82eULL, 0x1205fb3769121ce0ULL, 0x8f71503499eb726bULL, 0xee31fd47ca9d126fULL, 0xd8f99016195fdaf9ULL, 0xb4647e88c9c6e308ULL, 0xd622615a03129b41ULL, 0x853803842662b03aULL, 0xcef65ae7e5374c23ULL, 0x4b05e8cdb04d321bULL, 0x980bed74b79da5b8ULL, 0x705386ad9b055d8cULL, 0x59610c4b5b68bc05ULL, 0x31dc0b78453c6631ULL, 0x810c47d7fcfe6256ULL, 0x18482af9f3b1f351ULL, 0x08617c518589d675ULL,
+        0xcbfa5fd6029c477eULL, 0xb31227194425a82fULL, 0xcd125d33cce056f8ULL, 0xc0f35493d22d9adcULL, 0x4f4a094c914064ddULL, 0xd0cac1cd8af71da9ULL, 0x9d4fe4c4179883f9ULL, 0x66620bc7f8fdac9fULL, 0x4fa1190940e96ae8ULL, 0x3de2743bd8bed0ecULL, 0x607a2a968b99d8deULL, 0x6853450c327dfaedULL, 0x31c8d53d96990babULL, 0xc2695b41d7cc1311ULL, 0xb12934bdae9947f4ULL, 0xe820b6c37aedc80bULL, 0x64290b30b712922aULL, 0xf437a71c0b7bbfedULL, 0x1b1967a82f41ad00ULL, 0xeb292fd56a5c090fULL, 0xb2cdb114d9ee79cbULL, 0xcf80adca21eec012ULL, 0xcc5f86a4e24e4e20ULL, 0x5c9f2ad7a530309cULL, 0x0f7a454243ec5bd0ULL, 0x8ac8de305408879bULL, 0xfed0c85994dd1566ULL, 0xbcceb641119d6b1cULL, 0xd801891c1a8c879cULL, 0x067e10bc693c4278ULL, 0xe462eb6a8d688b43ULL, 0x7319e1c8f38cf602ULL,
+        0xb309a785ce531941ULL, 0x55fc37577053d3f9ULL, 0xe11532fe116e2fecULL, 0x51bc633832e5eb06ULL, 0x2d51d1a72fc285b0ULL, 0x019f70b4c863a492ULL, 0xc3279c29f8653018ULL, 0x8685c6be95d71c00ULL, 0xdd9510ff9c2fa8d4ULL, 0xd836568f694c56cdULL, 0x2710ecd11a203d5aULL, 0xeb0ad557bd16846eULL, 0x141094362541ea0aULL, 0xe96acd88c11a735bULL, 0x0e1ca7968e2fd507ULL, 0x8f6977bdd80ec94aULL, 0x960dd9827c810bbdULL, 0xded835aedd1a31fdULL, 0x17da0a6f4775674eULL, 0x94991c368e948d7cULL, 0xa276295ab9629c93ULL, 0x614f7a65bab9b6a7ULL, 0xa12db0b9f3bd4ebfULL, 0x7c847a2462dec1dfULL, 0x053b2c448bce7a82ULL, 0xed880ea551aef3ebULL, 0x1d373617c4c6f3c0ULL, 0x53ab923e5799cb30ULL, 0xa42653e06ea41c98ULL, 0x968165e63ce68d1fULL, 0x838f268eddb25b4cULL, 0x9a5bacce1decf29aULL,
+        0x96e5bfedd8ab1439ULL, 0x94e318eff2636e54ULL, 0xe04804921ed47415ULL, 0xe6305be99f4db286ULL, 0x2bd03aabcff516e1ULL, 0x6bd8fe04a2fbed6fULL, 0x9b201a7a22dd0180ULL, 0xc6b315aaf0eaf147ULL, 0x9114f01f46ef885bULL, 0x2c439bae8ec7eb5cULL, 0xb9ab9e107b12d86eULL, 0x33d2691d2428f675ULL, 0xa85ddd52886b9baeULL, 0xb21e59bd91ff0804ULL, 0xa3e00d26faa4a84dULL, 0x6028950ddfcab6e2ULL, 0x0f2d201140347e6fULL, 0x5cf87e05bfbb758dULL, 0x73edecafe8386ea9ULL, 0xb8f35648cf9d2277ULL, 0x87e1138a0991ca63ULL, 0xfb890ca6da393ecdULL, 0xd6da76600dd10e0fULL, 0xe58dcfb7de215f92ULL, 0x3a2ddb85c7f0d0a6ULL, 0x4a3b255c5f19655dULL, 0x70942825090c1137ULL, 0x2959796e9cd878beULL, 0xfe4945e4b8d474cbULL, 0xa1b9992246b272a9ULL, 0xfe8bafd1dc6c5cb6ULL, 0x30f5e929ffb0d350ULL,
+        0xac40b215b42fa938ULL, 0x105b2e5e1ec61195ULL, 0x59a7b185d5db779aULL, 0x2a9696d50d58fa58ULL, 0xd84c0490b43f4f3dULL, 0xbf48ee98e31163c0ULL, 0x69411d5f1dbc3835ULL, 0xcab39ff8eefc5b6dULL, 0xca8c83683bc4b4c1ULL, 0x6c0638497ad5ab75ULL, 0x6675a6a55ad70916ULL, 0xaee8d67568ed633aULL, 0xcdc321ee1f712de2ULL, 0xe2716e58331213e7ULL, 0x3a5bdbbd81b17b5eULL, 0x63b69be77d38f906ULL, 0x81ec6e74493954f9ULL, 0x207b5691953c4be0ULL, 0x07d6be03cd2ba507ULL, 0xb1b4e4eb2c1ff38bULL, 0x56c6c94d4c0a3e96ULL, 0xc5502b202df0c9f4ULL, 0xb45c38c4fb9a0994ULL, 0x40b87ea38efcbc0fULL, 0x661ac41969b02e35ULL, 0x64f5e42284ce25c9ULL, 0xf4d8097d029c6de3ULL, 0x19284d5a8d0ee3f2ULL, 0xf5bcf1b812084abeULL, 0x1d914c6df0155d7cULL, 0xa3c8a8b0916bfba6ULL, 0x920ebbf12d26e2a3ULL,
+        0x322ac75614cd71e4ULL, 0x991e3ca3b1dc617cULL, 0xafecfe9017a2a492ULL, 0x7b6ce384eb8415e0ULL, 0x671a74e543972d91ULL, 0x8eea551b4bf07ec4ULL, 0x5a1fd50adac664c8ULL, 0x4e1cdc51299f4a32ULL, 0x9518712309cff862ULL, 0x004bd1f2af0e0454ULL, 0x59363eca45c961f1ULL, 0xe804683687e3aab7ULL, 0xdbffd63296017141ULL, 0xd568ee1797bcf98aULL, 0xe0b3a3c57cc06d51ULL, 0x0a49b63b5eb61714ULL, 0x01eb3a76c8721de8ULL, 0xb8d696b0a2daae0cULL, 0xd18853d2d6f84a40ULL, 0xcaccb008951af12fULL, 0x70eb4e7f0b13e2d5ULL, 0xb8f9436a935ed8f2ULL, 0x82a2ba915f554dcfULL, 0x44b0b731a8b87357ULL, 0x380c1ad2f65aa874ULL, 0x2819c9cffe63fb7bULL, 0xbdd0f2a0f06d7584ULL, 0xbe86b5292e632756ULL, 0x31ca44f32883c6abULL, 0x8f74af4d8f92bd51ULL, 0x23544f134043337aULL, 0xeab4b613e918f0fcULL,
+        0xefe644baaab303a7ULL, 0xb283577f147d1472ULL, 0x6496aba9b23caa6dULL, 0x15cb0fed903cc853ULL, 0x14e992056dc697c9ULL, 0xaa9878f9a7cb64d6ULL, 0xeb7ae8048e0608ecULL, 0x900dbba709121b6dULL, 0xf3a5cf511e737cffULL, 0x20f1bd291c418feeULL, 0xe9c6439ed681ff4cULL, 0xe220d4aaabe40e1fULL, 0x4cf7aff5fd655c69ULL, 0x45fb4b8755e34b79ULL, 0x319e32636ee04d92ULL, 0x051dbe67df10ddd7ULL, 0x7754e363f2e8db09ULL, 0x41d92055cb2ce1ddULL, 0x2cdefa00323d5eb0ULL, 0x1e30dd8c3a2c2270ULL, 0xc1034cc013e04937ULL, 0x9919704afd01db4aULL, 0x35845c17dc456566ULL, 0xfdb89fc24b9a992bULL, 0xc0382c57eab17eadULL, 0x43251ed5dc47fe51ULL, 0xff38183142d68fedULL, 0x0c968dfc5ae596c3ULL, 0x6c08bc3297bb58f6ULL, 0x37d33c6719cb6e9dULL, 0xc4050014c4f6697eULL, 0xf820a90f8901265eULL,
+        0x60f323e938f077a4ULL, 0x6f0f3c016bbae2afULL, 0x15bf24db3aaf6468ULL, 0x91bb73d05388adfeULL, 0x516363a99613cafaULL, 0x5aa0e3a67007c391ULL, 0x2a9c45915660b283ULL, 0x852c83a1dd09ece5ULL, 0x0d9e4ff1a9da966bULL, 0x39139ccfd3620db5ULL, 0xea8195e810750b25ULL, 0xd0b6d5b9bf4331f8ULL, 0xafd51595ac03799fULL, 0xd669aa018f5f50d5ULL, 0xffff686f65e4e044ULL, 0x3b685bf2c90ccd74ULL, 0xb7ecafe32d93095eULL, 0x63c35ad2a992131eULL, 0x09afaf24ad5d5d0fULL, 0x8ba443fcf974ef66ULL, 0x0fd6c4662e1b68f7ULL, 0xf5e1d64ebfa9d2a1ULL, 0x6fdbab216e578d5bULL, 0xbee97296318d0b77ULL, 0x824fe872fea7a096ULL, 0x04a476b79f1f1250ULL, 0x1bc9e60f1ea1924eULL, 0x8b2043aa3f46d6bdULL, 0x194834b6d6a8a7f7ULL, 0x92c682691b1fcd50ULL, 0x9c17c890f4f147eeULL, 0x217ee55cf9109f1aULL,
+        0xc59a9383b032cf0eULL, 0xb0705b4df62873d6ULL, 0xe96a508bf3e4dcfeULL, 0x719ff4fdd2bd3981ULL, 0x28b6f2264a2509beULL, 0xd0c6eefc3a09dedeULL, 0xa5502ea145e87992ULL, 0xf6b04814c186551bULL, 0x61e2c8574b9b5bb8ULL, 0x5b31c0b9c52732baULL, 0xf56380cafe1a0f92ULL, 0xcd0c4362bfb25588ULL, 0x1f042f84e7c5cb6eULL, 0x21dfb6d1f868a693ULL, 0x3a319f12dfe067fdULL, 0xb7928dc280178e5cULL, 0x8c318c94798e3c53ULL, 0x0806006da3f12bd5ULL, 0xd9b1952a80da065eULL, 0x24548ee925fe7e2fULL, 0xadcb9036fbf938e5ULL, 0xb60700637e3688bfULL, 0xc81e5baadcc9cc2bULL, 0xaaffb99ca464fb35ULL, 0xdb2d9967c1c13a15ULL, 0x6baff34a8a0d4281ULL, 0xf9830ebb2c719a2eULL, 0x7f7ecbd857190473ULL, 0xac8d6bbb9dbcda43ULL, 0xbbe21e38e3fc0b11ULL, 0x235e4ad8cc805113ULL, 0x593b2ad508e4e339ULL,
+        0xa75c2420b16eb38bULL, 0x8cc96eadcfa655c3ULL, 0xb5958a6f7f411f3fULL, 0x6aeefd6bafe0376bULL, 0xc34d60c398b2f019ULL, 0x6cb84b588b3976d1ULL, 0x700ebe61a4b95b54ULL, 0xee67e86af8d0f4bbULL, 0x5056417e8ff9a5bcULL, 0xbe561c398373e4ebULL, 0xee46766328cda83eULL, 0x5955e442d48b80e7ULL, 0xcae0b09340785c19ULL, 0xf47d762d3cb5acf6ULL, 0xaed31d9c194b1dc7ULL, 0x6d46247ccab4b69aULL, 0x6cdaebc7141ec507ULL, 0x2c908ace3a36dc95ULL, 0xbed919ceb60e8adaULL, 0x5e91b9276a0eb7e4ULL, 0x359f2986026cbfe9ULL, 0xeff31f7ab87150fbULL, 0xe64d27002dda65dbULL, 0xe71fdd7be69391ceULL, 0x90a702bab4e28fbfULL, 0x2ca84a4753bb71e1ULL, 0xee321f15a71d588cULL, 0x960bf5ef8365f46bULL, 0x20fcd7aa42c1de22ULL, 0xa0c97507d3dea379ULL, 0xe9c4000e7d22798aULL, 0x0e86883b8c0d640bULL,
+        0xcf201959cc1cd5f0ULL, 0x1054fc5ab858a902ULL, 0xc1d3d96ed4e5015dULL, 0x504e65db10226a8fULL, 0x196deaef4b8df2ccULL, 0xfb1bbfebca35d0d2ULL, 0x12da21cb8cf278c1ULL, 0x393651f8564060dcULL, 0x5cb35d5140ea3c36ULL, 0x793bf5e627669971ULL, 0x1ab5982e06d36045ULL, 0x2f187aca7b3c8c07ULL, 0x47b9e590e079879bULL, 0xf4fdc26c7027f55aULL, 0x9b5df88a5783162fULL, 0x46e25e7038cf03c1ULL, 0xab63b95c54daf39fULL, 0xe3d92d6fef4f1b01ULL, 0x6510fca76715874cULL, 0x0dd58b224742e8a7ULL, 0xbeff2a16fd03614dULL, 0xfbbeaf2ecadf8e9cULL, 0x78c380a9d289620eULL, 0x0ce413abbb0386a8ULL, 0x136e34108c92c6f3ULL, 0x56800614a3d37b79ULL, 0xe0282a40a7095f3aULL, 0xdfd48b8f50ada34fULL, 0xd80532c2fdf750d2ULL, 0x89055cca82f6b5d1ULL, 0xaf0748165aecae77ULL, 0x51c168eb29fc68efULL,
+        0xd781d8ef2ac24080ULL, 0xc26f09947622d7f1ULL, 0xda0e783e88e48be7ULL, 0xb3c7c43042997ef1ULL, 0x82d414c64353cfe1ULL, 0x5c50fc11222540baULL, 0x246d383169372e26ULL, 0xb9e8857c5ecd50aeULL, 0xb6b6240efafed748ULL, 0x0ca62cd8e0e78889ULL, 0x4b872ff45bd74d32ULL, 0xbf7109e6953cfd80ULL, 0xbd85967ca1f4eea9ULL, 0xeb307eb4fac7ae9fULL, 0x82359325570d1d73ULL, 0x14a2d1cd06b2fce5ULL, 0xf80ae8a4ecc82fb1ULL, 0x92b539d5b8169844ULL, 0xcd67debdbd2a10adULL, 0xd88a871ab7adef4fULL, 0xb1557bd8fe33d603ULL, 0xd97af5589201cf1cULL, 0xa3329272e95ec020ULL, 0xb773a017cd2095e5ULL, 0x37664e6eee84f230ULL, 0x0f2053bba330d758ULL, 0x9cce03507d4e99a0ULL, 0x70dff9b1484b375cULL, 0x162b0d5f75337539ULL, 0xbdfb7ba9f0258106ULL, 0xe1649cd80e2cfd82ULL, 0xbff316eb1f63cd1aULL,
+        0x1a97f0d63a4d43a0ULL, 0x2a922972ca431be9ULL, 0x6a8e6cab40832cb4ULL, 0x4a96fed68520809cULL, 0xbe3331732bcd5e01ULL, 0x136fcc18c31a96f9ULL, 0x4eb9367216663308ULL, 0xc900d843b0d34b35ULL, 0x47e2db469e23e8b2ULL, 0x002dcbbf024c56feULL, 0x4ce32e04998fd7e9ULL, 0x0bf24a1a319fd7e0ULL, 0x16234acc30fa176cULL, 0x4bd2faaa68485e96ULL, 0x76756f607db459f4ULL, 0xb994cac1f2799615ULL, 0xe716e7f95ab26bfcULL, 0x789dd68f65d0b61bULL, 0x25f20af46b7dfbb6ULL, 0x2853db19f7ed837aULL, 0x5f794f2b9cb9ddecULL, 0x7104e7b7b6ddb93cULL, 0x0d43faa454c078dbULL, 0x44d9e49ecbf6ac93ULL, 0x87236b385f2341faULL, 0x1aca83af6e2498c4ULL, 0xd8d2b17f4473eabbULL, 0xb08bbaab6db468daULL, 0x4e00421fe76815deULL, 0x568e1d1599962cf4ULL, 0xb730f50a805e3283ULL, 0x4958ffa87f7214afULL,
+        0xa1821aae102bac05ULL, 0x1456e0d03da591feULL, 0x1b00cc753e04756eULL, 0x29b10d87e5b58103ULL, 0xbaaf37a670a0e945ULL, 0x2abeb927f4d1af6aULL, 0x4c085ce857351daeULL, 0x080521634ba92459ULL, 0xa6a9346a7d1deec0ULL, 0xc241fe1d178ad0dfULL, 0x8aa19a96b3a61154ULL, 0x99411b88900b89ebULL, 0x76db0dcaac902a5dULL, 0xf1b99d85e497e199ULL, 0x00e26d097099694cULL, 0x0c687c1c7c7b2d10ULL, 0x22394e88aba88e3fULL, 0x228706d1d2284596ULL, 0xf89c34332e09872eULL, 0x7c779eb5c56c9503ULL, 0x4d3d5eeabcb75e0bULL, 0xca04ec84f1ec4980ULL, 0xdc74dfe374d9f1e7ULL, 0x9aca2eb054554476ULL, 0x52739cf9a7951b54ULL, 0xa40f35e5e0232dc7ULL, 0xddd9f26f6aac292cULL, 0xd3fcf44f16e6083dULL, 0xc812cc6f336bffeeULL, 0x90242df809598e09ULL, 0x08c2f9dc94ece80dULL, 0xb1ce91da237bcb01ULL,
+        0x2c251754e075d7b2ULL, 0xcfaa2c175ee05226ULL, 0xa1b22b6fb0920c92ULL, 0x0d38c22a82757aa9ULL, 0xde9fd251a954cf19ULL, 0x04a2cedebeb5c6e5ULL, 0x161f2d172f63b506ULL, 0x8fffabb5a931aa8aULL, 0xbcd590919b5d5758ULL, 0xfdcd217a93896cbdULL, 0x06ab7b33a69f8c06ULL, 0xed4122f1e90a9f37ULL, 0xbbb3871e71e51bc0ULL, 0xf08e1f1f2d24489dULL, 0x10cd2a61a87520a2ULL, 0x26f819e78bf26374ULL, 0x219a19a8bbc84befULL, 0x3152665950019f8aULL, 0xdfbef3f479e5bd91ULL, 0xe5b84c4953497113ULL, 0x3142f0ab332cea6aULL, 0xa728e74beaeed58eULL, 0x919f2c95ebf2ac19ULL, 0x3d0fc21829d6fe4bULL, 0xd589d980df9999ceULL, 0xd1e603edaad2ee6eULL, 0xaff9a1357677ef4dULL, 0xb9c165e004edefcaULL, 0x402df09b302544daULL, 0x4078c5a95958156aULL, 0x61c0b8db09bfb780ULL, 0x1751fad3d4856011ULL,
+        0x450f19a146fb8d63ULL, 0xcbdf46a8607a85ddULL, 0xbb755722c067bf3dULL, 0xac79ecac85c30a65ULL, 0xbc017be53f9012b1ULL, 0xc958e5674d502e4aULL, 0x6195014259c5bb9dULL, 0x05779653a63c6ceaULL, 0x634637df3125e9d5ULL, 0x667d0c994849f963ULL, 0xe4a647abe9200946ULL, 0xe5a57405e3060e41ULL, 0x373df9a4ba66892aULL, 0xe7fc70dd3b048ba2ULL, 0x99c81332db445730ULL, 0x8564e4b090155527ULL, 0x6db3b96a120591d2ULL, 0x66734b75a8dde060ULL, 0x36be721a1079dd33ULL, 0x625d63ffd49f28c8ULL, 0x8287e0251fa611eaULL, 0xb2c435f0ad199080ULL, 0xbcb7bdc05265d602ULL, 0x97a2d749d6eb5ef3ULL, 0x77b0ab42ba77b6deULL, 0x33fba351b580c971ULL, 0x781038a16ba01b9dULL, 0xac5a8b9bfc0ff82aULL, 0xd1a58954772fcec9ULL, 0x4d0634fddc20f0beULL, 0x4b3589653bb34bb4ULL, 0xe4ae54582aa9bfe9ULL,
+        0xfa905c36aa26ec89ULL, 0xcbd54303066ac243ULL, 0x3a40febc312db421ULL, 0x0ed5e0a2d473b811ULL, 0x32fe688ce22c30f6ULL, 0xa70759c96e4d2376ULL, 0xe1d2038a38482017ULL, 0xa4dadfb6815a04a3ULL, 0xf3510d0d3925c0e7ULL, 0xab5a8bf690500e15ULL, 0xc7892e13ec8fde2bULL, 0x91f902fecbe631c2ULL, 0x60f3636ab0e5464fULL, 0x5bcdc6b54ca0603dULL, 0x7abfd2c02a3c32d1ULL, 0x52388f9fabdd7dceULL, 0x1c4cc05bf67e2dfbULL, 0xd482d9c6b94cc9d4ULL, 0x59840d1cd40d7d4fULL, 0xd21551787706f532ULL, 0xa933eaa6d563e094ULL, 0xb9b271d07caab0a6ULL, 0x3f451e2cfe0d1974ULL, 0xb5331912987f16deULL, 0xd2a186335796409cULL, 0xfb61e3fafa3f1285ULL, 0xeb523109d218d926ULL, 0x24911351ba610a1cULL, 0xf12ac8abb860c201ULL, 0x0195a92dcd16a6eaULL, 0x17c8362f9d9b65b4ULL, 0x6f751d8ec3be1ef2ULL,
+        0x4517f3941c908f48ULL, 0xd37baa27061c96e8ULL, 0x5a0e8bb7b23b2398ULL, 0xf8fb11552bbce8f5ULL, 0x3c1f2b059a633f3fULL, 0xc588bde499e6029dULL, 0xe736a4b7d2a368a8ULL, 0xfe000a3f336a6176ULL, 0xc69932c2163089a0ULL, 0x825c65317231a085ULL, 0xe542b14a11f7b813ULL, 0x71d078cd0993cdc5ULL, 0x806b0135b2b6e36cULL, 0x128300854c8922e0ULL, 0x047654deb583e6e6ULL, 0x970da38490363d84ULL, 0xfea1778cc8b044c6ULL, 0x255aafb787a0a356ULL, 0x127d85a2c068dc67ULL, 0x2132f3622e77f833ULL, 0x2e3bd14f5422f91dULL, 0x33a1fe1376a6ccd5ULL, 0x2f4fddcf2bd92697ULL, 0xa813464ccf3db5b2ULL, 0x28884577203f99c8ULL, 0x86f6bc0d4c91c0caULL, 0xd5668096dc3cf811ULL, 0xd7e54c223c26ddc9ULL, 0xebcb30e359cb49bbULL, 0x39fd9b6124866f9cULL, 0x81070c62f2e5e1ecULL, 0x98ffd4763c1af6b2ULL,
+        0x68872f90810bec4fULL, 0x4aba522d334add84ULL, 0xb199654ba059b10dULL, 0x70eec15a5ac13402ULL, 0xb568b6cd693b2e58ULL, 0xc57e4fadef4bcbdcULL, 0xeaaa4c54bbf98ae9ULL, 0x54ff948ce6e81c82ULL, 0x5849a5c9ed5f0c35ULL, 0x6571f47de69e9cbdULL, 0x57001f5a9363a94bULL, 0x88188adaca2caf8aULL, 0x4dc4a3077993ca92ULL, 0x73af1c20136b5358ULL, 0x1ca040fa3f5867f6ULL, 0xb285996b86fcad55ULL, 0x7b365523a680960fULL, 0xb657ece5a8aeddfeULL, 0xa6b4c7b10ed9a292ULL, 0x26e3b2d8eb9ce877ULL, 0x0966362265293cc0ULL, 0xc6fa8027ad4f2c82ULL, 0xf12d73912b0196e8ULL, 0x8620e05f0a7ddfa5ULL, 0x59029acf95d083ebULL, 0xcdd4eafd1f39b74fULL, 0xfc6c3f82df0639b2ULL, 0xef6fc3b20999c22fULL, 0x964a96aa36e03f7aULL, 0x69d99ff9d6c28965ULL, 0x7bd0db3be7888959ULL, 0x6ba07ce1f0939e76ULL,
+        0x4ed271f6b734de6aULL, 0x5df8338f22122f21ULL, 0x4ee9ffb791129ff6ULL, 0x61a3cf220a163b18ULL, 0x2d1fab867bf756e6ULL, 0x667eab173c826bdcULL, 0xbf1abb624474b2b7ULL, 0x0575292d39937d90ULL, 0x5471b2c07011cccfULL, 0xb0d88ef9c9a8912aULL, 0x8d1cb2d7653f683bULL, 0xc075599256a246d3ULL, 0x77c13659a7f741b1ULL, 0x72d560ff899564c1ULL, 0x8d944eeea7212664ULL, 0x255717f6a2e11a64ULL, 0xc17ad54966c816e5ULL, 0x7ddb72e76062c7c0ULL, 0xce44e5668b3ece28ULL, 0xad5fe7b1e6ac9911ULL, 0xb86f512e6f1b299bULL, 0x60379a1999095182ULL, 0xffc3c073b0a99b3eULL, 0xdfe29eb747a517f7ULL, 0x7523c74b32f425acULL, 0x137367438e8a9016ULL, 0x51c5f1c81c2c1cebULL, 0x38936e3cfcaacce5ULL, 0x67e56fa55c0a8980ULL, 0x2d3156acd28c1e1fULL, 0x9a562a137959f2f2ULL, 0x4f6aac73ee25c953ULL,
+        0xbd612c10f1fc7775ULL, 0x81f76dbdaa686c21ULL, 0x833d484722e2920fULL, 0xfa207ef6add4ad95ULL, 0xb606dcb36b97395fULL, 0xb50031a298237e5fULL, 0x9ed419e9eb50bf47ULL, 0x3bcdc2b8cbb39b46ULL, 0xaee631b7a955d6dcULL, 0xca3d5ddde841d68eULL, 0xcdaaee0e1c90172fULL, 0xfcd1362de8080066ULL, 0x64fe0bc1107edebcULL, 0xd089ef5edad68702ULL, 0x48669f6a7321a9a0ULL, 0x2d9debe56a3fc3ecULL, 0x79a82b6d686d2ee1ULL, 0xf10a4cabf095b6e4ULL, 0xdd05840f6c028cacULL, 0x47a28149715c79feULL, 0xe23e56b1b0731d66ULL, 0x670fe4b5647a6011ULL, 0xfc9c9c06ac5d3747ULL, 0x30e423ed64691f82ULL, 0x768e560eca79c96bULL, 0x737d4e30ef894cc1ULL, 0x90acbba3c147c717ULL, 0xf87726b6398c02c6ULL, 0x2a1d20093d5b06d7ULL, 0x388f8a0d9b892956ULL, 0xde5e98331e182070ULL, 0x45e77b6348c50e16ULL,
+        0x006c3ce00218abd9ULL, 0x6eb239377858d9e5ULL, 0x8ba1d3a281dec0aaULL, 0x5e2068b0c99e831cULL, 0xdb044d3dcf01dbfaULL, 0xa79f70a7aabe16f1ULL, 0x9d2ca0ace0ba873eULL, 0x051b69605135b97fULL, 0xc50f5083ce55a43cULL, 0x35cf4cf985d48619ULL, 0x8fa6fddb4142782fULL, 0x033aec985be6e298ULL, 0xc86c0d8b0b1abd07ULL, 0x3682fe6b8945d9feULL, 0x759a2f6947489e6bULL, 0x1727b982be5d5dd4ULL, 0xcbab665e05e7b02aULL, 0x5cd7738505150667ULL, 0x57a8b1e968b72225ULL, 0xc33e9fcb5868fab6ULL, 0xa5e4ce93918fc55aULL, 0x9964fbfb438ca19cULL, 0xa9a50b11f5b6fe98ULL, 0xe39e74f6554c5c53ULL, 0x58834c76b63dee4eULL, 0xcc44742352a16d36ULL, 0xb35ac5556146dd2eULL, 0x19c974561e9e314cULL, 0x2b28d5df939cf020ULL, 0xacbdd38ec62db4b3ULL, 0x1758ad046d38e45aULL, 0x67651c3b961a6582ULL,
+        0x9d9d3a13ad30ccb1ULL, 0xc841dbfc5aef0552ULL, 0x3dca8ceddf971ff1ULL, 0xfa01274ddccedf4eULL, 0x0eba47d4e0449bceULL, 0x2a4ede9bf94f6c57ULL, 0x7be5ee866930c074ULL, 0xd41bc89a5738eae2ULL, 0x764f85d2add30d2cULL, 0xb2432bef5ade1ef4ULL, 0x5d371bb74c608cecULL, 0x8297bd809bcc440bULL, 0xa714a1d7cb5b4bbfULL, 0x90357c52f5dcbd9dULL, 0x0de1b7f322cb421dULL, 0xafa4d66e479a271cULL, 0x5d57a65fcb178027ULL, 0x334c0aecff907523ULL, 0xf9b4158d590fd4aaULL, 0x8efb9079de151746ULL, 0x1bc264e21923f956ULL, 0x82ad404d6767e152ULL, 0x35e9f580c9d5c34fULL, 0x6837885974337c6eULL, 0xe36c93e0411e5e86ULL, 0x41d6bad1c2eed6b6ULL, 0x5951fbc9951b0f4cULL, 0xf280c3fcc0576c38ULL, 0x6658c2035ce002f8ULL, 0x2f3158894aabf327ULL, 0xc6a7e614ee6db756ULL, 0x08fc7c2528b20c76ULL,
+        0x76ac8f01ca467ff3ULL, 0xf2d937c03671cdc1ULL, 0x6c3a8f9fce2c0af3ULL, 0x455e50f5a40f98fdULL, 0x13ae79055c9cf1f6ULL, 0x049c20c62973f345ULL, 0x3adc483ac20f1a9eULL, 0x21a10452d2540ca8ULL, 0x15b90986bd61e363ULL, 0x6bf843e8c07eefcaULL, 0xc34fc2f38e398e99ULL, 0xdc5d8b8ee6ce4cdfULL, 0x0814473b1c74d0acULL, 0xdbac2fc830564ba6ULL, 0x4d5b416ee88255eeULL, 0xac641482c2bd9340ULL, 0x0c8196bcff89c09eULL, 0xa8a843b7aeb28bf7ULL, 0xee423f45399ddeeaULL, 0xad13ca745634b368ULL, 0x77c2b16e8c7b4c01ULL, 0x6a509eefc5d18b79ULL, 0xb99cecc988107bdfULL, 0x550bb9c4952d55a9ULL, 0xd15aa740593d9001ULL, 0xdfcd469fde0a2502ULL, 0xbfb768c3793ee4ffULL, 0xaef1615218829902ULL, 0xbde9d976c927ecd5ULL, 0xed58e4544bac1e10ULL, 0x81fb04c4f1b606dbULL, 0x1a62b44aab6814b2ULL,
+        0xfb82045296472a52ULL, 0x52c1ee7baa3061ccULL, 0xbc125333ba5c6f04ULL, 0x39e26c6ef62393e2ULL, 0x1e266972225c4045ULL, 0xafbe9f2077629159ULL, 0xac2b19e20c0b537fULL, 0x15b7e9877b7f2447ULL, 0xfead8f7e75a05d11ULL, 0x5ddf281d5066f67cULL, 0xa5ad29e1afed45ebULL, 0xf668458f41733496ULL, 0x8c5f932e37b960dbULL, 0xc5b9a7b8ac56ee22ULL, 0x62660e6a10901e5eULL, 0x9eefd12e904f8e0bULL, 0x7bda8c1053c011f2ULL, 0xa528a876d077f9a1ULL, 0x9e1c03db0509a8fbULL, 0xd5e3dc1a6a0a5b87ULL, 0xfc420063b8dc9811ULL, 0x080b7f8d22d73966ULL, 0xffda1f4caa1f7646ULL, 0xd96213a3c1ef38c7ULL, 0xf275a20035f5be11ULL, 0x1d1e505db055bb8dULL, 0x2ba86149ce1cfa91ULL, 0x8728712af26479ceULL, 0x12e8aa75a5e7154fULL, 0xc193e08a24cffc42ULL, 0x66ab46c5339d5886ULL, 0x165cf4f639a02919ULL,
+        0x791c49f521ca74fdULL, 0x1a24e19b44bc4969ULL, 0x29168e7008d0c5acULL, 0xb90ad497cda6a3aaULL, 0x5bdc8f080d06173eULL, 0xaf6a90fd1375206eULL, 0x09eb244a432ea582ULL, 0xbeede7277f2a97feULL, 0x8ae8b8b2b5a984b0ULL, 0x95d56ef8c428e911ULL, 0x8fe8a940b5e815f4ULL, 0x512e8df44a5dc259ULL, 0xa63cf86caa3f8c48ULL, 0x4a6464e61070a4f0ULL, 0x0fadc4fb666a9677ULL, 0xd8c36af56c9667d3ULL, 0x293e6d08fbfc3c2cULL, 0x70f1a7ca6cca78c8ULL, 0x2820a48c3db0c79cULL, 0x32ceccfebec4774dULL, 0x49f9463aae74cdf1ULL, 0xd463772e138c9600ULL, 0xf0b56298a0fb6144ULL, 0x419ac6683cd4fd5dULL, 0x44146940b4d059aeULL, 0x46f465672063b0b6ULL, 0x7fe657ac8e10640fULL, 0x5ace0d401a3cc735ULL, 0x51879bfb43429419ULL, 0x25d39af0c6de673bULL, 0x6ce1f0a3d079ce45ULL, 0x7a385e63a7e33f58ULL,
+        0x94b73a13be64c5c3ULL, 0x571acfad7886b3bfULL, 0x0f2e94a31d24dd77ULL, 0xe51c8330c8b8576aULL, 0x7996cf4668510a91ULL, 0x591cb6dc0dcd71d9ULL, 0xef2397339595df73ULL, 0x178aad26e1aa60d7ULL, 0x5a2c2c4a03f1f775ULL, 0x0aa1216711125546ULL, 0x7c26be96cc21ab61ULL, 0x4a15ca6f1b5dcdfbULL, 0x8f1577c940f0d298ULL, 0x0deaaeafd24b6e8eULL, 0x1895a7728977b91bULL, 0xd7dcd12c6f489bbcULL, 0x0deb04eed933cc6eULL, 0x04392ac362ec1f65ULL, 0xe950c2c39516ec25ULL, 0x9309b2e0004258f7ULL, 0x2cdbb6ddd4228999ULL, 0xba4d20e42eff0bffULL, 0x21c0a0662d1b302bULL, 0x96b2d5f798982452ULL, 0xfe6d728974357e75ULL, 0x6636c41cda2e6f6dULL, 0x705bcd0d51110dafULL, 0x160c25181ac00533ULL, 0x35bb689c948a4914ULL, 0xafc819d9da362a27ULL, 0x22b457d2e7ac7820ULL, 0x0db73abce40a4808ULL,
+        0x8bcfeefb3c7131b1ULL, 0x14de901599ed1b9dULL, 0xcdcd4de7d292d1c6ULL, 0x11b166e4ed6983f8ULL, 0x146d94e6caf1e2ccULL, 0x34b2c66fabd2d112ULL, 0x3590bd65229cf8ccULL, 0x21637fb981ad4d51ULL, 0xb4ed4522e70ffe64ULL, 0x7e9cfc98e9f3a338ULL, 0x7fdac2e61e041a3eULL, 0xff26ab440ee84ad5ULL, 0xf577309846a9e968ULL, 0x070fdc5cb8c62989ULL, 0x70afbd1cd96010d9ULL, 0xd75c24b298830231ULL, 0x85481d999d3b1dbaULL, 0x7a7a2b34a0ac0e76ULL, 0x30d40c50f59f1885ULL, 0x415bde3904742666ULL, 0x88242bce8c60dc05ULL, 0x4a42502b30143409ULL, 0xfe2256cad62f58a7ULL, 0x41059648fa9f946fULL, 0x01918e2c2397bad2ULL, 0xc9d0407f17021997ULL, 0x04f367da60cf4e5eULL, 0x48f266555f7ad097ULL, 0x1e4d10d9fb47ce23ULL, 0x8d7c5fa7e536518cULL, 0x0d3df3adc8549e7eULL, 0xf721b83c7be8ad93ULL,
+        0xf5cc5d6e351cf0cdULL, 0x6a60d93e58dcce1bULL, 0x3406094cedbc3404ULL, 0x3d5d8aa561ce9895ULL, 0x82b55c5fe55c1344ULL, 0x392b96df309e775cULL, 0x17e0a71c4c3dc1b6ULL, 0x73837c6bff7f09abULL, 0x451cd188b99a7571ULL, 0xff9e6e064cd3038dULL, 0x16b75314b4c7f8f2ULL, 0x4b0d4e01bcc581d4ULL, 0xf5adcef4aaafe6acULL, 0xa9bdeddefd423468ULL, 0xcd7808372aca07f1ULL, 0xae63690257406d13ULL, 0x60b18b464502525eULL, 0x9a9d83c138a75493ULL, 0x0381e1c3388eb371ULL, 0xe758730e23dee8aeULL, 0x8cad7a4a27dd29d3ULL, 0x4f1742f598570242ULL, 0xb69f07c2c353cb2bULL, 0xc1f1ef1dcf7bdadeULL, 0x8f4d5d4dc575b5efULL, 0x80cb502117922b7bULL, 0xc87a05a7ed28806bULL, 0x26c4f326c56c0b21ULL, 0xc92a9e21e6d934f8ULL, 0xf2dac4bb69d7a162ULL, 0x10d84b72b28f84dbULL, 0x81f8ddcf31296ad3ULL,
+        0xb80aaabf9101d79bULL, 0xd3335c14f49c2989ULL, 0x61925186c2dd3af1ULL, 0x98e9e489e23d7eefULL, 0x7e54874363dc11a1ULL, 0x6958788e75ef5ce3ULL, 0xee3486a6265fb81bULL, 0x2fed242e296eb00cULL, 0x90c3c33bfd739e94ULL, 0x67b58e46e292970eULL, 0x2dcad242df2b8e90ULL, 0x4f9685efef7ea600ULL, 0x3acd352708a7f171ULL, 0xfc04c0236cd2f36bULL, 0xf4df22328ff62c26ULL, 0x1300f6ab19e1f31dULL, 0xef21e1eccf896791ULL, 0x5bf1ae756e2f007bULL, 0x8a4d42cc78e84a75ULL, 0xd0c7bcb3cb5eabc6ULL, 0x668e2b86fad47951ULL, 0x677556cd4d5d9ea6ULL, 0x6d618aae5983aa88ULL, 0xf2b9dab091ec854eULL, 0xee90a21e6a5b090dULL, 0x72123745523e1f01ULL, 0xbf11de16935b9711ULL, 0x1c1c4d6f30f7284aULL, 0x56a494f6e1e3623aULL, 0xa1c70ae054970ce6ULL, 0x00839e23b842d754ULL, 0x66dc9906255af438ULL,
+        0x9294a3865e2b9972ULL, 0x4a83bcf8b50a4962ULL, 0xe153ff271504b7e3ULL, 0xd4eb6a078aaba83aULL, 0xbb57c6794d88e9eaULL, 0x3b34d8ebb96f7e83ULL, 0x8504af65e027ab33ULL, 0x2631b74642415db9ULL, 0xcba5572f1de4e530ULL, 0xd2644b91a00615b6ULL, 0x3b150f176bdc1ff1ULL, 0xe8f3c1b4feac3a39ULL, 0x98f89e953d9a0fa0ULL, 0x33b7fc3c1a5a2e9aULL, 0x516153a47ac27831ULL, 0x26a0a1f4fc987182ULL, 0xecdeea471c8420b2ULL, 0xd846cca984cf6a2fULL, 0x19f1418d7a60c05cULL, 0xcdbb37686984dca8ULL, 0x2ad1e3d82fa423baULL, 0x09eb091b2e528244ULL, 0x62edbdc40cc3b76fULL, 0xb74f21adee74984eULL, 0x47368cb0979c0313ULL, 0x1b0be8ac499b7a36ULL, 0x93326235ba7cddebULL, 0x4d155350a7e70297ULL, 0x491db492c2725a24ULL, 0x1095bab0ee5d6573ULL, 0x1a7e9a3b20c9a78aULL, 0x2560251f44255c13ULL,
+        0x35f758f38f2d0c85ULL, 0xbc82699172c3cc9bULL, 0xa2f712d0a848ec79ULL, 0x62aca85a6edf74a8ULL, 0x80e12c7c82f80c9aULL, 0x919b47cfcfe32538ULL, 0x9e545b37be7ea412ULL, 0x1acc5adb42aab194ULL, 0x26756dee867e4bfaULL, 0xc6352af9c09499b4ULL, 0xf9243b7c3d279be6ULL, 0x4876f07b2292983cULL, 0xdc844d08c2d45d0eULL, 0xe3fe133e1425ba02ULL, 0x4a4c1aad8f004b05ULL, 0xa490dc65a7f32fbdULL, 0xfed6e958a0906ba5ULL, 0x3712f93882e1efceULL, 0x26ce412347471403ULL, 0xa6a291f82f1ab7f8ULL, 0x060274d475a4b096ULL, 0x7f3176e50b43175dULL, 0x6278c4ac1c6e542cULL, 0xdc12aba0c61e8319ULL, 0x590fb6959269d952ULL, 0xad4ef6624271cfcdULL, 0xd1802fa50670272dULL, 0xf42b0d2b353c926cULL, 0xc886b1a3595f7d9eULL, 0xa7a34adf9b0039cfULL, 0x6c493d0a63de83e7ULL, 0x1dec577390e6b869ULL,
+        0xda7bde2525a61773ULL, 0x16edf2758e457c3fULL, 0x486351cfff592ad4ULL, 0x6d739fd2c7450fb7ULL, 0x78089e907a43d949ULL, 0x934df6f64143c28fULL, 0x4a7a907e9b9194e9ULL, 0x17139f74bde8d4cdULL, 0xb1c516197e77be5aULL, 0x4d97a1c37195a521ULL, 0x2fe6c77b1ab6336cULL, 0x3809586f6e9c2afaULL, 0x04da43686bd9af21ULL, 0x599af9ca6a0f095dULL, 0xc9970fcecf50a331ULL, 0xf20d857b472bb40bULL, 0xacf36fba212bb5c4ULL, 0xadbbf748286e3a7aULL, 0x3f0c67088ebfb366ULL, 0xf37a701c9cfde849ULL, 0x778924b2f6eacbadULL, 0x0c1d2c0947bb0f8eULL, 0x9844e1eb01346833ULL, 0x1f9fff8e0df04222ULL, 0x680b8c63c569f7f6ULL, 0xabfa3ee05ebbd4d3ULL, 0x14df99ad0d1cee5bULL, 0x7a5aafcc0ba85030ULL, 0x0c4b2d102ace8105ULL, 0x337e2801f7d06aeaULL, 0x16698f9d7828b693ULL, 0xe3be80ec8c8d47b0ULL,
+        0x9656f716b8722ef3ULL, 0x71fff63e842b7ccdULL, 0x7a3bd8aec0275e23ULL, 0x826b7f619fd05917ULL, 0xdbfed3afc2403261ULL, 0x9033e12b8ee267baULL, 0xbeb7a985178f34deULL, 0x9672831b31d0ae8fULL, 0x24e7018cd0ac7531ULL, 0x70d3d13a2d075490ULL, 0x762e5841e67fa4abULL, 0xfc09eee0447d638eULL, 0xebd6fb2fe0acbe38ULL, 0x5d01543a5584c145ULL, 0xdc51b7afe1aa86a5ULL, 0x3683021694cd84d2ULL, 0x65e006e4ec715401ULL, 0x464d7313a82ab37dULL, 0x2028fbb22d9e5c90ULL, 0xeae9737c4bbb4aeaULL, 0x3887cca9159ec44eULL, 0xbbfa1969d30416f5ULL, 0x03a536f971b2f3dbULL, 0xe03b4acc05fb2e9fULL, 0x39b7ffb006ac7bbfULL, 0x035489a66b365211ULL, 0x3eb45c48d06de5a5ULL, 0xd93c1ec9bd7d0287ULL, 0xe0787c8a3dfadc22ULL, 0xed0fc38c6b0be093ULL, 0x58631c5c5be28151ULL, 0x278920c1911cd24bULL,
+        0xcfce37baea4f6f08ULL, 0xb34473931a240d6dULL, 0x06101e4af70dd69cULL, 0x2bfe8cc4f2295287ULL, 0x451c2049d2226a06ULL, 0x3750320ac1677c48ULL, 0x97a335072b21fd88ULL, 0x33c597d3dbeb0351ULL, 0x5896813f5e946861ULL, 0x6151b42f8fe3de9eULL, 0x18b590f86d112898ULL, 0xfd97845e81b21f35ULL, 0x96571b3ab0b1f4e3ULL, 0x388765321e33c293ULL, 0x3e4748f31de88ec9ULL, 0x3c9bccb91293b82cULL, 0x5d9ef1062552ebb3ULL, 0x3ba1faa6328bcc3bULL, 0x31315e3a70c050bcULL, 0xcef5b55d2e435acfULL, 0x3777b32fe35b11afULL, 0x8d0c618101910f38ULL, 0x0470f5513684fa48ULL, 0xdc26ab421c2e3356ULL, 0x80619e55692c218dULL, 0x7cd520af4d77e01aULL, 0xcf98dd9a34acdf96ULL, 0x9af770067df58454ULL, 0x99160a421d96885fULL, 0x2f94e326020ecd26ULL, 0x5b05cf77541524eaULL, 0xe23ac2a487129799ULL,
+        0xe912f29c20c2bd1bULL, 0xea61e1e82df5834dULL, 0xa97af2d203ca4b47ULL, 0x94b7f7e1dda48fd6ULL, 0x0368a984727e36f6ULL, 0x0eb8396805a69089ULL, 0x6806fc42e80defcfULL, 0xb97497ed126a79a0ULL, 0xd30ed70679f0f4f4ULL, 0x17b8fa864fbb819dULL, 0x114b13769594d425ULL, 0x42beb90fd17b6c44ULL, 0x2ecc107cf7f0604eULL, 0x672f0b1d59b169fbULL, 0x98d905b035c95b85ULL, 0x97a993b445120db4ULL, 0x19dfd837822a063aULL, 0x9d2b9d60198192ffULL, 0xf3c6d4c6c585b62dULL, 0x4c3fff0fd981bdbdULL, 0xda1aee73eca92983ULL, 0x150c98d808508a6cULL, 0xaa51a616bf1cfb1bULL, 0xaccbbf9450abf831ULL, 0x996f687a27c3fdfbULL, 0x9563e83e4971a29bULL, 0xc0263245f9c2f6deULL, 0xcd127efc4af45184ULL, 0xaf56de1078238270ULL, 0xff34b7b3eb10b78eULL, 0xd6e5226af29e5645ULL, 0x275cf46fb31f609eULL,
+        0xf00466a499a529f3ULL, 0x10d57858e31a232fULL, 0x11476dcfbbb062edULL, 0xf876be89ba45a173ULL, 0x7bfba92dfed57bd6ULL, 0x8e6f3c0574a9a246ULL, 0x8767a8465b67476cULL, 0x9f294e5c83a00ffdULL, 0x7a20491eed5b1c86ULL, 0x9c01216ab19f7787ULL, 0x1609a2b3d4c8af96ULL, 0x78020422f121513fULL, 0x314295a2b41c5561ULL, 0x912abe4066195e19ULL, 0x08888bce99551fafULL, 0x9bf7d6e4b185b690ULL, 0xd1189c917d8f094fULL, 0x1dbaff0b0ad33fbaULL, 0x116f435871db4df8ULL, 0x12eb1a43e14839d6ULL, 0x91dec3475b8b326eULL, 0x0abff837d3d0616bULL, 0x1e867280d663e034ULL, 0x145e0e3cbd34cef8ULL, 0x96ea117324ddc55aULL, 0x8121d9e075f99423ULL, 0x2797ef6a19f33418ULL, 0xd3ffc354ee7552d5ULL, 0x9d34a083539046a8ULL, 0xb589775908729574ULL, 0x3ae540b4e511a754ULL, 0x1da673c041f10e50ULL,
+        0xda1a5d2c6374489eULL, 0x461b09d9ecbf9451ULL, 0x2517b314481440b0ULL, 0x27061b2db6a86d11ULL, 0xbc90c41a43b7a710ULL, 0xd796ac95ed294ef1ULL, 0x97ca3d6ca9714f10ULL, 0x3a9e3b6b6d906de1ULL, 0x9c9fc26b9d816321ULL, 0x761bcecfc7a28a1aULL, 0x630c3972ef7b2af4ULL, 0xd5133d2808016284ULL, 0x1f21b5d8b19edcb0ULL, 0x20a555fb377952a6ULL, 0xb8aa26236d566a66ULL, 0x9c1152d1cf8489f4ULL, 0xcd521dda9fcb5329ULL, 0xfc050541a08e75a0ULL, 0xc98eaef616e8dc94ULL, 0x2ea29519e6ad4288ULL, 0xf57efef417279eb2ULL, 0x345bd80aed97c1adULL, 0xf5525d4ca57e129bULL, 0xb0c895b23aa640b2ULL, 0x422db82cf1a35ef2ULL, 0x02f97f5270b76bacULL, 0xa29b271dd7dc3798ULL, 0x7726a7232a2342bfULL, 0x42e7cfc2d628bd40ULL, 0x20fe7b1ddb64ef2dULL, 0xd9772f33cd202f6eULL, 0xf5f6d400eb700e7fULL,
+        0x6d7d2c83291b2cacULL, 0x15df4f45ac29d6e1ULL, 0xcdb6b704d4218522ULL, 0xc4161018576ec3e7ULL, 0xfbd77dae6cc9dd87ULL, 0x87ce8879f78078aaULL, 0x50daef915f104b56ULL, 0x9f162be39b174972ULL, 0xb3fb2fbdb922c256ULL, 0x1918d3fb75dcb27dULL, 0xb5f3e42abf8695eeULL, 0x5175853a4fc2cc21ULL, 0x4dfa048436a0a755ULL, 0x0c7a54fac961017aULL, 0xd802abd4d455489eULL, 0x750a4a5da28ce946ULL, 0xb834d05a69445b34ULL, 0xd2fe94e12b8b2e57ULL, 0x8d4d518f74644324ULL, 0x222b9703a4f8fa9eULL, 0x923dfdbe2ba98271ULL, 0xdf103990a6a979f8ULL, 0x48b53fc83a9fd8cfULL, 0xe89f03b453402c56ULL, 0x481844a265a3f33dULL, 0xa10103114541adc8ULL, 0x38d4b68e8a05e4ecULL, 0x1375f7a1ceec46a2ULL, 0xf00ade66b1e63e49ULL, 0x47778a5141e3ecd0ULL, 0x8a8413995ecde8c7ULL, 0x94d08e5b42e0946fULL,
+        0xdceef3a3144cdfcfULL, 0xeb8f44d10a2f88a0ULL, 0x06a1bdca66d32af4ULL, 0x26b9744716eb1222ULL, 0x79a46444a846097eULL, 0xd3a4d58c6498e891ULL, 0xf1ff1b753a20784dULL, 0x485b62eed1d3ba45ULL, 0x6a382aa3673a8da1ULL, 0x1d5ecc12bf6df725ULL, 0x9aaea494d88e0b13ULL, 0xb69b8c954b1fde1dULL, 0xefe260976d4c2664ULL, 0xf6045866a0a7a163ULL, 0x6d47788eb1520893ULL, 0xbda3c9bc538966ebULL, 0x74f5a35fe197b429ULL, 0x2159ee07695ad5a9ULL, 0x2c9cf68bdcdc8980ULL, 0x04bf9414b8b2cea6ULL, 0x486d4fa45c92362cULL, 0x4e6a43957e2a984cULL, 0x1c2ff0a64a085daaULL, 0x81f99ae7a656b5d9ULL, 0x882d09c3c926aa72ULL, 0x389e0a415633f951ULL, 0xc9000fff6196e98aULL, 0xa7720464e73b6634ULL, 0x049803bf4799f5f7ULL, 0x80e49a48e3991cc2ULL, 0xe9b8091e1bc3bb4bULL, 0x597576a8750cd0d3ULL,
+        0x3ffbb1a9e52170e2ULL, 0xea8e877cc3943670ULL, 0x83fc67f036478533ULL, 0xea7b88c6af264e4bULL, 0x5d2dfa08053e1820ULL, 0x5082761d834f915bULL, 0x386180c921d51a46ULL, 0xab654a363ebc01adULL, 0xaa44fe8e483b9249ULL, 0xc723f18e3dae1d70ULL, 0x21f0fb8d5e6d88caULL, 0xb6e8a56bdfeca50fULL, 0x2862145a1db656d8ULL, 0xa0ffda36b12e5961ULL, 0xbe1771dde606081dULL, 0x191aab065a870df3ULL, 0x893a2563a4ac2bebULL, 0x84ba6cda0902499fULL, 0xb62479c23cc74d19ULL, 0x6f84b1b04b072511ULL, 0xc26978617f0865e6ULL, 0x4874758cf6e7226bULL, 0x2a399a3c0c83a6a6ULL, 0xbb2ab13b5eab1be1ULL, 0x28d91a4b1d445a60ULL, 0x00b2c6595a4e2be7ULL, 0xe567c115e3e1bfa6ULL, 0x7ff1793c093a9923ULL, 0x1cf2315890cc491fULL, 0xbf65df1fe585cd46ULL, 0xe293dc7fb81bd14bULL, 0x09feeae9498de5f1ULL,
+        0xcd1f97758a91ca9cULL, 0x8e312dea28d17b28ULL, 0xad15414601481a41ULL, 0x8699ccd2442e3e2bULL, 0x8b51e397f29a9121ULL, 0x45bc16b08edae8f9ULL, 0xb0cf645a59063857ULL, 0x228101627096c4e9ULL, 0xb712938486a6661eULL, 0xf0d29e6329d95c22ULL, 0x637a75ec9c11ca2eULL, 0x67ae68568f6c0bf9ULL, 0xd942ebe5450603fbULL, 0xf7ae64cc62a026eeULL, 0xbbe98114a523f53cULL, 0x3f4ad9016f3faa01ULL, 0xadc7926f271538bfULL, 0x9d8bfd290b90ed46ULL, 0x016596bd0989211aULL, 0x43309a75348ce824ULL, 0x40e3512aa1b70a0dULL, 0x37b31add7e222846ULL, 0x816c53db63ed4634ULL, 0xf239ce150d32c36fULL, 0xb30606ffee776efeULL, 0xac1b87ff66a96603ULL, 0x26825e034d71945bULL, 0x19477cc733873f4fULL, 0xe216f8138d51f9afULL, 0x243297a95d06d462ULL, 0x0ab5b0e221c00a0dULL, 0xab92a265c5199f7eULL,
+        0x26f5ce81d1e4758fULL, 0xf150463317eb1f81ULL, 0x035f42e35c61d9a2ULL, 0x7ff1425b2933216fULL, 0x9a2c86520e022f35ULL, 0x1b2de4aa738619a8ULL, 0x0503eaf55e85f925ULL, 0x2411f191458c09d5ULL, 0x1bfadfe306b1c55bULL, 0x075f889a03ec39f1ULL, 0xd6ceab0a08edf813ULL, 0x98765a8db13e1d92ULL, 0xd5495a1df880d2acULL, 0xdec6ca4e05550040ULL, 0xfa647f36ff8b4e11ULL, 0x4d3e91173f727e43ULL, 0x6b879273a891edf0ULL, 0xe393808087aecc9dULL, 0x51be918ce899766dULL, 0x0aa70d26703d16f1ULL, 0x6ac75cfc93bf9d2fULL, 0xdb644a58d74e22c9ULL, 0x46cbfafb658a2a24ULL, 0xeb6189c57d14e1d4ULL, 0x96b2551f75dc9aa6ULL, 0x9fea592632728343ULL, 0x7926a5290eef080cULL, 0xc9d30dd4c41ab920ULL, 0x896605208e6c9366ULL, 0x38736b14915d25eeULL, 0x9d8f7722f5dc13bfULL, 0xd9cd0b3bc05e6320ULL,
+        0xb872253e517e6327ULL, 0x2b04b7e9acd9eb7cULL, 0x495e4fa3da5aaf11ULL, 0x7b15de890daaa9ffULL, 0xc1cc9277266f639dULL, 0x6964c7d0b7e2f824ULL, 0x79198101c77c5076ULL, 0x859a22382188d96cULL, 0x276e4be43b3d59f4ULL, 0x74f7e1be248f7c59ULL, 0xd7ee604ae34bfcc9ULL, 0xe06d22b32e44732fULL, 0xd7af53fd201272d2ULL, 0xfa23a77c19e6bbeeULL, 0xb0eb4a68cd58c070ULL, 0x071f411fbee6c02fULL, 0x1773966ede6910d0ULL, 0x7a876bb34563ce3bULL, 0x616f5c438e37fbeeULL, 0x5f2368c1e210016eULL, 0xd5fca2d6a064c832ULL, 0xdcf80c95b4deb77dULL, 0xdafc3013d2f925c0ULL, 0x66ff850397542af4ULL, 0x0358ecd8415acc29ULL, 0x475e84b31f5ae8f5ULL, 0x3b93fd8cbfe09c6aULL, 0x98ae50357933b324ULL, 0x4b680bd187cf3cd9ULL, 0xd7fc61b6f482ed2bULL, 0x98bb5c701bb64cc8ULL, 0xdaea71bcf026b08dULL,
+        0x1029a2b2f60768aeULL, 0x26011d5b5b101c68ULL, 0x3927aca01bb80ec7ULL, 0xbacfd97a7d38af61ULL, 0x171a799e94d56b1fULL, 0x78e403cacdf51a8aULL, 0xb006442a34b53e9dULL, 0x55324c2172cbc7fdULL, 0xd20c36ff357ebf54ULL, 0x4e2190bea9bc0b52ULL, 0xf3b508f3cd190a85ULL, 0xe11ea0bf845d1dc3ULL, 0x905262817ddccecbULL, 0x0957608c92abb540ULL, 0x1bb71e40b4381268ULL, 0x87d1866e6ab75b93ULL, 0xaf7f9a9b54446a9bULL, 0x0273826aef0c5472ULL, 0xe783e636c4ae5e2eULL, 0x192ee0463a13cd79ULL, 0x0d9cda06d8d9a78dULL, 0xd3584c2eadae0ec6ULL, 0x4065ea1c5ceef676ULL, 0xc0bc6996e32207bbULL, 0x3e4b5ecd9583e806ULL, 0xc3133c187db704f1ULL, 0x465909c860c7b470ULL, 0x17258d335892d693ULL, 0x9b6a1ecedb6363ebULL, 0x7098549af0d34393ULL, 0x13709bd22e5d06a7ULL, 0x172863145340bac9ULL,
+        0xef4beb390e2e4ce9ULL, 0x4f1026e7f27b4b7bULL, 0xe03cf6d23f8b0262ULL, 0x73df8069c1d98f0cULL, 0x442deb620c14618fULL, 0x7ed0ee202975a0d3ULL, 0xdb89ef874442dab1ULL, 0x4d08aecdbabb8ab8ULL, 0xedcb97d9bdd4a696ULL, 0x3defea3280442c81ULL, 0xeaa119735ac7eb12ULL, 0x1a71d5ac560c8336ULL, 0x9b0912465822c39eULL, 0x393c47a2f9e0df93ULL, 0x97cbc371dca099ceULL, 0xbfb2f08e2f799fc8ULL, 0xf1c082d45d16226aULL, 0xc623cfcdd829af45ULL, 0xd5e4337e32c68088ULL, 0x718740fb88e5db1dULL, 0xda3293e3d02ba569ULL, 0xf950c37b3fec57d8ULL, 0x644c4e1bcacdbfcdULL, 0x25ed59977f9dee4bULL, 0x9ddd1207e58911ddULL, 0xfad409ab73024c68ULL, 0x269c04731a928c79ULL, 0x359606e0d2a4307eULL, 0x1ee08218dc972bedULL, 0x81a173024fad9a36ULL, 0x0d45f0a38df89691ULL, 0xc5d8381f42f43297ULL,
+        0x6f788c8d3bc1c31dULL, 0xa6286ba8b12cfdcaULL, 0x6d568a34c0e99d61ULL, 0x1fc45ea74f68348eULL, 0xd75a74386729dcdbULL, 0x121a59362d9ac49bULL, 0xf7f7c296ed0ac104ULL, 0x74cda524da3d7baeULL, 0x43a294a6cf61c352ULL, 0x4ee70218234768cdULL, 0x42642f247a58d65eULL, 0xf11eb8ab63fbf6b7ULL, 0x9b4417283001737fULL, 0x7f85c21d387ae032ULL, 0xf52e5eda5577c76bULL, 0x8bdb6150921953b2ULL, 0x5f49ad98f934e7c7ULL, 0x5d4fc88ba8a5b4d5ULL, 0xe1f9ee7ff8c96ebaULL, 0xac2c2ea49ff8f5deULL, 0x6db2cceb53240d6eULL, 0xc9929ccdcd2d52abULL, 0x3444253a38e16f93ULL, 0x4d351de603e0dcf4ULL, 0x5339045338519d01ULL, 0xb78a384b108b49b2ULL, 0xebdbb55a8366016aULL, 0x5d66db52141f8fa4ULL, 0xb080bb9c766fa8edULL, 0x3d229823577ba203ULL, 0x9647d26770751786ULL, 0x643396e1398ff1f1ULL,
+        0x9a67f0b09196a9ffULL, 0x49a972c7c957ff57ULL, 0x4731494aa9869e66ULL, 0x2106f2aff6fc3688ULL, 0x7c23e78faa1c0ec5ULL, 0x32af7c83b3713ec8ULL, 0x9665d6d6c8a3c91dULL, 0xa62eb4e1361dda5fULL, 0x6b1b00082ff076bfULL, 0x5bef84b615f9e3e6ULL, 0x710fb64be3de0847ULL, 0x8ee77ea8a0d23855ULL, 0xa86bc2d3d9ba2228ULL, 0xf12c03c07f21ed37ULL, 0x1175dfe541b218ceULL, 0x97a77489c071c99fULL, 0x843e67e50064f0a5ULL, 0xf5dfa016a42ed6abULL, 0x432a8e4e14c3982eULL, 0xf52ec77952030b81ULL, 0x9f7b14513aad8d46ULL, 0x31ec73810108820dULL, 0x4932d67d99b44fcbULL, 0xdcdd5b1cdcd14213ULL, 0xffea1493cbc465d1ULL, 0x5dd8a332071a7e06ULL, 0xb1d7342ddafc99cfULL, 0xb0e17150dcdd1defULL, 0x39f434b6a6ee77dfULL, 0xb3f8fa780b9bdf87ULL, 0x2d981ae7549aeea2ULL, 0x69f727247be50d26ULL,
+        0xf7605454f2ec30fbULL, 0xd0f9fb542d974bedULL, 0x33906a2d711a7790ULL, 0xd81228ec2ce24456ULL, 0xd830f2b2def2d1c0ULL, 0xb4cec3c62d7a7761ULL, 0xff284c75fb0eea9bULL, 0x7f1a95a73270a7ddULL, 0x9746b8196d794e5eULL, 0xbd5e84cd86736713ULL, 0xe3ce13806dcd1f93ULL, 0xdd1e80dd9fbe2e1aULL, 0x686640e0012fb21eULL, 0x7c0bbf4618565eeaULL, 0xcb1827fd347d147eULL, 0xaa09f8f900cff195ULL, 0xdf6db50e798cd21cULL, 0x2a5ac25f447687e9ULL, 0x78c8bd01fe1681f8ULL, 0x00bc7a212d11f76cULL, 0x68e3ab401e126525ULL, 0xf7a616e6c12a35c5ULL, 0x5e183062978c1eb4ULL, 0x0396cfc7f3be6c61ULL, 0xcb8230c68da5f304ULL, 0x1a916dca8f223a14ULL, 0xd315c7da20997faaULL, 0x79e5ce81748f69fcULL, 0xe8e62243f5785132ULL, 0xbdae8aedc3bc10e7ULL, 0xb1aecd23b53d82c1ULL, 0xe2e27c0ae11bbb49ULL,
+        0xcd84367c8069bf80ULL, 0xcc74e9fe31cd3bf8ULL, 0xb8477d2936d22915ULL, 0x4428183061179524ULL, 0xb4e0fa44387f43d0ULL, 0xea64b6d8b02248b7ULL, 0x6c1c507ccfc80039ULL, 0xf86fa75d05ac149bULL, 0x6904ac4a2b561bf7ULL, 0xa0ccce38e0f55145ULL, 0x6a1f9d26876c3502ULL, 0x90ca003f120715e8ULL, 0xbf9af45675eca4faULL, 0x38d5feacf19218fdULL, 0xa98be6d9a8c78628ULL, 0x4c2ac5d39eb01dafULL, 0xfa456c62c7828144ULL, 0x2092127ac397287eULL, 0xe772f94c274d8bbdULL, 0xb7e3033a0cb92357ULL, 0xf0a3fd33fa7af985ULL, 0x2358d129536f9141ULL, 0x71e7d4262410c836ULL, 0x0ef7a8d6acddef33ULL, 0x1e1ca4a6dd3dd245ULL, 0xf766a72c1bff5320ULL, 0x9b118039dc0e5442ULL, 0x94cc0170b57a5ae6ULL, 0x18c9961bc54e3c1bULL, 0x8ab81b6a7eafb687ULL, 0xc008cd36cbaba049ULL, 0xee1ec784c3f8aecdULL,
+        0x442942e1b4e2a066ULL, 0xc351cc8cf708c134ULL, 0x78755c43e0fbebf3ULL, 0x47dd93f82ea7fc2dULL, 0x38baf496fe38f623ULL, 0x44be98980b9f40ceULL, 0x6500d888cd1b4b30ULL, 0x99fda03a2126df7cULL, 0xe1566d0536e8457eULL, 0x506c9ee55d59ef1eULL, 0xb3ef2700153476b3ULL, 0x57d4ef4aa214f2efULL, 0x3c52962e03ab99c8ULL, 0x252bc97d225e6871ULL, 0x23a69c756f89706dULL, 0x0dbb8743fd94d60eULL, 0xe8ed27834bf1ece5ULL, 0x2bc25b0a90461daaULL, 0x1b981d92035ee9cfULL, 0xf355208da85f1d34ULL, 0x1a68caf229b951b7ULL, 0xd31f4baf5519b0f6ULL, 0x44db7e9a2f2860eaULL, 0x5a639cda533e059aULL, 0x6a16b55a8a2b943cULL, 0xc30e86182fa82099ULL, 0x1e7c78e697391cf7ULL, 0x550df92203486c8cULL, 0xde586d3c2d77791dULL, 0x2a2d8ee9884ffc4bULL, 0x98e01732403dc1a7ULL, 0x070f6d8fc7272248ULL,
+        0x006f998e3807a66dULL, 0x934e0cc922e0febaULL, 0x3d07531935eb48fcULL, 0x86f58e7b5ddc8035ULL, 0xf965fe8e4303c4ddULL, 0xc8d61937da829ca7ULL, 0x03e4d450dd4c0ba6ULL, 0x3884c7e174ce96a3ULL, 0x77c6db563447b815ULL, 0xb2ff5a0205ff1209ULL, 0xfed746cfc5e11947ULL, 0xe778799e9d5b1aacULL, 0x24747e7fc41b1a14ULL, 0x8b3c32aa50ad643aULL, 0x1655688b66d0b315ULL, 0x3579819d9f1b065aULL, 0xc4a25e93bf84cf3eULL, 0xf84aa48327429506ULL, 0x410b365ff3641f98ULL, 0x913eae11b398deb4ULL, 0xb780475a0362f52eULL, 0x80482c19a407db37ULL, 0xa01e9bc5a9f33acfULL, 0x8ed0ff20faf1f68cULL, 0xfbce738b0c5f7450ULL, 0x30d709e8704f61d9ULL, 0xd1fd1e44ed1801ffULL, 0x690d90c077a2adcdULL, 0x7dc0b384fdd7b2caULL, 0x41da50951d9ef388ULL, 0x240b880c9ea88796ULL, 0x5abfe29c181f2a1aULL,
+        0xc66666ac29832ec6ULL, 0xbcfa1d6cbef17127ULL, 0xad1b320d857a085eULL, 0x2f83e9b72fd3dddfULL, 0x7c1a74f1645afd53ULL, 0xd8e320457700e8dbULL, 0x376c4f6e44aa4b1eULL, 0xdd53b319a0849c42ULL, 0xab26df52884870feULL, 0xbb4b72e0d56cc00fULL, 0x639caf181608b56eULL, 0x5f0c53d95611aa68ULL, 0x458850b3b403e38eULL, 0xa53ebc578941a5d3ULL, 0x38c6ab675cc94280ULL, 0x2dd73119409bea3fULL, 0xe1c680bd29e26373ULL, 0x0ffacfb823b9c117ULL, 0x41f998d32c425824ULL, 0xa32c4790832ab300ULL, 0xac37db0e176fdc72ULL, 0x911a4498f1211840ULL, 0x8a64956c99ff15beULL, 0xbf537f9218c0bae5ULL, 0x5ba8555000c9502cULL, 0x0e8fbe1864ed3f54ULL, 0x486dbde6f5b534afULL, 0x3602938345030eb8ULL, 0xfe01af4a889b05e2ULL, 0x960cc4d188969cfdULL, 0x07a159a9fd8d3d39ULL, 0xb382125c320d196eULL,
+        0xe72a648fc4454ea7ULL, 0xaa213f414c1d326eULL, 0x35c7a4bb009b5031ULL, 0xd803c9ffa2dcfd66ULL, 0x84a523daebdb3257ULL, 0xbc431635ed2fb029ULL, 0x15064dc9da01ff95ULL, 0xc7f87924816012e9ULL, 0xa077b1067b33652eULL, 0x5cd4d50ad009cd11ULL, 0xce308714748c2192ULL, 0x8adb267619fca2d1ULL, 0x3c061afb208e99d4ULL, 0x291befcd80119a2fULL, 0xe7797e4ddfce3c36ULL, 0x4fbe1e5af71e024fULL, 0x083c89731a957c72ULL, 0xd1ac971a68ab7142ULL, 0xb14f7c30f69b2c37ULL, 0x41d7378e3e73b16eULL, 0x94fbe336a0ff403aULL, 0xa273be5d8be09a94ULL, 0x71ca9cae4c236d4dULL, 0x52d191aff9cb5a92ULL, 0x8642aafc270333f9ULL, 0xb56934efb8e9df55ULL, 0xc4d90af10dab2a83ULL, 0x336498c2dfb8232eULL, 0xf9c429f631b3715dULL, 0x204769910882c07fULL, 0x8fd8ee14f095530aULL, 0x9a03707577801a8eULL,
+        0x6d416c45123647bbULL, 0x11f863c0892f9577ULL, 0x028a98d717fdd6bdULL, 0xa9e30ae1de8e2d8bULL, 0xa434cd1c7ae516f6ULL, 0x9f314abe4235d9d8ULL, 0x8dc857b6483d8e5aULL, 0x7ea64c10142d6774ULL, 0xfec629aeaf32968fULL, 0x9e877ee7fd3a75feULL, 0x581c3e2236d29bcfULL, 0x6e94178741e1e869ULL, 0xdbc6b0cb8e996525ULL, 0x6c91f00be028c7c0ULL, 0x79c5e75cdad8b5aeULL, 0x9601a5f9da48639fULL, 0x1f8745a572488cdfULL, 0x499830ae868bc2d2ULL, 0xdd0e0f3d6d79c1ccULL, 0x506cc9971e36f2e0ULL, 0x1bb3600603e8564dULL, 0xe31fc946e7d67e59ULL, 0x7d8528538a4d25b7ULL, 0x2b5cd263a36d204eULL, 0xf0fe4f2b98bed8a1ULL, 0x93035cb16b01de1dULL, 0x379de16f136f9973ULL, 0xd6387505695a081dULL, 0x66f0920b44e67b4cULL, 0xa5527d77753aa250ULL, 0x2d4d1b5df353cd5fULL, 0xc0627acec2effa18ULL,
+        0x11e16ed69b4019d0ULL, 0xdb054b6687aef7f4ULL, 0x102f59c4847a68dcULL, 0x3bed36a22505e2e5ULL, 0xba7a5a4f4b230c4dULL, 0xbbdb787dc00e5299ULL, 0x0f037e8acdaeec34ULL, 0x36968a269f372543ULL, 0x346b5f154ae07ed3ULL, 0x5001ec6582f09e1aULL, 0xd06e80f19d1c2708ULL, 0xa09fbf94ee773901ULL, 0x20002c463c961183ULL, 0x60854e7a172d9ba1ULL, 0x04c172253116a9d1ULL, 0xc8569f08e2d20653ULL, 0xb9e2cd36fb6710efULL, 0x2e32e2e482cb7a55ULL, 0x6238e989f7cb4524ULL, 0xda2d7b38e4e249a9ULL, 0x06bd471adb324faaULL, 0xe1dd21da4f633f1dULL, 0x169008b577bf33fdULL, 0x34c900075d4ff5acULL, 0xe306be0299a58bcfULL, 0xff8d316fd1d190daULL, 0x3cd74b9023eabea1ULL, 0xee4099684e969228ULL, 0x306d811f46682436ULL, 0xcfbf32fe40809acdULL, 0x7cf2ec65eef0ba3eULL, 0x8c37cb5de02587c6ULL,
+        0x7a2aee1eb29eff50ULL, 0xc3be164825699fd3ULL, 0xeb823d4bd872a549ULL, 0xb9c36e822dcff1a5ULL, 0x62c806de7c885237ULL, 0xe1b2d40f4caa229fULL, 0x7d5c9097e8cd1e74ULL, 0xea3bf351c37747a2ULL, 0x15bbd1766c308c68ULL, 0x9499b044d415c401ULL, 0x47d56f0455f24765ULL, 0xd3bd5d5c0b37421fULL, 0xab15a08396d6336cULL, 0x15e53024c1c77e4dULL, 0xb8b9ce2dcc54a78fULL, 0xfb59c3a4f762c0b7ULL, 0xe2b4ef87d2e0ccc4ULL, 0xa6b27f342288002eULL, 0x98bd39a7fd4631b4ULL, 0x8aa777b141adddcdULL, 0x8d22d84c3e5969d0ULL, 0xdecc5642566059faULL, 0x2d2edf36e7ae56c1ULL, 0xbd9c87b945295afbULL, 0xfbf2654e3e79d479ULL, 0xc98b4c53df6092cdULL, 0x2aef2bbe050c3663ULL, 0x9b2971309db366f7ULL, 0xe3a44419a218fc01ULL, 0x72e91ca944c5a80bULL, 0xb8529e63eaf7a84fULL, 0x66e506191121bb29ULL,
+        0x431a2823a8db8887ULL, 0x20800cfc5b42a719ULL, 0xf8908b581fc4f3feULL, 0xc18a318e3a729efdULL, 0x5f683e5ea582bc76ULL, 0xe4303ab0758f589cULL, 0xf8323c97181273afULL, 0x8b67c70ce28e1018ULL, 0x883ec5a1225c29caULL, 0xe87ad104f8e59623ULL, 0xe6ecdaab1c27d896ULL, 0xa8bfcd6f8157dd2cULL, 0xabf45d9d58d1446cULL, 0x80b413606af7d070ULL, 0x96a250d28e3d891cULL, 0x70b2a6288cba15b2ULL, 0xad06c6a7e77c34ebULL, 0xdfd2c83e6ec52f0eULL, 0x86ebe9b3074cd2c3ULL, 0xcca4ca0389fe6dbbULL, 0xd8a28ea15d5201a2ULL, 0xbbbbec90d01221b8ULL, 0xe059ac5de011b42cULL, 0xf7c003b2b663f77aULL, 0x6d683db1ecf673f3ULL, 0x9371a4137b70d60eULL, 0x03fb76fa65aefcbfULL, 0xa81ea1d8bcab664aULL, 0x71c493b6cab5b58fULL, 0x0cb3f866dc7d332dULL, 0x723f7324cad886aaULL, 0x7aaf237e7517dd46ULL,
+        0x9786c92d8cc53057ULL, 0x8dbd336f356851ceULL, 0xd165777a3515f228ULL, 0x49260f80f28dc604ULL, 0x114434313d956082ULL, 0xb28840c7eeb2c9d9ULL, 0xf021ab1219081a0fULL, 0xa9d3c91df26da8b8ULL, 0xd56bf31f710370beULL, 0x3c359f71d746c140ULL, 0x79fde51ea186a53bULL, 0x39841e05494e85b5ULL, 0x0167aaaf751faee0ULL, 0x90051b7e1ec71a87ULL, 0x3388fde48a6ffc30ULL, 0xb8438403e870b996ULL, 0xf7b6055dbf7457d6ULL, 0xc502931d71242d38ULL, 0x9516cad74d38ec1fULL, 0x7b129fa1864a5db1ULL, 0xbe25ff885dde1103ULL, 0x92479eff7abe85dbULL, 0x8441a83da091dddcULL, 0xf7032f55388b915dULL, 0x2c71bbf3b9664f28ULL, 0xd152f31901eacc70ULL, 0x6363f0d1d90b7b4bULL, 0x8252d97a09b3474bULL, 0x69062c0e60ba021cULL, 0xc3c85ec3d13ed12aULL, 0x6752bc98be85e653ULL, 0x336450420179cf04ULL,
+        0xe73317b86599c723ULL, 0x718ff60aefafaf22ULL, 0x73533eac75ce4373ULL, 0x68e7a88abfd4c459ULL, 0x9979e2fb9b258fc1ULL, 0x7470c81850192315ULL, 0xf2e9518c295e997eULL, 0x2915d334ce9dc1bdULL, 0x41607b553715de28ULL, 0xed92c6f8b21f7a35ULL, 0x16cf533319d93951ULL, 0x91633cfc45d72304ULL, 0x54afd9075ae9c7baULL, 0x669b9e633cce03aeULL, 0x266d2e85037d8b90ULL, 0x046454675688b1b5ULL, 0x08b244f93cb074c7ULL, 0x156ddfb33d73deb1ULL, 0x88637792f2fa8dd6ULL, 0x978ae898c916d223ULL, 0x1338f6ad2a149b03ULL, 0x4d62487f769c52c1ULL, 0x1506b0214582fbd3ULL, 0x057de65238bd7102ULL, 0x009ae45834bd8ae6ULL, 0x2dbb3031a4850ec1ULL, 0x08d69e285be164ccULL, 0x44b78f787491482dULL, 0x5b08c4963aeb3b61ULL, 0x3a443edb37459c9fULL, 0xeeadad3ae7e2b04cULL, 0x104cc3b444e80650ULL,
+        0x5b4499a191a568e0ULL, 0x4635deaa417b18feULL, 0xc699f4b3cec8034aULL, 0x9f80012cf517f61aULL, 0xb0ba41d098942cbfULL, 0x3f521bd92f5ae00eULL, 0xa4ce358708da159cULL, 0x73f6f83200034937ULL, 0x87465d950e8845e4ULL, 0x3d7cfa60406a92e9ULL, 0x2a2c881d19e5af8aULL, 0x9520da28899f8fe5ULL, 0x4e89a05eb63e291aULL, 0xa03532aeea03a26eULL, 0x13a6076699a798f3ULL, 0x711b97f08e79d1c4ULL, 0xbb367f93be720f1fULL, 0x03e4501d0d969b6aULL, 0x47874c99bbfd594fULL, 0x33d9bbedcfcae832ULL, 0xe581cb3a0f3b92f7ULL, 0xc5b3487fc2837ebdULL, 0xf9045bf83a8c8938ULL, 0x559879671fb56062ULL, 0x9b4872bb0402ee8cULL, 0xddf18d368e48169aULL, 0x3310053ed9e8c903ULL, 0x9efbc4a058053dddULL, 0xd0af11cedfbd9b9fULL, 0x8d39f584101e7938ULL, 0xc87f0aa1e1c0d9cbULL, 0xcbd605c5b1fbbbb0ULL,
+        0x88b2aa02887d51b0ULL, 0x8905b878b2b18670ULL, 0x9444c1d41694425fULL, 0x108318a3c58a0701ULL, 0xd505b27ed0b22376ULL, 0xa414e8dea5adbd89ULL, 0x3b84400f0726165aULL, 0x19e0ab77790a248bULL, 0x35cbf79462efb71fULL, 0xb86898a98cf894e8ULL, 0x2c32c1745d749773ULL, 0xfc1b1a0b74d8bac2ULL, 0x034a0658349ee7fcULL, 0xf0d78e1a0a7afa64ULL, 0x54e94bcf510e8645ULL, 0x6b8249bc45b394a9ULL, 0xcf30408f77c6dab0ULL, 0x5e4c550bd09a4892ULL, 0x5d93c8cddfeb53d4ULL, 0x7704024cc43a67eeULL, 0x35d4e59ceb43f30aULL, 0x681ef2c97c996143ULL, 0x1890772a9a72ae31ULL, 0x7c1cdde14c938fa0ULL, 0xb7997ea2260390fdULL, 0x846ee26ee2e6f367ULL, 0x3e40044bbbf8653cULL, 0xa502a4208b5fba91ULL, 0x901882fe32ae615aULL, 0x1384c0145d5eb60fULL, 0xe914fb191581aab4ULL, 0xc7a7ebaadb38e872ULL,
+        0xac551a93a7e38354ULL, 0x73aed0892454dd62ULL, 0xfb8fe80778825322ULL, 0x3bc45f7e7d2d65a9ULL, 0x1b2b85819dc402c3ULL, 0xda6978c3794ce813ULL, 0x6da6abc34ae07df2ULL, 0xc1321878d78a6d5cULL, 0x807aef3fc8b95e9dULL, 0x8cdb1854d33e80b0ULL, 0x7684fd66b56fc481ULL, 0x3e9688424f981359ULL, 0x7634f579a2fbb0d7ULL, 0xb887f2c0e843b947ULL, 0x79280301e75eeb91ULL, 0x527c55f037cc355eULL, 0xa91a69c6eddee31dULL, 0x374efaec166125b9ULL, 0x28270bc1f5b427ceULL, 0x94efec190240a269ULL, 0x3978c66ac5ef6afeULL, 0x576c889e783ffb73ULL, 0xb54df89fcdf8ddbbULL, 0x9fe1d25adbfc6cfeULL, 0xac6f8f580dbbb60fULL, 0x7003c4ee1016e123ULL, 0x14d5d226de1756f8ULL, 0x13ef36898613f7faULL, 0x71dd5548bf39ab0eULL, 0x3ff135bd87a4c271ULL, 0x713e7dbe4b168f8eULL, 0x313b6e448fcda19aULL,
+        0x3603108357b99b3bULL, 0x1a20ef0527f5733aULL, 0x07f14a9677dbcdbaULL, 0x895aa757ac9499b7ULL, 0x2c880eb1b1031e62ULL, 0x0dcda306ae602cffULL, 0x8630a0f0745ba8c4ULL, 0xceb3d34b645d7777ULL, 0x1129c99dab90200bULL, 0x9ceeb96a70dab85cULL, 0x5bc2d4329fcef8a8ULL, 0x833bb4e59b9f34e6ULL, 0x1107edbec27125bbULL, 0x0c2d1681592bb28cULL, 0xb18fd1cdc2e46732ULL, 0x4ed7861a6c4820ffULL, 0x9e2723a60026e83dULL, 0x388e1d9ec87ac7efULL, 0x02dc1715405b1d70ULL, 0xff8faf2d3eb82262ULL, 0xc82b475f6f60073cULL, 0xb0496d06186cd9dbULL, 0x57c325e0229c767fULL, 0x7d975dc8e7b38bdeULL, 0x5a70c67906a23a8bULL, 0xab4b96f84aa75071ULL, 0x9a8de43517adbfdfULL, 0x940fe985e8d063a4ULL, 0x5251330059c48ac2ULL, 0xcfe25e09dc40f66eULL, 0x2afb022aa7285d2eULL, 0x2538475ee3351bccULL,
+        0xeb555f7268d6828dULL, 0x80adf8603f4f0fd7ULL, 0xdf094c24da7870d0ULL, 0xdcee2170306936f1ULL, 0xd8f2f74ff1e525a6ULL, 0x6e820bb575ff490eULL, 0x792c27e5bf0a7495ULL, 0x24fcfb2d7e7db965ULL, 0x093236793c7111a9ULL, 0x7475b376ac3d3f5fULL, 0xbbd36106f44e1c9aULL, 0x5d83dfe3633fde79ULL, 0x787ce7e2a4aae49dULL, 0x08e0f8fac0d9074eULL, 0x38171d9b7ad47ed1ULL, 0x3e76ed5fff5cf3ffULL, 0x8b96d5c81d1874c0ULL, 0x084334d9981c5e77ULL, 0x62ab4a4a775b5a03ULL, 0xeb97b9804e662affULL, 0x7d586539c4b235f4ULL, 0x13b64b085254603cULL, 0x7f4016be534ccf53ULL, 0x44f3d3cbc385896aULL, 0xb32cf47526586abeULL, 0x5414c7de01a9f683ULL, 0xbf749786523ebb0fULL, 0x77e86d80afff44f8ULL, 0x0cc00d8928611f86ULL, 0x7d19d18407624d48ULL, 0x20d2ad7a9e600925ULL, 0x041a385fadf62e1aULL,
+        0x5c8f6edbcc4a75eeULL, 0x831016e7109b82d4ULL, 0xbb50d3f07482f4f8ULL, 0xbf21e818f7cf40faULL, 0x325f7e5221f657f4ULL, 0x31f9c39efd70f1d8ULL, 0x84ab63ee3179c6b4ULL, 0xca61803b9c469043ULL, 0xa9f20a465a0e0508ULL, 0x3bcc28598718298fULL, 0xbc3bf6fe4bc82dedULL, 0xfb190bf7440014a1ULL, 0xd484af2193a4def1ULL, 0xadde23b8c7aec84cULL, 0x76bdf8233bb66858ULL, 0x0ebb3178dc11392aULL, 0xe57d9755d665091eULL, 0x31874924014077dcULL, 0x8565a6ad006dd514ULL, 0xc3ee729983a8130dULL, 0x45d15aa65e7fdc13ULL, 0x1dde527dcb2a37caULL, 0xa79e4a71a793eb37ULL, 0x473a79b17b9e8f26ULL, 0x868bb1792dae8569ULL, 0xe4456257bf8204a4ULL, 0xb80951a6a4b08792ULL, 0x122cc8de2f65d19bULL, 0xfca8f450781397c0ULL, 0xf98ebc0d20e636ddULL, 0xdc6f8d36cd08b61bULL, 0x46ed557b576e0e69ULL,
+        0xfa613cc0e38beaa5ULL, 0x184e9aea2f249a0eULL, 0x44c1d87c5854d2d2ULL, 0x387dc9e8bdbe2377ULL, 0x9cc658dfeb53ad7bULL, 0x8e6418e120d79d11ULL, 0xd646d7e26a7a46bcULL, 0x535b4eda1bed2b8aULL, 0x332036a7428b64c0ULL, 0x9dde304b0282fcc8ULL, 0x0dd1dcecbc61eafeULL, 0x2b3cfde0474baf38ULL, 0x8978f8f42ced015eULL, 0x5425a408ba8701d0ULL, 0x09b13bf7b14c2930ULL, 0x220917b55ef09bdfULL, 0x2d56e38c7151470eULL, 0x4c70e60ced6521c0ULL, 0xdff5840adb1ba7dcULL, 0xe6ff502440a39b43ULL, 0xbee1d8dd13e88c2eULL, 0x620e811cb3422317ULL, 0xb543fd934b05d2a4ULL, 0x9561ba2ebeba719fULL, 0x83372342843c570bULL, 0x427ad6d571d718c9ULL, 0xa531e1316fae9d42ULL, 0x2cfef3f001290fb4ULL, 0x8bbaca44f20cbae4ULL, 0x0967b016abb1f960ULL, 0x81df905e7ab1c3d0ULL, 0xc572685e24c01107ULL,
+        0x57203c6e91cee8e7ULL, 0xf50c7c9a268bd379ULL, 0x43cf1219ef3df57fULL, 0x91b99fdecf47dbffULL, 0x2a9ce2cc3a53a743ULL, 0x448b105b3131a1a6ULL, 0xcca6dc6891ecf700ULL, 0x4ea0d93912e3fe05ULL, 0x05f3efae0d0712ccULL, 0x5b8f040c3516e59bULL, 0xb0881ca60fdb8cbaULL, 0x30223b47e75b8043ULL, 0x2a158a6df258057bULL, 0x695f25d53b132d78ULL, 0x2af5a8fd4b08c388ULL, 0xa47afd5f23639cb8ULL, 0xeaf63ed382a90115ULL, 0xd463d31e77cba839ULL, 0x43f82a4ce5e781c6ULL, 0x5bb740d6c054e989ULL, 0xecc734da9f2d0bafULL, 0xb9c2fe7a1e05d5c6ULL, 0x8df957454f0a428dULL, 0x22e4dd0cceb32aedULL, 0xa7296283148dac27ULL, 0x4a9f41d4e4cb9a0aULL, 0xfeeaec2efeb2b0cfULL, 0x77c905e532f1bc57ULL, 0xdcbeb7c3f71bdfb0ULL, 0x82b096e8e7977e1cULL, 0x7df1f580d06a3312ULL, 0x43f4f881b1039b2bULL,
+        0x2bad74e1278e12a5ULL, 0xa4aeb61b9d4237a5ULL, 0x2447a7090f12cc2fULL, 0xaa81e5ae957258eeULL, 0x2523f4183fd1cca7ULL, 0x5f2848eef89a6cd2ULL, 0x4501f8b204890578ULL, 0xb030f8839fb728baULL, 0xc4a7f7a559c9fa14ULL, 0xcf091eb0d6e1e941ULL, 0x5edb7dc1f266de61ULL, 0x6e1849d990a9095fULL, 0x0d434caf439fc053ULL, 0xc124cbfe99d24dd1ULL, 0xa8f1eff6bf4e10a8ULL, 0x09256c98b2c4fdd1ULL, 0x63834d5d8860a5e8ULL, 0xced95ea8d86b30b8ULL, 0x4dbc49c5c1034ffaULL, 0x4e12b75b2eb08b4eULL, 0x942424ef765a5f05ULL, 0xa2acf20dec18e319ULL, 0xf07ec0126c26d4ecULL, 0x1f12882844aa53f0ULL, 0x4169cc31ca09d4c4ULL, 0xf395dece78deef19ULL, 0x140f5d7147fc3857ULL, 0x1d9c9bc1e79d724fULL, 0xa9e3bf055b7c650fULL, 0xa30d1f15bae1322aULL, 0x9dbc8bb3fc62d5f6ULL, 0x1687e4b4fae6f87dULL,
+        0x000c8369cdfab26fULL, 0x0c8d14efcb3026feULL, 0x913d437c6dcca098ULL, 0x89e4c276e1a71184ULL, 0xafb434941c175da4ULL, 0x3e4732c212f209b6ULL, 0x71a02d0f61213604ULL, 0xab889133af8c3389ULL, 0xfdf57b0938e59949ULL, 0x07cedce73d28f7b9ULL, 0x211b9147a14b3eddULL, 0x8b8d9985e75daff0ULL, 0x4c27e420907b94b5ULL, 0x4d1de8ee98098769ULL, 0x1a78885ba60ec1a2ULL, 0x3154be9c48a91aeeULL, 0xc610e8529e4667bcULL, 0xa24c1b23dd73bd3bULL, 0xaa68ea1c24244a19ULL, 0x489ff9681d9dbcf5ULL, 0x75fd4673906b82eaULL, 0xd8d6ae4f3696f6f2ULL, 0xbce65977302e3a36ULL, 0xe4ed65f7fe24aacbULL, 0x17805e30c90aef48ULL, 0x03922c87d05d22b9ULL, 0x61e228ced33ff466ULL, 0x64f71e2c26086af6ULL, 0x761fa0503d91f589ULL, 0xc01d1a1009d81c55ULL, 0xd3a8a2eeba58454fULL, 0xac46d075fbfaa713ULL,
+        0xdafa773442d3c5deULL, 0xf5e57a5df4aed839ULL, 0x60e3bbb164163dbfULL, 0xbf2ca3fa8d31f704ULL, 0xf4234ceb4da787aeULL, 0xd419c6a64e94b082ULL, 0xbcf240218c7e8e34ULL, 0xf60a9ae309b2f7e6ULL, 0xf2263556030bd991ULL, 0x845193d3fb4e162fULL, 0x08bb234408e49743ULL, 0xddf9f47cf9f8dbe4ULL, 0x1905c968119d300aULL, 0xe8dfa7658fcab280ULL, 0xe4ac419291838e6cULL, 0xbed1a717e8ce7173ULL, 0xde9bbafeb5ff2345ULL, 0xf95127aa9369c562ULL, 0x5a75a4fcb5349617ULL, 0x10b32edf6435101dULL, 0x7867c892afb29b46ULL, 0xc082f347eedb623eULL, 0xe24627e1f0809228ULL, 0xd2dc17509fc08072ULL, 0xe60c47d9f898af77ULL, 0x29f393687a67ac61ULL, 0xb3f7a2ec680e99ecULL, 0x6b80d3f09c8773c2ULL, 0xb2357e7660c11f04ULL, 0x95a8c9254b5ff8bbULL, 0x9045cb14e5dcb9bfULL, 0xf610662cab7ea46eULL,
+        0x0eb46c309c789aeeULL, 0x5525c194e4c04652ULL, 0x5a56f9190b664601ULL, 0xee40602198a45889ULL, 0xb9987d8d03a866b5ULL, 0x1ebe18ef0b15b48aULL, 0xcea3bcb609f3c5d1ULL, 0xf994cfdbd8fd99f2ULL, 0x9f119c56bec64118ULL, 0xe480c0980b087fb2ULL, 0xb8ab39aedc5da774ULL, 0xd82836d7479d6da0ULL, 0xf915c7987e94b273ULL, 0xe92da6dc79b950f4ULL, 0x569743ea493e9bb5ULL, 0x9b40e6f72dd29fa7ULL, 0xbdba3e96a7027f1aULL, 0xea753dab031ff7c5ULL, 0x868c7c6e1992b36dULL, 0xcce7d7819868f7b4ULL, 0x9973135d10dfac78ULL, 0xa2e21d59f3030648ULL, 0x24bb869a70d8db56ULL, 0x247a8490fbaaadcfULL, 0xeb526730e521dbf1ULL, 0x3ad4469c51886d30ULL, 0xfe9cb98530a465f8ULL, 0xded735f71341d254ULL, 0x7a91bfb447046745ULL, 0xa36c3f28009dc8ddULL, 0xe8c5429e2ddd9bd7ULL, 0xf172e7c039e5762dULL,
+        0x8d4fbbd19525ad4bULL, 0xb66699bebd5522bbULL, 0x63d97b057de16c92ULL, 0xdb3a36e2a24d6808ULL, 0x0d2ec866b5eb51c6ULL, 0xf1b9911fe29a5608ULL, 0x31f49958498461e6ULL, 0xf15057a9f487e3dbULL, 0xc502d147d5346f48ULL, 0x0679631e21c07d1cULL, 0xfaa9e7a3a0848fd3ULL, 0xb560d88d929254c6ULL, 0xdcd8762bfb0ea458ULL, 0x1ed9109c25a51286ULL, 0x9daf66ffb40827f2ULL, 0xa57b4bc0f359f66bULL, 0xc94bf5567947edb9ULL, 0x49dd34889a1ead5fULL, 0x83e848273e2a900aULL, 0xcd628acf0894f1ebULL, 0xf57c8df9de00ecbfULL, 0x14a35095a03bcff8ULL, 0x24816049b51ff7d6ULL, 0xc946691de432f371ULL, 0x2ca1868d3ceefe28ULL, 0x6b60db95f43be445ULL, 0x17e0eabaa7a1557aULL, 0x2cd4db3e08595ed9ULL, 0x49d4227793c49170ULL, 0x03fba95e4c46134dULL, 0xb3feb001ebc98717ULL, 0x61f79323bd4d9a93ULL,
+        0xe5815d764000e077ULL, 0x277e16a12b002ca2ULL, 0x9878dca05dd9f0d0ULL, 0xc8d1b0b39ffdb062ULL, 0x94f47cdd3f10c22bULL, 0x82709a25e34a6c5dULL, 0xbcb3d63e03f33b5dULL, 0x5a2bb4d12738ab10ULL, 0x3c0c5100971c098fULL, 0x4bea21e78540f8cbULL, 0x7f13b5d4f4e0e6bbULL, 0x4615f53c6575bae5ULL, 0x961b94ce0223768bULL, 0xacfc5c2a118bd8c1ULL, 0x9dd0dcba38e3d64dULL, 0x3b18d29f753ee905ULL, 0x1d9c2d1ff073ba04ULL, 0x5708ed7cbd7a44c1ULL, 0xe1e5a9144d5c6e3cULL, 0xc95cf3cd9a7a976bULL, 0xcfa4287da8a47dadULL, 0x97886ba1bd8d86c3ULL, 0xf148e3539bbe7030ULL, 0x1c42dafafbf29cdaULL, 0x8c2815bb31df5b67ULL, 0xb765d29a83e57090ULL, 0xaa5544ab8f9e81d4ULL, 0xca5e348d7f18e965ULL, 0x3693591f58f1037aULL, 0x040a144dc7537943ULL, 0x1b538a06dc8c7999ULL, 0xb3f9f02e8ef3e1acULL,
+        0x3fdb82eb67ff84d9ULL, 0xe2d0b76b20e85161ULL, 0x6bb6097abc5c5826ULL, 0x181dd12358e2bb81ULL, 0x751c63c87d00b169ULL, 0x5251fa58558012d2ULL, 0x74365173a220df22ULL, 0x8f42eae17e26230eULL, 0xd29c1f430c3f978bULL, 0x352fa59344841d99ULL, 0xaf059c22fcb74f37ULL, 0xc14a8f9d4a812ab6ULL, 0xe755c04a4eaba873ULL, 0x8df03df5d002d98fULL, 0x4ab75dfd26463c88ULL, 0x7853a2a471a4f9b3ULL, 0x2bd4a4f9a17be658ULL, 0x556fc40f836ab3c3ULL, 0x64982dec783a8ee0ULL, 0xc75041bfc752402cULL, 0xb7de2bba6c1627a4ULL, 0xd47003be03d61537ULL, 0x79fa8095d04cd087ULL, 0x1f32820c2a5e6038ULL, 0x163335eccfcfb893ULL, 0x4a569d3faf936908ULL, 0xd86ec9602ae85ba3ULL, 0xfe988adc0f1a4050ULL, 0x20ec706e8849150aULL, 0x1c2131ad2bc0d8abULL, 0xa659bb4c709c8f22ULL, 0x3739d815fa6f540eULL,
+        0x38281201ff103a95ULL, 0xe4f65e1c61588120ULL, 0x062ac3be6dc5807fULL, 0xd79c45c14911852bULL, 0xb0bc35fa1efe25c4ULL, 0xe203588b76367980ULL, 0x23d2c60ec9fdef2cULL, 0x4a51bb28ad253c60ULL, 0x9784cd30b0741e3bULL, 0x879275e2fbfcfb48ULL, 0x9bbef75b357399a2ULL, 0x65577be49cde02d7ULL, 0xd2dfae6c3ff02d79ULL, 0x0adf12e577094a41ULL, 0x649bf61817d8741fULL, 0x8a511d735703890aULL, 0x5639aca4196d3f9cULL, 0x74e766f00c5573cfULL, 0xc681fe9c2b10d8f3ULL, 0x2afb7360dec9df1dULL, 0xa959a594343b986eULL, 0xfd43fe9378677a46ULL, 0x5f2abd906e8d08c4ULL, 0x85840561a42e6a76ULL, 0x1b5c588c20993667ULL, 0x6295c50f122ecc40ULL, 0xc634eb09893d1d4aULL, 0xd57cba13d0147e57ULL, 0x181c239cc55c87e8ULL, 0xd0a1d4b085c3b7f7ULL, 0xbb022225a3345ce4ULL, 0x0801864e0535e117ULL,
+        0x09fd32666ff6aa4cULL, 0xdec1969893546491ULL, 0xa9474957ada382b3ULL, 0x9ce7202422d9f45eULL, 0x7c542fc41cb640aeULL, 0xef2efca5962e5604ULL, 0x25f1354a022ccee9ULL, 0xabfc7e29289a9c8aULL, 0x7ce8a36a3dd9739fULL, 0xc0db751a6610354cULL, 0xe1629417bb0cd25cULL, 0xefd6d0199fb51225ULL, 0x8fae4ea27dd8d957ULL, 0x097e925c143590efULL, 0x05b6ff2b0c873a15ULL, 0x25405f340e309c69ULL, 0xf199de7446a2620eULL, 0x5c4c4da1fd47f90dULL, 0xa62f5b1122f16fd5ULL, 0xa99c4f7e8fb08ce0ULL, 0x710cb312ca80b019ULL, 0xab14de7acce07c64ULL, 0xb1bad645098bd95cULL, 0xd582108dea62fc1bULL, 0x39e0030edca831beULL, 0x6cf5e8560e678fe2ULL, 0xd2dbd8301cdf54a3ULL, 0x76b4861a9b4ad645ULL, 0xb600393cff31eb68ULL, 0x9f1fb0b4daf09b62ULL, 0xe5c3d9ead2486248ULL, 0xad1a16cce690e0f9ULL,
+        0xb91a7dfa2fecd1f8ULL, 0x16da6e121655b8deULL, 0x7f27a28757fbe5ddULL, 0x1e66ce6fcda8d838ULL, 0x9055c0aae176f3adULL, 0xbfead5dd3c78a5f8ULL, 0x8688ae75a72beb94ULL, 0xd700679565cb054dULL, 0xa235febefa466999ULL, 0xa7d9efc077e71ba9ULL, 0x32701720589ad2cbULL, 0xb8829e87a8fcffceULL, 0x3d5c34d031b6dccfULL, 0x940d73570f0403ebULL, 0x8a32aa3ad8bb0729ULL, 0x1b3be684d8c928cdULL, 0xf147daa25b95cbe9ULL, 0x00287fd23cf2351dULL, 0x1a492fd3044aa3bbULL, 0xe574adfdb0934cdaULL, 0xc516e414166065d1ULL, 0xfcc46fdd9b14107eULL, 0x9d7f4186170510e0ULL, 0xded5fd8c961db606ULL, 0x3afd3266d61cc2a9ULL, 0xab5f2fd1344be86eULL, 0xf2818b8832d0242fULL, 0x5c7a1236b6be8445ULL, 0xdce0e599c2b20b6fULL, 0xf7d28e3e1386c30fULL, 0x185adf85a7f00bb9ULL, 0x1cab123d481dc578ULL,
+        0x87eb2124447848d6ULL, 0xb7cdf1bdddcde2c4ULL, 0x820c48ff620424e0ULL, 0x89d5382fa81fc6b3ULL, 0x16904b808dff7a40ULL, 0x2fc0e58217859d4bULL, 0xb919c521398f4553ULL, 0x301d971c3d8daaecULL, 0x2fc3470331276d60ULL, 0x4158dd456df803ddULL, 0x617ca88199879f04ULL, 0x214dbf095ae60eeaULL, 0x7939bf726702bfabULL, 0x663b646c9c78c4e1ULL, 0xe5522c53e4a5f831ULL, 0x9e90c955c8ee055eULL, 0x1a1a15734e1ef1e7ULL, 0x992f2ced4b338b6cULL, 0xbcebf7fd8d591ca0ULL, 0x8e0faec959aeee3fULL, 0xa83b6d7686c42b1dULL, 0xfbea36bca07edbafULL, 0x7847f466715b8fb1ULL, 0x62d283a9eb6944cbULL, 0xdf7ca851123b78e5ULL, 0xb51f6379bc439ed9ULL, 0xeac2906bc6998ea3ULL, 0xc6c50c5fbfa0d4d2ULL, 0x65502b18ff9f94e6ULL, 0xeb8148eb316123dbULL, 0x9a14d32b3297d0c5ULL, 0x6527872ec54bf611ULL,
+        0xa0338fa6255c84f5ULL, 0x70597f075b3a516eULL, 0xdbae6943804f166dULL, 0x3b9882ce881f83a1ULL, 0xd60c287a0d5b024dULL, 0xf6193804e9b898a0ULL, 0x37c853878b4c0d3eULL, 0x9233d5d15dafd4cfULL, 0x438e87af6682035eULL, 0x4701bc80b353333cULL, 0x37d897511f522f84ULL, 0x24b81e562fccd94fULL, 0xdbbffabb3f4a42c6ULL, 0xe422e4971cdabfddULL, 0x29f7037795dac0b4ULL, 0xad392af894c2b383ULL, 0xfc13328be3ffe875ULL, 0x7d5119c60b8fb3ecULL, 0x22a457dcedef8bfcULL, 0x45e527ca1d3ecb77ULL, 0x028326c0e913d8e7ULL, 0x7cf5dd7042ac9cabULL, 0x3ac9b6ec77c6cf86ULL, 0xe841a59a71c46500ULL, 0x7e29d6c415d6fdc9ULL, 0x6ef51d5176f2fd26ULL, 0x57ad5da521ef33c5ULL, 0x13ed4120f407c317ULL, 0x29d9f65d41bc8f10ULL, 0xf96c38a66485af20ULL, 0x5cd252b95fd7905aULL, 0xb5f6402a39087180ULL,
+        0xb7e66b6639ea4243ULL, 0x9b58f41f216907c2ULL, 0x94307c802b299322ULL, 0x30ff52573d389915ULL, 0x562cee26d68be6eaULL, 0x3a092b39e16bd8cbULL, 0xce62701fb683ebb3ULL, 0xe5edfb76a2543027ULL, 0x4092065ddaf1c512ULL, 0x1192cb2f28a2e4beULL, 0x3866f1ef11afa2beULL, 0x2f1e643b4f414fd5ULL, 0x83729e5b85aa80cfULL, 0x9693664d6371551cULL, 0xd14175b27d4f2373ULL, 0xf22cba0dc8fb6e2bULL, 0x71e4fec2ac1a2831ULL, 0x5a47b69099b996ddULL, 0xf5e71a9a494d7a5fULL, 0x56621c204e25d55aULL, 0xe967788ea7fc3118ULL, 0x9bf3b613cc433d4eULL, 0xaf7d39529ff0cd7dULL, 0xb7f3cb8a9441f69cULL, 0x8f8810a836916186ULL, 0x777568b579905633ULL, 0x3aa0a7006df6fb79ULL, 0x698f4d389af55c44ULL, 0x325b029cd2781d4cULL, 0x82eb43729d2a971cULL, 0xba8b8e1aeb95cbbcULL, 0x294772b164bcf692ULL,
+        0x7185bd6425873baeULL, 0xc19d752efd07f022ULL, 0xa1a9f99a4691ddf8ULL, 0x79af26b0a1d581f4ULL, 0xcecba3053af6ea58ULL, 0x81d8194c100ac0f8ULL, 0xb9efa9a09d6e30a9ULL, 0x72d48103e3cbfb24ULL, 0x73c598037e3c0ee8ULL, 0x1e8ff58934a12e3dULL, 0x5f6171a994c0dffeULL, 0x15d8671b64b87c57ULL, 0xce33a0aa4837bad5ULL, 0x7051ce1c0206dbe8ULL, 0x172ff7bac59ab30dULL, 0x59b1ad712e0cff99ULL, 0xd0e365cd2bcd799eULL, 0x10cf72054461f0b6ULL, 0x05d6eeb5e5d14ceeULL, 0x4ac5f224e379b85fULL, 0x3f07baaa74b12f7dULL, 0x795b6bfab408c555ULL, 0x1447b7efbedd1ae1ULL, 0x370ae36ea03fa620ULL, 0x6f0ec35b4668e9dfULL, 0xc3ff75da474935f0ULL, 0xe315b9ca566aacc5ULL, 0x684556c90dc1fc8bULL, 0x667ff1b03ee98804ULL, 0x91ae55852afa9b04ULL, 0xd7b11ee982e54d0fULL, 0xc16e5a2182cb0bfaULL,
+        0x319cbca985e63de6ULL, 0x9b30b682cacf0b8eULL, 0x74aea298fb0a56eeULL, 0x641f51fbdbd32233ULL, 0x8ec06e377ef93e52ULL, 0xa8191b16ff787fefULL, 0x474d00816b46e8e0ULL, 0x705a383767d8b2e2ULL, 0x7541f6e9a0354604ULL, 0x271fae8632ae429aULL, 0x5ca5b465b82a88d8ULL, 0x5480baec0386cb54ULL, 0x65b7efaa65b20e9aULL, 0xce115f1f85b9e1e1ULL, 0x341bbeaa756bf35fULL, 0x68b5403eb2b89c7cULL, 0xb6a8949cc010eb5aULL, 0x29be465ede520adbULL, 0x3667938dd9861ba1ULL, 0xc3d829a5446b03f1ULL, 0x39f457ac14c41f86ULL, 0x2d622f92fd622c6bULL, 0x19b968fdeef40351ULL, 0x3dc881c183b489aaULL, 0xe3c805d1c7f814ddULL, 0x3f08e1a69ccfb385ULL, 0xc630eee3039ce03aULL, 0x32f68d64fbfa30ffULL, 0x2cda9ad80dca071dULL, 0xb98d8a20517ee099ULL, 0x0a762685587229dcULL, 0xc5723a4a97e760a2ULL,
+        0x5218534b91ca164aULL, 0x54224990af962d83ULL, 0x08fa7160b2b81a1bULL, 0xfaada92b0a66d526ULL, 0xa51b7351bc6828fcULL, 0x7cfe650c690253d6ULL, 0x59638f596a4f80bbULL, 0x890ae9e377c1e9ffULL, 0x7e2cc3245a10fb30ULL, 0xe55f16f7ebd732e9ULL, 0x874784923ed70a11ULL, 0xbeccb7640c91e2f6ULL, 0xd2d6026769698f8fULL, 0x4baf17532a083919ULL, 0xa848133c50c7a3d3ULL, 0x80c0befd1d35cf09ULL, 0x69e48e988f2193dfULL, 0xc23248cfca9aa1fbULL, 0xa299cf2fc6bb56faULL, 0xc815d0edd682cfafULL, 0xd68a9ba20294905eULL, 0x31cfd9ed56a085a4ULL, 0x1cf0901c3c301ce1ULL, 0x2d2c4ff1847a022cULL, 0x14c75c810d17e75aULL, 0x7e21bb157e26cc31ULL, 0x0f0df90965aa3599ULL, 0xbd4fb344b4af8248ULL, 0x69e820012819e801ULL, 0x520c9c4ff1e1ce9eULL, 0x775f053b57bbaf77ULL, 0xa256ab942fed0446ULL,
+        0x86c1605a8e87935eULL, 0xdfa13c1f87409f01ULL, 0x5316917fa7eeabb4ULL, 0xe8877295f95817b1ULL, 0x31f90505c5992563ULL, 0x75e895e15af4ce57ULL, 0x18a9d17f190da9d8ULL, 0x4062493c37d2ae35ULL, 0xd3dd06067f50371bULL, 0xd5327ed478dc0305ULL, 0x849d6507912c3255ULL, 0xf556c8a3c19737dcULL, 0x595c49e66e5eb678ULL, 0x69cc06cc96f29ca0ULL, 0x815968e49c07300bULL, 0xaaf15ebad30038dfULL, 0xd30cd5522473242eULL, 0xeeef32b744c35ae1ULL, 0x94a6014bd0f04d59ULL, 0xb4e4b86ea35ba822ULL, 0x6f29d020b0d4b94dULL, 0x5c3b03fc36f3f458ULL, 0x5a5aa47f5e3115c3ULL, 0xb66e77fc57faa709ULL, 0xc75aac438092e382ULL, 0x7d8a5cc223ca360dULL, 0xb7d859ff922879b4ULL, 0x6d6682fb316917ddULL, 0x22ea37dba383990dULL, 0xfe1a0c3d87b7c07dULL, 0x787c6955bb48e243ULL, 0x39ae7d737be0461dULL,
+        0xd2b32b9d2df7f6e7ULL, 0x1b820b6bd4a6fe52ULL, 0xccad5b2acc0be70cULL, 0x84eb995db0ac131fULL, 0xd01756042bbcbab1ULL, 0x206478aee5e80232ULL, 0x770469ef46c95e0bULL, 0xf61dc7485a7be69fULL, 0xf4183b770a989a08ULL, 0x5851a20749cd48aeULL, 0xd2de9a6c68e95f0cULL, 0x569cc4812c0f0ec9ULL, 0x83527406164f4f4bULL, 0x376b8e18c9144714ULL, 0x60ec67801dc9d41bULL, 0xa1493b2f63cb963bULL, 0x5db45b9b77413dd4ULL, 0xb9097a62efcbfd54ULL, 0xac349866890d443cULL, 0x386c4d27617601d5ULL, 0xe9c82b85d04dc345ULL, 0x21fa63987ac1c11cULL, 0xc8f03c0d7e2a6b7fULL, 0xa53acfe126730b10ULL, 0x0f59685f184baaefULL, 0x22eafa9537cf9a20ULL, 0x7a51b7af80d06bfdULL, 0x878e5ab3bfecad65ULL, 0x9d4b67309b11b866ULL, 0x09cd81c521f02dc0ULL, 0x29913aa639036038ULL, 0xdb1a4a99d434bee3ULL,
+        0xc7ddd993fe8a1626ULL, 0x69c527bbb55803f1ULL, 0x1acde79c1f03a2e7ULL, 0x6f04ed13b6601d6aULL, 0x61db63503e7d04edULL, 0xcc88b6d948141944ULL, 0x977968a3dda9f275ULL, 0x76de1ed9fc63e6e1ULL, 0x4cc1a41adca10b77ULL, 0xd50cd180e1cab8b4ULL, 0xb6f73190b96a96f3ULL, 0x8a56dc3f23f5dd7fULL, 0xf8bfa1fd7008e4daULL, 0x801a0ef852227fc1ULL, 0x108214badf38bc39ULL, 0x7e8e080f0affc98dULL, 0x40dd54f495b0e573ULL, 0xd33ac2f273815825ULL, 0x8241c7c1f47b7236ULL, 0x4365fbd4c3a3710aULL, 0x0d62ab6a1310537cULL, 0xff6319e5b7ae579cULL, 0xccd3048e1fa53a63ULL, 0x9605e5a154ff7bf9ULL, 0xb2dcaf318e225e1cULL, 0xcda4290d3c0df31aULL, 0xc5f91e3e103ba349ULL, 0x1d77c19f61f03fb6ULL, 0x0afe6195dcc955c6ULL, 0x69ec17a1e0eb296dULL, 0xed6a75b62c119ccfULL, 0x359371951fc593d3ULL,
+        0x238d51686d0b7dd8ULL, 0x519d475789cca0b5ULL, 0x9f66b42cdf52c48dULL, 0x308238d1906485b0ULL, 0xdc69eda52068d9e1ULL, 0xb59b73bec7b3a143ULL, 0x61907f39cc94b880ULL, 0x2afc7f1ca03afab7ULL, 0x6c36a758aff63256ULL, 0x0bffed2c73f6131bULL, 0x12db79a2845cef59ULL, 0xb97c9370c09a1b7bULL, 0x508d22418839e1a2ULL, 0x04b17fd67864e6a8ULL, 0x0b89c0eee4b58f0fULL, 0x84123d2dec2c8b86ULL, 0x57fc37fbae1e2f0fULL, 0x995637e0301f26c1ULL, 0x90b37afb7040fd53ULL, 0x0023806c787ea1adULL, 0xd05426cb91606d47ULL, 0x3d420c0ffbe21bbfULL, 0xe310276e4e4c71a4ULL, 0xef196e43985fbcc3ULL, 0xfe2b57e79e09687fULL, 0x5e4d70219c26bcbcULL, 0xbe355a253ecd3061ULL, 0x5646d40e1621fad9ULL, 0x0a700fdad4c2a5b8ULL, 0x42ff9aa8c65409aaULL, 0xb629c9fdc0545232ULL, 0xef1f43cc02c43de2ULL,
+        0x3286d889edccf323ULL, 0xf7ef1f0c8effd63aULL, 0x84d76dc3409c89d0ULL, 0xc00631d5e63dc28eULL, 0xa2027cc591adfa0eULL, 0x49e0be056504d6b7ULL, 0xc05f984acf2fa3b8ULL, 0x20492ddbd03ae4a6ULL, 0x1d6f53d4a34ef17cULL, 0x7abe04897a725962ULL, 0x85f80eb823fa399cULL, 0x68ab79677acdef0aULL, 0xc97f64b6f9b187adULL, 0x1171957367cd07feULL, 0x88f118364383e93fULL, 0x56a3e020b739a678ULL, 0x5d79feba4bd3dccaULL, 0xff675af3b27b0f94ULL, 0x93a86154e8f251d8ULL, 0xd648c1a3e615a07aULL, 0xfba801181a250e32ULL, 0x4739af754b9d79ddULL, 0x3b54610d5f2c69deULL, 0xba5f463038cc4221ULL, 0xad6fa0e4fe4861aeULL, 0xa64f94fc64467c82ULL, 0x7301c5934cd443cbULL, 0x2ffef5aaa173024eULL, 0xba346184dbba2e44ULL, 0xafddbe035ae3ad3fULL, 0x782b0e6d47c0c830ULL, 0x390eb2e305581e50ULL,
+        0xc4792275854dbc23ULL, 0x6c0e4777dfa530bdULL, 0xe4e9f2da10e00a19ULL, 0xbd2b8387047d1d89ULL, 0xe29c0f620c1bcb06ULL, 0x4ec8bd6ab0c636beULL, 0xabd78616a57f5ed8ULL, 0x853609a140cdf215ULL, 0x89871601ba8b745dULL, 0xdc0d2f5029767536ULL, 0xc3e65c6b142dba3fULL, 0x9c2f2b81c97cbd6fULL, 0x692dc2334336b988ULL, 0x8840f285675905b8ULL, 0x92a192bc2eeee42bULL, 0x85f95810b399d6daULL, 0x9fe595a2dc58587bULL, 0x931ac4c7a53bd074ULL, 0x670479505315aee5ULL, 0x91f4ce814bab117cULL, 0x359eac14076857e9ULL, 0x8a3a04206588185bULL, 0x4fa499bf584d452eULL, 0xf9c632f40d8ed0c0ULL, 0x8bc567c013d26adaULL, 0xb098757f987fef00ULL, 0xfff529f0cee9a34cULL, 0x568e584a4facac38ULL, 0x423b8d62fb79b3b7ULL, 0x67b336c29f17d9a1ULL, 0x9a21d0a7cbad1272ULL, 0x89162a4475141834ULL,
+        0x10b70240d2f2ae6eULL, 0xce2560777ad98389ULL, 0xfa40cc9ab5a25f77ULL, 0x270ada6185b790dbULL, 0x2d81126c01fa3c15ULL, 0xc568297dfcd49d81ULL, 0x16637521cd7a4430ULL, 0x9628d98a5ba08697ULL, 0x60a4953320803cb3ULL, 0xe90e18825e042e1eULL, 0xfd3e797b984b3bbdULL, 0x693617d942f3744bULL, 0x0e12151d47c26b08ULL, 0x9bf290f02c9e3803ULL, 0xdb5931f4eed3d204ULL, 0x6a1154c5715bbe91ULL, 0xa5480b5b8b17730eULL, 0xf83f2938df4e4a0fULL, 0xca6daedb83486a02ULL, 0xf234af1fa17633e2ULL, 0x1804493c0944cf79ULL, 0xcc030e32af5f387aULL, 0xd4e3274f84dab2cbULL, 0x9644a89e15d921abULL, 0x2a5c392522d120a2ULL, 0x211e21608c1e3689ULL, 0xe432fd75dcfa531fULL, 0x48875ce979b9a9eeULL, 0x31b7cd0be12bc7caULL, 0x0a9504b35c041c11ULL, 0x0c8eb325f8847b88ULL, 0x44fdd7f0b23f99f6ULL,
+        0xdd50e8e8847c5c57ULL, 0xa5d27db11e1d56f2ULL, 0xa0e3420cfd4207d6ULL, 0x6eaa289584e10928ULL, 0x3f79901c6e1d8d6bULL, 0xe7f7efc2d8976b23ULL, 0xc6639158b51527a2ULL, 0x812a78c61cef3440ULL, 0x31e543b194ba2c31ULL, 0x8574addeed5f8c0dULL, 0x423fc763f7117523ULL, 0xe9c0d794e9a1e901ULL, 0x207a46e2037a69b1ULL, 0x24581245d2a7622fULL, 0xc0603daed871df6bULL, 0x3ace3b6e6d8df03cULL, 0x3d2a0df8325368a5ULL, 0xb85b551ebd319a46ULL, 0xef5f28a1dc0b1165ULL, 0x25ab9ff1055601b8ULL, 0x661328e8d7109647ULL, 0x5fd4bf15b69ae76cULL, 0x506da4b279809db4ULL, 0xcd52958eea22f0afULL, 0x315c374665251fecULL, 0x912c35437b15f63dULL, 0x700c502757d5c198ULL, 0x57023ce596eba6ffULL, 0x014fc4364f5632ccULL, 0xcbcc367f8b775ab3ULL, 0x0d6b664c0e0ec4a4ULL, 0x76ebfeeb27501064ULL,
+        0x1354bb453580e601ULL, 0xfc74582ec63d206aULL, 0x39dd1c311f76fbbfULL, 0xa18514a4db8870fdULL, 0x618865300e9a1835ULL, 0x4d35aa6610282690ULL, 0xefc401a516e00337ULL, 0x42dd013eea8c2b83ULL, 0xbfbba6764d8caf8dULL, 0x0fe3d1150bf2ec91ULL, 0xf1055495cc42cd54ULL, 0x6e99bf45101370ddULL, 0x947f385cdff184d6ULL, 0xa588833891f0c963ULL, 0xa12ee598f7bb14ffULL, 0x177928fad4c5bf1fULL, 0x0ba870a21fd07ed9ULL, 0xfab44de44a717e81ULL, 0xf42916f64b09342cULL, 0xdb36422b5fe18dc5ULL, 0x9f72f2f49a3780e8ULL, 0x2567e2c647e3dbbcULL, 0x421db53f4c4e03b7ULL, 0x04c24b194979eb3fULL, 0x3a154bf6638b13caULL, 0x9224ea1d8a1f6ff1ULL, 0x60634cad50e6a547ULL, 0x290589e5295f2d0dULL, 0xbfb09d67d43b7e74ULL, 0xf6e0d8caa0a6fe6fULL, 0x6de5b45cd2a3820dULL, 0x34d37fa61f652ee2ULL,
+        0x2829ff3ea87ebe21ULL, 0xdc7f0a20cbc23893ULL, 0x796ee03d64e2a97bULL, 0x76d03106a5593138ULL, 0xcaa43c634e5183cbULL, 0xc400b9055ad34991ULL, 0x41585a6eda2ae24bULL, 0xef7cae4066339225ULL, 0xf59e4c28c868ee4dULL, 0x453560986808e10eULL, 0xda94d4fabda3664cULL, 0x6ceb4855bbe43a2dULL, 0xcc167f358d175761ULL, 0x88e5a277ba158abfULL, 0xed4af775a604a00bULL, 0x6ee8cc177905e598ULL, 0xce9787367c3f2f51ULL, 0x9a3652cced8aac3bULL, 0xf97d0417eee0ea77ULL, 0xe85651bc1dd2724eULL, 0xf64d280aa537cacfULL, 0x2459fd2c9ede6b4fULL, 0xc525bb48f335c166ULL, 0x5ebec494dbc2b651ULL, 0x946985b4c3dc39beULL, 0x631c7f95b122c1a5ULL, 0x9813253de06a8351ULL, 0xf99c1a2bba4ded7fULL, 0xa5e082e07c0da172ULL, 0x8cea65454f319f1cULL, 0xfc39fb442fadd8baULL, 0x31cfb5cb50ef00e8ULL,
+        0x18c853485e5102c1ULL, 0x486e974eece80340ULL, 0x04099998d8d8c3ceULL, 0x8c84bd2294f4a7e2ULL, 0x7888e5f7fd13afacULL, 0xaf365cb8275c2229ULL, 0x3fd95e99399d7ea0ULL, 0x14267c9ab168e270ULL, 0x7a0f204e95b1d862ULL, 0x435c6f3d6ac50d5bULL, 0xcec4438e63081265ULL, 0x9e19ac65cf5ce5bbULL, 0x8eb9ebe72f415a1fULL, 0x14a9d7a5b11a0ad7ULL, 0x4fff6b22e70ee77fULL, 0x9c2e27146d8f2058ULL, 0xc7dc6f964c912efaULL, 0x662173ab178d1378ULL, 0x551aa8393c7e60dbULL, 0x3a88e5e0d0cbf9cfULL, 0xe304a4777398d59fULL, 0xef8b625dcfc52624ULL, 0x94c381a285ffc6b2ULL, 0x59a9ccf941a45d4bULL, 0x4fc5e8288f8762fcULL, 0xd843f04992837c67ULL, 0x6b756ea1406781edULL, 0xbff868b4f98dececULL, 0xc263a039dcac58aeULL, 0xcff0f610fdc49135ULL, 0xb8f30f95686d8a99ULL, 0x5518355e36cae10dULL,
+        0x92afb7b854c74ac7ULL, 0xc6103573e7053c61ULL, 0xe8aff4b4348cf01aULL, 0xefc6a4cc261dd546ULL, 0xbcf01efaa23788deULL, 0x0cfd53ef0c07dbcbULL, 0x1be171ebfe4167d3ULL, 0xb41ccc7c956b8f66ULL, 0x28635eca390b7839ULL, 0xc7fbe5d22a12d23fULL, 0x1731ddfd47b880deULL, 0x80c7215e1165a853ULL, 0xf5d230338a579f6eULL, 0xd8aa49eef7a35ff4ULL, 0xcf58b97ac31266acULL, 0x4f6c6d6c256c7211ULL, 0x276e15ea22a80f26ULL, 0x38e56ef9c6a55d4cULL, 0x25d09535ca8265b7ULL, 0x7067b9634e306057ULL, 0xc8757d00f6218a7aULL, 0x8b3f43daf6e04f09ULL, 0x53ffe9226c5b0fecULL, 0x06f941b7fab840ffULL, 0x89327c65f382f8adULL, 0x4dc5d04a477a3060ULL, 0x33a057d61ffcc9c6ULL, 0xc932fe4c51a72567ULL, 0xed3addecf74e2354ULL, 0x5690c3f13dc94ea6ULL, 0x93ab93baf41ef826ULL, 0x77ecd1505fc589c8ULL,
+        0x0d6395848cad181eULL, 0xfadaa83059c0b9b0ULL, 0x9321471b77d840a2ULL, 0x8a19802967651ec7ULL, 0x73f98112682fae23ULL, 0xaec5e9707a72276aULL, 0x59872e49fb351218ULL, 0x20bb995655704291ULL, 0x8bffd11a3881d691ULL, 0xac7038155c773016ULL, 0xa73b50f953738f03ULL, 0x394ef21f4508fe07ULL, 0x576abc60e794f94eULL, 0xe97ba4a33ab249c9ULL, 0x7400be7f08674158ULL, 0x36db17aa40853123ULL, 0x7972eed0fe30fec3ULL, 0xff5aaa9215d2bda3ULL, 0x5a10401898ddb47eULL, 0x3f0207b10f6bbbdfULL, 0xa31ac8dfacc677fbULL, 0x7b2b8edd6ae8c99eULL, 0x22a093f0e99df3eeULL, 0x24ed28485b201575ULL, 0x8357ef1e995ec1a8ULL, 0xbb725bc82c34c2b5ULL, 0xdd5973e529400ebaULL, 0x30be39a6d790e6fcULL, 0xd6d74f6aa2fc0f7aULL, 0xc2d96a224be71af0ULL, 0x077cd17322238528ULL, 0x0246a0bb0e7f7c41ULL,
+        0xfb08bbd2977db6cfULL, 0xdd773dfc3248e36fULL, 0xb3e4795aee662923ULL, 0xa409a32eb261df05ULL, 0xca1c1ae83a59091aULL, 0x3cb960c5c72bac89ULL, 0xd18006dc473fa58dULL, 0x64c763811d23a932ULL, 0x869b18faf578d310ULL, 0xcf5276e80dec3874ULL, 0x8963f1ea06973f76ULL, 0x16b5719241917195ULL, 0x6b41bcca8d2fc769ULL, 0x9b161010551b599aULL, 0xe42a6a63d40ba730ULL, 0x1ac150ddcf0f88bbULL, 0xf7f6423c5ce88fd3ULL, 0xa210635e08e68d5aULL, 0x5ab526f3ad1d5e65ULL, 0x592685c28cfc8322ULL, 0x5e6fadfcb0adb76eULL, 0x3cb995f83d526299ULL, 0xf1c98af67ba45a6cULL, 0x574685d0ed1f254bULL, 0x84b720abbae75939ULL, 0xe72f2b625a8cc2a2ULL, 0xe3a329ee99b8402bULL, 0x69e2d333bdd52fa8ULL, 0xcd33af26687259f8ULL, 0x902f580185644762ULL, 0x23d6b975d9c27e25ULL, 0xde036caf10dcd210ULL,
+        0x3d56540eed070ed6ULL, 0xcf360b6dda1e7e68ULL, 0xab553a9a19a1f377ULL, 0xb045b2eb7c4b0e29ULL, 0xbfb9be618eada65cULL, 0x7634ffa897117400ULL, 0x81e6974edc91ae5fULL, 0xb2e8f09267ccf00eULL, 0x8a0596daadf7d7beULL, 0xddcfa300471d906aULL, 0x275dc933e5179821ULL, 0x4cde92dbb763fea0ULL, 0x84311d7b73f51063ULL, 0xde4bedfc173f1779ULL, 0x92e4e4350e896e77ULL, 0x980fe6672bb78ef0ULL, 0xd6658da11fa10812ULL, 0x6e2dbcf1eb10d9ebULL, 0xb4ac66e1735ec288ULL, 0xab1f6f307e7d803dULL, 0x4cc9e795eb5818a5ULL, 0x460c81803cef23a1ULL, 0xe5abbc2fdee3a878ULL, 0x510a8cd8455766e0ULL, 0x9ade171ab4491451ULL, 0x7054837d92a7bc6eULL, 0x96ad04a79d51cbd0ULL, 0x213628f322aac1ccULL, 0x77d9b11faea5c92cULL, 0x45726aa54af1d838ULL, 0xac00178bb8fb6207ULL, 0x79e63eb67b33e69cULL,
+        0x6542c8ecbbb153c7ULL, 0x384c3b41807ab81dULL, 0x0a6133323607b15eULL, 0x683421ca4524abdbULL, 0x2d14f641d0161e42ULL, 0x75b1d6b1e59de08cULL, 0x7909d37ccfdd43a2ULL, 0x8e23f3fc9321b02aULL, 0xbfe22aaa169770b2ULL, 0x54b8105703ca8725ULL, 0x54176fe4b8afec39ULL, 0xa923f31afffa629eULL, 0x77e6833b8d4b1f2cULL, 0xfe966fad49b62b1dULL, 0xacb1dac7e0f814dcULL, 0xac29aee16227e31dULL, 0x8f5d4d71461dfc9dULL, 0xe0be8e050d4293ccULL, 0x8fd29ab97fe93686ULL, 0xf4e40da30e13cea1ULL, 0x64badd1cf1457a66ULL, 0x698738ebf06c681aULL, 0xe27f29535aa5259cULL, 0xb98cb5dfe43da32bULL, 0x15081178113e2345ULL, 0x9fc5b6990f5f11ddULL, 0x977b5877470e42e2ULL, 0x7bc9234252d8f820ULL, 0x742a2a2bb3af9ee1ULL, 0x62d0b60dfb45216cULL, 0xef0e914ffc54340fULL, 0x88382162deae2fabULL,
+        0x7bca0dc8c0fee1daULL, 0xbea9ab8a140fc9abULL, 0x42aaea01775e16b7ULL, 0x084434aa60051ad0ULL, 0xe5f51776dcaf06a3ULL, 0x80d978d9c84a0a4bULL, 0xedd8127f0f146210ULL, 0x8315beeb8a783c97ULL, 0xb6fbdee09b5baafbULL, 0x38b04610df9b8591ULL, 0xc89c7007e481b4feULL, 0xc573c74c7a503d86ULL, 0x7752729be78d0650ULL, 0x0599b8e290f66cf3ULL, 0xa8440b7cf5cde1b9ULL, 0x42580f8c6f130690ULL, 0xfd73c1c1ee4d628dULL, 0xfd012bd482fb082cULL, 0xca26a59d26005d1aULL, 0xef6bdebdc976773dULL, 0x4e7db113889578c2ULL, 0x4247020178037f64ULL, 0x120d6aea79a0bac1ULL, 0x4dd0571be8b48b52ULL, 0x3027ca77d5de7a0fULL, 0x82260e8bc8ed8012ULL, 0x08a0204500fc05c2ULL, 0x9dfd4030e90583e5ULL, 0x3460e006e9f62604ULL, 0x0fa5608cd28b9754ULL, 0x6bc80c6311df1709ULL, 0xc91f789d6d06d9a6ULL,
+        0x9b7363540282cf8cULL, 0x089f334a8082c842ULL, 0x27719e721d2466bfULL, 0x00c68c4fe222264dULL, 0x48fad336889a54d7ULL, 0xd4b478d6215b6e24ULL, 0x2b6dbee95474706eULL, 0xdd404b3d5d7e4fd8ULL, 0x472240d53ccac388ULL, 0x96d90ba75c56a605ULL, 0x6fcce08c214c0a06ULL, 0xf50af4b361d132c3ULL, 0x9797a6d3a6600d54ULL, 0x289c857a010913bbULL, 0x550aa4aede05e7d4ULL, 0x21c3a7e50fb669beULL, 0x717cfd797f3732cfULL, 0x2fe2519301ca079aULL, 0x403201f8e2e0763dULL, 0xf2bb62198ac10eb6ULL, 0x505dd5be595e8192ULL, 0x6f23ffd47254ed6fULL, 0xcc2d7f2588f30b49ULL, 0xbdca874e76b344ecULL, 0x590f72c38133e38eULL, 0x704003bd868d2cc9ULL, 0xa45b35ba3b5d2896ULL, 0x1182fbec62c6711bULL, 0x1cf03f20f7febb20ULL, 0x0bc366de0583dab0ULL, 0x377fdac82dbeca96ULL, 0x2cf9a717ae7eacbfULL,
+        0xf223243839ade4b4ULL, 0x18b0f19e0f81dd95ULL, 0x487acdf360002fb1ULL, 0x1a005d52a2025f1bULL, 0x9aba7bb04e73c471ULL, 0x851e671260b71f31ULL, 0xe10c973f09e7cb9bULL, 0x3c32bd4317db52dbULL, 0xa5c9b67848c532c8ULL, 0x27a43a075f519ab4ULL, 0xd001531bcadb1e93ULL, 0x8689bab81b664b3dULL, 0xb179db3b62d6cc5bULL, 0xe49984334cd0c7c4ULL, 0xa9ff33cf36d67befULL, 0xbed5d83ace1dcf4aULL, 0x3fd3218eb88a3b42ULL, 0xc59c4b2e31827434ULL, 0x6100a5979ba1a26fULL, 0xdc94ec05e43de4c7ULL, 0x99c780e6058bc640ULL, 0x1ec6f686ac9a9137ULL, 0xbd4e90cdcbed59ceULL, 0x27804a61f4c57b77ULL, 0xccac695fc7c7472fULL, 0xfa31821d64e46e93ULL, 0x91349f40f0b4cad2ULL, 0xc5444a593c50cc75ULL, 0x595c2c5d262c8634ULL, 0x907706b94adaeb10ULL, 0x137ca31be66ad4bbULL, 0xbd43f58fa3a430cfULL,
+        0xbb611218320a6c23ULL, 0x968c4c468b5ce037ULL, 0x01ef88c1dc1b4d69ULL, 0xe5b06ae4d85722e7ULL, 0xa11473e8f238da30ULL, 0x32f0bf5f5118e1f8ULL, 0xb90bf794d662e797ULL, 0xeb5cd0a5e61949afULL, 0x81fc33ee62ba7bc3ULL, 0x5935784789f08a01ULL, 0x04d2bc63a79cfeddULL, 0x57137da25bfdad68ULL, 0x6aa0c42e9315dee3ULL, 0x7ef0a73aaa20e578ULL, 0x80ffe35d9d55a04cULL, 0x3404d5385f2d3632ULL, 0x29c6575706e7e2edULL, 0x94bb74a8d973f96aULL, 0xaf4658754ce83682ULL, 0xc597197be16634caULL, 0x9e31183e4cfd3cdcULL, 0x89115f2edbbd99bcULL, 0x21e1ad8c87b82d63ULL, 0x8f36f23c6d7c7e77ULL, 0x349ccfb29a917565ULL, 0x65d0b382578d5685ULL, 0xd70a7890991805c3ULL, 0x6efb43bdfbc15450ULL, 0xfe62a6b80333b88dULL, 0x0feb8729c090312aULL, 0x24e067e2370c0da7ULL, 0x0745c3c35b9ae337ULL,
+        0x6a5149317c76a1ddULL, 0x1bf7a886f4c0c103ULL, 0x88382deaf0f95640ULL, 0x0f39986a738b9c22ULL, 0x656d74772eee2b85ULL, 0xa1b4ad4d94a32a3dULL, 0x48aa957eb7d05651ULL, 0x4040a605325395fcULL, 0x838f33afecc89c8bULL, 0xdd3f6220af92ca74ULL, 0xf93b17a6665cd806ULL, 0xdc17bee3c4406abeULL, 0x87768e569337bd08ULL, 0xcf98fe212901a04eULL, 0xb324953efee55a95ULL, 0xbe9d981eeff944a0ULL, 0x4f22e21fb0e46b19ULL, 0x89ddc4e1fd572823ULL, 0x033b82d0834eba97ULL, 0x6005a67fc7b581ffULL, 0x3e252c25f331723bULL, 0xb1eb9c8e7df2d3f5ULL, 0xe0eba3abee639367ULL, 0x4c10dd8f11554c5bULL, 0x674da1ce343bef4fULL, 0xd0f51d95d3394689ULL, 0xe0a5a6c9a2eebc4cULL, 0x652cb00d4408a6d0ULL, 0x8a399e4741e8bb6bULL, 0x8534f711a2c80d69ULL, 0xefa6644df601d05aULL, 0xe626137b454c2293ULL,
+        0xc15db14ee7a0f2ebULL, 0x86592e97d509a03dULL, 0x9eb93fe1d709ca4eULL, 0xd1c0b0e29055e270ULL, 0x6e94319997716ae4ULL, 0x719f3faae0080659ULL, 0x8299876c3c281616ULL, 0xc8cfe789e6d6ef43ULL, 0x2d6ba222e3b95e42ULL, 0xe8e6f5f25e7216b9ULL, 0x312c62c52081229eULL, 0x7a7694aea403276fULL, 0xa2f690414cc78621ULL, 0xce438e3df5171f1fULL, 0xf49e591ca1b0c9fdULL, 0x39c7d09a6e9778e5ULL, 0x1960e07e898a4590ULL, 0xb0894f7cc8206f7bULL, 0xb5602fbbe7b59a65ULL, 0xfedcebb586c8e719ULL, 0x5f40b233e6bcfe02ULL, 0xd6380e21ac911d0bULL, 0xf7ae5e19fa7e94b7ULL, 0x6906ae790ba25a34ULL, 0x0144cea8e71e5fa5ULL, 0xc9fd7e720ac8fdb7ULL, 0x603e662a1744c734ULL, 0xb5aea698f05b231fULL, 0x0e1dc93398c13150ULL, 0x52172bddf195ba6cULL, 0xe177aef35c91b2faULL, 0x042e976e227cdeb3ULL,
+        0x8a5aa66bd4b86015ULL, 0xebe56fd1c74b91d5ULL, 0xb5e646cd49f42e2fULL, 0x127ad8031c196e99ULL, 0x809aa507d874a3bcULL, 0xc6c9755beb4a1142ULL, 0xa1b6e11d41e666fcULL, 0xad4274bad98a8f10ULL, 0x8376f558891231bfULL, 0xef63ac3d8119067cULL, 0x3e830f692e562978ULL, 0x25e298cba4d5aa43ULL, 0xb111e793e3c0fff3ULL, 0x31e42cf72c8bcc49ULL, 0x2cf8400ce9c5f71cULL, 0xc86679c0e535b489ULL, 0x0cbf487ca675fb0eULL, 0x30607831f735cc74ULL, 0xc8fa71a6a3052fedULL, 0x7cdafbd97687afbfULL, 0x96039da32816abf3ULL, 0x74854b8b09723876ULL, 0x6c0f7323c6435e84ULL, 0xac15b40e696671beULL, 0x02dcd59d307d28bbULL, 0x2fb2ddd61cb073a9ULL, 0xabd2e1c0f59adf54ULL, 0x561f80253c451905ULL, 0x93067a5b40a0cd6eULL, 0xe0d4f6e17938b30eULL, 0xe6a6fca240dae529ULL, 0xf535c2ac766258dbULL,
+        0x6f625e891c0903eeULL, 0x01d3c4267062c034ULL, 0xfa7b69d7a5744c71ULL, 0x27ebacb1c7d56e1cULL, 0x9ed0ee43c70271f2ULL, 0x3f0b6b6bd81b107eULL, 0x3baf8f502c093d80ULL, 0xe20702f3a3e2d0d0ULL, 0x7cfbdf86054e5e6bULL, 0x859d4f656d2c6dc6ULL, 0xc17c91a0d4774db5ULL, 0x6f4fb3fd16f18ed2ULL, 0xfc7d50a13289cd1eULL, 0x4ae166e7dff9c6f5ULL, 0x69c5859c11bda70bULL, 0xb3181ac626d36576ULL, 0xe940f48622453609ULL, 0x2aec9ced2a8c5b4eULL, 0x5d139cfb95a67cbcULL, 0xa11f764fdcce0afcULL, 0xb3cac7f12a16f467ULL, 0x352e0e53723ec49dULL, 0x74587dad0fe69130ULL, 0xb3e49b07119c20f2ULL, 0x9133c15c0a43b697ULL, 0x80539b97cd022d5aULL, 0x3ff9b548277dcda2ULL, 0x4d8c3b21d4d26876ULL, 0x84528792881662f5ULL, 0x2251974deef27439ULL, 0x8ebf4faf8f1a89c8ULL, 0x1aba7139bedf1f3cULL,
+        0x902ce79e81649fb8ULL, 0x461176ebca0d7819ULL, 0x9997848a7a128251ULL, 0xe7b446f626f1b11dULL, 0xb85cd2db7df745b6ULL, 0x94ca9e4795244075ULL, 0x12ed37d3934444afULL, 0x7827f019645666baULL, 0xb5539b867d743ec8ULL, 0x11ed2933796bcbc9ULL, 0x177febff95e0a3cbULL, 0x64303535b63fb06dULL, 0xfcad1e8628c57376ULL, 0x1529cf9766059508ULL, 0x666986b767741543ULL, 0x1027b150767bef1eULL, 0xa5cb10da92474fd5ULL, 0xcd56782b5627334fULL, 0xaee336450b63b99fULL, 0xa26d6952ddc8900aULL, 0x6bc54e55e0ea96f4ULL, 0xd6fadb55082ae807ULL, 0x7cc1b0b199f963f5ULL, 0x2816890bebce790bULL, 0xfde4c2c71c4027ebULL, 0x39b1cf31f3b24035ULL, 0xc7c58f35540ef7ccULL, 0x8475d6e03b8a782cULL, 0x2db35ebdaeb5e2f9ULL, 0xf0e3fc94009294a1ULL, 0x71f782edc2092453ULL, 0xb063a83c52aa41eeULL,
+        0xb8f3f19b49e6d8fbULL, 0xda56a932b2e4c446ULL, 0xdb3b1584cf39f1bcULL, 0x5c05b15c81a90934ULL, 0x9712e1cf227ee99aULL, 0x21a36dbb334eee41ULL, 0xc0af9764f03e4b6dULL, 0x06c32c13d60888aeULL, 0x06e6d655eb75d890ULL, 0x40c327c5bc479eacULL, 0xa4ef769e22f731f7ULL, 0xa177812907993b90ULL, 0xbece6da12126b46fULL, 0xfa44eb8cc877da90ULL, 0x7613119e7758dac9ULL, 0x2a602271f0390a60ULL, 0x9475ffef5b91449fULL, 0x0428844346b6e152ULL, 0xea37827ab5e691c4ULL, 0x43219a4031a8bc13ULL, 0x84441659b136bcc9ULL, 0x9dbb712fb45158e3ULL, 0x45631abc5161b3b3ULL, 0x0085d91bee17beffULL, 0x8755bb726d794985ULL, 0x6a313eec087e4b5bULL, 0x51409d6fbb498806ULL, 0x00cb001d904ddfb7ULL, 0xe65fe7fdb23f415dULL, 0xea0afbe6ab6d32f5ULL, 0xf9e901a0b961df5cULL, 0x9d53f2c13e2dfb9cULL,
+        0x56e5bd5115896c6fULL, 0x3157baa0dc0e68c6ULL, 0xca09f46cd54a54b7ULL, 0x3afac3cacc44ef14ULL, 0xf9ad0be5087d5ea0ULL, 0xd6be18cd0886eab0ULL, 0x5b2f2e15b9915600ULL, 0x039434689f4f7a04ULL, 0x19a569a77efa5941ULL, 0x08a4564bf9ff57daULL, 0xc179323dff10d210ULL, 0x027822b7d92003a7ULL, 0x4d4ac7fdd25f2c1aULL, 0x1d9d0e7fa61110bbULL, 0x39674ef19b1c72b2ULL, 0x3dc6c11b1cc466b6ULL, 0xbb39f2ebae8383dfULL, 0xa2c86f05aa627b90ULL, 0xc109b0d106fc3c27ULL, 0xc864e4312924cc12ULL, 0x170f947b2dce6103ULL, 0x86a211f119c0aa15ULL, 0xaf2c9cce55474ee8ULL, 0x42c836eade5d3ba1ULL, 0xa5a95c83c3c9c4c9ULL, 0x9bbfc8eedfe210aeULL, 0x57d1549bd33e6b15ULL, 0x0f309db5fe1bb289ULL, 0x8c75e32e528eb0e6ULL, 0xe85f48f7c6e59080ULL, 0xa58bdb49f6858ec2ULL, 0x0980c13cc22e63c2ULL,
+        0xba2d399f3fb7899eULL, 0x2e7bc5efde62c2c6ULL, 0x212dfe673b81dfd9ULL, 0x051556af4fa6afb8ULL, 0x8616811fe5738c65ULL, 0x3b5419c5e78e2d5bULL, 0x1d7361c208333c5eULL, 0x9e48705e5049b48fULL, 0x4fc298808b1c58fbULL, 0x625709611b60a49aULL, 0xe0ab7f50e0aeb793ULL, 0x02f4ddb4499c5bc5ULL, 0xc53d7c8af6afa2a5ULL, 0xfbb36a88e1ab15d7ULL, 0xb67a7eec6bf2ef6dULL, 0x9625677ab82842e1ULL, 0x0e59f836fa1a2d0cULL, 0xfc7a8bdff080632eULL, 0x8e67935c0d546110ULL, 0xd61232a333947643ULL, 0xf9d29b653e36a870ULL, 0x0c926f5b6f03b578ULL, 0x7f115d8db64bc53dULL, 0x1a7983488085603cULL, 0x4f65473c70253fbbULL, 0x01f324ed22a355fdULL, 0x9baa22a7e219423dULL, 0x13049dc9af03b832ULL, 0xabde65d7460bac4fULL, 0xd89f543f719133ecULL, 0xff7fffc52b48deb3ULL, 0x4cf43eec159fc149ULL,
+        0xe29f65dcbb3c2df5ULL, 0x0fd8280510efeff8ULL, 0x93b3002936117bc9ULL, 0xbdd554aa3d9aa87dULL, 0x1461d8cef0c76a17ULL, 0x114a9f3e626d7c9aULL, 0xd82b2344ef39dc81ULL, 0xca7dd7a915564490ULL, 0x4d35e0e8d5acd428ULL, 0x42db6f47494f1af3ULL, 0xc2a94d6d6ea82cbaULL, 0x87412e3f113287beULL, 0x778bd9c236031dcdULL, 0xec9914e0e9bca6bdULL, 0x3466c6f208cdcbeeULL, 0x7b8dda68fdd2cbf9ULL, 0x2aa93ceec4526e45ULL, 0x11f63526f8c1b50aULL, 0xdf83007ca59f2dabULL, 0xc4dd8ac213520584ULL, 0xde6625d2f847d734ULL, 0xb89b8ca2408b39e8ULL, 0x51bb7237b25e0e3dULL, 0x099f36d98fd6b21aULL, 0xa21311133fef03aeULL, 0x2a70f2994223523dULL, 0x3a6cd1c7bd8dd098ULL, 0x37a000ef2408dcddULL, 0x73a471626fff5f21ULL, 0x9a49da0343dc79fdULL, 0x1bb056dc578dced2ULL, 0x64e02a1d5054109dULL,
+        0x709e972ec2b23f4aULL, 0x601345515e6075feULL, 0x55030e2fa78ad985ULL, 0x85b84f922c2f1107ULL, 0x2588360db1cfa6cdULL, 0xbb5663be41ead9deULL, 0xddb91b0cee2afd01ULL, 0xc5862366826ab616ULL, 0x056c46e59ec387b6ULL, 0x923d6d7b388ecb03ULL, 0x4c9a79407ce442a2ULL, 0x70676ae26ed58e44ULL, 0x5094a877e5fcaad6ULL, 0xa0da73da3398e22bULL, 0x28d9d799997e5462ULL, 0xc92d9ebe3c55b24bULL, 0x09295d9d150c4371ULL, 0x0a01758f7cc03531ULL, 0xb52d2df7591e3a81ULL, 0x07d49df480a95833ULL, 0x9d24b461df6dbdc4ULL, 0xff9f2d0e2a887aacULL, 0xe977fb23e30d5194ULL, 0xf8ad3c06d6df0f39ULL, 0x7c22fbe9f5a7dd14ULL, 0xa10ece3ba5351a20ULL, 0x8800c1acd8a97ae4ULL, 0x8074299358ddd662ULL, 0x35505f3b925af6acULL, 0xf1896f82f16354bbULL, 0x1e3f98bce3c67d40ULL, 0x6e0b4742305a60b1ULL,
+        0x38e2f9fc5a539c25ULL, 0xa9fe0db467e4a599ULL, 0x41be6e6a198e6c4aULL, 0xcc51fd2af95106fcULL, 0xfc4342e72854c1f1ULL, 0x66894329a9a6149cULL, 0xd1ba847635cb7b87ULL, 0x82be552a35c7589aULL, 0xe2b2994e27a93287ULL, 0x8d58f95d1b45ac64ULL, 0x4623e906ba111148ULL, 0x2f3c9d6d6a4ef1abULL, 0xb5c9fa14e6d7aecfULL, 0xefdae8ed69898ca4ULL, 0x71d3ffdac19f37a5ULL, 0x17033b82dadc894eULL, 0xef0f32234e8bca2dULL, 0xe44f4fc550278752ULL, 0xefd74c9fc49bd7bfULL, 0x2e1b872461949522ULL, 0xfc230ef26e786bceULL, 0x303a186e44f9276fULL, 0xb2baa2a60397a62aULL, 0xa29ccdee4916b225ULL, 0x82e0dbf8e9c79cf2ULL, 0x57e4762a8c413202ULL, 0x8007f7e4163b55ccULL, 0xfd8c54096962a906ULL, 0xf8ce5b8b30e8db72ULL, 0x0aa1d8f323765333ULL, 0xec42e475010ea0ceULL, 0xc89c66b2238ca016ULL,
+        0xa141ef8bcebea8f6ULL, 0xcefec9e387bf1b93ULL, 0x55da5e8dc328597cULL, 0xcb0c0ff8c0bdc600ULL, 0x512888a21e5530eeULL, 0xc6839b1e2c20f918ULL, 0x2d3aa2f0c36a0373ULL, 0x965da7fa1e742535ULL, 0xb5b24a76400320aeULL, 0xe6676d3531486631ULL, 0x70ad652a457a4b72ULL, 0x442350696f940368ULL, 0x4b61f05bc1315936ULL, 0x654234c0a83ea6acULL, 0xa6c1b5a75728c40dULL, 0xfae760f6f0855ffcULL, 0x54d8d933041229a4ULL, 0x769710da7c18ca36ULL, 0x50a07c791da52853ULL, 0x38ff9d6a757afb2dULL, 0x17bfc3cf73734dbeULL, 0x0d795d67aa810f6eULL, 0x5896595077a27967ULL, 0x83269659fe691433ULL, 0x1654f8f90c71ba8dULL, 0x7659646f304343e2ULL, 0x06e681c0bbad1a2dULL, 0x1ba52a53bd9c19d8ULL, 0x4ec7ee9a9f52d0e2ULL, 0x078eb5e55af70622ULL, 0xda0887168e39b9aeULL, 0xcc4afe0a2b8ff359ULL,
+        0xcf52a3a9a8915109ULL, 0x7a0bdece339f2168ULL, 0xa8d5eb96fe536f24ULL, 0x7f1072dba0c596ccULL, 0xf4975c7447b627d2ULL, 0x5fa58185ef64365dULL, 0x86cfb7e773caca3eULL, 0xda5ed2704cb51112ULL, 0x844ef8a00fed0915ULL, 0x8183a89cfe48c5fcULL, 0x5f15b9ecec00bf94ULL, 0x40444dee99527d03ULL, 0x5a20ccebcdcca9c5ULL, 0xc4595e2c25062a80ULL, 0x8b6b829075aa12f0ULL, 0x8bead7959614086dULL, 0x197a06754952181bULL, 0x6e50be5e9b989875ULL, 0x97a99bdaf6179798ULL, 0x4586a3723c6af5d8ULL, 0x4d15eaa99747fa2aULL, 0x92ebd9042215743cULL, 0xd2fff45d948eb6a9ULL, 0x0539ff77603f2536ULL, 0x31b0713911355c20ULL, 0x60bdc2b5fb54c88aULL, 0xe0a1daf960a1e14dULL, 0x9aee6b7e876f842bULL, 0xf4d272489a772863ULL, 0xd768c32bbe8ab82eULL, 0xb1a82b2357ad388fULL, 0x20725a63e31b7116ULL,
+        0x8a37493b8251d1cdULL, 0x9b4ed0bbc18947f1ULL, 0xeac285329d926c60ULL, 0xe7fe3f140bd03c28ULL, 0xd5250b45398dfed6ULL, 0xa3c287c066c91d02ULL, 0x09a117e7c1d68d6aULL, 0x9bf6cdd4ff57fdd9ULL, 0x3740573f8ec4a7afULL, 0x63418b061c7c72acULL, 0x434a7c29e0d8897fULL, 0x3601b8a50517a98aULL, 0xf02d74a376765010ULL, 0xb79532bb8e27d374ULL, 0x8b8e74541f5013ebULL, 0x5cabc7d30781ff77ULL, 0xf792c2103d0d51daULL, 0x7c17df0d6c776dddULL, 0x9cbc8b294564adf7ULL, 0xbcc5d37954547155ULL, 0x1d1a8c058737fa57ULL, 0xe781022365a72036ULL, 0xea0ff903bfcfaf08ULL, 0x5ab28e82734ddcbdULL, 0x0e2b9e00c4ae96b5ULL, 0x6561e581d14c96a7ULL, 0x932edceac8bfa4eaULL, 0x4ae137fa84ed793fULL, 0xffd977cfcbeca451ULL, 0xf30e656fa023db75ULL, 0xd3ba977dbf6213c6ULL, 0x45d07eebc49ddb5cULL,
+        0x7937370ed34cb788ULL, 0x095c4a42dedea50dULL, 0x14d30b15a7f97235ULL, 0x9e35157538748951ULL, 0x6967d8f5a15d8485ULL, 0x40529c772075be96ULL, 0xcb7f06faa5cbbddeULL, 0xcf08135108047ae0ULL, 0x9d5ac2bb07599f3fULL, 0x17bb947939330620ULL, 0x66764a2be04a3a4aULL, 0x5d451d3d6883f8c9ULL, 0x7f0f6991da022674ULL, 0x6639a93026ae0e0aULL, 0xe9f4949572fab61bULL, 0xb04e6079f60e1285ULL, 0x4a1cbf34225e36baULL, 0xe978581eb42daba1ULL, 0x1e19f441f7bd266dULL, 0x6aa17e22e1c92bbdULL, 0x4a5936c735f49346ULL, 0xdc41376cff554ca1ULL, 0x4bc21a919907cd7dULL, 0xc7bede56661172f1ULL, 0x1bfb57e71171a742ULL, 0x97eca19bf767e3e3ULL, 0xdaa293621d47eb27ULL, 0x4106a1d66faa863fULL, 0x07f68ed05ac60852ULL, 0x314f6bf205346b57ULL, 0x814a9c9656c86618ULL, 0xdc9be8945faff3a9ULL,
+        0x6756eb97f25b4ce3ULL, 0xd4ce4d2b37461b81ULL, 0x467b28c745a0cc76ULL, 0xffe2dc19ea446a0cULL, 0x2ffac1ee53f11c39ULL, 0x3fce89c1683f5e3fULL, 0x42217fd3d726b4f0ULL, 0x0c73c94eb3ef2bf6ULL, 0x3f01eb417901d472ULL, 0xfebbbb56224a0234ULL, 0xba0d5e32b485d573ULL, 0x783bcf56c710c96eULL, 0xfbe45ce9b4e5bdffULL, 0xb036593d77fdea9cULL, 0x2ade068f946fee9eULL, 0x79d1a817f5048ea7ULL, 0x0148c7b9096c5621ULL, 0x075ee4ce24ddfed8ULL, 0xf51f734c0c227cfaULL, 0x967f75e59a9b8d2cULL, 0x95cb598701bc5c3aULL, 0xbfa9a2516e2a841bULL, 0x17f74c6f81ce51e9ULL, 0xd112735f1c4c864fULL, 0x70e23986ca46c01bULL, 0x20fd6951faa0218eULL, 0xfcde3f0c376439f9ULL, 0x4771f5964204e89fULL, 0x48669be6c8355c84ULL, 0x773e50ff745e889cULL, 0xc97f684eac3f2b24ULL, 0x8b3a39f1567095caULL,
+        0x40a94a95daa5670fULL, 0xea74267eff9ea2a4ULL, 0x5f7b21c0471a6e97ULL, 0x7f5f485dc9b87faaULL, 0x86844e5e84eebe11ULL, 0x2d973a1e5c311cefULL, 0xc3f2760a74fb231dULL, 0x943f4ebd21d0e557ULL, 0xbb404ba57709857dULL, 0x304907c08b2465e7ULL, 0xe1aa3d96380817d8ULL, 0xb6ea2c2fb953c434ULL, 0xad40843be37ba722ULL, 0x1249e33eeae508a5ULL, 0x477a3312e0286c44ULL, 0x2c31d4b522d20328ULL, 0xd1cc798bc10d2a0eULL, 0x43358cbca16d9e44ULL, 0x8d1ce94899d1310cULL, 0x8dd4b705520a58d7ULL, 0x8bd0a42fc1f8936dULL, 0x183e87efe6cd7150ULL, 0x6fefbf49965a5be3ULL, 0x3f3ab8e2778cff9dULL, 0xbdf769c7a3ec52caULL, 0x8a9da665f74d6fe0ULL, 0xaf940252849cb60eULL, 0xd938f67e72a8b7f6ULL, 0xa166ae12f461a384ULL, 0x3d030f334da27e3aULL, 0x06ba65a52111423fULL, 0x388be6e650a59640ULL,
+        0x3c42862fd631a1eaULL, 0x3a309c2e291736eeULL, 0x8d318ecc0a067213ULL, 0x6d551556bcfaede0ULL, 0xe97dbe6e7be3d1adULL, 0xe0f7edc1b35e0768ULL, 0x4b811a541fc4718cULL, 0x9ea6bd5ee7fa4af1ULL, 0x903fe7fe80b0dc2eULL, 0x4037b6e21883ae85ULL, 0xb929a9a7eb891976ULL, 0x3cc75301ee00d10dULL, 0x02b7b8bf83345ddbULL, 0xed142ac7994494a3ULL, 0x7bbd6373c9fcac83ULL, 0x19ea8e6893c4395eULL, 0x8b3545c5200dbcdcULL, 0x81593d4fdcb8577fULL, 0xa4baf091f17d9c0dULL, 0xd80e9c375d08f715ULL, 0x9396b847e8b48fdfULL, 0x2304f00dd2ef70b7ULL, 0x03e1a092e0dc662eULL, 0x582d620715b5984fULL, 0x2ea3d57ed6ec69d9ULL, 0xae2f44b207066e72ULL, 0x1e3b264e96e7e218ULL, 0x3e26a04164b79372ULL, 0x16c86eaf53b23a67ULL, 0xb5ef105836a7bd17ULL, 0x6d6b01dfc14f5c79ULL, 0xb5ac94ea77e3cb56ULL,
+        0xa41a575efbe55ce4ULL, 0x85bc10ed0b327223ULL, 0xbf16b634310ae5e4ULL, 0xc7b62c276a1e1b65ULL, 0x711fdf57b9023256ULL, 0x0574b6f5142be137ULL, 0x73e41082d9a6c6adULL, 0x03877398d091cd28ULL, 0xe452727603729f38ULL, 0x8ef7a424a8e84c5aULL, 0xba4fd591bf64ae08ULL, 0xa54a049432e60e48ULL, 0x107bf6760454b2b1ULL, 0x0d00cb808078ade4ULL, 0x86436ed42795643fULL, 0x9d433543a1bcb814ULL, 0x28761dbd2de6c660ULL, 0x0d0571e99b551452ULL, 0xa82ea69aadbabf10ULL, 0xcbc34036370563b2ULL, 0x6f2410e0c0b16f9bULL, 0x8be1bebe42878039ULL, 0xf75dc8fc00390670ULL, 0x5df42b8975a9c4caULL, 0x5872d08169752305ULL, 0x9fb3a336f3f5de86ULL, 0xe813a9373b41c4dbULL, 0x2484f1222af7ad0bULL, 0x22f45d0ebcc766a4ULL, 0x0761ea0031d1a798ULL, 0x128af5a587ec3458ULL, 0xf8d896277b601340ULL,
+        0x9e3c63a7e2a81f21ULL, 0x3c5d961fe6f03686ULL, 0x9974a61d965c893aULL, 0x34b781d4a80ff750ULL, 0xee0ddd243819611dULL, 0x3e2960c9b976de7aULL, 0x5d451730d98b4f45ULL, 0xcf9b29198f0cd718ULL, 0x12d7ad2eb4efd4ddULL, 0xafcad7455fddeed2ULL, 0x35da7d78a659ed1dULL, 0x9d3fb6a662063bb9ULL, 0x11ca202193488c9cULL, 0x9ff8790b80066901ULL, 0x45b819d1682b378cULL, 0x337e3f8f44ea935cULL, 0xb1ae9222dc74fc91ULL, 0x6828993755d03123ULL, 0xfe0db74d34cbc63dULL, 0xc9ae7013760e6b1aULL, 0x050a7d15171b3581ULL, 0x978b582f43792687ULL, 0x49ca6ed99a5c38b1ULL, 0x22b141cfbd68a8dfULL, 0x3aa1345cb8e26ed0ULL, 0x834aba138be58850ULL, 0x853e5dc74d26f8eaULL, 0x2a2f48f4739158b7ULL, 0x3ad7f3a114441542ULL, 0x9bf9315b2c78c3f6ULL, 0x9e2d73c3fffa7be8ULL, 0x7b0defc57bf633abULL,
+        0x73f6508c442f609aULL, 0xd96a92749be5c2ceULL, 0x57ea32bb25d68968ULL, 0x79d566618bdc4a95ULL, 0x82b5133482603b7aULL, 0x14e04bc0f631dd30ULL, 0xe5021715f25cf4dbULL, 0x24330c3af3a434e6ULL, 0x11f68b138632aa6dULL, 0xbacf14d73c2f4f71ULL, 0x88f83535a2d6591fULL, 0x326128fe7528f976ULL, 0xa500e13f64d95e72ULL, 0x73c020242aeca0f0ULL, 0x2521068c23f2a344ULL, 0x6001a810c574ee1bULL, 0x13d00b228f75ede7ULL, 0xf90c703aa840416eULL, 0xc7eea7e79e08ca5bULL, 0x9055f7ab2f07d6b5ULL, 0xf4cf70f100c357baULL, 0x2d016bc7e95f923fULL, 0x0825b97869e54c10ULL, 0x2a106b8484eeebaeULL, 0x06df9b67b9d08748ULL, 0x39dde90b13ad31dcULL, 0x371921feec382e82ULL, 0x92d0065297c250b3ULL, 0x7e6f02668b76072aULL, 0x5b224b44166881ccULL, 0xd3aee7e445428bd9ULL, 0xedddb3b0be5cc243ULL,
+        0x01a10e13677e3a1fULL, 0x94b3d92517b0e7caULL, 0xcf6f0293928a63bbULL, 0xf66d20d1e534a0d9ULL, 0x445c6a4b1e72a292ULL, 0xb9c1872436fc3d73ULL, 0xcf5af916a51a3ebaULL, 0x6dba00ccee7cd1d3ULL, 0x6c1e9b3afc7f5406ULL, 0xae51b57d4be67af0ULL, 0x8bce82e30aacb827ULL, 0x48aaf04051e7dfbaULL, 0xbd0c603b9381f131ULL, 0x6ca6087c8645b755ULL, 0x18b3695e6ab4b709ULL, 0x1e4879e1b09046e5ULL, 0x4aba0a7f92a71b06ULL, 0x26936abe8e89db6fULL, 0xb57abb1ee951108dULL, 0x469306df3b831d0bULL, 0x535261a0833ef616ULL, 0x4abcf0b347152105ULL, 0x043794425be52895ULL, 0x62420f1d62bbc99dULL, 0x4b0dbb16d25e31a1ULL, 0xf8a53e9f04d37420ULL, 0x459e6bfb8089a982ULL, 0x3276df78b32a136bULL, 0xe753e80fc0fc151cULL, 0xab524ad4a706da18ULL, 0x2f167b7669d137c3ULL, 0x07d18ed744dcdd0fULL,
+        0x4f32de3fb246b358ULL, 0x5dd6f26178a6566aULL, 0xc63cc1477fe5c102ULL, 0x26d4e7d0abca0c90ULL, 0x7344224dfe7d7b26ULL, 0x123adb6f4b861b37ULL, 0x21d8644545a4d84cULL, 0x9a32c41b3a470afeULL, 0x61040077ffcdfec0ULL, 0x7f710b3f9df7dba2ULL, 0x0f833c67c46aacadULL, 0x121cc5ffcaf46dbcULL, 0x8283953f02d28c7cULL, 0x11fec7a8544aa5b2ULL, 0x5b74fd276d9d7d2dULL, 0x0295460d79c56f66ULL, 0x2b6b7b089d73838eULL, 0x8418a5837fade9bcULL, 0x5df18ae6e4d7b958ULL, 0x5daaf2d2fc0cd811ULL, 0xf9c9e57598eb8c4cULL, 0xd81ac43bfeeca622ULL, 0x54b775912a8dbf70ULL, 0xbb73bf413ee6af11ULL, 0x5c74ee177fc35d81ULL, 0x0f5f425c46a08d0bULL, 0xed2173f0015c54efULL, 0x0da9c1dbad289065ULL, 0x67a9de24bb1b040fULL, 0x730d2ee1585dd47eULL, 0x662573a20271b683ULL, 0x6fdb472e6be1bddbULL,
+        0x18b0f4d5f9fef2b0ULL, 0xfdf77ae6772126dbULL, 0x9d017f70b0cdaaedULL, 0xd9632c026c0c48c6ULL, 0xd28f8c457077cf2dULL, 0xc5bcfc47ec59c054ULL, 0x9a194d5018c1c98eULL, 0x11d62021d2ce0d08ULL, 0x8b7154b64ce50418ULL, 0x7d57fcfc555d37e5ULL, 0x6ec229ab8f29d946ULL, 0x8488dffc4c8f3e97ULL, 0xf5cbeee8caffb3f6ULL, 0x2e25cc6a03430a47ULL, 0xc4ab9baf33b6cd50ULL, 0x7c2f5d676d01e876ULL, 0x76f619a2f2133070ULL, 0xadcb72d07fe25251ULL, 0xb4b23f24bd5005f1ULL, 0x0bc223787c0bb6f5ULL, 0xcfdece4c22f8b6e5ULL, 0xde3cdfec3d4631ebULL, 0xc4645d0027b1d484ULL, 0xb327b5124868296bULL, 0x581367afb51a0ca2ULL, 0xb6ca3bae406512b8ULL, 0xa3c9d5003397addbULL, 0x2cd471bf40bdcd3cULL, 0x1a9ece4608b4455eULL, 0x5e235b6c1cd90e48ULL, 0x83a170044a69d214ULL, 0xc10f5eb38c8f4861ULL,
+        0xa0930455ebbc2f60ULL, 0xc44b69bdf11897abULL, 0x4c3a791a4af8091fULL, 0x76ce1ac9bcc5d072ULL, 0x316102209d05d9a1ULL, 0x44826de9e853ca78ULL, 0x15c2fb5438ac4ff6ULL, 0xb851982c258158edULL, 0x936d900e202b4f58ULL, 0x2bed37692c0c0950ULL, 0x48cd3ca78be6a43dULL, 0x9d186532e8cda705ULL, 0xe62084a3f5140771ULL, 0xf68eae8c94849a90ULL, 0x6297fd1104f8066cULL, 0x6c24ecf63c006fffULL, 0x8edc6b37e4a6efe6ULL, 0x57b54ee4d6c51702ULL, 0x9bfbedca4d52df08ULL, 0xbeb4d3827307d6efULL, 0x34b0f8e329e62bdaULL, 0x7604718891695bfaULL, 0x16f299294ac398bbULL, 0x3cf9ed1266e04a13ULL, 0x0af26d675050d720ULL, 0x9ff505eeb98928a8ULL, 0xf8ae60fb3a6a0546ULL, 0xae936ba560f6f4edULL, 0xff408d80363b40afULL, 0xd47c82b18b2e29afULL, 0xae33a34828d98026ULL, 0x624d9226c5a839c5ULL,
+        0xa856861cbe60ce13ULL, 0xddc7ff152ab10bf1ULL, 0xddbc689d7e5376f3ULL, 0x5e83cff1cd7524d8ULL, 0x88303b04c33d85cbULL, 0x343e3967be18955cULL, 0x8f78c083d27c2e3bULL, 0xe4ce601e48e5fb15ULL, 0x05d5b96b1b30e8caULL, 0x055c0587ee400284ULL, 0xafe5a9b86c76154cULL, 0x6836d34cb10c550fULL, 0x5ec26aba6ab190cfULL, 0xc49f2f49480b6f1bULL, 0xec99614ca8cac047ULL, 0x10a18ecfd71b20f4ULL, 0xe35449066db6a3a6ULL, 0xe1097a9201daa247ULL, 0xc1037bff809eddcdULL, 0x5be56d86a73de9adULL, 0xe54919fc92c2a1c4ULL, 0xab26a8583e94c11bULL, 0x165017464449d0f8ULL, 0xa971a4a1f8600874ULL, 0xc308af68e3fa70c2ULL, 0x53fd541413220c06ULL, 0x2012043c80343f4eULL, 0xb836f54cd5df63bfULL, 0xe5e4c5da806c982fULL, 0x109305af34404702ULL, 0x8976a65efce1cbeeULL, 0xcd53842a037ed478ULL,
+        0x437a1a5f78455066ULL, 0x674f84133102fcf5ULL, 0xbb0de9fb0a1ee70bULL, 0x9958c20d2498e415ULL, 0xf6e059e603f8f012ULL, 0x842116abaca644a6ULL, 0xb974682c3556a807ULL, 0xa5cbd654b742fc19ULL, 0xb47f0be855232486ULL, 0x3294b172050936a8ULL, 0xfe5f5ee492669a1cULL, 0x24adf5b56f56c530ULL, 0xbeb38c876782a1aaULL, 0x9a4e5a21c27ef218ULL, 0xd0827b4e3aaf0554ULL, 0x030415a2dadfa39fULL, 0xd9c9c370e431f22eULL, 0x773e2ff52772556cULL, 0xb310795106f8603cULL, 0x3c38cd07083e131fULL, 0xebcf4d9677fb9a84ULL, 0x116fc9558682f993ULL, 0xfd66530f9f8a1593ULL, 0x625f0a36a15b6fa3ULL, 0x1f8e51b6eba364d3ULL, 0xaca4ca43387ca8ceULL, 0xf63fe06ce151ca79ULL, 0x60d94efe046f1c60ULL, 0xd33bd13661cb99dcULL, 0xf98f118adad718a1ULL, 0x834c798057070c11ULL, 0xeba8a91b795a9cd4ULL,
+        0x4d86660ca8b8089eULL, 0xe0e7782ae2279cd1ULL, 0xe95833dcf0dbfb79ULL, 0x47057cd86744a085ULL, 0x81ce3a37946b76dfULL, 0x7280a087d680b8e5ULL, 0x294d5679d1224fb5ULL, 0x9f15b256af41ed0bULL, 0x975f757e5f716818ULL, 0x3e8eb5efff2d1befULL, 0x5e20f95e5ab4a251ULL, 0x24d02ac77112ac27ULL, 0x15163e8ad6d2828cULL, 0x5800ca7028a68a62ULL, 0x3812d83915dcc7caULL, 0x59712ec4b795e7f9ULL, 0x11252e60543fdf28ULL, 0x1f78fc4469fed884ULL, 0xe36ead3c0c2f343eULL, 0x93fc4900ff0e3844ULL, 0x28bc9d56cda8d6c9ULL, 0x4013f618375cdde9ULL, 0x882085611165ede0ULL, 0xce5c9cd020432999ULL, 0x9fad2901f0c1fc9fULL, 0xe003751cc87c9799ULL, 0x72aaa1418fc930bfULL, 0x1435c7783f41bbdbULL, 0x910413e25985ad4eULL, 0xdbe84ca34e151084ULL, 0x5ef5ad56d0b4f7f6ULL, 0xf599e825fa4db954ULL,
+        0xbba7663ef95c8f5dULL, 0x7fe385f796bf5d17ULL, 0x0a8bbbc3f06ab03cULL, 0xc3ad38da6fe25950ULL, 0xa1c051c488fa0334ULL, 0xa7c1a409ceb600e6ULL, 0xa489369af8f9f94bULL, 0x12df6d689ac5547eULL, 0x7a4b159a21ee7a68ULL, 0x8ac885d97faea28eULL, 0x3566923ea6118005ULL, 0x7009203a62a4de3fULL, 0x2376b4d40c325aa1ULL, 0x0c9f2ed85cfc48ddULL, 0x136565dade90cf46ULL, 0xbfcabf5840128759ULL, 0xc947288b6c765fd2ULL, 0xe52046cd4a717dcdULL, 0x15c3b039640c328fULL, 0xc8a08a4caf7d5ca5ULL, 0x14fd2b62479fbdb6ULL, 0xb52dff44d2876257ULL, 0x0de96bc630230e08ULL, 0x978f98473a48867fULL, 0x90ce87d2edd3700fULL, 0x12e2f0bc3d75d1d5ULL, 0x2b39520e1356e371ULL, 0x5a805fffadb2dffeULL, 0x2f7fa299b421d8d5ULL, 0xb5bf9a2e9dfcdd5bULL, 0xcb7e073c1a43dd4cULL, 0x61a710177ba49028ULL,
+        0x9a5657711519b672ULL, 0x60353b3e52293cc2ULL, 0x0b476782048fb15aULL, 0x2db128606d27583dULL, 0x130118a350bf1781ULL, 0x8e93a0b9c14f4b7cULL, 0xc34509f614e5269dULL, 0x41c05e97f1a60a63ULL, 0xe9e0d7e3b2b8aaffULL, 0x3d12ade96b8f79f1ULL, 0x146be01e3ed34427ULL, 0x1c3db82a68c6d8f2ULL, 0xf25a6bfe83b97cdaULL, 0x481454e41f99ec01ULL, 0x0f18eebe24cf8b47ULL, 0x0c084b0d0cf90c7cULL, 0x5e48e7187708edb2ULL, 0xd93b47201fba2de3ULL, 0x6d223af143d5a814ULL, 0xd4be0f794add3eefULL, 0xb32b09a9ff4aa545ULL, 0x696bf0b006794763ULL, 0x99afbc8ff8aad39dULL, 0x375845e6eb166165ULL, 0x242261b0216c7f19ULL, 0x441fa090d76de8e2ULL, 0x364c417f4ff0a85fULL, 0x9566090b4208145aULL, 0x9b48d565bc8c1f0cULL, 0x1b80591100f52f65ULL, 0xba4dd5c0e0f11f61ULL, 0xd951d611f53fd3a7ULL,
+        0x1d10da26d9fca55fULL, 0xe970ef19da1e65a6ULL, 0x3a8fa6d29be920aeULL, 0x971db70a59639afbULL, 0xf4537697441941faULL, 0xbeb3f0bcec5bf7f1ULL, 0xb0e4eced8de37bd6ULL, 0x85a6d2bfd82cbd53ULL, 0x12843a354c024bc8ULL, 0xe09aa8cefaac60c3ULL, 0xcad2502bdece083eULL, 0x3c1be593fdf99fa8ULL, 0x07d505de9133a238ULL, 0x71e18c41e55f7e69ULL, 0x394ac67edafd5868ULL, 0x09c82a079a56790dULL, 0xcffee165ec0cc21aULL, 0xb947d77b70528f36ULL, 0x7d9e77c560bd72eaULL, 0x513254f9dc16fa1bULL, 0x35fb30d0e1324014ULL, 0x71a25e2c7260ee66ULL, 0x550e9729c755b6d7ULL, 0x3b8d6b993e6973b3ULL, 0x9573f3bea81eeb16ULL, 0x079b2915fa55eaa1ULL, 0x988308afbc189331ULL, 0x2aa1d145e834a209ULL, 0x4ed299b2c0053dafULL, 0xac05c7f72bf75022ULL, 0x10fab88104a93af0ULL, 0x2320b8df4cfe91f1ULL,
+        0xd24b42c9dc7d14f2ULL, 0xee12177529de0652ULL, 0x839fe21e87b6d063ULL, 0xb06f14c7f6383a02ULL, 0xb179eacb8e3d3067ULL, 0x488a8a03012dfee4ULL, 0x541fbbb6d13db222ULL, 0xf43d7c45149c2687ULL, 0xaed28830977e72b9ULL, 0xbb681ba5b2a67e1eULL, 0xedad7953337705d3ULL, 0x4b33c1249f6510e2ULL, 0x6c9e5c22c11ab81fULL, 0x7474b414e8e13a31ULL, 0xf4825336f803c0b6ULL, 0x60f732abc7244f92ULL, 0x6269344e76c5015bULL, 0x1f70747eb77e4a45ULL, 0x24cc85a34a422ac5ULL, 0x0846fe6f09106484ULL, 0x23c3049284c607f7ULL, 0x6942626b35274ae2ULL, 0xe2d6e0e873e2a71fULL, 0x85d56fccb44f31f9ULL, 0xae9c1d5e4f5e997cULL, 0xf1b23f4784930a31ULL, 0xdda635569f1c082fULL, 0xb187cb4be2bcd377ULL, 0x9962b139e1dcb011ULL, 0x089f79d00cfa8f67ULL, 0x779cf9bcf905d4a5ULL, 0x5ca3751b44d980b0ULL,
+        0xf0e79a5eafc952e1ULL, 0xcee9a4940d5878a9ULL, 0x9306630274a5269eULL, 0xe8f8b741c2af27dfULL, 0x7680f3eea625feb1ULL, 0xc34b4de838fe83d5ULL, 0x4a2a3b5951f095d7ULL, 0x97d48b63b918e96eULL, 0xbcada95036b01aa4ULL, 0x0256351a33b01ae6ULL, 0x8013f9be3313a89cULL, 0x2b8168a2105c4482ULL, 0xe2940ff657453d6bULL, 0xc7d607d828170171ULL, 0x9266a666289414ceULL, 0xad4748c2ed203ba5ULL, 0x6fca61f4726aa750ULL, 0xe7fa70a8e15b31e6ULL, 0xa7987d9ab34949b3ULL, 0xe343375eeb8d59dfULL, 0x2fabf0ce9f02bf04ULL, 0xddd66eed12792b8aULL, 0x2e95e8ea3fccf374ULL, 0x738136178155e566ULL, 0x83c21f5f4984f4adULL, 0xe4d29b07faafd841ULL, 0x30701650b39e4917ULL, 0x02bfd163368433d5ULL, 0xaa00ae27afcb1618ULL, 0x5be384f681880dd8ULL, 0xfc17a68442edf916ULL, 0x6e79c076e3b98e9cULL,
+        0xcf2a623904f35c12ULL, 0xe780b4d038cc5a86ULL, 0xb6c54bf1f248930aULL, 0xad7544a3081ebcc8ULL, 0xc6dd12486eb2e27dULL, 0xe0fbc7c3ea8c7671ULL, 0x791e299bbefef3b3ULL, 0xe24144492d5bb6aaULL, 0x21270637acfc6b52ULL, 0xff04e460383ad6b8ULL, 0x92133aa5d8b38af3ULL, 0x0d791877909f8a31ULL, 0xf6362f7bcf8d97c5ULL, 0x7d31a5483858d0b4ULL, 0x4a4dc0118313ec49ULL, 0x1dbdba6b44184dcbULL, 0x1ba19545816081e4ULL, 0xa607200f1d93554eULL, 0x818759b6ea7ad7b5ULL, 0xf1d296176bd9d58cULL, 0xaf32cd16793e1cb9ULL, 0xb07faf244b25ebceULL, 0x88ec1929852fee5cULL, 0xdd10026a6ad9ae23ULL, 0xf3b1efe949826af8ULL, 0x9ead28a36f7193c0ULL, 0xed93bca08b71d8c8ULL, 0x1bff2f2699ce1db6ULL, 0xcb095c61f8b1f389ULL, 0x7c1e2a272cd14f2bULL, 0xff0441138b324a62ULL, 0x6cb699e61221e887ULL,
+        0x2251607b436b593bULL, 0x4b42ef0572ff0ff3ULL, 0x419896b5f27eb8c1ULL, 0x2821204f30fe6de5ULL, 0x564e97b5812abf59ULL, 0x7dfe1f4eaa17dc79ULL, 0x5281b313d030b6a2ULL, 0x9fc7f2755a5a98b5ULL, 0x2db1ca8f80586c9eULL, 0xad141c1067b0636aULL, 0x7f8524347dcb70d8ULL, 0xea84842f9fcf89b7ULL, 0xd9ebd806e62b5fccULL, 0x1876cc68b2c3dd9cULL, 0xcf75b3243da14c71ULL, 0x139f60e9a250870dULL, 0xba78e9ad55034f14ULL, 0x09d506d57582c188ULL, 0x0d81d2549bed5d70ULL, 0xa843291a381b5effULL, 0xfc3b1658aa7c5b17ULL, 0xfd5aa302651629b1ULL, 0xa9ad282ea9ca6315ULL, 0x27c3c011e6d071beULL, 0x5b60296001064df4ULL, 0x2ae0b44394768068ULL, 0xccdb08df4b51fb5eULL, 0xed90b212ff53245bULL, 0x42c9c4f085d36f43ULL, 0xca1e163d6dbbb495ULL, 0xf4eae512fba596b5ULL, 0x9b85e2dacae94275ULL,
+        0x663425f9b67ab335ULL, 0x1a655dc24014fdf6ULL, 0x4ed7a5b4efef0f04ULL, 0x84c36c95ee2a1e17ULL, 0xcdd2833cbda1c842ULL, 0xdaceb50dcd4fc961ULL, 0x6bc1165d50034c16ULL, 0xcdb0412a43ec01b4ULL, 0xa54cddbfc56ac0ceULL, 0x8482f8d2f6e19783ULL, 0xee7cc4725f58eed3ULL, 0x183ad552850ac52aULL, 0x966262e5ab1484d9ULL, 0xe23c2dfe2e021ee8ULL, 0x0f3cafb76e36bd53ULL, 0x59635b5781eea47fULL, 0xe3ecce3b4241d496ULL, 0xc21f1b44ba5c1de6ULL, 0xf6724ea277ee78b0ULL, 0x7459fd21313fd58cULL, 0xda144bc60bcb699bULL, 0xf331ffcae0a0a742ULL, 0xe5e2436112c4e777ULL, 0x725c43df4f132214ULL, 0x1b0840044ea79e62ULL, 0xb5aa5e073222760bULL, 0xde85457331229d36ULL, 0x5bd9405a4a33b502ULL, 0xe366aba10ab629b9ULL, 0x9aed1ebcf75824d2ULL, 0x1b3cc5ef7164a5a7ULL, 0x76f984a64e0c6027ULL,
+        0x50b1b074636508e4ULL, 0xbd26448d349afc2eULL, 0x786ee9d23297e23dULL, 0x19247552e5b6f8a0ULL, 0x9a1fc330b5eedcf3ULL, 0xd5767261a7e08b86ULL, 0x7bb5454ae0a11452ULL, 0x97531ff1ed93332aULL, 0x0f5cb6f8d65f7c1eULL, 0x7bcc2ce9879a3b16ULL, 0x8aeb097a7d29ec87ULL, 0xbe0bf9d1996dff43ULL, 0x810f69ce74bb7b6dULL, 0x17a6d1ac4474c07bULL, 0xed61bb5d2b0dd3fdULL, 0x472dbaaae7644d92ULL, 0x4d28f966cb3eddfaULL, 0xf1c8a061297fd932ULL, 0xa05fdcf56dadf545ULL, 0xfe40bacd8426c873ULL, 0x0650be9c26c5ec3fULL, 0xbde2c0884433af2fULL, 0x12f22aa78af080daULL, 0x3e3aa45f47dc182dULL, 0x18ad0c0fd1c1fb56ULL, 0x0033e540994cd892ULL, 0xe14073d9a102bbfbULL, 0xf4cd210a9b35d8e7ULL, 0x54e094acbfabed68ULL, 0xe54d2bc4a9a05de6ULL, 0x144b549698f9d8a8ULL, 0xc2e1ba2d922f4dd5ULL,
+        0xc060ab025a2955ceULL, 0xdc8e53b75b64ffb2ULL, 0xb8c1babb5e17843aULL, 0xb74e9607652ddbbfULL, 0xccd263cfde41b16dULL, 0x834bef2a2bf2c893ULL, 0x43eb8a15ea3c5f71ULL, 0xc92d9d81efbe4e20ULL, 0xc4630810ab412bb6ULL, 0xa57b2d809b8584ebULL, 0x5112304cc5421bcbULL, 0x96c523d38f3a1b11ULL, 0x130d26870c938de8ULL, 0x0362e3952cc9fc6fULL, 0xf51de9afdc21200fULL, 0x186eff9d40728be4ULL, 0xa635a84bbb09d7b2ULL, 0x4c6a8d4c007ba483ULL, 0x58f1e87db97deee5ULL, 0x5369bd9c99a706e4ULL, 0x4313f99b6a715cc4ULL, 0x3d48a94c513cb65dULL, 0x852a2337870e50ffULL, 0x82b4e4d9ed0e60f3ULL, 0xd2749671a920403aULL, 0x8161c5d99de930c1ULL, 0x0865b24a0f4e8a62ULL, 0x1cac425e25be6a0dULL, 0x419f5fda2f0b2f34ULL, 0x665c5d9fef1cbebcULL, 0x74e6b9e673c89a2eULL, 0x622448e20755666dULL,
+        0x33af70a5da5ee911ULL, 0xb0f9f57e6bf3aaefULL, 0x983291758710cc5aULL, 0x8e5d861b04ebf20cULL, 0x99b94b61a69d3870ULL, 0x2f0224351ca5680fULL, 0xfa4bed250f9da939ULL, 0x91b41ffd21b3df40ULL, 0x4b1e29f2e1206de9ULL, 0xd11a72234fc7f4e3ULL, 0x4ab1a683ce20cb37ULL, 0xfb9b7ca89689b836ULL, 0x98df0797d4b7bc0fULL, 0x89cd1426e01121aeULL, 0xc85b3da62812cb61ULL, 0x8a8592f5817ed872ULL, 0xb1df2d932360f239ULL, 0x81fd1da1bf32ba4dULL, 0x404fe55fd03ea96eULL, 0x32c342d0bb29c9f5ULL, 0xd12f8ba5083cf78cULL, 0x5ecab6a7f42c3aa8ULL, 0xa42b460f94511036ULL, 0xc60c0e543a0464a4ULL, 0x94d9d08d42e1babeULL, 0x3e92c7446133529aULL, 0xec98d7dcfeaaa787ULL, 0xf204ec9bc38dc7a2ULL, 0x6984f9902e0a3af7ULL, 0x60035bff83356afcULL, 0x1fb3921eebb797abULL, 0x1a7f1a0de7d665cbULL,
+        0x152a8b3cf1c4aaaeULL, 0x60c3558b21cc443aULL, 0xc7ff77df209c8f37ULL, 0xd7ffeb905240444aULL, 0xcb563d7330455c7fULL, 0x90bca71153974f53ULL, 0x32461d44e29a7789ULL, 0x31368a1cce211a44ULL, 0x4ffbbaa857158c50ULL, 0x20317a042c9e524eULL, 0x456eac4901b96238ULL, 0x8c22b4a123e2835dULL, 0x709778fd770ba0b3ULL, 0x8dbd28f43c0384c5ULL, 0x621db16672e7a305ULL, 0x42b471eb4b296700ULL, 0x77e226662e1717a7ULL, 0x2851aa7aac2a6878ULL, 0x8575238db182d011ULL, 0x0409fdabb6da2daaULL, 0x6362c3ee97cfda60ULL, 0x3ba4cef3698edee3ULL, 0xc6acad265ebcb66dULL, 0x62dbd2b0288e3ee6ULL, 0x63994c7d6b3a60fbULL, 0x5ea439317c8dae9cULL, 0xd3c9ccbdb9c52e41ULL, 0x3c05506ac7654e8eULL, 0x71da52aa7f15255eULL, 0x3274f6fcd6e10c76ULL, 0xffc9394a5d657220ULL, 0x09b53c2a1a59b64fULL,
+        0xb6db834b14341575ULL, 0xf5552f2823c92695ULL, 0x175ec952f9e8da38ULL, 0x800604eed6a2cc28ULL, 0xd7ae0eb41b5063c8ULL, 0x4c55cb0744f4ea7dULL, 0x44034991e38e7e86ULL, 0x759511466f27b43aULL, 0x6ccea8a9e8c74b8eULL, 0xc303801d38e509e5ULL, 0x830d4b1d53e89fc6ULL, 0x5996b0eb0aaa93ffULL, 0x65e88e8d4309acf2ULL, 0x8073d66b90b60a23ULL, 0x3222a5f3140a9c6eULL, 0x5e62e1c336d6866bULL, 0xaa8f7e3b3a532eb1ULL, 0x9796c61f8590e142ULL, 0x93a45f23b63af07cULL, 0x638f5f1f3f659f20ULL, 0x614578017e06ae26ULL, 0x6c39a00f1a99d7e6ULL, 0xd4e293333443dc5cULL, 0x9fa1922d8b94a451ULL, 0x0abde7016bf3b3faULL, 0x34ff76316449ac13ULL, 0xe402b903275666e2ULL, 0xfcd056de06fef54eULL, 0x898a895b9943871fULL, 0x22a4fb00f3c44421ULL, 0x2dfc48a53bfbc0acULL, 0x8096c6f6b2f1fd09ULL,
+        0x146dda093fe7d71dULL, 0x48b526ab5aa93bcfULL, 0xba8b9fb9999f8afdULL, 0x91be97e41537c416ULL, 0x8018b54f4469daeeULL, 0xb728bb86e84be1cfULL, 0x736045d5944aa545ULL, 0x6f991eeb5fe527d3ULL, 0xdec677fd4ea24a9cULL, 0xeb39302ad8458514ULL, 0x5db6217ff001ff1dULL, 0xdd4a3010f904e904ULL, 0x34046e877533de59ULL, 0xfebc0c837718b11dULL, 0x6b97fcbf0cf3d38cULL, 0x68e3440b3d94e808ULL, 0x8398e20826c931a0ULL, 0xc7ce6e99fc25313cULL, 0xfcc696796044ad6aULL, 0x4d10c66532f44391ULL, 0x12fed81ee474bb48ULL, 0x26b18def550e1074ULL, 0xd8faceb88cb61bf2ULL, 0x354a93e9391f3841ULL, 0x5e5b7e9230b25eaaULL, 0x9917aa42ccbb0de0ULL, 0xae2b4813d7636dd8ULL, 0xecdb7428dbe9d9ccULL, 0xe9236537048dc693ULL, 0xcf644aad5daa40aeULL, 0x79f7e9d4e4bf8199ULL, 0x5d3f601ee2f9abf4ULL,
+        0xbf434582f433b2b7ULL, 0x054f71974e02ae30ULL, 0x79ddb255f22be804ULL, 0x26d7c74e481f5fedULL, 0xbc6244f165846564ULL, 0x935ba13e4363a86dULL, 0xffa476522221d913ULL, 0x80e4ddcd6faf1e8bULL, 0xaa768e611ea6f9bdULL, 0x09b6c6937de36133ULL, 0x5469f4362d2b8adeULL, 0x9532d04c4e4cb72dULL, 0x6a0e1aa97e049777ULL, 0xc30c5b631e5f7d9cULL, 0x88f3454753d51e6bULL, 0x8a5119035c5f792eULL, 0x3e53e8cdfc74d892ULL, 0x8b5dd58526516c68ULL, 0x79a68b37d9b05566ULL, 0x5b0c009c07fc95f9ULL, 0x5e9a41fb7174aa5cULL, 0x4ba119a84f2d1971ULL, 0x7982805c916b4dd6ULL, 0x5858fc47d0d6e558ULL, 0x27347794b256c735ULL, 0xcfe7a6c481fbb8c2ULL, 0x6ee720cd35ca1c00ULL, 0x05d98e9c13f30242ULL, 0x1f25922bcb70d681ULL, 0x5415cb6bae03b4d7ULL, 0xb127ad98bc8856c6ULL, 0xb9ea0fb53b56f0a1ULL,
+        0x7876b5709b7fbd35ULL, 0xcd2ce0b23007e100ULL, 0xac5d031a37765567ULL, 0xe86b2ec6a56c00bfULL, 0x5bbb64d973b6a9dbULL, 0x1b170c537d34131eULL, 0xba4d3ed7bc79a705ULL, 0x9f71abc218fd6a56ULL, 0x68ccea0e9e9a8d3fULL, 0x6a593d93622ed691ULL, 0x48ee58382a59b28dULL, 0xc7a3ee88493a619aULL, 0xe48c9b1d24850a54ULL, 0x05055515b814c30fULL, 0x4fe916e278ff10e8ULL, 0xfeffaac69d4ccc9bULL, 0xa7106688d88a8c0cULL, 0x183f76e098fc17f2ULL, 0x82d627ce9a4e0c4eULL, 0x8d83048b529080f6ULL, 0xe5ad29a5e5391eb0ULL, 0x1f9184ac71e0b6d1ULL, 0x5ae39d6ae649f6c6ULL, 0x5c754d243e0eb169ULL, 0x42f73d7d8b06be62ULL, 0xa140c438af705fe4ULL, 0x2be07024aa274640ULL, 0xa0805716a88b2b16ULL, 0x80f5018d8bd5f5f6ULL, 0xc1a9fd4b742125f9ULL, 0x3b95249d3352d5deULL, 0xdb167b537b35221fULL,
+        0x678d72eb17ae960cULL, 0x1484c9092bad902dULL, 0x5b970af3e0c448f0ULL, 0xcc79dba7fbdef5c8ULL, 0xda307ce0e6ba7412ULL, 0x046b4f4914f9a3dfULL, 0x0ac2b3b885490897ULL, 0x2a1aaaec0ac54262ULL, 0x181d235c7e284a63ULL, 0xd1da7145360559deULL, 0x1e5788c93a8a5030ULL, 0xff78c6a021525dbcULL, 0x909c8d77d3b8c6d4ULL, 0x84f7e50a506acdbdULL, 0xf082c4186d4efe60ULL, 0x7710a90f01948eb8ULL, 0xa5dd29f68f25b2eaULL, 0xf1b29f52f870c304ULL, 0xe3160b008a6f621cULL, 0x05e6164ae1e336c9ULL, 0x60a7a2b10da8de22ULL, 0x4fb686d5b7bed86cULL, 0xf1fb9f39e0d6a451ULL, 0xaeacc527b5dd984cULL, 0x5b14c24584ac7957ULL, 0xcf907187d97382bfULL, 0x7a307906a4b7597aULL, 0xd020446d178920e9ULL, 0x32e1b8fc23ee335aULL, 0xcf55a974d6bbb326ULL, 0x560f7e192f6eca6cULL, 0x6085fd97fe1a43dcULL,
+        0x671ae53dc3846d95ULL, 0x66508f6b69e6688cULL, 0xa0cbe7945ea762feULL, 0x47c1e4a13c171adaULL, 0x08a080d8bf1ed3cfULL, 0xb87f8770d3f71a14ULL, 0x040236685ee7d251ULL, 0x195344297c5fff8bULL, 0x56cfe260c55a2704ULL, 0x4d7723a819c86de0ULL, 0xfcf401e7d569f8e5ULL, 0xcf23ad20b30e3676ULL, 0xec6ba0cf6aedc39dULL, 0xa8904773a7f449faULL, 0x3a8f7079cbdcc015ULL, 0xc754e2906d75c65dULL, 0x159fbcbe53fc35ccULL, 0xf14ecd2188c8d95bULL, 0x657dbe5c9237fc32ULL, 0x6d418716142fd363ULL, 0xd278f21170d37334ULL, 0x1e76d4b37c9eeb0bULL, 0x4e58bee34886fe15ULL, 0x726cc5a05840273dULL, 0x99a7c5b1033cb2eaULL, 0x363fdf8c36fc42d3ULL, 0x8442ca2bb447f6efULL, 0x84ce9c5d4d00f3e1ULL, 0x0a89d35578a81292ULL, 0x7a6823da4cbd08d7ULL, 0x3519100e896f7be9ULL, 0x535e01607cc10f2bULL,
+        0xc10a951c9a57bbf2ULL, 0xd8d23ddceb556161ULL, 0x9e8b0127dce31d08ULL, 0xfa4c28b2d3154f16ULL, 0x55ee72454afb1d0dULL, 0xc72964eed30c0579ULL, 0x27e49a5ed3a03313ULL, 0x08e2dcdaef19238eULL, 0x667f89c92828a034ULL, 0xddde824be7715b2dULL, 0xb9aa1e94326df8bdULL, 0x545edfc102f6594fULL, 0x814458e64decdf6cULL, 0x43e6793daab844ccULL, 0xe26904ffe189a017ULL, 0xc69a86588ac0f492ULL, 0x22f42387f81cdccdULL, 0x33e48878f02cbad0ULL, 0xb443c746cbf89d5aULL, 0xb63f15cb5713bc91ULL, 0x76985a2d745fe656ULL, 0x316aa1ae1d82cee9ULL, 0xebc1e768820581eaULL, 0x29d1c9467dc11845ULL, 0x2f8d78421ab97d4aULL, 0x9bfe6d70cdc9d5d0ULL, 0x1680b3e44b06cda8ULL, 0xe65819dc6a11564dULL, 0x54a571d5bc4a9af2ULL, 0xab97040e2fb87124ULL, 0xd896f9171f218f7dULL, 0xedf7ccc4a6e9412dULL,
+        0xfe02df39556a281bULL, 0x281f7f610ff2bd87ULL, 0xa661d93c06698818ULL, 0x818f5e016c62084eULL, 0x471a962bbcf96532ULL, 0x3bf69c39bc5f1ad6ULL, 0x3590a9c54087ea1dULL, 0x19de0a6b754744ebULL, 0x8a6c714eca4d5d12ULL, 0x0cdf8279f931e58aULL, 0xdbc493fbadba6b2dULL, 0x27ab550b85db8583ULL, 0x969fa5951633eabbULL, 0x9731734dbe98fbecULL, 0x6d7d3c2f4dea70a9ULL, 0xcbee4bc27c88eb5aULL, 0x37e34e6819a6c32eULL, 0x84ebe21091bf9654ULL, 0x8a281535300a50bcULL, 0x21f277bcfe9c734eULL, 0x9d5c672e38783848ULL, 0x91ba2118631b0c76ULL, 0x94eaef534a7dcadbULL, 0x0ba8986cc9ada5edULL, 0x27020dc0ec312f67ULL, 0x9cb0011d992608b3ULL, 0x7cd51e44263a401bULL, 0x493879188ec36974ULL, 0x01649279f4bdc689ULL, 0x514833e37e1be76aULL, 0xf837d887e7bee2d2ULL, 0x61abdacb66812bd9ULL,
+        0xaab244fa55913f8bULL, 0x506b5b1065c5dce7ULL, 0x85f498ed62d0f6e0ULL, 0x67e4bef4f8ae0330ULL, 0xd0786aed8930d167ULL, 0x3509453d9dd56586ULL, 0xf7d1d72746daace2ULL, 0x4e65a808089d3abbULL, 0xb600f2b0c04a7070ULL, 0xb5fd9a8eae52dce5ULL, 0x119846f8ae384b5aULL, 0xafef0198bc93f692ULL, 0xd1f0d302170810dcULL, 0x9720a8660098322dULL, 0x91733b6aba6b544eULL, 0x39c37fa9af720386ULL, 0xf10c49fdb391fed1ULL, 0x6cc4f24bbd79b692ULL, 0x93cfbfc6ad9c1832ULL, 0xf04c5d9d465f2cbeULL, 0xc0fc2355608f0333ULL, 0x8182032b06678359ULL, 0xfd6a584318417963ULL, 0x748a0076f5fbc985ULL, 0x341fa69f1e9b32f1ULL, 0xd6273e6bb8981a7eULL, 0x91acad855f021145ULL, 0xdaaed75eab42086bULL, 0x34ba20c8ac36721aULL, 0xb40f60864f743b3fULL, 0xb6b1d7e6547e7cbfULL, 0x8df2008a500c4dc7ULL,
+        0xad91e08950d50aefULL, 0xb0271f185eecf675ULL, 0x20d644a11f91a134ULL, 0x5ec71bbfaaed0462ULL, 0x5b8c4cae3675f7baULL, 0x12816d7fda309583ULL, 0x20b861793eab1c62ULL, 0x2860834f87637ee6ULL, 0x8f4fe029d9df53cbULL, 0x3d5d2284e822ea32ULL, 0xe8b20506e510fd9cULL, 0xf857f57289af7d01ULL, 0x97ba9c5bf1f1082cULL, 0xace4782dd8fa998aULL, 0xe50cd3d6d73206a2ULL, 0xde29418b0ee5abbbULL, 0xae666f65f4b61ee9ULL, 0xf3813dcb0b31d57aULL, 0x98cc94254872ec1bULL, 0x618d22ad58fd7b5fULL, 0x40e01803e63ad774ULL, 0xd1cef541e555bd09ULL, 0x79cca0c5afa269f9ULL, 0x608bf4e95c3485cfULL, 0x85bee87973adb91dULL, 0x39d0cb6b0e43614dULL, 0x4f345bfd2d055555ULL, 0x4ab40e67be179ee7ULL, 0x64f58bf5b96080b8ULL, 0x6dc5308927910934ULL, 0xe6753310db2c3295ULL, 0x79ecf0b9d88702acULL,
+        0x1de869a95c208e52ULL, 0xe5b8d45bd86839daULL, 0x8f2cba6e0c3b6898ULL, 0xeaee8aa953e28e7aULL, 0xe0c257421dcc182cULL, 0x58fe6b5d5e58c2f6ULL, 0x691d94e14953efdaULL, 0x1600e0f56dcb8c5fULL, 0x1af2731051ab9498ULL, 0xbebeb3d20dd07035ULL, 0xc6acae4c453828d9ULL, 0xec8aa86dc4159645ULL, 0x0bb7260bace3e1f1ULL, 0x2a687875e39dac01ULL, 0x5fe4347f70d3621bULL, 0xd40c14bedf2360ecULL, 0x6dc3b0e3c38f7823ULL, 0x9ce497c5d2262787ULL, 0x0fc2c49f5afed59bULL, 0x8a8b0e6120778180ULL, 0x333ed9f9c4b3c9f0ULL, 0x99f54c0217918708ULL, 0x4cd7791fcb5b1ee5ULL, 0x4068cfd8ba4f2303ULL, 0xe3a1ccd01b3bc681ULL, 0xc14481812e6d51adULL, 0x2cd4385c1ca1cba9ULL, 0x9cd5872bf51d09adULL, 0xfe370725f6b85e66ULL, 0xcd5d9074bc24be6fULL, 0x8d8bbe9ea2bbef24ULL, 0x5b65aeab492f19efULL,
+        0x62b1b909a928a9f5ULL, 0x111a7d87a467578eULL, 0x26b639097fb5d846ULL, 0x75e0de791d4d2903ULL, 0x9c91d816ba8ffb2fULL, 0x914f8e11da09b9b0ULL, 0x3447b8d64783369fULL, 0x1fd87bd85ee14982ULL, 0x86b13196f6b8eaf0ULL, 0x34fd6e1dc847f34eULL, 0x6cc61f016633879bULL, 0xe7f62015538cad26ULL, 0x11581052e4db0abaULL, 0x2ee961748ff483ebULL, 0x5d4510c838bc322dULL, 0xbb63ddaf88041107ULL, 0x10187f0eb36e5bfbULL, 0x8bd1c3838d150b1bULL, 0x4586f487e4614a38ULL, 0x9435a63ed5142ab1ULL, 0x3b59ead67c94fcbaULL, 0x1eb3acc9a21e374dULL, 0x8785fdab2b067c5eULL, 0x315b7cd2239b263eULL, 0x49c566657c0c0422ULL, 0x1c9dd5fd514201f7ULL, 0xa4b27e5f015642aaULL, 0x738f3cb227bb8f42ULL, 0xe21ab9fde2d524d5ULL, 0xd23491ec4980f04cULL, 0xe35c34e99185c48cULL, 0x2ad93fb9ed9cfbc0ULL,
+        0xd3ab9b4c4e92a9e5ULL, 0xc850eaf696668484ULL, 0xcf3690ebd6c57b01ULL, 0xd17abba9aa6816ddULL, 0xd12d8b1670717a77ULL, 0xc9edfb02500bd5f1ULL, 0xa93f208e9fe30d65ULL, 0x2abc7a4e4ad9e9e2ULL, 0xa1658ef84a6eaa8fULL, 0xea15d20d511f848aULL, 0xe3ae54ad68f501e3ULL, 0x83d5d5e64e5712e5ULL, 0x48289ce4119aab4eULL, 0x6ca717d65b31b984ULL, 0x8013497ae422c81cULL, 0xa907cf08a385e546ULL, 0xd74fc6178b9c8657ULL, 0x99e44f1057b2e86fULL, 0x3617e38ac62650dbULL, 0xf39c9075dd9d01a7ULL, 0x0bd28db4acd625c3ULL, 0x5a2b98c222738110ULL, 0x9fad1a6e1cdac8ddULL, 0xd1f69b093b50bbbaULL, 0x6eb8fde918ba4789ULL, 0xfb01d576874be10fULL, 0x159242ed3ca3e9d2ULL, 0x9147fd90f564ec84ULL, 0x78dfa5edccccfd67ULL, 0x5291eecd8841d901ULL, 0x408c80055b511be6ULL, 0x67c7a245cd809149ULL,
+        0xfbbf1a48428a4262ULL, 0x01e101739ba853c4ULL, 0x48ddb8f011765a5dULL, 0xe92e4408a919d181ULL, 0xe0dc8dbd0920f50cULL, 0xfa5374bfe95c322fULL, 0x4f37465b78ee8d03ULL, 0x0fa8c17ea0deb7eeULL, 0xfeacc3dc93c12c82ULL, 0x8bc4a26e6f47f9acULL, 0xdc719a31c44ba1bcULL, 0xa4c2e0c68af75201ULL, 0x584ae6598f82d05fULL, 0xe1d4fe23cbcf20f3ULL, 0x3e898cd062e173acULL, 0x326a30e4b508f38cULL, 0x25397d2b8f792df2ULL, 0x27604f845a3ad4d5ULL, 0xfbb4d5b1a1c0899bULL, 0x7d535b29ff389439ULL, 0x4c011f4194bdc7c4ULL, 0x89c4d45dfe1badebULL, 0x5193cecd4f7a2b03ULL, 0x1e79b7c8df873addULL, 0xbcbd2b7a5d0d9411ULL, 0x088c8fc0046e3f80ULL, 0xafd4dad4909b00dfULL, 0x52ad99a82b5bda8dULL, 0x82db9cd321da9967ULL, 0x7d4378cd82b2bae9ULL, 0x398d70c5f8fba175ULL, 0xd84c09127749b669ULL,
+        0x857323f37ec1810cULL, 0x955474ffb3731515ULL, 0xe7422a6d83f04184ULL, 0x007c9f09ed3c1d9aULL, 0x63df2e5617392e58ULL, 0xf088364171577dc3ULL, 0x44c55ac94421aff2ULL, 0x66a2ce535336164fULL, 0x5e0ebd6f31c75c72ULL, 0x85d70defa56a2e29ULL, 0xe1253550fda63409ULL, 0x0051cc66e8a2f447ULL, 0x007ed05abfeec2e2ULL, 0xe4c5e234a965afa6ULL, 0x84cc3d1cfe1f4ac0ULL, 0x4da9b5bad1ce85f1ULL, 0x971cca3001e1193aULL, 0xe2418a46c86194abULL, 0xebb6d2327fb36986ULL, 0xbf073437485b38d7ULL, 0xc913642d38be8045ULL, 0x9042296419766c21ULL, 0x424a4fa762e818d3ULL, 0x3103538d106077b7ULL, 0xfa78e7543dd74476ULL, 0x48cd830610fd8fb1ULL, 0x17bd2061f84bdb13ULL, 0x90559b72768fbb03ULL, 0x0e7ce81e6077821fULL, 0x2c47ca0bbf66fb4cULL, 0x6a436ee7cf4be89cULL, 0x4b3012efe9962428ULL,
+        0x2789b842aa55e66dULL, 0x6732c6920319ab41ULL, 0x112b8fa02eb8113dULL, 0x7898173f060cf50eULL, 0x8dc98fd25fc97caeULL, 0x0a08a27b417810c5ULL, 0x0853b67a5210e8f3ULL, 0x2cebed7be4809570ULL, 0x954a4cb0148b30b1ULL, 0x99e15cb855f9a7cfULL, 0x83a672c1c6a2b740ULL, 0xdc65ba8f7484e8a1ULL, 0x2e73ce9070bf8b71ULL, 0x69e5f34b108a2f17ULL, 0xacaefefec3ea3a81ULL, 0x3773303e0c299b47ULL, 0x1c23fbaac95a6cddULL, 0x211d0f9719e59c2bULL, 0xfeca7fa01ea718ceULL, 0x5bbd38e49764908fULL, 0xb862137884fccfb1ULL, 0x0ab7c7c44b93e575ULL, 0x8cd7f0dec39cf7caULL, 0xf4e7fd8d405d3555ULL, 0x4da8b1e531590e37ULL, 0x946d639db62a6858ULL, 0x1bf67fe5a13c7553ULL, 0x97decff98813e563ULL, 0xace3a4d84a006ba8ULL, 0xed44d60a1345b782ULL, 0xd63ebe23bc46037fULL, 0x37a951b3c4f0bb53ULL,
+        0xf48fe3d84808882eULL, 0xa082ff85e666a0bbULL, 0xac06d1a2adac01f7ULL, 0x53d164f9c6a6709dULL, 0x764b9f1aa4f751dfULL, 0xfd3a1718c406addeULL, 0x73a6e2700f81bfb3ULL, 0xde5e2d9efa31d318ULL, 0x2a6a1a829582efbaULL, 0xcbbce7ebaf7cac78ULL, 0x94e0691865ce88c9ULL, 0x88c0ddbe1fa8c7ccULL, 0x464af3c84f4124d3ULL, 0x433c64cafc6058e8ULL, 0xda1f91ddb54160eeULL, 0xf023140b3159f984ULL, 0xd78b3612ff239a85ULL, 0x3eb397919cf520acULL, 0x0543421e54d12f17ULL, 0x7857469b4c69332cULL, 0x51d52363fad12c35ULL, 0xfd96fcb1d042e602ULL, 0xc66db8661abaa019ULL, 0xa892d665c1b4fbc1ULL, 0x92e5a83d3d727ed2ULL, 0x3e2b16017882cebeULL, 0x9590d86776bfcc7aULL, 0x74ae496baa771485ULL, 0x0e4491115342e7b3ULL, 0xa7d46a34e2f963a3ULL, 0x0ecbd9d7e2045887ULL, 0xfabd2ae8d49bff42ULL,
+        0xb8bebeca503eeb6dULL, 0xa6e42e3a7ef160ebULL, 0xbc2c182b9cf60526ULL, 0xecacb19e8e8873a5ULL, 0x2a513e2c856d42beULL, 0x841a98013e5f9fbbULL, 0xcd54b5e9e5a4a27eULL, 0xe3916042947e26c5ULL, 0x1cd86d9e317801feULL, 0x141bbee99a7733e3ULL, 0x1c5f75017dd28092ULL, 0xe2d728aeaa599618ULL, 0xb3f255c502f4fd24ULL, 0xc88c39b2a3952308ULL, 0x54c10334bb7c2460ULL, 0x602b4b6c3cc769aaULL, 0x68487fe81d0934ffULL, 0x45261db16828b003ULL, 0x7b35abe11c66eeceULL, 0x7dca48ec8c6c0d91ULL, 0x301e1f91d73a51d8ULL, 0x894e594f16da117fULL, 0x1ba6accc4cea873fULL, 0x528dedbd9ec6eee0ULL, 0x989e09b629ba85eeULL, 0xd711fa7095db053cULL, 0xd13390780995db5bULL, 0x4f27250b30284c04ULL, 0x711c6f6a5f534106ULL, 0x995ef966f82f0d11ULL, 0x86db852dd2c72f93ULL, 0x205d6118c91d4169ULL,
+        0x4cf1008a29c6df96ULL, 0xcf86981e5109a2aeULL, 0x132ad4b3747a2c93ULL, 0x8ed687c7147171bcULL, 0x5a9b3078c1571142ULL, 0x7b0be09ed5e34a1cULL, 0x6586f1f8b7cf47d2ULL, 0xe8e0558dbbc30a77ULL, 0xc4e43877d6124fa1ULL, 0x5330242317462433ULL, 0x00c49522a6f9fed4ULL, 0xd1f22f3fd7ccd821ULL, 0x61e6d51ed61fbc4bULL, 0xd1bcc11edb8a9a46ULL, 0xb6421fab3711037cULL, 0xb99da8052a2f7d34ULL, 0xc740bbdcae0cc538ULL, 0xc1d514b9a543c32fULL, 0xfcb078b52ca5eb21ULL, 0x7be1a184c345ee5dULL, 0x5bb90c5fcaea8545ULL, 0x53e8a57b0aba98e2ULL, 0x83a54597691b0b48ULL, 0x40f12ff649b2ecb6ULL, 0x41bfaf9d0a626d91ULL, 0xe6bd399360ae785aULL, 0x37653b1876a82a9cULL, 0x89c53514cd873dabULL, 0x90f50d3e667fa857ULL, 0xc09fc617f5e0d780ULL, 0x51f14085a0e38203ULL, 0xf8a77683c1b77bcaULL,
+        0x3e0dd1ca92622128ULL, 0x15a4209503a98f22ULL, 0x237ff979de7478a5ULL, 0x29b673d1ef5b261eULL, 0xd5cd1436b24a4f66ULL, 0x9505ec5b45622887ULL, 0x15732be8553dc510ULL, 0x160ccea88815ed39ULL, 0xba73d6539dac18d5ULL, 0x82ed08d408005b21ULL, 0x3b55b78aac8b0caeULL, 0x0fab05dd10297b31ULL, 0x780bbce68c96f421ULL, 0xcb7de4c427e0cb41ULL, 0xd05bcad61c5b3c8cULL, 0x6c902b2eca2ee5a1ULL, 0xb5d95df56df3ad8aULL, 0xad3fe804915e4ac2ULL, 0x8f77ff79680f39e7ULL, 0x2141cf7377a1ed2bULL, 0xc72c07fa1f179887ULL, 0x7f3c5e62db7453e7ULL, 0xdb962bd30916e794ULL, 0xc161f02c47e6d82cULL, 0xfd4d53cb2f9668d2ULL, 0xb6511375df2ce8f5ULL, 0xacbc9f79b14d974cULL, 0x0452b875d1b94cb7ULL, 0x0665ec85183cb371ULL, 0x22c7250cab7c5eaaULL, 0xc276de11717b11c8ULL, 0x610341bd9c7fa13dULL,
+        0xc8d3a00ee2722823ULL, 0x114886b024dd39b9ULL, 0xb2a6fa1f3c12c964ULL, 0xdd058a9357caea74ULL, 0x7100398094cfbef5ULL, 0x4b037ce0b57589c4ULL, 0x22423c5258e3677eULL, 0xd45b2bc9b32c72fdULL, 0xa24dfe9b9cf9a112ULL, 0x53e05e2d1550ddcbULL, 0xa3a21906a7bff8e7ULL, 0x9450adc294194727ULL, 0x505fce7fc9e7ae47ULL, 0xa258d4a4dc40081eULL, 0x198ecba1bc7efb83ULL, 0xd9523d536665d2f6ULL, 0x752724fd3dbe695fULL, 0xeaa99faa83d441a6ULL, 0x3f310e18c9d09469ULL, 0x31b35d6c3493e44cULL, 0x632cfa6bbfee1f43ULL, 0x1b1cb29dfc4e077aULL, 0x5a6108c7d5363f07ULL, 0x08a55117370d40d0ULL, 0x598df77c11c1dd1aULL, 0xf6a33708d3ae7d03ULL, 0x4ef93eed8cbdc316ULL, 0xef2e8186a674ac73ULL, 0x072d499084fea950ULL, 0xce0f17a97b7329baULL, 0x34e0812eca6b679fULL, 0x35c88cbc0cd5bdb5ULL,
+        0x18cfa31fe9e4e90cULL, 0x10f41d49998f9e53ULL, 0x571f56b35921c82bULL, 0x36ac186a1811b7f9ULL, 0x3ab16431a566af0aULL, 0xc036c0b74107e4beULL, 0x79c1096cfef056c3ULL, 0x2748364538255bb6ULL, 0xb200004f830b67c4ULL, 0x8930b6981acd1b34ULL, 0x49ec4fbc358a6765ULL, 0x06b45d65a14c5966ULL, 0x5b63598f2e959060ULL, 0x75f0f65635939c78ULL, 0xbd7fc4a6f293fc1fULL, 0x8df3d2190ad13b60ULL, 0xb6c551e7a4919d30ULL, 0x176d24b2d5da0ae0ULL, 0x3e31db89e071b898ULL, 0x84b52fe60fa1988eULL, 0x0b0ef743c46f496aULL, 0x168a4332b24fe24eULL, 0xe3f5ccd8cc0b6c70ULL, 0x616bb11c3dd984ceULL, 0x280f65455752d9cfULL, 0x778a5bb0e43e7737ULL, 0xeae0e1a0b76af077ULL, 0x5d11b1df2b869114ULL, 0x0c9033adccb85024ULL, 0xe4c49d999aeb390aULL, 0xcdc37f705c209ae0ULL, 0x7ea859b3018e3363ULL,
+        0x815bdba43198f8d8ULL, 0xa7f422e17b0100ffULL, 0x3c0dd33194ee3b96ULL, 0x13dcd13217e21079ULL, 0x8b3759eb5e7dda32ULL, 0x52694e8a0821c33aULL, 0x5a95262975f48842ULL, 0x1a39517621810f35ULL, 0x8233e32cce87d9b7ULL, 0xc04c9ccc222daec0ULL, 0x06853e0bc02553f5ULL, 0xc1a0795598d84359ULL, 0x8940a696ea1967afULL, 0xb064867c82ecea86ULL, 0x6da6b921d68b2dedULL, 0xbc050ea69db5d5f7ULL, 0xf77647e59f94054bULL, 0x238bd18cb996bac9ULL, 0x299fccc51772c62eULL, 0xaba41a984682f063ULL, 0x98d924f2283a5bbaULL, 0x4ebb10d4986a75b6ULL, 0x882d21b70edde31bULL, 0xfc5ceea6deb54de4ULL, 0xc136ccbcf228642dULL, 0x0d0b3aeae745a356ULL, 0x3a948e65a18ae87aULL, 0xbf522b44cbb582f5ULL, 0x88a68af259c41ccbULL, 0xbf71e0b183801f52ULL, 0x8299c4a28c87b356ULL, 0x694b8eee9624aa8dULL,
+        0x2199cf35afb84320ULL, 0xb0e1660adf4d8991ULL, 0xab517ff1a594ba64ULL, 0xd0ab4a3e61e59e18ULL, 0x5de8fba967094eb1ULL, 0x55c885584f5fb8cdULL, 0x4f3614e9650f7822ULL, 0xd96daac090a2cbd4ULL, 0x0395637889072f0fULL, 0x68a0e077f8fae717ULL, 0x782f28d25a3bc9c8ULL, 0x3ddfa776c35fcc3bULL, 0x2bd6b87ec73b595aULL, 0xd5b319dcb1e5f67bULL, 0x226fe4e7c0ff9482ULL, 0xa429d141bc12e0a5ULL, 0xa608a00f90039979ULL, 0x29851294e6161cbeULL, 0x61be606fe9830512ULL, 0xa16db599d164b19cULL, 0xaa0da4edb0e80784ULL, 0xc30076fcc409bb75ULL, 0xcbb9132c4b89ec21ULL, 0x402f46a0fe3436b8ULL, 0xa6dc363531d15647ULL, 0x38acd29abeb7c6e8ULL, 0xca1ca0ccc1688f54ULL, 0xd94ea75ba06b7b4cULL, 0x23bc96b0f29958bdULL, 0x18006ca9daea37ebULL, 0x98a297a5bab3edecULL, 0xfc61f9594ec53b99ULL,
+        0x69b690098e60ab1dULL, 0x716d36c3ad9b9614ULL, 0xf86803c3ab5132e2ULL, 0x1ff30ee28766dfecULL, 0xa931ea96ee8a8431ULL, 0x56e68ba1caf9f9e7ULL, 0xacd0fb4a43304752ULL, 0xa962aa4b169600bfULL, 0xe984625b57885cfbULL, 0xcdf34bd13e223fd2ULL, 0x51fbd106d87ebea8ULL, 0x2ca20fffa0fd13edULL, 0xc98f2c2f1f2158d0ULL, 0x90e690452a45618eULL, 0x4b189d1dc40c9472ULL, 0xb085ddb316e73b90ULL, 0x004877018271d135ULL, 0x7b286634524d0610ULL, 0x9d774fe71953fa14ULL, 0x74cfc8e2d47e683dULL, 0x0b4db21a0f57384dULL, 0xa64dd46edbc31293ULL, 0x57daf56da1e7650cULL, 0xfbf75bdd9ff00d45ULL, 0x2ca8552dc5bcdad4ULL, 0xc3d68173b67e0fedULL, 0x4ea5fa57ce5d7748ULL, 0x57f8f35eda085347ULL, 0x9c0105bfc105392cULL, 0x189757c291639d0eULL, 0xcd2ad488a4897fb5ULL, 0x6ed12f22979f26e8ULL,
+        0xbda937f2ddc62c3fULL, 0x87b33272419a3fbfULL, 0x4a568bdf5ddccbe8ULL, 0x3f540f05587256e7ULL, 0x97378ac10df97219ULL, 0x5417350cd6ca8fafULL, 0x00d3aa8079bd0c56ULL, 0x5e7bf530d2db0f1dULL, 0x9cc2fb546a22b6f8ULL, 0xb0d2b9806b8ee2fcULL, 0x6697fcc27d2f42c8ULL, 0x9b1d96badbcb991eULL, 0xec19fc7a93b8eb47ULL, 0xb56acadfca824e43ULL, 0x899d4f48dd8eb939ULL, 0xa39f4f7a4e865873ULL, 0x2513b0fdb92c3e4dULL, 0x68c9b68da9bef197ULL, 0x8934af44d662cc9cULL, 0x1bac7ad258ed9678ULL, 0x6ae149b73cc0d845ULL, 0x9aedf56057b5dc4aULL, 0xe360ce12fd9e7644ULL, 0x8cb4ea7e90a4a49aULL, 0x25061d9ade73578bULL, 0xb4c21b653350490eULL, 0x8d0b50fb20b28556ULL, 0xe170da50587bf34eULL, 0x0ecd3841aaf2e7afULL, 0x3794da0b8c6da94aULL, 0xd1450a01f8660608ULL, 0x863deb6290c2ffa1ULL,
+        0xae63829581b9a334ULL, 0x9d067cc6fb38b84bULL, 0x068652e0dff11d40ULL, 0x1eb4d3648d37b4ffULL, 0x83b3c4a5f274b961ULL, 0x0d66ced032a3cf3aULL, 0x48d9d5069c4fdb03ULL, 0x8b772e2ede18f9d9ULL, 0x9ebf8f8e3705a79cULL, 0x6abbbda1308c8a52ULL, 0xc6d7d0a254500e1bULL, 0x9c89795c1eaea907ULL, 0xbf38d09a76b41a03ULL, 0xb72d6421a31d8b94ULL, 0x5658bc7c4e12cdf8ULL, 0x4ca97df84182d623ULL, 0xac4948d78e9e33a3ULL, 0x52d6aaa8cff30e7dULL, 0xf4c231459a9c83f2ULL, 0xe0de1c51de06169fULL, 0xda58f3fecb0f7360ULL, 0xb74f5d6b1cac62f7ULL, 0x4712c4450405338bULL, 0x422f59f4b5b8fb3bULL, 0xcc3738485213b203ULL, 0xa0005e1f1e41b01eULL, 0x1fd3e184750efd62ULL, 0x8ada83c67be732aeULL, 0xcb4b315521dcceccULL, 0xd7e0f3df9edc09f7ULL, 0x53c2cea6ec7ea6ccULL, 0x8d740ac64d9e3da7ULL,
+        0xc0048fe1838f06a4ULL, 0x9f2c52011a540612ULL, 0x3649681bde4f72a4ULL, 0x7bddbc008223f52eULL, 0x2a6a4a007f4a5763ULL, 0x215e097d6ddd2190ULL, 0xc0d5f13e96a79cc7ULL, 0x707502dc09c18876ULL, 0x188338f88de71f29ULL, 0x8546727fc56ab231ULL, 0x107ee8eb99de75dcULL, 0xdd44e1dbe53c7bd6ULL, 0x0faf394e3c770ea3ULL, 0x5f254da0ac10d719ULL, 0x33340ff37dbe07baULL, 0xc74ab4f382e0e22cULL, 0x42775a91916e0670ULL, 0xd1b28def1d75e64aULL, 0x3d0a0e16b5c5a706ULL, 0xbfb9db6bb0e2e218ULL, 0x94a011b9c581e262ULL, 0x655461b12c31b921ULL, 0x17191511d6f6623aULL, 0x4f724e79b30ba5a8ULL, 0x38e1cc01ff8ccb67ULL, 0xc7c888a06bb47141ULL, 0x04a82f2ffadf5fd4ULL, 0x929f00eaf3ae591fULL, 0xeea1ffe6625c489cULL, 0x76020f39023835d2ULL, 0x3b745be57c5d6f04ULL, 0x922fb2b95e911941ULL,
+        0xfbc8ba367d57a211ULL, 0xcbc4ebcffc7af3bfULL, 0xbd379cc439b64f7cULL, 0x913d102ef761bc54ULL, 0xef6234b36ebb88c4ULL, 0x05b64d154b589c3fULL, 0xbc8b98d45514a619ULL, 0xd9a51a6eef9a4c88ULL, 0xb9fa7561168b4f55ULL, 0xfd2fda33314f8b56ULL, 0xfc2dd0e515b1c977ULL, 0xd9210b12a892d144ULL, 0x6213447d66651aa1ULL, 0x260e0013be34c46eULL, 0xbdcf6dd155f070c0ULL, 0x26d49968f3bad800ULL, 0x37bc373cfc659740ULL, 0x9920b58add58a887ULL, 0x023cfd12293bbc94ULL, 0x0360a6cb9c8ad4ceULL, 0x1f10e23038509fc5ULL, 0xa7c9baebec8cfd56ULL, 0xdb65cc9eb2dbe3a6ULL, 0x51ce2b45bf401e61ULL, 0xaa493b60ea29c64aULL, 0xfc0f66d1a3317a19ULL, 0x5e9a534ae52ff26bULL, 0xf686ac3a4f9b841dULL, 0x2cb8145ad437c81cULL, 0xe747f0242cf92784ULL, 0x8c81d6cc40330ad7ULL, 0xa567d8e7a8b6ac10ULL,
+        0x9b53ff2d752384b3ULL, 0x21a341ef9e63e8a6ULL, 0x55e8b7466161b53eULL, 0x15509180a6674ccbULL, 0xf2c08936a6bd3d55ULL, 0x7bf4ccf273553f1cULL, 0x3e97a113cf4cb7a9ULL, 0xdab1933940d5365eULL, 0x8e9c66d77258e573ULL, 0x33bfe7051f1b316eULL, 0xc92896c56d1b25c1ULL, 0xd318d1fd1ea196c5ULL, 0x22135f808e988ddcULL, 0x4ce8c43443bc6a5dULL, 0x0829453a6b2ec047ULL, 0x5d3de99e72aa601aULL, 0x490ae86312588e93ULL, 0xcab84f992bac1cd9ULL, 0xb8d5a6f7f69d169fULL, 0x3887f2500452adbdULL, 0x88a0dcc875ea8c89ULL, 0x0960c4458628b5eaULL, 0x3e366ff13142f7d7ULL, 0xc16c4af1003e9985ULL, 0xf6eb31b4fd6c906bULL, 0x43eb42477efc7955ULL, 0xeff8d1c9007e1368ULL, 0xd692ff5b7ffab82cULL, 0x1d0b81a7637bd82dULL, 0x79ffd82b72c8e3e7ULL, 0x1bac7a7f0daa6fbbULL, 0x5c716e0e36c89825ULL,
+        0x686831eb38eae63aULL, 0xe6f4377fc5cd0a73ULL, 0x64acd7fd29c9ee44ULL, 0x84f2ed4fcc486912ULL, 0x0e3f9d98bd59cee2ULL, 0x3741615b382d2c0aULL, 0x7f1ccccee2948534ULL, 0x55262b357df1c732ULL, 0x412337b9c781e026ULL, 0x771110cf93abd268ULL, 0xdcd4968800544253ULL, 0x145774c221e3dca6ULL, 0x122e4f8c15c33134ULL, 0x12d15ca6750f3e24ULL, 0x0333303889953719ULL, 0x92791463dd16d224ULL, 0x72c58382b0ac62f0ULL, 0x684ea016c27451bbULL, 0x25b9a57862d8e408ULL, 0x149c0c40599bea23ULL, 0x7818435463973566ULL, 0xfb17ed5429ebe612ULL, 0x17ca532c25da0149ULL, 0xad9b363d60a3301bULL, 0x1f00526cdaa6c220ULL, 0x57c0b5db60c261dfULL, 0xcadad952997879ecULL, 0xeae78bf2e930a5c3ULL, 0xcd8bbca77ab12752ULL, 0xd531008a45dbdf55ULL, 0x59dce37f87900213ULL, 0x03edbded4f130fa7ULL,
+        0xcf95aa876e7fb760ULL, 0x72d72b3e381249cfULL, 0xa15657fae0f10972ULL, 0xd82d42648958a643ULL, 0x50fcd90d2e60c4bcULL, 0x7442dac5060c7d3dULL, 0x43bd1cdd63dc72dbULL, 0xf79b403b5388d6e5ULL, 0xa69a72aeaea3f6fcULL, 0xfb864e2896ac3828ULL, 0x9d3992fb4fb7d9d4ULL, 0xdb5eba2586a485afULL, 0xac411cf876cdc6e8ULL, 0x9eb0265880bc14c3ULL, 0x2d8b8f26a0edc86dULL, 0x78b2e37bc3f8cc5eULL, 0xbc536ffb7c5cac92ULL, 0x492484c3aa866162ULL, 0x612f0371b5210782ULL, 0xc55ce9042b617e44ULL, 0xa1341a02fe34bb5dULL, 0x360f2feab7678bf6ULL, 0x0fdff27fb4ee3046ULL, 0x48b50334a3b34151ULL, 0xde337445cc988c9bULL, 0x66345e287d742a43ULL, 0xd4cc6a450fff486fULL, 0x3db586692bf99fb2ULL, 0x37e770225a5827baULL, 0x8e21e1134b83f3b8ULL, 0x7a84df713df5cd72ULL, 0x78681f8eba972d84ULL,
+        0xd92095564bc452acULL, 0xf5b9c5da593358f7ULL, 0x93c2b100a959711cULL, 0xa93e565c9e3ee929ULL, 0x862dcaa8426189ecULL, 0xa63c5a8822ad14c3ULL, 0xfa931333194c23ddULL, 0x7f5f9ac965741fe5ULL, 0xab6340d8b95d98a1ULL, 0xfafd49719b2dacedULL, 0xbf362198a29a2303ULL, 0xf46681d4ddf7eeaaULL, 0x8065ebae27104753ULL, 0x90e7e8923b58714aULL, 0x9187d11454de1e35ULL, 0x2ccd84f48be35424ULL, 0x7bb68241cab0bde3ULL, 0x3752745672510520ULL, 0x354a2481d58cbc45ULL, 0x72383517998a61ffULL, 0x85b38554efddbd7dULL, 0xa96f0207fbba54c6ULL, 0x12aa9b4a902c17cfULL, 0xa7aa2b17ed9593ebULL, 0x30e45e2765ecaac4ULL, 0xed44f63a60f34ff9ULL, 0x94bcbe1d8313ad74ULL, 0x84a3ccb9afdb899aULL, 0x22e3756586168332ULL, 0x8a472765ec83ee76ULL, 0xac81c9c56fe3ec36ULL, 0xa1b462f9579a5bc3ULL,
+        0xaeb586cb4b14b4cfULL, 0xb5fc498c7070dfafULL, 0x86efa4a57c7ad981ULL, 0xadd0826bd241f8ceULL, 0xae264f4c386aadefULL, 0x8487bd6044497069ULL, 0xaf39c1b99f97bbffULL, 0x9967fc5be24212a8ULL, 0x6586ac1161ae0325ULL, 0xba0824513b294633ULL, 0xcc2fa558601d02b2ULL, 0x0ddb5eec9dff7f04ULL, 0x2b8ab92a5e199be1ULL, 0x271f3d2fcbf3c737ULL, 0xaf8bacbd6ee420e4ULL, 0xf54d612f797339ebULL, 0x959b18a4ac2c95daULL, 0x4ee17f9110239fd7ULL, 0x288a8f86e68359aeULL, 0x46800ec376ec5decULL, 0x28521f83508ce8ffULL, 0x1a49af6af74ad6fbULL, 0x4d3bd1c801afadb4ULL, 0xed79c6c8059afdadULL, 0x1db1b7edad206232ULL, 0x47dedf9a68efa64bULL, 0x2cb326a9e24c5f94ULL, 0xd9d60a10dfbd0a37ULL, 0xecdcc4455d3311e0ULL, 0x0998d18ec74502e4ULL, 0xd54eec38e6540784ULL, 0xee56c43dc72899b1ULL,
+        0xa73c6f5f9674096dULL, 0xacb98debbdd7f0d3ULL, 0x0a004a97aafeac00ULL, 0x1ba51f358127ab53ULL, 0x8d828ccd22fbc0eeULL, 0x2037e3cc2ca46f47ULL, 0x8dc83cac2b37450dULL, 0x2410066498fc49bfULL, 0x90926e6c922b19e2ULL, 0xc419cfdadf66dd4cULL, 0x3be38305c74fa258ULL, 0x9953c4b02f32c318ULL, 0x09635eb649dd40e5ULL, 0xa7e75e0231f0efbdULL, 0xa618ad0a20e40128ULL, 0x4567eb37d5ea1d5dULL, 0x3042f42dd530de82ULL, 0xa1a7722fd423f811ULL, 0x5349f8f3af10624fULL, 0xa1622af24e015528ULL, 0x6ef51cd8c14cca02ULL, 0x667ccab5e02ac76eULL, 0xd521a0b620935db8ULL, 0xee30d3d81e038c76ULL, 0x67e654475dd09898ULL, 0x498fb5faa6fa2cdfULL, 0x403cd1e1739252f9ULL, 0xbf87b44c24214d2bULL, 0x0b791bccf63b59f1ULL, 0xa715b20292dff2f7ULL, 0x3af7d33f56c93a5cULL, 0x25ba595d230e002eULL,
+        0x4df64a2779006547ULL, 0x2edeca7f34819fbdULL, 0xc2c6e59ff94ba0a7ULL, 0xa23a6293719f8417ULL, 0x0d7d0ee44d89c990ULL, 0xbbb0639ce64176c4ULL, 0x53e021550c944954ULL, 0x61fac1960ceb2de3ULL, 0x996bbab8818877f6ULL, 0xb1855e97ac5fc704ULL, 0xf5920c58da4775e7ULL, 0x9c1516aa9210268aULL, 0xa3769ccd9dbf8acdULL, 0x34ba60eefc05542eULL, 0x94a8102e760b04dbULL, 0xfd8bd1cea9837f11ULL, 0x26a36738a5eb827fULL, 0x029197c7026454dbULL, 0x4c93c07d1d67913fULL, 0x7f46ddfd3590337dULL, 0x8cd634710561cbb5ULL, 0x9f560da5367de22fULL, 0xe8b323297438502fULL, 0xe48c113edb73df32ULL, 0xc8e63d0bfaf567a2ULL, 0x18e4777a020dab42ULL, 0xa8fddf90a681290eULL, 0xa6ba38ed708cfaefULL, 0xdbe8f5d207a26b8cULL, 0xe63a2241f8ae4626ULL, 0xaa6b13a8d6cc4b5eULL, 0xedd6bd522eb5d9e8ULL,
+        0xcf52baf55c132641ULL, 0x4e36abfd1672d1ddULL, 0xe46e998288ed49dfULL, 0x758d9939f18909bdULL, 0x3c73df36beafe1a0ULL, 0x2cb54e1d2e3b4f42ULL, 0xc6242a617538475bULL, 0xb955e6b5e3622b0fULL, 0xdd07e156f1d9d1f7ULL, 0xdd345df6653b877cULL, 0xdce9f733ddaac81fULL, 0x1bfb5cd5bf051cd5ULL, 0xb48368557eb8d870ULL, 0x9f1099e294edded6ULL, 0xf1db28cf4aa7d93cULL, 0x350657b3000929bcULL, 0x60d75ec2501eda7fULL, 0xd571440b0ee6af44ULL, 0xf0030fca74d2d050ULL, 0x951f0f488bf00860ULL, 0x260bd4d098c961b7ULL, 0x170c70a5c1ea444cULL, 0xa7d9db6040711ae2ULL, 0xd9c357d433508720ULL, 0x60297af0f8265588ULL, 0xfea362ade316858fULL, 0xe57468894789ed37ULL, 0x0df4acb9c3cdb15eULL, 0x81c4f9ac1a4688e5ULL, 0xc60bb1f97de4c8abULL, 0x6085f005d6c8dca2ULL, 0x925633e614c48824ULL,
+        0x10a53d39c656b457ULL, 0x361de81a74df7169ULL, 0x9bca38b590ec8e29ULL, 0xc7ad08812102fdcaULL, 0x43ff1d821e00b0ecULL, 0x636b2d5ebccbe152ULL, 0x5a26c6375dbfcc89ULL, 0x1d89b8897de84e2dULL, 0x116aa43888714fd0ULL, 0xa2a967af9935ef42ULL, 0x699b8aea4639a575ULL, 0x2ecc05acbc1addb0ULL, 0xa5cf48c093a7ae48ULL, 0xeec58936970408f5ULL, 0x69716876ec0176a9ULL, 0xef2f256e2f853fdaULL, 0x0955ad7977a12ecdULL, 0x270d2dee0710073fULL, 0x78014072ba408a34ULL, 0xea0d92fdf3480094ULL, 0x0f52edf78cc49a68ULL, 0xfa74132992c2eec3ULL, 0x94cf9114f1d92101ULL, 0x4c27863a8ac7107bULL, 0x18d373eb93e6e008ULL, 0xb04de0ec66022e47ULL, 0x523bafe70864cb97ULL, 0x80b6a42c3a0fefe9ULL, 0x4536822f46f2bd21ULL, 0xa90fa3653643c9e6ULL, 0x630157c6641e85b7ULL, 0x267329616ea39830ULL,
+        0xe8dcefa423bdac30ULL, 0xf5e02637f9bda327ULL, 0x9ee1ecea9214b920ULL, 0x468e60a920a3146dULL, 0xf9030d154ac1f640ULL, 0x1e60c8a8f0f3ecffULL, 0xe5fbc4db1b53b194ULL, 0xd2e87986c5743072ULL, 0xf0501e3b771e57b6ULL, 0x3eefe893449b1073ULL, 0xe8f27a7aa366c404ULL, 0xd553697d771336b5ULL, 0xaec743fd87ed538aULL, 0x7d394d93fb29f880ULL, 0x4fa76fe17a9e0a2eULL, 0x2d777102e7144b47ULL, 0xd1b7cde38386a0e7ULL, 0x803d70cbc1e43d6bULL, 0x3ee26d0cfeb2c1d8ULL, 0xafe84e6062f3c367ULL, 0x2d9ab82c9121f39dULL, 0x10e1598e91f25d79ULL, 0x7f12a8ff78f165faULL, 0xbcfc26cc01708a8bULL, 0x7dc0071634700e16ULL, 0x428b7ce7418c3e2dULL, 0x65c8d2ad982c80c7ULL, 0x1f1aaa5a54b6f9a7ULL, 0xeafee8f856c0e634ULL, 0x05a0aa02bfa52965ULL, 0xdcffd576770d7a53ULL, 0xc8b9677623cd44bfULL,
+        0x5c263d23d77b02abULL, 0x5ecb888cb415b647ULL, 0x00a6c614dce107a6ULL, 0x0345589946f67167ULL, 0xc7666ab26b18c62fULL, 0x52acf3784929023aULL, 0x4ea1239f2d1c715dULL, 0x3781d9c7207426ddULL, 0x1881d08e3638666fULL, 0xa379fe8e396d1402ULL, 0x23cdf98d9f343b3eULL, 0xbacea28430c8a8f4ULL, 0x564a5b743bf64eadULL, 0xe3124b7aed078af2ULL, 0xb38377caed355541ULL, 0x3954f18a09849fb1ULL, 0x0200b4f3910db3d5ULL, 0xc3b50cfcff2da570ULL, 0x3ce0863ede0e4a2aULL, 0x516a7cb77e61a4ebULL, 0xacf39e189a18acecULL, 0x613cae72525b41afULL, 0x5986d2e943afd19dULL, 0xd3545615c23e85e2ULL, 0xa574e6b0d2cde380ULL, 0xc0698ab8a2922675ULL, 0x562a90f634dbcf0eULL, 0x701ae5380396a0d3ULL, 0x65c29c1b7ff4df74ULL, 0x8317a6acc93a88f3ULL, 0x7002006f16729c3bULL, 0x0db4973aff564044ULL,
+        0xbf296f4bfde8fcb2ULL, 0xc8d75258df9a87d8ULL, 0x82624741931f0e6fULL, 0xe9233219d81d3e0dULL, 0x6be626407ce35950ULL, 0x015ac2471b0247b4ULL, 0x79f559c8ab9ec4edULL, 0x8cd0d18e781ef919ULL, 0x683296f6706eeb4eULL, 0x9a260b692bb1823bULL, 0xcc736fb99052da77ULL, 0xc5cda2f13a912a09ULL, 0x97f0c1dd38522e68ULL, 0xe0915b1a195a06a9ULL, 0x0ca83ca9979c942aULL, 0xecd434cdb3f238deULL, 0xe6b90ba9e074aeb2ULL, 0xfdc53c98633bb519ULL, 0x9d3443090c08a29fULL, 0x835783f7841972f6ULL, 0x487b9ed8ce8b1f5bULL, 0xe5b7bed7864da66aULL, 0xc595424f9820c683ULL, 0xbcf311764393bf9bULL, 0x321dee36a2b4c086ULL, 0x8dcc64e96f1d1d1dULL, 0xb2321174a997134cULL, 0x2e955a378452613cULL, 0x9930fbf2bbb97565ULL, 0xd2576b4af7369271ULL, 0x54926212e8b51fe2ULL, 0x9d37aede31e1bbedULL,
+        0x1673ffc2795fa9c1ULL, 0x97b96272ee2e61a7ULL, 0x3a26e8139b20f153ULL, 0xe08ff9888b95bfeaULL, 0x2ef2b88da0a8853eULL, 0x9e8a89cfcf027db5ULL, 0xa88f256ee1a8520dULL, 0xb634b039f0272d07ULL, 0x0c6cff9436908dc6ULL, 0xb834c3b240df530fULL, 0x5b38fa1e3b9a3d09ULL, 0x8c02aefa857f7db7ULL, 0x72bcd33951534f02ULL, 0x81b41481f046150eULL, 0x95f0f287589cd9feULL, 0x8c97b1207ee53329ULL, 0x6661089ff496f903ULL, 0x8ee63b83f176a713ULL, 0xb6655f5dff33b37eULL, 0x7c470fe64245dec7ULL, 0x8d9e979ebb8286d2ULL, 0xa5f061263f5bd267ULL, 0x3daf418f680a020fULL, 0xd5f7fd6950d76a11ULL, 0xae0237d476db9fd5ULL, 0x466432c6859a336dULL, 0xca99979b9c0b902eULL, 0xcf97fe7f08f58835ULL, 0x3aabff572e2ae285ULL, 0xb8f2ac804b3c45a9ULL, 0x459b1cbfdf4fa0d8ULL, 0x1fcd9dbf8bb762e1ULL,
+        0xa8990c0e462ac334ULL, 0xd5fd91d3315ba98bULL, 0xddee50592862718bULL, 0x5d36dc3d63a46914ULL, 0x06cd5ed57b4e264aULL, 0x7216d87233210efbULL, 0x3d4db78cc4fcd6d8ULL, 0x960e016dd7aecc99ULL, 0x1c4d9825b3a9e4daULL, 0xfe91a439d47bb633ULL, 0xdaf6830c7efe006fULL, 0x42cb6d8af9fccb3fULL, 0x4e436bd7a4603387ULL, 0x496befbe9f1424f1ULL, 0xf334b42bf371f915ULL, 0x5fa1f83be9c1b6ffULL, 0xf856c58249541134ULL, 0x9cb5f88fc83a0314ULL, 0xe70555aacefe6a4bULL, 0xac712a7e494207bcULL, 0x896b0e78e99745c5ULL, 0x6cff9ba00fb0d4b1ULL, 0x33de61aae7021903ULL, 0xf8673e20fdab55daULL, 0x32b8c7068b5fc265ULL, 0xe49e10eace8a67feULL, 0x1fb617838dd2be4dULL, 0xdf3237be6fcf7087ULL, 0x7807984b65e7826aULL, 0xc575d3b678094abbULL, 0xc91c99b526f82d5fULL, 0xa259f9870c9cfa22ULL,
+        0x3589399137bbc6ccULL, 0x0f36acfbfc60de18ULL, 0xcd5c7450060d7c19ULL, 0x58b4128d41be6dcbULL, 0x3803338d78ad41e8ULL, 0x6d53ee1d004f822cULL, 0x47953724c8ebc512ULL, 0xe7d493702fa217e1ULL, 0x8427a170c6b7d43dULL, 0x17ed7b4d611ceee1ULL, 0x9aa6ad790d84da4cULL, 0x9532efe50ae86aadULL, 0x17f671e4af496ef4ULL, 0x6275a665ef263163ULL, 0xd844c17a4074f9dcULL, 0xd9440308fa374845ULL, 0x4e3774d4389ed4feULL, 0x2f6d164664097949ULL, 0x65892253f4d5d00bULL, 0x26f6af6e57476f96ULL, 0xfab90cb6661b7f1aULL, 0x981febef1cc7f190ULL, 0x8c06e7e41505fd3dULL, 0xf437d5445198fc14ULL, 0xebe528398048efd8ULL, 0xbda82fc0fa28f244ULL, 0xfbad1679d00003feULL, 0x4fea05a09876fde7ULL, 0xf2d65d082113d6bdULL, 0xb64668d9e9dd234cULL, 0x7d90e3d55bcee5b4ULL, 0xf68980b06ccfc259ULL,
+        0xae5d75ac0303552eULL, 0x22d125e33727382dULL, 0x5f795e83b1ff3990ULL, 0x148293d238940fbdULL, 0xc850736fba2708e9ULL, 0x0e781b02ee3d0c1fULL, 0x1005889f2b60d9d7ULL, 0xce3502900fa82e07ULL, 0x9b840e40c2bf4615ULL, 0x42a27cb165a6e7eeULL, 0xc5d4233ed6410fbfULL, 0xee9dc8a8fce6893dULL, 0x64b4a413b16e687fULL, 0xe5e8acd25f998fd1ULL, 0xe83998b423ab58b8ULL, 0xe462f7b1a329b44cULL, 0xc0312203472f8271ULL, 0xf2c1d9e12be467ffULL, 0x5c96e1628e2f6289ULL, 0x7ec982fca7aab2a2ULL, 0xa8e9127dd391e2cdULL, 0x713403a276b6cf6dULL, 0xce5d7b77deea784cULL, 0x84d44a43957cdf73ULL, 0x827a6298b64ba83eULL, 0x686f789413e8232cULL, 0x83ade1502013c289ULL, 0xed49dd50d72d0f5aULL, 0xa6645b8d3ab4181bULL, 0x54ca7e6b45814f8cULL, 0x612fe1f12d10ea13ULL, 0x923bc25e5a3f2bbaULL,
+        0x6fdac2bd794f8a17ULL, 0x04fc5c035b8c593cULL, 0xd540072f76151ae0ULL, 0xb32d2f8c0a9664a4ULL, 0xd73625299afd5510ULL, 0x8dc2cb529cbaab46ULL, 0x072230de9f468800ULL, 0x464c49e0c08166f8ULL, 0x508914f45b30da27ULL, 0xb460fd19cfe2e8a6ULL, 0xb87ba01b79e186a5ULL, 0x1ea5a9e5ff0d1ce2ULL, 0x45ce57efd8d56346ULL, 0x2cacd1addea1036fULL, 0xe11311ad1e166bb9ULL, 0xd4615a80c1ea04bfULL, 0x8e0cb5b1ef90d428ULL, 0x323a955004a22c1fULL, 0x929640842417c2ffULL, 0x8e20374c65b1b8ebULL, 0xd1f29377e0291cc3ULL, 0x5b730353a0329ac4ULL, 0x9dcc83091b28f6efULL, 0x1f76d3dead792bf0ULL, 0x7f4a34149a839128ULL, 0x5420a89db158c81eULL, 0x42bc94370baeed85ULL, 0x701127bf57c161adULL, 0xb682b13e7acd7792ULL, 0x6685c420df7098c1ULL, 0x88e40b602f212d59ULL, 0x64e377ea7bd4d8beULL,
+        0x6a3d0e3d6312a45eULL, 0xe32bf3105d4483caULL, 0xacc98d6fbf4ccbefULL, 0x159b8b94a482671dULL, 0x9776a72e0bd70f50ULL, 0xfa9392dfcfa41117ULL, 0xa197c601448b5d85ULL, 0xb38e7d50b61604fcULL, 0xdd68352d5ff365b5ULL, 0x1a5d8f9db18c9853ULL, 0x8a6b9be49ee8bc1dULL, 0x6bedd1cff74aaf01ULL, 0x0735ef8b4d2fb0cdULL, 0xf164505c97406471ULL, 0x86cb3e683e1d383aULL, 0x1c2404ec04a49378ULL, 0x2d467c3f6a69478eULL, 0x4b147606880780c7ULL, 0xd53d5c71f0697a32ULL, 0xc53562839cee2af7ULL, 0x1eb58c88e0640758ULL, 0x31653d124dc39872ULL, 0x9c196b8f9e1d144fULL, 0x39614c696d36f098ULL, 0xb0363f68c14739a2ULL, 0x5adc24f1e9a8116aULL, 0x0b008211b7626daeULL, 0xc913c22913aca2ebULL, 0x56a66a9471868f20ULL, 0x176f51de99947fafULL, 0x760873323c9b0298ULL, 0xfe987f71c66640eaULL,
+        0x8950f7bdfa3310a3ULL, 0x92e89355930d7b80ULL, 0x185e7a0ce000451aULL, 0x167fffb05b414e28ULL, 0x7648dfa02e9eebf9ULL, 0xef9bb30d6e86218fULL, 0x06523e3611a23aecULL, 0x6a9137c33de7fa04ULL, 0x59a721671d61433cULL, 0x189e16befbe37b5eULL, 0x0c60aacac13ea884ULL, 0xdca82f6e35cba5beULL, 0xafe1bde27e90949cULL, 0xdf16eb3e8fcd1c58ULL, 0xa7b186e6660c60baULL, 0xaac083012c0462a3ULL, 0xdb35bf7d08977a4eULL, 0x2ba101642600bc9aULL, 0x07a8e60a50f5a93aULL, 0x3ba0153c48a1db2fULL, 0xeaaeaf85b880df5aULL, 0xd600b1acd4dffbeaULL, 0x00ae238be1c821f6ULL, 0xd4021160c97919f9ULL, 0x43953fb8d963c720ULL, 0x99bbf6e5fc868409ULL, 0x53ef30a0eb04dbc4ULL, 0x93fb4c53dc50f203ULL, 0xb84d943dc663bd90ULL, 0x912409f4b882093bULL, 0x21672be89465b3ddULL, 0x6aee13eebcbb5392ULL,
+        0x9a70112215eb7095ULL, 0xc71ca551729888ccULL, 0x6364bed2d39fe8f6ULL, 0xa9fe7bc8574a671fULL, 0x86b8bfa3e080e60eULL, 0xa68d717423c343f2ULL, 0xc21c7dbfcf761bc3ULL, 0x9fa4c0c566e43ed5ULL, 0x91636ed27be5626eULL, 0x515f32a4d16f5149ULL, 0x5d66c445e5ec6a3fULL, 0x3537be6536c4b7f6ULL, 0xead2f09655802c7aULL, 0x358867f6466fa989ULL, 0x0957b2514e34d6e2ULL, 0xfb90c287b1f6c9d5ULL, 0x38266f0229d664c9ULL, 0xe11b51db2e89f5daULL, 0x810f2d8d238f9461ULL, 0x20f3abd8850300b7ULL, 0xa922026742d2d0b7ULL, 0x682e957a2f1a10fcULL, 0x9693789d8cf9f39cULL, 0xca4289b7fec2029fULL, 0x0afdd9129929945eULL, 0x21dd4636a96a6054ULL, 0x6b6b777c7c659458ULL, 0x401b5f6c8576b727ULL, 0x5677079acb25ddf5ULL, 0xf3998f8c7a259dd4ULL, 0x1da7d824a25132ccULL, 0x953640b6d3037297ULL,
+        0x8faaa6f48c0b9df3ULL, 0x275c073a9a6c6210ULL, 0x490899ba1afc9d5aULL, 0x11a4d263b4eeea23ULL, 0xcdda687d72e83c10ULL, 0xa66620b9b3949870ULL, 0x891501433c380088ULL, 0xe3c8e4068ca80978ULL, 0xec2a55f6da91856cULL, 0xaf0ac01cb076b4f9ULL, 0xd6a7486fee829c8cULL, 0x44693fc4ec4cb7c0ULL, 0x5185bf2dd00405f8ULL, 0x271c870f60d31438ULL, 0xc8246966d86c5a5cULL, 0x43b55de194112cffULL, 0xa1a5fe4a7d077afdULL, 0xf67ad1e24fb55024ULL, 0x629ba79c6fc59a29ULL, 0x70952b6f428d4dd3ULL, 0xdb3d4961d1854864ULL, 0xca8fc440de32ebebULL, 0x1418da365c4b2b35ULL, 0x38250c778f6da7d4ULL, 0xfeb984e02556fccfULL, 0x2eb8e31921db0eacULL, 0x9279e07c51539134ULL, 0x05d8144d6a1331d6ULL, 0x3d82e570c247482aULL, 0xe440f61df7599e02ULL, 0x4bd0955382944fd4ULL, 0xa5ec66a0cd73047dULL,
+        0x1d518599780b02e6ULL, 0x315f4c093595ffcbULL, 0xb21a7fe986885363ULL, 0xb60159ff7f06eb45ULL, 0x55412a9d7c0ddab0ULL, 0xfc05dc0389ede0e7ULL, 0xbf8b54bcf507b464ULL, 0x1fa64050d26da0bfULL, 0x18f01932e6fda68cULL, 0x3b51d979b9150420ULL, 0x81a97d6ef80295adULL, 0x4dc3cb8370587f73ULL, 0xb58acd91fe23b3eaULL, 0xf8f56688005387b9ULL, 0x050aeb21ec9fd157ULL, 0xfd47066bad5dd16eULL, 0xc8be95084b78d85aULL, 0xc18f63793d07e533ULL, 0x78f89095ce146161ULL, 0x70657a5616dc0ad1ULL, 0x735e479da91a79e5ULL, 0xce74e17850621a3fULL, 0x2b9c1c3fa9ee7ba4ULL, 0x0164dfd8c9ac62a2ULL, 0xcbffb4e36cfb1f00ULL, 0xd5250308a496ccb4ULL, 0x320d8451fcf67e25ULL, 0xf683e25cd23e036dULL, 0xed50458f8d95ee62ULL, 0xb12e6c60d66d6319ULL, 0x158834cb50e4b2e8ULL, 0xd8157bf7507634a6ULL,
+        0xfab20fbb63855271ULL, 0xf416347a6d55262bULL, 0x3c7b30181ff6ebabULL, 0x521d9de4c4e4346cULL, 0xc3345e93e94299e1ULL, 0x22b8be967a20652fULL, 0xf9de841ddf6b4a81ULL, 0xba08980d329e9ea7ULL, 0xa5e049675bf0a0a7ULL, 0xb70d51e1929f1d8bULL, 0x1248054ba4cd8119ULL, 0x52af672a9e048e76ULL, 0x7e93eb4d8b03c15bULL, 0x949f857a70fc6a07ULL, 0x3428ed1cf0a0e2a1ULL, 0x7f88f109853897e3ULL, 0x44d3b4a0e9621f57ULL, 0x4651aee895e40fc7ULL, 0x2fc7a9178f93acb5ULL, 0x32b06dd724604845ULL, 0x36bd03ff01b3748dULL, 0x20505e80c94db55eULL, 0x1e87b72152156b36ULL, 0x3574491b45bdc946ULL, 0xccb4c36661d4af04ULL, 0xf063f303370e4e71ULL, 0x252db7e6ed0b67e9ULL, 0x5c6270f4e6aa0150ULL, 0xbbe5c3457579541bULL, 0x6efaa894dbc02554ULL, 0x6c6a7ffc2642885dULL, 0xc68e6e5944533beaULL,
+        0x3e6c8faa205eb5bcULL, 0xef5d85d908240755ULL, 0xf537b6688c3f3edeULL, 0x25c3c7b2862cb88aULL, 0x0ed4cb8a14ddb084ULL, 0x54e95014d60695e9ULL, 0x7f78346185bf01b2ULL, 0xae01698c72a6b6cdULL, 0xdaff625fec729754ULL, 0xa193c2cd013db84fULL, 0xaa71a4b7c1ea624fULL, 0x976715dec899c17eULL, 0xeab6878be1b228c3ULL, 0x66c8e51f340794b9ULL, 0x66ae2f6b15d07761ULL, 0x0c1a8b50a0284ad1ULL, 0x5baff73ecb14f59fULL, 0x10c5a78bef4ca087ULL, 0x73ef94955fa6f295ULL, 0xc064c6246307ba82ULL, 0x3803588e71ed882aULL, 0xd34a5cf712e05a3eULL, 0xebe4434d8e8e9ff9ULL, 0x76fed36d748423b6ULL, 0xb8f83230484a50d8ULL, 0x4e521d46ec26da71ULL, 0xe312d6f61051c399ULL, 0x92a7a9999df2f2d8ULL, 0x7d051cd567554141ULL, 0xf4cb5e4b3fb11d8eULL, 0x3828daa348603f44ULL, 0xe2392bd3af547bb8ULL,
+        0x1a45e2beef3f46e3ULL, 0x5b536c35f38f9e0cULL, 0x76d25a86c8267c38ULL, 0x5c4682dbe1c23f7bULL, 0x7c4a72322a0e966aULL, 0xfa29843193592a47ULL, 0x9dac8d9a28e5e191ULL, 0x8873bc096b0bed93ULL, 0x8ad49a1dc89a3bb6ULL, 0x43216aab4f66604eULL, 0xa8ad82afa29d8704ULL, 0xa6d22ba7726d7f98ULL, 0xd86c42fb1c200e75ULL, 0xde2bb6573d74f290ULL, 0x55a77ae6aaa7b6a2ULL, 0xa5db7d7f0821008dULL, 0x07b8232ffc7f1f3fULL, 0x8304833edcdb0571ULL, 0x8081684dc08e66bbULL, 0x3812b3320f6b8173ULL, 0xd207c4ad8cb87e20ULL, 0xa67d603aa25e9b27ULL, 0x849570c3867d0a4cULL, 0x52d8501fa13d1bebULL, 0x1cc2df2b4003345dULL, 0xbc04c871446ec881ULL, 0x816250fe8807a92aULL, 0xa32d453d58a4e66fULL, 0x215edc97e67ac8a2ULL, 0x4fa316369a488f1eULL, 0xdf75f94500888373ULL, 0x5c0e1945c90e43fbULL,
+        0x3677c30fe9363ebdULL, 0x41f5c5c4ff215702ULL, 0x5d47615e80f2c9afULL, 0xa259b98cc80f4a62ULL, 0x09277020c1a3b072ULL, 0x5e556200a89b3ab3ULL, 0xf0084970d7c14b2eULL, 0xa60826e5a46cbf04ULL, 0xfc5a605b05ec57e1ULL, 0x53785b3569003ee1ULL, 0x4d5ede77611bdad7ULL, 0x5e5d5a2b6eddf069ULL, 0x4d22138fc11f9e2cULL, 0xa078af35ad9ece78ULL, 0x6ed0e5b54def16e5ULL, 0xd59b880fba70a2ceULL, 0xeebc10f6746e420bULL, 0xb77bcb490aecfd85ULL, 0x97c4e9f71d2f966cULL, 0xbace9181eb472a99ULL, 0x29acf08e327d2d03ULL, 0x48b2697b437198dcULL, 0x3e640f575d6d14caULL, 0x730bfcca1f91adb2ULL, 0xecfb65e798ac8226ULL, 0x96273f58a518ff5bULL, 0xe0cbcd1bd2e65f63ULL, 0xb9c2f7289170d163ULL, 0x83060ca04ecc273fULL, 0xf0a0a8e919a1bc38ULL, 0xe467bca0f0aafc85ULL, 0xf39edee5031b0858ULL,
+        0x4dea675b49793e28ULL, 0x4f15464ad7483c45ULL, 0x88e8a5983ce05c65ULL, 0x6418f7b6d72e80d3ULL, 0x700df3a50e8e4319ULL, 0xa51baf241b70e62dULL, 0x8193a6645882e46eULL, 0x17e834173362dc6dULL, 0x82a3466fa109d826ULL, 0xc8b3361d5e28721cULL, 0x6c58021422fd1667ULL, 0x2a2940c35b1d8168ULL, 0xb711596c739d9031ULL, 0xcbadfa7c0303116cULL, 0xbddc6a1b76e34f0fULL, 0xca6533fd2ebe4847ULL, 0xcedf4591661ad6d5ULL, 0xa034de4d90a4ec6eULL, 0x2d4f3c715665d4efULL, 0xd52b65f8b81ff92eULL, 0xaccac1af3b5d429aULL, 0x22a8e0f6e319d1a0ULL, 0x244bec6c3291ac16ULL, 0xf16884811a36e911ULL, 0x09de6ee96ac3186eULL, 0x15d463217a778837ULL, 0xc348837b45576998ULL, 0xff5542b6431670a1ULL, 0x2545596719f3a4b1ULL, 0x06f74c7ab7872638ULL, 0x121a1d8631259d4eULL, 0x55d3c4a7a031df15ULL,
+        0x826ad4aceb8160acULL, 0x9fa0d8a102155805ULL, 0x16fe9afc8c3e8396ULL, 0xeb7ca3cf6d369da3ULL, 0x0ad86ccc593ba003ULL, 0x2b5369624c0c81fdULL, 0x2e524509615366ccULL, 0xd5c89362604d7636ULL, 0xebfa8e2bc35d9947ULL, 0x81e482717e5b54cbULL, 0x3f2e3bc156f99cb1ULL, 0x1769fb5a4231a303ULL, 0xbab5e99af6cea453ULL, 0x3d24baf1e972bc03ULL, 0x201b97a673b7f93cULL, 0xa6269f3760aa6482ULL, 0x5dcc69453fe077c3ULL, 0xcdf230f1a8aaaf0eULL, 0x78994d90cfd8e0f1ULL, 0x2ae8c51bba99e33aULL, 0x99dc661f4aa8d33cULL, 0xae3a8fd29845a27bULL, 0xf5b5eca50a07bdcbULL, 0xa9c2b8502cf29998ULL, 0x50d1964a81411517ULL, 0x44bab691ab1a7585ULL, 0x784e7bf183e402b2ULL, 0xaf47a0ff2bc4587fULL, 0xdf515ee330fe8ff8ULL, 0x995596294121937dULL, 0x8c9be13a32517284ULL, 0x5c5ca712a3dc52fdULL,
+        0x5cf2f5b91af80a49ULL, 0xef4b0b2c2f7b9c01ULL, 0x71be143f2a0acb5eULL, 0x5183c63bbcdef9caULL, 0x5febaf1bc3b7f212ULL, 0x9c273561d20157edULL, 0x7e9897f1d3e963f0ULL, 0x380bc4dcd75cfe8dULL, 0x282dde6bf1b0b2d2ULL, 0x31628ebd40798bf9ULL, 0x1320c497f1333e93ULL, 0xe1e7ae5e45a7716dULL, 0xc7868a7d1b2e5729ULL, 0xd522ff09d008db6aULL, 0xdcaa2889e22f0c91ULL, 0x3d7590a19d197c70ULL, 0xc8c37ca2a2aaf4a6ULL, 0x912ca9d1c7baa7cfULL, 0x7baa3d4c0297b3fdULL, 0x65a51a71e9167d10ULL, 0xefda45b4ce4ed980ULL, 0xf188522516af16f3ULL, 0x8314c8d2768d7ad1ULL, 0x0d066ef952a4d412ULL, 0x53a256e7a19d60eeULL, 0x39756f9824bd2793ULL, 0x9ef50105fa2a30e4ULL, 0x8711f7c6c214fd4dULL, 0x9398c099b9736540ULL, 0xb5f6beec30b2d1f4ULL, 0xc6ce4daf254eb9b7ULL, 0xeed4a3129f05da2cULL,
+        0x580f0bf8e29e8ccfULL, 0xd545afe093905438ULL, 0x7f0083ece9073e2dULL, 0x17abe24d0377a991ULL, 0xd247d9d2b939138cULL, 0x0c869ce4799485b9ULL, 0xb184041c34056db9ULL, 0x20008825127cfda1ULL, 0xaad862dbf7f2e12fULL, 0x9a3863bc7793cae1ULL, 0x4df827871ec0b1eeULL, 0x55db01d6fdbf92bfULL, 0x8cd4313e51b2130bULL, 0x4a1917cff7c58b48ULL, 0xdbad69df3f1e74d5ULL, 0x9d5f70f06535730cULL, 0x14e366a192691ef3ULL, 0x54cb551315ec55fcULL, 0x417882ea4eb6806aULL, 0x2b2fed10e9021445ULL, 0x5c2814fa3a8b3a5cULL, 0xc56a8989ad39bfb0ULL, 0x76b7f021acf91904ULL, 0x30b7269b60931c38ULL, 0x00c6a5d01f00f5daULL, 0x600db07c4a90606bULL, 0x1dfe2a1a33ff2b90ULL, 0xfb280547061bd97fULL, 0xe65adfe78fa348b0ULL, 0x4d0f0652333bd5a2ULL, 0x8f6c626f416d2ba8ULL, 0x4d02fe8216bc6083ULL,
+        0x8c9371821a45ff32ULL, 0x009bcca532eab4bdULL, 0x50a4f62f25abc9b5ULL, 0xeea900bccf123bb5ULL, 0xb467915924e5185cULL, 0x69fe8a858265a3f2ULL, 0x6ce2b9634e6580d5ULL, 0x74a0f14499a11192ULL, 0xd5d6391070e1f21fULL, 0x36966d8fb37eb9f4ULL, 0x554cfef2d37fe4f2ULL, 0x6d728206d8468612ULL, 0xd2fd3591e661dad9ULL, 0xd79f4daf5bd9fde3ULL, 0x147c6330467b6874ULL, 0x85f33b6083e4a7feULL, 0xd15be08be4b358ebULL, 0x59641ff3c6853f10ULL, 0x41dd8baa811b2cc1ULL, 0x9fd2651696d1afa6ULL, 0x4adaca16a41ed457ULL, 0xf8f00bda297c5d34ULL, 0xd360960d8155f2dfULL, 0x5ba5195da17f6448ULL, 0xcee01ab1be9ba962ULL, 0xd731c4ad6fb0c2b9ULL, 0x1b6a01df89e61865ULL, 0xd08cfe79d67bb234ULL, 0x6b0c95cfd15d9311ULL, 0xf700c26144bb6dcaULL, 0x02eb4d3738978ff2ULL, 0xf6bdafef55858d0dULL,
+        0x052d813a8e34008aULL, 0x69500a28084a1beeULL, 0xde4abb5b2f1ca9c3ULL, 0x847f113e1cfac8dfULL, 0x32607708571ddb1eULL, 0x7e97012a504b97d7ULL, 0x82efb5a9fdce159fULL, 0xfc4e9d3044a1586cULL, 0xe0197dec86d99558ULL, 0x51cbe67fd44bc9bbULL, 0xba3a4ae45c7af459ULL, 0xdcdbeb3dc38cfe60ULL, 0xb676bc8554df6770ULL, 0x2a07cb222fe9530dULL, 0xc244c4c6cc3f55a5ULL, 0x92fe8fb03dd7b9eeULL, 0xd4edafaf9ce019d4ULL, 0xdedc621e989b0805ULL, 0x424c04f1f915b082ULL, 0xc1381d2c5b39da6eULL, 0xb0b5eceef4669328ULL, 0xb814d858aefdfeafULL, 0xbf71c754fc9c3c84ULL, 0x10b33e34e206e9f6ULL, 0x83953f0c6cb67deaULL, 0x9c2cafea0713c3b5ULL, 0xa2baacfb0fbf61f2ULL, 0x831f5eac15aacddaULL, 0x84f0c161005deddaULL, 0x20a4f3efc462927cULL, 0xffb6bc6fb93c0323ULL, 0xe8bb4dbddba00779ULL,
+        0x156f7dab02e12bfcULL, 0x78cf88266d023da8ULL, 0x47997733f553e323ULL, 0xf7d928d1be31324dULL, 0x7b790cc2f293d80bULL, 0x35ce47e0a6ad2de5ULL, 0xbadc3d9fdf69327bULL, 0xe5d98fb1769faf8bULL, 0x4f57626012d99b1eULL, 0xeb3c18f1f35af476ULL, 0xa5773970eeb1cff0ULL, 0x7b5111b6fb8fa28cULL, 0x2bfe1198861ed4edULL, 0x32d2a183ba0c8a31ULL, 0x2f0e1aafdb332a56ULL, 0xf9e49b605e1bdacfULL, 0xf2a9f63bc82b9ee7ULL, 0xd7e580a381c585a4ULL, 0x026ac0b408d8f0f3ULL, 0x55c71c38f965b3b9ULL, 0x3f42caaac2210780ULL, 0x4a72a4a26c15331aULL, 0x1f115f4bb561f866ULL, 0x41dd80d81aff5432ULL, 0xa48ee0ff6c9f67bfULL, 0xc7da20c837136f8dULL, 0x9951d3557178c111ULL, 0xc236c1246992501cULL, 0xd78ceec3438ba194ULL, 0xa92c1d88fd1cf8adULL, 0xe41e35b02f98eb91ULL, 0x02aa09cceac9de22ULL,
+        0x9802091713a3fa1dULL, 0x3f738ec3e2705229ULL, 0x3d935c5e23ee5565ULL, 0x21e15a738aa44fdeULL, 0x8a99dd465d8db972ULL, 0x2f588eadb35c71e7ULL, 0x727e1062742d196cULL, 0x58a0c4dd653a748aULL, 0xa10facc89d9a2b13ULL, 0x1a859fb9faed5d78ULL, 0xe22d5ea67b867f6eULL, 0x8c786ac36a49d112ULL, 0xf85333f44b3c94cdULL, 0x175ebba3bcc420a1ULL, 0x18da2421612e6d7aULL, 0x803a98b877b17450ULL, 0xcda23ff64f9c5284ULL, 0x9a85c2f091f0ca4cULL, 0x7d3019b0d7adda57ULL, 0x7086ee837490ecb9ULL, 0x160373c203a8e82cULL, 0x41cf72ac3f32dfbbULL, 0xc2b5eb51ed746881ULL, 0x365ee62f77ad6f3eULL, 0xb3676b3faee2540cULL, 0xd9bd7a91565e30e3ULL, 0x4947d74c8789272bULL, 0x69fed32748f0ce61ULL, 0x3e785169163d7c62ULL, 0x11e558ae75ee9efcULL, 0x2552ab4a7ebe7fc5ULL, 0xe3f6ae75880265fbULL,
+        0xf057474a7526ae3eULL, 0x77cda81cc2b2897eULL, 0xc8e23104666e1c54ULL, 0x25c58545fcd8f5b3ULL, 0x9951c9340f5df6e8ULL, 0xab9a7a082d9f92a2ULL, 0x4b2051e0c39ac6ccULL, 0xd3c7b841a95286d0ULL, 0x84cb6ab056b7bcc9ULL, 0xae659367cfb7e09fULL, 0xb0c40d915b2054afULL, 0xf2275ab5c031ed7eULL, 0xe92b255e61ec5e0fULL, 0xbb875b73341be0a3ULL, 0xbcab1007106bff2cULL, 0xa5e1a1ef1cfde452ULL, 0x07d4aa2c6265feccULL, 0xb1fd5e30645f4cf8ULL, 0xdadf0f4f86e5c395ULL, 0x194851c043048e13ULL, 0x390badc7d0576cf8ULL, 0x14ceb365192f5137ULL, 0x9725a53f2e8594c1ULL, 0x24cdd28474292267ULL, 0xf764f6309205f938ULL, 0xbdfae1e1e9554442ULL, 0x571b3a6803d8e17eULL, 0xc90325216f24688cULL, 0x794c559fca25f355ULL, 0x692363208dbf839fULL, 0xdc24832a09b0eebbULL, 0x63da0a2979cc8bf4ULL,
+        0x4c9d90d2627df30eULL, 0xc4db8e54acd08cdfULL, 0x082e2c1b56b3d7caULL, 0x37b226b3168f36ecULL, 0x0acdd1a097bc02d0ULL, 0x0c86065f7789182eULL, 0x274c8dd99e8fc154ULL, 0xdfce6c33d8cb3b36ULL, 0x87fc2175fa2d12c8ULL, 0x595aee46797b9474ULL, 0xb3e4fcde2cbf725eULL, 0x9aa8bbb945721a50ULL, 0x1170c213de1c8992ULL, 0x4a48ec90c689c110ULL, 0x6a6bd7b84f6284d6ULL, 0x626a9a2f464c3cd3ULL, 0x385a89788c27aea2ULL, 0x4fd9a9a1b6465595ULL, 0x61b4c4443906dc7aULL, 0x9e0d63983f1634aaULL, 0x60b3b8b37fb2c675ULL, 0xb409ee0977f1c3d1ULL, 0x275e7fa01bcae820ULL, 0x59777f51fa698c4fULL, 0x806b18d5ef95f877ULL, 0xe27f1da06cc7bfa7ULL, 0xc7d1fdef63d98ca1ULL, 0x8282e2253b47a36dULL, 0x223124c0a5884a01ULL, 0x08a18223d742274dULL, 0xdd12f1e2b5016dc3ULL, 0xdf3314f9c2a15882ULL,
+        0xbe2db111b9a0b450ULL, 0xacea807b41dd2218ULL, 0xe6007031766c0089ULL, 0xa067e23d0d26f184ULL, 0x7ff7b173be01c282ULL, 0x8eb8f780da014a36ULL, 0xf7c7d58a8d981fd3ULL, 0x74eb4c594caa9232ULL, 0xfaded8fb09ec31dbULL, 0xf93bb909e4de8029ULL, 0x8ae42a7b8ff7cd61ULL, 0x766373a4cbf8576aULL, 0xf1455a4271f3fe4fULL, 0x0a7f5cda4f20ce6eULL, 0xc8d0b276eba61a2aULL, 0x8f340cf1fb900b79ULL, 0xaf1a750f70fac8b3ULL, 0x733f2a9169997405ULL, 0xc7b7fc2c66b6ce57ULL, 0xfdc3f4923d4973f7ULL, 0x5813924a4f7350eaULL, 0x33684323f4c80560ULL, 0xeb01e29e2f2951bcULL, 0xe0839dcbc8958c5fULL, 0xc6b287aa01c68b1dULL, 0x72fe9deaefc6cf93ULL, 0x2e7ffbbe5088463bULL, 0x822b586b5ce4bd97ULL, 0x636b3471f3e86f7aULL, 0xa91ef12ff65a5cadULL, 0xb968d93e758c6f0eULL, 0x12494da9aa35eec6ULL,
+        0x918c916ba5d7f0aaULL, 0x81a3fbb5571e22d7ULL, 0x925ded3fbfe243b8ULL, 0x71374a769367c4f4ULL, 0x4b7095e97b773481ULL, 0x94034257d8a26fdcULL, 0x95eac65ec462c8cfULL, 0xad223abbeac49e58ULL, 0x4ceb407e05a089bcULL, 0x411aa16cad9ecb8dULL, 0xaff5fe30b7248fd1ULL, 0x9496f5677cd9197dULL, 0x6c30fa23bdff03eeULL, 0x369395751c0b02a1ULL, 0xd6ec431ce4f4cc09ULL, 0x10fccadaaefd7b0eULL, 0xd594cff5decdaf4cULL, 0x89ffa9f795aea0f7ULL, 0x76510ac181568414ULL, 0xc324d85d35a4e5a7ULL, 0xf56395b75d15bc73ULL, 0xb4b8dd6d3b1fcc29ULL, 0x65cfc8824afcd4aeULL, 0x4f6a85f5853b2f57ULL, 0x1a0f94d94df5c88cULL, 0xd40f251136b5210fULL, 0x4f0a6d363d3ccf06ULL, 0x54ac79c9c43b369dULL, 0x1a09ac47ad4a2658ULL, 0xe726839b20b5a5d3ULL, 0xedb208aeb735d1c9ULL, 0xdcb4c303cb7803e6ULL,
+        0xc3d24e1287f5c3cdULL, 0x4465158c6dde118cULL, 0x20127ecc2620e2ceULL, 0xc4ed706e9098dbc5ULL, 0xb205a7012dcdf2bcULL, 0x23db31a1a2753fd1ULL, 0x65134202cae20e61ULL, 0xcbfe88b6824f586aULL, 0xbd3f482e3b64fb58ULL, 0xbd7e45fca2189364ULL, 0xf74289a5b4ec4b47ULL, 0x11fd8ced6077e4dcULL, 0xd02f29a9b08951afULL, 0xf1b73a49a27b8296ULL, 0xce97f379a9250deeULL, 0x9e79e7aef29cf178ULL, 0x3d9d508a5650d34aULL, 0x9886b9515476cb91ULL, 0x53c649faba8b5a87ULL, 0xb352e49f228ad4a9ULL, 0xc4120662e7a10343ULL, 0x9c9d37dd81deca57ULL, 0x2a4daf74fd6d66b3ULL, 0x5844f5d3ae299b20ULL, 0x1b5e920f057acebdULL, 0x2e8c975d8bee3c13ULL, 0x6dc2004bffc37fe9ULL, 0x77d78e84e231617cULL, 0x98292fc4c5f1311aULL, 0x757e5b8b3573501aULL, 0x0afb669a37c50b48ULL, 0xe45eb844ee1c128bULL,
+        0xc80d26b68c8c16e3ULL, 0x22c3d23560645a86ULL, 0x9c849c254526bbfcULL, 0x19bbd729c9b18257ULL, 0x99e3284dc393f525ULL, 0x98e81b2c79ef0e6fULL, 0x482051e19454e683ULL, 0x9354e8002ef53484ULL, 0xc609188d81b67548ULL, 0xcd4eb1937643dd4fULL, 0x9534d28289385c65ULL, 0xe17b1beaf4b66576ULL, 0xedde3419d8353cb9ULL, 0x4011c6969766ac37ULL, 0x8a28cdc87aa5c83eULL, 0xa221ffdce6412cc2ULL, 0xfc28f88ada819712ULL, 0xeafd22c651628cdfULL, 0x59b457abb961425cULL, 0x9ce465c23c3c749aULL, 0x95764258995634b5ULL, 0x3830b5eec58f7b41ULL, 0x26242451029c5e10ULL, 0x06848674a16e446dULL, 0xfa1b2a21285af870ULL, 0xcd9216953c94d3deULL, 0xf1eb20ab7e2de5a4ULL, 0xa3a7723f25ea7791ULL, 0x3b05d6af592677e1ULL, 0x3c90faae2ef308a5ULL, 0x3ca321f1f79f53d3ULL, 0x7e62e766a0e1a3eeULL,
+        0x97a266a1aa675e96ULL, 0xf365a33ffc2b9db4ULL, 0x2841699614100abfULL, 0xbb8c1dced23d3eadULL, 0x09f124b8c43acdedULL, 0x0c91c0b8e161f5f6ULL, 0x1de20a8a9af7dcffULL, 0x1d1a8244efdf4de0ULL, 0xb6adc249122ed4a5ULL, 0x87cdde6135b25880ULL, 0x7a3b5424910036b7ULL, 0x68e89f81a8231d6fULL, 0xf0df5f485b1bd470ULL, 0xad3fa6a23a169bedULL, 0x03d999d7bed6c67eULL, 0x4530ffe8072c5b51ULL, 0xde77ea6392696edfULL, 0x4548bd1d60a4deb8ULL, 0x1f7a0708cfbec68dULL, 0x914c3f383403033aULL, 0x33e55a74235393dbULL, 0x3997803a0ea0a2c7ULL, 0xc72deed25cb305b4ULL, 0x4ae19d49644a55f0ULL, 0x65f371d73cf8afc1ULL, 0x300378d72a221de6ULL, 0x47800d06cc1849c5ULL, 0x8bd7f55b75449e97ULL, 0xe9ad77493d772200ULL, 0x77e8536daece3ae6ULL, 0xc113ece6e5bd0ce7ULL, 0x49c8f149f9d9c472ULL,
+        0xb0bc96fe4a88c684ULL, 0x3370a28f6bbb57f0ULL, 0x18fabc93bf4f6891ULL, 0xb53175819d69eff7ULL, 0x06d4bda69ea77c85ULL, 0xfa41722acf928d19ULL, 0x9178bce72e73e6f6ULL, 0xc5617aa701b3145cULL, 0xe5543a97c836b05eULL, 0x5cd316ae74eda93eULL, 0x88db8ef9b829bfd1ULL, 0x452cc5df1d4dd914ULL, 0xb08761d988fe1c2eULL, 0xa2556852b4957f0fULL, 0xae66f0c7b2618a26ULL, 0xcd2b6d5dcf886287ULL, 0x9c4f33b9111d0fd1ULL, 0x5733efe8545fe047ULL, 0x350e9ad27ff93152ULL, 0x4cea38098a577fecULL, 0xa6faba7112fc6195ULL, 0x344e839ebf0b78deULL, 0x9d8330f5614b1f08ULL, 0x0950d52205be9052ULL, 0x42d2eda6a3c5eb4cULL, 0xfef5fea29aee45a4ULL, 0x3f0523f8ff79f985ULL, 0x753082d1ab821cf1ULL, 0x80c9a97420d927e9ULL, 0xd9bb4ef25417efe3ULL, 0x00120c2022771ab4ULL, 0x71f0df84d49a5734ULL,
+        0x19333120e6d6d798ULL, 0xa92f8d69a10b3492ULL, 0xe156d67ad322e25aULL, 0x986a936aee682a38ULL, 0x5c3f498ae3a2d72fULL, 0x99594661c5e4af4fULL, 0x5c8825bd5b8701f7ULL, 0xea2735f29aeb3b90ULL, 0x3f5ee931139b0d7eULL, 0x45198f34be21a0d7ULL, 0xbbfabb0b70d19569ULL, 0xeea58838ef95316bULL, 0x105b5124b95d7c17ULL, 0x81f53185d9ec70c4ULL, 0x1226f4a488b5c594ULL, 0x8cd047ddc2cb1eebULL, 0xe93fbf98024fa692ULL, 0x9e85c339b2d809f1ULL, 0xbeb6559f9ca5e77eULL, 0x84472d3878bf44b1ULL, 0xf38f93b1907a1b13ULL, 0x7ea7ab43e3dd8576ULL, 0xbcd5eb59f0e6d59dULL, 0xf4b6bf589f24e79dULL, 0xd1425281b8f885edULL, 0xd13836d557e0112dULL, 0xdeb65bc56da127a4ULL, 0xa1f098f834261e8eULL, 0xa88844b66c4ed2bdULL, 0x7bc2208f377dd0ceULL, 0xe6f0246aa6fafcffULL, 0xd23ea348e39714aeULL,
+        0x435e6c95101a9f57ULL, 0xc0311bbe314ffac2ULL, 0x6b54bbb087b92246ULL, 0xbd9cdde3aaefe019ULL, 0xc8b5042475d2a1dfULL, 0x7ada5ff89e0a6a73ULL, 0xc868956de08a3577ULL, 0x215534d275409545ULL, 0x9a8328351f054627ULL, 0xd41be9f5ece4f15bULL, 0x3c5e4b546ec11601ULL, 0xc6bddda7319d1fb7ULL, 0xa483c11b294efe41ULL, 0x72c64eaa2bea60f6ULL, 0x4192ac301cc39656ULL, 0xdb71341245e777c1ULL, 0x2032c849d362cb91ULL, 0x590bd5fb288a8238ULL, 0xbce646bdcb66c585ULL, 0x0680ac70ca2062c7ULL, 0x70c1aabb1f8f2e18ULL, 0x267f20727b198152ULL, 0xb52ced49edfa3d5dULL, 0x9f6d762739c5af68ULL, 0x878df67a44532584ULL, 0x66a383f7c0425899ULL, 0x8e1a772251a3c6efULL, 0x3b0b10804044ac24ULL, 0x64c27999507dc44cULL, 0xcdedbb4e072a7e47ULL, 0x7a62f23ca5cc8d2aULL, 0x0f6bb08500ef1a61ULL,
+        0x4c5bb7d9e1417ac3ULL, 0xad8e9ce9916a6c3bULL, 0x9623aefca68207e4ULL, 0x5a5613c1b617aad0ULL, 0xd22df36978411408ULL, 0xc358cf94bc9beb2cULL, 0xb050c9c0dffe53aeULL, 0x946decd4c5fa92d8ULL, 0xa554b3159e710bd3ULL, 0x11606b57ca20f31eULL, 0x398f1c92aa5f911dULL, 0xb950f5cbc81a9390ULL, 0x8ae8cf405e919ff6ULL, 0xe2ebf462de8ae544ULL, 0x9da1a563896b2948ULL, 0x78b080e246e2fb17ULL, 0x059eb0fe87136780ULL, 0x646ac302d255771aULL, 0x713091c3c5be8564ULL, 0xc6e933460dcf7578ULL, 0xa223ee593f4dc49bULL, 0x1ca3eef2c61f3c5eULL, 0x08f9931877330667ULL, 0x033ca6181ef14ab7ULL, 0x244437757bd6756dULL, 0x40d1a576e621cf93ULL, 0x6b9bcce22e1d7248ULL, 0xcda2c6e9019601feULL, 0xce4744a58e32a1a1ULL, 0xbffee939689c6bacULL, 0xbded1c9ecc12f04dULL, 0x212e901b1a81378aULL,
+        0x123964c5228a30c5ULL, 0x7517efdba37fc8f3ULL, 0xd0097bf36137dd85ULL, 0x61896adf5eee8c82ULL, 0x5dda6f1f990f2668ULL, 0xe59332781ecc5944ULL, 0x441580b25f8d15beULL, 0xf214bd410363a9a8ULL, 0x6fabfc3fda6e9ce3ULL, 0xbd52c9d5dfea6eeaULL, 0x9e13a9b5d12061d1ULL, 0x4ab28f919ce3dc55ULL, 0x7e058d08da079453ULL, 0xbdf9457dcb713bd9ULL, 0x3ff0df4360a0d878ULL, 0x50ec7058e84a59c1ULL, 0x7ee600d848f9bdc9ULL, 0xd4c0fbbc287b2db4ULL, 0x5e82180acdbf2bc4ULL, 0xda4612b7b33daeb1ULL, 0xcf67bb8d09be09a0ULL, 0x7cb29d85db85618dULL, 0x3367cbda236dcd92ULL, 0x364ceea93a9e278fULL, 0x199eb68147aeac8cULL, 0x7e99f3c564d21d27ULL, 0xebb646bbbb203721ULL, 0x0428df7babaf78a7ULL, 0xd3681babe44f71bbULL, 0x03e0f941762ea14aULL, 0x6ad6bd9c2ae1aba1ULL, 0x5688c2caf1e835a2ULL,
+        0xb9748307df7b1edfULL, 0x47555165f4cd025dULL, 0x7f6568a80dab4300ULL, 0x0b9207292dbf9867ULL, 0xa465cc22de688feaULL, 0xf3b9ed33571707a1ULL, 0x4b0f8a28d1f7758cULL, 0x587a80e3d45976f6ULL, 0xa25f730da0a8a031ULL, 0xc094552d74c9e3acULL, 0x4bdaa7ed07108d06ULL, 0x8ee9367f29ee68d3ULL, 0xabbb41e0d555172aULL, 0xc9dab89c1a181b65ULL, 0x3cfbc13bdaecf924ULL, 0x6d9ddad972de9c6dULL, 0x4e90b05c241e580eULL, 0xa085ed29b9d9a085ULL, 0x7f050b4083999e12ULL, 0xa03fdab70ffec4a3ULL, 0xec29473b71bd2d5cULL, 0x8dd42a18c8ba2266ULL, 0x65487ff92fc98a66ULL, 0x16d16aff44ae7b6dULL, 0x9c869b0895f19646ULL, 0xb2219c2b2c8e9410ULL, 0xfd556527b31ec3afULL, 0x1555a00128ef1ec9ULL, 0x7e32c57357396eb4ULL, 0x68e45847d55c8a6aULL, 0xf5e62e85fc867230ULL, 0x8b1ef484c8089983ULL,
+        0x9f2654a6f64409e1ULL, 0xbdfc661ba5036570ULL, 0x7a1a8322a1d8c816ULL, 0xd3fec7065915e08cULL, 0x426dd90ca375936fULL, 0xac0d34706e8470aaULL, 0x993e94a20aae7497ULL, 0xfb71878a8c0d3bbaULL, 0x1a0ca8f8f6561e82ULL, 0x29a1d0fb4b2f5fffULL, 0x62ceda04cf658363ULL, 0x482ab8b2452ff6a5ULL, 0xfccd5fd9f9faa1c9ULL, 0xa0fb4a9f675f2658ULL, 0x448f3dcaf6a89159ULL, 0x153267c07d8bb942ULL, 0x20499fb59c6cbb6aULL, 0x5beb503ff8fda74cULL, 0xfb017cddbb77c458ULL, 0xf7ab28d18c3f7b0cULL, 0xb50403d9a9132274ULL, 0x068d412a47a2bf53ULL, 0x10c20f5dd484935aULL, 0x3b2e0b306d4c5904ULL, 0xd585c58cb758923aULL, 0x28025e1ef6521b16ULL, 0xcd87704b931bb880ULL, 0xb02f290c33d81d03ULL, 0x8cd7f8b7445b1ec3ULL, 0x5077b45a894de214ULL, 0x37cb471f80907e13ULL, 0xfda670bccfcfea4eULL,
+        0xeba1b0991dc25595ULL, 0x68007f33f0495632ULL, 0xd7bd19bbcebfc842ULL, 0xa385e8e36b726373ULL, 0x7df0596e1c0ffc47ULL, 0x18b91a91d8652788ULL, 0xc26842a8aac30271ULL, 0x43a37cca0e92c0c5ULL, 0x878f1ad46eaaffceULL, 0x1e7dca2f47fecedaULL, 0x1135a8459326403dULL, 0xa4f1f8c71d97b6eaULL, 0xca4df35b86a90d56ULL, 0xd3728b562339779aULL, 0xfb4bbd1a53076cceULL, 0xd88657a2599fad52ULL, 0x9a52d0090d335df6ULL, 0x70ebe7f5c0e97283ULL, 0xbda5d8ab30ca2d7aULL, 0x361206ba0e5b116bULL, 0xcd76de6d53b18ca7ULL, 0xd7544576c6b06e39ULL, 0x4f9693165636c58eULL, 0x12de6a2d01d621bbULL, 0xb49190bd00e29f33ULL, 0xee8d570913ab108cULL, 0x8fa2f717709da91bULL, 0x1332aa4818b0bcc2ULL, 0x3eaff0b0217f1cf8ULL, 0xcddb4e0c859d4394ULL, 0xf424fdc4a1b54e51ULL, 0xa76559a01096482fULL,
+        0x342c4047d18f9780ULL, 0x67588addd9ff03f6ULL, 0xeaae506c85ea9c0eULL, 0x12ecd193f762833eULL, 0x2a94c62fdc982aecULL, 0xdd45a6054eee5110ULL, 0xf4b9372d071d38abULL, 0xa981a1ca397cd0f6ULL, 0x572f5e3158d352eeULL, 0x3fcc9ac92b64cd0fULL, 0x5f497e3023dab0b2ULL, 0x4a9f53b71f592f00ULL, 0xab9a07b3e288cdf0ULL, 0xc82716fb08224d86ULL, 0xdffbaa669e6c7be6ULL, 0x61897536af29487bULL, 0xc6f9c9e3ea81cf87ULL, 0x1061cc45d540574dULL, 0x573e5c66bd108298ULL, 0x61b00f82bfd9cb9fULL, 0x8160adca449f618bULL, 0x1c2c95b07f0dbe4eULL, 0xda3cd6b507955343ULL, 0xc755fdaa55230b82ULL, 0x8d6a4b2c2d4fd194ULL, 0xc397982a92ef001aULL, 0x3349f4444a94070bULL, 0xa02ee3227f6ad19dULL, 0x8136740e835fbce8ULL, 0xc65cd5a92c787f22ULL, 0x4021458bf3cca1c2ULL, 0xd260041567d8befdULL,
+        0x47b6c29868192201ULL, 0xc3851bd9e73e4d47ULL, 0x22f2d79f6abdd5a1ULL, 0x513e5b5a9af6627eULL, 0xa7d399da5950035fULL, 0x08ca400386c9e9dfULL, 0x66faba480af83e0fULL, 0x4e6b322d56023c48ULL, 0x912f7cbcd24f08c4ULL, 0xe643f5f56dc91bdaULL, 0x01f86eb1f2fce3d9ULL, 0x7b12c11e7638776dULL, 0x10a7d06070ab939dULL, 0x55efc975bab3fe3cULL, 0x332ac681159fe4b7ULL, 0x80c07cd41f85450eULL, 0x4839b4cf4b159ee1ULL, 0x52882e5b3e4e494bULL, 0xb9d868066e7e3250ULL, 0xb4193c80f619efb6ULL, 0x5799e4d74be0a3ddULL, 0xe6dd9933efd924d9ULL, 0x22f91a0aeeec9cccULL, 0xc6cda82bd10ad015ULL, 0xf8e447f7c493b152ULL, 0x7e2b450bec9de087ULL, 0x2cbdfe20263b46a4ULL, 0x706e9cb7d2b000a7ULL, 0xdc278998ba7874a9ULL, 0xf1a1d566830b546eULL, 0x6da3823fee0259c5ULL, 0x89d7bd0cb27d2677ULL,
+        0xf128a7fdbf011961ULL, 0xda547b73e830d3c9ULL, 0xd570b970da44ef82ULL, 0xb139132a80f0e5a6ULL, 0x46398e5cbf693b0cULL, 0x1e246bcfafca0b83ULL, 0xc2f65b3ac2c24ee4ULL, 0xd2e270c114dcdf69ULL, 0x388e720d2160c6adULL, 0x6d68a20bab3bc1eeULL, 0xa5683da5923c6d87ULL, 0x01ca7eabb48123a4ULL, 0xf0994e9e0a575083ULL, 0x3446a995995e79c6ULL, 0x4b876baea7c5a6e2ULL, 0x0c95b4bbf510b5bcULL, 0xee439b87a3032c68ULL, 0xcbdc3833cd2403cbULL, 0xa8185f80c59c7a19ULL, 0xc9096f5b7858fe9fULL, 0x0353c892661e8f9bULL, 0x8af2435e83025b00ULL, 0x0b57dfdccaae62d3ULL, 0x889e7c09459f1e55ULL, 0x3d528a45d9008f03ULL, 0x40d84d6bfe3261f5ULL, 0x5754fcf03eb11461ULL, 0x8898ed43d9080077ULL, 0xd83f7700d9f47585ULL, 0x7f4cf45aa991103bULL, 0xdb3ec2c221154490ULL, 0x8d8d5175661a40d1ULL,
+        0xb58b9847c2cae456ULL, 0xfee86caad934408cULL, 0x0c8572a35bb1003bULL, 0x344a67d9777e3e68ULL, 0x51e9a0835cef1cc2ULL, 0x4e3c5b96f0ef1aa5ULL, 0x0ef79c6eb9763f81ULL, 0x987e34549d8dab1eULL, 0xa94040537efdcf0eULL, 0xdd7ea0e84ac7f339ULL, 0xd54edbed2dfa0c38ULL, 0xd5a9368194f442c0ULL, 0xa482f56ae68a3817ULL, 0x8c22698359262aeaULL, 0x7aa0340ba0cc71bdULL, 0x3117c9b0381cf9f1ULL, 0x9ba0619ec35eb9d8ULL, 0x3e1bd620d1fc29b9ULL, 0xa09ef1046aff1d7eULL, 0xcc2a632700759b90ULL, 0x716d3e2a0fc97341ULL, 0x36998826beb26b2bULL, 0x0a411b621d95f1ddULL, 0x7c0b84a20a0a8d90ULL, 0x0a98654ba610b83aULL, 0x49227e60ed021798ULL, 0xa94d02f3f6495b76ULL, 0x05d66f2b0cb55736ULL, 0xb8592a2903fcb978ULL, 0xa66a72ac33ef7802ULL, 0xac13d631e9604e5fULL, 0x2b62146eb0663154ULL,
+        0x7e320a207df80a5fULL, 0x5ea129ead332594bULL, 0xb4e5889d678fc380ULL, 0x498d92c6cd5bc02eULL, 0x32d07e229c4d3ebdULL, 0x4d14e73eb8326f7eULL, 0xf26aed89474b323bULL, 0x37ca63114a8ff56dULL, 0xb3afa353217e7f95ULL, 0xb29e48263b17504dULL, 0x60368bbd0be1f64fULL, 0x2e03917d8f76829dULL, 0x741c19f1df3b548fULL, 0x7313654d19a1e2f1ULL, 0x455aac5b6a540605ULL, 0xb9b78b64cd8df5e9ULL, 0x6a0f8d1329cc4d3bULL, 0xfbc50ea451006ee4ULL, 0xa59d1d84319bc163ULL, 0x729d73e8525da2c3ULL, 0x86c2a4b8e095305eULL, 0xe44abd81a67fa8dbULL, 0x0014c9814ff85f84ULL, 0xd4cada4599b8755aULL, 0xc32766c1483c4ebaULL, 0x4e342ab919937150ULL, 0x4221f7a9ea661181ULL, 0x5174dac37716ff9aULL, 0x12783a90e9d408dbULL, 0x819d027c0f98bc6cULL, 0x5f193d8189656f87ULL, 0x550dfc32b0dd2eafULL,
+        0x755b3622c7cbad76ULL, 0xa0f7cabc817de865ULL, 0x30dae47f9dc93d89ULL, 0x746d95ae7a4fd34dULL, 0xaaaf2cd0296e8b5bULL, 0x65259293be1ca236ULL, 0x30b3e1d2670e5388ULL, 0x825c2441d4f641bdULL, 0x48a82c822b3680d9ULL, 0x8846df9dd095a1eeULL, 0xeb84f1310e9cfcb6ULL, 0x43c68d9e20eaa5c2ULL, 0x7bd60235293ea95cULL, 0x744c44a3403c8dceULL, 0x142dba8e4396c591ULL, 0xc349e35326ca1d08ULL, 0x2ad289c2b7cacad5ULL, 0x5963b299b770c8abULL, 0x574672963e64b7d0ULL, 0x5db4882ec5336cfcULL, 0xb23990bd01ba7513ULL, 0x717ce2aa27dc46b6ULL, 0x9284288ae01f3370ULL, 0x55a8ffb57e3208d5ULL, 0xf2ab5c7e3eece036ULL, 0x1196ccee48b9c7f3ULL, 0x30694f0a99df6189ULL, 0x85c82f8e4f91a2a5ULL, 0x2b35525c5acc49a4ULL, 0xc8908b426abda10fULL, 0xa1d567c3d343182eULL, 0x2cbe92bf896b924dULL,
+        0x23ffff9ed083a57fULL, 0x6db908260ee5166fULL, 0x508809976ba40a0dULL, 0x4fd9bd4b583cb0d0ULL, 0xdfac9deeede2e83bULL, 0xf17024a754765750ULL, 0x0f8380c0a86bab03ULL, 0x19f305303325963bULL, 0x2ce4151e77eaecc4ULL, 0x7612eb9e8a830a22ULL, 0x33bed3f9ae730b04ULL, 0x3ab9e71c079fbcc4ULL, 0xfb4d978c7253af17ULL, 0x9da0b0bfd851b829ULL, 0x3e4377b34407fc81ULL, 0xd4a6a79bd9a15018ULL, 0xa63dee6b6783f12fULL, 0x35c4bb0100cfcddcULL, 0xfef257649a6e14faULL, 0xff34f3027b443870ULL, 0x2365fe52ec1759d4ULL, 0xa06aee23132d4b7aULL, 0xa8110060e5f77dc3ULL, 0xe6b4387bc7b7174aULL, 0xfeeb3101d038090cULL, 0x7984a72633003bbeULL, 0x979ca116faab7c94ULL, 0x9b1c63750f357dc3ULL, 0xe8cfb1d329479ba3ULL, 0x0d2a2b165ed2bbbaULL, 0xa613db117d2f8ce9ULL, 0xf4a9716efbdc3860ULL,
+        0x19b368f5e5415798ULL, 0x3d2470e272d0320bULL, 0x15b0750aa9ad54a6ULL, 0x01da96ecf0da41f4ULL, 0xa88c94634ffd7ce0ULL, 0x99a09f0886e46327ULL, 0x2fcabf6de8dbd918ULL, 0x913589c115a62933ULL, 0xeb0be39471b89810ULL, 0x704ca940a353868bULL, 0x4c5347f157ccf444ULL, 0xed22e6b23c592479ULL, 0xc960ac14311780a5ULL, 0x66788ebc583f76f1ULL, 0xd51aaf87d604b52bULL, 0x524aa1e05bf17cb2ULL, 0x022aec7e0bfb819cULL, 0x64f891fb3ce2a3afULL, 0xfef31a54d84ce875ULL, 0x34a178fca00b5fbaULL, 0x11383c2508055b66ULL, 0x58b019656ff11694ULL, 0xc09bfaff738699e2ULL, 0xfa2b48b6c2bb9542ULL, 0x9ce2003ecacc30c8ULL, 0xe71c73ad02581376ULL, 0x0e8b684679857b06ULL, 0x3326764daa304306ULL, 0x2a00a6ad3ed3dfecULL, 0xb58336b0fad601a6ULL, 0xa6f75b0912e08eceULL, 0x32809553d3c9bebcULL,
+        0xadc7c5581d3e343fULL, 0xcbe165bfb2c633eeULL, 0x5f2b468a94a13e90ULL, 0xb1f261ecc77ed3cbULL, 0x2eff02f794f56037ULL, 0xd988db19deeb250aULL, 0x61aec62c2809cf81ULL, 0x184ed27898123746ULL, 0x8318f4b2b5071679ULL, 0x2d06bae4b5674a88ULL, 0x1a99fff636bc2e92ULL, 0x16e92fdd2dcc9ab5ULL, 0x92daa604fe6e901fULL, 0xcc88d0e3d2d9125bULL, 0xaf2ebece05ee05e1ULL, 0x700da71e10a6c787ULL, 0x7e4bb86592625684ULL, 0x8a1e3b8110c290a1ULL, 0x11a24d6b25b6c5e1ULL, 0x44926a36a0e6536aULL, 0x30b95ad33dd1b94cULL, 0x6d9b951a4aa54edaULL, 0x2e3ef89175d21784ULL, 0x8e0b7a7355c00184ULL, 0x1c607f37e8ec49ddULL, 0xcb9601800907d72eULL, 0x8e2c535c68716790ULL, 0x7d3463b721aa0d17ULL, 0xb43528349047f368ULL, 0xa18b37455ec48b59ULL, 0xf5382b339ac06004ULL, 0x72434d9a5ec8c2a2ULL,
+        0x6c20a91ed896cf1fULL, 0x40612edeb19ef2f2ULL, 0x50fda2605eb1c591ULL, 0x19d123e0b9e994ccULL, 0x71273ef4d226673bULL, 0xe46ed249ac5b7c52ULL, 0xbbad5d90982385ecULL, 0x64023243b9a253f6ULL, 0x80ffd1e6cd576db8ULL, 0x3bc6587da57a31deULL, 0xdc65a26b0e170092ULL, 0xeb5baabdb4e742f6ULL, 0x6c7ef823cc73f9beULL, 0xe0a202cb84bca3a6ULL, 0xd4ac8de247502be4ULL, 0xab594313794545e8ULL, 0x55d9097104b6344bULL, 0x146b8d51a6ac314dULL, 0xf0cd02dd605137e0ULL, 0xfb4b4aa4b7f0e675ULL, 0x7a12c11375a476f0ULL, 0x86a4bd03b9566eb1ULL, 0xe683a9fbc61a2a59ULL, 0x195e4f4132ef9273ULL, 0x673a05d89f00920eULL, 0xca797be9a4aaf55dULL, 0xba02067b950061baULL, 0x6fd448b815d3074aULL, 0x24376d931882547dULL, 0x55e6f73d0ba18b05ULL, 0xb7f743b2749745f3ULL, 0xa9b067d174e8faa8ULL,
+        0xc3d0388b591148caULL, 0xcfb92a473d7f6549ULL, 0xeef1e83b8417217bULL, 0x7b5db15459a3d5b0ULL, 0x5df333d5ea3e763bULL, 0xe2486479ef91654aULL, 0x6564e76dcd93c797ULL, 0xf4f8c20b5551ea27ULL, 0x081663868595f406ULL, 0xe3fa96cb147b6d04ULL, 0x0abff20710f9bed7ULL, 0xc2dba2828cab89b8ULL, 0x916adafed242d9c4ULL, 0x019d286a1c0ade31ULL, 0xcf075b6dfd368765ULL, 0x108b7891a3f6d817ULL, 0x4cf920ddac88bfa5ULL, 0xbf04821134ae1c0aULL, 0x0834a8b5a2391046ULL, 0xbc9e0f205d7413c3ULL, 0x157190eaf02d30c7ULL, 0x9a0a4accf0b8cb05ULL, 0x898e4346d3811029ULL, 0x034072e46670eb01ULL, 0x02fe2d13a0d9c36fULL, 0x23877fc3c5258c5dULL, 0x8982057226f744a9ULL, 0xf1f2495f6acc65e3ULL, 0x13097f19f977f619ULL, 0xede9c56ac1f97a18ULL, 0x810b5838f2fe30c7ULL, 0xb7d29fc428b28f62ULL,
+        0xfdf2acaa4ddf5915ULL, 0xd99266a98c472e02ULL, 0xb2bd41eb99c0a5f9ULL, 0xd04bdc1515ce24faULL, 0x5de1fac4d67a5647ULL, 0x61f28ddfc750234dULL, 0x292f3c34f6a47cd3ULL, 0x36342fd75e3b0cfeULL, 0xd5249c43d1c3437cULL, 0x7f4d58f32d7a0debULL, 0xc319e2cb8a68b773ULL, 0x6813ff0817854f0dULL, 0xd0f3c2c184d10dcaULL, 0x1cd712a583f24b92ULL, 0x63033d72ad6c0e6cULL, 0x1f2a416ac78af7c0ULL, 0x6948c9da15e3d19eULL, 0xa9e8ff658ff55f9aULL, 0x5a90478f8bd1622eULL, 0xd0cec9807e9cb811ULL, 0x3f88f3f43c6ae73fULL, 0x75ada214ab6ca241ULL, 0xc5d1097968c21067ULL, 0x3ec37ad0367a1c6dULL, 0xbebfedd70bb483bdULL, 0x105691c1606bdcfbULL, 0xbfc74150e7d1e3a1ULL, 0x130f0b066b27b2a1ULL, 0x83acdb537c078905ULL, 0x059a9ffdd2ce150fULL, 0x8bab689960455c7fULL, 0xac0133c833ac0e23ULL,
+        0x409b9ee66fd4b578ULL, 0xaf78dddcc533f7fbULL, 0xb000f79208d2a3daULL, 0x2d044765f217cfdcULL, 0x88a47c66604f644aULL, 0x848a5f4919f2dac2ULL, 0xc672e8e24e28b11fULL, 0xd42c58d9ff2c4cfbULL, 0x3e6e107a79e32a89ULL, 0xb95f0a9f7208e81dULL, 0xfe99c6335739f0d8ULL, 0x2dc560408c2219ddULL, 0xf36cd0e1e724ce5cULL, 0x139a1abcdeb4b0b0ULL, 0x6f2995d8a7eacdc9ULL, 0x75020fbbc0e3e526ULL, 0xbfd5549ffd193c99ULL, 0xbe11339e1ac66ca5ULL, 0xec30615befca343aULL, 0x653e6aa2bebf8c0fULL, 0x67ead36793b962e0ULL, 0x0835540d892a2966ULL, 0x34fde4045e9e09b9ULL, 0x3f86b70fe1671cb0ULL, 0x3cfc3484bf9669ccULL, 0x1c70ec948ca2664bULL, 0x010b34ce7e28bc64ULL, 0x7dc25a71b2de100bULL, 0x1306d07403eaf993ULL, 0xcc24a09be6df6036ULL, 0x21a0677e3dd2b13aULL, 0x2dbf6901740c307bULL,
+        0x604d1e6e1d502785ULL, 0xff5300dd3f8305c0ULL, 0xac477e6250beb7f9ULL, 0x8bf7b0436dfc9494ULL, 0x58a51d570d39ba6eULL, 0x9c798f7f0259e124ULL, 0x889dfbcbb1bc0594ULL, 0x779f3d26860a3c88ULL, 0x27c187461574540aULL, 0x44d614b401a22d27ULL, 0x7300d047a58f0f06ULL, 0x9051cf8ec193e226ULL, 0x3d7613657254b433ULL, 0x63a82941a336c42cULL, 0xf1fb0fff62037708ULL, 0xa70f1dc6c8718267ULL, 0x26cd6e963b67b0a6ULL, 0x0ff7582d82138574ULL, 0x8f7e64acb423bd75ULL, 0x677471b5ca925a62ULL, 0x380ed55e729facd6ULL, 0x5993eb6a5ca1607cULL, 0xf1b1b96221897362ULL, 0xfc0624484a021ce3ULL, 0xa934a637d9a718e8ULL, 0x5544a88756b617e1ULL, 0x4b74fe92935e7f64ULL, 0x77dcb5287f2ac9b4ULL, 0x12777fff8ca84ae9ULL, 0x1cb16ac60536945aULL, 0xa3c4af40f478b495ULL, 0xc29166569cb27b6dULL,
+        0x54b41e041e590fa5ULL, 0x94d78f6651b7a824ULL, 0xf7c609e5c75291d1ULL, 0x7705e761e754b85bULL, 0x1a924e054cb9f725ULL, 0x4bd518102ac2777fULL, 0xf173978f9d486fd8ULL, 0x3bfefb0a4f3fdbe5ULL, 0xf65526247bf1820bULL, 0x78286b60a342fde4ULL, 0xdc6fa2b6a70e35c8ULL, 0x22f41c5ae2970e56ULL, 0xb6790893e4cb866fULL, 0x98ecf96bb871483bULL, 0x85f236ddff261f7bULL, 0x7056c97f5a7254eeULL, 0x1e9328fc359a4997ULL, 0xc70ce6ae4dcb33fdULL, 0xb7d991c6b1817749ULL, 0x14c2116dad65384aULL, 0xfa0fc33b931998a0ULL, 0x8204fa5645630d8fULL, 0xa3ae20a2cb611579ULL, 0xb494dd04e82573a6ULL, 0x7d2601c69d53c31aULL, 0x342d19dedfb900acULL, 0xf13beeb5bbe1e8a3ULL, 0x6153d9180847d32aULL, 0xbe50386db5c832baULL, 0xc82eae7c10f2a4a0ULL, 0x4a1a9674a54eba02ULL, 0x2aea80316957241dULL,
+        0x3f7019e81ebe1fabULL, 0x66f133694b86d5a9ULL, 0x6a89da5bc06ef5ceULL, 0x4ec47c0801a8b725ULL, 0x54746fedbc4a1a19ULL, 0x96812e9a145e16dfULL, 0x5376e28babef5875ULL, 0x9f6a5148cc6835b6ULL, 0x1cb7c6bba5718364ULL, 0x9bcdc2e8881b2dbcULL, 0xa9a579f90c6565abULL, 0x1a830d2d9044bf58ULL, 0xea36c6d44cd06e6aULL, 0x676af0f7001285beULL, 0xe601864067503f66ULL, 0x20d8f73a9ea3e0a2ULL, 0x8ec45f20313d1601ULL, 0x1daa523944c626b2ULL, 0x7813a479c153cd98ULL, 0xd16e3b02b96c4157ULL, 0x7421ce748ae19705ULL, 0xed1640807338b7a8ULL, 0xc21c187380ebfa37ULL, 0xf742e7fb7dd0541bULL, 0xebea560e5c634a36ULL, 0x1b36be71ccd2741cULL, 0xac5300c1ee288ca5ULL, 0x41024468847f5a9aULL, 0xe08a94d4f39949dfULL, 0x5d9fd620dca35741ULL, 0x8293005542450058ULL, 0x430fff456af27d3fULL,
+        0x813defbd34e7a4f2ULL, 0xf37e5021b1418295ULL, 0x235c147c2f0237bcULL, 0x747b827d474e91deULL, 0xa7cb44f5b7f44f7fULL, 0x0a9dcac1848d7de7ULL, 0x16d130a47e25c5eeULL, 0xadb736cf9a76d5f9ULL, 0x4325f7c069468213ULL, 0xb4ba44a85c1e0c38ULL, 0x0917b8e564babe28ULL, 0x4c539daa18672290ULL, 0xd0b4d4b0f7db4240ULL, 0xce5260d878f42ce4ULL, 0xc7b632b03a161c9fULL, 0x1e62b092e7d3be1bULL, 0xcbb5de61c5511c36ULL, 0x731e503c5c5d4fc0ULL, 0xb1f16ac4b82e2849ULL, 0x6dcbd9fd9f57af0bULL, 0x7464b6ed36f55f98ULL, 0xcc7d70ab22e81399ULL, 0x7e337e6694a62fa6ULL, 0xfad799b4e60ec759ULL, 0xca65aeb39be30c34ULL, 0x4d8f0107167d1a55ULL, 0x688ddf4b2d81a6abULL, 0x47ebce5656cc832bULL, 0x97706da4ef0a5ae8ULL, 0xa36cc952840efdecULL, 0x5f5e8d2f7d6c7904ULL, 0x7f9cabe72a568158ULL,
+        0xb3a40fd1078a9fb8ULL, 0x76b5f219e937bc77ULL, 0x58b0ef1ca21f5231ULL, 0x1078d33877ecb1faULL, 0x809d7331a2cd2295ULL, 0xf537512264c6625aULL, 0x47d482c59592f856ULL, 0x925c8fc59c19c6cbULL, 0x7aee43c9bfa10bf4ULL, 0x6394edb4e9b2b267ULL, 0x42abc890ed50d910ULL, 0x6d6ca938caf796edULL, 0xded4539f4c525043ULL, 0x63b2fe8894ae8d5bULL, 0x8df6f6ba9c0c12f5ULL, 0x88c4d7da433feb4eULL, 0xeb4394c8fbf57a9eULL, 0x07f588fec3aaedc1ULL, 0x1f66fc7452527005ULL, 0x46008afb397a8f8fULL, 0xc5e4f09dd1c2a3a3ULL, 0xa63f2de1a290aff2ULL, 0x37922eccb43b7915ULL, 0x3beb26045ca6c862ULL, 0x148c0059ded97fb0ULL, 0x979eea75bb6d5c06ULL, 0x97f09c8b5e33661fULL, 0x295bd1d01f108cecULL, 0x87f43762e8f318dbULL, 0x8009c7302b440a53ULL, 0xaf398f2b6e05f1fbULL, 0xd38a0e944a31a0e9ULL,
+        0x0fcf1dcc55062d64ULL, 0x68eb0feec0c240bcULL, 0x683de316d0bd4be0ULL, 0xa73d0f332269f77bULL, 0x9f2099d10eb5047eULL, 0xf93f592ff608bb92ULL, 0x244b6891885ba81eULL, 0xde39ed5e083c03d5ULL, 0x6dcdc58a0f70ada8ULL, 0xc521c1e0041eb8caULL, 0x4446775707248829ULL, 0x31291590ddff0781ULL, 0xf1fca257eac1b988ULL, 0xa73c0dcf228e4c80ULL, 0xb2a824d362f5c483ULL, 0x6a77889fe7460b99ULL, 0xccd276d1bd289031ULL, 0x8bf2d3d7eee407aaULL, 0x99ead18b12868b86ULL, 0x8c92cd2d7aee3d50ULL, 0x26483b719d3cee15ULL, 0x3c22fe8a7b328abaULL, 0xb9281f368344a09dULL, 0x9c4eac0c3ac8dba6ULL, 0x41e13180faee6fdeULL, 0x3243a2b7dfcefcceULL, 0x8960cb349013b202ULL, 0xdeb5f395cccb62c0ULL, 0x4102661f246fa6b6ULL, 0xfb48ccb47934a2fbULL, 0xcd3b89eb3c7617d1ULL, 0xf7d4275af7616f2fULL,
+        0x6b7a0901d5d9ee2bULL, 0x11544763124d8afeULL, 0xaca1572a9f9b4182ULL, 0x502338972fb51dd5ULL, 0x29f4a969abbc912aULL, 0xac33fd09cc6a72a5ULL, 0x6f278163cd59d8dcULL, 0x5ddd9ddfe1652c87ULL, 0x4ad91bdd42301344ULL, 0x0cbc4424e8eb45bdULL, 0x79a144e5441b7499ULL, 0x87f7079aa782cec2ULL, 0x1a28b6086cc2dafdULL, 0x50530ad70efe4926ULL, 0x7d43d274af1c5789ULL, 0xad25ad13a4c26fc7ULL, 0x7fde66392f3d7db7ULL, 0x46f7554652245731ULL, 0x85833830d23f8bccULL, 0x4faa5a6ccbde77b8ULL, 0x4a39a1be3e3eea5aULL, 0x670e68f9508cb7c7ULL, 0xda633e933d0d0eacULL, 0x70cc3eaea8501910ULL, 0x5bf19ea6793bcbd0ULL, 0x6461089d612c4dc3ULL, 0xa9bce01dced4b762ULL, 0x49683b142b3c515cULL, 0x2a1fa42b2316f629ULL, 0x504f40298557fef2ULL, 0x6de201462b0edac9ULL, 0x85155ea161f60510ULL,
+        0x84a7a358ed5927d2ULL, 0xfd405aa281d58dc6ULL, 0x53070e562e9e0356ULL, 0x4b69eb95cbc12417ULL, 0x6288269fc5a3a1adULL, 0xac94c44a7489160aULL, 0x943edeba9940be3aULL, 0x70134ea272a497faULL, 0x61c72d4d31a403e0ULL, 0x2ed9a685cd9316a2ULL, 0x88f126b0775ff6daULL, 0x0676cff1f8f467b0ULL, 0x6e645bd06b4233f5ULL, 0x5b3a908eb9ab85b9ULL, 0x2c5169ff9a5d0bf2ULL, 0x5ecfd52fe434808cULL, 0x115f9f3816cc4c0eULL, 0xa673ecf60450a6eeULL, 0xe9120998f8eb68eeULL, 0x582d04adb211ba82ULL, 0x899c630f678388a9ULL, 0x5bcb38a405d90be8ULL, 0x2873642c940f9c2aULL, 0xda011e3fe27800ebULL, 0xe995349e3feab796ULL, 0x075bbd618f3ee328ULL, 0xd737a5ca4fe6ad84ULL, 0x8507fb6faf795dcbULL, 0x4852aa50c7df09a2ULL, 0x9541b4db3a5c277bULL, 0xeea906cf1da573dcULL, 0xd41a17ba4cb35796ULL,
+        0xec5f739adb75ae02ULL, 0xb50fe5a17a690bd8ULL, 0x0c85be11248814c5ULL, 0xf05fd74def9234fbULL, 0x1e278da437a73e04ULL, 0xbe1f6872af8185a0ULL, 0xccea6e302ed5948cULL, 0xbd9c0f3a3e4ef4deULL, 0x1a9070a94decd73fULL, 0xb8332d97d572b3edULL, 0x643c7c3a88b40feaULL, 0xebe5095a27059078ULL, 0xdf9a61c7201e8f14ULL, 0xc26eb5a3ac825912ULL, 0x2dd1a6c950c24b63ULL, 0x03465844e8c60634ULL, 0x33dbd39550cf2e02ULL, 0x043858a611a3e1d7ULL, 0xa10a9dae03119459ULL, 0x29c0b4fa73128065ULL, 0x54e8c7dd1d086960ULL, 0x549a23d41aa24964ULL, 0xf41350ba1333d205ULL, 0x29cc9be02e9c2409ULL, 0x139285349eb4e52fULL, 0x93a36c0225e0f796ULL, 0xbbd89c1727d28181ULL, 0xbb3c66d078faac31ULL, 0xdcbd3b3e23d74f01ULL, 0x128de7229fd45f52ULL, 0x3f7554345c08b003ULL, 0xfc15f12c08104085ULL,
+        0xa2790920dcf9bf8aULL, 0xdca118ebee2c6cdeULL, 0x25e3ff16b1833a43ULL, 0x81c898322b065920ULL, 0xa3be99850444565fULL, 0x4df93c0e69d0e24fULL, 0xcb033532ae66d974ULL, 0xe2a47df31732ca52ULL, 0x6e1b2231f497b745ULL, 0xd5f6a7c348da4d3dULL, 0x713c7cb2bc83948eULL, 0x0761a09518b2e983ULL, 0x3ca9907e97559202ULL, 0x5f251f0809daeb94ULL, 0xafc11431d17aff2fULL, 0x9c3d17a29dbe19a1ULL, 0xe1491d3ba9992b1dULL, 0x95312a3ea36f73faULL, 0x9c39ce14d50f5abeULL, 0x8734003b59c8e463ULL, 0x36038ce3311ded80ULL, 0xa75862ef7fdaa28dULL, 0x6c66e32c2cf13ddbULL, 0x7fb46ce9ad57a270ULL, 0xc35bcab4749df18eULL, 0x3618cf1949f499f4ULL, 0x36c7b7d91d18ccf7ULL, 0xd40cf93835b85da1ULL, 0x1634e50fc31d3cc6ULL, 0x861aea7259d81a8aULL, 0x23c8c8550f320806ULL, 0x088af0b7b7ddec21ULL,
+        0xa5f20658550ac1deULL, 0x0149e06ccf3ec866ULL, 0xc2fec399815aef9cULL, 0xe5393a9f6e0f3d92ULL, 0x97f1036ab44f930fULL, 0x3d7bdef76b98197eULL, 0xe2eb4af36acd777dULL, 0xcfd68c9b4ab1d851ULL, 0x52037c8c96a13968ULL, 0xb3d332ded630e336ULL, 0x8bd9531fbc305155ULL, 0x731b849388387f8bULL, 0x15b0ce63a255bc5cULL, 0x00702f46a3da97a9ULL, 0xc9ed4238c908c35fULL, 0x29e6cee83803df19ULL, 0xdc43456e9fa23180ULL, 0x3570573a6173e854ULL, 0xa1f1e84b4b0ffe52ULL, 0xaa1c14135b388f68ULL, 0x1c2baedb0f3ac71bULL, 0x4a7f0071c1cccad2ULL, 0x00d7152a89d2052aULL, 0x37dc11a26fef926eULL, 0xc2499e60a81fe597ULL, 0x706a6196d7b56793ULL, 0x698626f4a61b795fULL, 0xa1dd3ca8c5ab466fULL, 0x0a9a93c7b9809c32ULL, 0x954b5c9554375075ULL, 0xeb003ceb94896a3fULL, 0x83962e47a848827aULL,
+        0xe6cf91fd22d61de8ULL, 0x8245f70def5ac90cULL, 0x41f4c83cd3bde012ULL, 0xd8b96e6b13b08fc2ULL, 0xca86754d1cd49bd3ULL, 0xa3b5f1b7a59d0817ULL, 0x16f09506bca02846ULL, 0xff56a1281ebe9906ULL, 0xab188f1ec9eba468ULL, 0x6225e6e38cdf23d0ULL, 0xfe741391cc659747ULL, 0xc52ffcb1f80a6700ULL, 0xa737819343cbddc1ULL, 0x7987eb43ee44cb21ULL, 0xbfed7ca078dedc96ULL, 0x331aa8e0c2b7fec2ULL, 0x6aded6f8a10a74ecULL, 0x1b3c580f27416cdbULL, 0x2c66ef6f92d8b904ULL, 0x29948567041c8e6cULL, 0x67e3f8e8e7ef04e7ULL, 0x27a3c28a706f429fULL, 0x62522afee43c4377ULL, 0xd2ee06ed7094de99ULL, 0x44332d8a2ee75592ULL, 0xd8c206d3b4306c7aULL, 0x23d2d910b2e4be49ULL, 0xece744dd43577fbeULL, 0x2ad94b1331479759ULL, 0x05f27c0a5b57a5e8ULL, 0x82c8693fe7d09ac1ULL, 0xd1ef54c16747cd70ULL,
+        0x897ab550f546e4a4ULL, 0x273f099d4583013fULL, 0xc056063e24538348ULL, 0x5f9b189e599c9fb5ULL, 0x06dbe0feb1163b32ULL, 0xc3b76e83713f39d7ULL, 0x8b9a10a8121ee01fULL, 0x12d2814f5eae4503ULL, 0xcd2a3a54d9c464a0ULL, 0x17a615fa2b93208aULL, 0x4be55befc506e52cULL, 0x4404c81a627add66ULL, 0x4022d587b6e3963fULL, 0x3cd796209fd48211ULL, 0x05e3e7832184b621ULL, 0xcc9d4208dab84a00ULL, 0xe639a4178f2a339fULL, 0xd0cd3ec3bb95d024ULL, 0x9011e448a71052d7ULL, 0x7fcbda62d119c8e0ULL, 0xb9b94476d004648cULL, 0x0f02f2d3793b674bULL, 0x0b25ad15c27ca361ULL, 0x9bf36760c5f58c16ULL, 0x403a0a490debc6c1ULL, 0x959369bf317135cdULL, 0x5b2f3add0c7cdc24ULL, 0x951106b013efa621ULL, 0xb5ebd926f0d4cbfeULL, 0x1ff221199547307dULL, 0x412548f128c1af7dULL, 0xa1a4386a34d1d273ULL,
+        0x0677103be3a85ff6ULL, 0x4b2280495d854022ULL, 0xb6449e70901b54f6ULL, 0x12420ce3f2232d9fULL, 0x0ba71a2f50e86374ULL, 0x06e349dbe1940afaULL, 0xc0050b7278bc4742ULL, 0x8bf3f6bedaf4961dULL, 0xeaf1d56e0079473aULL, 0x76a306ce6897a244ULL, 0x765e978397abec67ULL, 0xc209e4a3dece0c5fULL, 0x18f3872e361b037fULL, 0x03ca13eedef007c6ULL, 0xde3e21e2e90b6665ULL, 0xa919094958c3df76ULL, 0x480874b1a05dac2dULL, 0x6dede88cf36a900dULL, 0x13ea1dc9401889e6ULL, 0x34cafba4f12676cdULL, 0xa876b8f238ecebd8ULL, 0x240a59128fa71a67ULL, 0xb6fad63ae9582791ULL, 0x3136a5c5a9042a2eULL, 0xeaec025c7923a87aULL, 0x878c5ee3470c3b5aULL, 0x01ef3ee0b5dac2ebULL, 0xf165ac9e54a93825ULL, 0xd1528a57e92f9314ULL, 0x03d6e2a091343aa0ULL, 0x1f80232529c492efULL, 0x71b012ec2c97e46eULL,
+        0xcdbbf1b24a293476ULL, 0x49ff099468a949bfULL, 0x85cc7cccd8db6abfULL, 0x6dbcd5e714f7c12eULL, 0x1384506a514698b4ULL, 0x87ad4f87b4f9e64fULL, 0x45128ed4d070e01dULL, 0xc958f45b6f6ee4f8ULL, 0x81754df5f5d9db66ULL, 0xcff20da153e9758aULL, 0x2be5dba0533a129aULL, 0xf51f1db9875b900cULL, 0x6302d0d6c429eb6eULL, 0x9878d5710db2d55bULL, 0xb76a814501b51c81ULL, 0xe6d4b46bea3cb1c4ULL, 0x7a314674da431abeULL, 0x1c1bad710493db6bULL, 0x0afc5293cc8634ceULL, 0x4a7055efdfd93c88ULL, 0x76eea300ab409507ULL, 0x4e4ffd17eb92c93fULL, 0x36ed34f89981cbc4ULL, 0x1c50ae8c13f86dd2ULL, 0x02675859c308865eULL, 0x5e28962abcce4c33ULL, 0x40504b14b793bd2aULL, 0x8b3559ed375e83ecULL, 0xbfc311e4bb92acbeULL, 0xc28fbf150cba60b6ULL, 0xdf2fdb8413016bccULL, 0xd348ee2399fd10c8ULL,
+        0xd966b47bcb5e00ecULL, 0x2aaa85fe751e7106ULL, 0x861a2ecc664ce083ULL, 0xe4eb551aecf995faULL, 0xbdfb6dc2a32205d7ULL, 0x379ae47fa6ffe097ULL, 0xde1ef63b320aafdcULL, 0x304a7d293a6efcb0ULL, 0xff706287c6fdd441ULL, 0x15f100d7e704308aULL, 0x5d9759455c9d8c00ULL, 0xa4d073933537c324ULL, 0x853f78ac4d2ff565ULL, 0x47f10c9181cb8f86ULL, 0xed654e2dad4ba21dULL, 0x40cf670e252f2c9eULL, 0xea2687cbadc431e4ULL, 0xb48eb50a7f40dfcaULL, 0x48931559dc99d8cbULL, 0xde237213ce8ad936ULL, 0x7d89b7a643a5d621ULL, 0x561b766087b3bd70ULL, 0x3227796b6aeb706bULL, 0xea42d92dc7d60aa5ULL, 0x752d23be397c0f6fULL, 0xc69864b6e2ac30a3ULL, 0x2ffc05f2238223b1ULL, 0xe8e0358a018834fcULL, 0xdd8f14c4a55d64d1ULL, 0xa828ba0e59eeaa75ULL, 0x51b80e87ca63350fULL, 0xf4dee8fefe32e3b3ULL,
+        0x154e0615452a2b7aULL, 0x0dc23d4a0fd8c9f8ULL, 0xc208350dbbb08dd8ULL, 0x583acfcc252ac11fULL, 0xe0d42c874cd97ee8ULL, 0xda8fbb96f61a7126ULL, 0x2495444bafb028a8ULL, 0x59e4120ad4291195ULL, 0xc3358331afe46509ULL, 0xf6675b90186662a8ULL, 0x033a5e63f102ac08ULL, 0x420d45840e89c204ULL, 0x507799f46fc741abULL, 0x5a2c8f24469421ebULL, 0xa033f996c7418c06ULL, 0xc01bfebd47ccb633ULL, 0x111ae5e06284348eULL, 0x5c2db56ab8b56775ULL, 0xdd739ce02d38988aULL, 0x757ac3cd4a2fc4b3ULL, 0xed5f0bdab5fd0d0bULL, 0x0250b8634310edbbULL, 0xf26511c71c0c4e7cULL, 0xa43273ad09f7b994ULL, 0xac54566460f1c3afULL, 0xbdf72ee01f903ec2ULL, 0x101d8465e91a919cULL, 0x07346399db6205d6ULL, 0x64647eba140be920ULL, 0x044636f544292f06ULL, 0xae2725a07af16064ULL, 0x4a85d1b32cc7a7b7ULL,
+        0x2b403f32cb2dde46ULL, 0x84062a7a961fe4aeULL, 0x0eee4ddbeda80693ULL, 0x59bd7397f496391cULL, 0xaa12a65dbaaf315eULL, 0x80d73dc5b1ab5576ULL, 0x82e3221a78cbb278ULL, 0x9e1df55be2f9ad51ULL, 0xd1085388947e5b80ULL, 0x5909692b164d87fcULL, 0xdaf3fdef3cb879e1ULL, 0x86a4acf315e14a7eULL, 0x4c01286c5b81ef7eULL, 0x95330a30e55108feULL, 0x8917cfdad81a8c3bULL, 0xee378fe5f2f8999eULL, 0x9b7bce890c2e878cULL, 0x6b7a0a0171d7ed36ULL, 0xce7aad2786a5abfbULL, 0x27c081884c86077eULL, 0x2957924c3e672f09ULL, 0xf5a982f181078452ULL, 0x918cd9a4d63b227dULL, 0x035bfb9a944283a2ULL, 0x02eb96900213d464ULL, 0x6006ddcae038b00eULL, 0x91572e533942779fULL, 0xb338b6f1336d7c46ULL, 0x22d5a21efb2b763fULL, 0xec339520339b9580ULL, 0x63897125d6ba0e72ULL, 0x009b6108a440dd8bULL,
+        0x3ed7bf173ebc8a6aULL, 0xced8fd0472bad7fcULL, 0xbf7d78e1c085f71aULL, 0x7e2600ab5f2768bdULL, 0x1b76404bd6d7b5a0ULL, 0x1c21ea117a82fc48ULL, 0xef87f84971e3d1b0ULL, 0xfb2a56d3c203ba37ULL, 0x5e2b91c314c6d680ULL, 0x53b5333ee3d531beULL, 0xf5cb2930c632aae4ULL, 0x53b804be414067b4ULL, 0x603e84d68de7a409ULL, 0x0f4c53cc6835843fULL, 0x8c78d2a82ef93b5fULL, 0x916750e3cff4f315ULL, 0x72a63c5f357def58ULL, 0xfb8841a81bf73c6eULL, 0xa55a30655a8258acULL, 0xcf2b1b923e386864ULL, 0xed75adfa0bca3537ULL, 0x1fae301bb0370d6dULL, 0x66ba132ba93a68c4ULL, 0x30aafab1f90067d3ULL, 0xd9e6d7c334b84088ULL, 0x7cd942a62dcf5ed4ULL, 0xd672f3f7a5c6bd63ULL, 0x6df33ea18dbbf619ULL, 0xa055ff8c21e469b4ULL, 0xb29aedc036b793d9ULL, 0x49b33656defaa704ULL, 0x09583b1522ed079eULL,
+        0x3a287777bbb2805bULL, 0xe12dac080bd34148ULL, 0xa7b95144db9f6a21ULL, 0x9bf5ec8e85bda5bdULL, 0x002b31b2c7b4b6d6ULL, 0xf1f469488ea61747ULL, 0x723bcb0341b7754eULL, 0x33e81832defed4b9ULL, 0xc54953af856581b8ULL, 0x2df01af4bbeb5595ULL, 0x6779e6fb50fd85acULL, 0xdf1c73808b0445a1ULL, 0xfac261531c08cc50ULL, 0x55d3feed18ca8eafULL, 0x6b1e2d00e12781b7ULL, 0x67a77396c0858ee6ULL, 0x7a49701d526b14edULL, 0x231e8bbd3a9c0e51ULL, 0x8bed8356e462525fULL, 0x0738b662a78c25b0ULL, 0x13eb2c54c8505b55ULL, 0xde7069f3fa20bca4ULL, 0x2886ebb6a0e04234ULL, 0xb2ed731ba076cc2cULL, 0x86d1c8542244af7cULL, 0xc16e9087e21b7b7bULL, 0x37d075f8589d58baULL, 0x75e021b17e015ab2ULL, 0xba3459cb555cacfaULL, 0xe6e51c815d7a6356ULL, 0x47c9b72800b195cdULL, 0x34e873337a00ec84ULL,
+        0x09bf681c2bae4e0cULL, 0x660f9942e7adb0c1ULL, 0x83346740da9637bdULL, 0x75c0018213d5e53eULL, 0x70b7d2c2f9a64deeULL, 0xa9667b74535a4ed7ULL, 0x84bcfccce4c5a7eaULL, 0xfc2803bb8a3a1c54ULL, 0x95fab4c652225b39ULL, 0x28d34f9667fc5906ULL, 0xb391fc616eb57ea8ULL, 0x731b6a5c77c123bfULL, 0xede48e072c1fdca3ULL, 0xc69f0c7dca300cceULL, 0x59666f260bdacdbdULL, 0xb88885257bbdb45dULL, 0x6fba044cc55105a4ULL, 0x3417c2cccefbe7aaULL, 0x74d25a63b7147adbULL, 0xb94864a42070d6afULL, 0x76ddad840ead9957ULL, 0xbcf5f9d9a1370353ULL, 0x34d83436e7da9af8ULL, 0x5eae23cb91629f58ULL, 0xd1d7d0e7e2edd5baULL, 0xd51776dd0bec7624ULL, 0x20d2a8ac03328a69ULL, 0xe6bd515bab389a28ULL, 0xb7f57a9f0e4a18bcULL, 0xdc78466869053f90ULL, 0x51c8999c4852f102ULL, 0x154645400080bb87ULL,
+        0x21209166f2d5ddcdULL, 0x3179b0668af9a004ULL, 0xac2f92a158207f2cULL, 0xbf029577d256f4acULL, 0x5f2675b8d024138dULL, 0x38aa30328ccad3d1ULL, 0x57b9e7a4d17fd75bULL, 0x7b06865b6bb7c1e5ULL, 0x2fb3c9635073764dULL, 0xa01ff6c7389f22ffULL, 0xfb84e596436d2b63ULL, 0x18dc8c8901bb9a78ULL, 0xf9ef48db22956f75ULL, 0xd94312ee8300d1cbULL, 0xa26a1d5e6f5e2853ULL, 0xc015f34ca3b2dbf1ULL, 0x69c3141431a7d3e5ULL, 0x69abb3714e58535eULL, 0x32296ef4cba9a51aULL, 0x9aedd510a534c2feULL, 0xaac5ab9e18cf4d37ULL, 0xd52491bf584b1d43ULL, 0x697f76a0893c7950ULL, 0x389c738d8f1cb758ULL, 0x1c21ffbfbf095b81ULL, 0x8b8ecc8b8f3dbd94ULL, 0x4e5808b8de8b414dULL, 0x1c94c2a848e53467ULL, 0x734e82c0c612bff3ULL, 0x829c162577b6b74aULL, 0xfd6b6c4b390b0467ULL, 0xbff80fcac7c0c4a1ULL,
+        0xef88943b4b51520eULL, 0xd8c640b03abe56fcULL, 0x439079e2da543f1aULL, 0xc77ccc046d34e63fULL, 0xcf506041f6b3c319ULL, 0xfcec92bd7a6da7d5ULL, 0x7a2fababbc5ad23bULL, 0x65ed2f35488dbc02ULL, 0x1c036584ab48b126ULL, 0x009ba4c9460f58f6ULL, 0xaf7bc1f46ae56df8ULL, 0x67d61d6f98bf2ec6ULL, 0x023712a0505844c1ULL, 0x3061363e11e50c12ULL, 0xceb96c7942dc6996ULL, 0x203094a3f66c9787ULL, 0x502f294e31764ed3ULL, 0x9fd33f75b2b7629dULL, 0xe0cf6ac1c38c445eULL, 0xa208aad77dd3163fULL, 0xd8ee9adb7142b8e1ULL, 0xc3142501cacca9ceULL, 0x913e5440ed4c80f0ULL, 0xaf42e8c8bb68292cULL, 0xd45fbe6a55456164ULL, 0x139f0620cf93355aULL, 0x8e7a3b9b96334ee8ULL, 0x0d93aca44f79bb58ULL, 0x421588902a2b3fb4ULL, 0x849c2f259830ddccULL, 0x81e9a5373d40a56cULL, 0x9bdcadc6d6250008ULL,
+        0x0ebfd0a74debcb22ULL, 0x5e3ab552cc6960b2ULL, 0xe5d011cffe9664ccULL, 0xab5e90ae65c4c819ULL, 0xa007f6fd6722a28fULL, 0x543bec41009ec23aULL, 0xeac969670730e9a1ULL, 0xe093676d5c0851deULL, 0x8454873294ff5f77ULL, 0x94082030dcb8fec5ULL, 0xe47d9472b8928262ULL, 0x11652ac091aea66aULL, 0xcc5d57eb9f255b19ULL, 0xc5b258e7742ce599ULL, 0x0ea3e1fe90d0d761ULL, 0x24589743737b5d4fULL, 0x5694f24272537377ULL, 0x306db082c0d56ccbULL, 0xad93bfd698f4d9c4ULL, 0xf4af3dc1cb83a417ULL, 0x8109b4e5a5a3112aULL, 0x84df981088cd7175ULL, 0x6555520c50dc4d9fULL, 0x19cf4edb67de035bULL, 0x2e15b60fcfe1a7e5ULL, 0x30098cfe9ea0ece9ULL, 0x2051f4d07aee6fe5ULL, 0xfd06e82dec9a79a0ULL, 0x23f8c8c4b9926098ULL, 0x9da6cec3805a5fd6ULL, 0x27f32c962bc0f992ULL, 0x67f98d109fb9e013ULL,
+        0x36b1b50aa3831d7eULL, 0x10fea3bb6e104e1dULL, 0x6260106c280e60a8ULL, 0x1fe87f54cfed485cULL, 0xb1bb451c4d528b95ULL, 0x10e12df198fdb384ULL, 0x81c7bc4800bd23faULL, 0xf9f081b7d7997359ULL, 0x2e5cb7308555b10eULL, 0x63417736e9405029ULL, 0x7cebb841349e8fb4ULL, 0x5c6ff6a9b19d711eULL, 0x655b98c15f81efaaULL, 0x00efed021c56bc5aULL, 0x1de0125c1ff5c3edULL, 0x428f23c06949f551ULL, 0x09cbcdf0910eb1cbULL, 0xdefd17d08c5a1b09ULL, 0x6dcfe45e704e7299ULL, 0xb7d1bfbd21947926ULL, 0xa5cdc7bd002ca8d8ULL, 0x3bbb5ebad1ecb210ULL, 0xba736b157e18d453ULL, 0x9e7a541f62fe6d57ULL, 0x4f7fcb2347020f4aULL, 0x43511af94748de3cULL, 0xf099e1336b0e9461ULL, 0x601f8b5a390c35e0ULL, 0x3e7fccb4ce5e48d6ULL, 0x2c9610b5b93f155fULL, 0xf23eae788c4ca4f1ULL, 0x634ea8ebd096d217ULL,
+        0x4e3c9fcd4db48175ULL, 0x41b2969bdfd5836eULL, 0xac96fb085cb4f81dULL, 0x999834f5347dbcd0ULL, 0xe4ad7ca4eb6d6bffULL, 0x03d0b132023a52ddULL, 0x72129a25fbffdd58ULL, 0x17e3c279e57aed81ULL, 0xc84c4dccdb1f07c7ULL, 0x8f5eba75362bd524ULL, 0x21bb8b5c7e5510d3ULL, 0x3d0df5e0a09c07afULL, 0x5d135cc0b18d2d45ULL, 0xfef1261808398de1ULL, 0xb9b4fa5aaa992fbdULL, 0xe9eb2e1952badb6bULL, 0xafb5ab3c7911ad58ULL, 0xdc449070c51ba4adULL, 0xb6810c4332a4bf42ULL, 0x4c44641135fb05a1ULL, 0x3b7aad731c31f434ULL, 0xebbd8cb1ba02780eULL, 0x70a03becb3c9d8f4ULL, 0x605d7d1a85934241ULL, 0x46040d66911a974aULL, 0x4e0ede7a6b7365d4ULL, 0xead5ee2a0a257d78ULL, 0xb77533011b59f5c4ULL, 0x4a86e7a5e02513e8ULL, 0x5e3c86506ba54c6dULL, 0xdd7bdda23fc96c0dULL, 0x97045006b024761bULL,
+        0xd7516bad0ba9ebc7ULL, 0x815aa36232b7e84fULL, 0x3c27f39bb0ebb947ULL, 0x22a8c15efc15ca97ULL, 0xd942574cbd746e48ULL, 0x8f38d2efbca09eedULL, 0xb82ef1ff777e2e7aULL, 0x7d2f6909a2322d38ULL, 0x22a2e664dd5a3a1dULL, 0xdc6140ca2523b80dULL, 0x12d1ea07e60d04eeULL, 0x69ff02e411003569ULL, 0x67774d45389e01f0ULL, 0x431f8dd48489a51aULL, 0x10b42f89de14216bULL, 0xf1777dee160d580aULL, 0xc6c4f4c1164500aaULL, 0x62a288db0cddda95ULL, 0xa23bdfa78df3a939ULL, 0x3209401249c8cfe6ULL, 0xa98ba12e8b201ef6ULL, 0xf9435f297bc5e37aULL, 0x916ca6c97e8e16d9ULL, 0xe9864d88941e2d09ULL, 0xa2c6dc4f76d11c40ULL, 0x75e2084ce94c7320ULL, 0xca65ee9ce57e75c0ULL, 0x9a055cb20fc2fa0aULL, 0xbfe2e63708643794ULL, 0x9bcb9036f55cb817ULL, 0xa365422b67609b46ULL, 0xc5f5d7359b0856d1ULL,
+        0x6f081c5e0ff794cfULL, 0xbf572e814513fb45ULL, 0x0d96a5f6fc92baceULL, 0x325d23f9a5f5d541ULL, 0xcea797ee87730398ULL, 0xf647320ad112b642ULL, 0x6f8e2eb7c9b7af43ULL, 0x9c7d047430d39b7dULL, 0x373181c4f3cd495dULL, 0xb33929ab54efcf0eULL, 0xb515b2253e45da54ULL, 0x917bb3de9166a39eULL, 0x5f540e9cdfbd9691ULL, 0xa5de24705d5effceULL, 0xf330f988576e6c82ULL, 0xf4726d383707dc14ULL, 0x29c8cc5770facda7ULL, 0xe4ed8a20d06da3f9ULL, 0xc00b5800c52ba6a0ULL, 0x289d7c0a5e3f0939ULL, 0x35abc859094b4e82ULL, 0x7ea2cc18aba11ad5ULL, 0x9f416b3d1625b260ULL, 0xf636f88beff47503ULL, 0x6e5dad3c70ea3869ULL, 0xd17f8469a8f6d961ULL, 0x72148ccaa7101176ULL, 0x1bab73a7077e0c32ULL, 0x8b89d5e967b89bffULL, 0xfb3de8b72264198eULL, 0xaa592952e7a23b2dULL, 0x7c4af6acf4a0ded4ULL,
+        0x2e92aa14a73de544ULL, 0xa4b74a0797e5e349ULL, 0x9f362a82db340813ULL, 0x20d6554656d468aeULL, 0x83855b733df54a95ULL, 0xec7b09621877bc1bULL, 0xf2671e1ac365d594ULL, 0xfd6cd0868a095b26ULL, 0xa44643e1a55b040eULL, 0x15e103b5b5cb53e9ULL, 0x15d0787fbbd67724ULL, 0xa68ef1196274d78eULL, 0x7b5d1f0d6e4ab7cbULL, 0xcd19d0526f4567fbULL, 0x8daffb89fab8abbeULL, 0x6303ee896f6c6dd2ULL, 0x524795ada731c532ULL, 0x414b3bd232c7a86fULL, 0xd637e70b44e7fdf3ULL, 0x8bb166e998737c1dULL, 0xdcbb4dd3073f03daULL, 0x8ccadac955e77f2dULL, 0xfedbae9e945f1317ULL, 0x280244e1e13a813aULL, 0xc53e4025a8ef8e45ULL, 0x3b66d4d81f1a50abULL, 0x533ac091041e3edaULL, 0x8e6e284e7534dde9ULL, 0x2a37cc30f0bef183ULL, 0xca66c322e20ddb6aULL, 0x4a1169e51a5c2925ULL, 0x8c4feed3f0d98dd5ULL,
+        0x71a14d3abf85f376ULL, 0x93c1d86d75bd5ef5ULL, 0x09832618a26f0488ULL, 0x04123f5f5dfe2349ULL, 0xa70d142e1f8bc41aULL, 0x34819ef7edee6080ULL, 0x08246f56f96349a2ULL, 0x41fb060e1ae807d2ULL, 0x0d308b151b71abd7ULL, 0xdb49825b0110ef52ULL, 0xad5848ffdd1c27d5ULL, 0xb85fbbfc1553628dULL, 0xdf2d182bf2e89738ULL, 0x4007af716dffc0a6ULL, 0x970426a7671f746fULL, 0xb618e20af645f761ULL, 0x9a7d8b7977c3c3ecULL, 0x8f0a4fa3fc1ad544ULL, 0xc5ef0facfa159da2ULL, 0x38230e173a2d9e5eULL, 0xd7a59a86fb9b111fULL, 0x197444036b9f89d9ULL, 0x312c482b4c111fcbULL, 0x323daaff47629132ULL, 0x0612f6c4346a3cd8ULL, 0x9619a32f8eb4ac84ULL, 0x182b4d94bf6353d9ULL, 0x70839c53a231ee66ULL, 0x6a832d5a7dcba865ULL, 0xa7cc1c5ed4dd6326ULL, 0x63c95fafdfc37678ULL, 0x6516d0035c0966fdULL,
+        0xeab3c6ec781b9ea8ULL, 0x34475d2a0ad7b052ULL, 0x6ee6542adda0cc3aULL, 0x848358559cb4e90dULL, 0x7682d9417d487387ULL, 0x9b4bd327dc87bc22ULL, 0x4b727734cf8b645fULL, 0xabe74a56626acff6ULL, 0xb0b0c19125a4ae72ULL, 0xa431e79554677c40ULL, 0xbbc079867ff8af0fULL, 0x4150bf124d7ca746ULL, 0x54065de03e51c1e3ULL, 0x56bd9975d612aa95ULL, 0xeb1de5a8497edbb5ULL, 0x9f6bec21c7d25b2dULL, 0xc8429470bca60859ULL, 0xf32159d4cf078b66ULL, 0x33e08f0a1daf5fb3ULL, 0x6c19f19aa0dc051fULL, 0x9d1da415ee68fc32ULL, 0x8efc538eb3be2e57ULL, 0x2ea3cde2d53d7dbfULL, 0x563977f4817e5dbeULL, 0xd09173732d43e984ULL, 0x9278d17e8100bc7bULL, 0x33011165ad29c520ULL, 0xb7482c0410bf175cULL, 0x7d4361b502ab9375ULL, 0x48f75f675b4362f0ULL, 0x3c183c2ee34f6409ULL, 0xb37863392ab14da4ULL,
+        0x72dc352c4af01291ULL, 0x163025deaab78d67ULL, 0xd6b219f6c37c67ceULL, 0x6b325f1c523fc6afULL, 0x9bf91de1422d7316ULL, 0xdf23327b12fc6818ULL, 0x635aca3909877615ULL, 0xf2cd38329d56510bULL, 0x83d6db66ae9cf8ecULL, 0x591198b94bf2b023ULL, 0x28d9c546c4871d4fULL, 0x11a50a5e1683b0e1ULL, 0xbcb68dbe4d1eb3b8ULL, 0x8f41694f0dbe2573ULL, 0xe2df76d27481a649ULL, 0x2e9a8154c841c29cULL, 0x20409932bbef7492ULL, 0x3eead84a2e11d69aULL, 0x484706df4709730eULL, 0xa10928a6c6524cf1ULL, 0xb97baeb5ebe098d0ULL, 0x2deccaaaaf73c66dULL, 0xba274cfc82e0516eULL, 0xac3af8c1d720dde8ULL, 0xaade180647bad716ULL, 0x40224228c4cc04e3ULL, 0x95d495431396d646ULL, 0xe3c8ad6e43b66f27ULL, 0x2514dd6fe2a31c0cULL, 0x3ed26662a1cc9669ULL, 0x75f5239c31b05cecULL, 0xf456eb92f24ae5f2ULL,
+        0x90da96473e1e2292ULL, 0xf0b10441cf0c483dULL, 0x944bf2c077f3cf1eULL, 0x1d6156def06008eaULL, 0xf5c749f2bfa7ce6bULL, 0x23a29f29f840c549ULL, 0x1dba0da4a469b99bULL, 0x16190a8e5195e305ULL, 0xd93d71c3ca690b14ULL, 0xcb6f5b8b0502715dULL, 0xf5be79aedd59f3c5ULL, 0x79d4a10f0674cf2cULL, 0xf1652b961faaae2aULL, 0x27accbb6292c1667ULL, 0x80cd3e231dcf9f88ULL, 0x3fd2384f72a03bc7ULL, 0x907385471fce07bbULL, 0x57f4f3d08c4cade6ULL, 0x14307fbb5462dfadULL, 0x277d1f5165c35a9aULL, 0x5f4058e36e104c0fULL, 0x9d97c965e2da1b59ULL, 0x1d2c35a014cb3ad6ULL, 0xf43f8ba3060fb4e4ULL, 0xf065a050cea6ddddULL, 0x0b09746644f29833ULL, 0xaace7742ad3c0ce3ULL, 0x60cbd71c8c43f448ULL, 0xc27cd5a7bc3944c2ULL, 0x6379aa43f5f559dfULL, 0x68a0710484a24772ULL, 0x26475841e7601569ULL,
+        0xaba522acc6df9d7aULL, 0x7f4f11742395b466ULL, 0xec21b8a7dd2f6919ULL, 0xa9b2db552a770b47ULL, 0x1c9873f7286c207eULL, 0x5a6ee68019968495ULL, 0x289afa970504f484ULL, 0xc3c5dcd9fa7c0d5eULL, 0x607cc002d18245a3ULL, 0x26cddad9e7c238beULL, 0xfe4de1282ec20c47ULL, 0x523fb50adef66608ULL, 0x596671783ffc09c1ULL, 0x0cace53447f90b85ULL, 0x06c912af5bcf4ad4ULL, 0x65bace9db3f2d9c5ULL, 0x767e377b41374e00ULL, 0xcec1e7be1c2dad54ULL, 0xf33cc870e2a860f1ULL, 0x9dcc0dbe38582dadULL, 0xa27ddd6044b955bcULL, 0xa2727cbb11924b0cULL, 0x3b92e5d14946d539ULL, 0xee95a555eb1776d0ULL, 0xdbc42ca42913e80cULL, 0x4c5328cf7a4b1aefULL, 0x7985b2b2404f7b95ULL, 0xf191867060f924e3ULL, 0xeb70de2bfc09bec6ULL, 0xae7046103e6a67c8ULL, 0xfcb349e4b0ac93f1ULL, 0x2a77a90c83884d5aULL,
+        0x22728ca70e85eb09ULL, 0xdb8578268e845de8ULL, 0xd489272e4626c87fULL, 0x5bd549f0ceec0374ULL, 0x87122d25620f2ea4ULL, 0x13b154b7976ea28cULL, 0x28f3da3cc2ed8334ULL, 0x80e05eabdf320fb3ULL, 0x663281f95af23a9aULL, 0x22da1ec307f7ba51ULL, 0xa887879fa57bcae3ULL, 0xa9e348a2b38bb27cULL, 0xb271600cfb616071ULL, 0x8abb40c2a62c8d76ULL, 0xfa5a91138a49d69fULL, 0x0aa1ea2e95d533d0ULL, 0x6abeabb0bed4e623ULL, 0x4185ded371fec789ULL, 0x93fde20a0e748ea3ULL, 0xef3ce8e585b41dcaULL, 0xe89f6a97b0979736ULL, 0xe83dcfcb2d2471afULL, 0x5a22cab361f6edeaULL, 0x6cce21792350cc5cULL, 0x33b5dc0889ca725eULL, 0xc65e6bff7f7cb112ULL, 0x135191d8ab8fcdb2ULL, 0x5f91196ee5c27d25ULL, 0x081fcec4d25c7a59ULL, 0xbe630991d0e8204fULL, 0xa47800eb8ef80816ULL, 0xad4ff14df5156a9dULL,
+        0xc3bde4b3f5398a11ULL, 0x51eba40e2ece14dcULL, 0xf108644cf9a856dbULL, 0xbd5e5d93cf090ebcULL, 0x78731c8400449978ULL, 0xf9f800389563b496ULL, 0x492664ff39980ee4ULL, 0xcc2206f7f6d68319ULL, 0x3cbadc1e6a49fba7ULL, 0x9a83837231db2b98ULL, 0x84a760bbb1cd9367ULL, 0x2aa444f2f9ea6a91ULL, 0xcab8f12f5e469011ULL, 0xd87ced325cf81690ULL, 0x911510bc92858243ULL, 0x368c2bedb30419edULL, 0x7814af5fe88c7f8cULL, 0x98234354bce2cc47ULL, 0xd427534c1f246e6cULL, 0x0a166ee467c2919fULL, 0x611d625763ac1b0cULL, 0x6536780059262e87ULL, 0x81db3f68351128abULL, 0x51993707d5924786ULL, 0x7efe5978923ae149ULL, 0x1862aeeb85f7bfb1ULL, 0x40c8e1f80d0d627aULL, 0x96716f14163b8040ULL, 0xbd344761f8604718ULL, 0xa90b0bb9521024c8ULL, 0x7d1afa44ad6910a3ULL, 0x699ea08bddecdf59ULL,
+        0x65e372ea6882de9dULL, 0xe3dd7066ff9dc9d4ULL, 0xc920f4eea8a80bc3ULL, 0xd45dba190f07fdd4ULL, 0x2223bb31ff7f7635ULL, 0x5f5feeeb9da9ef54ULL, 0x0cddb24736eb3f14ULL, 0xd1066b9a2d7f3a94ULL, 0x8666834ad4bb743eULL, 0xf4e019a92f8fa7a8ULL, 0x3fba241c8a031988ULL, 0x43a512562b0ad399ULL, 0xbaba989d7e5f50f9ULL, 0xf1bc6d9c2f57c106ULL, 0x42463829db3f9f0eULL, 0x2f93c16a33d0ef53ULL, 0x473090247ded99a7ULL, 0x58f951b45ac68e42ULL, 0xff074877c3120cebULL, 0x87c2b7ff75b35157ULL, 0x83d41e8d1c394b95ULL, 0x56c20e412eb95f22ULL, 0x7ae2314caaa1e9beULL, 0x79e2eced8886e8caULL, 0x7308c65e9735d4d7ULL, 0xe61117fe02426990ULL, 0x0dc13c6d856d275eULL, 0x839973207eafcad4ULL, 0x6ae6b98e4e3228b1ULL, 0xd444bc918a1c280dULL, 0x6d26ec8bfe60156bULL, 0xd8196d041c022a84ULL,
+        0xc7550f06c829445bULL, 0x3a657520203c53bbULL, 0x6e8d4c34560bb48cULL, 0x24dcc5255d9756c9ULL, 0xc1031de84a04002aULL, 0x299ed05a5d5659aeULL, 0x42e828aa8fe5ad21ULL, 0xc8b3e932b3b5b808ULL, 0xaccb66d4b0f12370ULL, 0x3d7a1454253613dfULL, 0x792b94b134a2c122ULL, 0x060dd67b1a975629ULL, 0xb620b24cbbedb432ULL, 0xb4ec652c716dec45ULL, 0x484647ac7ded13fbULL, 0x0cf0783ca4b76202ULL, 0xaa1013ef8d0be2b2ULL, 0xb133da5af5ed7afcULL, 0x97187b300fe8973eULL, 0x72927f81a1fae457ULL, 0x7836d1b1766bede5ULL, 0x5f292b9514896d99ULL, 0x6ccafc3e9267f54fULL, 0x957239886f732d17ULL, 0x75b1cf52c7db1499ULL, 0x1b6461ffb759c81cULL, 0x12c662ef91f5ceb5ULL, 0xb0eb6c726265a070ULL, 0xbf96138a81ed71f4ULL, 0x6fe935cc58d7b45bULL, 0x51184a21f781897dULL, 0x5ae6012eaa60a59cULL,
+        0x5204426bca266c40ULL, 0x1071eed479344f58ULL, 0x4be68e52e8cb1ffeULL, 0x556d38447f710c2dULL, 0x69adf3adcb424fceULL, 0x1247771cf1de10c9ULL, 0x5193f0d2d082ae92ULL, 0x50c82c01dbf02589ULL, 0xa013278b7fd00726ULL, 0x222eb836fcaa1f78ULL, 0xc8cdc30399acf69cULL, 0x4a2faffd90d42aa9ULL, 0x69ab57ab49231965ULL, 0x3da37ee933619d2aULL, 0xf45f6c210c2ca2daULL, 0x266004e015e54010ULL, 0x73da5943f948387cULL, 0x56759bc64a6b500bULL, 0xf52b5b068c2d814cULL, 0x7983947887167794ULL, 0x753dc9eabcc495f7ULL, 0xf9a84e69b599d43cULL, 0xdfe22f4dfa4e81d5ULL, 0x45e7900267510e9eULL, 0x4aaaa8086e34d9efULL, 0x2f0ef5ad68e8f32bULL, 0x2f255ec50f736409ULL, 0x304f8c6129b4a197ULL, 0x4744946ddb972942ULL, 0xd8528008b4b4a539ULL, 0x0062920c876f8fb0ULL, 0x968e3994bae0f34dULL,
+        0x4ac794fdedf54773ULL, 0xc9c8a3d0b846d77eULL, 0x349a5a54d875960aULL, 0xf2c34b11fb8368f4ULL, 0x4793e5246bf71105ULL, 0x8aa209bd7c3fe8cbULL, 0xd9e85ee7780061f9ULL, 0xb7035cf6d886c5f1ULL, 0xefaecbfd3d60d46dULL, 0x93dfe75364d5afadULL, 0xbde58eab5741e622ULL, 0x40f1a51bfb56bba3ULL, 0x3b25b8217c8442c4ULL, 0x68cf051cec363b3bULL, 0x80c1f7b7de286d4cULL, 0xd352d4dc1f6abc38ULL, 0x7a857d271638fa71ULL, 0x250097dca05e5558ULL, 0x67c751ff34aaf98aULL, 0x08bacb291aa235cfULL, 0xde2a7b6af5f2f51aULL, 0xbeee8f8e0328243dULL, 0xdd091cf7a0a84bcfULL, 0x9284daeee54809cbULL, 0xab3eebe58cb1f495ULL, 0x164a3c9b1b687d3bULL, 0x9718b690b325335eULL, 0x6bcc8ea4ec15bbd5ULL, 0xc68cc85153450f0cULL, 0xf66f21c10ce565eeULL, 0x9f35e8f4f714801dULL, 0x61f77db97a67dd0cULL,
+        0xe3d8c0a689b46e5aULL, 0xfaab4669b7919d19ULL, 0xa134b92460b178c3ULL, 0xf65ad109dbd17564ULL, 0xbc69faba0b06818cULL, 0x5335bb905fd14d77ULL, 0x75ebb3ed9a60fff3ULL, 0xabce91655e6d2645ULL, 0x3979f5c3e5ddcb23ULL, 0x26e0f03bfb532dc3ULL, 0xf0e70ed619dd9f66ULL, 0xea530916a6613533ULL, 0xca069b75a16eac1cULL, 0x773132f752220e85ULL, 0xe223c5a569d81b7dULL, 0x036a09e5ec221cb0ULL, 0x5ed0a3471bb307a9ULL, 0x682a0661cea2effaULL, 0xeb05c177f658e187ULL, 0x9d7734028924bdbeULL, 0x3f75c20fc2d9545dULL, 0xc997096c5480f6e2ULL, 0xfa2aee25aeb4470eULL, 0x131ec0a624f30964ULL, 0x5a720ae477f30914ULL, 0x9fcc1e09a2aa5383ULL, 0x0ee35a594e59e900ULL, 0x9a4440ed8ff49247ULL, 0x777671621b2d7ff6ULL, 0xd0589fd18365fc9bULL, 0xf251aeb9403d6121ULL, 0x173fec87f06ae28fULL,
+        0xf0d7bc07add7a96cULL, 0x0ab4bd3348b02617ULL, 0x9a7ccb8e30e7c43bULL, 0xf9c5cc95a0560289ULL, 0xa055668065b876ceULL, 0xa75630386896c244ULL, 0xed0ab68c902da2f3ULL, 0x8c61e1b2b0993fabULL, 0x42fac4b470b6841fULL, 0x3a28cbb1e7c67ac6ULL, 0xc7956243fde82566ULL, 0x8a7a0c9a58299faeULL, 0x51990cb1444de627ULL, 0x95e82e0907b34800ULL, 0x6c6d99254441a1a2ULL, 0xcf49d46f5bb8a55dULL, 0xac6fa0f9c350c77dULL, 0x48a8523347631b28ULL, 0xd143064da3185ba4ULL, 0x52b563d77cae46baULL, 0x6e33bc8d461855beULL, 0x310950a0e3daf5c7ULL, 0x4dc5da9716649f58ULL, 0xaa819b9aa711b040ULL, 0x94520f7cf095d67cULL, 0xbdd9b1917e3ad12eULL, 0xd32220a6af4aee08ULL, 0x60895499f1dd35a7ULL, 0x706afe4f6dcdc88bULL, 0xd2c06a1fb8ad1d6fULL, 0x5ba8ba141de671f4ULL, 0xa1f02f7f817471a7ULL,
+        0xd4f07044c5d13d21ULL, 0x9b984f563979a788ULL, 0xf04ba62766362d97ULL, 0x636e591d8141a71dULL, 0x7965a73ff3355e00ULL, 0x500a772c4b3746e9ULL, 0x63b1eb6401fcd653ULL, 0x102bfd16b6ec89bcULL, 0xecde30c7a7baef87ULL, 0xbcaf86373f3e119eULL, 0x4bdf13bf50b43d08ULL, 0x23ccb98448981e75ULL, 0xa82aa24a2846c346ULL, 0xd4f34f1f1ab06d3aULL, 0x841572a5ad2bdac0ULL, 0x9b9e5024663eb877ULL, 0x9c3ab088dbcaf871ULL, 0x7bf1e53be89b622bULL, 0x42cab94c616425a2ULL, 0x4e6050e95770eddcULL, 0x674874d67c16ca6cULL, 0xe993d1641e8c0d91ULL, 0xcd4e73c6eeaf8726ULL, 0x8c80e82ca2aa427fULL, 0xc36ad6ac8bcf52edULL, 0x0c18ed7ae3f425deULL, 0xc1dfd0179a3c7f05ULL, 0x42185411537b361bULL, 0x4a8cee7425896366ULL, 0x78e2263796b6b586ULL, 0x755e589bcc3eb57bULL, 0x86fad2caceefe6b8ULL,
+        0x4817945d3b449ec1ULL, 0xf68905255d953c04ULL, 0xa2028e88879e48b9ULL, 0x5f6e5db3f1b3fe39ULL, 0x8c1fa62e3c6a1a6bULL, 0xbd705e2406a03657ULL, 0xe1e9f5b81e312e2cULL, 0x72c6972bbb74996cULL, 0xaaaf573e390ad1e3ULL, 0x51d5dd2c2e02f885ULL, 0x28fe61c052051e0dULL, 0x4c656828fca3aba3ULL, 0x53672cbe65fabfb7ULL, 0x6fd7e3a82cc7e596ULL, 0x1b4e1ce73c20fd39ULL, 0xed472c8b74f15deaULL, 0x1a258446741a46e6ULL, 0x7efe18f3c6cf2af4ULL, 0x093959a13048c336ULL, 0xd82f58b075356c8dULL, 0xb09ad1a73d381501ULL, 0x75a2a7053c950aceULL, 0xee4f99218da7c281ULL, 0x6e791287e0201e29ULL, 0x6aa435b11e5969cfULL, 0x2c513efae16a581cULL, 0xe63c6207b20c5be8ULL, 0x964e093238b2d0c4ULL, 0x5e0839c6036f0fa4ULL, 0x4b8bf4d6b7fd49b4ULL, 0x25f96987be07c8a7ULL, 0x7ed8e46f730d646bULL,
+        0x946afc4f67dd0319ULL, 0x542c085486875112ULL, 0x159c39cbfc663dc4ULL, 0x1057191a64c9ed0cULL, 0xccd0eb76ed054a27ULL, 0xcc3e29df0f14a51cULL, 0x5ddf1789d7f243e2ULL, 0x3ac12f29d249df72ULL, 0x3c484845f631987cULL, 0x78d3190acd4064c9ULL, 0x189aa211dbc44a25ULL, 0x43ee59c3e095e32fULL, 0xbb5ac586bbc8120fULL, 0xab9a18a3e54ee614ULL, 0x70be1c8c85cca371ULL, 0x65da26b7e6fd869fULL, 0x33f66679d7847835ULL, 0xbf6a43a694a37c97ULL, 0xe6082ff75f905c51ULL, 0x030312dee521ecb6ULL, 0xdefc13f54e5e0905ULL, 0x1e7003c659efe35cULL, 0xe9875a9c83303dd6ULL, 0x3335841c1b81e39aULL, 0x9b0f0958d5508944ULL, 0x0019ff962c090746ULL, 0xa37b97cc22c2a2deULL, 0x43506bc2984c9acfULL, 0x0526ba39675aec2cULL, 0x4b563166767d553bULL, 0x8f5ea0481263535bULL, 0x48254680590e854eULL,
+        0xff50503ef8ca84c6ULL, 0x7a957cffc61e4f1dULL, 0xbb913b5b83930334ULL, 0x0f16e4e1e46682d3ULL, 0x0f60b528bc6751d8ULL, 0x258f316e25742238ULL, 0xfcf761d46dde7203ULL, 0x76913f79d6e27be4ULL, 0x6923b9745d8394d7ULL, 0x6d9682c06aacf4d3ULL, 0x8d17086faa6a09a6ULL, 0x4c65a2b2c59b680dULL, 0x418be8e56116a4b1ULL, 0xb32e76604b68896eULL, 0x6fc623c44fc4739fULL, 0x545c17b5d193c64dULL, 0x5cd69b68dc0d2f37ULL, 0x50ceb1cbb5ee0165ULL, 0xff01b8af68715634ULL, 0xfa94d590ddc2da7eULL, 0x17d9ac53f87c0000ULL, 0x4de9385b6fcf0abeULL, 0x4dcf329c682b04c3ULL, 0xc66c04c9e601a91cULL, 0x1748ea804bf090feULL, 0xdc32e87c7309e78dULL, 0xda781c3e28040e19ULL, 0x957ec722e4bf74b4ULL, 0x4b682d7856048f59ULL, 0x3b07f460f7b32daaULL, 0xa653369d3f230885ULL, 0x1935810ce1964b19ULL,
+        0x267a9546a4f1d084ULL, 0x142534c15f415056ULL, 0x623ffddd17b1bb3eULL, 0x78960d99a8c2826aULL, 0x8036924cf81a8ef2ULL, 0xf60f26b19195b052ULL, 0xb2ea393129ba1204ULL, 0xd2afb4896e9d3b40ULL, 0xa21e4ea13d05637eULL, 0x5333beab49d149e6ULL, 0xe8703083884a04b3ULL, 0x97085676c4d32c03ULL, 0x4760cbf0e60efc5dULL, 0xdbda7bef89e81e83ULL, 0xdfa9e32b0b9a89feULL, 0xda1da82309119603ULL, 0xcdfa9686314b946aULL, 0x7be76c1e017bb0aaULL, 0x311aae877f045517ULL, 0xd5551d3840951ca8ULL, 0x543a1406a67b6961ULL, 0x2700943480edd0b3ULL, 0x4980e5204c22be60ULL, 0x28f0077350f38116ULL, 0xffb04424afcade67ULL, 0xda42d4176f796071ULL, 0xdc97e9f22e5a69c1ULL, 0x6cb34afbb87897d3ULL, 0xc9617cb2ef359bd8ULL, 0xb2ee7b1ec55da620ULL, 0x141589f0c9fc9616ULL, 0xf5d361ee1d5a4b93ULL,
+        0xe1d388455246e07fULL, 0x6b09bbe23fe906faULL, 0x0f242a782b26b796ULL, 0xfbb9c5aec2b70605ULL, 0x6075e1a087ce2d5eULL, 0xd4277e1a53745dc5ULL, 0x4bd118704c4bc8e3ULL, 0x8a2aa9a965a355a1ULL, 0x65abf52e617008d3ULL, 0xe6afd9f171159332ULL, 0x47884a44ca8f3ac9ULL, 0x0691f066e3f4761eULL, 0x0d3a1368ef8ad17aULL, 0x61ba3caadb7726a1ULL, 0x41e00ee31c96c8ccULL, 0x001f60ecfcefc9c9ULL, 0x9e2793af3e93c51bULL, 0xbf5702734fb842a4ULL, 0x7ab19982f69b9678ULL, 0x5c6ceaca758cf5baULL, 0xc3bc4d7e24a7de5fULL, 0x8e8691efa1466449ULL, 0xac199fdfd9df9287ULL, 0x3a6f327c80a85e59ULL, 0x558bc4d6af653756ULL, 0xeff34b8172ceaac4ULL, 0x3a20beb938270533ULL, 0x5cb8d605ffe3c3a4ULL, 0xec31414cd35d7ed0ULL, 0xe2f2ab2a00bfddb0ULL, 0xfc911827530ffcb6ULL, 0x8c595577daeb56bdULL,
+        0x56ca4b3cf6e10b30ULL, 0x84f6bdda17fcc7bdULL, 0xb1fb0593af0328c1ULL, 0x7c13b4573721484aULL, 0x7b3321b594a5208eULL, 0xb4d1c2e9cf574b80ULL, 0xccfcebc3fef0b9d9ULL, 0x902c1f72007a568eULL, 0xda8e66dc35ed197aULL, 0xe897037ac7a09916ULL, 0x81050646bb24e1b0ULL, 0x5e416dd8715db29fULL, 0x1d6f8a935798917dULL, 0x574000f2eeaa0d77ULL, 0x122e5dd4628f5465ULL, 0xb467e9e99984ae86ULL, 0xfa9c4c78a8781649ULL, 0x3e86729ff60722c5ULL, 0xfde7b4ab1312b13aULL, 0x6aa922785a1e0ddaULL, 0x76b887557e281d23ULL, 0x68569e64b235e272ULL, 0xaa1eb91dbeb6cbbcULL, 0x9f53b3135cf525dcULL, 0xf06f31ccc8f92151ULL, 0x97906f1a3d231bd5ULL, 0x4222c8f170fa045bULL, 0x3f957438014aefceULL, 0x27345c35c0b9e87dULL, 0x5b58f233d6c99fd6ULL, 0xcfa27bef1bce0fbbULL, 0xc9495635edea40eaULL,
+        0x76600de1a6e3681dULL, 0xb5e1d61d5ef04745ULL, 0x51f646e5968f1c2cULL, 0x61aa14920a3d2d01ULL, 0x5b319f678fab9634ULL, 0x2764a08e23643213ULL, 0x2253326afc26c809ULL, 0x79a91e893bfc29fcULL, 0x44d4991bc6da70f1ULL, 0x97855605ab7d3e79ULL, 0x706b697cc60ff648ULL, 0x38516d7e5a449f52ULL, 0x409d5a2f88f96dcaULL, 0x93b71114ab8962a3ULL, 0x0b50a333138a3394ULL, 0x57ef6b69fa0f3fc2ULL, 0x7d30e0fe4e8f2521ULL, 0xe9e3b9713da98fb7ULL, 0xa179adfd75dc47d2ULL, 0x1eae969be14363dcULL, 0xa79e1658cc073fcaULL, 0xf1ef9c9fd551a09fULL, 0x4d4a66262e107c5aULL, 0xa7d0d2445aaaf36bULL, 0x97e66f19c8c4584fULL, 0x57fbc8db7eb6d545ULL, 0xfdcd280d3e4a33a6ULL, 0x235819c1050ac7c5ULL, 0xfdc7ba9ae9e68b16ULL, 0xf888a2346d9a525dULL, 0x9ad6c495d83510f3ULL, 0xeddbfa2d22f65f32ULL,
+        0xc355685b7f7bdee0ULL, 0x8332e3c0dc00621cULL, 0xc6f3a6fe8d22d3fbULL, 0x06e8e3a8bff9db21ULL, 0x18dbc31d08bc957bULL, 0x36c10d47c79b133eULL, 0xb22e58c94f922ddcULL, 0x190744d8c5667984ULL, 0xee6f977c6edba4aeULL, 0x66261894452494bfULL, 0x9b480402d79427acULL, 0x9abf93c1c51a5341ULL, 0xeea0830be5364a97ULL, 0xa92c3dd20b557c76ULL, 0x65b811976926beb5ULL, 0x110ecdb4dabf9414ULL, 0xe93075219a2c187dULL, 0x26dd3e2657b199dfULL, 0x236d9ee5200c5bd9ULL, 0x23cf9606adc64ddeULL, 0x747e1e0c578cc9e4ULL, 0x7b3de2bf8cd2974aULL, 0x421f20fc6221d191ULL, 0x2cfd8ebea628bb5eULL, 0x5af738ca42c8f104ULL, 0x940a0efebfc0d194ULL, 0xfebc138f85fd9076ULL, 0xd4506d518c275a97ULL, 0x52e7698baa20d602ULL, 0x7b7f7304cbcf5617ULL, 0x461488c35054cf1dULL, 0x27161948b72c56f0ULL,
+        0x7351d16041e6a677ULL, 0x18c30435f5fefcdbULL, 0x3435f803743b2885ULL, 0x0968152c4f492601ULL, 0x630ef7a5ca71e804ULL, 0x1a44e65087317789ULL, 0x2bcf228bb2fc338cULL, 0x398cbc04a633e17bULL, 0x9a945f6139a95633ULL, 0x1a71b1e1dd6b9839ULL, 0x1001bda6253251e7ULL, 0x208567b24f8246b6ULL, 0x266afa860b9ca31dULL, 0x76f2a701e555c88bULL, 0xabacd90b49ca5d5cULL, 0x3d74341d8b8c1d76ULL, 0x5ed26cee8b5382b1ULL, 0x7817c8b07cdb80c9ULL, 0x9abe99ec320d9dd6ULL, 0x847c20b643cc8fb2ULL, 0xeee12094fb0ec7f2ULL, 0x1dedbe33b561648dULL, 0xc2b229f0b571d031ULL, 0xc77c53c48a213bf0ULL, 0xdfbbc07039129dadULL, 0x4838c1238a067aaeULL, 0xec1a698f14fe0eecULL, 0x1911c51e5b4a88a0ULL, 0xe0eda0f4ef53137aULL, 0x41345c1e662ac511ULL, 0x7c5ca49c23cda179ULL, 0xb614751f1481ce8bULL,
+        0x3c71d07af268b4e6ULL, 0x4c627a7a74ca6022ULL, 0x83026d24d16ddfeaULL, 0x83cd2f3638493436ULL, 0x44e69293fab6795dULL, 0x80d841943a6534daULL, 0x37ee2604338745b0ULL, 0xec1de95f4fc57246ULL, 0xbb2198ab16d49a56ULL, 0x90df8c49d06ae502ULL, 0x38e7c7dec6ed6392ULL, 0xc349826b854c0de4ULL, 0xfc1bc3cd9c5731d8ULL, 0xe6066356b8f2d0ebULL, 0x235f92461678a685ULL, 0xb8c73271899a5de4ULL, 0x3c14666233ea0e99ULL, 0xe7480f21ceaad185ULL, 0x3ab6d3da5d24babdULL, 0x68477157d5aecbf0ULL, 0x36d035b4c79909bfULL, 0xd5623539fe8e9ca0ULL, 0x5705a0226de3a42aULL, 0x2b1ea96852193336ULL, 0xdc38fb77da5cf2ffULL, 0x245b1a2c57cc2690ULL, 0x41a8accc7ffc6803ULL, 0x6655694a33637fcdULL, 0x87899fe1cf11d5a1ULL, 0x394970fb64c47addULL, 0x170517f6e794db6dULL, 0x1a2e6586f662d825ULL,
+        0x1c892425829481efULL, 0x7560e07946648a3cULL, 0xcb46bc896a03a73fULL, 0xe1a941848ad50bc6ULL, 0xd4213090042cfae5ULL, 0xd8c8c0a19db7ef76ULL, 0x8077fd4f66363a6aULL, 0xf5a77ac6aaf1f83aULL, 0xbca3ce0580af4d06ULL, 0x3dad8fb2ed630d87ULL, 0x6b68c7fd562e2c6aULL, 0x5b625d133f5fbb05ULL, 0x6df4d18fb6c46deeULL, 0xe840141069316fc7ULL, 0x26ce2bcc5990eae4ULL, 0xb28f045bcd6ad75bULL, 0xb1c308bbb7a69a96ULL, 0x3868b22ff2b8c10fULL, 0x905929554096a078ULL, 0xde24f294f393e417ULL, 0x9163bd22c13e192eULL, 0x39247ae3a0969df3ULL, 0x0bc46fbbae4eb991ULL, 0x2b42b019ceb0269dULL, 0x8ff4aa7c865c1ae6ULL, 0x1e30c4c4fcf5204bULL, 0x7b0b9b1acc18a0f7ULL, 0xbfe93693cc7c61e7ULL, 0x177087bf917e4d48ULL, 0x6fdb76c7fda14501ULL, 0xf73d65a59c4b2e2cULL, 0xa6abb771a0bde651ULL,
+        0x489982ded1ba32feULL, 0x33a6fad338ccf90dULL, 0xe9224cc451a400b3ULL, 0xe619f05079361db7ULL, 0x93c8a671461ef686ULL, 0xe65cfabb3f9b1aebULL, 0xeeff058f24efff23ULL, 0x7ae3b81d159be2bfULL, 0xeb7b6ec296fd0138ULL, 0x544b002d322c379eULL, 0x0876541b96a8dcafULL, 0xf43ad0d05f91a97dULL, 0xe302883f1a3c8baeULL, 0x0f15479db5693395ULL, 0x161dbddee00061fdULL, 0x4d26234e8dfe3ac8ULL, 0x17be83aef1540e24ULL, 0xc794dbe2418d830aULL, 0x76aa4e87d103209aULL, 0xe960295dc9f9e38bULL, 0xe992d3439de42426ULL, 0xb91fc927b98a5c93ULL, 0xe419f7575783f0d2ULL, 0x0867d3c8109193f2ULL, 0x4d29de584acc13fdULL, 0x44a2f37e728ed676ULL, 0xd1463c27030d21a3ULL, 0x1415040c4f68a1bdULL, 0x58e3812271ba99dbULL, 0x363beca9e1d0f7e0ULL, 0x16eac419958e7bedULL, 0x52f63766809b0cb6ULL,
+        0x699d0057fa5a251cULL, 0xb9f275dcfb5c9565ULL, 0x8b0aa6c1c230c56eULL, 0xac894e35536dd7d6ULL, 0xc98e5c802c61e1a4ULL, 0xb160200c3ddb8880ULL, 0x26e8bf0d6d500119ULL, 0xc2fab8fa492b7f29ULL, 0xfa30669f5b8de4c5ULL, 0xb705bda6bf7b7bd7ULL, 0x0cab34f80ba89a48ULL, 0x13365a33fe8f6b0dULL, 0x696e1c0613726a4cULL, 0x6523e4524a17addbULL, 0x1abb8d469fceeb11ULL, 0x65f43ad925abfe39ULL, 0x2fb1af57ebd10165ULL, 0x1b4e6a1b2a00cc7dULL, 0x61bdbf60aa1ef2c5ULL, 0x70b7d936ac8bccf5ULL, 0xec3db7eff86ec577ULL, 0x921449f934c6d817ULL, 0x3457a0dffaf9ef8dULL, 0x4abdfee3426df84dULL, 0x5b8a3c96b5ec4462ULL, 0xdbc7cc11e727c96bULL, 0x14d5373ae7fa3a79ULL, 0x88eedca0acaf6d77ULL, 0x294d76eadc148579ULL, 0x56dfcc847e9334e5ULL, 0x9b125978b42ef6bcULL, 0xc4a2fc3cb93fdbbeULL,
+        0x359b587b6fe2a474ULL, 0xd0478c1ac5fc0c64ULL, 0xc03c3cc03b5859c7ULL, 0x36c59455343c3d9bULL, 0x4ae877084f6ff031ULL, 0x54769f91d9a04397ULL, 0x1476477a88cac3c4ULL, 0xa4e81553dd31aff5ULL, 0x1153ecda3ed0a29aULL, 0xd0d54938332d613dULL, 0xfebe10427225213cULL, 0xf6de6800ceda8c18ULL, 0x4628da3f51ff1fa9ULL, 0xd901aa093b278ab3ULL, 0xfde7ba2a35655088ULL, 0x10c82946efe3d5dfULL, 0x168e586dfcc7a5a4ULL, 0xc143f4310b063609ULL, 0x3f73faa815b7cd08ULL, 0x8d7be2fe069c310eULL, 0xf91155869098e89dULL, 0x93b6785336ae72b8ULL, 0x80059d864d7d6ec3ULL, 0xf5b8c1391a6be899ULL, 0xdba6b46c5c25d381ULL, 0x7d9b03b21ab2ece0ULL, 0xe8b1fc2d9cd7dc25ULL, 0x9531a1bbc7268b36ULL, 0x75c55d6c05290074ULL, 0xfbc6284d84eadef0ULL, 0x918649721afc2a70ULL, 0x11a254ceab5d7a2aULL,
+        0xc48b5803458470cfULL, 0x3e9e07090edeb8dfULL, 0xc33dc4bc3b0e1f4bULL, 0xc724d75f0771a2c4ULL, 0x25c1a21afcec455cULL, 0xda5436a938047ae8ULL, 0x73b6460e75b7ffe8ULL, 0xa8ad26064e6127edULL, 0x1191115c80165205ULL, 0xdf4b16a600146b7cULL, 0x6acc08e813f934feULL, 0xa85dc6d7878b65d8ULL, 0x3f5c402e25c5e8cbULL, 0x6588a3aa4718efd9ULL, 0xb622087ef1448bc6ULL, 0xf3cb0382f6bb6ec6ULL, 0x813ef009e5fda496ULL, 0xf1699b75b0109c4cULL, 0xd45fc6d013504458ULL, 0xe79dd517a38669fdULL, 0x1581a246e9746fbeULL, 0xa7750b7f0d7ba23fULL, 0x4ae2787437dc7e2fULL, 0xbf0a55d799d33686ULL, 0x2c7be4195f5162c8ULL, 0x138d0267a916371dULL, 0x1187e33993c931eeULL, 0xce606d6bf2bd0924ULL, 0xea095fbd43e2043cULL, 0xd55f154c456f1d5aULL, 0xc96d50d8b05d578bULL, 0x3d2b1317897a80cdULL,
+        0xf078ed5d5cd21243ULL, 0xcb406073b831bbfaULL, 0x61d0e4f310b87a76ULL, 0x43cd4e4201a36f53ULL, 0x6f532364479b9d8cULL, 0xc438a13402bd1fb8ULL, 0x4e7bc7bd5b60a41cULL, 0x40843c7af2fef30dULL, 0xe0eb1be1a641e063ULL, 0x113889a6fd1e37e3ULL, 0xb29f7b81f834ab53ULL, 0xc90a4097bc520739ULL, 0xfeb5f315a714f4d9ULL, 0x24cc850d78a2e173ULL, 0x994c8876736f6346ULL, 0x0be612d9b0055153ULL, 0x2abb278688682fceULL, 0x23cacc74f7e959feULL, 0x760916fd0bbae8eeULL, 0x45adbc45bddb5a0cULL, 0x3d697c341c70791cULL, 0xd3d347fa67a29a3eULL, 0x8b5561e04c35d868ULL, 0xb78a0c822aceedd8ULL, 0xe7c51916c64b47b7ULL, 0xe15a4d7e1221b5abULL, 0x5288a5e66b362791ULL, 0xcb34c767810a2bc0ULL, 0x7aa28ce5cfbdf0ffULL, 0x18db4e2c6afead87ULL, 0xeb10d4ce4c49162bULL, 0x46d91e422c3b3312ULL,
+        0x23cc13efebfb56b4ULL, 0x83c7f2d24d5b3370ULL, 0x916cb04297954abbULL, 0x2117d608468f18f2ULL, 0x320e53d94c3a9509ULL, 0xc2f0bdfaca6cd916ULL, 0x385daf1044c622feULL, 0xeaadefdaaa1f3f84ULL, 0x899c42a1a3d945e3ULL, 0x16b5ae21fed215b8ULL, 0x39056f98c354ffeeULL, 0x717984f2d6816ed5ULL, 0x8277eea77a124b55ULL, 0x7e2925e8a77f781dULL, 0xe31ecf400ae9fb6bULL, 0xb524ad7d8a909abdULL, 0xe1712914f2fbdd33ULL, 0xcd53dd24aa6e7728ULL, 0xcbcb6fbc26652de3ULL, 0x5fb233e617439160ULL, 0xe84113747eb82e6aULL, 0xfbc942e6512eb56dULL, 0x1f39e94e475ed414ULL, 0x7439a20c018b0e56ULL, 0x86299154a5a25c7eULL, 0x735239e6c6da3c2bULL, 0xdde6ba300a0882c3ULL, 0x45e8b4c0ceeb49b6ULL, 0xcc5192bb283092acULL, 0x8e6dc8c7e49f1ad7ULL, 0x822319497e579a4eULL, 0xbf0e51fdd6015ef1ULL,
+        0x007def82a7c89a17ULL, 0xf376272d5e87bb32ULL, 0x43d3ce7fa2ff1b28ULL, 0xfe6f39218f4374b4ULL, 0x29efe2be4e2fff03ULL, 0xa653fba9e6f6cd2dULL, 0xddaa4f0a16307d3fULL, 0x9eb319d41be14932ULL, 0xfffb8d0c0f6940e5ULL, 0x977332b124da8651ULL, 0x4234f910bfc1c4b3ULL, 0x81d15b126f9cf6adULL, 0x679d6b592eec2a1bULL, 0x3594d35c0fdd4f85ULL, 0xc176e38545185cffULL, 0x269511ebc8f1ea71ULL, 0x39d9cd1d33bcba83ULL, 0xd6fc4051ef118494ULL, 0xa3b27701e23b264aULL, 0x7ffbf8cffa87e974ULL, 0xc6e4d26e930b9785ULL, 0x5f1efdedab557b23ULL, 0xb0e2a6249c946eedULL, 0x200bc073cdd07208ULL, 0xdbf9d88df0ee8f6dULL, 0x8a40627477945421ULL, 0x9140ebfe13de6b82ULL, 0xd9376b31f85980bfULL, 0xa772385ac195ed84ULL, 0xc210a9f32bb0e3f8ULL, 0x6ba02c4cc7c3e9d2ULL, 0x11a0681f599a6fc1ULL,
+        0xe97569bfe890a3f0ULL, 0xce9fc4310fb1591eULL, 0x3174f8552452dba9ULL, 0x1809060dd181a61dULL, 0x9eaa07d024866e0aULL, 0x5f45ca49c15a1e82ULL, 0xb36043ac272707ccULL, 0x4eb6948ccd127fedULL, 0x0f7cbc39744fc1f0ULL, 0xea292cf4a37a5f76ULL, 0xedb3946396898d5eULL, 0xfc162901336f4f5aULL, 0xeaa71962430292edULL, 0xfe43d39157121f40ULL, 0xcc378930dca075abULL, 0x42826addbabab11fULL, 0xc26c32fe5f9ab6d6ULL, 0x78daaf2516ea1cbaULL, 0xd379b3c64c2c2f3aULL, 0xbd36a3e46682d010ULL, 0x48c7357aefed33caULL, 0x158eb35f91aa38d1ULL, 0x29e08c8ac5f80be5ULL, 0x3c5fdc0190abab45ULL, 0xe27b55bb18497cb1ULL, 0x8db376a4e4475e57ULL, 0xe96ae198718f7fdbULL, 0x089ec3f373fd3b67ULL, 0x50572f243c586198ULL, 0xb2e668aaf394d0a1ULL, 0xd036373c72cb3dd6ULL, 0x66665266827bb281ULL,
+        0xbb917761a180523aULL, 0x5165561e31578681ULL, 0xd486b76be9447e84ULL, 0x16ae6c52f505334fULL, 0xb15c388131f457d4ULL, 0x8078923f6c24f300ULL, 0xa168a0ef2e06e633ULL, 0x447a7ad79adb6b15ULL, 0x0007d3eeba1a1135ULL, 0x22d1b173a0c07ae3ULL, 0x0472cc398cbaf321ULL, 0xe4d8b07955712f91ULL, 0xbdc4bdfd7708788eULL, 0x8a7474e47cfca9e4ULL, 0x9ff5e6fac0e5149bULL, 0x66df9e1d3313300cULL, 0xf0027302d33aa3d0ULL, 0x9f90e535d78e12ffULL, 0xf67f424308dab93cULL, 0xa9febd83334838a8ULL, 0xafa29fb10de49ca5ULL, 0x40ac1f55ce6dfebbULL, 0x78a3e0e58e7f5ee5ULL, 0x9e6dec63396e796aULL, 0x104b857fd757dcc2ULL, 0xa0329142b307f404ULL, 0xbc7bcb248ebe7dfdULL, 0x6286021d1366e549ULL, 0x3e3c761d8496449bULL, 0x115b6a2d422239a1ULL, 0xe9483312f7f640b3ULL, 0x38e3864450d5b554ULL,
+        0x0a9793af6e1772dfULL, 0x5a6400dccc11334fULL, 0xc2ecfbb0e7a84586ULL, 0x051827dcfa1cc244ULL, 0x53669826695065d2ULL, 0x458308a5bc8f6e07ULL, 0xe3ef5ebf25c8d498ULL, 0x975acfdd3cdf14c8ULL, 0x0c3e8efb2980426aULL, 0x87067c0b0133bacaULL, 0x861504642bdc96e0ULL, 0x113395457a654575ULL, 0x2e603920989d7855ULL, 0x27e00e60e2482714ULL, 0xa025418f213c2e91ULL, 0x8d3062a92d1d005fULL, 0x6913bb107f88686dULL, 0xec24324b46191696ULL, 0x0518806cb3b85b77ULL, 0xeac4e0a92aec48a3ULL, 0x8203c24880a6d978ULL, 0x314bfef0f793ba20ULL, 0xada31929b0426cf2ULL, 0xd56c47fb817519b0ULL, 0x0feaf2ba8a8fdfc8ULL, 0x9dadb58aee6e5a9cULL, 0x653f38289e7c95e9ULL, 0xcddaaf390b3e5c3cULL, 0xa14292a62cb70658ULL, 0xe5c5e3ff0c7cea0aULL, 0x28a25fcf66aa712eULL, 0x61cc2ef6208d7fd2ULL,
+        0xed66ec2d1a06e4d0ULL, 0xefd57be7394b7339ULL, 0x22c37fcf7a097607ULL, 0x83b7606116684699ULL, 0xb1f67c6b95e50676ULL, 0x82b9c8dfe58d2ab3ULL, 0x99e45dab8972b5b0ULL, 0x68d5c58a558105beULL, 0x3ce3470c7f4492aaULL, 0xb22f7f73829340bfULL, 0x1d64869d9c500780ULL, 0x609712a3a25c478aULL, 0x5be87ec7242b4cecULL, 0xd7cb20675ff76b9bULL, 0xfc8cc6720ae3bc8fULL, 0xd7236e604e1230b8ULL, 0xc8a3d530fa813251ULL, 0x6619f3aa07c3c0adULL, 0x1242943802def7fcULL, 0x8739780d57e9ec78ULL, 0xb0ee0bf9f8842fe8ULL, 0xb26b3ad3d59d9e6aULL, 0x6d0b3e60aa21baf7ULL, 0x9de304f0a13b2729ULL, 0xb772ff20d92a8b9eULL, 0x3e6fa04880025ea8ULL, 0x52771eb404df0abaULL, 0x9ab166fcdb43bfaeULL, 0x8e6f0a47efd7e7e9ULL, 0x227c0f055a7e7086ULL, 0xdca4df60fc2fb0f1ULL, 0x1904ef0894d29f7bULL,
+        0x7f85017be6b73708ULL, 0x0602050c288b7958ULL, 0x85ce7aa4e87bc965ULL, 0xa4bc86b3d651b3a8ULL, 0x41ec495c57b84503ULL, 0xb60b893a6060c4e9ULL, 0xd298575dedbeadafULL, 0x5e22c7f960340d9eULL, 0x0492054be1c9fce2ULL, 0xf146de84ffe3ffb1ULL, 0x57be8dfceb331b61ULL, 0x06b03237fa354e54ULL, 0xc4cbb201f7c3e7a2ULL, 0xd1a6d168bf49743bULL, 0x2e89180945adff46ULL, 0x36fa08cfafbb84c7ULL, 0x9f3841efca5a7919ULL, 0x5d467619a1b7e1d2ULL, 0x9da5a005bc5db37fULL, 0xa3e5b48d34879dc2ULL, 0x17a0d377011dc7f0ULL, 0x40348ed02eac3e94ULL, 0xc65d6b3ef35f9fdeULL, 0xa46601f45d598dc9ULL, 0x8a513d1a04b95ed8ULL, 0x6c633e97f76d7ee9ULL, 0x5f59599cd68a617bULL, 0xc33a0bd050be0b0aULL, 0x368096f976a56ef8ULL, 0xa49d6587cd60e275ULL, 0xcf215589698b33e5ULL, 0xe79cb0e6ae223a85ULL,
+        0x2508ed9d8a20fdc6ULL, 0x07f919ebb144e488ULL, 0x562ae4b070ff8192ULL, 0x2c4635cf839d162aULL, 0x3edd39b24903b6dfULL, 0x6a9eedd6cd94476aULL, 0x79cfa978ce17126cULL, 0x595768286086a0d0ULL, 0xf5cfd00fa382a25fULL, 0xe1804892784063a0ULL, 0x6edca9602cab5defULL, 0x781ebde8a777aff3ULL, 0xcb981f104432e064ULL, 0x16d066ca8cc76aecULL, 0x3a25721da1cdc1b9ULL, 0x654ac45fefd37a6aULL, 0x4bc57d0e43e1c38cULL, 0xf67920f1b64118aaULL, 0x8ae7dd93097a43e0ULL, 0xd40af60c267203e2ULL, 0x37f96e0c52d7ae5bULL, 0x74b916ca684da56eULL, 0x1464df2f38657905ULL, 0xbcf9da8d75a810bcULL, 0x2ed1cbfce35a993cULL, 0xbf2d7e1d8d41f6e1ULL, 0xe402ffbef3a26423ULL, 0x1fb7838d41527c36ULL, 0xde81577ca8475131ULL, 0x16061bba6766c221ULL, 0xff08e6d94b46b906ULL, 0xcce0747c4d304402ULL,
+        0x9d784b4eb0d46690ULL, 0xc1a3d609b035e598ULL, 0xb702fbff1ee77ef4ULL, 0xb38a07a664556fb3ULL, 0x1f9b706bdab9644cULL, 0x8f30d1ebc7e7b180ULL, 0x42a20c6dfcf4e2adULL, 0x4bac2cbb7dae2310ULL, 0x2f05dcdb061272e2ULL, 0x6cca2647781760fdULL, 0x50c41d23131dad15ULL, 0x92d0e52aaef6b1aaULL, 0x1a5eea0eb6d94fafULL, 0xa6952955294ee4e7ULL, 0xc9945e5d36cf256dULL, 0x5f5b92e9a4f56711ULL, 0xe063a80b2ec97425ULL, 0x96a0cd22c0422523ULL, 0xd667749f78be54fbULL, 0xb6a1e5fe152a7173ULL, 0x531338b1b27f2eb8ULL, 0x00271e9ed0d92788ULL, 0x5c2af013cdca75f6ULL, 0x7561b74cc4b5a28cULL, 0xea1b6e6e0bc23e3aULL, 0x37dc989e7822bf74ULL, 0x4e531512d66b4076ULL, 0xaf9d5b22f8ca40b4ULL, 0xae2422b08634aeffULL, 0xd66c3a2760230414ULL, 0xb62e87157ba03e8dULL, 0xbca9600ac7b7c794ULL,
+        0xfd846ea7a4970ebaULL, 0x4e6cd0cff65b17e2ULL, 0x2faec871c3207315ULL, 0x65ac4b75e81e6c95ULL, 0x00bef893f4f74e1bULL, 0xa35def0b709cf84cULL, 0x6276d11def7112c4ULL, 0x29e5960cc6a42a09ULL, 0xcd3acab7150f4703ULL, 0xbb461e4695cf1a21ULL, 0x8177d03058705962ULL, 0xbc40db1967278bdbULL, 0xd49d644ca790a96fULL, 0xda255f36e8186ac4ULL, 0x86a285dc22e70bceULL, 0x1f013cca018acbc9ULL, 0xb852c8084ea2a8f4ULL, 0x3b10728188377201ULL, 0x7c5f02b5444a5998ULL, 0xa903f9f5637c9627ULL, 0x98880cf11c1dddd8ULL, 0x886431aa2f9fe1eaULL, 0x0520d289c4b6220fULL, 0x48397607b92f9557ULL, 0x7a3a9e99bb4786fcULL, 0x2968ce8cad860f30ULL, 0xa6e95007fe6a61dbULL, 0x25aba0e61b6fdf21ULL, 0xac35d87e25fe8500ULL, 0x85f621cea50384a3ULL, 0xfb934577e610fef0ULL, 0x920daea6d1695738ULL,
+        0x245103d14a983adbULL, 0xc25a29360cf9bd63ULL, 0xef4c55194ee8c09eULL, 0xe71657b6ac400539ULL, 0x338d4e907b5b58fcULL, 0x623a2c53b92cb879ULL, 0x5cd3f7109bceb751ULL, 0xca77f4131c887b44ULL, 0x02af4336b93058c6ULL, 0x178d38a899e28a3dULL, 0xf290fee6108b8a24ULL, 0x4050b08fa544a8b6ULL, 0x427863f1e950326bULL, 0x59566431af00dedbULL, 0x8eaf708c57b08b8dULL, 0x6400fcfc29be5c78ULL, 0x7f00c180890676d7ULL, 0x495f45d447d8a95fULL, 0x714c9e13679278a2ULL, 0xe01d773b22f54829ULL, 0x2e99efa896d25c57ULL, 0xc654e1b9508e0fa4ULL, 0x97dd1e939988afc0ULL, 0xfd8308c5e3881e49ULL, 0xa694e36a185c808cULL, 0x326c9f1dc07554e8ULL, 0xc7afa9c9f481aee1ULL, 0x104adc8849a32624ULL, 0x838e1dc5cd9eb9f8ULL, 0xbe6e97fba6be27e2ULL, 0xb9533e81dbbb2431ULL, 0xa21ef2cc4a838c55ULL,
+        0x38eb25a2ec72f7d3ULL, 0x08fd4d9300ddee80ULL, 0x958fc9f1780e6ab8ULL, 0x494777ada14cd4f4ULL, 0x40e3d83fd30c640cULL, 0x594301fe39cd15b9ULL, 0x93babf19de87322dULL, 0xb164e4c96a181136ULL, 0x9f5ac893e46fab0aULL, 0x25c87b7ca02a8bd1ULL, 0x5ccc9b49708cb281ULL, 0xa691cedefcb41b48ULL, 0x1868448cb4a30465ULL, 0x2b96f5fe48dc1adbULL, 0x13d54fb70799ea5fULL, 0xda981c2d7f6990a4ULL, 0x3f4fb96a76677e9bULL, 0xbf7ee1c8e5c678c1ULL, 0x8ca01fdac58ee953ULL, 0x22cc8e455f54b006ULL, 0x87ca45ceccc8fd0cULL, 0xd0054d78da4dd06fULL, 0xa05d062206490641ULL, 0x96555b07c8d42858ULL, 0x3ee0c3c21d0c0034ULL, 0xc936763386af750eULL, 0x37b032462992000cULL, 0xb87813dace3ef42cULL, 0x50a1f28883faadb4ULL, 0xe7d2678272a0e482ULL, 0xc0d58b94e0637247ULL, 0xfd740816aef9273eULL,
+        0xaebc975db8acdb61ULL, 0x61bfa94dc2b37102ULL, 0x332f81fe6cbdd580ULL, 0xa2491818cf417f1fULL, 0xe3f6ae15b430d91fULL, 0x8a3b1c419e4ba8f2ULL, 0x47d4e95a13ae8273ULL, 0x2182568342ce5294ULL, 0x91a9e597014dfc58ULL, 0x9cb9b1b9901cfb6fULL, 0x9a523e94f5c5d019ULL, 0xc99ae29f467ae1deULL, 0x77579e5f5ffece31ULL, 0x3123df7467ccea31ULL, 0xdf64bd0571840185ULL, 0x3b27b1ec13f93a43ULL, 0x225c73cec3dade04ULL, 0x1311329c940c5187ULL, 0x78d4517b40217893ULL, 0x63c7a0175a97425fULL, 0xc0ac465b707110a8ULL, 0x719a13d100265fadULL, 0xb4a6e92dc9458440ULL, 0x8b67b762f061a0b8ULL, 0x6a540ddab7d2ecafULL, 0x3285c7869ac1a7e2ULL, 0x497c2cca2232bc22ULL, 0x784cf6273736f6e1ULL, 0xab9b52d0c350e5c4ULL, 0x470ccb5e744b1436ULL, 0xea4e7dc63d8b65f9ULL, 0x80277bb1789b2a89ULL,
+        0xe59bad08863a8447ULL, 0xf4220975b1bd48aeULL, 0x8284a4bba0e11c16ULL, 0x482146e6eed7b12bULL, 0x816e41a68729e106ULL, 0xecdba4eb2935b59aULL, 0xedb97d904cacd039ULL, 0x471d776c781eafc9ULL, 0x3f933842aac51a41ULL, 0x8df48a66c485e72bULL, 0x0723962b3118d23bULL, 0xdd7500d04bbda4d7ULL, 0xbd3b6c4a6c268dccULL, 0x71155202d0372aa0ULL, 0xbe542dd6ae0598d2ULL, 0x1ffbfc4c4797c731ULL, 0x4d7016b4db2ccc17ULL, 0x0b2810c4eea4851fULL, 0x82db120f18c2aafaULL, 0x3682e55a7bb005efULL, 0x41a3f621ab1efe02ULL, 0x3cfd112af366da0bULL, 0x3724083f6fbe7283ULL, 0x5020d4c2a7ab8a9aULL, 0x319ccb4353b2ca00ULL, 0x50b8feb9680515bfULL, 0xb86b2b88d62d75f4ULL, 0x7d36bd17caf81b73ULL, 0xc9a66810e691e515ULL, 0xaca50e5d7805a3d8ULL, 0xac2c22124124ddf2ULL, 0x1198825a6bcbbad2ULL,
+        0x628b9aea7d522a43ULL, 0xa922256e3842e622ULL, 0xc15540ad21c3e6faULL, 0xfe9eb2df8e17dbceULL, 0x99b8a987e270371dULL, 0x1d2404f8db51e187ULL, 0xfe4f5a4253db532eULL, 0x79c8899084c5fa3eULL, 0x92763de378a5e4e8ULL, 0xf839ffbcfe92e65eULL, 0xf381208f0fe5e5d1ULL, 0x21b4726aef8ed5daULL, 0x320c444e5f97efb9ULL, 0xc8695d55eb905b18ULL, 0xf296ec0d05d55e97ULL, 0x23db201b84d031ddULL, 0xdb12345eb8140406ULL, 0xcc23a1929bd84de1ULL, 0xb09d2187eccd1fa7ULL, 0x149eaca82c09c4e0ULL, 0xc460a9953953e3d6ULL, 0x2edf97d5d615b7beULL, 0x1519eafd905f0885ULL, 0x41a249e6fee8c04dULL, 0x932ef90bcbd4895fULL, 0x39922915ac87f9baULL, 0xec373334bd624b90ULL, 0x71704d147755ab2eULL, 0xdff78855fd6d376fULL, 0xe20b01d4a01ede71ULL, 0xc031a95ba8256432ULL, 0xadd199f990566840ULL,
+        0xf1786ff064468542ULL, 0xab50ac717efd445aULL, 0xa9d505e08425c466ULL, 0xebece4ec124e3fc3ULL, 0x8c23e8a9f4632d3cULL, 0x746636c2753468a2ULL, 0x3b26be43265a7881ULL, 0x02a9c6032f4b407aULL, 0x488697728e05f4e5ULL, 0x051754af08bab8e2ULL, 0xbe9be5df9074d404ULL, 0xd5f8bec542ebe83eULL, 0x8e089fd55e1b4f8fULL, 0x0d71904125b46ceaULL, 0x59152a47235afccbULL, 0x30c68ce64baeb4aaULL, 0x74dff3576365cfc9ULL, 0xf93e9d4246ad2dd0ULL, 0x2b1d65c05f1bda5eULL, 0x1073fc18fa149e81ULL, 0xcdcaf6d67299a9e8ULL, 0xe18cc0daa060df39ULL, 0x5c890d0c064f9df5ULL, 0x1ef4969c7efe16bdULL, 0x28a81fd1ca70c98dULL, 0xf3ae4c715484d645ULL, 0x8c9d1ce9f270bf1aULL, 0x0dcb52442935d2deULL, 0xfcaf89a527ba877aULL, 0x7bf9d2f244ccf63dULL, 0xd1ef903f5c90ab86ULL, 0xacc7515af077a90cULL,
+        0xae7c5c9604d31c85ULL, 0x9ce8960d18ee6557ULL, 0xa4c5689515b024edULL, 0x8e826f214aa86754ULL, 0x249fca4ea319e023ULL, 0x6c57eb274daded08ULL, 0x9550709f9eb69d3bULL, 0xfc924237e723e952ULL, 0x10a1a7c492d86ebaULL, 0xc001eebe3e3f955bULL, 0x2e0235c329446449ULL, 0xb24d9e1cc1c9935cULL, 0x33da342a23ffe131ULL, 0xc4fe9578d362a52eULL, 0x13c7d45236f0a4faULL, 0x20127e3b7f3d062aULL, 0x69674c1279947ed2ULL, 0x9f06058f107d3f40ULL, 0x841201caba762ffaULL, 0x7539ac433c857d6fULL, 0x662f2187a60b3849ULL, 0x81908b8ecbe79388ULL, 0x800e8e000fc4eccaULL, 0x78bc5de8f2e05038ULL, 0xd309b88f815c9dbfULL, 0x3a64cf1739cfc792ULL, 0x84640ff05c003252ULL, 0x1da68fa1d0971c29ULL, 0xf80ab65e9a6b5e98ULL, 0x823e7af4a9f97cfbULL, 0xf121a8861a178f53ULL, 0x44cd6c8b0c6e5ca1ULL,
+        0x12d66a6046dad115ULL, 0xbb761a07eb435352ULL, 0x01579ac2c55fd390ULL, 0xedba18ca64e282d2ULL, 0x4343f95701d6f0d5ULL, 0xf34cd172d9570edaULL, 0x3be9093070d88856ULL, 0x9948e1268e85f993ULL, 0x7649e2eac52cdc74ULL, 0xbcc3d7e08144090dULL, 0xa8cf594cd58c212eULL, 0x6ae7e3d484353394ULL, 0xd3e5e78635ff6a25ULL, 0x4fa04422c51900d0ULL, 0x22c218d4f0d180b5ULL, 0x143b050263429a90ULL, 0xeba62701751d244dULL, 0x3ae443a8670616a9ULL, 0xacdbca2f8bc2501aULL, 0xb3d0be18b3747562ULL, 0x914718453c64dbbcULL, 0x5f8933d10d632b16ULL, 0xf83b034902d3dac7ULL, 0x895b9e6d81460a50ULL, 0xef6fee859b28b38eULL, 0xa1cf110dda3967cdULL, 0x9f651ec592e56f30ULL, 0x5d7fd1970be963abULL, 0x1c0ae16bd5ae1962ULL, 0xb9260c89581b2b4bULL, 0x454b86e1989f2f46ULL, 0x32e3824e24bb3e0eULL,
+        0x8400dc6ff991b5eeULL, 0x2a02673e01899784ULL, 0x377718d51fcdb12eULL, 0x01e7beadbe35489fULL, 0x56dc1de3cac7c270ULL, 0xa6333c8d15a8949aULL, 0xfaf23adf4ea536d9ULL, 0x87aed14d0863f857ULL, 0x361f235bb7e82349ULL, 0xa5947b93cb9fb3aeULL, 0x677c879426f93a25ULL, 0x6a1c9b65d6738e3bULL, 0xf3bc81d34b9ef0dbULL, 0x7d3fe85b301a150cULL, 0x4aa255bbc540be50ULL, 0x92407edee70b2be0ULL, 0x3150bcdedad14bf3ULL, 0xd03a48d7f6d9dba1ULL, 0x11b09fbd21a274e0ULL, 0x1df791c7b8306e8bULL, 0x965134992578fa81ULL, 0x0cfb90cde4c4e2b6ULL, 0xafcc52afe0b52d97ULL, 0xb2497d92009c4606ULL, 0xfa47edb2def218f0ULL, 0x1c404536efcd1aa9ULL, 0xc66a3bcdcb1e0ffaULL, 0xd3775d5abe13a52bULL, 0x1bff17d32182ed7fULL, 0x35ee9b73be37f456ULL, 0x43842765cdbb6a01ULL, 0x8b6affe29648aa74ULL,
+        0x89dc77a00e2ac5a6ULL, 0x388c5817ed54442bULL, 0x7947d98670ab3296ULL, 0xb6d12b0206e0bc14ULL, 0x18bad9f9bc340034ULL, 0x89025391143ccd0bULL, 0x25222517a86ac416ULL, 0xbc145d22dea4937cULL, 0x2b08ed9b36af0a1cULL, 0x830b3e26661ab76fULL, 0x95df8cf11d79d95bULL, 0xc046729a7fadde84ULL, 0xb4e49f380467d953ULL, 0xb919eea714bca449ULL, 0x1294c88064a252a1ULL, 0x4824eaec675d1debULL, 0x9925a1e069bfe9d9ULL, 0x9077beda34f6b350ULL, 0xe219f89c13795243ULL, 0x2a34c9c7c692cc14ULL, 0x4e136e4788070675ULL, 0x52bf5dd6e2212352ULL, 0x52beee8968215f6fULL, 0x1b93bbce3efbd46dULL, 0xdb84e93df1f5ee1eULL, 0x63c5f62e3d38cbf9ULL, 0xc9e557b61aec859cULL, 0xbaa27895d31c58bbULL, 0x72f52e93e1224c69ULL, 0x5ea1d3714578a495ULL, 0xc688556d22ee0d5dULL, 0x53485989a1982215ULL,
+        0x350997625e0be0d6ULL, 0x3f307aa46fc0c9f0ULL, 0x59f7cf00b1a5ff5dULL, 0x240f47e1eaf19144ULL, 0xbf826a76656b15f5ULL, 0x4dd9a3c892552493ULL, 0x73be4229ba83dfb9ULL, 0x08b5347a7f52cb13ULL, 0xd78a958f4889fc54ULL, 0xdc58710c06c6b189ULL, 0x6a8b1ddcf0c35fcdULL, 0xf89875269d41b0eeULL, 0x8a553085b757a30aULL, 0x509b95f12aa7e02cULL, 0xde7b507ef710a38fULL, 0x9a902042bb4ac5f1ULL, 0x0adcd07bf44e01cbULL, 0x653ccab696a50d4fULL, 0x6805af94d3d272aeULL, 0xd49488ef6748348eULL, 0x8990766fd08951d0ULL, 0x362e5520b31c186fULL, 0x6c268c60e336656aULL, 0xb1d381fab749721bULL, 0x10906e1be2169d3dULL, 0x36d6fdd7818d5577ULL, 0x568f5e0fc2a2703fULL, 0xf48658b829300b2aULL, 0x1e6605ab66e024d3ULL, 0xd23c45f7fb5fb98dULL, 0x6b917c82d29e8edaULL, 0x678bac781c3f5e0cULL,
+        0xe64102966d1c0d22ULL, 0x0e7d3214f15d344fULL, 0xf8eb1427b4e62d56ULL, 0x458bdfa8d2778f30ULL, 0x89aaf385831f31dcULL, 0xf190043f625a1785ULL, 0xae9d65587e9a22e7ULL, 0x8bde92df90907a36ULL, 0xdbfdf805ea4365c1ULL, 0xd7c25f843cc0df32ULL, 0x7fb3482860060329ULL, 0x003092983d1b43ebULL, 0xaa8d91ccbac53f2eULL, 0xb0735d00dc44dc46ULL, 0x6ba4fd65b39c9f39ULL, 0xa24f3d21d77b8014ULL, 0x452376114a0d0cf2ULL, 0x9b8483f6d90b4bd7ULL, 0x42a98d0d64b8c010ULL, 0x652de24134defaf4ULL, 0xac30e2c3da19217eULL, 0x2bba2c8e8ca74f70ULL, 0x7ce0c8d5f2e4f78fULL, 0x38862c9feb35d31bULL, 0x6f16efffd143b1e9ULL, 0x645c2cff144726fdULL, 0x6fa0f0585b45f845ULL, 0xac6f9773b57893e0ULL, 0xf91631df1724e17bULL, 0xf9e1cb6bdd36360cULL, 0xa9a5db6b08c9f3c8ULL, 0xf037823fc5eebd24ULL,
+        0xf2c515cfcbc81584ULL, 0x6fc765f3ef95d914ULL, 0x46eaf5b1ce905893ULL, 0x7cdbef58b3a2e35aULL, 0x4b02c6a5f189186bULL, 0xa9a2db7ef7e9be86ULL, 0x61d152a1722e1763ULL, 0x40f69dc02b1e7b38ULL, 0x8208a9e7861ddc9bULL, 0x621dad96c917b7d2ULL, 0x639f0d7ddb6f5b66ULL, 0x01c2cba85c49a1b1ULL, 0x46b8d4bdc47a98ebULL, 0x9842b1534b947383ULL, 0x5226b11ec934cd07ULL, 0x3ad6d2c2b05474b3ULL, 0xc0bc1d6203ca06cdULL, 0xef3673d6847db090ULL, 0xaad89f9c355a8b51ULL, 0xd17bcd3e2e94b3eaULL, 0x6b6e1cd1f178800cULL, 0x0ab477a1396f03ceULL, 0xda803d078e8d64b7ULL, 0x790605b3ddeec397ULL, 0x74ee7035ae2934bfULL, 0x9b85eb1b272f4d8fULL, 0x0ecfdfcca59cb02aULL, 0xd5df21c52b983b99ULL, 0xd4f5cff6dfa9255bULL, 0x5ecbe154810f90c0ULL, 0xdb400335c91e6a1dULL, 0x2aa032ec1110fdfcULL,
+        0x517320d2ee01deeeULL, 0xc3aa60bf4bd1e090ULL, 0xfec8979a5331e9dbULL, 0xaf072eb7d9849049ULL, 0xd6ffd1821a5f73e1ULL, 0xe9371d7915068f3cULL, 0x27e8091d802996deULL, 0x495c824623b5f6a7ULL, 0xd2dfcc6a10760451ULL, 0x1b2f292c5d3df9daULL, 0x98895b360c8c556fULL, 0x01938423ffaae779ULL, 0xd3f11b3c0f5daa26ULL, 0xb57e22b25eb41534ULL, 0x646ee17ffc6657d1ULL, 0xdef9318d5ea857a9ULL, 0xbdcde45c0a51d26eULL, 0x9f9448c47b09b930ULL, 0x8f613f86c56c93b2ULL, 0x20b2f89c26d700daULL, 0xe46cd397130ebeb2ULL, 0x09d9e7e788bde2e8ULL, 0xda41d49114b1b88aULL, 0x98e251cadfa4921dULL, 0xe168631bf800077cULL, 0x284f3cff637a8fe8ULL, 0x0494ffe26c236e6dULL, 0x54f9724bbf3d21aeULL, 0xcce7d021ba381678ULL, 0x40b8ff99c746a730ULL, 0x10059bf82c9ac155ULL, 0xc440eb37d4b92aabULL,
+        0x7fbc65b93513bb4aULL, 0x94556d74cc3bb337ULL, 0x5bb1b118268e048aULL, 0x436a958bf76e7265ULL, 0x3b1bc36ff209fe60ULL, 0x95e406f7644b17b0ULL, 0xe0d6ad34ba9cc7d6ULL, 0xd119b07a48e41aa0ULL, 0x670bb82c86add655ULL, 0x8365463637b99cbbULL, 0xa4b0e0d54cc65d78ULL, 0x63e4177d061173efULL, 0x02d9a56c3e8629feULL, 0xc9280d9a8d85c430ULL, 0xf6dcda0beba7227cULL, 0x65dd4622b493f568ULL, 0x1ea8555a9367264cULL, 0x2d90a70fbc54b5f2ULL, 0x832fd2835db8f6f3ULL, 0x7608be7c08d617ffULL, 0x39a42502da1146f1ULL, 0x819e139a6bf6f7e3ULL, 0xf2e61caa1825e1c4ULL, 0xce9434d8b26550a4ULL, 0x666e51f1ba6cd811ULL, 0xa7b3999f8c5a9933ULL, 0x5542796931b1c705ULL, 0x3c781b5d9063351bULL, 0xbf8b12788d228e82ULL, 0xe3ff5296a8787afaULL, 0x46e1a41c92d51040ULL, 0xe14446fc6a4824cbULL,
+        0x1dd8032cf52d6d28ULL, 0xc16948e53c20ac54ULL, 0x11e8abfde35677aeULL, 0x446a54725f1aaba5ULL, 0xcf22c1c584162d21ULL, 0x4f556af340e2deafULL, 0x0fc17776be4caf39ULL, 0x42198ecf46b99b90ULL, 0xf035a14951c88799ULL, 0x3b4bd814442544e1ULL, 0x744c6f20f176fef4ULL, 0x649d5f171fe61079ULL, 0xf9e1eeda3bb66c70ULL, 0x7a15827cafa79e08ULL, 0x40e05b5a70806128ULL, 0x7c3d1bf65479b0daULL, 0xf5286037e0b2f854ULL, 0x96b10e152fc728e6ULL, 0xb97617935be800b9ULL, 0xb278a4e95a94f49bULL, 0x9ac50f31cb19e08bULL, 0xcf2e422118b7861bULL, 0xf45df434cee34b97ULL, 0xa97095a93c3a6682ULL, 0x1ee253cb84763534ULL, 0x1b147076226eb066ULL, 0x6617125342f2a446ULL, 0xdc80b59e50972663ULL, 0xa37021337944c61bULL, 0x21a32c5d434f4889ULL, 0x51871ab53ab6f113ULL, 0xb792b39922b98b52ULL,
+        0x0087eeba0e29762cULL, 0x8fd36fba03fd930aULL, 0x0f9a39d0d9979347ULL, 0xec1c0c85d6e8c763ULL, 0x2bd99e3b69c2ecfcULL, 0x8c67762a7cb8361cULL, 0x675cb62c89bdba01ULL, 0x7ad06e02aaba2a77ULL, 0x2176577900c60a34ULL, 0xe358d8342bf8f329ULL, 0xa1182370bcfb29a9ULL, 0x67f5d21e8ff3f9c2ULL, 0x7cd4d394763b4f75ULL, 0xbab77f346497889fULL, 0xbeb587ca12a5e471ULL, 0x39bf4d681b88ef15ULL, 0x391b12a8c70dc339ULL, 0x11f86ae2177e83f5ULL, 0x3db797e3c8fe126fULL, 0x3a35a912c4386698ULL, 0x137a0662287cee24ULL, 0x9d74d5fe69646374ULL, 0x4ef564d5b2c3f73eULL, 0xc740b6615f0ca8e8ULL, 0x42a22e2ef6e572f2ULL, 0x9755c3e8ad49ed2dULL, 0x673665cb616a269fULL, 0xe489cdd9dba488c9ULL, 0x647825972ecc2b03ULL, 0x6e36032c6bde1da1ULL, 0x32968b3d1db441d6ULL, 0x4fa5f6a8447c9c3aULL,
+        0x03e9b69920862310ULL, 0x89b2a35a7cf6c3d0ULL, 0x81bc4f45151642b0ULL, 0xec638dd7d2b57bcbULL, 0x9b70317fc8459851ULL, 0x6b06b63432e0af56ULL, 0x2f46348af1e035e5ULL, 0x73098e8ac14de0a3ULL, 0x38fb8acd3ee0e3aeULL, 0xd7ff7808efaf8e97ULL, 0xa14e6e8ba5a84e01ULL, 0xea93d61502d75052ULL, 0x78b19602e347afcaULL, 0xe7c822dbf7f9543fULL, 0x28a5ec6696f2ff39ULL, 0xd03fc2211c515e5fULL, 0x11ce4a0e2acdccacULL, 0x1f0ba8ffc534f016ULL, 0x1f0dc1cd669b9e12ULL, 0xd36746768d497ceeULL, 0x6c0d064f0c0a3560ULL, 0xc30d4d1d85022edaULL, 0xa911f879c48c94deULL, 0x5c81cfa39a3bd964ULL, 0xbefac35b1b080e7dULL, 0xc991c89857c082f8ULL, 0x3a7907c03d328c00ULL, 0xb4e08f6efea46c10ULL, 0xed9d09dd49c47703ULL, 0xca142b2083db2bddULL, 0x4d063c63292ac35dULL, 0x1d0835c5e42dcd74ULL,
+        0xffbd69721552b009ULL, 0x271f4d8f4d50436fULL, 0xc8b6cbcd05e949a7ULL, 0xef22c3563b21bd8bULL, 0x0e5341f6f1a23144ULL, 0xcee9f8f2023fa0d9ULL, 0x4bd15472d18bd389ULL, 0xebe621b25329c7beULL, 0xf879b7e22fab8c03ULL, 0x0c08be63090979d8ULL, 0x85d230926c852e8eULL, 0xc0dd81fa39587140ULL, 0x2323ff7166187b43ULL, 0xdf2910834c798c05ULL, 0x101772fe264f35cfULL, 0x29679364d4159044ULL, 0x4e6620c409f8bc3bULL, 0x15f8a7a73ce59ea7ULL, 0xc7fedaba7be0af13ULL, 0x2a6831fedf436226ULL, 0x0dec2c1c459761e7ULL, 0x6979d39c30bdbabcULL, 0xb41023b4fd4b2c7bULL, 0xb5f865da8e4d297aULL, 0x3920f2d62ebad39dULL, 0x561a2a324897c718ULL, 0xe12a7a6ddddf6927ULL, 0x1d8622285ea090d2ULL, 0x12ede36c4b20f59cULL, 0x8504f2d381ac4b89ULL, 0x93f6c4df1236f739ULL, 0x122bf963640ed866ULL,
+        0x8580072d0e52ef87ULL, 0x403bcc0ec9b7bdf2ULL, 0xd0d5174d59b94f33ULL, 0xbf988b1613079a08ULL, 0xda11b36acbf9276bULL, 0xe697df32b3062109ULL, 0xa2389d1316e0befdULL, 0x16febc0d55759b2aULL, 0x3b3ea36088989499ULL, 0x72d3a4050f5bfd1aULL, 0xec7316cb166f9719ULL, 0xf8c7b3b4fbcb8517ULL, 0xa4558b01e2f4b8d7ULL, 0x8c2a6b0cdc77f057ULL, 0xbee60a0d3a6234a0ULL, 0x1c8ee1e57ff013aaULL, 0x1c87a5a9ef891037ULL, 0x4a7ed04521c008c9ULL, 0xbfadd06de01bd789ULL, 0x4e4604dd5714eebbULL, 0xd72c460f74e575aaULL, 0x25586d1c64fb9e2dULL, 0xe12682c10b00a329ULL, 0x90adbf2cfe954deaULL, 0x2bf1488a0a40856aULL, 0xe9a3b8272e18722cULL, 0x983c33fecdc840deULL, 0x4ac8d91b93c73c16ULL, 0x5429e2708f2beff5ULL, 0x94751cb47ed33fbdULL, 0x420e8a9ae62745ffULL, 0xbed680da531aaa69ULL,
+        0x11528f3521e8a752ULL, 0x9e960b7b6345734fULL, 0x225a06ddfee8ef88ULL, 0x2461271433a7cb8aULL, 0xf59bfe43522f0376ULL, 0x6159633244e336e5ULL, 0x0858dba88d417332ULL, 0xb8c8102417fdd005ULL, 0xfa7a4ee971ee06dcULL, 0x242e718cff9cf973ULL, 0x7853c9c5e90d06ccULL, 0x0f2c3648a7553809ULL, 0x6f43d1e2e934c18cULL, 0xd21d387e4eb6f150ULL, 0x2e038461c52dd2dbULL, 0x37dc549e82ec4eaaULL, 0x2c6578f86df3a017ULL, 0x0bee9d30e697c5c0ULL, 0x738eba5c6fef57e6ULL, 0xcbce11d6242ef84dULL, 0xa5da2c2127dc4fb4ULL, 0xe458b3c47f29a2d1ULL, 0xaed1d2128b66bb37ULL, 0xa7874843cde2cadaULL, 0x3c6635d821da9be5ULL, 0x56b9f7323a66cfcfULL, 0x86f2a8ef7dc06c7fULL, 0x068fc90c054f20ffULL, 0x84765e6173b76781ULL, 0x141c400ba8f89b09ULL, 0xcbb2630aa45af299ULL, 0x846c89b05f893dafULL,
+        0xda5f15ea9c5acbd5ULL, 0xb41588dfae46071cULL, 0x1e93cec2c18f677cULL, 0xa8f120a77b98e71dULL, 0x6989482c310b8cc1ULL, 0xc5582b7eff400970ULL, 0xc9c809157afa64f5ULL, 0x73fb0283562f773aULL, 0xb686337072661961ULL, 0x5d5ea7796e7bb6b9ULL, 0x0194f4976c19c46cULL, 0x503a2571c3754706ULL, 0xe2cf16222a76295dULL, 0xed8fbff6d758b750ULL, 0x730afcfb5720d119ULL, 0x786d3480803c8260ULL, 0xa7f6009f56dc05bcULL, 0xafdd7dbff4261f41ULL, 0x5163ffd5c86f5572ULL, 0x2f17778b7d719655ULL, 0xd82f7384877f00c9ULL, 0xf02f34acf069df8cULL, 0x4df69b7b75949fbdULL, 0xed3036d18290139dULL, 0x746149a8b3432b75ULL, 0xdc44351c5b0c042eULL, 0x942dc1110fe705bcULL, 0x77562e5f40f46cd5ULL, 0x30320c0cd2fa9982ULL, 0x426f6575b1e0d1ccULL, 0x9ce3f54435214cb1ULL, 0xefff56dc8f0dd7a9ULL,
+        0x8e3f7c5253ea17ffULL, 0xea2df70dd2d0f6deULL, 0xe90c01ec90911c13ULL, 0x9aabb70d03534a50ULL, 0x666815c8af7582d0ULL, 0x1a20e1b6455f046bULL, 0x67f11821e21286c8ULL, 0x14efa848b8dd43ebULL, 0x37402f941efed546ULL, 0x824f5cf8b715ac8fULL, 0xfb8d4f0b9711ccf0ULL, 0x24f0544369eb3356ULL, 0x82a664e5155b3efbULL, 0xb26ba2a0edbade0dULL, 0xd9e0fc7d05b88882ULL, 0x21550cac6b9ab370ULL, 0x125ac252ad3fededULL, 0x70a50fe1e3700836ULL, 0x1b242722abb6668bULL, 0x1d43027ad7ce3b52ULL, 0xc54596251258022cULL, 0xa78868d3c860b700ULL, 0xcef05c0c932f2eaaULL, 0x5cc5f83eb1906fcbULL, 0xfa37bfec1c577ba7ULL, 0xe0a46c8d7020de3cULL, 0x0f2009c31c321f64ULL, 0xe73fe1f4fcf3d8ffULL, 0x84fb259d29db3b1bULL, 0xea49c8740567e641ULL, 0x2fda91d98f2a0800ULL, 0x68a724eb70d26590ULL,
+        0x5deaf00272494a99ULL, 0x167d4f57541a2f0eULL, 0x1a7837855e45a990ULL, 0x5a451bd135291c84ULL, 0xcc1c10a0dbc66aafULL, 0x7f1b9d4ca4767f7aULL, 0x3026f83a0dbc71e4ULL, 0xc079273f113f420eULL, 0x53bcede6ae4e022fULL, 0xafc21b6be6034cceULL, 0xb1dfde938cb27049ULL, 0xe14719ce06c2f2b0ULL, 0xf95302244b2a13b0ULL, 0x0fc514c69b2a1fa3ULL, 0xb9805c5586440a62ULL, 0x01dddf6ff0c71c91ULL, 0xfa5efe489bbe8f0fULL, 0x50a88824886bd55cULL, 0xa2183c68f5bb7abbULL, 0xa22de0abf314a79cULL, 0xb494a35f9aa4afb3ULL, 0x0624fa7d179c1c9fULL, 0x9b527c659e47c9caULL, 0x4831ed8a622b5887ULL, 0x441890afedc1aff9ULL, 0xe5940fd4c2e836d6ULL, 0xc0ffa1be77a493ccULL, 0x4c1115909643442dULL, 0x674368fe1d96ff8fULL, 0x0591b10334c58fb0ULL, 0xb93e413567542657ULL, 0x6c7f4b047b9d1056ULL,
+        0xfd30e18caf6dded3ULL, 0xa57717ca6a801f20ULL, 0x26aae01885421970ULL, 0x0fbb02e3357cb34bULL, 0xb83c8b8302bd0be4ULL, 0x6e9b4c5d897c0a5cULL, 0x26e136e327098be1ULL, 0x3c10bc4bb3417780ULL, 0xba00df7adee159f4ULL, 0x317079f37b551118ULL, 0xb2483a347ffb24d9ULL, 0x1888f6c73e24e16fULL, 0xd5bae98dd8340404ULL, 0x22d90e94e37ca364ULL, 0xdcc1114525b7c24aULL, 0xde3b3328beecd37fULL, 0x08d3d5ec30e86da4ULL, 0x9616e0d544e2e1eaULL, 0xb36653a4bd7478d0ULL, 0x7b3b532e66332423ULL, 0xe0d2b9c233007e4fULL, 0x6c95da2f599c5a13ULL, 0xdd96c09b2fd98a11ULL, 0xfa23e14694b0ceb1ULL, 0xe41c1f533255d420ULL, 0xa0cd868256205817ULL, 0x01a0c8bee2facd14ULL, 0x384df7ad62c30afeULL, 0x71363cbb46f1c089ULL, 0xa2720aea8488c8e8ULL, 0x9e5af670180ec4f1ULL, 0x65bef670a6d5654aULL,
+        0x931d989e723c5446ULL, 0xd3272121beb6a0f8ULL, 0x2929be7c25625e8aULL, 0xe56274e518588160ULL, 0x68521adf855f4d2fULL, 0x72933bd3287a7479ULL, 0x80276fddbdd7035cULL, 0x302951346d60cfe4ULL, 0x66decf8a6f960cfeULL, 0xaadaab1999e3be67ULL, 0xdd3b7b7883b81513ULL, 0x335deddbb624af87ULL, 0xa396c756cf167b37ULL, 0xe359fe00c588997cULL, 0xe9e446691ee540c6ULL, 0xe295c1a6d79ab179ULL, 0xb139e4f08f39e00fULL, 0x6bc42768e21706aaULL, 0x5b97a2e15e7c445aULL, 0xcbc93d47c5b012a6ULL, 0x779ea6005c8cd752ULL, 0xf0c055682b46769dULL, 0x18a3f4186b3912cdULL, 0xc92655ef0f8ef43fULL, 0x93fce566473bedf2ULL, 0xf03cf1ab0e0411baULL, 0xdd6068f0145a2374ULL, 0xf7e6f443bbbc368eULL, 0xe6a479d07fb6f004ULL, 0x6479c84478fba193ULL, 0xab6b0510cf7af5d8ULL, 0x862d58b6a85b576dULL,
+        0x9c401490dc165e22ULL, 0x0dbc9501512895deULL, 0xc41bc486aa66a7b3ULL, 0x3947cddbf97e43feULL, 0xaa45e42db26a6ef1ULL, 0xcd6805c71a4b2e75ULL, 0x2eb0031739e20bafULL, 0xf099a4f7c06034b6ULL, 0xfb8fe7e816fa62fbULL, 0x64e1f92a4f9f4ebcULL, 0xfe4a4e209cfc73d6ULL, 0x13491201e6bb52d7ULL, 0x2bc976e057bacb6aULL, 0x10873e768469680bULL, 0xa5f477d43f83e0fbULL, 0x7503b6b457357ab5ULL, 0x0772f352cbaabf4cULL, 0x727f124bf692514fULL, 0x365a3ee34004b5ceULL, 0x912cfa44db3835bfULL, 0x61f989c5e471bf9eULL, 0x412c7a809dacc634ULL, 0xc3746499f705b880ULL, 0x41808d7d60006024ULL, 0x03fbc657b166bf2fULL, 0xb41c6b5e3e582dc6ULL, 0x3ac17d6f8fa4fcbcULL, 0x6d599b1499ed20f3ULL, 0x6fe39ef3a19361f1ULL, 0xf8c87a344dfa80f3ULL, 0x44bd438195afcee4ULL, 0xbce7adb64c648ebfULL,
+        0x451721483dbb6506ULL, 0x303e4224f1e23568ULL, 0x96620b745fdacefeULL, 0xe2d62aaf7df52e39ULL, 0x4a65713a2d165a93ULL, 0x5e8ccc4f73cc2d4aULL, 0x08394d94bb033298ULL, 0xeab466464189911cULL, 0x103b7b7882fccf1fULL, 0x16520ccbc821f92eULL, 0x35d4b5438ed9afd7ULL, 0xbd09f1eb11e3fb73ULL, 0xdc22540375c2d9eeULL, 0x12e4412979ef53d0ULL, 0x6d6a65494dcfd3ccULL, 0x27d35732ec76c3d9ULL, 0x8b207718fb5ef3ccULL, 0x07b7bc693ad30a6dULL, 0x7b1a6af7c3c06ee8ULL, 0xa4a3be701fc7e1cdULL, 0x4fa6c8362af6e7a4ULL, 0x1fec5da3c229d2edULL, 0xd13ef5ba0c51392fULL, 0x096e721d3bff11e9ULL, 0xf4dd79c1d345383eULL, 0xe867617f42651a11ULL, 0xdd134acebc5d4071ULL, 0x2da32e11da904012ULL, 0xeed816d908434340ULL, 0xf0ed350bbe3fe507ULL, 0x9de7103beea38838ULL, 0x8a8bdf3119804d3bULL,
+        0xd83131c4935f0852ULL, 0x4c6898a8f757458bULL, 0x720f003380d580f5ULL, 0x742e9fcc9f29b516ULL, 0x1e86a185c8c86ef3ULL, 0x79987f440e8b4daaULL, 0x28a2c82c3c20e33fULL, 0xccb4aeff3f4d4b92ULL, 0x8e5e0477d31d9ac9ULL, 0x2a3c52b8126541c5ULL, 0x2561efb20a53185aULL, 0xdbda6f580023961cULL, 0x449f03696ee25c26ULL, 0xd17dc85a07891210ULL, 0x65b8963ad48db6aeULL, 0x956dbf31463feef8ULL, 0x95cf7927ef3498efULL, 0x34a5398c0719c92bULL, 0xac88ad6c74dbd112ULL, 0xe492dbadac354d55ULL, 0xc85ba0561d4d77a5ULL, 0xef0c957eaf130601ULL, 0x2f0d6a91c6fe76dcULL, 0x52e03f7ea6f13188ULL, 0x7a34a4d974418905ULL, 0x49df464b7579f859ULL, 0x537a210c1ea46ae5ULL, 0xacd34297019243bdULL, 0x9d379689deb0d2fdULL, 0x9c6b54d206347169ULL, 0xd349ecae5e643299ULL, 0x16a3cb6b8f1f675cULL,
+        0xdfb6027fe92744ceULL, 0x332bea82bbb2a5fdULL, 0x231b0f56ca8acf4dULL, 0x00034f9478e680beULL, 0x34c49061c403747cULL, 0xf0ab3b30a548514bULL, 0xae043c0f29ff42e7ULL, 0xf589707a6092c72cULL, 0x46c584031d022f9aULL, 0x5108c555f368e527ULL, 0x97f9976e30738ca6ULL, 0x41039b660af903cfULL, 0x29573f99728ac160ULL, 0xc6c8823a21a93356ULL, 0xe9a366ebb887e3adULL, 0x5ab9654ebe724c77ULL, 0xbcdb2b346a2f8147ULL, 0x4a24f8b9180153beULL, 0xf1663770cb5203bcULL, 0x5af031229403901aULL, 0xcbd8d2fe11a6aadfULL, 0xc59783bedb12348bULL, 0x2e19e252e39d48eaULL, 0xa0214b828f6fe3c9ULL, 0x58199de46a61043eULL, 0xe74ea3ad801ce0e2ULL, 0x3289a7e1bbae1edeULL, 0xa8520ee231a37895ULL, 0xb3daf90fe9b0806eULL, 0xfd5308703c3a1758ULL, 0xae7872fd24eda5aaULL, 0x8343e1d1923b9763ULL,
+        0xc5c1c28c3c52b592ULL, 0x7bbc3ed6612e3e15ULL, 0x67de3489f4f1e738ULL, 0x8b8f44a04c50ce42ULL, 0x1084c70df54b0cacULL, 0xf4f501af130772e1ULL, 0xe124fc82d75f04a1ULL, 0x2b55fbbcc0696c65ULL, 0x4a61e8ea052a0da0ULL, 0x3e156321181c490eULL, 0xae8abb07b6a1808bULL, 0x0a3865f08492785bULL, 0xeeea18acc4ff57cfULL, 0x6ae9a767af394b21ULL, 0x7dfcf1e12649a772ULL, 0x7a8bf56a4d2d84faULL, 0x42c1700e48531355ULL, 0x7a754e5dc52e4132ULL, 0xa52414960355cf34ULL, 0xf586a88b8bf5d8e3ULL, 0x6d2ac597cc3d39e1ULL, 0xea6b87a85cf054dcULL, 0x609e2b6d4f80cc37ULL, 0xd732f6d3064f4fafULL, 0x616739690a99c585ULL, 0xda74409c36e49b4fULL, 0xb90699c91832da3cULL, 0xcdb13e3a01633fc1ULL, 0xed0dbf29e4be7a06ULL, 0xc686243367d01c7dULL, 0xf51b20e119b685f7ULL, 0x6493e26b514c081aULL,
+        0xa4027948b4deacedULL, 0x687eb8bf553bc53dULL, 0x752ac258397636daULL, 0x8280bfa8946d0f4cULL, 0x78950ccda760f01eULL, 0x8c97ca77adb16d0dULL, 0xf23d36f6268c7775ULL, 0x34fd4b6c6b5fae65ULL, 0x46f1d6ac3249fea0ULL, 0xdb3153655acb88adULL, 0xa5f9d99f8191a6c1ULL, 0xb633e11cb6563012ULL, 0xf8d01f2bded3a208ULL, 0x721da6a3d04ee227ULL, 0x0f6cdbf9c87b1741ULL, 0x3e8c117f91877c3eULL, 0xfbb0a2b59a866127ULL, 0xf81443c20a815dccULL, 0x22528d6093fb0cbdULL, 0x0aaddf0411f9354dULL, 0x8ab0e9de0cc3929dULL, 0xe0d436be6024d725ULL, 0x20e16814aab0b635ULL, 0x25903d8456b1beb0ULL, 0x7691edc375fb10bdULL, 0x5596bcc8d0436380ULL, 0x4eb64e216b30a8faULL, 0x9a469ebe71fb0945ULL, 0xdb84e33434141c26ULL, 0xbc59a3dd127bd4c9ULL, 0x157c2c87ab4b0fd8ULL, 0xd6b37dd996651146ULL,
+        0xde4c37065f604828ULL, 0x43464c67e2e3f77cULL, 0x0c3796160c27cd34ULL, 0x0d49663d21a2c165ULL, 0xb556f634004049ddULL, 0xb093ebdfcf5c2124ULL, 0xcae4a100bfadd354ULL, 0x23cd87ce444db3d4ULL, 0x860efc8828e3e80eULL, 0x1d42aee3d1a7c0c9ULL, 0x31e956b349fb893cULL, 0x96d3e74c52721b30ULL, 0xa843195dc5193737ULL, 0x2e7bd9b0813cebf1ULL, 0xc22b7a0c04fe4054ULL, 0xaa5396e41963d97dULL, 0x5f04785471fcc4f9ULL, 0x9cd74963e7bc486bULL, 0x7e65cc494c37d46aULL, 0x6d4061c64939e588ULL, 0x3f6ac4b0c5be9f70ULL, 0x223cbae06a1e1657ULL, 0x9aed5265fd02bd0aULL, 0xbef5ded758b99069ULL, 0x7beccea3738b4b1aULL, 0xa7d00b6144d17ff9ULL, 0xeaf7e74aab7bcd3eULL, 0x4915565be3599c38ULL, 0xa13c88696d62a827ULL, 0x26262a9a87c0221bULL, 0xe53d5bb6be6a159dULL, 0x841837c2ab2dcdc6ULL,
+        0xd62f711709dd7fb8ULL, 0x0e235851fc85201bULL, 0x2d1ac56c94d0347cULL, 0xe293e35569f7af52ULL, 0xe42aa97d675810e4ULL, 0x52202ad842419d21ULL, 0x5be1adb015434d8cULL, 0x539bc3e766157c6cULL, 0x0b447caa33804fcaULL, 0x3dd0cf04f18bd4e4ULL, 0x5cc7debd523bce17ULL, 0x15adb2f81b606271ULL, 0x9967471d51f72916ULL, 0x8ebc17d35e2c6fd3ULL, 0xb3f6300f7d259296ULL, 0xc8dde6b0cd6b07d0ULL, 0x23250d008cd340b1ULL, 0xa36aa05970b1e33aULL, 0x72be47d831a928b6ULL, 0x874b48890f7641b7ULL, 0xea54ac106180a3d7ULL, 0xd38633ac938c9a85ULL, 0x635e043011027e76ULL, 0x880ea0e3bfe52fdfULL, 0x8a7f3ac1544591b5ULL, 0xa487fc4abc62a6fbULL, 0xd3e502f3b61875d3ULL, 0xc80a8951ae1cac3fULL, 0x911e86bf68e79938ULL, 0xf6a2b311dbe89fcfULL, 0x61ee4555f6ec0e7eULL, 0xc80dafc51fadac3eULL,
+        0xcdeb22f45d231058ULL, 0xe12cfb597b8f6b2bULL, 0xb3968a16dd421283ULL, 0x04a8c3a4a67d0534ULL, 0xa0f16512bc039eddULL, 0x42eca4d842ca99b8ULL, 0xb08531837d8dd65cULL, 0x571a29d262092999ULL, 0xb798315a4e3117ebULL, 0xd34a45e7e92e35f4ULL, 0x3b4a9653f43f72b9ULL, 0x0f07a623734af3e4ULL, 0x6daf04bdccfaf7e4ULL, 0x582ef458448d539eULL, 0x3cb54b7f389f4feeULL, 0x6b66b587cb534654ULL, 0x5259444f62e8c789ULL, 0x8a53e918c7904b81ULL, 0x02d9c32e46e08567ULL, 0x31265e55487ff63bULL, 0xb503fec852838f14ULL, 0x5ff9864fa06ccfb0ULL, 0x14d2645540aef4e1ULL, 0x34218b4d208dc03fULL, 0x6d41c15c4961561bULL, 0xdeb43c866856af97ULL, 0x443d8bf313f53846ULL, 0x6ec5063cccfcc6a5ULL, 0xd9300f558a9be6c4ULL, 0x26c25a874237f6ceULL, 0x233f50ba0350771dULL, 0xe6427044102df594ULL,
+        0x9a6480248b1b99c8ULL, 0x72994e91fa199400ULL, 0xeb49dea320cd2de8ULL, 0x9327535c3145f190ULL, 0x2a231c48952aac8bULL, 0xe8b609e18ad833ebULL, 0xfb1f11072bf0290aULL, 0x1a361557c33dc5acULL, 0xc23d588f3ccf4835ULL, 0x3e9add14505641fdULL, 0xbd429542dd2d6d47ULL, 0x524afa671fd4fcfcULL, 0xcfc72a3187fdb953ULL, 0x08925e62d691f3cdULL, 0xe563d5a94ae07635ULL, 0x123b2b20f31e116dULL, 0xde16fe61cd048db0ULL, 0xc2ffdae3b858040bULL, 0xfbb0c169453bd126ULL, 0x148b157030442976ULL, 0xe0eb871e59e7f176ULL, 0xd47976a1025ae026ULL, 0x7d932da24d5cff5aULL, 0x3ec331556bbe7410ULL, 0x8e6cf4593fda4d40ULL, 0xe2bc04313c57f012ULL, 0x2613effb6d535f2dULL, 0xd4171ac6b68fde38ULL, 0x95b5219b43e6dd4cULL, 0x15a162b881ea812bULL, 0x4a9a3a2050c4eb5fULL, 0xc32b5b46f7d5688fULL,
+        0xbe2cad718bd16ffcULL, 0x7a1dfc5a8200d83bULL, 0xf45bdeb24a5390e0ULL, 0x66b91d090fba1618ULL, 0xa503e7b1b35695ecULL, 0x01a23f6463165078ULL, 0x99fe3f704162b5a3ULL, 0x13f341522e40a51aULL, 0x9040b5d7337e64e8ULL, 0xde07ed5cedb4d960ULL, 0xd0b3623ea96a9c19ULL, 0xfd1c064bdc12c435ULL, 0x9d67e997c721347aULL, 0xf3bfe85bd942de36ULL, 0x1bc4dd4e1d9e35f2ULL, 0x823676142ce6ea9eULL, 0x6b1208d04327ef18ULL, 0xd70bb79395462f32ULL, 0x3ede454a3b785e36ULL, 0xd93731367246cbcfULL, 0xf46fac74dfe8fe8eULL, 0xb096bae8590b36e6ULL, 0x37c6abc63411c35eULL, 0xb1091c782f423a32ULL, 0xc502a64817676a1dULL, 0x136806044040cf2eULL, 0xe37651dc7f18174aULL, 0x3c4269ff6f3d1f13ULL, 0xa19ad1bd3012da93ULL, 0x1846f91f7584af9cULL, 0xa51cb2272293be66ULL, 0xf5c63f162d5062b7ULL,
+        0x688151c0e5828f0cULL, 0x8fbb26f33ea309beULL, 0xd9e4ceffbe87d1a1ULL, 0x5998ead0a7973328ULL, 0xf6f820f307933e0dULL, 0xfdf374d69b26266cULL, 0xbf773cd99be6b43bULL, 0xe36714be793ee930ULL, 0x5490f18f216b3009ULL, 0x4c3d9b6a94310360ULL, 0x9a290cc7d35a7441ULL, 0x76fe9ba84bc2712aULL, 0x6abe9e98305784a9ULL, 0x49f918dc7824d2acULL, 0x39d5c91a6a0f34e0ULL, 0xf78d5b22b902e844ULL, 0xff1bedbdc1d34ed6ULL, 0x94460f2ac80b00acULL, 0x7f58a019b924b386ULL, 0x9a5aa50c5d4838efULL, 0xc4e6095e2095230bULL, 0x40109497f3698898ULL, 0x56a2a41b508d5143ULL, 0xa8547e918ea5e551ULL, 0xb4cc14153a21b3c1ULL, 0x187b8f407987995cULL, 0xc46414ee6ec80b59ULL, 0xfef9d11c18f7ec43ULL, 0x82586492032a7dfaULL, 0x3b77b49db5cc228fULL, 0x513bf4eb0aab01cfULL, 0x5cde76dfec8b4608ULL,
+        0x626fb02b5de919ccULL, 0xf7eaef8246eb609eULL, 0x948ae7cfe5b28e93ULL, 0x1bd0ff426201aad6ULL, 0xc4d03e534fcbb6f7ULL, 0x77526cec13526b8dULL, 0x3bb5220cc5bf8708ULL, 0x80fa67a783b7d90dULL, 0x958b83bb0770467eULL, 0x78cfa7c718d595d5ULL, 0x876c97cf46525699ULL, 0x5c1f13d55810ef9dULL, 0x74a6f017bde64f6bULL, 0x971834b25927e3cbULL, 0x09714849cbb9a700ULL, 0x751d269ee0cded31ULL, 0xa1e43248301ae627ULL, 0xdc2bc60a2d438dd3ULL, 0x5230b68dfad41ea9ULL, 0x3de6882af06d8114ULL, 0xaac5a1ef26281e65ULL, 0xd33f500941de9eceULL, 0x7277700311326dc8ULL, 0xc297d3bbb7d4c1f8ULL, 0xcf50eeb81c9212a1ULL, 0xd7716a87c3bd8c88ULL, 0xdc515d900a9d6276ULL, 0xa70634d70ca2e4e2ULL, 0xb3f42addf3282c26ULL, 0x4c67c107e2bd74b8ULL, 0xab31dfc5ff899c92ULL, 0x0910abd4c2e48c2fULL,
+        0x55369973b02dc5d9ULL, 0x882e35529c7904d2ULL, 0xae2346993d5d4e48ULL, 0xe7a90843e5e64b85ULL, 0xc882949f3b090b23ULL, 0xab43f208260e9467ULL, 0x77dd87db7a949f1cULL, 0xf24c2d3526a99ff0ULL, 0x859af41032413cebULL, 0x58d12c80efa6014bULL, 0x0747635bf1250d38ULL, 0x56d1838ebbdf3587ULL, 0xd54b4582b25de547ULL, 0x6126a32b27692bd5ULL, 0xbcb3db9618712250ULL, 0xca69cb8eee861f1aULL, 0x80795c4b0b73600dULL, 0x331f7b1aafbea386ULL, 0x5f5ed1bedbec0973ULL, 0x0431199a9e1de781ULL, 0x9422e1e7f384f577ULL, 0x2ff8ca9079096994ULL, 0x4b6c3a52a143d142ULL, 0x6f403dd6ea8dcd7eULL, 0xfc85e268c5ec8e6eULL, 0xe3214ccf373e962dULL, 0xb189774d9b1b3e48ULL, 0x4711f1bad73cf8d0ULL, 0x215a494d6157ae6aULL, 0xdf772a2d857deba4ULL, 0xefd281ee2acc4559ULL, 0x51838357e0be454fULL,
+        0xa469097ba0f10125ULL, 0xa7c8886e18170b2cULL, 0x26620ab17ca965bcULL, 0xb1e2ec604e5e8582ULL, 0xb8ae26b67bbb9743ULL, 0x2b902e8b80c46361ULL, 0x7d0249de3cce258cULL, 0x62ef28b782495a45ULL, 0x00924839879c2954ULL, 0xa18cc2bd08f49fb7ULL, 0xfb3b8a455365fb61ULL, 0xbe7ceb53ec02b083ULL, 0x1d3c4cfb17cd0b51ULL, 0xbe3929a4ff03fb73ULL, 0xedc831afc8eb8e1cULL, 0x016080958a9734caULL, 0x32eb055730861c17ULL, 0x64b7a96245dcfc30ULL, 0xe3c26bb03b0a688dULL, 0xba950f91c323369fULL, 0xa18827602d053d8cULL, 0x0b011aa2a69de275ULL, 0x4a13060d185adf73ULL, 0xb74176ff918ef51aULL, 0x7724257f3c1bf867ULL, 0xadce0b541d0cbbd2ULL, 0x9b00c09ba77bb604ULL, 0xfb15c4595626a5faULL, 0xf2b1acc553a8116eULL, 0xa94edfd44b4f7877ULL, 0xea9a378cc2261942ULL, 0x16dc927d60641a84ULL,
+        0x9cc8fd692d8972c6ULL, 0xbae998e673b2267bULL, 0x9bc9a7895b2efc27ULL, 0x1f0439ea8f9eac8eULL, 0x319b7ae15bcdcf9bULL, 0xda1aa768db50560cULL, 0x4e4907d247ce1f31ULL, 0x638bb1c2d0ce2fa1ULL, 0x6980f87b955f423dULL, 0x55ec8ae31cc20241ULL, 0xcfb51a7a68195f46ULL, 0x99c946a276e53ac2ULL, 0xff5de6a435d503fbULL, 0xd788b59f7bf0ab51ULL, 0x807e4f900266118dULL, 0xeecedfbc271fadb8ULL, 0x6b973f73226573afULL, 0x5090fb6bc2409d70ULL, 0xa7447f384f0c89a8ULL, 0x32ae0f7184b7ccbbULL, 0x0f66387f280dd7f6ULL, 0x3d02565cf2f011dcULL, 0xe1f7cadf63d80818ULL, 0x7d0664b9ad124be4ULL, 0xf589affdb5194ad8ULL, 0x73b8092b66a602feULL, 0x53d1e0df35506792ULL, 0x57bb64bdcfdf2ef3ULL, 0xf0715b2483e9d14eULL, 0x6a3d439b45d9479dULL, 0x51a62bff426c03edULL, 0x468d0d9b9f874414ULL,
+        0xac813e3c672a75d9ULL, 0xdf9c741745f3e73aULL, 0x5d8b7b7424dc7633ULL, 0xfa0931188ff110e5ULL, 0xe063a5e184fd1e18ULL, 0x130ffd809b82a8acULL, 0x2e55393e759d85d0ULL, 0x12da3656ad903fb4ULL, 0x828ff3ab168d5b01ULL, 0x1a3a1ef5c35597f1ULL, 0x2d73dd030105d20eULL, 0x29002d728be7c75bULL, 0x023c26f2ae0cc5dcULL, 0xa5db88a0972037adULL, 0x14c1bf6812d65cd2ULL, 0x8882c0bc501ceb03ULL, 0x3451a67c672b18baULL, 0x53281875c346f842ULL, 0x0bfed7f66074c60eULL, 0x8965d00af0496467ULL, 0xf3209c3fa069af07ULL, 0x946abe1e6c8cb03bULL, 0x0af2aae71f6eb8b2ULL, 0xc60f86390594a64eULL, 0xf026c43a2628a5dfULL, 0xb994118e3cddac8bULL, 0x62394207dbebde21ULL, 0xb615466c7593071aULL, 0xd2e6f299ff6dc3a4ULL, 0xf75c059094c3e78aULL, 0x760c20ea3c559558ULL, 0x66370389f9a879fbULL,
+        0xab7e9198df16d6e9ULL, 0x2b860eab74eb76adULL, 0x0b3e672cd61e62d4ULL, 0xa75245e3c3615b93ULL, 0x186257d3cbd1e009ULL, 0x4765dfddc527debcULL, 0xd5213d6341b99ea1ULL, 0x9ff781aca7850f79ULL, 0x0e09c6ca8bf6872bULL, 0x8a1d1932e313a5aaULL, 0x6424ff1d71cf37adULL, 0xe0dc5427f8bbb599ULL, 0x75e253f178ea49c3ULL, 0xf05cf14b3b851fd6ULL, 0x06db548ee372dc4fULL, 0xf5b60d7510c9b802ULL, 0x0ef421090b17a6ddULL, 0x173939e6ff0e4880ULL, 0xd4af46ad497a8e8bULL, 0xc12995e835ab6b05ULL, 0xfa51ee7a222e3d95ULL, 0x3abee4562caf3cd5ULL, 0x8ab8e87ebdfb3a79ULL, 0xd17fab0917e5d44aULL, 0x31a98eafc1ec9adfULL, 0x230b7835698743cfULL, 0x375a1ea61b54b783ULL, 0xb976457fde1545ecULL, 0xe19b24443d16f11eULL, 0x9a29d957aba5911dULL, 0x2172c29c8e5cfcfdULL, 0xe4fbbd81d2cd00cfULL,
+        0x73c14bc75708056bULL, 0xbf1c3d3d105d7efdULL, 0xedf4cb0a46efbc38ULL, 0x545fe6b21855ffd2ULL, 0x720ca046630a59ebULL, 0xf904a2b50cf3052eULL, 0xb4a24fb7461b8056ULL, 0xa3526838a626cc46ULL, 0xfa34ffc0c312f470ULL, 0x87843acb7be1b5e7ULL, 0x7a9639be504739b2ULL, 0x4b75d4ec77034dacULL, 0x7153724df73acf0fULL, 0x11d7016908cc3ec5ULL, 0x329abf4d6fef344fULL, 0x1e421d733418bc16ULL, 0x9812f68d78aef2dbULL, 0x689ec9def026696fULL, 0xc5bd33471583c8daULL, 0xb59ecd3b88a6a8abULL, 0x1186bf56cf98b5afULL, 0x1a53813661688bb6ULL, 0x5e9bd93aaa3defb1ULL, 0x332f8c1f8877f88aULL, 0xdea78ea6b713ad2fULL, 0x1f5caa0c31a5d453ULL, 0x87ab5135e246ba77ULL, 0x4f14c00c68efd28bULL, 0xfa57b777387cb0acULL, 0x50e71202221d0025ULL, 0x3cf1eaf4266df9a9ULL, 0x6a921545a444564fULL,
+        0xc43e833064564911ULL, 0x90aec57e70fd48d6ULL, 0xdecadf2e29e4d987ULL, 0x37d7a34f4245994fULL, 0x0346677d0f46247bULL, 0x1645bb27143e4d0dULL, 0x529e54e3b6dfe0bbULL, 0xf539389c62b360faULL, 0xa5748abf63e6437cULL, 0x5af092f79b5ba76eULL, 0xca821d2c10a0e7f7ULL, 0xe395b494bde448bcULL, 0x82c0d0b1ae6e167fULL, 0xc1cd0380ddffbef1ULL, 0x2666761ed145e530ULL, 0x8e66cc3e36c06d28ULL, 0xbb877e786326e5aeULL, 0x9fbd9e23cb848359ULL, 0x680492a04e11c010ULL, 0x149dd4baa4deaaf1ULL, 0x124889bd46994823ULL, 0x2abbb3b206a1a66dULL, 0x79ed39c55c594997ULL, 0x78ee8c2775a7696cULL, 0x57f656fbf0e962b8ULL, 0x403c149a56f612f7ULL, 0x3ae57b8ffb64bfacULL, 0x05d776e16abff0a2ULL, 0xefe8f97ecf22cb1bULL, 0xdb98ba663b717870ULL, 0x276982beee43efe5ULL, 0x767ba76e50da97f4ULL,
+        0x803d319300cd24aaULL, 0x029d34eb8e21da7fULL, 0xf205f1451ce4321cULL, 0xc2914b0a1621c0c7ULL, 0x0603a20a90e63970ULL, 0xb895f7ca1df02e61ULL, 0x3e74a598704cbf15ULL, 0x18a43c4b2da0cabdULL, 0x81dd49b12e1ec365ULL, 0x418ddb273bcdd81bULL, 0xfff2a03558908472ULL, 0x2fd72ffcf94c31aeULL, 0x13f5fcbe4eaede8fULL, 0x75095db78e490878ULL, 0x29368f459cdea547ULL, 0x635a8a0102317ce8ULL, 0xfc4929caed69cf62ULL, 0xba769c9e5cf7e083ULL, 0x0cd8b3c5c6ebf300ULL, 0x3349912b5c05ccedULL, 0x9ebd708dac883703ULL, 0x648f5273a6b64709ULL, 0xfcb5c05fcba86d15ULL, 0x95b837fcd2a72804ULL, 0x5339b4bf8582fd50ULL, 0x8246905ad68c759fULL, 0x80e9504f54ddb62bULL, 0x61cdd080f3353b10ULL, 0x750c0d26ce84de71ULL, 0xe13094d3f947fdd8ULL, 0x864e26393e712e10ULL, 0x08e1124a812d6b3aULL,
+        0xa431688dc250721fULL, 0x7d4f50e904bcb9f3ULL, 0xcdb09c02b476d2e5ULL, 0xf6bb2dbcf8dabff8ULL, 0xba8dac658c84c132ULL, 0xb6b2b5690d546860ULL, 0xea8011ec8bac72a2ULL, 0x6104c14377d3e9cdULL, 0xf5d188fd37dbfe54ULL, 0x386dec9f69826561ULL, 0x101d073aab98b582ULL, 0xecccb66a13fe5159ULL, 0x3ee17143014e267bULL, 0x3552b933dfa576d0ULL, 0x582a935abbf0978dULL, 0x50fdda5f3f66030eULL, 0x1f21adb84bf8ab6bULL, 0xbae57e20b75f83b6ULL, 0x1049fde99f80bdc5ULL, 0x073bfcfe952f4ebbULL, 0x5137de64c2a97468ULL, 0x5f8565ead4d41764ULL, 0xcbfe93e8eeecdd20ULL, 0x3267beae7fbf1802ULL, 0x387835c7d9162b8dULL, 0xbe64bedd9942ea59ULL, 0xaa4b0987f54be9ebULL, 0xabd18cdc3cb1b0d3ULL, 0x1f0131164218c9a8ULL, 0x70e786eb136c0403ULL, 0xe485729bc629a84eULL, 0x491d8131c0fa67daULL,
+        0x5ace9e39c70ee664ULL, 0xdbae2f66d05c939aULL, 0x69efd0917a511cc0ULL, 0x39043b359cb72cf1ULL, 0x87b4d7f7e3a94de2ULL, 0x0bbb3a44a2ad2120ULL, 0x94e9eef5b5e667b5ULL, 0x12682084a9e0b229ULL, 0x578b264b093c7be4ULL, 0x41ae7d2cc0ac0f14ULL, 0xe64ad4114369855fULL, 0x2e5e6e9eaec781a5ULL, 0xa1965a4dc0a1a6fbULL, 0x60fc9a1d5f185f3eULL, 0x90a492d05a44169bULL, 0x2582c84b45531226ULL, 0x485f8481f9f54906ULL, 0xa4ed4e4ee5e5c690ULL, 0x1c530711216540eaULL, 0x1056519c5e56dffdULL, 0x8ada74789570a92dULL, 0xa2fa12bae896f63bULL, 0xb0d1805a965a00a7ULL, 0xea1290e838fe919eULL, 0xe5d0d766bc7a95b0ULL, 0x7f5bd39f23e2a6d0ULL, 0x8c667595513d61b6ULL, 0x2cc4efaeb893155cULL, 0x2448df5bfa30f693ULL, 0xb4fe456864cfe8b2ULL, 0xa6444f67d904f314ULL, 0xe4f8b93c1f5dd8baULL,
+        0x48baba5c9ba69bd1ULL, 0x177c97fd6404832eULL, 0xdf3b20d5358567c0ULL, 0x82adbf0887dcd72aULL, 0x07f5eef4869c9cc7ULL, 0x71d203f21e73d8bcULL, 0xfcf0597251c06bb7ULL, 0xc44bd2981b4dd4a9ULL, 0xbeee00b612eea9b9ULL, 0x732e2bd55fa37c0cULL, 0xdacfc87f687e85c1ULL, 0x594543b86213a24cULL, 0x2064dd60c3cc7644ULL, 0xe4637055cb446999ULL, 0xf9a2349845e5560dULL, 0xd0bec4d76e5b3c34ULL, 0xffa3ed844bbfe038ULL, 0xf8e28ac6763cd80eULL, 0x3da444c25544bce2ULL, 0x199fd812d1e18649ULL, 0xd5c75055b801fc3eULL, 0x32127c949e600e04ULL, 0x5856ecfa9318a5fbULL, 0xf924c5fd0b78ebf6ULL, 0xe029de2b280ecc0cULL, 0xa446ca38af3838ccULL, 0x5297a9c15d9c19afULL, 0x871266c8729eca5eULL, 0x38c348428ffe5994ULL, 0xddabdc3fa8520037ULL, 0xf5bd23b05b67395bULL, 0x86dad774557347b8ULL,
+        0xf89dca50a62e7ea5ULL, 0x739e73ef728e4f15ULL, 0xc32d89ab8a501a9aULL, 0x7812ab67be713e2dULL, 0x33c7c160f693eb3dULL, 0x3478b913be3c1c60ULL, 0x9bca92ec2e8068a9ULL, 0x22e433a048f83cddULL, 0x8b6f33b0cbccda96ULL, 0xfcf4a305cd621e85ULL, 0x6a1f5894f32b20cfULL, 0xffeb6de8f1576e3cULL, 0xfc0678eb94780812ULL, 0xda31afd0fac2ae0eULL, 0x7eb51c4c528bc93dULL, 0x3ff2e79850b50c7eULL, 0xbfa41f555f18957dULL, 0xf9e3338c9252e15fULL, 0xbbfc607c23899897ULL, 0x60b9e36eaaf3ee93ULL, 0x6fa8efbe7651e286ULL, 0xd83d486271640a66ULL, 0x5cc76b0dd78b972bULL, 0xa58c90629dc0c6d4ULL, 0xfc6e1fd93d0b3884ULL, 0xd423f45aad59de00ULL, 0x4c5d4cf071c2e901ULL, 0x1b599c001f21d7beULL, 0xf56c02321d67a763ULL, 0x4bef13d4b4ef17d4ULL, 0x7f6095975245f327ULL, 0xca08f7bde0ae8c50ULL,
+        0x23260449efa8d358ULL, 0xfdacee8b9ce35fc9ULL, 0xeace49d490e9554cULL, 0x6402117b85163868ULL, 0xc375fde7ba37e932ULL, 0xe3f8763f2944fe91ULL, 0x75c04d770a87d2e4ULL, 0xf55162cdfad533a7ULL, 0x0fcf88b8bbfb3fc4ULL, 0x19aa8899822ae7efULL, 0x00e29e3111a1affeULL, 0x343d340a9776c867ULL, 0xe5e8a282ff9c3b36ULL, 0xb4c40bc7782908d0ULL, 0x5d77d9ea9964319dULL, 0x1405f242e36d5936ULL, 0x77b00afeffa4c6b5ULL, 0x37b65c04def7c932ULL, 0x1d0b147d751accbcULL, 0x87c10f93b8cb6c68ULL, 0x56a35fde12f128a6ULL, 0xa6be01db4981a168ULL, 0xb6f8d00f1d17f203ULL, 0x977353a6f36e64bcULL, 0xca7e60943721ced7ULL, 0x093b015240f45282ULL, 0x21891405ba4ef8e3ULL, 0x0efe0df1e427ded8ULL, 0xc8b1c4067fad49bfULL, 0xbc393f06592a361fULL, 0x937d5902f3dbe421ULL, 0x2eaade2e11ae18f5ULL,
+        0xed71135998107b11ULL, 0x19d11bf0d3b9e9e5ULL, 0x15bd340ddc7ec714ULL, 0x2690435319d7b533ULL, 0xcc7fd2ff755661c3ULL, 0x179263cc0e91e5ddULL, 0xc1e692fe843d6862ULL, 0x6fbbfacb7fd9784aULL, 0x95a91ac755478af0ULL, 0x01212f9c9ce29b6cULL, 0x710388a070e967b9ULL, 0xea45f7f0a7c93578ULL, 0xcc39c1a4de8dac08ULL, 0x0571a2310dc781e5ULL, 0xea6e26cb09da4d06ULL, 0xe6a1d15551e8cbd0ULL, 0xd3d141647918aeebULL, 0x28a8788b4de17cb5ULL, 0xe9102bda48a15e2dULL, 0xed7c07a3210fd972ULL, 0x6288bd2d63731642ULL, 0xd20d3c6b43de9e24ULL, 0x4835583dae959ef6ULL, 0x15186c98a25b96e9ULL, 0x4c120eded4c36f88ULL, 0xfdd381b90dccc141ULL, 0x9878cd201caa02c3ULL, 0xecf85550498bc4d5ULL, 0x00f8efb276145d43ULL, 0x9cb0b40fec837312ULL, 0x1401bef5d51963f1ULL, 0x6517b0efc0857c05ULL,
+        0xeb4dcf8eb148adc8ULL, 0xb228461404d7548fULL, 0x9c57443814d34f2fULL, 0x704c581db44990fdULL, 0x50bb08bd8aa07f35ULL, 0x2d7ff9977b8269dcULL, 0x1699f3b9a03fea7bULL, 0xe3b59338e945f4b0ULL, 0x169a29180effe1a8ULL, 0xa98ee2811ad8b894ULL, 0x92d3e3044bbd3bf0ULL, 0xca91901bb3ea4bbfULL, 0xff9cbb993eacd43fULL, 0x75b0b50d2cee6e98ULL, 0x928634b12d9cd7bdULL, 0x93ffea3f02a156f2ULL, 0x5be165d196bd966fULL, 0x2c1d856e5998d15aULL, 0x211b6893c9ba4ac5ULL, 0x9067b083e5e382ddULL, 0xfe8eb1e195e8fba6ULL, 0xef9568610e849524ULL, 0x958dcb91e7741a3fULL, 0x42524feb1e3c838bULL, 0x01492632ae3c8b3dULL, 0x7d2eb974f56cb87cULL, 0x4d15130801e16192ULL, 0xb322b4d143bbc5e1ULL, 0x21d8cbfcd0e388c3ULL, 0x6b683eb12e309ea5ULL, 0x672eca25b98ed2ffULL, 0x56dbbfbc6ab07852ULL,
+        0xbd94fcdb145beb0bULL, 0xe7cb8e0c1c1a8db5ULL, 0x02c49b668a8ca499ULL, 0xf3f17f8b6a5f901cULL, 0x75be658441d68c0aULL, 0x8a908c8dcf7d8a87ULL, 0xb0bccf8eff72d3f5ULL, 0x4d706fe17fa98508ULL, 0xa2a7c7c3fffc062dULL, 0x47cad83240de5429ULL, 0x5c5d42d0466011acULL, 0xe3a28ead8f0370deULL, 0x6a3802cdf3ef0eadULL, 0xac1a9f4b0e0c5143ULL, 0x28548519cf881610ULL, 0x7660ea91606f60acULL, 0xcadd14f9484daee1ULL, 0x5ce40e2a47f41fe4ULL, 0x2d8f5c816ee8509cULL, 0xe974a38b88be5b60ULL, 0x61c514b2f2e4041eULL, 0x7dd07da3bec34fefULL, 0x383d5bd7e743bf6dULL, 0xd99e241cc1a64bc4ULL, 0x764a3ea45cf4669fULL, 0x3ac642d9e06d7542ULL, 0x0ddac42bd01bf311ULL, 0xc1a1315903db6210ULL, 0x3b34cbef01cdd410ULL, 0x5a676889dea7ddd0ULL, 0x82e383441a37b03aULL, 0xe5a6988d484c64e6ULL,
+        0x8138f1024d53ea94ULL, 0x8299d1aea63a5457ULL, 0x1b494328d9e26d30ULL, 0x23a134b94b8905feULL, 0xa28476aff6d70040ULL, 0x10a722efd9a0a409ULL, 0xb3be75c2378ca2e7ULL, 0xc8ff7e83eed51e4eULL, 0x7d04091f3633d7d0ULL, 0x243d599744987cd7ULL, 0xd22efb587a389ea2ULL, 0x40d692e4037eb364ULL, 0x44963f8063daa9aaULL, 0x4697a52db92a258fULL, 0x49674bab6aea660fULL, 0x51bd98a7b842e4f7ULL, 0x20fe36c6674d08bfULL, 0x4de200e7f5a7d09eULL, 0x06d9bdbaf12fa450ULL, 0x0179f39064972091ULL, 0xed1d25734feae77cULL, 0x9ec0fdff6d942c4dULL, 0x54f9e8f0b5decf23ULL, 0x4b57820d8618744fULL, 0x67e8635c36e2388dULL, 0x27a0d33abbbee163ULL, 0x212c3d0d942429b9ULL, 0x7889d6eca0176106ULL, 0x26f8287835e5f147ULL, 0x948c5af2e893560dULL, 0x8fce17b28318ae5dULL, 0x9c69882e923125deULL,
+        0x449a3c020275d310ULL, 0x11cea247d9426e7bULL, 0x0b8fc7c38a8b0badULL, 0x83b00354a137651bULL, 0xdace4732c375beeeULL, 0x7b93be79918049ecULL, 0x1d3f9f42e1c446faULL, 0x0b8b5451fe1fd7f5ULL, 0xd237ba0e176e1ed5ULL, 0x703a5e18648f5165ULL, 0xbac11eb8b26f0e46ULL, 0xca1c5fb0974a826dULL, 0x2a7c57b12212690bULL, 0xbc3726fbc834e7deULL, 0xc1a93fb3eca930abULL, 0x7a7c7b9ec3597687ULL, 0xcc759a51a5fd2fd2ULL, 0xcf3d2c0dc6ab1ea0ULL, 0xcd17665e0987a0f3ULL, 0x481d5dbeb0f83ff5ULL, 0x531a9ced41611a59ULL, 0x73a432e8f5230798ULL, 0xd16b9a10ab9b3acaULL, 0x3cf8e8158a6804c4ULL, 0x003e0ccbd202bae3ULL, 0x0b573e43204ec50dULL, 0x9fc1615ca0f660b9ULL, 0xb381d62754acae2cULL, 0x7144abb3e9643f91ULL, 0x3e93641aeaf5f7c4ULL, 0x9c539ab350121e49ULL, 0xfd5575830d71d1fcULL,
+        0xc0469adc906fd27bULL, 0x9ec4217d22e9e55fULL, 0xd2c2d85608479822ULL, 0x1e87c09b6e5c6374ULL, 0x2a81fb1bb2f7c3daULL, 0x22b9b64013d2b8faULL, 0xe0cad2fd01cc8dfdULL, 0x6d0d221fdb1718d2ULL, 0x7abafc3af7caf54bULL, 0xe60cb8fc7ce3d650ULL, 0x2727cf586c60c55aULL, 0x90d766e50a97f072ULL, 0x407470a3cf8ac5bdULL, 0x31e137ef695db033ULL, 0x7a38c375931bfc51ULL, 0xe2a5fc263d08abc3ULL, 0xf0ba05888791bdd9ULL, 0xd47194ce2cdb9c82ULL, 0x19c8d64b313302e9ULL, 0xc7d4b728bc2a1040ULL, 0x801d74dadbc21713ULL, 0xca16b07ea9627aadULL, 0xae2a2cfe7d9f0dc7ULL, 0x78fca6f4242c6debULL, 0x02bb0c221b839fe8ULL, 0x4dcac20154335cfdULL, 0x0191bdedbd3ff5e9ULL, 0xf54c17e756e1758bULL, 0x6b8bd87819b82814ULL, 0x67a41ec69958a120ULL, 0x57c12243755b351dULL, 0x76a19322068fb59cULL,
+        0xbae7b5af566bd9fdULL, 0x0a411a3f668f3c90ULL, 0x6215fb1c1c9a9e1eULL, 0x5ea426fdca4ea5f9ULL, 0x6b2afbfbb8a4a15fULL, 0x0cc7870ab2c3f174ULL, 0x2c78d19cc85a6764ULL, 0xb00443f1d528ee53ULL, 0x8d9786fa43c09a1cULL, 0xa349d9eb954cb24eULL, 0x15f195bd513d6da4ULL, 0xc6f021e75b206063ULL, 0x873433193a93bf07ULL, 0xe606caf50f5b0e83ULL, 0xcce874f3af2c06feULL, 0x8ccb7dc6ebf14ba7ULL, 0x02b651e226975ef1ULL, 0x27b5a79f48d745b6ULL, 0xa94ed03bde724633ULL, 0x57ba9e454e6015cdULL, 0x869f58daab902400ULL, 0x0af3ba8e5e2b19d8ULL, 0xf3a63062fb37a9a7ULL, 0xb0c1f814b9df11a4ULL, 0xc0e02ff6b067adbbULL, 0x52705bbe20c490b2ULL, 0xb45288b083d90002ULL, 0x6a06421168fc1185ULL, 0x06ed406fc2c6ce60ULL, 0x8a10c603d0ecec88ULL, 0x28ff5bb000847d27ULL, 0xd2bde358c9a2ff70ULL,
+        0xfefab04abc5b82cdULL, 0x58cb4c3491a65170ULL, 0x8ae76eac3093852fULL, 0x055186fda788947fULL, 0x5efe8cfd5400db36ULL, 0x46bb96821f8cef8fULL, 0xf6fec12707576393ULL, 0xb8eaa5af3ff8ce29ULL, 0x824e4152669647f8ULL, 0xc73fd21857e36deaULL, 0xdbcfb3f147795839ULL, 0xc70ed61962011165ULL, 0x6c1efd67d1507d94ULL, 0x373ca60f75157f20ULL, 0x5e6e6840859111f3ULL, 0xa472c1ac28892cedULL, 0x484a5acadf492e56ULL, 0x62e9af953d3e5febULL, 0xc78076aebe055259ULL, 0x2e3b2c62ba7afb67ULL, 0x25c8852e8f3d0d89ULL, 0x8007edbd7bdbf518ULL, 0xa8c032fba2605c2eULL, 0x74bd262c59e2bd68ULL, 0xd64b4fd4b16c5779ULL, 0x9cbffe6dc24fac5fULL, 0xbcc2ff62d9e14d46ULL, 0x9dd031f8de33c196ULL, 0x4f8ee026cfdfa37bULL, 0x2955992a2d916702ULL, 0x03fe60d1f72fa3d6ULL, 0x9940fcda09d9c6bdULL,
+        0x47771daa3d03d8a6ULL, 0xb4cfaf05eabe1d53ULL, 0x006bad8eef13392fULL, 0xa9390163f1e09915ULL, 0x4c2fb71f4c376392ULL, 0xd0608255944ce23fULL, 0x13ee39cd53b2b980ULL, 0x35a3fba7023c8f6dULL, 0xa212cfba45cb0624ULL, 0x6faa313940ae5442ULL, 0x4c180df00c84292cULL, 0x4dc6df21ad72c013ULL, 0x4e952f8d86ea07aaULL, 0x396b7cdd2ddb8900ULL, 0xac0c32aa91fbf1f2ULL, 0xc62e8db6bda5b945ULL, 0x24dca8de50868227ULL, 0x5ea721aea51a5d80ULL, 0x97727ac890076783ULL, 0x8245035296987167ULL, 0xff83ce426e3e9f4aULL, 0xea672af8b6952cdbULL, 0x0d1ec4741afd3dc5ULL, 0xa17b820335f898d2ULL, 0x21d27e28e48e66feULL, 0x7a601c90215c3e19ULL, 0xb94626b9ac1702a9ULL, 0x9ca2c2083b622357ULL, 0x9f02485beca0a41cULL, 0xe91819ffda95b275ULL, 0xe00a4b861a3d2bebULL, 0xbba586378049d251ULL,
+        0xce480b7655348acdULL, 0xa16fe0be5e3ec4b8ULL, 0x9e04aa8f3a3aa8b9ULL, 0x6908c713630b8a01ULL, 0x4c362ed604fed856ULL, 0x8f3ae2bf5e885c9fULL, 0xb22ada0e19aaa48eULL, 0x4d693dc6d086a465ULL, 0x2f9a3430783f0d24ULL, 0xc6b9305b5d651354ULL, 0x64e8decd564b860cULL, 0xdf66bd790c1fbd8bULL, 0x38765b0675407bd4ULL, 0x0905f09555bf377eULL, 0x8e550a8826a30763ULL, 0x43ab73aa6947fad8ULL, 0x0f53a44d2451dbb1ULL, 0x633bf4933fb20f45ULL, 0x84c0484c7ad6014aULL, 0x4bcac9eb06d393a1ULL, 0xaad4d4e7b09cda3dULL, 0xc36edcb8191d482eULL, 0xce2bad7e6bdac0e0ULL, 0x6808cdca604d317bULL, 0xf0f8d4c2ebef5561ULL, 0xd6a9549cab77f6d2ULL, 0xac713575d690cb5bULL, 0x1e73efb30a47db75ULL, 0x6df589e97681f5edULL, 0xd531582f2e844294ULL, 0xa0c125c8888d249eULL, 0x6443dd4e6d99e01bULL,
+        0x60d5e63e58585b5fULL, 0x47bf2adb9da6cf9fULL, 0xc4139363d9186327ULL, 0x8f9f2c459e545168ULL, 0x2bcb0cb8a21d661dULL, 0x349e82b322dbad06ULL, 0x205f5c1df07d3e81ULL, 0x3a33f16e69903a5aULL, 0x54db0b5de6a36ca5ULL, 0xb77ffb3aea0dabddULL, 0x2a122bbe082bd04bULL, 0xafc3fecdfe56c423ULL, 0xf19eb5c5c7ecf4f0ULL, 0xbde7dc342a14855eULL, 0x86cfc1967df76343ULL, 0xe274bc83095eefb5ULL, 0xe0906ce23bde6a83ULL, 0xfc23619e31ca4b93ULL, 0x7468ddb85123f734ULL, 0x1a66cbd14168436eULL, 0xeb060a4beaf6b18fULL, 0x86f16d2ec8001657ULL, 0x2962284fbca8d2f3ULL, 0x53297b897a16c25aULL, 0xac151424e49bb2b7ULL, 0x8a89ec0991e13287ULL, 0x1c6112f0651ef4dbULL, 0x8325798ca0976ddaULL, 0x63e6832a38ae4048ULL, 0xe2936104158f9a1eULL, 0x35aee8b5230482dbULL, 0x4003486971d2657eULL,
+        0x1731d1c270670bb2ULL, 0x63d121347836f91cULL, 0xeb7bb4bc10ca1300ULL, 0x0a31868cbd19857fULL, 0x18447055af9aa572ULL, 0x689e11ffe8edb90eULL, 0x26b8465df740b324ULL, 0xc91b041d2d2d97deULL, 0xb9caa5ce1e33056eULL, 0x65a566ac332028deULL, 0x10290f0083c384f6ULL, 0xf91a389250e05088ULL, 0x12286e908274cad4ULL, 0x7358799ac5ed7b21ULL, 0xaa14f833b5c57fe9ULL, 0x374560a7c5389a81ULL, 0xbcec2d1276726f2cULL, 0xa2dee172f032c289ULL, 0x8b5988ca1c5377fbULL, 0x452956727251404fULL, 0x6d3d8de04fa1c994ULL, 0xe95a332995f9fcdbULL, 0x7d8c02f98cda77e5ULL, 0xcd8e4f57b2ff16ecULL, 0x3721c0f1ccb27629ULL, 0x95c37950d4e91dcbULL, 0x55656622706be9aaULL, 0x626997865bf8e700ULL, 0xf60b3f925802a67aULL, 0xf7518095b07f6afbULL, 0xa300a89cd0e91d40ULL, 0x514c4cf88aab959cULL,
+        0xebaa163d408be845ULL, 0x698697b97aa896ccULL, 0x80eeb76ccb8172c8ULL, 0x093323e08260da3aULL, 0x349b0e222e4a1952ULL, 0x06b1c479bf2ebf9aULL, 0x73f4ac9b530a219fULL, 0x6621236d76b4bec8ULL, 0xc0d4e1cc7a47b81cULL, 0xad40d9ace1587bceULL, 0xdf06ad637d27f6c9ULL, 0xda419b5612cb6253ULL, 0x34d9bdc3ec587a77ULL, 0xcc90b5392880b2f1ULL, 0xf516b6a9a1b92df0ULL, 0x9316a0468635943fULL, 0x46f796b4b2a0e544ULL, 0x9de4a07a4cc5c555ULL, 0x4140781e406e3acfULL, 0x9f4d8d5084079350ULL, 0x15b62f562562e999ULL, 0xaa5445be11c86b42ULL, 0xc8ae9537f11493e7ULL, 0x9596d8cae78e1cb8ULL, 0x3413b4a39ee13659ULL, 0xdc84694b197ed4cbULL, 0xc7e7d87334a7fb3fULL, 0x8c7539878a7bcbe6ULL, 0x7e012ad98725c738ULL, 0xef3c2714fd95ba10ULL, 0x240e988b7d77a4b6ULL, 0x926a709f175d9d31ULL,
+        0xaaea5662b4db5792ULL, 0xb6d98107a88ee6beULL, 0x57dd372d2383e86eULL, 0xdc93a5ef7afc9f69ULL, 0x4ffaf3c417265d23ULL, 0x976b3bc7d3d0833bULL, 0x309fbcfc7d72b6e1ULL, 0x0d86c9efcb7f26c1ULL, 0x726d604a91487ba9ULL, 0xb5da78e56f62015bULL, 0x5e299c1c64b8329dULL, 0x3131d2ddb24d63b1ULL, 0x391e81eb502c67bcULL, 0x38619d157cd1fa19ULL, 0xab89da8e305678f7ULL, 0x11aa6c48e0308cd9ULL, 0x09cfd5ea6c176d67ULL, 0x105d1cbefa512384ULL, 0x1e4e971028f96af1ULL, 0x1f24fe96e4dfc778ULL, 0x82f982fa7cc5680bULL, 0x4900db8780da1dbfULL, 0xb91e177df8ca9a6aULL, 0xee6d5372f4be1f35ULL, 0x9239ad07bcecc54bULL, 0xf29098578aeceec7ULL, 0x20cc85fdb06d1fc9ULL, 0x4d2c6ec2b737d433ULL, 0x1de7729a5126b6c1ULL, 0x3d5c7d1b03ed45efULL, 0xaaba0b1dd14fbf25ULL, 0x8f33b85e7a2b6b7cULL,
+        0x7e7000c2b799519fULL, 0x4d2522ebf464d21dULL, 0x05f0f4172d9c8014ULL, 0x2d7635eac14b4738ULL, 0xe4bbd8497594df45ULL, 0x03449e7f0e9e27dcULL, 0x100f8919b1903e14ULL, 0x667f9bcbb1cb38f8ULL, 0x4a5f00524d5d100cULL, 0xddfc52a95e434fc0ULL, 0x88b6d6e595279a34ULL, 0x19d76d096fe3fdb9ULL, 0x71b87686341166a8ULL, 0x23f296bd43c914d7ULL, 0x6ee397876d16ef37ULL, 0x6b5105843372e1efULL, 0x32c7ff6168223404ULL, 0xcc3f9d85fe08a32aULL, 0x360578d8732460f2ULL, 0x9ff85cee9d77d325ULL, 0xfe6a4aa56fcfd3e4ULL, 0x2a0e115fb22b566fULL, 0x658b771bd7dab05dULL, 0xbd1f32483b6683dbULL, 0x3ceaa393a014f388ULL, 0x685104dc0f1b193cULL, 0x9c77a4178002f51cULL, 0xab790042ff81f720ULL, 0x4153433c60cbd18fULL, 0xd8644f19a22b7535ULL, 0xe1c8a4e6447c739dULL, 0xfed3a527588c84c9ULL,
+        0xe8eceb590b710f46ULL, 0x1717ab31f8250f43ULL, 0xd737cc58f57fcb17ULL, 0xb013fbeaa1b41553ULL, 0xf604b0aeb9697fecULL, 0x2388966534db3c62ULL, 0x33c8153dea8507d9ULL, 0x39b1f93694d3d908ULL, 0x2ab95be3232a1830ULL, 0x2876297a32bf673dULL, 0xdb7b2f6e98ca871cULL, 0xf071754cf88abe6cULL, 0xee51b20df76491eaULL, 0x0c68e9d97aa67991ULL, 0x9660ea82e377b29bULL, 0x2ce68acf3e4c9ad8ULL, 0xf6d5c8320cb4569eULL, 0x739a332c11f3c813ULL, 0x5ece74819582318eULL, 0x7b9c38cb89bd72baULL, 0x1cdd64bce87eb831ULL, 0xc7d9133d50f69402ULL, 0xeeb956329b21eda7ULL, 0xef08ad89f60c02e0ULL, 0x01d6b9e2c50379c5ULL, 0x8b1ed35c4da8c1feULL, 0x752f943b3acb5806ULL, 0x5095b96a5468a2fdULL, 0x22c516109f5b887dULL, 0x698dbddf8b376c08ULL, 0x8ed1ca6fe6182a1eULL, 0xa1aca350c84e0889ULL,
+        0xe1a4ae74ebd4e72eULL, 0x65282e3c558dd7c1ULL, 0xf251fd9aa97d2c88ULL, 0x42a47bdbcccb84b3ULL, 0xc96ba36a4ee4eebcULL, 0x23f8d938a92811f2ULL, 0x0fcf4cf58bdea417ULL, 0x2ca2ceba05dc4d0bULL, 0xdfe69e39782f8aa2ULL, 0x042d11be79c21084ULL, 0x70f18fc862d73f6fULL, 0xd2486ae9250babb0ULL, 0x65fca44f4c16c798ULL, 0x0742e5ee63593e40ULL, 0x9da54cc1f6f4c245ULL, 0xa711cafe9f327191ULL, 0xb882973b1d4e5488ULL, 0x832f27bfb0a50ff3ULL, 0xcced9ca2371d02d3ULL, 0xf42c3d08d789a924ULL, 0x45f2cd969c5340a6ULL, 0xcdbf63768c3ed7f0ULL, 0x3c6fa7fe53847276ULL, 0x88b4dde062403d64ULL, 0xa14e6682c4064258ULL, 0xb33b9065a1a91ddfULL, 0xdfcd06721447e379ULL, 0xaa301c44b3d2d9c5ULL, 0x879742bfc0d1b738ULL, 0xaa2258203c742754ULL, 0x4c6450b11aafb0d0ULL, 0xfa9d74cba193bd29ULL,
+        0xd8831ab8ea7d95a4ULL, 0xa20d50ded5db2f67ULL, 0x2c293c15ee0d3080ULL, 0x47edec35bfae02f0ULL, 0x2925f298ee4a7885ULL, 0xa40bea68242bf6baULL, 0x7555aaec9bdd183eULL, 0x81a7db6867ad3f57ULL, 0xa741f0057d3a110dULL, 0x08cf2c2545a999daULL, 0xaf62eae87938db3dULL, 0x1098f3b6dbfe164eULL, 0x97257bd0da5aea28ULL, 0x5f86f2c4940ffeb3ULL, 0xe446d4da54cb87adULL, 0x37353f0a02740ab9ULL, 0x27b31f111033aa05ULL, 0xc5e9463013e40d87ULL, 0xe9a92e616d7d14d5ULL, 0x7712a6cbf9e8f0adULL, 0x7002fac634155f23ULL, 0xad9fb5b692966ab0ULL, 0xa537b0a60e650668ULL, 0xa28b1bd2eead0a99ULL, 0xdd168911ec9d5c50ULL, 0xbace88e436f72caeULL, 0x68fef4c23bfc0cabULL, 0x01167347ebcb7a0cULL, 0x37313dbb76641b40ULL, 0x0c653574090ac2e0ULL, 0xf1f47697e0156e5eULL, 0x117c7cdd3865b6d6ULL,
+        0x8df16aa5d3008b7fULL, 0xc8b9ad97d7e784bbULL, 0xd050891deb5e786aULL, 0x19b335bc72165131ULL, 0xffe9f35e0d7f7329ULL, 0x407c85451db6ae9fULL, 0xd1d8275b00d0aa85ULL, 0xc13beb110b39958eULL, 0x20c50f897d57cca4ULL, 0x0d430326cc8c0a26ULL, 0xc70c4708b361b31cULL, 0x82e55d6adffce615ULL, 0x0263d1b2d1c871d0ULL, 0x0418d6cbe8154997ULL, 0xba43b7060ecebf88ULL, 0x41016f69db72b84bULL, 0xf9f8b878f7d8b4deULL, 0x91287398dd41f5eaULL, 0x69a2326c59d47b88ULL, 0x86f774a7c47d947bULL, 0xaa64e106ca60c62bULL, 0xbed7ab30006e7455ULL, 0xef26c81d83bfbee7ULL, 0x184923507d5e97deULL, 0xdaebca2074a8a34aULL, 0x74ec37806d1cf36aULL, 0x61c6057bce216cc1ULL, 0x1fc7385c24d077e7ULL, 0x412fc6380d679143ULL, 0x0332dc7a22007abbULL, 0xff7a6e74fa41d7b0ULL, 0x18073d08399cc24fULL,
+        0xe264a718f709a025ULL, 0xfcfd0467b0d12bccULL, 0x50b64967f44023b9ULL, 0xeaff96c401ac430cULL, 0x1797f84e38df4defULL, 0x49d51426dd664626ULL, 0xf3f221eb8aff0e7dULL, 0x3230d3c32a758c65ULL, 0xfddf81949a7ee954ULL, 0x07be990f17d88fffULL, 0x8645fa16533fdeadULL, 0x6e27278b8913031bULL, 0x84ed33e8c84e6642ULL, 0xd53d28de0f446cd7ULL, 0x10dbf16ec28fa35eULL, 0x5aa9a5df48c5dc03ULL, 0xea9a81d6487d0db7ULL, 0xdef829967a5abd86ULL, 0xf2496e1bdda137ceULL, 0x512c93f5da24657bULL, 0x6221369540114e5eULL, 0x27e98f526a51ff13ULL, 0x9a745f9f1fd0e139ULL, 0x6ded99558d93eb54ULL, 0x03b2aa609e18b758ULL, 0x9fe72c3846bac643ULL, 0x250b30a87ebe5bbaULL, 0x7458ae6427943331ULL, 0x4ff0843685b62ca0ULL, 0xf6396f13cc8ce2a1ULL, 0x92284d97e5eb58e6ULL, 0x881ecc8522503c3bULL,
+        0xd0cef71f8f78b10cULL, 0x1642cca739c7483bULL, 0x903427fa9f38805fULL, 0xf5ed4836417e7fa9ULL, 0xcce7a6405116bd89ULL, 0x0eb38ab42517b3adULL, 0x1a3546371631873cULL, 0xca48c2be9a34e6b7ULL, 0xd897148466fe60e7ULL, 0xa9b8a7cbf68ea2f5ULL, 0x6c1e7232e0d8f592ULL, 0xc8a8e9bda9a727b6ULL, 0x49aa129e13810411ULL, 0x1fda93e3228fdd7cULL, 0x2028615cd6c10ab2ULL, 0x0187f567e74c0b02ULL, 0xe3bd5d5b5f25ba3aULL, 0x6b7acb986071f202ULL, 0xbe214a4233592694ULL, 0xdfba869bd5c9d744ULL, 0xb31e928ad15cc447ULL, 0x8d845bfce6d61589ULL, 0x9860b27edceab2aaULL, 0x7e676fdfeb928eb8ULL, 0xef8ede2ec6628521ULL, 0x7a0967d5cd5f953bULL, 0x4201bde999e1f1e2ULL, 0xe00d6dfe3f8bfc2cULL, 0x52c8bd0dbad9dcdcULL, 0x2a743c0af109e3bcULL, 0xf6dab1a6b2219c5eULL, 0xccef1d5d467b3102ULL,
+        0x5ee5380a31f76fe2ULL, 0x00e947e3cd512f6dULL, 0xafac10d2f760bf89ULL, 0x0e68420950397239ULL, 0xe854949b9783730aULL, 0x08f5bd834a996545ULL, 0x15173693f3f42242ULL, 0xc917912942bd4b41ULL, 0x82edbe72e7969fd6ULL, 0xa6bae00c01b6efc1ULL, 0x37bddb4e29f55f76ULL, 0x826e369b01409df7ULL, 0xd451ec76a6073569ULL, 0x970b77df467d0b6fULL, 0xa020e9485dabd100ULL, 0x567b5b5542cbf027ULL, 0x7f108cbed50c03f7ULL, 0x4d51f71f1d2eb9abULL, 0x56308847b1bf9407ULL, 0xcb0cc30a954ba16bULL, 0x2c867c8f89a7c695ULL, 0xed311efe3af6ec79ULL, 0xb90e36dd1f8f8d2eULL, 0xca80f0f6b0860eafULL, 0xdc4215a8dcc4e2ccULL, 0x5012f1398b0fbd86ULL, 0xbd5526da2b9fc2c4ULL, 0x9eb0a036a9eb0f83ULL, 0xf480c25fef801857ULL, 0x367fe3bbe58a1c27ULL, 0xa28a77c94a24bafdULL, 0x37c519010b81b3dbULL,
+        0x92b70fba8cc855d5ULL, 0x4020826eb9451ba1ULL, 0x193998f7f3193f41ULL, 0x7e0065999f2b9751ULL, 0x3c3a6258b14f55c0ULL, 0xe6150e742cd9e91fULL, 0x5139f2c4ed9b47aaULL, 0xcacb8c8c0c212c49ULL, 0x47554ae4c6c58750ULL, 0x0e8643d1bbbc7535ULL, 0x9191ea5374154d5eULL, 0xa9c8d2c03ee7f3f1ULL, 0x864d8d6bfdce7453ULL, 0xf7dfd5e8e27c3f6dULL, 0x2749015d50ff90dfULL, 0xa0fb146e54d5f5deULL, 0x24c188fad752395cULL, 0xd7a6fc7da7a4ecf7ULL, 0x532a4306a5a7ae56ULL, 0xe450d3ef08bae231ULL, 0x7b68c51001964e43ULL, 0x3c8036ff53ed4cfaULL, 0x5671528f226e62d3ULL, 0x45f4285e172f442dULL, 0x55ea47129ff38413ULL, 0x6a2117c150a28a68ULL, 0xeb9782a6ca576afbULL, 0x0e04598677b0e8fcULL, 0x0a6ce75e9dc524adULL, 0x6cec12371409830aULL, 0x1db81b558a7c9783ULL, 0x30aff106e8da5465ULL,
+        0xc9a987b18fe00508ULL, 0xc03650fdb889e789ULL, 0x45b62357f509815dULL, 0xc91630c1629982b1ULL, 0x18341815ac275b45ULL, 0xbd0b68817eff8d01ULL, 0x2fd3530cdebd9286ULL, 0xcfa0bf7308ad1cc5ULL, 0xff255abfa658bb85ULL, 0xb285ca8a5e9e70d4ULL, 0x0367acbdfb5488f6ULL, 0xe43324baa9718d96ULL, 0xd45b592fe3f4601fULL, 0x8f6b273d94bcf35aULL, 0xd987ecb071e554e4ULL, 0x73f5a9ec150f746cULL, 0x54765c64029d5664ULL, 0xe543167bca0b5c95ULL, 0x71aed09297ef86b7ULL, 0x87adb108b6349703ULL, 0xe6452fd15deebbddULL, 0xbf50dc04a2106575ULL, 0x7c096a593cca23b1ULL, 0xf5e08c5a4dd16c69ULL, 0xaf1ac74bb51df813ULL, 0xda50ab4085d29039ULL, 0x2783bec62e4dc3d9ULL, 0x890a1d87b2794d1bULL, 0x5e0ac8e82c8f9c19ULL, 0x63044ae95252e088ULL, 0x478b93b9111622dfULL, 0xdf55cd5f445032a6ULL,
+        0x6da47cad4fe7e754ULL, 0x7d810aac4c911791ULL, 0xbd120ea58d1cfd49ULL, 0xaf9c9004f71435a8ULL, 0xc36032f67528a907ULL, 0xdc448c98b511c4a2ULL, 0xb464f3bd33de4d27ULL, 0x7695fa0369c7ab6bULL, 0x942d657988130e3bULL, 0x4911bb4429cef8cbULL, 0x0e19157e233ab2feULL, 0xe4488cf488c52d5dULL, 0x2dbe9667d92885d0ULL, 0x94b9b4a60cdb12aaULL, 0x2fa2911c3b6842d6ULL, 0x7ac9d0f8c51e6e81ULL, 0x5615e3f006614923ULL, 0xfd359f75319b180dULL, 0x01b92c92016d7879ULL, 0x1c01db258010b798ULL, 0x0fa5c69a1715b69fULL, 0xa8cb8f3b9819d371ULL, 0x8f5c7722984e8c8aULL, 0xea96e7ba60824035ULL, 0xb5d86b82e5002c52ULL, 0x34bf4f8b97aa5855ULL, 0x6ada8a392b9508c2ULL, 0x217f988af51e5f8eULL, 0xc05909cd79b91bccULL, 0xede989b271c8cbdaULL, 0x8192fd68331d667eULL, 0xcd0f80b052735e2eULL,
+        0x293bc870fa3def2aULL, 0x3e85311b50480f4fULL, 0x847ac13079dc725fULL, 0xd5b31fbd930a008bULL, 0xe801f76f0530f426ULL, 0x66457873d3ca785cULL, 0x335eb79259c2663eULL, 0xcc0171ce7578ae52ULL, 0x7123209689c45415ULL, 0x8dea642b5735210aULL, 0x7e50b6ed2aaafcf1ULL, 0xdf962ddc20d86f79ULL, 0x27e019fa33137c85ULL, 0xe6875326f526eb49ULL, 0xc91201a2e88bb02eULL, 0xce18fa0e45f27137ULL, 0xa3df72c199174ac0ULL, 0x9bedec2e369616d7ULL, 0x3fcc95959e18257eULL, 0x3580f8bd80f6db2cULL, 0x97f0583b7c828833ULL, 0x4a0ae23ed1867af5ULL, 0xe583c3029ff61f60ULL, 0x754c378d1cbc7252ULL, 0x83df3ea9030d5148ULL, 0x584c0ef2b9c38d21ULL, 0x8284ed751fd07143ULL, 0x50ce3ee889e26681ULL, 0x2e99eb06d869234dULL, 0xcc205b14ce5b8a11ULL, 0xcc8ce58a3a89c780ULL, 0xd2e397d483f42150ULL,
+        0x11153ee3d17a5f64ULL, 0xc60e5b7b0b2bb0e7ULL, 0x7a0d21b3ea2795b1ULL, 0x27a14752b9795a9fULL, 0xe9ae6a4f551aefd4ULL, 0x8f396de07106aabaULL, 0xa0425f727371da74ULL, 0xf618def5c1a37305ULL, 0xb03326a415667c9aULL, 0xc1f1890556d7807dULL, 0xe1f3b91b623920adULL, 0x359214d4c9c3e151ULL, 0xf719584660671067ULL, 0x22f32eceea1e144aULL, 0x2beb6a8d532f586cULL, 0x0669aaf792726180ULL, 0xce83622c090a4161ULL, 0xdcb0090e93262fdfULL, 0x02326dedeb59115cULL, 0xdb07443a79033405ULL, 0x8c71a2685e703c5eULL, 0xf87e7a8a43ad4c12ULL, 0x718309063dc3debaULL, 0x067e3fec745bc2d0ULL, 0x04236643776e0428ULL, 0xe97ac2a34c6be45fULL, 0x5a5a413259644dd0ULL, 0x12b6bf25cf4e5be3ULL, 0xd63a5ae7280a749bULL, 0x85bca52ac7f73caaULL, 0xc83f783552922deeULL, 0xa755ac9e8d4e680fULL,
+        0x7d2064cf3e28ec53ULL, 0x91e371bfb5972bbdULL, 0x183a2543c5b8d902ULL, 0x89fca87292e852e0ULL, 0x013f1f16b8a37837ULL, 0x9b09fcfea31b35f5ULL, 0x682aa0f54a7dadf6ULL, 0x5b0c89e40fefc36fULL, 0xc780dfc80d4c9d7eULL, 0x0332be70d009cd04ULL, 0x70e81627a63b61b7ULL, 0x50b5bbc6d8679237ULL, 0x121370cbe20af2e9ULL, 0x5b8b5551526a5e79ULL, 0x13e01334ae458150ULL, 0xb0fbf2ac76e66d0cULL, 0xe60513307934ba99ULL, 0x157a635dec5071b6ULL, 0xd6bbcb325e236cd1ULL, 0xb613cf789c2bb995ULL, 0x6ceafc53159199d8ULL, 0x9e4b439d85aa554bULL, 0x328ed0636a22115cULL, 0xc1a01ef73487501aULL, 0x198c8e0d39c3ae54ULL, 0x88edd498ec855116ULL, 0xf5a97b0fdd83eefbULL, 0xa358cd554216acfdULL, 0xfb560985a81b2d83ULL, 0x2a333a2cbc5abc0dULL, 0x57d8694104bba454ULL, 0x803ad1025f20c7f9ULL,
+        0xe8746dd20199bcfbULL, 0x60a03ebb883374c8ULL, 0x291911eae34ef3d2ULL, 0x8d3410714e2109d2ULL, 0xbf4da439b4bf62d9ULL, 0xa0d03d7e9378b19aULL, 0xb9b4137560758358ULL, 0x1eccbce0ee00c4daULL, 0x548fd68df8ca80a8ULL, 0x307c828a99bf2e12ULL, 0xcd63f92e1d26e6e4ULL, 0x4b5647f673cc1cb5ULL, 0xd25be6b69567839eULL, 0x98470758fe0fcfa1ULL, 0x647c77efb726d443ULL, 0x5fe1506c3f4f9981ULL, 0xef267302fbf314feULL, 0x0f550487c49dafcbULL, 0x371b3a1d916ee96fULL, 0xdfd16a9c66dad774ULL, 0x2bf99f85e2d963b0ULL, 0x38e725dba6f28ee8ULL, 0x5c16ef364a694d10ULL, 0x76366b3345317c95ULL, 0x5c22d1520ed576d7ULL, 0x3c0bc9e08b74701bULL, 0xe3c64be5a22a1c5eULL, 0xa7f37ca5f6a87378ULL, 0x96d5237dcf369a71ULL, 0xdaa040c2c06d92d4ULL, 0x61c7b173635ec1e6ULL, 0xe0a3151e51b998baULL,
+        0x49afeaaaa4cc48bcULL, 0x5e444a05bfce0e4aULL, 0x42224a695ad0be8eULL, 0x7286b5ca85fc1f0dULL, 0x658797fbddbc4f33ULL, 0xa918ad5aa30ca9c3ULL, 0x09aeefb96d2f02dfULL, 0xadbe3884fb8f7747ULL, 0x28f916d65a998597ULL, 0x0b7feae542640864ULL, 0x53fbd753acbf0213ULL, 0x38300a937f12363bULL, 0xa3bc2c2135717b23ULL, 0x4017544745d91fccULL, 0x292cb58b99e413f8ULL, 0x6e97bd229fd612eeULL, 0xfef4393fccaeb386ULL, 0xa22ab300592dc61aULL, 0x3578cab27c01064eULL, 0x4c05ea73009a2fc5ULL, 0x98b4a4c38f869597ULL, 0xc28412f084b9ea07ULL, 0x20b276627b333601ULL, 0x331a65f4b6c79052ULL, 0x4a928cea702042f4ULL, 0x3087f64800ae0fdeULL, 0x3086df5aa5162f70ULL, 0xc97021a9b61aa335ULL, 0xad01cf913addb74eULL, 0xc6611bac67691c5bULL, 0x6a7db39ae8ac0ca8ULL, 0x0dc2cbc54881fcb1ULL,
+        0x26e5cb09f66b6ccbULL, 0xb1bdbdef148ce90aULL, 0x9c7c87128a585177ULL, 0x5f3b79f43a0fab36ULL, 0x224542dc7eda1afaULL, 0xb4f6bc3787820520ULL, 0x234aae30e3ab2ba7ULL, 0xa3efe9eecff91752ULL, 0xbd4e6044eae3eb6eULL, 0xbbc8a6d73454f256ULL, 0x9d02c380137f88c2ULL, 0x9c6b58c8919912ceULL, 0xaa31041bc65d65cdULL, 0x05894ffb140e54c7ULL, 0x2889996576b591e5ULL, 0x8a47d41c404cbe28ULL, 0x246e98b421c12e85ULL, 0xda7bf2864e1f3347ULL, 0x0d146ee6c4772d3eULL, 0xb1e71b2020cbae8dULL, 0x0fd30796955663edULL, 0xf2b6fc1909c39a33ULL, 0xb737ca9f73dbe71fULL, 0x24ee16980d224ac3ULL, 0xd1e26bb4c44836c8ULL, 0x20e10a7c99ca6e3bULL, 0x0a3bc766cda03f89ULL, 0x3c358c7bf1d6f43fULL, 0xa32ff8f361f60bc2ULL, 0x85dae2d05f37dd70ULL, 0xf1f1f63162e3423dULL, 0x88374306d6660846ULL,
+        0x2cb921cf22e28a96ULL, 0x973e90f883877203ULL, 0x4e5ff4a70c33fde6ULL, 0x098e324686e11511ULL, 0x28bf63af66ca1d3dULL, 0x9a2f778bad60d733ULL, 0x3efa26968ba9bec9ULL, 0x4a3ba4afb040d141ULL, 0x475d8b3dc6c716e2ULL, 0x963c27688e01b260ULL, 0xc786d36db8f67a06ULL, 0xe0a08096a9f1683dULL, 0x0195b7d19264bea8ULL, 0x907d97d1fbc9eaacULL, 0x927767aec1cc8cacULL, 0xaa79a64d39aa30b6ULL, 0xf6fb8bf9d999e290ULL, 0x0bd90dc1f1c1b61aULL, 0x9b94a148ecd3e084ULL, 0x88c2e1efcab01653ULL, 0x2891aa73813fc01dULL, 0x64d25ef9956c432bULL, 0x2c75d62de10199b0ULL, 0xcefd2e4b32e37434ULL, 0x622f272560f75347ULL, 0x02bccf72683942f0ULL, 0xaefa891368493b7bULL, 0x9307efdd84c1a365ULL, 0x820fe0daf6f67c4cULL, 0x8938cb213bcd2ce4ULL, 0x2677467250a4ed28ULL, 0x0c10b87deacdb85bULL,
+        0xf4cf3731572974b2ULL, 0xdb2df62927924aefULL, 0x5d70ba0d7b9d97a2ULL, 0x9c4eaf809a5356f1ULL, 0x26d546c30ae4d3d2ULL, 0x6ca34207899ea7dfULL, 0x4f9e49a60d6fee91ULL, 0x54ef1f223d836ef6ULL, 0xae9eb1527488e213ULL, 0x7b28e663c6ce3838ULL, 0x58ae3793daa09e56ULL, 0x908f0729590f2aabULL, 0x91f92af8cc805467ULL, 0x273c55413e825684ULL, 0x0b2fcd55efda4ebaULL, 0x2b35a685a2158b87ULL, 0x502177d116d32886ULL, 0x7a9546dc0967dff1ULL, 0x3638611ada8ce2d0ULL, 0x593ab16b9cd4d1f2ULL, 0x454afeada488b09bULL, 0xe4553b42b45d74a0ULL, 0x6f0a855568458c45ULL, 0xf43c67d8b727b987ULL, 0xa8c0ea094817dd73ULL, 0x41925191bb2f9a82ULL, 0x9ff2d5ae8b7c1dcdULL, 0x16610ad073a5c964ULL, 0xfc8fbf6ec42a1a4bULL, 0x8ce2cf3b8e8c4b01ULL, 0x17fd05c1c354d677ULL, 0xdc98fdd467ca2d28ULL,
+        0xdd97ea1ae817c9f2ULL, 0xe3aff689caa4c493ULL, 0x63b34b6ab2740611ULL, 0x056cc39912dd694eULL, 0xbbfabf79206fee5dULL, 0x8f778d512c3a9ccdULL, 0x8eea222783ce0537ULL, 0x8ac2db93a497e8ebULL, 0x632cf9b890a929b6ULL, 0x0375353bfa120f83ULL, 0xc2471837727461b5ULL, 0x655058b540b47337ULL, 0xc4c38093acec0110ULL, 0x0ac07f3a4a2bb88fULL, 0xadb74d87f35e7b33ULL, 0xcfafd276b207fc21ULL, 0xbd76fc8be92aa6aaULL, 0xe392a173a9ff4aefULL, 0x3e1e8c4dc7a3ebc1ULL, 0x00116295f79e3413ULL, 0x3d426446fb85faedULL, 0x2bf1c823f12bdf4bULL, 0xe7ded505ebd22fc1ULL, 0x2f80f8babbab49f6ULL, 0xc260577c85daf442ULL, 0xb4e9ec0dadcf0a00ULL, 0x713f14e62cc7e43fULL, 0x89c8535e7bc175cdULL, 0xdfd2497cc3b923d0ULL, 0x4872a97094886869ULL, 0x2403cfa24ad88743ULL, 0x442d2f97b05d6547ULL,
+        0x3cbabaf02d667086ULL, 0xbe601e37e83a4019ULL, 0x470b417c46b64746ULL, 0xa2337a69bf23e7d1ULL, 0x539425b4192c192aULL, 0x870bc60b7e69a8faULL, 0xb53408d450d59faeULL, 0xfeb13c48d7707107ULL, 0x2cd258b77b7e5f26ULL, 0xae0683147b83593bULL, 0xe38925391d500831ULL, 0xa628e6b864d6f895ULL, 0xf5291763df4534eeULL, 0x88e0774af8d2d0f1ULL, 0x74c84c162b722652ULL, 0xefae1ec4495354b7ULL, 0x183034fa9bce82d3ULL, 0x6f4727e0adaae2c3ULL, 0x057d9f7fdf5b0a46ULL, 0x200e5941db31e6e2ULL, 0xec96c90601f08423ULL, 0x0bb78f245f48f733ULL, 0x557cd8dfd0d1b185ULL, 0x958228a686fe84fdULL, 0x6e7ff63ffd6fe9eaULL, 0x9129e3763a29da7cULL, 0x94c942d4009d63ddULL, 0xcabf434d23101876ULL, 0x040af02b5e07760eULL, 0xd131fa3b4ffe171aULL, 0x07aa1d2299de9342ULL, 0x4b961fd8e968b73eULL,
+        0x6b047bd0a0d56efeULL, 0x9a7692b80873c3c2ULL, 0xaded24a1056442a4ULL, 0x2b13287befdc6145ULL, 0xfa8e5da51ca51bfeULL, 0x803515cfd48290a9ULL, 0x3a190a99681a0c33ULL, 0xd8f1fde1871c85deULL, 0xe697012271139da2ULL, 0xdb72b050aee2b5cbULL, 0x950aafabcd930536ULL, 0xb3e4ca7941214c39ULL, 0xb7ca8e30c5113a90ULL, 0x54083aa401dab4acULL, 0xd62df7dfd5fad6adULL, 0x8190f2b5ada7e026ULL, 0x3fd571e5427c9101ULL, 0xf4ce27bb623ce867ULL, 0x425c855a68e15bbdULL, 0xe948a150258c9cf9ULL, 0xea5e4c518d1e3436ULL, 0x5d0b44f882738493ULL, 0xc4d2252bc6d91488ULL, 0xf23510011f039370ULL, 0x262d349c2013edc2ULL, 0x2ef43db3b79e1755ULL, 0xb35c51d5680a74c4ULL, 0xfdca2402cfaf7670ULL, 0xd9907e22363121ecULL, 0x88e76e29dea8f48dULL, 0xb2d77af32fdf810eULL, 0xc62f2103bce7e3d6ULL,
+        0x62ff6ce6838d469fULL, 0xa6314617acef2ffdULL, 0x1e0e1879ea7fb81fULL, 0xa45051af4f53505aULL, 0xb4ae54c0f2ef81c3ULL, 0x71106bbf478efe24ULL, 0x2c3ca29883e16974ULL, 0x3059850d1e0dfc66ULL, 0xe3e1e22511f52fd7ULL, 0xaee56659b5fbca6eULL, 0xc740a43cedeeef74ULL, 0x92d09be226ed9b94ULL, 0xf40ecaf037eab140ULL, 0x66efbcc830dd3d37ULL, 0xc2fac8fa353acd1eULL, 0x77c8b0124246ebefULL, 0x52d20e43c6612a99ULL, 0x5442c83a257138d4ULL, 0x9845f7177d211598ULL, 0x7f89278fdc9bfc10ULL, 0xfc093bd3f70d56b9ULL, 0x7330ea376773bed1ULL, 0xfb616b99608235d1ULL, 0x7493cad66190bd6dULL, 0x0b97ca219f69633aULL, 0xb016124f8de20140ULL, 0xaa79864cc90d4e37ULL, 0x0b2c9842b9ae9b31ULL, 0x1086a486020a0128ULL, 0xb3fb5c534d38884fULL, 0x0d3259de618d8550ULL, 0x7084f8b4829356b3ULL,
+        0x9be043705bc2085dULL, 0x068ad4290fae6abaULL, 0x1542f965f52a4775ULL, 0x0235311b612f6896ULL, 0x2c88bed114e9041bULL, 0x2be5997abc5559e2ULL, 0x3c1180103ae440caULL, 0xfb307f6ccc88c0d7ULL, 0x4e220fcd63217ffeULL, 0x39be00eed36423f6ULL, 0x58ea80bf186c8550ULL, 0x599a90ed6c64d797ULL, 0x97801908118324b5ULL, 0xe51b2668fa411d49ULL, 0x47584022b8d0ef7bULL, 0xc1c6aafcdc6cf49bULL, 0xa9bbb6367e1979dcULL, 0x4a232557ee3798f0ULL, 0x316b40ce59ac8cd8ULL, 0x1e8b1906048f7624ULL, 0xff9c26828908c0f6ULL, 0x59bb176bcb622d5cULL, 0x1869cca6c9732268ULL, 0xcbfbc585b1aecea2ULL, 0xaab8693e2896a09fULL, 0x3a9b3c8412bd50e6ULL, 0xfa6031e3c565da28ULL, 0xc20e2439f4594d22ULL, 0x9c313733e5d76845ULL, 0xbddec353f161bfe8ULL, 0x1f1cfc554c2474a3ULL, 0x8478d5e305f72673ULL,
+        0xcc0a7b6990ac9a13ULL, 0xcacf93757127abd8ULL, 0xc3c6fc4b4761dd58ULL, 0xadf7d5e3ed6db67aULL, 0x315f76a359cf2877ULL, 0x697c7828574c83ccULL, 0x5aa1ecb5a4e42dddULL, 0x7188fc85728dda03ULL, 0x7443b2e20619f853ULL, 0x6a7d0210b351e957ULL, 0x12e1b00404db66f8ULL, 0xc23f012085187881ULL, 0x3a19a05624800185ULL, 0x2f198772f936d58eULL, 0xbc3fbec1948fb203ULL, 0x3c9f8f736f3ad4a3ULL, 0xbbc46870f892021cULL, 0x2781125820000a8aULL, 0x248d8b9a270ddfa6ULL, 0xd0400c4472ae5f7bULL, 0xfd3d8f1e05ee2f7aULL, 0x8a5dbbcfb765e709ULL, 0x7ba440ada4b48d6cULL, 0x7d953fc0e0493539ULL, 0x7b516399178d9a58ULL, 0x02ff025fb64ff528ULL, 0x4539ca662cd4b60fULL, 0x1cc8a42d73ea38aeULL, 0x0fbabb55d8d36296ULL, 0x707687b72d3abafeULL, 0x32c193c380c2e160ULL, 0xe9257eafdc407437ULL,
+        0x62a8d067762ad8eeULL, 0x0b3cdaf0ec2a0030ULL, 0x33a19acacdec1bc0ULL, 0xb56a98f601608545ULL, 0x646c7bbd9423676dULL, 0x41121c34406b6720ULL, 0x48acc9b5676c83bcULL, 0xdf2db7dcd26b26f6ULL, 0xcefacaca773e4cfeULL, 0x1becb3879c4d4496ULL, 0xc6add987d469d908ULL, 0x02061829f83633ddULL, 0xb0670b98c539116dULL, 0x015f6e834785d73dULL, 0x5ef2707a64dc0d9cULL, 0xd4b073e3b00b19a9ULL, 0x96a36b91247caccbULL, 0x50cea76ce86a6230ULL, 0x812b393b6c6b538aULL, 0x5ff85a57edf4ee10ULL, 0xcc47df7343f37af9ULL, 0xe8286dc90e23726aULL, 0x9df18315d16c65f7ULL, 0x081ee1b35f622344ULL, 0x51baee84454c8ebdULL, 0x586f3dc9136fd345ULL, 0xbc65702f1742d7b4ULL, 0xd220461fd5c8583aULL, 0x16491058d097d132ULL, 0x87613b076eac793fULL, 0x3889d9fd1feaa1e1ULL, 0x154a7887e83c2947ULL,
+        0x57795ee42735c423ULL, 0x35a3981779bea270ULL, 0x1c6dc56530e7988fULL, 0xadb03c37bb29c856ULL, 0x726029f1d663450bULL, 0x9b750ccf43965ecfULL, 0x72cee2ddac2f19c0ULL, 0xcd64b67375f8b2adULL, 0x7d23014d436dbb46ULL, 0x7eeca2658f8e8fd5ULL, 0x1f7a444fb9e75d65ULL, 0x45590cd11378caa9ULL, 0x8cfa7047972f865cULL, 0x0bade43e1bd18764ULL, 0xe00948a62eddf902ULL, 0x0c023cfbaf978a86ULL, 0x3ab817e99588d6bcULL, 0xea0589429fb09c37ULL, 0xc91fc3197c46d163ULL, 0x24db90a3f3beeff1ULL, 0xbddbfa23f4aa3573ULL, 0xea26feb61f08f06fULL, 0x6f146d611e43fe17ULL, 0xd9b019159f9a33caULL, 0x37521681a09bd9c7ULL, 0x69f56888f7471e35ULL, 0x66aad330a76e8d97ULL, 0x604191b8f2971379ULL, 0x1f1382cd46ccccb2ULL, 0x16a5f2f71ec05cbdULL, 0xf77e8c550b207b9dULL, 0x46ed2ff0db161a31ULL,
+        0xdf11b0b0b6a1535cULL, 0xf795df31a7d7bbd3ULL, 0x8a806186c88c46b6ULL, 0xd5765c92c2450881ULL, 0x42733282b2fda857ULL, 0xb41fc9d8f4823513ULL, 0xd9644c24e7b228d2ULL, 0x50d086cbe0da5a39ULL, 0x5415c43a73eee149ULL, 0xf597c2f91edad003ULL, 0x9c434d2a92e63497ULL, 0xccfe6e0663973c81ULL, 0x06831c986bdab506ULL, 0x6549a64c2f95f6caULL, 0x4940f9315bc1fbccULL, 0x29f3a478fb405655ULL, 0xb3a7f4fde9e1a8bdULL, 0x04cecf5fe9f95826ULL, 0xfae1a3af7852d9b9ULL, 0xa42588244f6b0536ULL, 0xbde3fbc299ffcdb6ULL, 0xe3d37c48a6f52dc1ULL, 0x6d65a6b447e50053ULL, 0x0b47e898a2bafbcbULL, 0xd8322893741ea869ULL, 0x1060c93e6df40d0aULL, 0xb78f80f5c3957bd5ULL, 0x74791f8b19ed798fULL, 0xf0a62973033e0b6dULL, 0xf9072c778c5228adULL, 0x38c7051090a36debULL, 0x5a7f9ff3751d2bfcULL,
+        0xf4bfc6e6d5e3884bULL, 0xdae24dda110643c6ULL, 0xd0ab9d9217eb4a94ULL, 0x6db8ae07cae37f28ULL, 0x0c6f27b7a3350c89ULL, 0x3b2acd557aef6ee0ULL, 0x5cc0de4ee98430a6ULL, 0x2df47b67a46dbc96ULL, 0x4c859dd71801f2a1ULL, 0x7b24d51125b47f77ULL, 0x7b8ba689fdc8dafcULL, 0xd7f50621b7d44feaULL, 0xd81196bb03a28287ULL, 0xbbaa1269c25d13ceULL, 0x78a9a5ee07567436ULL, 0x34a775ebcd9f1e08ULL, 0xe62501079e40dd25ULL, 0x84a2a430da688d68ULL, 0x80a316abf626bc78ULL, 0x7136dbe2d7e4289dULL, 0x7c70a752b2b61e83ULL, 0xd971163629e7dff7ULL, 0x842f83e458002651ULL, 0xaed30522e0c4b954ULL, 0xc3f55d194453a158ULL, 0x468f5dae6c367e8bULL, 0x1a7d0b8b7ebd9119ULL, 0xd1d8032cbc62a4e8ULL, 0x7e8ac21407b50c00ULL, 0x9fa2312461e605c5ULL, 0x47783cfb7ac118b6ULL, 0x11c60d58eddfacb5ULL,
+        0x62bba70290c4f783ULL, 0xf909bde6cffcccaeULL, 0x1de6a63e81cc1d15ULL, 0xe6fe391e3fa5acd0ULL, 0xc8239724aa85f5f8ULL, 0x107a136ff4d50bd1ULL, 0x30d92b0766dd4dd9ULL, 0x508a758babe77f13ULL, 0xea5632f6a75753f0ULL, 0x0abea3b44b602531ULL, 0x4006a845577f6a84ULL, 0x9d83e76b46cdf34eULL, 0x9177979d3f9318f9ULL, 0xe09550d2b93ddc63ULL, 0x20fd5ab8f07b86baULL, 0x5e1c3d9c6a8882c3ULL, 0x221f8b71edc13c77ULL, 0x14c8b8c01bf57304ULL, 0x60057edcbf8a6773ULL, 0xa2f7de729d2e49d9ULL, 0x119bee4d5e384bdfULL, 0x30105f4e9efe7b02ULL, 0x2a494c470170f116ULL, 0xffe4007fb7d4af89ULL, 0x198df020ad064e0cULL, 0x463e6d136c2073d4ULL, 0x27745c3ef5020d81ULL, 0xb1f820c3879efad8ULL, 0x14b5211d912c90efULL, 0x1ecd22bc3de64071ULL, 0xadb5bd87d1f3b49aULL, 0xeae8037b119a8d77ULL,
+        0x1bea1d5b31fbfffcULL, 0xae18f21ae4355fb5ULL, 0xb4bede34a4df23b7ULL, 0xc4658ec0d72f92e9ULL, 0x1ef2dcdbd3dd8252ULL, 0x80c372b3dda0d067ULL, 0xc4f2f580f45e4d73ULL, 0x4ce6a82d86754a4bULL, 0x03a09eebf1772c93ULL, 0xf82b4b88ac130348ULL, 0x641ca33519d9b246ULL, 0x9f42841dd463cb22ULL, 0xd19cea93ef41f437ULL, 0xd5e3db3798b4caeaULL, 0xeac378d9ab24f8ccULL, 0x49b0f5f9b941314dULL, 0x14a1dedd6c2641caULL, 0xdf9690a664c16070ULL, 0x0690475b3a9d55b3ULL, 0x5d777bcee209c1a5ULL, 0xba253d946b57b0d8ULL, 0x54c354524c99b38cULL, 0x72ee50d71bdf36c7ULL, 0xde9afc5d9e332903ULL, 0xf5fdb131bc1e759aULL, 0x0f0e0bc4478a8abeULL, 0x3546ab7420a6ab04ULL, 0xf678baa02b1dce2aULL, 0x67baa09787431502ULL, 0x6165dc602c774637ULL, 0xff4b1be08f05338fULL, 0x9d9be91e4f627ab2ULL,
+        0xa8e9dcd6649cf10bULL, 0x102173c132e818dbULL, 0x9f14451c6cac5e64ULL, 0xdec6b30b005ff6dcULL, 0xf9e1a041c50f0523ULL, 0x221347116693842eULL, 0x56dacbde100a5a04ULL, 0x781606c1ed6ca1cdULL, 0x276f8b3c94c1c2d0ULL, 0x94fa609b12deb8ceULL, 0x075e26b3ffabc2b9ULL, 0x576e018134228706ULL, 0x2f7e4ac4792990f1ULL, 0xd9c311af3c29df34ULL, 0xd385fb7ad1876dffULL, 0x5b590037ad2e36e0ULL, 0x8839cf96b0f5ca01ULL, 0x4a1d47452b233c3aULL, 0x441c00cc9ddcba0cULL, 0x377a1d6235fb3eeaULL, 0xecf06aa4562625d5ULL, 0xd325ab1c0e95b926ULL, 0x2718f3fdf3686ae4ULL, 0x05f5927f6ffc730aULL, 0x75540b839dd9e9b9ULL, 0x2454669997b4ee71ULL, 0x3ebd23fb5315d2faULL, 0x8c28de84c106103dULL, 0x8652a9cc85c69344ULL, 0xce9dac422c1c25f8ULL, 0x02e2bc6ab8b093b1ULL, 0x0353d9fa776aefbbULL,
+        0x1589c4e94133661eULL, 0x679338116d247593ULL, 0x43724b21d2d70916ULL, 0xb015e7931bd9c285ULL, 0xe2ef3c638b409a30ULL, 0x69d616c786f581aaULL, 0x73f7cd9c94144cb3ULL, 0x463a9d9e880efadeULL, 0xd34eb7ce727498adULL, 0xa9696d0e2000dff8ULL, 0x2d4cb50e025c9811ULL, 0x83a798ea6df2d6b5ULL, 0x9d9606015aa53f97ULL, 0x0cf337cdd983eeedULL, 0x7c83e0e10af7d67fULL, 0x59e27ba9038edb0fULL, 0x4aa1a0168d89fad3ULL, 0xcb12967652a9fbd5ULL, 0xcfaa9a3dc8c276b1ULL, 0x88afec64a36ab2d5ULL, 0xe003e161c9fa2304ULL, 0x146a1e492fcc5f60ULL, 0x349acbdf5d6e7b42ULL, 0x3e87f66bab3730e6ULL, 0x04f5351050602187ULL, 0xeadd3ac9b26ed422ULL, 0xc1a7da2c60d32a10ULL, 0xe8b742bcbf66efedULL, 0xf6f90631653dec84ULL, 0x061ba3ae6010b650ULL, 0x9ce54c17d401d97dULL, 0x735f99f80c946328ULL,
+        0xd9317137180cf223ULL, 0x56903234d5f59c87ULL, 0x558b04c14a9ea0f1ULL, 0xb6c4dc8c0ed297abULL, 0x43da74bdcf81b76dULL, 0x7354ca516d0dc8a6ULL, 0xc45853e601117cd5ULL, 0xf1f0ccef10b9e464ULL, 0x9319367268527e61ULL, 0x9adf9775312c629eULL, 0x804aad173dbaa580ULL, 0xab385ca94e69323eULL, 0xfb1b7a7ad2fad2ceULL, 0x891ee2caedb3d03eULL, 0x4703f80ce093ae06ULL, 0xecc3c519c2a57861ULL, 0x1686c990b42a8263ULL, 0xbfed768c2e4cc1abULL, 0x6a8ca7bb51182020ULL, 0x7a65c8f7955abff4ULL, 0x5675fb35871bd517ULL, 0xe0b8e0f4347a4536ULL, 0xfac09677fea7d2d6ULL, 0x9d44e0d623c9156dULL, 0xcf08a762430da04aULL, 0x858f591277e48e06ULL, 0x4544fefeb74f338dULL, 0x647febca211367bdULL, 0x07131d03b4a0e255ULL, 0xd0fc23e626fb7340ULL, 0x0b58455d8f0bffe5ULL, 0x4ae01b04e85f7aa5ULL,
+        0xdb0d7f16e285024dULL, 0x7e3ad17d6889fbaaULL, 0xccb6c89c734736d2ULL, 0x1f5472897058f538ULL, 0xeef5132505d0eaacULL, 0xcc5ce609180e06edULL, 0xc539725f3697af28ULL, 0x4adb87e7a42dec8bULL, 0x7bdd665c327e54b0ULL, 0x679cb09797c9e392ULL, 0xcdcbd34dec507751ULL, 0x687fb1bcb44bb96fULL, 0x62ffabb9b9a6297fULL, 0x8f84bd5e2ca66a4aULL, 0x28c69f9e935a6e2bULL, 0x6783a7ba7deccbe2ULL, 0xc9931f26c5eb715bULL, 0xa6c2b441993e3cddULL, 0x5d105cddec9a5c99ULL, 0xa3dda5f7a6b0f50aULL, 0xe1c852b9788479f2ULL, 0x9ebe689faec0d28bULL, 0x7b9cfcf022233c64ULL, 0xc1fb725732b6e60dULL, 0xa2e770ae16184e4dULL, 0x986eb40426963bdbULL, 0x7e757979874daad5ULL, 0x511d7a53d67c4454ULL, 0x193b8784fd469cf8ULL, 0xa77c7893726edff3ULL, 0x01b8265e93b92f39ULL, 0xe28146d3f975a6ffULL,
+        0x34dc4935e54c3b97ULL, 0x35bcc5403f313402ULL, 0xcb791fe477099aa5ULL, 0x3f3e3ef200da7f3cULL, 0xc5b2d1da7a2dbe38ULL, 0x42621a4dca51c0b8ULL, 0x936368ea552c7b8eULL, 0x467f0e58cba246c2ULL, 0x358cbb360a185f7aULL, 0xb6fa3517affe93aaULL, 0x3119952f50f599a3ULL, 0x818e100029bd0086ULL, 0xb526455e91fb0ba8ULL, 0x4c0e3885eaf0e7cfULL, 0x9de6117d949d83b1ULL, 0xfc4848d669e08f6aULL, 0xe8ecbace9d4acb37ULL, 0x55074cf78360f818ULL, 0xb323e791d1beb24eULL, 0xe0ef4f998903eeceULL, 0x1c5b272341544f29ULL, 0x1f78a7dfd165ed47ULL, 0x3732f1578cc45a9cULL, 0x7ddc14131876c5eeULL, 0x864fa1450ffea166ULL, 0xb80ba19d878964dfULL, 0xbb4b4d610802a5b9ULL, 0x72cf435a8964d23aULL, 0x6b4ba2fc6f4349feULL, 0xbed4f87b21099ff0ULL, 0xa37ff74771ff5ed6ULL, 0x751b096c19f56715ULL,
+        0xec73088675acfb5fULL, 0x083268057a90293aULL, 0xfc8c54aebd8b4491ULL, 0x74497f4bbacfcfdcULL, 0x2cb31be8425fd3fdULL, 0xa95a3509d7def81bULL, 0x49f838c0c73fd495ULL, 0xa40eddb9c05d0a39ULL, 0x7d929200aef4a9d0ULL, 0x305a5009062ac783ULL, 0x689bb16bd267bb67ULL, 0x728c8a3eb20ebc8dULL, 0xf5126b6caedefbf5ULL, 0x739edbd4bde61868ULL, 0xd207455ac4c097f7ULL, 0x4753a64471b71fccULL, 0x0ae1dc337cfde265ULL, 0x0616c04d250863d0ULL, 0x49be8ca5d71729edULL, 0x0b90acc7a54b5de4ULL, 0x3962d97ea9c61aa7ULL, 0x9a039618540e39f5ULL, 0x5f93b184f05b10d3ULL, 0x9e6ad0f2730a86fbULL, 0x620bd6ee5df517faULL, 0xf9964d6faafdf0e7ULL, 0x7b15fa2e13554ebfULL, 0x4c014319172ad3d4ULL, 0xdcb587e67f589455ULL, 0xfd1a6a2f4170d2faULL, 0x6d2d3bca1b51ab84ULL, 0x62b53ab5ce75a879ULL,
+        0x25d7f3b468efbd9eULL, 0x3cf67295238e7312ULL, 0x1ed12a85835f874cULL, 0x1e05f61eca7045f2ULL, 0xe596d7edc0339ed4ULL, 0x6f7e5d6eee30cf94ULL, 0xa97eb7189ce4b45dULL, 0xc70d05e3ebf61d87ULL, 0xe7400a55f10854edULL, 0x9e2e8c42a5e0b19dULL, 0x21ead11c66fe76faULL, 0x2609d2f5f950c647ULL, 0x0171c9afadd40740ULL, 0xebbe45d96c376ee4ULL, 0x1f2fe8f18c1df71fULL, 0x21b12c1ec0622a92ULL, 0x93c85fb1f3488816ULL, 0x7f60ab51710edbd3ULL, 0x564429f2900f1d16ULL, 0x5c38dfa0de2260f7ULL, 0x0756988fc2263724ULL, 0x7f86f419a75d104aULL, 0xa60722ed89523cd3ULL, 0xf60cba768e7ba399ULL, 0x59143c551b72da81ULL, 0x44660796f3e60034ULL, 0x659a3a81ac4b6fccULL, 0x56f3bd885d35e2e1ULL, 0x88767faf8166ccdbULL, 0xaad271d63991b316ULL, 0xc192292907d18482ULL, 0x50de383d6935aa80ULL,
+        0x32c5b49d7015e7c2ULL, 0xfe2404d9252237ddULL, 0xa986c4ddc977c924ULL, 0xb0100ad3452b506fULL, 0x3d4124a0ff80f285ULL, 0xa0a28ab31972a4ffULL, 0x86d81abb978816e6ULL, 0xea411cfc263c3dafULL, 0x02564319d8fd620dULL, 0x77ebef905c59e110ULL, 0x4fa472b6f38e7e6aULL, 0x7d85c3473329ce35ULL, 0x05ecc61853327ecfULL, 0x3622bb74d6e5d2aeULL, 0x59e0dd52b7f84899ULL, 0xcdddce64d2622493ULL, 0x17f118ac5118798fULL, 0xa6100c36374214adULL, 0xcb02227006588717ULL, 0x9d9db22907d8b080ULL, 0x76c3654b6bde7ad5ULL, 0xd97263aed8a163f2ULL, 0xc7da7632413adef8ULL, 0xadf238e2e28a637aULL, 0xe91988353d469027ULL, 0x2765357c5e60722dULL, 0x6fc008709bdf2ec8ULL, 0xbabb1dca65c49800ULL, 0xe7c1aec3710ab278ULL, 0xc498fa34a5208d17ULL, 0x04d813e644ba4bf3ULL, 0xccf0f7b62c62e3cdULL,
+        0xb9b1ec7e7f2d704fULL, 0x27a30640a9fac6eeULL, 0xb2872aae25976e51ULL, 0x617129867340d8baULL, 0x3a806b39e3f85bb1ULL, 0x18fff101ea0aee04ULL, 0x490cf5ac8db74685ULL, 0xd7fb86e3eb915ae3ULL, 0x5e572355ff430085ULL, 0xceb8dea6322ba395ULL, 0x5c402270a79fdcafULL, 0x84e7bf2c3f91931aULL, 0xf26eb5d70f696912ULL, 0x8160f944d3bb34deULL, 0x0e8e0605d173c54aULL, 0xece7e76276d2b007ULL, 0x00fc1f741a589453ULL, 0xf23e8eaf1b804606ULL, 0xc81694c117f6769fULL, 0x57eb5492303b3676ULL, 0xf3444965b1773d60ULL, 0x3172812f266e1a08ULL, 0xa5469776b1cbcfb0ULL, 0xed1ff4d022ab1802ULL, 0xa880729087624cf5ULL, 0xe97a883ab2fefdc1ULL, 0x8eacfb38920b8189ULL, 0x327c49c8076b7a43ULL, 0x10d0c20f3a98b037ULL, 0x87210f39470dc065ULL, 0xde64a43859b6ffc1ULL, 0xd3bc9a0d65eeba6cULL,
+        0x0ef3616b7c9baf89ULL, 0x8f510f3978a201d3ULL, 0xa2ccc433a7953110ULL, 0x5b0d878eb66a6f0eULL, 0xb760a49fd4b5b08cULL, 0xb867edd6de8b724aULL, 0xb85053585ed93230ULL, 0x0f345de6c1770f1cULL, 0x000937657c4daa6aULL, 0x88e085b48fd4c4a5ULL, 0x450cacfb9679dbe6ULL, 0x55f1044799a01962ULL, 0x61ed96fe5a5a8411ULL, 0x322a9f29dc22cbdaULL, 0xcde613ccad004106ULL, 0x3d34c8603abc7e84ULL, 0xb92f2297d2998145ULL, 0x1ab0935e18bb78edULL, 0x4e542bfa1fcddb95ULL, 0xcbd6044ca5c85697ULL, 0x46caf56a6ebf712cULL, 0x822a352ce08b1c62ULL, 0xcd178a4954e2e22dULL, 0xf709dc7919f88f0aULL, 0x67d1e88328e5b3e0ULL, 0xb604dfdb7232544fULL, 0xe09842ddb9c29a08ULL, 0x1ab08493d394a9d8ULL, 0xd8ab18f5280fe15dULL, 0x0a443ac01c252b0aULL, 0x8af05460dd6cd859ULL, 0x9adcfa5ec9dab95eULL,
+        0x15f76a2cdb2d10caULL, 0xa2694a6614fbd7d8ULL, 0x8de45214d7e3d3f0ULL, 0x99e0a2174abc821dULL, 0x8b662ef5565a740aULL, 0x1067367c493dc634ULL, 0xd1c99ea97c32ba77ULL, 0x0e7dbaa7553c28e3ULL, 0x792cb5ea18bca385ULL, 0x6a1ad26cf2f05b51ULL, 0x3d88665fdd3e80d8ULL, 0xbd993e9303701886ULL, 0xe4c718388137d49eULL, 0xd013568436841e95ULL, 0xae73f2976e721d3cULL, 0x15b354634c1855a6ULL, 0x2f62e3be3727f043ULL, 0x8de7a814fdfa3f95ULL, 0xbb6a0664b17ffd10ULL, 0xf06527b01a8d6a9cULL, 0xa3f53a914e3c180bULL, 0xabe8f6f7ec792e63ULL, 0x423e103d7da40136ULL, 0x949ce2f0f520da44ULL, 0x95be53a128bbf468ULL, 0xd1f80ee84c3cc038ULL, 0x3575b8eb769f55d7ULL, 0x8ddfcf77271916edULL, 0x3cdb75afdf6465c9ULL, 0x2b60cbcfe686039fULL, 0x5e194c1870923919ULL, 0xeacbbce359b619c5ULL,
+        0xb0f5c116b7857022ULL, 0x4c2695eed5c1255fULL, 0x22af53a0b4169937ULL, 0x79a05f6d59c6e42bULL, 0xc523db0aeb722b43ULL, 0x4eb66e14f6a1788eULL, 0x7404cc7aec9c0f43ULL, 0xf9c3b4229875976aULL, 0x6ad524105f2f2ce6ULL, 0xbe8706c656e9ef66ULL, 0xeb62d4da4d9eff8bULL, 0x7c0b80dcb31bde8cULL, 0xd5762e15c52308d6ULL, 0x2ae2e7e6257bcaf4ULL, 0xa0276c5e40e124f2ULL, 0xa0cef1ea48b80223ULL, 0x0d50f8c09a1d3754ULL, 0x8e3c34833570d3c7ULL, 0xeb5396bd0f3e1092ULL, 0x2141ec8152850879ULL, 0xadc8e374bf8172f6ULL, 0x99062e7f8d0ef847ULL, 0x5aea888b70a8bbcbULL, 0xe18f31fa6351e0c1ULL, 0xfccd95b2e687fbb6ULL, 0x93d1074f89f21c95ULL, 0x452887e1b9f0d85cULL, 0xceaee85c5b08342eULL, 0xe2c3b994260c49a4ULL, 0xcf0f42efd5a0382dULL, 0x200c22c10cbfbc14ULL, 0x4ca03cbabc29a85aULL,
+        0x41e139a6b64e8c5cULL, 0x85741c6cdaec22daULL, 0xcc257c595f4bfd47ULL, 0xbbcc0b50a529268bULL, 0x3931550a43f71953ULL, 0x51892bdb55db7349ULL, 0x9479042421762505ULL, 0x46174740f21d371cULL, 0x8451ef021a0521edULL, 0x566980f83155eafcULL, 0xb032145ba3838483ULL, 0x8a8b1e75ee36277bULL, 0x4b0ea8d1636d8babULL, 0x04bc8e033cdffeadULL, 0x07df59737ffc23e1ULL, 0x3336785753602f58ULL, 0x96959d6bd91a277dULL, 0x5d0c7706f5768c4eULL, 0x7dad052ea925ee5dULL, 0xd9661d8c0f133327ULL, 0x8b0caf6ce93aeecfULL, 0xf50c1dd99ad323c9ULL, 0xecba314263510ae6ULL, 0x375ea7b0379f2977ULL, 0x1f04388c5eb9c127ULL, 0xc5e0de7a2ed90e72ULL, 0x2444b87957676c34ULL, 0xa17c22d8e83eb131ULL, 0x10fe968b2e4277f9ULL, 0x4f51dd638cee3a3aULL, 0x5663a3785d9b1e8bULL, 0x74003c8a1dbc4817ULL,
+        0xf9432cb528448914ULL, 0x79aef170e9387df8ULL, 0x4c9755b311adb346ULL, 0xd9fae73ee26aae4bULL, 0xa7b819cdace03ba5ULL, 0x59609a08e3c61f88ULL, 0xc961bec1ca69f6deULL, 0x6542dab671ef7d77ULL, 0xf7943db173f5ad1bULL, 0x0c862f7b75ca0490ULL, 0xb788882510f53eb6ULL, 0xae53e7c1da3f7534ULL, 0x53961990046e019eULL, 0x8a4019fc991e5d6eULL, 0x8d9b1211404e5ebcULL, 0x831d232a7697eac5ULL, 0x99dafbb43e8f7fe4ULL, 0x552c652b266a0568ULL, 0x3def1b314a282b8dULL, 0x6cf63de35cc3f481ULL, 0xa40f846da7c99bb8ULL, 0xced4ce83a26eca31ULL, 0xb61ba2fcc737b210ULL, 0xab9a47ab87ac4b92ULL, 0xa87c73cf9a192148ULL, 0x6a82fdfb413942fbULL, 0x43be429c8de60470ULL, 0x064c940126e42a55ULL, 0xf6c00f269e242d7fULL, 0x3fb93f450d1ed0c9ULL, 0x46257bf9955954c9ULL, 0x4e5cd5c3716b0c41ULL,
+        0x4ba0909edff8875dULL, 0x8a3a377bac381308ULL, 0xcfcd23a3ed97a305ULL, 0x712df581f01810cfULL, 0xb9723e20e497bb3bULL, 0x4146a07211c592aaULL, 0x8146fb68503bec88ULL, 0xe6001e42424bfc2dULL, 0x1b075397c0cbac38ULL, 0x68ba693729388450ULL, 0xf355eb3824aaafd7ULL, 0x1c21dd7cb598120bULL, 0x4466a5ef2adb384bULL, 0x4eb45775a7f275d2ULL, 0x348a8291b18db219ULL, 0xc339ae1b8c4c902dULL, 0x55aba9eb08a4140aULL, 0x5f961562cf120cb5ULL, 0x4fb45423500061a0ULL, 0xaa01cb34dd499f41ULL, 0xdc9f7cb63d63a23aULL, 0x62027f92cef5da1aULL, 0xb6879e228b007bb2ULL, 0x1909f3077aa8718eULL, 0xb58ab4985a0b2deeULL, 0x5ff29d4812869c42ULL, 0x53c7cc8518cf2352ULL, 0xd7decdcd9943c4c0ULL, 0x71d96306d9d7c958ULL, 0x1d6647b9981d2c35ULL, 0xadb471166e18e48bULL, 0x14b88537dc326762ULL,
+        0xa9d6848858e51101ULL, 0xf524982278f96c9bULL, 0xb283aa6530979beaULL, 0x83eab5321bcaed2bULL, 0xd6cabe0cb7630a2dULL, 0x0f8f587850ab1a77ULL, 0xfde6e0ba9000a67eULL, 0x6820fd8fac0c3dddULL, 0xdc9a6596058b3f3cULL, 0x9e08d077910d3a21ULL, 0x9e93d6885d1a4f1fULL, 0xaf3e7b334359f39aULL, 0x490dd61f0c54f719ULL, 0x44f8bf67218d1631ULL, 0x2a58b1821cfa0814ULL, 0xa2338d02be8d0b97ULL, 0x300a36308ce11b8dULL, 0x88eb09bc1df32b25ULL, 0xd32836404c13f1dbULL, 0x0a9150b3892230c1ULL, 0x0c83ab53acf21a3eULL, 0xc94add6a88d589a3ULL, 0xa86caa5f9f5a8e5bULL, 0xecd24c79a18fa0d9ULL, 0xb5a58118a6f9804fULL, 0xbaa0ec9f8b6d041fULL, 0x6bfe8154cae62ba1ULL, 0xeb9970ffbab4e871ULL, 0x9be6e2c98f50bd9aULL, 0xae965372c82a3cdcULL, 0xddaf632f6c0054c7ULL, 0x26c9ae2719ddcc95ULL,
+        0xc780818d9079b8cbULL, 0x03b4a4d86b2c6e09ULL, 0xf9bc2ea0611bf053ULL, 0xc4aa07d713a2da2aULL, 0x013f4f1976dba809ULL, 0x5151035415559b7cULL, 0x37a06744ab189d2cULL, 0xe99bf639827d3661ULL, 0xb6f9cf800f980df0ULL, 0xc759d02f2136751bULL, 0x973fa90f124c71c5ULL, 0x74ea6a105c6639b2ULL, 0x78d891cb2d94121eULL, 0x4e79de3bd17c6e05ULL, 0xde90d41e16ada07dULL, 0x69a64264454c98ccULL, 0xdf94e81391a8958fULL, 0x9344c38420dfc36eULL, 0xf4fdbddaf955e762ULL, 0xfcf8c94242747074ULL, 0xf52dd685cb770c94ULL, 0x4b0a56a1f50e58d0ULL, 0xac4934e3d1603a8dULL, 0x84b6b64820842423ULL, 0x5e161cb5661ac64cULL, 0xf36727d828463f53ULL, 0x9f9a3aae0427eb8bULL, 0x6c7a5eae6a5040d6ULL, 0xa5dfd9f45f61e4f7ULL, 0xcd4a881907f872aaULL, 0x0329c1d3a0bc2ea8ULL, 0xc8923f29192930ccULL,
+        0x9dbbd757ccf8690dULL, 0x8317939377cda4a6ULL, 0x646d24063b38bb95ULL, 0x6eebe3c7d45f5e8cULL, 0x4e0c07ca45c8ee66ULL, 0x4e3c6156ba35dde4ULL, 0xa1eefccaa4bc3258ULL, 0x33c32076a3e11cdbULL, 0x789452a4b82523c9ULL, 0x6121be3e2ba08575ULL, 0x340ab945d420851eULL, 0x66a83f849a5c23b1ULL, 0x8027c4cce3de0ff5ULL, 0xf54198b5e91984d0ULL, 0xbd1d8888819b768aULL, 0x31ee1cf0d3fbdfd5ULL, 0xfcb1cfa431c01c02ULL, 0xe2b9e64309cb59c6ULL, 0xa3c7e66b29349baaULL, 0x0e78a591ce5a0cbeULL, 0xec9c0da3a2670833ULL, 0x91ed5b6855bdec25ULL, 0x3db1bf1e90c0f822ULL, 0x646afa8af22d2871ULL, 0xfbc0b7fb727535f8ULL, 0x32726fb7a520f4e3ULL, 0x5bac1512d09bca11ULL, 0x06258107e3259489ULL, 0xf7c7e1747b24814dULL, 0x5543399fac519890ULL, 0xb4c961d25d8ab92bULL, 0x0ce35c01844a4f99ULL,
+        0x840c455817659653ULL, 0x8234a53ae248be77ULL, 0xd293d78a0047c10dULL, 0xedc96105ac6128c2ULL, 0x52fbf93196b9cc48ULL, 0x58f22419db96170bULL, 0xce344e8b41b5c557ULL, 0xbf05c2a1ca6b6559ULL, 0x10b2b054e23c2ce0ULL, 0xdd002b3d41a8c5a5ULL, 0x2f1c808fe8b48abeULL, 0x3e2150cfdf43fc4aULL, 0xdf5ebea4edcaefb8ULL, 0xf4ac5bad0fae9d26ULL, 0x97190c71b5182c01ULL, 0x812ca2bb695e30e3ULL, 0x7dcba57a700dcd94ULL, 0xf45d72c3cc4ccef0ULL, 0x4f1e6b30ecb3f5d8ULL, 0x177e957d69637942ULL, 0x6c1c2b67b764583dULL, 0xe120144904a76d01ULL, 0x312df94eb5d3c0daULL, 0x49d32717f0493342ULL, 0x9701f1b49a75d45eULL, 0x085c722879a7b45dULL, 0x6d96a87d2a2f6216ULL, 0x21ceb4905f626ed8ULL, 0xb4b93ea2aadb2f7eULL, 0xd168d893122a9fd0ULL, 0xda2c437dabd089c2ULL, 0x592a0aa464bf7097ULL,
+        0x7f24efbf18daa6d3ULL, 0x9ea0e8074ca08a9eULL, 0x97438e1272ac63e8ULL, 0x3ba931703f3f0434ULL, 0x8044820c21837ae9ULL, 0xaa018bd037a7f066ULL, 0x7475ada2b61505b2ULL, 0xc6a6c9863f9b0eeaULL, 0x49f740ddee301abcULL, 0x51eb7c7ba219038fULL, 0x75c73b6a5b555ddeULL, 0x0f36d8d6bede5566ULL, 0xb7487c7d8de7f2cfULL, 0x1c0fddfbaf43371dULL, 0xc8911770d20d78faULL, 0xad46cb016654949cULL, 0x5440311898de3be4ULL, 0x712892749888b3acULL, 0x41c7718f78ec6242ULL, 0x60962e2450cb5038ULL, 0xe703690f3491f549ULL, 0x8b89e760c3693b33ULL, 0xd0c456d0a3370509ULL, 0x1be2100652d9deceULL, 0x5347aac46107dd88ULL, 0xf7f5d626c5aa720aULL, 0x2f58187f3390cfe7ULL, 0xb44c3fb6da58c2bbULL, 0xd45f5a9e7046c16cULL, 0x4eb24119d0c80affULL, 0xf4d0dc2c83f73f4dULL, 0xad94f9411d3f8692ULL,
+        0xd7703d30cbbe226bULL, 0xc47d1767d31e628bULL, 0xd2fea6db9c3284bbULL, 0xfcab61feaed21050ULL, 0x79207b3c0c9053acULL, 0xad24d9591a9d8e52ULL, 0x8ef0ed825c598cd0ULL, 0x926cff267f8b2330ULL, 0x2a79dd22f10bcedbULL, 0x3d260cd6c28e9e49ULL, 0xdfe7462ce1593bb9ULL, 0x9e53337c37a10590ULL, 0xf0c7ec419e080119ULL, 0xb77397a15bf51d73ULL, 0x9895f8766af43937ULL, 0x491c7ccd7cd90ef7ULL, 0xc0421a0eb2ce4fc2ULL, 0x2d1bedeeb6ff7d13ULL, 0x7f1762bbdf4eb5ccULL, 0x3b4462cbce93eb5fULL, 0xf844eb9cf2f93618ULL, 0x32c3afaf6e932dd0ULL, 0x8c31594a14f95da5ULL, 0x01e5862d11e1d5fbULL, 0x892795286be38ea0ULL, 0xb5c7e7896b67e950ULL, 0x55c33435fdfc5b5aULL, 0x17f801c2ae3d6ffaULL, 0x32a1b5894767072bULL, 0xaf6dc792711c3b6fULL, 0x76d226e8d4e8f3d7ULL, 0xda250e0f5dea0131ULL,
+        0x5fb8ae32717a2842ULL, 0x6187b3b84559a7a2ULL, 0x59b7be8e634868ecULL, 0x2cd9157a1910e8f6ULL, 0xef02f5e86ed5a0ebULL, 0xb10c20b2dfba8a67ULL, 0x3da3732097bf3bfdULL, 0x96cfe8681bb6a4e0ULL, 0x3f2bfd9ff9bc733fULL, 0xd0d6f3efe2377096ULL, 0xd1e30e3686a2cb68ULL, 0xce93779a9488fa22ULL, 0x6b7c5b3ad0006115ULL, 0xea21248e3edd8730ULL, 0x3637701249455022ULL, 0xb91c8523fd57f04aULL, 0x56de550b59ef68aaULL, 0xf36e3c64882449ebULL, 0x7e1d7d811964550aULL, 0xe9dc15631474af56ULL, 0xb9d86d4a51fb8b80ULL, 0x0e80cfbb117b3e17ULL, 0xe1a49d5ad06156a3ULL, 0x8c02131b81092210ULL, 0x9a81c0c77bd4ca26ULL, 0xf04b896992514430ULL, 0xd3d4f843b6f1ab5bULL, 0x6960dff7360bd610ULL, 0x5f1a6513b1e18abfULL, 0xccb91b90e41e3915ULL, 0xe084156195acf7f1ULL, 0x7477c0b8eedb2041ULL,
+        0x3d545332822a1c2eULL, 0x058c71fbf99f2f94ULL, 0x05ceef90ea836cbbULL, 0x16090ac4ee9f7a5fULL, 0x1b089b7f74cfa994ULL, 0xc4400dd176eb8a0cULL, 0x272e36f452763566ULL, 0x2bb69158b42fe1e7ULL, 0x8906f87404652e7cULL, 0xf28ed1c90dc08216ULL, 0x0e322319d05b9544ULL, 0x31000559cc3134ddULL, 0x0f3c19ffecba1ce6ULL, 0x3c08b17f3fdfc701ULL, 0x37bbf5176f99fa87ULL, 0xcb95fb7e337d3a60ULL, 0xda87cd2b27d554b3ULL, 0xe4ba5ab24142ee77ULL, 0x985e288811f7eac5ULL, 0x8413a0f5fde32ad5ULL, 0xca290d104adef3ebULL, 0x211ebddb7ef7429dULL, 0xc29192002799de47ULL, 0x3e77f0b291e052f2ULL, 0x5a8e0e79c8b60ad7ULL, 0x11b07818ff0b03d6ULL, 0x351faa769d594302ULL, 0x42a24bfcc94ba7a1ULL, 0xa440fb8bfbaa9c0fULL, 0xb57a8d21b97ece97ULL, 0xfb1b35f8f35b2c05ULL, 0x1ca44eb008d93567ULL,
+        0x366203579297f4c4ULL, 0x7c267e2ba7077fd4ULL, 0xdd65b65e1ea66773ULL, 0x14c1ab0c768cae9cULL, 0xe2d2a5b1c6cca21bULL, 0x5050bc30057d60d2ULL, 0x7408906b4837a08dULL, 0xbed386c76013cecaULL, 0x83b78c253122a3fcULL, 0xbb5d7b859091da11ULL, 0x3b5734c151ced27fULL, 0x20701c20359da81bULL, 0x5d9fc221e2356ebaULL, 0x5bef19c13e49d81fULL, 0x18f8f338b26bda88ULL, 0x1f316f40d05a62b0ULL, 0x139df693e81c38a4ULL, 0xd793ccdcc9000f5aULL, 0x41047849f7ad489bULL, 0x86c9156c022e812aULL, 0x8fa291f29835482dULL, 0x81ab918b7aa66965ULL, 0xd7cc00fb6c1a1255ULL, 0x2f32ce15049d72f4ULL, 0xd7610770f35f648fULL, 0x09646c9ecbe02182ULL, 0x69b348b6928e5341ULL, 0x973392fee159da98ULL, 0xefd3026383872d2dULL, 0xddd84c02e87d5d16ULL, 0xb6ee3aedd499a920ULL, 0x20d967b26f15347aULL,
+        0x76a7470feb462012ULL, 0xfd8b50fc930c4652ULL, 0xea6bafdd6b29f905ULL, 0x9f76718da88f259eULL, 0x90cb44a547b70e37ULL, 0xe23ff516771eaf21ULL, 0x8a27412e138fb16dULL, 0x4d67240b728f1f33ULL, 0xa8dcfd923c118981ULL, 0x5844400760f64da3ULL, 0x4939b1825a47608fULL, 0x1fa3d52faeff22f4ULL, 0x3aafcba9a823bd37ULL, 0x70b076ff67543807ULL, 0xdc97b735ed0d6c14ULL, 0x8bf4125b1390b952ULL, 0xd6c8f69c0beced10ULL, 0x4940766fef5f870bULL, 0x964643895a2f0fedULL, 0x1a004bca94014ed2ULL, 0x7045f669041549d2ULL, 0x743c9c1afcb3283bULL, 0x8d5a94db1001221fULL, 0xee36d4ef9fe690d6ULL, 0xafc97d933c66ecb2ULL, 0x8ab4ddd5071ee0c9ULL, 0xa4825ba6b3fd58beULL, 0x1a490b59d93c0b08ULL, 0x587f45826d39e1bdULL, 0x263c21ff0b5e8173ULL, 0x47828c7501338cd9ULL, 0xb15b35c02d546beaULL,
+        0xe9719481a3b341d0ULL, 0xbe78dd3932b37ac8ULL, 0x056d7fe638e33935ULL, 0xe54cb2e817263f4eULL, 0xfa69a77b41b7226fULL, 0x10a0f75118774f85ULL, 0xb64db66b4de2cb4cULL, 0x8d473ee3e4b65d3bULL, 0xd5e011d51afa6d8dULL, 0x78bfbd7a3d49a155ULL, 0xaeec6b2bc72c58bcULL, 0xfb3c85a9d1ed11afULL, 0x5a67e0a93c4f1cdeULL, 0x40c23918b4d68bb8ULL, 0x86512d7f9395dc6bULL, 0xa93113267e4c62dcULL, 0xef4af6ea04c75beeULL, 0xd2c7acb5c299edf1ULL, 0x08ee00540d70cf4aULL, 0x4740e81d6926f3e9ULL, 0xacba9837090dbc1bULL, 0x08a4d74cbc76d924ULL, 0xedab550fd6366a6fULL, 0xb6efcbe03632040fULL, 0xd7d185d88c13654aULL, 0x12a744ed5a50c9faULL, 0x56054cc176c79835ULL, 0x87dadcecc0e4673bULL, 0x1b9077ea851f60e7ULL, 0x7a88e12b7345bbd5ULL, 0x8768ed8c33d1ad73ULL, 0xa2a1e65095e4456eULL,
+        0x09bd52f25dc51dfbULL, 0xe28c4915a9cae303ULL, 0xd5317d292cb05f8aULL, 0x0269c4e0698340beULL, 0x97793d9cd584809eULL, 0x3419646d5ece333dULL, 0x5d22bdff48b4f580ULL, 0x04ffc9a63b85c59cULL, 0xd2cb262b415804f1ULL, 0xc08bda80f882395cULL, 0xbc21e44cb95f1c68ULL, 0x49ef94383049f8c0ULL, 0x4f5daed63140f6d3ULL, 0x88fe9d7c5a1912acULL, 0x0447e0eabfdfc59aULL, 0x731e22d3d0e93dffULL, 0x5f4b3db8898e12daULL, 0x79f03e548c4b70daULL, 0x496b54482f1e6703ULL, 0x23517f6ce1d44529ULL, 0x26e7ae698d4575c8ULL, 0xc5a4a1c32410365dULL, 0x67ddbdb22e787b0eULL, 0x917bd889b0670eeaULL, 0x73c6cada4de4550aULL, 0x1c52191f640443fcULL, 0xddee8b091e0ba3d1ULL, 0x844b80e33a970a2eULL, 0x11e5fdf63adac394ULL, 0xba5a31bae451ba01ULL, 0x6ba8b3956b678f7bULL, 0x625d1609b12bcfb7ULL,
+        0x5468633f122e586bULL, 0x6b66ce79e6f805fbULL, 0x87d13501c2cb12c1ULL, 0x7753b477d6788653ULL, 0xa3378adff49ff96dULL, 0x13dc184803883533ULL, 0x42ea18b6ea4f2901ULL, 0x878d1076caa2eceaULL, 0x88ada6e6518aeb69ULL, 0x2e778fae0b02bb7eULL, 0xde61dd75f0dc7caaULL, 0x0628a3878c14153cULL, 0x0319fad71ea9d9e1ULL, 0x83a930d17dcba378ULL, 0xbb926b457555b130ULL, 0xf2ba491ae9b53228ULL, 0x1dde4ee9fce0e9dfULL, 0x685d14fbf6a7115aULL, 0xc3d11c34c1d90703ULL, 0x7ebc39e3d541b26dULL, 0xc63e9cb78327aa04ULL, 0xc633d07b45b99210ULL, 0xdfcd7b0037637b21ULL, 0x9ba41c9da78662ebULL, 0x73ee07ad99cbb6c4ULL, 0x01297f56efaf1e77ULL, 0x01f2d636bdf7710cULL, 0xd859bbd1356e99b8ULL, 0x3c282a88e5bb9be4ULL, 0x2654fe1ced32d157ULL, 0x78e190dff71c6d48ULL, 0xc2a44925d9aed8bdULL,
+        0xe55b6a0c9dec89ddULL, 0xe40c230f5408c7bfULL, 0x82b65146325dfec7ULL, 0xf0e5756089392d8cULL, 0xdcd43a418f2a4bc0ULL, 0x6f162ce4a30e54d3ULL, 0xad66660aaad93c6aULL, 0xf9ea80c551a19d83ULL, 0xdd035fd57f961c7eULL, 0x43ce42510a567914ULL, 0xc2e691cb3f8078b4ULL, 0xb20817a5ff82df93ULL, 0xeded63bd8891bec1ULL, 0xa3c3b39b033d8aa3ULL, 0x4e69a896029d7531ULL, 0x259ffee793031d85ULL, 0x6dc998b07338d26cULL, 0xd2841576e7ebe44fULL, 0x893bf3c2f16571c2ULL, 0x56b26a22d3461716ULL, 0xc5c9199f707cc380ULL, 0xc466154a4aa85898ULL, 0x48ab5c187146e6beULL, 0x3cf6bbbbff6c683cULL, 0x018c0e78a536b4fbULL, 0xb5d7a6b7d15b151aULL, 0x55bbe7e670955f24ULL, 0xa0e33a687712df8aULL, 0xfb3f084888df3ba8ULL, 0x88ffaff0f19099a8ULL, 0xb6628923947b7b76ULL, 0x2c55aafecab6d2ccULL,
+        0xbcafb21efce3a0feULL, 0xf0925b3430a3fe43ULL, 0x996714832c082f66ULL, 0x4aa850aebe8624aeULL, 0xce953b735d0a0915ULL, 0xf7eb05e09e4f5556ULL, 0xe8ce528d1858e131ULL, 0x4d310c974099ba54ULL, 0x1bfe5d87a7332a20ULL, 0x5a3e32734fcb3bd7ULL, 0x221491133cff6d8cULL, 0x66e01c27d7441255ULL, 0x856ad6967d8d051aULL, 0x066934bc11d82a90ULL, 0x9140886822c317feULL, 0xeb4fbb9ffff2a8c6ULL, 0x160076b986e9b355ULL, 0xfe561eaf649038b1ULL, 0xbbe5147c82c5538dULL, 0x3d8a2f39389e5534ULL, 0xceafe2d4d61eefa7ULL, 0xb2c0611ad781ec2bULL, 0x02617af44ef89518ULL, 0x80c452d0b5d1f274ULL, 0xfb41f3848d9eec3fULL, 0xe5126c712fc53481ULL, 0x6030e456e6309e20ULL, 0x0b608ff70047b7f6ULL, 0xa29873994f239994ULL, 0x9c67887b781e0fcfULL, 0x0131a6e07adf7f0fULL, 0x232501b40de5aadeULL,
+        0x0627ff94b149350fULL, 0x4d33a0ff3b281172ULL, 0xf4780207a90154baULL, 0xe3161099990d7cb2ULL, 0xf55cad87e37af685ULL, 0x00fd8a022ac47edbULL, 0x30ea5762adfb7b8bULL, 0xb65d11552082dc54ULL, 0x720182869f6b692dULL, 0xc0838c178429b457ULL, 0xd7c485a9ae62ccf5ULL, 0xd5e59287d16efd30ULL, 0x1ebb292cbee9c779ULL, 0x35a5abf319121dd0ULL, 0xc3c9c7ed461875e1ULL, 0xb1bd493f011422ccULL, 0xdc540fb3195106b5ULL, 0x7f18ca26e98fc3b4ULL, 0x46cd0612d8dcc80eULL, 0x9aac927eec146700ULL, 0x82eb985bfaefa47cULL, 0xd5c32c70c9678021ULL, 0x7014014ab413ee63ULL, 0xac60103437090ac6ULL, 0xd76b6bca1fc202ceULL, 0xf234fedcf351c330ULL, 0xd0a78c69ec8faedfULL, 0x74bc766fdb7714e5ULL, 0x3aa3cd9763efd03bULL, 0xc0206316bca57840ULL, 0xdc60e2f2d7d0f870ULL, 0xed7b49bb0d275669ULL,
+        0x2f0dc2f9af14ad1dULL, 0x1c83acb137dba329ULL, 0x6fe87146b176755dULL, 0xff3ded550f3fe471ULL, 0xd46d2f9777e37628ULL, 0x6c88aae9421bfefcULL, 0xdfb484ddc83e69d0ULL, 0xe805ec5ba87b0f86ULL, 0x89fd667afccc97dbULL, 0x49aee84b1f9bb128ULL, 0xea56cb7544da41adULL, 0x291c602799a0143dULL, 0x92a9eadebda84bc8ULL, 0xe559066620328a74ULL, 0xa16c947419f27b48ULL, 0xb73bd4cbddd8e762ULL, 0x85399c972ca2b60bULL, 0x9846cf16e4129ba7ULL, 0x205d04dfd11a45feULL, 0x00e123c42617e7a5ULL, 0x27436661f1a67e13ULL, 0xbd36c336774e6197ULL, 0x101ad68b936ece9dULL, 0xb9d93360bce20d74ULL, 0xe2ead5ae9ef64a5fULL, 0x9e1df4e3d5ee9173ULL, 0x2788bf613a51431bULL, 0xf067c13d9cbf2dc5ULL, 0xed0edab307f817a6ULL, 0x25b5f9c29383fe37ULL, 0x33eb69232bf5cd4bULL, 0xa22eb551c757d88eULL,
+        0x24c00c041fc39404ULL, 0x5be3cc4a1d80fd04ULL, 0x142cd7d008af7da9ULL, 0xc7798b061f5ed786ULL, 0x57a4d3776f013dc6ULL, 0x78472561c2a4a2a6ULL, 0xa161feb61032edebULL, 0xba2ceb530c53a4d4ULL, 0x0fc0748e6926d88dULL, 0xf60efcf9c5159e06ULL, 0x2e661963b333fe75ULL, 0x3ddcad15d25b3275ULL, 0xb9f75dcb4cfa3023ULL, 0x014058b23c56fb01ULL, 0x6c81a3233151611cULL, 0x53f34aa46b0178c8ULL, 0xfd30e3b57ce8e431ULL, 0xd715152023957a8fULL, 0xaf0c78fb39f52ee0ULL, 0xaff14cdca5c89986ULL, 0x050d082e2c51431aULL, 0x067c96fd77f50b0aULL, 0xe85597b450e98772ULL, 0x98b827259a5293e6ULL, 0x354a2367114dbaccULL, 0x57c9eb067ba8acecULL, 0x7d1a84913274a046ULL, 0x9f026105521dd2baULL, 0xe6d49a1818368103ULL, 0x15df1a21ed47f37bULL, 0x4a551eac7dcee2abULL, 0x6939f5a878315ea0ULL,
+        0x0087817be42929d6ULL, 0x98e51084be412e60ULL, 0x4eb3d10e78f72831ULL, 0x02ada8347c612693ULL, 0x5fc29f9bae9d2951ULL, 0x94d3c757fbd67957ULL, 0x80f1000503ea8cbbULL, 0x4e2ac5db15484121ULL, 0x5556a8c197436d3dULL, 0x7503611f492ead07ULL, 0xda2e19420bdfcd69ULL, 0x0d5ab3dd234cb74dULL, 0xeb83bfc2905aa4f4ULL, 0xf90d9312e5ef11afULL, 0xc02aa99f1a335feaULL, 0xfcc7641294f851faULL, 0xb05050e70c058151ULL, 0x4824442ebd474482ULL, 0x3fa6ae65b85ef5b6ULL, 0x95ef55f4f081b63aULL, 0x58ff945e2585b05bULL, 0x78478a3a066b2c50ULL, 0xb0a26eeb5a511a72ULL, 0xd5200e2dbdf93fc8ULL, 0xcf57d37f246836ebULL, 0xb2ae27c0e07a0374ULL, 0xd75c88cf72606b63ULL, 0xfc5381baa416fcefULL, 0x2a7da3d55396457dULL, 0x871d27430b1937b4ULL, 0xa2c8f7a3a9189820ULL, 0xa03eba7403b81775ULL,
+        0x19c589d44b43d7d5ULL, 0xfe6fd6f46039fb47ULL, 0x0c6c2883d52b5355ULL, 0x6f4026169da2894eULL, 0x2059a97e66108973ULL, 0x0a7d505e0d2de5cfULL, 0x7790847c4de07f85ULL, 0x10b842786a3b1811ULL, 0xdb519db945ded12bULL, 0x86a7d83d526df068ULL, 0x4d4d9510681b5747ULL, 0x9c3c1b4ab62fad3aULL, 0x530be7435a21e189ULL, 0xa1e4e483aa8da6c9ULL, 0x9e8b54e28eb3c39bULL, 0x98af9f33d0c2f4b0ULL, 0x9b4d903d69199730ULL, 0x0527daf2a18577a3ULL, 0x1e9c496be25e264eULL, 0xd0b3d40e5da6ffa1ULL, 0x2b91c13cb5960665ULL, 0x22afa1facdf815dfULL, 0xc6e6735edffddf0fULL, 0x2aca05b43c4e6bfaULL, 0x8cc518b3330a5108ULL, 0x3a1e1ff71c9a2755ULL, 0xf5e55eb5206e9560ULL, 0x372706558a2b49d0ULL, 0xe550fb80777b0829ULL, 0xc993933a852d3275ULL, 0x4047f8aaeed5010eULL, 0x7c04c9d145c1ed9dULL,
+        0xc09cdbe94af42623ULL, 0x6556f05a0fc10c72ULL, 0x6e89a62adc2d6a3eULL, 0x21440493f77c76d5ULL, 0x901a3ec3f641fb2aULL, 0x07452d075447f0aaULL, 0x31f6deb5adf12d1aULL, 0x5196353da9f9abd9ULL, 0xe6ca9e9335c13eafULL, 0xde89c0b6e1399e5aULL, 0x3cfa79fa7364f529ULL, 0xa4aab22b087c699bULL, 0x75aca2ab7351ba6fULL, 0x97ca7b94e48470d0ULL, 0xfebd4c9adfa2872aULL, 0x30e07bb055f70296ULL, 0x7b8e6ff9930c86f3ULL, 0x6d7e819dc5d6b8f0ULL, 0x834c6ed3dc8d86b4ULL, 0xbc7190d3c5eeab0dULL, 0xc136be5c27d3ff7aULL, 0x90002c2b8d2f766aULL, 0xe7e6661941ea9850ULL, 0xaf5724aca2ec8d73ULL, 0xc0c6b85946a7c716ULL, 0xe088d4c459e8134fULL, 0x75fc468a8ea48572ULL, 0x9f35734de956dfdaULL, 0x0003872aa4bf3fa8ULL, 0xbd0fbefbb13f7eb2ULL, 0x18d037a076cfcaedULL, 0xdd5ee6c587b1c2f0ULL,
+        0x6fd3c97a2bc3ecd1ULL, 0x3cb4c50beb978029ULL, 0x75e66e26c249566aULL, 0x3f68cfd465dceef5ULL, 0xe99a58b3497e9a2fULL, 0xec85b83b6ead2078ULL, 0xb28c392c8de9d52aULL, 0x66a599a112224290ULL, 0x48801866cdf1e9d4ULL, 0xf0eea2d7f951e5efULL, 0xa9f88f94867d22e3ULL, 0x09b13aad7572b327ULL, 0x58adbb3da86eaf67ULL, 0xca58fb4e07db19c4ULL, 0xccd45b9a8ecf7057ULL, 0x952c42219fb8e1d5ULL, 0xb9c21cc87c3ac851ULL, 0x31de43b11c6f46deULL, 0x8481e99098c2c96dULL, 0xad660457083a7d15ULL, 0xc30a805ab9fb1562ULL, 0xbfe03f825b035986ULL, 0x0e7069f8f9013591ULL, 0xe88325b17760e1c0ULL, 0x7b1b7eba1475e253ULL, 0x9eff71a94bbd97d0ULL, 0xa4507ba93b4c307aULL, 0x6c2a14470b99efb7ULL, 0x64af578c9749f295ULL, 0xf564b5e89b63931fULL, 0x0bd88e7e775e3175ULL, 0x647f7156a35518e0ULL,
+        0x0238a7cf7749cce9ULL, 0x3251404c14a3d6a4ULL, 0xc5f554819d6ca43aULL, 0x491ee78dc4a30a63ULL, 0x1c0e06a290e278c6ULL, 0x7fba79f5f3eb00bbULL, 0x7044530eeb87103cULL, 0xa0fc4955c5b788fbULL, 0x183d3c10e3aff2b9ULL, 0x11b18181734ae99bULL, 0x0dd81dc79bf1dc12ULL, 0x780ea134be6b60e7ULL, 0xfcdffe48214537d8ULL, 0x6bdcbd6cf081d2a1ULL, 0x7929323c35d43fb2ULL, 0xb6f78a716ea66e05ULL, 0xf1540fe960810da0ULL, 0x48d18d48f97e1dabULL, 0x0eab48e20852a30aULL, 0x313ee6ff2bb42aa0ULL, 0xbacf14c65d0e1e49ULL, 0xd703812755b51acdULL, 0x8a983af01fb5f178ULL, 0x3710d929c6d9f303ULL, 0x6946a7f03a534ddaULL, 0x2bd272292f223274ULL, 0xaaac50d8eedc7174ULL, 0x6a6bc8d7db72fb6dULL, 0xfbb9718ce14c00bdULL, 0xec8f64ebefd02a57ULL, 0x2a54755fad2b5245ULL, 0x92b5502784a73ad3ULL,
+        0xa2b787d35bdaef3dULL, 0x9dfd470f26dbdb91ULL, 0xba975c8dc7dc0063ULL, 0x903b67ea5f8c8218ULL, 0x0442d8447638626eULL, 0xa6312303eb9b2e5dULL, 0x02fb396d77383e27ULL, 0x0bbdf27b0227eb81ULL, 0x9b454f1f149a7a27ULL, 0x33e41afe9b1a4129ULL, 0xddd8f2ba0f2457acULL, 0x3da01da887339503ULL, 0x761dc50b742f17a9ULL, 0xb0bc8cb3f5b08b57ULL, 0x9b4aeaa1538d87f3ULL, 0xaec91263473531c5ULL, 0x79e9bc29bc5c8baeULL, 0x9f33c0c38e18186fULL, 0xec89932319ea60bcULL, 0x0cdd8ac3222569fcULL, 0xcaf6cc4b7dc868e8ULL, 0xb5ad6c8a7ae94cc8ULL, 0x29e5fb61cd2dc681ULL, 0x2c82d8930163179aULL, 0x30e92c6e6cac452fULL, 0x1a13b0a50b12d799ULL, 0x700c698f6ffd40b5ULL, 0x7b5991bbb2707b87ULL, 0x7fafcf4e118771f8ULL, 0x772bb9f28cddd218ULL, 0x241ec6ca6fa54f2eULL, 0xffae15ce456714a8ULL,
+        0x597a49cc6461291dULL, 0xbb96e5a23f585a6eULL, 0xe7d5eb49d384d1afULL, 0x5e2de0a7e75cd1d9ULL, 0xa840524f9e927adbULL, 0x606d66c340d653ecULL, 0x4dbb4833d9706181ULL, 0xad76d91eddf81dd7ULL, 0x2ca8d40850beaf65ULL, 0x384d543c1ac02d17ULL, 0xa53fc3d7d6a653dfULL, 0x242bfd235782de8eULL, 0xee694851a8ced6caULL, 0xc6825e41fec02c6aULL, 0x19fd2b99e635d09dULL, 0xb0e3070bbb278dc8ULL, 0xa9a9467b9afb4a1aULL, 0xfa6960437b5deab2ULL, 0x4eaf58757b7108d3ULL, 0x782178c4d69d5123ULL, 0x992b4908fd937b11ULL, 0x372b451409a8b541ULL, 0xb2ae5bfdab3eecd0ULL, 0x7a71e0d6907d8eb8ULL, 0x8ef97acc8e974f0eULL, 0xb164b661e4007098ULL, 0x16a0efefe25bc996ULL, 0x79607022a6e71afaULL, 0x9e18afb09d0841aeULL, 0x91793b3a331f514fULL, 0xb9a542c1a2fa529dULL, 0x63f8a3328ad7c391ULL,
+        0xcf3406900e889e49ULL, 0x36769a3b0bffc7a4ULL, 0xa7adf78f4933df62ULL, 0x3427fbafe9345d48ULL, 0x310dc2c6f7470bb7ULL, 0x2339524b99ba3cedULL, 0xbde77cb9e5731613ULL, 0xaeb9f4402a6a9721ULL, 0x3ea9c7b4b29de59aULL, 0x9270b845eaf1d26dULL, 0x66fa1d9fc80b5b6eULL, 0x41fbf342fb35b5bdULL, 0xfafb40939307e0f3ULL, 0x61859816b4510dd3ULL, 0x2506c90d6749b75bULL, 0xd480845fb0ff375cULL, 0x12dbe32ee1a7eafcULL, 0xd0dcc54a8d0f82ceULL, 0x9d91f010e65a982dULL, 0x1915b938180353d4ULL, 0x06c75fbe1199f7b9ULL, 0xda8793335444a6bdULL, 0x8918a9d2c6e5e7e9ULL, 0xb7de6d8999340956ULL, 0x40bda79b75c7b287ULL, 0x507cb95e77d737c9ULL, 0xab838ef3da01e32dULL, 0xfbc2911ce1c14f57ULL, 0x5dab300c8797fe01ULL, 0x64a76a944c80c34eULL, 0x0836f257f2ccf50eULL, 0x37e766038c0b2bc9ULL,
+        0x212320340046edffULL, 0x8fb66afccd174305ULL, 0x12ca3e3b993cfa50ULL, 0xcea5a6dfc265107fULL, 0x973829ff44acf479ULL, 0xb3fff24045a67ac3ULL, 0x5b2fb404f3828856ULL, 0x20093b5ac6491267ULL, 0xf5e281dde5554959ULL, 0x0e09068ee9803429ULL, 0x02f12b68cd8c57aeULL, 0x0e7bbcf6fd5d968eULL, 0xcd32da5bcfdfd549ULL, 0x6c80a2ed62bbb9f4ULL, 0xdd0d812141ba4596ULL, 0xc5b80d94a1a42b7dULL, 0x6193bf4c16058cd2ULL, 0x6132e6b7972902a7ULL, 0x7a8781c806385d61ULL, 0xcca9a430d594e5cbULL, 0xdfcb8ff55301fe79ULL, 0x25df16ba9d66d2fbULL, 0x79f64c57d1e041b2ULL, 0x96063d164052ed75ULL, 0xd876344d06edc61aULL, 0x14c5f7b2059919f1ULL, 0xa223ef508a0392deULL, 0x4b760579e7b39a4fULL, 0xc494bdca4bbe5cf4ULL, 0x8ae3ecc303cc2de5ULL, 0xd72609e6424bb9b6ULL, 0x8c5c9ff0181af19cULL,
+        0x8864c58c44fe404fULL, 0x99d7011827914a41ULL, 0x3e6069168ad55ef8ULL, 0x93a51de25df37ca0ULL, 0x94a4b52a7f437c42ULL, 0x763ea2213214e384ULL, 0x0a583f3fdad9b10fULL, 0x95a64c140bd17e13ULL, 0x980f74e8eecd731fULL, 0xb2c111a05cc96cfdULL, 0xd975a34040ce749aULL, 0x63c58ef8ca0c5f9eULL, 0x04dacc566262e792ULL, 0x6b839227d9cb146dULL, 0x4a04dd0ef9ecc363ULL, 0x95c388a01aa8cef4ULL, 0x174892bf8f624822ULL, 0x7f42e755c549e46aULL, 0x5dde436c26b14a61ULL, 0xe05447af662e7792ULL, 0x572690c98f056e80ULL, 0x7377e33bea343ae6ULL, 0x002c26a4ca5e8986ULL, 0xd9c9f5c14d4ba47fULL, 0x08bac5781c95c41dULL, 0x1d76df6d4c6eb4d3ULL, 0xf8f88f2022e95ab2ULL, 0x8e1c8a86543a1d84ULL, 0x2fe78199d5941563ULL, 0x5b8e9853290026d6ULL, 0x448b076bd4a9dd8cULL, 0xdaea448c244afb81ULL,
+        0x5e17f4ffeb340a1bULL, 0x18e593998d7f82d2ULL, 0x3bb4620d131358c5ULL, 0x0f3b8197ab99a48eULL, 0x986b6d313a6b724bULL, 0x0f2264a5dba7346fULL, 0x223c23a052d8a2bdULL, 0xeefc66850557cd6dULL, 0x41279b2eca3d36e7ULL, 0x9d11c7f60f1e65b5ULL, 0x3197a74d5b395641ULL, 0xf0ea556785d976a5ULL, 0xa20a58df9e19ab37ULL, 0xba27e53672cb3728ULL, 0xa480d66cf76efef7ULL, 0x041c97ad66eba5d9ULL, 0xadce361d7db109cfULL, 0xdf80b50d562dc56eULL, 0xedb77807cc52ba72ULL, 0xa6ba3d4ef1f2d246ULL, 0x89e3848b75375a98ULL, 0x43c0cb38276bc809ULL, 0x4b7598481b09c2b6ULL, 0xab94c7f805f3fa99ULL, 0x8c81fb3332ab6fadULL, 0x78749a38f0201464ULL, 0xcbf78b01826bc6e2ULL, 0x975f00d8b26bd028ULL, 0x169778a68ab0f2fdULL, 0xb16583fdaad4b764ULL, 0x4ed24c9f4db8c37aULL, 0x7b1d95fb0a42527fULL,
+        0x2b52641d1c783081ULL, 0x8651147f49b2b1b3ULL, 0x0372e047703344a2ULL, 0xa15efd115b927ec0ULL, 0xfa929a65cb2135fcULL, 0x5b53b29ee21f24f8ULL, 0x21dd148d3ed76d28ULL, 0x61bf2c49ffa56692ULL, 0x44602551ed2295fbULL, 0x31a0f06b26dcb384ULL, 0x8124ea4a5699ae8aULL, 0x56bb637488b926beULL, 0xf50c4333ff575affULL, 0xccc6c87827f70c9dULL, 0x3e5fada290581b7dULL, 0x61a9650de6d5e246ULL, 0x5f7839810246ca26ULL, 0xb5c58a725f092dd9ULL, 0xd723571b43f85f96ULL, 0x0bb49b77c51b15adULL, 0xda1fbf3a0178fdd2ULL, 0x4b6762bc2a3ad0c8ULL, 0x3c940228c92132ebULL, 0x70cafdd00890954aULL, 0xcce0db07ada00ca6ULL, 0xd3e874095c54dac4ULL, 0xb2c9ad7ce627ab8aULL, 0xbfdd6bb9f2709ca3ULL, 0x3d53867838240b3aULL, 0xab135d18b01c36efULL, 0x323a6557309cf96cULL, 0xbec27781cbe0a84dULL,
+        0x68d842659bdad4a2ULL, 0xb10521906bf7f93eULL, 0xf98d19c31c5b0447ULL, 0x5d1d2ceebd07a1a7ULL, 0x45351af1d13e9e8dULL, 0x728d610d65fea7e7ULL, 0x198ec3b79bd35e25ULL, 0xd19968c270f28305ULL, 0xdb069dd0ef46c09bULL, 0xba730b4a8ee03f11ULL, 0x9727959d2de98e61ULL, 0x2c46457cd84f9651ULL, 0x6c30dcef92b75319ULL, 0xd9463d469595070cULL, 0xbc214a015e3e6b38ULL, 0xe58e413764706210ULL, 0x7b1a86550d0896b4ULL, 0xe79e547a51ff6a5fULL, 0xf1a1bdf405ed153bULL, 0x5f12d2d4aef1372eULL, 0x617b9c0a83f65833ULL, 0x9a0a49639e994cddULL, 0x2051a3741d43d8beULL, 0xa69dc75081c8f921ULL, 0xf8d6da14b5dd3a62ULL, 0x80029d031def7a0aULL, 0xa06e7b339843adccULL, 0x9d465121395224cdULL, 0xfd851734d88ad72bULL, 0x65feadb7e5df1128ULL, 0x7f906b98fa6fc95bULL, 0x71be0c01ff0f230dULL,
+        0x09cd7876befb97a3ULL, 0xc5b2ecb552530d03ULL, 0x9da9394fd9510282ULL, 0xf48162a69868f59bULL, 0xfa2e8ef5ee3b1b6fULL, 0xbea7675886d20b12ULL, 0x3466219753437189ULL, 0x9d78d4c412569481ULL, 0xddb7411fe0840027ULL, 0xd4101b446afe4366ULL, 0x8bdf71b4a97490c5ULL, 0x76dd9be56cc22ad6ULL, 0xc23543360fd55d1cULL, 0xe457f8b3c02f1f6bULL, 0xf5ccfd01bae3aab2ULL, 0x238be00762a4d635ULL, 0x87b385f1401815c1ULL, 0x570af63f187fb721ULL, 0xc0fd2bc5c86f1772ULL, 0x013c943ff1afca8fULL, 0x8eba111c0e2030c0ULL, 0xc0872809162fb963ULL, 0xaf2da47389e2c527ULL, 0x751ba0a9863324b1ULL, 0xf05fd8cd5edff83eULL, 0x3874c5a74bb1f753ULL, 0xc764e2a9464bd40bULL, 0xc641dc07345f0ceeULL, 0xcd61cd934cd725b0ULL, 0x80ae7dfa471cee66ULL, 0xd6b3d55550a746f1ULL, 0x4c998560e14b97f9ULL,
+        0x25a61b4c8c0f5fdcULL, 0x08221a8b956c1f7eULL, 0x9ee6410a85a1fd5cULL, 0x47830ca045c089f9ULL, 0x4b7dfbae8c7eaa9eULL, 0x0149663f12ebd1c5ULL, 0xa2b86b90aa1e3a4dULL, 0x37a47e1131668bf8ULL, 0x6173e7af7de4d339ULL, 0x52a4bb883194bf0eULL, 0x25387493bfee57dcULL, 0x81e42d9e8c7ab30fULL, 0xad81bbd170c4263fULL, 0xa6b08238ad3adaf1ULL, 0x04ba344e48a52d85ULL, 0x87fc631c698022eaULL, 0xe895cc7b5f41d9f5ULL, 0x37e05e1e6c4970dcULL, 0x857c46cbd886729eULL, 0x64a83eae358cc33bULL, 0xe0d0300a97e85100ULL, 0x9790991b7f58783dULL, 0xd4b8a20cb49d3492ULL, 0x88596cb83e19b373ULL, 0xda7b2713cb02f354ULL, 0x61cf164d8eabff76ULL, 0x1fbb2df6bd3c357aULL, 0xf95bf332b6d446ffULL, 0xdfca9893de672c7aULL, 0x447d058d81aa85aaULL, 0x0261023a930dfe1bULL, 0x27a4ac27e4c9d5d1ULL,
+        0x98ce1505a72b0ab2ULL, 0xe1df1ce33fccffafULL, 0x7a56e7983ab87473ULL, 0x1effcfc48681831bULL, 0x3c8f3763c05e391aULL, 0xfb35c72efc738e35ULL, 0x4b58019b7c667d11ULL, 0xbd2882f121b13bb0ULL, 0x755f04ee8936e727ULL, 0x8a1eb4bfff18983aULL, 0x074a08847c019f9cULL, 0xd2e7da420c021e24ULL, 0x905939f692fd8833ULL, 0xdcfd3e8d80b36589ULL, 0x86f3d61e58536c43ULL, 0x42dc4cedd685f746ULL, 0x81f733467fe9e700ULL, 0x1f9be654d907efeeULL, 0x389af5d7ed8cbc2fULL, 0xdbeba2fbd1891a64ULL, 0xd6564db1f30dfd0eULL, 0x1e4f083bdf8d2882ULL, 0xea7209f7c0231e79ULL, 0xb763678c2d01d643ULL, 0x8436ed05a84b12ffULL, 0xf7bb71a7a1eaa5e5ULL, 0x6afa4721f1e31e02ULL, 0x38b39620288d7253ULL, 0xa707954344844439ULL, 0xff251eebf6b7ceafULL, 0xab77bc654988e935ULL, 0x05193a3984a7e01aULL,
+        0xc6704a762f02b30dULL, 0x07238f8afb7d2d94ULL, 0xad21701bcb2c1627ULL, 0xee152b0925bea8a5ULL, 0x2eb9d7f072c5233cULL, 0x3ec94369e3f41747ULL, 0x601208e2cab90c64ULL, 0xabe9a0f48b328d7eULL, 0x23b0d9971f4c2b37ULL, 0xc871cfaaa7dac7e2ULL, 0xbf25931469a99690ULL, 0xf369e3d308f1005eULL, 0x68a0fd08f352048cULL, 0x131ea4f2f50d089aULL, 0x4fbc1a75f63932a5ULL, 0xdba761a02850d501ULL, 0xc11f7f93b8d21cd8ULL, 0xd6712b59696385eaULL, 0xfa5128c6543015ffULL, 0xf3aeafd2596753deULL, 0x880eaac9f5334adbULL, 0x64f35e838878a806ULL, 0xfad12c3205b7b31eULL, 0xa1ac3841a863fce7ULL, 0x733ad6322f06c3c2ULL, 0xdcbf1610128bd71cULL, 0xfd6ff3b51bde0624ULL, 0x72dc2532f7992933ULL, 0x0f06e5a9e98d18adULL, 0x0f67d63b2b6ca264ULL, 0x09a382a441886dd5ULL, 0x2b56a166553ef2f1ULL,
+        0x38c87a09a1697432ULL, 0xd521dba2f4c3b94dULL, 0xa8cce193bf9eff53ULL, 0x31ed9470f574e92dULL, 0x2f8d7f1ae0dbbdf1ULL, 0xeb8fa0e767843d69ULL, 0xf949492442c18ce2ULL, 0x1dde5ae412e52554ULL, 0xd9f7dc127abbed5cULL, 0xbcb90c108f7ef64dULL, 0x9f8223271474f7f2ULL, 0x97246dbf058f9badULL, 0x312f386f0fcf97b2ULL, 0x8b16bc27bb923a95ULL, 0x9d1a2f6d4f92b4c5ULL, 0x2d57620c1d2a50b4ULL, 0x8b04ec7b4d1ceb43ULL, 0x623d2ade848d3f09ULL, 0x59e49b3eda415075ULL, 0xa3eb5d498f8f11dcULL, 0x279ebb3653c49b6cULL, 0x1392803208fc6ed5ULL, 0x8094343e200603a3ULL, 0x4d450742283c0bb1ULL, 0x3bb27939692a284dULL, 0x909946375db22a09ULL, 0x95d24724c0d91beaULL, 0x62ff66a0aaf7463fULL, 0x25238ce458be7e5aULL, 0x57587024dba57a25ULL, 0xa1b4dd8bcd3a5f70ULL, 0x3f67d914d2a4c3cdULL,
+        0x1a1a5c9517316978ULL, 0x0545d5def4c7261eULL, 0xbd43e2b1dafad898ULL, 0xa0ed7e14d64ff83dULL, 0xd36318c0a540b0b1ULL, 0x89c4bbcbaab2014aULL, 0xf86e2012c942f863ULL, 0xb3140503b1352a1aULL, 0x349fae3b459944d3ULL, 0x86da81ee7c0576e9ULL, 0xd58d515c595c45e1ULL, 0x8c0a1c15bc39279aULL, 0x4225213811fab719ULL, 0x5c4a68ed4a42525fULL, 0xa574386c581ed2b0ULL, 0x89d16a9d2fc9379cULL, 0x006e845dfd7022edULL, 0xd0970335fe3a852bULL, 0xc484c61b0c15b521ULL, 0x7fcb1e9b93f9bb90ULL, 0xbcd7b8090b16e5f5ULL, 0x3c0d2e42581e5827ULL, 0x32ae820c218e197eULL, 0x0cb17bd10f01ab96ULL, 0x49cbf8977d91b4ecULL, 0xbfc9ff1e1707eba2ULL, 0x82cbf12b6efac93cULL, 0xc4356193a28d2684ULL, 0xcad6da88efbfcb51ULL, 0x605b751a73937b97ULL, 0xac3e62636d74690eULL, 0x2551836a520143b8ULL,
+        0x84681512f3514085ULL, 0xa37ddd98826f9f32ULL, 0x2c335d958a192912ULL, 0xb74315c5b0d2fa33ULL, 0xc101b4eb7cf46b9cULL, 0x1022b68325e1099cULL, 0x1293b46bb5c71575ULL, 0x23c70f490a7c1a09ULL, 0x1a22712fd6c37c1aULL, 0xd5a2bb80f0966c2cULL, 0xb01690a2ed7d24d2ULL, 0x6c62ec09b411f33cULL, 0xbab1af93c5492239ULL, 0xd06ebd5991b15a13ULL, 0xe2730469aa9dd493ULL, 0xa520146f6257e80fULL, 0xdc766b1829077ebaULL, 0xb1b9ce19ce672900ULL, 0x57217d9598485831ULL, 0x461f71191732ac9cULL, 0x0c3327b398b152a9ULL, 0x2c3cd51bef2724ddULL, 0x93f4f897a20403ddULL, 0x761dbf5c81b4bec4ULL, 0x492d8d3d8d40c282ULL, 0x1eb7e02c7ec7d37eULL, 0xab181ebb201365d2ULL, 0xe8837431f350ca8eULL, 0x32338323c93c2305ULL, 0x202091da37102fcdULL, 0x962b842f64211b7bULL, 0x04115b7c4a2e1828ULL,
+        0x561b6306743d5dd9ULL, 0x464fc02eaf59dd99ULL, 0x0443b688c06ad778ULL, 0x6dad754726471221ULL, 0x9c93213d6fe36377ULL, 0x2a15482b29820396ULL, 0xc6e1320d41720587ULL, 0x5c1a1f9d6465f4e1ULL, 0x8f80bcc88d00bdc2ULL, 0x5bea93c761d3d829ULL, 0x69508c735ca37176ULL, 0xec267b6984e3e0c3ULL, 0x1e917b6bcbfd9c7dULL, 0x9799b6e922cd4efaULL, 0x997646616757fd11ULL, 0x62cc85b68e4ad927ULL, 0x39469019b82b60f8ULL, 0xdca9d0c4fa3c5f73ULL, 0x969e53eadb9503acULL, 0xb4a4c8ff44770084ULL, 0x38c5569d2ef05ec1ULL, 0x981f6cfd53370bafULL, 0xb37149a9e4df58d0ULL, 0x7bb9dda638179766ULL, 0x2a4a2e0b48242d78ULL, 0xbdb0650581075723ULL, 0xb5668b6acb66b71bULL, 0x83805d0b2ca8838cULL, 0x7d6da37dcd955fa3ULL, 0x0c5291c6bb017129ULL, 0xe36f278dc79cd977ULL, 0xb75f0be492409e41ULL,
+
+    };
+
+
+#endif // ROCRAND_SCRAMBLED_SOBOL_PRECOMPUTED_H_
@@ -107,11 +107,16 @@ public:
         discard_state();
     }
 
-    /// Advances the internal state by stride times, where stride is power of 2
+    /// Advances the internal state by stride times
     FQUALIFIERS
     void discard_stride(unsigned int stride)
     {
-        discard_state_power2(stride);
+        if(stride == 1)
+            discard_state();
+        else if((stride & (stride - 1)) == 0)
+            discard_state_power2(stride);
+        else
+            discard_state_stride(stride);
     }
 
     FQUALIFIERS
@@ -176,6 +181,22 @@ protected:
         m_state.i += stride;
     }
 
+    FQUALIFIERS
+    void discard_state_stride(unsigned int stride)
+    {
+        // Generalized leap frog for arbitrary jumps: the state changes by
+        // the vectors of bits that differ in Gray codes of i and i + stride
+        const unsigned int j = m_state.i + stride;
+        unsigned int c = (m_state.i ^ (m_state.i >> 1)) ^ (j ^ (j >> 1));
+        while(c != 0)
+        {
+            // the rightmost one bit of c
+            m_state.d ^= m_state.vectors[rightmost_zero_bit(~c)];
+            c &= c - 1;
+        }
+        m_state.i = j;
+    }
+
     // Returns the index of the rightmost zero bit in the binary expansion of
     // x (Gray code of the current element's index)
     FQUALIFIERS
@@ -213,6 +234,7 @@ protected:
 
 /// \cond ROCRAND_KERNEL_DOCS_TYPEDEFS
 typedef rocrand_device::sobol32_engine<false> rocrand_state_sobol32;
+typedef rocrand_device::sobol32_engine<true> rocrand_state_sobol32_block;
 /// \endcond
 
 /**
@@ -251,6 +273,98 @@ unsigned int rocrand(rocrand_state_sobol32 * state)
     return state->next();
 }
 
+/**
+ * \brief Initialize SOBOL32 block state cooperatively by all threads of the block.
+ *
+ * Copies the 32 direction \p vectors of one dimension to \p shared and
+ * initializes \p state with them and \p offset. All threads of the block must
+ * call the function with the same \p vectors, every thread with its own
+ * \p offset. Unlike rocrand_state_sobol32, which keeps a copy of the vectors
+ * in every thread, the block state only points to \p shared, so the vectors
+ * are read from global memory once per block and every step reads shared memory.
+ * \p shared must stay valid while the state is used.
+ *
+ * \param vectors - Direction vectors (in global memory)
+ * \param offset - Absolute offset into sequence
+ * \param state - Pointer to state to initialize
+ * \param shared - Pointer to 32 <tt>unsigned int</tt> values of shared memory
+ */
+__forceinline__ __device__
+void rocrand_init_block(const unsigned int * vectors,
+                        const unsigned int offset,
+                        rocrand_state_sobol32_block * state,
+                        unsigned int * shared)
+{
+    const unsigned int tid = hipThreadIdx_x
+        + hipBlockDim_x * (hipThreadIdx_y + hipBlockDim_y * hipThreadIdx_z);
+    const unsigned int threads = hipBlockDim_x * hipBlockDim_y * hipBlockDim_z;
+    for(unsigned int i = tid; i < 32; i += threads)
+    {
+        shared[i] = vectors[i];
+    }
+    __syncthreads();
+    *state = rocrand_state_sobol32_block(shared, offset);
+}
+
+/**
+ * \brief Returns uniformly distributed random <tt>unsigned int</tt> value
+ * from [0; 2^32 - 1] range.
+ *
+ * Generates and returns uniformly distributed random <tt>unsigned int</tt>
+ * value from [0; 2^32 - 1] range using Sobol32 generator in block state \p state.
+ * State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Quasirandom value (32-bit) as an <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand(rocrand_state_sobol32_block * state)
+{
+    return state->next();
+}
+
+/**
+ * \brief Returns the current value and advances the state by \p stride elements.
+ *
+ * Returns the same value as rocrand() and then skips \p stride - 1 further
+ * elements, so threads of a grid initialized with offsets <tt>offset + id</tt>
+ * can generate elements <tt>offset + id + k * stride</tt> (leap frog).
+ * For powers of 2 (e.g. grid sizes of 2^k threads) a step
+ * reads only 2 direction vectors, for other strides the number of changed
+ * bits of the Gray code of the position.
+ *
+ * \param state - Pointer to a state to use
+ * \param stride - Number of elements to advance, not 0
+ *
+ * \return Quasirandom value (32-bit) as an <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_strided(rocrand_state_sobol32_block * state, unsigned int stride)
+{
+    const unsigned int p = state->current();
+    state->discard_stride(stride);
+    return p;
+}
+
+/**
+ * \brief Returns the current value and advances the state by \p stride elements.
+ *
+ * See rocrand_strided() for SOBOL32 block states.
+ *
+ * \param state - Pointer to a state to use
+ * \param stride - Number of elements to advance, not 0
+ *
+ * \return Quasirandom value (32-bit) as an <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_strided(rocrand_state_sobol32 * state, unsigned int stride)
+{
+    const unsigned int p = state->current();
+    state->discard_stride(stride);
+    return p;
+}
+
 /**
  * \brief Updates SOBOL32 state to skip ahead by \p offset elements.
  *
@@ -265,6 +379,20 @@ void skipahead(unsigned long long offset, rocrand_state_sobol32 * state)
     return state->discard(offset);
 }
 
+/**
+ * \brief Updates SOBOL32 block state to skip ahead by \p offset elements.
+ *
+ * Updates the SOBOL32 block state in \p state to skip ahead by \p offset elements.
+ *
+ * \param offset - Number of elements to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead(unsigned long long offset, rocrand_state_sobol32_block * state)
+{
+    return state->discard(offset);
+}
+
 /** @} */ // end of group rocranddevice
 
 #endif // ROCRAND_SOBOL32_H_
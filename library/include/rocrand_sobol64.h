@@ -0,0 +1,288 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef ROCRAND_SOBOL64_H_
+#define ROCRAND_SOBOL64_H_
+
+#ifndef FQUALIFIERS
+#define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS_
+
+#include "rocrand_common.h"
+
+// S. Joe and F. Y. Kuo, Remark on Algorithm 659: Implementing Sobol's quasirandom
+// sequence generator, 2003
+// http://doi.acm.org/10.1145/641876.641879
+
+namespace rocrand_device {
+
+template<bool UseSharedVectors>
+struct sobol64_state
+{
+    unsigned long long d;
+    unsigned long long i;
+    unsigned long long vectors[64];
+
+    FQUALIFIERS
+    sobol64_state() { }
+
+    FQUALIFIERS
+    sobol64_state(const unsigned long long d,
+                  const unsigned long long i,
+                  const unsigned long long * vectors)
+        : d(d), i(i)
+    {
+        for(int k = 0; k < 64; k++)
+        {
+            this->vectors[k] = vectors[k];
+        }
+    }
+};
+
+template<>
+struct sobol64_state<true>
+{
+    unsigned long long d;
+    unsigned long long i;
+    const unsigned long long * vectors;
+
+    FQUALIFIERS
+    sobol64_state() { }
+
+    FQUALIFIERS
+    sobol64_state(const unsigned long long d,
+                  const unsigned long long i,
+                  const unsigned long long * vectors)
+        : d(d), i(i), vectors(vectors) { }
+};
+
+template<bool UseSharedVectors>
+class sobol64_engine
+{
+public:
+
+    typedef struct sobol64_state<UseSharedVectors> sobol64_state;
+
+    FQUALIFIERS
+    sobol64_engine() { }
+
+    FQUALIFIERS
+    sobol64_engine(const unsigned long long * vectors,
+                   const unsigned long long offset)
+        : m_state(0, 0, vectors)
+    {
+        discard_state(offset);
+    }
+
+    FQUALIFIERS
+    ~sobol64_engine() { }
+
+    /// Advances the internal state to skip \p offset numbers.
+    FQUALIFIERS
+    void discard(unsigned long long offset)
+    {
+        discard_state(offset);
+    }
+
+    FQUALIFIERS
+    void discard()
+    {
+        discard_state();
+    }
+
+    /// Advances the internal state by stride times
+    FQUALIFIERS
+    void discard_stride(unsigned int stride)
+    {
+        if((stride & (stride - 1)) == 0)
+            discard_state_power2(stride);
+        else
+            discard_state_stride(stride);
+    }
+
+    FQUALIFIERS
+    unsigned long long operator()()
+    {
+        return this->next();
+    }
+
+    FQUALIFIERS
+    unsigned long long next()
+    {
+        unsigned long long p = m_state.d;
+        discard_state();
+        return p;
+    }
+
+    FQUALIFIERS
+    unsigned long long current()
+    {
+        return m_state.d;
+    }
+
+protected:
+    // Advances the internal state by offset times.
+    FQUALIFIERS
+    void discard_state(unsigned long long offset)
+    {
+        m_state.i += offset;
+        const unsigned long long g = m_state.i ^ (m_state.i >> 1);
+        m_state.d = 0;
+        for(int i = 0; i < 64; i++)
+        {
+            m_state.d ^= (g & (1ULL << i) ? m_state.vectors[i] : 0);
+        }
+    }
+
+    // Advances the internal state to the next state
+    FQUALIFIERS
+    void discard_state()
+    {
+        m_state.d ^= m_state.vectors[rightmost_zero_bit(m_state.i)];
+        m_state.i++;
+    }
+
+    FQUALIFIERS
+    void discard_state_power2(unsigned int stride)
+    {
+        // Leap frog
+        //
+        // T Bradley, J Toit, M Giles, R Tong, P Woodhams
+        // Parallelisation Techniques for Random Number Generators
+        // GPU Computing Gems, 2011
+        //
+        // For power of 2 jumps only 2 bits in Gray code change values
+        // All bits lower than log2(stride) flip 2, 4... times, i.e.
+        // do not change their values.
+
+        // log2(stride) bit
+        m_state.d ^= m_state.vectors[rightmost_zero_bit(~static_cast<unsigned long long>(stride)) - 1];
+        // the rightmost zero bit of i, not including the lower log2(stride) bits
+        m_state.d ^= m_state.vectors[rightmost_zero_bit(m_state.i | (stride - 1))];
+        m_state.i += stride;
+    }
+
+    FQUALIFIERS
+    void discard_state_stride(unsigned int stride)
+    {
+        // Generalized leap frog for arbitrary jumps: the state changes by
+        // the vectors of bits that differ in Gray codes of i and i + stride
+        const unsigned long long j = m_state.i + stride;
+        unsigned long long c = (m_state.i ^ (m_state.i >> 1)) ^ (j ^ (j >> 1));
+        while(c != 0)
+        {
+            // the rightmost one bit of c
+            m_state.d ^= m_state.vectors[rightmost_zero_bit(~c)];
+            c &= c - 1;
+        }
+        m_state.i = j;
+    }
+
+    // Returns the index of the rightmost zero bit in the binary expansion of
+    // x (Gray code of the current element's index)
+    FQUALIFIERS
+    unsigned int rightmost_zero_bit(unsigned long long x)
+    {
+        #if defined(__HIP_DEVICE_COMPILE__)
+        unsigned int z = __ffsll(~x);
+        return z ? z - 1 : 0;
+        #else
+        if(x == 0)
+            return 0;
+        unsigned long long y = x;
+        unsigned int z = 1;
+        while(y & 1)
+        {
+            y >>= 1;
+            z++;
+        }
+        return z - 1;
+        #endif
+    }
+
+protected:
+    // State
+    sobol64_state m_state;
+
+}; // sobol64_engine class
+
+} // end namespace rocrand_device
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+/// \cond ROCRAND_KERNEL_DOCS_TYPEDEFS
+typedef rocrand_device::sobol64_engine<false> rocrand_state_sobol64;
+/// \endcond
+
+/**
+ * \brief Initialize SOBOL64 state.
+ *
+ * Initializes the SOBOL64 generator \p state with the given
+ * direction \p vectors and \p offset.
+ *
+ * \param vectors - Direction vectors
+ * \param offset - Absolute offset into sequence
+ * \param state - Pointer to state to initialize
+ */
+FQUALIFIERS
+void rocrand_init(const unsigned long long * vectors,
+                  const unsigned long long offset,
+                  rocrand_state_sobol64 * state)
+{
+    *state = rocrand_state_sobol64(vectors, offset);
+}
+
+/**
+ * \brief Returns uniformly distributed random <tt>unsigned long long</tt> value
+ * from [0; 2^64 - 1] range.
+ *
+ * Generates and returns uniformly distributed random <tt>unsigned long long</tt>
+ * value from [0; 2^64 - 1] range using Sobol64 generator in \p state.
+ * State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Quasirandom value (64-bit) as an <tt>unsigned long long</tt>
+ */
+FQUALIFIERS
+unsigned long long rocrand(rocrand_state_sobol64 * state)
+{
+    return state->next();
+}
+
+/**
+ * \brief Updates SOBOL64 state to skip ahead by \p offset elements.
+ *
+ * Updates the SOBOL64 state in \p state to skip ahead by \p offset elements.
+ *
+ * \param offset - Number of elements to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead(unsigned long long offset, rocrand_state_sobol64 * state)
+{
+    return state->discard(offset);
+}
+
+/** @} */ // end of group rocranddevice
+
+#endif // ROCRAND_SOBOL64_H_
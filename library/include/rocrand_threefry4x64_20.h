@@ -0,0 +1,422 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+/*
+Copyright 2010-2011, D. E. Shaw Research.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions, and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions, and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+* Neither the name of D. E. Shaw Research nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef ROCRAND_THREEFRY4X64_20_H_
+#define ROCRAND_THREEFRY4X64_20_H_
+
+#ifndef FQUALIFIERS
+#define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS_
+
+#include "rocrand_common.h"
+#include "rocrand_threefry_common.h"
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+ /**
+ * \def ROCRAND_THREEFRY4x64_DEFAULT_SEED
+ * \brief Default seed for THREEFRY4x64 PRNG.
+ */
+#define ROCRAND_THREEFRY4x64_DEFAULT_SEED 0xdeadbeefdeadbeefULL
+/** @} */ // end of group rocranddevice
+
+namespace rocrand_device {
+
+class threefry4x64_20_engine
+{
+public:
+    struct threefry4x64_20_state
+    {
+        ulonglong4 counter;
+        ulonglong4 result;
+        ulonglong4 key;
+        // Position of the next 32-bit value in result (0..7): the low half
+        // of every 64-bit word goes first
+        unsigned int substate;
+
+        #ifndef ROCRAND_DETAIL_THREEFRY4X64_BM_NOT_IN_STATE
+        // The Box–Muller transform requires two inputs to convert uniformly
+        // distributed real values [0; 1] to normally distributed real values
+        // (with mean = 0, and stddev = 1). Often user wants only one
+        // normally distributed number, to save performance and random
+        // numbers the 2nd value is saved for future requests.
+        unsigned int boxmuller_float_state; // is there a float in boxmuller_float
+        unsigned int boxmuller_double_state; // is there a double in boxmuller_double
+        float boxmuller_float; // normally distributed float
+        double boxmuller_double; // normally distributed double
+        #endif
+
+        FQUALIFIERS
+        ~threefry4x64_20_state() { }
+    };
+
+    FQUALIFIERS
+    threefry4x64_20_engine()
+    {
+        this->seed(ROCRAND_THREEFRY4x64_DEFAULT_SEED, 0, 0);
+    }
+
+    /// Initializes the internal state of the PRNG using
+    /// seed value \p seed, goes to \p subsequence -th subsequence,
+    /// and skips \p offset random numbers.
+    ///
+    /// A subsequence is 8 * 2^128 numbers long.
+    FQUALIFIERS
+    threefry4x64_20_engine(const unsigned long long seed,
+                           const unsigned long long subsequence,
+                           const unsigned long long offset)
+    {
+        this->seed(seed, subsequence, offset);
+    }
+
+    FQUALIFIERS
+    ~threefry4x64_20_engine() { }
+
+    /// Reinitializes the internal state of the PRNG using new
+    /// seed value \p seed_value, skips \p subsequence subsequences
+    /// and \p offset random numbers.
+    ///
+    /// A subsequence is 8 * 2^128 numbers long.
+    FQUALIFIERS
+    void seed(unsigned long long seed_value,
+              const unsigned long long subsequence,
+              const unsigned long long offset)
+    {
+        m_state.key = {seed_value, 0, 0, 0};
+        this->restart(subsequence, offset);
+    }
+
+    /// Advances the internal state to skip \p offset numbers.
+    FQUALIFIERS
+    void discard(unsigned long long offset)
+    {
+        this->discard_impl(offset);
+        m_state.result = this->twenty_rounds(m_state.counter, m_state.key);
+    }
+
+    /// Advances the internal state to skip \p subsequence subsequences.
+    /// A subsequence is 8 * 2^128 numbers long.
+    FQUALIFIERS
+    void discard_subsequence(unsigned long long subsequence)
+    {
+        this->discard_subsequence_impl(subsequence);
+        m_state.result = this->twenty_rounds(m_state.counter, m_state.key);
+    }
+
+    FQUALIFIERS
+    void restart(const unsigned long long subsequence,
+                 const unsigned long long offset)
+    {
+        m_state.counter = {0, 0, 0, 0};
+        m_state.result  = {0, 0, 0, 0};
+        m_state.substate = 0;
+        #ifndef ROCRAND_DETAIL_THREEFRY4X64_BM_NOT_IN_STATE
+        m_state.boxmuller_float_state = 0;
+        m_state.boxmuller_double_state = 0;
+        #endif
+        this->discard_subsequence_impl(subsequence);
+        this->discard_impl(offset);
+        m_state.result = this->twenty_rounds(m_state.counter, m_state.key);
+    }
+
+    FQUALIFIERS
+    unsigned int operator()()
+    {
+        return this->next();
+    }
+
+    FQUALIFIERS
+    unsigned int next()
+    {
+        #if defined(__HIP_PLATFORM_HCC__)
+            const unsigned long long v = m_state.result.data[m_state.substate / 2];
+        #else
+            const unsigned long long v = (&m_state.result.x)[m_state.substate / 2];
+        #endif
+        unsigned int ret = static_cast<unsigned int>(
+            (m_state.substate & 1) == 0 ? v : v >> 32
+        );
+        m_state.substate++;
+        if(m_state.substate == 8)
+        {
+            m_state.substate = 0;
+            this->discard_state();
+            m_state.result = this->twenty_rounds(m_state.counter, m_state.key);
+        }
+        return ret;
+    }
+
+    FQUALIFIERS
+    uint4 next4()
+    {
+        // The order of evaluation of braced initializers is guaranteed
+        return uint4 { this->next(), this->next(), this->next(), this->next() };
+    }
+
+protected:
+    // Advances the internal state to skip \p offset numbers.
+    // DOES NOT CALCULATE NEW 8 UINTs (m_state.result)
+    FQUALIFIERS
+    void discard_impl(unsigned long long offset)
+    {
+        // Adjust offset for subset
+        m_state.substate += offset & 7;
+        offset += m_state.substate < 8 ? 0 : 8;
+        m_state.substate += m_state.substate < 8 ? 0 : -8;
+        // Discard states
+        this->discard_state(offset / 8);
+    }
+
+    // DOES NOT CALCULATE NEW 8 UINTs (m_state.result)
+    FQUALIFIERS
+    void discard_subsequence_impl(unsigned long long subsequence)
+    {
+        m_state.counter.z += subsequence;
+        m_state.counter.w += (m_state.counter.z < subsequence ? 1 : 0);
+    }
+
+    // Advances the internal state by offset times.
+    // DOES NOT CALCULATE NEW 8 UINTs (m_state.result)
+    FQUALIFIERS
+    void discard_state(unsigned long long offset)
+    {
+        ulonglong4 temp = m_state.counter;
+        m_state.counter.x += offset;
+        m_state.counter.y += (m_state.counter.x < temp.x ? 1 : 0);
+        m_state.counter.z += (m_state.counter.y < temp.y ? 1 : 0);
+        m_state.counter.w += (m_state.counter.z < temp.z ? 1 : 0);
+    }
+
+    // Advances the internal state to the next state
+    // DOES NOT CALCULATE NEW 8 UINTs (m_state.result)
+    FQUALIFIERS
+    void discard_state()
+    {
+        m_state.counter.x++;
+        unsigned long long add = m_state.counter.x == 0 ? 1 : 0;
+        m_state.counter.y += add; add = m_state.counter.y == 0 ? add : 0;
+        m_state.counter.z += add; add = m_state.counter.z == 0 ? add : 0;
+        m_state.counter.w += add;
+    }
+
+    // 20 Threefry4x64 rounds
+    FQUALIFIERS
+    ulonglong4 twenty_rounds(ulonglong4 counter, ulonglong4 key)
+    {
+        // Source: Random123
+        const unsigned long long ks[5] = {
+            key.x, key.y, key.z, key.w,
+            ROCRAND_THREEFRY_PARITY64 ^ key.x ^ key.y ^ key.z ^ key.w
+        };
+        counter.x += ks[0];
+        counter.y += ks[1];
+        counter.z += ks[2];
+        counter.w += ks[3];
+        this->four_rounds(counter, 14, 16, 52, 57, 23, 40,  5, 37); this->inject_key(counter, ks, 1); // 1-4
+        this->four_rounds(counter, 25, 33, 46, 12, 58, 22, 32, 32); this->inject_key(counter, ks, 2); // 5-8
+        this->four_rounds(counter, 14, 16, 52, 57, 23, 40,  5, 37); this->inject_key(counter, ks, 3); // 9-12
+        this->four_rounds(counter, 25, 33, 46, 12, 58, 22, 32, 32); this->inject_key(counter, ks, 4); // 13-16
+        this->four_rounds(counter, 14, 16, 52, 57, 23, 40,  5, 37); this->inject_key(counter, ks, 5); // 17-20
+        return counter;
+    }
+
+private:
+    // Even rounds mix (x, y) and (z, w), odd rounds mix (x, w) and (z, y)
+    FQUALIFIERS
+    void four_rounds(ulonglong4& v,
+                     const unsigned int r00, const unsigned int r01,
+                     const unsigned int r10, const unsigned int r11,
+                     const unsigned int r20, const unsigned int r21,
+                     const unsigned int r30, const unsigned int r31)
+    {
+        detail::threefry_mix64(v.x, v.y, r00); detail::threefry_mix64(v.z, v.w, r01);
+        detail::threefry_mix64(v.x, v.w, r10); detail::threefry_mix64(v.z, v.y, r11);
+        detail::threefry_mix64(v.x, v.y, r20); detail::threefry_mix64(v.z, v.w, r21);
+        detail::threefry_mix64(v.x, v.w, r30); detail::threefry_mix64(v.z, v.y, r31);
+    }
+
+    // i-th injection of the key schedule
+    FQUALIFIERS
+    void inject_key(ulonglong4& v, const unsigned long long (&ks)[5], const unsigned int i)
+    {
+        v.x += ks[i % 5];
+        v.y += ks[(i + 1) % 5];
+        v.z += ks[(i + 2) % 5];
+        v.w += ks[(i + 3) % 5] + i;
+    }
+
+protected:
+    // State
+    threefry4x64_20_state m_state;
+
+    #ifndef ROCRAND_DETAIL_THREEFRY4X64_BM_NOT_IN_STATE
+    friend struct detail::engine_boxmuller_helper<threefry4x64_20_engine>;
+    #endif
+
+}; // threefry4x64_20_engine class
+
+} // end namespace rocrand_device
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+/// \cond ROCRAND_KERNEL_DOCS_TYPEDEFS
+typedef rocrand_device::threefry4x64_20_engine rocrand_state_threefry4x64_20;
+/// \endcond
+
+/**
+ * \brief Initializes Threefry4x64 state.
+ *
+ * Initializes the Threefry4x64 generator \p state with the given
+ * \p seed, \p subsequence, and \p offset.
+ *
+ * \param seed - Value to use as a seed
+ * \param subsequence - Subsequence to start at
+ * \param offset - Absolute offset into subsequence
+ * \param state - Pointer to state to initialize
+ */
+FQUALIFIERS
+void rocrand_init(const unsigned long long seed,
+                  const unsigned long long subsequence,
+                  const unsigned long long offset,
+                  rocrand_state_threefry4x64_20 * state)
+{
+    *state = rocrand_state_threefry4x64_20(seed, subsequence, offset);
+}
+
+/**
+ * \brief Returns uniformly distributed random <tt>unsigned int</tt> value
+ * from [0; 2^32 - 1] range.
+ *
+ * Generates and returns uniformly distributed random <tt>unsigned int</tt>
+ * value from [0; 2^32 - 1] range using Threefry4x64 generator in \p state.
+ * State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Pseudorandom value (32-bit) as an <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand(rocrand_state_threefry4x64_20 * state)
+{
+    return state->next();
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>unsigned int</tt> values
+ * from [0; 2^32 - 1] range.
+ *
+ * Generates and returns four uniformly distributed random <tt>unsigned int</tt>
+ * values from [0; 2^32 - 1] range using Threefry4x64 generator in \p state.
+ * State is incremented by four positions.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four pseudorandom values (32-bit) as an <tt>uint4</tt>
+ */
+FQUALIFIERS
+uint4 rocrand4(rocrand_state_threefry4x64_20 * state)
+{
+    return state->next4();
+}
+
+/**
+ * \brief Updates Threefry4x64 state to skip ahead by \p offset elements.
+ *
+ * Updates the Threefry4x64 generator state in \p state to skip ahead by \p offset elements.
+ *
+ * \param offset - Number of elements to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead(unsigned long long offset, rocrand_state_threefry4x64_20 * state)
+{
+    return state->discard(offset);
+}
+
+/**
+ * \brief Updates Threefry4x64 state to skip ahead by \p subsequence subsequences.
+ *
+ * Updates the Threefry4x64 generator state in \p state to skip ahead by \p subsequence subsequences.
+ * Each subsequence is 8 * 2^128 numbers long.
+ *
+ * \param subsequence - Number of subsequences to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead_subsequence(unsigned long long subsequence, rocrand_state_threefry4x64_20 * state)
+{
+    return state->discard_subsequence(subsequence);
+}
+
+/**
+ * \brief Updates Threefry4x64 state to skip ahead by \p sequence sequences.
+ *
+ * Updates the Threefry4x64 generator state in \p state skipping \p sequence sequences ahead.
+ * For Threefry4x64 each sequence is 8 * 2^128 numbers long (equal to the size of a subsequence).
+ *
+ * \param sequence - Number of sequences to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead_sequence(unsigned long long sequence, rocrand_state_threefry4x64_20 * state)
+{
+    return state->discard_subsequence(sequence);
+}
+
+#endif // ROCRAND_THREEFRY4X64_20_H_
+
+/** @} */ // end of group rocranddevice
@@ -31,9 +31,18 @@
 #endif // FQUALIFIERS
 
 #include "rocrand_philox4x32_10.h"
+#include "rocrand_philox4x32_7.h"
+#include "rocrand_philox4x64_10.h"
+#include "rocrand_threefry2x64_20.h"
+#include "rocrand_threefry4x64_20.h"
 #include "rocrand_mrg32k3a.h"
 #include "rocrand_xorwow.h"
+#include "rocrand_xoshiro128pp.h"
+#include "rocrand_pcg32.h"
 #include "rocrand_sobol32.h"
+#include "rocrand_scrambled_sobol32.h"
+#include "rocrand_sobol64.h"
+#include "rocrand_scrambled_sobol64.h"
 #include "rocrand_mtgp32.h"
 
 namespace rocrand_device {
@@ -146,6 +155,18 @@ double mrg_uniform_distribution_double(unsigned int v)
     return ret;
 }
 
+// Returns four values of rocrand() generated by a local copy of the state,
+// so the state is loaded and stored once instead of for every value
+template<class State>
+FQUALIFIERS
+uint4 rocrand4_local(State * state)
+{
+    State s = *state;
+    const uint4 v = uint4 { ::rocrand(&s), ::rocrand(&s), ::rocrand(&s), ::rocrand(&s) };
+    *state = s;
+    return v;
+}
+
 } // end namespace detail
 } // end namespace rocrand_device
 
@@ -167,6 +188,24 @@ float rocrand_uniform(rocrand_state_philox4x32_10 * state)
     return rocrand_device::detail::uniform_distribution(rocrand(state));
 }
 
+/**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using Philox4x32-7 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS
+float rocrand_uniform(rocrand_state_philox4x32_7 * state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
 /**
  * \brief Returns two uniformly distributed random <tt>float</tt> values
  * from (0; 1] range.
@@ -188,6 +227,27 @@ float2 rocrand_uniform2(rocrand_state_philox4x32_10 * state)
     };
 }
 
+/**
+ * \brief Returns two uniformly distributed random <tt>float</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns two uniformly distributed \p float values from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using Philox4x32-7 generator in \p state, and
+ * increments position of the generator by two.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two uniformly distributed \p float values from (0; 1] range as \p float2.
+ */
+FQUALIFIERS
+float2 rocrand_uniform2(rocrand_state_philox4x32_7 * state)
+{
+    return float2 {
+        rocrand_device::detail::uniform_distribution(rocrand(state)),
+        rocrand_device::detail::uniform_distribution(rocrand(state))
+    };
+}
+
 /**
  * \brief Returns four uniformly distributed random <tt>float</tt> values
  * from (0; 1] range.
@@ -206,6 +266,24 @@ float4 rocrand_uniform4(rocrand_state_philox4x32_10 * state)
     return rocrand_device::detail::uniform_distribution4(rocrand4(state));
 }
 
+/**
+ * \brief Returns four uniformly distributed random <tt>float</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns four uniformly distributed \p float values from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using Philox4x32-7 generator in \p state, and
+ * increments position of the generator by four.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four uniformly distributed \p float values from (0; 1] range as \p float4.
+ */
+FQUALIFIERS
+float4 rocrand_uniform4(rocrand_state_philox4x32_7 * state)
+{
+    return rocrand_device::detail::uniform_distribution4(rocrand4(state));
+}
+
 /**
  * \brief Returns a uniformly distributed random <tt>double</tt> value
  * from (0; 1] range.
@@ -224,6 +302,24 @@ double rocrand_uniform_double(rocrand_state_philox4x32_10 * state)
     return rocrand_device::detail::uniform_distribution_double(rocrand(state), rocrand(state));
 }
 
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using Philox4x32-7 generator in \p state, and
+ * increments position of the generator by two.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS
+double rocrand_uniform_double(rocrand_state_philox4x32_7 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state), rocrand(state));
+}
+
 /**
  * \brief Returns two uniformly distributed random <tt>double</tt> values
  * from (0; 1] range.
@@ -242,6 +338,24 @@ double2 rocrand_uniform_double2(rocrand_state_philox4x32_10 * state)
     return rocrand_device::detail::uniform_distribution_double2(rocrand4(state));
 }
 
+/**
+ * \brief Returns two uniformly distributed random <tt>double</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns two uniformly distributed \p double values from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using Philox4x32-7 generator in \p state, and
+ * increments position of the generator by four.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two uniformly distributed \p double values from (0; 1] range as \p double2.
+ */
+FQUALIFIERS
+double2 rocrand_uniform_double2(rocrand_state_philox4x32_7 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double2(rocrand4(state));
+}
+
 /**
  * \brief Returns four uniformly distributed random <tt>double</tt> values
  * from (0; 1] range.
@@ -260,12 +374,30 @@ double4 rocrand_uniform_double4(rocrand_state_philox4x32_10 * state)
     return rocrand_device::detail::uniform_distribution_double4(rocrand4(state), rocrand4(state));
 }
 
- /**
+/**
+ * \brief Returns four uniformly distributed random <tt>double</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns four uniformly distributed \p double values from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using Philox4x32-7 generator in \p state, and
+ * increments position of the generator by eight.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four uniformly distributed \p double values from (0; 1] range as \p double4.
+ */
+FQUALIFIERS
+double4 rocrand_uniform_double4(rocrand_state_philox4x32_7 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double4(rocrand4(state), rocrand4(state));
+}
+
+/**
  * \brief Returns a uniformly distributed random <tt>float</tt> value
  * from (0; 1] range.
  *
  * Generates and returns a uniformly distributed \p float value from (0; 1] range
- * (excluding \p 0.0f, including \p 1.0f) using MRG32K3A generator in \p state, and
+ * (excluding \p 0.0f, including \p 1.0f) using Philox4x64 generator in \p state, and
  * increments position of the generator by one.
  *
  * \param state - Pointer to a state to use
@@ -273,56 +405,56 @@ double4 rocrand_uniform_double4(rocrand_state_philox4x32_10 * state)
  * \return Uniformly distributed \p float value from (0; 1] range.
  */
 FQUALIFIERS
-float rocrand_uniform(rocrand_state_mrg32k3a * state)
+float rocrand_uniform(rocrand_state_philox4x64_10 * state)
 {
-    return rocrand_device::detail::mrg_uniform_distribution(rocrand(state));
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
 }
 
- /**
- * \brief Returns a uniformly distributed random <tt>double</tt> value
+/**
+ * \brief Returns two uniformly distributed random <tt>float</tt> values
  * from (0; 1] range.
  *
- * Generates and returns a uniformly distributed \p double value from (0; 1] range
- * (excluding \p 0.0, including \p 1.0) using MRG32K3A generator in \p state, and
- * increments position of the generator by one.
+ * Generates and returns two uniformly distributed \p float values from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using Philox4x64 generator in \p state, and
+ * increments position of the generator by two.
  *
  * \param state - Pointer to a state to use
  *
- * Note: In this implementation returned \p double value is generated
- * from only 32 random bits (one <tt>unsigned int</tt> value).
- *
- * \return Uniformly distributed \p double value from (0; 1] range.
+ * \return Two uniformly distributed \p float values from (0; 1] range as \p float2.
  */
 FQUALIFIERS
-double rocrand_uniform_double(rocrand_state_mrg32k3a * state)
+float2 rocrand_uniform2(rocrand_state_philox4x64_10 * state)
 {
-    return rocrand_device::detail::mrg_uniform_distribution_double(rocrand(state));
+    return float2 {
+        rocrand_device::detail::uniform_distribution(rocrand(state)),
+        rocrand_device::detail::uniform_distribution(rocrand(state))
+    };
 }
 
- /**
- * \brief Returns a uniformly distributed random <tt>float</tt> value
+/**
+ * \brief Returns four uniformly distributed random <tt>float</tt> values
  * from (0; 1] range.
  *
- * Generates and returns a uniformly distributed \p float value from (0; 1] range
- * (excluding \p 0.0f, including \p 1.0f) using XORWOW generator in \p state, and
- * increments position of the generator by one.
+ * Generates and returns four uniformly distributed \p float values from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using Philox4x64 generator in \p state, and
+ * increments position of the generator by four.
  *
  * \param state - Pointer to a state to use
  *
- * \return Uniformly distributed \p float value from (0; 1] range.
+ * \return Four uniformly distributed \p float values from (0; 1] range as \p float4.
  */
 FQUALIFIERS
-float rocrand_uniform(rocrand_state_xorwow * state)
+float4 rocrand_uniform4(rocrand_state_philox4x64_10 * state)
 {
-    return rocrand_device::detail::uniform_distribution(rocrand(state));
+    return rocrand_device::detail::uniform_distribution4(rocrand4(state));
 }
 
- /**
+/**
  * \brief Returns a uniformly distributed random <tt>double</tt> value
  * from (0; 1] range.
  *
  * Generates and returns a uniformly distributed \p double value from (0; 1] range
- * (excluding \p 0.0, including \p 1.0) using MRG32K3A generator in \p state, and
+ * (excluding \p 0.0, including \p 1.0) using Philox4x64 generator in \p state, and
  * increments position of the generator by two.
  *
  * \param state - Pointer to a state to use
@@ -330,56 +462,53 @@ float rocrand_uniform(rocrand_state_xorwow * state)
  * \return Uniformly distributed \p double value from (0; 1] range.
  */
 FQUALIFIERS
-double rocrand_uniform_double(rocrand_state_xorwow * state)
+double rocrand_uniform_double(rocrand_state_philox4x64_10 * state)
 {
     return rocrand_device::detail::uniform_distribution_double(rocrand(state), rocrand(state));
 }
 
- /**
- * \brief Returns a uniformly distributed random <tt>float</tt> value
+/**
+ * \brief Returns two uniformly distributed random <tt>double</tt> values
  * from (0; 1] range.
  *
- * Generates and returns a uniformly distributed \p float value from (0; 1] range
- * (excluding \p 0.0f, including \p 1.0f) using MTGP32 generator in \p state, and
- * increments position of the generator by one.
+ * Generates and returns two uniformly distributed \p double values from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using Philox4x64 generator in \p state, and
+ * increments position of the generator by four.
  *
  * \param state - Pointer to a state to use
  *
- * \return Uniformly distributed \p float value from (0; 1] range.
+ * \return Two uniformly distributed \p double values from (0; 1] range as \p double2.
  */
 FQUALIFIERS
-float rocrand_uniform(rocrand_state_mtgp32 * state)
+double2 rocrand_uniform_double2(rocrand_state_philox4x64_10 * state)
 {
-    return rocrand_device::detail::uniform_distribution(rocrand(state));
+    return rocrand_device::detail::uniform_distribution_double2(rocrand4(state));
 }
 
 /**
- * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * \brief Returns four uniformly distributed random <tt>double</tt> values
  * from (0; 1] range.
  *
- * Generates and returns a uniformly distributed \p double value from (0; 1] range
- * (excluding \p 0.0, including \p 1.0) using MTGP32 generator in \p state, and
- * increments position of the generator by one.
+ * Generates and returns four uniformly distributed \p double values from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using Philox4x64 generator in \p state, and
+ * increments position of the generator by eight.
  *
  * \param state - Pointer to a state to use
  *
- * Note: In this implementation returned \p double value is generated
- * from only 32 random bits (one <tt>unsigned int</tt> value).
- *
- * \return Uniformly distributed \p double value from (0; 1] range.
+ * \return Four uniformly distributed \p double values from (0; 1] range as \p double4.
  */
 FQUALIFIERS
-double rocrand_uniform_double(rocrand_state_mtgp32 * state)
+double4 rocrand_uniform_double4(rocrand_state_philox4x64_10 * state)
 {
-    return rocrand_device::detail::uniform_distribution_double(rocrand(state));
+    return rocrand_device::detail::uniform_distribution_double4(rocrand4(state), rocrand4(state));
 }
 
- /**
+/**
  * \brief Returns a uniformly distributed random <tt>float</tt> value
  * from (0; 1] range.
  *
  * Generates and returns a uniformly distributed \p float value from (0; 1] range
- * (excluding \p 0.0f, including \p 1.0f) using SOBOL32 generator in \p state, and
+ * (excluding \p 0.0f, including \p 1.0f) using Threefry2x64 generator in \p state, and
  * increments position of the generator by one.
  *
  * \param state - Pointer to a state to use
@@ -387,28 +516,686 @@ double rocrand_uniform_double(rocrand_state_mtgp32 * state)
  * \return Uniformly distributed \p float value from (0; 1] range.
  */
 FQUALIFIERS
-float rocrand_uniform(rocrand_state_sobol32 * state)
+float rocrand_uniform(rocrand_state_threefry2x64_20 * state)
 {
     return rocrand_device::detail::uniform_distribution(rocrand(state));
 }
 
+/**
+ * \brief Returns two uniformly distributed random <tt>float</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns two uniformly distributed \p float values from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using Threefry2x64 generator in \p state, and
+ * increments position of the generator by two.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two uniformly distributed \p float values from (0; 1] range as \p float2.
+ */
+FQUALIFIERS
+float2 rocrand_uniform2(rocrand_state_threefry2x64_20 * state)
+{
+    return float2 {
+        rocrand_device::detail::uniform_distribution(rocrand(state)),
+        rocrand_device::detail::uniform_distribution(rocrand(state))
+    };
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>float</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns four uniformly distributed \p float values from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using Threefry2x64 generator in \p state, and
+ * increments position of the generator by four.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four uniformly distributed \p float values from (0; 1] range as \p float4.
+ */
+FQUALIFIERS
+float4 rocrand_uniform4(rocrand_state_threefry2x64_20 * state)
+{
+    return rocrand_device::detail::uniform_distribution4(rocrand4(state));
+}
+
 /**
  * \brief Returns a uniformly distributed random <tt>double</tt> value
  * from (0; 1] range.
  *
  * Generates and returns a uniformly distributed \p double value from (0; 1] range
- * (excluding \p 0.0, including \p 1.0) using SOBOL32 generator in \p state, and
- * increments position of the generator by one.
+ * (excluding \p 0.0, including \p 1.0) using Threefry2x64 generator in \p state, and
+ * increments position of the generator by two.
  *
  * \param state - Pointer to a state to use
  *
- * Note: In this implementation returned \p double value is generated
- * from only 32 random bits (one <tt>unsigned int</tt> value).
- *
  * \return Uniformly distributed \p double value from (0; 1] range.
  */
 FQUALIFIERS
-double rocrand_uniform_double(rocrand_state_sobol32 * state)
+double rocrand_uniform_double(rocrand_state_threefry2x64_20 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state), rocrand(state));
+}
+
+/**
+ * \brief Returns two uniformly distributed random <tt>double</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns two uniformly distributed \p double values from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using Threefry2x64 generator in \p state, and
+ * increments position of the generator by four.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two uniformly distributed \p double values from (0; 1] range as \p double2.
+ */
+FQUALIFIERS
+double2 rocrand_uniform_double2(rocrand_state_threefry2x64_20 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double2(rocrand4(state));
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>double</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns four uniformly distributed \p double values from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using Threefry2x64 generator in \p state, and
+ * increments position of the generator by eight.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four uniformly distributed \p double values from (0; 1] range as \p double4.
+ */
+FQUALIFIERS
+double4 rocrand_uniform_double4(rocrand_state_threefry2x64_20 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double4(rocrand4(state), rocrand4(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using Threefry4x64 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS
+float rocrand_uniform(rocrand_state_threefry4x64_20 * state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns two uniformly distributed random <tt>float</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns two uniformly distributed \p float values from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using Threefry4x64 generator in \p state, and
+ * increments position of the generator by two.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two uniformly distributed \p float values from (0; 1] range as \p float2.
+ */
+FQUALIFIERS
+float2 rocrand_uniform2(rocrand_state_threefry4x64_20 * state)
+{
+    return float2 {
+        rocrand_device::detail::uniform_distribution(rocrand(state)),
+        rocrand_device::detail::uniform_distribution(rocrand(state))
+    };
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>float</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns four uniformly distributed \p float values from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using Threefry4x64 generator in \p state, and
+ * increments position of the generator by four.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four uniformly distributed \p float values from (0; 1] range as \p float4.
+ */
+FQUALIFIERS
+float4 rocrand_uniform4(rocrand_state_threefry4x64_20 * state)
+{
+    return rocrand_device::detail::uniform_distribution4(rocrand4(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using Threefry4x64 generator in \p state, and
+ * increments position of the generator by two.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS
+double rocrand_uniform_double(rocrand_state_threefry4x64_20 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state), rocrand(state));
+}
+
+/**
+ * \brief Returns two uniformly distributed random <tt>double</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns two uniformly distributed \p double values from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using Threefry4x64 generator in \p state, and
+ * increments position of the generator by four.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two uniformly distributed \p double values from (0; 1] range as \p double2.
+ */
+FQUALIFIERS
+double2 rocrand_uniform_double2(rocrand_state_threefry4x64_20 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double2(rocrand4(state));
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>double</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns four uniformly distributed \p double values from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using Threefry4x64 generator in \p state, and
+ * increments position of the generator by eight.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four uniformly distributed \p double values from (0; 1] range as \p double4.
+ */
+FQUALIFIERS
+double4 rocrand_uniform_double4(rocrand_state_threefry4x64_20 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double4(rocrand4(state), rocrand4(state));
+}
+
+ /**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using MRG32K3A generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS
+float rocrand_uniform(rocrand_state_mrg32k3a * state)
+{
+    return rocrand_device::detail::mrg_uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>float</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns four uniformly distributed \p float values from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using MRG32K3A generator in \p state, and
+ * increments position of the generator by four.
+ * The values are the same as returned by four calls of rocrand_uniform().
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four uniformly distributed \p float values from (0; 1] range as \p float4.
+ */
+FQUALIFIERS
+float4 rocrand_uniform4(rocrand_state_mrg32k3a * state)
+{
+    const uint4 v = rocrand_device::detail::rocrand4_local(state);
+    return float4 {
+        rocrand_device::detail::mrg_uniform_distribution(v.x),
+        rocrand_device::detail::mrg_uniform_distribution(v.y),
+        rocrand_device::detail::mrg_uniform_distribution(v.z),
+        rocrand_device::detail::mrg_uniform_distribution(v.w)
+    };
+}
+
+ /**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using MRG32K3A generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * Note: In this implementation returned \p double value is generated
+ * from only 32 random bits (one <tt>unsigned int</tt> value).
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS
+double rocrand_uniform_double(rocrand_state_mrg32k3a * state)
+{
+    return rocrand_device::detail::mrg_uniform_distribution_double(rocrand(state));
+}
+
+ /**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using XORWOW generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS
+float rocrand_uniform(rocrand_state_xorwow * state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>float</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns four uniformly distributed \p float values from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using XORWOW generator in \p state, and
+ * increments position of the generator by four.
+ * The values are the same as returned by four calls of rocrand_uniform().
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four uniformly distributed \p float values from (0; 1] range as \p float4.
+ */
+FQUALIFIERS
+float4 rocrand_uniform4(rocrand_state_xorwow * state)
+{
+    return rocrand_device::detail::uniform_distribution4(rocrand_device::detail::rocrand4_local(state));
+}
+
+ /**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using MRG32K3A generator in \p state, and
+ * increments position of the generator by two.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS
+double rocrand_uniform_double(rocrand_state_xorwow * state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state), rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using compact XORWOW generator in \p state,
+ * and increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS
+float rocrand_uniform(rocrand_state_xorwow_compact * state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using compact XORWOW generator in \p state,
+ * and increments position of the generator by two.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS
+double rocrand_uniform_double(rocrand_state_xorwow_compact * state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state), rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using xoshiro128++ generator in \p state,
+ * and increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS
+float rocrand_uniform(rocrand_state_xoshiro128pp * state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using xoshiro128++ generator in \p state,
+ * and increments position of the generator by two.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS
+double rocrand_uniform_double(rocrand_state_xoshiro128pp * state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state), rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using PCG32 generator in \p state,
+ * and increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS
+float rocrand_uniform(rocrand_state_pcg32 * state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using PCG32 generator in \p state,
+ * and increments position of the generator by two.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS
+double rocrand_uniform_double(rocrand_state_pcg32 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state), rocrand(state));
+}
+
+ /**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using MTGP32 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS
+float rocrand_uniform(rocrand_state_mtgp32 * state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>float</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns four uniformly distributed \p float values from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using MTGP32 generator in \p state, and
+ * increments position of the generator by four.
+ * The values are the same as returned by four calls of rocrand_uniform(), the
+ * function must be called by all threads of the block.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four uniformly distributed \p float values from (0; 1] range as \p float4.
+ */
+FQUALIFIERS
+float4 rocrand_uniform4(rocrand_state_mtgp32 * state)
+{
+    return rocrand_device::detail::uniform_distribution4(state->next4());
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using MTGP32 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * Note: In this implementation returned \p double value is generated
+ * from only 32 random bits (one <tt>unsigned int</tt> value).
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS
+double rocrand_uniform_double(rocrand_state_mtgp32 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state));
+}
+
+ /**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using SOBOL32 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS
+float rocrand_uniform(rocrand_state_sobol32 * state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using SOBOL32 generator in block state \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS
+float rocrand_uniform(rocrand_state_sobol32_block * state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using SOBOL32 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * Note: In this implementation returned \p double value is generated
+ * from only 32 random bits (one <tt>unsigned int</tt> value).
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS
+double rocrand_uniform_double(rocrand_state_sobol32 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using SOBOL32 generator in block state \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * Note: In this implementation returned \p double value is generated
+ * from only 32 random bits (one <tt>unsigned int</tt> value).
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS
+double rocrand_uniform_double(rocrand_state_sobol32_block * state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using SCRAMBLED_SOBOL32 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS
+float rocrand_uniform(rocrand_state_scrambled_sobol32 * state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using SCRAMBLED_SOBOL32 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * Note: In this implementation returned \p double value is generated
+ * from only 32 random bits (one <tt>unsigned int</tt> value).
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS
+double rocrand_uniform_double(rocrand_state_scrambled_sobol32 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using SOBOL64 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS
+float rocrand_uniform(rocrand_state_sobol64 * state)
+{
+    return rocrand_device::detail::uniform_distribution(static_cast<unsigned int>(rocrand(state) >> 32));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using SOBOL64 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS
+double rocrand_uniform_double(rocrand_state_sobol64 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using SCRAMBLED_SOBOL64 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS
+float rocrand_uniform(rocrand_state_scrambled_sobol64 * state)
+{
+    return rocrand_device::detail::uniform_distribution(static_cast<unsigned int>(rocrand(state) >> 32));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using SCRAMBLED_SOBOL64 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS
+double rocrand_uniform_double(rocrand_state_scrambled_sobol64 * state)
 {
     return rocrand_device::detail::uniform_distribution_double(rocrand(state));
 }
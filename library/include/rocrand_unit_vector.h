@@ -0,0 +1,870 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_UNIT_VECTOR_H_
+#define ROCRAND_UNIT_VECTOR_H_
+
+#ifndef FQUALIFIERS
+#define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+#include <math.h>
+
+#include "rocrand_philox4x32_10.h"
+#include "rocrand_philox4x32_7.h"
+#include "rocrand_philox4x64_10.h"
+#include "rocrand_threefry2x64_20.h"
+#include "rocrand_threefry4x64_20.h"
+#include "rocrand_mrg32k3a.h"
+#include "rocrand_xorwow.h"
+#include "rocrand_xoshiro128pp.h"
+#include "rocrand_pcg32.h"
+
+#include "rocrand_normal.h"
+
+// Uniformly distributed directions (points on the unit sphere S^(dim-1)).
+// Vectors of 2, 3 and 4 values are generated without trigonometric functions
+// by rejection from pairs of values uniform in the square [-1, 1]^2 (the
+// acceptance rate is pi/4): von Neumann's method for the circle, Marsaglia's
+// methods for S^2 and S^3 (G. Marsaglia, Choosing a Point from the Surface of
+// a Sphere, 1972). Other sizes normalize vectors of normal values.
+
+namespace rocrand_device {
+namespace detail {
+
+// Maps a 32-bit value to (-1, 1) symmetrically
+FQUALIFIERS
+float unit_vector_uniform(unsigned int v)
+{
+    return static_cast<int>(v) * (2.0f * ROCRAND_2POW32_INV) + ROCRAND_2POW32_INV;
+}
+
+// Returns a pair uniformly distributed in the unit disk without its center,
+// s = u^2 + v^2
+template<class State>
+FQUALIFIERS
+float2 unit_disk_point(State& state, float& s)
+{
+    while(true)
+    {
+        const float u = unit_vector_uniform(rocrand(state));
+        const float v = unit_vector_uniform(rocrand(state));
+        s = u * u + v * v;
+        if(s < 1.0f && s > 0.0f)
+        {
+            return float2 { u, v };
+        }
+    }
+}
+
+template<class State>
+FQUALIFIERS
+float unit_vector1(State& state)
+{
+    return (rocrand(state) & 1) == 0 ? 1.0f : -1.0f;
+}
+
+template<class State>
+FQUALIFIERS
+float2 unit_vector2(State& state)
+{
+    // (u + iv)^2 / |u + iv|^2 has a uniformly distributed angle
+    float s;
+    const float2 p = unit_disk_point(state, s);
+    const float r = 1.0f / s;
+    return float2 { (p.x * p.x - p.y * p.y) * r, 2.0f * p.x * p.y * r };
+}
+
+template<class State>
+FQUALIFIERS
+float3 unit_vector3(State& state)
+{
+    float s;
+    const float2 p = unit_disk_point(state, s);
+    const float r = 2.0f * sqrtf(1.0f - s);
+    return float3 { p.x * r, p.y * r, 1.0f - 2.0f * s };
+}
+
+template<class State>
+FQUALIFIERS
+float4 unit_vector4(State& state)
+{
+    float s1;
+    float s2;
+    const float2 p1 = unit_disk_point(state, s1);
+    const float2 p2 = unit_disk_point(state, s2);
+    const float r = sqrtf((1.0f - s1) / s2);
+    return float4 { p1.x, p1.y, p2.x * r, p2.y * r };
+}
+
+// Normalizes dim normal values (generated by groups of 4 with
+// normal_distribution4) and stores them to vector[i * stride]
+template<bool FastMath = ROCRAND_DETAIL_FAST_MATH, class State>
+FQUALIFIERS
+void unit_vector(State& state, float * vector, unsigned int dim, size_t stride)
+{
+    if(dim == 0)
+    {
+        return;
+    }
+    float sum = 0.0f;
+    while(!(sum > 0.0f))
+    {
+        sum = 0.0f;
+        for(unsigned int i = 0; i < dim; i += 4)
+        {
+            const uint4 v = uint4 { rocrand(state), rocrand(state), rocrand(state), rocrand(state) };
+            const float4 n = normal_distribution4<FastMath>(v);
+            const float values[4] = { n.x, n.y, n.z, n.w };
+            for(unsigned int j = 0; j < 4 && i + j < dim; j++)
+            {
+                vector[(i + j) * stride] = values[j];
+                sum += values[j] * values[j];
+            }
+        }
+    }
+    const float r = 1.0f / sqrtf(sum);
+    for(unsigned int i = 0; i < dim; i++)
+    {
+        vector[i * stride] *= r;
+    }
+}
+
+} // end namespace detail
+} // end namespace rocrand_device
+
+/**
+ * \brief Returns a uniformly distributed 2D unit vector using Philox generator.
+ *
+ * Generates and returns a point uniformly distributed on the unit circle
+ * using Philox generator in \p state, no trigonometric functions are
+ * computed. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Unit vector as a <tt>float2</tt>
+ */
+FQUALIFIERS
+float2 rocrand_unit_vector2(rocrand_state_philox4x32_10 * state)
+{
+    return rocrand_device::detail::unit_vector2(state);
+}
+
+/**
+ * \brief Returns a uniformly distributed 3D unit vector using Philox generator.
+ *
+ * Generates and returns a point uniformly distributed on the unit sphere S^2
+ * (an isotropic direction) using Philox generator in \p state with
+ * Marsaglia's method. State is incremented by a variable amount
+ * (2.55 values on average).
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Unit vector as a <tt>float3</tt>
+ */
+FQUALIFIERS
+float3 rocrand_unit_vector3(rocrand_state_philox4x32_10 * state)
+{
+    return rocrand_device::detail::unit_vector3(state);
+}
+
+/**
+ * \brief Returns a uniformly distributed 4D unit vector using Philox generator.
+ *
+ * Generates and returns a point uniformly distributed on the unit sphere S^3
+ * using Philox generator in \p state with Marsaglia's method. State is
+ * incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Unit vector as a <tt>float4</tt>
+ */
+FQUALIFIERS
+float4 rocrand_unit_vector4(rocrand_state_philox4x32_10 * state)
+{
+    return rocrand_device::detail::unit_vector4(state);
+}
+
+/**
+ * \brief Generates a uniformly distributed unit vector of any size using Philox generator.
+ *
+ * Generates a point uniformly distributed on the unit sphere S^(\p dim - 1)
+ * and saves its \p dim values to \p vector using Philox generator in \p state.
+ * The vector is a vector of normally distributed values (generated by groups of
+ * 4 as in rocrand_normal4()) divided by its length. State is incremented by
+ * a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param vector - Pointer to memory to store \p dim values
+ * \param dim - Number of values of the vector (at least 1)
+ */
+FQUALIFIERS
+void rocrand_unit_vector(rocrand_state_philox4x32_10 * state, float * vector, unsigned int dim)
+{
+    rocrand_device::detail::unit_vector(state, vector, dim, 1);
+}
+
+/**
+ * \brief Returns a uniformly distributed 2D unit vector using Philox4x32-7 generator.
+ *
+ * Generates and returns a point uniformly distributed on the unit circle
+ * using Philox4x32-7 generator in \p state, no trigonometric functions are
+ * computed. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Unit vector as a <tt>float2</tt>
+ */
+FQUALIFIERS
+float2 rocrand_unit_vector2(rocrand_state_philox4x32_7 * state)
+{
+    return rocrand_device::detail::unit_vector2(state);
+}
+
+/**
+ * \brief Returns a uniformly distributed 3D unit vector using Philox4x32-7 generator.
+ *
+ * Generates and returns a point uniformly distributed on the unit sphere S^2
+ * (an isotropic direction) using Philox4x32-7 generator in \p state with
+ * Marsaglia's method. State is incremented by a variable amount
+ * (2.55 values on average).
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Unit vector as a <tt>float3</tt>
+ */
+FQUALIFIERS
+float3 rocrand_unit_vector3(rocrand_state_philox4x32_7 * state)
+{
+    return rocrand_device::detail::unit_vector3(state);
+}
+
+/**
+ * \brief Returns a uniformly distributed 4D unit vector using Philox4x32-7 generator.
+ *
+ * Generates and returns a point uniformly distributed on the unit sphere S^3
+ * using Philox4x32-7 generator in \p state with Marsaglia's method. State is
+ * incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Unit vector as a <tt>float4</tt>
+ */
+FQUALIFIERS
+float4 rocrand_unit_vector4(rocrand_state_philox4x32_7 * state)
+{
+    return rocrand_device::detail::unit_vector4(state);
+}
+
+/**
+ * \brief Generates a uniformly distributed unit vector of any size using Philox4x32-7 generator.
+ *
+ * Generates a point uniformly distributed on the unit sphere S^(\p dim - 1)
+ * and saves its \p dim values to \p vector using Philox4x32-7 generator in \p state.
+ * The vector is a vector of normally distributed values (generated by groups of
+ * 4 as in rocrand_normal4()) divided by its length. State is incremented by
+ * a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param vector - Pointer to memory to store \p dim values
+ * \param dim - Number of values of the vector (at least 1)
+ */
+FQUALIFIERS
+void rocrand_unit_vector(rocrand_state_philox4x32_7 * state, float * vector, unsigned int dim)
+{
+    rocrand_device::detail::unit_vector(state, vector, dim, 1);
+}
+
+/**
+ * \brief Returns a uniformly distributed 2D unit vector using Philox4x64 generator.
+ *
+ * Generates and returns a point uniformly distributed on the unit circle
+ * using Philox4x64 generator in \p state, no trigonometric functions are
+ * computed. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Unit vector as a <tt>float2</tt>
+ */
+FQUALIFIERS
+float2 rocrand_unit_vector2(rocrand_state_philox4x64_10 * state)
+{
+    return rocrand_device::detail::unit_vector2(state);
+}
+
+/**
+ * \brief Returns a uniformly distributed 3D unit vector using Philox4x64 generator.
+ *
+ * Generates and returns a point uniformly distributed on the unit sphere S^2
+ * (an isotropic direction) using Philox4x64 generator in \p state with
+ * Marsaglia's method. State is incremented by a variable amount
+ * (2.55 values on average).
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Unit vector as a <tt>float3</tt>
+ */
+FQUALIFIERS
+float3 rocrand_unit_vector3(rocrand_state_philox4x64_10 * state)
+{
+    return rocrand_device::detail::unit_vector3(state);
+}
+
+/**
+ * \brief Returns a uniformly distributed 4D unit vector using Philox4x64 generator.
+ *
+ * Generates and returns a point uniformly distributed on the unit sphere S^3
+ * using Philox4x64 generator in \p state with Marsaglia's method. State is
+ * incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Unit vector as a <tt>float4</tt>
+ */
+FQUALIFIERS
+float4 rocrand_unit_vector4(rocrand_state_philox4x64_10 * state)
+{
+    return rocrand_device::detail::unit_vector4(state);
+}
+
+/**
+ * \brief Generates a uniformly distributed unit vector of any size using Philox4x64 generator.
+ *
+ * Generates a point uniformly distributed on the unit sphere S^(\p dim - 1)
+ * and saves its \p dim values to \p vector using Philox4x64 generator in \p state.
+ * The vector is a vector of normally distributed values (generated by groups of
+ * 4 as in rocrand_normal4()) divided by its length. State is incremented by
+ * a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param vector - Pointer to memory to store \p dim values
+ * \param dim - Number of values of the vector (at least 1)
+ */
+FQUALIFIERS
+void rocrand_unit_vector(rocrand_state_philox4x64_10 * state, float * vector, unsigned int dim)
+{
+    rocrand_device::detail::unit_vector(state, vector, dim, 1);
+}
+
+/**
+ * \brief Returns a uniformly distributed 2D unit vector using Threefry2x64 generator.
+ *
+ * Generates and returns a point uniformly distributed on the unit circle
+ * using Threefry2x64 generator in \p state, no trigonometric functions are
+ * computed. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Unit vector as a <tt>float2</tt>
+ */
+FQUALIFIERS
+float2 rocrand_unit_vector2(rocrand_state_threefry2x64_20 * state)
+{
+    return rocrand_device::detail::unit_vector2(state);
+}
+
+/**
+ * \brief Returns a uniformly distributed 3D unit vector using Threefry2x64 generator.
+ *
+ * Generates and returns a point uniformly distributed on the unit sphere S^2
+ * (an isotropic direction) using Threefry2x64 generator in \p state with
+ * Marsaglia's method. State is incremented by a variable amount
+ * (2.55 values on average).
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Unit vector as a <tt>float3</tt>
+ */
+FQUALIFIERS
+float3 rocrand_unit_vector3(rocrand_state_threefry2x64_20 * state)
+{
+    return rocrand_device::detail::unit_vector3(state);
+}
+
+/**
+ * \brief Returns a uniformly distributed 4D unit vector using Threefry2x64 generator.
+ *
+ * Generates and returns a point uniformly distributed on the unit sphere S^3
+ * using Threefry2x64 generator in \p state with Marsaglia's method. State is
+ * incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Unit vector as a <tt>float4</tt>
+ */
+FQUALIFIERS
+float4 rocrand_unit_vector4(rocrand_state_threefry2x64_20 * state)
+{
+    return rocrand_device::detail::unit_vector4(state);
+}
+
+/**
+ * \brief Generates a uniformly distributed unit vector of any size using Threefry2x64 generator.
+ *
+ * Generates a point uniformly distributed on the unit sphere S^(\p dim - 1)
+ * and saves its \p dim values to \p vector using Threefry2x64 generator in \p state.
+ * The vector is a vector of normally distributed values (generated by groups of
+ * 4 as in rocrand_normal4()) divided by its length. State is incremented by
+ * a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param vector - Pointer to memory to store \p dim values
+ * \param dim - Number of values of the vector (at least 1)
+ */
+FQUALIFIERS
+void rocrand_unit_vector(rocrand_state_threefry2x64_20 * state, float * vector, unsigned int dim)
+{
+    rocrand_device::detail::unit_vector(state, vector, dim, 1);
+}
+
+/**
+ * \brief Returns a uniformly distributed 2D unit vector using Threefry4x64 generator.
+ *
+ * Generates and returns a point uniformly distributed on the unit circle
+ * using Threefry4x64 generator in \p state, no trigonometric functions are
+ * computed. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Unit vector as a <tt>float2</tt>
+ */
+FQUALIFIERS
+float2 rocrand_unit_vector2(rocrand_state_threefry4x64_20 * state)
+{
+    return rocrand_device::detail::unit_vector2(state);
+}
+
+/**
+ * \brief Returns a uniformly distributed 3D unit vector using Threefry4x64 generator.
+ *
+ * Generates and returns a point uniformly distributed on the unit sphere S^2
+ * (an isotropic direction) using Threefry4x64 generator in \p state with
+ * Marsaglia's method. State is incremented by a variable amount
+ * (2.55 values on average).
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Unit vector as a <tt>float3</tt>
+ */
+FQUALIFIERS
+float3 rocrand_unit_vector3(rocrand_state_threefry4x64_20 * state)
+{
+    return rocrand_device::detail::unit_vector3(state);
+}
+
+/**
+ * \brief Returns a uniformly distributed 4D unit vector using Threefry4x64 generator.
+ *
+ * Generates and returns a point uniformly distributed on the unit sphere S^3
+ * using Threefry4x64 generator in \p state with Marsaglia's method. State is
+ * incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Unit vector as a <tt>float4</tt>
+ */
+FQUALIFIERS
+float4 rocrand_unit_vector4(rocrand_state_threefry4x64_20 * state)
+{
+    return rocrand_device::detail::unit_vector4(state);
+}
+
+/**
+ * \brief Generates a uniformly distributed unit vector of any size using Threefry4x64 generator.
+ *
+ * Generates a point uniformly distributed on the unit sphere S^(\p dim - 1)
+ * and saves its \p dim values to \p vector using Threefry4x64 generator in \p state.
+ * The vector is a vector of normally distributed values (generated by groups of
+ * 4 as in rocrand_normal4()) divided by its length. State is incremented by
+ * a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param vector - Pointer to memory to store \p dim values
+ * \param dim - Number of values of the vector (at least 1)
+ */
+FQUALIFIERS
+void rocrand_unit_vector(rocrand_state_threefry4x64_20 * state, float * vector, unsigned int dim)
+{
+    rocrand_device::detail::unit_vector(state, vector, dim, 1);
+}
+
+/**
+ * \brief Returns a uniformly distributed 2D unit vector using MRG32K3A generator.
+ *
+ * Generates and returns a point uniformly distributed on the unit circle
+ * using MRG32K3A generator in \p state, no trigonometric functions are
+ * computed. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Unit vector as a <tt>float2</tt>
+ */
+FQUALIFIERS
+float2 rocrand_unit_vector2(rocrand_state_mrg32k3a * state)
+{
+    return rocrand_device::detail::unit_vector2(state);
+}
+
+/**
+ * \brief Returns a uniformly distributed 3D unit vector using MRG32K3A generator.
+ *
+ * Generates and returns a point uniformly distributed on the unit sphere S^2
+ * (an isotropic direction) using MRG32K3A generator in \p state with
+ * Marsaglia's method. State is incremented by a variable amount
+ * (2.55 values on average).
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Unit vector as a <tt>float3</tt>
+ */
+FQUALIFIERS
+float3 rocrand_unit_vector3(rocrand_state_mrg32k3a * state)
+{
+    return rocrand_device::detail::unit_vector3(state);
+}
+
+/**
+ * \brief Returns a uniformly distributed 4D unit vector using MRG32K3A generator.
+ *
+ * Generates and returns a point uniformly distributed on the unit sphere S^3
+ * using MRG32K3A generator in \p state with Marsaglia's method. State is
+ * incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Unit vector as a <tt>float4</tt>
+ */
+FQUALIFIERS
+float4 rocrand_unit_vector4(rocrand_state_mrg32k3a * state)
+{
+    return rocrand_device::detail::unit_vector4(state);
+}
+
+/**
+ * \brief Generates a uniformly distributed unit vector of any size using MRG32K3A generator.
+ *
+ * Generates a point uniformly distributed on the unit sphere S^(\p dim - 1)
+ * and saves its \p dim values to \p vector using MRG32K3A generator in \p state.
+ * The vector is a vector of normally distributed values (generated by groups of
+ * 4 as in rocrand_normal4()) divided by its length. State is incremented by
+ * a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param vector - Pointer to memory to store \p dim values
+ * \param dim - Number of values of the vector (at least 1)
+ */
+FQUALIFIERS
+void rocrand_unit_vector(rocrand_state_mrg32k3a * state, float * vector, unsigned int dim)
+{
+    rocrand_device::detail::unit_vector(state, vector, dim, 1);
+}
+
+/**
+ * \brief Returns a uniformly distributed 2D unit vector using XORWOW generator.
+ *
+ * Generates and returns a point uniformly distributed on the unit circle
+ * using XORWOW generator in \p state, no trigonometric functions are
+ * computed. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Unit vector as a <tt>float2</tt>
+ */
+FQUALIFIERS
+float2 rocrand_unit_vector2(rocrand_state_xorwow * state)
+{
+    return rocrand_device::detail::unit_vector2(state);
+}
+
+/**
+ * \brief Returns a uniformly distributed 3D unit vector using XORWOW generator.
+ *
+ * Generates and returns a point uniformly distributed on the unit sphere S^2
+ * (an isotropic direction) using XORWOW generator in \p state with
+ * Marsaglia's method. State is incremented by a variable amount
+ * (2.55 values on average).
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Unit vector as a <tt>float3</tt>
+ */
+FQUALIFIERS
+float3 rocrand_unit_vector3(rocrand_state_xorwow * state)
+{
+    return rocrand_device::detail::unit_vector3(state);
+}
+
+/**
+ * \brief Returns a uniformly distributed 4D unit vector using XORWOW generator.
+ *
+ * Generates and returns a point uniformly distributed on the unit sphere S^3
+ * using XORWOW generator in \p state with Marsaglia's method. State is
+ * incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Unit vector as a <tt>float4</tt>
+ */
+FQUALIFIERS
+float4 rocrand_unit_vector4(rocrand_state_xorwow * state)
+{
+    return rocrand_device::detail::unit_vector4(state);
+}
+
+/**
+ * \brief Generates a uniformly distributed unit vector of any size using XORWOW generator.
+ *
+ * Generates a point uniformly distributed on the unit sphere S^(\p dim - 1)
+ * and saves its \p dim values to \p vector using XORWOW generator in \p state.
+ * The vector is a vector of normally distributed values (generated by groups of
+ * 4 as in rocrand_normal4()) divided by its length. State is incremented by
+ * a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param vector - Pointer to memory to store \p dim values
+ * \param dim - Number of values of the vector (at least 1)
+ */
+FQUALIFIERS
+void rocrand_unit_vector(rocrand_state_xorwow * state, float * vector, unsigned int dim)
+{
+    rocrand_device::detail::unit_vector(state, vector, dim, 1);
+}
+
+/**
+ * \brief Returns a uniformly distributed 2D unit vector using compact XORWOW generator.
+ *
+ * Generates and returns a point uniformly distributed on the unit circle
+ * using compact XORWOW generator in \p state, no trigonometric functions are
+ * computed. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Unit vector as a <tt>float2</tt>
+ */
+FQUALIFIERS
+float2 rocrand_unit_vector2(rocrand_state_xorwow_compact * state)
+{
+    return rocrand_device::detail::unit_vector2(state);
+}
+
+/**
+ * \brief Returns a uniformly distributed 3D unit vector using compact XORWOW generator.
+ *
+ * Generates and returns a point uniformly distributed on the unit sphere S^2
+ * (an isotropic direction) using compact XORWOW generator in \p state with
+ * Marsaglia's method. State is incremented by a variable amount
+ * (2.55 values on average).
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Unit vector as a <tt>float3</tt>
+ */
+FQUALIFIERS
+float3 rocrand_unit_vector3(rocrand_state_xorwow_compact * state)
+{
+    return rocrand_device::detail::unit_vector3(state);
+}
+
+/**
+ * \brief Returns a uniformly distributed 4D unit vector using compact XORWOW generator.
+ *
+ * Generates and returns a point uniformly distributed on the unit sphere S^3
+ * using compact XORWOW generator in \p state with Marsaglia's method. State is
+ * incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Unit vector as a <tt>float4</tt>
+ */
+FQUALIFIERS
+float4 rocrand_unit_vector4(rocrand_state_xorwow_compact * state)
+{
+    return rocrand_device::detail::unit_vector4(state);
+}
+
+/**
+ * \brief Generates a uniformly distributed unit vector of any size using compact XORWOW generator.
+ *
+ * Generates a point uniformly distributed on the unit sphere S^(\p dim - 1)
+ * and saves its \p dim values to \p vector using compact XORWOW generator in \p state.
+ * The vector is a vector of normally distributed values (generated by groups of
+ * 4 as in rocrand_normal4()) divided by its length. State is incremented by
+ * a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param vector - Pointer to memory to store \p dim values
+ * \param dim - Number of values of the vector (at least 1)
+ */
+FQUALIFIERS
+void rocrand_unit_vector(rocrand_state_xorwow_compact * state, float * vector, unsigned int dim)
+{
+    rocrand_device::detail::unit_vector(state, vector, dim, 1);
+}
+
+/**
+ * \brief Returns a uniformly distributed 2D unit vector using xoshiro128++ generator.
+ *
+ * Generates and returns a point uniformly distributed on the unit circle
+ * using xoshiro128++ generator in \p state, no trigonometric functions are
+ * computed. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Unit vector as a <tt>float2</tt>
+ */
+FQUALIFIERS
+float2 rocrand_unit_vector2(rocrand_state_xoshiro128pp * state)
+{
+    return rocrand_device::detail::unit_vector2(state);
+}
+
+/**
+ * \brief Returns a uniformly distributed 3D unit vector using xoshiro128++ generator.
+ *
+ * Generates and returns a point uniformly distributed on the unit sphere S^2
+ * (an isotropic direction) using xoshiro128++ generator in \p state with
+ * Marsaglia's method. State is incremented by a variable amount
+ * (2.55 values on average).
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Unit vector as a <tt>float3</tt>
+ */
+FQUALIFIERS
+float3 rocrand_unit_vector3(rocrand_state_xoshiro128pp * state)
+{
+    return rocrand_device::detail::unit_vector3(state);
+}
+
+/**
+ * \brief Returns a uniformly distributed 4D unit vector using xoshiro128++ generator.
+ *
+ * Generates and returns a point uniformly distributed on the unit sphere S^3
+ * using xoshiro128++ generator in \p state with Marsaglia's method. State is
+ * incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Unit vector as a <tt>float4</tt>
+ */
+FQUALIFIERS
+float4 rocrand_unit_vector4(rocrand_state_xoshiro128pp * state)
+{
+    return rocrand_device::detail::unit_vector4(state);
+}
+
+/**
+ * \brief Generates a uniformly distributed unit vector of any size using xoshiro128++ generator.
+ *
+ * Generates a point uniformly distributed on the unit sphere S^(\p dim - 1)
+ * and saves its \p dim values to \p vector using xoshiro128++ generator in \p state.
+ * The vector is a vector of normally distributed values (generated by groups of
+ * 4 as in rocrand_normal4()) divided by its length. State is incremented by
+ * a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param vector - Pointer to memory to store \p dim values
+ * \param dim - Number of values of the vector (at least 1)
+ */
+FQUALIFIERS
+void rocrand_unit_vector(rocrand_state_xoshiro128pp * state, float * vector, unsigned int dim)
+{
+    rocrand_device::detail::unit_vector(state, vector, dim, 1);
+}
+
+/**
+ * \brief Returns a uniformly distributed 2D unit vector using PCG32 generator.
+ *
+ * Generates and returns a point uniformly distributed on the unit circle
+ * using PCG32 generator in \p state, no trigonometric functions are
+ * computed. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Unit vector as a <tt>float2</tt>
+ */
+FQUALIFIERS
+float2 rocrand_unit_vector2(rocrand_state_pcg32 * state)
+{
+    return rocrand_device::detail::unit_vector2(state);
+}
+
+/**
+ * \brief Returns a uniformly distributed 3D unit vector using PCG32 generator.
+ *
+ * Generates and returns a point uniformly distributed on the unit sphere S^2
+ * (an isotropic direction) using PCG32 generator in \p state with
+ * Marsaglia's method. State is incremented by a variable amount
+ * (2.55 values on average).
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Unit vector as a <tt>float3</tt>
+ */
+FQUALIFIERS
+float3 rocrand_unit_vector3(rocrand_state_pcg32 * state)
+{
+    return rocrand_device::detail::unit_vector3(state);
+}
+
+/**
+ * \brief Returns a uniformly distributed 4D unit vector using PCG32 generator.
+ *
+ * Generates and returns a point uniformly distributed on the unit sphere S^3
+ * using PCG32 generator in \p state with Marsaglia's method. State is
+ * incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Unit vector as a <tt>float4</tt>
+ */
+FQUALIFIERS
+float4 rocrand_unit_vector4(rocrand_state_pcg32 * state)
+{
+    return rocrand_device::detail::unit_vector4(state);
+}
+
+/**
+ * \brief Generates a uniformly distributed unit vector of any size using PCG32 generator.
+ *
+ * Generates a point uniformly distributed on the unit sphere S^(\p dim - 1)
+ * and saves its \p dim values to \p vector using PCG32 generator in \p state.
+ * The vector is a vector of normally distributed values (generated by groups of
+ * 4 as in rocrand_normal4()) divided by its length. State is incremented by
+ * a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param vector - Pointer to memory to store \p dim values
+ * \param dim - Number of values of the vector (at least 1)
+ */
+FQUALIFIERS
+void rocrand_unit_vector(rocrand_state_pcg32 * state, float * vector, unsigned int dim)
+{
+    rocrand_device::detail::unit_vector(state, vector, dim, 1);
+}
+
+#endif // ROCRAND_UNIT_VECTOR_H_
+
+/** @} */ // end of group rocranddevice
@@ -28,6 +28,11 @@
 #include "rocrand_common.h"
 #include "rocrand_xorwow_precomputed.h"
 
+// Headers generated without digit tables have one matrix per digit position
+#ifndef XORWOW_JUMP_DIGITS
+#define XORWOW_JUMP_DIGITS 1
+#endif
+
 // G. Marsaglia, Xorshift RNGs, 2003
 // http://www.jstatsoft.org/v08/i14/paper
 
@@ -71,80 +76,45 @@ void mul_mat_vec_inplace(const unsigned int * m, unsigned int * v)
     copy_vec(v, r);
 }
 
-} // end detail namespace
-
-class xorwow_engine
+struct xorwow_state
 {
-public:
-    struct xorwow_state
-    {
-        // Xorshift values (160 bits)
-        unsigned int x[5];
-
-        // Weyl sequence value
-        unsigned int d;
-
-        #ifndef ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
-        // The Box–Muller transform requires two inputs to convert uniformly
-        // distributed real values [0; 1] to normally distributed real values
-        // (with mean = 0, and stddev = 1). Often user wants only one
-        // normally distributed number, to save performance and random
-        // numbers the 2nd value is saved for future requests.
-        unsigned int boxmuller_float_state; // is there a float in boxmuller_float
-        unsigned int boxmuller_double_state; // is there a double in boxmuller_double
-        float boxmuller_float; // normally distributed float
-        double boxmuller_double; // normally distributed double
-        #endif
+    // Xorshift values (160 bits)
+    unsigned int x[5];
 
-        FQUALIFIERS
-        ~xorwow_state() { }
-    };
+    // Weyl sequence value
+    unsigned int d;
 
-    FQUALIFIERS
-    xorwow_engine() : xorwow_engine(ROCRAND_XORWOW_DEFAULT_SEED, 0, 0) { }
+    #ifndef ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+    // The Box–Muller transform requires two inputs to convert uniformly
+    // distributed real values [0; 1] to normally distributed real values
+    // (with mean = 0, and stddev = 1). Often user wants only one
+    // normally distributed number, to save performance and random
+    // numbers the 2nd value is saved for future requests.
+    unsigned int boxmuller_float_state; // is there a float in boxmuller_float
+    unsigned int boxmuller_double_state; // is there a double in boxmuller_double
+    float boxmuller_float; // normally distributed float
+    double boxmuller_double; // normally distributed double
+    #endif
 
-    /// Initializes the internal state of the PRNG using
-    /// seed value \p seed, goes to \p subsequence -th subsequence,
-    /// and skips \p offset random numbers.
-    ///
-    /// A subsequence is 2^67 numbers long.
     FQUALIFIERS
-    xorwow_engine(const unsigned long long seed,
-                  const unsigned long long subsequence,
-                  const unsigned long long offset)
-    {
-        m_state.x[0] = 123456789U;
-        m_state.x[1] = 362436069U;
-        m_state.x[2] = 521288629U;
-        m_state.x[3] = 88675123U;
-        m_state.x[4] = 5783321U;
+    ~xorwow_state() { }
+};
 
-        m_state.d = 6615241U;
-
-        // Constants are arbitrary prime numbers
-        const unsigned int s0 = static_cast<unsigned int>(seed) ^ 0x2c7f967fU;
-        const unsigned int s1 = static_cast<unsigned int>(seed >> 32) ^ 0xa03697cbU;
-        const unsigned int t0 = 1228688033U * s0;
-        const unsigned int t1 = 2073658381U * s1;
-        m_state.x[0] += t0;
-        m_state.x[1] ^= t0;
-        m_state.x[2] += t1;
-        m_state.x[3] ^= t1;
-        m_state.x[4] += t0;
-        m_state.d += t1 + t0;
-
-        discard_subsequence(subsequence);
-        discard(offset);
-
-        #ifndef ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
-        m_state.boxmuller_float_state = 0;
-        m_state.boxmuller_double_state = 0;
-        #endif
-    }
+// State without the Box-Muller cache (see xorwow_compact_engine)
+struct xorwow_compact_state
+{
+    // Xorshift values (160 bits)
+    unsigned int x[5];
 
-    FQUALIFIERS
-    ~xorwow_engine() { }
+    // Weyl sequence value
+    unsigned int d;
+};
 
+// XORWOW algorithm for both state layouts, State has x and d members
+template<class State>
+class xorwow_engine_base
+{
+public:
     /// Advances the internal state to skip \p offset numbers.
     FQUALIFIERS
     void discard(unsigned long long offset)
@@ -174,6 +144,25 @@ public:
         // d has the same value because 2^67 is divisible by 2^32 (d is 32-bit)
     }
 
+    /// Cooperative version of discard(): all threads of the block must call it
+    /// (with any offsets), \p shared is XORWOW_SIZE unsigned ints of shared memory.
+    /// Jump matrices are read from global memory once per block instead of
+    /// once per thread.
+    __forceinline__ __device__
+    void discard_block(unsigned long long offset, unsigned int * shared)
+    {
+        jump_block(offset, d_xorwow_jump_matrices, shared);
+
+        m_state.d += static_cast<unsigned int>(offset) * 362437;
+    }
+
+    /// Cooperative version of discard_subsequence() (see discard_block()).
+    __forceinline__ __device__
+    void discard_subsequence_block(unsigned long long subsequence, unsigned int * shared)
+    {
+        jump_block(subsequence, d_xorwow_sequence_jump_matrices, shared);
+    }
+
     FQUALIFIERS
     unsigned int operator()()
     {
@@ -196,10 +185,39 @@ public:
     }
 
 protected:
+    /// Initializes \p x and \p d of the state (see xorwow_engine())
+    FQUALIFIERS
+    void seed_state(const unsigned long long seed,
+                    const unsigned long long subsequence,
+                    const unsigned long long offset)
+    {
+        m_state.x[0] = 123456789U;
+        m_state.x[1] = 362436069U;
+        m_state.x[2] = 521288629U;
+        m_state.x[3] = 88675123U;
+        m_state.x[4] = 5783321U;
+
+        m_state.d = 6615241U;
+
+        // Constants are arbitrary prime numbers
+        const unsigned int s0 = static_cast<unsigned int>(seed) ^ 0x2c7f967fU;
+        const unsigned int s1 = static_cast<unsigned int>(seed >> 32) ^ 0xa03697cbU;
+        const unsigned int t0 = 1228688033U * s0;
+        const unsigned int t1 = 2073658381U * s1;
+        m_state.x[0] += t0;
+        m_state.x[1] ^= t0;
+        m_state.x[2] += t1;
+        m_state.x[3] ^= t1;
+        m_state.x[4] += t0;
+        m_state.d += t1 + t0;
+
+        discard_subsequence(subsequence);
+        discard(offset);
+    }
 
     FQUALIFIERS
     void jump(unsigned long long v,
-              const unsigned int jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SIZE])
+              const unsigned int jump_matrices[XORWOW_JUMP_MATRICES * XORWOW_JUMP_DIGITS][XORWOW_SIZE])
     {
         // x~(n + v) = (A^v mod m)x~n mod m
         // The matrix (A^v mod m) can be precomputed for selected values of v.
@@ -213,14 +231,76 @@ protected:
         //   A^(1 * 2^67), A^(4 * 2^67), A^(16 * 2^67)...
         //
         // Intermediate powers can be calculated as multiplication of the powers above.
+        //
+        // Tables generated with digit tables (XORWOW_JUMP_DIGITS = 2^XORWOW_JUMP_LOG2 - 1)
+        // contain A^(d * 2^(k * XORWOW_JUMP_LOG2)) for all digits d, so every digit
+        // needs at most one multiplication.
 
         unsigned int mi = 0;
         while (v > 0)
         {
             const unsigned int is = static_cast<unsigned int>(v) & ((1 << XORWOW_JUMP_LOG2) - 1);
-            for (unsigned int i = 0; i < is; i++)
+            if (XORWOW_JUMP_DIGITS > 1)
+            {
+                if (is > 0)
+                {
+                    detail::mul_mat_vec_inplace(jump_matrices[mi * XORWOW_JUMP_DIGITS + is - 1], m_state.x);
+                }
+            }
+            else
             {
-                detail::mul_mat_vec_inplace(jump_matrices[mi], m_state.x);
+                for (unsigned int i = 0; i < is; i++)
+                {
+                    detail::mul_mat_vec_inplace(jump_matrices[mi], m_state.x);
+                }
+            }
+            mi++;
+            v >>= XORWOW_JUMP_LOG2;
+        }
+    }
+
+    // jump() with matrices staged in shared memory. Threads continue while any
+    // thread of the block has digits left and stage only matrices that are
+    // needed by some thread.
+    __forceinline__ __device__
+    void jump_block(unsigned long long v,
+                    const unsigned int jump_matrices[XORWOW_JUMP_MATRICES * XORWOW_JUMP_DIGITS][XORWOW_SIZE],
+                    unsigned int * shared)
+    {
+        const unsigned int tid = hipThreadIdx_x
+            + hipBlockDim_x * (hipThreadIdx_y + hipBlockDim_y * hipThreadIdx_z);
+        const unsigned int threads = hipBlockDim_x * hipBlockDim_y * hipBlockDim_z;
+
+        unsigned int mi = 0;
+        // __syncthreads_or is also a barrier between the previous
+        // multiplications and the next staging of shared
+        while (__syncthreads_or(v > 0))
+        {
+            const unsigned int is = static_cast<unsigned int>(v) & ((1 << XORWOW_JUMP_LOG2) - 1);
+            const unsigned int digits = XORWOW_JUMP_DIGITS > 1 ? XORWOW_JUMP_DIGITS : 1;
+            for (unsigned int d = 1; d <= digits; d++)
+            {
+                const bool needed = XORWOW_JUMP_DIGITS > 1 ? is == d : is > 0;
+                if (!__syncthreads_or(needed))
+                    continue;
+                const unsigned int * m = jump_matrices[mi * XORWOW_JUMP_DIGITS + d - 1];
+                for (unsigned int i = tid; i < XORWOW_SIZE; i += threads)
+                {
+                    shared[i] = m[i];
+                }
+                __syncthreads();
+                if (XORWOW_JUMP_DIGITS > 1)
+                {
+                    if (needed)
+                        detail::mul_mat_vec_inplace(shared, m_state.x);
+                }
+                else
+                {
+                    for (unsigned int i = 0; i < is; i++)
+                    {
+                        detail::mul_mat_vec_inplace(shared, m_state.x);
+                    }
+                }
             }
             mi++;
             v >>= XORWOW_JUMP_LOG2;
@@ -229,14 +309,71 @@ protected:
 
 protected:
     // State
-    xorwow_state m_state;
+    State m_state;
+}; // xorwow_engine_base class
+
+} // end detail namespace
+
+class xorwow_engine : public detail::xorwow_engine_base<detail::xorwow_state>
+{
+public:
+    typedef detail::xorwow_state xorwow_state;
+
+    FQUALIFIERS
+    xorwow_engine() : xorwow_engine(ROCRAND_XORWOW_DEFAULT_SEED, 0, 0) { }
 
+    /// Initializes the internal state of the PRNG using
+    /// seed value \p seed, goes to \p subsequence -th subsequence,
+    /// and skips \p offset random numbers.
+    ///
+    /// A subsequence is 2^67 numbers long.
+    FQUALIFIERS
+    xorwow_engine(const unsigned long long seed,
+                  const unsigned long long subsequence,
+                  const unsigned long long offset)
+    {
+        this->seed_state(seed, subsequence, offset);
+
+        #ifndef ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+        m_state.boxmuller_float_state = 0;
+        m_state.boxmuller_double_state = 0;
+        #endif
+    }
+
+    FQUALIFIERS
+    ~xorwow_engine() { }
+
+protected:
     #ifndef ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
     friend struct detail::engine_boxmuller_helper<xorwow_engine>;
     #endif
 
 }; // xorwow_engine class
 
+/// XORWOW engine without the Box-Muller cache: the state is 24 bytes instead of
+/// 48, normally distributed values are generated in pairs.
+/// It produces the same sequence as xorwow_engine.
+class xorwow_compact_engine : public detail::xorwow_engine_base<detail::xorwow_compact_state>
+{
+public:
+    typedef detail::xorwow_compact_state xorwow_state;
+
+    FQUALIFIERS
+    xorwow_compact_engine() : xorwow_compact_engine(ROCRAND_XORWOW_DEFAULT_SEED, 0, 0) { }
+
+    /// \copydoc xorwow_engine::xorwow_engine(const unsigned long long, const unsigned long long, const unsigned long long)
+    FQUALIFIERS
+    xorwow_compact_engine(const unsigned long long seed,
+                          const unsigned long long subsequence,
+                          const unsigned long long offset)
+    {
+        this->seed_state(seed, subsequence, offset);
+    }
+
+    FQUALIFIERS
+    ~xorwow_compact_engine() { }
+}; // xorwow_compact_engine class
+
 } // end namespace rocrand_device
 
 /** \rocrand_internal \addtogroup rocranddevice
@@ -248,6 +385,10 @@ protected:
 typedef rocrand_device::xorwow_engine rocrand_state_xorwow;
 /// \endcond
 
+/// \cond ROCRAND_KERNEL_DOCS_TYPEDEFS
+typedef rocrand_device::xorwow_compact_engine rocrand_state_xorwow_compact;
+/// \endcond
+
 /**
  * \brief Initialize XORWOW state.
  *
@@ -268,6 +409,34 @@ void rocrand_init(const unsigned long long seed,
     *state = rocrand_state_xorwow(seed, subsequence, offset);
 }
 
+/**
+ * \brief Initialize XORWOW state cooperatively by all threads of the block.
+ *
+ * Initializes \p state to the same value as rocrand_init(). All threads of
+ * the block must call the function, every thread with its own \p subsequence
+ * and \p offset. Jump matrices are staged in \p shared once per block, so
+ * initialization of many states reads much less global memory.
+ *
+ * \param seed - Value to use as a seed
+ * \param subsequence - Subsequence to start at
+ * \param offset - Absolute offset into subsequence
+ * \param state - Pointer to state to initialize
+ * \param shared - Pointer to <tt>XORWOW_SIZE</tt> <tt>unsigned int</tt> values
+ * of shared memory
+ */
+__forceinline__ __device__
+void rocrand_init_block(const unsigned long long seed,
+                        const unsigned long long subsequence,
+                        const unsigned long long offset,
+                        rocrand_state_xorwow * state,
+                        unsigned int * shared)
+{
+    rocrand_state_xorwow s(seed, 0, 0);
+    s.discard_subsequence_block(subsequence, shared);
+    s.discard_block(offset, shared);
+    *state = s;
+}
+
 /**
  * \brief Returns uniformly distributed random <tt>unsigned int</tt> value
  * from [0; 2^32 - 1] range.
@@ -330,6 +499,86 @@ void skipahead_subsequence(unsigned long long subsequence, rocrand_state_xorwow
      return state->discard_subsequence(sequence);
  }
 
+/**
+ * \brief Initialize compact XORWOW state.
+ *
+ * Initializes the compact XORWOW generator \p state with the given
+ * \p seed, \p subsequence, and \p offset. The compact state does not cache
+ * normally distributed values, so it is half the size of rocrand_state_xorwow
+ * and produces the same sequence of <tt>unsigned int</tt> values.
+ *
+ * \param seed - Value to use as a seed
+ * \param subsequence - Subsequence to start at
+ * \param offset - Absolute offset into subsequence
+ * \param state - Pointer to state to initialize
+ */
+FQUALIFIERS
+void rocrand_init(const unsigned long long seed,
+                  const unsigned long long subsequence,
+                  const unsigned long long offset,
+                  rocrand_state_xorwow_compact * state)
+{
+    *state = rocrand_state_xorwow_compact(seed, subsequence, offset);
+}
+
+/**
+ * \brief Returns uniformly distributed random <tt>unsigned int</tt> value
+ * from [0; 2^32 - 1] range.
+ *
+ * Generates and returns uniformly distributed random <tt>unsigned int</tt>
+ * value from [0; 2^32 - 1] range using compact XORWOW generator in \p state.
+ * State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Pseudorandom value (32-bit) as an <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand(rocrand_state_xorwow_compact * state)
+{
+    return state->next();
+}
+
+/**
+ * \brief Updates compact XORWOW state to skip ahead by \p offset elements.
+ *
+ * \param offset - Number of elements to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead(unsigned long long offset, rocrand_state_xorwow_compact * state)
+{
+    return state->discard(offset);
+}
+
+/**
+ * \brief Updates compact XORWOW state to skip ahead by \p subsequence subsequences.
+ *
+ * Each subsequence is 2^67 numbers long.
+ *
+ * \param subsequence - Number of subsequences to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead_subsequence(unsigned long long subsequence, rocrand_state_xorwow_compact * state)
+{
+    return state->discard_subsequence(subsequence);
+}
+
+/**
+ * \brief Updates compact XORWOW state to skip ahead by \p sequence sequences.
+ *
+ * Each sequence is 2^67 numbers long (equal to the size of a subsequence).
+ *
+ * \param sequence - Number of sequences to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead_sequence(unsigned long long sequence, rocrand_state_xorwow_compact * state)
+{
+    return state->discard_subsequence(sequence);
+}
+
 #endif // ROCRAND_XORWOW_H_
 
 /** @} */ // end of group rocranddevice
@@ -29,8 +29,11 @@
 #define XORWOW_SIZE (XORWOW_M * XORWOW_N * XORWOW_N)
 #define XORWOW_JUMP_MATRICES 32
 #define XORWOW_JUMP_LOG2 2
+#define XORWOW_JUMP_DIGITS 1
 
-static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SIZE] = {
+ROCRAND_DEVICE_TABLE const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES * XORWOW_JUMP_DIGITS][XORWOW_SIZE]
+#if defined(ROCRAND_DEVICE_TABLE_DEFINITIONS)
+= {
     {
         0, 0, 0, 0, 3, 0, 0, 0, 0, 6, 0, 0, 0, 0, 15, 0, 0, 0, 0, 30, 0, 0, 0, 0, 60, 
         0, 0, 0, 0, 120, 0, 0, 0, 0, 240, 0, 0, 0, 0, 480, 0, 0, 0, 0, 960, 0, 0, 0, 0, 1920, 
@@ -1119,9 +1122,11 @@ static const __device__ unsigned int d_xorwow_jump_matrices[XORWOW_JUMP_MATRICES
         4100978724, 2709958834, 574590507, 961767386, 21100886, 753746372, 4072632446, 733729367, 3060214669, 289165105, 426065754, 2036100240, 2172365757, 502856627, 84490194, 2630806596, 1206161269, 1009438449, 569581317, 1836947000, 3125379675, 1756936428, 3772694822, 3670337911, 3020603818, 
         2376224883, 2539951453, 2053395002, 3525193914, 1991480838, 3786481083, 873873707, 1693894743, 2450223985, 754878026, 1943356492, 401524329, 759931885, 611231307, 147950334, 599693701, 3358729722, 3649058074, 906423787, 1333804225, 875187278, 1115838692, 2476325972, 3307226674, 3539078918, 
     },
-};
+}
+#endif
+;
 
-static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SIZE] = {
+static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES * XORWOW_JUMP_DIGITS][XORWOW_SIZE] = {
     {
         0, 0, 0, 0, 3, 0, 0, 0, 0, 6, 0, 0, 0, 0, 15, 0, 0, 0, 0, 30, 0, 0, 0, 0, 60, 
         0, 0, 0, 0, 120, 0, 0, 0, 0, 240, 0, 0, 0, 0, 480, 0, 0, 0, 0, 960, 0, 0, 0, 0, 1920, 
@@ -2212,7 +2217,9 @@ static const unsigned int h_xorwow_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SI
     },
 };
 
-static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SIZE] = {
+ROCRAND_DEVICE_TABLE const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES * XORWOW_JUMP_DIGITS][XORWOW_SIZE]
+#if defined(ROCRAND_DEVICE_TABLE_DEFINITIONS)
+= {
     {
         850664906, 2293210629, 1517805917, 1215500405, 1612415445, 645388200, 824349799, 3517232886, 4075591755, 3089899292, 4249786064, 3811424903, 1100783479, 53649761, 2817264826, 3159462529, 1654848550, 950025444, 3095510002, 4080567211, 4111078399, 3241719305, 2788212779, 4256963770, 2426893717, 
         4190211142, 1420776905, 3780537969, 1102912875, 1657948873, 3354905256, 2519610308, 515777663, 3396785394, 1832603711, 1154211550, 1915690212, 1933919046, 789578337, 337961173, 1359089498, 2249086205, 3417955173, 862571348, 528120760, 1265685672, 1970052076, 3585976752, 3645339918, 312171257, 
@@ -3301,9 +3308,11 @@ static const __device__ unsigned int d_xorwow_sequence_jump_matrices[XORWOW_JUMP
         522606644, 1925230852, 3887440328, 2111843275, 3549473366, 922916775, 2889744544, 2970467682, 3039277863, 990580154, 55435595, 1665634070, 3043418336, 2792050230, 2762503138, 1402344059, 2099263558, 3945248675, 3925566467, 2413979948, 463637252, 3768636616, 3374572388, 2217956879, 791988933, 
         382210765, 1715859444, 3462446413, 971427992, 3255404695, 2001750035, 2214129237, 320812374, 3688098101, 920365480, 2819401059, 2932570681, 3749857130, 523943786, 1271514748, 4078439472, 3501181265, 2475869985, 1797996951, 2300820710, 3994893924, 1739992082, 2475950326, 3780826558, 1018851411, 
     },
-};
+}
+#endif
+;
 
-static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SIZE] = {
+static const unsigned int h_xorwow_sequence_jump_matrices[XORWOW_JUMP_MATRICES * XORWOW_JUMP_DIGITS][XORWOW_SIZE] = {
     {
         850664906, 2293210629, 1517805917, 1215500405, 1612415445, 645388200, 824349799, 3517232886, 4075591755, 3089899292, 4249786064, 3811424903, 1100783479, 53649761, 2817264826, 3159462529, 1654848550, 950025444, 3095510002, 4080567211, 4111078399, 3241719305, 2788212779, 4256963770, 2426893717, 
         4190211142, 1420776905, 3780537969, 1102912875, 1657948873, 3354905256, 2519610308, 515777663, 3396785394, 1832603711, 1154211550, 1915690212, 1933919046, 789578337, 337961173, 1359089498, 2249086205, 3417955173, 862571348, 528120760, 1265685672, 1970052076, 3585976752, 3645339918, 312171257, 
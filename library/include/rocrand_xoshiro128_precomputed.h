@@ -0,0 +1,298 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_XOSHIRO128_PRECOMPUTED_H_
+#define ROCRAND_XOSHIRO128_PRECOMPUTED_H_
+
+// Auto-generated file. Do not edit!
+// Generated by tools/xoshiro128_precomputed_generator
+
+#define XOSHIRO128_N 4
+#define XOSHIRO128_DEGREE 128
+#define XOSHIRO128_JUMP_POLYNOMIALS 128
+
+ROCRAND_DEVICE_TABLE const __device__ unsigned int d_xoshiro128_jump_polynomials[XOSHIRO128_JUMP_POLYNOMIALS][XOSHIRO128_N]
+#if defined(ROCRAND_DEVICE_TABLE_DEFINITIONS)
+= {
+    { 0x00000002U, 0x00000000U, 0x00000000U, 0x00000000U, }, // 2^0
+    { 0x00000004U, 0x00000000U, 0x00000000U, 0x00000000U, }, // 2^1
+    { 0x00000010U, 0x00000000U, 0x00000000U, 0x00000000U, }, // 2^2
+    { 0x00000100U, 0x00000000U, 0x00000000U, 0x00000000U, }, // 2^3
+    { 0x00010000U, 0x00000000U, 0x00000000U, 0x00000000U, }, // 2^4
+    { 0x00000000U, 0x00000001U, 0x00000000U, 0x00000000U, }, // 2^5
+    { 0x00000000U, 0x00000000U, 0x00000001U, 0x00000000U, }, // 2^6
+    { 0xde18fc01U, 0x1b489db6U, 0x006254b1U, 0x00fc65a2U, }, // 2^7
+    { 0x78bd1157U, 0xb488a061U, 0x77900a22U, 0x0e6834fbU, }, // 2^8
+    { 0x7b0bf49aU, 0x4152f743U, 0x44118d9bU, 0x38d2b436U, }, // 2^9
+    { 0x845a09b1U, 0x94b54ba1U, 0x503a9ae6U, 0x5f7aa4ffU, }, // 2^10
+    { 0x0a1f06b6U, 0xece7bc8eU, 0x9ab5cf0eU, 0x780f1aedU, }, // 2^11
+    { 0x8fcff8d3U, 0xd66b4f59U, 0x07ee277aU, 0xeb3e4975U, }, // 2^12
+    { 0x8a2979a9U, 0x60e16970U, 0x8b01ce7bU, 0xc9d1ce32U, }, // 2^13
+    { 0xd4fd7b86U, 0x57b8e99aU, 0x3853473dU, 0xee6262e1U, }, // 2^14
+    { 0x7f0861fdU, 0xa1ea4d71U, 0xa2327f56U, 0x668140b3U, }, // 2^15
+    { 0x08a24926U, 0x2fb44195U, 0x6d916adeU, 0x4e271317U, }, // 2^16
+    { 0xd35f6af2U, 0x4677800bU, 0x7b28f619U, 0x83bc62cdU, }, // 2^17
+    { 0x0dfcd277U, 0x46325cc0U, 0x73a74986U, 0x19b1cec2U, }, // 2^18
+    { 0xb8c5a6a6U, 0x97e03957U, 0xba0dcd4fU, 0xee16f96cU, }, // 2^19
+    { 0x584b12afU, 0x7316a7cdU, 0x7a2ba910U, 0x53fe0a37U, }, // 2^20
+    { 0x08b50aa9U, 0x78f5b997U, 0xb6319395U, 0x665aaf09U, }, // 2^21
+    { 0x2d6021eeU, 0x4f64a1a4U, 0x0baac402U, 0x14dbe352U, }, // 2^22
+    { 0xff5111edU, 0x8cdd10afU, 0x9596864eU, 0x7584f641U, }, // 2^23
+    { 0x2e4b8d20U, 0x6c4fa858U, 0x60a23f97U, 0x6cbdae97U, }, // 2^24
+    { 0x8fd0c1adU, 0x8d6d396cU, 0x1b2a88a9U, 0x5409d06cU, }, // 2^25
+    { 0x070bbd82U, 0x38dc68d8U, 0xe2f8cff2U, 0x1a377633U, }, // 2^26
+    { 0xdeef0ad1U, 0x306d9b7bU, 0x75f46cc6U, 0x6ea3c8e6U, }, // 2^27
+    { 0x3b11252cU, 0x1849dfcfU, 0x83608b0cU, 0x4271354cU, }, // 2^28
+    { 0x7bc67b5dU, 0x699cac0aU, 0xd888887fU, 0x88e6db6eU, }, // 2^29
+    { 0xdc16b5e8U, 0x2514ba92U, 0x5de9763fU, 0x11534240U, }, // 2^30
+    { 0x19a6c40dU, 0xfdd2110dU, 0x9499febcU, 0x686d0878U, }, // 2^31
+    { 0xf7afe108U, 0xf3be07b8U, 0x730b948dU, 0x0f8aed94U, }, // 2^32
+    { 0xf460532dU, 0xc59fb123U, 0xa69c31b0U, 0x5322c76eU, }, // 2^33
+    { 0x51e478c4U, 0xf5e2f2d7U, 0xfe9852d5U, 0x95e92935U, }, // 2^34
+    { 0xb50d1e24U, 0xb42d61cdU, 0xbd400cddU, 0x09d372b1U, }, // 2^35
+    { 0x6bdfad84U, 0xc4c77b39U, 0x2c1d0568U, 0xe7536e87U, }, // 2^36
+    { 0x1971c861U, 0x9b2f7d00U, 0x5bfabd1eU, 0x4b9d0a59U, }, // 2^37
+    { 0xfa529189U, 0x29d8e7c8U, 0x6e84af09U, 0xd61683d9U, }, // 2^38
+    { 0xafa34e18U, 0x990b180cU, 0x93d1a9a8U, 0x2bddc822U, }, // 2^39
+    { 0x4690ac90U, 0x83f99607U, 0x720d8d54U, 0x8c913c7bU, }, // 2^40
+    { 0x369ee447U, 0xb2090283U, 0x4e01096bU, 0x5bcc6a1aU, }, // 2^41
+    { 0x5bdef343U, 0x1b6400d1U, 0xe94b6db2U, 0x789925e5U, }, // 2^42
+    { 0x24768a59U, 0x298bd3d0U, 0x17709585U, 0x44b170cfU, }, // 2^43
+    { 0x5d874f1bU, 0x170214ceU, 0x0b14099dU, 0x97cda294U, }, // 2^44
+    { 0xe0d94af5U, 0x53f78198U, 0xf13a78acU, 0x48731cb9U, }, // 2^45
+    { 0xccca1be5U, 0xa64a2fb8U, 0xe4558a6eU, 0x3f16f673U, }, // 2^46
+    { 0x0683f257U, 0x6dd6ee27U, 0x99a8d18eU, 0xa3ef88dfU, }, // 2^47
+    { 0xcb56667cU, 0x87a4583dU, 0xdec5bb9aU, 0xdeaa4ca2U, }, // 2^48
+    { 0xcfa23a11U, 0xf03580b0U, 0x76e2536bU, 0x8c8fab83U, }, // 2^49
+    { 0xb6ff34b1U, 0x16f8a8c8U, 0x445b421dU, 0x6157c701U, }, // 2^50
+    { 0x4ec6d5deU, 0x4cf8b920U, 0x7e968b3eU, 0xc9790225U, }, // 2^51
+    { 0x35a81e7cU, 0x3b0ce3bfU, 0xc4c741e4U, 0xdbcbeaaeU, }, // 2^52
+    { 0x816402f4U, 0x1970e372U, 0x8b80bd92U, 0x479e43a8U, }, // 2^53
+    { 0xddeca818U, 0xc45c3501U, 0x2253cc65U, 0x0adcea84U, }, // 2^54
+    { 0x729a959bU, 0x880a3b77U, 0x4de1459aU, 0xb1afc783U, }, // 2^55
+    { 0x61fb9420U, 0xe6895754U, 0x2f656668U, 0x5d351d8eU, }, // 2^56
+    { 0x09e626b1U, 0xed521e9bU, 0x48307882U, 0x1f945c5fU, }, // 2^57
+    { 0x7e887a38U, 0x6247b9b1U, 0xab5076c6U, 0x8f5e8e11U, }, // 2^58
+    { 0xc815942dU, 0x3bef9fbeU, 0x163b81dbU, 0xdd9db375U, }, // 2^59
+    { 0x556b1be1U, 0x570b130fU, 0xef247f68U, 0x81a138adU, }, // 2^60
+    { 0x744853a3U, 0x485c1e3eU, 0xae1e2311U, 0x2ca9fb49U, }, // 2^61
+    { 0x1615188dU, 0x821fd395U, 0xf2c0b4f8U, 0x3e3e7fb3U, }, // 2^62
+    { 0xfbb4ea2aU, 0x0c437163U, 0xeeeeff2fU, 0xce994be3U, }, // 2^63
+    { 0x8764000bU, 0xf542d2d3U, 0x6fa035c3U, 0x77f2db5bU, }, // 2^64
+    { 0x9b802a8bU, 0x794805edU, 0x5eb170f0U, 0x7c0f7916U, }, // 2^65
+    { 0x1a235895U, 0x008078d6U, 0x18eca90eU, 0x5f292782U, }, // 2^66
+    { 0xf70585fbU, 0x4e0c5957U, 0xbce250c3U, 0x17a896ffU, }, // 2^67
+    { 0xd2f6556fU, 0x4a18286dU, 0x3628d30bU, 0x55160319U, }, // 2^68
+    { 0x7a7faf9aU, 0xa16bbafdU, 0x0e0ce4fbU, 0x3c7d15deU, }, // 2^69
+    { 0xf28e46ebU, 0x5de8d870U, 0x99c73881U, 0x138475d2U, }, // 2^70
+    { 0x606a7785U, 0x20e6d45fU, 0x1b647514U, 0x86eb7ca9U, }, // 2^71
+    { 0x49666eccU, 0x3789d8a5U, 0x6a660a93U, 0xd71038c4U, }, // 2^72
+    { 0x5128e049U, 0x57728e18U, 0x914d8f82U, 0x770b4aaeU, }, // 2^73
+    { 0xf4c220b9U, 0x204509e7U, 0xf72abaa8U, 0x87a9ba17U, }, // 2^74
+    { 0xa770745cU, 0x6305aeb1U, 0x514fb641U, 0x53f14381U, }, // 2^75
+    { 0xef0c0748U, 0x37c6bfd3U, 0xce823c5fU, 0x614b1be8U, }, // 2^76
+    { 0xa7598b6eU, 0x56acc333U, 0x7616abebU, 0x444c7482U, }, // 2^77
+    { 0x3b8e5872U, 0x95b59666U, 0x250a934eU, 0xe1c8cd14U, }, // 2^78
+    { 0x61af734bU, 0xcafb7befU, 0x40320995U, 0x52c3fefdU, }, // 2^79
+    { 0x1e448b65U, 0x3d04f456U, 0x0065b6c1U, 0x03ede698U, }, // 2^80
+    { 0x999c0c61U, 0x8f514f34U, 0x208ae8a1U, 0xa286055dU, }, // 2^81
+    { 0xfd77b051U, 0xdc74937cU, 0x87c9caa7U, 0x87c3b447U, }, // 2^82
+    { 0x5cb18704U, 0x3861888cU, 0x421e95f0U, 0x84702775U, }, // 2^83
+    { 0x796e8f1cU, 0x17386578U, 0xa950e8b9U, 0x5122b999U, }, // 2^84
+    { 0xfd714f38U, 0x6a60580cU, 0x1de92dc7U, 0x0a378a8dU, }, // 2^85
+    { 0x920394a9U, 0x59e5f42eU, 0xa82afdb9U, 0x29ec5ed3U, }, // 2^86
+    { 0x9d4e636eU, 0x91c22db3U, 0xf24479f8U, 0xb34270eeU, }, // 2^87
+    { 0xf610cdc8U, 0x935a2512U, 0xa972efe6U, 0x866bc548U, }, // 2^88
+    { 0xf67e06e0U, 0x830fc62fU, 0x426d33f9U, 0x36c311b2U, }, // 2^89
+    { 0x82e394f4U, 0x8e7ae190U, 0x74da71b9U, 0x2b8b3ac4U, }, // 2^90
+    { 0x1b17a73eU, 0x48ec363cU, 0x9f3a8665U, 0x1ba09ec7U, }, // 2^91
+    { 0x5eee0d0eU, 0x8a54b514U, 0x268d5b56U, 0x7c53cf77U, }, // 2^92
+    { 0xecb31e06U, 0x1def52d6U, 0x5ec53d4fU, 0xcb831ed8U, }, // 2^93
+    { 0x196075bfU, 0xc31db8fbU, 0x2e624b60U, 0xba7e0917U, }, // 2^94
+    { 0xf59f8398U, 0x7e8f6a86U, 0xc9ba6afbU, 0xc28a81edU, }, // 2^95
+    { 0xb523952eU, 0x0b6f099fU, 0xccf5a0efU, 0x1c580662U, }, // 2^96
+    { 0xeeb0e0a4U, 0x77133e23U, 0xdc596025U, 0x97f55fe2U, }, // 2^97
+    { 0x9e9b45acU, 0x6d495900U, 0x69ac41e5U, 0x0356e935U, }, // 2^98
+    { 0x407883f3U, 0x547d4854U, 0x9065599bU, 0x662b6ac9U, }, // 2^99
+    { 0x667ee2deU, 0x8a954d8bU, 0x6551c593U, 0x2fcdf7e4U, }, // 2^100
+    { 0xfb5707aaU, 0xdaa2886aU, 0xb233cd67U, 0x0f4183caU, }, // 2^101
+    { 0x40dbcd63U, 0x8e131a4fU, 0x224fc251U, 0xc64784eeU, }, // 2^102
+    { 0x4f4db4ffU, 0x7b6ea15fU, 0xb29e13b7U, 0x563b1ea7U, }, // 2^103
+    { 0xbbd3ae5aU, 0xebf544e9U, 0xd28ec540U, 0x5ce3332fU, }, // 2^104
+    { 0xd39c61ebU, 0x1f4dd02eU, 0x95a4e90fU, 0xa9ac90e8U, }, // 2^105
+    { 0x790c846cU, 0xd428b915U, 0xd2660f23U, 0x725dcd70U, }, // 2^106
+    { 0x08eff263U, 0xf39ff6c1U, 0x513d8ba0U, 0xca4404caU, }, // 2^107
+    { 0x26534b4dU, 0xcf8db66bU, 0x6102f64bU, 0xf84f07e3U, }, // 2^108
+    { 0xa88724c5U, 0x0870d7d7U, 0x181f9787U, 0xdc3d5d45U, }, // 2^109
+    { 0xdba73489U, 0x0df0ec1fU, 0x43005e2eU, 0xd543edf1U, }, // 2^110
+    { 0x6d73a1e7U, 0xfe43b2a7U, 0xf9a46a20U, 0x58859a86U, }, // 2^111
+    { 0xa683b6d0U, 0xafc4a733U, 0x1bf94979U, 0xf904dd9fU, }, // 2^112
+    { 0x2ee03d84U, 0x75c74e3dU, 0x96efbfd6U, 0x7d256f6cU, }, // 2^113
+    { 0x3ad0ebe7U, 0x13f14f31U, 0x796d291cU, 0xa42bbfddU, }, // 2^114
+    { 0xce04ddb0U, 0x1fc44a96U, 0xb6a00a91U, 0x8a6c4326U, }, // 2^115
+    { 0x4e519967U, 0x0d7a869eU, 0x40012492U, 0x6dc7c036U, }, // 2^116
+    { 0x9e4d0a48U, 0x6a86db67U, 0xae852b9bU, 0x6cc51cebU, }, // 2^117
+    { 0x5a52e97fU, 0x77beacceU, 0xb8030b6cU, 0x5ead7c39U, }, // 2^118
+    { 0x022cefbeU, 0x7d88e3d4U, 0x858bbdfeU, 0x6b644146U, }, // 2^119
+    { 0x90067a45U, 0xb7ce03bcU, 0xde4ac3e8U, 0x99853a2cU, }, // 2^120
+    { 0xe3a7ccf3U, 0x35c9b163U, 0xbb5b8048U, 0x31ac55d8U, }, // 2^121
+    { 0x8d4a33dbU, 0x169e96efU, 0x3788b4a3U, 0x622cd32eU, }, // 2^122
+    { 0x0513f190U, 0x06f60339U, 0x93608184U, 0x4576959dU, }, // 2^123
+    { 0x1a64167bU, 0x05c745c5U, 0xe2f50d3aU, 0x8abc30faU, }, // 2^124
+    { 0x1741bb62U, 0x3afd4ba4U, 0xb268faefU, 0x18bf57c6U, }, // 2^125
+    { 0x39b7b7b9U, 0x31bb1001U, 0xd95f2dccU, 0x5686c6e7U, }, // 2^126
+    { 0x54d81f7eU, 0x0453f0feU, 0x3bef4345U, 0x9d5e1791U, }, // 2^127
+}
+#endif
+;
+
+static const unsigned int h_xoshiro128_jump_polynomials[XOSHIRO128_JUMP_POLYNOMIALS][XOSHIRO128_N] = {
+    { 0x00000002U, 0x00000000U, 0x00000000U, 0x00000000U, }, // 2^0
+    { 0x00000004U, 0x00000000U, 0x00000000U, 0x00000000U, }, // 2^1
+    { 0x00000010U, 0x00000000U, 0x00000000U, 0x00000000U, }, // 2^2
+    { 0x00000100U, 0x00000000U, 0x00000000U, 0x00000000U, }, // 2^3
+    { 0x00010000U, 0x00000000U, 0x00000000U, 0x00000000U, }, // 2^4
+    { 0x00000000U, 0x00000001U, 0x00000000U, 0x00000000U, }, // 2^5
+    { 0x00000000U, 0x00000000U, 0x00000001U, 0x00000000U, }, // 2^6
+    { 0xde18fc01U, 0x1b489db6U, 0x006254b1U, 0x00fc65a2U, }, // 2^7
+    { 0x78bd1157U, 0xb488a061U, 0x77900a22U, 0x0e6834fbU, }, // 2^8
+    { 0x7b0bf49aU, 0x4152f743U, 0x44118d9bU, 0x38d2b436U, }, // 2^9
+    { 0x845a09b1U, 0x94b54ba1U, 0x503a9ae6U, 0x5f7aa4ffU, }, // 2^10
+    { 0x0a1f06b6U, 0xece7bc8eU, 0x9ab5cf0eU, 0x780f1aedU, }, // 2^11
+    { 0x8fcff8d3U, 0xd66b4f59U, 0x07ee277aU, 0xeb3e4975U, }, // 2^12
+    { 0x8a2979a9U, 0x60e16970U, 0x8b01ce7bU, 0xc9d1ce32U, }, // 2^13
+    { 0xd4fd7b86U, 0x57b8e99aU, 0x3853473dU, 0xee6262e1U, }, // 2^14
+    { 0x7f0861fdU, 0xa1ea4d71U, 0xa2327f56U, 0x668140b3U, }, // 2^15
+    { 0x08a24926U, 0x2fb44195U, 0x6d916adeU, 0x4e271317U, }, // 2^16
+    { 0xd35f6af2U, 0x4677800bU, 0x7b28f619U, 0x83bc62cdU, }, // 2^17
+    { 0x0dfcd277U, 0x46325cc0U, 0x73a74986U, 0x19b1cec2U, }, // 2^18
+    { 0xb8c5a6a6U, 0x97e03957U, 0xba0dcd4fU, 0xee16f96cU, }, // 2^19
+    { 0x584b12afU, 0x7316a7cdU, 0x7a2ba910U, 0x53fe0a37U, }, // 2^20
+    { 0x08b50aa9U, 0x78f5b997U, 0xb6319395U, 0x665aaf09U, }, // 2^21
+    { 0x2d6021eeU, 0x4f64a1a4U, 0x0baac402U, 0x14dbe352U, }, // 2^22
+    { 0xff5111edU, 0x8cdd10afU, 0x9596864eU, 0x7584f641U, }, // 2^23
+    { 0x2e4b8d20U, 0x6c4fa858U, 0x60a23f97U, 0x6cbdae97U, }, // 2^24
+    { 0x8fd0c1adU, 0x8d6d396cU, 0x1b2a88a9U, 0x5409d06cU, }, // 2^25
+    { 0x070bbd82U, 0x38dc68d8U, 0xe2f8cff2U, 0x1a377633U, }, // 2^26
+    { 0xdeef0ad1U, 0x306d9b7bU, 0x75f46cc6U, 0x6ea3c8e6U, }, // 2^27
+    { 0x3b11252cU, 0x1849dfcfU, 0x83608b0cU, 0x4271354cU, }, // 2^28
+    { 0x7bc67b5dU, 0x699cac0aU, 0xd888887fU, 0x88e6db6eU, }, // 2^29
+    { 0xdc16b5e8U, 0x2514ba92U, 0x5de9763fU, 0x11534240U, }, // 2^30
+    { 0x19a6c40dU, 0xfdd2110dU, 0x9499febcU, 0x686d0878U, }, // 2^31
+    { 0xf7afe108U, 0xf3be07b8U, 0x730b948dU, 0x0f8aed94U, }, // 2^32
+    { 0xf460532dU, 0xc59fb123U, 0xa69c31b0U, 0x5322c76eU, }, // 2^33
+    { 0x51e478c4U, 0xf5e2f2d7U, 0xfe9852d5U, 0x95e92935U, }, // 2^34
+    { 0xb50d1e24U, 0xb42d61cdU, 0xbd400cddU, 0x09d372b1U, }, // 2^35
+    { 0x6bdfad84U, 0xc4c77b39U, 0x2c1d0568U, 0xe7536e87U, }, // 2^36
+    { 0x1971c861U, 0x9b2f7d00U, 0x5bfabd1eU, 0x4b9d0a59U, }, // 2^37
+    { 0xfa529189U, 0x29d8e7c8U, 0x6e84af09U, 0xd61683d9U, }, // 2^38
+    { 0xafa34e18U, 0x990b180cU, 0x93d1a9a8U, 0x2bddc822U, }, // 2^39
+    { 0x4690ac90U, 0x83f99607U, 0x720d8d54U, 0x8c913c7bU, }, // 2^40
+    { 0x369ee447U, 0xb2090283U, 0x4e01096bU, 0x5bcc6a1aU, }, // 2^41
+    { 0x5bdef343U, 0x1b6400d1U, 0xe94b6db2U, 0x789925e5U, }, // 2^42
+    { 0x24768a59U, 0x298bd3d0U, 0x17709585U, 0x44b170cfU, }, // 2^43
+    { 0x5d874f1bU, 0x170214ceU, 0x0b14099dU, 0x97cda294U, }, // 2^44
+    { 0xe0d94af5U, 0x53f78198U, 0xf13a78acU, 0x48731cb9U, }, // 2^45
+    { 0xccca1be5U, 0xa64a2fb8U, 0xe4558a6eU, 0x3f16f673U, }, // 2^46
+    { 0x0683f257U, 0x6dd6ee27U, 0x99a8d18eU, 0xa3ef88dfU, }, // 2^47
+    { 0xcb56667cU, 0x87a4583dU, 0xdec5bb9aU, 0xdeaa4ca2U, }, // 2^48
+    { 0xcfa23a11U, 0xf03580b0U, 0x76e2536bU, 0x8c8fab83U, }, // 2^49
+    { 0xb6ff34b1U, 0x16f8a8c8U, 0x445b421dU, 0x6157c701U, }, // 2^50
+    { 0x4ec6d5deU, 0x4cf8b920U, 0x7e968b3eU, 0xc9790225U, }, // 2^51
+    { 0x35a81e7cU, 0x3b0ce3bfU, 0xc4c741e4U, 0xdbcbeaaeU, }, // 2^52
+    { 0x816402f4U, 0x1970e372U, 0x8b80bd92U, 0x479e43a8U, }, // 2^53
+    { 0xddeca818U, 0xc45c3501U, 0x2253cc65U, 0x0adcea84U, }, // 2^54
+    { 0x729a959bU, 0x880a3b77U, 0x4de1459aU, 0xb1afc783U, }, // 2^55
+    { 0x61fb9420U, 0xe6895754U, 0x2f656668U, 0x5d351d8eU, }, // 2^56
+    { 0x09e626b1U, 0xed521e9bU, 0x48307882U, 0x1f945c5fU, }, // 2^57
+    { 0x7e887a38U, 0x6247b9b1U, 0xab5076c6U, 0x8f5e8e11U, }, // 2^58
+    { 0xc815942dU, 0x3bef9fbeU, 0x163b81dbU, 0xdd9db375U, }, // 2^59
+    { 0x556b1be1U, 0x570b130fU, 0xef247f68U, 0x81a138adU, }, // 2^60
+    { 0x744853a3U, 0x485c1e3eU, 0xae1e2311U, 0x2ca9fb49U, }, // 2^61
+    { 0x1615188dU, 0x821fd395U, 0xf2c0b4f8U, 0x3e3e7fb3U, }, // 2^62
+    { 0xfbb4ea2aU, 0x0c437163U, 0xeeeeff2fU, 0xce994be3U, }, // 2^63
+    { 0x8764000bU, 0xf542d2d3U, 0x6fa035c3U, 0x77f2db5bU, }, // 2^64
+    { 0x9b802a8bU, 0x794805edU, 0x5eb170f0U, 0x7c0f7916U, }, // 2^65
+    { 0x1a235895U, 0x008078d6U, 0x18eca90eU, 0x5f292782U, }, // 2^66
+    { 0xf70585fbU, 0x4e0c5957U, 0xbce250c3U, 0x17a896ffU, }, // 2^67
+    { 0xd2f6556fU, 0x4a18286dU, 0x3628d30bU, 0x55160319U, }, // 2^68
+    { 0x7a7faf9aU, 0xa16bbafdU, 0x0e0ce4fbU, 0x3c7d15deU, }, // 2^69
+    { 0xf28e46ebU, 0x5de8d870U, 0x99c73881U, 0x138475d2U, }, // 2^70
+    { 0x606a7785U, 0x20e6d45fU, 0x1b647514U, 0x86eb7ca9U, }, // 2^71
+    { 0x49666eccU, 0x3789d8a5U, 0x6a660a93U, 0xd71038c4U, }, // 2^72
+    { 0x5128e049U, 0x57728e18U, 0x914d8f82U, 0x770b4aaeU, }, // 2^73
+    { 0xf4c220b9U, 0x204509e7U, 0xf72abaa8U, 0x87a9ba17U, }, // 2^74
+    { 0xa770745cU, 0x6305aeb1U, 0x514fb641U, 0x53f14381U, }, // 2^75
+    { 0xef0c0748U, 0x37c6bfd3U, 0xce823c5fU, 0x614b1be8U, }, // 2^76
+    { 0xa7598b6eU, 0x56acc333U, 0x7616abebU, 0x444c7482U, }, // 2^77
+    { 0x3b8e5872U, 0x95b59666U, 0x250a934eU, 0xe1c8cd14U, }, // 2^78
+    { 0x61af734bU, 0xcafb7befU, 0x40320995U, 0x52c3fefdU, }, // 2^79
+    { 0x1e448b65U, 0x3d04f456U, 0x0065b6c1U, 0x03ede698U, }, // 2^80
+    { 0x999c0c61U, 0x8f514f34U, 0x208ae8a1U, 0xa286055dU, }, // 2^81
+    { 0xfd77b051U, 0xdc74937cU, 0x87c9caa7U, 0x87c3b447U, }, // 2^82
+    { 0x5cb18704U, 0x3861888cU, 0x421e95f0U, 0x84702775U, }, // 2^83
+    { 0x796e8f1cU, 0x17386578U, 0xa950e8b9U, 0x5122b999U, }, // 2^84
+    { 0xfd714f38U, 0x6a60580cU, 0x1de92dc7U, 0x0a378a8dU, }, // 2^85
+    { 0x920394a9U, 0x59e5f42eU, 0xa82afdb9U, 0x29ec5ed3U, }, // 2^86
+    { 0x9d4e636eU, 0x91c22db3U, 0xf24479f8U, 0xb34270eeU, }, // 2^87
+    { 0xf610cdc8U, 0x935a2512U, 0xa972efe6U, 0x866bc548U, }, // 2^88
+    { 0xf67e06e0U, 0x830fc62fU, 0x426d33f9U, 0x36c311b2U, }, // 2^89
+    { 0x82e394f4U, 0x8e7ae190U, 0x74da71b9U, 0x2b8b3ac4U, }, // 2^90
+    { 0x1b17a73eU, 0x48ec363cU, 0x9f3a8665U, 0x1ba09ec7U, }, // 2^91
+    { 0x5eee0d0eU, 0x8a54b514U, 0x268d5b56U, 0x7c53cf77U, }, // 2^92
+    { 0xecb31e06U, 0x1def52d6U, 0x5ec53d4fU, 0xcb831ed8U, }, // 2^93
+    { 0x196075bfU, 0xc31db8fbU, 0x2e624b60U, 0xba7e0917U, }, // 2^94
+    { 0xf59f8398U, 0x7e8f6a86U, 0xc9ba6afbU, 0xc28a81edU, }, // 2^95
+    { 0xb523952eU, 0x0b6f099fU, 0xccf5a0efU, 0x1c580662U, }, // 2^96
+    { 0xeeb0e0a4U, 0x77133e23U, 0xdc596025U, 0x97f55fe2U, }, // 2^97
+    { 0x9e9b45acU, 0x6d495900U, 0x69ac41e5U, 0x0356e935U, }, // 2^98
+    { 0x407883f3U, 0x547d4854U, 0x9065599bU, 0x662b6ac9U, }, // 2^99
+    { 0x667ee2deU, 0x8a954d8bU, 0x6551c593U, 0x2fcdf7e4U, }, // 2^100
+    { 0xfb5707aaU, 0xdaa2886aU, 0xb233cd67U, 0x0f4183caU, }, // 2^101
+    { 0x40dbcd63U, 0x8e131a4fU, 0x224fc251U, 0xc64784eeU, }, // 2^102
+    { 0x4f4db4ffU, 0x7b6ea15fU, 0xb29e13b7U, 0x563b1ea7U, }, // 2^103
+    { 0xbbd3ae5aU, 0xebf544e9U, 0xd28ec540U, 0x5ce3332fU, }, // 2^104
+    { 0xd39c61ebU, 0x1f4dd02eU, 0x95a4e90fU, 0xa9ac90e8U, }, // 2^105
+    { 0x790c846cU, 0xd428b915U, 0xd2660f23U, 0x725dcd70U, }, // 2^106
+    { 0x08eff263U, 0xf39ff6c1U, 0x513d8ba0U, 0xca4404caU, }, // 2^107
+    { 0x26534b4dU, 0xcf8db66bU, 0x6102f64bU, 0xf84f07e3U, }, // 2^108
+    { 0xa88724c5U, 0x0870d7d7U, 0x181f9787U, 0xdc3d5d45U, }, // 2^109
+    { 0xdba73489U, 0x0df0ec1fU, 0x43005e2eU, 0xd543edf1U, }, // 2^110
+    { 0x6d73a1e7U, 0xfe43b2a7U, 0xf9a46a20U, 0x58859a86U, }, // 2^111
+    { 0xa683b6d0U, 0xafc4a733U, 0x1bf94979U, 0xf904dd9fU, }, // 2^112
+    { 0x2ee03d84U, 0x75c74e3dU, 0x96efbfd6U, 0x7d256f6cU, }, // 2^113
+    { 0x3ad0ebe7U, 0x13f14f31U, 0x796d291cU, 0xa42bbfddU, }, // 2^114
+    { 0xce04ddb0U, 0x1fc44a96U, 0xb6a00a91U, 0x8a6c4326U, }, // 2^115
+    { 0x4e519967U, 0x0d7a869eU, 0x40012492U, 0x6dc7c036U, }, // 2^116
+    { 0x9e4d0a48U, 0x6a86db67U, 0xae852b9bU, 0x6cc51cebU, }, // 2^117
+    { 0x5a52e97fU, 0x77beacceU, 0xb8030b6cU, 0x5ead7c39U, }, // 2^118
+    { 0x022cefbeU, 0x7d88e3d4U, 0x858bbdfeU, 0x6b644146U, }, // 2^119
+    { 0x90067a45U, 0xb7ce03bcU, 0xde4ac3e8U, 0x99853a2cU, }, // 2^120
+    { 0xe3a7ccf3U, 0x35c9b163U, 0xbb5b8048U, 0x31ac55d8U, }, // 2^121
+    { 0x8d4a33dbU, 0x169e96efU, 0x3788b4a3U, 0x622cd32eU, }, // 2^122
+    { 0x0513f190U, 0x06f60339U, 0x93608184U, 0x4576959dU, }, // 2^123
+    { 0x1a64167bU, 0x05c745c5U, 0xe2f50d3aU, 0x8abc30faU, }, // 2^124
+    { 0x1741bb62U, 0x3afd4ba4U, 0xb268faefU, 0x18bf57c6U, }, // 2^125
+    { 0x39b7b7b9U, 0x31bb1001U, 0xd95f2dccU, 0x5686c6e7U, }, // 2^126
+    { 0x54d81f7eU, 0x0453f0feU, 0x3bef4345U, 0x9d5e1791U, }, // 2^127
+};
+
+
+#endif // ROCRAND_XOSHIRO128_PRECOMPUTED_H_
@@ -0,0 +1,290 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_XOSHIRO128PP_H_
+#define ROCRAND_XOSHIRO128PP_H_
+
+#ifndef FQUALIFIERS
+#define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS_
+
+#include "rocrand_common.h"
+#include "rocrand_xoshiro128_precomputed.h"
+
+// D. Blackman, S. Vigna, Scrambled linear pseudorandom number generators, 2021
+// https://prng.di.unimi.it/
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+ /**
+ * \def ROCRAND_XOSHIRO128PP_DEFAULT_SEED
+ * \brief Default seed for xoshiro128++ PRNG.
+ */
+ #define ROCRAND_XOSHIRO128PP_DEFAULT_SEED 0ULL
+ /** @} */ // end of group rocranddevice
+
+namespace rocrand_device {
+namespace detail {
+
+struct xoshiro128pp_state
+{
+    // 128-bit state, never all zeros
+    unsigned int s[4];
+};
+
+FQUALIFIERS
+unsigned int rotl32(const unsigned int x, const unsigned int k)
+{
+    return (x << k) | (x >> (32 - k));
+}
+
+} // end detail namespace
+
+class xoshiro128pp_engine
+{
+public:
+    typedef detail::xoshiro128pp_state xoshiro128pp_state;
+
+    FQUALIFIERS
+    xoshiro128pp_engine() : xoshiro128pp_engine(ROCRAND_XOSHIRO128PP_DEFAULT_SEED, 0, 0) { }
+
+    /// Initializes the internal state of the PRNG using
+    /// seed value \p seed, goes to \p subsequence -th subsequence,
+    /// and skips \p offset random numbers.
+    ///
+    /// The state is two SplitMix64 values of the seed.
+    /// A subsequence is 2^64 numbers long.
+    FQUALIFIERS
+    xoshiro128pp_engine(const unsigned long long seed,
+                        const unsigned long long subsequence,
+                        const unsigned long long offset)
+    {
+        unsigned long long z = seed;
+        for(unsigned int i = 0; i < 2; i++)
+        {
+            z += 0x9E3779B97F4A7C15ULL;
+            unsigned long long r = z;
+            r = (r ^ (r >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            r = (r ^ (r >> 27)) * 0x94D049BB133111EBULL;
+            r = r ^ (r >> 31);
+            // SplitMix64 is a bijection, consecutive values are not both zeros
+            m_state.s[2 * i] = static_cast<unsigned int>(r);
+            m_state.s[2 * i + 1] = static_cast<unsigned int>(r >> 32);
+        }
+
+        discard_subsequence(subsequence);
+        discard(offset);
+    }
+
+    /// Advances the internal state to skip \p offset numbers.
+    FQUALIFIERS
+    void discard(unsigned long long offset)
+    {
+        // A jump by a polynomial costs XOSHIRO128_DEGREE steps,
+        // low bits of the offset are stepped directly
+        const unsigned int steps = static_cast<unsigned int>(offset) & (XOSHIRO128_DEGREE - 1);
+        for(unsigned int i = 0; i < steps; i++)
+        {
+            next();
+        }
+        #ifdef __HIP_DEVICE_COMPILE__
+        jump(offset >> 7, 7, d_xoshiro128_jump_polynomials);
+        #else
+        jump(offset >> 7, 7, h_xoshiro128_jump_polynomials);
+        #endif
+    }
+
+    /// Advances the internal state to skip \p subsequence subsequences.
+    /// A subsequence is 2^64 numbers long, jump() of the reference
+    /// implementation skips one subsequence.
+    FQUALIFIERS
+    void discard_subsequence(unsigned long long subsequence)
+    {
+        #ifdef __HIP_DEVICE_COMPILE__
+        jump(subsequence, 64, d_xoshiro128_jump_polynomials);
+        #else
+        jump(subsequence, 64, h_xoshiro128_jump_polynomials);
+        #endif
+    }
+
+    FQUALIFIERS
+    unsigned int operator()()
+    {
+        return next();
+    }
+
+    FQUALIFIERS
+    unsigned int next()
+    {
+        unsigned int * s = m_state.s;
+        const unsigned int result = detail::rotl32(s[0] + s[3], 7) + s[0];
+        const unsigned int t = s[1] << 9;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = detail::rotl32(s[3], 11);
+        return result;
+    }
+
+protected:
+    // Skips v * 2^first numbers: jumps by 2^(first + e) for all set bits e of v.
+    // The state after a jump by J numbers is the sum of the states after k
+    // steps for all terms x^k of x^J mod P(x), P is the characteristic
+    // polynomial of the linear engine (see tools/xoshiro128_precomputed_generator).
+    FQUALIFIERS
+    void jump(unsigned long long v,
+              unsigned int first,
+              const unsigned int polynomials[XOSHIRO128_JUMP_POLYNOMIALS][XOSHIRO128_N])
+    {
+        for(unsigned int e = first; v > 0; e++, v >>= 1)
+        {
+            if((v & 1) == 0)
+                continue;
+            unsigned int r[4] = { 0, 0, 0, 0 };
+            for(unsigned int w = 0; w < XOSHIRO128_N; w++)
+            {
+                const unsigned int p = polynomials[e][w];
+                for(unsigned int b = 0; b < 32; b++)
+                {
+                    const unsigned int mask = (p & (1U << b)) ? 0xffffffffU : 0U;
+                    for(unsigned int i = 0; i < 4; i++)
+                    {
+                        r[i] ^= m_state.s[i] & mask;
+                    }
+                    next();
+                }
+            }
+            for(unsigned int i = 0; i < 4; i++)
+            {
+                m_state.s[i] = r[i];
+            }
+        }
+    }
+
+protected:
+    // State
+    xoshiro128pp_state m_state;
+}; // xoshiro128pp_engine class
+
+} // end namespace rocrand_device
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+/// \cond ROCRAND_KERNEL_DOCS_TYPEDEFS
+typedef rocrand_device::xoshiro128pp_engine rocrand_state_xoshiro128pp;
+/// \endcond
+
+/**
+ * \brief Initializes xoshiro128++ state.
+ *
+ * Initializes the xoshiro128++ generator \p state with the given
+ * \p seed, \p subsequence, and \p offset.
+ *
+ * The state is 16 bytes (4 32-bit words) and has no room for saved normally
+ * distributed values, so they are generated in pairs (like with
+ * rocrand_state_xorwow_compact). Skipping ahead is done with 128-bit jump
+ * polynomials, no jump matrices are read.
+ *
+ * \param seed - Value to use as a seed
+ * \param subsequence - Subsequence to start at
+ * \param offset - Absolute offset into subsequence
+ * \param state - Pointer to state to initialize
+ */
+FQUALIFIERS
+void rocrand_init(const unsigned long long seed,
+                  const unsigned long long subsequence,
+                  const unsigned long long offset,
+                  rocrand_state_xoshiro128pp * state)
+{
+    *state = rocrand_state_xoshiro128pp(seed, subsequence, offset);
+}
+
+/**
+ * \brief Returns uniformly distributed random <tt>unsigned int</tt> value
+ * from [0; 2^32 - 1] range.
+ *
+ * Generates and returns uniformly distributed random <tt>unsigned int</tt>
+ * value from [0; 2^32 - 1] range using xoshiro128++ generator in \p state.
+ * State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Pseudorandom value (32-bit) as an <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand(rocrand_state_xoshiro128pp * state)
+{
+    return state->next();
+}
+
+/**
+ * \brief Updates xoshiro128++ state to skip ahead by \p offset elements.
+ *
+ * Updates the xoshiro128++ state in \p state to skip ahead by \p offset elements.
+ *
+ * \param offset - Number of elements to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead(unsigned long long offset, rocrand_state_xoshiro128pp * state)
+{
+    return state->discard(offset);
+}
+
+/**
+ * \brief Updates xoshiro128++ state to skip ahead by \p subsequence subsequences.
+ *
+ * Updates the xoshiro128++ \p state to skip ahead by \p subsequence subsequences.
+ * Each subsequence is 2^64 numbers long.
+ *
+ * \param subsequence - Number of subsequences to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead_subsequence(unsigned long long subsequence, rocrand_state_xoshiro128pp * state)
+{
+    return state->discard_subsequence(subsequence);
+}
+
+/**
+ * \brief Updates xoshiro128++ state to skip ahead by \p sequence sequences.
+ *
+ * Updates the xoshiro128++ \p state skipping \p sequence sequences ahead.
+ * For xoshiro128++ each sequence is 2^64 numbers long (equal to the size of a subsequence).
+ *
+ * \param sequence - Number of sequences to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead_sequence(unsigned long long sequence, rocrand_state_xoshiro128pp * state)
+{
+    return state->discard_subsequence(sequence);
+}
+
+#endif // ROCRAND_XOSHIRO128PP_H_
+
+/** @} */ // end of group rocranddevice
@@ -58,6 +58,53 @@ module hipfor
             type(c_ptr), value :: ptr
             integer(c_int) :: hipFree
         end function
+
+        function hipMallocPitch(ptr, pitch, width, height) bind(C, name = "cudaMallocPitch")
+            use iso_c_binding
+            implicit none
+            type(c_ptr) :: ptr
+            integer(c_size_t) :: pitch
+            integer(c_size_t), value :: width
+            integer(c_size_t), value :: height
+            integer(c_int) :: hipMallocPitch
+        end function
+
+        function hipHostMalloc(ptr, length, flags) bind(C, name = "cudaHostAlloc")
+            use iso_c_binding
+            implicit none
+            type(c_ptr) :: ptr
+            integer(c_size_t), value :: length
+            integer(c_int), value :: flags
+            integer(c_int) :: hipHostMalloc
+        end function
+
+        function hipHostFree(ptr) bind(C, name = "cudaFreeHost")
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: ptr
+            integer(c_int) :: hipHostFree
+        end function
+
+        function hipStreamCreate(stream) bind(C, name = "cudaStreamCreate")
+            use iso_c_binding
+            implicit none
+            integer(c_size_t) :: stream
+            integer(c_int) :: hipStreamCreate
+        end function
+
+        function hipStreamDestroy(stream) bind(C, name = "cudaStreamDestroy")
+            use iso_c_binding
+            implicit none
+            integer(c_size_t), value :: stream
+            integer(c_int) :: hipStreamDestroy
+        end function
+
+        function hipStreamSynchronize(stream) bind(C, name = "cudaStreamSynchronize")
+            use iso_c_binding
+            implicit none
+            integer(c_size_t), value :: stream
+            integer(c_int) :: hipStreamSynchronize
+        end function
     end interface
 
 end module
@@ -48,6 +48,20 @@ module hiprand_m
     integer, public :: HIPRAND_STATUS_INTERNAL_ERROR  = 999
     integer, public :: HIPRAND_STATUS_NOT_IMPLEMENTED  = 1000
 
+    integer, public :: HIPRAND_BATCH_UNIFORM = 0
+    integer, public :: HIPRAND_BATCH_UNIFORM_DOUBLE = 1
+    integer, public :: HIPRAND_BATCH_NORMAL = 2
+    integer, public :: HIPRAND_BATCH_NORMAL_DOUBLE = 3
+    integer, public :: HIPRAND_BATCH_POISSON = 4
+
+    !> Request of hiprandGenerateBatch (hiprandBatchRequest_t)
+    type, bind(C) :: hiprandBatchRequest
+        integer(c_int) :: distribution
+        type(c_ptr) :: output_data
+        integer(c_size_t) :: n
+        real(c_double) :: parameters(2)
+    end type hiprandBatchRequest
+
     interface
         function hiprandCreateGenerator(generator, rng_type) &
         bind(C, name="hiprandCreateGenerator")
@@ -223,5 +237,27 @@ module hiprand_m
             integer(c_int) :: hiprandDestroyDistribution
             integer(c_size_t), value :: discrete_distribution
         end function
+
+        function hiprandGenerateBatch(generator, requests, count) &
+        bind(C, name="hiprandGenerateBatch")
+            use iso_c_binding
+            import :: hiprandBatchRequest
+            implicit none
+            integer(c_int) :: hiprandGenerateBatch
+            integer(c_size_t), value :: generator
+            type(hiprandBatchRequest), intent(in) :: requests(*)
+            integer(c_size_t), value :: count
+        end function
+
+        function hiprandGeneratePoissonArray(generator, output_data, lambdas, n) &
+        bind(C, name="hiprandGeneratePoissonArray")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: hiprandGeneratePoissonArray
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            type(c_ptr), value :: lambdas
+            integer(c_size_t), value :: n
+        end function
     end interface
 end module hiprand_m
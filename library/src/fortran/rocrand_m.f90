@@ -26,6 +26,12 @@ module rocrand_m
     integer, public :: ROCRAND_RNG_PSEUDO_MRG32K3A = 402
     integer, public :: ROCRAND_RNG_PSEUDO_MTGP32 = 403
     integer, public :: ROCRAND_RNG_PSEUDO_PHILOX4_32_10 = 404
+    integer, public :: ROCRAND_RNG_PSEUDO_PHILOX4_64_10 = 405
+    integer, public :: ROCRAND_RNG_PSEUDO_THREEFRY2_64_20 = 406
+    integer, public :: ROCRAND_RNG_PSEUDO_THREEFRY4_64_20 = 407
+    integer, public :: ROCRAND_RNG_PSEUDO_PHILOX4_32_7 = 408
+    integer, public :: ROCRAND_RNG_PSEUDO_XOSHIRO128PP = 409
+    integer, public :: ROCRAND_RNG_PSEUDO_PCG32 = 410
     integer, public :: ROCRAND_RNG_QUASI_DEFAULT = 500
     integer, public :: ROCRAND_RNG_QUASI_SOBOL32 = 501
 
@@ -40,6 +46,20 @@ module rocrand_m
     integer, public :: ROCRAND_STATUS_LAUNCH_FAILURE  = 107
     integer, public :: ROCRAND_STATUS_INTERNAL_ERROR  = 108
 
+    integer, public :: ROCRAND_BATCH_UNIFORM = 0
+    integer, public :: ROCRAND_BATCH_UNIFORM_DOUBLE = 1
+    integer, public :: ROCRAND_BATCH_NORMAL = 2
+    integer, public :: ROCRAND_BATCH_NORMAL_DOUBLE = 3
+    integer, public :: ROCRAND_BATCH_POISSON = 4
+
+    !> Request of rocrand_generate_batch (rocrand_batch_request)
+    type, bind(C) :: rocrand_batch_request
+        integer(c_int) :: distribution
+        type(c_ptr) :: output_data
+        integer(c_size_t) :: n
+        real(c_double) :: parameters(2)
+    end type rocrand_batch_request
+
     interface
         function rocrand_create_generator(generator, rng_type) &
         bind(C, name="rocrand_create_generator")
@@ -226,5 +246,219 @@ module rocrand_m
             integer(c_int) :: rocrand_destroy_discrete_distribution
             integer(c_size_t), value :: discrete_distribution
         end function
+
+        function rocrand_initialize_generator_async(generator) &
+        bind(C, name="rocrand_initialize_generator_async")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_initialize_generator_async
+            integer(c_size_t), value :: generator
+        end function
+
+        function rocrand_get_stream(generator, stream) &
+        bind(C, name="rocrand_get_stream")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_get_stream
+            integer(c_size_t), value :: generator
+            integer(c_size_t) :: stream
+        end function
+
+        function rocrand_set_substreams(generator, count, streams) &
+        bind(C, name="rocrand_set_substreams")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_set_substreams
+            integer(c_size_t), value :: generator
+            integer(c_int), value :: count
+            type(c_ptr), value :: streams
+        end function
+
+        function rocrand_generate_on(generator, substream, output_data, n) &
+        bind(C, name="rocrand_generate_on")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_on
+            integer(c_size_t), value :: generator
+            integer(c_int), value :: substream
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+        end function
+
+        function rocrand_generate_uniform_on(generator, substream, output_data, n) &
+        bind(C, name="rocrand_generate_uniform_on")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_uniform_on
+            integer(c_size_t), value :: generator
+            integer(c_int), value :: substream
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+        end function
+
+        function rocrand_generate_uniform_double_on(generator, substream, &
+        output_data, n) bind(C, name="rocrand_generate_uniform_double_on")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_uniform_double_on
+            integer(c_size_t), value :: generator
+            integer(c_int), value :: substream
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+        end function
+
+        function rocrand_generate_normal_on(generator, substream, output_data, &
+        n, mean, stddev) bind(C, name="rocrand_generate_normal_on")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_normal_on
+            integer(c_size_t), value :: generator
+            integer(c_int), value :: substream
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+            real(c_float), value :: mean
+            real(c_float), value :: stddev
+        end function
+
+        function rocrand_generate_normal_double_on(generator, substream, &
+        output_data, n, mean, stddev) bind(C, name="rocrand_generate_normal_double_on")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_normal_double_on
+            integer(c_size_t), value :: generator
+            integer(c_int), value :: substream
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+            real(c_double), value :: mean
+            real(c_double), value :: stddev
+        end function
+
+        function rocrand_generate_batch(generator, requests, count) &
+        bind(C, name="rocrand_generate_batch")
+            use iso_c_binding
+            import :: rocrand_batch_request
+            implicit none
+            integer(c_int) :: rocrand_generate_batch
+            integer(c_size_t), value :: generator
+            type(rocrand_batch_request), intent(in) :: requests(*)
+            integer(c_size_t), value :: count
+        end function
+
+        function rocrand_generate_uniform_2d(generator, output_data, pitch, &
+        width, height) bind(C, name="rocrand_generate_uniform_2d")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_uniform_2d
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: pitch
+            integer(c_size_t), value :: width
+            integer(c_size_t), value :: height
+        end function
+
+        function rocrand_generate_uniform_double_2d(generator, output_data, &
+        pitch, width, height) bind(C, name="rocrand_generate_uniform_double_2d")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_uniform_double_2d
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: pitch
+            integer(c_size_t), value :: width
+            integer(c_size_t), value :: height
+        end function
+
+        function rocrand_generate_normal_2d(generator, output_data, pitch, &
+        width, height, mean, stddev) bind(C, name="rocrand_generate_normal_2d")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_normal_2d
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: pitch
+            integer(c_size_t), value :: width
+            integer(c_size_t), value :: height
+            real(c_float), value :: mean
+            real(c_float), value :: stddev
+        end function
+
+        function rocrand_generate_normal_double_2d(generator, output_data, &
+        pitch, width, height, mean, stddev) bind(C, name="rocrand_generate_normal_double_2d")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_normal_double_2d
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: pitch
+            integer(c_size_t), value :: width
+            integer(c_size_t), value :: height
+            real(c_double), value :: mean
+            real(c_double), value :: stddev
+        end function
+
+        function rocrand_generate_to_host(generator, output_data, n) &
+        bind(C, name="rocrand_generate_to_host")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_to_host
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+        end function
+
+        function rocrand_generate_uniform_to_host(generator, output_data, n) &
+        bind(C, name="rocrand_generate_uniform_to_host")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_uniform_to_host
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+        end function
+
+        function rocrand_generate_uniform_double_to_host(generator, output_data, n) &
+        bind(C, name="rocrand_generate_uniform_double_to_host")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_uniform_double_to_host
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+        end function
+
+        function rocrand_generate_normal_to_host(generator, output_data, n, &
+        mean, stddev) bind(C, name="rocrand_generate_normal_to_host")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_normal_to_host
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+            real(c_float), value :: mean
+            real(c_float), value :: stddev
+        end function
+
+        function rocrand_generate_normal_double_to_host(generator, output_data, &
+        n, mean, stddev) bind(C, name="rocrand_generate_normal_double_to_host")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_normal_double_to_host
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+            real(c_double), value :: mean
+            real(c_double), value :: stddev
+        end function
+
+        function rocrand_generate_poisson_to_host(generator, output_data, n, lambda) &
+        bind(C, name="rocrand_generate_poisson_to_host")
+            use iso_c_binding
+            implicit none
+            integer(c_int) :: rocrand_generate_poisson_to_host
+            integer(c_size_t), value :: generator
+            type(c_ptr), value :: output_data
+            integer(c_size_t), value :: n
+            real(c_double), value :: lambda
+        end function
     end interface
 end module rocrand_m
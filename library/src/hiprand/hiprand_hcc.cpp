@@ -23,6 +23,10 @@
 #include <rocrand.h>
 
 #include <hiprand.h>
+#include <hiprand_ext.h>
+
+#include <new>
+#include <vector>
 
 #if defined(__cplusplus)
 extern "C" {
@@ -84,11 +88,11 @@ rocrand_rng_type to_rocrand_rng_type(hiprandRngType_t rng_type)
         case HIPRAND_RNG_QUASI_SOBOL32:
             return ROCRAND_RNG_QUASI_SOBOL32;
         case HIPRAND_RNG_QUASI_SCRAMBLED_SOBOL32:
-            throw HIPRAND_STATUS_NOT_IMPLEMENTED;
+            return ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32;
         case HIPRAND_RNG_QUASI_SOBOL64:
-            throw HIPRAND_STATUS_NOT_IMPLEMENTED;
+            return ROCRAND_RNG_QUASI_SOBOL64;
         case HIPRAND_RNG_QUASI_SCRAMBLED_SOBOL64:
-            throw HIPRAND_STATUS_NOT_IMPLEMENTED;
+            return ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64;
         default:
             throw HIPRAND_STATUS_TYPE_ERROR;
     }
@@ -114,9 +118,18 @@ hiprandCreateGenerator(hiprandGenerator_t * generator, hiprandRngType_t rng_type
 hiprandStatus_t HIPRANDAPI
 hiprandCreateGeneratorHost(hiprandGenerator_t * generator, hiprandRngType_t rng_type)
 {
-    (void) generator;
-    (void) rng_type;
-    return HIPRAND_STATUS_NOT_IMPLEMENTED;
+    try
+    {
+        return to_hiprand_status(
+            rocrand_create_generator_host(
+                (rocrand_generator *)(generator),
+                to_rocrand_rng_type(rng_type)
+            )
+        );
+    } catch(const hiprandStatus_t& error)
+    {
+        return error;
+    }
 }
 
 hiprandStatus_t HIPRANDAPI
@@ -165,6 +178,18 @@ hiprandGenerateShort(hiprandGenerator_t generator,
     );
 }
 
+hiprandStatus_t HIPRANDAPI
+hiprandGenerateLongLong(hiprandGenerator_t generator,
+                        unsigned long long * output_data, size_t n)
+{
+    return to_hiprand_status(
+        rocrand_generate_long_long(
+            (rocrand_generator)(generator),
+            output_data, n
+        )
+    );
+}
+
 hiprandStatus_t HIPRANDAPI
 hiprandGenerateUniform(hiprandGenerator_t generator,
                        float * output_data, size_t n)
@@ -377,6 +402,97 @@ hiprandDestroyDistribution(hiprandDiscreteDistribution_t discrete_distribution)
     );
 }
 
+hiprandStatus_t HIPRANDAPI
+hiprandInitStates(void * states,
+                  size_t n,
+                  unsigned long long seed,
+                  unsigned long long offset,
+                  hiprandRngType_t rng_type,
+                  hipStream_t stream)
+{
+    try
+    {
+        return to_hiprand_status(
+            rocrand_init_states(
+                states, n, seed, offset,
+                to_rocrand_rng_type(rng_type),
+                stream
+            )
+        );
+    } catch(const hiprandStatus_t& error)
+    {
+        return error;
+    }
+}
+
+hiprandStatus_t HIPRANDAPI
+hiprandGenerateBatch(hiprandGenerator_t generator,
+                     const hiprandBatchRequest_t * requests,
+                     size_t count)
+{
+    if(requests == NULL)
+    {
+        return HIPRAND_STATUS_OUT_OF_RANGE;
+    }
+    try
+    {
+        std::vector<rocrand_batch_request> rocrand_requests(count);
+        for(size_t i = 0; i < count; i++)
+        {
+            rocrand_requests[i].distribution =
+                static_cast<rocrand_batch_distribution>(requests[i].distribution);
+            rocrand_requests[i].output_data = requests[i].output_data;
+            rocrand_requests[i].n = requests[i].n;
+            rocrand_requests[i].parameters[0] = requests[i].parameters[0];
+            rocrand_requests[i].parameters[1] = requests[i].parameters[1];
+        }
+        return to_hiprand_status(
+            rocrand_generate_batch(
+                (rocrand_generator)(generator),
+                rocrand_requests.data(), count
+            )
+        );
+    } catch(const std::bad_alloc&)
+    {
+        return HIPRAND_STATUS_ALLOCATION_FAILED;
+    }
+}
+
+hiprandStatus_t HIPRANDAPI
+hiprandGeneratePoissonArray(hiprandGenerator_t generator,
+                            unsigned int * output_data,
+                            const double * lambdas, size_t n)
+{
+    return to_hiprand_status(
+        rocrand_generate_poisson_array(
+            (rocrand_generator)(generator),
+            output_data, lambdas, n
+        )
+    );
+}
+
+hiprandStatus_t HIPRANDAPI
+hiprandGeneratorSave(hiprandGenerator_t generator, void * blob, size_t * blob_size)
+{
+    return to_hiprand_status(
+        rocrand_generator_save(
+            (rocrand_generator)(generator),
+            blob, blob_size
+        )
+    );
+}
+
+hiprandStatus_t HIPRANDAPI
+hiprandGeneratorLoad(hiprandGenerator_t generator, const void * blob, size_t blob_size)
+{
+    return to_hiprand_status(
+        rocrand_generator_load(
+            (rocrand_generator)(generator),
+            blob, blob_size
+        )
+    );
+}
+
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
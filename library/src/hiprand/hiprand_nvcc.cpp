@@ -23,6 +23,7 @@
 #include <curand.h>
 
 #include <hiprand.h>
+#include <hiprand_ext.h>
 
 #if defined(__cplusplus)
 extern "C" {
@@ -171,6 +172,18 @@ hiprandGenerateShort(hiprandGenerator_t generator,
     return HIPRAND_STATUS_NOT_IMPLEMENTED;
 }
 
+hiprandStatus_t HIPRANDAPI
+hiprandGenerateLongLong(hiprandGenerator_t generator,
+                        unsigned long long * output_data, size_t n)
+{
+    return to_hiprand_status(
+        curandGenerateLongLong(
+            (curandGenerator_t)(generator),
+            output_data, n
+        )
+    );
+}
+
 hiprandStatus_t HIPRANDAPI
 hiprandGenerateUniform(hiprandGenerator_t generator,
                        float * output_data, size_t n)
@@ -379,6 +392,118 @@ hiprandDestroyDistribution(hiprandDiscreteDistribution_t discrete_distribution)
     );
 }
 
+hiprandStatus_t HIPRANDAPI
+hiprandInitStates(void * states,
+                  size_t n,
+                  unsigned long long seed,
+                  unsigned long long offset,
+                  hiprandRngType_t rng_type,
+                  hipStream_t stream)
+{
+    (void) states;
+    (void) n;
+    (void) seed;
+    (void) offset;
+    (void) rng_type;
+    (void) stream;
+    return HIPRAND_STATUS_NOT_IMPLEMENTED;
+}
+
+// cuRAND has no batched generation, requests are generated one by one
+hiprandStatus_t HIPRANDAPI
+hiprandGenerateBatch(hiprandGenerator_t generator,
+                     const hiprandBatchRequest_t * requests,
+                     size_t count)
+{
+    if(requests == NULL)
+    {
+        return HIPRAND_STATUS_OUT_OF_RANGE;
+    }
+    for(size_t i = 0; i < count; i++)
+    {
+        const hiprandBatchRequest_t& request = requests[i];
+        if(request.output_data == NULL
+            || request.distribution < HIPRAND_BATCH_UNIFORM
+            || request.distribution > HIPRAND_BATCH_POISSON
+            || (request.distribution == HIPRAND_BATCH_POISSON && !(request.parameters[0] > 0.0)))
+        {
+            return HIPRAND_STATUS_OUT_OF_RANGE;
+        }
+    }
+    for(size_t i = 0; i < count; i++)
+    {
+        const hiprandBatchRequest_t& request = requests[i];
+        hiprandStatus_t status = HIPRAND_STATUS_SUCCESS;
+        switch(request.distribution)
+        {
+            case HIPRAND_BATCH_UNIFORM:
+                status = hiprandGenerateUniform(
+                    generator, static_cast<float *>(request.output_data), request.n
+                );
+                break;
+            case HIPRAND_BATCH_UNIFORM_DOUBLE:
+                status = hiprandGenerateUniformDouble(
+                    generator, static_cast<double *>(request.output_data), request.n
+                );
+                break;
+            case HIPRAND_BATCH_NORMAL:
+                status = hiprandGenerateNormal(
+                    generator, static_cast<float *>(request.output_data), request.n,
+                    static_cast<float>(request.parameters[0]),
+                    static_cast<float>(request.parameters[1])
+                );
+                break;
+            case HIPRAND_BATCH_NORMAL_DOUBLE:
+                status = hiprandGenerateNormalDouble(
+                    generator, static_cast<double *>(request.output_data), request.n,
+                    request.parameters[0], request.parameters[1]
+                );
+                break;
+            case HIPRAND_BATCH_POISSON:
+                status = hiprandGeneratePoisson(
+                    generator, static_cast<unsigned int *>(request.output_data), request.n,
+                    request.parameters[0]
+                );
+                break;
+        }
+        if(status != HIPRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+    }
+    return HIPRAND_STATUS_SUCCESS;
+}
+
+hiprandStatus_t HIPRANDAPI
+hiprandGeneratePoissonArray(hiprandGenerator_t generator,
+                            unsigned int * output_data,
+                            const double * lambdas, size_t n)
+{
+    (void) generator;
+    (void) output_data;
+    (void) lambdas;
+    (void) n;
+    return HIPRAND_STATUS_NOT_IMPLEMENTED;
+}
+
+hiprandStatus_t HIPRANDAPI
+hiprandGeneratorSave(hiprandGenerator_t generator, void * blob, size_t * blob_size)
+{
+    (void) generator;
+    (void) blob;
+    (void) blob_size;
+    return HIPRAND_STATUS_NOT_IMPLEMENTED;
+}
+
+hiprandStatus_t HIPRANDAPI
+hiprandGeneratorLoad(hiprandGenerator_t generator, const void * blob, size_t blob_size)
+{
+    (void) generator;
+    (void) blob;
+    (void) blob_size;
+    return HIPRAND_STATUS_NOT_IMPLEMENTED;
+}
+
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
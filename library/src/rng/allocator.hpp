@@ -0,0 +1,51 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_ALLOCATOR_H_
+#define ROCRAND_RNG_ALLOCATOR_H_
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+namespace rocrand_host {
+namespace detail {
+
+    // Internal device memory is allocated by the allocator set by
+    // rocrand_set_allocator() (see rocrand_allocator.cpp). Memory allocated
+    // in stream can be used in any stream after device_malloc() returns,
+    // device_free() is ordered after work submitted to stream.
+    hipError_t device_malloc(void ** ptr, size_t size, hipStream_t stream);
+
+    // Frees ptr allocated by device_malloc() by its allocator, NULL is ignored
+    hipError_t device_free(void * ptr, hipStream_t stream);
+
+    template<class T>
+    inline hipError_t device_malloc(T ** ptr, size_t size, hipStream_t stream)
+    {
+        void * p = NULL;
+        const hipError_t error = device_malloc(&p, size, stream);
+        *ptr = static_cast<T *>(p);
+        return error;
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_ALLOCATOR_H_
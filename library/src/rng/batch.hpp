@@ -0,0 +1,174 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_BATCH_H_
+#define ROCRAND_RNG_BATCH_H_
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "distribution/poisson.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+    // Requests of a batch kernel are passed in its arguments (so batches do not
+    // need device memory and can be captured into graphs), generate_batch()
+    // of generators launches a kernel for every batch_max_requests requests
+    constexpr unsigned int batch_max_requests = 40;
+
+    // Distributions of requests of batch kernels, the normal method
+    // and the Poisson method are selected on the host
+    enum batch_kernel_kind : unsigned int
+    {
+        batch_uniform_float,
+        batch_uniform_double,
+        batch_normal_float,
+        batch_normal_double,
+        batch_ziggurat_float,
+        batch_ziggurat_double,
+        batch_poisson,
+        batch_poisson_rejection
+    };
+
+    struct batch_kernel_request
+    {
+        batch_kernel_kind kind;
+        void * output;
+        size_t n;
+        double parameters[2];
+        // Tables of batch_poisson
+        rocrand_discrete_distribution_st tables;
+    };
+
+    struct batch_kernel_requests
+    {
+        unsigned int count;
+        batch_kernel_request requests[batch_max_requests];
+    };
+
+    static_assert(sizeof(batch_kernel_requests) <= 4096, "Kernel arguments are too large");
+
+    // Poisson distribution with tables of a batch request. Values of MRG32k3a
+    // are remapped to [0, UINT_MAX] as mrg_discrete_distribution does.
+    template<bool Mrg>
+    struct batch_poisson_distribution
+    {
+        static constexpr unsigned int input_width = 1;
+        static constexpr unsigned int output_width = 1;
+
+        rocrand_discrete_distribution_st tables;
+
+        __forceinline__ __host__ __device__
+        void operator()(const unsigned int (&input)[1], unsigned int (&output)[1]) const
+        {
+            const unsigned int v = Mrg
+                ? ::rocrand_device::detail::mrg_uniform_distribution_uint(input[0])
+                : input[0];
+            output[0] = ::rocrand_device::detail::discrete_alias(v, tables);
+        }
+    };
+
+    // Number of different lambdas of a batch that need Poisson tables
+    inline size_t batch_poisson_tables_count(const rocrand_batch_request * requests,
+                                             const size_t count)
+    {
+        size_t tables_count = 0;
+        for(size_t i = 0; i < count; i++)
+        {
+            const double lambda = requests[i].parameters[0];
+            if(requests[i].distribution != ROCRAND_BATCH_POISSON
+                || lambda >= poisson_rejection_distribution::lambda_threshold)
+            {
+                continue;
+            }
+            bool found = false;
+            for(size_t j = 0; j < i && !found; j++)
+            {
+                found = requests[j].distribution == ROCRAND_BATCH_POISSON
+                    && requests[j].parameters[0] == lambda;
+            }
+            tables_count += found ? 0 : 1;
+        }
+        return tables_count;
+    }
+
+    // Converts count (at most batch_max_requests) checked requests to requests
+    // of a batch kernel. Tables of a Poisson lambda are returned by
+    // poisson_tables(lambda), which throws rocrand_status on errors.
+    template<class PoissonTables>
+    rocrand_status make_batch_kernel_requests(const rocrand_batch_request * requests,
+                                              const size_t count,
+                                              const bool ziggurat,
+                                              PoissonTables poisson_tables,
+                                              batch_kernel_requests& kernel_requests)
+    {
+        kernel_requests.count = static_cast<unsigned int>(count);
+        for(size_t i = 0; i < count; i++)
+        {
+            const rocrand_batch_request& request = requests[i];
+            batch_kernel_request& kernel_request = kernel_requests.requests[i];
+            kernel_request.output = request.output_data;
+            kernel_request.n = request.n;
+            kernel_request.parameters[0] = request.parameters[0];
+            kernel_request.parameters[1] = request.parameters[1];
+            kernel_request.tables = rocrand_discrete_distribution_st();
+
+            switch(request.distribution)
+            {
+                case ROCRAND_BATCH_UNIFORM:
+                    kernel_request.kind = batch_uniform_float;
+                    break;
+                case ROCRAND_BATCH_UNIFORM_DOUBLE:
+                    kernel_request.kind = batch_uniform_double;
+                    break;
+                case ROCRAND_BATCH_NORMAL:
+                    kernel_request.kind = ziggurat ? batch_ziggurat_float : batch_normal_float;
+                    break;
+                case ROCRAND_BATCH_NORMAL_DOUBLE:
+                    kernel_request.kind = ziggurat ? batch_ziggurat_double : batch_normal_double;
+                    break;
+                case ROCRAND_BATCH_POISSON:
+                    if(request.parameters[0] >= poisson_rejection_distribution::lambda_threshold)
+                    {
+                        kernel_request.kind = batch_poisson_rejection;
+                        break;
+                    }
+                    kernel_request.kind = batch_poisson;
+                    try
+                    {
+                        kernel_request.tables = poisson_tables(request.parameters[0]);
+                    }
+                    catch(rocrand_status status)
+                    {
+                        return status;
+                    }
+                    break;
+                default:
+                    return ROCRAND_STATUS_OUT_OF_RANGE;
+            }
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_BATCH_H_
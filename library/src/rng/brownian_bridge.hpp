@@ -0,0 +1,97 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_BROWNIAN_BRIDGE_H_
+#define ROCRAND_RNG_BROWNIAN_BRIDGE_H_
+
+#include <cmath>
+#include <vector>
+
+#include <rocrand.h>
+
+namespace rocrand_host {
+namespace detail {
+
+// One step of a Brownian bridge: W(t[index]) is built from the normal value
+// of the step's dimension and the already built W(t[left]) and W(t[right]),
+// W(t[0]) = W(0) = 0 and index 0 of right means no right point.
+// Indices of times are 1-based, times[k - 1] is t[k].
+struct brownian_bridge_step
+{
+    unsigned int index;
+    unsigned int left;
+    unsigned int right;
+    float left_weight;
+    float right_weight;
+    float stddev;
+};
+
+// Builds the bridge of \p steps times: the first step is the last time,
+// then midpoints of the unbuilt ranges follow level by level, so low
+// (better distributed) quasi-random dimensions define the large-scale
+// shape of paths.
+inline rocrand_status build_brownian_bridge(const float * times, unsigned int steps,
+                                            std::vector<brownian_bridge_step>& bridge)
+{
+    if(times == NULL || steps == 0)
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    std::vector<double> t(steps + 1, 0.0);
+    for(unsigned int k = 1; k <= steps; k++)
+    {
+        t[k] = times[k - 1];
+        if(!std::isfinite(t[k]) || !(t[k] > t[k - 1]))
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    bridge.resize(steps);
+    std::vector<bool> built(steps + 1, false);
+    built[0] = true;
+    built[steps] = true;
+    bridge[0] = brownian_bridge_step { steps, 0, 0, 0.0f, 0.0f,
+                                       static_cast<float>(std::sqrt(t[steps])) };
+
+    unsigned int j = 1;
+    for(unsigned int i = 1; i < steps; i++)
+    {
+        // The next range of unbuilt times [j, k), its ends are built
+        while(built[j])
+            j = j == steps ? 1 : j + 1;
+        unsigned int k = j;
+        while(!built[k])
+            k++;
+        const unsigned int m = j + (k - 1 - j) / 2;
+        const unsigned int l = j - 1;
+        const double length = t[k] - t[l];
+        bridge[i] = brownian_bridge_step {
+            m, l, k,
+            static_cast<float>((t[k] - t[m]) / length),
+            static_cast<float>((t[m] - t[l]) / length),
+            static_cast<float>(std::sqrt((t[m] - t[l]) * (t[k] - t[m]) / length))
+        };
+        built[m] = true;
+        j = k + 1 > steps ? 1 : k + 1;
+    }
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_BROWNIAN_BRIDGE_H_
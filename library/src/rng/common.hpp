@@ -25,6 +25,12 @@
 #define FQUALIFIERS __forceinline__ __device__ __host__
 #endif
 
+#include <algorithm>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include <hip/hip_runtime.h>
+
 #include <rocrand_common.h>
 
 template<class T, unsigned int N>
@@ -33,4 +39,522 @@ struct alignas(sizeof(T) * N) aligned_vec_type
     T data[N];
 };
 
+namespace rocrand_host {
+namespace detail {
+
+    #if defined(__HIP_DEVICE_COMPILE__) && defined(__HIP_PLATFORM_HCC__)
+    typedef unsigned int nontemporal_uint4 __attribute__((ext_vector_type(4)));
+
+    // The largest type of a non-temporal store of a value of Size bytes
+    template<size_t Size>
+    struct nontemporal_word
+    {
+        typedef typename std::conditional<
+            Size % 16 == 0, nontemporal_uint4,
+            typename std::conditional<
+                Size % 8 == 0, unsigned long long,
+                typename std::conditional<
+                    Size % 4 == 0, unsigned int,
+                    typename std::conditional<
+                        Size % 2 == 0, unsigned short, unsigned char
+                    >::type
+                >::type
+            >::type
+        >::type type;
+    };
+    #endif
+
+    // Stores value to *ptr, with non-temporal stores if streaming is true
+    // (ROCRAND_STORE_POLICY_STREAMING): values are written to memory without
+    // keeping them in caches. Non-temporal stores are used only by device
+    // code for AMD GPUs.
+    template<class V>
+    __forceinline__ __device__ __host__
+    void store_vec(V * ptr, const V& value, const bool streaming)
+    {
+        #if defined(__HIP_DEVICE_COMPILE__) && defined(__HIP_PLATFORM_HCC__)
+        if(streaming)
+        {
+            typedef typename nontemporal_word<sizeof(V)>::type word_type;
+            const word_type * words = reinterpret_cast<const word_type *>(&value);
+            word_type * ptr_words = reinterpret_cast<word_type *>(ptr);
+            for(unsigned int i = 0; i < sizeof(V) / sizeof(word_type); i++)
+            {
+                __builtin_nontemporal_store(words[i], ptr_words + i);
+            }
+            return;
+        }
+        #else
+        (void)streaming;
+        #endif
+        *ptr = value;
+    }
+
+    // Calls function(i) for all i in [0, size) using all available host threads.
+    // Every thread processes a contiguous range of indices.
+    template<class Function>
+    inline void host_parallel_for(const size_t size, Function function)
+    {
+        const size_t hardware_threads =
+            std::max<size_t>(1, std::thread::hardware_concurrency());
+        const size_t threads = std::min(hardware_threads, size);
+        if(threads <= 1)
+        {
+            for(size_t i = 0; i < size; i++)
+            {
+                function(i);
+            }
+            return;
+        }
+
+        const size_t chunk = (size + threads - 1) / threads;
+        std::vector<std::thread> workers;
+        workers.reserve(threads);
+        for(size_t begin = 0; begin < size; begin += chunk)
+        {
+            const size_t end = std::min(size, begin + chunk);
+            workers.emplace_back(
+                [begin, end, &function]()
+                {
+                    for(size_t i = begin; i < end; i++)
+                    {
+                        function(i);
+                    }
+                }
+            );
+        }
+        for(std::thread& worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    // Work of a stream that is being captured into a graph is recorded and
+    // not executed, so it must not allocate memory or wait for the device
+    inline bool is_stream_capturing(hipStream_t stream)
+    {
+        hipStreamCaptureStatus status = hipStreamCaptureStatusNone;
+        if(hipStreamIsCapturing(stream, &status) != hipSuccess)
+            return false;
+        return status != hipStreamCaptureStatusNone;
+    }
+
+    // Engines of XORWOW and MRG32k3a generators are stored as structures of
+    // arrays of engines_size engines (see rocrand_load_state_soa()), so loads
+    // and stores of consecutive threads' engines are coalesced
+    template<class Engine>
+    __forceinline__ __device__ __host__
+    Engine load_engine_soa(const Engine * engines,
+                           const size_t engines_size,
+                           const size_t engine_id)
+    {
+        return ::rocrand_device::detail::load_state_soa<Engine>(engines, engines_size, engine_id);
+    }
+
+    template<class Engine>
+    __forceinline__ __device__ __host__
+    void store_engine_soa(Engine * engines,
+                          const size_t engines_size,
+                          const size_t engine_id,
+                          const Engine& engine)
+    {
+        ::rocrand_device::detail::store_state_soa(engines, engines_size, engine_id, engine);
+    }
+
+    // Seed of the engine_id-th engine in ROCRAND_ORDERING_PSEUDO_SEEDED ordering:
+    // SplitMix64 of the generator's seed and engine_id, so engines of
+    // a generator start at unrelated points without skipping ahead
+    __forceinline__ __device__ __host__
+    unsigned long long seeded_engine_seed(const unsigned long long seed,
+                                          const unsigned long long engine_id)
+    {
+        unsigned long long z = seed + (engine_id + 1) * 0x9E3779B97F4A7C15ULL;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    // Creates the engine_id-th engine of XORWOW and MRG32k3a generators:
+    // the engine_id-th subsequence of seed (default ordering), or the first
+    // subsequence of its own seed (seeded ordering)
+    template<class Engine>
+    __forceinline__ __device__ __host__
+    Engine create_engine(const unsigned long long seed,
+                         const unsigned long long engine_id,
+                         const unsigned long long offset,
+                         const bool seeded)
+    {
+        if(seeded)
+        {
+            return Engine(seeded_engine_seed(seed, engine_id), 0, offset);
+        }
+        return Engine(seed, engine_id, offset);
+    }
+
+    // Work of one thread of split_engines_kernel (rocrand_generator_split()):
+    // the engine_id-th engine of the i-th child is the engine_id-th engine
+    // skipped ahead by (i + 1) * engines_size subsequences, then the engine
+    // skips ahead past all children, so it does not overlap them after
+    // the split (and children of later splits do not overlap them either)
+    template<class Engine>
+    __forceinline__ __device__ __host__
+    void split_engine(Engine * engines,
+                      Engine * const * children,
+                      const unsigned int children_count,
+                      const size_t engines_size,
+                      const size_t engine_id)
+    {
+        Engine engine = load_engine_soa(engines, engines_size, engine_id);
+        for(unsigned int i = 0; i < children_count; i++)
+        {
+            engine.discard_subsequence(engines_size);
+            store_engine_soa(children[i], engines_size, engine_id, engine);
+        }
+        engine.discard_subsequence(engines_size);
+        store_engine_soa(engines, engines_size, engine_id, engine);
+    }
+
+    // Generates values engine_id, engine_id + stride, ... of n values to data
+    // with engine (values of output_width are stored together, see store_vec()
+    // for streaming). This is the work of one thread of generate_kernel of
+    // XORWOW and MRG32k3a generators, it is also used by their batch kernels,
+    // so both produce the same values.
+    template<class Engine, class T, class Distribution>
+    __forceinline__ __device__ __host__
+    void generate_engine_values(Engine& engine,
+                                const unsigned int engine_id,
+                                const unsigned int stride,
+                                T * data, const size_t n,
+                                Distribution distribution,
+                                const bool streaming = false)
+    {
+        constexpr unsigned int input_width = Distribution::input_width;
+        constexpr unsigned int output_width = Distribution::output_width;
+
+        using vec_type = aligned_vec_type<T, output_width>;
+
+        size_t index = engine_id;
+
+        unsigned int input[input_width];
+        T output[output_width];
+
+        const uintptr_t uintptr = reinterpret_cast<uintptr_t>(data);
+        const size_t misalignment =
+            (
+                output_width - uintptr / sizeof(T) % output_width
+            ) % output_width;
+        const unsigned int head_size = n < misalignment ? n : misalignment;
+        const unsigned int tail_size = (n - head_size) % output_width;
+        const size_t vec_n = (n - head_size) / output_width;
+
+        vec_type * vec_data = reinterpret_cast<vec_type *>(data + misalignment);
+        while(index < vec_n)
+        {
+            for(unsigned int i = 0; i < input_width; i++)
+            {
+                input[i] = engine();
+            }
+            distribution(input, output);
+
+            store_vec(vec_data + index, *reinterpret_cast<vec_type *>(output), streaming);
+            // Next position
+            index += stride;
+        }
+
+        // Check if we need to save head and tail.
+        // Those numbers should be generated by the thread that would
+        // save next vec_type.
+        if(output_width > 1 && index == vec_n)
+        {
+            // If data is not aligned by sizeof(vec_type)
+            if(head_size > 0)
+            {
+                for(unsigned int i = 0; i < input_width; i++)
+                {
+                    input[i] = engine();
+                }
+                distribution(input, output);
+
+                for(unsigned int o = 0; o < output_width; o++)
+                {
+                    if(o < head_size)
+                    {
+                        data[o] = output[o];
+                    }
+                }
+            }
+
+            if(tail_size > 0)
+            {
+                for(unsigned int i = 0; i < input_width; i++)
+                {
+                    input[i] = engine();
+                }
+                distribution(input, output);
+
+                for(unsigned int o = 0; o < output_width; o++)
+                {
+                    if(o < tail_size)
+                    {
+                        data[n - tail_size + o] = output[o];
+                    }
+                }
+            }
+        }
+    }
+
+    // Number of consecutive iterations of generate kernels that a block stores
+    // together as 16-byte vectors (see store_block_iterations): 4-byte
+    // and 8-byte values that are generated one by one, otherwise 1
+    // (values are stored as generated).
+    template<class T, class Distribution>
+    struct store_iterations
+    {
+        static constexpr unsigned int value =
+            Distribution::output_width == 1 && (sizeof(T) == 4 || sizeof(T) == 8)
+                ? 16 / sizeof(T) : 1;
+    };
+
+    // Dynamic shared memory required by generate kernels that use
+    // store_block_iterations with blocks of block_size threads
+    template<class T, class Distribution>
+    inline size_t generate_shared_bytes(const unsigned int block_size)
+    {
+        constexpr unsigned int iterations = store_iterations<T, Distribution>::value;
+        return iterations > 1 ? static_cast<size_t>(iterations) * block_size * sizeof(T) : 0;
+    }
+
+    // Returns true if the block can use store_block_iterations for data
+    template<class T, class Distribution>
+    __forceinline__ __device__
+    bool can_store_block_iterations(const T * data, const unsigned int block_size)
+    {
+        constexpr unsigned int iterations = store_iterations<T, Distribution>::value;
+        return iterations > 1
+            && block_size % iterations == 0
+            && reinterpret_cast<uintptr_t>(data) % (iterations * sizeof(T)) == 0;
+    }
+
+    // Stores values of Iterations consecutive iterations of the block:
+    // values[r] of the thread goes to data[r * stride + hipThreadIdx_x].
+    // The values are exchanged in shared (Iterations * hipBlockDim_x values),
+    // so every thread stores Iterations consecutive values of one iteration as
+    // one 16-byte vector instead of Iterations 4-byte or 8-byte stores.
+    // Positions of values do not change. All threads of the block must call it.
+    template<unsigned int Iterations, class T>
+    __forceinline__ __device__
+    void store_block_iterations(T * data,
+                                const size_t stride,
+                                const T (&values)[Iterations],
+                                T * shared,
+                                const bool streaming)
+    {
+        using vec_type = aligned_vec_type<T, Iterations>;
+
+        const unsigned int tid = hipThreadIdx_x;
+        const unsigned int block_size = hipBlockDim_x;
+        for(unsigned int r = 0; r < Iterations; r++)
+        {
+            shared[r * block_size + tid] = values[r];
+        }
+        __syncthreads();
+
+        const unsigned int vecs = block_size / Iterations;
+        const unsigned int r = tid / vecs;
+        const unsigned int j = tid % vecs * Iterations;
+        store_vec(
+            reinterpret_cast<vec_type *>(data + r * stride + j),
+            *reinterpret_cast<const vec_type *>(shared + r * block_size + j),
+            streaming
+        );
+        // shared is reused by the next call
+        __syncthreads();
+    }
+
+    // Device version of generate_engine_values(): the same values are stored
+    // to the same positions, but while all positions of Iterations consecutive
+    // iterations of the block are in [0, n), they are stored by
+    // store_block_iterations. All threads of the block must call it, the kernel
+    // is launched with generate_shared_bytes() of dynamic shared memory.
+    template<class Engine, class T, class Distribution>
+    __forceinline__ __device__
+    void generate_engine_values_block(Engine& engine,
+                                      const unsigned int engine_id,
+                                      const unsigned int stride,
+                                      T * data, const size_t n,
+                                      Distribution distribution,
+                                      const bool streaming)
+    {
+        constexpr unsigned int input_width = Distribution::input_width;
+        constexpr unsigned int iterations = store_iterations<T, Distribution>::value;
+
+        // Values of the rest of iterations are generated by generate_engine_values
+        size_t done = 0;
+        if(can_store_block_iterations<T, Distribution>(data, hipBlockDim_x))
+        {
+            extern __shared__ uint4 generate_shared[];
+            T * shared = reinterpret_cast<T *>(generate_shared);
+
+            const size_t block_start = engine_id - hipThreadIdx_x;
+            while(block_start + done + (iterations - 1) * static_cast<size_t>(stride)
+                  + hipBlockDim_x <= n)
+            {
+                unsigned int input[input_width];
+                T output[Distribution::output_width];
+                T values[iterations];
+                for(unsigned int r = 0; r < iterations; r++)
+                {
+                    for(unsigned int i = 0; i < input_width; i++)
+                    {
+                        input[i] = engine();
+                    }
+                    distribution(input, output);
+                    values[r] = output[0];
+                }
+                store_block_iterations(
+                    data + block_start + done, stride, values, shared, streaming
+                );
+                done += iterations * static_cast<size_t>(stride);
+            }
+        }
+        generate_engine_values(
+            engine, engine_id, stride,
+            data + done, n > done ? n - done : 0,
+            distribution, streaming
+        );
+    }
+
+    // Generates height rows of width values, rows start pitch values apart
+    // (rocrand_generate_uniform_2d() etc.). Rows get the same values as height
+    // consecutive generate_engine_values calls of width values, the layout
+    // of every row (head, vectors and tail) depends only on its address.
+    template<class Engine, class T, class Distribution>
+    __forceinline__ __device__ __host__
+    void generate_engine_values_2d(Engine& engine,
+                                   const unsigned int engine_id,
+                                   const unsigned int stride,
+                                   T * data, const size_t pitch,
+                                   const size_t width, const size_t height,
+                                   Distribution distribution)
+    {
+        for(size_t row = 0; row < height; row++)
+        {
+            generate_engine_values(
+                engine, engine_id, stride, data + row * pitch, width, distribution
+            );
+        }
+    }
+
+    // Device version of generate_engine_values_2d(), rows are stored by
+    // generate_engine_values_block. All threads of the block must call it.
+    template<class Engine, class T, class Distribution>
+    __forceinline__ __device__
+    void generate_engine_values_block_2d(Engine& engine,
+                                         const unsigned int engine_id,
+                                         const unsigned int stride,
+                                         T * data, const size_t pitch,
+                                         const size_t width, const size_t height,
+                                         Distribution distribution,
+                                         const bool streaming)
+    {
+        for(size_t row = 0; row < height; row++)
+        {
+            generate_engine_values_block(
+                engine, engine_id, stride, data + row * pitch, width, distribution, streaming
+            );
+        }
+    }
+
+    // generate_kernel of a substream (rocrand_set_substreams()): the grid
+    // uses engines [first_engine, first_engine + grid size) of engines_size
+    // SoA engines, values are distributed among them as among all engines
+    // of a generate_kernel launch with the grid size
+    template<class Engine, class T, class Distribution>
+    __global__
+    void generate_substream_kernel(Engine * engines,
+                                   const size_t engines_size,
+                                   const size_t first_engine,
+                                   T * data, const size_t n,
+                                   Distribution distribution,
+                                   const bool streaming)
+    {
+        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        Engine engine = load_engine_soa(engines, engines_size, first_engine + engine_id);
+        generate_engine_values_block(engine, engine_id, stride, data, n, distribution, streaming);
+        store_engine_soa(engines, engines_size, first_engine + engine_id, engine);
+    }
+
+    // Pointers passed to store_pointers_kernel as its argument
+    template<class T>
+    struct pointers_batch
+    {
+        static const unsigned int max_size = 32;
+        T * pointers[max_size];
+    };
+
+    template<class T>
+    __global__
+    void store_pointers_kernel(T ** dst, const unsigned int size, const pointers_batch<T> batch)
+    {
+        const unsigned int i = hipThreadIdx_x;
+        if(i < size)
+            dst[i] = batch.pointers[i];
+    }
+
+    // Stores size pointers of host memory src to device memory dst in stream.
+    // Kernel arguments are copied when the kernel is launched, so unlike
+    // hipMemcpyAsync() src can be released after return without waiting
+    // for the stream.
+    template<class T>
+    inline hipError_t store_pointers(T ** dst, T * const * src, const size_t size,
+                                     hipStream_t stream)
+    {
+        const unsigned int max_size = pointers_batch<T>::max_size;
+        for(size_t first = 0; first < size; first += max_size)
+        {
+            const unsigned int batch_size =
+                static_cast<unsigned int>(std::min<size_t>(size - first, max_size));
+            pointers_batch<T> batch = {};
+            std::copy(src + first, src + first + batch_size, batch.pointers);
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(store_pointers_kernel<T>),
+                dim3(1), dim3(max_size), 0, stream,
+                dst + first, batch_size, batch
+            );
+            const hipError_t error = hipPeekAtLastError();
+            if(error != hipSuccess)
+                return error;
+        }
+        return hipSuccess;
+    }
+
+    inline __device__ unsigned int warp_reduce_min(unsigned int val, int size) {
+      for (int offset = size/2; offset > 0; offset /= 2) {
+        #if defined(__HIP_PLATFORM_NVCC__) && __CUDACC_VER_MAJOR__ >= 9
+        unsigned int temp = __shfl_xor_sync(0xffffffff, (int)val, offset);
+        #else
+        unsigned int temp = __shfl_xor((int)val, offset);
+        #endif
+        val = (temp < val) ? temp : val;
+      }
+      return val;
+    }
+
+    inline __device__ unsigned int warp_reduce_max(unsigned int val, int size) {
+      for (int offset = size/2; offset > 0; offset /= 2) {
+        #if defined(__HIP_PLATFORM_NVCC__) && __CUDACC_VER_MAJOR__ >= 9
+        unsigned int temp = __shfl_xor_sync(0xffffffff, (int)val, offset);
+        #else
+        unsigned int temp = __shfl_xor((int)val, offset);
+        #endif
+        val = (temp > val) ? temp : val;
+      }
+      return val;
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
 #endif // ROCRAND_RNG_COMMON_H_
@@ -0,0 +1,1396 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_COUNTER_BASED64_H_
+#define ROCRAND_RNG_COUNTER_BASED64_H_
+
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime.h>
+
+#include <rocrand.h>
+
+#include "common.hpp"
+#include "generator_type.hpp"
+#include "engines_cache.hpp"
+#include "device_engines.hpp"
+#include "distributions.hpp"
+
+// Counter-based generators with 64-bit words: PHILOX4_64_10, THREEFRY2_64_20
+// and THREEFRY4_64_20, and PHILOX4_32_7 (Philox4x32 with 7 rounds).
+// Engines are shared by ThreadsPerEngine threads that use every
+// ThreadsPerEngine-th state of the engine, like in rocrand_philox4x32_10,
+// but one state of these engines has Engine::state_values (4 or 8) 32-bit values.
+
+namespace rocrand_host {
+namespace detail {
+namespace counter_based64 {
+
+    __forceinline__ __device__ __host__
+    void split_words(const uint4& words, unsigned int (&values)[4])
+    {
+        values[0] = words.x;
+        values[1] = words.y;
+        values[2] = words.z;
+        values[3] = words.w;
+    }
+
+    __forceinline__ __device__ __host__
+    void split_words(const ulonglong2& words, unsigned int (&values)[4])
+    {
+        values[0] = static_cast<unsigned int>(words.x);
+        values[1] = static_cast<unsigned int>(words.x >> 32);
+        values[2] = static_cast<unsigned int>(words.y);
+        values[3] = static_cast<unsigned int>(words.y >> 32);
+    }
+
+    __forceinline__ __device__ __host__
+    void split_words(const ulonglong4& words, unsigned int (&values)[8])
+    {
+        values[0] = static_cast<unsigned int>(words.x);
+        values[1] = static_cast<unsigned int>(words.x >> 32);
+        values[2] = static_cast<unsigned int>(words.y);
+        values[3] = static_cast<unsigned int>(words.y >> 32);
+        values[4] = static_cast<unsigned int>(words.z);
+        values[5] = static_cast<unsigned int>(words.z >> 32);
+        values[6] = static_cast<unsigned int>(words.w);
+        values[7] = static_cast<unsigned int>(words.w >> 32);
+    }
+
+    struct philox4x64_10_device_engine : public ::rocrand_device::philox4x64_10_engine
+    {
+        typedef ::rocrand_device::philox4x64_10_engine base_type;
+        // Number of 32-bit values in one state
+        static constexpr unsigned int state_values = 8;
+
+        __forceinline__ __device__ __host__
+        philox4x64_10_device_engine() { }
+
+        __forceinline__ __device__ __host__
+        philox4x64_10_device_engine(const unsigned long long seed,
+                                    const unsigned long long subsequence,
+                                    const unsigned long long offset)
+            : base_type(seed, subsequence, offset)
+        {
+
+        }
+
+        __forceinline__ __device__ __host__
+        ~philox4x64_10_device_engine () {}
+
+        // Returns values of the current state and skips leap states
+        __forceinline__ __device__ __host__
+        void next_leap(unsigned int leap, unsigned int (&values)[state_values])
+        {
+            split_words(m_state.result, values);
+            this->discard_state(leap);
+            m_state.result = this->ten_rounds(m_state.counter, m_state.key);
+        }
+
+        // Returns values of the current state
+        __forceinline__ __device__ __host__
+        void current_values(unsigned int (&values)[state_values]) const
+        {
+            split_words(m_state.result, values);
+        }
+
+        // m_state from base class
+    };
+
+    struct philox4x32_7_device_engine : public ::rocrand_device::philox4x32_7_engine
+    {
+        typedef ::rocrand_device::philox4x32_7_engine base_type;
+        // Number of 32-bit values in one state
+        static constexpr unsigned int state_values = 4;
+
+        __forceinline__ __device__ __host__
+        philox4x32_7_device_engine() { }
+
+        __forceinline__ __device__ __host__
+        philox4x32_7_device_engine(const unsigned long long seed,
+                                   const unsigned long long subsequence,
+                                   const unsigned long long offset)
+            : base_type(seed, subsequence, offset)
+        {
+
+        }
+
+        __forceinline__ __device__ __host__
+        ~philox4x32_7_device_engine () {}
+
+        // Returns values of the current state and skips leap states
+        __forceinline__ __device__ __host__
+        void next_leap(unsigned int leap, unsigned int (&values)[state_values])
+        {
+            split_words(m_state.result, values);
+            this->discard_state(leap);
+            m_state.result = this->rounds(m_state.counter, m_state.key);
+        }
+
+        // Returns values of the current state
+        __forceinline__ __device__ __host__
+        void current_values(unsigned int (&values)[state_values]) const
+        {
+            split_words(m_state.result, values);
+        }
+
+        // m_state from base class
+    };
+
+    struct threefry2x64_20_device_engine : public ::rocrand_device::threefry2x64_20_engine
+    {
+        typedef ::rocrand_device::threefry2x64_20_engine base_type;
+        // Number of 32-bit values in one state
+        static constexpr unsigned int state_values = 4;
+
+        __forceinline__ __device__ __host__
+        threefry2x64_20_device_engine() { }
+
+        __forceinline__ __device__ __host__
+        threefry2x64_20_device_engine(const unsigned long long seed,
+                                      const unsigned long long subsequence,
+                                      const unsigned long long offset)
+            : base_type(seed, subsequence, offset)
+        {
+
+        }
+
+        __forceinline__ __device__ __host__
+        ~threefry2x64_20_device_engine () {}
+
+        // Returns values of the current state and skips leap states
+        __forceinline__ __device__ __host__
+        void next_leap(unsigned int leap, unsigned int (&values)[state_values])
+        {
+            split_words(m_state.result, values);
+            this->discard_state(leap);
+            m_state.result = this->twenty_rounds(m_state.counter, m_state.key);
+        }
+
+        // Returns values of the current state
+        __forceinline__ __device__ __host__
+        void current_values(unsigned int (&values)[state_values]) const
+        {
+            split_words(m_state.result, values);
+        }
+
+        // m_state from base class
+    };
+
+    struct threefry4x64_20_device_engine : public ::rocrand_device::threefry4x64_20_engine
+    {
+        typedef ::rocrand_device::threefry4x64_20_engine base_type;
+        // Number of 32-bit values in one state
+        static constexpr unsigned int state_values = 8;
+
+        __forceinline__ __device__ __host__
+        threefry4x64_20_device_engine() { }
+
+        __forceinline__ __device__ __host__
+        threefry4x64_20_device_engine(const unsigned long long seed,
+                                      const unsigned long long subsequence,
+                                      const unsigned long long offset)
+            : base_type(seed, subsequence, offset)
+        {
+
+        }
+
+        __forceinline__ __device__ __host__
+        ~threefry4x64_20_device_engine () {}
+
+        // Returns values of the current state and skips leap states
+        __forceinline__ __device__ __host__
+        void next_leap(unsigned int leap, unsigned int (&values)[state_values])
+        {
+            split_words(m_state.result, values);
+            this->discard_state(leap);
+            m_state.result = this->twenty_rounds(m_state.counter, m_state.key);
+        }
+
+        // Returns values of the current state
+        __forceinline__ __device__ __host__
+        void current_values(unsigned int (&values)[state_values]) const
+        {
+            split_words(m_state.result, values);
+        }
+
+        // m_state from base class
+    };
+
+    template<rocrand_rng_type RngType>
+    struct traits;
+
+    template<>
+    struct traits<ROCRAND_RNG_PSEUDO_PHILOX4_64_10>
+    {
+        typedef philox4x64_10_device_engine engine_type;
+    };
+
+    template<>
+    struct traits<ROCRAND_RNG_PSEUDO_PHILOX4_32_7>
+    {
+        typedef philox4x32_7_device_engine engine_type;
+    };
+
+    template<>
+    struct traits<ROCRAND_RNG_PSEUDO_THREEFRY2_64_20>
+    {
+        typedef threefry2x64_20_device_engine engine_type;
+    };
+
+    template<>
+    struct traits<ROCRAND_RNG_PSEUDO_THREEFRY4_64_20>
+    {
+        typedef threefry4x64_20_device_engine engine_type;
+    };
+
+    template<class Engine>
+    __global__
+    void init_engines_kernel(Engine * engines,
+                             const size_t engines_size,
+                             const unsigned long long seed,
+                             const unsigned long long offset)
+    {
+        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        if(engine_id < engines_size)
+            engines[engine_id] = Engine(seed, engine_id, offset);
+    }
+
+    // Returns values of States consecutive states of the engine and skips
+    // states of other threads of the engine (they use the next
+    // States * (ThreadsPerEngine - 1) states)
+    template<unsigned int ThreadsPerEngine, unsigned int States, class Engine>
+    __forceinline__ __device__ __host__
+    void next_leap_values(Engine& engine,
+                          unsigned int (&values)[Engine::state_values * States])
+    {
+        constexpr unsigned int state_values = Engine::state_values;
+        unsigned int v[state_values];
+        for(unsigned int s = 0; s < States; s++)
+        {
+            engine.next_leap(
+                s + 1 < States ? 1 : ThreadsPerEngine * States - (States - 1), v
+            );
+            for(unsigned int i = 0; i < state_values; i++)
+            {
+                values[state_values * s + i] = v[i];
+            }
+        }
+    }
+
+    // Work of one thread of generate_kernel, thread_id-th thread uses
+    // (thread_id / ThreadsPerEngine)-th engine. Returns the index of the next
+    // vector the thread would save (see philox4x32_10.hpp).
+    template<unsigned int ThreadsPerEngine, class Engine, class T, class Distribution>
+    __forceinline__ __device__ __host__
+    size_t generate_thread(Engine& engine,
+                           const unsigned int thread_id,
+                           const unsigned int stride,
+                           T * data, const size_t n,
+                           Distribution distribution,
+                           const bool streaming = false)
+    {
+        constexpr unsigned int state_values = Engine::state_values;
+        constexpr unsigned int input_width = Distribution::input_width;
+        constexpr unsigned int output_width = Distribution::output_width;
+
+        static_assert(
+            (state_values % input_width == 0 && input_width <= state_values)
+                || input_width % state_values == 0,
+            "Incorrect input_width"
+        );
+        // Wide distributions use several states per output
+        constexpr unsigned int states = input_width > state_values ? input_width / state_values : 1;
+        constexpr unsigned int output_per_thread =
+            input_width > state_values ? 1 : state_values / input_width;
+        constexpr unsigned int full_output_width = output_per_thread * output_width;
+
+        using vec_type = aligned_vec_type<T, output_per_thread * output_width>;
+
+        size_t index = thread_id;
+
+        if(thread_id%ThreadsPerEngine > 0)
+        {
+            // Skips states of thread_id%ThreadsPerEngine threads
+            engine.discard(
+                static_cast<unsigned long long>(state_values) * states * (thread_id%ThreadsPerEngine)
+            );
+        }
+
+        unsigned int vs[state_values * states];
+        unsigned int input[input_width];
+        T output[output_per_thread][output_width];
+
+        const uintptr_t uintptr = reinterpret_cast<uintptr_t>(data);
+        const size_t misalignment =
+            (
+                full_output_width - uintptr / sizeof(T) % full_output_width
+            ) % full_output_width;
+        const unsigned int head_size = n < misalignment ? n : misalignment;
+        const unsigned int tail_size = (n - head_size) % full_output_width;
+        const size_t vec_n = (n - head_size) / full_output_width;
+
+        // Save multiple values as one vec_type
+        vec_type * vec_data = reinterpret_cast<vec_type *>(data + misalignment);
+        while(index < vec_n)
+        {
+            next_leap_values<ThreadsPerEngine, states>(engine, vs);
+            for(unsigned int s = 0; s < output_per_thread; s++)
+            {
+                for(unsigned int i = 0; i < input_width; i++)
+                {
+                    input[i] = vs[s * input_width + i];
+                }
+                distribution(input, output[s]);
+            }
+            store_vec(vec_data + index, *reinterpret_cast<vec_type *>(output), streaming);
+            // Next position
+            index += stride;
+        }
+
+        // Check if we need to save head and tail.
+        // Those numbers should be generated by the thread that would
+        // save next vec_type.
+        if(index == vec_n)
+        {
+            // If data is not aligned by sizeof(vec_type)
+            if(head_size > 0)
+            {
+                next_leap_values<ThreadsPerEngine, states>(engine, vs);
+                for(unsigned int s = 0; s < output_per_thread; s++)
+                {
+                    for(unsigned int i = 0; i < input_width; i++)
+                    {
+                        input[i] = vs[s * input_width + i];
+                    }
+                    distribution(input, output[s]);
+
+                    for(unsigned int o = 0; o < output_width; o++)
+                    {
+                        if(s * output_width + o < head_size)
+                        {
+                            data[s * output_width + o] = output[s][o];
+                        }
+                    }
+                }
+            }
+
+            if(tail_size > 0)
+            {
+                next_leap_values<ThreadsPerEngine, states>(engine, vs);
+                for(unsigned int s = 0; s < output_per_thread; s++)
+                {
+                    for(unsigned int i = 0; i < input_width; i++)
+                    {
+                        input[i] = vs[s * input_width + i];
+                    }
+                    distribution(input, output[s]);
+
+                    for(unsigned int o = 0; o < output_width; o++)
+                    {
+                        if(s * output_width + o < tail_size)
+                        {
+                            data[n - tail_size + s * output_width + o] = output[s][o];
+                        }
+                    }
+                }
+            }
+        }
+
+        return index;
+    }
+
+    template<unsigned int ThreadsPerEngine, class Engine, class T, class Distribution>
+    __global__
+    void generate_kernel(Engine * engines,
+                         T * data, const size_t n,
+                         Distribution distribution,
+                         const bool streaming)
+    {
+        const unsigned int thread_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int engine_id = thread_id/ThreadsPerEngine;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        // Load device engine
+        Engine engine = engines[engine_id];
+
+        const size_t index = generate_thread<ThreadsPerEngine>(
+            engine, thread_id, stride, data, n, distribution, streaming
+        );
+
+        // Find thread with the smallest state of the engine which id is engine_id
+        unsigned int index_min = warp_reduce_min(index, ThreadsPerEngine);
+        const bool smallest_state = (index == index_min);
+
+        // Save engine
+        if(smallest_state)
+            engines[engine_id] = engine;
+    }
+
+    // generate_kernel for discrete distributions with small packed alias
+    // tables (see discrete_shared_capacity)
+    template<unsigned int ThreadsPerEngine, class Engine, class Distribution>
+    __global__
+    void generate_discrete_shared_kernel(Engine * engines,
+                                         unsigned int * data, const size_t n,
+                                         Distribution distribution)
+    {
+        __shared__ unsigned long long table[discrete_shared_capacity];
+        distribution.load_shared(table);
+
+        const unsigned int thread_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int engine_id = thread_id/ThreadsPerEngine;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        Engine engine = engines[engine_id];
+
+        const size_t index = generate_thread<ThreadsPerEngine>(
+            engine, thread_id, stride, data, n, distribution
+        );
+
+        unsigned int index_min = warp_reduce_min(index, ThreadsPerEngine);
+        const bool smallest_state = (index == index_min);
+
+        if(smallest_state)
+            engines[engine_id] = engine;
+    }
+
+    // Host-side equivalent of ThreadsPerEngine threads of generate_kernel
+    // that use engine_id-th engine.
+    template<unsigned int ThreadsPerEngine, class Engine, class T, class Distribution>
+    inline
+    void generate_engine_host(Engine * engines,
+                              const unsigned int engine_id,
+                              const unsigned int stride,
+                              T * data, const size_t n,
+                              Distribution distribution)
+    {
+        Engine smallest_state_engine;
+        size_t index_min = 0;
+        for(unsigned int i = 0; i < ThreadsPerEngine; i++)
+        {
+            Engine engine = engines[engine_id];
+            const size_t index = generate_thread<ThreadsPerEngine>(
+                engine, engine_id * ThreadsPerEngine + i, stride, data, n, distribution
+            );
+            if(i == 0 || index < index_min)
+            {
+                index_min = index;
+                smallest_state_engine = engine;
+            }
+        }
+        engines[engine_id] = smallest_state_engine;
+    }
+
+    // Returns values of the states of one thread of the engine: the thread
+    // uses every ThreadsPerEngine-th state of the engine and counts used states.
+    template<unsigned int ThreadsPerEngine, class Engine>
+    struct leap_source
+    {
+        Engine& engine;
+        unsigned int values[Engine::state_values];
+        unsigned int position;
+        unsigned int states;
+
+        __forceinline__ __device__ __host__
+        unsigned int operator()()
+        {
+            if(position == Engine::state_values)
+            {
+                engine.next_leap(ThreadsPerEngine, values);
+                position = 0;
+                states++;
+            }
+            return values[position++];
+        }
+    };
+
+    // Work of one thread of generate_rejection_kernel, returns the number
+    // of states used by the thread (see philox4x32_10.hpp).
+    template<unsigned int ThreadsPerEngine, class Engine, class T, class Distribution>
+    __forceinline__ __device__ __host__
+    unsigned int generate_rejection_thread(Engine& engine,
+                                           const unsigned int thread_id,
+                                           const unsigned int stride,
+                                           T * data, const size_t n,
+                                           Distribution distribution)
+    {
+        if(thread_id%ThreadsPerEngine > 0)
+        {
+            // Skips thread_id%ThreadsPerEngine states
+            engine.discard(Engine::state_values * (thread_id%ThreadsPerEngine));
+        }
+
+        leap_source<ThreadsPerEngine, Engine> source = { engine, { }, Engine::state_values, 0 };
+        for(size_t index = thread_id; index < n; index += stride)
+        {
+            data[index] = distribution(source, index);
+        }
+        return source.states;
+    }
+
+    // Threads of the engine use different numbers of states, the engine is
+    // advanced past the states of the thread that used the most of them
+    template<unsigned int ThreadsPerEngine, class Engine, class T, class Distribution>
+    __global__
+    void generate_rejection_kernel(Engine * engines,
+                                   T * data, const size_t n,
+                                   Distribution distribution)
+    {
+        const unsigned int thread_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int engine_id = thread_id/ThreadsPerEngine;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        Engine engine = engines[engine_id];
+        const unsigned int states = generate_rejection_thread<ThreadsPerEngine>(
+            engine, thread_id, stride, data, n, distribution
+        );
+        const unsigned int max_states = warp_reduce_max(states, ThreadsPerEngine);
+
+        if(thread_id%ThreadsPerEngine == 0)
+        {
+            engine = engines[engine_id];
+            engine.discard(
+                static_cast<unsigned long long>(Engine::state_values) * ThreadsPerEngine * max_states
+            );
+            engines[engine_id] = engine;
+        }
+    }
+
+    // Host-side equivalent of ThreadsPerEngine threads of
+    // generate_rejection_kernel that use engine_id-th engine.
+    template<unsigned int ThreadsPerEngine, class Engine, class T, class Distribution>
+    inline
+    void generate_rejection_engine_host(Engine * engines,
+                                        const unsigned int engine_id,
+                                        const unsigned int stride,
+                                        T * data, const size_t n,
+                                        Distribution distribution)
+    {
+        unsigned int max_states = 0;
+        for(unsigned int i = 0; i < ThreadsPerEngine; i++)
+        {
+            Engine engine = engines[engine_id];
+            const unsigned int states = generate_rejection_thread<ThreadsPerEngine>(
+                engine, engine_id * ThreadsPerEngine + i, stride, data, n, distribution
+            );
+            max_states = states > max_states ? states : max_states;
+        }
+        engines[engine_id].discard(
+            static_cast<unsigned long long>(Engine::state_values) * ThreadsPerEngine * max_states
+        );
+    }
+
+    // Random-access generation (rocrand_generate_at()): the index-th value is
+    // computed from the first state of the subsequence keys[index], so it
+    // does not depend on other keys, their order or the generator's offset
+    template<class Engine, class T, class Distribution>
+    __forceinline__ __device__ __host__
+    void generate_at_value(const unsigned long long seed,
+                           const unsigned long long * keys,
+                           const size_t index,
+                           T * data,
+                           Distribution distribution)
+    {
+        constexpr unsigned int input_width = Distribution::input_width;
+        constexpr unsigned int output_width = Distribution::output_width;
+        static_assert(input_width <= Engine::state_values, "Incorrect input_width");
+
+        const Engine engine(seed, keys[index], 0);
+        unsigned int values[Engine::state_values];
+        engine.current_values(values);
+        unsigned int input[input_width];
+        T output[output_width];
+        for(unsigned int i = 0; i < input_width; i++)
+        {
+            input[i] = values[i];
+        }
+        distribution(input, output);
+        data[index] = output[0];
+    }
+
+    template<class Engine, class T, class Distribution>
+    __global__
+    void generate_at_kernel(const unsigned long long seed,
+                            const unsigned long long * keys,
+                            T * data, const size_t n,
+                            Distribution distribution)
+    {
+        const unsigned int thread_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        for(size_t index = thread_id; index < n; index += stride)
+        {
+            generate_at_value<Engine>(seed, keys, index, data, distribution);
+        }
+    }
+
+} // end namespace counter_based64
+} // end namespace detail
+} // end namespace rocrand_host
+
+// Host-side generator of PHILOX4_64_10, THREEFRY2_64_20, THREEFRY4_64_20 and PHILOX4_32_7,
+// it has the same features and launch configuration as rocrand_philox4x32_10.
+template<rocrand_rng_type RngType>
+class rocrand_counter_based64 : public rocrand_generator_type<RngType>
+{
+    static constexpr unsigned int s_threads_per_engine = 16;
+
+public:
+    using base_type = rocrand_generator_type<RngType>;
+    using traits_type = ::rocrand_host::detail::counter_based64::traits<RngType>;
+    using engine_type = typename traits_type::engine_type;
+
+    rocrand_counter_based64(unsigned long long seed = 0,
+                            unsigned long long offset = 0,
+                            hipStream_t stream = 0,
+                            bool host_side = false)
+        : base_type(seed, offset, stream, host_side),
+          m_engines_initialized(false), m_engines(NULL),
+          m_blocks(s_default_blocks), m_threads(s_default_threads),
+          m_engines_size(s_default_blocks * s_default_threads / s_threads_per_engine),
+          m_normal_method(ROCRAND_NORMAL_METHOD_BOX_MULLER)
+    {
+        rocrand_status status = allocate_engines(m_engines, m_engines_size);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            throw status;
+        }
+        m_poisson.set_stats(&m_stats);
+        m_poisson_host.set_stats(&m_stats);
+    }
+
+    ~rocrand_counter_based64()
+    {
+        free_engines(m_engines);
+    }
+
+    void reset()
+    {
+        m_engines_initialized = false;
+    }
+
+    /// Changes seed to \p seed and resets generator state.
+    void set_seed(unsigned long long seed)
+    {
+        m_seed = seed;
+        m_engines_initialized = false;
+    }
+
+    void set_offset(unsigned long long offset)
+    {
+        m_offset = offset;
+        m_engines_initialized = false;
+    }
+
+    /// Sets the method used by generate_normal()
+    rocrand_status set_normal_method(rocrand_normal_method method)
+    {
+        if(method != ROCRAND_NORMAL_METHOD_BOX_MULLER
+            && method != ROCRAND_NORMAL_METHOD_ZIGGURAT)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+
+        m_normal_method = method;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Changes launch configuration to \p blocks blocks of \p threads threads
+    /// (\p s_threads_per_engine threads per engine) and resets generator state.
+    /// When both are 0, the number of blocks is computed from occupancy of
+    /// the current device.
+    rocrand_status set_launch_config(unsigned int blocks, unsigned int threads)
+    {
+        if(blocks == 0 && threads == 0)
+        {
+            threads = s_default_threads;
+            blocks = s_default_blocks;
+            if(!m_host_side)
+            {
+                void (*kernel)(engine_type *, unsigned int *, const size_t,
+                               uniform_distribution<unsigned int>, const bool) =
+                    rocrand_host::detail::counter_based64::generate_kernel<
+                        s_threads_per_engine, engine_type,
+                        unsigned int, uniform_distribution<unsigned int>
+                    >;
+                rocrand_status status = rocrand_host::detail::get_occupancy_blocks(
+                    kernel, threads, blocks
+                );
+                if(status != ROCRAND_STATUS_SUCCESS)
+                    return status;
+            }
+        }
+        // Threads of one engine must belong to the same warp
+        if(blocks == 0 || threads == 0 || threads > s_max_threads
+            || threads % s_threads_per_engine != 0)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        if(blocks == m_blocks && threads == m_threads)
+            return ROCRAND_STATUS_SUCCESS;
+
+        const size_t engines_size = static_cast<size_t>(blocks) * threads / s_threads_per_engine;
+        engine_type * engines;
+        rocrand_status status = allocate_engines(engines, engines_size);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        free_engines(m_engines);
+
+        m_engines = engines;
+        m_engines_size = engines_size;
+        m_blocks = blocks;
+        m_threads = threads;
+        m_engines_initialized = false;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    void get_launch_config(unsigned int * blocks, unsigned int * threads) const
+    {
+        *blocks = m_blocks;
+        *threads = m_threads;
+    }
+
+    rocrand_status init()
+    {
+        if(m_engines_initialized && m_engines != NULL)
+            return ROCRAND_STATUS_SUCCESS;
+
+        // Initialization allocates memory and waits for the device,
+        // so it must be done before capture (see rocrand_initialize_generator())
+        if(!m_host_side && rocrand_host::detail::is_stream_capturing(m_stream))
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+
+        // Engines of a trimmed generator are copied back (see trim())
+        rocrand_status status = restore_engines(m_engines, m_engines_size, m_engines_initialized);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        if(m_engines_initialized)
+            return ROCRAND_STATUS_SUCCESS;
+
+        rocrand_host::detail::profiling_range range("rocrand init_engines_kernel");
+        count_init();
+        if(m_host_side)
+        {
+            engine_type * engines = m_engines;
+            const unsigned long long seed = m_seed;
+            const unsigned long long offset = m_offset;
+            rocrand_host::detail::host_parallel_for(
+                m_engines_size,
+                [engines, seed, offset](size_t engine_id)
+                {
+                    engines[engine_id] = engine_type(seed, engine_id, offset);
+                }
+            );
+            m_engines_initialized = true;
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        count_launch();
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::counter_based64::init_engines_kernel),
+            dim3((m_engines_size + s_default_threads - 1) / s_default_threads),
+            dim3(s_default_threads), 0, m_stream,
+            m_engines, m_engines_size, m_seed, m_offset
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Returns size in bytes of the state returned by get_state()
+    size_t get_state_size() const
+    {
+        return sizeof(engine_type) * m_engines_size;
+    }
+
+    /// Initializes engines if needed and copies them to host memory \p state
+    rocrand_status get_state(void * state)
+    {
+        rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        return rocrand_host::detail::copy_engines_to_host(
+            state, m_engines, m_engines_size, m_host_side, m_stream
+        );
+    }
+
+    /// Replaces engines with \p state (in host memory) returned by get_state()
+    /// of a generator with the same launch configuration
+    rocrand_status set_state(const void * state)
+    {
+        // The state replaces engines of a trimmed generator
+        rocrand_status status = restore_engines(m_engines, m_engines_size, false);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        status = rocrand_host::detail::copy_engines_from_host(
+            m_engines, m_engines_size, state, m_host_side, m_stream
+        );
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Returns size of device memory of engines and Poisson tables
+    /// (rocrand_get_memory_usage())
+    size_t get_memory_usage() const
+    {
+        return engines_device_bytes(m_engines, m_engines_size) + m_poisson.device_bytes();
+    }
+
+    /// Copies engines to host memory and frees device memory of engines
+    /// and Poisson tables (rocrand_generator_trim()). The next init()
+    /// (every generate call) restores engines.
+    rocrand_status trim()
+    {
+        rocrand_status status = trim_engines(m_engines, m_engines_size, m_engines_initialized);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        m_poisson.clear();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Returns size in bytes of the data written by save()
+    size_t get_save_size() const
+    {
+        return sizeof(save_data) + get_state_size();
+    }
+
+    /// Writes seed, offset, launch configuration and engines to host memory \p data
+    rocrand_status save(void * data)
+    {
+        const save_data header = { m_seed, m_offset, m_blocks, m_threads };
+        std::memcpy(data, &header, sizeof(save_data));
+        return get_state(static_cast<char *>(data) + sizeof(save_data));
+    }
+
+    /// Restores the generator from \p data of \p size bytes written by save()
+    rocrand_status load(const void * data, size_t size)
+    {
+        if(size < sizeof(save_data))
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        save_data header;
+        std::memcpy(&header, data, sizeof(save_data));
+        const size_t engines_size = static_cast<size_t>(header.blocks) * header.threads / s_threads_per_engine;
+        if(size != sizeof(save_data) + sizeof(engine_type) * engines_size)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        rocrand_status status = set_launch_config(header.blocks, header.threads);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        set_seed(header.seed);
+        set_offset(header.offset);
+        return set_state(static_cast<const char *>(data) + sizeof(save_data));
+    }
+
+    template<class T, class Distribution = uniform_distribution<T> >
+    rocrand_status generate(T * data, size_t data_size,
+                        Distribution distribution = Distribution())
+    {
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        rocrand_host::detail::profiling_range range("rocrand generate_kernel");
+        count_generate(data_size);
+
+        if(m_host_side)
+        {
+            engine_type * engines = m_engines;
+            const unsigned int stride = m_blocks * m_threads;
+            rocrand_host::detail::host_parallel_for(
+                m_engines_size,
+                [=](size_t engine_id)
+                {
+                    rocrand_host::detail::counter_based64::generate_engine_host<s_threads_per_engine>(
+                        engines, engine_id, stride, data, data_size, distribution
+                    );
+                }
+            );
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::counter_based64::generate_kernel<s_threads_per_engine>),
+            dim3(m_blocks), dim3(m_threads), 0, m_stream,
+            m_engines, data, data_size, distribution, streaming_stores()
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_uniform(T * data, size_t data_size)
+    {
+        uniform_distribution<T> distribution;
+        return generate(data, data_size, distribution);
+    }
+
+    /// Generates \p data_size integers in [\p lo, \p lo + \p range)
+    template<class T>
+    rocrand_status generate_uniform_range(T * data, size_t data_size, T lo, T range)
+    {
+        uniform_range_distribution<T> distribution(lo, range);
+        return generate_rejection(data, data_size, distribution);
+    }
+
+    /// Generates \p data_size values with a rejection \p distribution
+    /// (see generate_rejection_kernel)
+    template<class T, class Distribution>
+    rocrand_status generate_rejection(T * data, size_t data_size,
+                                      Distribution distribution)
+    {
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        rocrand_host::detail::profiling_range range("rocrand generate_kernel");
+        count_generate(data_size);
+
+        if(m_host_side)
+        {
+            engine_type * engines = m_engines;
+            const unsigned int stride = m_blocks * m_threads;
+            rocrand_host::detail::host_parallel_for(
+                m_engines_size,
+                [=](size_t engine_id)
+                {
+                    rocrand_host::detail::counter_based64::generate_rejection_engine_host<s_threads_per_engine>(
+                        engines, engine_id, stride, data, data_size, distribution
+                    );
+                }
+            );
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::counter_based64::generate_rejection_kernel<s_threads_per_engine>),
+            dim3(m_blocks), dim3(m_threads), 0, m_stream,
+            m_engines, data, data_size, distribution
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        if(m_normal_method == ROCRAND_NORMAL_METHOD_ZIGGURAT)
+        {
+            ziggurat_normal_distribution<T> distribution(mean, stddev);
+            return generate_rejection(data, data_size, distribution);
+        }
+        normal_distribution<T> distribution(mean, stddev, fast_math());
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        log_normal_distribution<T> distribution(mean, stddev, fast_math());
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T * data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    /// Generates Bernoulli decisions packed as bits (T is unsigned int)
+    /// or bytes (T is unsigned char)
+    template<class T>
+    rocrand_status generate_bernoulli(T * data, size_t data_size, double p)
+    {
+        bernoulli_distribution<T> distribution(p);
+        return generate(data, data_size, distribution);
+    }
+
+    /// Generates gamma variates (Marsaglia-Tsang rejection in every thread)
+    template<class T>
+    rocrand_status generate_gamma(T * data, size_t data_size, T shape, T scale)
+    {
+        gamma_distribution<T> distribution(shape, scale);
+        return generate_rejection(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_beta(T * data, size_t data_size, T alpha, T beta)
+    {
+        beta_distribution<T> distribution(alpha, beta);
+        return generate_rejection(data, data_size, distribution);
+    }
+
+    /// Generates normal values truncated to [\p lo, \p hi] (rejection in every thread)
+    template<class T>
+    rocrand_status generate_truncated_normal(T * data, size_t data_size,
+                                             T mean, T stddev, T lo, T hi)
+    {
+        truncated_normal_distribution<T> distribution(mean, stddev, lo, hi);
+        return generate_rejection(data, data_size, distribution);
+    }
+
+    /// Sets the maximum number of lambdas whose Poisson tables are cached
+    rocrand_status set_poisson_cache_capacity(size_t capacity)
+    {
+        if(capacity == 0)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        m_poisson.set_capacity(capacity);
+        m_poisson_host.set_capacity(capacity);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Computes and caches Poisson tables for \p count lambdas
+    rocrand_status prepare_poisson(const double * lambdas, size_t count)
+    {
+        for(size_t i = 0; i < count; i++)
+        {
+            if(lambdas[i] >= poisson_rejection_distribution::lambda_threshold)
+            {
+                // Generated without tables
+                continue;
+            }
+            try
+            {
+                if(m_host_side)
+                {
+                    m_poisson_host.set_lambda(lambdas[i]);
+                }
+                else
+                {
+                    m_poisson.set_lambda(lambdas[i], m_stream);
+                }
+            }
+            catch(rocrand_status status)
+            {
+                return status;
+            }
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
+    {
+        if(lambda >= poisson_rejection_distribution::lambda_threshold)
+        {
+            poisson_rejection_distribution distribution(lambda);
+            return generate_rejection(data, data_size, distribution);
+        }
+
+        try
+        {
+            if(m_host_side)
+            {
+                m_poisson_host.set_lambda(lambda);
+            }
+            else
+            {
+                m_poisson.set_lambda(lambda, m_stream);
+            }
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        if(m_host_side)
+        {
+            return generate(data, data_size, m_poisson_host.dis);
+        }
+        return generate(data, data_size, m_poisson.dis);
+    }
+
+    /// Generates \p data_size values of the discrete distribution with tables
+    /// \p tables in device memory (copied to the host for host-side generators)
+    rocrand_status generate_discrete(unsigned int * data, size_t data_size,
+                                     const rocrand_discrete_distribution_st& tables)
+    {
+        if(m_host_side)
+        {
+            rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_ALIAS, true> distribution;
+            try
+            {
+                distribution.init_from_device(tables);
+            }
+            catch(rocrand_status status)
+            {
+                distribution.deallocate();
+                return status;
+            }
+            const rocrand_status status = generate(data, data_size, distribution);
+            distribution.deallocate();
+            return status;
+        }
+        rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_ALIAS> distribution(tables);
+        if(tables.size <= rocrand_host::detail::discrete_shared_capacity)
+        {
+            return generate_discrete_shared(data, data_size, distribution);
+        }
+        return generate(data, data_size, distribution);
+    }
+
+    /// Generates \p data_size values of a discrete \p distribution with
+    /// a small alias table (see generate_discrete_shared_kernel)
+    template<class Distribution>
+    rocrand_status generate_discrete_shared(unsigned int * data, size_t data_size,
+                                            Distribution distribution)
+    {
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        rocrand_host::detail::profiling_range range("rocrand generate_kernel");
+        count_generate(data_size);
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::counter_based64::generate_discrete_shared_kernel<s_threads_per_engine>),
+            dim3(m_blocks), dim3(m_threads), 0, m_stream,
+            m_engines, data, data_size, distribution
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Generates \p data_size Poisson-distributed values, the i-th one
+    /// with lambda \p lambdas[i] (device memory, or host memory for host-side
+    /// generators)
+    rocrand_status generate_poisson_array(unsigned int * data, size_t data_size,
+                                          const double * lambdas)
+    {
+        poisson_array_distribution distribution(lambdas);
+        return generate_rejection(data, data_size, distribution);
+    }
+
+    /// Generates \p data_size binomially distributed values (\p n trials,
+    /// success probability \p p)
+    rocrand_status generate_binomial(unsigned int * data, size_t data_size,
+                                     unsigned int n, double p)
+    {
+        binomial_distribution distribution(n, p);
+        return generate_rejection(data, data_size, distribution);
+    }
+
+    /// Generates \p data_size binomially distributed values, the i-th one
+    /// with \p ns[i] trials and success probability \p ps[i]
+    rocrand_status generate_binomial_array(unsigned int * data, size_t data_size,
+                                           const unsigned int * ns, const double * ps)
+    {
+        binomial_array_distribution distribution(ns, ps);
+        return generate_rejection(data, data_size, distribution);
+    }
+
+    /// Generates \p data_size multinomial vectors of \p categories counts
+    /// stored by category (see multinomial_distribution)
+    rocrand_status generate_multinomial(unsigned int * data, size_t data_size,
+                                        unsigned int n, const double * weights,
+                                        unsigned int categories)
+    {
+        multinomial_distribution distribution(n, weights, categories, data, data_size);
+        return generate_rejection(data + (categories - 1) * data_size, data_size, distribution);
+    }
+
+    /// Generates \p data_size unit vectors of \p dim values (1 to 4) stored
+    /// one after another (see unit_vector_distribution)
+    rocrand_status generate_unit_vectors(float * data, size_t data_size, unsigned int dim)
+    {
+        if(dim == 1)
+            return generate_unit_vectors<1>(data, data_size);
+        else if(dim == 2)
+            return generate_unit_vectors<2>(data, data_size);
+        else if(dim == 3)
+            return generate_unit_vectors<3>(data, data_size);
+        else if(dim == 4)
+            return generate_unit_vectors<4>(data, data_size);
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    template<unsigned int Dim>
+    rocrand_status generate_unit_vectors(float * data, size_t data_size)
+    {
+        typedef unit_vector_distribution<Dim> distribution_type;
+        return generate_rejection(
+            reinterpret_cast<typename distribution_type::value_type *>(data),
+            data_size, distribution_type()
+        );
+    }
+
+    /// Rounds \p data_size values of \p input to 16-bit or 8-bit values of
+    /// \p format (see stochastic_round_distribution)
+    rocrand_status generate_stochastic_round(const float * input, void * output,
+                                             size_t data_size, rocrand_round_format format)
+    {
+        if(format == ROCRAND_ROUND_FORMAT_BFLOAT16)
+            return generate_stochastic_round<rocrand_host::detail::stochastic_round_bfloat16>(input, output, data_size);
+        else if(format == ROCRAND_ROUND_FORMAT_HALF)
+            return generate_stochastic_round<rocrand_host::detail::stochastic_round_half>(input, output, data_size);
+        else if(format == ROCRAND_ROUND_FORMAT_FP8_E4M3)
+            return generate_stochastic_round<rocrand_host::detail::stochastic_round_fp8_e4m3>(input, output, data_size);
+        else if(format == ROCRAND_ROUND_FORMAT_FP8_E5M2)
+            return generate_stochastic_round<rocrand_host::detail::stochastic_round_fp8_e5m2>(input, output, data_size);
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    /// Values of every engine value are stored together, the tail of
+    /// fewer values uses one engine value per value
+    template<class Format>
+    rocrand_status generate_stochastic_round(const float * input, void * output, size_t data_size)
+    {
+        typedef stochastic_round_distribution<Format> distribution_type;
+        typedef stochastic_round_distribution<Format, 1> tail_distribution_type;
+        typedef typename Format::value_type T;
+        constexpr unsigned int values = 32 / Format::random_bits;
+        const size_t groups = data_size / values;
+        const size_t tail_size = data_size - groups * values;
+        if(groups > 0)
+        {
+            const rocrand_status status = generate_rejection(
+                reinterpret_cast<typename distribution_type::value_type *>(output),
+                groups, distribution_type(input)
+            );
+            if(status != ROCRAND_STATUS_SUCCESS || tail_size == 0)
+                return status;
+        }
+        return generate_rejection(
+            reinterpret_cast<typename tail_distribution_type::value_type *>(
+                static_cast<T *>(output) + groups * values
+            ),
+            tail_size, tail_distribution_type(input + groups * values)
+        );
+    }
+
+    /// Generates \p data_size values, the i-th one from the counter \p keys[i]
+    /// (see generate_at_value). Engines and the offset are neither used
+    /// nor changed.
+    template<class T, class Distribution = uniform_distribution<T> >
+    rocrand_status generate_at(const unsigned long long * keys, T * data, size_t data_size,
+                               Distribution distribution = Distribution())
+    {
+        if(data_size == 0)
+            return ROCRAND_STATUS_SUCCESS;
+        if(keys == NULL || data == NULL)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        rocrand_host::detail::profiling_range range("rocrand generate_at_kernel");
+        count_generate(data_size);
+        const unsigned long long seed = m_seed;
+        if(m_host_side)
+        {
+            rocrand_host::detail::host_parallel_for(
+                data_size,
+                [=](size_t index)
+                {
+                    rocrand_host::detail::counter_based64::generate_at_value<engine_type>(
+                        seed, keys, index, data, distribution
+                    );
+                }
+            );
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::counter_based64::generate_at_kernel<engine_type>),
+            dim3(m_blocks), dim3(m_threads), 0, m_stream,
+            seed, keys, data, data_size, distribution
+        );
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// generate_at() with Box-Muller normal values (the Ziggurat method
+    /// may use more than one state per value)
+    template<class T>
+    rocrand_status generate_normal_at(const unsigned long long * keys, T * data,
+                                      size_t data_size, T mean, T stddev)
+    {
+        normal_distribution<T> distribution(mean, stddev, fast_math());
+        return generate_at(keys, data, data_size, distribution);
+    }
+
+private:
+    // Generator data written by save() before engines
+    struct save_data
+    {
+        unsigned long long seed;
+        unsigned long long offset;
+        unsigned int blocks;
+        unsigned int threads;
+    };
+
+    bool m_engines_initialized;
+    engine_type * m_engines;
+    unsigned int m_blocks;
+    unsigned int m_threads;
+    size_t m_engines_size;
+
+    const static uint32_t s_default_threads = 256;
+    const static uint32_t s_default_blocks = 1024;
+    const static uint32_t s_max_threads = 1024;
+
+    // For caching of Poisson for consecutive generations with the same lambda
+    poisson_distribution_manager<> m_poisson;
+    poisson_distribution_manager<ROCRAND_DISCRETE_METHOD_ALIAS, true> m_poisson_host;
+
+    rocrand_normal_method m_normal_method;
+
+    using base_type::m_seed;
+    using base_type::m_offset;
+    using base_type::m_stream;
+    using base_type::m_host_side;
+    using base_type::m_stats;
+    using base_type::allocate_engines;
+    using base_type::free_engines;
+    using base_type::engines_device_bytes;
+    using base_type::trim_engines;
+    using base_type::restore_engines;
+    using base_type::count_generate;
+    using base_type::count_init;
+    using base_type::count_launch;
+    using base_type::streaming_stores;
+    using base_type::fast_math;
+};
+
+// Disabled engines are replaced in generators.hpp
+#ifndef ROCRAND_DISABLE_PHILOX4_64_10
+typedef rocrand_counter_based64<ROCRAND_RNG_PSEUDO_PHILOX4_64_10> rocrand_philox4x64_10;
+#endif
+#ifndef ROCRAND_DISABLE_PHILOX4_32_7
+typedef rocrand_counter_based64<ROCRAND_RNG_PSEUDO_PHILOX4_32_7> rocrand_philox4x32_7;
+#endif
+#ifndef ROCRAND_DISABLE_THREEFRY2_64_20
+typedef rocrand_counter_based64<ROCRAND_RNG_PSEUDO_THREEFRY2_64_20> rocrand_threefry2x64_20;
+#endif
+#ifndef ROCRAND_DISABLE_THREEFRY4_64_20
+typedef rocrand_counter_based64<ROCRAND_RNG_PSEUDO_THREEFRY4_64_20> rocrand_threefry4x64_20;
+#endif
+
+#endif // ROCRAND_RNG_COUNTER_BASED64_H_
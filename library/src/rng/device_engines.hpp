@@ -26,6 +26,9 @@
 #endif
 
 #define ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
+#define ROCRAND_DETAIL_PHILOX4X64_BM_NOT_IN_STATE
+#define ROCRAND_DETAIL_THREEFRY2X64_BM_NOT_IN_STATE
+#define ROCRAND_DETAIL_THREEFRY4X64_BM_NOT_IN_STATE
 #define ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
 #define ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
 
@@ -0,0 +1,62 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DEVICE_TABLES_H_
+#define ROCRAND_RNG_DEVICE_TABLES_H_
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+namespace rocrand_host {
+namespace detail {
+
+    // Read-only tables (direction vectors, scramble constants) are uploaded
+    // once per device and shared by all generators of the process (see
+    // rocrand_device_tables.cpp). Returns in *ptr the device copy of the
+    // first size bytes of the host table on the current device, the copy is
+    // made only if no generator holds it. *uploaded is set to true if the
+    // table has been copied by this call.
+    hipError_t acquire_device_table(void ** ptr,
+                                    const void * table,
+                                    size_t size,
+                                    hipStream_t stream,
+                                    bool * uploaded);
+
+    // Releases the reference to ptr returned by acquire_device_table(),
+    // the table is freed when it is not held anymore. NULL is ignored.
+    hipError_t release_device_table(const void * ptr, hipStream_t stream);
+
+    template<class T>
+    inline hipError_t acquire_device_table(const T ** ptr,
+                                           const T * table,
+                                           size_t count,
+                                           hipStream_t stream,
+                                           bool * uploaded)
+    {
+        void * p = NULL;
+        const hipError_t error = acquire_device_table(&p, table, sizeof(T) * count, stream, uploaded);
+        *ptr = static_cast<const T *>(p);
+        return error;
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_DEVICE_TABLES_H_
@@ -0,0 +1,147 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISABLED_H_
+#define ROCRAND_RNG_DISABLED_H_
+
+#include <stddef.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "generator_type.hpp"
+#include "stream_producer.hpp"
+
+// Generator of an engine which is not built into the library (see ROCRAND_ENGINES
+// in library/CMakeLists.txt). It replaces the generator class of the engine, so
+// the dispatch in rocrand.cpp stays the same, but no kernels, engines or
+// precomputed tables of the engine are compiled. Generators are never created:
+// constructors throw ROCRAND_STATUS_TYPE_ERROR, so member functions are never called.
+template<rocrand_rng_type GeneratorType>
+class rocrand_disabled_generator : public rocrand_generator_type<GeneratorType>
+{
+public:
+    using base_type = rocrand_generator_type<GeneratorType>;
+
+    template<class... Args>
+    rocrand_disabled_generator(Args...)
+    {
+        throw ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    size_t get_state_size() const
+    {
+        return 0;
+    }
+
+    size_t get_save_size() const
+    {
+        return 0;
+    }
+
+    bool is_stateless() const
+    {
+        return false;
+    }
+
+    size_t get_memory_usage() const
+    {
+        return 0;
+    }
+
+    #define ROCRAND_DISABLED_GENERATOR_FUNCTION(name) \
+        template<class... Args> \
+        rocrand_status name(Args...) \
+        { \
+            return ROCRAND_STATUS_TYPE_ERROR; \
+        }
+
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(set_seed)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(set_offset)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(set_dimensions)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(set_generating_vector)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(set_normal_method)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(set_ordering)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(set_launch_config)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(get_launch_config)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(set_stateless)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(set_substreams)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(set_poisson_cache_capacity)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(prepare_poisson)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(init)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(init_async)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(trim)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(get_state)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(set_state)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(save)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(load)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(split)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_uniform)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_uniform_range)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_normal)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_log_normal)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_exponential)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_gamma)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_beta)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_truncated_normal)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_bernoulli)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_poisson)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_poisson_array)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_binomial)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_binomial_array)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_multinomial)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_unit_vectors)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_stochastic_round)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_at)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_normal_at)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_matrix)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_discrete)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_batch)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_uniform_2d)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_normal_2d)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_on)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_uniform_on)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_normal_on)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_slice)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_uniform_slice)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_normal_slice)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_multivariate_normal)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_brownian_paths)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_permutation)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(shuffle)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_latin_hypercube)
+    ROCRAND_DISABLED_GENERATOR_FUNCTION(generate_stratified_uniform)
+
+    #undef ROCRAND_DISABLED_GENERATOR_FUNCTION
+};
+
+// Stream producer of an engine which is not built into the library
+class rocrand_disabled_stream_producer : public rocrand_stream_producer_base_type
+{
+public:
+    rocrand_disabled_stream_producer(rocrand_rng_type rng_type, unsigned long long, size_t)
+        : rocrand_stream_producer_base_type(rng_type)
+    {
+        throw ROCRAND_STATUS_TYPE_ERROR;
+    }
+};
+
+#endif // ROCRAND_RNG_DISABLED_H_
@@ -0,0 +1,166 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_BERNOULLI_H_
+#define ROCRAND_RNG_DISTRIBUTION_BERNOULLI_H_
+
+#include <hip/hip_runtime.h>
+
+#include "device_distributions.hpp"
+
+// Bernoulli decisions: every 8-bit slice of a 32-bit value is compared with
+// a threshold (p rounded to a multiple of 1/256), so one value gives
+// 4 decisions. Decisions are packed as bits (32 per 32-bit word, bit k of
+// word w is decision 32 * w + k) or saved as bytes (0 or 1).
+
+namespace rocrand_host {
+namespace detail {
+
+// Returns p rounded to the nearest multiple of 1/256, multiplied by 256
+inline
+unsigned int bernoulli_threshold(double p)
+{
+    return static_cast<unsigned int>(p * 256.0 + 0.5);
+}
+
+__forceinline__ __device__ __host__
+unsigned int bernoulli_bits(const unsigned int (&input)[8], const unsigned int threshold)
+{
+    unsigned int bits = 0;
+    for(unsigned int i = 0; i < 8; i++)
+    {
+        for(unsigned int b = 0; b < 4; b++)
+        {
+            const unsigned int slice = (input[i] >> (8 * b)) & 0xFF;
+            bits |= (slice < threshold ? 1U : 0U) << (4 * i + b);
+        }
+    }
+    return bits;
+}
+
+__forceinline__ __device__ __host__
+void bernoulli_bytes(const unsigned int input, const unsigned int threshold,
+                     unsigned char (&output)[4])
+{
+    for(unsigned int b = 0; b < 4; b++)
+    {
+        const unsigned int slice = (input >> (8 * b)) & 0xFF;
+        output[b] = slice < threshold ? 1 : 0;
+    }
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+
+// Universal
+
+template<class T>
+struct bernoulli_distribution;
+
+template<>
+struct bernoulli_distribution<unsigned int>
+{
+    static constexpr unsigned int input_width = 8;
+    static constexpr unsigned int output_width = 1;
+
+    const unsigned int threshold;
+
+    __host__
+    bernoulli_distribution(double p)
+        : threshold(rocrand_host::detail::bernoulli_threshold(p)) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[8], unsigned int (&output)[1]) const
+    {
+        output[0] = rocrand_host::detail::bernoulli_bits(input, threshold);
+    }
+};
+
+template<>
+struct bernoulli_distribution<unsigned char>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 4;
+
+    const unsigned int threshold;
+
+    __host__
+    bernoulli_distribution(double p)
+        : threshold(rocrand_host::detail::bernoulli_threshold(p)) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], unsigned char (&output)[4]) const
+    {
+        rocrand_host::detail::bernoulli_bytes(input[0], threshold, output);
+    }
+};
+
+
+// Mrg32k3a
+
+template<class T>
+struct mrg_bernoulli_distribution;
+
+template<>
+struct mrg_bernoulli_distribution<unsigned int>
+{
+    static constexpr unsigned int input_width = 8;
+    static constexpr unsigned int output_width = 1;
+
+    const unsigned int threshold;
+
+    __host__
+    mrg_bernoulli_distribution(double p)
+        : threshold(rocrand_host::detail::bernoulli_threshold(p)) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[8], unsigned int (&output)[1]) const
+    {
+        unsigned int v[8];
+        for(unsigned int i = 0; i < 8; i++)
+        {
+            v[i] = rocrand_device::detail::mrg_uniform_distribution_uint(input[i]);
+        }
+        output[0] = rocrand_host::detail::bernoulli_bits(v, threshold);
+    }
+};
+
+template<>
+struct mrg_bernoulli_distribution<unsigned char>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 4;
+
+    const unsigned int threshold;
+
+    __host__
+    mrg_bernoulli_distribution(double p)
+        : threshold(rocrand_host::detail::bernoulli_threshold(p)) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], unsigned char (&output)[4]) const
+    {
+        const unsigned int v = rocrand_device::detail::mrg_uniform_distribution_uint(input[0]);
+        rocrand_host::detail::bernoulli_bytes(v, threshold, output);
+    }
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_BERNOULLI_H_
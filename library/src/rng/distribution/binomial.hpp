@@ -0,0 +1,107 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_BINOMIAL_H_
+#define ROCRAND_RNG_DISTRIBUTION_BINOMIAL_H_
+
+#include <hip/hip_runtime.h>
+
+#include "device_distributions.hpp"
+#include "poisson.hpp"
+
+#include <rocrand_binomial.h>
+
+// Table-free binomial and multinomial distributions for generate_rejection
+// kernels: inversion for small n * p and transformed rejection BTRS for large
+// ones (see rocrand_binomial.h), so changing n or p costs nothing.
+
+struct binomial_distribution
+{
+    const unsigned int n;
+    const double p;
+
+    __host__ __device__
+    binomial_distribution(unsigned int n, double p)
+        : n(n), p(p) {}
+
+    template<class Generator>
+    __host__ __device__
+    unsigned int operator()(Generator& generator, size_t) const
+    {
+        rocrand_host::detail::poisson_rejection_state<Generator> state = { generator };
+        rocrand_host::detail::poisson_rejection_state<Generator> * state_ptr = &state;
+        return rocrand_device::detail::binomial_distribution(state_ptr, n, p);
+    }
+};
+
+// Binomial distribution with parameters for every value (ns[index], ps[index])
+struct binomial_array_distribution
+{
+    const unsigned int * ns;
+    const double * ps;
+
+    __host__ __device__
+    binomial_array_distribution(const unsigned int * ns, const double * ps)
+        : ns(ns), ps(ps) {}
+
+    template<class Generator>
+    __host__ __device__
+    unsigned int operator()(Generator& generator, size_t index) const
+    {
+        rocrand_host::detail::poisson_rejection_state<Generator> state = { generator };
+        rocrand_host::detail::poisson_rejection_state<Generator> * state_ptr = &state;
+        return rocrand_device::detail::binomial_distribution(state_ptr, ns[index], ps[index]);
+    }
+};
+
+// Multinomial vectors of size values stored by category: the count of
+// category c of the index-th vector is output[c * size + index]. Generators
+// pass output + (categories - 1) * size as data of generate_rejection, the
+// distribution stores all counts and returns the last one.
+struct multinomial_distribution
+{
+    const unsigned int n;
+    const double * weights;
+    const unsigned int categories;
+    unsigned int * output;
+    const size_t size;
+
+    __host__ __device__
+    multinomial_distribution(unsigned int n, const double * weights,
+                             unsigned int categories,
+                             unsigned int * output, size_t size)
+        : n(n), weights(weights), categories(categories),
+          output(output), size(size) {}
+
+    template<class Generator>
+    __host__ __device__
+    unsigned int operator()(Generator& generator, size_t index) const
+    {
+        rocrand_host::detail::poisson_rejection_state<Generator> state = { generator };
+        rocrand_host::detail::poisson_rejection_state<Generator> * state_ptr = &state;
+        // The last count is also stored by the distribution, the second
+        // store of generate_rejection writes the same value
+        return rocrand_device::detail::multinomial_distribution(
+            state_ptr, n, weights, categories, output + index, size
+        );
+    }
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_BINOMIAL_H_
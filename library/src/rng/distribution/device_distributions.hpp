@@ -32,4 +32,117 @@
 #include <rocrand_log_normal.h>
 #include <rocrand_discrete.h>
 
+#include <hip/hip_bfloat16.h>
+
+#include <rocrand.h>
+
+namespace rocrand_host {
+namespace detail {
+
+    // Rounds v (not NaN) to the nearest bfloat16, ties to even
+    FQUALIFIERS
+    hip_bfloat16 float_to_bfloat16(float v)
+    {
+        union { float f; unsigned int u; } bits;
+        bits.f = v;
+        hip_bfloat16 r;
+        r.data = static_cast<uint16_t>((bits.u + 0x7fffU + ((bits.u >> 16) & 1U)) >> 16);
+        return r;
+    }
+
+    // bfloat16 has 8 significant bits, so 16 random bits are enough for a uniform
+    // value in (0, 1] and two values are generated from every 32-bit engine value
+    FQUALIFIERS
+    hip_bfloat16 uniform_distribution_bfloat16(unsigned short v)
+    {
+        return float_to_bfloat16(ROCRAND_2POW16_INV + (v * ROCRAND_2POW16_INV));
+    }
+
+    // Two normally distributed values with Box-Muller transform of the low
+    // and the high 16 bits of v (computed in float)
+    FQUALIFIERS
+    float2 box_muller_bfloat16(unsigned int v)
+    {
+        float2 r;
+        const float u = ROCRAND_2POW16_INV + ((v & 0xffffU) * ROCRAND_2POW16_INV);
+        const float w = ROCRAND_2POW16_INV_2PI + ((v >> 16) * ROCRAND_2POW16_INV_2PI);
+        const float s = sqrtf(-2.0f * logf(u));
+        #ifdef __HIP_DEVICE_COMPILE__
+            __sincosf(w, &r.x, &r.y);
+            r.x *= s;
+            r.y *= s;
+        #else
+            r.x = sinf(w) * s;
+            r.y = cosf(w) * s;
+        #endif
+        return r;
+    }
+
+    // Rounds v (not NaN) to the nearest 8-bit floating-point value with
+    // ExponentBits and MantissaBits (OCP FP8 E4M3 or E5M2), ties to even,
+    // values out of range saturate to the largest finite value
+    template<unsigned int ExponentBits, unsigned int MantissaBits>
+    FQUALIFIERS
+    unsigned char float_to_fp8(float v)
+    {
+        constexpr unsigned int bias = (1U << (ExponentBits - 1)) - 1;
+        constexpr unsigned int shift = 23 - MantissaBits;
+        // E4M3 has no infinities (S.1111.111 is NaN), E5M2 reserves the largest exponent
+        constexpr unsigned int max_code = ExponentBits == 4 ? 0x7EU : 0x7BU;
+        constexpr float subnormal_scale = static_cast<float>(1U << (bias - 1 + MantissaBits));
+
+        union { float f; unsigned int u; } bits;
+        bits.f = v;
+        const unsigned int sign = (bits.u >> 24) & 0x80U;
+        const unsigned int a = bits.u & 0x7fffffffU;
+        unsigned int code;
+        if(a < ((128U - bias) << 23))
+        {
+            // Subnormal values are multiples of 2^(1 - bias - MantissaBits)
+            bits.u = a;
+            code = static_cast<unsigned int>(rintf(bits.f * subnormal_scale));
+        }
+        else
+        {
+            code = ((a + (1U << (shift - 1)) - 1U + ((a >> shift) & 1U)) >> shift)
+                - ((127U - bias) << MantissaBits);
+        }
+        return static_cast<unsigned char>(sign | (code < max_code ? code : max_code));
+    }
+
+    // Conversions of float values to 8-bit outputs (rounded to nearest, saturated)
+    FQUALIFIERS
+    void float_to_8bit(float v, rocrand_fp8_e4m3& r)
+    {
+        r.data = float_to_fp8<4, 3>(v);
+    }
+
+    FQUALIFIERS
+    void float_to_8bit(float v, rocrand_fp8_e5m2& r)
+    {
+        r.data = float_to_fp8<5, 2>(v);
+    }
+
+    FQUALIFIERS
+    void float_to_8bit(float v, signed char& r)
+    {
+        const float x = rintf(v);
+        r = static_cast<signed char>(x < -128.0f ? -128.0f : (x > 127.0f ? 127.0f : x));
+    }
+
+    // FP8 formats have at most 4 significant bits, so 8 random bits are enough
+    // for a uniform value in (0, 1] and four values are generated from every
+    // 32-bit engine value
+    template<class T>
+    FQUALIFIERS
+    T uniform_distribution_fp8(unsigned int v)
+    {
+        T r;
+        float_to_8bit((1.0f + (v & 0xffU)) * (1.0f / 256.0f), r);
+        return r;
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
 #endif // ROCRAND_RNG_DISTRIBUTION_DEVICE_DISTRIBUTIONS_H_
@@ -28,6 +28,7 @@
 #include <rocrand.h>
 
 #include "device_distributions.hpp"
+#include "../allocator.hpp"
 
 // Alias method
 //
@@ -44,6 +45,522 @@ enum rocrand_discrete_method
     ROCRAND_DISCRETE_METHOD_UNIVERSAL = ROCRAND_DISCRETE_METHOD_ALIAS | ROCRAND_DISCRETE_METHOD_CDF
 };
 
+namespace rocrand_host {
+namespace detail {
+
+    // Construction of alias and CDF tables on the device from probabilities
+    // in device memory.
+    //
+    // The alias table is the one built by the sweeping algorithm: light items
+    // (normalized weight w < 1) in index order take their missing weight from
+    // the current heavy item, a heavy item that drops below 1 becomes a light
+    // item taking the rest from the next heavy item. With prefix sums of
+    // deficits of light items D(i) and of excesses of heavy items E(k),
+    // the i-th light item is paired with the first heavy item k such that
+    // E(k) >= D(i - 1), and the k-th heavy item drops below 1 after the first
+    // light item i such that D(i) > E(k), with weight 1 + E(k) - D(i).
+    // So all items are processed in parallel with binary searches.
+    //
+    // Hübschle-Schneider L., Sanders P.
+    // Parallel Weighted Random Sampling, 2019
+
+    constexpr unsigned int discrete_block_size = 256;
+
+    // Generators load packed alias tables of up to this number of values
+    // to shared memory (16 KB)
+    constexpr unsigned int discrete_shared_capacity = 2048;
+
+    // Inclusive scan of blocks of BlockSize values, totals of blocks are
+    // saved to block_sums (if not NULL)
+    template<unsigned int BlockSize, class T>
+    __global__
+    void discrete_scan_blocks_kernel(T * data, const size_t n, T * block_sums)
+    {
+        __shared__ T values[BlockSize];
+
+        const unsigned int tid = hipThreadIdx_x;
+        const size_t index = static_cast<size_t>(hipBlockIdx_x) * BlockSize + tid;
+
+        values[tid] = index < n ? data[index] : T(0);
+        __syncthreads();
+        for(unsigned int offset = 1; offset < BlockSize; offset *= 2)
+        {
+            const T v = tid >= offset ? values[tid - offset] : T(0);
+            __syncthreads();
+            values[tid] += v;
+            __syncthreads();
+        }
+
+        if(index < n)
+        {
+            data[index] = values[tid];
+        }
+        if(block_sums != NULL && tid == BlockSize - 1)
+        {
+            block_sums[hipBlockIdx_x] = values[tid];
+        }
+    }
+
+    template<unsigned int BlockSize, class T>
+    __global__
+    void discrete_add_block_offsets_kernel(T * data, const size_t n, const T * scanned_block_sums)
+    {
+        const size_t index = static_cast<size_t>(hipBlockIdx_x) * BlockSize + hipThreadIdx_x;
+        if(hipBlockIdx_x > 0 && index < n)
+        {
+            data[index] += scanned_block_sums[hipBlockIdx_x - 1];
+        }
+    }
+
+    // In-place inclusive prefix sum of n values in device memory
+    template<class T>
+    inline
+    rocrand_status discrete_inclusive_scan(T * data, const size_t n)
+    {
+        const size_t blocks = (n + discrete_block_size - 1) / discrete_block_size;
+        if(blocks <= 1)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(discrete_scan_blocks_kernel<discrete_block_size, T>),
+                dim3(1), dim3(discrete_block_size), 0, 0,
+                data, n, static_cast<T *>(NULL)
+            );
+            if(hipPeekAtLastError() != hipSuccess)
+                return ROCRAND_STATUS_LAUNCH_FAILURE;
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        T * block_sums;
+        if(device_malloc(&block_sums, sizeof(T) * blocks, 0) != hipSuccess)
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+
+        rocrand_status status = ROCRAND_STATUS_SUCCESS;
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(discrete_scan_blocks_kernel<discrete_block_size, T>),
+            dim3(blocks), dim3(discrete_block_size), 0, 0,
+            data, n, block_sums
+        );
+        if(hipPeekAtLastError() != hipSuccess)
+            status = ROCRAND_STATUS_LAUNCH_FAILURE;
+        if(status == ROCRAND_STATUS_SUCCESS)
+            status = discrete_inclusive_scan(block_sums, blocks);
+        if(status == ROCRAND_STATUS_SUCCESS)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(discrete_add_block_offsets_kernel<discrete_block_size, T>),
+                dim3(blocks), dim3(discrete_block_size), 0, 0,
+                data, n, block_sums
+            );
+            if(hipPeekAtLastError() != hipSuccess)
+                status = ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+
+        device_free(block_sums, 0);
+        return status;
+    }
+
+    // Weight of the item normalized so the average weight is 1
+    __forceinline__ __device__ __host__
+    double discrete_weight(const double * probabilities, const size_t index,
+                           const unsigned int size, const double * total)
+    {
+        return probabilities[index] * size / *total;
+    }
+
+    // Sets *invalid if a probability is negative (or NaN)
+    template<unsigned int BlockSize>
+    __global__
+    void discrete_validate_kernel(const double * probabilities, const unsigned int size,
+                                  unsigned int * invalid)
+    {
+        const size_t index = static_cast<size_t>(hipBlockIdx_x) * BlockSize + hipThreadIdx_x;
+        if(index < size && !(probabilities[index] >= 0.0))
+        {
+            *invalid = 1;
+        }
+    }
+
+    template<unsigned int BlockSize>
+    __global__
+    void discrete_normalize_cdf_kernel(double * cdf, const double * scan,
+                                       const unsigned int size, const double * total)
+    {
+        const size_t index = static_cast<size_t>(hipBlockIdx_x) * BlockSize + hipThreadIdx_x;
+        if(index < size)
+        {
+            cdf[index] = scan[index] / *total;
+        }
+    }
+
+    template<unsigned int BlockSize>
+    __global__
+    void discrete_classify_kernel(const double * probabilities, const unsigned int size,
+                                  const double * total, unsigned int * is_light)
+    {
+        const size_t index = static_cast<size_t>(hipBlockIdx_x) * BlockSize + hipThreadIdx_x;
+        if(index < size)
+        {
+            is_light[index] = discrete_weight(probabilities, index, size, total) < 1.0 ? 1 : 0;
+        }
+    }
+
+    // Stable partition: light items to [0, lights), heavy items to [lights, size)
+    // of order, deficits of light items and excesses of heavy items are
+    // saved to the beginnings of deficits and excesses
+    template<unsigned int BlockSize>
+    __global__
+    void discrete_partition_kernel(const double * probabilities, const unsigned int size,
+                                   const double * total, const unsigned int * lights_scan,
+                                   unsigned int * order, double * deficits, double * excesses)
+    {
+        const size_t index = static_cast<size_t>(hipBlockIdx_x) * BlockSize + hipThreadIdx_x;
+        if(index >= size)
+            return;
+
+        const unsigned int lights = lights_scan[size - 1];
+        const double w = discrete_weight(probabilities, index, size, total);
+        const unsigned int light_id = lights_scan[index] - 1;
+        const unsigned int heavy_id = index - lights_scan[index];
+        if(w < 1.0)
+        {
+            order[light_id] = index;
+            deficits[light_id] = 1.0 - w;
+        }
+        else
+        {
+            order[lights + heavy_id] = index;
+            excesses[heavy_id] = w - 1.0;
+        }
+    }
+
+    // Returns the first position in sorted values[0, n) with values[i] >= x
+    // (or values[i] > x if Strict), or n
+    template<bool Strict>
+    __forceinline__ __device__ __host__
+    unsigned int discrete_search(const double * values, const unsigned int n, const double x)
+    {
+        unsigned int min = 0;
+        unsigned int max = n;
+        while(min < max)
+        {
+            const unsigned int center = min + (max - min) / 2;
+            const bool before = Strict ? values[center] <= x : values[center] < x;
+            if(before)
+            {
+                min = center + 1;
+            }
+            else
+            {
+                max = center;
+            }
+        }
+        return min;
+    }
+
+    // Number of bits of the guide table index: the table has 2^bits >= size
+    // intervals, so most intervals contain at most one CDF value
+    inline
+    unsigned int discrete_guide_bits(const unsigned int size)
+    {
+        unsigned int bits = 0;
+        while (bits < 32 && (1ULL << bits) < size)
+        {
+            bits++;
+        }
+        return bits;
+    }
+
+    // The first index with cdf[index] >= j / 2^bits, or size - 1
+    __forceinline__ __device__ __host__
+    unsigned int discrete_guide_entry(const double * cdf, const unsigned int size,
+                                      const unsigned int bits, const unsigned long long j)
+    {
+        const double x = static_cast<double>(j) / static_cast<double>(1ULL << bits);
+        const unsigned int index = discrete_search<false>(cdf, size, x);
+        return index < size - 1 ? index : size - 1;
+    }
+
+    template<unsigned int BlockSize>
+    __global__
+    void discrete_guide_kernel(const double * cdf, const unsigned int size,
+                               const unsigned int bits, unsigned int * guide)
+    {
+        const size_t j = static_cast<size_t>(hipBlockIdx_x) * BlockSize + hipThreadIdx_x;
+        if(j <= (1ULL << bits))
+        {
+            guide[j] = discrete_guide_entry(cdf, size, bits, j);
+        }
+    }
+
+    // Creates the guide table of cdf in device memory
+    inline
+    rocrand_status create_discrete_guide(const double * cdf, const unsigned int size,
+                                         const unsigned int bits, unsigned int * guide)
+    {
+        const size_t entries = (1ULL << bits) + 1;
+        const size_t blocks = (entries + discrete_block_size - 1) / discrete_block_size;
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(discrete_guide_kernel<discrete_block_size>),
+            dim3(blocks), dim3(discrete_block_size), 0, 0,
+            cdf, size, bits, guide
+        );
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<unsigned int BlockSize>
+    __global__
+    void discrete_alias_kernel(const double * probabilities, const unsigned int size,
+                               const double * total, const unsigned int * lights_scan,
+                               const unsigned int * order,
+                               const double * deficits_scan, const double * excesses_scan,
+                               double * probability, unsigned int * alias)
+    {
+        const size_t id = static_cast<size_t>(hipBlockIdx_x) * BlockSize + hipThreadIdx_x;
+        if(id >= size)
+            return;
+
+        const unsigned int lights = lights_scan[size - 1];
+        const unsigned int heavies = size - lights;
+        const unsigned int index = order[id];
+        if(id < lights)
+        {
+            // Light item
+            const unsigned int i = id;
+            const double w = discrete_weight(probabilities, index, size, total);
+            if(heavies == 0)
+            {
+                // Rounding errors: all weights are almost 1
+                probability[index] = 1.0;
+                alias[index] = index;
+                return;
+            }
+            const double d = i == 0 ? 0.0 : deficits_scan[i - 1];
+            unsigned int k = discrete_search<false>(excesses_scan, heavies, d);
+            k = k < heavies ? k : heavies - 1;
+            probability[index] = w;
+            alias[index] = order[lights + k];
+        }
+        else
+        {
+            // Heavy item
+            const unsigned int k = id - lights;
+            const unsigned int i = lights > 0 && k + 1 < heavies
+                ? discrete_search<true>(deficits_scan, lights, excesses_scan[k])
+                : lights;
+            if(i == lights)
+            {
+                // Never drops below 1
+                probability[index] = 1.0;
+                alias[index] = index;
+                return;
+            }
+            const double w = 1.0 + excesses_scan[k] - deficits_scan[i];
+            probability[index] = w < 0.0 ? 0.0 : w;
+            alias[index] = order[lights + k + 1];
+        }
+    }
+
+    // Packs an entry of the alias table: alias to the high 32 bits and
+    // probability as 0.32 fixed point to the low 32 bits. The probability is
+    // rounded up, so for 32-bit fractions y, y < p is equivalent to
+    // y / 2^32 < probability; if it is 1 the value itself is used as alias.
+    __forceinline__ __device__ __host__
+    unsigned long long pack_alias_entry(const double probability,
+                                        const unsigned int alias,
+                                        const unsigned int index)
+    {
+        const double p = ceil(probability * 4294967296.0);
+        if(p >= 4294967296.0)
+        {
+            return (static_cast<unsigned long long>(index) << 32) | 0xFFFFFFFFU;
+        }
+        return (static_cast<unsigned long long>(alias) << 32) | static_cast<unsigned int>(p);
+    }
+
+    template<unsigned int BlockSize>
+    __global__
+    void discrete_pack_kernel(const double * probability, const unsigned int * alias,
+                              const unsigned int size, unsigned long long * alias_table)
+    {
+        const size_t index = static_cast<size_t>(hipBlockIdx_x) * BlockSize + hipThreadIdx_x;
+        if(index < size)
+        {
+            alias_table[index] = pack_alias_entry(probability[index], alias[index], index);
+        }
+    }
+
+    // Creates tables for size probabilities in device memory: alias table
+    // (if probability is not NULL) and/or CDF and its guide table with
+    // 2^guide_bits intervals (if cdf is not NULL). Negative probabilities and
+    // probabilities with zero sum are rejected with ROCRAND_STATUS_OUT_OF_RANGE.
+    inline
+    rocrand_status create_discrete_tables(const double * probabilities, const unsigned int size,
+                                          double * probability, unsigned int * alias,
+                                          unsigned long long * alias_table, double * cdf,
+                                          unsigned int * guide, const unsigned int guide_bits)
+    {
+        const size_t blocks = (static_cast<size_t>(size) + discrete_block_size - 1) / discrete_block_size;
+
+        double * scan = NULL;
+        double * excesses = NULL;
+        double * total = NULL;
+        unsigned int * invalid = NULL;
+        unsigned int * lights_scan = NULL;
+        unsigned int * order = NULL;
+
+        rocrand_status status = ROCRAND_STATUS_SUCCESS;
+        if(device_malloc(&scan, sizeof(double) * size, 0) != hipSuccess
+            || device_malloc(&total, sizeof(double), 0) != hipSuccess
+            || device_malloc(&invalid, sizeof(unsigned int), 0) != hipSuccess)
+        {
+            status = ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        if(status == ROCRAND_STATUS_SUCCESS && probability != NULL)
+        {
+            if(device_malloc(&excesses, sizeof(double) * size, 0) != hipSuccess
+                || device_malloc(&lights_scan, sizeof(unsigned int) * size, 0) != hipSuccess
+                || device_malloc(&order, sizeof(unsigned int) * size, 0) != hipSuccess)
+            {
+                status = ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+        }
+
+        // Sum of probabilities
+        if(status == ROCRAND_STATUS_SUCCESS)
+        {
+            if(hipMemcpy(scan, probabilities, sizeof(double) * size, hipMemcpyDeviceToDevice) != hipSuccess)
+                status = ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        if(status == ROCRAND_STATUS_SUCCESS)
+            status = discrete_inclusive_scan(scan, size);
+        if(status == ROCRAND_STATUS_SUCCESS)
+        {
+            if(hipMemcpy(total, scan + size - 1, sizeof(double), hipMemcpyDeviceToDevice) != hipSuccess)
+                status = ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        // Validation of probabilities
+        if(status == ROCRAND_STATUS_SUCCESS)
+        {
+            if(hipMemset(invalid, 0, sizeof(unsigned int)) != hipSuccess)
+                status = ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        if(status == ROCRAND_STATUS_SUCCESS)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(discrete_validate_kernel<discrete_block_size>),
+                dim3(blocks), dim3(discrete_block_size), 0, 0,
+                probabilities, size, invalid
+            );
+            if(hipPeekAtLastError() != hipSuccess)
+                status = ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+        if(status == ROCRAND_STATUS_SUCCESS)
+        {
+            unsigned int h_invalid;
+            double h_total;
+            if(hipMemcpy(&h_invalid, invalid, sizeof(unsigned int), hipMemcpyDeviceToHost) != hipSuccess
+                || hipMemcpy(&h_total, total, sizeof(double), hipMemcpyDeviceToHost) != hipSuccess)
+            {
+                status = ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            else if(h_invalid != 0 || !(h_total > 0.0))
+            {
+                status = ROCRAND_STATUS_OUT_OF_RANGE;
+            }
+        }
+
+        if(status == ROCRAND_STATUS_SUCCESS && cdf != NULL)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(discrete_normalize_cdf_kernel<discrete_block_size>),
+                dim3(blocks), dim3(discrete_block_size), 0, 0,
+                cdf, scan, size, total
+            );
+            if(hipPeekAtLastError() != hipSuccess)
+                status = ROCRAND_STATUS_LAUNCH_FAILURE;
+            if(status == ROCRAND_STATUS_SUCCESS)
+                status = create_discrete_guide(cdf, size, guide_bits, guide);
+        }
+
+        if(status == ROCRAND_STATUS_SUCCESS && probability != NULL)
+        {
+            // scan is reused for deficits
+            double * deficits = scan;
+            if(hipMemset(deficits, 0, sizeof(double) * size) != hipSuccess
+                || hipMemset(excesses, 0, sizeof(double) * size) != hipSuccess)
+            {
+                status = ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            if(status == ROCRAND_STATUS_SUCCESS)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(discrete_classify_kernel<discrete_block_size>),
+                    dim3(blocks), dim3(discrete_block_size), 0, 0,
+                    probabilities, size, total, lights_scan
+                );
+                if(hipPeekAtLastError() != hipSuccess)
+                    status = ROCRAND_STATUS_LAUNCH_FAILURE;
+            }
+            if(status == ROCRAND_STATUS_SUCCESS)
+                status = discrete_inclusive_scan(lights_scan, size);
+            if(status == ROCRAND_STATUS_SUCCESS)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(discrete_partition_kernel<discrete_block_size>),
+                    dim3(blocks), dim3(discrete_block_size), 0, 0,
+                    probabilities, size, total, lights_scan, order, deficits, excesses
+                );
+                if(hipPeekAtLastError() != hipSuccess)
+                    status = ROCRAND_STATUS_LAUNCH_FAILURE;
+            }
+            if(status == ROCRAND_STATUS_SUCCESS)
+                status = discrete_inclusive_scan(deficits, size);
+            if(status == ROCRAND_STATUS_SUCCESS)
+                status = discrete_inclusive_scan(excesses, size);
+            if(status == ROCRAND_STATUS_SUCCESS)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(discrete_alias_kernel<discrete_block_size>),
+                    dim3(blocks), dim3(discrete_block_size), 0, 0,
+                    probabilities, size, total, lights_scan, order,
+                    deficits, excesses, probability, alias
+                );
+                if(hipPeekAtLastError() != hipSuccess)
+                    status = ROCRAND_STATUS_LAUNCH_FAILURE;
+            }
+            if(status == ROCRAND_STATUS_SUCCESS)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(discrete_pack_kernel<discrete_block_size>),
+                    dim3(blocks), dim3(discrete_block_size), 0, 0,
+                    probability, alias, size, alias_table
+                );
+                if(hipPeekAtLastError() != hipSuccess)
+                    status = ROCRAND_STATUS_LAUNCH_FAILURE;
+            }
+        }
+
+        if(status == ROCRAND_STATUS_SUCCESS)
+        {
+            if(hipDeviceSynchronize() != hipSuccess)
+                status = ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        device_free(scan, 0);
+        device_free(excesses, 0);
+        device_free(total, 0);
+        device_free(invalid, 0);
+        device_free(lights_scan, 0);
+        device_free(order, 0);
+        return status;
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
 template<rocrand_discrete_method Method = ROCRAND_DISCRETE_METHOD_ALIAS, bool IsHostSide = false>
 class rocrand_discrete_distribution_base : public rocrand_discrete_distribution_st
 {
@@ -57,7 +574,10 @@ public:
         size = 0;
         probability = NULL;
         alias = NULL;
+        alias_table = NULL;
         cdf = NULL;
+        guide = NULL;
+        guide_bits = 0;
     }
 
     rocrand_discrete_distribution_base(const double * probabilities,
@@ -70,10 +590,119 @@ public:
         init(p, size, offset);
     }
 
+    // Uses tables of an existing distribution, the tables are not copied
+    // and not owned
+    explicit rocrand_discrete_distribution_base(const rocrand_discrete_distribution_st& tables)
+        : rocrand_discrete_distribution_st(tables)
+    { }
+
     __host__ __device__
     ~rocrand_discrete_distribution_base() { }
 
-    void deallocate()
+    // Copies device tables of an existing distribution (host tables only)
+    void init_from_device(const rocrand_discrete_distribution_st& tables)
+    {
+        static_assert(IsHostSide, "Tables are copied to the host");
+
+        if (((Method & ROCRAND_DISCRETE_METHOD_ALIAS) != 0
+                && (tables.probability == NULL || tables.alias == NULL || tables.alias_table == NULL))
+            || ((Method & ROCRAND_DISCRETE_METHOD_CDF) != 0 && tables.cdf == NULL))
+        {
+            throw ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+
+        this->size = tables.size;
+        this->offset = tables.offset;
+        this->guide_bits = rocrand_host::detail::discrete_guide_bits(tables.size);
+
+        deallocate();
+        allocate();
+        hipError_t error = hipSuccess;
+        if ((Method & ROCRAND_DISCRETE_METHOD_ALIAS) != 0)
+        {
+            error = hipMemcpy(probability, tables.probability, sizeof(double) * size, hipMemcpyDeviceToHost);
+            if (error == hipSuccess)
+            {
+                error = hipMemcpy(alias, tables.alias, sizeof(unsigned int) * size, hipMemcpyDeviceToHost);
+            }
+            if (error == hipSuccess)
+            {
+                error = hipMemcpy(alias_table, tables.alias_table, sizeof(unsigned long long) * size, hipMemcpyDeviceToHost);
+            }
+        }
+        if (error == hipSuccess && (Method & ROCRAND_DISCRETE_METHOD_CDF) != 0)
+        {
+            error = hipMemcpy(cdf, tables.cdf, sizeof(double) * size, hipMemcpyDeviceToHost);
+        }
+        if (error != hipSuccess)
+        {
+            throw ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        if ((Method & ROCRAND_DISCRETE_METHOD_CDF) != 0)
+        {
+            create_guide(cdf);
+        }
+    }
+
+    // Creates tables on the device from size probabilities in device memory,
+    // probabilities are not copied to the host (device tables only)
+    void init_device(const double * probabilities,
+                     const unsigned int size,
+                     const unsigned int offset)
+    {
+        static_assert(!IsHostSide, "Tables are created on the device");
+
+        this->size = size;
+        this->offset = offset;
+        this->guide_bits = rocrand_host::detail::discrete_guide_bits(size);
+
+        deallocate();
+        allocate();
+        const rocrand_status status = rocrand_host::detail::create_discrete_tables(
+            probabilities, size,
+            (Method & ROCRAND_DISCRETE_METHOD_ALIAS) != 0 ? probability : NULL, alias, alias_table,
+            (Method & ROCRAND_DISCRETE_METHOD_CDF) != 0 ? cdf : NULL, guide, guide_bits
+        );
+        if (status != ROCRAND_STATUS_SUCCESS)
+        {
+            throw status;
+        }
+    }
+
+    /// Returns size in bytes of tables in device memory (0 for host-side tables)
+    size_t device_bytes() const
+    {
+        if (IsHostSide)
+        {
+            return 0;
+        }
+        size_t bytes = 0;
+        if ((Method & ROCRAND_DISCRETE_METHOD_ALIAS) != 0)
+        {
+            bytes += (sizeof(double) + sizeof(unsigned int) + sizeof(unsigned long long)) * size;
+        }
+        if ((Method & ROCRAND_DISCRETE_METHOD_CDF) != 0)
+        {
+            bytes += sizeof(double) * size + sizeof(unsigned int) * guide_entries();
+        }
+        return bytes;
+    }
+
+    // Copies the packed alias table to table in shared memory and uses it,
+    // must be called by all threads of the block
+    __device__
+    void load_shared(unsigned long long * table)
+    {
+        for (unsigned int i = hipThreadIdx_x; i < size; i += hipBlockDim_x)
+        {
+            table[i] = alias_table[i];
+        }
+        __syncthreads();
+        alias_table = table;
+    }
+
+    // Device tables are freed in stream (after kernels using them)
+    void deallocate(hipStream_t stream = 0)
     {
         // Explicit deallocation is used because on HCC the object is copied
         // multiple times inside hipLaunchKernelGGL, and destructor is called
@@ -88,29 +717,47 @@ public:
             {
                 delete[] alias;
             }
+            if (alias_table != NULL)
+            {
+                delete[] alias_table;
+            }
             if (cdf != NULL)
             {
                 delete[] cdf;
             }
+            if (guide != NULL)
+            {
+                delete[] guide;
+            }
         }
         else
         {
             if (probability != NULL)
             {
-                hipFree(probability);
+                rocrand_host::detail::device_free(probability, stream);
             }
             if (alias != NULL)
             {
-                hipFree(alias);
+                rocrand_host::detail::device_free(alias, stream);
+            }
+            if (alias_table != NULL)
+            {
+                rocrand_host::detail::device_free(alias_table, stream);
             }
             if (cdf != NULL)
             {
-                hipFree(cdf);
+                rocrand_host::detail::device_free(cdf, stream);
+            }
+            if (guide != NULL)
+            {
+                rocrand_host::detail::device_free(guide, stream);
             }
         }
         probability = NULL;
         alias = NULL;
+        alias_table = NULL;
         cdf = NULL;
+        guide = NULL;
     }
 
     __forceinline__ __host__ __device__
@@ -126,6 +773,13 @@ public:
         }
     }
 
+    // 64-bit quasi-random values (Sobol64)
+    __forceinline__ __host__ __device__
+    unsigned int operator()(const unsigned long long x) const
+    {
+        return (*this)(static_cast<unsigned int>(x >> 32));
+    }
+
     __host__ __device__
     void operator()(const unsigned int (&input)[1], unsigned int output[1]) const
     {
@@ -140,10 +794,11 @@ protected:
     {
         this->size = size;
         this->offset = offset;
+        this->guide_bits = rocrand_host::detail::discrete_guide_bits(size);
 
+        normalize(p);
         deallocate();
         allocate();
-        normalize(p);
         if ((Method & ROCRAND_DISCRETE_METHOD_ALIAS) != 0)
         {
             create_alias_table(p);
@@ -162,10 +817,12 @@ protected:
             {
                 probability = new double[size];
                 alias = new unsigned int[size];
+                alias_table = new unsigned long long[size];
             }
             if ((Method & ROCRAND_DISCRETE_METHOD_CDF) != 0)
             {
                 cdf = new double[size];
+                guide = new unsigned int[guide_entries()];
             }
         }
         else
@@ -173,12 +830,17 @@ protected:
             hipError_t error;
             if ((Method & ROCRAND_DISCRETE_METHOD_ALIAS) != 0)
             {
-                error = hipMalloc(&probability, sizeof(double) * size);
+                error = rocrand_host::detail::device_malloc(&probability, sizeof(double) * size, 0);
                 if (error != hipSuccess)
                 {
                     throw ROCRAND_STATUS_ALLOCATION_FAILED;
                 }
-                error = hipMalloc(&alias, sizeof(unsigned int) * size);
+                error = rocrand_host::detail::device_malloc(&alias, sizeof(unsigned int) * size, 0);
+                if (error != hipSuccess)
+                {
+                    throw ROCRAND_STATUS_ALLOCATION_FAILED;
+                }
+                error = rocrand_host::detail::device_malloc(&alias_table, sizeof(unsigned long long) * size, 0);
                 if (error != hipSuccess)
                 {
                     throw ROCRAND_STATUS_ALLOCATION_FAILED;
@@ -186,7 +848,12 @@ protected:
             }
             if ((Method & ROCRAND_DISCRETE_METHOD_CDF) != 0)
             {
-                error = hipMalloc(&cdf, sizeof(double) * size);
+                error = rocrand_host::detail::device_malloc(&cdf, sizeof(double) * size, 0);
+                if (error != hipSuccess)
+                {
+                    throw ROCRAND_STATUS_ALLOCATION_FAILED;
+                }
+                error = rocrand_host::detail::device_malloc(&guide, sizeof(unsigned int) * guide_entries(), 0);
                 if (error != hipSuccess)
                 {
                     throw ROCRAND_STATUS_ALLOCATION_FAILED;
@@ -195,13 +862,22 @@ protected:
         }
     }
 
+    // Negative probabilities and probabilities with zero sum are rejected
     void normalize(std::vector<double>& p)
     {
         double sum = 0.0;
         for (unsigned int i = 0; i < size; i++)
         {
+            if (!(p[i] >= 0.0))
+            {
+                throw ROCRAND_STATUS_OUT_OF_RANGE;
+            }
             sum += p[i];
         }
+        if (!(sum > 0.0))
+        {
+            throw ROCRAND_STATUS_OUT_OF_RANGE;
+        }
         // Normalize probabilities
         for (unsigned int i = 0; i < size; i++)
         {
@@ -264,10 +940,17 @@ protected:
             h_probability[i] = 1.0;
         }
 
+        std::vector<unsigned long long> h_alias_table(size);
+        for (unsigned int i = 0; i < size; i++)
+        {
+            h_alias_table[i] = rocrand_host::detail::pack_alias_entry(h_probability[i], h_alias[i], i);
+        }
+
         if (IsHostSide)
         {
             std::copy(h_probability.begin(), h_probability.end(), probability);
             std::copy(h_alias.begin(), h_alias.end(), alias);
+            std::copy(h_alias_table.begin(), h_alias_table.end(), alias_table);
         }
         else
         {
@@ -282,6 +965,11 @@ protected:
             {
                 throw ROCRAND_STATUS_INTERNAL_ERROR;
             }
+            error = hipMemcpy(alias_table, h_alias_table.data(), sizeof(unsigned long long) * size, hipMemcpyDefault);
+            if (error != hipSuccess)
+            {
+                throw ROCRAND_STATUS_INTERNAL_ERROR;
+            }
         }
     }
 
@@ -309,6 +997,67 @@ protected:
                 throw ROCRAND_STATUS_INTERNAL_ERROR;
             }
         }
+        create_guide(h_cdf.data());
+    }
+
+    size_t guide_entries() const
+    {
+        return (1ULL << guide_bits) + 1;
+    }
+
+    // Creates the guide table from the CDF in host memory
+    void create_guide(const double * h_cdf)
+    {
+        std::vector<unsigned int> h_guide(guide_entries());
+        for (size_t j = 0; j < h_guide.size(); j++)
+        {
+            h_guide[j] = rocrand_host::detail::discrete_guide_entry(h_cdf, size, guide_bits, j);
+        }
+
+        if (IsHostSide)
+        {
+            std::copy(h_guide.begin(), h_guide.end(), guide);
+        }
+        else
+        {
+            hipError_t error;
+            error = hipMemcpy(guide, h_guide.data(), sizeof(unsigned int) * h_guide.size(), hipMemcpyDefault);
+            if (error != hipSuccess)
+            {
+                throw ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+        }
+    }
+};
+
+template<class Distribution>
+struct mrg_discrete_distribution
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 1;
+
+    Distribution dis;
+
+    mrg_discrete_distribution(Distribution dis)
+        : dis(dis)
+    { }
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], unsigned int (&output)[1]) const
+    {
+        // Alias method requires x in [0, 1), uint must be in [0, UINT_MAX],
+        // but Mrg32k3a's "raw" output is in [1, ROCRAND_MRG32K3A_M1],
+        // so probabilities are slightly different than expected,
+        // some values can not be generated at all.
+        // Hence the "raw" value is remapped to [0, UINT_MAX]:
+        unsigned int v = rocrand_device::detail::mrg_uniform_distribution_uint(input[0]);
+        output[0] = dis(v);
+    }
+
+    __device__
+    void load_shared(unsigned long long * table)
+    {
+        dis.load_shared(table);
     }
 };
 
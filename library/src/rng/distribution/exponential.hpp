@@ -0,0 +1,169 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_EXPONENTIAL_H_
+#define ROCRAND_RNG_DISTRIBUTION_EXPONENTIAL_H_
+
+#include <math.h>
+#include <hip/hip_runtime.h>
+
+#include "device_distributions.hpp"
+
+// Inverse transform: -log(u) / lambda, u is in (0, 1] so values are finite
+
+
+// Universal
+
+template<class T>
+struct exponential_distribution;
+
+template<>
+struct exponential_distribution<float>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const float lambda;
+
+    __host__ __device__
+    exponential_distribution(float lambda)
+        : lambda(lambda) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], float (&output)[1]) const
+    {
+        output[0] = -logf(rocrand_device::detail::uniform_distribution(input[0])) / lambda;
+    }
+};
+
+template<>
+struct exponential_distribution<double>
+{
+    static constexpr unsigned int input_width = 2;
+    static constexpr unsigned int output_width = 1;
+
+    const double lambda;
+
+    __host__ __device__
+    exponential_distribution(double lambda)
+        : lambda(lambda) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[2], double (&output)[1]) const
+    {
+        output[0] = -log(rocrand_device::detail::uniform_distribution_double(input[0], input[1])) / lambda;
+    }
+};
+
+
+// Mrg32k3a
+
+template<class T>
+struct mrg_exponential_distribution;
+
+template<>
+struct mrg_exponential_distribution<float>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const float lambda;
+
+    __host__ __device__
+    mrg_exponential_distribution(float lambda)
+        : lambda(lambda) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], float (&output)[1]) const
+    {
+        output[0] = -logf(rocrand_device::detail::mrg_uniform_distribution(input[0])) / lambda;
+    }
+};
+
+template<>
+struct mrg_exponential_distribution<double>
+{
+    static constexpr unsigned int input_width = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const double lambda;
+
+    __host__ __device__
+    mrg_exponential_distribution(double lambda)
+        : lambda(lambda) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[1], double (&output)[1]) const
+    {
+        output[0] = -log(rocrand_device::detail::mrg_uniform_distribution_double(input[0])) / lambda;
+    }
+};
+
+
+// Sobol
+
+template<class T>
+struct sobol_exponential_distribution;
+
+template<>
+struct sobol_exponential_distribution<float>
+{
+    const float lambda;
+
+    __host__ __device__
+    sobol_exponential_distribution(float lambda)
+        : lambda(lambda) {}
+
+    __host__ __device__
+    float operator()(const unsigned int x) const
+    {
+        return -logf(rocrand_device::detail::uniform_distribution(x)) / lambda;
+    }
+
+    __host__ __device__
+    float operator()(const unsigned long long x) const
+    {
+        return -logf(rocrand_device::detail::uniform_distribution(static_cast<unsigned int>(x >> 32))) / lambda;
+    }
+};
+
+template<>
+struct sobol_exponential_distribution<double>
+{
+    const double lambda;
+
+    __host__ __device__
+    sobol_exponential_distribution(double lambda)
+        : lambda(lambda) {}
+
+    __host__ __device__
+    double operator()(const unsigned int x) const
+    {
+        return -log(rocrand_device::detail::uniform_distribution_double(x)) / lambda;
+    }
+
+    __host__ __device__
+    double operator()(const unsigned long long x) const
+    {
+        return -log(rocrand_device::detail::uniform_distribution_double(x)) / lambda;
+    }
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_EXPONENTIAL_H_
@@ -0,0 +1,178 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_GAMMA_H_
+#define ROCRAND_RNG_DISTRIBUTION_GAMMA_H_
+
+#include <math.h>
+#include <hip/hip_runtime.h>
+
+#include "device_distributions.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+// Marsaglia and Tsang, "A Simple Method for Generating Gamma Variables":
+// returns a gamma variate with shape d + 1/3 (>= 1) and scale 1, c = 1/sqrt(9d).
+// A normal value (ziggurat) and a uniform value are consumed per attempt,
+// more than 95% of attempts are accepted.
+template<class Generator>
+__forceinline__ __device__ __host__
+float marsaglia_tsang_gamma(Generator& generator, const float d, const float c)
+{
+    while(true)
+    {
+        float x, v;
+        do
+        {
+            x = rocrand_device::detail::ziggurat_normal(generator);
+            v = 1.0f + c * x;
+        } while(v <= 0.0f);
+        v = v * v * v;
+        const float u = rocrand_device::detail::uniform_distribution(generator());
+        const float xx = x * x;
+        if(u < 1.0f - 0.0331f * xx * xx)
+        {
+            return d * v;
+        }
+        if(logf(u) < 0.5f * xx + d * (1.0f - v + logf(v)))
+        {
+            return d * v;
+        }
+    }
+}
+
+template<class Generator>
+__forceinline__ __device__ __host__
+double marsaglia_tsang_gamma(Generator& generator, const double d, const double c)
+{
+    while(true)
+    {
+        double x, v;
+        do
+        {
+            x = rocrand_device::detail::ziggurat_normal_double(generator);
+            v = 1.0 + c * x;
+        } while(v <= 0.0);
+        v = v * v * v;
+        const double u = rocrand_device::detail::next_uniform_double(generator);
+        const double xx = x * x;
+        if(u < 1.0 - 0.0331 * xx * xx)
+        {
+            return d * v;
+        }
+        if(log(u) < 0.5 * xx + d * (1.0 - v + log(v)))
+        {
+            return d * v;
+        }
+    }
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+// Rejection distributions for generate_rejection kernels.
+// Shapes < 1 are generated as gamma(shape + 1) * u^(1 / shape).
+
+template<class T>
+struct gamma_distribution;
+
+template<>
+struct gamma_distribution<float>
+{
+    const float d;
+    const float c;
+    // 1 / shape if shape < 1, 0 otherwise
+    const float inv_shape;
+    const float scale;
+
+    __host__ __device__
+    gamma_distribution(float shape, float scale)
+        : d((shape < 1.0f ? shape + 1.0f : shape) - 1.0f / 3.0f),
+          c(1.0f / sqrtf(9.0f * d)),
+          inv_shape(shape < 1.0f ? 1.0f / shape : 0.0f),
+          scale(scale) {}
+
+    template<class Generator>
+    __forceinline__ __device__ __host__
+    float operator()(Generator& generator, size_t) const
+    {
+        float x = rocrand_host::detail::marsaglia_tsang_gamma(generator, d, c);
+        if(inv_shape > 0.0f)
+        {
+            const float u = rocrand_device::detail::uniform_distribution(generator());
+            x *= powf(u, inv_shape);
+        }
+        return x * scale;
+    }
+};
+
+template<>
+struct gamma_distribution<double>
+{
+    const double d;
+    const double c;
+    // 1 / shape if shape < 1, 0 otherwise
+    const double inv_shape;
+    const double scale;
+
+    __host__ __device__
+    gamma_distribution(double shape, double scale)
+        : d((shape < 1.0 ? shape + 1.0 : shape) - 1.0 / 3.0),
+          c(1.0 / sqrt(9.0 * d)),
+          inv_shape(shape < 1.0 ? 1.0 / shape : 0.0),
+          scale(scale) {}
+
+    template<class Generator>
+    __forceinline__ __device__ __host__
+    double operator()(Generator& generator, size_t) const
+    {
+        double x = rocrand_host::detail::marsaglia_tsang_gamma(generator, d, c);
+        if(inv_shape > 0.0)
+        {
+            const double u = rocrand_device::detail::next_uniform_double(generator);
+            x *= pow(u, inv_shape);
+        }
+        return x * scale;
+    }
+};
+
+// Beta: x / (x + y), x and y are gamma variates with shapes alpha and beta
+template<class T>
+struct beta_distribution
+{
+    const gamma_distribution<T> x;
+    const gamma_distribution<T> y;
+
+    __host__ __device__
+    beta_distribution(T alpha, T beta)
+        : x(alpha, T(1)), y(beta, T(1)) {}
+
+    template<class Generator>
+    __forceinline__ __device__ __host__
+    T operator()(Generator& generator, size_t index) const
+    {
+        const T gx = x(generator, index);
+        const T gy = y(generator, index);
+        return gx / (gx + gy);
+    }
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_GAMMA_H_
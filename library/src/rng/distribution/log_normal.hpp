@@ -40,15 +40,23 @@ struct log_normal_distribution<float>
 
     const float mean;
     const float stddev;
+    const bool fast_math;
 
     __host__ __device__
-    log_normal_distribution(float mean, float stddev)
-        : mean(mean), stddev(stddev) {}
+    log_normal_distribution(float mean, float stddev, bool fast_math = false)
+        : mean(mean), stddev(stddev), fast_math(fast_math) {}
 
     __host__ __device__
     void operator()(const unsigned int (&input)[2], float (&output)[2]) const
     {
-        float2 v = rocrand_device::detail::normal_distribution2(input[0], input[1]);
+        if(fast_math)
+        {
+            float2 v = rocrand_device::detail::normal_distribution2<true>(input[0], input[1]);
+            output[0] = rocrand_device::detail::normal_expf<true>(mean + v.x * stddev);
+            output[1] = rocrand_device::detail::normal_expf<true>(mean + v.y * stddev);
+            return;
+        }
+        float2 v = rocrand_device::detail::normal_distribution2<false>(input[0], input[1]);
         output[0] = expf(mean + v.x * stddev);
         output[1] = expf(mean + v.y * stddev);
     }
@@ -64,7 +72,7 @@ struct log_normal_distribution<double>
     const double stddev;
 
     __host__ __device__
-    log_normal_distribution(double mean, double stddev)
+    log_normal_distribution(double mean, double stddev, bool /* fast_math */ = false)
         : mean(mean), stddev(stddev) {}
 
     __host__ __device__
@@ -88,7 +96,7 @@ struct log_normal_distribution<__half>
     const __half2 stddev;
 
     __host__ __device__
-    log_normal_distribution(__half mean, __half stddev)
+    log_normal_distribution(__half mean, __half stddev, bool /* fast_math */ = false)
         : mean(mean, mean), stddev(stddev, stddev) {}
 
     __host__ __device__
@@ -118,15 +126,23 @@ struct mrg_log_normal_distribution<float>
 
     const float mean;
     const float stddev;
+    const bool fast_math;
 
     __host__ __device__
-    mrg_log_normal_distribution(float mean, float stddev)
-        : mean(mean), stddev(stddev) {}
+    mrg_log_normal_distribution(float mean, float stddev, bool fast_math = false)
+        : mean(mean), stddev(stddev), fast_math(fast_math) {}
 
     __host__ __device__
     void operator()(const unsigned int (&input)[2], float (&output)[2]) const
     {
-        float2 v = rocrand_device::detail::mrg_normal_distribution2(input[0], input[1]);
+        if(fast_math)
+        {
+            float2 v = rocrand_device::detail::mrg_normal_distribution2<true>(input[0], input[1]);
+            output[0] = rocrand_device::detail::normal_expf<true>(mean + v.x * stddev);
+            output[1] = rocrand_device::detail::normal_expf<true>(mean + v.y * stddev);
+            return;
+        }
+        float2 v = rocrand_device::detail::mrg_normal_distribution2<false>(input[0], input[1]);
         output[0] = expf(mean + v.x * stddev);
         output[1] = expf(mean + v.y * stddev);
     }
@@ -142,7 +158,7 @@ struct mrg_log_normal_distribution<double>
     const double stddev;
 
     __host__ __device__
-    mrg_log_normal_distribution(double mean, double stddev)
+    mrg_log_normal_distribution(double mean, double stddev, bool /* fast_math */ = false)
         : mean(mean), stddev(stddev) {}
 
     __host__ __device__
@@ -164,7 +180,7 @@ struct mrg_log_normal_distribution<__half>
     const __half2 stddev;
 
     __host__ __device__
-    mrg_log_normal_distribution(__half mean, __half stddev)
+    mrg_log_normal_distribution(__half mean, __half stddev, bool /* fast_math */ = false)
         : mean(mean, mean), stddev(stddev, stddev) {}
 
     __host__ __device__
@@ -191,17 +207,29 @@ struct sobol_log_normal_distribution<float>
 {
     const float mean;
     const float stddev;
+    const bool fast_math;
 
     __host__ __device__
-    sobol_log_normal_distribution(float mean, float stddev)
-        : mean(mean), stddev(stddev) {}
+    sobol_log_normal_distribution(float mean, float stddev, bool fast_math = false)
+        : mean(mean), stddev(stddev), fast_math(fast_math) {}
 
     __host__ __device__
     float operator()(const unsigned int x) const
     {
-        float v = rocrand_device::detail::normal_distribution(x);
+        if(fast_math)
+        {
+            float v = rocrand_device::detail::normal_distribution<true>(x);
+            return rocrand_device::detail::normal_expf<true>(mean + (stddev * v));
+        }
+        float v = rocrand_device::detail::normal_distribution<false>(x);
         return expf(mean + (stddev * v));
     }
+
+    __host__ __device__
+    float operator()(const unsigned long long x) const
+    {
+        return (*this)(static_cast<unsigned int>(x >> 32));
+    }
 };
 
 template<>
@@ -211,7 +239,7 @@ struct sobol_log_normal_distribution<double>
     const double stddev;
 
     __host__ __device__
-    sobol_log_normal_distribution(double mean, double stddev)
+    sobol_log_normal_distribution(double mean, double stddev, bool /* fast_math */ = false)
         : mean(mean), stddev(stddev) {}
 
     __host__ __device__
@@ -220,6 +248,13 @@ struct sobol_log_normal_distribution<double>
         double v = rocrand_device::detail::normal_distribution_double(x);
         return exp(mean + (stddev * v));
     }
+
+    __host__ __device__
+    double operator()(const unsigned long long x) const
+    {
+        double v = rocrand_device::detail::normal_distribution_double(x);
+        return exp(mean + (stddev * v));
+    }
 };
 
 template<>
@@ -229,7 +264,7 @@ struct sobol_log_normal_distribution<__half>
     const __half stddev;
 
     __host__ __device__
-    sobol_log_normal_distribution(__half mean, __half stddev)
+    sobol_log_normal_distribution(__half mean, __half stddev, bool /* fast_math */ = false)
         : mean(mean), stddev(stddev) {}
 
     __host__ __device__
@@ -242,6 +277,17 @@ struct sobol_log_normal_distribution<__half>
         return expf(__half2float(mean) + (__half2float(stddev) * v));
         #endif
     }
+
+    __host__ __device__
+    __half operator()(const unsigned long long x) const
+    {
+        float v = rocrand_device::detail::normal_distribution(static_cast<unsigned int>(x >> 32));
+        #if defined(ROCRAND_HALF_MATH_SUPPORTED)
+        return hexp(__hfma(__float2half(v), stddev, mean));
+        #else
+        return expf(__half2float(mean) + (__half2float(stddev) * v));
+        #endif
+    }
 };
 
 #endif // ROCRAND_RNG_DISTRIBUTION_LOG_NORMAL_H_
@@ -40,15 +40,18 @@ struct normal_distribution<float>
 
     const float mean;
     const float stddev;
+    const bool fast_math;
 
     __host__ __device__
-    normal_distribution(float mean, float stddev)
-        : mean(mean), stddev(stddev) {}
+    normal_distribution(float mean, float stddev, bool fast_math = false)
+        : mean(mean), stddev(stddev), fast_math(fast_math) {}
 
     __host__ __device__
     void operator()(const unsigned int (&input)[2], float (&output)[2]) const
     {
-        float2 v = rocrand_device::detail::normal_distribution2(input[0], input[1]);
+        float2 v = fast_math
+            ? rocrand_device::detail::normal_distribution2<true>(input[0], input[1])
+            : rocrand_device::detail::normal_distribution2<false>(input[0], input[1]);
         output[0] = mean + v.x * stddev;
         output[1] = mean + v.y * stddev;
     }
@@ -64,7 +67,7 @@ struct normal_distribution<double>
     const double stddev;
 
     __host__ __device__
-    normal_distribution(double mean, double stddev)
+    normal_distribution(double mean, double stddev, bool /* fast_math */ = false)
         : mean(mean), stddev(stddev) {}
 
     __host__ __device__
@@ -88,7 +91,7 @@ struct normal_distribution<__half>
     const __half2 stddev;
 
     __host__ __device__
-    normal_distribution(__half mean, __half stddev)
+    normal_distribution(__half mean, __half stddev, bool /* fast_math */ = false)
         : mean(mean, mean), stddev(stddev, stddev) {}
 
     __host__ __device__
@@ -104,6 +107,89 @@ struct normal_distribution<__half>
     }
 };
 
+template<>
+struct normal_distribution<hip_bfloat16>
+{
+    static constexpr unsigned int input_width = 4;
+    static constexpr unsigned int output_width = 8;
+
+    const float mean;
+    const float stddev;
+
+    __host__ __device__
+    normal_distribution(hip_bfloat16 mean, hip_bfloat16 stddev, bool /* fast_math */ = false)
+        : mean(static_cast<float>(mean)), stddev(static_cast<float>(stddev)) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[4], hip_bfloat16 (&output)[8]) const
+    {
+        for(unsigned int i = 0; i < 4; i++)
+        {
+            const float2 v = rocrand_host::detail::box_muller_bfloat16(input[i]);
+            output[2 * i] = rocrand_host::detail::float_to_bfloat16(mean + v.x * stddev);
+            output[2 * i + 1] = rocrand_host::detail::float_to_bfloat16(mean + v.y * stddev);
+        }
+    }
+};
+
+// Box-Muller values of 16-bit halves of engine values (see box_muller_bfloat16())
+// rounded to 8-bit types, 16 values (one 128-bit store) per thread and iteration.
+// 8-bit uniform values would truncate tails at 3.3 standard deviations.
+template<class T, bool Mrg>
+struct normal_8bit_distribution
+{
+    static constexpr unsigned int input_width = 8;
+    static constexpr unsigned int output_width = 16;
+
+    const float mean;
+    const float stddev;
+
+    __host__ __device__
+    normal_8bit_distribution(float mean, float stddev)
+        : mean(mean), stddev(stddev) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[8], T (&output)[16]) const
+    {
+        for(unsigned int i = 0; i < 8; i++)
+        {
+            const unsigned int u = Mrg
+                ? rocrand_device::detail::mrg_uniform_distribution_uint(input[i])
+                : input[i];
+            const float2 v = rocrand_host::detail::box_muller_bfloat16(u);
+            rocrand_host::detail::float_to_8bit(mean + v.x * stddev, output[2 * i]);
+            rocrand_host::detail::float_to_8bit(mean + v.y * stddev, output[2 * i + 1]);
+        }
+    }
+};
+
+template<>
+struct normal_distribution<signed char>
+    : public normal_8bit_distribution<signed char, false>
+{
+    __host__ __device__
+    normal_distribution(float mean, float stddev, bool /* fast_math */ = false)
+        : normal_8bit_distribution(mean, stddev) {}
+};
+
+template<>
+struct normal_distribution<rocrand_fp8_e4m3>
+    : public normal_8bit_distribution<rocrand_fp8_e4m3, false>
+{
+    __host__ __device__
+    normal_distribution(float mean, float stddev, bool /* fast_math */ = false)
+        : normal_8bit_distribution(mean, stddev) {}
+};
+
+template<>
+struct normal_distribution<rocrand_fp8_e5m2>
+    : public normal_8bit_distribution<rocrand_fp8_e5m2, false>
+{
+    __host__ __device__
+    normal_distribution(float mean, float stddev, bool /* fast_math */ = false)
+        : normal_8bit_distribution(mean, stddev) {}
+};
+
 
 // Mrg32k3a
 
@@ -118,15 +204,18 @@ struct mrg_normal_distribution<float>
 
     const float mean;
     const float stddev;
+    const bool fast_math;
 
     __host__ __device__
-    mrg_normal_distribution(float mean, float stddev)
-        : mean(mean), stddev(stddev) {}
+    mrg_normal_distribution(float mean, float stddev, bool fast_math = false)
+        : mean(mean), stddev(stddev), fast_math(fast_math) {}
 
     __host__ __device__
     void operator()(const unsigned int (&input)[2], float (&output)[2]) const
     {
-        float2 v = rocrand_device::detail::mrg_normal_distribution2(input[0], input[1]);
+        float2 v = fast_math
+            ? rocrand_device::detail::mrg_normal_distribution2<true>(input[0], input[1])
+            : rocrand_device::detail::mrg_normal_distribution2<false>(input[0], input[1]);
         output[0] = mean + v.x * stddev;
         output[1] = mean + v.y * stddev;
     }
@@ -142,7 +231,7 @@ struct mrg_normal_distribution<double>
     const double stddev;
 
     __host__ __device__
-    mrg_normal_distribution(double mean, double stddev)
+    mrg_normal_distribution(double mean, double stddev, bool /* fast_math */ = false)
         : mean(mean), stddev(stddev) {}
 
     __host__ __device__
@@ -164,7 +253,7 @@ struct mrg_normal_distribution<__half>
     const __half2 stddev;
 
     __host__ __device__
-    mrg_normal_distribution(__half mean, __half stddev)
+    mrg_normal_distribution(__half mean, __half stddev, bool /* fast_math */ = false)
         : mean(mean, mean), stddev(stddev, stddev) {}
 
     __host__ __device__
@@ -180,6 +269,60 @@ struct mrg_normal_distribution<__half>
     }
 };
 
+template<>
+struct mrg_normal_distribution<hip_bfloat16>
+{
+    static constexpr unsigned int input_width = 4;
+    static constexpr unsigned int output_width = 8;
+
+    const float mean;
+    const float stddev;
+
+    __host__ __device__
+    mrg_normal_distribution(hip_bfloat16 mean, hip_bfloat16 stddev, bool /* fast_math */ = false)
+        : mean(static_cast<float>(mean)), stddev(static_cast<float>(stddev)) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[4], hip_bfloat16 (&output)[8]) const
+    {
+        for(unsigned int i = 0; i < 4; i++)
+        {
+            const float2 v = rocrand_host::detail::box_muller_bfloat16(
+                rocrand_device::detail::mrg_uniform_distribution_uint(input[i])
+            );
+            output[2 * i] = rocrand_host::detail::float_to_bfloat16(mean + v.x * stddev);
+            output[2 * i + 1] = rocrand_host::detail::float_to_bfloat16(mean + v.y * stddev);
+        }
+    }
+};
+
+template<>
+struct mrg_normal_distribution<signed char>
+    : public normal_8bit_distribution<signed char, true>
+{
+    __host__ __device__
+    mrg_normal_distribution(float mean, float stddev, bool /* fast_math */ = false)
+        : normal_8bit_distribution(mean, stddev) {}
+};
+
+template<>
+struct mrg_normal_distribution<rocrand_fp8_e4m3>
+    : public normal_8bit_distribution<rocrand_fp8_e4m3, true>
+{
+    __host__ __device__
+    mrg_normal_distribution(float mean, float stddev, bool /* fast_math */ = false)
+        : normal_8bit_distribution(mean, stddev) {}
+};
+
+template<>
+struct mrg_normal_distribution<rocrand_fp8_e5m2>
+    : public normal_8bit_distribution<rocrand_fp8_e5m2, true>
+{
+    __host__ __device__
+    mrg_normal_distribution(float mean, float stddev, bool /* fast_math */ = false)
+        : normal_8bit_distribution(mean, stddev) {}
+};
+
 
 // Sobol
 
@@ -191,17 +334,26 @@ struct sobol_normal_distribution<float>
 {
     const float mean;
     const float stddev;
+    const bool fast_math;
 
     __host__ __device__
-    sobol_normal_distribution(float mean, float stddev)
-        : mean(mean), stddev(stddev) {}
+    sobol_normal_distribution(float mean, float stddev, bool fast_math = false)
+        : mean(mean), stddev(stddev), fast_math(fast_math) {}
 
     __host__ __device__
     float operator()(const unsigned int x) const
     {
-        float v = rocrand_device::detail::normal_distribution(x);
+        float v = fast_math
+            ? rocrand_device::detail::normal_distribution<true>(x)
+            : rocrand_device::detail::normal_distribution<false>(x);
         return mean + v * stddev;
     }
+
+    __host__ __device__
+    float operator()(const unsigned long long x) const
+    {
+        return (*this)(static_cast<unsigned int>(x >> 32));
+    }
 };
 
 template<>
@@ -211,7 +363,7 @@ struct sobol_normal_distribution<double>
     const double stddev;
 
     __host__ __device__
-    sobol_normal_distribution(double mean, double stddev)
+    sobol_normal_distribution(double mean, double stddev, bool /* fast_math */ = false)
         : mean(mean), stddev(stddev) {}
 
     __host__ __device__
@@ -220,6 +372,13 @@ struct sobol_normal_distribution<double>
         double v = rocrand_device::detail::normal_distribution_double(x);
         return mean + v * stddev;
     }
+
+    __host__ __device__
+    double operator()(const unsigned long long x) const
+    {
+        double v = rocrand_device::detail::normal_distribution_double(x);
+        return mean + v * stddev;
+    }
 };
 
 template<>
@@ -229,7 +388,7 @@ struct sobol_normal_distribution<__half>
     const __half stddev;
 
     __host__ __device__
-    sobol_normal_distribution(__half mean, __half stddev)
+    sobol_normal_distribution(__half mean, __half stddev, bool /* fast_math */ = false)
         : mean(mean), stddev(stddev) {}
 
     __host__ __device__
@@ -242,6 +401,182 @@ struct sobol_normal_distribution<__half>
         return __half2float(mean) + v * __half2float(stddev);
         #endif
     }
+
+    __host__ __device__
+    __half operator()(const unsigned long long x) const
+    {
+        float v = rocrand_device::detail::normal_distribution(static_cast<unsigned int>(x >> 32));
+        #if defined(ROCRAND_HALF_MATH_SUPPORTED)
+        return __hfma(__float2half(v), stddev, mean);
+        #else
+        return __half2float(mean) + v * __half2float(stddev);
+        #endif
+    }
+};
+
+template<>
+struct sobol_normal_distribution<hip_bfloat16>
+{
+    const float mean;
+    const float stddev;
+
+    __host__ __device__
+    sobol_normal_distribution(hip_bfloat16 mean, hip_bfloat16 stddev, bool /* fast_math */ = false)
+        : mean(static_cast<float>(mean)), stddev(static_cast<float>(stddev)) {}
+
+    __host__ __device__
+    hip_bfloat16 operator()(const unsigned int x) const
+    {
+        float v = rocrand_device::detail::normal_distribution(x);
+        return rocrand_host::detail::float_to_bfloat16(mean + v * stddev);
+    }
+
+    __host__ __device__
+    hip_bfloat16 operator()(const unsigned long long x) const
+    {
+        float v = rocrand_device::detail::normal_distribution(static_cast<unsigned int>(x >> 32));
+        return rocrand_host::detail::float_to_bfloat16(mean + v * stddev);
+    }
+};
+
+// 8-bit normal values of quasi-random values
+template<class T>
+struct sobol_normal_8bit_distribution
+{
+    const float mean;
+    const float stddev;
+
+    __host__ __device__
+    sobol_normal_8bit_distribution(float mean, float stddev)
+        : mean(mean), stddev(stddev) {}
+
+    __host__ __device__
+    T operator()(const unsigned int x) const
+    {
+        T r;
+        float v = rocrand_device::detail::normal_distribution(x);
+        rocrand_host::detail::float_to_8bit(mean + v * stddev, r);
+        return r;
+    }
+
+    __host__ __device__
+    T operator()(const unsigned long long x) const
+    {
+        return (*this)(static_cast<unsigned int>(x >> 32));
+    }
+};
+
+template<>
+struct sobol_normal_distribution<signed char>
+    : public sobol_normal_8bit_distribution<signed char>
+{
+    __host__ __device__
+    sobol_normal_distribution(float mean, float stddev, bool /* fast_math */ = false)
+        : sobol_normal_8bit_distribution(mean, stddev) {}
+};
+
+template<>
+struct sobol_normal_distribution<rocrand_fp8_e4m3>
+    : public sobol_normal_8bit_distribution<rocrand_fp8_e4m3>
+{
+    __host__ __device__
+    sobol_normal_distribution(float mean, float stddev, bool /* fast_math */ = false)
+        : sobol_normal_8bit_distribution(mean, stddev) {}
+};
+
+template<>
+struct sobol_normal_distribution<rocrand_fp8_e5m2>
+    : public sobol_normal_8bit_distribution<rocrand_fp8_e5m2>
+{
+    __host__ __device__
+    sobol_normal_distribution(float mean, float stddev, bool /* fast_math */ = false)
+        : sobol_normal_8bit_distribution(mean, stddev) {}
+};
+
+// Ziggurat
+// Rejection method: a value needs a variable number of engine values, so
+// generators use it with generate_rejection kernels instead of the
+// fixed-width input/output interface.
+
+template<class T>
+struct ziggurat_normal_distribution;
+
+template<>
+struct ziggurat_normal_distribution<float>
+{
+    const float mean;
+    const float stddev;
+
+    __host__ __device__
+    ziggurat_normal_distribution(float mean, float stddev)
+        : mean(mean), stddev(stddev) {}
+
+    template<class Generator>
+    __host__ __device__
+    float operator()(Generator& generator, size_t) const
+    {
+        return mean + rocrand_device::detail::ziggurat_normal(generator) * stddev;
+    }
+};
+
+template<>
+struct ziggurat_normal_distribution<double>
+{
+    const double mean;
+    const double stddev;
+
+    __host__ __device__
+    ziggurat_normal_distribution(double mean, double stddev)
+        : mean(mean), stddev(stddev) {}
+
+    template<class Generator>
+    __host__ __device__
+    double operator()(Generator& generator, size_t) const
+    {
+        return mean + rocrand_device::detail::ziggurat_normal_double(generator) * stddev;
+    }
+};
+
+template<>
+struct ziggurat_normal_distribution<__half>
+{
+    const __half mean;
+    const __half stddev;
+
+    __host__ __device__
+    ziggurat_normal_distribution(__half mean, __half stddev)
+        : mean(mean), stddev(stddev) {}
+
+    template<class Generator>
+    __host__ __device__
+    __half operator()(Generator& generator, size_t) const
+    {
+        float v = rocrand_device::detail::ziggurat_normal(generator);
+        #if defined(ROCRAND_HALF_MATH_SUPPORTED)
+        return __hfma(__float2half(v), stddev, mean);
+        #else
+        return __half2float(mean) + v * __half2float(stddev);
+        #endif
+    }
+};
+
+template<>
+struct ziggurat_normal_distribution<hip_bfloat16>
+{
+    const float mean;
+    const float stddev;
+
+    __host__ __device__
+    ziggurat_normal_distribution(hip_bfloat16 mean, hip_bfloat16 stddev)
+        : mean(static_cast<float>(mean)), stddev(static_cast<float>(stddev)) {}
+
+    template<class Generator>
+    __host__ __device__
+    hip_bfloat16 operator()(Generator& generator, size_t) const
+    {
+        float v = rocrand_device::detail::ziggurat_normal(generator);
+        return rocrand_host::detail::float_to_bfloat16(mean + v * stddev);
+    }
 };
 
 #endif // ROCRAND_RNG_DISTRIBUTION_NORMAL_H_
@@ -23,11 +23,15 @@
 
 #include <climits>
 #include <algorithm>
+#include <list>
+#include <utility>
 #include <vector>
 
 #include <rocrand.h>
 
 #include "discrete.hpp"
+#include "../common.hpp"
+#include "../profiling.hpp"
 
 template<rocrand_discrete_method Method = ROCRAND_DISCRETE_METHOD_ALIAS, bool IsHostSide = false>
 class rocrand_poisson_distribution : public rocrand_discrete_distribution_base<Method, IsHostSide>
@@ -109,61 +113,220 @@ protected:
     }
 };
 
-// Handles caching of precomputed tables for the distribution and recomputes
-// them only when lambda is changed (as these computations, device memory
-// allocations and copying take time).
+// Handles caching of precomputed tables for the distribution: keeps tables
+// of up to capacity most recently used lambdas and recomputes them only when
+// lambda is not cached (as these computations, device memory allocations and
+// copying take time).
 template<rocrand_discrete_method Method = ROCRAND_DISCRETE_METHOD_ALIAS, bool IsHostSide = false>
 class poisson_distribution_manager
 {
 public:
 
-    rocrand_poisson_distribution<Method, IsHostSide> dis;
+    typedef rocrand_poisson_distribution<Method, IsHostSide> distribution_type;
+
+    // Distribution of the last lambda passed to set_lambda()
+    distribution_type dis;
 
     poisson_distribution_manager()
-        : lambda(0.0)
+        : capacity(1), stats(NULL), stream(0)
     { }
 
     ~poisson_distribution_manager()
     {
-        dis.deallocate();
+        for (auto& entry : entries)
+        {
+            entry.second.deallocate(stream);
+        }
     }
 
-    void set_lambda(double new_lambda)
+    // Tables of a new lambda are allocated and copied synchronously, this is
+    // not allowed while work of stream is being captured into a graph
+    void set_lambda(double new_lambda, hipStream_t stream = 0)
     {
-        const bool changed = lambda != new_lambda;
-        if (changed)
+        // Evicted tables can be used by kernels launched in this stream
+        this->stream = stream;
+        auto it = std::find_if(
+            entries.begin(), entries.end(),
+            [new_lambda](const entry_type& entry) { return entry.first == new_lambda; }
+        );
+        if (it != entries.end())
+        {
+            // Move to the front (most recently used)
+            entries.splice(entries.begin(), entries, it);
+        }
+        else
         {
-            lambda = new_lambda;
-            dis.set_lambda(lambda);
+            if(!IsHostSide && rocrand_host::detail::is_stream_capturing(stream))
+            {
+                throw ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            rocrand_host::detail::profiling_range range("rocrand set_lambda");
+            entries.push_front(entry_type(new_lambda, distribution_type()));
+            try
+            {
+                entries.front().second.set_lambda(new_lambda);
+            }
+            catch (rocrand_status status)
+            {
+                entries.front().second.deallocate(stream);
+                entries.pop_front();
+                throw status;
+            }
+            if (stats != NULL)
+            {
+                stats->poisson_table_builds++;
+                stats->device_bytes_allocated += entries.front().second.device_bytes();
+            }
+            evict();
         }
+        dis = entries.front().second;
+    }
+
+    // Changes the maximum number of cached lambdas (at least 1)
+    void set_capacity(size_t new_capacity)
+    {
+        capacity = new_capacity;
+        evict();
+    }
+
+    // Table computations of the manager are counted in stats of the generator
+    void set_stats(rocrand_generator_stats * generator_stats)
+    {
+        stats = generator_stats;
+    }
+
+    // Raises the capacity to at least size lambdas, so tables of size
+    // lambdas can be used by one kernel
+    void reserve(size_t size)
+    {
+        capacity = std::max(capacity, size);
+    }
+
+    // Returns size of device memory of all cached tables
+    size_t device_bytes() const
+    {
+        size_t bytes = 0;
+        for (const auto& entry : entries)
+        {
+            bytes += entry.second.device_bytes();
+        }
+        return bytes;
+    }
+
+    // Frees all cached tables (rocrand_generator_trim()), the next
+    // set_lambda() computes its table again
+    void clear()
+    {
+        for (auto& entry : entries)
+        {
+            entry.second.deallocate(stream);
+        }
+        entries.clear();
+        dis = distribution_type();
     }
 
 private:
 
-    double lambda;
+    typedef std::pair<double, distribution_type> entry_type;
+
+    void evict()
+    {
+        while (entries.size() > capacity)
+        {
+            entries.back().second.deallocate(stream);
+            entries.pop_back();
+        }
+    }
+
+    size_t capacity;
+    rocrand_generator_stats * stats;
+    // Stream of the last set_lambda()
+    hipStream_t stream;
+    // Ordered from the most recently used
+    std::list<entry_type> entries;
 };
 
-struct mrg_poisson_distribution
+template<bool IsHostSide = false>
+using mrg_poisson_distribution =
+    mrg_discrete_distribution<rocrand_poisson_distribution<ROCRAND_DISCRETE_METHOD_ALIAS, IsHostSide>>;
+
+namespace rocrand_host {
+namespace detail {
+
+    // Wraps a generator of uniform 32-bit values (engine or rejection source
+    // of a generate_rejection kernel) into a state for the device API
+    // Poisson samplers, which use rocrand_uniform_double(state).
+    template<class Generator>
+    struct poisson_rejection_state
+    {
+        Generator& generator;
+    };
+
+    // Found by argument-dependent lookup in rocrand_device::detail samplers
+    template<class Generator>
+    __forceinline__ __device__ __host__
+    double rocrand_uniform_double(poisson_rejection_state<Generator> * state)
+    {
+        const unsigned int v1 = state->generator();
+        const unsigned int v2 = state->generator();
+        return ::rocrand_device::detail::uniform_distribution_double(v1, v2);
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+// Table-free Poisson distribution for large lambdas: Atkinson's rejection
+// method PA of the device API runs inside generate_rejection kernels, so
+// no table of O(sqrt(lambda)) probabilities is computed and uploaded.
+struct poisson_rejection_distribution
 {
-    static constexpr unsigned int input_width = 1;
-    static constexpr unsigned int output_width = 1;
+    // Generators use this distribution instead of tables for lambda >= threshold
+    static constexpr double lambda_threshold = rocrand_device::detail::lambda_threshold_huge;
 
-    rocrand_poisson_distribution<ROCRAND_DISCRETE_METHOD_ALIAS> dis;
+    const double lambda;
 
-    mrg_poisson_distribution(rocrand_poisson_distribution<ROCRAND_DISCRETE_METHOD_ALIAS> dis)
-        : dis(dis)
-    { }
+    __host__ __device__
+    poisson_rejection_distribution(double lambda)
+        : lambda(lambda) {}
 
+    template<class Generator>
     __host__ __device__
-    void operator()(const unsigned int (&input)[1], unsigned int (&output)[1]) const
+    unsigned int operator()(Generator& generator, size_t) const
     {
-        // Alias method requires x in [0, 1), uint must be in [0, UINT_MAX],
-        // but Mrg32k3a's "raw" output is in [1, ROCRAND_MRG32K3A_M1],
-        // so probabilities are slightly different than expected,
-        // some values can not be generated at all.
-        // Hence the "raw" value is remapped to [0, UINT_MAX]:
-        unsigned int v = rocrand_device::detail::mrg_uniform_distribution_uint(input[0]);
-        output[0] = dis(v);
+        rocrand_host::detail::poisson_rejection_state<Generator> state = { generator };
+        rocrand_host::detail::poisson_rejection_state<Generator> * state_ptr = &state;
+        return rocrand_device::detail::poisson_distribution_large(state_ptr, lambda);
+    }
+};
+
+// Poisson distribution with a lambda for every value (lambdas[index]),
+// table-free: inversion (algorithm ITR) for small lambdas, transformed
+// rejection PTRS for lambdas in [10, 64) and Atkinson's rejection method PA
+// for large ones.
+struct poisson_array_distribution
+{
+    const double * lambdas;
+
+    __host__ __device__
+    poisson_array_distribution(const double * lambdas)
+        : lambdas(lambdas) {}
+
+    template<class Generator>
+    __host__ __device__
+    unsigned int operator()(Generator& generator, size_t index) const
+    {
+        const double lambda = lambdas[index];
+        rocrand_host::detail::poisson_rejection_state<Generator> state = { generator };
+        rocrand_host::detail::poisson_rejection_state<Generator> * state_ptr = &state;
+        if(lambda < rocrand_device::detail::lambda_threshold_ptrs)
+        {
+            return rocrand_device::detail::poisson_distribution_itr(state_ptr, lambda);
+        }
+        if(lambda < rocrand_device::detail::lambda_threshold_small)
+        {
+            return rocrand_device::detail::poisson_distribution_ptrs(state_ptr, lambda);
+        }
+        return rocrand_device::detail::poisson_distribution_large(state_ptr, lambda);
     }
 };
 
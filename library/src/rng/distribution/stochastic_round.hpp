@@ -0,0 +1,173 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#ifndef ROCRAND_RNG_DISTRIBUTION_STOCHASTIC_ROUND_H_
+#define ROCRAND_RNG_DISTRIBUTION_STOCHASTIC_ROUND_H_
+
+#include <hip/hip_runtime.h>
+
+#include "device_distributions.hpp"
+
+#include <rocrand.h>
+
+namespace rocrand_host {
+namespace detail {
+
+    // Bits of v rounded stochastically to the floating-point format with
+    // ExponentBits and MantissaBits (IEEE-like, the largest exponent is
+    // reserved): v is rounded up with the probability of its distance from
+    // the lower neighbour in units of the spacing, quantized to RandomBits
+    // random bits of r (dropped bits below them are truncated). Values beyond
+    // the largest finite value (infinities too) become infinities, or
+    // saturate to the largest finite value if Saturate is true. NaNs become
+    // NaNs. E4M3 has no infinities (S.1111.111 is NaN), it must saturate.
+    template<unsigned int ExponentBits, unsigned int MantissaBits,
+             unsigned int RandomBits, bool Saturate>
+    FQUALIFIERS
+    unsigned int float_to_bits_stochastic(float v, unsigned int r)
+    {
+        constexpr int bias = (1 << (ExponentBits - 1)) - 1;
+        constexpr int min_exponent = 1 - bias;
+        constexpr unsigned int inf_code = ((1U << ExponentBits) - 1U) << MantissaBits;
+        constexpr unsigned int nan_code = inf_code | ((1U << MantissaBits) - 1U);
+        constexpr unsigned int max_code = ExponentBits == 4 ? 0x7EU : inf_code - 1U;
+        constexpr unsigned int overflow_code = Saturate ? max_code : inf_code;
+
+        union { float f; unsigned int u; } bits;
+        bits.f = v;
+        const unsigned int sign = (bits.u >> 31) << (ExponentBits + MantissaBits);
+        unsigned int a = bits.u & 0x7fffffffU;
+        if(a > 0x7f800000U)
+        {
+            return sign | nan_code;
+        }
+        r &= (1U << RandomBits) - 1U;
+
+        // Float subnormals have the spacing of the exponent -126
+        const int exponent = (a < 0x00800000U ? 1 : static_cast<int>(a >> 23)) - 127;
+        // Bits of a below the spacing of the format at v
+        const unsigned int dropped = 23 - MantissaBits
+            + (exponent < min_exponent ? min_exponent - exponent : 0);
+
+        unsigned int code;
+        if(dropped > 23)
+        {
+            // v is less than the smallest subnormal value, the significand
+            // is the fraction of it in units of 2^-dropped
+            const unsigned int significand =
+                a < 0x00800000U ? a : ((a & 0x007fffffU) | 0x00800000U);
+            const unsigned int shift = dropped - RandomBits;
+            const unsigned int fraction = shift < 32 ? significand >> shift : 0U;
+            code = r + fraction >= (1U << RandomBits) ? 1U : 0U;
+        }
+        else
+        {
+            // The carry of the addition may go to the next exponent, the result
+            // is a power of 2 then (a value of the format)
+            const unsigned int random = dropped >= RandomBits
+                ? r << (dropped - RandomBits)
+                : r >> (RandomBits - dropped);
+            a = (a + random) & ~((1U << dropped) - 1U);
+            if(a < static_cast<unsigned int>(127 + min_exponent) << 23)
+            {
+                // Subnormal values of the format are multiples of
+                // 2^(min_exponent - MantissaBits)
+                const int e = (a < 0x00800000U ? 1 : static_cast<int>(a >> 23)) - 127;
+                const unsigned int significand =
+                    a < 0x00800000U ? a : ((a & 0x007fffffU) | 0x00800000U);
+                code = significand >> (23 - MantissaBits + (min_exponent - e));
+            }
+            else
+            {
+                code = (a >> (23 - MantissaBits))
+                    - (static_cast<unsigned int>(127 - bias) << MantissaBits);
+            }
+        }
+        return sign | (code < overflow_code ? code : overflow_code);
+    }
+
+    // Output formats of rocrand_stochastic_round(), random_bits of every
+    // 32-bit engine value are used for one value
+    template<unsigned int ExponentBits, unsigned int MantissaBits,
+             unsigned int RandomBits, bool Saturate, class T>
+    struct stochastic_round_format
+    {
+        typedef T value_type;
+        static constexpr unsigned int random_bits = RandomBits;
+
+        FQUALIFIERS
+        static T round(float v, unsigned int r)
+        {
+            return static_cast<T>(
+                float_to_bits_stochastic<ExponentBits, MantissaBits, RandomBits, Saturate>(v, r)
+            );
+        }
+    };
+
+    typedef stochastic_round_format<8, 7, 16, false, unsigned short> stochastic_round_bfloat16;
+    typedef stochastic_round_format<5, 10, 16, false, unsigned short> stochastic_round_half;
+    // FP8 values saturate like outputs of other FP8 functions (see float_to_fp8())
+    typedef stochastic_round_format<4, 3, 8, true, unsigned char> stochastic_round_fp8_e4m3;
+    typedef stochastic_round_format<5, 2, 8, true, unsigned char> stochastic_round_fp8_e5m2;
+
+    // Values rounded with bits of one engine value, packed without
+    // alignment requirements (outputs are arrays of 16-bit or 8-bit values)
+    template<class T, unsigned int Values>
+    struct stochastic_round_value
+    {
+        T v[Values];
+    };
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+// Stochastic rounding of input for generate_rejection kernels: the i-th value
+// stored by the kernel holds Values rounded input values from i * Values, all
+// of them use bits of one engine value. Values less than 32 / random_bits are
+// for the tail of the input.
+template<class Format, unsigned int Values = 32 / Format::random_bits>
+struct stochastic_round_distribution
+{
+    typedef rocrand_host::detail::stochastic_round_value<
+        typename Format::value_type, Values
+    > value_type;
+
+    static_assert(Values * Format::random_bits <= 32, "Too many values per engine value");
+
+    const float * input;
+
+    __host__ __device__
+    stochastic_round_distribution(const float * input)
+        : input(input) {}
+
+    template<class Generator>
+    __host__ __device__
+    value_type operator()(Generator& generator, size_t index) const
+    {
+        const unsigned int r = generator();
+        value_type result;
+        for(unsigned int i = 0; i < Values; i++)
+        {
+            result.v[i] = Format::round(input[index * Values + i], r >> (i * Format::random_bits));
+        }
+        return result;
+    }
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_STOCHASTIC_ROUND_H_
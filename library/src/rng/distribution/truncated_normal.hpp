@@ -0,0 +1,163 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_TRUNCATED_NORMAL_H_
+#define ROCRAND_RNG_DISTRIBUTION_TRUNCATED_NORMAL_H_
+
+#include <math.h>
+#include <hip/hip_runtime.h>
+
+#include "device_distributions.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+// Uniform (in (0, 1]) and normal values of type of the second argument
+template<class Generator>
+__forceinline__ __device__ __host__
+float next_uniform(Generator& generator, float)
+{
+    return rocrand_device::detail::uniform_distribution(generator());
+}
+
+template<class Generator>
+__forceinline__ __device__ __host__
+double next_uniform(Generator& generator, double)
+{
+    return rocrand_device::detail::next_uniform_double(generator);
+}
+
+template<class Generator>
+__forceinline__ __device__ __host__
+float next_normal(Generator& generator, float)
+{
+    return rocrand_device::detail::ziggurat_normal(generator);
+}
+
+template<class Generator>
+__forceinline__ __device__ __host__
+double next_normal(Generator& generator, double)
+{
+    return rocrand_device::detail::ziggurat_normal_double(generator);
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+// Rejection distribution for generate_rejection kernels: normal values
+// in [lo, hi]. The standardized interval [a, b] is moved to b > 0 by symmetry,
+// then the method is chosen as in Robert, "Simulation of truncated normal
+// variables": normal rejection for wide intervals containing 0, uniform
+// proposals for narrow intervals, exponential proposals with the optimal rate
+// for tails. The expected number of attempts is bounded for all intervals
+// (below 2.1), so narrow intervals and far tails do not waste draws.
+template<class T>
+struct truncated_normal_distribution
+{
+    enum method_type : unsigned int
+    {
+        normal_rejection,
+        uniform_rejection,
+        exponential_rejection
+    };
+
+    T mean;
+    // stddev or -stddev if the interval is mirrored
+    T scale;
+    T a;
+    T b;
+    // Point of [a, b] closest to 0 (uniform proposals)
+    T nearest;
+    // Rate of exponential proposals
+    T lambda;
+    method_type method;
+
+    __host__ __device__
+    truncated_normal_distribution(T mean, T stddev, T lo, T hi)
+        : mean(mean), scale(stddev),
+          a((lo - mean) / stddev), b((hi - mean) / stddev),
+          nearest(0), lambda(0), method(normal_rejection)
+    {
+        if(b <= T(0))
+        {
+            const T t = a;
+            a = -b;
+            b = -t;
+            scale = -stddev;
+        }
+        if(a < T(0))
+        {
+            // sqrt(2 pi)
+            method = b - a >= T(2.5066282746310002) ? normal_rejection : uniform_rejection;
+        }
+        else
+        {
+            const T s = sqrt(a * a + T(4));
+            lambda = (a + s) / T(2);
+            nearest = a;
+            // Exponential proposals are better beyond this bound
+            const T bound = a + T(2) / (a + s) * exp((a * a - a * s) / T(4) + T(0.5));
+            method = b > bound ? exponential_rejection : uniform_rejection;
+        }
+    }
+
+    // Returns false if the interval is so far from the mean (relative to stddev)
+    // that its squared distance overflows, such values can not be sampled
+    __host__
+    bool is_valid() const
+    {
+        return isfinite(nearest * nearest);
+    }
+
+    template<class Generator>
+    __forceinline__ __device__ __host__
+    T operator()(Generator& generator, size_t) const
+    {
+        T x;
+        while(true)
+        {
+            if(method == normal_rejection)
+            {
+                x = rocrand_host::detail::next_normal(generator, T(0));
+                if(x >= a && x <= b)
+                    break;
+            }
+            else if(method == uniform_rejection)
+            {
+                x = a + (b - a) * (T(1) - rocrand_host::detail::next_uniform(generator, T(0)));
+                const T u = rocrand_host::detail::next_uniform(generator, T(0));
+                // nearest^2 - x^2 without squares (they can be infinite)
+                if(T(2) * log(u) <= (nearest - x) * (nearest + x))
+                    break;
+            }
+            else
+            {
+                x = a - log(rocrand_host::detail::next_uniform(generator, T(0))) / lambda;
+                const T u = rocrand_host::detail::next_uniform(generator, T(0));
+                const T d = x - lambda;
+                if(x <= b && T(2) * log(u) <= -d * d)
+                    break;
+            }
+        }
+        return mean + scale * x;
+    }
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_TRUNCATED_NORMAL_H_
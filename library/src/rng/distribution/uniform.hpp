@@ -74,6 +74,20 @@ struct uniform_distribution<unsigned short>
     }
 };
 
+template<>
+struct uniform_distribution<unsigned long long>
+{
+    static constexpr unsigned int input_width = 4;
+    static constexpr unsigned int output_width = 2;
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[4], unsigned long long (&output)[2]) const
+    {
+        output[0] = (static_cast<unsigned long long>(input[1]) << 32) | input[0];
+        output[1] = (static_cast<unsigned long long>(input[3]) << 32) | input[2];
+    }
+};
+
 template<>
 struct uniform_distribution<float>
 {
@@ -115,6 +129,86 @@ struct uniform_distribution<__half>
     }
 };
 
+// Two values per 32-bit engine value, 8 values (one 128-bit store) per thread
+// and iteration
+template<>
+struct uniform_distribution<hip_bfloat16>
+{
+    static constexpr unsigned int input_width = 4;
+    static constexpr unsigned int output_width = 8;
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[4], hip_bfloat16 (&output)[8]) const
+    {
+        for(unsigned int i = 0; i < 4; i++)
+        {
+            const unsigned int v = input[i];
+            output[2 * i] = rocrand_host::detail::uniform_distribution_bfloat16(
+                static_cast<unsigned short>(v)
+            );
+            output[2 * i + 1] = rocrand_host::detail::uniform_distribution_bfloat16(
+                static_cast<unsigned short>(v >> 16)
+            );
+        }
+    }
+};
+
+// Four 8-bit values per 32-bit engine value, 16 values (one 128-bit store)
+// per thread and iteration. Integers are the bits of engine values,
+// FP8 values are rounded uniform values (see uniform_distribution_fp8()).
+template<class T, bool Mrg>
+struct uniform_8bit_distribution
+{
+    static constexpr unsigned int input_width = 4;
+    static constexpr unsigned int output_width = 16;
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[4], T (&output)[16]) const
+    {
+        for(unsigned int i = 0; i < 4; i++)
+        {
+            const unsigned int v = Mrg
+                ? rocrand_device::detail::mrg_uniform_distribution_uint(input[i])
+                : input[i];
+            for(unsigned int j = 0; j < 4; j++)
+            {
+                output[4 * i + j] = rocrand_host::detail::uniform_distribution_fp8<T>(v >> (8 * j));
+            }
+        }
+    }
+};
+
+template<bool Mrg>
+struct uniform_8bit_distribution<signed char, Mrg>
+{
+    static constexpr unsigned int input_width = 4;
+    static constexpr unsigned int output_width = 16;
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[4], signed char (&output)[16]) const
+    {
+        for(unsigned int i = 0; i < 4; i++)
+        {
+            const unsigned int v = Mrg
+                ? rocrand_device::detail::mrg_uniform_distribution_uint(input[i])
+                : input[i];
+            *reinterpret_cast<unsigned int *>(output + 4 * i) = v;
+        }
+    }
+};
+
+template<>
+struct uniform_distribution<signed char>
+    : public uniform_8bit_distribution<signed char, false> {};
+
+template<>
+struct uniform_distribution<rocrand_fp8_e4m3>
+    : public uniform_8bit_distribution<rocrand_fp8_e4m3, false> {};
+
+template<>
+struct uniform_distribution<rocrand_fp8_e5m2>
+    : public uniform_8bit_distribution<rocrand_fp8_e5m2, false> {};
+
 
 // Mrg32k3a
 
@@ -163,6 +257,25 @@ struct mrg_uniform_distribution<unsigned short>
     }
 };
 
+template<>
+struct mrg_uniform_distribution<unsigned long long>
+{
+    static constexpr unsigned int input_width = 4;
+    static constexpr unsigned int output_width = 2;
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[4], unsigned long long (&output)[2]) const
+    {
+        unsigned int v[4];
+        for(unsigned int i = 0; i < 4; i++)
+        {
+            v[i] = rocrand_device::detail::mrg_uniform_distribution_uint(input[i]);
+        }
+        output[0] = (static_cast<unsigned long long>(v[1]) << 32) | v[0];
+        output[1] = (static_cast<unsigned long long>(v[3]) << 32) | v[2];
+    }
+};
+
 template<>
 struct mrg_uniform_distribution<float>
 {
@@ -204,6 +317,40 @@ struct mrg_uniform_distribution<__half>
     }
 };
 
+template<>
+struct mrg_uniform_distribution<hip_bfloat16>
+{
+    static constexpr unsigned int input_width = 4;
+    static constexpr unsigned int output_width = 8;
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[4], hip_bfloat16 (&output)[8]) const
+    {
+        for(unsigned int i = 0; i < 4; i++)
+        {
+            const unsigned int v = rocrand_device::detail::mrg_uniform_distribution_uint(input[i]);
+            output[2 * i] = rocrand_host::detail::uniform_distribution_bfloat16(
+                static_cast<unsigned short>(v)
+            );
+            output[2 * i + 1] = rocrand_host::detail::uniform_distribution_bfloat16(
+                static_cast<unsigned short>(v >> 16)
+            );
+        }
+    }
+};
+
+template<>
+struct mrg_uniform_distribution<signed char>
+    : public uniform_8bit_distribution<signed char, true> {};
+
+template<>
+struct mrg_uniform_distribution<rocrand_fp8_e4m3>
+    : public uniform_8bit_distribution<rocrand_fp8_e4m3, true> {};
+
+template<>
+struct mrg_uniform_distribution<rocrand_fp8_e5m2>
+    : public uniform_8bit_distribution<rocrand_fp8_e5m2, true> {};
+
 
 // Sobol
 
@@ -218,6 +365,12 @@ struct sobol_uniform_distribution<unsigned int>
     {
         return v;
     }
+
+    __host__ __device__
+    unsigned int operator()(const unsigned long long v) const
+    {
+        return static_cast<unsigned int>(v >> 32);
+    }
 };
 
 template<>
@@ -228,6 +381,12 @@ struct sobol_uniform_distribution<unsigned char>
     {
         return static_cast<unsigned char>(v >> 24);
     }
+
+    __host__ __device__
+    unsigned char operator()(const unsigned long long v) const
+    {
+        return static_cast<unsigned char>(v >> 56);
+    }
 };
 
 template<>
@@ -238,6 +397,28 @@ struct sobol_uniform_distribution<unsigned short>
     {
         return static_cast<unsigned short>(v >> 16);
     }
+
+    __host__ __device__
+    unsigned short operator()(const unsigned long long v) const
+    {
+        return static_cast<unsigned short>(v >> 48);
+    }
+};
+
+template<>
+struct sobol_uniform_distribution<unsigned long long>
+{
+    __host__ __device__
+    unsigned long long operator()(const unsigned int v) const
+    {
+        return static_cast<unsigned long long>(v) << 32;
+    }
+
+    __host__ __device__
+    unsigned long long operator()(const unsigned long long v) const
+    {
+        return v;
+    }
 };
 
 template<>
@@ -248,6 +429,12 @@ struct sobol_uniform_distribution<float>
     {
         return rocrand_device::detail::uniform_distribution(v);
     }
+
+    __host__ __device__
+    float operator()(const unsigned long long v) const
+    {
+        return rocrand_device::detail::uniform_distribution(static_cast<unsigned int>(v >> 32));
+    }
 };
 
 template<>
@@ -258,6 +445,12 @@ struct sobol_uniform_distribution<double>
     {
         return rocrand_device::detail::uniform_distribution_double(v);
     }
+
+    __host__ __device__
+    double operator()(const unsigned long long v) const
+    {
+        return rocrand_device::detail::uniform_distribution_double(v);
+    }
 };
 
 template<>
@@ -268,6 +461,292 @@ struct sobol_uniform_distribution<__half>
     {
         return rocrand_device::detail::uniform_distribution_half(static_cast<unsigned short>(v >> 16));
     }
+
+    __host__ __device__
+    __half operator()(const unsigned long long v) const
+    {
+        return rocrand_device::detail::uniform_distribution_half(static_cast<unsigned short>(v >> 48));
+    }
+};
+
+template<>
+struct sobol_uniform_distribution<hip_bfloat16>
+{
+    __host__ __device__
+    hip_bfloat16 operator()(const unsigned int v) const
+    {
+        return rocrand_host::detail::uniform_distribution_bfloat16(static_cast<unsigned short>(v >> 16));
+    }
+
+    __host__ __device__
+    hip_bfloat16 operator()(const unsigned long long v) const
+    {
+        return rocrand_host::detail::uniform_distribution_bfloat16(static_cast<unsigned short>(v >> 48));
+    }
+};
+
+// 8-bit values from the highest bits of quasi-random values
+template<class T>
+struct sobol_uniform_8bit_distribution
+{
+    __host__ __device__
+    T operator()(const unsigned int v) const
+    {
+        return rocrand_host::detail::uniform_distribution_fp8<T>(v >> 24);
+    }
+
+    __host__ __device__
+    T operator()(const unsigned long long v) const
+    {
+        return rocrand_host::detail::uniform_distribution_fp8<T>(static_cast<unsigned int>(v >> 56));
+    }
+};
+
+template<>
+struct sobol_uniform_distribution<signed char>
+{
+    __host__ __device__
+    signed char operator()(const unsigned int v) const
+    {
+        return static_cast<signed char>(v >> 24);
+    }
+
+    __host__ __device__
+    signed char operator()(const unsigned long long v) const
+    {
+        return static_cast<signed char>(v >> 56);
+    }
+};
+
+template<>
+struct sobol_uniform_distribution<rocrand_fp8_e4m3>
+    : public sobol_uniform_8bit_distribution<rocrand_fp8_e4m3> {};
+
+template<>
+struct sobol_uniform_distribution<rocrand_fp8_e5m2>
+    : public sobol_uniform_8bit_distribution<rocrand_fp8_e5m2> {};
+
+// Bounded integers
+
+// Integers in [lo, lo + range) with Lemire's multiply-shift method: the high
+// half of x * range is the value. Values with the low half less than
+// (2^w mod range) are rejected to remove the bias, this happens with
+// probability less than range / 2^w, so the division that computes
+// the threshold is done only then.
+//
+// Lemire D.
+// Fast Random Integer Generation in an Interval, 2019
+
+namespace rocrand_host {
+namespace detail {
+
+    __forceinline__ __device__ __host__
+    unsigned long long mul_hi_64(const unsigned long long x, const unsigned long long y)
+    {
+        #ifdef __HIP_DEVICE_COMPILE__
+        return __umul64hi(x, y);
+        #else
+        const unsigned long long x_lo = x & 0xFFFFFFFFULL;
+        const unsigned long long x_hi = x >> 32;
+        const unsigned long long y_lo = y & 0xFFFFFFFFULL;
+        const unsigned long long y_hi = y >> 32;
+        const unsigned long long lo_lo = x_lo * y_lo;
+        const unsigned long long hi_lo = x_hi * y_lo;
+        const unsigned long long lo_hi = x_lo * y_hi;
+        const unsigned long long cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFFULL) + lo_hi;
+        return x_hi * y_hi + (hi_lo >> 32) + (cross >> 32);
+        #endif
+    }
+
+    // The integer part of x * range / 2^128, where x = x_hi * 2^64 + x_lo
+    __forceinline__ __device__ __host__
+    unsigned long long mul_hi_128(const unsigned long long x_hi,
+                                  const unsigned long long x_lo,
+                                  const unsigned long long range)
+    {
+        const unsigned long long mid = x_hi * range;
+        const unsigned long long sum = mid + mul_hi_64(x_lo, range);
+        return mul_hi_64(x_hi, range) + (sum < mid ? 1 : 0);
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+// Rejection distribution for generate_rejection kernels, unbiased
+template<class T>
+struct uniform_range_distribution;
+
+template<>
+struct uniform_range_distribution<unsigned int>
+{
+    const unsigned int lo;
+    const unsigned int range;
+
+    __host__ __device__
+    uniform_range_distribution(unsigned int lo, unsigned int range)
+        : lo(lo), range(range) {}
+
+    template<class Generator>
+    __forceinline__ __device__ __host__
+    unsigned int operator()(Generator& generator, size_t) const
+    {
+        unsigned long long m = static_cast<unsigned long long>(generator()) * range;
+        unsigned int l = static_cast<unsigned int>(m);
+        if(l < range)
+        {
+            // 2^32 mod range
+            const unsigned int threshold = (0U - range) % range;
+            while(l < threshold)
+            {
+                m = static_cast<unsigned long long>(generator()) * range;
+                l = static_cast<unsigned int>(m);
+            }
+        }
+        return lo + static_cast<unsigned int>(m >> 32);
+    }
+};
+
+template<>
+struct uniform_range_distribution<unsigned long long>
+{
+    const unsigned long long lo;
+    const unsigned long long range;
+
+    __host__ __device__
+    uniform_range_distribution(unsigned long long lo, unsigned long long range)
+        : lo(lo), range(range) {}
+
+    template<class Generator>
+    __forceinline__ __device__ __host__
+    unsigned long long operator()(Generator& generator, size_t) const
+    {
+        unsigned long long x = next(generator);
+        unsigned long long l = x * range;
+        if(l < range)
+        {
+            // 2^64 mod range
+            const unsigned long long threshold = (0ULL - range) % range;
+            while(l < threshold)
+            {
+                x = next(generator);
+                l = x * range;
+            }
+        }
+        return lo + rocrand_host::detail::mul_hi_64(x, range);
+    }
+
+private:
+
+    // The first value is the low half
+    template<class Generator>
+    __forceinline__ __device__ __host__
+    static unsigned long long next(Generator& generator)
+    {
+        const unsigned long long low = generator();
+        const unsigned long long high = generator();
+        return (high << 32) | low;
+    }
+};
+
+// For generators without rejection support (MTGP32): the fraction x has
+// twice the bits of the result, so the bias is less than 2^-32 (2^-64)
+template<class T>
+struct uniform_range_wide_distribution;
+
+template<>
+struct uniform_range_wide_distribution<unsigned int>
+{
+    static constexpr unsigned int input_width = 2;
+    static constexpr unsigned int output_width = 1;
+
+    const unsigned int lo;
+    const unsigned int range;
+
+    __host__ __device__
+    uniform_range_wide_distribution(unsigned int lo, unsigned int range)
+        : lo(lo), range(range) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[2], unsigned int (&output)[1]) const
+    {
+        const unsigned long long x =
+            (static_cast<unsigned long long>(input[1]) << 32) | input[0];
+        output[0] = lo + static_cast<unsigned int>(rocrand_host::detail::mul_hi_64(x, range));
+    }
+};
+
+template<>
+struct uniform_range_wide_distribution<unsigned long long>
+{
+    static constexpr unsigned int input_width = 4;
+    static constexpr unsigned int output_width = 1;
+
+    const unsigned long long lo;
+    const unsigned long long range;
+
+    __host__ __device__
+    uniform_range_wide_distribution(unsigned long long lo, unsigned long long range)
+        : lo(lo), range(range) {}
+
+    __host__ __device__
+    void operator()(const unsigned int (&input)[4], unsigned long long (&output)[1]) const
+    {
+        const unsigned long long x_lo =
+            (static_cast<unsigned long long>(input[1]) << 32) | input[0];
+        const unsigned long long x_hi =
+            (static_cast<unsigned long long>(input[3]) << 32) | input[2];
+        output[0] = lo + rocrand_host::detail::mul_hi_128(x_hi, x_lo, range);
+    }
+};
+
+// Quasi-random points are mapped without rejection
+template<class T>
+struct sobol_uniform_range_distribution;
+
+template<>
+struct sobol_uniform_range_distribution<unsigned int>
+{
+    const unsigned int lo;
+    const unsigned int range;
+
+    __host__ __device__
+    sobol_uniform_range_distribution(unsigned int lo, unsigned int range)
+        : lo(lo), range(range) {}
+
+    __host__ __device__
+    unsigned int operator()(const unsigned int v) const
+    {
+        return lo + static_cast<unsigned int>((static_cast<unsigned long long>(v) * range) >> 32);
+    }
+
+    __host__ __device__
+    unsigned int operator()(const unsigned long long v) const
+    {
+        return lo + static_cast<unsigned int>(rocrand_host::detail::mul_hi_64(v, range));
+    }
+};
+
+template<>
+struct sobol_uniform_range_distribution<unsigned long long>
+{
+    const unsigned long long lo;
+    const unsigned long long range;
+
+    __host__ __device__
+    sobol_uniform_range_distribution(unsigned long long lo, unsigned long long range)
+        : lo(lo), range(range) {}
+
+    __host__ __device__
+    unsigned long long operator()(const unsigned int v) const
+    {
+        return lo + rocrand_host::detail::mul_hi_64(static_cast<unsigned long long>(v) << 32, range);
+    }
+
+    __host__ __device__
+    unsigned long long operator()(const unsigned long long v) const
+    {
+        return lo + rocrand_host::detail::mul_hi_64(v, range);
+    }
 };
 
 #endif // ROCRAND_RNG_DISTRIBUTION_UNIFORM_H_
@@ -0,0 +1,112 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_UNIT_VECTOR_H_
+#define ROCRAND_RNG_DISTRIBUTION_UNIT_VECTOR_H_
+
+#include <hip/hip_runtime.h>
+
+#include "device_distributions.hpp"
+#include "poisson.hpp"
+
+#include <rocrand_unit_vector.h>
+
+namespace rocrand_host {
+namespace detail {
+
+    // Found by argument-dependent lookup in rocrand_device::detail samplers
+    template<class Generator>
+    __forceinline__ __device__ __host__
+    unsigned int rocrand(poisson_rejection_state<Generator> * state)
+    {
+        return state->generator();
+    }
+
+    // Values of a unit vector, packed without alignment requirements
+    // (outputs of rocrand_generate_unit_vectors() are float arrays)
+    template<unsigned int Dim>
+    struct unit_vector_value
+    {
+        float v[Dim];
+    };
+
+    template<class State>
+    __forceinline__ __device__ __host__
+    void store_unit_vector(unit_vector_value<1>& r, State& state)
+    {
+        r.v[0] = rocrand_device::detail::unit_vector1(state);
+    }
+
+    template<class State>
+    __forceinline__ __device__ __host__
+    void store_unit_vector(unit_vector_value<2>& r, State& state)
+    {
+        const float2 v = rocrand_device::detail::unit_vector2(state);
+        r.v[0] = v.x;
+        r.v[1] = v.y;
+    }
+
+    template<class State>
+    __forceinline__ __device__ __host__
+    void store_unit_vector(unit_vector_value<3>& r, State& state)
+    {
+        const float3 v = rocrand_device::detail::unit_vector3(state);
+        r.v[0] = v.x;
+        r.v[1] = v.y;
+        r.v[2] = v.z;
+    }
+
+    template<class State>
+    __forceinline__ __device__ __host__
+    void store_unit_vector(unit_vector_value<4>& r, State& state)
+    {
+        const float4 v = rocrand_device::detail::unit_vector4(state);
+        r.v[0] = v.x;
+        r.v[1] = v.y;
+        r.v[2] = v.z;
+        r.v[3] = v.w;
+    }
+
+    // Vectors of more values are normal vectors normalized in place
+    constexpr unsigned int unit_vector_max_fused_dim = 4;
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+// Unit vectors of Dim values (1 to 4) for generate_rejection kernels, the
+// i-th value stored by the kernel is the i-th vector (rocrand_generate_unit_vectors())
+template<unsigned int Dim>
+struct unit_vector_distribution
+{
+    typedef rocrand_host::detail::unit_vector_value<Dim> value_type;
+
+    template<class Generator>
+    __host__ __device__
+    value_type operator()(Generator& generator, size_t) const
+    {
+        rocrand_host::detail::poisson_rejection_state<Generator> state = { generator };
+        rocrand_host::detail::poisson_rejection_state<Generator> * state_ptr = &state;
+        value_type r;
+        rocrand_host::detail::store_unit_vector(r, state_ptr);
+        return r;
+    }
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_UNIT_VECTOR_H_
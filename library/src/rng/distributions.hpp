@@ -26,5 +26,12 @@
 #include "distribution/log_normal.hpp"
 #include "distribution/discrete.hpp"
 #include "distribution/poisson.hpp"
+#include "distribution/exponential.hpp"
+#include "distribution/gamma.hpp"
+#include "distribution/truncated_normal.hpp"
+#include "distribution/bernoulli.hpp"
+#include "distribution/binomial.hpp"
+#include "distribution/unit_vector.hpp"
+#include "distribution/stochastic_round.hpp"
 
 #endif // ROCRAND_RNG_DISTRIBUTION_S_H_
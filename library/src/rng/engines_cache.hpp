@@ -0,0 +1,333 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_ENGINES_CACHE_H_
+#define ROCRAND_RNG_ENGINES_CACHE_H_
+
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "allocator.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+    // Copies size engines to host memory dst (in stream for device engines)
+    template<class Engine>
+    inline rocrand_status copy_engines_to_host(void * dst,
+                                               const Engine * engines, size_t size,
+                                               bool host_side, hipStream_t stream)
+    {
+        if(host_side)
+        {
+            std::memcpy(dst, engines, sizeof(Engine) * size);
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        if(hipMemcpyAsync(dst, engines, sizeof(Engine) * size, hipMemcpyDeviceToHost, stream) != hipSuccess
+            || hipStreamSynchronize(stream) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Copies size engines from host memory src (in stream for device engines)
+    template<class Engine>
+    inline rocrand_status copy_engines_from_host(Engine * engines, size_t size,
+                                                 const void * src,
+                                                 bool host_side, hipStream_t stream)
+    {
+        if(host_side)
+        {
+            std::memcpy(static_cast<void *>(engines), src, sizeof(Engine) * size);
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        // src can be released by the caller after return
+        if(hipMemcpyAsync(engines, src, sizeof(Engine) * size, hipMemcpyHostToDevice, stream) != hipSuccess
+            || hipStreamSynchronize(stream) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Opt-in persistent cache of initialized engines. It is enabled when
+    // ROCRAND_STATE_CACHE_DIR environment variable is set to an existing directory,
+    // then engines are stored in files named by generator type, seed, offset
+    // and launch configuration, so other processes can load them instead of
+    // initializing.
+    class engines_file_cache
+    {
+        struct header
+        {
+            unsigned int magic;
+            unsigned int version;
+            unsigned int rng_type;
+            unsigned int engine_size;
+            unsigned long long seed;
+            unsigned long long offset;
+            unsigned long long size;
+
+            bool operator==(const header& other) const
+            {
+                return magic == other.magic && version == other.version
+                    && rng_type == other.rng_type && engine_size == other.engine_size
+                    && seed == other.seed && offset == other.offset && size == other.size;
+            }
+        };
+
+    public:
+        // Disabled cache
+        engines_file_cache() : m_header() {}
+
+        engines_file_cache(rocrand_rng_type rng_type,
+                           unsigned long long seed,
+                           unsigned long long offset,
+                           unsigned int blocks,
+                           unsigned int threads,
+                           size_t engine_size,
+                           size_t size)
+        {
+            m_header.magic = 0x524f4352; // "ROCR"
+            m_header.version = ROCRAND_VERSION;
+            m_header.rng_type = static_cast<unsigned int>(rng_type);
+            m_header.engine_size = static_cast<unsigned int>(engine_size);
+            m_header.seed = seed;
+            m_header.offset = offset;
+            m_header.size = size;
+
+            const char * dir = std::getenv("ROCRAND_STATE_CACHE_DIR");
+            if(dir != NULL && dir[0] != '\0')
+            {
+                m_path = std::string(dir) + "/rocrand_"
+                    + std::to_string(m_header.rng_type) + "_"
+                    + std::to_string(seed) + "_"
+                    + std::to_string(offset) + "_"
+                    + std::to_string(blocks) + "x" + std::to_string(threads)
+                    + ".state";
+            }
+        }
+
+        bool enabled() const
+        {
+            return !m_path.empty();
+        }
+
+        // Loads engines from the cache file, returns false if there is no valid file
+        template<class Engine>
+        bool load(Engine * engines, bool host_side, hipStream_t stream) const
+        {
+            if(!enabled())
+                return false;
+            std::ifstream file(m_path, std::ios::binary);
+            if(!file)
+                return false;
+
+            header h;
+            if(!file.read(reinterpret_cast<char *>(&h), sizeof(header)) || !(h == m_header))
+                return false;
+
+            const size_t bytes = sizeof(Engine) * m_header.size;
+            std::vector<char> buffer(bytes);
+            if(!file.read(buffer.data(), bytes))
+                return false;
+            return copy_engines_from_host(
+                engines, m_header.size, buffer.data(), host_side, stream
+            ) == ROCRAND_STATUS_SUCCESS;
+        }
+
+        // Stores engines to the cache file. Failures are ignored, the cache
+        // is an optimization only.
+        template<class Engine>
+        void store(const Engine * engines, bool host_side, hipStream_t stream) const
+        {
+            if(!enabled())
+                return;
+
+            const size_t bytes = sizeof(Engine) * m_header.size;
+            std::vector<char> buffer(bytes);
+            if(copy_engines_to_host(buffer.data(), engines, m_header.size, host_side, stream)
+                != ROCRAND_STATUS_SUCCESS)
+                return;
+
+            // Write to a temporary file and rename it, so concurrent processes
+            // never read partially written files
+            const std::string tmp_path = m_path + ".tmp" + std::to_string(std::random_device()());
+            {
+                std::ofstream file(tmp_path, std::ios::binary);
+                if(!file)
+                    return;
+                file.write(reinterpret_cast<const char *>(&m_header), sizeof(header));
+                file.write(buffer.data(), bytes);
+                if(!file)
+                {
+                    file.close();
+                    std::remove(tmp_path.c_str());
+                    return;
+                }
+            }
+            if(std::rename(tmp_path.c_str(), m_path.c_str()) != 0)
+            {
+                std::remove(tmp_path.c_str());
+            }
+        }
+
+    private:
+        header m_header;
+        std::string m_path;
+    };
+
+    // Stores copies of device engines initialized with given seed and offset,
+    // so generators reinitialized with previously used values can copy engines
+    // instead of running the initialization (skipahead) kernel again.
+    // At most Capacity entries of at most MaxBytes bytes in total are kept
+    // (a few copies of default engines, device_bytes() is counted by
+    // rocrand_get_memory_usage()), the least recently used ones are replaced.
+    // Engines larger than MaxBytes are not cached.
+    template<class Engine, size_t Capacity = 4, size_t MaxBytes = (16 << 20)>
+    class engines_cache
+    {
+        struct entry
+        {
+            unsigned long long seed;
+            unsigned long long offset;
+            size_t size;
+            Engine * engines;
+            // Stream of the last copy, memory is freed in it
+            hipStream_t stream;
+        };
+
+    public:
+        engines_cache() {}
+
+        ~engines_cache()
+        {
+            clear();
+        }
+
+        void clear()
+        {
+            for(entry& e : m_entries)
+            {
+                device_free(e.engines, e.stream);
+            }
+            m_entries.clear();
+        }
+
+        // Returns size of device memory of all entries
+        size_t device_bytes() const
+        {
+            size_t bytes = 0;
+            for(const entry& e : m_entries)
+            {
+                bytes += sizeof(Engine) * e.size;
+            }
+            return bytes;
+        }
+
+        // Copies cached engines to engines asynchronously (in stream), returns false
+        // if there are no engines for seed, offset and size
+        bool load(unsigned long long seed, unsigned long long offset,
+                  Engine * engines, size_t size, hipStream_t stream)
+        {
+            for(auto it = m_entries.begin(); it != m_entries.end(); ++it)
+            {
+                if(it->seed == seed && it->offset == offset && it->size == size)
+                {
+                    const hipError_t error = hipMemcpyAsync(
+                        engines, it->engines, sizeof(Engine) * size,
+                        hipMemcpyDeviceToDevice, stream
+                    );
+                    if(error != hipSuccess)
+                        return false;
+                    it->stream = stream;
+                    // Move to front as the most recently used
+                    m_entries.splice(m_entries.begin(), m_entries, it);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Copies engines to the cache asynchronously (in stream)
+        rocrand_status store(unsigned long long seed, unsigned long long offset,
+                             const Engine * engines, size_t size, hipStream_t stream)
+        {
+            const size_t bytes = sizeof(Engine) * size;
+            if(bytes > MaxBytes)
+                return ROCRAND_STATUS_SUCCESS;
+
+            // Replace the least recently used entries, memory of one
+            // of the same size is reused
+            entry e;
+            bool reused = false;
+            while(m_entries.size() >= Capacity || device_bytes() + bytes > MaxBytes)
+            {
+                const entry last = m_entries.back();
+                m_entries.pop_back();
+                if(!reused && last.size == size)
+                {
+                    e = last;
+                    reused = true;
+                }
+                else
+                {
+                    device_free(last.engines, last.stream);
+                }
+            }
+            if(!reused && device_malloc(&e.engines, bytes, stream) != hipSuccess)
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            e.seed = seed;
+            e.offset = offset;
+            e.size = size;
+            e.stream = stream;
+            const hipError_t error = hipMemcpyAsync(
+                e.engines, engines, bytes, hipMemcpyDeviceToDevice, stream
+            );
+            if(error != hipSuccess)
+            {
+                device_free(e.engines, stream);
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            m_entries.push_front(e);
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+    private:
+        std::list<entry> m_entries;
+
+        // Entries own device memory
+        engines_cache(const engines_cache&) = delete;
+        engines_cache& operator=(const engines_cache&) = delete;
+    };
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_ENGINES_CACHE_H_
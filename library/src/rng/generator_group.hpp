@@ -0,0 +1,202 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_GENERATOR_GROUP_H_
+#define ROCRAND_RNG_GENERATOR_GROUP_H_
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <list>
+#include <map>
+#include <mutex>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "allocator.hpp"
+
+// Arena of engines of generators created in a group
+// (rocrand_create_generator_in_group()). Engines are carved from chunks
+// of device memory, a new chunk is at least as large as all previous chunks
+// together, so the number of allocations grows logarithmically with the total
+// size of engines. Empty chunks are released.
+//
+// The group is reference counted: the handle and every generator own
+// a reference, memory is released when the last one is released.
+struct rocrand_generator_group_type
+{
+    rocrand_generator_group_type() : m_references(1), m_reserved_bytes(0) {}
+
+    ~rocrand_generator_group_type()
+    {
+        for(chunk& c : m_chunks)
+        {
+            rocrand_host::detail::device_free(c.data, 0);
+        }
+    }
+
+    void retain()
+    {
+        m_references++;
+    }
+
+    void release()
+    {
+        if(--m_references == 0)
+        {
+            delete this;
+        }
+    }
+
+    /// Allocates \p size bytes of device memory
+    hipError_t allocate(void ** ptr, size_t size)
+    {
+        *ptr = NULL;
+        if(size == 0)
+            return hipSuccess;
+        size = (size + s_alignment - 1) / s_alignment * s_alignment;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for(chunk& c : m_chunks)
+        {
+            // First fit
+            for(auto it = c.free_ranges.begin(); it != c.free_ranges.end(); ++it)
+            {
+                if(it->second >= size)
+                {
+                    const size_t offset = it->first;
+                    const size_t rest = it->second - size;
+                    c.free_ranges.erase(it);
+                    if(rest > 0)
+                        c.free_ranges[offset + size] = rest;
+                    c.used += size;
+                    *ptr = c.data + offset;
+                    m_allocations[*ptr] = allocation { &c, offset, size };
+                    return hipSuccess;
+                }
+            }
+        }
+
+        m_chunks.emplace_back();
+        chunk& c = m_chunks.back();
+        c.size = std::max(std::max(size, m_reserved_bytes),
+                          static_cast<size_t>(s_min_chunk_size));
+        const hipError_t error = rocrand_host::detail::device_malloc(&c.data, c.size, 0);
+        if(error != hipSuccess)
+        {
+            m_chunks.pop_back();
+            return error;
+        }
+        m_reserved_bytes += c.size;
+        if(c.size > size)
+            c.free_ranges[size] = c.size - size;
+        c.used = size;
+        *ptr = c.data;
+        m_allocations[*ptr] = allocation { &c, 0, size };
+        return hipSuccess;
+    }
+
+    /// Returns memory allocated by allocate() to the arena after work submitted
+    /// to \p stream is finished, so other generators can reuse it in any stream
+    hipError_t deallocate(void * ptr, hipStream_t stream)
+    {
+        if(ptr == NULL)
+            return hipSuccess;
+        const hipError_t error = hipStreamSynchronize(stream);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto a = m_allocations.find(ptr);
+        if(a == m_allocations.end())
+            return hipErrorInvalidValue;
+        chunk& c = *a->second.owner;
+        size_t offset = a->second.offset;
+        size_t size = a->second.size;
+        m_allocations.erase(a);
+
+        c.used -= size;
+        if(c.used == 0)
+        {
+            m_reserved_bytes -= c.size;
+            rocrand_host::detail::device_free(c.data, 0);
+            m_chunks.remove_if([&c](const chunk& other) { return &other == &c; });
+            return error;
+        }
+
+        // Merge with adjacent free ranges
+        auto next = c.free_ranges.lower_bound(offset);
+        if(next != c.free_ranges.end() && next->first == offset + size)
+        {
+            size += next->second;
+            next = c.free_ranges.erase(next);
+        }
+        if(next != c.free_ranges.begin())
+        {
+            auto prev = std::prev(next);
+            if(prev->first + prev->second == offset)
+            {
+                offset = prev->first;
+                size += prev->second;
+                c.free_ranges.erase(prev);
+            }
+        }
+        c.free_ranges[offset] = size;
+        return error;
+    }
+
+    /// Returns the number of bytes of device memory reserved by the arena
+    size_t get_reserved_bytes()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_reserved_bytes;
+    }
+
+private:
+    struct chunk
+    {
+        char * data;
+        size_t size;
+        size_t used;
+        // Offsets and sizes of free ranges
+        std::map<size_t, size_t> free_ranges;
+    };
+
+    struct allocation
+    {
+        chunk * owner;
+        size_t offset;
+        size_t size;
+    };
+
+    static constexpr size_t s_alignment = 256;
+    static constexpr size_t s_min_chunk_size = 1 << 20;
+
+    std::atomic<unsigned int> m_references;
+    std::mutex m_mutex;
+    // Elements of lists are not moved, allocations point to their chunks
+    std::list<chunk> m_chunks;
+    std::map<void *, allocation> m_allocations;
+    size_t m_reserved_bytes;
+
+    rocrand_generator_group_type(const rocrand_generator_group_type&) = delete;
+    rocrand_generator_group_type& operator=(const rocrand_generator_group_type&) = delete;
+};
+
+#endif // ROCRAND_RNG_GENERATOR_GROUP_H_
@@ -21,15 +21,221 @@
 #ifndef ROCRAND_RNG_GENERATOR_TYPE_H_
 #define ROCRAND_RNG_GENERATOR_TYPE_H_
 
+#include <algorithm>
+#include <new>
+#include <vector>
+
 #include <hip/hip_runtime.h>
 #include <rocrand.h>
 
+#include "allocator.hpp"
+#include "engines_cache.hpp"
+#include "generator_group.hpp"
+#include "profiling.hpp"
+#include "tuning.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+    // Computes the number of blocks of block_size threads running kernel that can be
+    // simultaneously active on all compute units of the current device (blocks
+    // use dynamic_shared_bytes of dynamic shared memory)
+    template<class Kernel>
+    inline rocrand_status get_occupancy_blocks(Kernel kernel,
+                                               unsigned int block_size,
+                                               unsigned int& blocks,
+                                               size_t dynamic_shared_bytes = 0)
+    {
+        int device;
+        hipDeviceProp_t props;
+        int blocks_per_cu;
+        if(hipGetDevice(&device) != hipSuccess
+            || hipGetDeviceProperties(&props, device) != hipSuccess
+            || hipOccupancyMaxActiveBlocksPerMultiprocessor(
+                   &blocks_per_cu, kernel, block_size, dynamic_shared_bytes) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        blocks = static_cast<unsigned int>(std::max(1, blocks_per_cu * props.multiProcessorCount));
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Chooses the block size dividing engines_count (default_threads or a power
+    // of two from 64 to max_threads) that keeps most engines simultaneously
+    // active on the current device, default_threads wins ties
+    // (ROCRAND_ORDERING_PSEUDO_DYNAMIC, blocks run engines_count / threads)
+    template<class Kernel, class SharedBytes>
+    inline rocrand_status get_occupancy_threads(Kernel kernel,
+                                                SharedBytes shared_bytes,
+                                                size_t engines_count,
+                                                unsigned int default_threads,
+                                                unsigned int max_threads,
+                                                unsigned int& threads)
+    {
+        const unsigned int candidates[] = { default_threads, 64, 128, 256, 512, 1024 };
+        threads = 0;
+        size_t best_active = 0;
+        for(unsigned int block_size : candidates)
+        {
+            if(block_size > max_threads || engines_count % block_size != 0)
+                continue;
+            unsigned int blocks;
+            rocrand_status status = get_occupancy_blocks(
+                kernel, block_size, blocks, shared_bytes(block_size)
+            );
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+            const size_t active = std::min(engines_count, static_cast<size_t>(blocks) * block_size);
+            if(active > best_active)
+            {
+                best_active = active;
+                threads = block_size;
+            }
+        }
+        return threads == 0 ? ROCRAND_STATUS_OUT_OF_RANGE : ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Computes a launch configuration of at least engines_count engines
+    // (one engine per thread) for generators created with engines_count
+    // (rocrand_create_generator_in_group())
+    inline void get_engines_launch_config(unsigned int engines_count,
+                                          unsigned int default_threads,
+                                          unsigned int& blocks,
+                                          unsigned int& threads)
+    {
+        threads = std::min(engines_count, default_threads);
+        blocks = (engines_count + threads - 1) / threads;
+    }
+
+    // Destroys generators created by create_generators()
+    template<class Generator>
+    inline void destroy_generators(std::vector<Generator *>& generators)
+    {
+        for(Generator * generator : generators)
+        {
+            delete generator;
+        }
+        generators.clear();
+    }
+
+    // Creates count generators constructed with args (children of
+    // rocrand_generator_split()), all of them are destroyed on failure
+    template<class Generator, class... Args>
+    inline rocrand_status create_generators(unsigned int count,
+                                            std::vector<Generator *>& generators,
+                                            Args... args)
+    {
+        rocrand_status status;
+        try
+        {
+            generators.reserve(count);
+            while(generators.size() < count)
+            {
+                generators.push_back(new Generator(args...));
+            }
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        catch(const std::bad_alloc& e)
+        {
+            status = ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        catch(rocrand_status e)
+        {
+            status = e;
+        }
+        destroy_generators(generators);
+        return status;
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
 struct rocrand_generator_base_type
 {
-    rocrand_generator_base_type(rocrand_rng_type rng_type) : rng_type(rng_type) {}
+    rocrand_generator_base_type(rocrand_rng_type rng_type)
+        : rng_type(rng_type), m_stats(), m_store_policy(ROCRAND_STORE_POLICY_DEFAULT),
+          m_precision(ROCRAND_PRECISION_DEFAULT),
+          m_managed_policy(ROCRAND_MANAGED_POLICY_DEFAULT) {}
     const rocrand_rng_type rng_type;
 
     virtual ~rocrand_generator_base_type() {}
+
+    /// Returns counters of work done by the generator (rocrand_get_generator_stats())
+    rocrand_generator_stats get_stats() const
+    {
+        return m_stats;
+    }
+
+    /// Sets the policy of storing values by generate kernels (rocrand_set_store_policy())
+    rocrand_status set_store_policy(rocrand_store_policy policy)
+    {
+        if(policy != ROCRAND_STORE_POLICY_DEFAULT && policy != ROCRAND_STORE_POLICY_STREAMING)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        m_store_policy = policy;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_store_policy get_store_policy() const
+    {
+        return m_store_policy;
+    }
+
+    /// Sets the precision of normal and log-normal transforms (rocrand_set_precision())
+    rocrand_status set_precision(rocrand_precision precision)
+    {
+        if(precision != ROCRAND_PRECISION_DEFAULT && precision != ROCRAND_PRECISION_FAST)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        m_precision = precision;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_precision get_precision() const
+    {
+        return m_precision;
+    }
+
+    /// Sets prefetching of managed output buffers (rocrand_set_managed_policy())
+    rocrand_status set_managed_policy(rocrand_managed_policy policy)
+    {
+        if(policy != ROCRAND_MANAGED_POLICY_DEFAULT && policy != ROCRAND_MANAGED_POLICY_NONE
+            && policy != ROCRAND_MANAGED_POLICY_PREFETCH_HOST)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        m_managed_policy = policy;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_managed_policy get_managed_policy() const
+    {
+        return m_managed_policy;
+    }
+
+protected:
+    /// Copies policies of \p other, children of rocrand_generator_split()
+    /// have policies of their parent
+    void copy_policies(const rocrand_generator_base_type& other)
+    {
+        m_store_policy = other.m_store_policy;
+        m_precision = other.m_precision;
+        m_managed_policy = other.m_managed_policy;
+    }
+
+    /// Returns true if generate kernels use non-temporal stores (see store_vec())
+    bool streaming_stores() const
+    {
+        return m_store_policy == ROCRAND_STORE_POLICY_STREAMING;
+    }
+
+    /// Returns true if single-precision normal and log-normal distributions
+    /// use intrinsics (see normal_logf())
+    bool fast_math() const
+    {
+        return m_precision == ROCRAND_PRECISION_FAST;
+    }
+
+    rocrand_generator_stats m_stats;
+    rocrand_store_policy m_store_policy;
+    rocrand_precision m_precision;
+    rocrand_managed_policy m_managed_policy;
 };
 
 // rocRAND random number generator base class
@@ -40,11 +246,21 @@ struct rocrand_generator_type : public rocrand_generator_base_type
 
     rocrand_generator_type(unsigned long long seed = 0,
                            unsigned long long offset = 0,
-                           hipStream_t stream = 0)
+                           hipStream_t stream = 0,
+                           bool host_side = false,
+                           rocrand_generator_group_type * group = NULL)
         : base_type(GeneratorType),
-          m_seed(seed), m_offset(offset), m_stream(stream)
+          m_seed(seed), m_offset(offset), m_stream(stream),
+          m_host_side(host_side), m_group(group), m_auto_launch_config(true)
     {
+        if(m_group != NULL)
+            m_group->retain();
+    }
 
+    ~rocrand_generator_type()
+    {
+        if(m_group != NULL)
+            m_group->release();
     }
 
     /// Return generator's type
@@ -73,11 +289,179 @@ struct rocrand_generator_type : public rocrand_generator_base_type
         m_stream = stream;
     }
 
+    /// Returns true if generator uses host CPU and generates to host memory
+    bool is_host_side() const
+    {
+        return m_host_side;
+    }
+
 protected:
+    /// Counts generation of \p size values (one kernel for device generators)
+    void count_generate(size_t size)
+    {
+        if(!m_host_side)
+            m_stats.kernel_launches++;
+        m_stats.values_generated += size;
+    }
+
+    /// count_generate() for generation by substreams, which can run concurrently
+    /// (rocrand_set_substreams())
+    void count_generate_concurrent(size_t size)
+    {
+        if(!m_host_side)
+            __atomic_fetch_add(&m_stats.kernel_launches, 1ULL, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&m_stats.values_generated, static_cast<unsigned long long>(size),
+                           __ATOMIC_RELAXED);
+    }
+
+    /// Looks up the launch configuration of generating \p size values of type \p T
+    /// in the tuning database of the current device (see tuning_database). Only
+    /// device generators whose launch configuration is chosen by the library
+    /// (m_auto_launch_config) use tuned configurations.
+    template<class T>
+    bool get_tuned_launch_config(size_t size, unsigned int& blocks, unsigned int& threads) const
+    {
+        return !m_host_side && m_auto_launch_config
+            && rocrand_host::detail::tuning_database::lookup(
+                   rng_type, sizeof(T), size, blocks, threads
+               );
+    }
+
+    /// Counts initialization of engines (they can be copied from caches
+    /// without kernels, see count_launch())
+    void count_init()
+    {
+        m_stats.initializations++;
+    }
+
+    /// Counts a kernel launch other than generation
+    void count_launch()
+    {
+        m_stats.kernel_launches++;
+    }
+
+    /// Allocates \p size engines in host or device memory depending on generator's mode,
+    /// device engines of generators created in a group are allocated in its arena
+    template<class Engine>
+    rocrand_status allocate_engines(Engine *& engines, size_t size)
+    {
+        if(m_host_side)
+        {
+            engines = new (std::nothrow) Engine[size];
+            return engines == NULL ? ROCRAND_STATUS_ALLOCATION_FAILED : ROCRAND_STATUS_SUCCESS;
+        }
+        void * ptr = NULL;
+        const hipError_t error = m_group != NULL
+            ? m_group->allocate(&ptr, sizeof(Engine) * size)
+            : rocrand_host::detail::device_malloc(&ptr, sizeof(Engine) * size, m_stream);
+        engines = static_cast<Engine *>(ptr);
+        if(error != hipSuccess)
+        {
+            engines = NULL;
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        m_stats.device_bytes_allocated += sizeof(Engine) * size;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Frees engines allocated by allocate_engines()
+    template<class Engine>
+    void free_engines(Engine * engines) const
+    {
+        if(m_host_side)
+        {
+            delete[] engines;
+        }
+        else if(m_group != NULL)
+        {
+            m_group->deallocate(engines, m_stream);
+        }
+        else
+        {
+            rocrand_host::detail::device_free(engines, m_stream);
+        }
+    }
+
+    /// Returns size of device memory of \p size engines (0 for host generators
+    /// and engines freed by trim_engines())
+    template<class Engine>
+    size_t engines_device_bytes(const Engine * engines, size_t size) const
+    {
+        return m_host_side || engines == NULL ? 0 : sizeof(Engine) * size;
+    }
+
+    /// Copies \p size device engines to host memory if they are \p initialized
+    /// and frees them (rocrand_generator_trim()), restore_engines() allocates
+    /// them again. Engines of host generators are kept.
+    template<class Engine>
+    rocrand_status trim_engines(Engine *& engines, size_t size, bool initialized)
+    {
+        if(m_host_side || engines == NULL)
+            return ROCRAND_STATUS_SUCCESS;
+        if(initialized)
+        {
+            try
+            {
+                m_trimmed_engines.resize(sizeof(Engine) * size);
+            }
+            catch(const std::bad_alloc&)
+            {
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            const rocrand_status status = rocrand_host::detail::copy_engines_to_host(
+                m_trimmed_engines.data(), engines, size, false, m_stream
+            );
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                std::vector<char>().swap(m_trimmed_engines);
+                return status;
+            }
+        }
+        free_engines(engines);
+        engines = NULL;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Allocates engines freed by trim_engines() and copies their state back
+    /// if they are still \p initialized (changing seed, offset or launch
+    /// configuration after trimming discards the state)
+    template<class Engine>
+    rocrand_status restore_engines(Engine *& engines, size_t size, bool initialized)
+    {
+        if(engines == NULL)
+        {
+            rocrand_status status = allocate_engines(engines, size);
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+            if(initialized && !m_trimmed_engines.empty())
+            {
+                status = rocrand_host::detail::copy_engines_from_host(
+                    engines, size, m_trimmed_engines.data(), false, m_stream
+                );
+                if(status != ROCRAND_STATUS_SUCCESS)
+                {
+                    free_engines(engines);
+                    engines = NULL;
+                    return status;
+                }
+            }
+        }
+        std::vector<char>().swap(m_trimmed_engines);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     // ordering type
     unsigned long long m_seed;
     unsigned long long m_offset;
     hipStream_t m_stream;
+    // Engines are stored in host memory and numbers are generated by host threads
+    const bool m_host_side;
+    // Group of the generator (can be NULL), engines are allocated in its arena
+    rocrand_generator_group_type * const m_group;
+    // Launch configuration is chosen by the library (set_launch_config(0, 0))
+    bool m_auto_launch_config;
+    // Engines of a trimmed generator (see trim_engines())
+    std::vector<char> m_trimmed_engines;
 };
 
 #endif // ROCRAND_RNG_GENERATOR_TYPE_H_
@@ -21,10 +21,86 @@
 #ifndef ROCRAND_RNG_GENERATORS_H_
 #define ROCRAND_RNG_GENERATORS_H_
 
+// Engines excluded from the build by ROCRAND_ENGINES are replaced by
+// rocrand_disabled_generator, so their kernels are not compiled
+
+#include "disabled.hpp"
+
+#ifndef ROCRAND_DISABLE_PHILOX4_32_10
 #include "philox4x32_10.hpp"
+#else
+typedef rocrand_disabled_generator<ROCRAND_RNG_PSEUDO_PHILOX4_32_10> rocrand_philox4x32_10;
+#endif
+
+#include "counter_based64.hpp"
+#ifdef ROCRAND_DISABLE_PHILOX4_64_10
+typedef rocrand_disabled_generator<ROCRAND_RNG_PSEUDO_PHILOX4_64_10> rocrand_philox4x64_10;
+#endif
+#ifdef ROCRAND_DISABLE_PHILOX4_32_7
+typedef rocrand_disabled_generator<ROCRAND_RNG_PSEUDO_PHILOX4_32_7> rocrand_philox4x32_7;
+#endif
+#ifdef ROCRAND_DISABLE_THREEFRY2_64_20
+typedef rocrand_disabled_generator<ROCRAND_RNG_PSEUDO_THREEFRY2_64_20> rocrand_threefry2x64_20;
+#endif
+#ifdef ROCRAND_DISABLE_THREEFRY4_64_20
+typedef rocrand_disabled_generator<ROCRAND_RNG_PSEUDO_THREEFRY4_64_20> rocrand_threefry4x64_20;
+#endif
+
+#ifndef ROCRAND_DISABLE_MRG32K3A
 #include "mrg32k3a.hpp"
+#else
+typedef rocrand_disabled_generator<ROCRAND_RNG_PSEUDO_MRG32K3A> rocrand_mrg32k3a;
+#endif
+
+#ifndef ROCRAND_DISABLE_XORWOW
 #include "xorwow.hpp"
-#include "sobol32.hpp"
+#else
+typedef rocrand_disabled_generator<ROCRAND_RNG_PSEUDO_XORWOW> rocrand_xorwow;
+#endif
+
+#include "small_state.hpp"
+#ifdef ROCRAND_DISABLE_XOSHIRO128PP
+typedef rocrand_disabled_generator<ROCRAND_RNG_PSEUDO_XOSHIRO128PP> rocrand_xoshiro128pp;
+#endif
+#ifdef ROCRAND_DISABLE_PCG32
+typedef rocrand_disabled_generator<ROCRAND_RNG_PSEUDO_PCG32> rocrand_pcg32;
+#endif
+
+#include "sobol.hpp"
+#ifdef ROCRAND_DISABLE_SOBOL32
+typedef rocrand_disabled_generator<ROCRAND_RNG_QUASI_SOBOL32> rocrand_sobol32;
+#endif
+#ifdef ROCRAND_DISABLE_SCRAMBLED_SOBOL32
+typedef rocrand_disabled_generator<ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32> rocrand_scrambled_sobol32;
+#endif
+#ifdef ROCRAND_DISABLE_SOBOL64
+typedef rocrand_disabled_generator<ROCRAND_RNG_QUASI_SOBOL64> rocrand_sobol64;
+#endif
+#ifdef ROCRAND_DISABLE_SCRAMBLED_SOBOL64
+typedef rocrand_disabled_generator<ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64> rocrand_scrambled_sobol64;
+#endif
+
+#include "point_set.hpp"
+#ifdef ROCRAND_DISABLE_LATTICE32
+typedef rocrand_disabled_generator<ROCRAND_RNG_QUASI_LATTICE32> rocrand_lattice32;
+#endif
+#ifdef ROCRAND_DISABLE_HALTON32
+typedef rocrand_disabled_generator<ROCRAND_RNG_QUASI_HALTON32> rocrand_halton32;
+#endif
+#ifdef ROCRAND_DISABLE_SCRAMBLED_HALTON32
+typedef rocrand_disabled_generator<ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32> rocrand_scrambled_halton32;
+#endif
+
+#ifndef ROCRAND_DISABLE_MTGP32
 #include "mtgp32.hpp"
+#else
+typedef rocrand_disabled_generator<ROCRAND_RNG_PSEUDO_MTGP32> rocrand_mtgp32;
+#endif
+
+#include "multivariate_normal.hpp"
+#include "unit_vectors.hpp"
+#include "multi_device.hpp"
+#include "stream_producer.hpp"
+#include "sampling.hpp"
 
 #endif // ROCRAND_RNG_GENERATORS_H_
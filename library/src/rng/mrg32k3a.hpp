@@ -22,6 +22,8 @@
 #define ROCRAND_RNG_MRG32K3A_H_
 
 #include <algorithm>
+#include <cstring>
+#include <vector>
 #include <hip/hip_runtime.h>
 
 #include <rocrand.h>
@@ -29,8 +31,10 @@
 
 #include "common.hpp"
 #include "generator_type.hpp"
+#include "engines_cache.hpp"
 #include "device_engines.hpp"
 #include "distributions.hpp"
+#include "batch.hpp"
 
 namespace rocrand_host {
 namespace detail {
@@ -40,63 +44,337 @@ namespace detail {
     __global__
     void init_engines_kernel(mrg32k3a_device_engine * engines,
                              unsigned long long seed,
-                             unsigned long long offset)
+                             unsigned long long offset,
+                             bool seeded)
     {
         const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-        engines[engine_id] = mrg32k3a_device_engine(seed, engine_id, offset);
+        const unsigned int engines_size = hipGridDim_x * hipBlockDim_x;
+        store_engine_soa(
+            engines, engines_size, engine_id,
+            create_engine<mrg32k3a_device_engine>(seed, engine_id, offset, seeded)
+        );
     }
 
-    template<class T, class Distribution>
+    // Initializes engines of children of rocrand_generator_split()
+    // (see split_engine())
     __global__
-    void generate_kernel(mrg32k3a_device_engine * engines,
+    void split_engines_kernel(mrg32k3a_device_engine * engines,
+                              mrg32k3a_device_engine * const * children,
+                              const unsigned int children_count)
+    {
+        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int engines_size = hipGridDim_x * hipBlockDim_x;
+        split_engine(engines, children, children_count, engines_size, engine_id);
+    }
+
+    // Work of one thread of generate_kernel. Host-side generators call it
+    // for all engines, so they produce the same sequences as the kernel.
+    template<class T, class Distribution>
+    __forceinline__ __device__ __host__
+    void generate_engine(mrg32k3a_device_engine * engines,
+                         const unsigned int engine_id,
+                         const unsigned int stride,
                          T * data, const size_t n,
                          Distribution distribution)
     {
-        constexpr unsigned int input_width = Distribution::input_width;
-        constexpr unsigned int output_width = Distribution::output_width;
+        // Load device engine, stride is the number of engines
+        mrg32k3a_device_engine engine = load_engine_soa(engines, stride, engine_id);
+        generate_engine_values(engine, engine_id, stride, data, n, distribution);
 
-        using vec_type = aligned_vec_type<T, output_width>;
+        // Save engine with its state
+        store_engine_soa(engines, stride, engine_id, engine);
+    }
+
+    template<class T, class Distribution>
+    __global__
+    void generate_kernel(mrg32k3a_device_engine * engines,
+                         const unsigned int stride,
+                         T * data, const size_t n,
+                         Distribution distribution,
+                         const bool streaming)
+    {
+        // Threads run engines engine_id, engine_id + grid size, ... The grid
+        // runs fewer engines than stride with ROCRAND_ORDERING_PSEUDO_DYNAMIC
+        // (see set_dynamic_launch_config()), the block size divides stride,
+        // so all threads of a block run the same number of engines
+        for(unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+            engine_id < stride; engine_id += hipGridDim_x * hipBlockDim_x)
+        {
+            // The same values as generate_engine(), stored as vectors when possible
+            mrg32k3a_device_engine engine = load_engine_soa(engines, stride, engine_id);
+            generate_engine_values_block(engine, engine_id, stride, data, n, distribution, streaming);
+            store_engine_soa(engines, stride, engine_id, engine);
+        }
+    }
 
+    // generate_kernel for n smaller than the number of engines (stride): there
+    // every engine generates at most one vector and engines after n do not
+    // generate values, so only engines [0, n] are launched. Values and states
+    // are the same as with generate_kernel, but state traffic depends on n.
+    template<class T, class Distribution>
+    __global__
+    void generate_small_kernel(mrg32k3a_device_engine * engines,
+                               const unsigned int stride,
+                               T * data, const size_t n,
+                               Distribution distribution,
+                               const bool streaming)
+    {
         const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
-        size_t index = engine_id;
+        if(engine_id > n)
+            return;
+
+        mrg32k3a_device_engine engine = load_engine_soa(engines, stride, engine_id);
+        generate_engine_values(engine, engine_id, stride, data, n, distribution, streaming);
+        store_engine_soa(engines, stride, engine_id, engine);
+    }
+
+    // Work of one thread of generate_2d_kernel for host-side generators
+    template<class T, class Distribution>
+    __forceinline__ __device__ __host__
+    void generate_engine_2d(mrg32k3a_device_engine * engines,
+                            const unsigned int engine_id,
+                            const unsigned int stride,
+                            T * data, const size_t pitch,
+                            const size_t width, const size_t height,
+                            Distribution distribution)
+    {
+        mrg32k3a_device_engine engine = load_engine_soa(engines, stride, engine_id);
+        generate_engine_values_2d(
+            engine, engine_id, stride, data, pitch, width, height, distribution
+        );
+        store_engine_soa(engines, stride, engine_id, engine);
+    }
+
+    // generate_kernel for pitched buffers: every engine generates all rows,
+    // so the engine is loaded and stored once for all of them
+    template<class T, class Distribution>
+    __global__
+    void generate_2d_kernel(mrg32k3a_device_engine * engines,
+                            const unsigned int stride,
+                            T * data, const size_t pitch,
+                            const size_t width, const size_t height,
+                            Distribution distribution,
+                            const bool streaming)
+    {
+        // Engines of the thread, see generate_kernel
+        for(unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+            engine_id < stride; engine_id += hipGridDim_x * hipBlockDim_x)
+        {
+            mrg32k3a_device_engine engine = load_engine_soa(engines, stride, engine_id);
+            generate_engine_values_block_2d(
+                engine, engine_id, stride, data, pitch, width, height, distribution, streaming
+            );
+            store_engine_soa(engines, stride, engine_id, engine);
+        }
+    }
+
+    // generate_kernel for discrete distributions with small packed alias
+    // tables (see discrete_shared_capacity): the table is loaded to shared
+    // memory, so random lookups do not load from global memory
+    template<class Distribution>
+    __global__
+    void generate_discrete_shared_kernel(mrg32k3a_device_engine * engines,
+                                         const unsigned int stride,
+                                         unsigned int * data, const size_t n,
+                                         Distribution distribution)
+    {
+        __shared__ unsigned long long table[discrete_shared_capacity];
+        distribution.load_shared(table);
+
+        // Engines of the thread, see generate_kernel
+        for(unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+            engine_id < stride; engine_id += hipGridDim_x * hipBlockDim_x)
+        {
+            generate_engine(engines, engine_id, stride, data, n, distribution);
+        }
+    }
+
+    // Values of a thread of generate_rejection_kernel generated with engine
+    template<class T, class Distribution>
+    __forceinline__ __device__ __host__
+    void generate_rejection_values(mrg32k3a_device_engine& engine,
+                                   const unsigned int engine_id,
+                                   const unsigned int stride,
+                                   T * data, const size_t n,
+                                   Distribution distribution)
+    {
+        ::rocrand_device::detail::mrg_ziggurat_source<mrg32k3a_device_engine> source = { engine };
+        for(size_t index = engine_id; index < n; index += stride)
+        {
+            data[index] = distribution(source, index);
+        }
+    }
+
+    // Work of one thread of generate_rejection_kernel: generates values
+    // engine_id, engine_id + stride, ... with a rejection Distribution that
+    // consumes a variable number of (full-range 32-bit) values per output.
+    // Distribution gets the index of the value (e.g. to load its parameters).
+    template<class T, class Distribution>
+    __forceinline__ __device__ __host__
+    void generate_rejection_engine(mrg32k3a_device_engine * engines,
+                                   const unsigned int engine_id,
+                                   const unsigned int stride,
+                                   T * data, const size_t n,
+                                   Distribution distribution)
+    {
+        mrg32k3a_device_engine engine = load_engine_soa(engines, stride, engine_id);
+        generate_rejection_values(engine, engine_id, stride, data, n, distribution);
+        store_engine_soa(engines, stride, engine_id, engine);
+    }
 
-        // Load device engine
-        mrg32k3a_device_engine engine = engines[engine_id];
+    template<class T, class Distribution>
+    __global__
+    void generate_rejection_kernel(mrg32k3a_device_engine * engines,
+                                   const unsigned int stride,
+                                   T * data, const size_t n,
+                                   Distribution distribution)
+    {
+        // Engines of the thread, see generate_kernel
+        for(unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+            engine_id < stride; engine_id += hipGridDim_x * hipBlockDim_x)
+        {
+            generate_rejection_engine(engines, engine_id, stride, data, n, distribution);
+        }
+    }
 
-        unsigned int input[input_width];
-        T output[output_width];
+    // generate_rejection_kernel of a substream (see generate_substream_kernel)
+    template<class T, class Distribution>
+    __global__
+    void generate_rejection_substream_kernel(mrg32k3a_device_engine * engines,
+                                             const size_t engines_size,
+                                             const size_t first_engine,
+                                             T * data, const size_t n,
+                                             Distribution distribution)
+    {
+        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
 
-        const uintptr_t uintptr = reinterpret_cast<uintptr_t>(data);
-        const size_t misalignment =
-            (
-                output_width - uintptr / sizeof(T) % output_width
-            ) % output_width;
-        const unsigned int head_size = min(n, misalignment);
-        const unsigned int tail_size = (n - head_size) % output_width;
-        const size_t vec_n = (n - head_size) / output_width;
+        mrg32k3a_device_engine engine = load_engine_soa(engines, engines_size, first_engine + engine_id);
+        generate_rejection_values(engine, engine_id, stride, data, n, distribution);
+        store_engine_soa(engines, engines_size, first_engine + engine_id, engine);
+    }
 
-        vec_type * vec_data = reinterpret_cast<vec_type *>(data + misalignment);
-        while(index < vec_n)
+    // Work of one thread of generate_batch_kernel: the engine generates values
+    // of all requests in their order, as it does in consecutive generate calls
+    __forceinline__ __device__ __host__
+    void generate_batch_engine(mrg32k3a_device_engine * engines,
+                               const unsigned int engine_id,
+                               const unsigned int stride,
+                               const batch_kernel_requests& requests)
+    {
+        mrg32k3a_device_engine engine = load_engine_soa(engines, stride, engine_id);
+        for(unsigned int r = 0; r < requests.count; r++)
         {
-            for(unsigned int i = 0; i < input_width; i++)
+            const batch_kernel_request& request = requests.requests[r];
+            const float mean = static_cast<float>(request.parameters[0]);
+            const float stddev = static_cast<float>(request.parameters[1]);
+            switch(request.kind)
             {
-                input[i] = engine();
+                case batch_uniform_float:
+                    generate_engine_values(
+                        engine, engine_id, stride, static_cast<float *>(request.output), request.n,
+                        mrg_uniform_distribution<float>()
+                    );
+                    break;
+                case batch_uniform_double:
+                    generate_engine_values(
+                        engine, engine_id, stride, static_cast<double *>(request.output), request.n,
+                        mrg_uniform_distribution<double>()
+                    );
+                    break;
+                case batch_normal_float:
+                    generate_engine_values(
+                        engine, engine_id, stride, static_cast<float *>(request.output), request.n,
+                        mrg_normal_distribution<float>(mean, stddev)
+                    );
+                    break;
+                case batch_normal_double:
+                    generate_engine_values(
+                        engine, engine_id, stride, static_cast<double *>(request.output), request.n,
+                        mrg_normal_distribution<double>(request.parameters[0], request.parameters[1])
+                    );
+                    break;
+                case batch_ziggurat_float:
+                    generate_rejection_values(
+                        engine, engine_id, stride, static_cast<float *>(request.output), request.n,
+                        ziggurat_normal_distribution<float>(mean, stddev)
+                    );
+                    break;
+                case batch_ziggurat_double:
+                    generate_rejection_values(
+                        engine, engine_id, stride, static_cast<double *>(request.output), request.n,
+                        ziggurat_normal_distribution<double>(request.parameters[0], request.parameters[1])
+                    );
+                    break;
+                case batch_poisson:
+                    generate_engine_values(
+                        engine, engine_id, stride, static_cast<unsigned int *>(request.output), request.n,
+                        batch_poisson_distribution<true>{ request.tables }
+                    );
+                    break;
+                case batch_poisson_rejection:
+                    generate_rejection_values(
+                        engine, engine_id, stride, static_cast<unsigned int *>(request.output), request.n,
+                        poisson_rejection_distribution(request.parameters[0])
+                    );
+                    break;
             }
-            distribution(input, output);
+        }
+        store_engine_soa(engines, stride, engine_id, engine);
+    }
 
-            vec_data[index] = *reinterpret_cast<vec_type *>(output);
-            // Next position
-            index += stride;
+    __global__
+    void generate_batch_kernel(mrg32k3a_device_engine * engines,
+                               const unsigned int stride,
+                               const batch_kernel_requests requests)
+    {
+        // Engines of the thread, see generate_kernel
+        for(unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+            engine_id < stride; engine_id += hipGridDim_x * hipBlockDim_x)
+        {
+            generate_batch_engine(engines, engine_id, stride, requests);
         }
+    }
+
+    // Produces values [begin, end) of a generate_kernel call with n values and
+    // aligned data (data points to the value begin), and leaves engines in the same
+    // states as that call. begin and end must be multiples of output_width
+    // (except end == n). Used by multi-device generators: every device owns
+    // a copy of all engines and computes its own slice of values.
+    template<class T, class Distribution>
+    __global__
+    void generate_slice_kernel(mrg32k3a_device_engine * engines,
+                               const unsigned int stride,
+                               T * data, const size_t n,
+                               const size_t begin, const size_t end,
+                               Distribution distribution)
+    {
+        constexpr unsigned int input_width = Distribution::input_width;
+        constexpr unsigned int output_width = Distribution::output_width;
+
+        using vec_type = aligned_vec_type<T, output_width>;
 
-        // Check if we need to save head and tail.
-        // Those numbers should be generated by the thread that would
-        // save next vec_type.
-        if(output_width > 1 && index == vec_n)
+        const size_t vec_n = n / output_width;
+        const unsigned int tail_size = n % output_width;
+        const size_t vec_begin = begin / output_width;
+        const size_t vec_end = end / output_width;
+
+        // Engines of the thread, see generate_kernel
+        for(unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+            engine_id < stride; engine_id += hipGridDim_x * hipBlockDim_x)
         {
-            // If data is not aligned by sizeof(vec_type)
-            if(head_size > 0)
+            // Vectors of the engine are engine_id, engine_id + stride, ...
+            size_t index = vec_begin + (engine_id + stride - vec_begin % stride) % stride;
+
+            mrg32k3a_device_engine engine = load_engine_soa(engines, stride, engine_id);
+            // Skip vectors of previous slices
+            engine.discard(static_cast<unsigned long long>(index / stride) * input_width);
+
+            unsigned int input[input_width];
+            T output[output_width];
+
+            vec_type * vec_data = reinterpret_cast<vec_type *>(data);
+            while(index < vec_end)
             {
                 for(unsigned int i = 0; i < input_width; i++)
                 {
@@ -104,35 +382,33 @@ namespace detail {
                 }
                 distribution(input, output);
 
-                for(unsigned int o = 0; o < output_width; o++)
-                {
-                    if(o < head_size)
-                    {
-                        data[o] = output[o];
-                    }
-                }
+                vec_data[index - vec_begin] = *reinterpret_cast<vec_type *>(output);
+                index += stride;
             }
 
-            if(tail_size > 0)
+            // Skip vectors of next slices
+            const size_t last_index = vec_n + (engine_id + stride - vec_n % stride) % stride;
+            engine.discard(static_cast<unsigned long long>((last_index - index) / stride) * input_width);
+
+            // The thread that would save the next vector saves the tail
+            if(output_width > 1 && last_index == vec_n && tail_size > 0)
             {
                 for(unsigned int i = 0; i < input_width; i++)
                 {
                     input[i] = engine();
                 }
-                distribution(input, output);
-
-                for(unsigned int o = 0; o < output_width; o++)
+                if(end == n)
                 {
-                    if(o < tail_size)
+                    distribution(input, output);
+                    for(unsigned int o = 0; o < tail_size; o++)
                     {
-                        data[n - tail_size + o] = output[o];
+                        data[n - tail_size - begin + o] = output[o];
                     }
                 }
             }
-        }
 
-        // Save engine with its state
-        engines[engine_id] = engine;
+            store_engine_soa(engines, stride, engine_id, engine);
+        }
     }
 
 } // end namespace detail
@@ -146,16 +422,32 @@ public:
 
     rocrand_mrg32k3a(unsigned long long seed = 0,
                      unsigned long long offset = 0,
-                     hipStream_t stream = 0)
-        : base_type(seed, offset, stream),
-          m_engines_initialized(false), m_engines(NULL), m_engines_size(s_threads * s_blocks)
+                     hipStream_t stream = 0,
+                     bool host_side = false,
+                     rocrand_generator_group_type * group = NULL,
+                     unsigned int engines_count = 0)
+        : base_type(seed, offset, stream, host_side, group),
+          m_engines_initialized(false), m_engines(NULL),
+          m_blocks(s_default_blocks), m_threads(s_default_threads),
+          m_engines_size(s_default_blocks * s_default_threads),
+          m_init_pending(false), m_init_stream(NULL), m_init_event(NULL),
+          m_normal_method(ROCRAND_NORMAL_METHOD_BOX_MULLER),
+          m_ordering(ROCRAND_ORDERING_PSEUDO_DEFAULT)
     {
-        // Allocate device random number engines
-        auto error = hipMalloc(&m_engines, sizeof(engine_type) * m_engines_size);
-        if(error != hipSuccess)
+        if(engines_count != 0)
+        {
+            rocrand_host::detail::get_engines_launch_config(
+                engines_count, s_default_threads, m_blocks, m_threads
+            );
+            m_engines_size = static_cast<size_t>(m_blocks) * m_threads;
+        }
+        rocrand_status status = allocate_engines(m_engines, m_engines_size);
+        if(status != ROCRAND_STATUS_SUCCESS)
         {
-            throw ROCRAND_STATUS_ALLOCATION_FAILED;
+            throw status;
         }
+        m_poisson.set_stats(&m_stats);
+        m_poisson_host.set_stats(&m_stats);
         if(m_seed == 0)
         {
             m_seed = ROCRAND_MRG32K3A_DEFAULT_SEED;
@@ -164,7 +456,11 @@ public:
 
     ~rocrand_mrg32k3a()
     {
-        hipFree(m_engines);
+        free_engines(m_engines);
+        if(m_init_event != NULL)
+            hipEventDestroy(m_init_event);
+        if(m_init_stream != NULL)
+            hipStreamDestroy(m_init_stream);
     }
 
     void reset()
@@ -192,90 +488,1419 @@ public:
         m_engines_initialized = false;
     }
 
+    /// Sets the method used by generate_normal()
+    rocrand_status set_normal_method(rocrand_normal_method method)
+    {
+        if(method != ROCRAND_NORMAL_METHOD_BOX_MULLER
+            && method != ROCRAND_NORMAL_METHOD_ZIGGURAT)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+
+        m_normal_method = method;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Sets how engines are initialized: ROCRAND_ORDERING_PSEUDO_DEFAULT places
+    /// the i-th engine at the i-th subsequence of the seed (skipping ahead),
+    /// ROCRAND_ORDERING_PSEUDO_SEEDED seeds the i-th engine with a hash of
+    /// the seed and i (no skipping ahead, much faster initialization),
+    /// ROCRAND_ORDERING_PSEUDO_DYNAMIC is ROCRAND_ORDERING_PSEUDO_DEFAULT with
+    /// the number of engines fixed (the default one), the launch configuration
+    /// is chosen from occupancy (see set_dynamic_launch_config()).
+    /// Resets generator state.
+    rocrand_status set_ordering(rocrand_ordering ordering)
+    {
+        if(ordering == ROCRAND_ORDERING_QUASI_DEFAULT
+            || ordering == ROCRAND_ORDERING_QUASI_INTERLEAVED)
+        {
+            return ROCRAND_STATUS_TYPE_ERROR;
+        }
+        if(ordering != ROCRAND_ORDERING_PSEUDO_DEFAULT
+            && ordering != ROCRAND_ORDERING_PSEUDO_SEEDED
+            && ordering != ROCRAND_ORDERING_PSEUDO_DYNAMIC)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+
+        if(ordering != m_ordering)
+        {
+            if(ordering == ROCRAND_ORDERING_PSEUDO_DYNAMIC)
+            {
+                // Engines of the default launch configuration, the block
+                // size is chosen from occupancy
+                const rocrand_ordering previous = m_ordering;
+                rocrand_status status = set_launch_config(s_default_blocks, s_default_threads);
+                if(status != ROCRAND_STATUS_SUCCESS)
+                    return status;
+                m_ordering = ordering;
+                status = set_dynamic_launch_config(0, 0);
+                if(status != ROCRAND_STATUS_SUCCESS)
+                {
+                    m_ordering = previous;
+                    return status;
+                }
+            }
+            else if(m_ordering == ROCRAND_ORDERING_PSEUDO_DYNAMIC)
+            {
+                // One engine per thread again
+                m_blocks = engines_blocks();
+            }
+            m_ordering = ordering;
+            m_engines_initialized = false;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_ordering get_ordering() const
+    {
+        return m_ordering;
+    }
+
+    /// Changes launch configuration to \p blocks blocks of \p threads threads
+    /// (one engine per thread) and resets generator state. When both are 0, the
+    /// number of blocks is computed from occupancy of the current device.
+    rocrand_status set_launch_config(unsigned int blocks, unsigned int threads)
+    {
+        if(m_ordering == ROCRAND_ORDERING_PSEUDO_DYNAMIC)
+            return set_dynamic_launch_config(blocks, threads);
+        const bool automatic = blocks == 0 && threads == 0;
+        if(automatic)
+        {
+            threads = s_default_threads;
+            blocks = s_default_blocks;
+            if(!m_host_side)
+            {
+                void (*kernel)(engine_type *, const unsigned int, unsigned int *, const size_t,
+                               mrg_uniform_distribution<unsigned int>, const bool) =
+                    rocrand_host::detail::generate_kernel<unsigned int, mrg_uniform_distribution<unsigned int> >;
+                rocrand_status status = rocrand_host::detail::get_occupancy_blocks(
+                    kernel, threads, blocks,
+                    rocrand_host::detail::generate_shared_bytes<
+                        unsigned int, mrg_uniform_distribution<unsigned int>
+                    >(threads)
+                );
+                if(status != ROCRAND_STATUS_SUCCESS)
+                    return status;
+            }
+        }
+        if(blocks == 0 || threads == 0 || threads > s_max_threads)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        m_auto_launch_config = automatic;
+        if(blocks == m_blocks && threads == m_threads)
+            return ROCRAND_STATUS_SUCCESS;
+
+        const size_t engines_size = static_cast<size_t>(blocks) * threads;
+        engine_type * engines;
+        rocrand_status status = allocate_engines(engines, engines_size);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        free_engines(m_engines);
+
+        m_engines = engines;
+        m_engines_size = engines_size;
+        m_blocks = blocks;
+        m_threads = threads;
+        m_engines_initialized = false;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Launch configuration of ROCRAND_ORDERING_PSEUDO_DYNAMIC: \p threads must
+    /// divide the number of engines and \p blocks blocks must not run more than
+    /// all engines, threads run engines i, i + blocks * threads, ... (see
+    /// generate_kernel). The value (vector) at index i is generated by engine
+    /// i % engines regardless of the configuration, so generator state is kept.
+    /// When both are 0, the block size keeping most engines active on the current
+    /// device is chosen and all engines run at once.
+    rocrand_status set_dynamic_launch_config(unsigned int blocks, unsigned int threads)
+    {
+        const bool automatic = blocks == 0 && threads == 0;
+        if(automatic)
+        {
+            threads = s_default_threads;
+            if(!m_host_side)
+            {
+                void (*kernel)(engine_type *, const unsigned int, unsigned int *, const size_t,
+                               mrg_uniform_distribution<unsigned int>, const bool) =
+                    rocrand_host::detail::generate_kernel<unsigned int, mrg_uniform_distribution<unsigned int> >;
+                rocrand_status status = rocrand_host::detail::get_occupancy_threads(
+                    kernel,
+                    rocrand_host::detail::generate_shared_bytes<
+                        unsigned int, mrg_uniform_distribution<unsigned int>
+                    >,
+                    m_engines_size, s_default_threads, s_max_threads, threads
+                );
+                if(status != ROCRAND_STATUS_SUCCESS)
+                    return status;
+            }
+            blocks = static_cast<unsigned int>(m_engines_size / threads);
+        }
+        if(blocks == 0 || threads == 0 || threads > s_max_threads
+            || m_engines_size % threads != 0 || blocks > m_engines_size / threads)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        m_blocks = blocks;
+        m_threads = threads;
+        m_auto_launch_config = automatic;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    void get_launch_config(unsigned int * blocks, unsigned int * threads) const
+    {
+        *blocks = m_blocks;
+        *threads = m_threads;
+    }
+
     rocrand_status init()
     {
+        rocrand_status status = wait_init_async();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        if (m_engines_initialized && m_engines != NULL)
+            return ROCRAND_STATUS_SUCCESS;
+
+        // Initialization allocates memory and waits for the device,
+        // so it must be done before capture (see rocrand_initialize_generator())
+        if(!m_host_side && rocrand_host::detail::is_stream_capturing(m_stream))
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+
+        // Engines of a trimmed generator are copied back (see trim())
+        status = restore_engines(m_engines, m_engines_size, m_engines_initialized);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
         if (m_engines_initialized)
             return ROCRAND_STATUS_SUCCESS;
 
-        hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::init_engines_kernel),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, m_seed, m_offset
-        );
-        // Check kernel status
-        if(hipPeekAtLastError() != hipSuccess)
-            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        if(m_host_side)
+        {
+            rocrand_host::detail::profiling_range range("rocrand init_engines");
+            count_init();
+            // Seeded engines are not cached, they are initialized faster
+            // than the cache file is read
+            const bool seeded = m_ordering == ROCRAND_ORDERING_PSEUDO_SEEDED;
+            const rocrand_host::detail::engines_file_cache file_cache = get_file_cache();
+            if(seeded || !file_cache.load(m_engines, true, m_stream))
+            {
+                engine_type * engines = m_engines;
+                const size_t engines_size = m_engines_size;
+                const unsigned long long seed = m_seed;
+                const unsigned long long offset = m_offset;
+                rocrand_host::detail::host_parallel_for(
+                    m_engines_size,
+                    [engines, engines_size, seed, offset, seeded](size_t engine_id)
+                    {
+                        rocrand_host::detail::store_engine_soa(
+                            engines, engines_size, engine_id,
+                            rocrand_host::detail::create_engine<engine_type>(
+                                seed, engine_id, offset, seeded
+                            )
+                        );
+                    }
+                );
+                if(!seeded)
+                    file_cache.store(m_engines, true, m_stream);
+            }
+            m_engines_initialized = true;
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        status = init_engines(m_stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
 
         m_engines_initialized = true;
 
         return ROCRAND_STATUS_SUCCESS;
     }
 
-    template<class T, class Distribution = mrg_uniform_distribution<T> >
-    rocrand_status generate(T * data, size_t data_size,
-                            Distribution distribution = Distribution())
+    /// Starts initialization of engines in a separate stream without blocking
+    /// the host. Work in the generator's stream waits for it only when
+    /// the engines are needed (by the next generate call).
+    rocrand_status init_async()
+    {
+        if(m_host_side)
+            return init();
+        // Engines of a trimmed generator are restored synchronously
+        if(m_engines == NULL)
+            return init();
+        if(m_engines_initialized)
+            return ROCRAND_STATUS_SUCCESS;
+
+        if(m_init_event == NULL
+            && hipEventCreateWithFlags(&m_init_event, hipEventDisableTiming) != hipSuccess)
+        {
+            m_init_event = NULL;
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        if(m_init_stream == NULL
+            && hipStreamCreateWithFlags(&m_init_stream, hipStreamNonBlocking) != hipSuccess)
+        {
+            m_init_stream = NULL;
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        // Engines can still be used by previous work in m_stream
+        if(hipEventRecord(m_init_event, m_stream) != hipSuccess
+            || hipStreamWaitEvent(m_init_stream, m_init_event, 0) != hipSuccess)
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+
+        rocrand_status status = init_engines(m_init_stream, true);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        if(hipEventRecord(m_init_event, m_init_stream) != hipSuccess)
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+
+        m_init_pending = true;
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Returns size in bytes of the state returned by get_state()
+    size_t get_state_size() const
+    {
+        return sizeof(engine_type) * m_engines_size;
+    }
+
+    /// Initializes engines if needed and copies them to host memory \p state
+    rocrand_status get_state(void * state)
     {
         rocrand_status status = init();
-        if (status != ROCRAND_STATUS_SUCCESS)
+        if(status != ROCRAND_STATUS_SUCCESS)
             return status;
+        return rocrand_host::detail::copy_engines_to_host(
+            state, m_engines, m_engines_size, m_host_side, m_stream
+        );
+    }
 
-        hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, distribution
+    /// Replaces engines with \p state (in host memory) returned by get_state()
+    /// of a generator with the same launch configuration
+    rocrand_status set_state(const void * state)
+    {
+        rocrand_status status = wait_init_async();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        // The state replaces engines of a trimmed generator
+        status = restore_engines(m_engines, m_engines_size, false);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        status = rocrand_host::detail::copy_engines_from_host(
+            m_engines, m_engines_size, state, m_host_side, m_stream
         );
-        // Check kernel status
-        if(hipPeekAtLastError() != hipSuccess)
-            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Returns size of device memory of engines, cached engines
+    /// and Poisson tables (rocrand_get_memory_usage())
+    size_t get_memory_usage() const
+    {
+        return engines_device_bytes(m_engines, m_engines_size)
+            + m_engines_cache.device_bytes() + m_poisson.device_bytes();
+    }
 
+    /// Copies engines to host memory and frees device memory of engines,
+    /// cached engines and Poisson tables (rocrand_generator_trim()).
+    /// The next init() (every generate call) restores engines.
+    rocrand_status trim()
+    {
+        rocrand_status status = wait_init_async();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        status = trim_engines(m_engines, m_engines_size, m_engines_initialized);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        m_engines_cache.clear();
+        m_poisson.clear();
         return ROCRAND_STATUS_SUCCESS;
     }
 
-    template<class T>
-    rocrand_status generate_uniform(T * data, size_t data_size)
+    /// Returns size in bytes of the data written by save()
+    size_t get_save_size() const
     {
-        mrg_uniform_distribution<T> distribution;
-        return generate(data, data_size, distribution);
+        return sizeof(save_data) + get_state_size();
     }
 
-    template<class T>
-    rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
+    /// Writes seed, offset, launch configuration and engines to host memory \p data
+    rocrand_status save(void * data)
     {
-        mrg_normal_distribution<T> distribution(mean, stddev);
-        return generate(data, data_size, distribution);
+        const save_data header = {
+            m_seed, m_offset, m_blocks, m_threads, static_cast<unsigned int>(m_ordering),
+            m_auto_launch_config ? 1U : 0U
+        };
+        std::memcpy(data, &header, sizeof(save_data));
+        return get_state(static_cast<char *>(data) + sizeof(save_data));
     }
 
-    template<class T>
-    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
+    /// Restores the generator from \p data of \p size bytes written by save()
+    rocrand_status load(const void * data, size_t size)
     {
-        mrg_log_normal_distribution<T> distribution(mean, stddev);
-        return generate(data, data_size, distribution);
+        if(size < sizeof(save_data))
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        save_data header;
+        std::memcpy(&header, data, sizeof(save_data));
+        const size_t engines_size = header.ordering == ROCRAND_ORDERING_PSEUDO_DYNAMIC
+            ? static_cast<size_t>(s_default_blocks) * s_default_threads
+            : static_cast<size_t>(header.blocks) * header.threads;
+        if(size != sizeof(save_data) + sizeof(engine_type) * engines_size)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        // Engines of ROCRAND_ORDERING_PSEUDO_DYNAMIC are set by the ordering
+        rocrand_status status = set_ordering(static_cast<rocrand_ordering>(header.ordering));
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        status = set_launch_config(header.blocks, header.threads);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        m_auto_launch_config = header.auto_launch_config != 0;
+        set_seed(header.seed);
+        set_offset(header.offset);
+        return set_state(static_cast<const char *>(data) + sizeof(save_data));
     }
 
-    rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
+    /// Creates \p count generators with the launch configuration and settings
+    /// of this generator to \p children (rocrand_generator_split()). Engines
+    /// of children are engines of this generator skipped ahead by multiples of
+    /// the number of engines subsequences, they are initialized by one kernel
+    /// without init_engines_kernel (see split_engine()).
+    rocrand_status split(unsigned int count, rocrand_generator * children)
     {
-        try
+        if(count == 0)
+            return ROCRAND_STATUS_SUCCESS;
+        rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        // Children allocate engines, see init()
+        if(!m_host_side && rocrand_host::detail::is_stream_capturing(m_stream))
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+
+        std::vector<rocrand_mrg32k3a *> generators;
+        status = rocrand_host::detail::create_generators(
+            count, generators, m_seed, m_offset, m_stream, m_host_side, m_group,
+            static_cast<unsigned int>(m_engines_size)
+        );
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        std::vector<engine_type *> engines(count);
+        for(unsigned int i = 0; i < count && status == ROCRAND_STATUS_SUCCESS; i++)
         {
-            m_poisson.set_lambda(lambda);
+            rocrand_mrg32k3a * child = generators[i];
+            // Only custom launch configurations differ from the one
+            // computed from the number of engines
+            // (set_dynamic_launch_config() keeps engines of the dynamic ordering)
+            child->m_ordering = m_ordering;
+            status = child->set_launch_config(m_blocks, m_threads);
+            child->copy_policies(*this);
+            child->m_normal_method = m_normal_method;
+            child->m_engines_initialized = true;
+            engines[i] = child->m_engines;
         }
-        catch(rocrand_status status)
+        if(status == ROCRAND_STATUS_SUCCESS)
+            status = split_engines(engines);
+        // Children can generate in other streams (set_stream()), their
+        // engines are ready when split_engines_kernel in m_stream finishes
+        for(unsigned int i = 0; i < count && status == ROCRAND_STATUS_SUCCESS && !m_host_side; i++)
+            status = generators[i]->record_init_event(m_stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
         {
+            rocrand_host::detail::destroy_generators(generators);
             return status;
         }
-        mrg_poisson_distribution distribution(m_poisson.dis);
-        return generate(data, data_size, distribution);
+        std::copy(generators.begin(), generators.end(), children);
+        return ROCRAND_STATUS_SUCCESS;
     }
 
-private:
-    bool m_engines_initialized;
-    engine_type * m_engines;
-    size_t m_engines_size;
+    template<class T, class Distribution = mrg_uniform_distribution<T> >
+    rocrand_status generate(T * data, size_t data_size,
+                            Distribution distribution = Distribution())
+    {
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
 
-    static const uint32_t s_threads = 256;
-    static const uint32_t s_blocks = 512;
+        rocrand_host::detail::profiling_range range("rocrand generate_kernel");
+        count_generate(data_size);
 
-    // For caching of Poisson for consecutive generations with the same lambda
-    poisson_distribution_manager<> m_poisson;
+        // Results of the dynamic ordering do not depend on the launch
+        // configuration, the tuned one is used if the library chooses it
+        unsigned int tuned_blocks;
+        unsigned int tuned_threads;
+        if(m_ordering == ROCRAND_ORDERING_PSEUDO_DYNAMIC
+            && get_tuned_launch_config<T>(data_size, tuned_blocks, tuned_threads))
+        {
+            set_dynamic_launch_config(tuned_blocks, tuned_threads);
+            m_auto_launch_config = true;
+        }
+
+        if(m_host_side)
+        {
+            engine_type * engines = m_engines;
+            const unsigned int stride = static_cast<unsigned int>(m_engines_size);
+            rocrand_host::detail::host_parallel_for(
+                m_engines_size,
+                [=](size_t engine_id)
+                {
+                    rocrand_host::detail::generate_engine(
+                        engines, engine_id, stride, data, data_size, distribution
+                    );
+                }
+            );
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        const unsigned int stride = static_cast<unsigned int>(m_engines_size);
+        if(data_size < stride)
+        {
+            // Small requests load and store only engines that generate values
+            const unsigned int blocks =
+                static_cast<unsigned int>((data_size + 1 + m_threads - 1) / m_threads);
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_small_kernel),
+                dim3(blocks), dim3(m_threads), 0, m_stream,
+                m_engines, stride, data, data_size, distribution, streaming_stores()
+            );
+            if(hipPeekAtLastError() != hipSuccess)
+                return ROCRAND_STATUS_LAUNCH_FAILURE;
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        const size_t shared_bytes =
+            rocrand_host::detail::generate_shared_bytes<T, Distribution>(m_threads);
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
+            dim3(m_blocks), dim3(m_threads),
+            shared_bytes, m_stream,
+            m_engines, static_cast<unsigned int>(m_engines_size), data, data_size,
+            distribution, streaming_stores()
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_uniform(T * data, size_t data_size)
+    {
+        mrg_uniform_distribution<T> distribution;
+        return generate(data, data_size, distribution);
+    }
+
+    /// Generates \p data_size integers in [\p lo, \p lo + \p range)
+    template<class T>
+    rocrand_status generate_uniform_range(T * data, size_t data_size, T lo, T range)
+    {
+        uniform_range_distribution<T> distribution(lo, range);
+        return generate_rejection(data, data_size, distribution);
+    }
+
+    /// Generates \p data_size values with a rejection \p distribution
+    /// (see generate_rejection_kernel)
+    template<class T, class Distribution>
+    rocrand_status generate_rejection(T * data, size_t data_size,
+                                      Distribution distribution)
+    {
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        rocrand_host::detail::profiling_range range("rocrand generate_kernel");
+        count_generate(data_size);
+
+        if(m_host_side)
+        {
+            engine_type * engines = m_engines;
+            const unsigned int stride = static_cast<unsigned int>(m_engines_size);
+            rocrand_host::detail::host_parallel_for(
+                m_engines_size,
+                [=](size_t engine_id)
+                {
+                    rocrand_host::detail::generate_rejection_engine(
+                        engines, engine_id, stride, data, data_size, distribution
+                    );
+                }
+            );
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_rejection_kernel),
+            dim3(m_blocks), dim3(m_threads), 0, m_stream,
+            m_engines, static_cast<unsigned int>(m_engines_size), data, data_size, distribution
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        if(m_normal_method == ROCRAND_NORMAL_METHOD_ZIGGURAT)
+        {
+            ziggurat_normal_distribution<T> distribution(mean, stddev);
+            return generate_rejection(data, data_size, distribution);
+        }
+        mrg_normal_distribution<T> distribution(mean, stddev, fast_math());
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        mrg_log_normal_distribution<T> distribution(mean, stddev, fast_math());
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T * data, size_t data_size, T lambda)
+    {
+        mrg_exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    /// Generates Bernoulli decisions packed as bits (T is unsigned int)
+    /// or bytes (T is unsigned char)
+    template<class T>
+    rocrand_status generate_bernoulli(T * data, size_t data_size, double p)
+    {
+        mrg_bernoulli_distribution<T> distribution(p);
+        return generate(data, data_size, distribution);
+    }
+
+    /// Generates gamma variates (Marsaglia-Tsang rejection in every thread)
+    template<class T>
+    rocrand_status generate_gamma(T * data, size_t data_size, T shape, T scale)
+    {
+        gamma_distribution<T> distribution(shape, scale);
+        return generate_rejection(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_beta(T * data, size_t data_size, T alpha, T beta)
+    {
+        beta_distribution<T> distribution(alpha, beta);
+        return generate_rejection(data, data_size, distribution);
+    }
+
+    /// Generates normal values truncated to [\p lo, \p hi] (rejection in every thread)
+    template<class T>
+    rocrand_status generate_truncated_normal(T * data, size_t data_size,
+                                             T mean, T stddev, T lo, T hi)
+    {
+        truncated_normal_distribution<T> distribution(mean, stddev, lo, hi);
+        return generate_rejection(data, data_size, distribution);
+    }
+
+    /// Generates \p height rows of \p width values, rows start \p pitch values
+    /// apart. Rows get the same values as \p height consecutive generate() calls
+    /// of \p width values, but all rows are generated by one launch.
+    template<class T, class Distribution = mrg_uniform_distribution<T> >
+    rocrand_status generate_2d(T * data, size_t pitch, size_t width, size_t height,
+                               Distribution distribution = Distribution())
+    {
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        rocrand_host::detail::profiling_range range("rocrand generate_2d_kernel");
+        count_generate(width * height);
+
+        if(m_host_side)
+        {
+            engine_type * engines = m_engines;
+            const unsigned int stride = static_cast<unsigned int>(m_engines_size);
+            rocrand_host::detail::host_parallel_for(
+                m_engines_size,
+                [=](size_t engine_id)
+                {
+                    rocrand_host::detail::generate_engine_2d(
+                        engines, engine_id, stride, data, pitch, width, height, distribution
+                    );
+                }
+            );
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        const size_t shared_bytes =
+            rocrand_host::detail::generate_shared_bytes<T, Distribution>(m_threads);
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_2d_kernel),
+            dim3(m_blocks), dim3(m_threads),
+            shared_bytes, m_stream,
+            m_engines, static_cast<unsigned int>(m_engines_size), data, pitch, width, height,
+            distribution, streaming_stores()
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_2d(T * data, size_t pitch, size_t width, size_t height)
+    {
+        mrg_uniform_distribution<T> distribution;
+        return generate_2d(data, pitch, width, height, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_normal_2d(T * data, size_t pitch, size_t width, size_t height,
+                                      T mean, T stddev)
+    {
+        if(m_normal_method == ROCRAND_NORMAL_METHOD_ZIGGURAT)
+        {
+            // Rejection kernels are not row-aware, rows are generated one by one
+            ziggurat_normal_distribution<T> distribution(mean, stddev);
+            for(size_t row = 0; row < height; row++)
+            {
+                const rocrand_status status =
+                    generate_rejection(data + row * pitch, width, distribution);
+                if(status != ROCRAND_STATUS_SUCCESS)
+                    return status;
+            }
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        mrg_normal_distribution<T> distribution(mean, stddev, fast_math());
+        return generate_2d(data, pitch, width, height, distribution);
+    }
+
+    /// Splits engines into \p count substreams of consecutive blocks of engines
+    /// (rocrand_set_substreams()), the i-th substream generates in \p streams[i]
+    /// (in the generator's stream if \p streams is NULL). Engines are initialized
+    /// here, so generate_on() does not modify the generator and calls for
+    /// different substreams can run concurrently.
+    rocrand_status set_substreams(unsigned int count, const hipStream_t * streams)
+    {
+        if(count == 0)
+        {
+            m_substream_streams.clear();
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        if(engines_blocks() % count != 0)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        // Substreams use initialized engines in other streams
+        if(!m_host_side && hipStreamSynchronize(m_stream) != hipSuccess)
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+
+        if(streams != NULL)
+            m_substream_streams.assign(streams, streams + count);
+        else
+            m_substream_streams.assign(count, m_stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Generates \p data_size values with engines of \p substream in its stream,
+    /// as generate() of a generator with these engines does
+    template<class T, class Distribution = mrg_uniform_distribution<T> >
+    rocrand_status generate_on(unsigned int substream, T * data, size_t data_size,
+                               Distribution distribution = Distribution())
+    {
+        size_t first_engine;
+        size_t engines_size;
+        hipStream_t stream;
+        rocrand_status status = get_substream(substream, first_engine, engines_size, stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        rocrand_host::detail::profiling_range range("rocrand generate_substream_kernel");
+        count_generate_concurrent(data_size);
+
+        if(m_host_side)
+        {
+            engine_type * engines = m_engines;
+            const size_t all_engines_size = m_engines_size;
+            const unsigned int stride = static_cast<unsigned int>(engines_size);
+            rocrand_host::detail::host_parallel_for(
+                engines_size,
+                [=](size_t engine_id)
+                {
+                    engine_type engine = rocrand_host::detail::load_engine_soa(
+                        engines, all_engines_size, first_engine + engine_id
+                    );
+                    rocrand_host::detail::generate_engine_values(
+                        engine, engine_id, stride, data, data_size, distribution
+                    );
+                    rocrand_host::detail::store_engine_soa(
+                        engines, all_engines_size, first_engine + engine_id, engine
+                    );
+                }
+            );
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        const size_t shared_bytes =
+            rocrand_host::detail::generate_shared_bytes<T, Distribution>(m_threads);
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_substream_kernel),
+            dim3(engines_blocks() / m_substream_streams.size()), dim3(m_threads),
+            shared_bytes, stream,
+            m_engines, m_engines_size, first_engine, data, data_size,
+            distribution, streaming_stores()
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// generate_rejection() with engines of \p substream (see generate_on())
+    template<class T, class Distribution>
+    rocrand_status generate_rejection_on(unsigned int substream, T * data, size_t data_size,
+                                         Distribution distribution)
+    {
+        size_t first_engine;
+        size_t engines_size;
+        hipStream_t stream;
+        rocrand_status status = get_substream(substream, first_engine, engines_size, stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        rocrand_host::detail::profiling_range range("rocrand generate_substream_kernel");
+        count_generate_concurrent(data_size);
+
+        if(m_host_side)
+        {
+            engine_type * engines = m_engines;
+            const size_t all_engines_size = m_engines_size;
+            const unsigned int stride = static_cast<unsigned int>(engines_size);
+            rocrand_host::detail::host_parallel_for(
+                engines_size,
+                [=](size_t engine_id)
+                {
+                    engine_type engine = rocrand_host::detail::load_engine_soa(
+                        engines, all_engines_size, first_engine + engine_id
+                    );
+                    rocrand_host::detail::generate_rejection_values(
+                        engine, engine_id, stride, data, data_size, distribution
+                    );
+                    rocrand_host::detail::store_engine_soa(
+                        engines, all_engines_size, first_engine + engine_id, engine
+                    );
+                }
+            );
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_rejection_substream_kernel),
+            dim3(engines_blocks() / m_substream_streams.size()), dim3(m_threads), 0, stream,
+            m_engines, m_engines_size, first_engine, data, data_size, distribution
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_on(unsigned int substream, T * data, size_t data_size)
+    {
+        mrg_uniform_distribution<T> distribution;
+        return generate_on(substream, data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_normal_on(unsigned int substream, T * data, size_t data_size,
+                                      T mean, T stddev)
+    {
+        if(m_normal_method == ROCRAND_NORMAL_METHOD_ZIGGURAT)
+        {
+            ziggurat_normal_distribution<T> distribution(mean, stddev);
+            return generate_rejection_on(substream, data, data_size, distribution);
+        }
+        mrg_normal_distribution<T> distribution(mean, stddev, fast_math());
+        return generate_on(substream, data, data_size, distribution);
+    }
+
+    /// Generates values of \p count requests as consecutive generate calls
+    /// for the requests do, batch_max_requests requests in every kernel launch
+    rocrand_status generate_batch(const rocrand_batch_request * requests, size_t count)
+    {
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        const bool ziggurat = m_normal_method == ROCRAND_NORMAL_METHOD_ZIGGURAT;
+        for(size_t begin = 0; begin < count; begin += rocrand_host::detail::batch_max_requests)
+        {
+            const size_t size = std::min<size_t>(
+                count - begin, rocrand_host::detail::batch_max_requests
+            );
+            // Tables must not be evicted by other lambdas of the same launch
+            const size_t tables_count =
+                rocrand_host::detail::batch_poisson_tables_count(requests + begin, size);
+            m_poisson.reserve(tables_count);
+            m_poisson_host.reserve(tables_count);
+
+            rocrand_host::detail::batch_kernel_requests kernel_requests;
+            status = rocrand_host::detail::make_batch_kernel_requests(
+                requests + begin, size, ziggurat,
+                [this](double lambda) -> rocrand_discrete_distribution_st
+                {
+                    if(m_host_side)
+                    {
+                        m_poisson_host.set_lambda(lambda);
+                        return m_poisson_host.dis;
+                    }
+                    m_poisson.set_lambda(lambda, m_stream);
+                    return m_poisson.dis;
+                },
+                kernel_requests
+            );
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+
+            rocrand_host::detail::profiling_range range("rocrand generate_kernel");
+            size_t values = 0;
+            for(size_t i = 0; i < size; i++)
+            {
+                values += requests[begin + i].n;
+            }
+            count_generate(values);
+            if(m_host_side)
+            {
+                engine_type * engines = m_engines;
+                const unsigned int stride = static_cast<unsigned int>(m_engines_size);
+                rocrand_host::detail::host_parallel_for(
+                    m_engines_size,
+                    [engines, stride, &kernel_requests](size_t engine_id)
+                    {
+                        rocrand_host::detail::generate_batch_engine(
+                            engines, engine_id, stride, kernel_requests
+                        );
+                    }
+                );
+                continue;
+            }
+
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_batch_kernel),
+                dim3(m_blocks), dim3(m_threads), 0, m_stream,
+                m_engines, static_cast<unsigned int>(m_engines_size), kernel_requests
+            );
+            // Check kernel status
+            if(hipPeekAtLastError() != hipSuccess)
+                return ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Generates values [\p begin, \p end) of a generate() call producing \p n
+    /// values to (aligned) device memory and advances engines as that call does.
+    /// \p data points to the value \p begin. Used by multi-device generators.
+    template<class T, class Distribution = mrg_uniform_distribution<T> >
+    rocrand_status generate_slice(T * data, size_t n, size_t begin, size_t end,
+                                  Distribution distribution = Distribution())
+    {
+        constexpr unsigned int output_width = Distribution::output_width;
+
+        if(m_host_side)
+            return ROCRAND_STATUS_TYPE_ERROR;
+        if(begin > end || end > n || begin % output_width != 0
+            || (end != n && end % output_width != 0))
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        if(reinterpret_cast<uintptr_t>(data) % (sizeof(T) * output_width) != 0)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        rocrand_host::detail::profiling_range range("rocrand generate_kernel");
+        count_generate(end - begin);
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_slice_kernel),
+            dim3(m_blocks), dim3(m_threads), 0, m_stream,
+            m_engines, static_cast<unsigned int>(m_engines_size), data, n, begin, end, distribution
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_slice(T * data, size_t n, size_t begin, size_t end)
+    {
+        mrg_uniform_distribution<T> distribution;
+        return generate_slice(data, n, begin, end, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_normal_slice(T * data, size_t n, size_t begin, size_t end,
+                                         T mean, T stddev)
+    {
+        mrg_normal_distribution<T> distribution(mean, stddev, fast_math());
+        return generate_slice(data, n, begin, end, distribution);
+    }
+
+    /// Sets the maximum number of lambdas whose Poisson tables are cached
+    rocrand_status set_poisson_cache_capacity(size_t capacity)
+    {
+        if(capacity == 0)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        m_poisson.set_capacity(capacity);
+        m_poisson_host.set_capacity(capacity);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Computes and caches Poisson tables for \p count lambdas
+    rocrand_status prepare_poisson(const double * lambdas, size_t count)
+    {
+        for(size_t i = 0; i < count; i++)
+        {
+            if(lambdas[i] >= poisson_rejection_distribution::lambda_threshold)
+            {
+                // Generated without tables
+                continue;
+            }
+            try
+            {
+                if(m_host_side)
+                {
+                    m_poisson_host.set_lambda(lambdas[i]);
+                }
+                else
+                {
+                    m_poisson.set_lambda(lambdas[i], m_stream);
+                }
+            }
+            catch(rocrand_status status)
+            {
+                return status;
+            }
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
+    {
+        if(lambda >= poisson_rejection_distribution::lambda_threshold)
+        {
+            poisson_rejection_distribution distribution(lambda);
+            return generate_rejection(data, data_size, distribution);
+        }
+
+        try
+        {
+            if(m_host_side)
+            {
+                m_poisson_host.set_lambda(lambda);
+            }
+            else
+            {
+                m_poisson.set_lambda(lambda, m_stream);
+            }
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        if(m_host_side)
+        {
+            mrg_poisson_distribution<true> distribution(m_poisson_host.dis);
+            return generate(data, data_size, distribution);
+        }
+        mrg_poisson_distribution<> distribution(m_poisson.dis);
+        return generate(data, data_size, distribution);
+    }
+
+    /// Generates \p data_size values of the discrete distribution with tables
+    /// \p tables in device memory (copied to the host for host-side generators)
+    rocrand_status generate_discrete(unsigned int * data, size_t data_size,
+                                     const rocrand_discrete_distribution_st& tables)
+    {
+        if(m_host_side)
+        {
+            typedef rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_ALIAS, true> host_tables_type;
+            host_tables_type h_tables;
+            try
+            {
+                h_tables.init_from_device(tables);
+            }
+            catch(rocrand_status status)
+            {
+                h_tables.deallocate();
+                return status;
+            }
+            mrg_discrete_distribution<host_tables_type> distribution(h_tables);
+            const rocrand_status status = generate(data, data_size, distribution);
+            h_tables.deallocate();
+            return status;
+        }
+        typedef rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_ALIAS> tables_type;
+        mrg_discrete_distribution<tables_type> distribution((tables_type(tables)));
+        if(tables.size <= rocrand_host::detail::discrete_shared_capacity)
+        {
+            return generate_discrete_shared(data, data_size, distribution);
+        }
+        return generate(data, data_size, distribution);
+    }
+
+    /// Generates \p data_size values of a discrete \p distribution with
+    /// a small alias table (see generate_discrete_shared_kernel)
+    template<class Distribution>
+    rocrand_status generate_discrete_shared(unsigned int * data, size_t data_size,
+                                            Distribution distribution)
+    {
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        rocrand_host::detail::profiling_range range("rocrand generate_kernel");
+        count_generate(data_size);
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_discrete_shared_kernel),
+            dim3(m_blocks), dim3(m_threads), 0, m_stream,
+            m_engines, static_cast<unsigned int>(m_engines_size), data, data_size, distribution
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Generates \p data_size Poisson-distributed values, the i-th one
+    /// with lambda \p lambdas[i] (device memory, or host memory for host-side
+    /// generators)
+    rocrand_status generate_poisson_array(unsigned int * data, size_t data_size,
+                                          const double * lambdas)
+    {
+        poisson_array_distribution distribution(lambdas);
+        return generate_rejection(data, data_size, distribution);
+    }
+
+    /// Generates \p data_size binomially distributed values (\p n trials,
+    /// success probability \p p)
+    rocrand_status generate_binomial(unsigned int * data, size_t data_size,
+                                     unsigned int n, double p)
+    {
+        binomial_distribution distribution(n, p);
+        return generate_rejection(data, data_size, distribution);
+    }
+
+    /// Generates \p data_size binomially distributed values, the i-th one
+    /// with \p ns[i] trials and success probability \p ps[i]
+    rocrand_status generate_binomial_array(unsigned int * data, size_t data_size,
+                                           const unsigned int * ns, const double * ps)
+    {
+        binomial_array_distribution distribution(ns, ps);
+        return generate_rejection(data, data_size, distribution);
+    }
+
+    /// Generates \p data_size multinomial vectors of \p categories counts
+    /// stored by category (see multinomial_distribution)
+    rocrand_status generate_multinomial(unsigned int * data, size_t data_size,
+                                        unsigned int n, const double * weights,
+                                        unsigned int categories)
+    {
+        multinomial_distribution distribution(n, weights, categories, data, data_size);
+        return generate_rejection(data + (categories - 1) * data_size, data_size, distribution);
+    }
+
+    /// Generates \p data_size unit vectors of \p dim values (1 to 4) stored
+    /// one after another (see unit_vector_distribution)
+    rocrand_status generate_unit_vectors(float * data, size_t data_size, unsigned int dim)
+    {
+        if(dim == 1)
+            return generate_unit_vectors<1>(data, data_size);
+        else if(dim == 2)
+            return generate_unit_vectors<2>(data, data_size);
+        else if(dim == 3)
+            return generate_unit_vectors<3>(data, data_size);
+        else if(dim == 4)
+            return generate_unit_vectors<4>(data, data_size);
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    template<unsigned int Dim>
+    rocrand_status generate_unit_vectors(float * data, size_t data_size)
+    {
+        typedef unit_vector_distribution<Dim> distribution_type;
+        return generate_rejection(
+            reinterpret_cast<typename distribution_type::value_type *>(data),
+            data_size, distribution_type()
+        );
+    }
+
+    /// Rounds \p data_size values of \p input to 16-bit or 8-bit values of
+    /// \p format (see stochastic_round_distribution)
+    rocrand_status generate_stochastic_round(const float * input, void * output,
+                                             size_t data_size, rocrand_round_format format)
+    {
+        if(format == ROCRAND_ROUND_FORMAT_BFLOAT16)
+            return generate_stochastic_round<rocrand_host::detail::stochastic_round_bfloat16>(input, output, data_size);
+        else if(format == ROCRAND_ROUND_FORMAT_HALF)
+            return generate_stochastic_round<rocrand_host::detail::stochastic_round_half>(input, output, data_size);
+        else if(format == ROCRAND_ROUND_FORMAT_FP8_E4M3)
+            return generate_stochastic_round<rocrand_host::detail::stochastic_round_fp8_e4m3>(input, output, data_size);
+        else if(format == ROCRAND_ROUND_FORMAT_FP8_E5M2)
+            return generate_stochastic_round<rocrand_host::detail::stochastic_round_fp8_e5m2>(input, output, data_size);
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    /// Values of every engine value are stored together, the tail of
+    /// fewer values uses one engine value per value
+    template<class Format>
+    rocrand_status generate_stochastic_round(const float * input, void * output, size_t data_size)
+    {
+        typedef stochastic_round_distribution<Format> distribution_type;
+        typedef stochastic_round_distribution<Format, 1> tail_distribution_type;
+        typedef typename Format::value_type T;
+        constexpr unsigned int values = 32 / Format::random_bits;
+        const size_t groups = data_size / values;
+        const size_t tail_size = data_size - groups * values;
+        if(groups > 0)
+        {
+            const rocrand_status status = generate_rejection(
+                reinterpret_cast<typename distribution_type::value_type *>(output),
+                groups, distribution_type(input)
+            );
+            if(status != ROCRAND_STATUS_SUCCESS || tail_size == 0)
+                return status;
+        }
+        return generate_rejection(
+            reinterpret_cast<typename tail_distribution_type::value_type *>(
+                static_cast<T *>(output) + groups * values
+            ),
+            tail_size, tail_distribution_type(input + groups * values)
+        );
+    }
+
+private:
+    // Generator data written by save() before engines
+    struct save_data
+    {
+        unsigned long long seed;
+        unsigned long long offset;
+        unsigned int blocks;
+        unsigned int threads;
+        unsigned int ordering;
+        // Whether the library chose the launch configuration (m_auto_launch_config)
+        unsigned int auto_launch_config;
+    };
+
+    bool m_engines_initialized;
+    engine_type * m_engines;
+    unsigned int m_blocks;
+    unsigned int m_threads;
+    size_t m_engines_size;
+
+    static const uint32_t s_default_threads = 256;
+    static const uint32_t s_default_blocks = 512;
+    static const uint32_t s_max_threads = 1024;
+
+    // Engine states for previously used seeds and offsets
+    rocrand_host::detail::engines_cache<engine_type> m_engines_cache;
+    // Streams of substreams (set_substreams())
+    std::vector<hipStream_t> m_substream_streams;
+    // Asynchronous initialization
+    bool m_init_pending;
+    hipStream_t m_init_stream;
+    hipEvent_t m_init_event;
+    // Cache file of engines initialized by init_async(), see wait_init_async()
+    rocrand_host::detail::engines_file_cache m_init_file_cache;
+
+    // For caching of Poisson for consecutive generations with the same lambda
+    poisson_distribution_manager<> m_poisson;
+    poisson_distribution_manager<ROCRAND_DISCRETE_METHOD_ALIAS, true> m_poisson_host;
+
+    rocrand_normal_method m_normal_method;
+    rocrand_ordering m_ordering;
+
+    // Blocks of m_threads threads running all engines at once, m_blocks unless
+    // the grid of ROCRAND_ORDERING_PSEUDO_DYNAMIC is smaller
+    unsigned int engines_blocks() const
+    {
+        return static_cast<unsigned int>(m_engines_size / m_threads);
+    }
+
+    /// Returns engines and the stream of \p substream
+    rocrand_status get_substream(unsigned int substream,
+                                 size_t& first_engine,
+                                 size_t& engines_size,
+                                 hipStream_t& stream) const
+    {
+        if(substream >= m_substream_streams.size())
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        // Engines were reset, reallocated or trimmed after set_substreams()
+        if(!m_engines_initialized || m_engines == NULL || engines_blocks() % m_substream_streams.size() != 0)
+            return ROCRAND_STATUS_NOT_CREATED;
+        engines_size = m_engines_size / m_substream_streams.size();
+        first_engine = substream * engines_size;
+        stream = m_substream_streams[substream];
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Writes engines of children (see split_engine()), then
+    // engines of this generator skip ahead past them
+    rocrand_status split_engines(const std::vector<engine_type *>& children)
+    {
+        rocrand_host::detail::profiling_range range("rocrand split_engines_kernel");
+        const unsigned int count = static_cast<unsigned int>(children.size());
+        if(m_host_side)
+        {
+            engine_type * engines = m_engines;
+            engine_type * const * children_engines = children.data();
+            const size_t engines_size = m_engines_size;
+            rocrand_host::detail::host_parallel_for(
+                m_engines_size,
+                [=](size_t engine_id)
+                {
+                    rocrand_host::detail::split_engine(
+                        engines, children_engines, count, engines_size, engine_id
+                    );
+                }
+            );
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        engine_type ** children_engines;
+        if(rocrand_host::detail::device_malloc(
+               &children_engines, sizeof(engine_type *) * count, m_stream) != hipSuccess)
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        // children is released after return, the pointers are passed
+        // by kernel arguments (see store_pointers())
+        if(rocrand_host::detail::store_pointers(
+               children_engines, children.data(), count, m_stream) != hipSuccess)
+        {
+            rocrand_host::detail::device_free(children_engines, m_stream);
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+        count_launch();
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::split_engines_kernel),
+            dim3(engines_blocks()), dim3(m_threads), 0, m_stream,
+            m_engines, children_engines, count
+        );
+        const hipError_t error = hipPeekAtLastError();
+        rocrand_host::detail::device_free(children_engines, m_stream);
+        if(error != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Initializes device engines in stream, copies them from the cache
+    // if they were initialized with the same seed and offset before
+    // (seeded engines are not cached, the kernel is as fast as a copy).
+    // Storing engines to the cache file waits for them, if async is true
+    // it is deferred to wait_init_async().
+    rocrand_status init_engines(hipStream_t stream, bool async = false)
+    {
+        rocrand_host::detail::profiling_range range("rocrand init_engines_kernel");
+        count_init();
+        const bool seeded = m_ordering == ROCRAND_ORDERING_PSEUDO_SEEDED;
+        if(seeded)
+        {
+            count_launch();
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::init_engines_kernel),
+                dim3(engines_blocks()), dim3(m_threads), 0, stream,
+                m_engines, m_seed, m_offset, true
+            );
+            if(hipPeekAtLastError() != hipSuccess)
+                return ROCRAND_STATUS_LAUNCH_FAILURE;
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        if(m_engines_cache.load(m_seed, m_offset, m_engines, m_engines_size, stream))
+            return ROCRAND_STATUS_SUCCESS;
+
+        const rocrand_host::detail::engines_file_cache file_cache = get_file_cache();
+        if(file_cache.load(m_engines, false, stream))
+        {
+            m_engines_cache.store(m_seed, m_offset, m_engines, m_engines_size, stream);
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        count_launch();
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::init_engines_kernel),
+            dim3(engines_blocks()), dim3(m_threads), 0, stream,
+            m_engines, m_seed, m_offset, false
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        // Caches are an optimization, failing to store engines is not an error
+        m_engines_cache.store(m_seed, m_offset, m_engines, m_engines_size, stream);
+        if(async)
+            m_init_file_cache = file_cache;
+        else
+            file_cache.store(m_engines, false, stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Engines are initialized by work submitted to stream before m_init_event
+    // is recorded in it, following work in m_stream waits for the event
+    // (see wait_init_async())
+    rocrand_status record_init_event(hipStream_t stream)
+    {
+        if(m_init_event == NULL
+            && hipEventCreateWithFlags(&m_init_event, hipEventDisableTiming) != hipSuccess)
+        {
+            m_init_event = NULL;
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        if(hipEventRecord(m_init_event, stream) != hipSuccess)
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        m_init_pending = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Following work in m_stream waits for asynchronous initialization
+    rocrand_status wait_init_async()
+    {
+        if(m_init_pending)
+        {
+            // A graph can not wait for work outside of it, initialization
+            // must be finished before capture
+            if(rocrand_host::detail::is_stream_capturing(m_stream))
+            {
+                if(hipEventQuery(m_init_event) != hipSuccess)
+                    return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            else if(hipStreamWaitEvent(m_stream, m_init_event, 0) != hipSuccess)
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            m_init_pending = false;
+            // Engines are copied in m_init_stream after the initialization,
+            // the cache file is not stored during capture
+            if(m_init_file_cache.enabled())
+            {
+                if(!rocrand_host::detail::is_stream_capturing(m_stream))
+                    m_init_file_cache.store(m_engines, false, m_init_stream);
+                m_init_file_cache = rocrand_host::detail::engines_file_cache();
+            }
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_host::detail::engines_file_cache get_file_cache() const
+    {
+        return rocrand_host::detail::engines_file_cache(
+            rng_type, m_seed, m_offset, engines_blocks(), m_threads,
+            sizeof(engine_type), m_engines_size
+        );
+    }
 
     // m_seed from base_type
     // m_offset from base_type
@@ -56,6 +56,9 @@
 #define ROCRAND_RNG_MTGP32_H_
 
 #include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <vector>
 #include <hip/hip_runtime.h>
 
 #include <rocrand.h>
@@ -63,8 +66,10 @@
 
 #include "common.hpp"
 #include "generator_type.hpp"
+#include "engines_cache.hpp"
 #include "device_engines.hpp"
 #include "distributions.hpp"
+#include "mtgp32_jump.hpp"
 
 // Define external variable
 const int mtgpdc_params_11213_num = 512;
@@ -74,21 +79,24 @@ namespace detail {
 
     typedef ::rocrand_device::mtgp32_engine mtgp32_device_engine;
 
+    // Generates values of engine_id-th engine (all threads of the block call it),
+    // its values (vectors) are at engine_id * BlockSize + thread + k * stride
     template<unsigned int BlockSize, class T, class Distribution>
-    __global__
-    void generate_kernel(mtgp32_device_engine * engines,
+    __device__
+    void generate_engine(mtgp32_device_engine * engines,
+                         const unsigned int engine_id,
+                         const unsigned int stride,
                          T * data,
                          const size_t n,
-                         Distribution distribution)
+                         Distribution distribution,
+                         const bool streaming)
     {
         constexpr unsigned int input_width = Distribution::input_width;
         constexpr unsigned int output_width = Distribution::output_width;
 
         using vec_type = aligned_vec_type<T, output_width>;
 
-        const unsigned int engine_id = hipBlockIdx_x;
-        const unsigned int stride = hipGridDim_x * BlockSize;
-        size_t index = hipBlockIdx_x * BlockSize + hipThreadIdx_x;
+        size_t index = engine_id * BlockSize + hipThreadIdx_x;
 
         // Load device engine
         __shared__ mtgp32_device_engine engine;
@@ -112,6 +120,33 @@ namespace detail {
         const size_t vec_n_up = remainder_value == 0 ? vec_n_down : (vec_n_down + BlockSize);
 
         vec_type * vec_data = reinterpret_cast<vec_type *>(data + misalignment);
+        if(can_store_block_iterations<T, Distribution>(data, BlockSize))
+        {
+            // Iterations of the block are stored as vectors (see store_block_iterations),
+            // the same values are stored to the same positions
+            constexpr unsigned int iterations = store_iterations<T, Distribution>::value;
+            extern __shared__ uint4 generate_shared[];
+            T * shared = reinterpret_cast<T *>(generate_shared);
+
+            while(index - hipThreadIdx_x + (iterations - 1) * static_cast<size_t>(stride)
+                  + BlockSize <= vec_n_down)
+            {
+                T values[iterations];
+                for(unsigned int r = 0; r < iterations; r++)
+                {
+                    for(unsigned int i = 0; i < input_width; i++)
+                    {
+                        input[i] = engine();
+                    }
+                    distribution(input, output);
+                    values[r] = output[0];
+                }
+                store_block_iterations(
+                    data + index - hipThreadIdx_x, stride, values, shared, streaming
+                );
+                index += iterations * static_cast<size_t>(stride);
+            }
+        }
         while(index < vec_n_down)
         {
             for(unsigned int i = 0; i < input_width; i++)
@@ -120,7 +155,7 @@ namespace detail {
             }
             distribution(input, output);
 
-            vec_data[index] = *reinterpret_cast<vec_type *>(output);
+            store_vec(vec_data + index, *reinterpret_cast<vec_type *>(output), streaming);
             // Next position
             index += stride;
         }
@@ -135,7 +170,7 @@ namespace detail {
             // All threads generate (hence call __syncthreads) but not all write
             if(index < vec_n)
             {
-                vec_data[index] = *reinterpret_cast<vec_type *>(output);
+                store_vec(vec_data + index, *reinterpret_cast<vec_type *>(output), streaming);
             }
             // Next position
             index += stride;
@@ -174,6 +209,143 @@ namespace detail {
             }
         }
 
+        // Save the state, parameters of the engine do not change
+        engines[engine_id].copy_state(&engine);
+    }
+
+    // Blocks generate values of engines blockIdx, blockIdx + gridDim, ...,
+    // so the values do not depend on the number of blocks
+    // (gridDim == engines_count unless ROCRAND_ORDERING_PSEUDO_DYNAMIC is set)
+    template<unsigned int BlockSize, class T, class Distribution>
+    __global__
+    void generate_kernel(mtgp32_device_engine * engines,
+                         const unsigned int engines_count,
+                         T * data,
+                         const size_t n,
+                         Distribution distribution,
+                         const bool streaming)
+    {
+        const unsigned int stride = engines_count * BlockSize;
+        for(unsigned int engine_id = hipBlockIdx_x; engine_id < engines_count;
+            engine_id += hipGridDim_x)
+        {
+            generate_engine<BlockSize>(
+                engines, engine_id, stride, data, n, distribution, streaming
+            );
+        }
+    }
+
+    // Host-side equivalent of engine_id-th block of generate_kernel.
+    // All threads of a block make the same number of calls to the engine,
+    // so each call of next_block corresponds to one call of next() by every
+    // thread of the block.
+    template<unsigned int BlockSize, class T, class Distribution>
+    inline
+    void generate_engine_host(mtgp32_device_engine * engines,
+                              const unsigned int engine_id,
+                              const unsigned int stride,
+                              T * data,
+                              const size_t n,
+                              Distribution distribution)
+    {
+        constexpr unsigned int input_width = Distribution::input_width;
+        constexpr unsigned int output_width = Distribution::output_width;
+
+        using vec_type = aligned_vec_type<T, output_width>;
+
+        size_t block_index = engine_id * BlockSize;
+
+        mtgp32_device_engine engine;
+        engine.copy(&engines[engine_id]);
+
+        unsigned int block_input[input_width][BlockSize];
+        unsigned int input[input_width];
+        T output[output_width];
+
+        const uintptr_t uintptr = reinterpret_cast<uintptr_t>(data);
+        const size_t misalignment =
+            (
+                output_width - uintptr / sizeof(T) % output_width
+            ) % output_width;
+        const unsigned int head_size = std::min(n, misalignment);
+        const unsigned int tail_size = (n - head_size) % output_width;
+        const size_t vec_n = (n - head_size) / output_width;
+
+        // vec_n rounded up and down to the nearest multiple of BlockSize
+        const size_t remainder_value = vec_n % BlockSize;
+        const size_t vec_n_down = vec_n - remainder_value;
+        const size_t vec_n_up = remainder_value == 0 ? vec_n_down : (vec_n_down + BlockSize);
+
+        vec_type * vec_data = reinterpret_cast<vec_type *>(data + misalignment);
+        while(block_index < vec_n_up)
+        {
+            for(unsigned int i = 0; i < input_width; i++)
+            {
+                engine.next_block(block_input[i], BlockSize);
+            }
+            for(unsigned int t = 0; t < BlockSize; t++)
+            {
+                const size_t index = block_index + t;
+                if(index < vec_n)
+                {
+                    for(unsigned int i = 0; i < input_width; i++)
+                    {
+                        input[i] = block_input[i][t];
+                    }
+                    distribution(input, output);
+                    vec_data[index] = *reinterpret_cast<vec_type *>(output);
+                }
+            }
+            // Next position
+            block_index += stride;
+        }
+
+        // Check if we need to save head and tail.
+        if(output_width > 1 && (head_size > 0 || tail_size > 0))
+        {
+            for(unsigned int i = 0; i < input_width; i++)
+            {
+                engine.next_block(block_input[i], BlockSize);
+            }
+            for(unsigned int t = 0; t < BlockSize; t++)
+            {
+                const size_t index = block_index + t;
+                if(index != vec_n_up && index != vec_n_up + 1)
+                {
+                    continue;
+                }
+
+                for(unsigned int i = 0; i < input_width; i++)
+                {
+                    input[i] = block_input[i][t];
+                }
+                distribution(input, output);
+
+                // If data is not aligned by sizeof(vec_type)
+                if(index == vec_n_up)
+                {
+                    for(unsigned int o = 0; o < output_width; o++)
+                    {
+                        if(o < head_size)
+                        {
+                        data[o] = output[o];
+                        }
+                    }
+                }
+
+                if(index == vec_n_up + 1)
+                {
+                    for(unsigned int o = 0; o < output_width; o++)
+                    {
+                        if(o < tail_size)
+                        {
+                        data[n - tail_size + o] = output[o];
+                        }
+                    }
+                }
+            }
+        }
+
         // Save engine with its state
         engines[engine_id].copy(&engine);
     }
@@ -189,21 +361,37 @@ public:
 
     rocrand_mtgp32(unsigned long long seed = 0,
                    unsigned long long offset = 0,
-                   hipStream_t stream = 0)
-        : base_type(seed, offset, stream),
-          m_engines_initialized(false), m_engines(NULL), m_engines_size(s_blocks)
+                   hipStream_t stream = 0,
+                   bool host_side = false,
+                   rocrand_generator_group_type * group = NULL,
+                   unsigned int engines_count = 0)
+        : base_type(seed, offset, stream, host_side, group),
+          m_engines_initialized(false), m_engines(NULL),
+          m_blocks(s_default_blocks), m_engines_size(s_default_blocks),
+          m_ordering(ROCRAND_ORDERING_PSEUDO_DEFAULT)
     {
-        // Allocate device random number engines
-        auto error = hipMalloc(&m_engines, sizeof(engine_type) * m_engines_size);
-        if(error != hipSuccess)
+        // One engine per block
+        if(engines_count > s_max_blocks)
+        {
+            throw ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        if(engines_count != 0)
         {
-            throw ROCRAND_STATUS_ALLOCATION_FAILED;
+            m_blocks = engines_count;
+            m_engines_size = engines_count;
         }
+        rocrand_status status = allocate_engines(m_engines, m_engines_size);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            throw status;
+        }
+        m_poisson.set_stats(&m_stats);
+        m_poisson_host.set_stats(&m_stats);
     }
 
     ~rocrand_mtgp32()
     {
-        hipFree(m_engines);
+        free_engines(m_engines);
     }
 
     void reset()
@@ -227,37 +415,326 @@ public:
         m_engines_initialized = false;
     }
 
+    /// Sets the ordering: ROCRAND_ORDERING_PSEUDO_DEFAULT runs one engine per block,
+    /// ROCRAND_ORDERING_PSEUDO_DYNAMIC fixes the number of engines (the default
+    /// number of blocks) and blocks run engines blockIdx, blockIdx + gridDim, ...
+    /// (see set_launch_config()). Resets generator state.
+    rocrand_status set_ordering(rocrand_ordering ordering)
+    {
+        if(ordering == ROCRAND_ORDERING_QUASI_DEFAULT
+            || ordering == ROCRAND_ORDERING_QUASI_INTERLEAVED)
+        {
+            return ROCRAND_STATUS_TYPE_ERROR;
+        }
+        if(ordering != ROCRAND_ORDERING_PSEUDO_DEFAULT
+            && ordering != ROCRAND_ORDERING_PSEUDO_DYNAMIC)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+
+        if(ordering != m_ordering)
+        {
+            rocrand_status status = ROCRAND_STATUS_SUCCESS;
+            // One engine per block again, or engines of the default launch
+            // configuration with the number of blocks chosen from occupancy
+            m_ordering = ROCRAND_ORDERING_PSEUDO_DEFAULT;
+            if(ordering == ROCRAND_ORDERING_PSEUDO_DEFAULT)
+            {
+                status = set_launch_config(static_cast<unsigned int>(m_engines_size), s_threads);
+            }
+            else
+            {
+                status = set_launch_config(s_default_blocks, s_threads);
+                if(status == ROCRAND_STATUS_SUCCESS)
+                {
+                    m_ordering = ordering;
+                    status = set_launch_config(0, 0);
+                }
+            }
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                m_ordering = ROCRAND_ORDERING_PSEUDO_DEFAULT;
+                return status;
+            }
+            m_ordering = ordering;
+            m_engines_initialized = false;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_ordering get_ordering() const
+    {
+        return m_ordering;
+    }
+
+    /// Changes launch configuration to \p blocks blocks (one engine per block)
+    /// and resets generator state. The number of threads is fixed, \p threads must
+    /// be equal to 256. The number of blocks is limited by s_max_blocks. When both
+    /// are 0, the number of blocks is computed from occupancy of the current device.
+    ///
+    /// With ROCRAND_ORDERING_PSEUDO_DYNAMIC the number of engines does not change,
+    /// \p blocks must not exceed it and generator state is kept.
+    ///
+    /// There are mtgpdc_params_11213_num parameter sets, engine i uses the parameter
+    /// set i % mtgpdc_params_11213_num and its own seed (see init_engines_host()).
+    rocrand_status set_launch_config(unsigned int blocks, unsigned int threads)
+    {
+        const bool dynamic = m_ordering == ROCRAND_ORDERING_PSEUDO_DYNAMIC;
+        const unsigned int max_blocks =
+            dynamic ? static_cast<unsigned int>(m_engines_size) : s_max_blocks;
+        const bool automatic = blocks == 0 && threads == 0;
+        if(automatic)
+        {
+            threads = s_threads;
+            blocks = s_default_blocks;
+            if(!m_host_side)
+            {
+                void (*kernel)(engine_type *, const unsigned int, unsigned int *, const size_t,
+                               uniform_distribution<unsigned int>, const bool) =
+                    rocrand_host::detail::generate_kernel<
+                        s_threads, unsigned int, uniform_distribution<unsigned int>
+                    >;
+                rocrand_status status = rocrand_host::detail::get_occupancy_blocks(
+                    kernel, threads, blocks,
+                    rocrand_host::detail::generate_shared_bytes<
+                        unsigned int, uniform_distribution<unsigned int>
+                    >(threads)
+                );
+                if(status != ROCRAND_STATUS_SUCCESS)
+                    return status;
+            }
+            blocks = std::min(blocks, max_blocks);
+        }
+        if(blocks == 0 || blocks > max_blocks || threads != s_threads)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        m_auto_launch_config = automatic;
+        if(blocks == m_blocks)
+            return ROCRAND_STATUS_SUCCESS;
+        if(dynamic)
+        {
+            m_blocks = blocks;
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        engine_type * engines;
+        rocrand_status status = allocate_engines(engines, blocks);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        free_engines(m_engines);
+
+        m_engines = engines;
+        m_engines_size = blocks;
+        m_blocks = blocks;
+        m_engines_initialized = false;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    void get_launch_config(unsigned int * blocks, unsigned int * threads) const
+    {
+        *blocks = m_blocks;
+        *threads = s_threads;
+    }
+
     rocrand_status init()
     {
+        if (m_engines_initialized && m_engines != NULL)
+            return ROCRAND_STATUS_SUCCESS;
+
+        // Initialization allocates memory and waits for the device,
+        // so it must be done before capture (see rocrand_initialize_generator())
+        if(!m_host_side && rocrand_host::detail::is_stream_capturing(m_stream))
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+
+        // Engines of a trimmed generator are copied back (see trim())
+        rocrand_status status = restore_engines(m_engines, m_engines_size, m_engines_initialized);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
         if (m_engines_initialized)
             return ROCRAND_STATUS_SUCCESS;
 
-        rocrand_status status;
+        // Engines are initialized on the host, without kernels
+        rocrand_host::detail::profiling_range range("rocrand init_engines");
+        count_init();
+        const rocrand_host::detail::engines_file_cache file_cache(
+            rng_type, m_seed, m_offset, static_cast<unsigned int>(m_engines_size), s_threads,
+            sizeof(engine_type), m_engines_size
+        );
+        if(file_cache.load(m_engines, m_host_side, m_stream))
+        {
+            m_engines_initialized = true;
+            return ROCRAND_STATUS_SUCCESS;
+        }
 
-        if (m_engines_size > mtgpdc_params_11213_num)
-            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        if(m_host_side)
+        {
+            status = init_engines_host(m_engines);
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+            file_cache.store(m_engines, true, m_stream);
+            m_engines_initialized = true;
+            return ROCRAND_STATUS_SUCCESS;
+        }
 
-        status = rocrand_make_state_mtgp32(m_engines, mtgp32dc_params_fast_11213, m_engines_size, m_seed);
+        // Engines are initialized on the host (as rocrand_make_state_mtgp32 does)
+        std::vector<char> engines_host(sizeof(engine_type) * m_engines_size);
+        status =
+            init_engines_host(reinterpret_cast<engine_type *>(engines_host.data()));
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        status = rocrand_host::detail::copy_engines_from_host(
+            m_engines, m_engines_size, engines_host.data(), false, m_stream
+        );
         if(status != ROCRAND_STATUS_SUCCESS)
             return ROCRAND_STATUS_ALLOCATION_FAILED;
+        file_cache.store(m_engines, false, m_stream);
+
+        m_engines_initialized = true;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Returns size in bytes of the state returned by get_state()
+    size_t get_state_size() const
+    {
+        return sizeof(engine_type) * m_engines_size;
+    }
+
+    /// Initializes engines if needed and copies them to host memory \p state
+    rocrand_status get_state(void * state)
+    {
+        rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        return rocrand_host::detail::copy_engines_to_host(
+            state, m_engines, m_engines_size, m_host_side, m_stream
+        );
+    }
 
+    /// Replaces engines with \p state (in host memory) returned by get_state()
+    /// of a generator with the same launch configuration
+    rocrand_status set_state(const void * state)
+    {
+        // The state replaces engines of a trimmed generator
+        rocrand_status status = restore_engines(m_engines, m_engines_size, false);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        status = rocrand_host::detail::copy_engines_from_host(
+            m_engines, m_engines_size, state, m_host_side, m_stream
+        );
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
         m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Returns size of device memory of engines and Poisson tables
+    /// (rocrand_get_memory_usage())
+    size_t get_memory_usage() const
+    {
+        return engines_device_bytes(m_engines, m_engines_size) + m_poisson.device_bytes();
+    }
 
+    /// Copies engines to host memory and frees device memory of engines
+    /// and Poisson tables (rocrand_generator_trim()). The next init()
+    /// (every generate call) restores engines.
+    rocrand_status trim()
+    {
+        rocrand_status status = trim_engines(m_engines, m_engines_size, m_engines_initialized);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        m_poisson.clear();
         return ROCRAND_STATUS_SUCCESS;
     }
 
+    /// Returns size in bytes of the data written by save()
+    size_t get_save_size() const
+    {
+        return sizeof(save_data) + get_state_size();
+    }
+
+    /// Writes seed, offset, launch configuration, ordering and engines
+    /// to host memory \p data
+    rocrand_status save(void * data)
+    {
+        const save_data header = {
+            m_seed, m_offset, m_blocks, static_cast<unsigned int>(m_ordering),
+            m_auto_launch_config ? 1U : 0U
+        };
+        std::memcpy(data, &header, sizeof(save_data));
+        return get_state(static_cast<char *>(data) + sizeof(save_data));
+    }
+
+    /// Restores the generator from \p data of \p size bytes written by save()
+    rocrand_status load(const void * data, size_t size)
+    {
+        if(size < sizeof(save_data))
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        save_data header;
+        std::memcpy(&header, data, sizeof(save_data));
+        const size_t engines_size =
+            header.ordering == ROCRAND_ORDERING_PSEUDO_DYNAMIC ? s_default_blocks : header.blocks;
+        if(size != sizeof(save_data) + sizeof(engine_type) * engines_size)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        // Engines of ROCRAND_ORDERING_PSEUDO_DYNAMIC are set by the ordering
+        rocrand_status status = set_ordering(static_cast<rocrand_ordering>(header.ordering));
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        status = set_launch_config(header.blocks, s_threads);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        m_auto_launch_config = header.auto_launch_config != 0;
+        set_seed(header.seed);
+        set_offset(header.offset);
+        return set_state(static_cast<const char *>(data) + sizeof(save_data));
+    }
+
     template<class T, class Distribution = uniform_distribution<T> >
     rocrand_status generate(T * data, size_t data_size,
-                            Distribution distribution = Distribution())
+                        Distribution distribution = Distribution())
     {
         rocrand_status status = init();
         if (status != ROCRAND_STATUS_SUCCESS)
             return status;
 
+        rocrand_host::detail::profiling_range range("rocrand generate_kernel");
+        count_generate(data_size);
+
+        // Results of the dynamic ordering do not depend on the launch
+        // configuration, the tuned one is used if the library chooses it
+        unsigned int tuned_blocks;
+        unsigned int tuned_threads;
+        if(m_ordering == ROCRAND_ORDERING_PSEUDO_DYNAMIC
+            && get_tuned_launch_config<T>(data_size, tuned_blocks, tuned_threads))
+        {
+            set_launch_config(tuned_blocks, tuned_threads);
+            m_auto_launch_config = true;
+        }
+
+        if(m_host_side)
+        {
+            engine_type * engines = m_engines;
+            const unsigned int stride = static_cast<unsigned int>(m_engines_size) * s_threads;
+            rocrand_host::detail::host_parallel_for(
+                m_engines_size,
+                [=](size_t engine_id)
+                {
+                    rocrand_host::detail::generate_engine_host<s_threads>(
+                        engines, engine_id, stride, data, data_size, distribution
+                    );
+                }
+            );
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        const size_t shared_bytes =
+            rocrand_host::detail::generate_shared_bytes<T, Distribution>(s_threads);
         hipLaunchKernelGGL(
             HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel<s_threads>),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, distribution
+            dim3(m_blocks), dim3(s_threads),
+            shared_bytes, m_stream,
+            m_engines, static_cast<unsigned int>(m_engines_size),
+            data, data_size, distribution, streaming_stores()
         );
         // Check kernel status
         if(hipPeekAtLastError() != hipSuccess)
@@ -273,43 +750,242 @@ public:
         return generate(data, data_size, distribution);
     }
 
+    /// Generates \p data_size integers in [\p lo, \p lo + \p range)
+    template<class T>
+    rocrand_status generate_uniform_range(T * data, size_t data_size, T lo, T range)
+    {
+        uniform_range_wide_distribution<T> distribution(lo, range);
+        return generate(data, data_size, distribution);
+    }
+
     template<class T>
     rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
     {
-        normal_distribution<T> distribution(mean, stddev);
+        normal_distribution<T> distribution(mean, stddev, fast_math());
         return generate(data, data_size, distribution);
     }
 
     template<class T>
     rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
     {
-        log_normal_distribution<T> distribution(mean, stddev);
+        log_normal_distribution<T> distribution(mean, stddev, fast_math());
         return generate(data, data_size, distribution);
     }
 
+    template<class T>
+    rocrand_status generate_exponential(T * data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    /// Generates Bernoulli decisions packed as bits (T is unsigned int)
+    /// or bytes (T is unsigned char)
+    template<class T>
+    rocrand_status generate_bernoulli(T * data, size_t data_size, double p)
+    {
+        bernoulli_distribution<T> distribution(p);
+        return generate(data, data_size, distribution);
+    }
+
+    /// Sets the maximum number of lambdas whose Poisson tables are cached
+    rocrand_status set_poisson_cache_capacity(size_t capacity)
+    {
+        if(capacity == 0)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        m_poisson.set_capacity(capacity);
+        m_poisson_host.set_capacity(capacity);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Computes and caches Poisson tables for \p count lambdas
+    rocrand_status prepare_poisson(const double * lambdas, size_t count)
+    {
+        for(size_t i = 0; i < count; i++)
+        {
+            try
+            {
+                if(m_host_side)
+                {
+                    m_poisson_host.set_lambda(lambdas[i]);
+                }
+                else
+                {
+                    m_poisson.set_lambda(lambdas[i], m_stream);
+                }
+            }
+            catch(rocrand_status status)
+            {
+                return status;
+            }
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
     {
         try
         {
-            m_poisson.set_lambda(lambda);
+            if(m_host_side)
+            {
+                m_poisson_host.set_lambda(lambda);
+            }
+            else
+            {
+                m_poisson.set_lambda(lambda, m_stream);
+            }
         }
         catch(rocrand_status status)
         {
             return status;
         }
+        if(m_host_side)
+        {
+            return generate(data, data_size, m_poisson_host.dis);
+        }
         return generate(data, data_size, m_poisson.dis);
     }
 
+    /// Generates \p data_size values of the discrete distribution with tables
+    /// \p tables in device memory (copied to the host for host-side generators)
+    rocrand_status generate_discrete(unsigned int * data, size_t data_size,
+                                     const rocrand_discrete_distribution_st& tables)
+    {
+        if(m_host_side)
+        {
+            rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_ALIAS, true> distribution;
+            try
+            {
+                distribution.init_from_device(tables);
+            }
+            catch(rocrand_status status)
+            {
+                distribution.deallocate();
+                return status;
+            }
+            const rocrand_status status = generate(data, data_size, distribution);
+            distribution.deallocate();
+            return status;
+        }
+        rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_ALIAS> distribution(tables);
+        return generate(data, data_size, distribution);
+    }
+
 private:
+    // Generator data written by save() before engines
+    struct save_data
+    {
+        unsigned long long seed;
+        unsigned long long offset;
+        unsigned int blocks;
+        unsigned int ordering;
+        // Whether the library chose the launch configuration (m_auto_launch_config)
+        unsigned int auto_launch_config;
+    };
+
     bool m_engines_initialized;
     engine_type * m_engines;
+    unsigned int m_blocks;
     size_t m_engines_size;
+    rocrand_ordering m_ordering;
 
     static constexpr uint32_t s_threads = 256;
-    static constexpr uint32_t s_blocks = 512;
+    static constexpr uint32_t s_default_blocks = 512;
+    static constexpr uint32_t s_max_blocks = 8 * mtgpdc_params_11213_num;
 
     // For caching of Poisson for consecutive generations with the same lambda
     poisson_distribution_manager<> m_poisson;
+    poisson_distribution_manager<ROCRAND_DISCRETE_METHOD_ALIAS, true> m_poisson_host;
+
+    // Host-side equivalent of rocrand_make_state_mtgp32, initializes engines
+    // in host memory. Engines beyond the number of parameter sets reuse
+    // parameter sets: they produce distinct parts of the same sequence
+    // (with period 2^11213 - 1) starting from states with different seeds.
+    //
+    // With a non-zero offset every engine skips m_offset values of its sequence:
+    // short offsets are stepped, longer ones use the jump polynomial of the
+    // engine's parameter set (see mtgp32_jump.hpp), so the cost per engine
+    // is the same for any offset.
+    rocrand_status init_engines_host(engine_type * engines) const
+    {
+        const unsigned long long seed = m_seed ^ (m_seed >> 32);
+        for(size_t i = 0; i < m_engines_size; i++)
+        {
+            init_engine(engines[i], i, (unsigned int)seed + i + 1);
+        }
+        if(m_offset == 0)
+            return ROCRAND_STATUS_SUCCESS;
+
+        if(m_offset < MTGP_TN)
+        {
+            rocrand_host::detail::host_parallel_for(m_engines_size, [&](size_t i)
+            {
+                unsigned int block[MTGP_TN];
+                engines[i].next_block(block, static_cast<unsigned int>(m_offset));
+            });
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        const size_t param_sets = std::min<size_t>(m_engines_size, mtgpdc_params_11213_num);
+        std::vector<rocrand_host::detail::gf2_polynomial> jumps(param_sets);
+        rocrand_host::detail::host_parallel_for(param_sets, [&](size_t i)
+        {
+            const rocrand_host::detail::gf2_polynomial phi = characteristic_polynomial(i);
+            if(rocrand_host::detail::gf2_degree(phi) == MTGP_MEXP)
+                jumps[i] = rocrand_host::detail::mtgp32_jump_polynomial(phi, m_offset - MTGP_TN);
+        });
+        for(size_t i = 0; i < param_sets; i++)
+        {
+            if(jumps[i].empty())
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        rocrand_host::detail::host_parallel_for(m_engines_size, [&](size_t i)
+        {
+            rocrand_host::detail::mtgp32_jump(engines[i], jumps[i % mtgpdc_params_11213_num]);
+        });
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    static void init_engine(engine_type& engine, size_t i, unsigned int seed)
+    {
+        const mtgp32_fast_params& params =
+            mtgp32dc_params_fast_11213[i % mtgpdc_params_11213_num];
+        rocrand_device::rocrand_mtgp32_init_state(
+            &(engine.m_state.status[0]), &params, seed
+        );
+        engine.m_state.offset = 0;
+        engine.m_state.id = i;
+        engine.pos_tbl = params.pos;
+        engine.sh1_tbl = params.sh1;
+        engine.sh2_tbl = params.sh2;
+        engine.mask = mtgp32dc_params_fast_11213[0].mask;
+        for(int j = 0; j < MTGP_TS; j++)
+        {
+            engine.param_tbl[j] = params.tbl[j];
+            engine.temper_tbl[j] = params.tmp_tbl[j];
+            engine.single_temper_tbl[j] = params.flt_tmp_tbl[j];
+        }
+    }
+
+    // Characteristic polynomial of the parameter set, computed once per process
+    static rocrand_host::detail::gf2_polynomial characteristic_polynomial(size_t param_set)
+    {
+        static std::mutex mutex;
+        static std::vector<rocrand_host::detail::gf2_polynomial>
+            polynomials(mtgpdc_params_11213_num);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if(!polynomials[param_set].empty())
+                return polynomials[param_set];
+        }
+        engine_type engine;
+        init_engine(engine, param_set, 1);
+        rocrand_host::detail::gf2_polynomial phi =
+            rocrand_host::detail::mtgp32_characteristic_polynomial(engine);
+        std::lock_guard<std::mutex> lock(mutex);
+        polynomials[param_set] = phi;
+        return phi;
+    }
 
     // m_seed from base_type
     // m_offset from base_type
@@ -0,0 +1,375 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_MTGP32_JUMP_H_
+#define ROCRAND_RNG_MTGP32_JUMP_H_
+
+#include <algorithm>
+#include <vector>
+
+#include <rocrand_mtgp32.h>
+
+// Jump-ahead of MTGP32 engines on the host.
+//
+// The recurrence of MTGP32 is linear over GF(2): if phi is the characteristic
+// polynomial of a parameter set (of degree MTGP_MEXP), advancing a state by
+// j values is the same as evaluating c(F) on it, where F is one step of the
+// recurrence and c = x^j mod phi. c(F) is computed as a sum of at most
+// MTGP_MEXP consecutive states, so the cost of a jump does not depend on j
+// (besides O(log j) polynomial multiplications). This is the method of the
+// MTGP reference jump code, phi is found by Berlekamp-Massey from the output.
+
+namespace rocrand_host {
+namespace detail {
+
+// Polynomial over GF(2), bit i is the coefficient of x^i
+typedef std::vector<unsigned long long> gf2_polynomial;
+
+inline int gf2_degree(const gf2_polynomial& p)
+{
+    for(size_t w = p.size(); w-- > 0;)
+    {
+        if(p[w] != 0)
+        {
+            int b = 63;
+            while(((p[w] >> b) & 1ULL) == 0)
+                b--;
+            return static_cast<int>(w * 64) + b;
+        }
+    }
+    return -1;
+}
+
+inline unsigned int gf2_coefficient(const gf2_polynomial& p, size_t i)
+{
+    return static_cast<unsigned int>((p[i / 64] >> (i % 64)) & 1ULL);
+}
+
+// p ^= q * x^shift using the first q_words words of q, p must be large enough
+inline void gf2_add_shifted(gf2_polynomial& p, const gf2_polynomial& q, size_t shift,
+                            size_t q_words)
+{
+    const size_t words = shift / 64;
+    const unsigned int bits = shift % 64;
+    for(size_t k = 0; k < q_words; k++)
+    {
+        if(q[k] == 0)
+            continue;
+        p[k + words] ^= q[k] << bits;
+        if(bits != 0 && k + words + 1 < p.size())
+            p[k + words + 1] ^= q[k] >> (64 - bits);
+    }
+}
+
+// 64 coefficients of p starting at x^i
+inline unsigned long long gf2_coefficients64(const gf2_polynomial& p, size_t i)
+{
+    const size_t w = i / 64;
+    const unsigned int b = i % 64;
+    unsigned long long v = w < p.size() ? p[w] >> b : 0;
+    if(b != 0 && w + 1 < p.size())
+        v |= p[w + 1] << (64 - b);
+    return v;
+}
+
+// Reduction modulo a polynomial m, 64 coefficients at a time. The remainders
+// of 8-coefficient parts are looked up in tables, the table of the j-th part
+// contains v * x^(degree + 8j) mod m for all polynomials v of degree < 8, so
+// they are added at word boundaries, without shifts.
+struct gf2_modulus
+{
+    explicit gf2_modulus(const gf2_polynomial& m)
+        : degree(gf2_degree(m)), words(degree / 64 + 1), table(8 * 256 * words, 0)
+    {
+        // r = x^degree mod m
+        gf2_polynomial r(words + 1, 0);
+        std::copy(m.begin(), m.begin() + std::min(m.size(), words), r.begin());
+        r[degree / 64] &= ~(1ULL << (degree % 64));
+        for(unsigned int j = 0; j < 64; j++)
+        {
+            std::copy(r.begin(), r.begin() + words, entry(j / 8, 1U << (j % 8)));
+            // r = r * x mod m
+            for(size_t w = words; w > 0; w--)
+            {
+                r[w] = (r[w] << 1) | (r[w - 1] >> 63);
+            }
+            r[0] <<= 1;
+            if((r[degree / 64] >> (degree % 64)) & 1ULL)
+            {
+                for(size_t w = 0; w < m.size() && w <= words; w++)
+                    r[w] ^= m[w];
+            }
+        }
+        for(unsigned int j = 0; j < 8; j++)
+        {
+            for(unsigned int v = 3; v < 256; v++)
+            {
+                const unsigned int low = v & (0U - v);
+                if(v == low)
+                    continue;
+                const unsigned long long * a = entry(j, v ^ low);
+                const unsigned long long * b = entry(j, low);
+                unsigned long long * t = entry(j, v);
+                for(size_t w = 0; w < words; w++)
+                    t[w] = a[w] ^ b[w];
+            }
+        }
+    }
+
+    // Replaces p with p mod m, the result has words words
+    void reduce(gf2_polynomial& p) const
+    {
+        const int top = gf2_degree(p);
+        if(top >= degree)
+        {
+            for(long q = (top - degree) / 64; q >= 0; q--)
+            {
+                const size_t i = degree + q * 64;
+                const unsigned long long v = gf2_coefficients64(p, i);
+                if(v == 0)
+                    continue;
+                // Clears the 64 coefficients and adds their remainder
+                p[i / 64] ^= v << (i % 64);
+                if(i % 64 != 0)
+                    p[i / 64 + 1] ^= v >> (64 - i % 64);
+                for(unsigned int j = 0; j < 8; j++)
+                {
+                    const unsigned int part = (v >> (8 * j)) & 0xFF;
+                    if(part == 0)
+                        continue;
+                    const unsigned long long * t = entry(j, part);
+                    unsigned long long * r = &p[q];
+                    for(size_t w = 0; w < words; w++)
+                        r[w] ^= t[w];
+                }
+            }
+        }
+        p.resize(words, 0);
+    }
+
+    const unsigned long long * entry(unsigned int j, unsigned int v) const
+    {
+        return &table[(j * 256 + v) * words];
+    }
+
+    unsigned long long * entry(unsigned int j, unsigned int v)
+    {
+        return &table[(j * 256 + v) * words];
+    }
+
+    int degree;
+    size_t words;
+    std::vector<unsigned long long> table;
+};
+
+inline unsigned long long gf2_spread32(unsigned long long x)
+{
+    x &= 0xFFFFFFFFULL;
+    x = (x | (x << 16)) & 0x0000FFFF0000FFFFULL;
+    x = (x | (x << 8)) & 0x00FF00FF00FF00FFULL;
+    x = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    x = (x | (x << 2)) & 0x3333333333333333ULL;
+    x = (x | (x << 1)) & 0x5555555555555555ULL;
+    return x;
+}
+
+// x^e mod m
+inline gf2_polynomial gf2_power_of_x(unsigned long long e, const gf2_modulus& m)
+{
+    gf2_polynomial r(m.words, 0);
+    r[0] = 1;
+    int b = 63;
+    while(b >= 0 && ((e >> b) & 1ULL) == 0)
+        b--;
+    for(; b >= 0; b--)
+    {
+        // Squaring over GF(2) spreads the coefficients: (sum a_i x^i)^2 = sum a_i x^2i
+        gf2_polynomial s(2 * m.words + 1, 0);
+        for(size_t w = 0; w < m.words; w++)
+        {
+            s[2 * w] = gf2_spread32(r[w]);
+            s[2 * w + 1] = gf2_spread32(r[w] >> 32);
+        }
+        if((e >> b) & 1ULL)
+        {
+            for(size_t w = s.size() - 1; w > 0; w--)
+            {
+                s[w] = (s[w] << 1) | (s[w - 1] >> 63);
+            }
+            s[0] <<= 1;
+        }
+        m.reduce(s);
+        r.swap(s);
+    }
+    return r;
+}
+
+// Characteristic polynomial of the shortest linear recurrence of the sequence
+// bits[0..size) (Berlekamp-Massey), x^L + c_1 x^(L-1) + ... + c_L for
+// bits[n] = c_1 bits[n - 1] + ... + c_L bits[n - L].
+inline gf2_polynomial gf2_minimal_polynomial(const std::vector<unsigned char>& bits)
+{
+    const size_t size = bits.size();
+    const size_t words = size / 64 + 2;
+    // The sequence is stored reversed (bit size - 1 - n is bits[n]), so
+    // 64 terms bits[n - i] for i = 64w..64w+63 are one unaligned word
+    std::vector<unsigned long long> reversed(words + 1, 0);
+    for(size_t n = 0; n < size; n++)
+    {
+        if(bits[n])
+        {
+            const size_t i = size - 1 - n;
+            reversed[i / 64] |= 1ULL << (i % 64);
+        }
+    }
+
+    // Connection polynomials, bit i is c_i. Degrees do not exceed lengths,
+    // so only the first length / 64 + 1 words are updated
+    gf2_polynomial c(words, 0);
+    gf2_polynomial b(words, 0);
+    gf2_polynomial t(words, 0);
+    c[0] = 1;
+    b[0] = 1;
+    size_t length = 0;
+    size_t b_length = 0;
+    size_t shift = 1;
+    for(size_t n = 0; n < size; n++)
+    {
+        // discrepancy = sum c_i bits[n - i], i <= length
+        const size_t q = (size - 1 - n) / 64;
+        const unsigned int r = (size - 1 - n) % 64;
+        unsigned long long acc = 0;
+        if(r == 0)
+        {
+            for(size_t w = 0; w <= length / 64; w++)
+                acc ^= c[w] & reversed[q + w];
+        }
+        else
+        {
+            for(size_t w = 0; w <= length / 64; w++)
+                acc ^= c[w] & ((reversed[q + w] >> r) | (reversed[q + w + 1] << (64 - r)));
+        }
+        acc ^= acc >> 32;
+        acc ^= acc >> 16;
+        acc ^= acc >> 8;
+        acc ^= acc >> 4;
+        acc ^= acc >> 2;
+        acc ^= acc >> 1;
+        if((acc & 1ULL) == 0)
+        {
+            shift++;
+        }
+        else if(2 * length <= n)
+        {
+            std::copy(c.begin(), c.begin() + length / 64 + 1, t.begin());
+            gf2_add_shifted(c, b, shift, b_length / 64 + 1);
+            b.swap(t);
+            b_length = length;
+            length = n + 1 - length;
+            shift = 1;
+        }
+        else
+        {
+            gf2_add_shifted(c, b, shift, b_length / 64 + 1);
+            shift++;
+        }
+    }
+
+    gf2_polynomial p(length / 64 + 1, 0);
+    for(size_t i = 0; i <= length; i++)
+    {
+        if(gf2_coefficient(c, i))
+            p[(length - i) / 64] |= 1ULL << ((length - i) % 64);
+    }
+    return p;
+}
+
+// Characteristic polynomial of the parameter set of engine, it does not depend
+// on the state of engine (given that the state is not zero)
+inline gf2_polynomial mtgp32_characteristic_polynomial(rocrand_device::mtgp32_engine engine)
+{
+    unsigned int block[MTGP_TN];
+    // The first state may have a component which is not in the period
+    // (bits of the first word excluded by the mask), one step removes it
+    engine.next_block(block, MTGP_TN);
+    // Bit 0 of the output is a linear function of the state
+    std::vector<unsigned char> bits;
+    bits.reserve(2 * MTGP_MEXP + 2 * MTGP_TN);
+    while(bits.size() < 2 * MTGP_MEXP + MTGP_TN)
+    {
+        engine.next_block(block, MTGP_TN);
+        for(unsigned int t = 0; t < MTGP_TN; t++)
+            bits.push_back(block[t] & 1U);
+    }
+    return gf2_minimal_polynomial(bits);
+}
+
+// Jump polynomial x^distance mod phi for mtgp32_jump()
+inline gf2_polynomial mtgp32_jump_polynomial(const gf2_polynomial& phi,
+                                             unsigned long long distance)
+{
+    const gf2_modulus modulus(phi);
+    return gf2_power_of_x(distance, modulus);
+}
+
+// Advances engine by MTGP_TN + distance values, where jump is
+// mtgp32_jump_polynomial(phi, distance). The engine's state is replaced
+// with an equivalent state with offset 0.
+inline void mtgp32_jump(rocrand_device::mtgp32_engine& engine, const gf2_polynomial& jump)
+{
+    unsigned int block[MTGP_TN];
+    // Advancing by one block first makes the state periodic (see
+    // mtgp32_characteristic_polynomial()), then c(F) is exact
+    engine.next_block(block, MTGP_TN);
+
+    // Words of the consecutive states: state k is history[k..k + MTGP_N)
+    const size_t history_size = MTGP_MEXP + MTGP_N - 1;
+    std::vector<unsigned int> history;
+    history.reserve(history_size + MTGP_TN);
+    for(int j = 0; j < MTGP_N; j++)
+        history.push_back(engine.m_state.status[(engine.m_state.offset + j) & MTGP_MASK]);
+    while(history.size() < history_size)
+    {
+        const int offset = engine.m_state.offset;
+        engine.next_block(block, MTGP_TN);
+        for(int t = 0; t < MTGP_TN; t++)
+            history.push_back(engine.m_state.status[(offset + MTGP_N + t) & MTGP_MASK]);
+    }
+
+    unsigned int status[MTGP_N] = { 0 };
+    const size_t terms = std::min<size_t>(jump.size() * 64, MTGP_MEXP);
+    for(size_t i = 0; i < terms; i++)
+    {
+        if(gf2_coefficient(jump, i))
+        {
+            const unsigned int * state = &history[i];
+            for(int j = 0; j < MTGP_N; j++)
+                status[j] ^= state[j];
+        }
+    }
+    for(int j = 0; j < MTGP_N; j++)
+        engine.m_state.status[j] = status[j];
+    engine.m_state.offset = 0;
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_MTGP32_JUMP_H_
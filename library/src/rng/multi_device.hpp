@@ -0,0 +1,286 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_MULTI_DEVICE_H_
+#define ROCRAND_RNG_MULTI_DEVICE_H_
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+struct rocrand_multi_device_generator_base_type
+{
+    rocrand_multi_device_generator_base_type(rocrand_rng_type rng_type) : rng_type(rng_type) {}
+    const rocrand_rng_type rng_type;
+
+    virtual ~rocrand_multi_device_generator_base_type() {}
+};
+
+// Generator which shards one logical sequence of Generator across devices.
+// Every device owns a generator with the same seed, offset and launch
+// configuration (i.e. a copy of all engines), and each generate call produces
+// on every device its own slice of the values the single-device generator
+// would produce. Engines skip values of other slices using discard, so all
+// copies stay in the same state.
+template<class Generator>
+class rocrand_multi_device : public rocrand_multi_device_generator_base_type
+{
+public:
+    using base_type = rocrand_multi_device_generator_base_type;
+
+    // Slices start at multiples of this number of values (points for quasi-random
+    // generators), so vectorized stores of all distributions use the same engines
+    // as in a single-device run
+    static constexpr size_t slice_granularity = 64;
+
+    rocrand_multi_device(rocrand_rng_type rng_type,
+                         const int * devices,
+                         unsigned int device_count)
+        : base_type(rng_type), m_dimensions(1), m_first_slice(0), m_slice_count(device_count)
+    {
+        if(devices == NULL || device_count == 0)
+        {
+            throw ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        int current_device;
+        if(hipGetDevice(&current_device) != hipSuccess)
+        {
+            throw ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        try
+        {
+            for(unsigned int i = 0; i < device_count; i++)
+            {
+                if(hipSetDevice(devices[i]) != hipSuccess)
+                {
+                    throw ROCRAND_STATUS_OUT_OF_RANGE;
+                }
+                m_devices.push_back(devices[i]);
+                m_generators.emplace_back(new Generator());
+            }
+        }
+        catch(...)
+        {
+            destroy_generators();
+            hipSetDevice(current_device);
+            throw;
+        }
+        hipSetDevice(current_device);
+    }
+
+    // Generator of only the rank-th of world_size slices, on the current device.
+    // Processes of a distributed run (e.g. MPI ranks) with generators of all ranks
+    // produce together the values of one single-device generator.
+    rocrand_multi_device(rocrand_rng_type rng_type,
+                         unsigned int rank,
+                         unsigned int world_size)
+        : base_type(rng_type), m_dimensions(1), m_first_slice(rank), m_slice_count(world_size)
+    {
+        if(world_size == 0 || rank >= world_size)
+        {
+            throw ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        int current_device;
+        if(hipGetDevice(&current_device) != hipSuccess)
+        {
+            throw ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        m_devices.push_back(current_device);
+        m_generators.emplace_back(new Generator());
+    }
+
+    ~rocrand_multi_device()
+    {
+        int current_device;
+        if(hipGetDevice(&current_device) == hipSuccess)
+        {
+            destroy_generators();
+            hipSetDevice(current_device);
+        }
+    }
+
+    unsigned int get_device_count() const
+    {
+        return static_cast<unsigned int>(m_devices.size());
+    }
+
+    void set_seed(unsigned long long seed)
+    {
+        for(auto& generator : m_generators)
+        {
+            generator->set_seed(seed);
+        }
+    }
+
+    void set_offset(unsigned long long offset)
+    {
+        for(auto& generator : m_generators)
+        {
+            generator->set_offset(offset);
+        }
+    }
+
+    rocrand_status set_dimensions(unsigned int dimensions)
+    {
+        for(auto& generator : m_generators)
+        {
+            rocrand_status status = generator->set_dimensions(dimensions);
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+        }
+        m_dimensions = dimensions;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Returns the first value (\p offset) and the number of values (\p size) of
+    /// device_index-th device's slice of a generate call producing \p n values.
+    /// For quasi-random generators \p offset is the index of the first point,
+    /// and the slice contains \p size / dimensions points of every dimension.
+    rocrand_status get_slice(size_t n, unsigned int device_index,
+                             size_t * offset, size_t * size) const
+    {
+        if(device_index >= m_devices.size())
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        size_t units;
+        rocrand_status status = get_units(n, units);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        size_t begin, end;
+        get_slice_units(units, device_index, begin, end);
+        *offset = begin;
+        *size = (end - begin) * (is_quasi() ? m_dimensions : 1);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status generate(unsigned int * const * outputs, size_t n)
+    {
+        return generate_slices(
+            outputs, n,
+            [](Generator * generator, unsigned int * data, size_t units, size_t begin, size_t end)
+            {
+                return generator->generate_slice(data, units, begin, end);
+            }
+        );
+    }
+
+    rocrand_status generate_uniform(float * const * outputs, size_t n)
+    {
+        return generate_slices(
+            outputs, n,
+            [](Generator * generator, float * data, size_t units, size_t begin, size_t end)
+            {
+                return generator->generate_uniform_slice(data, units, begin, end);
+            }
+        );
+    }
+
+    rocrand_status generate_normal(float * const * outputs, size_t n, float mean, float stddev)
+    {
+        return generate_slices(
+            outputs, n,
+            [mean, stddev](Generator * generator, float * data, size_t units, size_t begin, size_t end)
+            {
+                return generator->generate_normal_slice(data, units, begin, end, mean, stddev);
+            }
+        );
+    }
+
+private:
+    std::vector<int> m_devices;
+    std::vector<std::unique_ptr<Generator>> m_generators;
+    unsigned int m_dimensions;
+    // The i-th device produces the slice m_first_slice + i of m_slice_count
+    unsigned int m_first_slice;
+    unsigned int m_slice_count;
+
+    bool is_quasi() const
+    {
+        return rng_type == ROCRAND_RNG_QUASI_SOBOL32
+            || rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32
+            || rng_type == ROCRAND_RNG_QUASI_SOBOL64
+            || rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64;
+    }
+
+    // Number of values per dimension
+    rocrand_status get_units(size_t n, size_t& units) const
+    {
+        if(is_quasi() && n % m_dimensions != 0)
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        units = n / (is_quasi() ? m_dimensions : 1);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    void get_slice_units(size_t units, unsigned int device_index,
+                         size_t& begin, size_t& end) const
+    {
+        const size_t count = m_slice_count;
+        const size_t slice = m_first_slice + device_index;
+        const size_t chunk =
+            ((units + count - 1) / count + slice_granularity - 1)
+            / slice_granularity * slice_granularity;
+        begin = std::min(units, chunk * slice);
+        end = std::min(units, chunk * (slice + 1));
+    }
+
+    template<class T, class GenerateSlice>
+    rocrand_status generate_slices(T * const * outputs, size_t n, GenerateSlice generate_slice)
+    {
+        if(outputs == NULL)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        size_t units;
+        rocrand_status status = get_units(n, units);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        int current_device;
+        if(hipGetDevice(&current_device) != hipSuccess)
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        // Kernels are asynchronous, so all devices generate their slices concurrently
+        for(size_t i = 0; i < m_devices.size() && status == ROCRAND_STATUS_SUCCESS; i++)
+        {
+            size_t begin, end;
+            get_slice_units(units, i, begin, end);
+            if(hipSetDevice(m_devices[i]) != hipSuccess)
+            {
+                status = ROCRAND_STATUS_INTERNAL_ERROR;
+                break;
+            }
+            status = generate_slice(m_generators[i].get(), outputs[i], units, begin, end);
+        }
+        hipSetDevice(current_device);
+        return status;
+    }
+
+    void destroy_generators()
+    {
+        // Engines are freed on their devices
+        for(size_t i = 0; i < m_generators.size(); i++)
+        {
+            hipSetDevice(m_devices[i]);
+            m_generators[i].reset();
+        }
+        m_generators.clear();
+    }
+};
+
+#endif // ROCRAND_RNG_MULTI_DEVICE_H_
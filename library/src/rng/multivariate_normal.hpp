@@ -0,0 +1,231 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_MULTIVARIATE_NORMAL_H_
+#define ROCRAND_RNG_MULTIVARIATE_NORMAL_H_
+
+#include <algorithm>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "allocator.hpp"
+#include "common.hpp"
+
+// Multivariate normal vectors x = mean + L z (rocrand_generate_multivariate_normal()),
+// L is a lower triangular factor of the covariance and z are standard normal
+// values. Every block loads z of a tile of vectors to shared memory (from
+// a Source, see buffer_normal_source) and computes all elements of the tile,
+// columns of L are read from a transposed copy, so threads computing
+// consecutive elements read consecutive values.
+
+namespace rocrand_host {
+namespace detail {
+
+    constexpr unsigned int multivariate_normal_threads = 256;
+    constexpr unsigned int multivariate_normal_max_blocks = 1024;
+    // Size of tiles of z in shared memory (32 KB)
+    constexpr unsigned int multivariate_normal_shared_values = 8192;
+    constexpr unsigned int multivariate_normal_max_tile_vectors = 64;
+
+    // Source of standard normal values generated to a buffer,
+    // normals[v * dim + j] is z[j] of the vector v
+    struct buffer_normal_source
+    {
+        const float * normals;
+
+        // Loads count values starting at first to z by threads of the block
+        __forceinline__ __device__ __host__
+        void load(float * z, const size_t first, const unsigned int count,
+                  const unsigned int thread, const unsigned int threads) const
+        {
+            for(unsigned int i = thread; i < count; i += threads)
+            {
+                z[i] = normals[first + i];
+            }
+        }
+    };
+
+    // Stores the transposed lower triangle of factor (values above the diagonal
+    // are ignored)
+    __global__
+    void transpose_factor_kernel(const float * factor,
+                                 const unsigned int dim,
+                                 float * factor_t)
+    {
+        const unsigned int thread_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+        const size_t size = static_cast<size_t>(dim) * dim;
+        for(size_t index = thread_id; index < size; index += stride)
+        {
+            const size_t i = index / dim;
+            const size_t j = index % dim;
+            factor_t[j * dim + i] = j <= i ? factor[index] : 0.0f;
+        }
+    }
+
+    template<class Source>
+    __global__
+    void multivariate_normal_kernel(float * output,
+                                    const size_t n_vectors,
+                                    const unsigned int dim,
+                                    const unsigned int tile_vectors,
+                                    const float * factor_t,
+                                    const float * mean,
+                                    Source source)
+    {
+        extern __shared__ float multivariate_normal_shared[];
+        float * z = multivariate_normal_shared;
+
+        const size_t tiles = (n_vectors + tile_vectors - 1) / tile_vectors;
+        for(size_t tile = hipBlockIdx_x; tile < tiles; tile += hipGridDim_x)
+        {
+            const size_t first_vector = tile * tile_vectors;
+            const unsigned int count = static_cast<unsigned int>(
+                std::min<size_t>(tile_vectors, n_vectors - first_vector)
+            ) * dim;
+            source.load(z, first_vector * dim, count, hipThreadIdx_x, hipBlockDim_x);
+            __syncthreads();
+
+            for(unsigned int index = hipThreadIdx_x; index < count; index += hipBlockDim_x)
+            {
+                const unsigned int v = index / dim;
+                const unsigned int i = index % dim;
+                const float * zv = z + v * dim;
+                float x = mean == NULL ? 0.0f : mean[i];
+                for(unsigned int j = 0; j <= i; j++)
+                {
+                    x += factor_t[j * dim + i] * zv[j];
+                }
+                output[first_vector * dim + index] = x;
+            }
+            __syncthreads();
+        }
+    }
+
+    // Returns the number of vectors of a tile of z in shared memory
+    inline unsigned int get_multivariate_normal_tile_vectors(unsigned int dim)
+    {
+        return std::max(1U, std::min(multivariate_normal_shared_values / dim,
+                                     multivariate_normal_max_tile_vectors));
+    }
+
+    // Computes n_vectors vectors of dim values with standard normal values of
+    // source, factor_t is a temporary buffer of dim * dim values
+    template<class Source>
+    rocrand_status launch_multivariate_normal(hipStream_t stream,
+                                              float * output,
+                                              size_t n_vectors,
+                                              unsigned int dim,
+                                              const float * factor,
+                                              const float * mean,
+                                              float * factor_t,
+                                              Source source)
+    {
+        const size_t factor_size = static_cast<size_t>(dim) * dim;
+        const unsigned int transpose_blocks = static_cast<unsigned int>(std::min<size_t>(
+            (factor_size + multivariate_normal_threads - 1) / multivariate_normal_threads,
+            multivariate_normal_max_blocks
+        ));
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(transpose_factor_kernel),
+            dim3(transpose_blocks), dim3(multivariate_normal_threads), 0, stream,
+            factor, dim, factor_t
+        );
+
+        const unsigned int tile_vectors = get_multivariate_normal_tile_vectors(dim);
+        const size_t shared_bytes = sizeof(float) * tile_vectors * dim;
+        const unsigned int blocks = static_cast<unsigned int>(std::min<size_t>(
+            (n_vectors + tile_vectors - 1) / tile_vectors, multivariate_normal_max_blocks
+        ));
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(multivariate_normal_kernel<Source>),
+            dim3(blocks), dim3(multivariate_normal_threads), shared_bytes, stream,
+            output, n_vectors, dim, tile_vectors, factor_t, mean, source
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Computes vectors with standard normal values generated by
+    // generate_normal(data, size) to a temporary buffer (host memory
+    // for host-side generators), for generators without fused generation
+    template<class GenerateNormal>
+    rocrand_status generate_multivariate_normal(hipStream_t stream,
+                                                bool host_side,
+                                                float * output,
+                                                size_t n_vectors,
+                                                unsigned int dim,
+                                                const float * factor,
+                                                const float * mean,
+                                                GenerateNormal generate_normal)
+    {
+        const size_t size = n_vectors * dim;
+        if(size == 0)
+            return ROCRAND_STATUS_SUCCESS;
+        if(host_side)
+        {
+            std::vector<float> normals(size);
+            const rocrand_status status = generate_normal(normals.data(), size);
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+            const float * z = normals.data();
+            host_parallel_for(
+                size,
+                [=](size_t index)
+                {
+                    const size_t i = index % dim;
+                    const float * zv = z + (index - i);
+                    float x = mean == NULL ? 0.0f : mean[i];
+                    for(size_t j = 0; j <= i; j++)
+                    {
+                        x += factor[i * dim + j] * zv[j];
+                    }
+                    output[index] = x;
+                }
+            );
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        // Normal values are followed by the transposed factor
+        const size_t normals_size = (size + 63) / 64 * 64;
+        float * buffer;
+        if(device_malloc(&buffer, sizeof(float) * (normals_size + static_cast<size_t>(dim) * dim), stream)
+            != hipSuccess)
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        rocrand_status status = generate_normal(buffer, size);
+        if(status == ROCRAND_STATUS_SUCCESS)
+        {
+            status = launch_multivariate_normal(
+                stream, output, n_vectors, dim, factor, mean, buffer + normals_size,
+                buffer_normal_source { buffer }
+            );
+        }
+        device_free(buffer, stream);
+        return status;
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_MULTIVARIATE_NORMAL_H_
@@ -54,30 +54,24 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define ROCRAND_RNG_PHILOX4X32_10_H_
 
 #include <algorithm>
+#include <cstring>
+#include <vector>
 #include <hip/hip_runtime.h>
 
 #include <rocrand.h>
 
 #include "common.hpp"
 #include "generator_type.hpp"
+#include "engines_cache.hpp"
 #include "device_engines.hpp"
 #include "distributions.hpp"
+#include "multivariate_normal.hpp"
+
+#include <rocrand_matrix.h>
 
 namespace rocrand_host {
 namespace detail {
 
-    inline __device__ unsigned int warp_reduce_min(unsigned int val, int size) {
-      for (int offset = size/2; offset > 0; offset /= 2) {
-        #if defined(__HIP_PLATFORM_NVCC__) && __CUDACC_VER_MAJOR__ >= 9
-        unsigned int temp = __shfl_xor_sync(0xffffffff, (int)val, offset);
-        #else
-        unsigned int temp = __shfl_xor((int)val, offset);
-        #endif
-        val = (temp < val) ? temp : val;
-      }
-      return val;
-    }
-
     struct philox4x32_10_device_engine : public ::rocrand_device::philox4x32_10_engine
     {
         typedef ::rocrand_device::philox4x32_10_engine base_type;
@@ -103,50 +97,89 @@ namespace detail {
         {
             uint4 ret = m_state.result;
             this->discard_state(leap);
-            m_state.result = this->ten_rounds(m_state.counter, m_state.key);
+            m_state.result = this->rounds(m_state.counter, m_state.key);
             return ret;
         }
 
+        // Values of \p counter with \p key, computed without a state
+        __forceinline__ __device__ __host__
+        static uint4 counter_values(const uint4 counter, const uint2 key)
+        {
+            return base_type::rounds(counter, key);
+        }
+
         // m_state from base class
     };
 
     __global__
     void init_engines_kernel(philox4x32_10_device_engine * engines,
+                             const size_t engines_size,
                              const unsigned long long seed,
                              const unsigned long long offset)
     {
         const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-        engines[engine_id] = philox4x32_10_device_engine(seed, engine_id, offset);
+        if(engine_id < engines_size)
+            engines[engine_id] = philox4x32_10_device_engine(seed, engine_id, offset);
+    }
+
+    // Returns values of States consecutive states of the engine and skips
+    // states of other threads of the engine (they use the next
+    // States * (ThreadsPerEngine - 1) states)
+    template<unsigned int ThreadsPerEngine, unsigned int States>
+    __forceinline__ __device__ __host__
+    void next_leap_values(philox4x32_10_device_engine& engine,
+                          unsigned int (&values)[4 * States])
+    {
+        for(unsigned int s = 0; s < States; s++)
+        {
+            const uint4 v = engine.next4_leap(
+                s + 1 < States ? 1 : ThreadsPerEngine * States - (States - 1)
+            );
+            values[4 * s + 0] = v.x;
+            values[4 * s + 1] = v.y;
+            values[4 * s + 2] = v.z;
+            values[4 * s + 3] = v.w;
+        }
     }
 
+    // Work of one thread of generate_kernel, thread_id-th thread uses
+    // (thread_id / ThreadsPerEngine)-th engine. Returns the index of the next
+    // vector the thread would save: the thread with the smallest index among
+    // threads of the same engine has the most advanced state of the engine.
+    // Host-side generators call it for all threads, so they produce the same
+    // sequences as the kernel.
     template<unsigned int ThreadsPerEngine, class T, class Distribution>
-    __global__
-    void generate_kernel(philox4x32_10_device_engine * engines,
-                         T * data, const size_t n,
-                         Distribution distribution)
+    __forceinline__ __device__ __host__
+    size_t generate_thread(philox4x32_10_device_engine& engine,
+                           const unsigned int thread_id,
+                           const unsigned int stride,
+                           T * data, const size_t n,
+                           Distribution distribution,
+                           const bool streaming = false)
     {
         constexpr unsigned int input_width = Distribution::input_width;
         constexpr unsigned int output_width = Distribution::output_width;
 
-        static_assert(4 % input_width == 0 && input_width <= 4, "Incorrect input_width");
-        constexpr unsigned int output_per_thread = 4 / input_width;
+        static_assert(
+            (4 % input_width == 0 && input_width <= 4) || input_width % 4 == 0,
+            "Incorrect input_width"
+        );
+        // Wide distributions (input_width > 4) use several states per output
+        constexpr unsigned int states = input_width > 4 ? input_width / 4 : 1;
+        constexpr unsigned int output_per_thread = input_width > 4 ? 1 : 4 / input_width;
         constexpr unsigned int full_output_width = output_per_thread * output_width;
 
         using vec_type = aligned_vec_type<T, output_per_thread * output_width>;
 
-        const unsigned int thread_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-        const unsigned int engine_id = thread_id/ThreadsPerEngine;
-        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
         size_t index = thread_id;
 
-        // Load device engine
-        philox4x32_10_device_engine engine = engines[engine_id];
-        if(hipThreadIdx_x%ThreadsPerEngine > 0)
+        if(thread_id%ThreadsPerEngine > 0)
         {
-            // Skips hipThreadIdx_x%ThreadsPerEngine states
-            engine.discard(4 * (hipThreadIdx_x%ThreadsPerEngine));
+            // Skips states of thread_id%ThreadsPerEngine threads
+            engine.discard(4 * states * (thread_id%ThreadsPerEngine));
         }
 
+        unsigned int vs[4 * states];
         unsigned int input[input_width];
         T output[output_per_thread][output_width];
 
@@ -155,7 +188,7 @@ namespace detail {
             (
                 full_output_width - uintptr / sizeof(T) % full_output_width
             ) % full_output_width;
-        const unsigned int head_size = min(n, misalignment);
+        const unsigned int head_size = n < misalignment ? n : misalignment;
         const unsigned int tail_size = (n - head_size) % full_output_width;
         const size_t vec_n = (n - head_size) / full_output_width;
 
@@ -163,8 +196,7 @@ namespace detail {
         vec_type * vec_data = reinterpret_cast<vec_type *>(data + misalignment);
         while(index < vec_n)
         {
-            const uint4 v = engine.next4_leap(ThreadsPerEngine);
-            const unsigned int vs[4] = { v.x, v.y, v.z, v.w };
+            next_leap_values<ThreadsPerEngine, states>(engine, vs);
             for(unsigned int s = 0; s < output_per_thread; s++)
             {
                 for(unsigned int i = 0; i < input_width; i++)
@@ -173,27 +205,22 @@ namespace detail {
                 }
                 distribution(input, output[s]);
             }
-            vec_data[index] = *reinterpret_cast<vec_type *>(output);
+            store_vec(vec_data + index, *reinterpret_cast<vec_type *>(output), streaming);
             // Next position
             index += stride;
         }
 
-        // Find thread with the smallest state of the engine which id is engine_id
-        unsigned int index_min = warp_reduce_min(index, ThreadsPerEngine);
-        const bool smallest_state = (index == index_min);
-
         // Check if we need to save head and tail.
         // Those numbers should be generated by the thread that would
         // save next vec_type.
-        // If this condition is met, then we know that (index == index_min)
-        // is also true for that thread, so we don't need to check that.
+        // If this condition is met, then we know that this thread has
+        // the smallest index among threads of the engine.
         if(index == vec_n)
         {
             // If data is not aligned by sizeof(vec_type)
             if(head_size > 0)
             {
-                const uint4 v = engine.next4_leap(ThreadsPerEngine);
-                const unsigned int vs[4] = { v.x, v.y, v.z, v.w };
+                next_leap_values<ThreadsPerEngine, states>(engine, vs);
                 for(unsigned int s = 0; s < output_per_thread; s++)
                 {
                     for(unsigned int i = 0; i < input_width; i++)
@@ -206,7 +233,7 @@ namespace detail {
                     {
                         if(s * output_width + o < head_size)
                         {
-                            data[s * output_width + o] = output[s][o];
+                        data[s * output_width + o] = output[s][o];
                         }
                     }
                 }
@@ -214,8 +241,7 @@ namespace detail {
 
             if(tail_size > 0)
             {
-                const uint4 v = engine.next4_leap(ThreadsPerEngine);
-                const unsigned int vs[4] = { v.x, v.y, v.z, v.w };
+                next_leap_values<ThreadsPerEngine, states>(engine, vs);
                 for(unsigned int s = 0; s < output_per_thread; s++)
                 {
                     for(unsigned int i = 0; i < input_width; i++)
@@ -228,149 +254,2092 @@ namespace detail {
                     {
                         if(s * output_width + o < tail_size)
                         {
-                            data[n - tail_size + s * output_width + o] = output[s][o];
+                        data[n - tail_size + s * output_width + o] = output[s][o];
                         }
                     }
                 }
             }
         }
 
+        return index;
+    }
+
+    template<unsigned int ThreadsPerEngine, class T, class Distribution>
+    __global__
+    void generate_kernel(philox4x32_10_device_engine * engines,
+                         T * data, const size_t n,
+                         Distribution distribution,
+                         const bool streaming)
+    {
+        const unsigned int thread_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int engine_id = thread_id/ThreadsPerEngine;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        // Load device engine
+        philox4x32_10_device_engine engine = engines[engine_id];
+
+        const size_t index = generate_thread<ThreadsPerEngine>(
+            engine, thread_id, stride, data, n, distribution, streaming
+        );
+
+        // Find thread with the smallest state of the engine which id is engine_id
+        unsigned int index_min = warp_reduce_min(index, ThreadsPerEngine);
+        const bool smallest_state = (index == index_min);
+
         // Save engine
         if(smallest_state)
             engines[engine_id] = engine;
     }
 
-} // end namespace detail
-} // end namespace rocrand_host
+    // generate_kernel for discrete distributions with small packed alias
+    // tables (see discrete_shared_capacity): the table is loaded to shared
+    // memory, so random lookups do not load from global memory
+    template<unsigned int ThreadsPerEngine, class Distribution>
+    __global__
+    void generate_discrete_shared_kernel(philox4x32_10_device_engine * engines,
+                                         unsigned int * data, const size_t n,
+                                         Distribution distribution)
+    {
+        __shared__ unsigned long long table[discrete_shared_capacity];
+        distribution.load_shared(table);
 
-class rocrand_philox4x32_10 : public rocrand_generator_type<ROCRAND_RNG_PSEUDO_PHILOX4_32_10>
-{
-    static constexpr unsigned int s_threads_per_engine = 16;
+        const unsigned int thread_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int engine_id = thread_id/ThreadsPerEngine;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
 
-public:
-    using base_type = rocrand_generator_type<ROCRAND_RNG_PSEUDO_PHILOX4_32_10>;
-    using engine_type = ::rocrand_host::detail::philox4x32_10_device_engine;
+        philox4x32_10_device_engine engine = engines[engine_id];
 
-    rocrand_philox4x32_10(unsigned long long seed = 0,
-                          unsigned long long offset = 0,
-                          hipStream_t stream = 0)
-        : base_type(seed, offset, stream),
-          m_engines_initialized(false), m_engines(NULL),
-          m_engines_size(s_threads * s_blocks / s_threads_per_engine)
+        const size_t index = generate_thread<ThreadsPerEngine>(
+            engine, thread_id, stride, data, n, distribution
+        );
+
+        unsigned int index_min = warp_reduce_min(index, ThreadsPerEngine);
+        const bool smallest_state = (index == index_min);
+
+        if(smallest_state)
+            engines[engine_id] = engine;
+    }
+
+    // Host-side equivalent of ThreadsPerEngine threads of generate_kernel
+    // that use engine_id-th engine.
+    template<unsigned int ThreadsPerEngine, class T, class Distribution>
+    inline
+    void generate_engine_host(philox4x32_10_device_engine * engines,
+                              const unsigned int engine_id,
+                              const unsigned int stride,
+                              T * data, const size_t n,
+                              Distribution distribution)
     {
-        // Allocate device random number engines
-        auto error = hipMalloc(&m_engines, sizeof(engine_type) * m_engines_size);
-        if(error != hipSuccess)
+        philox4x32_10_device_engine smallest_state_engine;
+        size_t index_min = 0;
+        for(unsigned int i = 0; i < ThreadsPerEngine; i++)
         {
-            throw ROCRAND_STATUS_ALLOCATION_FAILED;
+            philox4x32_10_device_engine engine = engines[engine_id];
+            const size_t index = generate_thread<ThreadsPerEngine>(
+                engine, engine_id * ThreadsPerEngine + i, stride, data, n, distribution
+            );
+            if(i == 0 || index < index_min)
+            {
+                index_min = index;
+                smallest_state_engine = engine;
+            }
         }
+        engines[engine_id] = smallest_state_engine;
     }
 
-    ~rocrand_philox4x32_10()
+    // Returns values of the states of one thread of the engine: the thread
+    // uses every ThreadsPerEngine-th state (4 values) of the engine
+    // and counts used states.
+    template<unsigned int ThreadsPerEngine>
+    struct philox4x32_10_leap_source
+    {
+        philox4x32_10_device_engine& engine;
+        unsigned int values[4];
+        unsigned int position;
+        unsigned int states;
+
+        __forceinline__ __device__ __host__
+        unsigned int operator()()
+        {
+            if(position == 4)
+            {
+                const uint4 v = engine.next4_leap(ThreadsPerEngine);
+                values[0] = v.x;
+                values[1] = v.y;
+                values[2] = v.z;
+                values[3] = v.w;
+                position = 0;
+                states++;
+            }
+            return values[position++];
+        }
+    };
+
+    // Work of one thread of generate_rejection_kernel: generates values
+    // thread_id, thread_id + stride, ... with a rejection Distribution that
+    // consumes a variable number of values per output (Distribution gets
+    // the index of the value). Returns the number of states used by the thread.
+    template<unsigned int ThreadsPerEngine, class T, class Distribution>
+    __forceinline__ __device__ __host__
+    unsigned int generate_rejection_thread(philox4x32_10_device_engine& engine,
+                                           const unsigned int thread_id,
+                                           const unsigned int stride,
+                                           T * data, const size_t n,
+                                           Distribution distribution)
     {
-        hipFree(m_engines);
+        if(thread_id%ThreadsPerEngine > 0)
+        {
+            // Skips thread_id%ThreadsPerEngine states
+            engine.discard(4 * (thread_id%ThreadsPerEngine));
+        }
+
+        philox4x32_10_leap_source<ThreadsPerEngine> source = { engine, { 0, 0, 0, 0 }, 4, 0 };
+        for(size_t index = thread_id; index < n; index += stride)
+        {
+            data[index] = distribution(source, index);
+        }
+        return source.states;
     }
 
-    void reset()
+    // Threads of the engine use different numbers of states, the engine is
+    // advanced past the states of the thread that used the most of them
+    template<unsigned int ThreadsPerEngine, class T, class Distribution>
+    __global__
+    void generate_rejection_kernel(philox4x32_10_device_engine * engines,
+                                   T * data, const size_t n,
+                                   Distribution distribution)
     {
-        m_engines_initialized = false;
+        const unsigned int thread_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int engine_id = thread_id/ThreadsPerEngine;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        philox4x32_10_device_engine engine = engines[engine_id];
+        const unsigned int states = generate_rejection_thread<ThreadsPerEngine>(
+            engine, thread_id, stride, data, n, distribution
+        );
+        const unsigned int max_states = warp_reduce_max(states, ThreadsPerEngine);
+
+        if(thread_id%ThreadsPerEngine == 0)
+        {
+            engine = engines[engine_id];
+            engine.discard(4ULL * ThreadsPerEngine * max_states);
+            engines[engine_id] = engine;
+        }
     }
 
-    /// Changes seed to \p seed and resets generator state.
-    void set_seed(unsigned long long seed)
+    // Host-side equivalent of ThreadsPerEngine threads of
+    // generate_rejection_kernel that use engine_id-th engine.
+    template<unsigned int ThreadsPerEngine, class T, class Distribution>
+    inline
+    void generate_rejection_engine_host(philox4x32_10_device_engine * engines,
+                                        const unsigned int engine_id,
+                                        const unsigned int stride,
+                                        T * data, const size_t n,
+                                        Distribution distribution)
     {
-        m_seed = seed;
-        m_engines_initialized = false;
+        unsigned int max_states = 0;
+        for(unsigned int i = 0; i < ThreadsPerEngine; i++)
+        {
+            philox4x32_10_device_engine engine = engines[engine_id];
+            const unsigned int states = generate_rejection_thread<ThreadsPerEngine>(
+                engine, engine_id * ThreadsPerEngine + i, stride, data, n, distribution
+            );
+            max_states = states > max_states ? states : max_states;
+        }
+        engines[engine_id].discard(4ULL * ThreadsPerEngine * max_states);
     }
 
-    void set_offset(unsigned long long offset)
+    // Stateless generation: values are computed directly from the key
+    // (seed) and counters, so no engines are loaded or stored. The i-th state
+    // of the block b is the counter { i (64 bits), b (64 bits) }. Absolute
+    // positions are split into groups of the values of one block, the block of
+    // a group is the position of its first value, so the sequence depends
+    // neither on the launch configuration nor on how it is split into calls.
+    __forceinline__ __device__ __host__
+    uint4 stateless_values(const uint2 key,
+                           const unsigned long long block,
+                           const unsigned long long i)
     {
-        m_offset = offset;
-        m_engines_initialized = false;
+        const uint4 counter = {
+            static_cast<unsigned int>(i),
+            static_cast<unsigned int>(i >> 32),
+            static_cast<unsigned int>(block),
+            static_cast<unsigned int>(block >> 32)
+        };
+        return philox4x32_10_device_engine::counter_values(counter, key);
     }
 
-    rocrand_status init()
+    // Computes output_per_thread * output_width values of Distribution
+    // from States states of the block
+    template<unsigned int States, class T, class Distribution,
+             unsigned int OutputPerThread, unsigned int OutputWidth>
+    __forceinline__ __device__ __host__
+    void stateless_output(const uint2 key,
+                          const unsigned long long block,
+                          Distribution& distribution,
+                          T (&output)[OutputPerThread][OutputWidth])
     {
-        if(m_engines_initialized)
-            return ROCRAND_STATUS_SUCCESS;
+        constexpr unsigned int input_width = Distribution::input_width;
 
-        hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::init_engines_kernel),
-            dim3(s_blocks/s_threads_per_engine), dim3(s_threads), 0, m_stream,
-            m_engines, m_seed, m_offset
-        );
-        // Check kernel status
-        if(hipPeekAtLastError() != hipSuccess)
-            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        unsigned int vs[4 * States];
+        unsigned int input[input_width];
+        for(unsigned int s = 0; s < States; s++)
+        {
+            const uint4 v = stateless_values(key, block, s);
+            vs[4 * s + 0] = v.x;
+            vs[4 * s + 1] = v.y;
+            vs[4 * s + 2] = v.z;
+            vs[4 * s + 3] = v.w;
+        }
+        for(unsigned int s = 0; s < OutputPerThread; s++)
+        {
+            for(unsigned int i = 0; i < input_width; i++)
+            {
+                input[i] = vs[s * input_width + i];
+            }
+            distribution(input, output[s]);
+        }
+    }
 
-        m_engines_initialized = true;
-        return ROCRAND_STATUS_SUCCESS;
+    // Stores count values of absolute positions first, first + 1, ... to data:
+    // the value of the position q is the output q % full_output_width of
+    // the block q - q % full_output_width
+    template<unsigned int States, class T, class Distribution,
+             unsigned int OutputPerThread, unsigned int OutputWidth>
+    __forceinline__ __device__ __host__
+    void stateless_store(const uint2 key,
+                         const unsigned long long first,
+                         const unsigned int count,
+                         Distribution& distribution,
+                         T (&output)[OutputPerThread][OutputWidth],
+                         T * data)
+    {
+        constexpr unsigned int full_output_width = OutputPerThread * OutputWidth;
+
+        unsigned long long block = first - first % full_output_width;
+        stateless_output<States>(key, block, distribution, output);
+        for(unsigned int o = 0; o < count; o++)
+        {
+            const unsigned long long q = first + o;
+            const unsigned int slot = static_cast<unsigned int>(q % full_output_width);
+            if(q - slot != block)
+            {
+                block = q - slot;
+                stateless_output<States>(key, block, distribution, output);
+            }
+            data[o] = output[slot / OutputWidth][slot % OutputWidth];
+        }
     }
 
-    template<class T, class Distribution = uniform_distribution<T> >
-    rocrand_status generate(T * data, size_t data_size,
-                            Distribution distribution = Distribution())
+    // Work of one thread of generate_stateless_kernel, the layout of data
+    // (head, vectors and tail) is the same as in generate_thread. If position
+    // and data are aligned differently, vectors are assembled from 2 blocks.
+    template<class T, class Distribution>
+    __forceinline__ __device__ __host__
+    void generate_stateless_thread(const uint2 key,
+                                   const unsigned long long position,
+                                   const unsigned int thread_id,
+                                   const unsigned int stride,
+                                   T * data, const size_t n,
+                                   Distribution distribution,
+                                   const bool streaming = false)
     {
-        rocrand_status status = init();
-        if (status != ROCRAND_STATUS_SUCCESS)
-            return status;
+        constexpr unsigned int input_width = Distribution::input_width;
+        constexpr unsigned int output_width = Distribution::output_width;
 
-        hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel<s_threads_per_engine>),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, distribution
+        static_assert(
+            (4 % input_width == 0 && input_width <= 4) || input_width % 4 == 0,
+            "Incorrect input_width"
         );
-        // Check kernel status
-        if(hipPeekAtLastError() != hipSuccess)
-            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        constexpr unsigned int states = input_width > 4 ? input_width / 4 : 1;
+        constexpr unsigned int output_per_thread = input_width > 4 ? 1 : 4 / input_width;
+        constexpr unsigned int full_output_width = output_per_thread * output_width;
 
-        return ROCRAND_STATUS_SUCCESS;
+        using vec_type = aligned_vec_type<T, output_per_thread * output_width>;
+
+        T output[output_per_thread][output_width];
+
+        const uintptr_t uintptr = reinterpret_cast<uintptr_t>(data);
+        const size_t misalignment =
+            (
+                full_output_width - uintptr / sizeof(T) % full_output_width
+            ) % full_output_width;
+        const unsigned int head_size = n < misalignment ? n : misalignment;
+        const unsigned int tail_size = (n - head_size) % full_output_width;
+        const size_t vec_n = (n - head_size) / full_output_width;
+
+        vec_type * vec_data = reinterpret_cast<vec_type *>(data + misalignment);
+        const bool aligned_blocks = (position + head_size) % full_output_width == 0;
+        for(size_t index = thread_id; index < vec_n; index += stride)
+        {
+            const unsigned long long first = position + head_size + index * full_output_width;
+            if(aligned_blocks)
+            {
+                stateless_output<states>(key, first, distribution, output);
+                store_vec(vec_data + index, *reinterpret_cast<vec_type *>(output), streaming);
+            }
+            else
+            {
+                T values[full_output_width];
+                stateless_store<states>(
+                    key, first, full_output_width, distribution, output, values
+                );
+                store_vec(vec_data + index, *reinterpret_cast<vec_type *>(values), streaming);
+            }
+        }
+
+        // Head and tail are saved by the first thread
+        if(thread_id == 0)
+        {
+            if(head_size > 0)
+            {
+                stateless_store<states>(key, position, head_size, distribution, output, data);
+            }
+
+            if(tail_size > 0)
+            {
+                stateless_store<states>(
+                    key, position + n - tail_size, tail_size, distribution, output,
+                    data + n - tail_size
+                );
+            }
+        }
     }
 
-    template<class T>
-    rocrand_status generate_uniform(T * data, size_t data_size)
+    template<class T, class Distribution>
+    __global__
+    void generate_stateless_kernel(const uint2 key,
+                                   const unsigned long long position,
+                                   T * data, const size_t n,
+                                   Distribution distribution,
+                                   const bool streaming)
     {
-        uniform_distribution<T> distribution;
-        return generate(data, data_size, distribution);
+        const unsigned int thread_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        generate_stateless_thread(
+            key, position, thread_id, stride, data, n, distribution, streaming
+        );
     }
 
-    template<class T>
-    rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
+    // generate_stateless_kernel for pitched buffers: the row r gets the values
+    // of a generate_stateless_kernel call at position + r * width
+    template<class T, class Distribution>
+    __global__
+    void generate_stateless_2d_kernel(const uint2 key,
+                                      const unsigned long long position,
+                                      T * data, const size_t pitch,
+                                      const size_t width, const size_t height,
+                                      Distribution distribution,
+                                      const bool streaming)
     {
-        normal_distribution<T> distribution(mean, stddev);
-        return generate(data, data_size, distribution);
+        const unsigned int thread_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        for(size_t row = 0; row < height; row++)
+        {
+            generate_stateless_thread(
+                key, position + row * width, thread_id, stride,
+                data + row * pitch, width, distribution, streaming
+            );
+        }
     }
 
-    template<class T>
-    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
+    // generate_stateless_kernel for discrete distributions with small packed
+    // alias tables (see generate_discrete_shared_kernel)
+    template<class Distribution>
+    __global__
+    void generate_discrete_shared_stateless_kernel(const uint2 key,
+                                                   const unsigned long long position,
+                                                   unsigned int * data, const size_t n,
+                                                   Distribution distribution)
     {
-        log_normal_distribution<T> distribution(mean, stddev);
-        return generate(data, data_size, distribution);
+        __shared__ unsigned long long table[discrete_shared_capacity];
+        distribution.load_shared(table);
+
+        const unsigned int thread_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        generate_stateless_thread(key, position, thread_id, stride, data, n, distribution);
     }
 
-    rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
+    // Returns values of the block of one output of a rejection distribution,
+    // the output may use any number of states of its block
+    struct philox4x32_10_stateless_source
     {
-        try
+        uint2 key;
+        unsigned long long block;
+        unsigned long long state;
+        unsigned int values[4];
+        unsigned int position;
+
+        __forceinline__ __device__ __host__
+        unsigned int operator()()
         {
-            m_poisson.set_lambda(lambda);
+            if(position == 4)
+            {
+                const uint4 v = stateless_values(key, block, state++);
+                values[0] = v.x;
+                values[1] = v.y;
+                values[2] = v.z;
+                values[3] = v.w;
+                position = 0;
+            }
+            return values[position++];
         }
-        catch(rocrand_status status)
+    };
+
+    // Work of one thread of generate_rejection_stateless_kernel: the index-th
+    // output uses the block position + index
+    template<class T, class Distribution>
+    __forceinline__ __device__ __host__
+    void generate_rejection_stateless_thread(const uint2 key,
+                                             const unsigned long long position,
+                                             const unsigned int thread_id,
+                                             const unsigned int stride,
+                                             T * data, const size_t n,
+                                             Distribution distribution)
+    {
+        for(size_t index = thread_id; index < n; index += stride)
         {
-            return status;
+            philox4x32_10_stateless_source source = { key, position + index, 0, { 0, 0, 0, 0 }, 4 };
+            data[index] = distribution(source, index);
         }
-        return generate(data, data_size, m_poisson.dis);
     }
 
-private:
-    bool m_engines_initialized;
-    engine_type * m_engines;
-    const size_t m_engines_size;
+    template<class T, class Distribution>
+    __global__
+    void generate_rejection_stateless_kernel(const uint2 key,
+                                             const unsigned long long position,
+                                             T * data, const size_t n,
+                                             Distribution distribution)
+    {
+        const unsigned int thread_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
 
-    const static uint32_t s_threads = 256;
-    const static uint32_t s_blocks = 1024;
+        generate_rejection_stateless_thread(key, position, thread_id, stride, data, n, distribution);
+    }
 
-    // For caching of Poisson for consecutive generations with the same lambda
-    poisson_distribution_manager<> m_poisson;
+    // Random-access generation (rocrand_generate_at()): the index-th value is
+    // computed from the first state of the subsequence keys[index] (the block
+    // keys[index] of stateless generation), so it does not depend on other
+    // keys, their order or the generator's offset
+    template<class T, class Distribution>
+    __forceinline__ __device__ __host__
+    void generate_at_value(const uint2 key,
+                           const unsigned long long * keys,
+                           const size_t index,
+                           T * data,
+                           Distribution distribution)
+    {
+        constexpr unsigned int input_width = Distribution::input_width;
+        constexpr unsigned int output_width = Distribution::output_width;
+        static_assert(input_width <= 4, "Incorrect input_width");
+
+        const uint4 v = stateless_values(key, keys[index], 0);
+        const unsigned int vs[4] = { v.x, v.y, v.z, v.w };
+        unsigned int input[input_width];
+        T output[output_width];
+        for(unsigned int i = 0; i < input_width; i++)
+        {
+            input[i] = vs[i];
+        }
+        distribution(input, output);
+        data[index] = output[0];
+    }
+
+    template<class T, class Distribution>
+    __global__
+    void generate_at_kernel(const uint2 key,
+                            const unsigned long long * keys,
+                            T * data, const size_t n,
+                            Distribution distribution)
+    {
+        const unsigned int thread_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        for(size_t index = thread_id; index < n; index += stride)
+        {
+            generate_at_value(key, keys, index, data, distribution);
+        }
+    }
+
+    // Matrix tiles (rocrand_generate_matrix_*()): the index-th group of a tile
+    // is the Philox output of 4 columns of a row of the matrix (see
+    // rocrand_matrix4()), entries of the group inside the tile are stored
+    // as mean + stddev * x
+    template<class Distribution>
+    __forceinline__ __device__ __host__
+    void generate_matrix_group(const uint2 key,
+                               const unsigned long long matrix_id,
+                               float * data, const size_t pitch,
+                               const unsigned long long row,
+                               const unsigned long long col,
+                               const size_t width,
+                               const size_t groups_per_row,
+                               const size_t index,
+                               Distribution distribution,
+                               const float mean, const float stddev)
+    {
+        const size_t r = index / groups_per_row;
+        const unsigned long long col4 = col / 4 + index % groups_per_row;
+        const float4 v = distribution(
+            ::rocrand_device::detail::matrix_values(
+                key, matrix_id,
+                static_cast<unsigned int>(row + r), static_cast<unsigned int>(col4)
+            )
+        );
+        const float vs[4] = { v.x, v.y, v.z, v.w };
+        for(unsigned int i = 0; i < 4; i++)
+        {
+            const unsigned long long c = col4 * 4 + i;
+            if(c >= col && c < col + width)
+            {
+                data[r * pitch + (c - col)] = mean + stddev * vs[i];
+            }
+        }
+    }
+
+    template<class Distribution>
+    __global__
+    void generate_matrix_kernel(const uint2 key,
+                                const unsigned long long matrix_id,
+                                float * data, const size_t pitch,
+                                const unsigned long long row,
+                                const unsigned long long col,
+                                const size_t width, const size_t height,
+                                Distribution distribution,
+                                const float mean, const float stddev)
+    {
+        const unsigned int thread_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        const size_t groups_per_row = (col + width - 1) / 4 - col / 4 + 1;
+        const size_t groups = groups_per_row * height;
+        for(size_t index = thread_id; index < groups; index += stride)
+        {
+            generate_matrix_group(
+                key, matrix_id, data, pitch, row, col, width, groups_per_row, index,
+                distribution, mean, stddev
+            );
+        }
+    }
+
+    // Source of multivariate_normal_kernel (rocrand_generate_multivariate_normal())
+    // computing standard normal values of the stateless sequence directly in
+    // shared memory: the value i is the value generate_stateless_kernel stores
+    // to index i
+    struct stateless_normal_source
+    {
+        uint2 key;
+        unsigned long long position;
+        normal_distribution<float> distribution;
+
+        __forceinline__ __device__ __host__
+        void load(float * z, const size_t first, const unsigned int count,
+                  const unsigned int thread, const unsigned int threads) const
+        {
+            // Groups of 4 absolute positions share the state of their first value
+            const unsigned long long begin = position + first;
+            const unsigned long long end = begin + count;
+            const unsigned long long first_group = begin / 4;
+            const unsigned long long end_group = (end + 3) / 4;
+            for(unsigned long long group = first_group + thread; group < end_group; group += threads)
+            {
+                float output[2][2];
+                stateless_output<1>(key, group * 4, distribution, output);
+                for(unsigned int o = 0; o < 4; o++)
+                {
+                    const unsigned long long q = group * 4 + o;
+                    if(q >= begin && q < end)
+                        z[q - begin] = output[o / 2][o % 2];
+                }
+            }
+        }
+    };
+
+    // Keyed bijection of [0, n) (rocrand_generate_permutation()): a balanced
+    // Feistel network over 2 * half_bits bits with Philox4x32-10 as the round
+    // function. Indices outside [0, n) are mapped again (cycle walking), at most
+    // 4 times on average, so every index is mapped independently of others.
+    struct feistel_permutation
+    {
+        static constexpr unsigned int rounds = 4;
+        // Key words generated by the generator for every permutation
+        static constexpr unsigned int key_size = 2 * rounds;
+
+        unsigned long long n;
+        unsigned int half_bits;
+
+        __host__
+        explicit feistel_permutation(const unsigned long long n)
+            : n(n), half_bits(1)
+        {
+            while(2 * half_bits < 64 && (1ULL << (2 * half_bits)) < n)
+            {
+                half_bits++;
+            }
+        }
+
+        __forceinline__ __device__ __host__
+        unsigned long long operator()(unsigned long long index,
+                                      const unsigned int (&keys)[key_size]) const
+        {
+            const unsigned long long mask = (1ULL << half_bits) - 1;
+            do
+            {
+                unsigned long long l = index >> half_bits;
+                unsigned long long r = index & mask;
+                for(unsigned int round = 0; round < rounds; round++)
+                {
+                    const uint4 counter = {
+                        static_cast<unsigned int>(r),
+                        static_cast<unsigned int>(r >> 32),
+                        round, 0
+                    };
+                    const uint2 key = { keys[2 * round], keys[2 * round + 1] };
+                    const uint4 v = philox4x32_10_device_engine::counter_values(counter, key);
+                    const unsigned long long f = ((static_cast<unsigned long long>(v.y) << 32) | v.x) & mask;
+                    const unsigned long long t = l ^ f;
+                    l = r;
+                    r = t;
+                }
+                index = (l << half_bits) | r;
+            } while(index >= n);
+            return index;
+        }
+    };
+
+    __global__
+    void generate_permutation_kernel(unsigned int * data,
+                                     const feistel_permutation permutation,
+                                     const unsigned int * permutation_keys)
+    {
+        const unsigned int thread_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        unsigned int keys[feistel_permutation::key_size];
+        for(unsigned int i = 0; i < feistel_permutation::key_size; i++)
+        {
+            keys[i] = permutation_keys[i];
+        }
+        for(size_t index = thread_id; index < permutation.n; index += stride)
+        {
+            data[index] = static_cast<unsigned int>(permutation(index, keys));
+        }
+    }
+
+    // Gathers elements of words words of type T: output[i] = input[permutation(i)]
+    template<class T>
+    __forceinline__ __device__ __host__
+    void shuffle_element(const T * input, T * output, const size_t words,
+                         const size_t index, const feistel_permutation& permutation,
+                         const unsigned int (&keys)[feistel_permutation::key_size])
+    {
+        const size_t source = permutation(index, keys);
+        for(size_t w = 0; w < words; w++)
+        {
+            output[index * words + w] = input[source * words + w];
+        }
+    }
+
+    template<class T>
+    __global__
+    void shuffle_kernel(const T * input, T * output, const size_t words,
+                        const feistel_permutation permutation,
+                        const unsigned int * permutation_keys)
+    {
+        const unsigned int thread_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        unsigned int keys[feistel_permutation::key_size];
+        for(unsigned int i = 0; i < feistel_permutation::key_size; i++)
+        {
+            keys[i] = permutation_keys[i];
+        }
+        for(size_t index = thread_id; index < permutation.n; index += stride)
+        {
+            shuffle_element(input, output, words, index, permutation, keys);
+        }
+    }
+
+    // Value of the dimension dim of the point of rocrand_generate_latin_hypercube()
+    // (Latin is true) or rocrand_generate_stratified_uniform(): the stratum is
+    // the index of the point permuted by the keys of the dimension (one point in
+    // every one of strata = n_points strata) or the digit dim of the index of
+    // the point in base strata (cells of a grid). The position in the stratum
+    // is computed from the point and the first key of the dimension, Feistel
+    // rounds have 0 in the last word of their counters.
+    template<bool Latin>
+    __forceinline__ __device__ __host__
+    float stratified_value(const size_t point, const unsigned int dim,
+                           const feistel_permutation& permutation,
+                           const unsigned long long strata,
+                           const unsigned int * keys)
+    {
+        const unsigned int * dim_keys = keys + dim * feistel_permutation::key_size;
+        unsigned long long stratum;
+        if(Latin)
+        {
+            unsigned int k[feistel_permutation::key_size];
+            for(unsigned int i = 0; i < feistel_permutation::key_size; i++)
+            {
+                k[i] = dim_keys[i];
+            }
+            stratum = permutation(point, k);
+        }
+        else
+        {
+            unsigned long long cell = point;
+            for(unsigned int d = 0; d < dim; d++)
+            {
+                cell /= strata;
+            }
+            stratum = cell % strata;
+        }
+        const uint4 counter = {
+            static_cast<unsigned int>(point),
+            static_cast<unsigned int>(static_cast<unsigned long long>(point) >> 32),
+            0, 1
+        };
+        const uint2 key = { dim_keys[0], dim_keys[1] };
+        const uint4 v = philox4x32_10_device_engine::counter_values(counter, key);
+        const double u = rocrand_device::detail::uniform_distribution_double(v.x, v.y);
+        return static_cast<float>((stratum + u) / strata);
+    }
+
+    // Values are stored dimension-major or point-major (interleaved),
+    // every value is computed independently of others
+    template<bool Latin>
+    __global__
+    void generate_stratified_kernel(float * data,
+                                    const size_t n_points,
+                                    const unsigned int dims,
+                                    const feistel_permutation permutation,
+                                    const unsigned long long strata,
+                                    const unsigned int * keys,
+                                    const bool interleaved)
+    {
+        const unsigned int thread_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        const size_t size = n_points * dims;
+        for(size_t index = thread_id; index < size; index += stride)
+        {
+            const size_t point = interleaved ? index / dims : index % n_points;
+            const unsigned int dim = static_cast<unsigned int>(
+                interleaved ? index % dims : index / n_points
+            );
+            data[index] = stratified_value<Latin>(point, dim, permutation, strata, keys);
+        }
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+class rocrand_philox4x32_10 : public rocrand_generator_type<ROCRAND_RNG_PSEUDO_PHILOX4_32_10>
+{
+    static constexpr unsigned int s_threads_per_engine = 16;
+
+public:
+    using base_type = rocrand_generator_type<ROCRAND_RNG_PSEUDO_PHILOX4_32_10>;
+    using engine_type = ::rocrand_host::detail::philox4x32_10_device_engine;
+
+    rocrand_philox4x32_10(unsigned long long seed = 0,
+                          unsigned long long offset = 0,
+                          hipStream_t stream = 0,
+                          bool host_side = false)
+        : base_type(seed, offset, stream, host_side),
+          m_engines_initialized(false), m_engines(NULL),
+          m_blocks(s_default_blocks), m_threads(s_default_threads),
+          m_engines_size(s_default_blocks * s_default_threads / s_threads_per_engine),
+          m_stateless(false), m_position(offset), m_children(0),
+          m_normal_method(ROCRAND_NORMAL_METHOD_BOX_MULLER)
+    {
+        // Engines are allocated by init(), they are not needed in stateless mode
+        m_poisson.set_stats(&m_stats);
+        m_poisson_host.set_stats(&m_stats);
+    }
+
+    ~rocrand_philox4x32_10()
+    {
+        free_engines(m_engines);
+    }
+
+    void reset()
+    {
+        m_engines_initialized = false;
+        m_position = m_offset;
+    }
+
+    /// Changes seed to \p seed and resets generator state.
+    void set_seed(unsigned long long seed)
+    {
+        m_seed = seed;
+        m_children = 0;
+        this->reset();
+    }
+
+    void set_offset(unsigned long long offset)
+    {
+        m_offset = offset;
+        this->reset();
+    }
+
+    /// Enables or disables stateless mode and resets generator state.
+    /// In stateless mode values are computed directly from the seed and
+    /// counters derived from the offset and the index of the value
+    /// (see generate_stateless_kernel), engines are not allocated.
+    rocrand_status set_stateless(bool stateless)
+    {
+        if(stateless && m_engines != NULL)
+        {
+            free_engines(m_engines);
+            m_engines = NULL;
+        }
+        m_stateless = stateless;
+        this->reset();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    bool is_stateless() const
+    {
+        return m_stateless;
+    }
+
+    /// Sets the method used by generate_normal()
+    rocrand_status set_normal_method(rocrand_normal_method method)
+    {
+        if(method != ROCRAND_NORMAL_METHOD_BOX_MULLER
+            && method != ROCRAND_NORMAL_METHOD_ZIGGURAT)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+
+        m_normal_method = method;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Changes launch configuration to \p blocks blocks of \p threads threads
+    /// (\p s_threads_per_engine threads per engine) and resets generator state.
+    /// When both are 0, the number of blocks is computed from occupancy of
+    /// the current device.
+    rocrand_status set_launch_config(unsigned int blocks, unsigned int threads)
+    {
+        if(blocks == 0 && threads == 0)
+        {
+            threads = s_default_threads;
+            blocks = s_default_blocks;
+            if(!m_host_side)
+            {
+                void (*kernel)(engine_type *, unsigned int *, const size_t,
+                               uniform_distribution<unsigned int>, const bool) =
+                    rocrand_host::detail::generate_kernel<
+                        s_threads_per_engine, unsigned int, uniform_distribution<unsigned int>
+                    >;
+                rocrand_status status = rocrand_host::detail::get_occupancy_blocks(
+                    kernel, threads, blocks
+                );
+                if(status != ROCRAND_STATUS_SUCCESS)
+                    return status;
+            }
+        }
+        // Threads of one engine must belong to the same warp
+        if(blocks == 0 || threads == 0 || threads > s_max_threads
+            || threads % s_threads_per_engine != 0)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        if(blocks == m_blocks && threads == m_threads)
+            return ROCRAND_STATUS_SUCCESS;
+
+        // Engines of the new configuration are allocated by init()
+        if(m_engines != NULL)
+        {
+            free_engines(m_engines);
+            m_engines = NULL;
+        }
+
+        m_engines_size = static_cast<size_t>(blocks) * threads / s_threads_per_engine;
+        m_blocks = blocks;
+        m_threads = threads;
+        this->reset();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    void get_launch_config(unsigned int * blocks, unsigned int * threads) const
+    {
+        *blocks = m_blocks;
+        *threads = m_threads;
+    }
+
+    rocrand_status init()
+    {
+        if(m_stateless || (m_engines_initialized && m_engines != NULL))
+            return ROCRAND_STATUS_SUCCESS;
+
+        // Initialization allocates memory and waits for the device,
+        // so it must be done before capture (see rocrand_initialize_generator())
+        if(!m_host_side && rocrand_host::detail::is_stream_capturing(m_stream))
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+
+        // Engines of a trimmed generator are copied back (see trim())
+        rocrand_status status = restore_engines(m_engines, m_engines_size, m_engines_initialized);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        if(m_engines_initialized)
+            return ROCRAND_STATUS_SUCCESS;
+
+        rocrand_host::detail::profiling_range range("rocrand init_engines_kernel");
+        count_init();
+        if(m_host_side)
+        {
+            engine_type * engines = m_engines;
+            const unsigned long long seed = m_seed;
+            const unsigned long long offset = m_offset;
+            rocrand_host::detail::host_parallel_for(
+                m_engines_size,
+                [engines, seed, offset](size_t engine_id)
+                {
+                    engines[engine_id] = engine_type(seed, engine_id, offset);
+                }
+            );
+            m_engines_initialized = true;
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        count_launch();
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::init_engines_kernel),
+            dim3((m_engines_size + s_default_threads - 1) / s_default_threads),
+            dim3(s_default_threads), 0, m_stream,
+            m_engines, m_engines_size, m_seed, m_offset
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Returns size in bytes of the state returned by get_state(),
+    /// the state of a stateless generator is its counter position
+    size_t get_state_size() const
+    {
+        if(m_stateless)
+            return sizeof(m_position);
+        return sizeof(engine_type) * m_engines_size;
+    }
+
+    /// Initializes engines if needed and copies them to host memory \p state
+    rocrand_status get_state(void * state)
+    {
+        if(m_stateless)
+        {
+            std::memcpy(state, &m_position, sizeof(m_position));
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        return rocrand_host::detail::copy_engines_to_host(
+            state, m_engines, m_engines_size, m_host_side, m_stream
+        );
+    }
+
+    /// Replaces engines with \p state (in host memory) returned by get_state()
+    /// of a generator with the same launch configuration
+    rocrand_status set_state(const void * state)
+    {
+        if(m_stateless)
+        {
+            std::memcpy(&m_position, state, sizeof(m_position));
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        // The state replaces engines of a trimmed generator
+        rocrand_status status = restore_engines(m_engines, m_engines_size, false);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        status = rocrand_host::detail::copy_engines_from_host(
+            m_engines, m_engines_size, state, m_host_side, m_stream
+        );
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Returns size of device memory of engines and Poisson tables
+    /// (rocrand_get_memory_usage())
+    size_t get_memory_usage() const
+    {
+        return engines_device_bytes(m_engines, m_engines_size) + m_poisson.device_bytes();
+    }
+
+    /// Copies engines to host memory and frees device memory of engines
+    /// and Poisson tables (rocrand_generator_trim()).
+    /// The next init() (every generate call) restores engines, a stateless
+    /// generator keeps only its counter position and has no engines.
+    rocrand_status trim()
+    {
+        rocrand_status status = trim_engines(m_engines, m_engines_size, m_engines_initialized);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        m_poisson.clear();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Returns size in bytes of the data written by save()
+    size_t get_save_size() const
+    {
+        return sizeof(save_data) + get_state_size();
+    }
+
+    /// Writes seed, offset, launch configuration and engines to host memory \p data
+    rocrand_status save(void * data)
+    {
+        const save_data header = {
+            m_seed, m_offset, m_blocks, m_threads, m_stateless ? 1U : 0U, 0U
+        };
+        std::memcpy(data, &header, sizeof(save_data));
+        return get_state(static_cast<char *>(data) + sizeof(save_data));
+    }
+
+    /// Restores the generator from \p data of \p size bytes written by save()
+    rocrand_status load(const void * data, size_t size)
+    {
+        if(size < sizeof(save_data))
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        save_data header;
+        std::memcpy(&header, data, sizeof(save_data));
+        const size_t engines_size = static_cast<size_t>(header.blocks) * header.threads / s_threads_per_engine;
+        const size_t state_size = header.stateless != 0
+            ? sizeof(m_position)
+            : sizeof(engine_type) * engines_size;
+        if(size != sizeof(save_data) + state_size)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        rocrand_status status = set_launch_config(header.blocks, header.threads);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        set_seed(header.seed);
+        set_offset(header.offset);
+        set_stateless(header.stateless != 0);
+        return set_state(static_cast<const char *>(data) + sizeof(save_data));
+    }
+
+    /// Creates \p count generators with the launch configuration and settings
+    /// of this generator to \p children (rocrand_generator_split()). Keys of
+    /// children are derived from the seed and the number of children created
+    /// before, so the key space is partitioned without any device work
+    /// (engines of children are initialized when they generate).
+    rocrand_status split(unsigned int count, rocrand_generator * children)
+    {
+        std::vector<rocrand_philox4x32_10 *> generators;
+        rocrand_status status = rocrand_host::detail::create_generators(
+            count, generators, 0ULL, 0ULL, m_stream, m_host_side
+        );
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        for(unsigned int i = 0; i < count; i++)
+        {
+            rocrand_philox4x32_10 * child = generators[i];
+            // Launch configurations are validated by this generator and
+            // set_launch_config() does not allocate
+            child->set_launch_config(m_blocks, m_threads);
+            child->set_stateless(m_stateless);
+            child->set_seed(rocrand_host::detail::seeded_engine_seed(m_seed, m_children + i));
+            child->copy_policies(*this);
+            child->m_normal_method = m_normal_method;
+        }
+        m_children += count;
+        std::copy(generators.begin(), generators.end(), children);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T, class Distribution = uniform_distribution<T> >
+    rocrand_status generate(T * data, size_t data_size,
+                        Distribution distribution = Distribution())
+    {
+        if(m_stateless)
+            return generate_stateless(data, data_size, distribution);
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        rocrand_host::detail::profiling_range range("rocrand generate_kernel");
+        count_generate(data_size);
+
+        if(m_host_side)
+        {
+            engine_type * engines = m_engines;
+            const unsigned int stride = m_blocks * m_threads;
+            rocrand_host::detail::host_parallel_for(
+                m_engines_size,
+                [=](size_t engine_id)
+                {
+                    rocrand_host::detail::generate_engine_host<s_threads_per_engine>(
+                        engines, engine_id, stride, data, data_size, distribution
+                    );
+                }
+            );
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel<s_threads_per_engine>),
+            dim3(m_blocks), dim3(m_threads), 0, m_stream,
+            m_engines, data, data_size, distribution, streaming_stores()
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_uniform(T * data, size_t data_size)
+    {
+        uniform_distribution<T> distribution;
+        return generate(data, data_size, distribution);
+    }
+
+    /// Generates \p data_size integers in [\p lo, \p lo + \p range)
+    template<class T>
+    rocrand_status generate_uniform_range(T * data, size_t data_size, T lo, T range)
+    {
+        uniform_range_distribution<T> distribution(lo, range);
+        return generate_rejection(data, data_size, distribution);
+    }
+
+    /// Generates \p data_size values with a rejection \p distribution
+    /// (see generate_rejection_kernel)
+    template<class T, class Distribution>
+    rocrand_status generate_rejection(T * data, size_t data_size,
+                                      Distribution distribution)
+    {
+        if(m_stateless)
+            return generate_rejection_stateless(data, data_size, distribution);
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        rocrand_host::detail::profiling_range range("rocrand generate_kernel");
+        count_generate(data_size);
+
+        if(m_host_side)
+        {
+            engine_type * engines = m_engines;
+            const unsigned int stride = m_blocks * m_threads;
+            rocrand_host::detail::host_parallel_for(
+                m_engines_size,
+                [=](size_t engine_id)
+                {
+                    rocrand_host::detail::generate_rejection_engine_host<s_threads_per_engine>(
+                        engines, engine_id, stride, data, data_size, distribution
+                    );
+                }
+            );
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_rejection_kernel<s_threads_per_engine>),
+            dim3(m_blocks), dim3(m_threads), 0, m_stream,
+            m_engines, data, data_size, distribution
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        if(m_normal_method == ROCRAND_NORMAL_METHOD_ZIGGURAT)
+        {
+            ziggurat_normal_distribution<T> distribution(mean, stddev);
+            return generate_rejection(data, data_size, distribution);
+        }
+        normal_distribution<T> distribution(mean, stddev, fast_math());
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        log_normal_distribution<T> distribution(mean, stddev, fast_math());
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T * data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    /// Generates Bernoulli decisions packed as bits (T is unsigned int)
+    /// or bytes (T is unsigned char)
+    template<class T>
+    rocrand_status generate_bernoulli(T * data, size_t data_size, double p)
+    {
+        bernoulli_distribution<T> distribution(p);
+        return generate(data, data_size, distribution);
+    }
+
+    /// Generates gamma variates (Marsaglia-Tsang rejection in every thread)
+    template<class T>
+    rocrand_status generate_gamma(T * data, size_t data_size, T shape, T scale)
+    {
+        gamma_distribution<T> distribution(shape, scale);
+        return generate_rejection(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_beta(T * data, size_t data_size, T alpha, T beta)
+    {
+        beta_distribution<T> distribution(alpha, beta);
+        return generate_rejection(data, data_size, distribution);
+    }
+
+    /// Generates normal values truncated to [\p lo, \p hi] (rejection in every thread)
+    template<class T>
+    rocrand_status generate_truncated_normal(T * data, size_t data_size,
+                                             T mean, T stddev, T lo, T hi)
+    {
+        truncated_normal_distribution<T> distribution(mean, stddev, lo, hi);
+        return generate_rejection(data, data_size, distribution);
+    }
+
+    /// Generates \p height rows of \p width values, rows start \p pitch values
+    /// apart. Rows get the same values as \p height consecutive generate() calls
+    /// of \p width values. Stateless generators generate all rows by one launch,
+    /// engines of other generators are synchronized by every generate_kernel,
+    /// so their rows are generated one by one.
+    template<class T, class Distribution = uniform_distribution<T> >
+    rocrand_status generate_2d(T * data, size_t pitch, size_t width, size_t height,
+                               Distribution distribution = Distribution())
+    {
+        if(!m_stateless)
+        {
+            for(size_t row = 0; row < height; row++)
+            {
+                const rocrand_status status = generate(data + row * pitch, width, distribution);
+                if(status != ROCRAND_STATUS_SUCCESS)
+                    return status;
+            }
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        rocrand_host::detail::profiling_range range("rocrand generate_2d_kernel");
+        count_generate(width * height);
+        const uint2 key = stateless_key();
+        const unsigned long long position = m_position;
+        if(m_host_side)
+        {
+            const unsigned int stride = m_blocks * m_threads;
+            rocrand_host::detail::host_parallel_for(
+                stride,
+                [=](size_t thread_id)
+                {
+                    for(size_t row = 0; row < height; row++)
+                    {
+                        rocrand_host::detail::generate_stateless_thread(
+                            key, position + row * width, thread_id, stride,
+                            data + row * pitch, width, distribution
+                        );
+                    }
+                }
+            );
+        }
+        else
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_stateless_2d_kernel),
+                dim3(m_blocks), dim3(m_threads), 0, m_stream,
+                key, position, data, pitch, width, height, distribution, streaming_stores()
+            );
+            // Check kernel status
+            if(hipPeekAtLastError() != hipSuccess)
+                return ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+
+        m_position += width * height;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_2d(T * data, size_t pitch, size_t width, size_t height)
+    {
+        uniform_distribution<T> distribution;
+        return generate_2d(data, pitch, width, height, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_normal_2d(T * data, size_t pitch, size_t width, size_t height,
+                                      T mean, T stddev)
+    {
+        if(m_normal_method == ROCRAND_NORMAL_METHOD_ZIGGURAT)
+        {
+            // Rejection kernels are not row-aware, rows are generated one by one
+            ziggurat_normal_distribution<T> distribution(mean, stddev);
+            for(size_t row = 0; row < height; row++)
+            {
+                const rocrand_status status =
+                    generate_rejection(data + row * pitch, width, distribution);
+                if(status != ROCRAND_STATUS_SUCCESS)
+                    return status;
+            }
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        normal_distribution<T> distribution(mean, stddev, fast_math());
+        return generate_2d(data, pitch, width, height, distribution);
+    }
+
+    /// Sets the maximum number of lambdas whose Poisson tables are cached
+    rocrand_status set_poisson_cache_capacity(size_t capacity)
+    {
+        if(capacity == 0)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        m_poisson.set_capacity(capacity);
+        m_poisson_host.set_capacity(capacity);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Computes and caches Poisson tables for \p count lambdas
+    rocrand_status prepare_poisson(const double * lambdas, size_t count)
+    {
+        for(size_t i = 0; i < count; i++)
+        {
+            if(lambdas[i] >= poisson_rejection_distribution::lambda_threshold)
+            {
+                // Generated without tables
+                continue;
+            }
+            try
+            {
+                if(m_host_side)
+                {
+                    m_poisson_host.set_lambda(lambdas[i]);
+                }
+                else
+                {
+                    m_poisson.set_lambda(lambdas[i], m_stream);
+                }
+            }
+            catch(rocrand_status status)
+            {
+                return status;
+            }
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
+    {
+        if(lambda >= poisson_rejection_distribution::lambda_threshold)
+        {
+            poisson_rejection_distribution distribution(lambda);
+            return generate_rejection(data, data_size, distribution);
+        }
+
+        try
+        {
+            if(m_host_side)
+            {
+                m_poisson_host.set_lambda(lambda);
+            }
+            else
+            {
+                m_poisson.set_lambda(lambda, m_stream);
+            }
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        if(m_host_side)
+        {
+            return generate(data, data_size, m_poisson_host.dis);
+        }
+        return generate(data, data_size, m_poisson.dis);
+    }
+
+    /// Generates \p data_size values of the discrete distribution with tables
+    /// \p tables in device memory (copied to the host for host-side generators)
+    rocrand_status generate_discrete(unsigned int * data, size_t data_size,
+                                     const rocrand_discrete_distribution_st& tables)
+    {
+        if(m_host_side)
+        {
+            rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_ALIAS, true> distribution;
+            try
+            {
+                distribution.init_from_device(tables);
+            }
+            catch(rocrand_status status)
+            {
+                distribution.deallocate();
+                return status;
+            }
+            const rocrand_status status = generate(data, data_size, distribution);
+            distribution.deallocate();
+            return status;
+        }
+        rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_ALIAS> distribution(tables);
+        if(tables.size <= rocrand_host::detail::discrete_shared_capacity)
+        {
+            return generate_discrete_shared(data, data_size, distribution);
+        }
+        return generate(data, data_size, distribution);
+    }
+
+    /// Generates \p data_size values of a discrete \p distribution with
+    /// a small alias table (see generate_discrete_shared_kernel)
+    template<class Distribution>
+    rocrand_status generate_discrete_shared(unsigned int * data, size_t data_size,
+                                            Distribution distribution)
+    {
+        if(m_stateless)
+        {
+            rocrand_host::detail::profiling_range range("rocrand generate_kernel");
+            count_generate(data_size);
+            const uint2 key = stateless_key();
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_discrete_shared_stateless_kernel),
+                dim3(m_blocks), dim3(m_threads), 0, m_stream,
+                key, m_position, data, data_size, distribution
+            );
+            if(hipPeekAtLastError() != hipSuccess)
+                return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+            m_position += data_size;
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        rocrand_host::detail::profiling_range range("rocrand generate_kernel");
+        count_generate(data_size);
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_discrete_shared_kernel<s_threads_per_engine>),
+            dim3(m_blocks), dim3(m_threads), 0, m_stream,
+            m_engines, data, data_size, distribution
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Generates \p data_size Poisson-distributed values, the i-th one
+    /// with lambda \p lambdas[i] (device memory, or host memory for host-side
+    /// generators)
+    rocrand_status generate_poisson_array(unsigned int * data, size_t data_size,
+                                          const double * lambdas)
+    {
+        poisson_array_distribution distribution(lambdas);
+        return generate_rejection(data, data_size, distribution);
+    }
+
+    /// Generates \p data_size binomially distributed values (\p n trials,
+    /// success probability \p p)
+    rocrand_status generate_binomial(unsigned int * data, size_t data_size,
+                                     unsigned int n, double p)
+    {
+        binomial_distribution distribution(n, p);
+        return generate_rejection(data, data_size, distribution);
+    }
+
+    /// Generates \p data_size binomially distributed values, the i-th one
+    /// with \p ns[i] trials and success probability \p ps[i]
+    rocrand_status generate_binomial_array(unsigned int * data, size_t data_size,
+                                           const unsigned int * ns, const double * ps)
+    {
+        binomial_array_distribution distribution(ns, ps);
+        return generate_rejection(data, data_size, distribution);
+    }
+
+    /// Generates \p data_size multinomial vectors of \p categories counts
+    /// stored by category (see multinomial_distribution)
+    rocrand_status generate_multinomial(unsigned int * data, size_t data_size,
+                                        unsigned int n, const double * weights,
+                                        unsigned int categories)
+    {
+        multinomial_distribution distribution(n, weights, categories, data, data_size);
+        return generate_rejection(data + (categories - 1) * data_size, data_size, distribution);
+    }
+
+    /// Generates \p data_size unit vectors of \p dim values (1 to 4) stored
+    /// one after another (see unit_vector_distribution)
+    rocrand_status generate_unit_vectors(float * data, size_t data_size, unsigned int dim)
+    {
+        if(dim == 1)
+            return generate_unit_vectors<1>(data, data_size);
+        else if(dim == 2)
+            return generate_unit_vectors<2>(data, data_size);
+        else if(dim == 3)
+            return generate_unit_vectors<3>(data, data_size);
+        else if(dim == 4)
+            return generate_unit_vectors<4>(data, data_size);
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    template<unsigned int Dim>
+    rocrand_status generate_unit_vectors(float * data, size_t data_size)
+    {
+        typedef unit_vector_distribution<Dim> distribution_type;
+        return generate_rejection(
+            reinterpret_cast<typename distribution_type::value_type *>(data),
+            data_size, distribution_type()
+        );
+    }
+
+    /// Rounds \p data_size values of \p input to 16-bit or 8-bit values of
+    /// \p format (see stochastic_round_distribution)
+    rocrand_status generate_stochastic_round(const float * input, void * output,
+                                             size_t data_size, rocrand_round_format format)
+    {
+        if(format == ROCRAND_ROUND_FORMAT_BFLOAT16)
+            return generate_stochastic_round<rocrand_host::detail::stochastic_round_bfloat16>(input, output, data_size);
+        else if(format == ROCRAND_ROUND_FORMAT_HALF)
+            return generate_stochastic_round<rocrand_host::detail::stochastic_round_half>(input, output, data_size);
+        else if(format == ROCRAND_ROUND_FORMAT_FP8_E4M3)
+            return generate_stochastic_round<rocrand_host::detail::stochastic_round_fp8_e4m3>(input, output, data_size);
+        else if(format == ROCRAND_ROUND_FORMAT_FP8_E5M2)
+            return generate_stochastic_round<rocrand_host::detail::stochastic_round_fp8_e5m2>(input, output, data_size);
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    /// Values of every engine value are stored together, the tail of
+    /// fewer values uses one engine value per value
+    template<class Format>
+    rocrand_status generate_stochastic_round(const float * input, void * output, size_t data_size)
+    {
+        typedef stochastic_round_distribution<Format> distribution_type;
+        typedef stochastic_round_distribution<Format, 1> tail_distribution_type;
+        typedef typename Format::value_type T;
+        constexpr unsigned int values = 32 / Format::random_bits;
+        const size_t groups = data_size / values;
+        const size_t tail_size = data_size - groups * values;
+        if(groups > 0)
+        {
+            const rocrand_status status = generate_rejection(
+                reinterpret_cast<typename distribution_type::value_type *>(output),
+                groups, distribution_type(input)
+            );
+            if(status != ROCRAND_STATUS_SUCCESS || tail_size == 0)
+                return status;
+        }
+        return generate_rejection(
+            reinterpret_cast<typename tail_distribution_type::value_type *>(
+                static_cast<T *>(output) + groups * values
+            ),
+            tail_size, tail_distribution_type(input + groups * values)
+        );
+    }
+
+    /// Generates \p data_size values, the i-th one from the counter \p keys[i]
+    /// (see generate_at_value). Engines, the offset and the position in
+    /// stateless mode are neither used nor changed.
+    template<class T, class Distribution = uniform_distribution<T> >
+    rocrand_status generate_at(const unsigned long long * keys, T * data, size_t data_size,
+                               Distribution distribution = Distribution())
+    {
+        if(data_size == 0)
+            return ROCRAND_STATUS_SUCCESS;
+        if(keys == NULL || data == NULL)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        rocrand_host::detail::profiling_range range("rocrand generate_at_kernel");
+        count_generate(data_size);
+        const uint2 key = stateless_key();
+        if(m_host_side)
+        {
+            rocrand_host::detail::host_parallel_for(
+                data_size,
+                [=](size_t index)
+                {
+                    rocrand_host::detail::generate_at_value(key, keys, index, data, distribution);
+                }
+            );
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_at_kernel),
+            dim3(m_blocks), dim3(m_threads), 0, m_stream,
+            key, keys, data, data_size, distribution
+        );
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// generate_at() with Box-Muller normal values (the Ziggurat method
+    /// may use more than one state per value)
+    template<class T>
+    rocrand_status generate_normal_at(const unsigned long long * keys, T * data,
+                                      size_t data_size, T mean, T stddev)
+    {
+        normal_distribution<T> distribution(mean, stddev, fast_math());
+        return generate_at(keys, data, data_size, distribution);
+    }
+
+    /// Generates the tile of \p width x \p height entries at (\p row, \p col) of
+    /// the matrix \p matrix_id (see generate_matrix_group), \p pitch is the distance
+    /// between rows in values. Engines, the offset and the position in stateless
+    /// mode are neither used nor changed.
+    template<class Distribution>
+    rocrand_status generate_matrix(unsigned long long matrix_id,
+                                   float * data, size_t pitch,
+                                   unsigned long long row, unsigned long long col,
+                                   size_t width, size_t height,
+                                   Distribution distribution,
+                                   float mean = 0.0f, float stddev = 1.0f)
+    {
+        if(row > (1ULL << 32) || height > (1ULL << 32) - row
+            || col > (1ULL << 34) || width > (1ULL << 34) - col)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        if(width == 0 || height == 0)
+            return ROCRAND_STATUS_SUCCESS;
+        if(data == NULL)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        rocrand_host::detail::profiling_range range("rocrand generate_matrix_kernel");
+        count_generate(width * height);
+        const uint2 key = stateless_key();
+        if(m_host_side)
+        {
+            const size_t groups_per_row = (col + width - 1) / 4 - col / 4 + 1;
+            rocrand_host::detail::host_parallel_for(
+                groups_per_row * height,
+                [=](size_t index)
+                {
+                    rocrand_host::detail::generate_matrix_group(
+                        key, matrix_id, data, pitch, row, col, width, groups_per_row, index,
+                        distribution, mean, stddev
+                    );
+                }
+            );
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_matrix_kernel),
+            dim3(m_blocks), dim3(m_threads), 0, m_stream,
+            key, matrix_id, data, pitch, row, col, width, height,
+            distribution, mean, stddev
+        );
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Generates a random permutation of [0, \p n) (rocrand_generate_permutation())
+    rocrand_status generate_permutation(unsigned int * data, size_t n)
+    {
+        if((data == NULL && n > 0) || n > (1ULL << 32))
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        if(n == 0)
+            return ROCRAND_STATUS_SUCCESS;
+
+        const rocrand_host::detail::feistel_permutation permutation(n);
+        if(m_host_side)
+        {
+            unsigned int keys[rocrand_host::detail::feistel_permutation::key_size];
+            rocrand_status status = generate(keys, permutation.key_size);
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+
+            rocrand_host::detail::profiling_range range("rocrand generate_permutation_kernel");
+            count_generate(n);
+            rocrand_host::detail::host_parallel_for(
+                n,
+                [=](size_t index)
+                {
+                    data[index] = static_cast<unsigned int>(permutation(index, keys));
+                }
+            );
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        unsigned int * permutation_keys;
+        rocrand_status status = generate_permutation_keys(&permutation_keys);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        rocrand_host::detail::profiling_range range("rocrand generate_permutation_kernel");
+        count_generate(n);
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_permutation_kernel),
+            dim3(m_blocks), dim3(m_threads), 0, m_stream,
+            data, permutation, permutation_keys
+        );
+        status = hipPeekAtLastError() != hipSuccess
+            ? ROCRAND_STATUS_LAUNCH_FAILURE
+            : ROCRAND_STATUS_SUCCESS;
+        // Released after the kernel is finished
+        rocrand_host::detail::device_free(permutation_keys, m_stream);
+        return status;
+    }
+
+    /// Generates \p n_vectors multivariate normal vectors of \p dim values
+    /// (rocrand_generate_multivariate_normal()). Stateless device generators
+    /// with the Box-Muller method compute standard normal values in
+    /// multivariate_normal_kernel without a temporary buffer of them.
+    rocrand_status generate_multivariate_normal(float * data, size_t n_vectors,
+                                                unsigned int dim,
+                                                const float * factor, const float * mean)
+    {
+        if(!m_stateless || m_host_side || m_normal_method == ROCRAND_NORMAL_METHOD_ZIGGURAT)
+        {
+            return rocrand_host::detail::generate_multivariate_normal(
+                m_stream, m_host_side, data, n_vectors, dim, factor, mean,
+                [this](float * normals, size_t size)
+                {
+                    return this->generate_normal(normals, size, 0.0f, 1.0f);
+                }
+            );
+        }
+        if(n_vectors == 0)
+            return ROCRAND_STATUS_SUCCESS;
+
+        float * factor_t;
+        if(rocrand_host::detail::device_malloc(
+            &factor_t, sizeof(float) * dim * dim, m_stream
+        ) != hipSuccess)
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+
+        rocrand_host::detail::profiling_range range("rocrand multivariate_normal_kernel");
+        const size_t size = n_vectors * dim;
+        count_generate(size);
+        const rocrand_host::detail::stateless_normal_source source = {
+            stateless_key(), m_position, normal_distribution<float>(0.0f, 1.0f, fast_math())
+        };
+        const rocrand_status status = rocrand_host::detail::launch_multivariate_normal(
+            m_stream, data, n_vectors, dim, factor, mean, factor_t, source
+        );
+        rocrand_host::detail::device_free(factor_t, m_stream);
+        if(status == ROCRAND_STATUS_SUCCESS)
+            m_position += size;
+        return status;
+    }
+
+    /// Shuffles \p n elements of \p element_size bytes in place (rocrand_shuffle()):
+    /// elements are copied to a temporary buffer and gathered back by a random
+    /// permutation of [0, \p n)
+    rocrand_status shuffle(void * data, size_t n, size_t element_size)
+    {
+        if(element_size == 0 || (data == NULL && n > 0))
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        if(n == 0)
+            return ROCRAND_STATUS_SUCCESS;
+
+        // The largest words that elements are made of
+        const uintptr_t alignment = reinterpret_cast<uintptr_t>(data) | element_size;
+        if(alignment % sizeof(uint4) == 0)
+            return shuffle_words<uint4>(data, n, element_size);
+        if(alignment % sizeof(unsigned long long) == 0)
+            return shuffle_words<unsigned long long>(data, n, element_size);
+        if(alignment % sizeof(unsigned int) == 0)
+            return shuffle_words<unsigned int>(data, n, element_size);
+        if(alignment % sizeof(unsigned short) == 0)
+            return shuffle_words<unsigned short>(data, n, element_size);
+        return shuffle_words<unsigned char>(data, n, element_size);
+    }
+
+    /// Generates a Latin hypercube sample of \p n_points points of \p dims values
+    /// (rocrand_generate_latin_hypercube())
+    rocrand_status generate_latin_hypercube(float * data, size_t n_points,
+                                            unsigned int dims, bool interleaved)
+    {
+        return generate_stratified<true>(data, n_points, dims, n_points, interleaved);
+    }
+
+    /// Generates \p n_points points of \p dims values stratified by a grid of
+    /// \p strata cells in every dimension (rocrand_generate_stratified_uniform())
+    rocrand_status generate_stratified_uniform(float * data, size_t n_points,
+                                               unsigned int dims, unsigned int strata,
+                                               bool interleaved)
+    {
+        if(strata == 0)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        return generate_stratified<false>(data, n_points, dims, strata, interleaved);
+    }
+
+private:
+    /// Key words of permutations of all dimensions are generated by the generator,
+    /// points are computed by one launch of generate_stratified_kernel without
+    /// temporary buffers of uniform values or permutations
+    template<bool Latin>
+    rocrand_status generate_stratified(float * data, size_t n_points, unsigned int dims,
+                                       unsigned long long strata, bool interleaved)
+    {
+        if(dims == 0 || (data == NULL && n_points > 0))
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        if(n_points == 0)
+            return ROCRAND_STATUS_SUCCESS;
+
+        constexpr unsigned int key_size = rocrand_host::detail::feistel_permutation::key_size;
+        const size_t keys_size = static_cast<size_t>(dims) * key_size;
+        const rocrand_host::detail::feistel_permutation permutation(n_points);
+        if(m_host_side)
+        {
+            std::vector<unsigned int> host_keys(keys_size);
+            rocrand_status status = generate(host_keys.data(), keys_size);
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+
+            rocrand_host::detail::profiling_range range("rocrand generate_stratified_kernel");
+            count_generate(n_points * dims);
+            const unsigned int * keys = host_keys.data();
+            rocrand_host::detail::host_parallel_for(
+                n_points * dims,
+                [=](size_t index)
+                {
+                    const size_t point = interleaved ? index / dims : index % n_points;
+                    const unsigned int dim = static_cast<unsigned int>(
+                        interleaved ? index % dims : index / n_points
+                    );
+                    data[index] = rocrand_host::detail::stratified_value<Latin>(
+                        point, dim, permutation, strata, keys
+                    );
+                }
+            );
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        unsigned int * keys;
+        if(rocrand_host::detail::device_malloc(
+            &keys, sizeof(unsigned int) * keys_size, m_stream
+        ) != hipSuccess)
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        rocrand_status status = generate(keys, keys_size);
+        if(status == ROCRAND_STATUS_SUCCESS)
+        {
+            rocrand_host::detail::profiling_range range("rocrand generate_stratified_kernel");
+            count_generate(n_points * dims);
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_stratified_kernel<Latin>),
+                dim3(m_blocks), dim3(m_threads), 0, m_stream,
+                data, n_points, dims, permutation, strata, keys, interleaved
+            );
+            if(hipPeekAtLastError() != hipSuccess)
+                status = ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+        rocrand_host::detail::device_free(keys, m_stream);
+        return status;
+    }
+
+    /// Allocates and generates key words of a new permutation for device generators.
+    /// Every permutation has its own keys freed in m_stream after its kernel, so
+    /// keys read by a kernel in a previous stream (rocrand_set_stream()) are never
+    /// overwritten.
+    rocrand_status generate_permutation_keys(unsigned int ** keys)
+    {
+        constexpr unsigned int key_size = rocrand_host::detail::feistel_permutation::key_size;
+        if(rocrand_host::detail::device_malloc(
+            keys, sizeof(unsigned int) * key_size, m_stream
+        ) != hipSuccess)
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        rocrand_status status = generate(*keys, key_size);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            rocrand_host::detail::device_free(*keys, m_stream);
+        return status;
+    }
+
+    template<class T>
+    rocrand_status shuffle_words(void * data, size_t n, size_t element_size)
+    {
+        const size_t words = element_size / sizeof(T);
+        const size_t bytes = n * element_size;
+
+        const rocrand_host::detail::feistel_permutation permutation(n);
+        T * output = static_cast<T *>(data);
+        if(m_host_side)
+        {
+            unsigned int keys[rocrand_host::detail::feistel_permutation::key_size];
+            rocrand_status status = generate(keys, permutation.key_size);
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+
+            rocrand_host::detail::profiling_range range("rocrand shuffle_kernel");
+            count_generate(n);
+            std::vector<T> input(output, output + n * words);
+            const T * input_data = input.data();
+            rocrand_host::detail::host_parallel_for(
+                n,
+                [=](size_t index)
+                {
+                    rocrand_host::detail::shuffle_element(
+                        input_data, output, words, index, permutation, keys
+                    );
+                }
+            );
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        unsigned int * permutation_keys;
+        rocrand_status status = generate_permutation_keys(&permutation_keys);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        rocrand_host::detail::profiling_range range("rocrand shuffle_kernel");
+        count_generate(n);
+        T * input;
+        if(rocrand_host::detail::device_malloc(&input, bytes, m_stream) != hipSuccess)
+        {
+            rocrand_host::detail::device_free(permutation_keys, m_stream);
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        if(hipMemcpyAsync(input, data, bytes, hipMemcpyDeviceToDevice, m_stream) != hipSuccess)
+        {
+            rocrand_host::detail::device_free(input, m_stream);
+            rocrand_host::detail::device_free(permutation_keys, m_stream);
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::shuffle_kernel<T>),
+            dim3(m_blocks), dim3(m_threads), 0, m_stream,
+            static_cast<const T *>(input), output, words, permutation, permutation_keys
+        );
+        status = hipPeekAtLastError() != hipSuccess
+            ? ROCRAND_STATUS_LAUNCH_FAILURE
+            : ROCRAND_STATUS_SUCCESS;
+        // Released after the kernel is finished
+        rocrand_host::detail::device_free(input, m_stream);
+        rocrand_host::detail::device_free(permutation_keys, m_stream);
+        return status;
+    }
+
+    uint2 stateless_key() const
+    {
+        return uint2 {
+            static_cast<unsigned int>(m_seed),
+            static_cast<unsigned int>(m_seed >> 32)
+        };
+    }
+
+    /// generate() without engines (see generate_stateless_kernel)
+    template<class T, class Distribution>
+    rocrand_status generate_stateless(T * data, size_t data_size,
+                                      Distribution distribution)
+    {
+        rocrand_host::detail::profiling_range range("rocrand generate_kernel");
+        count_generate(data_size);
+        const uint2 key = stateless_key();
+        const unsigned long long position = m_position;
+        if(m_host_side)
+        {
+            const unsigned int stride = m_blocks * m_threads;
+            rocrand_host::detail::host_parallel_for(
+                stride,
+                [=](size_t thread_id)
+                {
+                    rocrand_host::detail::generate_stateless_thread(
+                        key, position, thread_id, stride, data, data_size, distribution
+                    );
+                }
+            );
+        }
+        else
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_stateless_kernel),
+                dim3(m_blocks), dim3(m_threads), 0, m_stream,
+                key, position, data, data_size, distribution, streaming_stores()
+            );
+            // Check kernel status
+            if(hipPeekAtLastError() != hipSuccess)
+                return ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+
+        m_position += data_size;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// generate_rejection() without engines
+    /// (see generate_rejection_stateless_kernel)
+    template<class T, class Distribution>
+    rocrand_status generate_rejection_stateless(T * data, size_t data_size,
+                                                Distribution distribution)
+    {
+        rocrand_host::detail::profiling_range range("rocrand generate_kernel");
+        count_generate(data_size);
+        const uint2 key = stateless_key();
+        const unsigned long long position = m_position;
+        if(m_host_side)
+        {
+            const unsigned int stride = m_blocks * m_threads;
+            rocrand_host::detail::host_parallel_for(
+                stride,
+                [=](size_t thread_id)
+                {
+                    rocrand_host::detail::generate_rejection_stateless_thread(
+                        key, position, thread_id, stride, data, data_size, distribution
+                    );
+                }
+            );
+        }
+        else
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_rejection_stateless_kernel),
+                dim3(m_blocks), dim3(m_threads), 0, m_stream,
+                key, position, data, data_size, distribution
+            );
+            // Check kernel status
+            if(hipPeekAtLastError() != hipSuccess)
+                return ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+
+        m_position += data_size;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Generator data written by save() before engines
+    struct save_data
+    {
+        unsigned long long seed;
+        unsigned long long offset;
+        unsigned int blocks;
+        unsigned int threads;
+        unsigned int stateless;
+        unsigned int reserved;
+    };
+
+    bool m_engines_initialized;
+    engine_type * m_engines;
+    unsigned int m_blocks;
+    unsigned int m_threads;
+    size_t m_engines_size;
+
+    bool m_stateless;
+    // Block of the next value in stateless mode, m_offset after reset()
+    unsigned long long m_position;
+    // Number of children created by split() since the seed was set
+    unsigned long long m_children;
+
+    const static uint32_t s_default_threads = 256;
+    const static uint32_t s_default_blocks = 1024;
+    const static uint32_t s_max_threads = 1024;
+
+    // For caching of Poisson for consecutive generations with the same lambda
+    poisson_distribution_manager<> m_poisson;
+    poisson_distribution_manager<ROCRAND_DISCRETE_METHOD_ALIAS, true> m_poisson_host;
+
+    rocrand_normal_method m_normal_method;
 
     // m_seed from base_type
     // m_offset from base_type
@@ -0,0 +1,615 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_POINT_SET_H_
+#define ROCRAND_RNG_POINT_SET_H_
+
+#include <algorithm>
+#include <new>
+#include <vector>
+#include <hip/hip_runtime.h>
+
+#include <rocrand.h>
+
+#include "common.hpp"
+#include "generator_type.hpp"
+#include "distributions.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+    // Reverses bits of x (radical inverse in base 2 as a 32-bit fraction)
+    __forceinline__ __device__ __host__
+    unsigned int reverse_bits(unsigned int x)
+    {
+    #if defined(__HIP_DEVICE_COMPILE__)
+        return __brev(x);
+    #else
+        x = ((x >> 1) & 0x55555555U) | ((x & 0x55555555U) << 1);
+        x = ((x >> 2) & 0x33333333U) | ((x & 0x33333333U) << 2);
+        x = ((x >> 4) & 0x0F0F0F0FU) | ((x & 0x0F0F0F0FU) << 4);
+        x = ((x >> 8) & 0x00FF00FFU) | ((x & 0x00FF00FFU) << 8);
+        return (x >> 16) | (x << 16);
+    #endif
+    }
+
+    // Point i of dimension d of a Halton sequence: the radical inverse of i in
+    // base constants[0] with digits multiplied by constants[1] modulo the base
+    // (1 for the original sequence), as a 32-bit fraction
+    __forceinline__ __device__ __host__
+    unsigned int halton_value(const unsigned int * constants, unsigned int index)
+    {
+        const unsigned int base = constants[0];
+        const unsigned long long multiplier = constants[1];
+        unsigned long long reversed = 0;
+        unsigned long long scale = 1;
+        while(index > 0)
+        {
+            const unsigned int next = index / base;
+            const unsigned int digit = index - next * base;
+            reversed = reversed * base + (multiplier * digit) % base;
+            scale *= base;
+            index = next;
+        }
+        // reversed < scale <= base * 2^32, the fraction is below 1
+        const double value =
+            static_cast<double>(reversed) / static_cast<double>(scale) * 4294967296.0;
+        return static_cast<unsigned int>(value < 4294967295.0 ? value : 4294967295.0);
+    }
+
+    // Properties of quasi-random generators whose points are computed directly
+    // from their indices: constants of one dimension, their computation on
+    // the host and the value of a point.
+    template<rocrand_rng_type RngType>
+    struct point_set_traits;
+
+    // Rank-1 lattice sequence: point i of dimension d is the fractional part of
+    // phi(i) * z[d], where phi(i) is the radical inverse of i in base 2 and z is
+    // the generating vector, so first 2^m points are the lattice rule of 2^m points.
+    template<>
+    struct point_set_traits<ROCRAND_RNG_QUASI_LATTICE32>
+    {
+        static constexpr unsigned int constants_per_dimension = 1;
+        static constexpr unsigned int max_dimensions = 1048576;
+        static constexpr bool has_generating_vector = true;
+
+        // Multiplier of the default Korobov vector z[d] = a^d mod 2^32, selected
+        // by the P2 criterion (weights 1/d^2, 20 dimensions) of 2^6..2^17 points
+        static constexpr unsigned int korobov_multiplier = 0xC3568CE3U;
+
+        static void compute_constants(const unsigned int dimensions,
+                                      std::vector<unsigned int>& constants)
+        {
+            constants.resize(dimensions);
+            unsigned int z = 1;
+            for(unsigned int d = 0; d < dimensions; d++)
+            {
+                constants[d] = z;
+                z *= korobov_multiplier;
+            }
+        }
+
+        __forceinline__ __device__ __host__
+        static unsigned int value(const unsigned int * constants, const unsigned int index)
+        {
+            return reverse_bits(index) * constants[0];
+        }
+    };
+
+    // Halton sequence: dimension d is the van der Corput sequence in base of
+    // the d-th prime
+    template<>
+    struct point_set_traits<ROCRAND_RNG_QUASI_HALTON32>
+    {
+        static constexpr unsigned int constants_per_dimension = 2;
+        static constexpr unsigned int max_dimensions = 65536;
+        static constexpr bool has_generating_vector = false;
+        static constexpr bool is_scrambled = false;
+
+        static void compute_constants(const unsigned int dimensions,
+                                      std::vector<unsigned int>& constants);
+
+        __forceinline__ __device__ __host__
+        static unsigned int value(const unsigned int * constants, const unsigned int index)
+        {
+            return halton_value(constants, index);
+        }
+    };
+
+    // Scrambled Halton sequence: digits of dimension d are multiplied by
+    // a fixed pseudo-random multiplier of the dimension's base
+    template<>
+    struct point_set_traits<ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32>
+        : public point_set_traits<ROCRAND_RNG_QUASI_HALTON32>
+    {
+        static constexpr bool is_scrambled = true;
+
+        static void compute_constants(const unsigned int dimensions,
+                                      std::vector<unsigned int>& constants);
+    };
+
+    // Computes bases (first primes) and digit multipliers of Halton sequences
+    inline void compute_halton_constants(const unsigned int dimensions,
+                                         const bool scrambled,
+                                         std::vector<unsigned int>& constants)
+    {
+        constants.resize(2 * static_cast<size_t>(dimensions));
+        // The 65536th prime is 821641
+        size_t limit = 16;
+        while(limit / 16 < dimensions)
+        {
+            limit *= 2;
+        }
+        std::vector<bool> composite(limit, false);
+        unsigned int d = 0;
+        for(size_t p = 2; p < limit && d < dimensions; p++)
+        {
+            if(composite[p])
+                continue;
+            for(size_t q = p * p; q < limit; q += p)
+            {
+                composite[q] = true;
+            }
+            unsigned int multiplier = 1;
+            if(scrambled && p > 2)
+            {
+                // Fixed hash of the dimension, the multiplier is in [2, p - 1]
+                // (1 would leave the dimension unscrambled)
+                unsigned long long h = 0x9E3779B97F4A7C15ULL * (d + 1);
+                h ^= h >> 31;
+                h *= 0xBF58476D1CE4E5B9ULL;
+                h ^= h >> 29;
+                multiplier = 2 + static_cast<unsigned int>(h % (p - 2));
+            }
+            constants[2 * d] = static_cast<unsigned int>(p);
+            constants[2 * d + 1] = multiplier;
+            d++;
+        }
+    }
+
+    inline void
+    point_set_traits<ROCRAND_RNG_QUASI_HALTON32>::compute_constants(const unsigned int dimensions,
+                                                                   std::vector<unsigned int>& constants)
+    {
+        compute_halton_constants(dimensions, false, constants);
+    }
+
+    inline void
+    point_set_traits<ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32>::compute_constants(const unsigned int dimensions,
+                                                                             std::vector<unsigned int>& constants)
+    {
+        compute_halton_constants(dimensions, true, constants);
+    }
+
+    // Generates values [first, first + count * stride, ...) of the output of
+    // size points of dimensions dimensions. Every value is computed from
+    // its own index, so consecutive threads write consecutive values: points
+    // of the same dimension, or dimensions of the same point for interleaved output.
+    template<class Traits, class T, class Distribution>
+    __forceinline__ __device__ __host__
+    void generate_point_set_thread(T * data, const size_t size,
+                                   const unsigned int dimensions,
+                                   const unsigned int * constants,
+                                   const unsigned int offset,
+                                   const size_t first,
+                                   const size_t stride,
+                                   const bool interleaved,
+                                   Distribution distribution)
+    {
+        const size_t total = size * dimensions;
+        const size_t inner_size = interleaved ? dimensions : size;
+        // Indices are advanced without divisions: stride is outer_step
+        // outer indices and inner_step inner indices
+        const size_t outer_step = stride / inner_size;
+        const size_t inner_step = stride - outer_step * inner_size;
+        size_t outer = first / inner_size;
+        size_t inner = first - outer * inner_size;
+        for(size_t i = first; i < total; i += stride)
+        {
+            const size_t point = interleaved ? outer : inner;
+            const unsigned int dimension = static_cast<unsigned int>(interleaved ? inner : outer);
+            data[i] = distribution(Traits::value(
+                constants + dimension * Traits::constants_per_dimension,
+                offset + static_cast<unsigned int>(point)
+            ));
+            outer += outer_step;
+            inner += inner_step;
+            if(inner >= inner_size)
+            {
+                inner -= inner_size;
+                outer++;
+            }
+        }
+    }
+
+    template<class Traits, class T, class Distribution>
+    __global__
+    void generate_point_set_kernel(T * data, const size_t size,
+                                   const unsigned int dimensions,
+                                   const unsigned int * constants,
+                                   const unsigned int offset,
+                                   const bool interleaved,
+                                   Distribution distribution)
+    {
+        generate_point_set_thread<Traits>(
+            data, size, dimensions, constants, offset,
+            hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x,
+            static_cast<size_t>(hipGridDim_x) * hipBlockDim_x,
+            interleaved, distribution
+        );
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+// Quasi-random generators whose points are computed directly from their
+// indices: LATTICE32 (rank-1 lattice sequence), HALTON32 and SCRAMBLED_HALTON32.
+// Unlike Sobol generators they need no strided discards, so one-dimensional
+// grids of any size generate all dimensions and points by grid-stride loops.
+template<rocrand_rng_type RngType>
+class rocrand_point_set : public rocrand_generator_type<RngType>
+{
+public:
+    using base_type = rocrand_generator_type<RngType>;
+    using traits_type = ::rocrand_host::detail::point_set_traits<RngType>;
+
+    rocrand_point_set(unsigned long long offset = 0,
+                      hipStream_t stream = 0,
+                      bool host_side = false)
+        : base_type(0, offset, stream, host_side),
+          m_initialized(false),
+          m_dimensions(1),
+          m_ordering(ROCRAND_ORDERING_QUASI_DEFAULT),
+          m_current_offset(0),
+          m_constants(NULL), m_constants_dimensions(0),
+          m_max_blocks(s_default_max_blocks), m_threads(s_default_threads)
+    {
+    }
+
+    ~rocrand_point_set()
+    {
+        if(!m_host_side)
+        {
+            rocrand_host::detail::device_free(m_constants, m_stream);
+        }
+    }
+
+    void reset()
+    {
+        m_initialized = false;
+    }
+
+    void set_offset(unsigned long long offset)
+    {
+        m_offset = offset;
+        m_initialized = false;
+    }
+
+    rocrand_status set_dimensions(unsigned int dimensions)
+    {
+        const unsigned int max_dimensions = m_vector.empty()
+            ? traits_type::max_dimensions
+            : static_cast<unsigned int>(m_vector.size());
+        if(dimensions < 1 || dimensions > max_dimensions)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+
+        m_dimensions = dimensions;
+        m_initialized = false;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Replaces the default generating vector of a lattice generator by \p size
+    /// components of \p vector and sets the number of dimensions to \p size
+    /// (rocrand_set_lattice_generating_vector())
+    rocrand_status set_generating_vector(const unsigned int * vector, unsigned int size)
+    {
+        if(!traits_type::has_generating_vector)
+        {
+            return ROCRAND_STATUS_TYPE_ERROR;
+        }
+        if(vector == NULL || size < 1 || size > traits_type::max_dimensions)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+
+        m_vector.assign(vector, vector + size);
+        m_dimensions = size;
+        m_constants_dimensions = 0;
+        m_initialized = false;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Sets the layout of generated values (see rocrand_sobol::set_ordering()),
+    /// does not change the sequences
+    rocrand_status set_ordering(rocrand_ordering ordering)
+    {
+        if(ordering == ROCRAND_ORDERING_PSEUDO_DEFAULT
+            || ordering == ROCRAND_ORDERING_PSEUDO_SEEDED
+            || ordering == ROCRAND_ORDERING_PSEUDO_DYNAMIC)
+        {
+            return ROCRAND_STATUS_TYPE_ERROR;
+        }
+        if(ordering != ROCRAND_ORDERING_QUASI_DEFAULT
+            && ordering != ROCRAND_ORDERING_QUASI_INTERLEAVED)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+
+        m_ordering = ordering;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    unsigned int get_dimensions() const
+    {
+        return m_dimensions;
+    }
+
+    rocrand_ordering get_ordering() const
+    {
+        return m_ordering;
+    }
+
+    /// Changes launch configuration: at most \p blocks blocks of \p threads threads
+    /// are launched. Generated sequences do not depend on launch configuration.
+    /// When both are 0, the maximum number of blocks is computed from occupancy
+    /// of the current device.
+    rocrand_status set_launch_config(unsigned int blocks, unsigned int threads)
+    {
+        if(blocks == 0 && threads == 0)
+        {
+            threads = s_default_threads;
+            blocks = s_default_max_blocks;
+            if(!m_host_side)
+            {
+                void (*kernel)(unsigned int *, const size_t, const unsigned int,
+                               const unsigned int *, const unsigned int, const bool,
+                               sobol_uniform_distribution<unsigned int>) =
+                    rocrand_host::detail::generate_point_set_kernel<
+                        traits_type, unsigned int, sobol_uniform_distribution<unsigned int>
+                    >;
+                rocrand_status status = rocrand_host::detail::get_occupancy_blocks(
+                    kernel, threads, blocks
+                );
+                if(status != ROCRAND_STATUS_SUCCESS)
+                    return status;
+            }
+        }
+        if(blocks == 0 || threads == 0 || threads > s_max_threads)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        m_max_blocks = blocks;
+        m_threads = threads;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    void get_launch_config(unsigned int * blocks, unsigned int * threads) const
+    {
+        *blocks = m_max_blocks;
+        *threads = m_threads;
+    }
+
+    rocrand_status init()
+    {
+        // Constants of a trimmed generator are uploaded again (see trim())
+        rocrand_status status = set_constants();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        if (m_initialized)
+            return ROCRAND_STATUS_SUCCESS;
+
+        count_init();
+        m_current_offset = static_cast<unsigned int>(m_offset);
+        m_initialized = true;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Returns size of device memory of constants (rocrand_get_memory_usage())
+    size_t get_memory_usage() const
+    {
+        return m_constants == NULL ? 0 : sizeof(unsigned int) * m_constants_host.size();
+    }
+
+    /// Frees device memory of constants (rocrand_generator_trim()),
+    /// the next init() (every generate call) uploads them again
+    rocrand_status trim()
+    {
+        if(m_host_side)
+            return ROCRAND_STATUS_SUCCESS;
+        rocrand_host::detail::device_free(m_constants, m_stream);
+        m_constants = NULL;
+        m_constants_dimensions = 0;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T, class Distribution = sobol_uniform_distribution<T> >
+    rocrand_status generate(T * data, size_t data_size,
+                            Distribution distribution = Distribution())
+    {
+        if (data_size % m_dimensions != 0)
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        rocrand_host::detail::profiling_range range("rocrand generate_point_set_kernel");
+        count_generate(data_size);
+
+        const size_t size = data_size / m_dimensions;
+        const bool interleaved = m_ordering == ROCRAND_ORDERING_QUASI_INTERLEAVED;
+        const uint32_t threads = m_threads;
+        const uint32_t blocks = static_cast<uint32_t>(std::max<size_t>(1, std::min<size_t>(
+            m_max_blocks, (data_size + threads - 1) / threads
+        )));
+
+        if(m_host_side)
+        {
+            const unsigned int * constants = m_constants_host.data();
+            const unsigned int dimensions = m_dimensions;
+            const unsigned int offset = m_current_offset;
+            const size_t stride = static_cast<size_t>(blocks) * threads;
+            rocrand_host::detail::host_parallel_for(
+                stride,
+                [=](size_t thread_id)
+                {
+                    rocrand_host::detail::generate_point_set_thread<traits_type>(
+                        data, size, dimensions, constants, offset,
+                        thread_id, stride, interleaved, distribution
+                    );
+                }
+            );
+            m_current_offset += static_cast<unsigned int>(size);
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_point_set_kernel<traits_type>),
+            dim3(blocks), dim3(threads), 0, m_stream,
+            data, size, m_dimensions,
+            static_cast<const unsigned int *>(m_constants),
+            m_current_offset, interleaved,
+            distribution
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_current_offset += static_cast<unsigned int>(size);
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_uniform(T * data, size_t data_size)
+    {
+        sobol_uniform_distribution<T> distribution;
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        sobol_normal_distribution<T> distribution(mean, stddev, fast_math());
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        sobol_log_normal_distribution<T> distribution(mean, stddev, fast_math());
+        return generate(data, data_size, distribution);
+    }
+
+private:
+    using base_type::m_offset;
+    using base_type::m_stream;
+    using base_type::m_host_side;
+    using base_type::m_stats;
+    using base_type::count_generate;
+    using base_type::count_init;
+    using base_type::fast_math;
+
+    bool m_initialized;
+    unsigned int m_dimensions;
+    rocrand_ordering m_ordering;
+    unsigned int m_current_offset;
+    // Generating vector set by set_generating_vector(), empty for the default one
+    std::vector<unsigned int> m_vector;
+    // Constants of the first m_constants_dimensions dimensions (host-side
+    // generators use m_constants_host)
+    std::vector<unsigned int> m_constants_host;
+    unsigned int * m_constants;
+    unsigned int m_constants_dimensions;
+    unsigned int m_max_blocks;
+    unsigned int m_threads;
+
+    static const uint32_t s_default_threads = 256;
+    static const uint32_t s_default_max_blocks = 4096;
+    static const uint32_t s_max_threads = 1024;
+
+    // Computes constants of all dimensions unless constants of the previous
+    // initialization cover them (constants of a dimension do not depend on
+    // the number of dimensions), device generators keep a copy in device memory
+    rocrand_status set_constants()
+    {
+        if(m_constants_dimensions >= m_dimensions)
+            return ROCRAND_STATUS_SUCCESS;
+
+        try
+        {
+            if(m_vector.empty())
+            {
+                traits_type::compute_constants(m_dimensions, m_constants_host);
+            }
+            else
+            {
+                m_constants_host = m_vector;
+            }
+        }
+        catch(const std::bad_alloc&)
+        {
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        const unsigned int dimensions =
+            static_cast<unsigned int>(m_constants_host.size() / traits_type::constants_per_dimension);
+        if(m_host_side)
+        {
+            m_constants_dimensions = dimensions;
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        // Kernels of previous calls may still read the constants
+        if(hipStreamSynchronize(m_stream) != hipSuccess)
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        rocrand_host::detail::device_free(m_constants, m_stream);
+        m_constants = NULL;
+        m_constants_dimensions = 0;
+        const size_t bytes = sizeof(unsigned int) * m_constants_host.size();
+        if(rocrand_host::detail::device_malloc(&m_constants, bytes, m_stream) != hipSuccess)
+        {
+            m_constants = NULL;
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        m_stats.device_bytes_allocated += bytes;
+        if(hipMemcpy(m_constants, m_constants_host.data(), bytes, hipMemcpyHostToDevice) != hipSuccess)
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        m_constants_dimensions = dimensions;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+};
+
+// Disabled engines are replaced in generators.hpp
+#ifndef ROCRAND_DISABLE_LATTICE32
+typedef rocrand_point_set<ROCRAND_RNG_QUASI_LATTICE32> rocrand_lattice32;
+#endif
+#ifndef ROCRAND_DISABLE_HALTON32
+typedef rocrand_point_set<ROCRAND_RNG_QUASI_HALTON32> rocrand_halton32;
+#endif
+#ifndef ROCRAND_DISABLE_SCRAMBLED_HALTON32
+typedef rocrand_point_set<ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32> rocrand_scrambled_halton32;
+#endif
+
+#endif // ROCRAND_RNG_POINT_SET_H_
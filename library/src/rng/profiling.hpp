@@ -0,0 +1,61 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef ROCRAND_RNG_PROFILING_H_
+#define ROCRAND_RNG_PROFILING_H_
+
+#ifdef ROCRAND_ENABLE_ROCTX
+#include <roctx.h>
+#endif
+
+namespace rocrand_host {
+namespace detail {
+
+    // Marks the lifetime of the object as a roctx range called name, so phases
+    // of generators appear in rocprof timelines when the library is built
+    // with ENABLE_ROCTX. Does nothing otherwise.
+    class profiling_range
+    {
+    public:
+        explicit profiling_range(const char * name)
+        {
+#ifdef ROCRAND_ENABLE_ROCTX
+            roctxRangePush(name);
+#else
+            (void)name;
+#endif
+        }
+
+        ~profiling_range()
+        {
+#ifdef ROCRAND_ENABLE_ROCTX
+            roctxRangePop();
+#endif
+        }
+
+        profiling_range(const profiling_range&) = delete;
+        profiling_range& operator=(const profiling_range&) = delete;
+    };
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_PROFILING_H_
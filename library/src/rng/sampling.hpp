@@ -0,0 +1,511 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_SAMPLING_H_
+#define ROCRAND_RNG_SAMPLING_H_
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "allocator.hpp"
+
+// Weighted sampling without replacement (rocrand_sample_without_replacement()):
+// every candidate i gets the Efraimidis-Spirakis key u_i^(1/w_i) (u_i are
+// uniform values of the generator), the k candidates with the largest keys
+// are selected. Keys are compared as log(u_i) / w_i mapped to unsigned integers
+// with the same order, and the k-th largest key is found by radix selection:
+// every pass builds a histogram of one digit of keys that match already selected
+// digits, so candidates are read a fixed number of times without sorting them.
+
+namespace rocrand_host {
+namespace detail {
+
+    // Output index of rows of rocrand_sample_without_replacement_csr()
+    // with fewer than k candidates
+    constexpr unsigned int sampling_no_index = 0xFFFFFFFFU;
+
+    // Returns the key of a candidate with uniform value u (in (0, 1])
+    // and weight w, candidates with non-positive weights have the smallest key 0
+    __forceinline__ __device__ __host__
+    unsigned int sampling_key(float u, float w)
+    {
+        if(!(w > 0.0f))
+            return 0;
+        union
+        {
+            float f;
+            unsigned int u;
+        } key;
+        key.f = logf(u) / w;
+        // Order of unsigned integers is the order of floats
+        return (key.u & 0x80000000U) ? ~key.u : (key.u | 0x80000000U);
+    }
+
+    // Digits of keys selected by passes of the global selection (most significant first)
+    constexpr unsigned int sampling_passes = 3;
+    constexpr unsigned int sampling_digit_bits[sampling_passes] = { 11, 11, 10 };
+    constexpr unsigned int sampling_digit_shifts[sampling_passes] = { 21, 10, 0 };
+    constexpr unsigned int sampling_bins = 1 << 11;
+
+    constexpr unsigned int sampling_threads = 256;
+    constexpr unsigned int sampling_max_blocks = 1024;
+
+    // State of the global selection in device memory, so passes do not
+    // synchronize with the host
+    struct sampling_state
+    {
+        // Selected digits of the k-th largest key and their bits
+        unsigned int threshold;
+        unsigned int mask;
+        // Number of candidates with the key equal to the threshold to select
+        unsigned long long remaining;
+        // Counters of the gather pass
+        unsigned long long selected;
+        unsigned long long ties;
+    };
+
+    __global__
+    void sampling_init_kernel(sampling_state * state,
+                              unsigned long long * histogram,
+                              const unsigned long long k)
+    {
+        const unsigned int thread_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+        for(unsigned int i = thread_id; i < sampling_bins; i += stride)
+        {
+            histogram[i] = 0;
+        }
+        if(thread_id == 0)
+        {
+            state->threshold = 0;
+            state->mask = 0;
+            state->remaining = k;
+            state->selected = 0;
+            state->ties = 0;
+        }
+    }
+
+    // Counts digits of keys that match selected digits. The first pass replaces
+    // uniform values by keys.
+    template<bool ComputeKeys>
+    __global__
+    void sampling_histogram_kernel(unsigned int * keys,
+                                   const float * weights,
+                                   const size_t n,
+                                   const sampling_state * state,
+                                   const unsigned int shift,
+                                   const unsigned int bits,
+                                   unsigned long long * histogram)
+    {
+        __shared__ unsigned int block_histogram[sampling_bins];
+
+        const unsigned int thread_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+        const unsigned int bins = 1U << bits;
+
+        for(unsigned int i = hipThreadIdx_x; i < bins; i += hipBlockDim_x)
+        {
+            block_histogram[i] = 0;
+        }
+        __syncthreads();
+
+        const unsigned int threshold = state->threshold;
+        const unsigned int mask = state->mask;
+        for(size_t index = thread_id; index < n; index += stride)
+        {
+            unsigned int key = keys[index];
+            if(ComputeKeys)
+            {
+                key = sampling_key(reinterpret_cast<const float *>(keys)[index], weights[index]);
+                keys[index] = key;
+            }
+            if((key & mask) == threshold)
+            {
+                atomicAdd(&block_histogram[(key >> shift) & (bins - 1)], 1U);
+            }
+        }
+        __syncthreads();
+
+        for(unsigned int i = hipThreadIdx_x; i < bins; i += hipBlockDim_x)
+        {
+            if(block_histogram[i] > 0)
+                atomicAdd(&histogram[i], static_cast<unsigned long long>(block_histogram[i]));
+        }
+    }
+
+    // Selects the digit of the k-th largest key from the histogram and clears it
+    // for the next pass (one block)
+    __global__
+    void sampling_select_kernel(sampling_state * state,
+                                unsigned long long * histogram,
+                                const unsigned int shift,
+                                const unsigned int bits)
+    {
+        const unsigned int bins = 1U << bits;
+        if(hipThreadIdx_x == 0)
+        {
+            unsigned long long remaining = state->remaining;
+            unsigned int digit = bins - 1;
+            while(digit > 0 && histogram[digit] < remaining)
+            {
+                remaining -= histogram[digit];
+                digit--;
+            }
+            state->threshold |= digit << shift;
+            state->mask |= (bins - 1) << shift;
+            state->remaining = remaining;
+        }
+        __syncthreads();
+
+        for(unsigned int i = hipThreadIdx_x; i < bins; i += hipBlockDim_x)
+        {
+            histogram[i] = 0;
+        }
+    }
+
+    // Writes indices of candidates with keys larger than the k-th largest key
+    // and of the remaining number of candidates with keys equal to it
+    __global__
+    void sampling_gather_kernel(const unsigned int * keys,
+                                const size_t n,
+                                sampling_state * state,
+                                unsigned int * output)
+    {
+        const unsigned int thread_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        const unsigned int threshold = state->threshold;
+        const unsigned long long remaining = state->remaining;
+        for(size_t index = thread_id; index < n; index += stride)
+        {
+            const unsigned int key = keys[index];
+            if(key > threshold
+                || (key == threshold && atomicAdd(&state->ties, 1ULL) < remaining))
+            {
+                output[atomicAdd(&state->selected, 1ULL)] = static_cast<unsigned int>(index);
+            }
+        }
+    }
+
+    // Selects k candidates of every row of a CSR graph (one block per row):
+    // the radix selection of 8-bit digits is done in shared memory over
+    // candidates of the row, the first pass replaces uniform values by keys
+    __global__
+    void sampling_csr_kernel(unsigned int * keys,
+                             const float * weights,
+                             const unsigned int * row_offsets,
+                             const size_t rows,
+                             const unsigned int k,
+                             unsigned int * output)
+    {
+        constexpr unsigned int bits = 8;
+        constexpr unsigned int bins = 1 << bits;
+        __shared__ unsigned int histogram[bins];
+        __shared__ unsigned int shared_threshold;
+        __shared__ unsigned int shared_remaining;
+        __shared__ unsigned int selected;
+        __shared__ unsigned int ties;
+
+        for(size_t row = hipBlockIdx_x; row < rows; row += hipGridDim_x)
+        {
+            const unsigned int begin = row_offsets[row];
+            const unsigned int end = row_offsets[row + 1];
+            unsigned int * row_output = output + row * k;
+
+            // All candidates are selected
+            if(end - begin <= k)
+            {
+                for(unsigned int i = hipThreadIdx_x; i < k; i += hipBlockDim_x)
+                {
+                    row_output[i] = i < end - begin ? begin + i : sampling_no_index;
+                }
+                continue;
+            }
+
+            if(hipThreadIdx_x == 0)
+            {
+                shared_threshold = 0;
+                shared_remaining = k;
+                selected = 0;
+                ties = 0;
+            }
+            unsigned int mask = 0;
+            for(int shift = 32 - bits; shift >= 0; shift -= bits)
+            {
+                for(unsigned int i = hipThreadIdx_x; i < bins; i += hipBlockDim_x)
+                {
+                    histogram[i] = 0;
+                }
+                __syncthreads();
+
+                const unsigned int threshold = shared_threshold;
+                for(unsigned int index = begin + hipThreadIdx_x; index < end; index += hipBlockDim_x)
+                {
+                    unsigned int key = keys[index];
+                    if(mask == 0)
+                    {
+                        key = sampling_key(reinterpret_cast<const float *>(keys)[index], weights[index]);
+                        keys[index] = key;
+                    }
+                    if((key & mask) == threshold)
+                    {
+                        atomicAdd(&histogram[(key >> shift) & (bins - 1)], 1U);
+                    }
+                }
+                __syncthreads();
+
+                if(hipThreadIdx_x == 0)
+                {
+                    unsigned int remaining = shared_remaining;
+                    unsigned int digit = bins - 1;
+                    while(digit > 0 && histogram[digit] < remaining)
+                    {
+                        remaining -= histogram[digit];
+                        digit--;
+                    }
+                    shared_threshold = threshold | (digit << shift);
+                    shared_remaining = remaining;
+                }
+                mask |= (bins - 1) << shift;
+                __syncthreads();
+            }
+
+            const unsigned int threshold = shared_threshold;
+            const unsigned int remaining = shared_remaining;
+            for(unsigned int index = begin + hipThreadIdx_x; index < end; index += hipBlockDim_x)
+            {
+                const unsigned int key = keys[index];
+                if(key > threshold
+                    || (key == threshold && atomicAdd(&ties, 1U) < remaining))
+                {
+                    row_output[atomicAdd(&selected, 1U)] = index;
+                }
+            }
+            __syncthreads();
+        }
+    }
+
+    // Selects indices (offset by first) of k largest keys of candidates
+    // [first, first + n) on the host
+    inline void sample_host(const float * uniforms,
+                            const float * weights,
+                            const unsigned int first,
+                            const size_t n,
+                            const size_t k,
+                            unsigned int * output)
+    {
+        std::vector<std::pair<unsigned int, unsigned int> > keys(n);
+        for(size_t i = 0; i < n; i++)
+        {
+            const unsigned int index = first + static_cast<unsigned int>(i);
+            keys[i] = std::make_pair(sampling_key(uniforms[index], weights[index]), index);
+        }
+        std::nth_element(
+            keys.begin(), keys.begin() + (k - 1), keys.end(),
+            std::greater<std::pair<unsigned int, unsigned int> >()
+        );
+        for(size_t i = 0; i < k; i++)
+        {
+            output[i] = keys[i].second;
+        }
+    }
+
+    inline unsigned int get_sampling_blocks(size_t n)
+    {
+        return static_cast<unsigned int>(std::max<size_t>(
+            1, std::min<size_t>((n + sampling_threads - 1) / sampling_threads, sampling_max_blocks)
+        ));
+    }
+
+    // Selects k of n candidates with weights, uniform values are generated
+    // by generate_uniform(data, size) to a temporary buffer in stream
+    // (host memory for host-side generators)
+    template<class GenerateUniform>
+    rocrand_status sample_without_replacement(hipStream_t stream,
+                                              bool host_side,
+                                              const float * weights,
+                                              size_t n,
+                                              size_t k,
+                                              unsigned int * output,
+                                              GenerateUniform generate_uniform)
+    {
+        if(k > n || n > (1ULL << 32))
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        if(k == 0)
+            return ROCRAND_STATUS_SUCCESS;
+
+        if(host_side)
+        {
+            std::vector<float> uniforms(n);
+            const rocrand_status status = generate_uniform(uniforms.data(), n);
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+            sample_host(uniforms.data(), weights, 0, n, k, output);
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        // Keys, histogram and state share one allocation
+        const size_t keys_bytes = (n * sizeof(unsigned int) + 255) / 256 * 256;
+        const size_t histogram_bytes = sampling_bins * sizeof(unsigned long long);
+        char * buffer;
+        if(device_malloc(&buffer, keys_bytes + histogram_bytes + sizeof(sampling_state), stream)
+            != hipSuccess)
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        unsigned int * keys = reinterpret_cast<unsigned int *>(buffer);
+        unsigned long long * histogram = reinterpret_cast<unsigned long long *>(buffer + keys_bytes);
+        sampling_state * state = reinterpret_cast<sampling_state *>(buffer + keys_bytes + histogram_bytes);
+
+        rocrand_status status = generate_uniform(reinterpret_cast<float *>(keys), n);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            device_free(buffer, stream);
+            return status;
+        }
+
+        const unsigned int blocks = get_sampling_blocks(n);
+        const unsigned long long count = k;
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(sampling_init_kernel),
+            dim3(sampling_bins / sampling_threads), dim3(sampling_threads), 0, stream,
+            state, histogram, count
+        );
+        for(unsigned int pass = 0; pass < sampling_passes; pass++)
+        {
+            const unsigned int shift = sampling_digit_shifts[pass];
+            const unsigned int bits = sampling_digit_bits[pass];
+            if(pass == 0)
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(sampling_histogram_kernel<true>),
+                    dim3(blocks), dim3(sampling_threads), 0, stream,
+                    keys, weights, n, state, shift, bits, histogram
+                );
+            }
+            else
+            {
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(sampling_histogram_kernel<false>),
+                    dim3(blocks), dim3(sampling_threads), 0, stream,
+                    keys, weights, n, state, shift, bits, histogram
+                );
+            }
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(sampling_select_kernel),
+                dim3(1), dim3(sampling_threads), 0, stream,
+                state, histogram, shift, bits
+            );
+        }
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(sampling_gather_kernel),
+            dim3(blocks), dim3(sampling_threads), 0, stream,
+            keys, n, state, output
+        );
+        // Check kernel status
+        status = hipPeekAtLastError() != hipSuccess
+            ? ROCRAND_STATUS_LAUNCH_FAILURE
+            : ROCRAND_STATUS_SUCCESS;
+        device_free(buffer, stream);
+        return status;
+    }
+
+    // Selects k candidates of every one of rows rows of a CSR graph
+    // (candidates of row r are [row_offsets[r], row_offsets[r + 1]),
+    // weights has nnz values)
+    template<class GenerateUniform>
+    rocrand_status sample_without_replacement_csr(hipStream_t stream,
+                                                  bool host_side,
+                                                  const unsigned int * row_offsets,
+                                                  size_t rows,
+                                                  const float * weights,
+                                                  size_t nnz,
+                                                  unsigned int k,
+                                                  unsigned int * output,
+                                                  GenerateUniform generate_uniform)
+    {
+        if(nnz > (1ULL << 32))
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        if(rows == 0 || k == 0)
+            return ROCRAND_STATUS_SUCCESS;
+
+        if(host_side)
+        {
+            std::vector<float> uniforms(nnz);
+            const rocrand_status status = generate_uniform(uniforms.data(), nnz);
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+            for(size_t row = 0; row < rows; row++)
+            {
+                const unsigned int begin = row_offsets[row];
+                const unsigned int size = row_offsets[row + 1] - begin;
+                unsigned int * row_output = output + row * k;
+                if(size <= k)
+                {
+                    for(unsigned int i = 0; i < k; i++)
+                    {
+                        row_output[i] = i < size ? begin + i : sampling_no_index;
+                    }
+                }
+                else
+                {
+                    sample_host(uniforms.data(), weights, begin, size, k, row_output);
+                }
+            }
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        unsigned int * keys;
+        if(device_malloc(&keys, std::max<size_t>(nnz, 1) * sizeof(unsigned int), stream)
+            != hipSuccess)
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        rocrand_status status = nnz == 0
+            ? ROCRAND_STATUS_SUCCESS
+            : generate_uniform(reinterpret_cast<float *>(keys), nnz);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            device_free(keys, stream);
+            return status;
+        }
+
+        const unsigned int blocks = static_cast<unsigned int>(
+            std::min<size_t>(rows, sampling_max_blocks * 4)
+        );
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(sampling_csr_kernel),
+            dim3(blocks), dim3(sampling_threads), 0, stream,
+            keys, weights, row_offsets, rows, k, output
+        );
+        // Check kernel status
+        status = hipPeekAtLastError() != hipSuccess
+            ? ROCRAND_STATUS_LAUNCH_FAILURE
+            : ROCRAND_STATUS_SUCCESS;
+        device_free(keys, stream);
+        return status;
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_SAMPLING_H_
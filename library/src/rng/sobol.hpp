@@ -0,0 +1,1228 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_SOBOL_H_
+#define ROCRAND_RNG_SOBOL_H_
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <vector>
+#include <hip/hip_runtime.h>
+
+#include <rocrand.h>
+#include <rocrand_sobol_precomputed.h>
+#include <rocrand_sobol64_precomputed.h>
+#include <rocrand_scrambled_sobol_precomputed.h>
+
+#include "common.hpp"
+#include "generator_type.hpp"
+#include "device_engines.hpp"
+#include "distributions.hpp"
+#include "brownian_bridge.hpp"
+#include "device_tables.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+    // Properties of Sobol generators: type of direction vectors and generated
+    // values, type of offsets, device engine and precomputed tables.
+    template<rocrand_rng_type RngType>
+    struct sobol_traits;
+
+    template<>
+    struct sobol_traits<ROCRAND_RNG_QUASI_SOBOL32>
+    {
+        typedef unsigned int constant_type;
+        typedef unsigned int offset_type;
+        typedef ::rocrand_device::sobol32_engine<true> engine_type;
+
+        static constexpr unsigned int bits = 32;
+        static constexpr unsigned int max_dimensions = SOBOL_DIM;
+        // Dimensions per block of generate_tiled_kernel (4 KB of direction vectors)
+        static constexpr unsigned int tile_dimensions = 32;
+        static constexpr bool is_scrambled = false;
+
+        static const constant_type * direction_vectors()
+        {
+            return h_sobol32_direction_vectors;
+        }
+
+        static const constant_type * scramble_constants()
+        {
+            return NULL;
+        }
+
+        __forceinline__ __device__ __host__
+        static engine_type create_engine(const constant_type * vectors,
+                                         const constant_type scramble_constant,
+                                         const offset_type offset)
+        {
+            (void) scramble_constant;
+            return engine_type(vectors, offset);
+        }
+    };
+
+    template<>
+    struct sobol_traits<ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32>
+    {
+        typedef unsigned int constant_type;
+        typedef unsigned int offset_type;
+        typedef ::rocrand_device::scrambled_sobol32_engine<true> engine_type;
+
+        static constexpr unsigned int bits = 32;
+        static constexpr unsigned int max_dimensions = SOBOL_DIM;
+        // Dimensions per block of generate_tiled_kernel (4 KB of direction vectors)
+        static constexpr unsigned int tile_dimensions = 32;
+        static constexpr bool is_scrambled = true;
+
+        static const constant_type * direction_vectors()
+        {
+            return h_sobol32_direction_vectors;
+        }
+
+        static const constant_type * scramble_constants()
+        {
+            return h_scrambled_sobol32_constants;
+        }
+
+        __forceinline__ __device__ __host__
+        static engine_type create_engine(const constant_type * vectors,
+                                         const constant_type scramble_constant,
+                                         const offset_type offset)
+        {
+            return engine_type(vectors, scramble_constant, offset);
+        }
+    };
+
+    template<>
+    struct sobol_traits<ROCRAND_RNG_QUASI_SOBOL64>
+    {
+        typedef unsigned long long constant_type;
+        typedef unsigned long long offset_type;
+        typedef ::rocrand_device::sobol64_engine<true> engine_type;
+
+        static constexpr unsigned int bits = 64;
+        static constexpr unsigned int max_dimensions = SOBOL64_DIM;
+        // Dimensions per block of generate_tiled_kernel (4 KB of direction vectors)
+        static constexpr unsigned int tile_dimensions = 8;
+        static constexpr bool is_scrambled = false;
+
+        static const constant_type * direction_vectors()
+        {
+            return h_sobol64_direction_vectors;
+        }
+
+        static const constant_type * scramble_constants()
+        {
+            return NULL;
+        }
+
+        __forceinline__ __device__ __host__
+        static engine_type create_engine(const constant_type * vectors,
+                                         const constant_type scramble_constant,
+                                         const offset_type offset)
+        {
+            (void) scramble_constant;
+            return engine_type(vectors, offset);
+        }
+    };
+
+    template<>
+    struct sobol_traits<ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64>
+    {
+        typedef unsigned long long constant_type;
+        typedef unsigned long long offset_type;
+        typedef ::rocrand_device::scrambled_sobol64_engine<true> engine_type;
+
+        static constexpr unsigned int bits = 64;
+        static constexpr unsigned int max_dimensions = SOBOL64_DIM;
+        // Dimensions per block of generate_tiled_kernel (4 KB of direction vectors)
+        static constexpr unsigned int tile_dimensions = 8;
+        static constexpr bool is_scrambled = true;
+
+        static const constant_type * direction_vectors()
+        {
+            return h_sobol64_direction_vectors;
+        }
+
+        static const constant_type * scramble_constants()
+        {
+            return h_scrambled_sobol64_constants;
+        }
+
+        __forceinline__ __device__ __host__
+        static engine_type create_engine(const constant_type * vectors,
+                                         const constant_type scramble_constant,
+                                         const offset_type offset)
+        {
+            return engine_type(vectors, scramble_constant, offset);
+        }
+    };
+
+    // Work of one thread of generate_kernel for one dimension. Host-side
+    // generators call it for all threads, so they produce the same sequences
+    // as the kernel.
+    template<unsigned int OutputPerThread, class Traits, class T, class Distribution>
+    __forceinline__ __device__ __host__
+    void generate_thread(T * data, const size_t n,
+                         const typename Traits::constant_type * vectors,
+                         const typename Traits::constant_type scramble_constant,
+                         const typename Traits::offset_type offset,
+                         const unsigned int engine_id,
+                         const unsigned int stride,
+                         Distribution distribution,
+                         const bool streaming = false)
+    {
+        typedef typename Traits::engine_type engine_type;
+        constexpr unsigned int output_per_thread = OutputPerThread;
+        using vec_type = aligned_vec_type<T, output_per_thread>;
+
+        size_t index = engine_id;
+
+        // All distributions generate one output from one input
+        // Generation of, for example, 2 shorts from 1 uint or
+        // 2 floats from 2 uints using Box-Muller transformation
+        // is impossible because the resulting sequence is not
+        // quasi-random anymore.
+
+        if(output_per_thread == 1)
+        {
+            const unsigned int engine_offset = engine_id * output_per_thread;
+            engine_type engine =
+                Traits::create_engine(vectors, scramble_constant, offset + engine_offset);
+
+            while(index < n)
+            {
+                data[index] = distribution(engine.current());
+                engine.discard_stride(stride);
+                index += stride;
+            }
+        }
+        else
+        {
+            const uintptr_t uintptr = reinterpret_cast<uintptr_t>(data);
+            const size_t misalignment =
+                (
+                    output_per_thread - uintptr / sizeof(T) % output_per_thread
+                ) % output_per_thread;
+            const unsigned int head_size = n < misalignment ? n : misalignment;
+            const unsigned int tail_size = (n - head_size) % output_per_thread;
+            const size_t vec_n = (n - head_size) / output_per_thread;
+
+            const unsigned int engine_offset =
+                engine_id * output_per_thread +
+                (engine_id == 0 ? 0 : head_size); // The first engine writes head_size values
+            engine_type engine =
+                Traits::create_engine(vectors, scramble_constant, offset + engine_offset);
+
+            if(engine_id == 0)
+            {
+                // If data is not aligned by sizeof(vec_type)
+                for(unsigned int o = 0; o < head_size; o++)
+                {
+                    data[o] = distribution(engine.current());
+                    engine.discard();
+                }
+            }
+
+            vec_type * vec_data = reinterpret_cast<vec_type *>(data + misalignment);
+            while(index < vec_n)
+            {
+                engine_type engine_copy = engine;
+
+                T output[output_per_thread];
+                for(unsigned int i = 0; i < output_per_thread; i++)
+                {
+                    output[i] = distribution(engine.current());
+                    engine.discard();
+                }
+
+                store_vec(vec_data + index, *reinterpret_cast<vec_type *>(output), streaming);
+
+                // Restore from a copy and use fast discard_stride
+                engine = engine_copy;
+                engine.discard_stride(stride * output_per_thread);
+                index += stride;
+            }
+
+            if(index == vec_n)
+            {
+                // Fill tail values (up to output_per_thread-1)
+                for(unsigned int o = 0; o < tail_size; o++)
+                {
+                    data[n - tail_size + o] = distribution(engine.current());
+                    engine.discard();
+                }
+            }
+        }
+    }
+
+    template<unsigned int OutputPerThread, class Traits, class T, class Distribution>
+    __global__
+    void generate_kernel(T * data, const size_t n,
+                         const typename Traits::constant_type * direction_vectors,
+                         const typename Traits::constant_type * scramble_constants,
+                         const typename Traits::offset_type offset,
+                         Distribution distribution,
+                         const bool streaming)
+    {
+        typedef typename Traits::constant_type constant_type;
+        constexpr unsigned int bits = Traits::bits;
+
+        const unsigned int dimension = hipBlockIdx_y;
+        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        // Each thread of the current block use the same direction vectors
+        // (the dimension is determined by hipBlockIdx_y)
+        __shared__ constant_type vectors[bits];
+        if (hipThreadIdx_x < bits)
+        {
+            vectors[hipThreadIdx_x] = direction_vectors[dimension * bits + hipThreadIdx_x];
+        }
+        __syncthreads();
+
+        const constant_type scramble_constant =
+            Traits::is_scrambled ? scramble_constants[dimension] : 0;
+        generate_thread<OutputPerThread, Traits>(
+            data + dimension * n, n, vectors, scramble_constant, offset,
+            engine_id, stride, distribution, streaming
+        );
+    }
+
+    // Generates values of one dimension for points engine_id, engine_id + stride, ...
+    // and stores them dimension-major (all points of a dimension are contiguous)
+    // or interleaved (all dimensions of a point are contiguous).
+    template<class Traits, class T, class Distribution>
+    __forceinline__ __device__ __host__
+    void generate_strided_thread(T * data, const size_t n,
+                                 const unsigned int dimensions,
+                                 const unsigned int dimension,
+                                 const typename Traits::constant_type * vectors,
+                                 const typename Traits::constant_type scramble_constant,
+                                 const typename Traits::offset_type offset,
+                                 const unsigned int engine_id,
+                                 const unsigned int stride,
+                                 const bool interleaved,
+                                 Distribution distribution)
+    {
+        typedef typename Traits::engine_type engine_type;
+
+        engine_type engine =
+            Traits::create_engine(vectors, scramble_constant, offset + engine_id);
+
+        for(size_t index = engine_id; index < n; index += stride)
+        {
+            const size_t i = interleaved
+                ? index * dimensions + dimension
+                : dimension * n + index;
+            data[i] = distribution(engine.current());
+            engine.discard_stride(stride);
+        }
+    }
+
+    // High-dimensional variant of generate_kernel: every block handles a tile of
+    // tile_dimensions consecutive dimensions (hipBlockIdx_y is the tile index) and
+    // hipBlockDim_x / tile_dimensions points of each of them, so blocks are not
+    // underpopulated when there are many dimensions and few points per dimension.
+    template<class Traits, class T, class Distribution>
+    __global__
+    void generate_tiled_kernel(T * data, const size_t n,
+                               const unsigned int dimensions,
+                               const unsigned int tile_dimensions,
+                               const typename Traits::constant_type * direction_vectors,
+                               const typename Traits::constant_type * scramble_constants,
+                               const typename Traits::offset_type offset,
+                               const bool interleaved,
+                               Distribution distribution)
+    {
+        typedef typename Traits::constant_type constant_type;
+        constexpr unsigned int bits = Traits::bits;
+
+        const unsigned int first_dimension = hipBlockIdx_y * tile_dimensions;
+        const unsigned int points_per_block = hipBlockDim_x / tile_dimensions;
+
+        // Direction vectors of all dimensions of the tile are contiguous
+        __shared__ constant_type vectors[Traits::tile_dimensions * bits];
+        for(unsigned int i = hipThreadIdx_x; i < tile_dimensions * bits; i += hipBlockDim_x)
+        {
+            if(first_dimension + i / bits < dimensions)
+            {
+                vectors[i] = direction_vectors[first_dimension * bits + i];
+            }
+        }
+        __syncthreads();
+
+        // Consecutive threads write consecutive values: dimensions of the same
+        // point for interleaved output, points of the same dimension otherwise
+        const unsigned int tile_dimension = interleaved
+            ? hipThreadIdx_x % tile_dimensions
+            : hipThreadIdx_x / points_per_block;
+        const unsigned int lane = interleaved
+            ? hipThreadIdx_x / tile_dimensions
+            : hipThreadIdx_x % points_per_block;
+        const unsigned int dimension = first_dimension + tile_dimension;
+        if(dimension >= dimensions)
+            return;
+
+        const constant_type scramble_constant =
+            Traits::is_scrambled ? scramble_constants[dimension] : 0;
+        generate_strided_thread<Traits>(
+            data, n, dimensions, dimension,
+            vectors + tile_dimension * bits, scramble_constant, offset,
+            hipBlockIdx_x * points_per_block + lane, hipGridDim_x * points_per_block,
+            interleaved, distribution
+        );
+    }
+
+    // Builds the Brownian path of point (path) of all dimensions: the normal
+    // value of dimension d is the step d of the bridge. W(t[k]) are stored to
+    // the path's row (path-major output), and replaced by increments
+    // W(t[k]) - W(t[k - 1]) when cumulative is false.
+    template<class Traits, class Distribution>
+    __forceinline__ __device__ __host__
+    void generate_brownian_path(float * data, const size_t path, const unsigned int steps,
+                                const typename Traits::constant_type * direction_vectors,
+                                const typename Traits::constant_type * scramble_constants,
+                                const typename Traits::offset_type offset,
+                                const brownian_bridge_step * bridge,
+                                const bool cumulative,
+                                Distribution distribution)
+    {
+        typedef typename Traits::engine_type engine_type;
+        constexpr unsigned int bits = Traits::bits;
+
+        float * row = data + path * steps;
+        for(unsigned int d = 0; d < steps; d++)
+        {
+            const typename Traits::constant_type scramble_constant =
+                Traits::is_scrambled ? scramble_constants[d] : 0;
+            engine_type engine = Traits::create_engine(
+                direction_vectors + d * bits, scramble_constant, offset + path
+            );
+            const brownian_bridge_step step = bridge[d];
+            float w = step.stddev * distribution(engine.current());
+            if(step.left != 0)
+                w += step.left_weight * row[step.left - 1];
+            if(step.right != 0)
+                w += step.right_weight * row[step.right - 1];
+            row[step.index - 1] = w;
+        }
+        if(!cumulative)
+        {
+            for(unsigned int k = steps - 1; k > 0; k--)
+            {
+                row[k] -= row[k - 1];
+            }
+        }
+    }
+
+    template<class Traits, class Distribution>
+    __global__
+    void generate_brownian_paths_kernel(float * data, const size_t paths, const unsigned int steps,
+                                        const typename Traits::constant_type * direction_vectors,
+                                        const typename Traits::constant_type * scramble_constants,
+                                        const typename Traits::offset_type offset,
+                                        const brownian_bridge_step * bridge,
+                                        const bool cumulative,
+                                        Distribution distribution)
+    {
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+        for(size_t path = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+            path < paths; path += stride)
+        {
+            generate_brownian_path<Traits>(
+                data, path, steps, direction_vectors, scramble_constants, offset,
+                bridge, cumulative, distribution
+            );
+        }
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+// Sobol quasi-random generators: SOBOL32, SCRAMBLED_SOBOL32, SOBOL64 and
+// SCRAMBLED_SOBOL64. Scrambled generators XOR all values of a dimension with
+// the dimension's scramble constant (random digital shift).
+template<rocrand_rng_type RngType>
+class rocrand_sobol : public rocrand_generator_type<RngType>
+{
+public:
+    using base_type = rocrand_generator_type<RngType>;
+    using traits_type = ::rocrand_host::detail::sobol_traits<RngType>;
+    using engine_type = typename traits_type::engine_type;
+    using constant_type = typename traits_type::constant_type;
+    using offset_type = typename traits_type::offset_type;
+
+    rocrand_sobol(unsigned long long offset = 0,
+                  hipStream_t stream = 0,
+                  bool host_side = false)
+        : base_type(0, offset, stream, host_side),
+          m_initialized(false),
+          m_dimensions(1),
+          m_ordering(ROCRAND_ORDERING_QUASI_DEFAULT),
+          m_direction_vectors(NULL), m_scramble_constants(NULL),
+          m_max_blocks(s_default_max_blocks), m_threads(s_default_threads),
+          m_bridge(NULL), m_bridge_capacity(0)
+    {
+        const size_t vectors_size = static_cast<size_t>(s_max_dimensions) * s_bits;
+        const size_t constants_size = traits_type::is_scrambled ? s_max_dimensions : 0;
+        m_poisson.set_stats(&m_stats);
+        m_poisson_host.set_stats(&m_stats);
+        if(m_host_side)
+        {
+            // Host generators read the static tables directly
+            m_direction_vectors = traits_type::direction_vectors();
+            m_scramble_constants = traits_type::scramble_constants();
+            return;
+        }
+        // Direction vectors and scramble constants are shared by all
+        // generators of the device, they are copied only by the first one
+        bool uploaded;
+        hipError_t error;
+        error = rocrand_host::detail::acquire_device_table(
+            &m_direction_vectors, traits_type::direction_vectors(), vectors_size, m_stream, &uploaded
+        );
+        if(error != hipSuccess)
+        {
+            throw ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        if(uploaded)
+        {
+            m_stats.device_bytes_allocated += sizeof(constant_type) * vectors_size;
+        }
+        if(traits_type::is_scrambled)
+        {
+            error = rocrand_host::detail::acquire_device_table(
+                &m_scramble_constants, traits_type::scramble_constants(), constants_size, m_stream, &uploaded
+            );
+            if(error != hipSuccess)
+            {
+                rocrand_host::detail::release_device_table(m_direction_vectors, m_stream);
+                throw ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            if(uploaded)
+            {
+                m_stats.device_bytes_allocated += sizeof(constant_type) * constants_size;
+            }
+        }
+    }
+
+    ~rocrand_sobol()
+    {
+        if(!m_host_side)
+        {
+            rocrand_host::detail::release_device_table(m_direction_vectors, m_stream);
+            rocrand_host::detail::release_device_table(m_scramble_constants, m_stream);
+            rocrand_host::detail::device_free(m_bridge, m_stream);
+        }
+    }
+
+    void reset()
+    {
+        m_initialized = false;
+    }
+
+    void set_offset(unsigned long long offset)
+    {
+        m_offset = offset;
+        m_initialized = false;
+    }
+
+    rocrand_status set_dimensions(unsigned int dimensions)
+    {
+        if(dimensions < 1 || dimensions > s_max_dimensions)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+
+        m_dimensions = dimensions;
+        m_initialized = false;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Sets the layout of generated values: ROCRAND_ORDERING_QUASI_DEFAULT stores
+    /// all points of a dimension contiguously, ROCRAND_ORDERING_QUASI_INTERLEAVED
+    /// stores all dimensions of a point contiguously. Does not change the sequences.
+    rocrand_status set_ordering(rocrand_ordering ordering)
+    {
+        if(ordering == ROCRAND_ORDERING_PSEUDO_DEFAULT
+            || ordering == ROCRAND_ORDERING_PSEUDO_SEEDED
+            || ordering == ROCRAND_ORDERING_PSEUDO_DYNAMIC)
+        {
+            return ROCRAND_STATUS_TYPE_ERROR;
+        }
+        if(ordering != ROCRAND_ORDERING_QUASI_DEFAULT
+            && ordering != ROCRAND_ORDERING_QUASI_INTERLEAVED)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+
+        m_ordering = ordering;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    unsigned int get_dimensions() const
+    {
+        return m_dimensions;
+    }
+
+    rocrand_ordering get_ordering() const
+    {
+        return m_ordering;
+    }
+
+    /// Changes launch configuration: at most \p blocks blocks of \p threads threads
+    /// are launched, \p threads must be a power of 2 not less than the number of
+    /// direction vectors of a dimension (32 or 64). Generated sequences do not depend
+    /// on launch configuration. When both are 0, the maximum number of blocks is
+    /// computed from occupancy of the current device.
+    rocrand_status set_launch_config(unsigned int blocks, unsigned int threads)
+    {
+        const bool automatic = blocks == 0 && threads == 0;
+        if(automatic)
+        {
+            threads = s_default_threads;
+            blocks = s_default_max_blocks;
+            if(!m_host_side)
+            {
+                void (*kernel)(unsigned int *, const size_t,
+                               const constant_type *, const constant_type *,
+                               const offset_type,
+                               sobol_uniform_distribution<unsigned int>, const bool) =
+                    rocrand_host::detail::generate_kernel<
+                        1, traits_type, unsigned int, sobol_uniform_distribution<unsigned int>
+                    >;
+                rocrand_status status = rocrand_host::detail::get_occupancy_blocks(
+                    kernel, threads, blocks
+                );
+                if(status != ROCRAND_STATUS_SUCCESS)
+                    return status;
+            }
+        }
+        // All direction vectors of a dimension are loaded by the first threads
+        // of a block, and tiles of dimensions split power of 2 blocks evenly
+        if(blocks == 0 || threads < s_bits || threads > s_max_threads
+            || (threads & (threads - 1)) != 0)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        m_max_blocks = blocks;
+        m_threads = threads;
+        m_auto_launch_config = automatic;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    void get_launch_config(unsigned int * blocks, unsigned int * threads) const
+    {
+        *blocks = m_max_blocks;
+        *threads = m_threads;
+    }
+
+    rocrand_status init()
+    {
+        if (m_initialized)
+            return ROCRAND_STATUS_SUCCESS;
+
+        count_init();
+        m_current_offset = static_cast<offset_type>(m_offset);
+        m_initialized = true;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Returns size of device memory of the Brownian bridge and Poisson tables
+    /// (rocrand_get_memory_usage()), shared direction vectors are not counted
+    size_t get_memory_usage() const
+    {
+        return sizeof(rocrand_host::detail::brownian_bridge_step) * m_bridge_capacity
+            + m_poisson.device_bytes();
+    }
+
+    /// Frees device memory of the Brownian bridge and Poisson tables
+    /// (rocrand_generator_trim()), they are built again when needed
+    rocrand_status trim()
+    {
+        if(!m_host_side)
+        {
+            rocrand_host::detail::device_free(m_bridge, m_stream);
+            m_bridge = NULL;
+            m_bridge_capacity = 0;
+            m_bridge_times.clear();
+        }
+        m_poisson.clear();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Returns size in bytes of the data written by save()
+    size_t get_save_size() const
+    {
+        return sizeof(save_data);
+    }
+
+    /// Writes offset, dimensions, ordering, launch configuration and the current
+    /// position in the sequence to host memory \p data
+    rocrand_status save(void * data)
+    {
+        rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        const save_data header = {
+            m_offset, m_dimensions, static_cast<unsigned int>(m_ordering),
+            m_current_offset, m_max_blocks, m_threads, m_auto_launch_config ? 1U : 0U
+        };
+        std::memcpy(data, &header, sizeof(save_data));
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Restores the generator from \p data of \p size bytes written by save()
+    rocrand_status load(const void * data, size_t size)
+    {
+        if(size != sizeof(save_data))
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        save_data header;
+        std::memcpy(&header, data, sizeof(save_data));
+        if(header.max_blocks == 0 || header.dimensions < 1 || header.dimensions > s_max_dimensions)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        if(header.ordering != ROCRAND_ORDERING_QUASI_DEFAULT
+            && header.ordering != ROCRAND_ORDERING_QUASI_INTERLEAVED)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        rocrand_status status = set_launch_config(header.max_blocks, header.threads);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        m_auto_launch_config = header.auto_launch_config != 0;
+        m_offset = header.offset;
+        m_dimensions = header.dimensions;
+        m_ordering = static_cast<rocrand_ordering>(header.ordering);
+        m_current_offset = header.current_offset;
+        m_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T, class Distribution = sobol_uniform_distribution<T> >
+    rocrand_status generate(T * data, size_t data_size,
+                        Distribution distribution = Distribution())
+    {
+        constexpr unsigned int output_per_thread =
+            sizeof(T) >= sizeof(int) ? 1 : sizeof(int) / sizeof(T);
+
+        if (data_size % m_dimensions != 0)
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        rocrand_host::detail::profiling_range range("rocrand generate_kernel");
+        count_generate(data_size);
+
+        // Sequences do not depend on the launch configuration, the tuned one
+        // is used if the library chooses it
+        unsigned int tuned_blocks;
+        unsigned int tuned_threads;
+        if(this->template get_tuned_launch_config<T>(data_size, tuned_blocks, tuned_threads))
+        {
+            set_launch_config(tuned_blocks, tuned_threads);
+            m_auto_launch_config = true;
+        }
+
+        const uint32_t threads = m_threads;
+        const uint32_t max_blocks = m_max_blocks;
+
+        const size_t size = data_size / m_dimensions;
+
+        // Interleaved output and many dimensions with too few points to fill
+        // a block of one dimension are handled by blocks of several dimensions
+        if(m_ordering == ROCRAND_ORDERING_QUASI_INTERLEAVED
+            || (m_dimensions > 1 && size * 2 <= threads))
+        {
+            return generate_tiled(data, size, distribution);
+        }
+
+        const uint32_t output_per_block = threads * output_per_thread;
+        const uint32_t blocks = std::min(
+            max_blocks,
+            static_cast<uint32_t>((size + output_per_block - 1) / output_per_block)
+        );
+
+        const uint32_t blocks_x = (blocks + m_dimensions - 1) / m_dimensions;
+        const uint32_t blocks_y = m_dimensions;
+
+        if(m_host_side)
+        {
+            const constant_type * direction_vectors = m_direction_vectors;
+            const constant_type * scramble_constants = m_scramble_constants;
+            const offset_type offset = m_current_offset;
+            const unsigned int stride = blocks_x * threads;
+            rocrand_host::detail::host_parallel_for(
+                static_cast<size_t>(stride) * blocks_y,
+                [=](size_t thread_id)
+                {
+                    const unsigned int dimension = thread_id / stride;
+                    const constant_type scramble_constant =
+                        traits_type::is_scrambled ? scramble_constants[dimension] : 0;
+                    rocrand_host::detail::generate_thread<output_per_thread, traits_type>(
+                        data + dimension * size, size,
+                        direction_vectors + dimension * s_bits, scramble_constant, offset,
+                        thread_id % stride, stride,
+                        distribution
+                    );
+                }
+            );
+            m_current_offset += size;
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel<output_per_thread, traits_type>),
+            dim3(blocks_x, blocks_y), dim3(threads), 0, m_stream,
+            data, size,
+            static_cast<const constant_type*>(m_direction_vectors),
+            static_cast<const constant_type*>(m_scramble_constants),
+            m_current_offset,
+            distribution, streaming_stores()
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_current_offset += size;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_uniform(T * data, size_t data_size)
+    {
+        sobol_uniform_distribution<T> distribution;
+        return generate(data, data_size, distribution);
+    }
+
+    /// Generates \p data_size integers in [\p lo, \p lo + \p range)
+    template<class T>
+    rocrand_status generate_uniform_range(T * data, size_t data_size, T lo, T range)
+    {
+        sobol_uniform_range_distribution<T> distribution(lo, range);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        sobol_normal_distribution<T> distribution(mean, stddev, fast_math());
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        sobol_log_normal_distribution<T> distribution(mean, stddev, fast_math());
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T * data, size_t data_size, T lambda)
+    {
+        sobol_exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    /// Generates points [\p begin, \p end) of all dimensions of a generate() call
+    /// producing \p n points per dimension, and advances the position in the sequence
+    /// as that call does. \p data receives (\p end - \p begin) points of every dimension.
+    /// Used by multi-device generators.
+    template<class T, class Distribution = sobol_uniform_distribution<T> >
+    rocrand_status generate_slice(T * data, size_t n, size_t begin, size_t end,
+                                  Distribution distribution = Distribution())
+    {
+        if(begin > end || end > n)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        const offset_type offset = m_current_offset;
+        if(end > begin)
+        {
+            m_current_offset += begin;
+            status = generate(data, (end - begin) * m_dimensions, distribution);
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                m_current_offset = offset;
+                return status;
+            }
+        }
+        m_current_offset = offset + n;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_slice(T * data, size_t n, size_t begin, size_t end)
+    {
+        sobol_uniform_distribution<T> distribution;
+        return generate_slice(data, n, begin, end, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_normal_slice(T * data, size_t n, size_t begin, size_t end,
+                                         T mean, T stddev)
+    {
+        sobol_normal_distribution<T> distribution(mean, stddev, fast_math());
+        return generate_slice(data, n, begin, end, distribution);
+    }
+
+    /// Generates \p paths Brownian paths of \p steps times \p times (rocrand_generate_brownian_paths()),
+    /// the generator must have \p steps dimensions. Advances the position in the sequence
+    /// by \p paths points as generate_normal() of all dimensions does.
+    rocrand_status generate_brownian_paths(float * data, size_t paths,
+                                           const float * times, unsigned int steps,
+                                           bool cumulative)
+    {
+        if(data == NULL || steps != m_dimensions)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+
+        rocrand_status status = set_bridge(times, steps);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        rocrand_host::detail::profiling_range range("rocrand generate_brownian_paths_kernel");
+        count_generate(paths * steps);
+
+        sobol_normal_distribution<float> distribution(0.0f, 1.0f, fast_math());
+        const offset_type offset = m_current_offset;
+        if(m_host_side)
+        {
+            const constant_type * direction_vectors = m_direction_vectors;
+            const constant_type * scramble_constants = m_scramble_constants;
+            const rocrand_host::detail::brownian_bridge_step * bridge = m_bridge_host.data();
+            rocrand_host::detail::host_parallel_for(
+                paths,
+                [=](size_t path)
+                {
+                    rocrand_host::detail::generate_brownian_path<traits_type>(
+                        data, path, steps, direction_vectors, scramble_constants, offset,
+                        bridge, cumulative, distribution
+                    );
+                }
+            );
+            m_current_offset += paths;
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        const uint32_t threads = m_threads;
+        const uint32_t blocks = std::max<size_t>(1, std::min<size_t>(
+            m_max_blocks, (paths + threads - 1) / threads
+        ));
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_brownian_paths_kernel<traits_type>),
+            dim3(blocks), dim3(threads), 0, m_stream,
+            data, paths, steps,
+            static_cast<const constant_type*>(m_direction_vectors),
+            static_cast<const constant_type*>(m_scramble_constants),
+            offset,
+            static_cast<const rocrand_host::detail::brownian_bridge_step*>(m_bridge),
+            cumulative, distribution
+        );
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_current_offset += paths;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Sets the maximum number of lambdas whose Poisson tables are cached
+    rocrand_status set_poisson_cache_capacity(size_t capacity)
+    {
+        if(capacity == 0)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        m_poisson.set_capacity(capacity);
+        m_poisson_host.set_capacity(capacity);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Computes and caches Poisson tables for \p count lambdas
+    rocrand_status prepare_poisson(const double * lambdas, size_t count)
+    {
+        for(size_t i = 0; i < count; i++)
+        {
+            try
+            {
+                if(m_host_side)
+                {
+                    m_poisson_host.set_lambda(lambdas[i]);
+                }
+                else
+                {
+                    m_poisson.set_lambda(lambdas[i], m_stream);
+                }
+            }
+            catch(rocrand_status status)
+            {
+                return status;
+            }
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
+    {
+        try
+        {
+            if(m_host_side)
+            {
+                m_poisson_host.set_lambda(lambda);
+            }
+            else
+            {
+                m_poisson.set_lambda(lambda, m_stream);
+            }
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        if(m_host_side)
+        {
+            return generate(data, data_size, m_poisson_host.dis);
+        }
+        return generate(data, data_size, m_poisson.dis);
+    }
+
+    /// Generates \p data_size values of the discrete distribution with tables
+    /// \p tables in device memory (copied to the host for host-side generators)
+    rocrand_status generate_discrete(unsigned int * data, size_t data_size,
+                                     const rocrand_discrete_distribution_st& tables)
+    {
+        if(m_host_side)
+        {
+            rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_CDF, true> distribution;
+            try
+            {
+                distribution.init_from_device(tables);
+            }
+            catch(rocrand_status status)
+            {
+                distribution.deallocate();
+                return status;
+            }
+            const rocrand_status status = generate(data, data_size, distribution);
+            distribution.deallocate();
+            return status;
+        }
+        rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_CDF> distribution(tables);
+        return generate(data, data_size, distribution);
+    }
+
+private:
+    // Generator data written by save()
+    struct save_data
+    {
+        unsigned long long offset;
+        unsigned int dimensions;
+        unsigned int ordering;
+        offset_type current_offset;
+        unsigned int max_blocks;
+        unsigned int threads;
+        // Whether the library chose the launch configuration (m_auto_launch_config)
+        unsigned int auto_launch_config;
+    };
+
+    using base_type::m_offset;
+    using base_type::m_stream;
+    using base_type::m_host_side;
+    using base_type::m_stats;
+    using base_type::m_auto_launch_config;
+    using base_type::count_generate;
+    using base_type::count_init;
+    using base_type::streaming_stores;
+    using base_type::fast_math;
+
+    bool m_initialized;
+    unsigned int m_dimensions;
+    rocrand_ordering m_ordering;
+    offset_type m_current_offset;
+    // Shared device tables (see device_tables.hpp) or the static host tables
+    const constant_type * m_direction_vectors;
+    const constant_type * m_scramble_constants;
+    unsigned int m_max_blocks;
+    unsigned int m_threads;
+
+    // Brownian bridge of the last time grid of generate_brownian_paths(),
+    // device generators keep a copy in device memory
+    std::vector<float> m_bridge_times;
+    std::vector<rocrand_host::detail::brownian_bridge_step> m_bridge_host;
+    rocrand_host::detail::brownian_bridge_step * m_bridge;
+    size_t m_bridge_capacity;
+
+    static const uint32_t s_default_threads = 256;
+    static const uint32_t s_default_max_blocks = 4096;
+    static const uint32_t s_max_threads = 1024;
+    static const uint32_t s_bits = traits_type::bits;
+    static const uint32_t s_max_dimensions = traits_type::max_dimensions;
+    static const uint32_t s_tile_dimensions = traits_type::tile_dimensions;
+
+    // For caching of Poisson for consecutive generations with the same lambda
+    poisson_distribution_manager<ROCRAND_DISCRETE_METHOD_CDF> m_poisson;
+    poisson_distribution_manager<ROCRAND_DISCRETE_METHOD_CDF, true> m_poisson_host;
+
+    // Builds the bridge of times unless it is the bridge of the previous call
+    rocrand_status set_bridge(const float * times, unsigned int steps)
+    {
+        if(times == NULL)
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        if(m_bridge_times.size() == steps
+            && std::equal(m_bridge_times.begin(), m_bridge_times.end(), times))
+            return ROCRAND_STATUS_SUCCESS;
+
+        m_bridge_times.clear();
+        rocrand_status status =
+            rocrand_host::detail::build_brownian_bridge(times, steps, m_bridge_host);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+        if(m_host_side)
+        {
+            m_bridge_times.assign(times, times + steps);
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        // Kernels of previous calls may still read the bridge
+        if(hipStreamSynchronize(m_stream) != hipSuccess)
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        if(m_bridge_capacity < steps)
+        {
+            rocrand_host::detail::device_free(m_bridge, m_stream);
+            m_bridge = NULL;
+            m_bridge_capacity = 0;
+            if(rocrand_host::detail::device_malloc(
+                &m_bridge, sizeof(rocrand_host::detail::brownian_bridge_step) * steps, m_stream
+            ) != hipSuccess)
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            m_bridge_capacity = steps;
+            m_stats.device_bytes_allocated += sizeof(rocrand_host::detail::brownian_bridge_step) * steps;
+        }
+        if(hipMemcpy(m_bridge, m_bridge_host.data(),
+                     sizeof(rocrand_host::detail::brownian_bridge_step) * steps,
+                     hipMemcpyHostToDevice) != hipSuccess)
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        m_bridge_times.assign(times, times + steps);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    size_t next_power2(size_t x)
+    {
+        size_t power = 1;
+        while (power < x)
+        {
+            power *= 2;
+        }
+        return power;
+    }
+
+    // Generates size points of all dimensions with generate_tiled_kernel
+    template<class T, class Distribution>
+    rocrand_status generate_tiled(T * data, size_t size, Distribution distribution)
+    {
+        const bool interleaved = m_ordering == ROCRAND_ORDERING_QUASI_INTERLEAVED;
+        const uint32_t threads = m_threads;
+
+        // Tiles of dimension-major output contain enough dimensions to fill
+        // a block with points, interleaved output uses full tiles to write
+        // the dimensions of a point with consecutive threads
+        size_t tile_dimensions = next_power2(m_dimensions);
+        if(tile_dimensions > s_tile_dimensions)
+            tile_dimensions = s_tile_dimensions;
+        if(!interleaved)
+            tile_dimensions = std::min(tile_dimensions, std::max<size_t>(1, threads / next_power2(size)));
+
+        const uint32_t points_per_block = threads / tile_dimensions;
+        const uint32_t blocks_y = (m_dimensions + tile_dimensions - 1) / tile_dimensions;
+        const uint32_t blocks_x = std::min(
+            (size + points_per_block - 1) / points_per_block,
+            std::max<size_t>(1, m_max_blocks / blocks_y)
+        );
+
+        if(m_host_side)
+        {
+            const constant_type * direction_vectors = m_direction_vectors;
+            const constant_type * scramble_constants = m_scramble_constants;
+            const offset_type offset = m_current_offset;
+            const unsigned int dimensions = m_dimensions;
+            const unsigned int stride = blocks_x * points_per_block;
+            rocrand_host::detail::host_parallel_for(
+                static_cast<size_t>(stride) * dimensions,
+                [=](size_t thread_id)
+                {
+                    const unsigned int dimension = thread_id / stride;
+                    const constant_type scramble_constant =
+                        traits_type::is_scrambled ? scramble_constants[dimension] : 0;
+                    rocrand_host::detail::generate_strided_thread<traits_type>(
+                        data, size, dimensions, dimension,
+                        direction_vectors + dimension * s_bits, scramble_constant, offset,
+                        thread_id % stride, stride, interleaved,
+                        distribution
+                    );
+                }
+            );
+            m_current_offset += size;
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_tiled_kernel<traits_type>),
+            dim3(blocks_x, blocks_y), dim3(threads), 0, m_stream,
+            data, size, m_dimensions, static_cast<unsigned int>(tile_dimensions),
+            static_cast<const constant_type*>(m_direction_vectors),
+            static_cast<const constant_type*>(m_scramble_constants),
+            m_current_offset, interleaved,
+            distribution
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_current_offset += size;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+};
+
+// Disabled engines are replaced in generators.hpp
+#ifndef ROCRAND_DISABLE_SOBOL32
+typedef rocrand_sobol<ROCRAND_RNG_QUASI_SOBOL32> rocrand_sobol32;
+#endif
+#ifndef ROCRAND_DISABLE_SCRAMBLED_SOBOL32
+typedef rocrand_sobol<ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32> rocrand_scrambled_sobol32;
+#endif
+#ifndef ROCRAND_DISABLE_SOBOL64
+typedef rocrand_sobol<ROCRAND_RNG_QUASI_SOBOL64> rocrand_sobol64;
+#endif
+#ifndef ROCRAND_DISABLE_SCRAMBLED_SOBOL64
+typedef rocrand_sobol<ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64> rocrand_scrambled_sobol64;
+#endif
+
+#endif // ROCRAND_RNG_SOBOL_H_
@@ -0,0 +1,257 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_STREAM_PRODUCER_H_
+#define ROCRAND_RNG_STREAM_PRODUCER_H_
+
+#include <algorithm>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "device_engines.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+    // Counters of a ring buffer in device memory
+    struct stream_counters
+    {
+        // Number of values written by the producer
+        unsigned long long head;
+        // Number of values read by consumers
+        unsigned long long tail;
+        // Number of blocks that finished their rounds
+        unsigned long long arrivals;
+        // Set by the host to terminate the producer
+        unsigned int stop;
+    };
+
+    // Persistent kernel: every thread keeps its engine in registers and writes
+    // values_per_thread values per round. A round starts when the previous one
+    // is published and there is room for it, values of round r are positions
+    // [r * round_size, (r + 1) * round_size) of the stream. The last block of
+    // a round publishes it by advancing head. All blocks must be resident.
+    template<class Engine>
+    __global__
+    void stream_producer_kernel(const unsigned long long seed,
+                                unsigned int * data,
+                                const size_t capacity,
+                                const unsigned int values_per_thread,
+                                stream_counters * counters)
+    {
+        const unsigned int thread_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int threads = hipGridDim_x * hipBlockDim_x;
+        const unsigned long long round_size =
+            static_cast<unsigned long long>(threads) * values_per_thread;
+
+        Engine engine(seed, thread_id, 0);
+
+        __shared__ unsigned int stop;
+        for(unsigned long long round = 0; ; round++)
+        {
+            const unsigned long long begin = round * round_size;
+            if(hipThreadIdx_x == 0)
+            {
+                volatile stream_counters * c = counters;
+                unsigned int s;
+                while(true)
+                {
+                    s = c->stop;
+                    if(s != 0 || (c->head == begin && begin + round_size - c->tail <= capacity))
+                        break;
+                }
+                stop = s;
+            }
+            __syncthreads();
+            if(stop != 0)
+                break;
+
+            size_t slot = begin % capacity + thread_id;
+            for(unsigned int i = 0; i < values_per_thread; i++)
+            {
+                if(slot >= capacity)
+                    slot -= capacity;
+                data[slot] = engine();
+                slot += threads;
+            }
+
+            // Values of the block are visible before it arrives
+            __threadfence();
+            __syncthreads();
+            if(hipThreadIdx_x == 0)
+            {
+                const unsigned long long arrived = atomicAdd(&counters->arrivals, 1ULL);
+                if(arrived == (round + 1) * hipGridDim_x - 1)
+                {
+                    __threadfence();
+                    atomicExch(&counters->head, begin + round_size);
+                }
+            }
+        }
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+struct rocrand_stream_producer_base_type
+{
+    rocrand_stream_producer_base_type(rocrand_rng_type rng_type)
+        : rng_type(rng_type), m_data(NULL), m_capacity(0), m_counters(NULL) {}
+    const rocrand_rng_type rng_type;
+
+    virtual ~rocrand_stream_producer_base_type() {}
+
+    void get_buffer(rocrand_ring_buffer * buffer) const
+    {
+        buffer->data = m_data;
+        buffer->capacity = m_capacity;
+        buffer->head = &m_counters->head;
+        buffer->tail = &m_counters->tail;
+    }
+
+protected:
+    unsigned int * m_data;
+    size_t m_capacity;
+    rocrand_host::detail::stream_counters * m_counters;
+};
+
+// Runs stream_producer_kernel with Engine, one block per compute unit,
+// so consumer kernels can run on all compute units at the same time
+template<class Engine>
+class rocrand_engine_stream_producer : public rocrand_stream_producer_base_type
+{
+public:
+    using base_type = rocrand_stream_producer_base_type;
+
+    rocrand_engine_stream_producer(rocrand_rng_type rng_type,
+                                   unsigned long long seed,
+                                   size_t capacity)
+        : base_type(rng_type), m_stream(NULL), m_control_stream(NULL), m_running(false)
+    {
+        int device;
+        hipDeviceProp_t props;
+        if(hipGetDevice(&device) != hipSuccess
+            || hipGetDeviceProperties(&props, device) != hipSuccess)
+        {
+            throw ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        // A round fills at most half of the buffer, so consumers can read
+        // one half while the other one is refilled
+        const size_t blocks = std::min<size_t>(
+            std::max(1, props.multiProcessorCount), capacity / (2 * s_threads)
+        );
+        if(blocks == 0)
+        {
+            throw ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        const unsigned int values_per_thread = static_cast<unsigned int>(
+            std::min<size_t>(s_max_values_per_thread, capacity / (2 * blocks * s_threads))
+        );
+
+        try
+        {
+            if(hipMalloc(&m_data, sizeof(unsigned int) * capacity) != hipSuccess)
+            {
+                m_data = NULL;
+                throw ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            if(hipMalloc(&m_counters, sizeof(rocrand_host::detail::stream_counters)) != hipSuccess)
+            {
+                m_counters = NULL;
+                throw ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            m_capacity = capacity;
+            if(hipStreamCreateWithFlags(&m_stream, hipStreamNonBlocking) != hipSuccess)
+            {
+                m_stream = NULL;
+                throw ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            if(hipStreamCreateWithFlags(&m_control_stream, hipStreamNonBlocking) != hipSuccess)
+            {
+                m_control_stream = NULL;
+                throw ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            // Other producers may be running, so the device is not synchronized
+            if(hipMemsetAsync(m_counters, 0, sizeof(rocrand_host::detail::stream_counters), m_stream) != hipSuccess)
+            {
+                throw ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::stream_producer_kernel<Engine>),
+                dim3(blocks), dim3(s_threads), 0, m_stream,
+                seed, m_data, m_capacity, values_per_thread, m_counters
+            );
+            if(hipPeekAtLastError() != hipSuccess)
+            {
+                throw ROCRAND_STATUS_LAUNCH_FAILURE;
+            }
+        }
+        catch(...)
+        {
+            release();
+            throw;
+        }
+        m_running = true;
+    }
+
+    ~rocrand_engine_stream_producer()
+    {
+        if(m_running)
+        {
+            // The kernel is running in m_stream, so the flag is set from another stream
+            const unsigned int stop = 1;
+            hipMemcpyAsync(
+                &m_counters->stop, &stop, sizeof(unsigned int),
+                hipMemcpyHostToDevice, m_control_stream
+            );
+            hipStreamSynchronize(m_control_stream);
+            hipStreamSynchronize(m_stream);
+        }
+        release();
+    }
+
+private:
+    static constexpr unsigned int s_threads = 256;
+    static constexpr unsigned int s_max_values_per_thread = 16;
+
+    hipStream_t m_stream;
+    hipStream_t m_control_stream;
+    bool m_running;
+
+    void release()
+    {
+        if(m_control_stream != NULL)
+            hipStreamDestroy(m_control_stream);
+        if(m_stream != NULL)
+            hipStreamDestroy(m_stream);
+        if(m_counters != NULL)
+            hipFree(m_counters);
+        if(m_data != NULL)
+            hipFree(m_data);
+        m_control_stream = NULL;
+        m_stream = NULL;
+        m_counters = NULL;
+        m_data = NULL;
+    }
+};
+
+#endif // ROCRAND_RNG_STREAM_PRODUCER_H_
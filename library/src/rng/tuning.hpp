@@ -0,0 +1,193 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_TUNING_H_
+#define ROCRAND_RNG_TUNING_H_
+
+#include <cctype>
+#include <cstdlib>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+namespace rocrand_host {
+namespace detail {
+
+    // One line of a tuning database: the fastest launch configuration
+    // of generating values of value_size bytes in the size bucket
+    struct tuning_entry
+    {
+        unsigned int rng_type;
+        unsigned int value_size;
+        unsigned int bucket;
+        unsigned int blocks;
+        unsigned int threads;
+    };
+
+    // Size bucket of a generate call of size values: floor(log2(size))
+    inline unsigned int tuning_bucket(size_t size)
+    {
+        unsigned int bucket = 0;
+        while(size > 1)
+        {
+            size >>= 1;
+            bucket++;
+        }
+        return bucket;
+    }
+
+    // Opt-in per-device database of launch configurations written by rocrand-tune.
+    // It is enabled when ROCRAND_TUNING_DIR environment variable is set to
+    // an existing directory, the database of a device is the text file named
+    // by the device name and the number of its compute units, each line is
+    // "<rng type> <value size> <size bucket> <blocks> <threads>" ('#' starts
+    // a comment). Only generators whose results do not depend on the launch
+    // configuration consult it (Sobol generators and ROCRAND_ORDERING_PSEUDO_DYNAMIC),
+    // and only when the library chooses the configuration.
+    class tuning_database
+    {
+    public:
+        // Path of the database of device, empty if tuning is disabled
+        static std::string path(int device)
+        {
+            const char * dir = std::getenv("ROCRAND_TUNING_DIR");
+            hipDeviceProp_t props;
+            if(dir == NULL || dir[0] == '\0'
+                || hipGetDeviceProperties(&props, device) != hipSuccess)
+            {
+                return std::string();
+            }
+            std::string name(props.name);
+            for(char& c : name)
+            {
+                if(!std::isalnum(static_cast<unsigned char>(c)))
+                    c = '_';
+            }
+            return std::string(dir) + "/rocrand_tuning_" + name + "_"
+                + std::to_string(props.multiProcessorCount) + "cu.txt";
+        }
+
+        // Reads entries of the database at path, invalid lines are skipped
+        static std::vector<tuning_entry> read(const std::string& path)
+        {
+            std::vector<tuning_entry> entries;
+            std::ifstream file(path);
+            std::string line;
+            while(std::getline(file, line))
+            {
+                line = line.substr(0, line.find('#'));
+                std::istringstream fields(line);
+                tuning_entry e;
+                if(fields >> e.rng_type >> e.value_size >> e.bucket >> e.blocks >> e.threads
+                    && e.blocks != 0 && e.threads != 0)
+                {
+                    entries.push_back(e);
+                }
+            }
+            return entries;
+        }
+
+        // Writes entries to the database at path (see engines_file_cache::store()),
+        // returns false on failure
+        static bool write(const std::string& path, const std::vector<tuning_entry>& entries)
+        {
+            const std::string tmp_path = path + ".tmp" + std::to_string(std::random_device()());
+            {
+                std::ofstream file(tmp_path);
+                if(!file)
+                    return false;
+                file << "# rng_type value_size size_bucket blocks threads\n";
+                for(const tuning_entry& e : entries)
+                {
+                    file << e.rng_type << " " << e.value_size << " " << e.bucket << " "
+                         << e.blocks << " " << e.threads << "\n";
+                }
+                if(!file)
+                {
+                    file.close();
+                    std::remove(tmp_path.c_str());
+                    return false;
+                }
+            }
+            if(std::rename(tmp_path.c_str(), path.c_str()) != 0)
+            {
+                std::remove(tmp_path.c_str());
+                return false;
+            }
+            return true;
+        }
+
+        // Finds the launch configuration of size values of value_size bytes
+        // generated by rng_type on the current device: the entry of the nearest
+        // size bucket. Databases are read once per process.
+        static bool lookup(rocrand_rng_type rng_type, size_t value_size, size_t size,
+                           unsigned int& blocks, unsigned int& threads)
+        {
+            const char * dir = std::getenv("ROCRAND_TUNING_DIR");
+            int device;
+            if(dir == NULL || dir[0] == '\0' || hipGetDevice(&device) != hipSuccess)
+                return false;
+
+            static std::mutex mutex;
+            static std::map<int, std::vector<tuning_entry>> databases;
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = databases.find(device);
+            if(it == databases.end())
+            {
+                const std::string p = path(device);
+                it = databases.insert(
+                    std::make_pair(device, p.empty() ? std::vector<tuning_entry>() : read(p))
+                ).first;
+            }
+
+            const unsigned int bucket = tuning_bucket(size);
+            const tuning_entry * best = NULL;
+            unsigned int best_distance = 0;
+            for(const tuning_entry& e : it->second)
+            {
+                if(e.rng_type != static_cast<unsigned int>(rng_type) || e.value_size != value_size)
+                    continue;
+                const unsigned int distance = e.bucket > bucket ? e.bucket - bucket : bucket - e.bucket;
+                if(best == NULL || distance < best_distance)
+                {
+                    best = &e;
+                    best_distance = distance;
+                }
+            }
+            if(best == NULL)
+                return false;
+            blocks = best->blocks;
+            threads = best->threads;
+            return true;
+        }
+    };
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_TUNING_H_
@@ -0,0 +1,124 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_UNIT_VECTORS_H_
+#define ROCRAND_RNG_UNIT_VECTORS_H_
+
+#include <algorithm>
+#include <cmath>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "common.hpp"
+
+// Unit vectors of rocrand_generate_unit_vectors() for generators without
+// fused generation and for more than unit_vector_max_fused_dim values:
+// standard normal values are generated directly to the output and every
+// vector is divided by its length in place, so no temporary buffer is needed.
+
+namespace rocrand_host {
+namespace detail {
+
+    constexpr unsigned int unit_vectors_threads = 256;
+    constexpr unsigned int unit_vectors_max_blocks = 1024;
+
+    // Normal vectors are never zero in practice, a zero vector becomes
+    // the first basis vector
+    __forceinline__ __device__ __host__
+    void normalize_vector(float * vector, const unsigned int dim)
+    {
+        float sum = 0.0f;
+        for(unsigned int i = 0; i < dim; i++)
+        {
+            sum += vector[i] * vector[i];
+        }
+        if(!(sum > 0.0f))
+        {
+            for(unsigned int i = 0; i < dim; i++)
+            {
+                vector[i] = i == 0 ? 1.0f : 0.0f;
+            }
+            return;
+        }
+        const float r = 1.0f / sqrtf(sum);
+        for(unsigned int i = 0; i < dim; i++)
+        {
+            vector[i] *= r;
+        }
+    }
+
+    __global__
+    void normalize_vectors_kernel(float * data, const size_t n, const unsigned int dim)
+    {
+        const unsigned int thread_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+        for(size_t index = thread_id; index < n; index += stride)
+        {
+            normalize_vector(data + index * dim, dim);
+        }
+    }
+
+    // Generates n unit vectors of dim values with standard normal values of
+    // generate_normal(data, size) (host memory for host-side generators)
+    template<class GenerateNormal>
+    rocrand_status generate_normalized_vectors(hipStream_t stream,
+                                               bool host_side,
+                                               float * output,
+                                               size_t n,
+                                               unsigned int dim,
+                                               GenerateNormal generate_normal)
+    {
+        if(n == 0)
+            return ROCRAND_STATUS_SUCCESS;
+        const rocrand_status status = generate_normal(output, n * dim);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        if(host_side)
+        {
+            host_parallel_for(
+                n,
+                [=](size_t index)
+                {
+                    normalize_vector(output + index * dim, dim);
+                }
+            );
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        const unsigned int blocks = static_cast<unsigned int>(std::min<size_t>(
+            (n + unit_vectors_threads - 1) / unit_vectors_threads, unit_vectors_max_blocks
+        ));
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(normalize_vectors_kernel),
+            dim3(blocks), dim3(unit_vectors_threads), 0, stream,
+            output, n, dim
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_UNIT_VECTORS_H_
@@ -21,246 +21,76 @@
 #ifndef ROCRAND_RNG_XORWOW_H_
 #define ROCRAND_RNG_XORWOW_H_
 
-#include <algorithm>
 #include <hip/hip_runtime.h>
 
 #include <rocrand.h>
 
 #include "common.hpp"
-#include "generator_type.hpp"
 #include "device_engines.hpp"
-#include "distributions.hpp"
+#include "small_state.hpp"
 
 namespace rocrand_host {
 namespace detail {
 
     typedef ::rocrand_device::xorwow_engine xorwow_device_engine;
 
-    __global__
-    void init_engines_kernel(xorwow_device_engine * engines,
-                             unsigned long long seed,
-                             unsigned long long offset)
-    {
-        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-        engines[engine_id] = xorwow_device_engine(seed, engine_id, offset);
-    }
+namespace small_state {
 
-    template<class T, class Distribution>
-    __global__
-    void generate_kernel(xorwow_device_engine * engines,
-                         T * data, const size_t n,
-                         Distribution distribution)
+    // XORWOW engines skip ahead by jump matrices, which are the same for all
+    // engines, so they are staged in shared memory once per block
+    // (the same states as create_engine() and split_engine())
+    template<>
+    struct traits<ROCRAND_RNG_PSEUDO_XORWOW>
     {
-        constexpr unsigned int input_width = Distribution::input_width;
-        constexpr unsigned int output_width = Distribution::output_width;
-
-        using vec_type = aligned_vec_type<T, output_width>;
-
-        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
-        size_t index = engine_id;
-
-        // Load device engine
-        xorwow_device_engine engine = engines[engine_id];
-
-        unsigned int input[input_width];
-        T output[output_width];
-
-        const uintptr_t uintptr = reinterpret_cast<uintptr_t>(data);
-        const size_t misalignment =
-            (
-                output_width - uintptr / sizeof(T) % output_width
-            ) % output_width;
-        const unsigned int head_size = min(n, misalignment);
-        const unsigned int tail_size = (n - head_size) % output_width;
-        const size_t vec_n = (n - head_size) / output_width;
-
-        vec_type * vec_data = reinterpret_cast<vec_type *>(data + misalignment);
-        while(index < vec_n)
+        typedef xorwow_device_engine engine_type;
+
+        __forceinline__ __device__
+        static void init_engine(xorwow_device_engine * engines,
+                                const unsigned int engines_size,
+                                const unsigned int engine_id,
+                                const unsigned long long seed,
+                                const unsigned long long offset,
+                                const bool seeded)
         {
-            for(unsigned int i = 0; i < input_width; i++)
+            if(seeded)
             {
-                input[i] = engine();
+                store_engine_soa(
+                    engines, engines_size, engine_id,
+                    create_engine<xorwow_device_engine>(seed, engine_id, offset, true)
+                );
+                return;
             }
-            distribution(input, output);
 
-            vec_data[index] = *reinterpret_cast<vec_type *>(output);
-            // Next position
-            index += stride;
+            __shared__ unsigned int jump_matrix[XORWOW_SIZE];
+            xorwow_device_engine engine(seed, 0, 0);
+            engine.discard_subsequence_block(engine_id, jump_matrix);
+            engine.discard_block(offset, jump_matrix);
+            store_engine_soa(engines, engines_size, engine_id, engine);
         }
 
-        // Check if we need to save head and tail.
-        // Those numbers should be generated by the thread that would
-        // save next vec_type.
-        if(output_width > 1 && index == vec_n)
+        __forceinline__ __device__
+        static void split_engine(xorwow_device_engine * engines,
+                                 xorwow_device_engine * const * children,
+                                 const unsigned int children_count,
+                                 const unsigned int engines_size,
+                                 const unsigned int engine_id)
         {
-            // If data is not aligned by sizeof(vec_type)
-            if(head_size > 0)
-            {
-                for(unsigned int i = 0; i < input_width; i++)
-                {
-                    input[i] = engine();
-                }
-                distribution(input, output);
-
-                for(unsigned int o = 0; o < output_width; o++)
-                {
-                    if(o < head_size)
-                    {
-                        data[o] = output[o];
-                    }
-                }
-            }
-
-            if(tail_size > 0)
+            __shared__ unsigned int jump_matrix[XORWOW_SIZE];
+            xorwow_device_engine engine = load_engine_soa(engines, engines_size, engine_id);
+            for(unsigned int i = 0; i < children_count; i++)
             {
-                for(unsigned int i = 0; i < input_width; i++)
-                {
-                    input[i] = engine();
-                }
-                distribution(input, output);
-
-                for(unsigned int o = 0; o < output_width; o++)
-                {
-                    if(o < tail_size)
-                    {
-                        data[n - tail_size + o] = output[o];
-                    }
-                }
+                engine.discard_subsequence_block(engines_size, jump_matrix);
+                store_engine_soa(children[i], engines_size, engine_id, engine);
             }
+            engine.discard_subsequence_block(engines_size, jump_matrix);
+            store_engine_soa(engines, engines_size, engine_id, engine);
         }
+    };
 
-        // Save engine with its state
-        engines[engine_id] = engine;
-    }
-
+} // end namespace small_state
 } // end namespace detail
 } // end namespace rocrand_host
 
-class rocrand_xorwow : public rocrand_generator_type<ROCRAND_RNG_PSEUDO_XORWOW>
-{
-public:
-    using base_type = rocrand_generator_type<ROCRAND_RNG_PSEUDO_XORWOW>;
-    using engine_type = ::rocrand_host::detail::xorwow_device_engine;
-
-    rocrand_xorwow(unsigned long long seed = 0,
-                   unsigned long long offset = 0,
-                   hipStream_t stream = 0)
-        : base_type(seed, offset, stream),
-          m_engines_initialized(false), m_engines(NULL), m_engines_size(s_threads * s_blocks)
-    {
-        // Allocate device random number engines
-        auto error = hipMalloc(&m_engines, sizeof(engine_type) * m_engines_size);
-        if(error != hipSuccess)
-        {
-            throw ROCRAND_STATUS_ALLOCATION_FAILED;
-        }
-    }
-
-    ~rocrand_xorwow()
-    {
-        hipFree(m_engines);
-    }
-
-    /// Changes seed to \p seed and resets generator state.
-    void set_seed(unsigned long long seed)
-    {
-        m_seed = seed;
-        m_engines_initialized = false;
-    }
-
-    void set_offset(unsigned long long offset)
-    {
-        m_offset = offset;
-        m_engines_initialized = false;
-    }
-
-    rocrand_status init()
-    {
-        if (m_engines_initialized)
-            return ROCRAND_STATUS_SUCCESS;
-
-        hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::init_engines_kernel),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, m_seed, m_offset
-        );
-        // Check kernel status
-        if(hipPeekAtLastError() != hipSuccess)
-            return ROCRAND_STATUS_LAUNCH_FAILURE;
-
-        m_engines_initialized = true;
-
-        return ROCRAND_STATUS_SUCCESS;
-    }
-
-    template<class T, class Distribution = uniform_distribution<T> >
-    rocrand_status generate(T * data, size_t data_size,
-                            Distribution distribution = Distribution())
-    {
-        rocrand_status status = init();
-        if (status != ROCRAND_STATUS_SUCCESS)
-            return status;
-
-        hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, distribution
-        );
-        // Check kernel status
-        if(hipPeekAtLastError() != hipSuccess)
-            return ROCRAND_STATUS_LAUNCH_FAILURE;
-
-        return ROCRAND_STATUS_SUCCESS;
-    }
-
-    template<class T>
-    rocrand_status generate_uniform(T * data, size_t data_size)
-    {
-        uniform_distribution<T> distribution;
-        return generate(data, data_size, distribution);
-    }
-
-    template<class T>
-    rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
-    {
-        normal_distribution<T> distribution(mean, stddev);
-        return generate(data, data_size, distribution);
-    }
-
-    template<class T>
-    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
-    {
-        log_normal_distribution<T> distribution(mean, stddev);
-        return generate(data, data_size, distribution);
-    }
-
-    rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
-    {
-        try
-        {
-            m_poisson.set_lambda(lambda);
-        }
-        catch(rocrand_status status)
-        {
-            return status;
-        }
-        return generate(data, data_size, m_poisson.dis);
-    }
-
-private:
-    bool m_engines_initialized;
-    engine_type * m_engines;
-    size_t m_engines_size;
-
-    static const uint32_t s_threads = 256;
-    static const uint32_t s_blocks = 512;
-
-    // For caching of Poisson for consecutive generations with the same lambda
-    poisson_distribution_manager<> m_poisson;
-
-    // m_seed from base_type
-    // m_offset from base_type
-};
+typedef rocrand_small_state<ROCRAND_RNG_PSEUDO_XORWOW> rocrand_xorwow;
 
 #endif // ROCRAND_RNG_XORWOW_H_
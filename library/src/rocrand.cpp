@@ -23,157 +23,183 @@
 #include "rng/generators.hpp"
 
 #include <rocrand.h>
+#include <algorithm>
+#include <cstring>
 #include <new>
 
-#if defined(__cplusplus)
-extern "C" {
-#endif /* __cplusplus */
+namespace {
 
-rocrand_status ROCRANDAPI
-rocrand_create_generator(rocrand_generator * generator, rocrand_rng_type rng_type)
+// Copies the state of generator to state if the buffer is large enough,
+// returns the size of the state in state_size
+template<class Generator>
+rocrand_status get_generator_state(Generator * generator, void * state, size_t * state_size)
 {
-    try
+    const size_t size = generator->get_state_size();
+    const size_t buffer_size = *state_size;
+    *state_size = size;
+    if(state == NULL)
     {
-        if(rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
-        {
-            *generator = new rocrand_philox4x32_10();
-        }
-        else if(rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
-        {
-            *generator = new rocrand_mrg32k3a();
-        }
-        else if(rng_type == ROCRAND_RNG_PSEUDO_XORWOW
-                    || rng_type == ROCRAND_RNG_PSEUDO_DEFAULT)
-        {
-            *generator = new rocrand_xorwow();
-        }
-        else if(rng_type == ROCRAND_RNG_QUASI_SOBOL32
-                    || rng_type == ROCRAND_RNG_QUASI_DEFAULT)
-        {
-            *generator = new rocrand_sobol32();
-        }
-        else if(rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
-        {
-            *generator = new rocrand_mtgp32();
-        }
-        else
-        {
-            return ROCRAND_STATUS_TYPE_ERROR;
-        }
+        return ROCRAND_STATUS_SUCCESS;
     }
-    catch(const std::bad_alloc& e)
+    if(buffer_size < size)
     {
-        return ROCRAND_STATUS_INTERNAL_ERROR;
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-    catch(rocrand_status status)
+    return generator->get_state(state);
+}
+
+template<class Generator>
+rocrand_status set_generator_state(Generator * generator, const void * state, size_t state_size)
+{
+    if(state == NULL || state_size != generator->get_state_size())
     {
-        return status;
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-    return ROCRAND_STATUS_SUCCESS;
+    return generator->set_state(state);
 }
 
-rocrand_status ROCRANDAPI
-rocrand_destroy_generator(rocrand_generator generator)
+// Header of blobs written by rocrand_generator_save()
+struct generator_blob_header
 {
-    try
+    unsigned int magic;
+    unsigned int version;
+    unsigned int rng_type;
+    unsigned int reserved;
+    unsigned long long size;
+};
+
+const unsigned int generator_blob_magic = 0x524e4447; // "GDNR"
+
+template<class Generator>
+rocrand_status save_generator(Generator * generator, void * blob, size_t * blob_size)
+{
+    const size_t size = generator->get_save_size();
+    const size_t buffer_size = *blob_size;
+    *blob_size = sizeof(generator_blob_header) + size;
+    if(blob == NULL)
     {
-        delete(generator);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    catch(rocrand_status status)
+    if(buffer_size < *blob_size)
     {
-        return status;
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-    return ROCRAND_STATUS_SUCCESS;
+
+    generator_blob_header header;
+    header.magic = generator_blob_magic;
+    header.version = ROCRAND_VERSION;
+    header.rng_type = static_cast<unsigned int>(generator->rng_type);
+    header.reserved = 0;
+    header.size = size;
+    std::memcpy(blob, &header, sizeof(generator_blob_header));
+    return generator->save(static_cast<char *>(blob) + sizeof(generator_blob_header));
 }
 
-rocrand_status ROCRANDAPI
-rocrand_generate(rocrand_generator generator,
-                 unsigned int * output_data, size_t n)
+template<class Generator>
+rocrand_status load_generator(Generator * generator, const void * blob, size_t blob_size)
 {
-    if(generator == NULL)
+    if(blob == NULL || blob_size < sizeof(generator_blob_header))
     {
-        return ROCRAND_STATUS_NOT_CREATED;
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    generator_blob_header header;
+    std::memcpy(&header, blob, sizeof(generator_blob_header));
+    if(header.magic != generator_blob_magic
+        || header.size != blob_size - sizeof(generator_blob_header))
     {
-        rocrand_philox4x32_10 * philox4x32_10_generator =
-            static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate(output_data, n);
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    if(header.version != ROCRAND_VERSION)
     {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate(output_data, n);
+        return ROCRAND_STATUS_VERSION_MISMATCH;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    if(header.rng_type != static_cast<unsigned int>(generator->rng_type))
     {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate(output_data, n);
+        return ROCRAND_STATUS_TYPE_ERROR;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    return generator->load(
+        static_cast<const char *>(blob) + sizeof(generator_blob_header),
+        blob_size - sizeof(generator_blob_header)
+    );
+}
+
+// Records work of generate() (a generation function called for generator)
+// into a graph by stream capture and adds it to graph as a child graph node.
+// The generator's stream is replaced by a temporary stream during capture.
+template<class Generator, class Generate>
+rocrand_status add_generator_graph_node(Generator * generator,
+                                        hipGraph_t graph,
+                                        hipGraphNode_t * node,
+                                        const hipGraphNode_t * dependencies,
+                                        size_t dependencies_count,
+                                        Generate generate)
+{
+    if(generator->is_host_side())
     {
-        rocrand_sobol32 * rocrand_sobol32_generator =
-            static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate(output_data, n);
+        return ROCRAND_STATUS_TYPE_ERROR;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    if(node == NULL)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate(output_data, n);
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-    return ROCRAND_STATUS_TYPE_ERROR;
-}
 
-rocrand_status ROCRANDAPI
-rocrand_generate_char(rocrand_generator generator,
-                      unsigned char * output_data, size_t n)
-{
-    if(generator == NULL)
+    // Allocations and initialization are not allowed during capture,
+    // and the graph can be launched in another stream
+    rocrand_status status = generator->init();
+    if(status != ROCRAND_STATUS_SUCCESS)
     {
-        return ROCRAND_STATUS_NOT_CREATED;
+        return status;
+    }
+    const hipStream_t stream = generator->get_stream();
+    if(hipStreamSynchronize(stream) != hipSuccess)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
     }
 
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    hipStream_t capture_stream;
+    if(hipStreamCreateWithFlags(&capture_stream, hipStreamNonBlocking) != hipSuccess)
     {
-        rocrand_philox4x32_10 * philox4x32_10_generator =
-            static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate(output_data, n);
+        return ROCRAND_STATUS_INTERNAL_ERROR;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    hipGraph_t child_graph = NULL;
+    if(hipStreamBeginCapture(capture_stream, hipStreamCaptureModeThreadLocal) == hipSuccess)
     {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate(output_data, n);
+        generator->set_stream(capture_stream);
+        status = generate();
+        generator->set_stream(stream);
+        if(hipStreamEndCapture(capture_stream, &child_graph) != hipSuccess
+            && status == ROCRAND_STATUS_SUCCESS)
+        {
+            status = ROCRAND_STATUS_INTERNAL_ERROR;
+        }
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    else
     {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate(output_data, n);
+        status = ROCRAND_STATUS_INTERNAL_ERROR;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    // The child graph is cloned into the node
+    if(status == ROCRAND_STATUS_SUCCESS
+        && hipGraphAddChildGraphNode(node, graph, dependencies, dependencies_count, child_graph) != hipSuccess)
     {
-        rocrand_sobol32 * rocrand_sobol32_generator =
-            static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate(output_data, n);
+        status = ROCRAND_STATUS_INTERNAL_ERROR;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    if(child_graph != NULL)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate(output_data, n);
+        hipGraphDestroy(child_graph);
     }
-
-    return ROCRAND_STATUS_TYPE_ERROR;
+    hipStreamDestroy(capture_stream);
+    return status;
 }
 
-rocrand_status ROCRANDAPI
-rocrand_generate_short(rocrand_generator generator,
-                       unsigned short * output_data, size_t n)
+// Graph nodes are supported for generators that keep positions of their
+// engines in device memory
+template<class Generate>
+rocrand_status add_graph_node(rocrand_generator generator,
+                              hipGraph_t graph,
+                              hipGraphNode_t * node,
+                              const hipGraphNode_t * dependencies,
+                              size_t dependencies_count,
+                              Generate generate)
 {
     if(generator == NULL)
     {
@@ -184,81 +210,258 @@ rocrand_generate_short(rocrand_generator generator,
     {
         rocrand_philox4x32_10 * philox4x32_10_generator =
             static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate(output_data, n);
+        if(philox4x32_10_generator->is_stateless())
+        {
+            return ROCRAND_STATUS_TYPE_ERROR;
+        }
+        return add_generator_graph_node(
+            philox4x32_10_generator, graph, node, dependencies, dependencies_count, generate
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return add_generator_graph_node(
+            static_cast<rocrand_philox4x32_7 *>(generator),
+            graph, node, dependencies, dependencies_count, generate
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return add_generator_graph_node(
+            static_cast<rocrand_philox4x64_10 *>(generator),
+            graph, node, dependencies, dependencies_count, generate
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return add_generator_graph_node(
+            static_cast<rocrand_threefry2x64_20 *>(generator),
+            graph, node, dependencies, dependencies_count, generate
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return add_generator_graph_node(
+            static_cast<rocrand_threefry4x64_20 *>(generator),
+            graph, node, dependencies, dependencies_count, generate
+        );
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate(output_data, n);
+        return add_generator_graph_node(
+            static_cast<rocrand_mrg32k3a *>(generator),
+            graph, node, dependencies, dependencies_count, generate
+        );
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate(output_data, n);
+        return add_generator_graph_node(
+            static_cast<rocrand_xorwow *>(generator),
+            graph, node, dependencies, dependencies_count, generate
+        );
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
     {
-        rocrand_sobol32 * rocrand_sobol32_generator =
-            static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate(output_data, n);
+        return add_generator_graph_node(
+            static_cast<rocrand_xoshiro128pp *>(generator),
+            graph, node, dependencies, dependencies_count, generate
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return add_generator_graph_node(
+            static_cast<rocrand_pcg32 *>(generator),
+            graph, node, dependencies, dependencies_count, generate
+        );
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate(output_data, n);
+        return add_generator_graph_node(
+            static_cast<rocrand_mtgp32 *>(generator),
+            graph, node, dependencies, dependencies_count, generate
+        );
     }
-
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
-rocrand_status ROCRANDAPI
-rocrand_generate_uniform(rocrand_generator generator,
-                         float * output_data, size_t n)
+// Device buffers of generation to host memory are limited to this size
+const size_t host_output_chunk_bytes = 4 << 20;
+
+// Resources of a pipeline of generation to host memory: values of chunk i are
+// generated into buffers[i % 2] in the generator's stream and copied to the host
+// in copy_stream, so generation of a chunk overlaps copying of the previous one
+struct host_output_pipeline
 {
-    if(generator == NULL)
+    void * buffers[2];
+    hipEvent_t generated[2];
+    hipEvent_t copied[2];
+    hipStream_t copy_stream;
+    // The generator's stream, buffers are allocated and freed in it
+    hipStream_t stream;
+
+    host_output_pipeline(hipStream_t stream)
+        : buffers(), generated(), copied(), copy_stream(NULL), stream(stream) {}
+
+    ~host_output_pipeline()
     {
-        return ROCRAND_STATUS_NOT_CREATED;
+        if(copy_stream != NULL)
+        {
+            hipStreamSynchronize(copy_stream);
+            hipStreamDestroy(copy_stream);
+        }
+        for(unsigned int i = 0; i < 2; i++)
+        {
+            if(generated[i] != NULL)
+            {
+                hipEventDestroy(generated[i]);
+            }
+            if(copied[i] != NULL)
+            {
+                hipEventDestroy(copied[i]);
+            }
+            rocrand_host::detail::device_free(buffers[i], stream);
+        }
     }
 
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    rocrand_status create(size_t buffer_size)
     {
-        rocrand_philox4x32_10 * philox4x32_10_generator =
-            static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_uniform(output_data, n);
+        if(hipStreamCreateWithFlags(&copy_stream, hipStreamNonBlocking) != hipSuccess)
+        {
+            copy_stream = NULL;
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        for(unsigned int i = 0; i < 2; i++)
+        {
+            if(rocrand_host::detail::device_malloc(&buffers[i], buffer_size, stream) != hipSuccess)
+            {
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            if(hipEventCreateWithFlags(&generated[i], hipEventDisableTiming) != hipSuccess
+                || hipEventCreateWithFlags(&copied[i], hipEventDisableTiming) != hipSuccess)
+            {
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+        }
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+};
+
+// Number of dimensions of generated values and whether each dimension
+// is stored contiguously (chunks of several dimensions need 2D copies)
+template<class Generator>
+void get_host_output_layout(const Generator *, unsigned int& dimensions, bool& planar)
+{
+    dimensions = 1;
+    planar = false;
+}
+
+template<rocrand_rng_type RngType>
+void get_host_output_layout(const rocrand_sobol<RngType> * generator,
+                            unsigned int& dimensions, bool& planar)
+{
+    dimensions = generator->get_dimensions();
+    planar = dimensions > 1 && generator->get_ordering() != ROCRAND_ORDERING_QUASI_INTERLEAVED;
+}
+
+template<rocrand_rng_type RngType>
+void get_host_output_layout(const rocrand_point_set<RngType> * generator,
+                            unsigned int& dimensions, bool& planar)
+{
+    dimensions = generator->get_dimensions();
+    planar = dimensions > 1 && generator->get_ordering() != ROCRAND_ORDERING_QUASI_INTERLEAVED;
+}
+
+// Generates n values to host memory output_data by calls of generate(data, size)
+// (a generation function called for generator) for chunks of device buffers
+template<class T, class Generator, class Generate>
+rocrand_status generate_generator_to_host(Generator * generator,
+                                          T * output_data, size_t n,
+                                          Generate generate)
+{
+    // Host generators write to host memory
+    if(generator->is_host_side())
     {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_uniform(output_data, n);
+        return generate(output_data, n);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+
+    unsigned int dimensions;
+    bool planar;
+    get_host_output_layout(generator, dimensions, planar);
+    if(n % dimensions != 0)
     {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_uniform(output_data, n);
+        return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    if(n == 0)
     {
-        rocrand_sobol32 * rocrand_sobol32_generator =
-            static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_uniform(output_data, n);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    const size_t points = n / dimensions;
+    const size_t chunk_points = std::max<size_t>(
+        1, host_output_chunk_bytes / (sizeof(T) * dimensions)
+    );
+
+    const hipStream_t stream = generator->get_stream();
+    host_output_pipeline pipeline(stream);
+    rocrand_status status = pipeline.create(
+        std::min(chunk_points, points) * dimensions * sizeof(T)
+    );
+    if(status != ROCRAND_STATUS_SUCCESS)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_uniform(output_data, n);
+        return status;
     }
-    return ROCRAND_STATUS_TYPE_ERROR;
+
+    for(size_t begin = 0, chunk = 0; begin < points; begin += chunk_points, chunk++)
+    {
+        const size_t count = std::min(chunk_points, points - begin);
+        const unsigned int b = chunk % 2;
+        T * buffer = static_cast<T *>(pipeline.buffers[b]);
+
+        // The buffer is reused when its previous chunk is copied
+        if(chunk >= 2 && hipStreamWaitEvent(stream, pipeline.copied[b], 0) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        status = generate(buffer, count * dimensions);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        if(hipEventRecord(pipeline.generated[b], stream) != hipSuccess
+            || hipStreamWaitEvent(pipeline.copy_stream, pipeline.generated[b], 0) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        const hipError_t error = planar
+            ? hipMemcpy2DAsync(
+                  output_data + begin, points * sizeof(T),
+                  buffer, count * sizeof(T),
+                  count * sizeof(T), dimensions,
+                  hipMemcpyDeviceToHost, pipeline.copy_stream
+              )
+            : hipMemcpyAsync(
+                  output_data + begin * dimensions, buffer,
+                  count * dimensions * sizeof(T),
+                  hipMemcpyDeviceToHost, pipeline.copy_stream
+              );
+        if(error != hipSuccess
+            || hipEventRecord(pipeline.copied[b], pipeline.copy_stream) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+    }
+
+    if(hipStreamSynchronize(pipeline.copy_stream) != hipSuccess)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    return ROCRAND_STATUS_SUCCESS;
 }
 
-rocrand_status ROCRANDAPI
-rocrand_generate_uniform_double(rocrand_generator generator,
-                                double * output_data, size_t n)
+template<class T, class Generate>
+rocrand_status generate_to_host(rocrand_generator generator,
+                                T * output_data, size_t n,
+                                Generate generate)
 {
     if(generator == NULL)
     {
@@ -267,325 +470,6871 @@ rocrand_generate_uniform_double(rocrand_generator generator,
 
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        rocrand_philox4x32_10 * philox4x32_10_generator =
-            static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_uniform(output_data, n);
+        return generate_generator_to_host(
+            static_cast<rocrand_philox4x32_10 *>(generator), output_data, n, generate
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return generate_generator_to_host(
+            static_cast<rocrand_philox4x32_7 *>(generator), output_data, n, generate
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return generate_generator_to_host(
+            static_cast<rocrand_philox4x64_10 *>(generator), output_data, n, generate
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return generate_generator_to_host(
+            static_cast<rocrand_threefry2x64_20 *>(generator), output_data, n, generate
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return generate_generator_to_host(
+            static_cast<rocrand_threefry4x64_20 *>(generator), output_data, n, generate
+        );
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_uniform(output_data, n);
+        return generate_generator_to_host(
+            static_cast<rocrand_mrg32k3a *>(generator), output_data, n, generate
+        );
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_uniform(output_data, n);
+        return generate_generator_to_host(
+            static_cast<rocrand_xorwow *>(generator), output_data, n, generate
+        );
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
     {
-        rocrand_sobol32 * rocrand_sobol32_generator =
-            static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_uniform(output_data, n);
+        return generate_generator_to_host(
+            static_cast<rocrand_xoshiro128pp *>(generator), output_data, n, generate
+        );
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_uniform(output_data, n);
+        return generate_generator_to_host(
+            static_cast<rocrand_pcg32 *>(generator), output_data, n, generate
+        );
     }
-    return ROCRAND_STATUS_TYPE_ERROR;
-}
-
-rocrand_status ROCRANDAPI
-rocrand_generate_uniform_half(rocrand_generator generator,
-                              half * output_data, size_t n)
-{
-    if(generator == NULL)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
     {
-        return ROCRAND_STATUS_NOT_CREATED;
+        return generate_generator_to_host(
+            static_cast<rocrand_sobol32 *>(generator), output_data, n, generate
+        );
     }
-
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
     {
-        rocrand_philox4x32_10 * philox4x32_10_generator =
-            static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_uniform(output_data, n);
+        return generate_generator_to_host(
+            static_cast<rocrand_scrambled_sobol32 *>(generator), output_data, n, generate
+        );
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
     {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_uniform(output_data, n);
+        return generate_generator_to_host(
+            static_cast<rocrand_sobol64 *>(generator), output_data, n, generate
+        );
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
     {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_uniform(output_data, n);
+        return generate_generator_to_host(
+            static_cast<rocrand_scrambled_sobol64 *>(generator), output_data, n, generate
+        );
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE32)
     {
-        rocrand_sobol32 * rocrand_sobol32_generator =
-            static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_uniform(output_data, n);
+        return generate_generator_to_host(
+            static_cast<rocrand_lattice32 *>(generator), output_data, n, generate
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON32)
+    {
+        return generate_generator_to_host(
+            static_cast<rocrand_halton32 *>(generator), output_data, n, generate
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32)
+    {
+        return generate_generator_to_host(
+            static_cast<rocrand_scrambled_halton32 *>(generator), output_data, n, generate
+        );
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_uniform(output_data, n);
+        return generate_generator_to_host(
+            static_cast<rocrand_mtgp32 *>(generator), output_data, n, generate
+        );
     }
-
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
-rocrand_status ROCRANDAPI
-rocrand_generate_normal(rocrand_generator generator,
-                        float * output_data, size_t n,
-                        float mean, float stddev)
+template<class Generator>
+void get_execution(const Generator * generator, hipStream_t& stream, bool& host_side)
 {
-    if(generator == NULL)
-    {
-        return ROCRAND_STATUS_NOT_CREATED;
-    }
+    stream = generator->get_stream();
+    host_side = generator->is_host_side();
+}
 
+// Returns the stream of generator and whether it is a host-side generator
+rocrand_status get_generator_execution(rocrand_generator generator,
+                                       hipStream_t& stream,
+                                       bool& host_side)
+{
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        rocrand_philox4x32_10 * philox4x32_10_generator =
-            static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_normal(output_data, n,
-                                                        mean, stddev);
+        get_execution(static_cast<rocrand_philox4x32_10 *>(generator), stream, host_side);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        get_execution(static_cast<rocrand_philox4x32_7 *>(generator), stream, host_side);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        get_execution(static_cast<rocrand_philox4x64_10 *>(generator), stream, host_side);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        get_execution(static_cast<rocrand_threefry2x64_20 *>(generator), stream, host_side);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        get_execution(static_cast<rocrand_threefry4x64_20 *>(generator), stream, host_side);
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_normal(output_data, n,
-                                                   mean, stddev);
+        get_execution(static_cast<rocrand_mrg32k3a *>(generator), stream, host_side);
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_normal(output_data, n,
-                                                         mean, stddev);
+        get_execution(static_cast<rocrand_xorwow *>(generator), stream, host_side);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        get_execution(static_cast<rocrand_xoshiro128pp *>(generator), stream, host_side);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        get_execution(static_cast<rocrand_pcg32 *>(generator), stream, host_side);
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
     {
-        rocrand_sobol32 * rocrand_sobol32_generator =
-            static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_normal(output_data, n,
-                                                          mean, stddev);
+        get_execution(static_cast<rocrand_sobol32 *>(generator), stream, host_side);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_normal(output_data, n,
-                                                         mean, stddev);
+        get_execution(static_cast<rocrand_scrambled_sobol32 *>(generator), stream, host_side);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    return ROCRAND_STATUS_TYPE_ERROR;
-}
-
-rocrand_status ROCRANDAPI
-rocrand_generate_normal_double(rocrand_generator generator,
-                               double * output_data, size_t n,
-                               double mean, double stddev)
-{
-    if(generator == NULL)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
     {
-        return ROCRAND_STATUS_NOT_CREATED;
+        get_execution(static_cast<rocrand_sobol64 *>(generator), stream, host_side);
+        return ROCRAND_STATUS_SUCCESS;
     }
-
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
     {
-        rocrand_philox4x32_10 * philox4x32_10_generator =
-            static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_normal(output_data, n,
-                                                        mean, stddev);
+        get_execution(static_cast<rocrand_scrambled_sobol64 *>(generator), stream, host_side);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE32)
     {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_normal(output_data, n,
-                                                   mean, stddev);
+        get_execution(static_cast<rocrand_lattice32 *>(generator), stream, host_side);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON32)
     {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_normal(output_data, n,
-                                                         mean, stddev);
+        get_execution(static_cast<rocrand_halton32 *>(generator), stream, host_side);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32)
     {
-        rocrand_sobol32 * rocrand_sobol32_generator =
-            static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_normal(output_data, n,
-                                                          mean, stddev);
+        get_execution(static_cast<rocrand_scrambled_halton32 *>(generator), stream, host_side);
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_normal(output_data, n,
-                                                         mean, stddev);
+        get_execution(static_cast<rocrand_mtgp32 *>(generator), stream, host_side);
+        return ROCRAND_STATUS_SUCCESS;
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
-rocrand_status ROCRANDAPI
-rocrand_generate_normal_half(rocrand_generator generator,
-                             half * output_data, size_t n,
-                             half mean, half stddev)
+// Prefetches a managed (hipMallocManaged()) output buffer of a device generator
+// to its device before values are generated and, with
+// ROCRAND_MANAGED_POLICY_PREFETCH_HOST, back to the host when the object is
+// destroyed (rocrand_set_managed_policy()). Prefetching is only a hint,
+// other buffers and errors are ignored. Errors pending before (reported by
+// hipPeekAtLastError()) are kept, nothing is prefetched then.
+class managed_output_prefetch
 {
-    if(generator == NULL)
+public:
+    managed_output_prefetch(rocrand_generator generator, const void * data, size_t bytes)
+        : m_data(NULL), m_bytes(bytes), m_stream(0), m_to_host(false)
     {
-        return ROCRAND_STATUS_NOT_CREATED;
-    }
+        const rocrand_managed_policy policy = generator->get_managed_policy();
+        if(policy == ROCRAND_MANAGED_POLICY_NONE || data == NULL || bytes == 0
+            || hipPeekAtLastError() != hipSuccess)
+        {
+            return;
+        }
+        bool host_side;
+        if(get_generator_execution(generator, m_stream, host_side) != ROCRAND_STATUS_SUCCESS
+            || host_side)
+        {
+            return;
+        }
 
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
-    {
-        rocrand_philox4x32_10 * philox4x32_10_generator =
-            static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_normal(output_data, n,
-                                                        mean, stddev);
+        hipPointerAttribute_t attributes;
+        if(hipPointerGetAttributes(&attributes, data) != hipSuccess)
+        {
+            // Memory unknown to HIP, the error must not be reported
+            // by hipPeekAtLastError() after generate kernels
+            discard_error();
+            return;
+        }
+        hipStreamCaptureStatus capture_status;
+        if(!attributes.isManaged
+            || hipStreamIsCapturing(m_stream, &capture_status) != hipSuccess
+            || capture_status != hipStreamCaptureStatusNone)
+        {
+            return;
+        }
+        if(hipMemPrefetchAsync(data, bytes, attributes.device, m_stream) != hipSuccess)
+        {
+            discard_error();
+            return;
+        }
+        m_data = data;
+        m_to_host = policy == ROCRAND_MANAGED_POLICY_PREFETCH_HOST;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+
+    ~managed_output_prefetch()
     {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_normal(output_data, n,
-                                                   mean, stddev);
+        if(m_to_host && hipPeekAtLastError() == hipSuccess
+            && hipMemPrefetchAsync(m_data, m_bytes, hipCpuDeviceId, m_stream) != hipSuccess)
+        {
+            discard_error();
+        }
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+
+private:
+    const void * m_data;
+    size_t m_bytes;
+    hipStream_t m_stream;
+    bool m_to_host;
+
+    // Clears the error of a failed hint, there was no error before it
+    static void discard_error()
     {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_normal(output_data, n,
-                                                         mean, stddev);
+        if(hipPeekAtLastError() != hipSuccess)
+            (void)hipGetLastError();
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+
+    managed_output_prefetch(const managed_output_prefetch&) = delete;
+    managed_output_prefetch& operator=(const managed_output_prefetch&) = delete;
+};
+
+// Converts pitch in bytes of rows of width values of T to the number of values,
+// rows must not overlap and must be aligned like T
+template<class T>
+rocrand_status get_row_pitch(const size_t pitch, const size_t width, size_t& row_pitch)
+{
+    if(pitch % sizeof(T) != 0 || pitch / sizeof(T) < width)
     {
-        rocrand_sobol32 * rocrand_sobol32_generator =
-            static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_normal(output_data, n,
-                                                          mean, stddev);
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    row_pitch = pitch / sizeof(T);
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+// Generates rows of a pitched buffer one by one with generate(data, n),
+// for generators without kernels for pitched buffers
+template<class T, class Generate>
+rocrand_status generate_rows(T * output_data,
+                             const size_t row_pitch,
+                             const size_t width,
+                             const size_t height,
+                             Generate generate)
+{
+    for(size_t row = 0; row < height; row++)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_normal(output_data, n,
-                                                         mean, stddev);
+        const rocrand_status status = generate(output_data + row * row_pitch, width);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
     }
-
-    return ROCRAND_STATUS_TYPE_ERROR;
+    return ROCRAND_STATUS_SUCCESS;
 }
 
-rocrand_status ROCRANDAPI
-rocrand_generate_log_normal(rocrand_generator generator,
-                            float * output_data, size_t n,
-                            float mean, float stddev)
+// Generators of 8-bit outputs (rocrand_generate_uniform_int8() etc.)
+template<class T>
+rocrand_status generate_uniform_8bit(rocrand_generator generator, T * output_data, size_t n)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
 
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        rocrand_philox4x32_10 * philox4x32_10_generator =
-            static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_log_normal(output_data, n,
-                                                            mean, stddev);
+        return static_cast<rocrand_philox4x32_10 *>(generator)->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7 *>(generator)->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10 *>(generator)->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20 *>(generator)->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20 *>(generator)->generate_uniform(output_data, n);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_log_normal(output_data, n,
-                                                       mean, stddev);
+        return static_cast<rocrand_mrg32k3a *>(generator)->generate_uniform(output_data, n);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_log_normal(output_data, n,
-                                                             mean, stddev);
+        return static_cast<rocrand_xorwow *>(generator)->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->generate_uniform(output_data, n);
     }
     else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
     {
-        rocrand_sobol32 * rocrand_sobol32_generator =
-            static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_log_normal(output_data, n,
-                                                              mean, stddev);
+        return static_cast<rocrand_sobol32 *>(generator)->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        return static_cast<rocrand_scrambled_sobol32 *>(generator)->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return static_cast<rocrand_sobol64 *>(generator)->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64 *>(generator)->generate_uniform(output_data, n);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_log_normal(output_data, n,
-                                                             mean, stddev);
+        return static_cast<rocrand_mtgp32 *>(generator)->generate_uniform(output_data, n);
     }
+
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
-rocrand_status ROCRANDAPI
-rocrand_generate_log_normal_double(rocrand_generator generator,
-                                   double * output_data, size_t n,
-                                   double mean, double stddev)
+// Mean and standard deviation of 8-bit outputs are floats, so distributions
+// are passed to generate() directly instead of generate_normal()
+// (the Box-Muller transform is always used)
+template<class T>
+rocrand_status generate_normal_8bit(rocrand_generator generator, T * output_data, size_t n,
+                                    float mean, float stddev)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
 
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    const normal_distribution<T> distribution(mean, stddev);
+    const mrg_normal_distribution<T> mrg_distribution(mean, stddev);
+    const sobol_normal_distribution<T> sobol_distribution(mean, stddev);
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        rocrand_philox4x32_10 * philox4x32_10_generator =
-            static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_log_normal(output_data, n,
-                                                            mean, stddev);
+        return static_cast<rocrand_philox4x32_10 *>(generator)->generate(output_data, n, distribution);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
     {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_log_normal(output_data, n,
-                                                       mean, stddev);
+        return static_cast<rocrand_philox4x32_7 *>(generator)->generate(output_data, n, distribution);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
     {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_log_normal(output_data, n,
-                                                             mean, stddev);
+        return static_cast<rocrand_philox4x64_10 *>(generator)->generate(output_data, n, distribution);
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20 *>(generator)->generate(output_data, n, distribution);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20 *>(generator)->generate(output_data, n, distribution);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)->generate(output_data, n, mrg_distribution);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->generate(output_data, n, distribution);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)->generate(output_data, n, distribution);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->generate(output_data, n, distribution);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return static_cast<rocrand_sobol32 *>(generator)->generate(output_data, n, sobol_distribution);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        return static_cast<rocrand_scrambled_sobol32 *>(generator)->generate(output_data, n, sobol_distribution);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return static_cast<rocrand_sobol64 *>(generator)->generate(output_data, n, sobol_distribution);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64 *>(generator)->generate(output_data, n, sobol_distribution);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32 *>(generator)->generate(output_data, n, distribution);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+// Generates a tile of a random matrix (rocrand_generate_matrix_*())
+template<class Distribution>
+rocrand_status generate_matrix(rocrand_generator generator,
+                               unsigned long long matrix_id,
+                               float * output_data, size_t pitch,
+                               unsigned long long row, unsigned long long col,
+                               size_t width, size_t height,
+                               Distribution distribution,
+                               float mean, float stddev)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    size_t row_pitch;
+    const rocrand_status status = get_row_pitch<float>(pitch, width, row_pitch);
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    const managed_output_prefetch prefetch(
+        generator, output_data, height == 0 ? 0 : pitch * (height - 1) + width * sizeof(*output_data)
+    );
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->generate_matrix(
+            matrix_id, output_data, row_pitch, row, col, width, height,
+            distribution, mean, stddev
+        );
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+using rocrand_xorwow_multi_device = rocrand_multi_device<rocrand_xorwow>;
+using rocrand_mrg32k3a_multi_device = rocrand_multi_device<rocrand_mrg32k3a>;
+using rocrand_xoshiro128pp_multi_device = rocrand_multi_device<rocrand_xoshiro128pp>;
+using rocrand_pcg32_multi_device = rocrand_multi_device<rocrand_pcg32>;
+using rocrand_sobol32_multi_device = rocrand_multi_device<rocrand_sobol32>;
+using rocrand_scrambled_sobol32_multi_device = rocrand_multi_device<rocrand_scrambled_sobol32>;
+using rocrand_sobol64_multi_device = rocrand_multi_device<rocrand_sobol64>;
+using rocrand_scrambled_sobol64_multi_device = rocrand_multi_device<rocrand_scrambled_sobol64>;
+
+#ifndef ROCRAND_DISABLE_XORWOW
+using rocrand_xorwow_stream_producer =
+    rocrand_engine_stream_producer<rocrand_host::detail::xorwow_device_engine>;
+#else
+using rocrand_xorwow_stream_producer = rocrand_disabled_stream_producer;
+#endif
+#ifndef ROCRAND_DISABLE_PHILOX4_32_10
+using rocrand_philox4x32_10_stream_producer =
+    rocrand_engine_stream_producer<rocrand_host::detail::philox4x32_10_device_engine>;
+#else
+using rocrand_philox4x32_10_stream_producer = rocrand_disabled_stream_producer;
+#endif
+
+} // end namespace
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+rocrand_status ROCRANDAPI
+rocrand_create_generator(rocrand_generator * generator, rocrand_rng_type rng_type)
+{
+    try
+    {
+        if(rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+        {
+            *generator = new rocrand_philox4x32_10();
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+        {
+            *generator = new rocrand_philox4x32_7();
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+        {
+            *generator = new rocrand_philox4x64_10();
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+        {
+            *generator = new rocrand_threefry2x64_20();
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+        {
+            *generator = new rocrand_threefry4x64_20();
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+        {
+            *generator = new rocrand_mrg32k3a();
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_XORWOW
+                    || rng_type == ROCRAND_RNG_PSEUDO_DEFAULT)
+        {
+            *generator = new rocrand_xorwow();
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+        {
+            *generator = new rocrand_xoshiro128pp();
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+        {
+            *generator = new rocrand_pcg32();
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_SOBOL32
+                    || rng_type == ROCRAND_RNG_QUASI_DEFAULT)
+        {
+            *generator = new rocrand_sobol32();
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+        {
+            *generator = new rocrand_scrambled_sobol32();
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+        {
+            *generator = new rocrand_sobol64();
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+        {
+            *generator = new rocrand_scrambled_sobol64();
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_LATTICE32)
+        {
+            *generator = new rocrand_lattice32();
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_HALTON32)
+        {
+            *generator = new rocrand_halton32();
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32)
+        {
+            *generator = new rocrand_scrambled_halton32();
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+        {
+            *generator = new rocrand_mtgp32();
+        }
+        else
+        {
+            return ROCRAND_STATUS_TYPE_ERROR;
+        }
+    }
+    catch(const std::bad_alloc& e)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    catch(rocrand_status status)
+    {
+        return status;
+    }
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_create_generator_host(rocrand_generator * generator, rocrand_rng_type rng_type)
+{
+    try
+    {
+        if(rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+        {
+            *generator = new rocrand_philox4x32_10(0, 0, 0, true);
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+        {
+            *generator = new rocrand_philox4x32_7(0, 0, 0, true);
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+        {
+            *generator = new rocrand_philox4x64_10(0, 0, 0, true);
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+        {
+            *generator = new rocrand_threefry2x64_20(0, 0, 0, true);
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+        {
+            *generator = new rocrand_threefry4x64_20(0, 0, 0, true);
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+        {
+            *generator = new rocrand_mrg32k3a(0, 0, 0, true);
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_XORWOW
+                    || rng_type == ROCRAND_RNG_PSEUDO_DEFAULT)
+        {
+            *generator = new rocrand_xorwow(0, 0, 0, true);
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+        {
+            *generator = new rocrand_xoshiro128pp(0, 0, 0, true);
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+        {
+            *generator = new rocrand_pcg32(0, 0, 0, true);
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_SOBOL32
+                    || rng_type == ROCRAND_RNG_QUASI_DEFAULT)
+        {
+            *generator = new rocrand_sobol32(0, 0, true);
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+        {
+            *generator = new rocrand_scrambled_sobol32(0, 0, true);
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+        {
+            *generator = new rocrand_sobol64(0, 0, true);
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+        {
+            *generator = new rocrand_scrambled_sobol64(0, 0, true);
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_LATTICE32)
+        {
+            *generator = new rocrand_lattice32(0, 0, true);
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_HALTON32)
+        {
+            *generator = new rocrand_halton32(0, 0, true);
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32)
+        {
+            *generator = new rocrand_scrambled_halton32(0, 0, true);
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+        {
+            *generator = new rocrand_mtgp32(0, 0, 0, true);
+        }
+        else
+        {
+            return ROCRAND_STATUS_TYPE_ERROR;
+        }
+    }
+    catch(const std::bad_alloc& e)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    catch(rocrand_status status)
+    {
+        return status;
+    }
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_create_generator_group(rocrand_generator_group * group)
+{
+    if(group == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    try
+    {
+        *group = new rocrand_generator_group_type();
+    }
+    catch(const std::bad_alloc& e)
+    {
+        return ROCRAND_STATUS_ALLOCATION_FAILED;
+    }
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_destroy_generator_group(rocrand_generator_group group)
+{
+    if(group == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    group->release();
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_create_generator_in_group(rocrand_generator * generator,
+                                  rocrand_rng_type rng_type,
+                                  rocrand_generator_group group,
+                                  unsigned int engines_count)
+{
+    if(group == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    try
+    {
+        if(rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+        {
+            *generator = new rocrand_mrg32k3a(0, 0, 0, false, group, engines_count);
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_XORWOW
+                    || rng_type == ROCRAND_RNG_PSEUDO_DEFAULT)
+        {
+            *generator = new rocrand_xorwow(0, 0, 0, false, group, engines_count);
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+        {
+            *generator = new rocrand_xoshiro128pp(0, 0, 0, false, group, engines_count);
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+        {
+            *generator = new rocrand_pcg32(0, 0, 0, false, group, engines_count);
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+        {
+            *generator = new rocrand_mtgp32(0, 0, 0, false, group, engines_count);
+        }
+        else
+        {
+            // No arrays of engines
+            return rocrand_create_generator(generator, rng_type);
+        }
+    }
+    catch(const std::bad_alloc& e)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    catch(rocrand_status status)
+    {
+        return status;
+    }
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_get_generator_group_size(rocrand_generator_group group, size_t * bytes)
+{
+    if(group == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(bytes == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    *bytes = group->get_reserved_bytes();
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_destroy_generator(rocrand_generator generator)
+{
+    try
+    {
+        delete(generator);
+    }
+    catch(rocrand_status status)
+    {
+        return status;
+    }
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generator_split(rocrand_generator parent,
+                        unsigned int count,
+                        rocrand_generator * children)
+{
+    if(parent == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(children == NULL && count != 0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(parent->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(parent)->split(count, children);
+    }
+    else if(parent->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(parent)->split(count, children);
+    }
+    else if(parent->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(parent)->split(count, children);
+    }
+    else if(parent->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(parent)->split(count, children);
+    }
+    else if(parent->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(parent)->split(count, children);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate(rocrand_generator generator,
+                 unsigned int * output_data, size_t n)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32 * rocrand_scrambled_sobol32_generator =
+            static_cast<rocrand_scrambled_sobol32 *>(generator);
+        return rocrand_scrambled_sobol32_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64 * rocrand_sobol64_generator =
+            static_cast<rocrand_sobol64 *>(generator);
+        return rocrand_sobol64_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64 * rocrand_scrambled_sobol64_generator =
+            static_cast<rocrand_scrambled_sobol64 *>(generator);
+        return rocrand_scrambled_sobol64_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE32)
+    {
+        rocrand_lattice32 * rocrand_lattice32_generator =
+            static_cast<rocrand_lattice32 *>(generator);
+        return rocrand_lattice32_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON32)
+    {
+        rocrand_halton32 * rocrand_halton32_generator =
+            static_cast<rocrand_halton32 *>(generator);
+        return rocrand_halton32_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32)
+    {
+        rocrand_scrambled_halton32 * rocrand_scrambled_halton32_generator =
+            static_cast<rocrand_scrambled_halton32 *>(generator);
+        return rocrand_scrambled_halton32_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate(output_data, n);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_char(rocrand_generator generator,
+                      unsigned char * output_data, size_t n)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32 * rocrand_scrambled_sobol32_generator =
+            static_cast<rocrand_scrambled_sobol32 *>(generator);
+        return rocrand_scrambled_sobol32_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64 * rocrand_sobol64_generator =
+            static_cast<rocrand_sobol64 *>(generator);
+        return rocrand_sobol64_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64 * rocrand_scrambled_sobol64_generator =
+            static_cast<rocrand_scrambled_sobol64 *>(generator);
+        return rocrand_scrambled_sobol64_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate(output_data, n);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_short(rocrand_generator generator,
+                       unsigned short * output_data, size_t n)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32 * rocrand_scrambled_sobol32_generator =
+            static_cast<rocrand_scrambled_sobol32 *>(generator);
+        return rocrand_scrambled_sobol32_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64 * rocrand_sobol64_generator =
+            static_cast<rocrand_sobol64 *>(generator);
+        return rocrand_sobol64_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64 * rocrand_scrambled_sobol64_generator =
+            static_cast<rocrand_scrambled_sobol64 *>(generator);
+        return rocrand_scrambled_sobol64_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate(output_data, n);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_long_long(rocrand_generator generator,
+                           unsigned long long * output_data, size_t n)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32 * rocrand_scrambled_sobol32_generator =
+            static_cast<rocrand_scrambled_sobol32 *>(generator);
+        return rocrand_scrambled_sobol32_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64 * rocrand_sobol64_generator =
+            static_cast<rocrand_sobol64 *>(generator);
+        return rocrand_sobol64_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64 * rocrand_scrambled_sobol64_generator =
+            static_cast<rocrand_scrambled_sobol64 *>(generator);
+        return rocrand_scrambled_sobol64_generator->generate(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate(output_data, n);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_uint_range(rocrand_generator generator,
+                                    unsigned int * output_data, size_t n,
+                                    unsigned int lo, unsigned int hi)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(hi <= lo)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_uniform_range(output_data, n,
+                                                              lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate_uniform_range(output_data, n,
+                                                              lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_uniform_range(output_data, n,
+                                                              lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_uniform_range(output_data, n,
+                                                              lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate_uniform_range(output_data, n,
+                                                              lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_uniform_range(output_data, n,
+                                                         lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_uniform_range(output_data, n,
+                                                               lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_uniform_range(output_data, n,
+                                                               lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_uniform_range(output_data, n,
+                                                               lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate_uniform_range(output_data, n,
+                                                                lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32 * rocrand_scrambled_sobol32_generator =
+            static_cast<rocrand_scrambled_sobol32 *>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_uniform_range(output_data, n,
+                                                                          lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64 * rocrand_sobol64_generator =
+            static_cast<rocrand_sobol64 *>(generator);
+        return rocrand_sobol64_generator->generate_uniform_range(output_data, n,
+                                                                lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64 * rocrand_scrambled_sobol64_generator =
+            static_cast<rocrand_scrambled_sobol64 *>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_uniform_range(output_data, n,
+                                                                          lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_uniform_range(output_data, n,
+                                                               lo, hi - lo);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_ulonglong_range(rocrand_generator generator,
+                                         unsigned long long * output_data, size_t n,
+                                         unsigned long long lo, unsigned long long hi)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(hi <= lo)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_uniform_range(output_data, n,
+                                                              lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate_uniform_range(output_data, n,
+                                                              lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_uniform_range(output_data, n,
+                                                              lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_uniform_range(output_data, n,
+                                                              lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate_uniform_range(output_data, n,
+                                                              lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_uniform_range(output_data, n,
+                                                         lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_uniform_range(output_data, n,
+                                                               lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_uniform_range(output_data, n,
+                                                               lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_uniform_range(output_data, n,
+                                                               lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate_uniform_range(output_data, n,
+                                                                lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32 * rocrand_scrambled_sobol32_generator =
+            static_cast<rocrand_scrambled_sobol32 *>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_uniform_range(output_data, n,
+                                                                          lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64 * rocrand_sobol64_generator =
+            static_cast<rocrand_sobol64 *>(generator);
+        return rocrand_sobol64_generator->generate_uniform_range(output_data, n,
+                                                                lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64 * rocrand_scrambled_sobol64_generator =
+            static_cast<rocrand_scrambled_sobol64 *>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_uniform_range(output_data, n,
+                                                                          lo, hi - lo);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_uniform_range(output_data, n,
+                                                               lo, hi - lo);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform(rocrand_generator generator,
+                         float * output_data, size_t n)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32 * rocrand_scrambled_sobol32_generator =
+            static_cast<rocrand_scrambled_sobol32 *>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64 * rocrand_sobol64_generator =
+            static_cast<rocrand_sobol64 *>(generator);
+        return rocrand_sobol64_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64 * rocrand_scrambled_sobol64_generator =
+            static_cast<rocrand_scrambled_sobol64 *>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE32)
+    {
+        rocrand_lattice32 * rocrand_lattice32_generator =
+            static_cast<rocrand_lattice32 *>(generator);
+        return rocrand_lattice32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON32)
+    {
+        rocrand_halton32 * rocrand_halton32_generator =
+            static_cast<rocrand_halton32 *>(generator);
+        return rocrand_halton32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32)
+    {
+        rocrand_scrambled_halton32 * rocrand_scrambled_halton32_generator =
+            static_cast<rocrand_scrambled_halton32 *>(generator);
+        return rocrand_scrambled_halton32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_uniform(output_data, n);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_double(rocrand_generator generator,
+                                double * output_data, size_t n)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32 * rocrand_scrambled_sobol32_generator =
+            static_cast<rocrand_scrambled_sobol32 *>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64 * rocrand_sobol64_generator =
+            static_cast<rocrand_sobol64 *>(generator);
+        return rocrand_sobol64_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64 * rocrand_scrambled_sobol64_generator =
+            static_cast<rocrand_scrambled_sobol64 *>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE32)
+    {
+        rocrand_lattice32 * rocrand_lattice32_generator =
+            static_cast<rocrand_lattice32 *>(generator);
+        return rocrand_lattice32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON32)
+    {
+        rocrand_halton32 * rocrand_halton32_generator =
+            static_cast<rocrand_halton32 *>(generator);
+        return rocrand_halton32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32)
+    {
+        rocrand_scrambled_halton32 * rocrand_scrambled_halton32_generator =
+            static_cast<rocrand_scrambled_halton32 *>(generator);
+        return rocrand_scrambled_halton32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_uniform(output_data, n);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_half(rocrand_generator generator,
+                              half * output_data, size_t n)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32 * rocrand_scrambled_sobol32_generator =
+            static_cast<rocrand_scrambled_sobol32 *>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64 * rocrand_sobol64_generator =
+            static_cast<rocrand_sobol64 *>(generator);
+        return rocrand_sobol64_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64 * rocrand_scrambled_sobol64_generator =
+            static_cast<rocrand_scrambled_sobol64 *>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_uniform(output_data, n);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_bfloat16(rocrand_generator generator,
+                                  bfloat16 * output_data, size_t n)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32 * rocrand_scrambled_sobol32_generator =
+            static_cast<rocrand_scrambled_sobol32 *>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64 * rocrand_sobol64_generator =
+            static_cast<rocrand_sobol64 *>(generator);
+        return rocrand_sobol64_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64 * rocrand_scrambled_sobol64_generator =
+            static_cast<rocrand_scrambled_sobol64 *>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_uniform(output_data, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_uniform(output_data, n);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_int8(rocrand_generator generator,
+                              signed char * output_data, size_t n)
+{
+    return generate_uniform_8bit(generator, output_data, n);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_fp8_e4m3(rocrand_generator generator,
+                                  rocrand_fp8_e4m3 * output_data, size_t n)
+{
+    return generate_uniform_8bit(generator, output_data, n);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_fp8_e5m2(rocrand_generator generator,
+                                  rocrand_fp8_e5m2 * output_data, size_t n)
+{
+    return generate_uniform_8bit(generator, output_data, n);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal(rocrand_generator generator,
+                        float * output_data, size_t n,
+                        float mean, float stddev)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_normal(output_data, n,
+                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate_normal(output_data, n,
+                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_normal(output_data, n,
+                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_normal(output_data, n,
+                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate_normal(output_data, n,
+                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_normal(output_data, n,
+                                                   mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_normal(output_data, n,
+                                                         mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_normal(output_data, n,
+                                                         mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_normal(output_data, n,
+                                                         mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate_normal(output_data, n,
+                                                          mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32 * rocrand_scrambled_sobol32_generator =
+            static_cast<rocrand_scrambled_sobol32 *>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_normal(output_data, n,
+                                                                    mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64 * rocrand_sobol64_generator =
+            static_cast<rocrand_sobol64 *>(generator);
+        return rocrand_sobol64_generator->generate_normal(output_data, n,
+                                                          mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64 * rocrand_scrambled_sobol64_generator =
+            static_cast<rocrand_scrambled_sobol64 *>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_normal(output_data, n,
+                                                                    mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE32)
+    {
+        rocrand_lattice32 * rocrand_lattice32_generator =
+            static_cast<rocrand_lattice32 *>(generator);
+        return rocrand_lattice32_generator->generate_normal(output_data, n,
+                                                                    mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON32)
+    {
+        rocrand_halton32 * rocrand_halton32_generator =
+            static_cast<rocrand_halton32 *>(generator);
+        return rocrand_halton32_generator->generate_normal(output_data, n,
+                                                                    mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32)
+    {
+        rocrand_scrambled_halton32 * rocrand_scrambled_halton32_generator =
+            static_cast<rocrand_scrambled_halton32 *>(generator);
+        return rocrand_scrambled_halton32_generator->generate_normal(output_data, n,
+                                                                    mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_normal(output_data, n,
+                                                         mean, stddev);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_double(rocrand_generator generator,
+                               double * output_data, size_t n,
+                               double mean, double stddev)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_normal(output_data, n,
+                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate_normal(output_data, n,
+                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_normal(output_data, n,
+                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_normal(output_data, n,
+                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate_normal(output_data, n,
+                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_normal(output_data, n,
+                                                   mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_normal(output_data, n,
+                                                         mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_normal(output_data, n,
+                                                         mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_normal(output_data, n,
+                                                         mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate_normal(output_data, n,
+                                                          mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32 * rocrand_scrambled_sobol32_generator =
+            static_cast<rocrand_scrambled_sobol32 *>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_normal(output_data, n,
+                                                                    mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64 * rocrand_sobol64_generator =
+            static_cast<rocrand_sobol64 *>(generator);
+        return rocrand_sobol64_generator->generate_normal(output_data, n,
+                                                          mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64 * rocrand_scrambled_sobol64_generator =
+            static_cast<rocrand_scrambled_sobol64 *>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_normal(output_data, n,
+                                                                    mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE32)
+    {
+        rocrand_lattice32 * rocrand_lattice32_generator =
+            static_cast<rocrand_lattice32 *>(generator);
+        return rocrand_lattice32_generator->generate_normal(output_data, n,
+                                                                    mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON32)
+    {
+        rocrand_halton32 * rocrand_halton32_generator =
+            static_cast<rocrand_halton32 *>(generator);
+        return rocrand_halton32_generator->generate_normal(output_data, n,
+                                                                    mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32)
+    {
+        rocrand_scrambled_halton32 * rocrand_scrambled_halton32_generator =
+            static_cast<rocrand_scrambled_halton32 *>(generator);
+        return rocrand_scrambled_halton32_generator->generate_normal(output_data, n,
+                                                                    mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_normal(output_data, n,
+                                                         mean, stddev);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_half(rocrand_generator generator,
+                             half * output_data, size_t n,
+                             half mean, half stddev)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_normal(output_data, n,
+                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate_normal(output_data, n,
+                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_normal(output_data, n,
+                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_normal(output_data, n,
+                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate_normal(output_data, n,
+                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_normal(output_data, n,
+                                                   mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_normal(output_data, n,
+                                                         mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_normal(output_data, n,
+                                                         mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_normal(output_data, n,
+                                                         mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate_normal(output_data, n,
+                                                          mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32 * rocrand_scrambled_sobol32_generator =
+            static_cast<rocrand_scrambled_sobol32 *>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_normal(output_data, n,
+                                                                    mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64 * rocrand_sobol64_generator =
+            static_cast<rocrand_sobol64 *>(generator);
+        return rocrand_sobol64_generator->generate_normal(output_data, n,
+                                                          mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64 * rocrand_scrambled_sobol64_generator =
+            static_cast<rocrand_scrambled_sobol64 *>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_normal(output_data, n,
+                                                                    mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_normal(output_data, n,
+                                                         mean, stddev);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_bfloat16(rocrand_generator generator,
+                                 bfloat16 * output_data, size_t n,
+                                 bfloat16 mean, bfloat16 stddev)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_normal(output_data, n,
+                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate_normal(output_data, n,
+                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_normal(output_data, n,
+                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_normal(output_data, n,
+                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate_normal(output_data, n,
+                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_normal(output_data, n,
+                                                   mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_normal(output_data, n,
+                                                         mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_normal(output_data, n,
+                                                         mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_normal(output_data, n,
+                                                         mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate_normal(output_data, n,
+                                                          mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32 * rocrand_scrambled_sobol32_generator =
+            static_cast<rocrand_scrambled_sobol32 *>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_normal(output_data, n,
+                                                                    mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64 * rocrand_sobol64_generator =
+            static_cast<rocrand_sobol64 *>(generator);
+        return rocrand_sobol64_generator->generate_normal(output_data, n,
+                                                          mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64 * rocrand_scrambled_sobol64_generator =
+            static_cast<rocrand_scrambled_sobol64 *>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_normal(output_data, n,
+                                                                    mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_normal(output_data, n,
+                                                         mean, stddev);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_int8(rocrand_generator generator,
+                             signed char * output_data, size_t n,
+                             float mean, float stddev)
+{
+    return generate_normal_8bit(generator, output_data, n, mean, stddev);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_fp8_e4m3(rocrand_generator generator,
+                                 rocrand_fp8_e4m3 * output_data, size_t n,
+                                 float mean, float stddev)
+{
+    return generate_normal_8bit(generator, output_data, n, mean, stddev);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_fp8_e5m2(rocrand_generator generator,
+                                 rocrand_fp8_e5m2 * output_data, size_t n,
+                                 float mean, float stddev)
+{
+    return generate_normal_8bit(generator, output_data, n, mean, stddev);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_log_normal(rocrand_generator generator,
+                            float * output_data, size_t n,
+                            float mean, float stddev)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_log_normal(output_data, n,
+                                                            mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate_log_normal(output_data, n,
+                                                            mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_log_normal(output_data, n,
+                                                            mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_log_normal(output_data, n,
+                                                            mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate_log_normal(output_data, n,
+                                                            mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_log_normal(output_data, n,
+                                                       mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_log_normal(output_data, n,
+                                                             mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_log_normal(output_data, n,
+                                                             mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_log_normal(output_data, n,
+                                                             mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate_log_normal(output_data, n,
+                                                              mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32 * rocrand_scrambled_sobol32_generator =
+            static_cast<rocrand_scrambled_sobol32 *>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_log_normal(output_data, n,
+                                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64 * rocrand_sobol64_generator =
+            static_cast<rocrand_sobol64 *>(generator);
+        return rocrand_sobol64_generator->generate_log_normal(output_data, n,
+                                                              mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64 * rocrand_scrambled_sobol64_generator =
+            static_cast<rocrand_scrambled_sobol64 *>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_log_normal(output_data, n,
+                                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE32)
+    {
+        rocrand_lattice32 * rocrand_lattice32_generator =
+            static_cast<rocrand_lattice32 *>(generator);
+        return rocrand_lattice32_generator->generate_log_normal(output_data, n,
+                                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON32)
+    {
+        rocrand_halton32 * rocrand_halton32_generator =
+            static_cast<rocrand_halton32 *>(generator);
+        return rocrand_halton32_generator->generate_log_normal(output_data, n,
+                                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32)
+    {
+        rocrand_scrambled_halton32 * rocrand_scrambled_halton32_generator =
+            static_cast<rocrand_scrambled_halton32 *>(generator);
+        return rocrand_scrambled_halton32_generator->generate_log_normal(output_data, n,
+                                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_log_normal(output_data, n,
+                                                             mean, stddev);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_log_normal_double(rocrand_generator generator,
+                                   double * output_data, size_t n,
+                                   double mean, double stddev)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_log_normal(output_data, n,
+                                                            mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate_log_normal(output_data, n,
+                                                            mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_log_normal(output_data, n,
+                                                            mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_log_normal(output_data, n,
+                                                            mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate_log_normal(output_data, n,
+                                                            mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_log_normal(output_data, n,
+                                                       mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_log_normal(output_data, n,
+                                                             mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_log_normal(output_data, n,
+                                                             mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_log_normal(output_data, n,
+                                                             mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate_log_normal(output_data, n,
+                                                              mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32 * rocrand_scrambled_sobol32_generator =
+            static_cast<rocrand_scrambled_sobol32 *>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_log_normal(output_data, n,
+                                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64 * rocrand_sobol64_generator =
+            static_cast<rocrand_sobol64 *>(generator);
+        return rocrand_sobol64_generator->generate_log_normal(output_data, n,
+                                                              mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64 * rocrand_scrambled_sobol64_generator =
+            static_cast<rocrand_scrambled_sobol64 *>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_log_normal(output_data, n,
+                                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE32)
+    {
+        rocrand_lattice32 * rocrand_lattice32_generator =
+            static_cast<rocrand_lattice32 *>(generator);
+        return rocrand_lattice32_generator->generate_log_normal(output_data, n,
+                                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON32)
+    {
+        rocrand_halton32 * rocrand_halton32_generator =
+            static_cast<rocrand_halton32 *>(generator);
+        return rocrand_halton32_generator->generate_log_normal(output_data, n,
+                                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32)
+    {
+        rocrand_scrambled_halton32 * rocrand_scrambled_halton32_generator =
+            static_cast<rocrand_scrambled_halton32 *>(generator);
+        return rocrand_scrambled_halton32_generator->generate_log_normal(output_data, n,
+                                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_log_normal(output_data, n,
+                                                             mean, stddev);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_log_normal_half(rocrand_generator generator,
+                                 half * output_data, size_t n,
+                                 half mean, half stddev)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_log_normal(output_data, n,
+                                                            mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate_log_normal(output_data, n,
+                                                            mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_log_normal(output_data, n,
+                                                            mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_log_normal(output_data, n,
+                                                            mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate_log_normal(output_data, n,
+                                                            mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_log_normal(output_data, n,
+                                                       mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_log_normal(output_data, n,
+                                                             mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_log_normal(output_data, n,
+                                                             mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_log_normal(output_data, n,
+                                                             mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate_log_normal(output_data, n,
+                                                              mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32 * rocrand_scrambled_sobol32_generator =
+            static_cast<rocrand_scrambled_sobol32 *>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_log_normal(output_data, n,
+                                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64 * rocrand_sobol64_generator =
+            static_cast<rocrand_sobol64 *>(generator);
+        return rocrand_sobol64_generator->generate_log_normal(output_data, n,
+                                                              mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64 * rocrand_scrambled_sobol64_generator =
+            static_cast<rocrand_scrambled_sobol64 *>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_log_normal(output_data, n,
+                                                                        mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_log_normal(output_data, n,
+                                                             mean, stddev);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_exponential(rocrand_generator generator,
+                             float * output_data, size_t n,
+                             float lambda)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(lambda <= 0.0f)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_exponential(output_data, n,
+                                                             lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate_exponential(output_data, n,
+                                                             lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_exponential(output_data, n,
+                                                             lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_exponential(output_data, n,
+                                                             lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate_exponential(output_data, n,
+                                                             lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_exponential(output_data, n,
+                                                        lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_exponential(output_data, n,
+                                                              lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_exponential(output_data, n,
+                                                              lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_exponential(output_data, n,
+                                                              lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate_exponential(output_data, n,
+                                                               lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32 * rocrand_scrambled_sobol32_generator =
+            static_cast<rocrand_scrambled_sobol32 *>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_exponential(output_data, n,
+                                                                         lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64 * rocrand_sobol64_generator =
+            static_cast<rocrand_sobol64 *>(generator);
+        return rocrand_sobol64_generator->generate_exponential(output_data, n,
+                                                               lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64 * rocrand_scrambled_sobol64_generator =
+            static_cast<rocrand_scrambled_sobol64 *>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_exponential(output_data, n,
+                                                                         lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_exponential(output_data, n,
+                                                              lambda);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_exponential_double(rocrand_generator generator,
+                                    double * output_data, size_t n,
+                                    double lambda)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(lambda <= 0.0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_exponential(output_data, n,
+                                                             lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate_exponential(output_data, n,
+                                                             lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_exponential(output_data, n,
+                                                             lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_exponential(output_data, n,
+                                                             lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate_exponential(output_data, n,
+                                                             lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_exponential(output_data, n,
+                                                        lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_exponential(output_data, n,
+                                                              lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_exponential(output_data, n,
+                                                              lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_exponential(output_data, n,
+                                                              lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate_exponential(output_data, n,
+                                                               lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32 * rocrand_scrambled_sobol32_generator =
+            static_cast<rocrand_scrambled_sobol32 *>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_exponential(output_data, n,
+                                                                         lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64 * rocrand_sobol64_generator =
+            static_cast<rocrand_sobol64 *>(generator);
+        return rocrand_sobol64_generator->generate_exponential(output_data, n,
+                                                               lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64 * rocrand_scrambled_sobol64_generator =
+            static_cast<rocrand_scrambled_sobol64 *>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_exponential(output_data, n,
+                                                                         lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_exponential(output_data, n,
+                                                              lambda);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_gamma(rocrand_generator generator,
+                       float * output_data, size_t n,
+                       float shape, float scale)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(shape <= 0.0f || scale <= 0.0f)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_gamma(output_data, n,
+                                                       shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate_gamma(output_data, n,
+                                                       shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_gamma(output_data, n,
+                                                       shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_gamma(output_data, n,
+                                                       shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate_gamma(output_data, n,
+                                                       shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_gamma(output_data, n,
+                                                  shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_gamma(output_data, n,
+                                                        shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_gamma(output_data, n,
+                                                        shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_gamma(output_data, n,
+                                                        shape, scale);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_gamma_double(rocrand_generator generator,
+                              double * output_data, size_t n,
+                              double shape, double scale)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(shape <= 0.0 || scale <= 0.0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_gamma(output_data, n,
+                                                       shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate_gamma(output_data, n,
+                                                       shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_gamma(output_data, n,
+                                                       shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_gamma(output_data, n,
+                                                       shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate_gamma(output_data, n,
+                                                       shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_gamma(output_data, n,
+                                                  shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_gamma(output_data, n,
+                                                        shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_gamma(output_data, n,
+                                                        shape, scale);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_gamma(output_data, n,
+                                                        shape, scale);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_beta(rocrand_generator generator,
+                      float * output_data, size_t n,
+                      float alpha, float beta)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(alpha <= 0.0f || beta <= 0.0f)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_beta(output_data, n,
+                                                      alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate_beta(output_data, n,
+                                                      alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_beta(output_data, n,
+                                                      alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_beta(output_data, n,
+                                                      alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate_beta(output_data, n,
+                                                      alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_beta(output_data, n,
+                                                 alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_beta(output_data, n,
+                                                       alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_beta(output_data, n,
+                                                       alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_beta(output_data, n,
+                                                       alpha, beta);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_beta_double(rocrand_generator generator,
+                             double * output_data, size_t n,
+                             double alpha, double beta)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(alpha <= 0.0 || beta <= 0.0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_beta(output_data, n,
+                                                      alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate_beta(output_data, n,
+                                                      alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_beta(output_data, n,
+                                                      alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_beta(output_data, n,
+                                                      alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate_beta(output_data, n,
+                                                      alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_beta(output_data, n,
+                                                 alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_beta(output_data, n,
+                                                       alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_beta(output_data, n,
+                                                       alpha, beta);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_beta(output_data, n,
+                                                       alpha, beta);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_truncated_normal(rocrand_generator generator,
+                                  float * output_data, size_t n,
+                                  float mean, float stddev,
+                                  float lo, float hi)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    // Negated comparisons reject NaNs
+    if(!(stddev > 0.0f) || !(lo < hi))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    if(!truncated_normal_distribution<float>(mean, stddev, lo, hi).is_valid())
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->generate_truncated_normal(
+            output_data, n, mean, stddev, lo, hi
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7 *>(generator)->generate_truncated_normal(
+            output_data, n, mean, stddev, lo, hi
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10 *>(generator)->generate_truncated_normal(
+            output_data, n, mean, stddev, lo, hi
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20 *>(generator)->generate_truncated_normal(
+            output_data, n, mean, stddev, lo, hi
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20 *>(generator)->generate_truncated_normal(
+            output_data, n, mean, stddev, lo, hi
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)->generate_truncated_normal(
+            output_data, n, mean, stddev, lo, hi
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->generate_truncated_normal(
+            output_data, n, mean, stddev, lo, hi
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)->generate_truncated_normal(
+            output_data, n, mean, stddev, lo, hi
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->generate_truncated_normal(
+            output_data, n, mean, stddev, lo, hi
+        );
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_truncated_normal_double(rocrand_generator generator,
+                                         double * output_data, size_t n,
+                                         double mean, double stddev,
+                                         double lo, double hi)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    // Negated comparisons reject NaNs
+    if(!(stddev > 0.0) || !(lo < hi))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    if(!truncated_normal_distribution<double>(mean, stddev, lo, hi).is_valid())
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->generate_truncated_normal(
+            output_data, n, mean, stddev, lo, hi
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7 *>(generator)->generate_truncated_normal(
+            output_data, n, mean, stddev, lo, hi
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10 *>(generator)->generate_truncated_normal(
+            output_data, n, mean, stddev, lo, hi
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20 *>(generator)->generate_truncated_normal(
+            output_data, n, mean, stddev, lo, hi
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20 *>(generator)->generate_truncated_normal(
+            output_data, n, mean, stddev, lo, hi
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)->generate_truncated_normal(
+            output_data, n, mean, stddev, lo, hi
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->generate_truncated_normal(
+            output_data, n, mean, stddev, lo, hi
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)->generate_truncated_normal(
+            output_data, n, mean, stddev, lo, hi
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->generate_truncated_normal(
+            output_data, n, mean, stddev, lo, hi
+        );
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_2d(rocrand_generator generator,
+                            float * output_data, size_t pitch,
+                            size_t width, size_t height)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    size_t row_pitch;
+    const rocrand_status status = get_row_pitch<float>(pitch, width, row_pitch);
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    const managed_output_prefetch prefetch(
+        generator, output_data, height == 0 ? 0 : pitch * (height - 1) + width * sizeof(*output_data)
+    );
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->generate_uniform_2d(
+            output_data, row_pitch, width, height
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)->generate_uniform_2d(
+            output_data, row_pitch, width, height
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->generate_uniform_2d(
+            output_data, row_pitch, width, height
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)->generate_uniform_2d(
+            output_data, row_pitch, width, height
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->generate_uniform_2d(
+            output_data, row_pitch, width, height
+        );
+    }
+
+    return generate_rows(
+        output_data, row_pitch, width, height,
+        [=](float * data, size_t n)
+        {
+            return rocrand_generate_uniform(generator, data, n);
+        }
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_double_2d(rocrand_generator generator,
+                                   double * output_data, size_t pitch,
+                                   size_t width, size_t height)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    size_t row_pitch;
+    const rocrand_status status = get_row_pitch<double>(pitch, width, row_pitch);
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    const managed_output_prefetch prefetch(
+        generator, output_data, height == 0 ? 0 : pitch * (height - 1) + width * sizeof(*output_data)
+    );
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->generate_uniform_2d(
+            output_data, row_pitch, width, height
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)->generate_uniform_2d(
+            output_data, row_pitch, width, height
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->generate_uniform_2d(
+            output_data, row_pitch, width, height
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)->generate_uniform_2d(
+            output_data, row_pitch, width, height
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->generate_uniform_2d(
+            output_data, row_pitch, width, height
+        );
+    }
+
+    return generate_rows(
+        output_data, row_pitch, width, height,
+        [=](double * data, size_t n)
+        {
+            return rocrand_generate_uniform_double(generator, data, n);
+        }
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_2d(rocrand_generator generator,
+                           float * output_data, size_t pitch,
+                           size_t width, size_t height,
+                           float mean, float stddev)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    size_t row_pitch;
+    const rocrand_status status = get_row_pitch<float>(pitch, width, row_pitch);
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    const managed_output_prefetch prefetch(
+        generator, output_data, height == 0 ? 0 : pitch * (height - 1) + width * sizeof(*output_data)
+    );
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->generate_normal_2d(
+            output_data, row_pitch, width, height, mean, stddev
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)->generate_normal_2d(
+            output_data, row_pitch, width, height, mean, stddev
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->generate_normal_2d(
+            output_data, row_pitch, width, height, mean, stddev
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)->generate_normal_2d(
+            output_data, row_pitch, width, height, mean, stddev
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->generate_normal_2d(
+            output_data, row_pitch, width, height, mean, stddev
+        );
+    }
+
+    return generate_rows(
+        output_data, row_pitch, width, height,
+        [=](float * data, size_t n)
+        {
+            return rocrand_generate_normal(generator, data, n, mean, stddev);
+        }
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_double_2d(rocrand_generator generator,
+                                  double * output_data, size_t pitch,
+                                  size_t width, size_t height,
+                                  double mean, double stddev)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    size_t row_pitch;
+    const rocrand_status status = get_row_pitch<double>(pitch, width, row_pitch);
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    const managed_output_prefetch prefetch(
+        generator, output_data, height == 0 ? 0 : pitch * (height - 1) + width * sizeof(*output_data)
+    );
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->generate_normal_2d(
+            output_data, row_pitch, width, height, mean, stddev
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)->generate_normal_2d(
+            output_data, row_pitch, width, height, mean, stddev
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->generate_normal_2d(
+            output_data, row_pitch, width, height, mean, stddev
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)->generate_normal_2d(
+            output_data, row_pitch, width, height, mean, stddev
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->generate_normal_2d(
+            output_data, row_pitch, width, height, mean, stddev
+        );
+    }
+
+    return generate_rows(
+        output_data, row_pitch, width, height,
+        [=](double * data, size_t n)
+        {
+            return rocrand_generate_normal_double(generator, data, n, mean, stddev);
+        }
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_substreams(rocrand_generator generator,
+                       unsigned int count,
+                       const hipStream_t * streams)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)->set_substreams(count, streams);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->set_substreams(count, streams);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)->set_substreams(count, streams);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->set_substreams(count, streams);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_on(rocrand_generator generator,
+                    unsigned int substream,
+                    unsigned int * output_data, size_t n)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)->generate_on(
+            substream, output_data, n
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->generate_on(
+            substream, output_data, n
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)->generate_on(
+            substream, output_data, n
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->generate_on(
+            substream, output_data, n
+        );
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_on(rocrand_generator generator,
+                            unsigned int substream,
+                            float * output_data, size_t n)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)->generate_uniform_on(
+            substream, output_data, n
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->generate_uniform_on(
+            substream, output_data, n
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)->generate_uniform_on(
+            substream, output_data, n
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->generate_uniform_on(
+            substream, output_data, n
+        );
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_double_on(rocrand_generator generator,
+                                   unsigned int substream,
+                                   double * output_data, size_t n)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)->generate_uniform_on(
+            substream, output_data, n
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->generate_uniform_on(
+            substream, output_data, n
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)->generate_uniform_on(
+            substream, output_data, n
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->generate_uniform_on(
+            substream, output_data, n
+        );
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_on(rocrand_generator generator,
+                           unsigned int substream,
+                           float * output_data, size_t n,
+                           float mean, float stddev)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)->generate_normal_on(
+            substream, output_data, n, mean, stddev
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->generate_normal_on(
+            substream, output_data, n, mean, stddev
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)->generate_normal_on(
+            substream, output_data, n, mean, stddev
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->generate_normal_on(
+            substream, output_data, n, mean, stddev
+        );
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_double_on(rocrand_generator generator,
+                                  unsigned int substream,
+                                  double * output_data, size_t n,
+                                  double mean, double stddev)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)->generate_normal_on(
+            substream, output_data, n, mean, stddev
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->generate_normal_on(
+            substream, output_data, n, mean, stddev
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)->generate_normal_on(
+            substream, output_data, n, mean, stddev
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->generate_normal_on(
+            substream, output_data, n, mean, stddev
+        );
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_at(rocrand_generator generator,
+                    const unsigned long long * keys,
+                    unsigned int * output_data, size_t n)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->generate_at(
+            keys, output_data, n
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7 *>(generator)->generate_at(
+            keys, output_data, n
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10 *>(generator)->generate_at(
+            keys, output_data, n
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20 *>(generator)->generate_at(
+            keys, output_data, n
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20 *>(generator)->generate_at(
+            keys, output_data, n
+        );
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_at(rocrand_generator generator,
+                            const unsigned long long * keys,
+                            float * output_data, size_t n)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->generate_at(
+            keys, output_data, n
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7 *>(generator)->generate_at(
+            keys, output_data, n
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10 *>(generator)->generate_at(
+            keys, output_data, n
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20 *>(generator)->generate_at(
+            keys, output_data, n
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20 *>(generator)->generate_at(
+            keys, output_data, n
+        );
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_double_at(rocrand_generator generator,
+                                   const unsigned long long * keys,
+                                   double * output_data, size_t n)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->generate_at(
+            keys, output_data, n
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7 *>(generator)->generate_at(
+            keys, output_data, n
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10 *>(generator)->generate_at(
+            keys, output_data, n
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20 *>(generator)->generate_at(
+            keys, output_data, n
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20 *>(generator)->generate_at(
+            keys, output_data, n
+        );
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_at(rocrand_generator generator,
+                           const unsigned long long * keys,
+                           float * output_data, size_t n,
+                           float mean, float stddev)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->generate_normal_at(
+            keys, output_data, n, mean, stddev
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7 *>(generator)->generate_normal_at(
+            keys, output_data, n, mean, stddev
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10 *>(generator)->generate_normal_at(
+            keys, output_data, n, mean, stddev
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20 *>(generator)->generate_normal_at(
+            keys, output_data, n, mean, stddev
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20 *>(generator)->generate_normal_at(
+            keys, output_data, n, mean, stddev
+        );
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_double_at(rocrand_generator generator,
+                                  const unsigned long long * keys,
+                                  double * output_data, size_t n,
+                                  double mean, double stddev)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->generate_normal_at(
+            keys, output_data, n, mean, stddev
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7 *>(generator)->generate_normal_at(
+            keys, output_data, n, mean, stddev
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10 *>(generator)->generate_normal_at(
+            keys, output_data, n, mean, stddev
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20 *>(generator)->generate_normal_at(
+            keys, output_data, n, mean, stddev
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20 *>(generator)->generate_normal_at(
+            keys, output_data, n, mean, stddev
+        );
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_matrix_uniform(rocrand_generator generator,
+                                unsigned long long matrix_id,
+                                float * output_data, size_t pitch,
+                                unsigned long long row, unsigned long long col,
+                                size_t width, size_t height)
+{
+    return generate_matrix(
+        generator, matrix_id, output_data, pitch, row, col, width, height,
+        rocrand_device::detail::matrix_uniform_distribution(), 0.0f, 1.0f
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_matrix_normal(rocrand_generator generator,
+                               unsigned long long matrix_id,
+                               float * output_data, size_t pitch,
+                               unsigned long long row, unsigned long long col,
+                               size_t width, size_t height,
+                               float mean, float stddev)
+{
+    return generate_matrix(
+        generator, matrix_id, output_data, pitch, row, col, width, height,
+        rocrand_device::detail::matrix_normal_distribution(), mean, stddev
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_matrix_rademacher(rocrand_generator generator,
+                                   unsigned long long matrix_id,
+                                   float * output_data, size_t pitch,
+                                   unsigned long long row, unsigned long long col,
+                                   size_t width, size_t height)
+{
+    return generate_matrix(
+        generator, matrix_id, output_data, pitch, row, col, width, height,
+        rocrand_device::detail::matrix_rademacher_distribution(), 0.0f, 1.0f
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_bernoulli(rocrand_generator generator,
+                           unsigned int * output_data, size_t n,
+                           double p)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(!(p >= 0.0 && p <= 1.0))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_bernoulli(output_data, n, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate_bernoulli(output_data, n, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_bernoulli(output_data, n, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_bernoulli(output_data, n, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate_bernoulli(output_data, n, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_bernoulli(output_data, n, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_bernoulli(output_data, n, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_bernoulli(output_data, n, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_bernoulli(output_data, n, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_bernoulli(output_data, n, p);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_bernoulli_char(rocrand_generator generator,
+                                unsigned char * output_data, size_t n,
+                                double p)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(!(p >= 0.0 && p <= 1.0))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_bernoulli(output_data, n, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate_bernoulli(output_data, n, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_bernoulli(output_data, n, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_bernoulli(output_data, n, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate_bernoulli(output_data, n, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_bernoulli(output_data, n, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_bernoulli(output_data, n, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_bernoulli(output_data, n, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_bernoulli(output_data, n, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_bernoulli(output_data, n, p);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_poisson(rocrand_generator generator,
+                         unsigned int * output_data, size_t n,
+                         double lambda)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if (lambda <= 0.0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_poisson(output_data, n,
+                                                         lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate_poisson(output_data, n,
+                                                         lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_poisson(output_data, n,
+                                                         lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_poisson(output_data, n,
+                                                         lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate_poisson(output_data, n,
+                                                         lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_poisson(output_data, n,
+                                                    lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_poisson(output_data, n,
+                                                          lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_poisson(output_data, n,
+                                                          lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_poisson(output_data, n,
+                                                          lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        rocrand_sobol32 * rocrand_sobol32_generator =
+            static_cast<rocrand_sobol32 *>(generator);
+        return rocrand_sobol32_generator->generate_poisson(output_data, n,
+                                                           lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32 * rocrand_scrambled_sobol32_generator =
+            static_cast<rocrand_scrambled_sobol32 *>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_poisson(output_data, n,
+                                                                     lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64 * rocrand_sobol64_generator =
+            static_cast<rocrand_sobol64 *>(generator);
+        return rocrand_sobol64_generator->generate_poisson(output_data, n,
+                                                           lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64 * rocrand_scrambled_sobol64_generator =
+            static_cast<rocrand_scrambled_sobol64 *>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_poisson(output_data, n,
+                                                                     lambda);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_poisson(output_data, n,
+                                                          lambda);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_poisson_array(rocrand_generator generator,
+                               unsigned int * output_data,
+                               const double * lambdas, size_t n)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_poisson_array(output_data, n,
+                                                               lambdas);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate_poisson_array(output_data, n,
+                                                               lambdas);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_poisson_array(output_data, n,
+                                                               lambdas);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_poisson_array(output_data, n,
+                                                               lambdas);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate_poisson_array(output_data, n,
+                                                               lambdas);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_poisson_array(output_data, n,
+                                                          lambdas);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_poisson_array(output_data, n,
+                                                                lambdas);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_poisson_array(output_data, n,
+                                                                lambdas);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_poisson_array(output_data, n,
+                                                                lambdas);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_binomial(rocrand_generator generator,
+                          unsigned int * output_data, size_t n,
+                          unsigned int trials, double p)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(!(p >= 0.0 && p <= 1.0))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_binomial(output_data, n, trials, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate_binomial(output_data, n, trials, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_binomial(output_data, n, trials, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_binomial(output_data, n, trials, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate_binomial(output_data, n, trials, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_binomial(output_data, n, trials, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_binomial(output_data, n, trials, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_binomial(output_data, n, trials, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_binomial(output_data, n, trials, p);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_binomial_array(rocrand_generator generator,
+                                unsigned int * output_data,
+                                const unsigned int * trials, const double * p,
+                                size_t n)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(trials == NULL || p == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_binomial_array(output_data, n, trials, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate_binomial_array(output_data, n, trials, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_binomial_array(output_data, n, trials, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_binomial_array(output_data, n, trials, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate_binomial_array(output_data, n, trials, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_binomial_array(output_data, n, trials, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_binomial_array(output_data, n, trials, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_binomial_array(output_data, n, trials, p);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_binomial_array(output_data, n, trials, p);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_multinomial(rocrand_generator generator,
+                             unsigned int * output_data, size_t n,
+                             unsigned int trials, const double * weights,
+                             unsigned int categories)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(weights == NULL || categories == 0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data,
+                                           n * categories * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_multinomial(output_data, n, trials,
+                                                         weights, categories);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate_multinomial(output_data, n, trials,
+                                                         weights, categories);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_multinomial(output_data, n, trials,
+                                                         weights, categories);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_multinomial(output_data, n, trials,
+                                                         weights, categories);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate_multinomial(output_data, n, trials,
+                                                         weights, categories);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_multinomial(output_data, n, trials,
+                                                         weights, categories);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_multinomial(output_data, n, trials,
+                                                         weights, categories);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_multinomial(output_data, n, trials,
+                                                         weights, categories);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_multinomial(output_data, n, trials,
+                                                         weights, categories);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_discrete(rocrand_generator generator,
+                          unsigned int * output_data, size_t n,
+                          const rocrand_discrete_distribution discrete_distribution)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(discrete_distribution == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    // The histogram is in device memory, generators need table pointers
+    rocrand_discrete_distribution_st tables;
+    hipError_t error = hipMemcpy(&tables, discrete_distribution,
+                                 sizeof(rocrand_discrete_distribution_st),
+                                 hipMemcpyDefault);
+    if(error != hipSuccess)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_discrete(output_data, n,
+                                                         tables);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate_discrete(output_data, n,
+                                                         tables);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_discrete(output_data, n,
+                                                         tables);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_discrete(output_data, n,
+                                                         tables);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate_discrete(output_data, n,
+                                                         tables);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_discrete(output_data, n,
+                                                    tables);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_discrete(output_data, n,
+                                                          tables);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_discrete(output_data, n,
+                                                          tables);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_discrete(output_data, n,
+                                                          tables);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
     {
         rocrand_sobol32 * rocrand_sobol32_generator =
             static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_log_normal(output_data, n,
-                                                              mean, stddev);
+        return rocrand_sobol32_generator->generate_discrete(output_data, n,
+                                                           tables);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        rocrand_scrambled_sobol32 * rocrand_scrambled_sobol32_generator =
+            static_cast<rocrand_scrambled_sobol32 *>(generator);
+        return rocrand_scrambled_sobol32_generator->generate_discrete(output_data, n,
+                                                                     tables);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        rocrand_sobol64 * rocrand_sobol64_generator =
+            static_cast<rocrand_sobol64 *>(generator);
+        return rocrand_sobol64_generator->generate_discrete(output_data, n,
+                                                           tables);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        rocrand_scrambled_sobol64 * rocrand_scrambled_sobol64_generator =
+            static_cast<rocrand_scrambled_sobol64 *>(generator);
+        return rocrand_scrambled_sobol64_generator->generate_discrete(output_data, n,
+                                                                     tables);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        rocrand_mtgp32 * rocrand_mtgp32_generator =
+            static_cast<rocrand_mtgp32 *>(generator);
+        return rocrand_mtgp32_generator->generate_discrete(output_data, n,
+                                                          tables);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_batch(rocrand_generator generator,
+                       const rocrand_batch_request * requests,
+                       size_t count)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(requests == NULL && count > 0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    // All requests are checked before values are generated
+    for(size_t i = 0; i < count; i++)
+    {
+        const rocrand_batch_request& request = requests[i];
+        if(request.distribution < ROCRAND_BATCH_UNIFORM
+            || request.distribution > ROCRAND_BATCH_POISSON
+            || (request.output_data == NULL && request.n > 0)
+            || (request.distribution == ROCRAND_BATCH_POISSON && !(request.parameters[0] > 0.0)))
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_batch(requests, count);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_batch(requests, count);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_batch(requests, count);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_batch(requests, count);
+    }
+
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_permutation(rocrand_generator generator,
+                             unsigned int * output_data,
+                             size_t n)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * sizeof(*output_data));
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->generate_permutation(
+            output_data, n
+        );
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_shuffle(rocrand_generator generator,
+                void * data,
+                size_t n,
+                size_t element_size)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->shuffle(
+            data, n, element_size
+        );
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_latin_hypercube(rocrand_generator generator,
+                                 float * output_data,
+                                 size_t n_points,
+                                 unsigned int dims,
+                                 rocrand_ordering ordering)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(ordering != ROCRAND_ORDERING_QUASI_DEFAULT && ordering != ROCRAND_ORDERING_QUASI_INTERLEAVED)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    const managed_output_prefetch prefetch(
+        generator, output_data, n_points * dims * sizeof(*output_data)
+    );
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->generate_latin_hypercube(
+            output_data, n_points, dims, ordering == ROCRAND_ORDERING_QUASI_INTERLEAVED
+        );
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_stratified_uniform(rocrand_generator generator,
+                                    float * output_data,
+                                    size_t n_points,
+                                    unsigned int dims,
+                                    unsigned int strata,
+                                    rocrand_ordering ordering)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(ordering != ROCRAND_ORDERING_QUASI_DEFAULT && ordering != ROCRAND_ORDERING_QUASI_INTERLEAVED)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    const managed_output_prefetch prefetch(
+        generator, output_data, n_points * dims * sizeof(*output_data)
+    );
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->generate_stratified_uniform(
+            output_data, n_points, dims, strata, ordering == ROCRAND_ORDERING_QUASI_INTERLEAVED
+        );
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_sample_without_replacement(rocrand_generator generator,
+                                   const float * weights,
+                                   size_t n,
+                                   size_t k,
+                                   unsigned int * output_data)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(k > 0 && (weights == NULL || output_data == NULL))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    hipStream_t stream;
+    bool host_side;
+    const rocrand_status status = get_generator_execution(generator, stream, host_side);
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+    return rocrand_host::detail::sample_without_replacement(
+        stream, host_side, weights, n, k, output_data,
+        [=](float * data, size_t size) { return rocrand_generate_uniform(generator, data, size); }
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_sample_without_replacement_csr(rocrand_generator generator,
+                                       const unsigned int * row_offsets,
+                                       size_t rows,
+                                       const float * weights,
+                                       size_t nnz,
+                                       unsigned int k,
+                                       unsigned int * output_data)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(rows > 0 && k > 0
+        && (row_offsets == NULL || output_data == NULL || (nnz > 0 && weights == NULL)))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    hipStream_t stream;
+    bool host_side;
+    const rocrand_status status = get_generator_execution(generator, stream, host_side);
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+    return rocrand_host::detail::sample_without_replacement_csr(
+        stream, host_side, row_offsets, rows, weights, nnz, k, output_data,
+        [=](float * data, size_t size) { return rocrand_generate_uniform(generator, data, size); }
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_multivariate_normal(rocrand_generator generator,
+                                     float * output_data,
+                                     size_t n_vectors,
+                                     unsigned int dim,
+                                     const float * factor,
+                                     const float * mean)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(dim > rocrand_host::detail::multivariate_normal_shared_values)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    if(n_vectors == 0 || dim == 0)
+    {
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    if(output_data == NULL || factor == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->generate_multivariate_normal(
+            output_data, n_vectors, dim, factor, mean
+        );
+    }
+
+    hipStream_t stream;
+    bool host_side;
+    const rocrand_status status = get_generator_execution(generator, stream, host_side);
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+    return rocrand_host::detail::generate_multivariate_normal(
+        stream, host_side, output_data, n_vectors, dim, factor, mean,
+        [=](float * data, size_t size)
+        {
+            return rocrand_generate_normal(generator, data, size, 0.0f, 1.0f);
+        }
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_unit_vectors(rocrand_generator generator,
+                              float * output_data,
+                              size_t n,
+                              unsigned int dim)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(dim == 0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    if(n == 0)
+    {
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    if(output_data == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    // Consecutive values of quasi-random generators are points of one
+    // dimension, vectors of them are not uniformly distributed
+    if(generator->rng_type >= ROCRAND_RNG_QUASI_DEFAULT)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    const managed_output_prefetch prefetch(generator, output_data, n * dim * sizeof(*output_data));
+
+    if(dim <= rocrand_host::detail::unit_vector_max_fused_dim)
+    {
+        if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+        {
+            rocrand_philox4x32_10 * philox4x32_10_generator =
+                static_cast<rocrand_philox4x32_10 *>(generator);
+            return philox4x32_10_generator->generate_unit_vectors(output_data, n, dim);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+        {
+            rocrand_philox4x32_7 * philox4x32_7_generator =
+                static_cast<rocrand_philox4x32_7 *>(generator);
+            return philox4x32_7_generator->generate_unit_vectors(output_data, n, dim);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+        {
+            rocrand_philox4x64_10 * philox4x64_10_generator =
+                static_cast<rocrand_philox4x64_10 *>(generator);
+            return philox4x64_10_generator->generate_unit_vectors(output_data, n, dim);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+        {
+            rocrand_threefry2x64_20 * threefry2x64_20_generator =
+                static_cast<rocrand_threefry2x64_20 *>(generator);
+            return threefry2x64_20_generator->generate_unit_vectors(output_data, n, dim);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+        {
+            rocrand_threefry4x64_20 * threefry4x64_20_generator =
+                static_cast<rocrand_threefry4x64_20 *>(generator);
+            return threefry4x64_20_generator->generate_unit_vectors(output_data, n, dim);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+        {
+            rocrand_mrg32k3a * mrg32k3a_generator =
+                static_cast<rocrand_mrg32k3a *>(generator);
+            return mrg32k3a_generator->generate_unit_vectors(output_data, n, dim);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+        {
+            rocrand_xorwow * rocrand_xorwow_generator =
+                static_cast<rocrand_xorwow *>(generator);
+            return rocrand_xorwow_generator->generate_unit_vectors(output_data, n, dim);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+        {
+            rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+                static_cast<rocrand_xoshiro128pp *>(generator);
+            return rocrand_xoshiro128pp_generator->generate_unit_vectors(output_data, n, dim);
+        }
+        else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+        {
+            rocrand_pcg32 * rocrand_pcg32_generator =
+                static_cast<rocrand_pcg32 *>(generator);
+            return rocrand_pcg32_generator->generate_unit_vectors(output_data, n, dim);
+        }
+    }
+
+    hipStream_t stream;
+    bool host_side;
+    const rocrand_status status = get_generator_execution(generator, stream, host_side);
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+    return rocrand_host::detail::generate_normalized_vectors(
+        stream, host_side, output_data, n, dim,
+        [=](float * data, size_t size)
+        {
+            return rocrand_generate_normal(generator, data, size, 0.0f, 1.0f);
+        }
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_stochastic_round(rocrand_generator generator,
+                         const float * input_data,
+                         void * output_data,
+                         size_t n,
+                         rocrand_round_format format)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(format != ROCRAND_ROUND_FORMAT_BFLOAT16 && format != ROCRAND_ROUND_FORMAT_HALF
+        && format != ROCRAND_ROUND_FORMAT_FP8_E4M3 && format != ROCRAND_ROUND_FORMAT_FP8_E5M2)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    if(n == 0)
+    {
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    if(input_data == NULL || output_data == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    const size_t value_size =
+        format == ROCRAND_ROUND_FORMAT_BFLOAT16 || format == ROCRAND_ROUND_FORMAT_HALF ? 2 : 1;
+    const managed_output_prefetch prefetch(generator, output_data, n * value_size);
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_stochastic_round(input_data, output_data, n, format);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate_stochastic_round(input_data, output_data, n, format);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        rocrand_philox4x64_10 * philox4x64_10_generator =
+            static_cast<rocrand_philox4x64_10 *>(generator);
+        return philox4x64_10_generator->generate_stochastic_round(input_data, output_data, n, format);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        rocrand_threefry2x64_20 * threefry2x64_20_generator =
+            static_cast<rocrand_threefry2x64_20 *>(generator);
+        return threefry2x64_20_generator->generate_stochastic_round(input_data, output_data, n, format);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        rocrand_threefry4x64_20 * threefry4x64_20_generator =
+            static_cast<rocrand_threefry4x64_20 *>(generator);
+        return threefry4x64_20_generator->generate_stochastic_round(input_data, output_data, n, format);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        rocrand_mrg32k3a * mrg32k3a_generator =
+            static_cast<rocrand_mrg32k3a *>(generator);
+        return mrg32k3a_generator->generate_stochastic_round(input_data, output_data, n, format);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        rocrand_xorwow * rocrand_xorwow_generator =
+            static_cast<rocrand_xorwow *>(generator);
+        return rocrand_xorwow_generator->generate_stochastic_round(input_data, output_data, n, format);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        rocrand_xoshiro128pp * rocrand_xoshiro128pp_generator =
+            static_cast<rocrand_xoshiro128pp *>(generator);
+        return rocrand_xoshiro128pp_generator->generate_stochastic_round(input_data, output_data, n, format);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        rocrand_pcg32 * rocrand_pcg32_generator =
+            static_cast<rocrand_pcg32 *>(generator);
+        return rocrand_pcg32_generator->generate_stochastic_round(input_data, output_data, n, format);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_brownian_paths(rocrand_generator generator,
+                                float * output_data,
+                                size_t paths,
+                                const float * times,
+                                unsigned int steps,
+                                int cumulative)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return static_cast<rocrand_sobol32 *>(generator)->generate_brownian_paths(
+            output_data, paths, times, steps, cumulative != 0
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        return static_cast<rocrand_scrambled_sobol32 *>(generator)->generate_brownian_paths(
+            output_data, paths, times, steps, cumulative != 0
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return static_cast<rocrand_sobol64 *>(generator)->generate_brownian_paths(
+            output_data, paths, times, steps, cumulative != 0
+        );
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64 *>(generator)->generate_brownian_paths(
+            output_data, paths, times, steps, cumulative != 0
+        );
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_poisson_cache_capacity(rocrand_generator generator,
+                                   size_t capacity)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->set_poisson_cache_capacity(capacity);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7 *>(generator)->set_poisson_cache_capacity(capacity);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10 *>(generator)->set_poisson_cache_capacity(capacity);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20 *>(generator)->set_poisson_cache_capacity(capacity);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20 *>(generator)->set_poisson_cache_capacity(capacity);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)->set_poisson_cache_capacity(capacity);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->set_poisson_cache_capacity(capacity);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)->set_poisson_cache_capacity(capacity);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->set_poisson_cache_capacity(capacity);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return static_cast<rocrand_sobol32 *>(generator)->set_poisson_cache_capacity(capacity);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        return static_cast<rocrand_scrambled_sobol32 *>(generator)->set_poisson_cache_capacity(capacity);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return static_cast<rocrand_sobol64 *>(generator)->set_poisson_cache_capacity(capacity);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64 *>(generator)->set_poisson_cache_capacity(capacity);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32 *>(generator)->set_poisson_cache_capacity(capacity);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_prepare_poisson(rocrand_generator generator,
+                        const double * lambdas, size_t count)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    for(size_t i = 0; i < count; i++)
+    {
+        if(lambdas[i] <= 0.0)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->prepare_poisson(lambdas, count);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7 *>(generator)->prepare_poisson(lambdas, count);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10 *>(generator)->prepare_poisson(lambdas, count);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20 *>(generator)->prepare_poisson(lambdas, count);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20 *>(generator)->prepare_poisson(lambdas, count);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)->prepare_poisson(lambdas, count);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->prepare_poisson(lambdas, count);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)->prepare_poisson(lambdas, count);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->prepare_poisson(lambdas, count);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return static_cast<rocrand_sobol32 *>(generator)->prepare_poisson(lambdas, count);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        return static_cast<rocrand_scrambled_sobol32 *>(generator)->prepare_poisson(lambdas, count);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return static_cast<rocrand_sobol64 *>(generator)->prepare_poisson(lambdas, count);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64 *>(generator)->prepare_poisson(lambdas, count);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32 *>(generator)->prepare_poisson(lambdas, count);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_initialize_generator(rocrand_generator generator)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return static_cast<rocrand_sobol32 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        return static_cast<rocrand_scrambled_sobol32 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return static_cast<rocrand_sobol64 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE32)
+    {
+        return static_cast<rocrand_lattice32 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON32)
+    {
+        return static_cast<rocrand_halton32 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32)
+    {
+        return static_cast<rocrand_scrambled_halton32 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32 *>(generator)->init();
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_initialize_generator_async(rocrand_generator generator)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)->init_async();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->init_async();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)->init_async();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->init_async();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return static_cast<rocrand_sobol32 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        return static_cast<rocrand_scrambled_sobol32 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return static_cast<rocrand_sobol64 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE32)
+    {
+        return static_cast<rocrand_lattice32 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON32)
+    {
+        return static_cast<rocrand_halton32 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32)
+    {
+        return static_cast<rocrand_scrambled_halton32 *>(generator)->init();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32 *>(generator)->init();
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_stream(rocrand_generator generator, hipStream_t stream)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        static_cast<rocrand_philox4x32_10 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        static_cast<rocrand_philox4x32_7 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        static_cast<rocrand_philox4x64_10 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        static_cast<rocrand_threefry2x64_20 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        static_cast<rocrand_threefry4x64_20 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        static_cast<rocrand_mrg32k3a *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        static_cast<rocrand_xorwow *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        static_cast<rocrand_xoshiro128pp *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        static_cast<rocrand_pcg32 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        static_cast<rocrand_sobol32 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        static_cast<rocrand_scrambled_sobol32 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        static_cast<rocrand_sobol64 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        static_cast<rocrand_scrambled_sobol64 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE32)
+    {
+        static_cast<rocrand_lattice32 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON32)
+    {
+        static_cast<rocrand_halton32 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32)
+    {
+        static_cast<rocrand_scrambled_halton32 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        static_cast<rocrand_mtgp32 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_get_stream(rocrand_generator generator, hipStream_t * stream)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(stream == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    bool host_side;
+    return get_generator_execution(generator, *stream, host_side);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_seed(rocrand_generator generator, unsigned long long seed)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        static_cast<rocrand_philox4x32_10 *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        static_cast<rocrand_philox4x32_7 *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        static_cast<rocrand_philox4x64_10 *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        static_cast<rocrand_threefry2x64_20 *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        static_cast<rocrand_threefry4x64_20 *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        if(seed == 0ULL)
+        {
+            seed = ROCRAND_MRG32K3A_DEFAULT_SEED;
+        }
+        static_cast<rocrand_mrg32k3a *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        static_cast<rocrand_xorwow *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        static_cast<rocrand_xoshiro128pp *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        static_cast<rocrand_pcg32 *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        static_cast<rocrand_mtgp32 *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_offset(rocrand_generator generator, unsigned long long offset)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        static_cast<rocrand_philox4x32_10 *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        static_cast<rocrand_philox4x32_7 *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        static_cast<rocrand_philox4x64_10 *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        static_cast<rocrand_threefry2x64_20 *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        static_cast<rocrand_threefry4x64_20 *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        static_cast<rocrand_mrg32k3a *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        static_cast<rocrand_xorwow *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        static_cast<rocrand_xoshiro128pp *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        static_cast<rocrand_pcg32 *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        static_cast<rocrand_sobol32 *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        static_cast<rocrand_scrambled_sobol32 *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        static_cast<rocrand_sobol64 *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        static_cast<rocrand_scrambled_sobol64 *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE32)
+    {
+        static_cast<rocrand_lattice32 *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON32)
+    {
+        static_cast<rocrand_halton32 *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32)
+    {
+        static_cast<rocrand_scrambled_halton32 *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        static_cast<rocrand_mtgp32 *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_quasi_random_generator_dimensions(rocrand_generator generator,
+                                              unsigned int dimensions)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return static_cast<rocrand_sobol32 *>(generator)->set_dimensions(dimensions);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        return static_cast<rocrand_scrambled_sobol32 *>(generator)->set_dimensions(dimensions);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return static_cast<rocrand_sobol64 *>(generator)->set_dimensions(dimensions);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64 *>(generator)->set_dimensions(dimensions);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE32)
+    {
+        return static_cast<rocrand_lattice32 *>(generator)->set_dimensions(dimensions);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON32)
+    {
+        return static_cast<rocrand_halton32 *>(generator)->set_dimensions(dimensions);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32)
+    {
+        return static_cast<rocrand_scrambled_halton32 *>(generator)->set_dimensions(dimensions);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_lattice_generating_vector(rocrand_generator generator,
+                                      const unsigned int * vector,
+                                      unsigned int dimensions)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE32)
+    {
+        return static_cast<rocrand_lattice32 *>(generator)->set_generating_vector(vector, dimensions);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_ordering(rocrand_generator generator,
+                     rocrand_ordering ordering)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return static_cast<rocrand_sobol32 *>(generator)->set_ordering(ordering);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        return static_cast<rocrand_scrambled_sobol32 *>(generator)->set_ordering(ordering);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return static_cast<rocrand_sobol64 *>(generator)->set_ordering(ordering);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64 *>(generator)->set_ordering(ordering);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE32)
+    {
+        return static_cast<rocrand_lattice32 *>(generator)->set_ordering(ordering);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON32)
+    {
+        return static_cast<rocrand_halton32 *>(generator)->set_ordering(ordering);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32)
+    {
+        return static_cast<rocrand_scrambled_halton32 *>(generator)->set_ordering(ordering);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->set_ordering(ordering);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)->set_ordering(ordering);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->set_ordering(ordering);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)->set_ordering(ordering);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32 *>(generator)->set_ordering(ordering);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_normal_method(rocrand_generator generator,
+                          rocrand_normal_method method)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->set_normal_method(method);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7 *>(generator)->set_normal_method(method);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10 *>(generator)->set_normal_method(method);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20 *>(generator)->set_normal_method(method);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20 *>(generator)->set_normal_method(method);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)->set_normal_method(method);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->set_normal_method(method);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)->set_normal_method(method);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->set_normal_method(method);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_store_policy(rocrand_generator generator,
+                         rocrand_store_policy policy)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    return generator->set_store_policy(policy);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_precision(rocrand_generator generator,
+                      rocrand_precision precision)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    return generator->set_precision(precision);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_managed_policy(rocrand_generator generator,
+                           rocrand_managed_policy policy)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    return generator->set_managed_policy(policy);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_stateless(rocrand_generator generator,
+                      int stateless)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->set_stateless(stateless != 0);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_launch_config(rocrand_generator generator,
+                          unsigned int blocks,
+                          unsigned int threads)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)->set_launch_config(blocks, threads);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7 *>(generator)->set_launch_config(blocks, threads);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10 *>(generator)->set_launch_config(blocks, threads);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20 *>(generator)->set_launch_config(blocks, threads);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20 *>(generator)->set_launch_config(blocks, threads);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)->set_launch_config(blocks, threads);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->set_launch_config(blocks, threads);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)->set_launch_config(blocks, threads);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->set_launch_config(blocks, threads);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return static_cast<rocrand_sobol32 *>(generator)->set_launch_config(blocks, threads);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        return static_cast<rocrand_scrambled_sobol32 *>(generator)->set_launch_config(blocks, threads);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return static_cast<rocrand_sobol64 *>(generator)->set_launch_config(blocks, threads);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64 *>(generator)->set_launch_config(blocks, threads);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE32)
+    {
+        return static_cast<rocrand_lattice32 *>(generator)->set_launch_config(blocks, threads);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON32)
+    {
+        return static_cast<rocrand_halton32 *>(generator)->set_launch_config(blocks, threads);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32)
+    {
+        return static_cast<rocrand_scrambled_halton32 *>(generator)->set_launch_config(blocks, threads);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32 *>(generator)->set_launch_config(blocks, threads);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_get_launch_config(rocrand_generator generator,
+                          unsigned int * blocks,
+                          unsigned int * threads)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(blocks == NULL || threads == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        static_cast<rocrand_philox4x32_10 *>(generator)->get_launch_config(blocks, threads);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        static_cast<rocrand_philox4x32_7 *>(generator)->get_launch_config(blocks, threads);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        static_cast<rocrand_philox4x64_10 *>(generator)->get_launch_config(blocks, threads);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        static_cast<rocrand_threefry2x64_20 *>(generator)->get_launch_config(blocks, threads);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        static_cast<rocrand_threefry4x64_20 *>(generator)->get_launch_config(blocks, threads);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        static_cast<rocrand_mrg32k3a *>(generator)->get_launch_config(blocks, threads);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        static_cast<rocrand_xorwow *>(generator)->get_launch_config(blocks, threads);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        static_cast<rocrand_xoshiro128pp *>(generator)->get_launch_config(blocks, threads);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        static_cast<rocrand_pcg32 *>(generator)->get_launch_config(blocks, threads);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        static_cast<rocrand_sobol32 *>(generator)->get_launch_config(blocks, threads);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        static_cast<rocrand_scrambled_sobol32 *>(generator)->get_launch_config(blocks, threads);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        static_cast<rocrand_sobol64 *>(generator)->get_launch_config(blocks, threads);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        static_cast<rocrand_scrambled_sobol64 *>(generator)->get_launch_config(blocks, threads);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE32)
+    {
+        static_cast<rocrand_lattice32 *>(generator)->get_launch_config(blocks, threads);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON32)
+    {
+        static_cast<rocrand_halton32 *>(generator)->get_launch_config(blocks, threads);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32)
+    {
+        static_cast<rocrand_scrambled_halton32 *>(generator)->get_launch_config(blocks, threads);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        static_cast<rocrand_mtgp32 *>(generator)->get_launch_config(blocks, threads);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_get_state(rocrand_generator generator, void * state, size_t * state_size)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(state_size == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return get_generator_state(static_cast<rocrand_philox4x32_10 *>(generator), state, state_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return get_generator_state(static_cast<rocrand_philox4x32_7 *>(generator), state, state_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return get_generator_state(static_cast<rocrand_philox4x64_10 *>(generator), state, state_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return get_generator_state(static_cast<rocrand_threefry2x64_20 *>(generator), state, state_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return get_generator_state(static_cast<rocrand_threefry4x64_20 *>(generator), state, state_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return get_generator_state(static_cast<rocrand_mrg32k3a *>(generator), state, state_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return get_generator_state(static_cast<rocrand_xorwow *>(generator), state, state_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return get_generator_state(static_cast<rocrand_xoshiro128pp *>(generator), state, state_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return get_generator_state(static_cast<rocrand_pcg32 *>(generator), state, state_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return get_generator_state(static_cast<rocrand_mtgp32 *>(generator), state, state_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32
+                || generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32
+                || generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64
+                || generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        // Sobol generators have no engines
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_state(rocrand_generator generator, const void * state, size_t state_size)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return set_generator_state(static_cast<rocrand_philox4x32_10 *>(generator), state, state_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return set_generator_state(static_cast<rocrand_philox4x32_7 *>(generator), state, state_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return set_generator_state(static_cast<rocrand_philox4x64_10 *>(generator), state, state_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return set_generator_state(static_cast<rocrand_threefry2x64_20 *>(generator), state, state_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return set_generator_state(static_cast<rocrand_threefry4x64_20 *>(generator), state, state_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return set_generator_state(static_cast<rocrand_mrg32k3a *>(generator), state, state_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return set_generator_state(static_cast<rocrand_xorwow *>(generator), state, state_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return set_generator_state(static_cast<rocrand_xoshiro128pp *>(generator), state, state_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return set_generator_state(static_cast<rocrand_pcg32 *>(generator), state, state_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return set_generator_state(static_cast<rocrand_mtgp32 *>(generator), state, state_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32
+                || generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32
+                || generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64
+                || generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        // Sobol generators have no engines
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generator_save(rocrand_generator generator, void * blob, size_t * blob_size)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(blob_size == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return save_generator(static_cast<rocrand_philox4x32_10 *>(generator), blob, blob_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return save_generator(static_cast<rocrand_philox4x32_7 *>(generator), blob, blob_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return save_generator(static_cast<rocrand_philox4x64_10 *>(generator), blob, blob_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return save_generator(static_cast<rocrand_threefry2x64_20 *>(generator), blob, blob_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return save_generator(static_cast<rocrand_threefry4x64_20 *>(generator), blob, blob_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return save_generator(static_cast<rocrand_mrg32k3a *>(generator), blob, blob_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return save_generator(static_cast<rocrand_xorwow *>(generator), blob, blob_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return save_generator(static_cast<rocrand_xoshiro128pp *>(generator), blob, blob_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return save_generator(static_cast<rocrand_pcg32 *>(generator), blob, blob_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return save_generator(static_cast<rocrand_sobol32 *>(generator), blob, blob_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        return save_generator(static_cast<rocrand_scrambled_sobol32 *>(generator), blob, blob_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return save_generator(static_cast<rocrand_sobol64 *>(generator), blob, blob_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return save_generator(static_cast<rocrand_scrambled_sobol64 *>(generator), blob, blob_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return save_generator(static_cast<rocrand_mtgp32 *>(generator), blob, blob_size);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generator_load(rocrand_generator generator, const void * blob, size_t blob_size)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return load_generator(static_cast<rocrand_philox4x32_10 *>(generator), blob, blob_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return load_generator(static_cast<rocrand_philox4x32_7 *>(generator), blob, blob_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return load_generator(static_cast<rocrand_philox4x64_10 *>(generator), blob, blob_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return load_generator(static_cast<rocrand_threefry2x64_20 *>(generator), blob, blob_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return load_generator(static_cast<rocrand_threefry4x64_20 *>(generator), blob, blob_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return load_generator(static_cast<rocrand_mrg32k3a *>(generator), blob, blob_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return load_generator(static_cast<rocrand_xorwow *>(generator), blob, blob_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return load_generator(static_cast<rocrand_xoshiro128pp *>(generator), blob, blob_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return load_generator(static_cast<rocrand_pcg32 *>(generator), blob, blob_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return load_generator(static_cast<rocrand_sobol32 *>(generator), blob, blob_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        return load_generator(static_cast<rocrand_scrambled_sobol32 *>(generator), blob, blob_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return load_generator(static_cast<rocrand_sobol64 *>(generator), blob, blob_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return load_generator(static_cast<rocrand_scrambled_sobol64 *>(generator), blob, blob_size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return load_generator(static_cast<rocrand_mtgp32 *>(generator), blob, blob_size);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_get_generator_stats(rocrand_generator generator, rocrand_generator_stats * stats)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(stats == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    *stats = generator->get_stats();
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_get_memory_usage(rocrand_generator generator, size_t * bytes)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(bytes == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        *bytes = static_cast<rocrand_philox4x32_10 *>(generator)->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        *bytes = static_cast<rocrand_philox4x32_7 *>(generator)->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        *bytes = static_cast<rocrand_philox4x64_10 *>(generator)->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        *bytes = static_cast<rocrand_threefry2x64_20 *>(generator)->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        *bytes = static_cast<rocrand_threefry4x64_20 *>(generator)->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        *bytes = static_cast<rocrand_mrg32k3a *>(generator)->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        *bytes = static_cast<rocrand_xorwow *>(generator)->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        *bytes = static_cast<rocrand_xoshiro128pp *>(generator)->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        *bytes = static_cast<rocrand_pcg32 *>(generator)->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        *bytes = static_cast<rocrand_sobol32 *>(generator)->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        *bytes = static_cast<rocrand_scrambled_sobol32 *>(generator)->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        *bytes = static_cast<rocrand_sobol64 *>(generator)->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        *bytes = static_cast<rocrand_scrambled_sobol64 *>(generator)->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE32)
+    {
+        *bytes = static_cast<rocrand_lattice32 *>(generator)->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON32)
+    {
+        *bytes = static_cast<rocrand_halton32 *>(generator)->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32)
+    {
+        *bytes = static_cast<rocrand_scrambled_halton32 *>(generator)->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_log_normal(output_data, n,
-                                                             mean, stddev);
+        *bytes = static_cast<rocrand_mtgp32 *>(generator)->get_memory_usage();
+        return ROCRAND_STATUS_SUCCESS;
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_generate_log_normal_half(rocrand_generator generator,
-                                 half * output_data, size_t n,
-                                 half mean, half stddev)
+rocrand_generator_trim(rocrand_generator generator)
 {
     if(generator == NULL)
     {
@@ -594,247 +7343,704 @@ rocrand_generate_log_normal_half(rocrand_generator generator,
 
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        rocrand_philox4x32_10 * philox4x32_10_generator =
-            static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_log_normal(output_data, n,
-                                                            mean, stddev);
+        return static_cast<rocrand_philox4x32_10 *>(generator)->trim();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7 *>(generator)->trim();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return static_cast<rocrand_philox4x64_10 *>(generator)->trim();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return static_cast<rocrand_threefry2x64_20 *>(generator)->trim();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return static_cast<rocrand_threefry4x64_20 *>(generator)->trim();
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_log_normal(output_data, n,
-                                                       mean, stddev);
+        return static_cast<rocrand_mrg32k3a *>(generator)->trim();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)->trim();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp *>(generator)->trim();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32 *>(generator)->trim();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return static_cast<rocrand_sobol32 *>(generator)->trim();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        return static_cast<rocrand_scrambled_sobol32 *>(generator)->trim();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return static_cast<rocrand_sobol64 *>(generator)->trim();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64 *>(generator)->trim();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_LATTICE32)
+    {
+        return static_cast<rocrand_lattice32 *>(generator)->trim();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_HALTON32)
+    {
+        return static_cast<rocrand_halton32 *>(generator)->trim();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32)
+    {
+        return static_cast<rocrand_scrambled_halton32 *>(generator)->trim();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        return static_cast<rocrand_mtgp32 *>(generator)->trim();
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_create_multi_device_generator(rocrand_multi_device_generator * generator,
+                                      rocrand_rng_type rng_type,
+                                      const int * devices,
+                                      unsigned int device_count)
+{
+    try
+    {
+        if(rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+        {
+            *generator = new rocrand_xorwow_multi_device(rng_type, devices, device_count);
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+        {
+            *generator = new rocrand_xoshiro128pp_multi_device(rng_type, devices, device_count);
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+        {
+            *generator = new rocrand_pcg32_multi_device(rng_type, devices, device_count);
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+        {
+            *generator = new rocrand_mrg32k3a_multi_device(rng_type, devices, device_count);
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+        {
+            *generator = new rocrand_sobol32_multi_device(rng_type, devices, device_count);
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+        {
+            *generator = new rocrand_scrambled_sobol32_multi_device(rng_type, devices, device_count);
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+        {
+            *generator = new rocrand_sobol64_multi_device(rng_type, devices, device_count);
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+        {
+            *generator = new rocrand_scrambled_sobol64_multi_device(rng_type, devices, device_count);
+        }
+        else
+        {
+            return ROCRAND_STATUS_TYPE_ERROR;
+        }
+    }
+    catch(const std::bad_alloc& e)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    catch(rocrand_status status)
+    {
+        return status;
+    }
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_create_distributed_generator(rocrand_multi_device_generator * generator,
+                                     rocrand_rng_type rng_type,
+                                     unsigned int rank,
+                                     unsigned int world_size)
+{
+    try
+    {
+        if(rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+        {
+            *generator = new rocrand_xorwow_multi_device(rng_type, rank, world_size);
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+        {
+            *generator = new rocrand_xoshiro128pp_multi_device(rng_type, rank, world_size);
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+        {
+            *generator = new rocrand_pcg32_multi_device(rng_type, rank, world_size);
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+        {
+            *generator = new rocrand_mrg32k3a_multi_device(rng_type, rank, world_size);
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+        {
+            *generator = new rocrand_sobol32_multi_device(rng_type, rank, world_size);
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+        {
+            *generator = new rocrand_scrambled_sobol32_multi_device(rng_type, rank, world_size);
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+        {
+            *generator = new rocrand_sobol64_multi_device(rng_type, rank, world_size);
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+        {
+            *generator = new rocrand_scrambled_sobol64_multi_device(rng_type, rank, world_size);
+        }
+        else
+        {
+            return ROCRAND_STATUS_TYPE_ERROR;
+        }
+    }
+    catch(const std::bad_alloc& e)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    catch(rocrand_status status)
+    {
+        return status;
+    }
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_destroy_multi_device_generator(rocrand_multi_device_generator generator)
+{
+    try
+    {
+        delete(generator);
+    }
+    catch(rocrand_status status)
+    {
+        return status;
+    }
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_multi_device_set_seed(rocrand_multi_device_generator generator,
+                              unsigned long long seed)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        static_cast<rocrand_xorwow_multi_device *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        static_cast<rocrand_xoshiro128pp_multi_device *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        static_cast<rocrand_pcg32_multi_device *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        static_cast<rocrand_mrg32k3a_multi_device *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_multi_device_set_offset(rocrand_multi_device_generator generator,
+                                unsigned long long offset)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        static_cast<rocrand_xorwow_multi_device *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        static_cast<rocrand_xoshiro128pp_multi_device *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        static_cast<rocrand_pcg32_multi_device *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        static_cast<rocrand_mrg32k3a_multi_device *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        static_cast<rocrand_sobol32_multi_device *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        static_cast<rocrand_scrambled_sobol32_multi_device *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        static_cast<rocrand_sobol64_multi_device *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        static_cast<rocrand_scrambled_sobol64_multi_device *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_multi_device_set_quasi_random_generator_dimensions(rocrand_multi_device_generator generator,
+                                                           unsigned int dimensions)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        return static_cast<rocrand_sobol32_multi_device *>(generator)->set_dimensions(dimensions);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
     {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_log_normal(output_data, n,
-                                                             mean, stddev);
+        return static_cast<rocrand_scrambled_sobol32_multi_device *>(generator)->set_dimensions(dimensions);
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
     {
-        rocrand_sobol32 * rocrand_sobol32_generator =
-            static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_log_normal(output_data, n,
-                                                              mean, stddev);
+        return static_cast<rocrand_sobol64_multi_device *>(generator)->set_dimensions(dimensions);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_log_normal(output_data, n,
-                                                             mean, stddev);
+        return static_cast<rocrand_scrambled_sobol64_multi_device *>(generator)->set_dimensions(dimensions);
     }
-
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_generate_poisson(rocrand_generator generator,
-                         unsigned int * output_data, size_t n,
-                         double lambda)
+rocrand_multi_device_get_slice(rocrand_multi_device_generator generator,
+                               size_t n,
+                               unsigned int device_index,
+                               size_t * offset,
+                               size_t * size)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
-    if (lambda <= 0.0)
+
+    if(offset == NULL || size == NULL)
     {
         return ROCRAND_STATUS_OUT_OF_RANGE;
     }
 
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        rocrand_philox4x32_10 * philox4x32_10_generator =
-            static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_poisson(output_data, n,
-                                                         lambda);
+        return static_cast<rocrand_xorwow_multi_device *>(generator)->get_slice(n, device_index, offset, size);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
     {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_poisson(output_data, n,
-                                                    lambda);
+        return static_cast<rocrand_xoshiro128pp_multi_device *>(generator)->get_slice(n, device_index, offset, size);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
     {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_poisson(output_data, n,
-                                                          lambda);
+        return static_cast<rocrand_pcg32_multi_device *>(generator)->get_slice(n, device_index, offset, size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a_multi_device *>(generator)->get_slice(n, device_index, offset, size);
     }
     else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
     {
-        rocrand_sobol32 * rocrand_sobol32_generator =
-            static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_poisson(output_data, n,
-                                                           lambda);
+        return static_cast<rocrand_sobol32_multi_device *>(generator)->get_slice(n, device_index, offset, size);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_poisson(output_data, n,
-                                                          lambda);
+        return static_cast<rocrand_scrambled_sobol32_multi_device *>(generator)->get_slice(n, device_index, offset, size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return static_cast<rocrand_sobol64_multi_device *>(generator)->get_slice(n, device_index, offset, size);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64_multi_device *>(generator)->get_slice(n, device_index, offset, size);
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_initialize_generator(rocrand_generator generator)
+rocrand_multi_device_generate(rocrand_multi_device_generator generator,
+                              unsigned int * const * outputs,
+                              size_t n)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
 
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        return static_cast<rocrand_philox4x32_10 *>(generator)->init();
+        return static_cast<rocrand_xorwow_multi_device *>(generator)->generate(outputs, n);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
     {
-        return static_cast<rocrand_mrg32k3a *>(generator)->init();
+        return static_cast<rocrand_xoshiro128pp_multi_device *>(generator)->generate(outputs, n);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
     {
-        return static_cast<rocrand_xorwow *>(generator)->init();
+        return static_cast<rocrand_pcg32_multi_device *>(generator)->generate(outputs, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a_multi_device *>(generator)->generate(outputs, n);
     }
     else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
     {
-        return static_cast<rocrand_sobol32 *>(generator)->init();
+        return static_cast<rocrand_sobol32_multi_device *>(generator)->generate(outputs, n);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
     {
-        return static_cast<rocrand_mtgp32 *>(generator)->init();
+        return static_cast<rocrand_scrambled_sobol32_multi_device *>(generator)->generate(outputs, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return static_cast<rocrand_sobol64_multi_device *>(generator)->generate(outputs, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64_multi_device *>(generator)->generate(outputs, n);
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_set_stream(rocrand_generator generator, hipStream_t stream)
+rocrand_multi_device_generate_uniform(rocrand_multi_device_generator generator,
+                                      float * const * outputs,
+                                      size_t n)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
 
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        static_cast<rocrand_philox4x32_10 *>(generator)->set_stream(stream);
-        return ROCRAND_STATUS_SUCCESS;
+        return static_cast<rocrand_xorwow_multi_device *>(generator)->generate_uniform(outputs, n);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
     {
-        static_cast<rocrand_mrg32k3a *>(generator)->set_stream(stream);
-        return ROCRAND_STATUS_SUCCESS;
+        return static_cast<rocrand_xoshiro128pp_multi_device *>(generator)->generate_uniform(outputs, n);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
     {
-        static_cast<rocrand_xorwow *>(generator)->set_stream(stream);
-        return ROCRAND_STATUS_SUCCESS;
+        return static_cast<rocrand_pcg32_multi_device *>(generator)->generate_uniform(outputs, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a_multi_device *>(generator)->generate_uniform(outputs, n);
     }
     else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
     {
-        static_cast<rocrand_sobol32 *>(generator)->set_stream(stream);
-        return ROCRAND_STATUS_SUCCESS;
+        return static_cast<rocrand_sobol32_multi_device *>(generator)->generate_uniform(outputs, n);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
     {
-        static_cast<rocrand_mtgp32 *>(generator)->set_stream(stream);
-        return ROCRAND_STATUS_SUCCESS;
+        return static_cast<rocrand_scrambled_sobol32_multi_device *>(generator)->generate_uniform(outputs, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return static_cast<rocrand_sobol64_multi_device *>(generator)->generate_uniform(outputs, n);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64_multi_device *>(generator)->generate_uniform(outputs, n);
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_set_seed(rocrand_generator generator, unsigned long long seed)
+rocrand_multi_device_generate_normal(rocrand_multi_device_generator generator,
+                                     float * const * outputs,
+                                     size_t n,
+                                     float mean, float stddev)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
 
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        static_cast<rocrand_philox4x32_10 *>(generator)->set_seed(seed);
-        return ROCRAND_STATUS_SUCCESS;
+        return static_cast<rocrand_xorwow_multi_device *>(generator)->generate_normal(outputs, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return static_cast<rocrand_xoshiro128pp_multi_device *>(generator)->generate_normal(outputs, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return static_cast<rocrand_pcg32_multi_device *>(generator)->generate_normal(outputs, n, mean, stddev);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
-        if(seed == 0ULL)
-        {
-            seed = ROCRAND_MRG32K3A_DEFAULT_SEED;
-        }
-        static_cast<rocrand_mrg32k3a *>(generator)->set_seed(seed);
-        return ROCRAND_STATUS_SUCCESS;
+        return static_cast<rocrand_mrg32k3a_multi_device *>(generator)->generate_normal(outputs, n, mean, stddev);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
     {
-        static_cast<rocrand_xorwow *>(generator)->set_seed(seed);
-        return ROCRAND_STATUS_SUCCESS;
+        return static_cast<rocrand_sobol32_multi_device *>(generator)->generate_normal(outputs, n, mean, stddev);
     }
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
     {
-        static_cast<rocrand_mtgp32 *>(generator)->set_seed(seed);
-        return ROCRAND_STATUS_SUCCESS;
+        return static_cast<rocrand_scrambled_sobol32_multi_device *>(generator)->generate_normal(outputs, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+    {
+        return static_cast<rocrand_sobol64_multi_device *>(generator)->generate_normal(outputs, n, mean, stddev);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        return static_cast<rocrand_scrambled_sobol64_multi_device *>(generator)->generate_normal(outputs, n, mean, stddev);
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_set_offset(rocrand_generator generator, unsigned long long offset)
+rocrand_create_stream_producer(rocrand_stream_producer * producer,
+                               rocrand_rng_type rng_type,
+                               unsigned long long seed,
+                               size_t capacity)
 {
-    if(generator == NULL)
+    if(producer == NULL)
     {
-        return ROCRAND_STATUS_NOT_CREATED;
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    try
     {
-        static_cast<rocrand_philox4x32_10 *>(generator)->set_offset(offset);
-        return ROCRAND_STATUS_SUCCESS;
+        if(rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+        {
+            *producer = new rocrand_xorwow_stream_producer(rng_type, seed, capacity);
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+        {
+            *producer = new rocrand_philox4x32_10_stream_producer(rng_type, seed, capacity);
+        }
+        else
+        {
+            return ROCRAND_STATUS_TYPE_ERROR;
+        }
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    catch(const std::bad_alloc& e)
     {
-        static_cast<rocrand_mrg32k3a *>(generator)->set_offset(offset);
-        return ROCRAND_STATUS_SUCCESS;
+        return ROCRAND_STATUS_INTERNAL_ERROR;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    catch(rocrand_status status)
     {
-        static_cast<rocrand_xorwow *>(generator)->set_offset(offset);
-        return ROCRAND_STATUS_SUCCESS;
+        return status;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_stream_producer_get_buffer(rocrand_stream_producer producer,
+                                   rocrand_ring_buffer * buffer)
+{
+    if(producer == NULL)
     {
-        static_cast<rocrand_sobol32 *>(generator)->set_offset(offset);
-        return ROCRAND_STATUS_SUCCESS;
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    if(buffer == NULL)
     {
-        // Can't set offset for MTGP32
-        return ROCRAND_STATUS_TYPE_ERROR;
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-    return ROCRAND_STATUS_TYPE_ERROR;
+    producer->get_buffer(buffer);
+    return ROCRAND_STATUS_SUCCESS;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_set_quasi_random_generator_dimensions(rocrand_generator generator,
-                                              unsigned int dimensions)
+rocrand_destroy_stream_producer(rocrand_stream_producer producer)
 {
-    if(generator == NULL)
+    if(producer == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
-
-    if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    try
     {
-        return static_cast<rocrand_sobol32 *>(generator)->set_dimensions(dimensions);
+        delete(producer);
     }
-    return ROCRAND_STATUS_TYPE_ERROR;
+    catch(rocrand_status status)
+    {
+        return status;
+    }
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_graph_node(rocrand_generator generator,
+                            hipGraph_t graph,
+                            hipGraphNode_t * node,
+                            const hipGraphNode_t * dependencies,
+                            size_t dependencies_count,
+                            unsigned int * output_data, size_t n)
+{
+    return add_graph_node(
+        generator, graph, node, dependencies, dependencies_count,
+        [=]() { return rocrand_generate(generator, output_data, n); }
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_graph_node(rocrand_generator generator,
+                                    hipGraph_t graph,
+                                    hipGraphNode_t * node,
+                                    const hipGraphNode_t * dependencies,
+                                    size_t dependencies_count,
+                                    float * output_data, size_t n)
+{
+    return add_graph_node(
+        generator, graph, node, dependencies, dependencies_count,
+        [=]() { return rocrand_generate_uniform(generator, output_data, n); }
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_double_graph_node(rocrand_generator generator,
+                                           hipGraph_t graph,
+                                           hipGraphNode_t * node,
+                                           const hipGraphNode_t * dependencies,
+                                           size_t dependencies_count,
+                                           double * output_data, size_t n)
+{
+    return add_graph_node(
+        generator, graph, node, dependencies, dependencies_count,
+        [=]() { return rocrand_generate_uniform_double(generator, output_data, n); }
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_graph_node(rocrand_generator generator,
+                                   hipGraph_t graph,
+                                   hipGraphNode_t * node,
+                                   const hipGraphNode_t * dependencies,
+                                   size_t dependencies_count,
+                                   float * output_data, size_t n,
+                                   float mean, float stddev)
+{
+    return add_graph_node(
+        generator, graph, node, dependencies, dependencies_count,
+        [=]() { return rocrand_generate_normal(generator, output_data, n, mean, stddev); }
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_double_graph_node(rocrand_generator generator,
+                                          hipGraph_t graph,
+                                          hipGraphNode_t * node,
+                                          const hipGraphNode_t * dependencies,
+                                          size_t dependencies_count,
+                                          double * output_data, size_t n,
+                                          double mean, double stddev)
+{
+    return add_graph_node(
+        generator, graph, node, dependencies, dependencies_count,
+        [=]() { return rocrand_generate_normal_double(generator, output_data, n, mean, stddev); }
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_to_host(rocrand_generator generator,
+                         unsigned int * output_data, size_t n)
+{
+    return generate_to_host(
+        generator, output_data, n,
+        [=](unsigned int * data, size_t size) { return rocrand_generate(generator, data, size); }
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_to_host(rocrand_generator generator,
+                                 float * output_data, size_t n)
+{
+    return generate_to_host(
+        generator, output_data, n,
+        [=](float * data, size_t size) { return rocrand_generate_uniform(generator, data, size); }
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_double_to_host(rocrand_generator generator,
+                                        double * output_data, size_t n)
+{
+    return generate_to_host(
+        generator, output_data, n,
+        [=](double * data, size_t size) { return rocrand_generate_uniform_double(generator, data, size); }
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_to_host(rocrand_generator generator,
+                                float * output_data, size_t n,
+                                float mean, float stddev)
+{
+    return generate_to_host(
+        generator, output_data, n,
+        [=](float * data, size_t size) { return rocrand_generate_normal(generator, data, size, mean, stddev); }
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_double_to_host(rocrand_generator generator,
+                                       double * output_data, size_t n,
+                                       double mean, double stddev)
+{
+    return generate_to_host(
+        generator, output_data, n,
+        [=](double * data, size_t size) { return rocrand_generate_normal_double(generator, data, size, mean, stddev); }
+    );
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_poisson_to_host(rocrand_generator generator,
+                                 unsigned int * output_data, size_t n,
+                                 double lambda)
+{
+    return generate_to_host(
+        generator, output_data, n,
+        [=](unsigned int * data, size_t size) { return rocrand_generate_poisson(generator, data, size, lambda); }
+    );
 }
 
 rocrand_status ROCRANDAPI
@@ -935,6 +8141,53 @@ rocrand_create_discrete_distribution(const double * probabilities,
     return ROCRAND_STATUS_SUCCESS;
 }
 
+rocrand_status ROCRANDAPI
+rocrand_create_discrete_distribution_device(const double * probabilities,
+                                            unsigned int size,
+                                            unsigned int offset,
+                                            rocrand_discrete_distribution * discrete_distribution)
+{
+    if (discrete_distribution == NULL || probabilities == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    if (size == 0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_UNIVERSAL> h_dis;
+    try
+    {
+        h_dis.init_device(probabilities, size, offset);
+    }
+    catch(const std::exception& e)
+    {
+        h_dis.deallocate();
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    catch(rocrand_status status)
+    {
+        h_dis.deallocate();
+        return status;
+    }
+
+    hipError_t error;
+    error = hipMalloc(discrete_distribution, sizeof(rocrand_discrete_distribution_st));
+    if (error != hipSuccess)
+    {
+        h_dis.deallocate();
+        return ROCRAND_STATUS_ALLOCATION_FAILED;
+    }
+    error = hipMemcpy(*discrete_distribution, &h_dis, sizeof(rocrand_discrete_distribution_st), hipMemcpyDefault);
+    if (error != hipSuccess)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+
+    return ROCRAND_STATUS_SUCCESS;
+}
+
 rocrand_status ROCRANDAPI
 rocrand_destroy_discrete_distribution(rocrand_discrete_distribution discrete_distribution)
 {
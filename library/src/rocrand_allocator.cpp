@@ -0,0 +1,209 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// The allocator of internal device memory is global and not a part of generators:
+// buffers are allocated by distributions, caches and temporary helpers which do not
+// know their generator. Every allocation remembers its allocator, so memory is
+// freed correctly after rocrand_set_allocator() changes it.
+
+#include <hip/hip_runtime.h>
+
+#include <rocrand.h>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+#include "rng/allocator.hpp"
+
+namespace {
+
+// Pool allocations are ordered in stream, but internal buffers can be used in
+// other streams (engines are allocated before the generator's stream is set),
+// so the stream is synchronized (not the device) after allocation
+hipError_t pool_allocate(void * context, void ** ptr, size_t size, hipStream_t stream)
+{
+    hipError_t error = hipMallocFromPoolAsync(ptr, size, static_cast<hipMemPool_t>(context), stream);
+    if(error != hipSuccess)
+    {
+        return error;
+    }
+    error = hipStreamSynchronize(stream);
+    if(error != hipSuccess)
+    {
+        hipFreeAsync(*ptr, stream);
+    }
+    return error;
+}
+
+hipError_t pool_deallocate(void *, void * ptr, hipStream_t stream)
+{
+    return hipFreeAsync(ptr, stream);
+}
+
+hipError_t plain_allocate(void *, void ** ptr, size_t size, hipStream_t)
+{
+    return hipMalloc(ptr, size);
+}
+
+hipError_t plain_deallocate(void *, void * ptr, hipStream_t)
+{
+    return hipFree(ptr);
+}
+
+struct allocator_registry
+{
+    std::mutex mutex;
+    bool user_allocator_set = false;
+    rocrand_allocator user_allocator = rocrand_allocator();
+    // Memory pools of devices, NULL if pools are not supported. Pools are not
+    // destroyed: memory can be freed by static generators during exit.
+    std::map<int, hipMemPool_t> pools;
+    std::unordered_map<void *, rocrand_allocator> allocations;
+
+    // Returns the caching pool of the current device, must be called under mutex
+    hipMemPool_t device_pool()
+    {
+        int device;
+        if(hipGetDevice(&device) != hipSuccess)
+        {
+            return NULL;
+        }
+        auto it = pools.find(device);
+        if(it != pools.end())
+        {
+            return it->second;
+        }
+
+        hipMemPoolProps props = hipMemPoolProps();
+        props.allocType = hipMemAllocationTypePinned;
+        props.location.type = hipMemLocationTypeDevice;
+        props.location.id = device;
+        hipMemPool_t pool = NULL;
+        if(hipMemPoolCreate(&pool, &props) == hipSuccess)
+        {
+            // Freed memory is kept in the pool for reuse
+            unsigned long long threshold = ~0ULL;
+            if(hipMemPoolSetAttribute(pool, hipMemPoolAttrReleaseThreshold, &threshold) != hipSuccess)
+            {
+                hipMemPoolDestroy(pool);
+                pool = NULL;
+            }
+        }
+        else
+        {
+            pool = NULL;
+        }
+        pools[device] = pool;
+        return pool;
+    }
+
+    rocrand_allocator current_allocator()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if(user_allocator_set)
+        {
+            return user_allocator;
+        }
+        rocrand_allocator allocator;
+        hipMemPool_t pool = device_pool();
+        allocator.context = pool;
+        allocator.allocate = pool != NULL ? pool_allocate : plain_allocate;
+        allocator.deallocate = pool != NULL ? pool_deallocate : plain_deallocate;
+        return allocator;
+    }
+};
+
+allocator_registry& get_registry()
+{
+    // Never destroyed, see pools
+    static allocator_registry * registry = new allocator_registry();
+    return *registry;
+}
+
+} // end namespace
+
+namespace rocrand_host {
+namespace detail {
+
+    hipError_t device_malloc(void ** ptr, size_t size, hipStream_t stream)
+    {
+        *ptr = NULL;
+        if(size == 0)
+        {
+            return hipSuccess;
+        }
+        allocator_registry& registry = get_registry();
+        const rocrand_allocator allocator = registry.current_allocator();
+        const hipError_t error = allocator.allocate(allocator.context, ptr, size, stream);
+        if(error != hipSuccess)
+        {
+            *ptr = NULL;
+            return error;
+        }
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.allocations[*ptr] = allocator;
+        return hipSuccess;
+    }
+
+    hipError_t device_free(void * ptr, hipStream_t stream)
+    {
+        if(ptr == NULL)
+        {
+            return hipSuccess;
+        }
+        allocator_registry& registry = get_registry();
+        rocrand_allocator allocator;
+        {
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            auto it = registry.allocations.find(ptr);
+            if(it == registry.allocations.end())
+            {
+                return hipErrorInvalidValue;
+            }
+            allocator = it->second;
+            registry.allocations.erase(it);
+        }
+        return allocator.deallocate(allocator.context, ptr, stream);
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+rocrand_status ROCRANDAPI
+rocrand_set_allocator(const rocrand_allocator * allocator)
+{
+    if(allocator != NULL && (allocator->allocate == NULL || allocator->deallocate == NULL))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    allocator_registry& registry = get_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.user_allocator_set = allocator != NULL;
+    registry.user_allocator = allocator != NULL ? *allocator : rocrand_allocator();
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
@@ -0,0 +1,182 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Read-only tables of generators are shared: with many generators in a process
+// every generator would otherwise keep its own identical device copy of the
+// (megabytes large) Sobol direction vectors and pay for the copy when created.
+// The tables are reference counted and freed when the last generator using
+// them is destroyed.
+
+#include <hip/hip_runtime.h>
+
+#include <rocrand.h>
+#include <map>
+#include <mutex>
+#include <tuple>
+
+#include "rng/allocator.hpp"
+#include "rng/device_tables.hpp"
+
+namespace {
+
+struct device_table
+{
+    void * ptr;
+    size_t references;
+    // Stream of the generators holding the table, the free is ordered
+    // in it if all of them use the same stream
+    hipStream_t stream;
+    bool single_stream;
+};
+
+struct device_table_registry
+{
+    std::mutex mutex;
+    // Keyed by (device, host table, size)
+    std::map<std::tuple<int, const void *, size_t>, device_table> tables;
+};
+
+device_table_registry& get_registry()
+{
+    // Never destroyed: tables can be released by static generators during exit
+    static device_table_registry * registry = new device_table_registry();
+    return *registry;
+}
+
+} // end namespace
+
+namespace rocrand_host {
+namespace detail {
+
+    hipError_t acquire_device_table(void ** ptr,
+                                    const void * table,
+                                    size_t size,
+                                    hipStream_t stream,
+                                    bool * uploaded)
+    {
+        *ptr = NULL;
+        *uploaded = false;
+        if(size == 0)
+        {
+            return hipSuccess;
+        }
+        int device;
+        hipError_t error = hipGetDevice(&device);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+
+        device_table_registry& registry = get_registry();
+        // The lock is held during the copy, so concurrently created
+        // generators do not upload the same table twice
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        const auto key = std::make_tuple(device, table, size);
+        auto it = registry.tables.find(key);
+        if(it != registry.tables.end())
+        {
+            device_table& entry = it->second;
+            entry.references++;
+            entry.single_stream = entry.single_stream && entry.stream == stream;
+            *ptr = entry.ptr;
+            return hipSuccess;
+        }
+
+        void * p;
+        error = device_malloc(&p, size, stream);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        error = hipMemcpy(p, table, size, hipMemcpyHostToDevice);
+        if(error != hipSuccess)
+        {
+            device_free(p, stream);
+            return error;
+        }
+        device_table entry;
+        entry.ptr = p;
+        entry.references = 1;
+        entry.stream = stream;
+        entry.single_stream = true;
+        registry.tables[key] = entry;
+        *ptr = p;
+        *uploaded = true;
+        return hipSuccess;
+    }
+
+    hipError_t release_device_table(const void * ptr, hipStream_t stream)
+    {
+        if(ptr == NULL)
+        {
+            return hipSuccess;
+        }
+        device_table_registry& registry = get_registry();
+        device_table entry;
+        int device;
+        {
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            auto it = registry.tables.begin();
+            while(it != registry.tables.end() && it->second.ptr != ptr)
+            {
+                ++it;
+            }
+            if(it == registry.tables.end())
+            {
+                return hipErrorInvalidValue;
+            }
+            entry = it->second;
+            device = std::get<0>(it->first);
+            entry.single_stream = entry.single_stream && entry.stream == stream;
+            if(--it->second.references > 0)
+            {
+                it->second.single_stream = entry.single_stream;
+                return hipSuccess;
+            }
+            registry.tables.erase(it);
+        }
+        if(!entry.single_stream)
+        {
+            // Kernels of other generators in other streams can still read
+            // the table, they are waited for before it is freed
+            int current_device = device;
+            hipError_t error = hipGetDevice(&current_device);
+            if(error == hipSuccess && current_device != device)
+            {
+                error = hipSetDevice(device);
+            }
+            if(error == hipSuccess)
+            {
+                error = hipDeviceSynchronize();
+            }
+            if(current_device != device)
+            {
+                hipSetDevice(current_device);
+            }
+            if(error != hipSuccess)
+            {
+                return error;
+            }
+        }
+        return device_free(entry.ptr, stream);
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
@@ -0,0 +1,214 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// States of the device API are initialized here and not in rocrand.cpp:
+// generators use engines without Box-Muller fields (see device_engines.hpp),
+// while states of users' kernels must have the layout of rocrand_kernel.h.
+
+#include <hip/hip_runtime.h>
+
+#include <rocrand_kernel.h>
+#include <rocrand.h>
+
+namespace {
+
+const unsigned int init_states_threads = 256;
+
+// Initializes states[i] to the state returned by rocrand_init(seed, i, offset, ...).
+// Only the first state of every block runs the full skipahead, other states
+// are computed cooperatively with doubled strides: in the k-th step threads
+// [2^k, 2^(k+1)) of the block copy the state 2^k positions before them and
+// skip 2^k subsequences, which is one or two multiplications by precomputed
+// jump matrices. So n states cost O(n) matrix work instead of O(n log n).
+template<class State>
+__global__
+void init_states_kernel(State * states,
+                        const size_t n,
+                        const unsigned long long seed,
+                        const unsigned long long offset)
+{
+    const size_t block_start = static_cast<size_t>(hipBlockIdx_x) * hipBlockDim_x;
+    const unsigned int tid = hipThreadIdx_x;
+    const size_t state_id = block_start + tid;
+
+    if(tid == 0)
+    {
+        State state;
+        rocrand_init(seed, block_start, offset, &state);
+        states[state_id] = state;
+    }
+    for(unsigned int stride = 1; stride < hipBlockDim_x; stride *= 2)
+    {
+        // Global memory writes are visible to other threads of the block
+        __syncthreads();
+        if(tid >= stride && tid < 2 * stride && state_id < n)
+        {
+            State state = states[state_id - stride];
+            skipahead_subsequence(stride, &state);
+            states[state_id] = state;
+        }
+    }
+}
+
+// Counter-based states are initialized in O(1), every thread initializes
+// its own state
+template<class State>
+__global__
+void init_counter_states_kernel(State * states,
+                                const size_t n,
+                                const unsigned long long seed,
+                                const unsigned long long offset)
+{
+    const size_t state_id = static_cast<size_t>(hipBlockIdx_x) * hipBlockDim_x + hipThreadIdx_x;
+    if(state_id < n)
+    {
+        State state;
+        rocrand_init(seed, state_id, offset, &state);
+        states[state_id] = state;
+    }
+}
+
+template<class State>
+rocrand_status init_states(void (*kernel)(State *, const size_t,
+                                          const unsigned long long,
+                                          const unsigned long long),
+                           void * states,
+                           size_t n,
+                           unsigned long long seed,
+                           unsigned long long offset,
+                           hipStream_t stream)
+{
+    if(n == 0)
+    {
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    if(states == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    const size_t blocks = (n + init_states_threads - 1) / init_states_threads;
+    hipLaunchKernelGGL(
+        kernel,
+        dim3(blocks), dim3(init_states_threads), 0, stream,
+        static_cast<State *>(states), n, seed, offset
+    );
+    if(hipPeekAtLastError() != hipSuccess)
+    {
+        return ROCRAND_STATUS_LAUNCH_FAILURE;
+    }
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+} // end namespace
+
+rocrand_status ROCRANDAPI
+rocrand_init_states(void * states,
+                    size_t n,
+                    unsigned long long seed,
+                    unsigned long long offset,
+                    rocrand_rng_type rng_type,
+                    hipStream_t stream)
+{
+    // Engines excluded from the build by ROCRAND_ENGINES are not initialized
+#ifndef ROCRAND_DISABLE_XORWOW
+    if(rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return init_states(
+            init_states_kernel<rocrand_state_xorwow>,
+            states, n, seed, offset, stream
+        );
+    }
+#endif
+#ifndef ROCRAND_DISABLE_MRG32K3A
+    if(rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return init_states(
+            init_states_kernel<rocrand_state_mrg32k3a>,
+            states, n, seed, offset, stream
+        );
+    }
+#endif
+#ifndef ROCRAND_DISABLE_XOSHIRO128PP
+    if(rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+    {
+        return init_states(
+            init_states_kernel<rocrand_state_xoshiro128pp>,
+            states, n, seed, offset, stream
+        );
+    }
+#endif
+#ifndef ROCRAND_DISABLE_PCG32
+    // PCG32 has no jump tables, its states are initialized like counter-based ones
+    if(rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        return init_states(
+            init_counter_states_kernel<rocrand_state_pcg32>,
+            states, n, seed, offset, stream
+        );
+    }
+#endif
+#ifndef ROCRAND_DISABLE_PHILOX4_32_10
+    if(rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return init_states(
+            init_counter_states_kernel<rocrand_state_philox4x32_10>,
+            states, n, seed, offset, stream
+        );
+    }
+#endif
+#ifndef ROCRAND_DISABLE_PHILOX4_32_7
+    if(rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return init_states(
+            init_counter_states_kernel<rocrand_state_philox4x32_7>,
+            states, n, seed, offset, stream
+        );
+    }
+#endif
+#ifndef ROCRAND_DISABLE_PHILOX4_64_10
+    if(rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+    {
+        return init_states(
+            init_counter_states_kernel<rocrand_state_philox4x64_10>,
+            states, n, seed, offset, stream
+        );
+    }
+#endif
+#ifndef ROCRAND_DISABLE_THREEFRY2_64_20
+    if(rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+    {
+        return init_states(
+            init_counter_states_kernel<rocrand_state_threefry2x64_20>,
+            states, n, seed, offset, stream
+        );
+    }
+#endif
+#ifndef ROCRAND_DISABLE_THREEFRY4_64_20
+    if(rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+    {
+        return init_states(
+            init_counter_states_kernel<rocrand_state_threefry4x64_20>,
+            states, n, seed, offset, stream
+        );
+    }
+#endif
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
@@ -44,6 +44,9 @@ class HipError(Exception):
 hipSuccess = 0
 hipMemcpyDeviceToHost = 2
 
+# DLPack device types of HIP devices (kDLCUDA and kDLROCM)
+DLPACK_DEVICE_TYPES = (2, 10)
+
 def check_hip(status):
     if status != hipSuccess:
         raise HipError(status)
@@ -81,6 +84,14 @@ def load_hip():
             hip.hipMalloc = cuda.cudaMalloc
             hip.hipFree = cuda.cudaFree
             hip.hipMemcpy = cuda.cudaMemcpy
+            hip.hipMemcpyAsync = cuda.cudaMemcpyAsync
+            hip.hipHostMalloc = cuda.cudaHostAlloc
+            hip.hipHostFree = cuda.cudaFreeHost
+            hip.hipStreamSynchronize = cuda.cudaStreamSynchronize
+            hip.hipEventCreate = cuda.cudaEventCreate
+            hip.hipEventDestroy = cuda.cudaEventDestroy
+            hip.hipEventRecord = cuda.cudaEventRecord
+            hip.hipEventSynchronize = cuda.cudaEventSynchronize
 
     if hip is None:
         raise ImportError("both libcudart.so and libhip_hcc.so cannot be loaded: " +
@@ -96,9 +107,217 @@ class MemoryPointer(object):
     def _finalize(cls, ptr):
         check_hip(hip.hipFree(ptr))
 
+class PinnedMemoryPointer(object):
+    def __init__(self, nbytes):
+        self.ptr = c_void_p()
+        self.nbytes = nbytes
+        check_hip(hip.hipHostMalloc(byref(self.ptr), c_size_t(nbytes), c_uint(0)))
+        track_for_finalization(self, self.ptr, PinnedMemoryPointer._finalize)
+
+    @classmethod
+    def _finalize(cls, ptr):
+        check_hip(hip.hipHostFree(ptr))
+
+def memcpy_device_to_host_async(host, device, nbytes, stream):
+    """Copies **nbytes** from **device** to pinned **host** in **stream**."""
+    check_hip(hip.hipMemcpyAsync(host.ptr, device.ptr, c_size_t(nbytes),
+            hipMemcpyDeviceToHost, stream))
+
+def pinned_array(pinned, dtype, size):
+    """Returns a :class:`numpy.ndarray` view of pinned host memory,
+    the view keeps **pinned** alive."""
+    dtype = np.dtype(dtype)
+    buf = (c_char * (dtype.itemsize * size)).from_address(pinned.ptr.value)
+    buf.owner = pinned
+    return np.frombuffer(buf, dtype, size)
+
+class Event(object):
+    def __init__(self):
+        self.event = c_void_p()
+        check_hip(hip.hipEventCreate(byref(self.event)))
+        track_for_finalization(self, self.event, Event._finalize)
+
+    @classmethod
+    def _finalize(cls, event):
+        check_hip(hip.hipEventDestroy(event))
+
+    def record(self, stream):
+        check_hip(hip.hipEventRecord(self.event, stream))
+
+    def synchronize(self):
+        check_hip(hip.hipEventSynchronize(self.event))
+
+class ExternalMemoryPointer(object):
+    """Device memory owned by another library.
+
+    **owner** is kept alive while the pointer is used.
+    """
+
+    def __init__(self, ptr, owner):
+        self.ptr = c_void_p(ptr)
+        self.owner = owner
+
+class DLDevice(Structure):
+    _fields_ = [("device_type", c_int), ("device_id", c_int)]
+
+class DLDataType(Structure):
+    _fields_ = [("code", c_uint8), ("bits", c_uint8), ("lanes", c_uint16)]
+
+class DLTensor(Structure):
+    _fields_ = [
+        ("data", c_void_p),
+        ("device", DLDevice),
+        ("ndim", c_int),
+        ("dtype", DLDataType),
+        ("shape", POINTER(c_int64)),
+        ("strides", POINTER(c_int64)),
+        ("byte_offset", c_uint64)]
+
+DLManagedTensorDeleter = CFUNCTYPE(None, c_void_p)
+
+class DLManagedTensor(Structure):
+    _fields_ = [
+        ("dl_tensor", DLTensor),
+        ("manager_ctx", c_void_p),
+        ("deleter", DLManagedTensorDeleter)]
+
+_PyCapsule_IsValid = pythonapi.PyCapsule_IsValid
+_PyCapsule_IsValid.restype = c_int
+_PyCapsule_IsValid.argtypes = [py_object, c_char_p]
+_PyCapsule_GetPointer = pythonapi.PyCapsule_GetPointer
+_PyCapsule_GetPointer.restype = c_void_p
+_PyCapsule_GetPointer.argtypes = [py_object, c_char_p]
+_PyCapsule_SetName = pythonapi.PyCapsule_SetName
+_PyCapsule_SetName.restype = c_int
+_PyCapsule_SetName.argtypes = [py_object, c_char_p]
+
+class DLPackMemoryPointer(object):
+    """Device memory of a consumed DLPack capsule.
+
+    The capsule is renamed to "used_dltensor" as the DLPack protocol requires,
+    the producer's deleter is called when the pointer is destroyed.
+    """
+
+    def __init__(self, capsule):
+        if not _PyCapsule_IsValid(capsule, b"dltensor"):
+            raise TypeError("invalid or already consumed DLPack capsule")
+        address = _PyCapsule_GetPointer(capsule, b"dltensor")
+        self.tensor = DLManagedTensor.from_address(address)
+        _PyCapsule_SetName(capsule, b"used_dltensor")
+        track_for_finalization(self, address, DLPackMemoryPointer._finalize)
+
+        dl_tensor = self.tensor.dl_tensor
+        self.ptr = c_void_p((dl_tensor.data or 0) + dl_tensor.byte_offset)
+
+    @classmethod
+    def _finalize(cls, address):
+        tensor = DLManagedTensor.from_address(address)
+        if tensor.deleter:
+            tensor.deleter(address)
+
 def device_pointer(dary):
     return dary.data.ptr
 
+def _c_contiguous(shape, strides, itemsize):
+    if strides is None:
+        return True
+    expected = itemsize
+    for dim, stride in reversed(list(zip(shape, strides))):
+        if dim != 1 and stride != expected:
+            return False
+        expected *= dim
+    return True
+
+def _synchronize_producer_stream(stream):
+    # 1 and 2 are the legacy and per-thread default streams
+    if stream is not None:
+        check_hip(hip.hipStreamSynchronize(c_void_p(0 if stream in (1, 2) else stream)))
+
+def _from_cuda_array_interface(ary):
+    interface = ary.__cuda_array_interface__
+    shape = tuple(interface["shape"])
+    dtype = np.dtype(interface["typestr"])
+    ptr, readonly = interface["data"]
+    if readonly:
+        raise ValueError("ary is read-only")
+    if not _c_contiguous(shape, interface.get("strides"), dtype.itemsize):
+        raise ValueError("ary must be C-contiguous")
+    _synchronize_producer_stream(interface.get("stream"))
+    return DeviceNDArray(shape, dtype, ExternalMemoryPointer(ptr or 0, ary))
+
+_DLPACK_TYPE_KINDS = {0: "i", 1: "u", 2: "f"}
+
+def _from_dlpack(ary):
+    device_type, _ = ary.__dlpack_device__()
+    if device_type not in DLPACK_DEVICE_TYPES:
+        raise TypeError("DLPack tensor is not in HIP device memory")
+
+    data = DLPackMemoryPointer(ary.__dlpack__())
+    dl_tensor = data.tensor.dl_tensor
+    if dl_tensor.dtype.code not in _DLPACK_TYPE_KINDS or dl_tensor.dtype.lanes != 1:
+        raise TypeError("unsupported DLPack data type")
+    dtype = np.dtype("{}{}".format(_DLPACK_TYPE_KINDS[dl_tensor.dtype.code], dl_tensor.dtype.bits // 8))
+    shape = tuple(dl_tensor.shape[i] for i in range(dl_tensor.ndim))
+    strides = None
+    if dl_tensor.strides:
+        # DLPack strides are in elements
+        strides = tuple(dl_tensor.strides[i] * dtype.itemsize for i in range(dl_tensor.ndim))
+    if not _c_contiguous(shape, strides, dtype.itemsize):
+        raise ValueError("ary must be C-contiguous")
+    return DeviceNDArray(shape, dtype, data)
+
+def as_device_array(ary):
+    """Returns a :class:`DeviceNDArray` that shares memory with device-side **ary**.
+
+    **ary** can be a :class:`DeviceNDArray` or an object of another library
+    that exports ``__cuda_array_interface__`` (CuPy, Numba, PyTorch) or
+    DLPack (``__dlpack__``). None is returned for host-side
+    :class:`numpy.ndarray`.
+
+    :param ary: Device-side array
+    """
+    if isinstance(ary, np.ndarray):
+        return None
+    if isinstance(ary, DeviceNDArray):
+        return ary
+    if hasattr(ary, "__cuda_array_interface__"):
+        return _from_cuda_array_interface(ary)
+    if hasattr(ary, "__dlpack__") and hasattr(ary, "__dlpack_device__"):
+        return _from_dlpack(ary)
+    raise TypeError("unsupported type {}".format(type(ary)))
+
+class StagingBuffers(object):
+    """Device-side and pinned host-side buffers reused for host-side outputs.
+
+    Buffers grow when a larger size is requested and are never shrunk.
+    """
+
+    def __init__(self):
+        self.device = None
+        self.host = None
+
+    def get(self, nbytes):
+        if self.host is None or self.host.nbytes < nbytes:
+            # The old buffers are freed before the new are allocated
+            self.device = self.host = None
+            self.device = MemoryPointer(nbytes)
+            self.host = PinnedMemoryPointer(nbytes)
+        return self.device, self.host
+
+    def copy_to_host(self, ary, nbytes, stream):
+        """Copies **nbytes** from the device buffer to **ary** through the
+        pinned buffer, the copy is asynchronous to the host in **stream**."""
+        self.copy_many_to_host([(ary, 0, nbytes)], nbytes, stream)
+
+    def copy_many_to_host(self, outputs, nbytes, stream):
+        """Copies the first **nbytes** of the device buffer with one copy
+        in **stream**, then every (ary, offset, size) of **outputs** receives
+        **size** bytes starting at **offset** of the buffer."""
+        memcpy_device_to_host_async(self.host, self.device, nbytes, stream)
+        check_hip(hip.hipStreamSynchronize(stream))
+        for ary, offset, size in outputs:
+            memmove(ary.ctypes.data_as(c_void_p), self.host.ptr.value + offset, size)
+
 class DeviceNDArray(object):
     """Device-side array.
 
@@ -161,6 +380,15 @@ class DeviceNDArray(object):
 
         return ary
 
+    @property
+    def __cuda_array_interface__(self):
+        return {
+            "shape": self.shape,
+            "typestr": self.dtype.str,
+            "data": (device_pointer(self).value, False),
+            "strides": None,
+            "version": 2}
+
 def empty(shape, dtype):
     """Create a new device-side array of given shape and type, without initializing entries.
 
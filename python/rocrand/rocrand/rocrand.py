@@ -26,10 +26,13 @@ import ctypes.util
 from ctypes import *
 
 import numbers
+import threading
 import numpy as np
 
 from .hip import load_hip, HIP_PATHS
-from .hip import empty, DeviceNDArray, device_pointer
+from .hip import empty, DeviceNDArray, device_pointer, as_device_array
+from .hip import StagingBuffers, MemoryPointer, PinnedMemoryPointer, Event
+from .hip import memcpy_device_to_host_async, pinned_array
 
 from .utils import find_library, expand_paths
 from .finalize import track_for_finalization
@@ -58,8 +61,20 @@ ROCRAND_RNG_PSEUDO_XORWOW = 401
 ROCRAND_RNG_PSEUDO_MRG32K3A = 402
 ROCRAND_RNG_PSEUDO_MTGP32 = 403
 ROCRAND_RNG_PSEUDO_PHILOX4_32_10 = 404
+ROCRAND_RNG_PSEUDO_PHILOX4_64_10 = 405
+ROCRAND_RNG_PSEUDO_THREEFRY2_64_20 = 406
+ROCRAND_RNG_PSEUDO_THREEFRY4_64_20 = 407
+ROCRAND_RNG_PSEUDO_PHILOX4_32_7 = 408
+ROCRAND_RNG_PSEUDO_XOSHIRO128PP = 409
+ROCRAND_RNG_PSEUDO_PCG32 = 410
 ROCRAND_RNG_QUASI_DEFAULT = 500
 ROCRAND_RNG_QUASI_SOBOL32 = 501
+ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32 = 502
+ROCRAND_RNG_QUASI_SOBOL64 = 503
+ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64 = 504
+ROCRAND_RNG_QUASI_LATTICE32 = 505
+ROCRAND_RNG_QUASI_HALTON32 = 506
+ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32 = 507
 
 ROCRAND_STATUS_SUCCESS = 0
 ROCRAND_STATUS_VERSION_MISMATCH = 100
@@ -105,6 +120,18 @@ ROCRAND_STATUS = {
         "Internal library error")
 }
 
+ROCRAND_BATCH_UNIFORM = 0
+ROCRAND_BATCH_UNIFORM_DOUBLE = 1
+ROCRAND_BATCH_NORMAL = 2
+ROCRAND_BATCH_NORMAL_DOUBLE = 3
+ROCRAND_BATCH_POISSON = 4
+
+class rocrand_batch_request(Structure):
+    _fields_ = [("distribution", c_int),
+                ("output_data", c_void_p),
+                ("n", c_size_t),
+                ("parameters", c_double * 2)]
+
 def check_rocrand(status):
     if status != ROCRAND_STATUS_SUCCESS:
         raise RocRandError(status)
@@ -124,13 +151,120 @@ class RocRandError(Exception):
         return "{} ({})".format(s, v)
 
 
+class _PooledGenerator(object):
+    """Generator of a :class:`GeneratorPool` and the state needed to reuse it."""
+
+    def __init__(self, pool, key, gen):
+        self.pool = pool
+        # (rngtype, seed, ndim) of the generator
+        self.key = key
+        self.gen = gen
+        self.staging = None
+        # Values were generated or the offset was set
+        self.advanced = False
+        self.stream_set = False
+
+
+class GeneratorPool(object):
+    """Cache of idle generators.
+
+    Generator objects created with a **pool** take an idle generator of the
+    same type and seed (or number of dimensions) from the pool and return it
+    when they are destroyed, so short-lived generator objects do not create
+    and destroy a generator (allocate and free its engines) every time.
+    Returned generators are moved back to the start of their sequence and to
+    the default stream, so a reused generator generates the same values as a
+    new one. Staging buffers of NumPy outputs are reused with the generator.
+
+    Example::
+
+        import rocrand
+        import numpy as np
+
+        pool = rocrand.GeneratorPool()
+
+        def sample(n):
+            a = np.empty(n, np.float32)
+            rocrand.PRNG(rocrand.PRNG.PHILOX4_32_10, seed=1234, pool=pool).uniform(a)
+            return a
+    """
+
+    def __init__(self, max_idle=4):
+        """__init__(self, max_idle=4)
+        Creates an empty pool.
+
+        :param max_idle: Maximum number of idle generators of every type and
+                         seed, other returned generators are destroyed
+        """
+        self.max_idle = max_idle
+        self._lock = threading.RLock()
+        self._idle = {}
+        track_for_finalization(self, self._idle, GeneratorPool._finalize)
+
+    @classmethod
+    def _finalize(cls, idle):
+        for entries in idle.values():
+            for entry in entries:
+                check_rocrand(rocrand.rocrand_destroy_generator(entry.gen))
+        idle.clear()
+
+    def clear(self):
+        """Destroys all idle generators."""
+        with self._lock:
+            GeneratorPool._finalize(self._idle)
+
+    def _acquire(self, key):
+        with self._lock:
+            entries = self._idle.get(key)
+            if entries:
+                return entries.pop()
+        return None
+
+    def _release(self, entry):
+        if entry.stream_set:
+            check_rocrand(rocrand.rocrand_set_stream(entry.gen, None))
+            entry.stream_set = False
+        if entry.advanced:
+            check_rocrand(rocrand.rocrand_set_offset(entry.gen, c_ulonglong(0)))
+            entry.advanced = False
+        with self._lock:
+            entries = self._idle.setdefault(entry.key, [])
+            if len(entries) < self.max_idle:
+                entries.append(entry)
+                return
+        check_rocrand(rocrand.rocrand_destroy_generator(entry.gen))
+
+
 class RNG(object):
-    """Random number generator base class."""
+    """Random number generator base class.
 
-    def __init__(self, rngtype, offset=None, stream=None):
-        self._gen = c_void_p()
-        check_rocrand(rocrand.rocrand_create_generator(byref(self._gen), rngtype))
-        track_for_finalization(self, self._gen, RNG._finalize)
+    Outputs can be NumPy arrays or device-side arrays (see
+    :func:`as_device_array`). Values are generated directly into device-side
+    arrays, like CuPy arrays or PyTorch tensors. NumPy arrays are filled
+    through device-side and pinned host-side buffers, which are owned by
+    the generator and reused by subsequent calls.
+    """
+
+    def __init__(self, rngtype, offset=None, stream=None, pool=None, key=None):
+        self._rngtype = rngtype
+        self._pooled = None
+        if pool is not None:
+            self._pooled = pool._acquire(key)
+        # A reused generator already has the seed or dimensions of key
+        self._reused = self._pooled is not None
+        if self._reused:
+            self._gen = self._pooled.gen
+        else:
+            self._gen = c_void_p()
+            check_rocrand(rocrand.rocrand_create_generator(byref(self._gen), rngtype))
+            if pool is not None:
+                self._pooled = _PooledGenerator(pool, key, self._gen)
+        if self._pooled is not None:
+            track_for_finalization(self, self._pooled, RNG._release)
+        else:
+            track_for_finalization(self, self._gen, RNG._finalize)
+        # Cleared when rocrand_generate_batch reports an unsupported generator
+        self._batch_supported = True
 
         self._offset = 0
         if offset is not None:
@@ -140,10 +274,30 @@ class RNG(object):
         if stream is not None:
             self.stream = stream
 
+        # Created on the first generation into a NumPy array
+        self._staging = None
+        if self._pooled is not None:
+            self._staging = self._pooled.staging
+
     @classmethod
     def _finalize(cls, gen):
         check_rocrand(rocrand.rocrand_destroy_generator(gen))
 
+    @classmethod
+    def _release(cls, entry):
+        entry.pool._release(entry)
+
+    def _advance(self):
+        if self._pooled is not None:
+            self._pooled.advanced = True
+
+    def _get_staging(self, nbytes):
+        if self._staging is None:
+            self._staging = StagingBuffers()
+            if self._pooled is not None:
+                self._pooled.staging = self._staging
+        return self._staging.get(nbytes)
+
     @property
     def offset(self):
         """Mutable attribute of the offset of random numbers sequence.
@@ -161,6 +315,7 @@ class RNG(object):
         """
         check_rocrand(rocrand.rocrand_set_offset(self._gen, c_ulonglong(offset)))
         self._offset = offset
+        self._advance()
 
     @property
     def stream(self):
@@ -170,6 +325,14 @@ class RNG(object):
     def stream(self, stream):
         check_rocrand(rocrand.rocrand_set_stream(self._gen, stream))
         self._stream = stream
+        if self._pooled is not None:
+            self._pooled.stream_set = True
+
+    @staticmethod
+    def _as_array(ary):
+        if isinstance(ary, np.ndarray):
+            return ary
+        return as_device_array(ary)
 
     def _generate(self, gen_func, ary, size, *args):
         if size is not None:
@@ -178,17 +341,16 @@ class RNG(object):
         else:
             size = ary.size
 
+        self._advance()
         if isinstance(ary, np.ndarray):
-            dary, needs_conversion = empty(size, ary.dtype), True
-        elif isinstance(ary, DeviceNDArray):
-            dary, needs_conversion = ary, False
+            # Values are generated into a reused device buffer and copied
+            # through a reused pinned buffer
+            nbytes = size * ary.dtype.itemsize
+            data, _ = self._get_staging(nbytes)
+            check_rocrand(gen_func(self._gen, data.ptr, c_size_t(size), *args))
+            self._staging.copy_to_host(ary, nbytes, self._stream)
         else:
-            raise TypeError("unsupported type {}".format(type(ary)))
-
-        check_rocrand(gen_func(self._gen, device_pointer(dary), c_size_t(size), *args))
-
-        if needs_conversion:
-            dary.copy_to_host(ary)
+            check_rocrand(gen_func(self._gen, device_pointer(ary), c_size_t(size), *args))
 
     def generate(self, ary, size=None):
         """Generates uniformly distributed integers.
@@ -199,9 +361,10 @@ class RNG(object):
         Supported **dtype** of **ary**: :class:`numpy.uint32`, :class:`numpy.int32`.
 
         :param ary:  NumPy array (:class:`numpy.ndarray`) or
-                     HIP device-side array (:class:`DeviceNDArray`)
+                     HIP device-side array (see :func:`as_device_array`)
         :param size: Number of samples to generate, default to **ary.size**
         """
+        ary = self._as_array(ary)
         if ary.dtype in (np.uint32, np.int32):
             self._generate(
                 rocrand.rocrand_generate,
@@ -221,9 +384,10 @@ class RNG(object):
         including 1.0.
 
         :param ary:  NumPy array (:class:`numpy.ndarray`) or
-                     HIP device-side array (:class:`DeviceNDArray`)
+                     HIP device-side array (see :func:`as_device_array`)
         :param size: Number of samples to generate, default to **ary.size**
         """
+        ary = self._as_array(ary)
         if ary.dtype == np.float32:
             self._generate(
                 rocrand.rocrand_generate_uniform,
@@ -244,11 +408,12 @@ class RNG(object):
         Supported **dtype** of **ary**: :class:`numpy.float32`, :class:`numpy.float64`.
 
         :param ary:    NumPy array (:class:`numpy.ndarray`) or
-                       HIP device-side array (:class:`DeviceNDArray`)
+                       HIP device-side array (see :func:`as_device_array`)
         :param mean:   Mean value of normal distribution
         :param stddev: Standard deviation value of normal distribution
         :param size:   Number of samples to generate, default to **ary.size**
         """
+        ary = self._as_array(ary)
         if ary.dtype == np.float32:
             self._generate(
                 rocrand.rocrand_generate_normal,
@@ -271,11 +436,12 @@ class RNG(object):
         Supported **dtype** of **ary**: :class:`numpy.float32`, :class:`numpy.float64`.
 
         :param ary:    NumPy array (:class:`numpy.ndarray`) or
-                       HIP device-side array (:class:`DeviceNDArray`)
+                       HIP device-side array (see :func:`as_device_array`)
         :param mean:   Mean value of log normal distribution
         :param stddev: Standard deviation value of log normal distribution
         :param size:   Number of samples to generate, default to **ary.size**
         """
+        ary = self._as_array(ary)
         if ary.dtype == np.float32:
             self._generate(
                 rocrand.rocrand_generate_log_normal,
@@ -298,10 +464,11 @@ class RNG(object):
         Supported **dtype** of **ary**: :class:`numpy.uint32`, :class:`numpy.int32`.
 
         :param ary:   NumPy array (:class:`numpy.ndarray`) or
-                      HIP device-side array (:class:`DeviceNDArray`)
+                      HIP device-side array (see :func:`as_device_array`)
         :param lmbd:  lambda for the Poisson distribution
         :param size:  Number of samples to generate, default to **ary.size**
         """
+        ary = self._as_array(ary)
         if ary.dtype in (np.uint32, np.int32):
             self._generate(
                 rocrand.rocrand_generate_poisson,
@@ -311,6 +478,202 @@ class RNG(object):
             raise TypeError("unsupported type {}".format(ary.dtype))
 
 
+    def _block_function(self, distribution, dtype, params):
+        dtype = np.dtype(dtype)
+        if distribution is None:
+            distribution = "generate" if dtype.kind in "iu" else "uniform"
+        single = dtype == np.float32
+        functions = {
+            ("generate", False): rocrand.rocrand_generate,
+            ("uniform", True): rocrand.rocrand_generate_uniform,
+            ("uniform", False): rocrand.rocrand_generate_uniform_double,
+            ("normal", True): rocrand.rocrand_generate_normal,
+            ("normal", False): rocrand.rocrand_generate_normal_double,
+            ("lognormal", True): rocrand.rocrand_generate_log_normal,
+            ("lognormal", False): rocrand.rocrand_generate_log_normal_double,
+            ("poisson", False): rocrand.rocrand_generate_poisson}
+        if distribution in ("generate", "poisson"):
+            supported = dtype in (np.uint32, np.int32)
+        else:
+            supported = dtype in (np.float32, np.float64)
+        if not supported or (distribution, single) not in functions:
+            raise TypeError("unsupported type {} for {}".format(dtype, distribution))
+
+        if distribution == "poisson":
+            args = tuple(c_double(p) for p in params)
+        else:
+            args = tuple((c_float if single else c_double)(p) for p in params)
+        return functions[(distribution, single)], args, distribution
+
+    def blocks(self, dtype, block_size, depth=2, distribution=None, params=(), count=None):
+        """Iterates over blocks of random numbers generated ahead of consumption.
+
+        Yields NumPy arrays of **block_size** values of **dtype**. Up to
+        **depth** blocks are generated and copied to pinned host memory
+        asynchronously in :attr:`stream`, so the generation of the next blocks
+        overlaps the processing of the current block. Blocks contain the same
+        values as consecutive calls of the distribution function with
+        arrays of **block_size** values.
+
+        A yielded array is overwritten when block k + **depth** is
+        generated, copy it if it is needed longer.
+
+        Example::
+
+            import rocrand
+            import numpy as np
+
+            gen = rocrand.PRNG()
+            for a in gen.blocks(np.float32, 1 << 20, count=100):
+                print(a.mean())
+
+        :param dtype:        Type of values (see **dtype** of the distribution functions)
+        :param block_size:   Number of values in a block
+        :param depth:        Number of blocks in flight, at least 1
+        :param distribution: "generate", "uniform", "normal", "lognormal" or
+                             "poisson", defaults to "generate" for integers
+                             and to "uniform" for floats
+        :param params:       Parameters of the distribution: mean and stddev
+                             of "normal" and "lognormal", lambda of "poisson"
+        :param count:        Number of blocks, None for an infinite iterator
+        """
+        gen_func, args, _ = self._block_function(distribution, dtype, params)
+        if depth < 1:
+            raise ValueError("depth must be at least 1")
+        nbytes = np.dtype(dtype).itemsize * block_size
+
+        # Copies of the device buffer are ordered in the stream,
+        # a single device buffer is enough
+        data = MemoryPointer(nbytes)
+        pinned = [PinnedMemoryPointer(nbytes) for _ in range(depth)]
+        events = [Event() for _ in range(depth)]
+        outputs = [pinned_array(p, dtype, block_size) for p in pinned]
+
+        def enqueue(block):
+            slot = block % depth
+            self._advance()
+            check_rocrand(gen_func(self._gen, data.ptr, c_size_t(block_size), *args))
+            memcpy_device_to_host_async(pinned[slot], data, nbytes, self._stream)
+            events[slot].record(self._stream)
+
+        def iterate():
+            enqueued = 0
+            while enqueued < depth and (count is None or enqueued < count):
+                enqueue(enqueued)
+                enqueued += 1
+            block = 0
+            while count is None or block < count:
+                slot = block % depth
+                events[slot].synchronize()
+                yield outputs[slot]
+                block += 1
+                if count is None or enqueued < count:
+                    enqueue(enqueued)
+                    enqueued += 1
+
+        # Arguments are checked and buffers are allocated before iterating
+        return iterate()
+
+    _BATCH_DISTRIBUTIONS = {
+        ("uniform", True): ROCRAND_BATCH_UNIFORM,
+        ("uniform", False): ROCRAND_BATCH_UNIFORM_DOUBLE,
+        ("normal", True): ROCRAND_BATCH_NORMAL,
+        ("normal", False): ROCRAND_BATCH_NORMAL_DOUBLE,
+        ("poisson", False): ROCRAND_BATCH_POISSON}
+
+    def generate_many(self, requests):
+        """Generates values of several requests with as few library calls as possible.
+
+        Every request is a tuple ``(distribution, ary, params...)``,
+        **ary.size** values are generated to **ary**. **distribution** and
+        **params** are the same as in :meth:`blocks`, for example
+        ``("normal", a, 0.0, 1.0)`` or ``("poisson", b, 10.0)``. The values
+        are the same as the values of calls of the distribution functions for
+        the requests in their order.
+
+        Consecutive uniform, normal and Poisson requests are generated by one
+        ``rocrand_generate_batch`` call (one kernel launch for every 40
+        requests) if the generator supports batches (:const:`PRNG.XORWOW`,
+        :const:`PRNG.MRG32K3A`, :const:`PRNG.XOSHIRO128PP`,
+        :const:`PRNG.PCG32`). NumPy outputs of such requests are generated
+        into one device buffer and copied to the host with one copy.
+        Other requests and generators use one call for every request.
+
+        Example::
+
+            import rocrand
+            import numpy as np
+
+            gen = rocrand.PRNG(rocrand.PRNG.XORWOW)
+            a = np.empty(100, np.float32)
+            b = np.empty(10, np.uint32)
+            gen.generate_many([("uniform", a), ("poisson", b, 4.0)])
+
+        :param requests: Sequence of requests
+        """
+        # All requests are checked before values are generated
+        resolved = []
+        for request in requests:
+            ary = self._as_array(request[1])
+            params = tuple(request[2:])
+            gen_func, args, distribution = self._block_function(request[0], ary.dtype, params)
+            batch = None
+            if self._batch_supported:
+                batch = RNG._BATCH_DISTRIBUTIONS.get((distribution, ary.dtype == np.float32))
+            resolved.append((ary, gen_func, args, batch, params))
+
+        group = []
+        for item in resolved:
+            if item[3] is not None and self._batch_supported:
+                group.append(item)
+                continue
+            self._generate_batch(group)
+            group = []
+            ary, gen_func, args = item[:3]
+            self._generate(gen_func, ary, None, *args)
+        self._generate_batch(group)
+
+    def _generate_batch(self, group):
+        if not group:
+            return
+        self._advance()
+
+        # NumPy outputs are placed at 256-byte aligned offsets of the device buffer
+        nbytes = 0
+        offsets = []
+        for ary, _, _, _, _ in group:
+            offsets.append(nbytes)
+            if isinstance(ary, np.ndarray):
+                nbytes += (ary.nbytes + 255) // 256 * 256
+        data = None
+        if nbytes > 0:
+            data, _ = self._get_staging(nbytes)
+
+        requests = (rocrand_batch_request * len(group))()
+        outputs = []
+        for request, offset, (ary, _, _, batch, params) in zip(requests, offsets, group):
+            request.distribution = batch
+            request.n = ary.size
+            for i, p in enumerate(params):
+                request.parameters[i] = p
+            if isinstance(ary, np.ndarray):
+                request.output_data = data.ptr.value + offset
+                outputs.append((ary, offset, ary.nbytes))
+            else:
+                request.output_data = device_pointer(ary).value
+
+        status = rocrand.rocrand_generate_batch(self._gen, requests, c_size_t(len(group)))
+        if status == ROCRAND_STATUS_TYPE_ERROR:
+            # The generator has no batches, nothing was generated
+            self._batch_supported = False
+            for ary, gen_func, args, _, _ in group:
+                self._generate(gen_func, ary, None, *args)
+            return
+        check_rocrand(status)
+        if outputs:
+            self._staging.copy_many_to_host(outputs, nbytes, self._stream)
+
+
 class PRNG(RNG):
     """Pseudo-random number generator.
 
@@ -335,13 +698,26 @@ class PRNG(RNG):
     """Mersenne Twister MTGP32 pseudo-random generator type"""
     PHILOX4_32_10 = ROCRAND_RNG_PSEUDO_PHILOX4_32_10
     """PHILOX_4x32 (10 rounds) pseudo-random generator type"""
-
-    def __init__(self, rngtype=DEFAULT, seed=None, offset=None, stream=None):
-        """__init__(self, rngtype=DEFAULT, seed=None, offset=None, stream=None)
+    PHILOX4_64_10 = ROCRAND_RNG_PSEUDO_PHILOX4_64_10
+    """PHILOX_4x64 (10 rounds) pseudo-random generator type"""
+    THREEFRY2_64_20 = ROCRAND_RNG_PSEUDO_THREEFRY2_64_20
+    """THREEFRY_2x64 (20 rounds) pseudo-random generator type"""
+    THREEFRY4_64_20 = ROCRAND_RNG_PSEUDO_THREEFRY4_64_20
+    """THREEFRY_4x64 (20 rounds) pseudo-random generator type"""
+    PHILOX4_32_7  = ROCRAND_RNG_PSEUDO_PHILOX4_32_7
+    """PHILOX_4x32 (7 rounds) pseudo-random generator type"""
+    XOSHIRO128PP  = ROCRAND_RNG_PSEUDO_XOSHIRO128PP
+    """xoshiro128++ pseudo-random generator type"""
+    PCG32  = ROCRAND_RNG_PSEUDO_PCG32
+    """PCG32 pseudo-random generator type"""
+
+    def __init__(self, rngtype=DEFAULT, seed=None, offset=None, stream=None, pool=None):
+        """__init__(self, rngtype=DEFAULT, seed=None, offset=None, stream=None, pool=None)
         Creates a new pseudo-random number generator.
 
         A new pseudo-random number generator of type **rngtype** is initialized
-        with given **seed**, **offset** and **stream**.
+        with given **seed**, **offset** and **stream**. If **pool** is given,
+        an idle generator with the same **rngtype** and **seed** is reused.
 
         Values of **rngtype**:
 
@@ -350,17 +726,29 @@ class PRNG(RNG):
         * :const:`MRG32K3A`
         * :const:`MTGP32`
         * :const:`PHILOX4_32_10`
+        * :const:`PHILOX4_64_10`
+        * :const:`THREEFRY2_64_20`
+        * :const:`THREEFRY4_64_20`
+        * :const:`PHILOX4_32_7`
+        * :const:`XOSHIRO128PP`
+        * :const:`PCG32`
 
         :param rngtype: Type of pseudo-random number generator to create
         :param seed:    Initial seed value
         :param offset:  Initial offset of random numbers sequence
         :param stream:  HIP stream for all kernel launches of the generator
+        :param pool:    :class:`GeneratorPool` to take the generator from
+                        and to return it to
         """
-        super(PRNG, self).__init__(rngtype, offset=offset, stream=stream)
+        super(PRNG, self).__init__(rngtype, offset=offset, stream=stream,
+                                   pool=pool, key=(rngtype, seed, None))
 
         self._seed = None
         if seed is not None:
-            self.seed = seed
+            if self._reused:
+                self._seed = seed
+            else:
+                self.seed = seed
 
     @property
     def seed(self):
@@ -374,6 +762,8 @@ class PRNG(RNG):
     def seed(self, seed):
         check_rocrand(rocrand.rocrand_set_seed(self._gen, c_ulonglong(seed)))
         self._seed = seed
+        if self._pooled is not None:
+            self._pooled.key = (self._rngtype, seed, None)
 
 
 class QRNG(RNG):
@@ -394,38 +784,64 @@ class QRNG(RNG):
     """Default quasi-random generator type, :const:`SOBOL32`"""
     SOBOL32           = ROCRAND_RNG_QUASI_SOBOL32
     """Sobol32 quasi-random generator type"""
-
-    def __init__(self, rngtype=DEFAULT, ndim=None, offset=None, stream=None):
-        """__init__(self, rngtype=DEFAULT, ndim=None, offset=None, stream=None)
+    SCRAMBLED_SOBOL32 = ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32
+    """Scrambled Sobol32 quasi-random generator type"""
+    SOBOL64           = ROCRAND_RNG_QUASI_SOBOL64
+    """Sobol64 quasi-random generator type"""
+    SCRAMBLED_SOBOL64 = ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64
+    """Scrambled Sobol64 quasi-random generator type"""
+    LATTICE32         = ROCRAND_RNG_QUASI_LATTICE32
+    """Rank-1 lattice sequence quasi-random generator type"""
+    HALTON32          = ROCRAND_RNG_QUASI_HALTON32
+    """Halton quasi-random generator type"""
+    SCRAMBLED_HALTON32 = ROCRAND_RNG_QUASI_SCRAMBLED_HALTON32
+    """Scrambled Halton quasi-random generator type"""
+
+    def __init__(self, rngtype=DEFAULT, ndim=None, offset=None, stream=None, pool=None):
+        """__init__(self, rngtype=DEFAULT, ndim=None, offset=None, stream=None, pool=None)
         Creates a new quasi-random number generator.
 
         A new quasi-random number generator of type **rngtype** is initialized
-        with given **ndim**, **offset** and **stream**.
+        with given **ndim**, **offset** and **stream**. If **pool** is given,
+        an idle generator with the same **rngtype** and **ndim** is reused.
 
         Values of **rngtype**:
 
         * :const:`DEFAULT`
         * :const:`SOBOL32`
+        * :const:`SCRAMBLED_SOBOL32`
+        * :const:`SOBOL64`
+        * :const:`SCRAMBLED_SOBOL64`
+        * :const:`LATTICE32`
+        * :const:`HALTON32`
+        * :const:`SCRAMBLED_HALTON32`
 
-        Values if **ndim** are 1 to 20000.
+        Values if **ndim** are 1 to 20000 for Sobol generators, 1 to 1048576
+        for :const:`LATTICE32` and 1 to 65536 for Halton generators.
 
         :param rngtype: Type of quasi-random number generator to create
         :param ndim:    Number of dimensions
         :param offset:  Initial offset of random numbers sequence
         :param stream:  HIP stream for all kernel launches of the generator
+        :param pool:    :class:`GeneratorPool` to take the generator from
+                        and to return it to
         """
 
-        super(QRNG, self).__init__(rngtype, offset=offset, stream=stream)
+        super(QRNG, self).__init__(rngtype, offset=offset, stream=stream,
+                                   pool=pool, key=(rngtype, None, ndim or 1))
 
         self._ndim = 1
         if ndim is not None:
-            self.ndim = ndim
+            if self._reused:
+                self._ndim = ndim
+            else:
+                self.ndim = ndim
 
     @property
     def ndim(self):
         """Mutable attribute of the number of dimensions of random numbers sequence.
 
-        Supported values are 1 to 20000.
+        Supported values are 1 to 20000 for Sobol generators (see above).
         Setting this attribute resets the sequence.
         """
         return self._ndim
@@ -434,6 +850,8 @@ class QRNG(RNG):
     def ndim(self, ndim):
         check_rocrand(rocrand.rocrand_set_quasi_random_generator_dimensions(self._gen, c_uint(ndim)))
         self._ndim = ndim
+        if self._pooled is not None:
+            self._pooled.key = (self._rngtype, None, ndim)
 
 
 def get_version():
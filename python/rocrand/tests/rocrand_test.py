@@ -62,6 +62,12 @@ make_test(TestCtorPRNG, "DEFAULT",       rngtype=PRNG.DEFAULT)
 make_test(TestCtorPRNG, "XORWOW",        rngtype=PRNG.XORWOW)
 make_test(TestCtorPRNG, "MRG32K3A",      rngtype=PRNG.MRG32K3A)
 make_test(TestCtorPRNG, "PHILOX4_32_10", rngtype=PRNG.PHILOX4_32_10)
+make_test(TestCtorPRNG, "PHILOX4_64_10", rngtype=PRNG.PHILOX4_64_10)
+make_test(TestCtorPRNG, "THREEFRY2_64_20", rngtype=PRNG.THREEFRY2_64_20)
+make_test(TestCtorPRNG, "THREEFRY4_64_20", rngtype=PRNG.THREEFRY4_64_20)
+make_test(TestCtorPRNG, "PHILOX4_32_7",  rngtype=PRNG.PHILOX4_32_7)
+make_test(TestCtorPRNG, "XOSHIRO128PP",  rngtype=PRNG.XOSHIRO128PP)
+make_test(TestCtorPRNG, "PCG32",         rngtype=PRNG.PCG32)
 
 class TestCtorPRNGMTGP32(TestRNGBase):
     rngtype = PRNG.MTGP32
@@ -110,6 +116,12 @@ make_test(TestParamsPRNG, "DEFAULT",       rngtype=PRNG.DEFAULT)
 make_test(TestParamsPRNG, "XORWOW",        rngtype=PRNG.XORWOW)
 make_test(TestParamsPRNG, "MRG32K3A",      rngtype=PRNG.MRG32K3A)
 make_test(TestParamsPRNG, "PHILOX4_32_10", rngtype=PRNG.PHILOX4_32_10)
+make_test(TestParamsPRNG, "PHILOX4_64_10", rngtype=PRNG.PHILOX4_64_10)
+make_test(TestParamsPRNG, "THREEFRY2_64_20", rngtype=PRNG.THREEFRY2_64_20)
+make_test(TestParamsPRNG, "THREEFRY4_64_20", rngtype=PRNG.THREEFRY4_64_20)
+make_test(TestParamsPRNG, "PHILOX4_32_7",  rngtype=PRNG.PHILOX4_32_7)
+make_test(TestParamsPRNG, "XOSHIRO128PP",  rngtype=PRNG.XOSHIRO128PP)
+make_test(TestParamsPRNG, "PCG32",         rngtype=PRNG.PCG32)
 
 class TestParamsPRNGMTGP32(TestRNGBase):
     rngtype = PRNG.MTGP32
@@ -269,14 +281,152 @@ class TestGenerate(TestRNGBase):
         self.assertTrue((output[:OUTPUT_SIZE] <= 1.0).all())
         self.assertTrue((output[OUTPUT_SIZE:] == 10.0).all())
 
+    def test_staging(self):
+        output = np.empty(OUTPUT_SIZE, np.float32)
+        self.rng.uniform(output)
+        device, host = self.rng._staging.get(0)
+        # Smaller requests reuse the buffers
+        self.rng.normal(np.empty(OUTPUT_SIZE // 2, np.float32), 0.0, 1.0)
+        self.assertIs(self.rng._staging.device, device)
+        self.assertIs(self.rng._staging.host, host)
+        self.assertTrue((output <= 1.0).all())
+
+    def test_cuda_array_interface(self):
+        class Array(object):
+            def __init__(self, dary):
+                self.dary = dary
+                self.__cuda_array_interface__ = dary.__cuda_array_interface__
+
+        dary = empty(OUTPUT_SIZE, np.float32)
+        self.rng.uniform(Array(dary))
+        output = dary.copy_to_host()
+        self.assertAlmostEqual(output.mean(), 0.5, delta=0.2)
+
+        strided = dict(dary.__cuda_array_interface__, shape=(OUTPUT_SIZE // 2,), strides=(8,))
+        with self.assertRaises(ValueError):
+            self.rng.uniform(type("Strided", (object,), {"__cuda_array_interface__": strided})())
+
+    def test_blocks(self):
+        block_size = 1000
+        expected = np.empty(block_size * 5, np.float32)
+        self.rng.normal(expected, 1.0, 2.0)
+
+        rng = self.klass(self.rngtype)
+        blocks = [b.copy() for b in rng.blocks(np.float32, block_size, depth=2,
+                distribution="normal", params=(1.0, 2.0), count=5)]
+        self.assertEqual(len(blocks), 5)
+        self.assertTrue((np.concatenate(blocks) == expected).all())
+
+        with self.assertRaises(TypeError):
+            rng.blocks(np.int8, block_size)
+        with self.assertRaises(TypeError):
+            rng.blocks(np.float32, block_size, distribution="poisson", params=(10.0,))
+        with self.assertRaises(ValueError):
+            rng.blocks(np.uint32, block_size, depth=0)
+
+    def test_blocks_infinite(self):
+        for i, b in enumerate(self.rng.blocks(np.uint32, OUTPUT_SIZE, depth=3)):
+            self.assertEqual(b.dtype, np.uint32)
+            self.assertEqual(b.size, OUTPUT_SIZE)
+            if i == 10:
+                break
+
+    def test_generate_many(self):
+        expected = [np.empty(100, np.float32), np.empty(50, np.float64),
+                    np.empty(30, np.uint32), np.empty(20, np.float32), np.empty(10, np.uint32)]
+        self.rng.uniform(expected[0])
+        self.rng.normal(expected[1], 1.0, 2.0)
+        self.rng.poisson(expected[2], 4.0)
+        self.rng.lognormal(expected[3], 0.0, 1.0)
+        self.rng.generate(expected[4])
+
+        rng = self.klass(self.rngtype)
+        outputs = [np.empty(100, np.float32), empty(50, np.float64),
+                   np.empty(30, np.uint32), np.empty(20, np.float32), np.empty(10, np.uint32)]
+        rng.generate_many([("uniform", outputs[0]), ("normal", outputs[1], 1.0, 2.0),
+                           ("poisson", outputs[2], 4.0), ("lognormal", outputs[3], 0.0, 1.0),
+                           ("generate", outputs[4])])
+        outputs[1] = outputs[1].copy_to_host()
+        for output, e in zip(outputs, expected):
+            self.assertTrue((output == e).all())
+
+        with self.assertRaises(TypeError):
+            rng.generate_many([("uniform", np.empty(10, np.float32)), ("poisson", np.empty(10, np.float32), 1.0)])
+
+    def test_cupy(self):
+        try:
+            import cupy
+        except ImportError:
+            self.skipTest("CuPy is not installed")
+        output = cupy.empty(OUTPUT_SIZE, cupy.float64)
+        self.rng.uniform(output)
+        self.assertAlmostEqual(float(output.mean()), 0.5, delta=0.2)
+
+    def test_torch(self):
+        try:
+            import torch
+        except ImportError:
+            self.skipTest("PyTorch is not installed")
+        if not torch.cuda.is_available():
+            self.skipTest("PyTorch has no HIP devices")
+        output = torch.empty(OUTPUT_SIZE, dtype=torch.float32, device="cuda")
+        self.rng.normal(output, 0.0, 1.0)
+        self.assertAlmostEqual(float(output.mean()), 0.0, delta=0.2)
+
 make_test(TestGenerate, "PRNG" + "DEFAULT",       klass=PRNG, rngtype=PRNG.DEFAULT)
 make_test(TestGenerate, "PRNG" + "XORWOW",        klass=PRNG, rngtype=PRNG.XORWOW)
 make_test(TestGenerate, "PRNG" + "MRG32K3A",      klass=PRNG, rngtype=PRNG.MRG32K3A)
 make_test(TestGenerate, "PRNG" + "MTGP32",        klass=PRNG, rngtype=PRNG.MTGP32)
 make_test(TestGenerate, "PRNG" + "PHILOX4_32_10", klass=PRNG, rngtype=PRNG.PHILOX4_32_10)
+make_test(TestGenerate, "PRNG" + "PHILOX4_64_10", klass=PRNG, rngtype=PRNG.PHILOX4_64_10)
+make_test(TestGenerate, "PRNG" + "THREEFRY2_64_20", klass=PRNG, rngtype=PRNG.THREEFRY2_64_20)
+make_test(TestGenerate, "PRNG" + "THREEFRY4_64_20", klass=PRNG, rngtype=PRNG.THREEFRY4_64_20)
+make_test(TestGenerate, "PRNG" + "PHILOX4_32_7",  klass=PRNG, rngtype=PRNG.PHILOX4_32_7)
+make_test(TestGenerate, "PRNG" + "XOSHIRO128PP",  klass=PRNG, rngtype=PRNG.XOSHIRO128PP)
+make_test(TestGenerate, "PRNG" + "PCG32",         klass=PRNG, rngtype=PRNG.PCG32)
 make_test(TestGenerate, "QRNG" + "DEFAULT",       klass=QRNG, rngtype=QRNG.DEFAULT)
 make_test(TestGenerate, "QRNG" + "SOBOL32",       klass=QRNG, rngtype=QRNG.SOBOL32)
 
+class TestGeneratorPool(TestRNGBase):
+    rngtype = PRNG.PHILOX4_32_10
+
+    def _sample(self, pool, seed, offset=None):
+        rng = PRNG(self.rngtype, seed=seed, offset=offset, pool=pool)
+        output = np.empty(OUTPUT_SIZE, np.uint32)
+        rng.generate(output)
+        rng.generate(output)
+        return output, rng._gen.value
+
+    def test_reuse(self):
+        pool = GeneratorPool()
+        expected, gen = self._sample(pool, 1234)
+        for _ in range(3):
+            output, reused = self._sample(pool, 1234)
+            # A reused generator restarts its sequence
+            self.assertEqual(reused, gen)
+            self.assertTrue((output == expected).all())
+
+        fresh = np.empty(OUTPUT_SIZE, np.uint32)
+        rng = PRNG(self.rngtype, seed=1234)
+        rng.generate(fresh)
+        rng.generate(fresh)
+        self.assertTrue((fresh == expected).all())
+
+        output, other = self._sample(pool, 4321)
+        self.assertNotEqual(other, gen)
+        self.assertFalse((output == expected).all())
+        output, reused = self._sample(pool, 1234, offset=100)
+        self.assertEqual(reused, gen)
+
+    def test_max_idle(self):
+        pool = GeneratorPool(max_idle=1)
+        rngs = [PRNG(self.rngtype, seed=1, pool=pool) for _ in range(3)]
+        self.assertEqual(len(set(r._gen.value for r in rngs)), 3)
+        del rngs
+        self.assertEqual(len(pool._idle[(self.rngtype, 1, None)]), 1)
+        pool.clear()
+        self.assertEqual(len(pool._idle), 0)
+
 
 if __name__ == "__main__":
     unittest.main()
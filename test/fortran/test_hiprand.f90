@@ -209,6 +209,40 @@ contains
         call assert_equals(HIPRAND_STATUS_SUCCESS, hiprandDestroyGenerator(gen))
     end subroutine test_hiprandGeneratePoisson
 
+    !> Test hiprandGenerateBatch.
+    subroutine test_hiprandGenerateBatch()
+        integer(kind =8) :: gen
+        real, target, dimension(128) :: h_x
+        integer(kind =4), target, dimension(128) :: h_y
+        type(c_ptr) :: d_x, d_y
+        type(hiprandBatchRequest), dimension(2) :: requests
+        integer(c_size_t), parameter :: output_size = 128, count = 2
+        real, parameter :: mean = 0.5, delta = 0.1
+        double precision, parameter :: lambda = 20.0
+        call assert_equals(hipSuccess, hipMalloc(d_x, output_size * sizeof(h_x(1))))
+        call assert_equals(hipSuccess, hipMalloc(d_y, output_size * sizeof(h_y(1))))
+        requests(1)%distribution = HIPRAND_BATCH_UNIFORM
+        requests(1)%output_data = d_x
+        requests(1)%n = output_size
+        requests(1)%parameters = 0.0
+        requests(2)%distribution = HIPRAND_BATCH_POISSON
+        requests(2)%output_data = d_y
+        requests(2)%n = output_size
+        requests(2)%parameters = (/ lambda, 0.0d0 /)
+        call assert_equals(HIPRAND_STATUS_SUCCESS, hiprandCreateGenerator(gen, &
+        HIPRAND_RNG_PSEUDO_XORWOW))
+        call assert_equals(HIPRAND_STATUS_SUCCESS, hiprandGenerateBatch(gen, requests, count))
+        call assert_equals(hipSuccess, hipMemcpy(c_loc(h_x), d_x, output_size * sizeof(h_x(1)), &
+        hipMemcpyDeviceToHost))
+        call assert_equals(hipSuccess, hipMemcpy(c_loc(h_y), d_y, output_size * sizeof(h_y(1)), &
+        hipMemcpyDeviceToHost))
+        call assert_equals((sum(h_x) / output_size), mean, delta)
+        call assert_equals(dble(sum(h_y)) / output_size, lambda, 2.0d0)
+        call assert_equals(hipSuccess, hipFree(d_x))
+        call assert_equals(hipSuccess, hipFree(d_y))
+        call assert_equals(HIPRAND_STATUS_SUCCESS, hiprandDestroyGenerator(gen))
+    end subroutine test_hiprandGenerateBatch
+
     !> Call each test.
     subroutine hiprand_basket()
     character(len=*) :: suite_name
@@ -241,6 +275,9 @@ contains
     call run_fruit_test_case(test_hiprandGeneratePoisson,'test_hiprandGeneratePoisson',&
         setup,teardown,suite_name)
 
+    call run_fruit_test_case(test_hiprandGenerateBatch,'test_hiprandGenerateBatch',&
+        setup,teardown,suite_name)
+
     end subroutine hiprand_basket
 
 end module test_hiprand
@@ -209,6 +209,108 @@ contains
         call assert_equals(ROCRAND_STATUS_SUCCESS, rocrand_destroy_generator(gen))
     end subroutine test_rocrand_generate_poisson
 
+    !> Test rocrand_set_stream and rocrand_get_stream.
+    subroutine test_rocrand_stream()
+        integer(kind =8) :: gen
+        integer(c_size_t) :: stream, generator_stream
+        real, target, dimension(128) :: h_x
+        type(c_ptr) :: d_x
+        integer(c_size_t), parameter :: output_size = 128
+        real, parameter :: mean = 0.5, delta = 0.1
+        call assert_equals(hipSuccess, hipStreamCreate(stream))
+        call assert_equals(hipSuccess, hipMalloc(d_x, output_size * sizeof(h_x(1))))
+        call assert_equals(ROCRAND_STATUS_SUCCESS, rocrand_create_generator(gen, &
+        ROCRAND_RNG_PSEUDO_XORWOW))
+        call assert_equals(ROCRAND_STATUS_SUCCESS, rocrand_set_stream(gen, stream))
+        call assert_equals(ROCRAND_STATUS_SUCCESS, rocrand_get_stream(gen, generator_stream))
+        call assert_equals(.true., stream == generator_stream)
+        call assert_equals(ROCRAND_STATUS_SUCCESS, rocrand_initialize_generator_async(gen))
+        call assert_equals(ROCRAND_STATUS_SUCCESS, rocrand_generate_uniform(gen, d_x, output_size))
+        call assert_equals(hipSuccess, hipStreamSynchronize(stream))
+        call assert_equals(hipSuccess, hipMemcpy(c_loc(h_x), d_x, output_size * sizeof(h_x(1)), &
+        hipMemcpyDeviceToHost))
+        call assert_equals((sum(h_x) / output_size), mean, delta)
+        call assert_equals(hipSuccess, hipFree(d_x))
+        call assert_equals(ROCRAND_STATUS_SUCCESS, rocrand_destroy_generator(gen))
+        call assert_equals(hipSuccess, hipStreamDestroy(stream))
+    end subroutine test_rocrand_stream
+
+    !> Test rocrand_generate_batch.
+    subroutine test_rocrand_generate_batch()
+        integer(kind =8) :: gen
+        real, target, dimension(128) :: h_x
+        double precision, target, dimension(128) :: h_y
+        type(c_ptr) :: d_x, d_y
+        type(rocrand_batch_request), dimension(2) :: requests
+        integer(c_size_t), parameter :: output_size = 128, count = 2
+        real, parameter :: mean = 0.5, delta = 0.1
+        double precision, parameter :: normal_mean = 5.0, normal_delta = 0.5
+        call assert_equals(hipSuccess, hipMalloc(d_x, output_size * sizeof(h_x(1))))
+        call assert_equals(hipSuccess, hipMalloc(d_y, output_size * sizeof(h_y(1))))
+        requests(1)%distribution = ROCRAND_BATCH_UNIFORM
+        requests(1)%output_data = d_x
+        requests(1)%n = output_size
+        requests(1)%parameters = 0.0
+        requests(2)%distribution = ROCRAND_BATCH_NORMAL_DOUBLE
+        requests(2)%output_data = d_y
+        requests(2)%n = output_size
+        requests(2)%parameters = (/ normal_mean, 1.0d0 /)
+        call assert_equals(ROCRAND_STATUS_SUCCESS, rocrand_create_generator(gen, &
+        ROCRAND_RNG_PSEUDO_XORWOW))
+        call assert_equals(ROCRAND_STATUS_SUCCESS, rocrand_generate_batch(gen, requests, count))
+        call assert_equals(hipSuccess, hipMemcpy(c_loc(h_x), d_x, output_size * sizeof(h_x(1)), &
+        hipMemcpyDeviceToHost))
+        call assert_equals(hipSuccess, hipMemcpy(c_loc(h_y), d_y, output_size * sizeof(h_y(1)), &
+        hipMemcpyDeviceToHost))
+        call assert_equals((sum(h_x) / output_size), mean, delta)
+        call assert_equals((sum(h_y) / output_size), normal_mean, normal_delta)
+        call assert_equals(hipSuccess, hipFree(d_x))
+        call assert_equals(hipSuccess, hipFree(d_y))
+        call assert_equals(ROCRAND_STATUS_SUCCESS, rocrand_destroy_generator(gen))
+    end subroutine test_rocrand_generate_batch
+
+    !> Test rocrand_generate_uniform_2d with a Fortran-ordered array.
+    subroutine test_rocrand_generate_uniform_2d()
+        integer(kind =8) :: gen
+        real, target, dimension(40, 16) :: h_x
+        type(c_ptr) :: d_x
+        ! Columns of 32 values in columns of 40 elements
+        integer(c_size_t), parameter :: rows = 32, columns = 16, leading_dimension = 40
+        real, parameter :: mean = 0.5, delta = 0.1
+        h_x = -1.0
+        call assert_equals(hipSuccess, hipMalloc(d_x, size(h_x) * sizeof(h_x(1, 1))))
+        call assert_equals(hipSuccess, hipMemcpy(d_x, c_loc(h_x), size(h_x) * sizeof(h_x(1, 1)), &
+        hipMemcpyHostToDevice))
+        call assert_equals(ROCRAND_STATUS_SUCCESS, rocrand_create_generator(gen, &
+        ROCRAND_RNG_PSEUDO_XORWOW))
+        call assert_equals(ROCRAND_STATUS_SUCCESS, rocrand_generate_uniform_2d(gen, d_x, &
+        leading_dimension * sizeof(h_x(1, 1)), rows, columns))
+        call assert_equals(hipSuccess, hipMemcpy(c_loc(h_x), d_x, size(h_x) * sizeof(h_x(1, 1)), &
+        hipMemcpyDeviceToHost))
+        call assert_equals((sum(h_x(1:rows, :)) / (rows * columns)), mean, delta)
+        call assert_equals(.true., all(h_x(rows + 1:, :) == -1.0))
+        call assert_equals(hipSuccess, hipFree(d_x))
+        call assert_equals(ROCRAND_STATUS_SUCCESS, rocrand_destroy_generator(gen))
+    end subroutine test_rocrand_generate_uniform_2d
+
+    !> Test rocrand_generate_uniform_to_host with pinned memory.
+    subroutine test_rocrand_generate_uniform_to_host()
+        integer(kind =8) :: gen
+        real, pointer, dimension(:) :: h_x
+        type(c_ptr) :: p_x
+        integer(c_size_t), parameter :: output_size = 128
+        real, parameter :: mean = 0.5, delta = 0.1
+        call assert_equals(hipSuccess, hipHostMalloc(p_x, output_size * 4, 0))
+        call c_f_pointer(p_x, h_x, (/ output_size /))
+        call assert_equals(ROCRAND_STATUS_SUCCESS, rocrand_create_generator(gen, &
+        ROCRAND_RNG_PSEUDO_DEFAULT))
+        call assert_equals(ROCRAND_STATUS_SUCCESS, rocrand_generate_uniform_to_host(gen, p_x, &
+        output_size))
+        call assert_equals((sum(h_x) / output_size), mean, delta)
+        call assert_equals(ROCRAND_STATUS_SUCCESS, rocrand_destroy_generator(gen))
+        call assert_equals(hipSuccess, hipHostFree(p_x))
+    end subroutine test_rocrand_generate_uniform_to_host
+
     !> Call each test.
     subroutine rocrand_basket()
     character(len=*) :: suite_name
@@ -241,6 +343,18 @@ contains
     call run_fruit_test_case(test_rocrand_generate_poisson,'test_rocrand_generate_poisson',&
         setup,teardown,suite_name)
 
+    call run_fruit_test_case(test_rocrand_stream,'test_rocrand_stream',&
+        setup,teardown,suite_name)
+
+    call run_fruit_test_case(test_rocrand_generate_batch,'test_rocrand_generate_batch',&
+        setup,teardown,suite_name)
+
+    call run_fruit_test_case(test_rocrand_generate_uniform_2d,'test_rocrand_generate_uniform_2d',&
+        setup,teardown,suite_name)
+
+    call run_fruit_test_case(test_rocrand_generate_uniform_to_host, &
+        'test_rocrand_generate_uniform_to_host',setup,teardown,suite_name)
+
     end subroutine rocrand_basket
 
 end module test_rocrand
@@ -0,0 +1,908 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// GPU-resident statistical quality tests: values are generated in chunks by
+// the host API (or by the device API in kernels) and consumed by test kernels
+// that accumulate histograms and sums in device memory, so samples are never
+// copied to the host or stored beyond one chunk. Only p-values are computed
+// on the host. Tests:
+//  uniform-chi2 - chi-square test of a histogram of uniform floats
+//  normal-ks    - Kolmogorov-Smirnov and chi-square tests of a histogram of
+//                 normal floats (the normal method and precision can be set)
+//  gap          - gap test of uniform floats (lengths of runs between values
+//                 in [0, 1/16))
+//  birthday     - birthday spacings of 4096 32-bit values (Marsaglia)
+//  correlation  - correlation of generators with adjacent seeds and of
+//                 neighbouring subsequences of the device API
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <numeric>
+#include <algorithm>
+#include <functional>
+
+#include "cmdparser.hpp"
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+#include <rocrand_kernel.h>
+
+#define HIP_CHECK(condition)         \
+  {                                  \
+    hipError_t error = condition;    \
+    if(error != hipSuccess){         \
+        std::cout << "HIP error: " << error << " line: " << __LINE__ << std::endl; \
+        exit(error); \
+    } \
+  }
+
+#define ROCRAND_CHECK(condition)                 \
+  {                                              \
+    rocrand_status _status = condition;           \
+    if(_status != ROCRAND_STATUS_SUCCESS) {       \
+        std::cout << "ROCRAND error: " << _status << " line: " << __LINE__ << std::endl; \
+        exit(_status); \
+    } \
+  }
+
+typedef rocrand_rng_type rng_type_t;
+
+const unsigned int block_size = 256;
+const unsigned int max_blocks = 1024;
+
+const unsigned int uniform_bins = 4096;
+// Normal values in [-normal_range, normal_range) with two tail bins
+const unsigned int normal_bins = 4096;
+const float normal_range = 8.0f;
+// Gap test: hits are values in [0, gap_p), lengths >= gap_max share a bin
+const float gap_p = 1.0f / 16.0f;
+const unsigned int gap_max = 64;
+const unsigned int gap_segment = 256;
+// Birthday spacings: lambda = birthdays^3 / (4 * 2^32) = 4
+const unsigned int birthdays = 4096;
+const unsigned int birthday_max_duplicates = 16;
+
+struct quality_options
+{
+    unsigned long long seed;
+    size_t samples;
+    size_t chunk;
+    rocrand_normal_method normal_method;
+    rocrand_precision precision;
+};
+
+struct test_result
+{
+    std::string test;
+    double statistic;
+    double p_value;
+};
+
+unsigned int blocks_for(const size_t size)
+{
+    return static_cast<unsigned int>(
+        std::min<size_t>(max_blocks, std::max<size_t>(1, (size + block_size - 1) / block_size))
+    );
+}
+
+// Host math
+
+// Regularized upper incomplete gamma function Q(a, x)
+double gamma_q(const double a, const double x)
+{
+    if(x <= 0.0)
+        return 1.0;
+    const double log_prefix = a * std::log(x) - x - std::lgamma(a);
+    if(x < a + 1.0)
+    {
+        // Series of P(a, x)
+        double term = 1.0 / a;
+        double sum = term;
+        for(int n = 1; n < 100000; n++)
+        {
+            term *= x / (a + n);
+            sum += term;
+            if(std::fabs(term) < std::fabs(sum) * 1e-15)
+                break;
+        }
+        return 1.0 - sum * std::exp(log_prefix);
+    }
+    // Continued fraction of Q(a, x) (modified Lentz's method)
+    const double tiny = 1e-300;
+    double b = x + 1.0 - a;
+    double c = 1.0 / tiny;
+    double d = 1.0 / b;
+    double h = d;
+    for(int i = 1; i < 100000; i++)
+    {
+        const double an = -i * (i - a);
+        b += 2.0;
+        d = an * d + b;
+        d = std::fabs(d) < tiny ? tiny : d;
+        c = b + an / c;
+        c = std::fabs(c) < tiny ? tiny : c;
+        d = 1.0 / d;
+        const double delta = d * c;
+        h *= delta;
+        if(std::fabs(delta - 1.0) < 1e-15)
+            break;
+    }
+    return std::exp(log_prefix) * h;
+}
+
+// Chi-square test of observed counts, consecutive bins are merged until
+// their expected count is at least 10
+test_result chi_square_test(const std::string& name,
+                            const std::vector<unsigned long long>& observed,
+                            const std::vector<double>& probabilities)
+{
+    const double total = std::accumulate(observed.begin(), observed.end(), 0.0);
+    double chi2 = 0.0;
+    size_t bins = 0;
+    double o = 0.0;
+    double e = 0.0;
+    for(size_t i = 0; i < observed.size(); i++)
+    {
+        o += observed[i];
+        e += probabilities[i] * total;
+        if(e >= 10.0 || i + 1 == observed.size())
+        {
+            if(e > 0.0)
+            {
+                chi2 += (o - e) * (o - e) / e;
+                bins++;
+            }
+            o = 0.0;
+            e = 0.0;
+        }
+    }
+    const double df = std::max<double>(1.0, bins - 1.0);
+    return { name, chi2, gamma_q(df / 2.0, chi2 / 2.0) };
+}
+
+double normal_cdf(const double x)
+{
+    return 0.5 * std::erfc(-x / std::sqrt(2.0));
+}
+
+// Two-sided p-value of a standard normal statistic
+double normal_p_value(const double z)
+{
+    return std::erfc(std::fabs(z) / std::sqrt(2.0));
+}
+
+// Asymptotic Kolmogorov distribution Q(lambda)
+double kolmogorov_p_value(const double lambda)
+{
+    if(lambda < 0.2)
+        return 1.0;
+    double sum = 0.0;
+    for(int k = 1; k < 100; k++)
+    {
+        sum += (k % 2 == 1 ? 2.0 : -2.0) * std::exp(-2.0 * k * k * lambda * lambda);
+    }
+    return std::min(1.0, std::max(0.0, sum));
+}
+
+// Device helpers
+
+__device__
+double block_reduce_sum(double value)
+{
+    __shared__ double sums[block_size];
+    sums[hipThreadIdx_x] = value;
+    __syncthreads();
+    for(unsigned int offset = block_size / 2; offset > 0; offset /= 2)
+    {
+        if(hipThreadIdx_x < offset)
+            sums[hipThreadIdx_x] += sums[hipThreadIdx_x + offset];
+        __syncthreads();
+    }
+    const double sum = sums[0];
+    __syncthreads();
+    return sum;
+}
+
+// Histogram of Bins bins accumulated in shared memory by the block
+template<unsigned int Bins>
+struct block_histogram
+{
+    unsigned int * counts;
+
+    __device__
+    void clear()
+    {
+        for(unsigned int i = hipThreadIdx_x; i < Bins; i += hipBlockDim_x)
+            counts[i] = 0;
+        __syncthreads();
+    }
+
+    __device__
+    void add(const unsigned int bin)
+    {
+        atomicAdd(&counts[bin], 1U);
+    }
+
+    __device__
+    void flush(unsigned long long * histogram)
+    {
+        __syncthreads();
+        for(unsigned int i = hipThreadIdx_x; i < Bins; i += hipBlockDim_x)
+        {
+            if(counts[i] > 0)
+                atomicAdd(&histogram[i], static_cast<unsigned long long>(counts[i]));
+        }
+    }
+};
+
+__global__
+void uniform_histogram_kernel(const float * values, const size_t n,
+                              unsigned long long * histogram)
+{
+    __shared__ unsigned int counts[uniform_bins];
+    block_histogram<uniform_bins> h = { counts };
+    h.clear();
+    const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+    for(size_t i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x; i < n; i += stride)
+    {
+        const unsigned int bin = static_cast<unsigned int>(values[i] * uniform_bins);
+        h.add(bin < uniform_bins ? bin : uniform_bins - 1);
+    }
+    h.flush(histogram);
+}
+
+// Bin 0 is below -normal_range, bin normal_bins + 1 is at least normal_range
+__global__
+void normal_histogram_kernel(const float * values, const size_t n,
+                             unsigned long long * histogram)
+{
+    __shared__ unsigned int counts[normal_bins + 2];
+    block_histogram<normal_bins + 2> h = { counts };
+    h.clear();
+    const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+    const float scale = normal_bins / (2.0f * normal_range);
+    for(size_t i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x; i < n; i += stride)
+    {
+        const float x = (values[i] + normal_range) * scale;
+        unsigned int bin;
+        if(!(x >= 0.0f))
+            bin = 0;
+        else if(x >= normal_bins)
+            bin = normal_bins + 1;
+        else
+            bin = static_cast<unsigned int>(x) + 1;
+        h.add(bin);
+    }
+    h.flush(histogram);
+}
+
+// Every gap starting in the thread's segment is followed (possibly past the
+// segment) to the next hit, gaps not finished at the end of the chunk are dropped
+__global__
+void gap_kernel(const float * values, const size_t n, unsigned long long * histogram)
+{
+    __shared__ unsigned int counts[gap_max + 1];
+    block_histogram<gap_max + 1> h = { counts };
+    h.clear();
+    const size_t segments = (n + gap_segment - 1) / gap_segment;
+    const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+    for(size_t s = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x; s < segments; s += stride)
+    {
+        const size_t end = (s + 1) * gap_segment < n ? (s + 1) * gap_segment : n;
+        for(size_t i = s * gap_segment; i < end; i++)
+        {
+            if(!(values[i] < gap_p))
+                continue;
+            unsigned int length = 0;
+            size_t j = i + 1;
+            while(j < n && length < gap_max && !(values[j] < gap_p))
+            {
+                length++;
+                j++;
+            }
+            if(length == gap_max || j < n)
+                h.add(length);
+            // Values before j are not hits
+            i = j - 1;
+        }
+    }
+    h.flush(histogram);
+}
+
+// Sorts birthdays keys in shared memory (bitonic sort)
+__device__
+void block_bitonic_sort(unsigned int * keys)
+{
+    for(unsigned int k = 2; k <= birthdays; k <<= 1)
+    {
+        for(unsigned int j = k >> 1; j > 0; j >>= 1)
+        {
+            for(unsigned int i = hipThreadIdx_x; i < birthdays; i += hipBlockDim_x)
+            {
+                const unsigned int l = i ^ j;
+                if(l > i)
+                {
+                    const unsigned int a = keys[i];
+                    const unsigned int b = keys[l];
+                    if((a > b) == ((i & k) == 0))
+                    {
+                        keys[i] = b;
+                        keys[l] = a;
+                    }
+                }
+            }
+            __syncthreads();
+        }
+    }
+}
+
+// Every test sorts birthdays values, computes their spacings and counts
+// spacings equal to a previous one (duplicates are Poisson-distributed)
+__global__
+void birthday_kernel(const unsigned int * values, const size_t tests,
+                     unsigned long long * histogram)
+{
+    __shared__ unsigned int keys[birthdays];
+    __shared__ unsigned int duplicates;
+    const unsigned int items = birthdays / block_size;
+    for(size_t t = hipBlockIdx_x; t < tests; t += hipGridDim_x)
+    {
+        for(unsigned int i = hipThreadIdx_x; i < birthdays; i += hipBlockDim_x)
+            keys[i] = values[t * birthdays + i];
+        if(hipThreadIdx_x == 0)
+            duplicates = 0;
+        __syncthreads();
+        block_bitonic_sort(keys);
+
+        unsigned int spacings[items];
+        for(unsigned int k = 0; k < items; k++)
+        {
+            const unsigned int i = hipThreadIdx_x + k * block_size;
+            spacings[k] = i == 0 ? keys[0] : keys[i] - keys[i - 1];
+        }
+        __syncthreads();
+        for(unsigned int k = 0; k < items; k++)
+            keys[hipThreadIdx_x + k * block_size] = spacings[k];
+        __syncthreads();
+        block_bitonic_sort(keys);
+
+        unsigned int count = 0;
+        for(unsigned int i = hipThreadIdx_x + 1; i < birthdays; i += hipBlockDim_x)
+            count += keys[i] == keys[i - 1] ? 1 : 0;
+        atomicAdd(&duplicates, count);
+        __syncthreads();
+        if(hipThreadIdx_x == 0)
+            atomicAdd(&histogram[duplicates < birthday_max_duplicates ? duplicates : birthday_max_duplicates], 1ULL);
+        __syncthreads();
+    }
+}
+
+// Sum of (x[i] - 1/2) * (y[i] - 1/2)
+__global__
+void pair_product_kernel(const float * x, const float * y, const size_t n, double * sum)
+{
+    const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+    double s = 0.0;
+    for(size_t i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x; i < n; i += stride)
+    {
+        s += (static_cast<double>(x[i]) - 0.5) * (static_cast<double>(y[i]) - 0.5);
+    }
+    s = block_reduce_sum(s);
+    if(hipThreadIdx_x == 0)
+        atomicAdd(sum, s);
+}
+
+// Sum of products of uniform values of subsequences 2 * id and 2 * id + 1
+// of the device API, no values are stored
+template<class State>
+__global__
+void subsequence_product_kernel(const unsigned long long seed,
+                                const size_t values_per_thread, double * sum)
+{
+    const unsigned int id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    State a;
+    State b;
+    rocrand_init(seed, 2ULL * id, 0, &a);
+    rocrand_init(seed, 2ULL * id + 1, 0, &b);
+    double s = 0.0;
+    for(size_t i = 0; i < values_per_thread; i++)
+    {
+        s += (static_cast<double>(rocrand_uniform(&a)) - 0.5)
+            * (static_cast<double>(rocrand_uniform(&b)) - 0.5);
+    }
+    s = block_reduce_sum(s);
+    if(hipThreadIdx_x == 0)
+        atomicAdd(sum, s);
+}
+
+// Host drivers
+
+rocrand_generator create_generator(const rng_type_t rng_type,
+                                   const quality_options& options,
+                                   const unsigned long long seed)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_seed(generator, seed));
+    const rocrand_status status = rocrand_set_normal_method(generator, options.normal_method);
+    if(status != ROCRAND_STATUS_TYPE_ERROR)
+    {
+        ROCRAND_CHECK(status);
+    }
+    ROCRAND_CHECK(rocrand_set_precision(generator, options.precision));
+    return generator;
+}
+
+// Generates options.samples values in chunks, consume(n) is called
+// after every chunk of n values is generated
+void for_each_chunk(const quality_options& options,
+                    std::function<void(size_t)> generate,
+                    std::function<void(size_t)> consume)
+{
+    for(size_t done = 0; done < options.samples; done += options.chunk)
+    {
+        const size_t n = std::min(options.chunk, options.samples - done);
+        generate(n);
+        consume(n);
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+}
+
+std::vector<unsigned long long> download(const unsigned long long * histogram, const size_t bins)
+{
+    std::vector<unsigned long long> h(bins);
+    HIP_CHECK(hipMemcpy(h.data(), histogram, bins * sizeof(unsigned long long), hipMemcpyDeviceToHost));
+    return h;
+}
+
+std::vector<test_result> run_uniform_chi2(const rng_type_t rng_type, const quality_options& options)
+{
+    float * values;
+    unsigned long long * histogram;
+    HIP_CHECK(hipMalloc((void **)&values, options.chunk * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&histogram, uniform_bins * sizeof(unsigned long long)));
+    HIP_CHECK(hipMemset(histogram, 0, uniform_bins * sizeof(unsigned long long)));
+    rocrand_generator generator = create_generator(rng_type, options, options.seed);
+
+    for_each_chunk(options,
+        [&](size_t n) { ROCRAND_CHECK(rocrand_generate_uniform(generator, values, n)); },
+        [&](size_t n)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(uniform_histogram_kernel),
+                dim3(blocks_for(n)), dim3(block_size), 0, 0,
+                values, n, histogram
+            );
+            HIP_CHECK(hipPeekAtLastError());
+        }
+    );
+
+    const std::vector<unsigned long long> observed = download(histogram, uniform_bins);
+    const std::vector<double> probabilities(uniform_bins, 1.0 / uniform_bins);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(values));
+    HIP_CHECK(hipFree(histogram));
+    return { chi_square_test("uniform-chi2", observed, probabilities) };
+}
+
+std::vector<test_result> run_normal_ks(const rng_type_t rng_type, const quality_options& options)
+{
+    const size_t bins = normal_bins + 2;
+    float * values;
+    unsigned long long * histogram;
+    HIP_CHECK(hipMalloc((void **)&values, options.chunk * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&histogram, bins * sizeof(unsigned long long)));
+    HIP_CHECK(hipMemset(histogram, 0, bins * sizeof(unsigned long long)));
+    rocrand_generator generator = create_generator(rng_type, options, options.seed);
+
+    // Box-Muller generates pairs
+    quality_options even_options = options;
+    even_options.chunk -= options.chunk % 2;
+    even_options.samples -= options.samples % 2;
+    for_each_chunk(even_options,
+        [&](size_t n) { ROCRAND_CHECK(rocrand_generate_normal(generator, values, n, 0.0f, 1.0f)); },
+        [&](size_t n)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(normal_histogram_kernel),
+                dim3(blocks_for(n)), dim3(block_size), 0, 0,
+                values, n, histogram
+            );
+            HIP_CHECK(hipPeekAtLastError());
+        }
+    );
+
+    const std::vector<unsigned long long> observed = download(histogram, bins);
+    const double total = std::accumulate(observed.begin(), observed.end(), 0.0);
+    const double width = 2.0 * normal_range / normal_bins;
+    std::vector<double> probabilities(bins);
+    // The Kolmogorov-Smirnov statistic is evaluated at bin edges only,
+    // so its p-value is conservative
+    double d = 0.0;
+    double cumulative = 0.0;
+    double previous_cdf = 0.0;
+    for(size_t i = 0; i + 1 < bins; i++)
+    {
+        const double edge = -normal_range + i * width;
+        const double cdf = normal_cdf(edge);
+        cumulative += observed[i];
+        d = std::max(d, std::fabs(cumulative / total - cdf));
+        probabilities[i] = cdf - previous_cdf;
+        previous_cdf = cdf;
+    }
+    probabilities[bins - 1] = 1.0 - previous_cdf;
+    const double lambda = std::sqrt(total) * d;
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(values));
+    HIP_CHECK(hipFree(histogram));
+    return {
+        { "normal-ks", d, kolmogorov_p_value(lambda) },
+        chi_square_test("normal-chi2", observed, probabilities)
+    };
+}
+
+std::vector<test_result> run_gap(const rng_type_t rng_type, const quality_options& options)
+{
+    const size_t bins = gap_max + 1;
+    float * values;
+    unsigned long long * histogram;
+    HIP_CHECK(hipMalloc((void **)&values, options.chunk * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&histogram, bins * sizeof(unsigned long long)));
+    HIP_CHECK(hipMemset(histogram, 0, bins * sizeof(unsigned long long)));
+    rocrand_generator generator = create_generator(rng_type, options, options.seed);
+
+    for_each_chunk(options,
+        [&](size_t n) { ROCRAND_CHECK(rocrand_generate_uniform(generator, values, n)); },
+        [&](size_t n)
+        {
+            const size_t segments = (n + gap_segment - 1) / gap_segment;
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(gap_kernel),
+                dim3(blocks_for(segments)), dim3(block_size), 0, 0,
+                values, n, histogram
+            );
+            HIP_CHECK(hipPeekAtLastError());
+        }
+    );
+
+    const std::vector<unsigned long long> observed = download(histogram, bins);
+    std::vector<double> probabilities(bins);
+    const double p = gap_p;
+    for(unsigned int r = 0; r < gap_max; r++)
+        probabilities[r] = p * std::pow(1.0 - p, r);
+    probabilities[gap_max] = std::pow(1.0 - p, gap_max);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(values));
+    HIP_CHECK(hipFree(histogram));
+    return { chi_square_test("gap", observed, probabilities) };
+}
+
+std::vector<test_result> run_birthday(const rng_type_t rng_type, const quality_options& options)
+{
+    const size_t bins = birthday_max_duplicates + 1;
+    // Chunks of whole tests
+    quality_options test_options = options;
+    test_options.chunk = std::max<size_t>(1, options.chunk / birthdays) * birthdays;
+    test_options.samples = std::max<size_t>(1, options.samples / birthdays) * birthdays;
+    unsigned int * values;
+    unsigned long long * histogram;
+    HIP_CHECK(hipMalloc((void **)&values, test_options.chunk * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&histogram, bins * sizeof(unsigned long long)));
+    HIP_CHECK(hipMemset(histogram, 0, bins * sizeof(unsigned long long)));
+    rocrand_generator generator = create_generator(rng_type, test_options, options.seed);
+
+    for_each_chunk(test_options,
+        [&](size_t n) { ROCRAND_CHECK(rocrand_generate(generator, values, n)); },
+        [&](size_t n)
+        {
+            const size_t tests = n / birthdays;
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(birthday_kernel),
+                dim3(static_cast<unsigned int>(std::min<size_t>(tests, max_blocks))), dim3(block_size), 0, 0,
+                values, tests, histogram
+            );
+            HIP_CHECK(hipPeekAtLastError());
+        }
+    );
+
+    const std::vector<unsigned long long> observed = download(histogram, bins);
+    const double lambda = std::pow(static_cast<double>(birthdays), 3.0) / (4.0 * 4294967296.0);
+    std::vector<double> probabilities(bins);
+    double cumulative = 0.0;
+    for(unsigned int k = 0; k < birthday_max_duplicates; k++)
+    {
+        probabilities[k] = std::exp(-lambda + k * std::log(lambda) - std::lgamma(k + 1.0));
+        cumulative += probabilities[k];
+    }
+    probabilities[birthday_max_duplicates] = 1.0 - cumulative;
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(values));
+    HIP_CHECK(hipFree(histogram));
+    return { chi_square_test("birthday", observed, probabilities) };
+}
+
+template<class State>
+double subsequence_product_sum(const quality_options& options, size_t& n)
+{
+    const unsigned int blocks = max_blocks;
+    const size_t threads = blocks * block_size;
+    const size_t values_per_thread = std::max<size_t>(1, options.samples / threads);
+    n = values_per_thread * threads;
+    double * sum;
+    HIP_CHECK(hipMalloc((void **)&sum, sizeof(double)));
+    HIP_CHECK(hipMemset(sum, 0, sizeof(double)));
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(subsequence_product_kernel<State>),
+        dim3(blocks), dim3(block_size), 0, 0,
+        options.seed, values_per_thread, sum
+    );
+    HIP_CHECK(hipPeekAtLastError());
+    double result;
+    HIP_CHECK(hipMemcpy(&result, sum, sizeof(double), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(sum));
+    return result;
+}
+
+std::vector<test_result> run_correlation(const rng_type_t rng_type, const quality_options& options)
+{
+    std::vector<test_result> results;
+
+    // Generators with adjacent seeds
+    float * x;
+    float * y;
+    double * sum;
+    HIP_CHECK(hipMalloc((void **)&x, options.chunk * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&y, options.chunk * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&sum, sizeof(double)));
+    HIP_CHECK(hipMemset(sum, 0, sizeof(double)));
+    rocrand_generator generator_x = create_generator(rng_type, options, options.seed);
+    rocrand_generator generator_y = create_generator(rng_type, options, options.seed + 1);
+
+    for_each_chunk(options,
+        [&](size_t n)
+        {
+            ROCRAND_CHECK(rocrand_generate_uniform(generator_x, x, n));
+            ROCRAND_CHECK(rocrand_generate_uniform(generator_y, y, n));
+        },
+        [&](size_t n)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(pair_product_kernel),
+                dim3(blocks_for(n)), dim3(block_size), 0, 0,
+                x, y, n, sum
+            );
+            HIP_CHECK(hipPeekAtLastError());
+        }
+    );
+    double seeds_sum;
+    HIP_CHECK(hipMemcpy(&seeds_sum, sum, sizeof(double), hipMemcpyDeviceToHost));
+    // Products of independent centered uniform values have variance 1/144
+    const double z = 12.0 * seeds_sum / std::sqrt(static_cast<double>(options.samples));
+    results.push_back({ "correlation-seeds", z, normal_p_value(z) });
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator_x));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator_y));
+    HIP_CHECK(hipFree(x));
+    HIP_CHECK(hipFree(y));
+    HIP_CHECK(hipFree(sum));
+
+    // Neighbouring subsequences of the device API
+    size_t n = 0;
+    double subsequences_sum = 0.0;
+    bool has_device_api = true;
+    if(rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+        subsequences_sum = subsequence_product_sum<rocrand_state_xorwow>(options, n);
+    else if(rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+        subsequences_sum = subsequence_product_sum<rocrand_state_mrg32k3a>(options, n);
+    else if(rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+        subsequences_sum = subsequence_product_sum<rocrand_state_philox4x32_10>(options, n);
+    else if(rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+        subsequences_sum = subsequence_product_sum<rocrand_state_philox4x32_7>(options, n);
+    else if(rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10)
+        subsequences_sum = subsequence_product_sum<rocrand_state_philox4x64_10>(options, n);
+    else if(rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20)
+        subsequences_sum = subsequence_product_sum<rocrand_state_threefry2x64_20>(options, n);
+    else if(rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20)
+        subsequences_sum = subsequence_product_sum<rocrand_state_threefry4x64_20>(options, n);
+    else if(rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP)
+        subsequences_sum = subsequence_product_sum<rocrand_state_xoshiro128pp>(options, n);
+    else if(rng_type == ROCRAND_RNG_PSEUDO_PCG32)
+        subsequences_sum = subsequence_product_sum<rocrand_state_pcg32>(options, n);
+    else
+        has_device_api = false;
+    if(has_device_api)
+    {
+        const double zs = 12.0 * subsequences_sum / std::sqrt(static_cast<double>(n));
+        results.push_back({ "correlation-subsequences", zs, normal_p_value(zs) });
+    }
+    return results;
+}
+
+const std::vector<std::string> all_tests = {
+    "uniform-chi2",
+    "normal-ks",
+    "gap",
+    "birthday",
+    "correlation",
+};
+
+const std::vector<std::string> all_engines = {
+    "xorwow",
+    "mrg32k3a",
+    "mtgp32",
+    "philox",
+    "philox4x32_7",
+    "philox4x64",
+    "threefry2x64",
+    "threefry4x64",
+    "xoshiro128pp",
+    "pcg32",
+};
+
+int main(int argc, char *argv[])
+{
+    cli::Parser parser(argc, argv);
+
+    const std::string test_desc =
+        "space-separated list of tests:" +
+        std::accumulate(all_tests.begin(), all_tests.end(), std::string(),
+            [](std::string a, std::string b) {
+                return a + "\n      " + b;
+            }
+        ) +
+        "\n      or all";
+    const std::string engine_desc =
+        "space-separated list of random number engines:" +
+        std::accumulate(all_engines.begin(), all_engines.end(), std::string(),
+            [](std::string a, std::string b) {
+                return a + "\n      " + b;
+            }
+        ) +
+        "\n      or all";
+
+    parser.set_optional<size_t>("samples", "samples", 30, "log2 of the number of values of every test");
+    parser.set_optional<size_t>("chunk", "chunk", 24, "log2 of the number of values generated by one call");
+    parser.set_optional<size_t>("seed", "seed", 12345, "seed of generators");
+    parser.set_optional<std::string>("normal-method", "normal-method", "box-muller", "normal method: box-muller or ziggurat");
+    parser.set_optional<std::string>("precision", "precision", "default", "precision of math functions: default or fast");
+    parser.set_optional<double>("alpha", "alpha", 1e-5, "tests with p-values below alpha fail");
+    parser.set_optional<std::vector<std::string>>("test", "test", {"all"}, test_desc.c_str());
+    parser.set_optional<std::vector<std::string>>("engine", "engine", {"philox"}, engine_desc.c_str());
+    parser.run_and_exit_if_error();
+
+    quality_options options;
+    options.seed = parser.get<size_t>("seed");
+    options.samples = size_t(1) << std::min<size_t>(48, parser.get<size_t>("samples"));
+    options.chunk = std::min(options.samples, size_t(1) << std::min<size_t>(30, parser.get<size_t>("chunk")));
+    const std::string normal_method = parser.get<std::string>("normal-method");
+    const std::string precision = parser.get<std::string>("precision");
+    if(normal_method != "box-muller" && normal_method != "ziggurat")
+    {
+        std::cout << "Wrong normal method" << std::endl;
+        exit(1);
+    }
+    if(precision != "default" && precision != "fast")
+    {
+        std::cout << "Wrong precision" << std::endl;
+        exit(1);
+    }
+    options.normal_method = normal_method == "ziggurat"
+        ? ROCRAND_NORMAL_METHOD_ZIGGURAT : ROCRAND_NORMAL_METHOD_BOX_MULLER;
+    options.precision = precision == "fast" ? ROCRAND_PRECISION_FAST : ROCRAND_PRECISION_DEFAULT;
+    const double alpha = parser.get<double>("alpha");
+
+    std::vector<std::string> tests;
+    {
+        auto ts = parser.get<std::vector<std::string>>("test");
+        for (auto t : all_tests)
+        {
+            if (std::find(ts.begin(), ts.end(), "all") != ts.end()
+                || std::find(ts.begin(), ts.end(), t) != ts.end())
+                tests.push_back(t);
+        }
+    }
+
+    std::vector<std::string> engines;
+    {
+        auto es = parser.get<std::vector<std::string>>("engine");
+        for (auto e : all_engines)
+        {
+            if (std::find(es.begin(), es.end(), "all") != es.end()
+                || std::find(es.begin(), es.end(), e) != es.end())
+                engines.push_back(e);
+        }
+    }
+
+    int version;
+    ROCRAND_CHECK(rocrand_get_version(&version));
+    int device_id;
+    HIP_CHECK(hipGetDevice(&device_id));
+    hipDeviceProp_t props;
+    HIP_CHECK(hipGetDeviceProperties(&props, device_id));
+    std::cout << "rocRAND: " << version << " ";
+    std::cout << "Device: " << props.name << " ";
+    std::cout << "Samples: " << options.samples << " ";
+    std::cout << "Normal method: " << normal_method << " ";
+    std::cout << "Precision: " << precision;
+    std::cout << std::endl << std::endl;
+
+    size_t failures = 0;
+    for (auto engine : engines)
+    {
+        rng_type_t rng_type = ROCRAND_RNG_PSEUDO_XORWOW;
+        if (engine == "xorwow")
+            rng_type = ROCRAND_RNG_PSEUDO_XORWOW;
+        else if (engine == "mrg32k3a")
+            rng_type = ROCRAND_RNG_PSEUDO_MRG32K3A;
+        else if (engine == "mtgp32")
+            rng_type = ROCRAND_RNG_PSEUDO_MTGP32;
+        else if (engine == "philox")
+            rng_type = ROCRAND_RNG_PSEUDO_PHILOX4_32_10;
+        else if (engine == "philox4x32_7")
+            rng_type = ROCRAND_RNG_PSEUDO_PHILOX4_32_7;
+        else if (engine == "philox4x64")
+            rng_type = ROCRAND_RNG_PSEUDO_PHILOX4_64_10;
+        else if (engine == "threefry2x64")
+            rng_type = ROCRAND_RNG_PSEUDO_THREEFRY2_64_20;
+        else if (engine == "threefry4x64")
+            rng_type = ROCRAND_RNG_PSEUDO_THREEFRY4_64_20;
+        else if (engine == "xoshiro128pp")
+            rng_type = ROCRAND_RNG_PSEUDO_XOSHIRO128PP;
+        else if (engine == "pcg32")
+            rng_type = ROCRAND_RNG_PSEUDO_PCG32;
+
+        std::cout << engine << ":" << std::endl;
+        for (auto test : tests)
+        {
+            std::vector<test_result> results;
+            if (test == "uniform-chi2")
+                results = run_uniform_chi2(rng_type, options);
+            else if (test == "normal-ks")
+                results = run_normal_ks(rng_type, options);
+            else if (test == "gap")
+                results = run_gap(rng_type, options);
+            else if (test == "birthday")
+                results = run_birthday(rng_type, options);
+            else if (test == "correlation")
+                results = run_correlation(rng_type, options);
+
+            for (const test_result& result : results)
+            {
+                const bool passed = result.p_value >= alpha;
+                failures += passed ? 0 : 1;
+                std::cout << "  " << std::left << std::setw(26) << result.test << std::right
+                          << "statistic: " << std::setw(14) << std::setprecision(6) << result.statistic
+                          << "  p-value: " << std::setw(12) << std::setprecision(4) << result.p_value
+                          << "  " << (passed ? "PASSED" : "FAILED") << std::endl;
+            }
+        }
+        std::cout << std::endl;
+    }
+
+    std::cout << failures << " test(s) failed" << std::endl;
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,181 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <rng/generator_type.hpp>
+#include <rng/generators.hpp>
+#include <rng/distribution/binomial.hpp>
+
+// Uniform values of the device API binomial distribution in host tests
+struct binomial_test_state
+{
+    std::mt19937 * gen;
+    size_t draws;
+};
+
+double rocrand_uniform_double(binomial_test_state * state)
+{
+    state->draws++;
+    const unsigned long long v =
+        (static_cast<unsigned long long>((*state->gen)()) << 32) | (*state->gen)();
+    return ROCRAND_2POW32_INV_DOUBLE / 2.0 + (v >> 11) * (ROCRAND_2POW32_INV_DOUBLE / 2097152.0);
+}
+
+double binomial_pmf(unsigned int n, double p, unsigned int k)
+{
+    return std::exp(
+        std::lgamma(n + 1.0) - std::lgamma(k + 1.0) - std::lgamma(n - k + 1.0)
+        + k * std::log(p) + (n - k) * std::log1p(-p)
+    );
+}
+
+typedef std::tuple<unsigned int, double> binomial_params;
+
+class binomial_distribution_tests : public ::testing::TestWithParam<binomial_params> { };
+
+// Inversion (small n * p) and BTRS (large n * p) follow the binomial distribution,
+// BTRS needs few uniform values per output
+TEST_P(binomial_distribution_tests, pmf_compare)
+{
+    const unsigned int n = std::get<0>(GetParam());
+    const double p = std::get<1>(GetParam());
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    binomial_test_state state = { &gen, 0 };
+    binomial_test_state * state_ptr = &state;
+
+    const size_t samples_count = 1000000;
+    std::vector<size_t> histogram(n + 1);
+    for (size_t si = 0; si < samples_count; si++)
+    {
+        const unsigned int v =
+            rocrand_device::detail::binomial_distribution(state_ptr, n, p);
+        ASSERT_LE(v, n);
+        histogram[v]++;
+    }
+
+    const double np = n * std::min(p, 1.0 - p);
+    if (np >= rocrand_device::detail::binomial_threshold_btrs)
+    {
+        EXPECT_LT(static_cast<double>(state.draws) / samples_count, 3.0);
+    }
+    for (unsigned int k = 0; k <= n; k++)
+    {
+        const double expected = samples_count * binomial_pmf(n, p, k);
+        EXPECT_NEAR(histogram[k], expected, std::max(20.0, 6.0 * std::sqrt(expected))) << k;
+    }
+}
+
+const binomial_params binomial_params_values[] = {
+    binomial_params(1, 0.3),
+    binomial_params(20, 0.05),
+    binomial_params(100, 0.09),
+    binomial_params(40, 0.5),
+    binomial_params(100, 0.1),
+    binomial_params(1000, 0.37),
+    binomial_params(1000, 0.98),
+    binomial_params(5000, 0.7)
+};
+
+INSTANTIATE_TEST_CASE_P(binomial_distribution_tests,
+                        binomial_distribution_tests,
+                        ::testing::ValuesIn(binomial_params_values));
+
+TEST(binomial_distribution_tests, edge_cases_test)
+{
+    std::mt19937 gen(1234);
+    binomial_test_state state = { &gen, 0 };
+    binomial_test_state * state_ptr = &state;
+
+    EXPECT_EQ(rocrand_device::detail::binomial_distribution(state_ptr, 0, 0.5), 0U);
+    EXPECT_EQ(rocrand_device::detail::binomial_distribution(state_ptr, 100, 0.0), 0U);
+    EXPECT_EQ(rocrand_device::detail::binomial_distribution(state_ptr, 100, 1.0), 100U);
+    EXPECT_EQ(state.draws, 0U);
+
+    // Large n, both methods
+    const unsigned int n = 4000000000U;
+    EXPECT_LE(rocrand_device::detail::binomial_distribution(state_ptr, n, 1e-9), n);
+    EXPECT_NEAR(rocrand_device::detail::binomial_distribution(state_ptr, n, 0.5), n / 2.0, 1e6);
+}
+
+// Counts of a multinomial vector sum to the number of trials, the mean of
+// every category is n * weight / sum of weights
+TEST(binomial_distribution_tests, multinomial_test)
+{
+    std::mt19937 gen(1234);
+
+    const unsigned int n = 1000;
+    const double weights[] = { 1.0, 0.0, 3.0, 0.5, 5.5 };
+    const unsigned int categories = sizeof(weights) / sizeof(weights[0]);
+    const size_t size = 20000;
+    std::vector<unsigned int> output(size * categories);
+    multinomial_distribution distribution(n, weights, categories, output.data(), size);
+    for (size_t i = 0; i < size; i++)
+    {
+        const unsigned int last = distribution(gen, i);
+        EXPECT_EQ(output[(categories - 1) * size + i], last);
+        unsigned int sum = 0;
+        for (unsigned int c = 0; c < categories; c++)
+        {
+            sum += output[c * size + i];
+        }
+        ASSERT_EQ(sum, n);
+    }
+
+    for (unsigned int c = 0; c < categories; c++)
+    {
+        double mean = 0.0;
+        for (size_t i = 0; i < size; i++)
+        {
+            mean += output[c * size + i];
+        }
+        mean /= size;
+        const double p = weights[c] / 10.0;
+        EXPECT_NEAR(mean, n * p, std::max(0.01, 6.0 * std::sqrt(n * p * (1.0 - p) / size))) << c;
+    }
+}
+
+// Parameters of the array distribution are read for every index
+TEST(binomial_distribution_tests, array_test)
+{
+    std::mt19937 gen(1234);
+
+    const unsigned int ns[] = { 0, 10, 1000, 1000 };
+    const double ps[] = { 0.5, 1.0, 0.0, 0.25 };
+    binomial_array_distribution distribution(ns, ps);
+    EXPECT_EQ(distribution(gen, 0), 0U);
+    EXPECT_EQ(distribution(gen, 1), 10U);
+    EXPECT_EQ(distribution(gen, 2), 0U);
+    double mean = 0.0;
+    const size_t size = 10000;
+    for (size_t i = 0; i < size; i++)
+    {
+        mean += distribution(gen, 3);
+    }
+    EXPECT_NEAR(mean / size, 250.0, 1.0);
+}
@@ -26,8 +26,14 @@
 
 const rocrand_rng_type rng_types[] = {
     ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
+    ROCRAND_RNG_PSEUDO_THREEFRY2_64_20,
+    ROCRAND_RNG_PSEUDO_THREEFRY4_64_20,
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_7,
     ROCRAND_RNG_PSEUDO_MRG32K3A,
     ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_XOSHIRO128PP,
+    ROCRAND_RNG_PSEUDO_PCG32,
     ROCRAND_RNG_PSEUDO_MTGP32,
     ROCRAND_RNG_QUASI_SOBOL32
 };
@@ -92,6 +92,21 @@ TEST(hiprand, hiprand_generate_test_sobol32)
     hiprand_generate_test_func<HIPRAND_RNG_QUASI_SOBOL32>();
 }
 
+TEST(hiprand, hiprand_generate_test_scrambled_sobol32)
+{
+    hiprand_generate_test_func<HIPRAND_RNG_QUASI_SCRAMBLED_SOBOL32>();
+}
+
+TEST(hiprand, hiprand_generate_test_sobol64)
+{
+    hiprand_generate_test_func<HIPRAND_RNG_QUASI_SOBOL64>();
+}
+
+TEST(hiprand, hiprand_generate_test_scrambled_sobol64)
+{
+    hiprand_generate_test_func<HIPRAND_RNG_QUASI_SCRAMBLED_SOBOL64>();
+}
+
 template<hiprandRngType_t rng_type>
 void hiprand_generate_uniform_test_func()
 {
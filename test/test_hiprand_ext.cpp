@@ -0,0 +1,204 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <cmath>
+
+#include <hip/hip_runtime.h>
+#include <hiprand.h>
+#include <hiprand_ext.h>
+
+#define HIP_CHECK(x) ASSERT_EQ(x, hipSuccess)
+#define HIPRAND_CHECK(state) ASSERT_EQ(state, HIPRAND_STATUS_SUCCESS)
+
+template<class T>
+std::vector<T> copy_to_host(const T * data, const size_t size)
+{
+    std::vector<T> host(size);
+    hipMemcpy(host.data(), data, size * sizeof(T), hipMemcpyDeviceToHost);
+    hipDeviceSynchronize();
+    return host;
+}
+
+// Batch must produce the same values as the corresponding separate calls
+template<hiprandRngType_t rng_type>
+void hiprand_generate_batch_test_func()
+{
+    const size_t sizes[] = { 1000, 4096, 130 };
+
+    float * uniform;
+    double * normal;
+    unsigned int * poisson;
+    HIP_CHECK(hipMalloc((void **)&uniform, 2 * sizes[0] * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&normal, 2 * sizes[1] * sizeof(double)));
+    HIP_CHECK(hipMalloc((void **)&poisson, 2 * sizes[2] * sizeof(unsigned int)));
+
+    hiprandBatchRequest_t requests[3] = {};
+    requests[0].distribution = HIPRAND_BATCH_UNIFORM;
+    requests[0].output_data = uniform;
+    requests[0].n = sizes[0];
+    requests[1].distribution = HIPRAND_BATCH_NORMAL_DOUBLE;
+    requests[1].output_data = normal;
+    requests[1].n = sizes[1];
+    requests[1].parameters[0] = 1.0;
+    requests[1].parameters[1] = 2.0;
+    requests[2].distribution = HIPRAND_BATCH_POISSON;
+    requests[2].output_data = poisson;
+    requests[2].n = sizes[2];
+    requests[2].parameters[0] = 50.0;
+
+    hiprandGenerator_t generator;
+    HIPRAND_CHECK(hiprandCreateGenerator(&generator, rng_type));
+    HIPRAND_CHECK(hiprandSetPseudoRandomGeneratorSeed(generator, 123456ULL));
+    HIPRAND_CHECK(hiprandGenerateBatch(generator, requests, 3));
+    HIPRAND_CHECK(hiprandDestroyGenerator(generator));
+
+    HIPRAND_CHECK(hiprandCreateGenerator(&generator, rng_type));
+    HIPRAND_CHECK(hiprandSetPseudoRandomGeneratorSeed(generator, 123456ULL));
+    HIPRAND_CHECK(hiprandGenerateUniform(generator, uniform + sizes[0], sizes[0]));
+    HIPRAND_CHECK(hiprandGenerateNormalDouble(generator, normal + sizes[1], sizes[1], 1.0, 2.0));
+    HIPRAND_CHECK(hiprandGeneratePoisson(generator, poisson + sizes[2], sizes[2], 50.0));
+    HIPRAND_CHECK(hiprandDestroyGenerator(generator));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> uniform_host = copy_to_host(uniform, 2 * sizes[0]);
+    std::vector<double> normal_host = copy_to_host(normal, 2 * sizes[1]);
+    std::vector<unsigned int> poisson_host = copy_to_host(poisson, 2 * sizes[2]);
+    HIP_CHECK(hipFree(uniform));
+    HIP_CHECK(hipFree(normal));
+    HIP_CHECK(hipFree(poisson));
+
+    for(size_t i = 0; i < sizes[0]; i++)
+    {
+        ASSERT_EQ(uniform_host[i], uniform_host[sizes[0] + i]) << i;
+    }
+    for(size_t i = 0; i < sizes[1]; i++)
+    {
+        ASSERT_EQ(normal_host[i], normal_host[sizes[1] + i]) << i;
+    }
+    for(size_t i = 0; i < sizes[2]; i++)
+    {
+        ASSERT_EQ(poisson_host[i], poisson_host[sizes[2] + i]) << i;
+    }
+}
+
+TEST(hiprand_ext, hiprand_generate_batch_test_xorwow)
+{
+    hiprand_generate_batch_test_func<HIPRAND_RNG_PSEUDO_XORWOW>();
+}
+
+TEST(hiprand_ext, hiprand_generate_batch_test_mrg32k3a)
+{
+    hiprand_generate_batch_test_func<HIPRAND_RNG_PSEUDO_MRG32K3A>();
+}
+
+TEST(hiprand_ext, hiprand_generate_batch_invalid)
+{
+    hiprandGenerator_t generator;
+    HIPRAND_CHECK(hiprandCreateGenerator(&generator, HIPRAND_RNG_PSEUDO_XORWOW));
+
+    hiprandBatchRequest_t request = {};
+    request.distribution = HIPRAND_BATCH_UNIFORM;
+    request.output_data = NULL;
+    request.n = 10;
+    EXPECT_EQ(hiprandGenerateBatch(generator, NULL, 1), HIPRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(hiprandGenerateBatch(generator, &request, 1), HIPRAND_STATUS_OUT_OF_RANGE);
+
+    HIPRAND_CHECK(hiprandDestroyGenerator(generator));
+}
+
+#ifndef __HIP_PLATFORM_NVCC__
+TEST(hiprand_ext, hiprand_generate_poisson_array_test)
+{
+    const size_t output_size = 8192;
+    std::vector<double> lambdas_host(output_size);
+    for(size_t i = 0; i < output_size; i++)
+    {
+        lambdas_host[i] = (i % 2 == 0) ? 3.0 : 1000.0;
+    }
+
+    unsigned int * output;
+    double * lambdas;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&lambdas, output_size * sizeof(double)));
+    HIP_CHECK(
+        hipMemcpy(
+            lambdas, lambdas_host.data(),
+            output_size * sizeof(double),
+            hipMemcpyHostToDevice
+        )
+    );
+
+    hiprandGenerator_t generator;
+    HIPRAND_CHECK(hiprandCreateGenerator(&generator, HIPRAND_RNG_PSEUDO_PHILOX4_32_10));
+    HIPRAND_CHECK(hiprandGeneratePoissonArray(generator, output, lambdas, output_size));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIPRAND_CHECK(hiprandDestroyGenerator(generator));
+
+    std::vector<unsigned int> output_host = copy_to_host(output, output_size);
+    HIP_CHECK(hipFree(output));
+    HIP_CHECK(hipFree(lambdas));
+
+    double means[2] = { 0.0, 0.0 };
+    for(size_t i = 0; i < output_size; i++)
+    {
+        means[i % 2] += static_cast<double>(output_host[i]) / (output_size / 2);
+    }
+    EXPECT_NEAR(means[0], 3.0, 0.3);
+    EXPECT_NEAR(means[1], 1000.0, 10.0);
+}
+
+TEST(hiprand_ext, hiprand_generator_save_load_test)
+{
+    const size_t output_size = 8192;
+    unsigned int * output;
+    HIP_CHECK(hipMalloc((void **)&output, 2 * output_size * sizeof(unsigned int)));
+
+    hiprandGenerator_t generator;
+    HIPRAND_CHECK(hiprandCreateGenerator(&generator, HIPRAND_RNG_PSEUDO_MRG32K3A));
+    HIPRAND_CHECK(hiprandSetPseudoRandomGeneratorSeed(generator, 5ULL));
+    HIPRAND_CHECK(hiprandGenerate(generator, output, output_size));
+
+    size_t blob_size = 0;
+    HIPRAND_CHECK(hiprandGeneratorSave(generator, NULL, &blob_size));
+    std::vector<char> blob(blob_size);
+    HIPRAND_CHECK(hiprandGeneratorSave(generator, blob.data(), &blob_size));
+    HIPRAND_CHECK(hiprandGenerate(generator, output, output_size));
+    HIPRAND_CHECK(hiprandDestroyGenerator(generator));
+
+    HIPRAND_CHECK(hiprandCreateGenerator(&generator, HIPRAND_RNG_PSEUDO_MRG32K3A));
+    HIPRAND_CHECK(hiprandGeneratorLoad(generator, blob.data(), blob_size));
+    HIPRAND_CHECK(hiprandGenerate(generator, output + output_size, output_size));
+    HIPRAND_CHECK(hiprandDestroyGenerator(generator));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> output_host = copy_to_host(output, 2 * output_size);
+    HIP_CHECK(hipFree(output));
+
+    // The restored generator continues the sequence
+    for(size_t i = 0; i < output_size; i++)
+    {
+        ASSERT_EQ(output_host[i], output_host[output_size + i]) << i;
+    }
+}
+#endif
@@ -217,6 +217,98 @@ void hiprand_discrete_kernel(unsigned int * output, const size_t size, hiprandDi
     }
 }
 
+// output[2 * i] is generated by hiprandStateXORWOW_t, output[2 * i + 1] by
+// hiprandStateXORWOWCompact_t initialized in the same way
+__global__
+void hiprand_xorwow_compact_kernel(unsigned int * output, const size_t size)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int global_size = hipGridDim_x * hipBlockDim_x;
+
+    hiprandStateXORWOW_t state;
+    hiprandStateXORWOWCompact_t compact_state;
+    const unsigned int subsequence = state_id;
+    hiprand_init(12345, subsequence, 67, &state);
+    hiprand_init(12345, subsequence, 67, &compact_state);
+
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        output[2 * index] = hiprand(&state);
+        output[2 * index + 1] = hiprand(&compact_state);
+        index += global_size;
+    }
+}
+
+// output[2 * i] is generated by the state of hiprand_init(), output[2 * i + 1]
+// by the state of hiprand_init_block()
+template <class GeneratorState>
+__global__
+void hiprand_init_block_kernel(unsigned int * output, unsigned long long seed)
+{
+    __shared__ unsigned int shared[XORWOW_SIZE];
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned long long subsequence = state_id * 7919ULL;
+    const unsigned long long offset = (state_id % 3) * 123456789ULL + state_id;
+
+    GeneratorState state;
+    hiprand_init(seed, subsequence, offset, &state);
+    output[2 * state_id] = hiprand(&state);
+    hiprand_init_block(seed, subsequence, offset, &state, shared);
+    output[2 * state_id + 1] = hiprand(&state);
+}
+
+template <class GeneratorState>
+__global__
+void hiprand_uniform4_kernel(float * output, const size_t size)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int global_size = hipGridDim_x * hipBlockDim_x;
+
+    GeneratorState state;
+    const unsigned int subsequence = state_id;
+    hiprand_init(12345, subsequence, 0, &state);
+
+    unsigned int index = state_id;
+    while(index < size / 4)
+    {
+        const float4 v = hiprand_uniform4(&state);
+        output[4 * index + 0] = v.x;
+        output[4 * index + 1] = v.y;
+        output[4 * index + 2] = v.z;
+        output[4 * index + 3] = v.w;
+        index += global_size;
+    }
+}
+
+// Every state generates one value, so the output is compared with states
+// initialized by hiprand_init()
+template <class GeneratorState>
+__global__
+void hiprand_states_kernel(GeneratorState * states, unsigned int * output, const size_t size)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(state_id < size)
+    {
+        GeneratorState state = states[state_id];
+        output[state_id] = hiprand(&state);
+    }
+}
+
+template <class GeneratorState>
+__global__
+void hiprand_init_states_reference_kernel(unsigned int * output, const size_t size,
+                                          unsigned long long seed, unsigned long long offset)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(state_id < size)
+    {
+        GeneratorState state;
+        hiprand_init(seed, state_id, offset, &state);
+        output[state_id] = hiprand(&state);
+    }
+}
+
 template<class T>
 void hiprand_kernel_h_hiprand_init_test()
 {
@@ -798,3 +890,210 @@ TEST_P(hiprand_kernel_h_default_poisson, hiprand_discrete)
 INSTANTIATE_TEST_CASE_P(hiprand_kernel_h_default_poisson,
                         hiprand_kernel_h_default_poisson,
                         ::testing::ValuesIn(lambdas));
+
+TEST(hiprand_kernel_h_xorwow_compact, hiprand)
+{
+    const size_t output_size = 8192;
+    unsigned int * output;
+    HIP_CHECK(hipMalloc((void **)&output, 2 * output_size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(hiprand_xorwow_compact_kernel),
+        dim3(4), dim3(64), 0, 0,
+        output, output_size
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<unsigned int> output_host(2 * output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            2 * output_size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    // The compact state produces the same sequence
+    for(size_t i = 0; i < output_size; i++)
+    {
+        ASSERT_EQ(output_host[2 * i], output_host[2 * i + 1]) << i;
+    }
+}
+
+template<class T>
+void hiprand_kernel_h_hiprand_init_block_test()
+{
+    typedef T state_type;
+
+    const size_t states_size = 256;
+    unsigned int * output;
+    HIP_CHECK(hipMalloc((void **)&output, 2 * states_size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(hiprand_init_block_kernel<state_type>),
+        dim3(4), dim3(64), 0, 0,
+        output, 0xdeadbeefbeefdeadULL
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<unsigned int> output_host(2 * states_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            2 * states_size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    for(size_t i = 0; i < states_size; i++)
+    {
+        ASSERT_EQ(output_host[2 * i], output_host[2 * i + 1]) << i;
+    }
+}
+
+TEST(hiprand_kernel_h_xorwow, hiprand_init_block)
+{
+    typedef hiprandStateXORWOW_t state_type;
+    hiprand_kernel_h_hiprand_init_block_test<state_type>();
+}
+
+TEST(hiprand_kernel_h_default, hiprand_init_block)
+{
+    typedef hiprandState_t state_type;
+    hiprand_kernel_h_hiprand_init_block_test<state_type>();
+}
+
+template<class T>
+void hiprand_kernel_h_hiprand_uniform4_test()
+{
+    typedef T state_type;
+
+    const size_t output_size = 8192;
+    float * output;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(hiprand_uniform4_kernel<state_type>),
+        dim3(4), dim3(64), 0, 0,
+        output, output_size
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<float> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(float),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    double mean = 0;
+    for(auto v : output_host)
+    {
+        ASSERT_GT(v, 0.0f);
+        ASSERT_LE(v, 1.0f);
+        mean += static_cast<double>(v);
+    }
+    mean = mean / output_size;
+    EXPECT_NEAR(mean, 0.5, 0.1);
+}
+
+TEST(hiprand_kernel_h_philox4x32_10, hiprand_uniform4)
+{
+    typedef hiprandStatePhilox4_32_10_t state_type;
+    hiprand_kernel_h_hiprand_uniform4_test<state_type>();
+}
+
+TEST(hiprand_kernel_h_mrg32k3a, hiprand_uniform4)
+{
+    typedef hiprandStateMRG32k3a_t state_type;
+    hiprand_kernel_h_hiprand_uniform4_test<state_type>();
+}
+
+TEST(hiprand_kernel_h_xorwow, hiprand_uniform4)
+{
+    typedef hiprandStateXORWOW_t state_type;
+    hiprand_kernel_h_hiprand_uniform4_test<state_type>();
+}
+
+TEST(hiprand_kernel_h_default, hiprand_uniform4)
+{
+    typedef hiprandState_t state_type;
+    hiprand_kernel_h_hiprand_uniform4_test<state_type>();
+}
+
+template<class T>
+void hiprand_kernel_h_hiprand_init_states_test(hiprandRngType_t rng_type)
+{
+    typedef T state_type;
+
+    const size_t states_size = 1000;
+    const unsigned long long seed = 0xdeadbeefbeefdeadULL;
+    const unsigned long long offset = 1234;
+    state_type * states;
+    unsigned int * output;
+    HIP_CHECK(hipMalloc((void **)&states, states_size * sizeof(state_type)));
+    HIP_CHECK(hipMalloc((void **)&output, 2 * states_size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    HIPRAND_CHECK(hiprandInitStates(states, states_size, seed, offset, rng_type, 0));
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(hiprand_states_kernel<state_type>),
+        dim3(4), dim3(256), 0, 0,
+        states, output, states_size
+    );
+    HIP_CHECK(hipPeekAtLastError());
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(hiprand_init_states_reference_kernel<state_type>),
+        dim3(4), dim3(256), 0, 0,
+        output + states_size, states_size, seed, offset
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<unsigned int> output_host(2 * states_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            2 * states_size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(states));
+    HIP_CHECK(hipFree(output));
+
+    for(size_t i = 0; i < states_size; i++)
+    {
+        ASSERT_EQ(output_host[i], output_host[states_size + i]) << i;
+    }
+}
+
+#ifndef __HIP_PLATFORM_NVCC__
+TEST(hiprand_kernel_h_philox4x32_10, hiprandInitStates)
+{
+    typedef hiprandStatePhilox4_32_10_t state_type;
+    hiprand_kernel_h_hiprand_init_states_test<state_type>(HIPRAND_RNG_PSEUDO_PHILOX4_32_10);
+}
+
+TEST(hiprand_kernel_h_mrg32k3a, hiprandInitStates)
+{
+    typedef hiprandStateMRG32k3a_t state_type;
+    hiprand_kernel_h_hiprand_init_states_test<state_type>(HIPRAND_RNG_PSEUDO_MRG32K3A);
+}
+
+TEST(hiprand_kernel_h_xorwow, hiprandInitStates)
+{
+    typedef hiprandStateXORWOW_t state_type;
+    hiprand_kernel_h_hiprand_init_states_test<state_type>(HIPRAND_RNG_PSEUDO_XORWOW);
+}
+#endif
@@ -21,6 +21,7 @@
 #include <stdio.h>
 #include <gtest/gtest.h>
 
+#include <cmath>
 #include <random>
 #include <vector>
 
@@ -130,3 +131,58 @@ const double lambdas[] = { 1.0, 5.5, 20.0, 100.0, 1234.5, 5000.0 };
 INSTANTIATE_TEST_CASE_P(poisson_distribution_tests,
                         poisson_distribution_tests,
                         ::testing::ValuesIn(lambdas));
+
+// Uniform values of the device API Poisson distribution in host tests
+struct poisson_test_state
+{
+    std::mt19937 * gen;
+    size_t draws;
+};
+
+double rocrand_uniform_double(poisson_test_state * state)
+{
+    state->draws++;
+    const unsigned long long v =
+        (static_cast<unsigned long long>((*state->gen)()) << 32) | (*state->gen)();
+    return ROCRAND_2POW32_INV_DOUBLE / 2.0 + (v >> 11) * (ROCRAND_2POW32_INV_DOUBLE / 2097152.0);
+}
+
+class poisson_ptrs_distribution_tests : public ::testing::TestWithParam<double> { };
+
+// Transformed rejection PTRS of the device API (lambda in [10, 64)) follows
+// the Poisson distribution and needs few uniform values per output
+TEST_P(poisson_ptrs_distribution_tests, pmf_compare)
+{
+    const double lambda = GetParam();
+
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    poisson_test_state state = { &gen, 0 };
+    poisson_test_state * state_ptr = &state;
+
+    const size_t samples_count = 1000000;
+    std::vector<size_t> histogram(256);
+    for (size_t si = 0; si < samples_count; si++)
+    {
+        const unsigned int v =
+            rocrand_device::detail::poisson_distribution_small(state_ptr, lambda);
+        if (v < histogram.size())
+        {
+            histogram[v]++;
+        }
+    }
+
+    EXPECT_LT(static_cast<double>(state.draws) / samples_count, 3.0);
+    for (size_t k = 0; k < histogram.size(); k++)
+    {
+        const double expected = samples_count
+            * std::exp(-lambda + k * std::log(lambda) - std::lgamma(k + 1.0));
+        EXPECT_NEAR(histogram[k], expected, std::max(20.0, 6.0 * std::sqrt(expected)));
+    }
+}
+
+const double ptrs_lambdas[] = { 10.0, 17.3, 42.0, 63.9 };
+
+INSTANTIATE_TEST_CASE_P(poisson_ptrs_distribution_tests,
+                        poisson_ptrs_distribution_tests,
+                        ::testing::ValuesIn(ptrs_lambdas));
@@ -0,0 +1,109 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <set>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+struct counting_allocator
+{
+    std::set<void *> allocations;
+    size_t allocated;
+
+    static hipError_t allocate(void * context, void ** ptr, size_t size, hipStream_t)
+    {
+        counting_allocator * a = static_cast<counting_allocator *>(context);
+        const hipError_t error = hipMalloc(ptr, size);
+        if(error == hipSuccess)
+        {
+            a->allocations.insert(*ptr);
+            a->allocated++;
+        }
+        return error;
+    }
+
+    static hipError_t deallocate(void * context, void * ptr, hipStream_t)
+    {
+        counting_allocator * a = static_cast<counting_allocator *>(context);
+        if(a->allocations.erase(ptr) != 1)
+        {
+            return hipErrorInvalidValue;
+        }
+        return hipFree(ptr);
+    }
+};
+
+class rocrand_allocator_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+// All device memory of generators is allocated by the allocator and freed
+// when generators are destroyed, also after the allocator is reset
+TEST_P(rocrand_allocator_tests, user_allocator_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    const size_t size = 12345;
+
+    counting_allocator counter;
+    counter.allocated = 0;
+    const rocrand_allocator allocator = {
+        &counter, counting_allocator::allocate, counting_allocator::deallocate
+    };
+    ROCRAND_CHECK(rocrand_set_allocator(&allocator));
+
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_generate(generator, data, size));
+    ROCRAND_CHECK(rocrand_generate_poisson(generator, data, size, 10.0));
+    ROCRAND_CHECK(rocrand_generate_poisson(generator, data, size, 20.0));
+    HIP_CHECK(hipDeviceSynchronize());
+    EXPECT_GT(counter.allocations.size(), 0U);
+
+    ROCRAND_CHECK(rocrand_set_allocator(NULL));
+    // Tables of new lambdas are allocated by the default allocator
+    const size_t allocated = counter.allocated;
+    ROCRAND_CHECK(rocrand_generate_poisson(generator, data, size, 30.0));
+    HIP_CHECK(hipDeviceSynchronize());
+    EXPECT_EQ(counter.allocated, allocated);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(data));
+    EXPECT_TRUE(counter.allocations.empty());
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_allocator_tests,
+                        rocrand_allocator_tests,
+                        ::testing::ValuesIn(rng_types));
+
+TEST(rocrand_allocator_neg_tests, neg_test)
+{
+    rocrand_allocator allocator = { NULL, counting_allocator::allocate, NULL };
+    EXPECT_EQ(rocrand_set_allocator(&allocator), ROCRAND_STATUS_OUT_OF_RANGE);
+    allocator.allocate = NULL;
+    allocator.deallocate = counting_allocator::deallocate;
+    EXPECT_EQ(rocrand_set_allocator(&allocator), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_set_allocator(NULL), ROCRAND_STATUS_SUCCESS);
+}
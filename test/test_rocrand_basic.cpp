@@ -20,6 +20,7 @@
 
 #include <stdio.h>
 #include <gtest/gtest.h>
+#include <vector>
 
 #include <hip/hip_runtime.h>
 #include <rocrand.h>
@@ -82,6 +83,73 @@ TEST_P(rocrand_basic_tests, rocrand_initialize_generator_test)
     ROCRAND_CHECK(rocrand_destroy_generator(g));
 }
 
+void generate_after_seed(rocrand_generator g,
+                         unsigned long long seed,
+                         bool async,
+                         unsigned int * data,
+                         std::vector<unsigned int>& output)
+{
+    ROCRAND_CHECK(rocrand_set_seed(g, seed));
+    if(async)
+    {
+        ROCRAND_CHECK(rocrand_initialize_generator_async(g));
+    }
+    ROCRAND_CHECK(rocrand_generate(g, data, output.size()));
+    HIP_CHECK(
+        hipMemcpy(
+            output.data(), data,
+            output.size() * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+}
+
+TEST_P(rocrand_basic_tests, rocrand_initialize_generator_async_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    if(rng_type == ROCRAND_RNG_QUASI_SOBOL32 || rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        // Seed can't be set for Sobol32, MTGP32 initialization is synchronous
+        rocrand_generator g = NULL;
+        EXPECT_EQ(rocrand_initialize_generator_async(g), ROCRAND_STATUS_NOT_CREATED);
+        ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+        ROCRAND_CHECK(rocrand_initialize_generator_async(g));
+        ROCRAND_CHECK(rocrand_destroy_generator(g));
+        return;
+    }
+
+    const size_t size = 12345;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+
+    std::vector<unsigned int> expected1(size), expected2(size);
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+    generate_after_seed(g, 123ULL, false, data, expected1);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+    generate_after_seed(g, 456ULL, false, data, expected2);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    // Asynchronous initialization and reseeding to previously used seeds
+    // (cached states) must produce the same values as a new generator
+    std::vector<unsigned int> output(size);
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+    for(int i = 0; i < 2; i++)
+    {
+        for(bool async : { true, false })
+        {
+            generate_after_seed(g, 123ULL, async, data, output);
+            ASSERT_EQ(output, expected1);
+            generate_after_seed(g, 456ULL, async, data, output);
+            ASSERT_EQ(output, expected2);
+        }
+    }
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    HIP_CHECK(hipFree(data));
+}
+
 INSTANTIATE_TEST_CASE_P(rocrand_basic_tests,
                         rocrand_basic_tests,
                         ::testing::ValuesIn(rng_types));
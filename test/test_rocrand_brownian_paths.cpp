@@ -0,0 +1,190 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+const rocrand_rng_type brownian_rng_types[] = {
+    ROCRAND_RNG_QUASI_SOBOL32,
+    ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32,
+    ROCRAND_RNG_QUASI_SOBOL64,
+    ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64
+};
+
+class rocrand_brownian_paths_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+void generate_paths(const rocrand_rng_type rng_type,
+                    const std::vector<float>& times,
+                    const size_t paths,
+                    const bool cumulative,
+                    std::vector<float>& output)
+{
+    const unsigned int steps = times.size();
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(generator, steps));
+
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, paths * steps * sizeof(float)));
+    // Paths of the second call continue the sequence
+    const size_t paths1 = paths / 3;
+    ROCRAND_CHECK(rocrand_generate_brownian_paths(
+        generator, data, paths1, times.data(), steps, cumulative
+    ));
+    ROCRAND_CHECK(rocrand_generate_brownian_paths(
+        generator, data + paths1 * steps, paths - paths1, times.data(), steps, cumulative
+    ));
+    HIP_CHECK(hipDeviceSynchronize());
+    output.resize(paths * steps);
+    HIP_CHECK(
+        hipMemcpy(
+            output.data(), data,
+            paths * steps * sizeof(float),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_brownian_paths_tests, paths_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    const size_t paths = 12345;
+    // Non-uniform time grid
+    std::vector<float> times;
+    for(unsigned int k = 1; k <= 13; k++)
+    {
+        times.push_back(0.1f * k + 0.01f * k * k);
+    }
+    const unsigned int steps = times.size();
+
+    std::vector<float> values;
+    generate_paths(rng_type, times, paths, true, values);
+    std::vector<float> increments;
+    generate_paths(rng_type, times, paths, false, increments);
+
+    // The first dimension defines the last time
+    std::vector<float> normal(paths * steps);
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+        ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(generator, steps));
+        float * data;
+        HIP_CHECK(hipMalloc((void **)&data, paths * steps * sizeof(float)));
+        ROCRAND_CHECK(rocrand_generate_normal(generator, data, paths * steps, 0.0f, 1.0f));
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(
+            hipMemcpy(
+                normal.data(), data,
+                paths * steps * sizeof(float),
+                hipMemcpyDeviceToHost
+            )
+        );
+        HIP_CHECK(hipFree(data));
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+
+    for(size_t p = 0; p < paths; p++)
+    {
+        float sum = 0.0f;
+        for(unsigned int k = 0; k < steps; k++)
+        {
+            sum += increments[p * steps + k];
+            ASSERT_NEAR(values[p * steps + k], sum, 1e-4f * std::max(1.0f, std::abs(sum)));
+        }
+        ASSERT_NEAR(
+            values[p * steps + steps - 1], std::sqrt(times[steps - 1]) * normal[p],
+            1e-5f * std::max(1.0f, std::abs(normal[p]))
+        );
+    }
+
+    // Covariances of a Brownian motion: E[W(s) W(t)] = min(s, t)
+    for(unsigned int i = 0; i < steps; i++)
+    {
+        for(unsigned int j = 0; j <= i; j++)
+        {
+            double covariance = 0.0;
+            for(size_t p = 0; p < paths; p++)
+            {
+                covariance += static_cast<double>(values[p * steps + i]) * values[p * steps + j];
+            }
+            covariance /= paths;
+            EXPECT_NEAR(covariance, std::min(times[i], times[j]), 0.02 * times[i]);
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_brownian_paths_tests,
+                        rocrand_brownian_paths_tests,
+                        ::testing::ValuesIn(brownian_rng_types));
+
+TEST(rocrand_brownian_paths_neg_tests, neg_test)
+{
+    const float times[] = { 0.5f, 1.0f, 1.5f, 2.0f };
+    const float bad_times[] = { 0.5f, 1.0f, 1.0f, 2.0f };
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, 100 * 4 * sizeof(float)));
+
+    EXPECT_EQ(
+        rocrand_generate_brownian_paths(NULL, data, 100, times, 4, 0),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(
+        rocrand_generate_brownian_paths(generator, data, 100, times, 4, 0),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL32));
+    // The generator must have a dimension per step
+    EXPECT_EQ(
+        rocrand_generate_brownian_paths(generator, data, 100, times, 4, 0),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(generator, 4));
+    EXPECT_EQ(
+        rocrand_generate_brownian_paths(generator, data, 100, bad_times, 4, 0),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_brownian_paths(generator, data, 100, NULL, 4, 0),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_brownian_paths(generator, NULL, 100, times, 4, 0),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_generate_brownian_paths(generator, data, 100, times, 4, 1));
+    HIP_CHECK(hipDeviceSynchronize());
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(data));
+}
@@ -56,6 +56,12 @@ void rocrand_rng_ctor_template()
 TEST(rocrand_cpp_wrapper, rocrand_rng_ctor)
 {
     ASSERT_NO_THROW(rocrand_rng_ctor_template<rocrand_cpp::philox4x32_10>());
+    ASSERT_NO_THROW(rocrand_rng_ctor_template<rocrand_cpp::philox4x32_7>());
+    ASSERT_NO_THROW(rocrand_rng_ctor_template<rocrand_cpp::xoshiro128pp>());
+    ASSERT_NO_THROW(rocrand_rng_ctor_template<rocrand_cpp::pcg32>());
+    ASSERT_NO_THROW(rocrand_rng_ctor_template<rocrand_cpp::philox4x64_10>());
+    ASSERT_NO_THROW(rocrand_rng_ctor_template<rocrand_cpp::threefry2x64_20>());
+    ASSERT_NO_THROW(rocrand_rng_ctor_template<rocrand_cpp::threefry4x64_20>());
     ASSERT_NO_THROW(rocrand_rng_ctor_template<rocrand_cpp::xorwow>());
     ASSERT_NO_THROW(rocrand_rng_ctor_template<rocrand_cpp::mrg32k3a>());
     ASSERT_NO_THROW(rocrand_rng_ctor_template<rocrand_cpp::mtgp32>());
@@ -76,6 +82,12 @@ void rocrand_prng_ctor_template()
 TEST(rocrand_cpp_wrapper, rocrand_prng_ctor)
 {
     ASSERT_NO_THROW(rocrand_prng_ctor_template<rocrand_cpp::philox4x32_10>());
+    ASSERT_NO_THROW(rocrand_prng_ctor_template<rocrand_cpp::philox4x32_7>());
+    ASSERT_NO_THROW(rocrand_prng_ctor_template<rocrand_cpp::xoshiro128pp>());
+    ASSERT_NO_THROW(rocrand_prng_ctor_template<rocrand_cpp::pcg32>());
+    ASSERT_NO_THROW(rocrand_prng_ctor_template<rocrand_cpp::philox4x64_10>());
+    ASSERT_NO_THROW(rocrand_prng_ctor_template<rocrand_cpp::threefry2x64_20>());
+    ASSERT_NO_THROW(rocrand_prng_ctor_template<rocrand_cpp::threefry4x64_20>());
     ASSERT_NO_THROW(rocrand_prng_ctor_template<rocrand_cpp::xorwow>());
     ASSERT_NO_THROW(rocrand_prng_ctor_template<rocrand_cpp::mrg32k3a>());
 
@@ -93,6 +105,12 @@ void assert_same_types()
 TEST(rocrand_cpp_wrapper, rocrand_rng_result_type)
 {
     assert_same_types<unsigned int, rocrand_cpp::philox4x32_10::result_type>();
+    assert_same_types<unsigned int, rocrand_cpp::philox4x32_7::result_type>();
+    assert_same_types<unsigned int, rocrand_cpp::xoshiro128pp::result_type>();
+    assert_same_types<unsigned int, rocrand_cpp::pcg32::result_type>();
+    assert_same_types<unsigned int, rocrand_cpp::philox4x64_10::result_type>();
+    assert_same_types<unsigned int, rocrand_cpp::threefry2x64_20::result_type>();
+    assert_same_types<unsigned int, rocrand_cpp::threefry4x64_20::result_type>();
     assert_same_types<unsigned int, rocrand_cpp::xorwow::result_type>();
     assert_same_types<unsigned int, rocrand_cpp::mrg32k3a::result_type>();
     assert_same_types<unsigned int, rocrand_cpp::mtgp32::result_type>();
@@ -102,6 +120,12 @@ TEST(rocrand_cpp_wrapper, rocrand_rng_result_type)
 TEST(rocrand_cpp_wrapper, rocrand_rng_offset_type)
 {
     assert_same_types<unsigned long long, rocrand_cpp::philox4x32_10::offset_type>();
+    assert_same_types<unsigned long long, rocrand_cpp::philox4x32_7::offset_type>();
+    assert_same_types<unsigned long long, rocrand_cpp::xoshiro128pp::offset_type>();
+    assert_same_types<unsigned long long, rocrand_cpp::pcg32::offset_type>();
+    assert_same_types<unsigned long long, rocrand_cpp::philox4x64_10::offset_type>();
+    assert_same_types<unsigned long long, rocrand_cpp::threefry2x64_20::offset_type>();
+    assert_same_types<unsigned long long, rocrand_cpp::threefry4x64_20::offset_type>();
     assert_same_types<unsigned long long, rocrand_cpp::xorwow::offset_type>();
     assert_same_types<unsigned long long, rocrand_cpp::mrg32k3a::offset_type>();
     assert_same_types<unsigned long long, rocrand_cpp::mtgp32::offset_type>();
@@ -111,6 +135,12 @@ TEST(rocrand_cpp_wrapper, rocrand_rng_offset_type)
 TEST(rocrand_cpp_wrapper, rocrand_prng_default_seed)
 {
     EXPECT_EQ(rocrand_cpp::philox4x32_10::default_seed, ROCRAND_PHILOX4x32_DEFAULT_SEED);
+    EXPECT_EQ(rocrand_cpp::philox4x32_7::default_seed, ROCRAND_PHILOX4x32_DEFAULT_SEED);
+    EXPECT_EQ(rocrand_cpp::xoshiro128pp::default_seed, ROCRAND_XOSHIRO128PP_DEFAULT_SEED);
+    EXPECT_EQ(rocrand_cpp::pcg32::default_seed, ROCRAND_PCG32_DEFAULT_SEED);
+    EXPECT_EQ(rocrand_cpp::philox4x64_10::default_seed, ROCRAND_PHILOX4x64_DEFAULT_SEED);
+    EXPECT_EQ(rocrand_cpp::threefry2x64_20::default_seed, ROCRAND_THREEFRY2x64_DEFAULT_SEED);
+    EXPECT_EQ(rocrand_cpp::threefry4x64_20::default_seed, ROCRAND_THREEFRY4x64_DEFAULT_SEED);
     EXPECT_EQ(rocrand_cpp::xorwow::default_seed, ROCRAND_XORWOW_DEFAULT_SEED);
     EXPECT_EQ(rocrand_cpp::mrg32k3a::default_seed, ROCRAND_MRG32K3A_DEFAULT_SEED);
 }
@@ -156,6 +186,12 @@ void rocrand_prng_seed_template()
 TEST(rocrand_cpp_wrapper, rocrand_prng_seed)
 {
     ASSERT_NO_THROW(rocrand_prng_seed_template<rocrand_cpp::philox4x32_10>());
+    ASSERT_NO_THROW(rocrand_prng_seed_template<rocrand_cpp::philox4x32_7>());
+    ASSERT_NO_THROW(rocrand_prng_seed_template<rocrand_cpp::xoshiro128pp>());
+    ASSERT_NO_THROW(rocrand_prng_seed_template<rocrand_cpp::pcg32>());
+    ASSERT_NO_THROW(rocrand_prng_seed_template<rocrand_cpp::philox4x64_10>());
+    ASSERT_NO_THROW(rocrand_prng_seed_template<rocrand_cpp::threefry2x64_20>());
+    ASSERT_NO_THROW(rocrand_prng_seed_template<rocrand_cpp::threefry4x64_20>());
     ASSERT_NO_THROW(rocrand_prng_seed_template<rocrand_cpp::xorwow>());
     ASSERT_NO_THROW(rocrand_prng_seed_template<rocrand_cpp::mrg32k3a>());
     ASSERT_NO_THROW(rocrand_prng_seed_template<rocrand_cpp::mtgp32>());
@@ -196,6 +232,12 @@ void rocrand_rng_offset_template()
 TEST(rocrand_cpp_wrapper, rocrand_rng_offset)
 {
     ASSERT_NO_THROW(rocrand_rng_offset_template<rocrand_cpp::philox4x32_10>());
+    ASSERT_NO_THROW(rocrand_rng_offset_template<rocrand_cpp::philox4x32_7>());
+    ASSERT_NO_THROW(rocrand_rng_offset_template<rocrand_cpp::xoshiro128pp>());
+    ASSERT_NO_THROW(rocrand_rng_offset_template<rocrand_cpp::pcg32>());
+    ASSERT_NO_THROW(rocrand_rng_offset_template<rocrand_cpp::philox4x64_10>());
+    ASSERT_NO_THROW(rocrand_rng_offset_template<rocrand_cpp::threefry2x64_20>());
+    ASSERT_NO_THROW(rocrand_rng_offset_template<rocrand_cpp::threefry4x64_20>());
     ASSERT_NO_THROW(rocrand_rng_offset_template<rocrand_cpp::xorwow>());
     ASSERT_NO_THROW(rocrand_rng_offset_template<rocrand_cpp::mrg32k3a>());
     ASSERT_NO_THROW(rocrand_rng_offset_template<rocrand_cpp::sobol32>());
@@ -215,6 +257,12 @@ void rocrand_rng_stream_template()
 TEST(rocrand_cpp_wrapper, rocrand_rng_stream)
 {
     ASSERT_NO_THROW(rocrand_rng_stream_template<rocrand_cpp::philox4x32_10>());
+    ASSERT_NO_THROW(rocrand_rng_stream_template<rocrand_cpp::philox4x32_7>());
+    ASSERT_NO_THROW(rocrand_rng_stream_template<rocrand_cpp::xoshiro128pp>());
+    ASSERT_NO_THROW(rocrand_rng_stream_template<rocrand_cpp::pcg32>());
+    ASSERT_NO_THROW(rocrand_rng_stream_template<rocrand_cpp::philox4x64_10>());
+    ASSERT_NO_THROW(rocrand_rng_stream_template<rocrand_cpp::threefry2x64_20>());
+    ASSERT_NO_THROW(rocrand_rng_stream_template<rocrand_cpp::threefry4x64_20>());
     ASSERT_NO_THROW(rocrand_rng_stream_template<rocrand_cpp::xorwow>());
     ASSERT_NO_THROW(rocrand_rng_stream_template<rocrand_cpp::mrg32k3a>());
     ASSERT_NO_THROW(rocrand_rng_stream_template<rocrand_cpp::mtgp32>());
@@ -650,3 +698,347 @@ TEST(rocrand_cpp_wrapper, rocrand_poisson_dist_param)
     d3.param(d1.param());
     ASSERT_TRUE(d1.param() == d3.param());
 }
+
+// Two exponential values with mean 1 from three 32-bit values,
+// the third value is a random sign of the difference
+struct exponential_pair_transform
+{
+    static constexpr unsigned int input_width = 3;
+    static constexpr unsigned int output_width = 2;
+
+    __device__
+    void operator()(const unsigned int (&input)[3], float (&output)[2]) const
+    {
+        output[0] = -logf(rocrand_device::detail::uniform_distribution(input[0]));
+        output[1] = -logf(rocrand_device::detail::uniform_distribution(input[1]));
+        if(input[2] & 1)
+        {
+            const float t = output[0];
+            output[0] = output[1];
+            output[1] = t;
+        }
+    }
+};
+
+template<class T>
+void rocrand_transform_dist_template()
+{
+    T engine;
+    rocrand_cpp::transform_distribution<float, exponential_pair_transform> d;
+
+    const size_t output_size = 8193;
+    float * output;
+    HIP_CHECK(
+        hipMalloc((void **)&output,
+        (output_size + 1) * sizeof(float))
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // generate (also misaligned and odd sizes)
+    EXPECT_NO_THROW(d(engine, output + 1, output_size));
+    EXPECT_NO_THROW(d(engine, output, 3));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> output_host(output_size + 1);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            (output_size + 1) * sizeof(float),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    double mean = 0;
+    for(auto v : output_host)
+    {
+        ASSERT_GE(v, 0.0f);
+        mean += static_cast<double>(v);
+    }
+    mean = mean / output_host.size();
+    EXPECT_NEAR(mean, 1.0, 0.1);
+}
+
+TEST(rocrand_cpp_wrapper, rocrand_transform_dist)
+{
+    ASSERT_NO_THROW((
+        rocrand_transform_dist_template<rocrand_cpp::philox4x32_10>()
+    ));
+    ASSERT_NO_THROW((
+        rocrand_transform_dist_template<rocrand_cpp::xorwow>()
+    ));
+    ASSERT_NO_THROW((
+        rocrand_transform_dist_template<rocrand_cpp::mrg32k3a>()
+    ));
+    ASSERT_NO_THROW((
+        rocrand_transform_dist_template<rocrand_cpp::mtgp32>()
+    ));
+}
+
+// Values generated in another stream than the stream of the engine (the key
+// is generated in the stream of the distribution) are the same as values
+// generated in the stream of the engine
+TEST(rocrand_cpp_wrapper, rocrand_transform_dist_stream)
+{
+    const size_t output_size = 8192;
+    float * output;
+    HIP_CHECK(hipMalloc((void **)&output, 2 * output_size * sizeof(float)));
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreate(&stream));
+
+    rocrand_cpp::philox4x32_10 engine0(123ULL);
+    rocrand_cpp::philox4x32_10 engine1(123ULL);
+    rocrand_cpp::transform_distribution<float, exponential_pair_transform> d0;
+    rocrand_cpp::transform_distribution<float, exponential_pair_transform> d1(
+        exponential_pair_transform(), stream
+    );
+    for(unsigned int i = 0; i < 3; i++)
+    {
+        d0(engine0, output, output_size);
+        d1(engine1, output + output_size, output_size);
+    }
+    HIP_CHECK(hipStreamSynchronize(stream));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> output_host(2 * output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            2 * output_size * sizeof(float),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipFree(output));
+    HIP_CHECK(hipStreamDestroy(stream));
+
+    for(size_t i = 0; i < output_size; i++)
+    {
+        ASSERT_EQ(output_host[i], output_host[output_size + i]) << i;
+    }
+}
+
+// 1 if a point of two uniform coordinates is inside the unit circle
+struct inside_circle_map
+{
+    static constexpr unsigned int input_width = 2;
+
+    __device__
+    unsigned long long operator()(const unsigned int (&input)[2]) const
+    {
+        const float x = rocrand_device::detail::uniform_distribution(input[0]);
+        const float y = rocrand_device::detail::uniform_distribution(input[1]);
+        return x * x + y * y <= 1.0f ? 1 : 0;
+    }
+};
+
+struct sum_reduce
+{
+    __device__
+    unsigned long long operator()(const unsigned long long& a, const unsigned long long& b) const
+    {
+        return a + b;
+    }
+};
+
+struct value_map
+{
+    static constexpr unsigned int input_width = 1;
+
+    __device__
+    unsigned int operator()(const unsigned int (&input)[1]) const
+    {
+        return input[0];
+    }
+};
+
+struct max_reduce
+{
+    __device__
+    unsigned int operator()(const unsigned int& a, const unsigned int& b) const
+    {
+        return a > b ? a : b;
+    }
+};
+
+template<class T>
+void rocrand_transform_reduce_template()
+{
+    T engine;
+
+    // More samples than threads of all blocks
+    const size_t samples = 1 << 22;
+    rocrand_cpp::transform_reduce<unsigned long long, inside_circle_map, sum_reduce> pi;
+    const unsigned long long inside = pi(engine, samples);
+    EXPECT_NEAR(4.0 * inside / samples, 3.14159, 0.01);
+    EXPECT_EQ(pi(engine, 0), 0ULL);
+
+    rocrand_cpp::transform_reduce<unsigned int, value_map, max_reduce> max_value;
+    EXPECT_GT(max_value(engine, 1000000), 0xFFF00000U);
+    // Fewer samples than threads of one block
+    EXPECT_GT(max_value(engine, 100), 0U);
+
+    // Result in device memory
+    unsigned int * result;
+    HIP_CHECK(hipMalloc((void **)&result, sizeof(unsigned int)));
+    max_value(engine, 12345, result);
+    unsigned int result_host;
+    HIP_CHECK(hipMemcpy(&result_host, result, sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(result));
+    EXPECT_GT(result_host, 0xFF000000U);
+}
+
+TEST(rocrand_cpp_wrapper, rocrand_transform_reduce)
+{
+    ASSERT_NO_THROW((
+        rocrand_transform_reduce_template<rocrand_cpp::philox4x32_10>()
+    ));
+    ASSERT_NO_THROW((
+        rocrand_transform_reduce_template<rocrand_cpp::xorwow>()
+    ));
+    ASSERT_NO_THROW((
+        rocrand_transform_reduce_template<rocrand_cpp::mtgp32>()
+    ));
+}
+
+// Reductions of the same engine state are the same
+TEST(rocrand_cpp_wrapper, rocrand_transform_reduce_reproducibility)
+{
+    rocrand_cpp::transform_reduce<unsigned long long, inside_circle_map, sum_reduce> pi;
+    rocrand_cpp::philox4x32_10 engine0(123ULL);
+    rocrand_cpp::philox4x32_10 engine1(123ULL);
+    EXPECT_EQ(pi(engine0, 1000003), pi(engine1, 1000003));
+    EXPECT_EQ(pi(engine0, 5000), pi(engine1, 5000));
+}
+
+// Reductions in another stream than the stream of the engine (the key and
+// the partials are written in the stream of the reduction) are the same as
+// reductions in the stream of the engine, also results in device memory
+TEST(rocrand_cpp_wrapper, rocrand_transform_reduce_stream)
+{
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreate(&stream));
+    unsigned long long * results;
+    HIP_CHECK(hipMalloc((void **)&results, 3 * sizeof(unsigned long long)));
+
+    rocrand_cpp::transform_reduce<unsigned long long, inside_circle_map, sum_reduce> pi0;
+    rocrand_cpp::transform_reduce<unsigned long long, inside_circle_map, sum_reduce> pi1(
+        inside_circle_map(), sum_reduce(), 0, stream
+    );
+    rocrand_cpp::philox4x32_10 engine0(123ULL);
+    rocrand_cpp::xorwow engine1(123ULL);
+    rocrand_cpp::philox4x32_10 engine2(123ULL);
+    rocrand_cpp::xorwow engine3(123ULL);
+    for(unsigned int i = 0; i < 3; i++)
+    {
+        pi1(engine2, 1000003, results + i);
+    }
+    std::vector<unsigned long long> expected;
+    for(unsigned int i = 0; i < 3; i++)
+    {
+        expected.push_back(pi0(engine0, 1000003));
+    }
+    EXPECT_EQ(pi0(engine1, 5000), pi1(engine3, 5000));
+
+    std::vector<unsigned long long> results_host(3);
+    HIP_CHECK(hipStreamSynchronize(stream));
+    HIP_CHECK(
+        hipMemcpy(
+            results_host.data(), results,
+            3 * sizeof(unsigned long long),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipFree(results));
+    HIP_CHECK(hipStreamDestroy(stream));
+    EXPECT_EQ(results_host, expected);
+}
+
+template<class T>
+void rocrand_async_template()
+{
+    const size_t size = 40000;
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, 2 * size * sizeof(float)));
+    hipStream_t streams[2];
+    for(hipStream_t& stream : streams)
+    {
+        HIP_CHECK(hipStreamCreate(&stream));
+    }
+
+    // Values generated by the same engine in different streams are
+    // the same as values generated synchronously in the stream of the engine
+    T engine(1234ULL);
+    rocrand_cpp::normal_distribution<float> d(1.0f, 2.0f);
+    rocrand_cpp::normal_distribution<float>::param_type params(-3.0f, 0.5f);
+    rocrand_cpp::device_span<float> output(data, 2 * size);
+    rocrand_cpp::generate_future f1 = d(engine, output.subspan(0, size), streams[0]);
+    rocrand_cpp::generate_future f2 = d(engine, output.subspan(size, size), params, streams[1]);
+    EXPECT_EQ(f1.status(), ROCRAND_STATUS_SUCCESS);
+    EXPECT_EQ(f2.status(), ROCRAND_STATUS_SUCCESS);
+    f1.wait();
+    f2.wait();
+    EXPECT_TRUE(f1.ready());
+    EXPECT_TRUE(f2.ready());
+    std::vector<float> output_host(2 * size);
+    HIP_CHECK(hipMemcpy(
+        output_host.data(), data, 2 * size * sizeof(float), hipMemcpyDeviceToHost
+    ));
+
+    T expected_engine(1234ULL);
+    rocrand_cpp::normal_distribution<float> d2(params);
+    d(expected_engine, data, size);
+    d2(expected_engine, data + size, size);
+    HIP_CHECK(hipDeviceSynchronize());
+    std::vector<float> expected(2 * size);
+    HIP_CHECK(hipMemcpy(
+        expected.data(), data, 2 * size * sizeof(float), hipMemcpyDeviceToHost
+    ));
+    EXPECT_EQ(output_host, expected);
+
+    // Other streams wait for the generation by the future
+    unsigned int * data_int;
+    HIP_CHECK(hipMalloc((void **)&data_int, size * sizeof(unsigned int)));
+    rocrand_cpp::generate_future f3 = engine(
+        rocrand_cpp::device_span<unsigned int>(data_int, size), streams[0]
+    );
+    EXPECT_NO_THROW(f3.wait(streams[1]));
+    std::vector<unsigned int> output_int(size, 0);
+    HIP_CHECK(hipMemcpyAsync(
+        output_int.data(), data_int, size * sizeof(unsigned int), hipMemcpyDeviceToHost,
+        streams[1]
+    ));
+    HIP_CHECK(hipStreamSynchronize(streams[1]));
+    EXPECT_NE(std::count(output_int.begin(), output_int.end(), 0U), static_cast<long>(size));
+
+    // Errors are reported by futures
+    rocrand_cpp::poisson_distribution<unsigned int> poisson(-1.0);
+    rocrand_cpp::generate_future f4 = poisson(
+        engine, rocrand_cpp::device_span<unsigned int>(data_int, size), streams[0]
+    );
+    EXPECT_EQ(f4.status(), ROCRAND_STATUS_OUT_OF_RANGE);
+    try {
+        f4.wait();
+        FAIL() << "Expected rocrand_cpp::error";
+    }
+    catch(const rocrand_cpp::error& err) {
+        EXPECT_EQ(err.error_code(), ROCRAND_STATUS_OUT_OF_RANGE);
+    }
+
+    HIP_CHECK(hipDeviceSynchronize());
+    for(hipStream_t stream : streams)
+    {
+        HIP_CHECK(hipStreamDestroy(stream));
+    }
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(data_int));
+}
+
+TEST(rocrand_cpp_wrapper, rocrand_async)
+{
+    ASSERT_NO_THROW(rocrand_async_template<rocrand_cpp::philox4x32_10>());
+    ASSERT_NO_THROW(rocrand_async_template<rocrand_cpp::xorwow>());
+    ASSERT_NO_THROW(rocrand_async_template<rocrand_cpp::mrg32k3a>());
+    ASSERT_NO_THROW(rocrand_async_template<rocrand_cpp::mtgp32>());
+}
@@ -142,6 +142,44 @@ TEST_P(rocrand_generate_tests, short_test)
     ROCRAND_CHECK(rocrand_destroy_generator(generator));
 }
 
+TEST_P(rocrand_generate_tests, long_long_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            rng_type
+        )
+    );
+
+    const size_t size = 12563;
+    unsigned long long * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned long long)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Any sizes
+    ROCRAND_CHECK(
+        rocrand_generate_long_long(generator, data, 1)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Any alignment
+    ROCRAND_CHECK(
+        rocrand_generate_long_long(generator, data+1, 2)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_long_long(generator, data, size)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
 TEST(rocrand_generate_tests, neg_test)
 {
     const size_t size = 256;
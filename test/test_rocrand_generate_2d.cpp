@@ -0,0 +1,193 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+struct generate_2d_test_params
+{
+    rocrand_rng_type rng_type;
+    bool stateless;
+    rocrand_normal_method normal_method;
+};
+
+const generate_2d_test_params generate_2d_params[] = {
+    { ROCRAND_RNG_PSEUDO_XORWOW, false, ROCRAND_NORMAL_METHOD_BOX_MULLER },
+    { ROCRAND_RNG_PSEUDO_XORWOW, false, ROCRAND_NORMAL_METHOD_ZIGGURAT },
+    { ROCRAND_RNG_PSEUDO_MRG32K3A, false, ROCRAND_NORMAL_METHOD_BOX_MULLER },
+    { ROCRAND_RNG_PSEUDO_PHILOX4_32_10, true, ROCRAND_NORMAL_METHOD_BOX_MULLER },
+    { ROCRAND_RNG_PSEUDO_PHILOX4_32_10, false, ROCRAND_NORMAL_METHOD_BOX_MULLER },
+    { ROCRAND_RNG_PSEUDO_THREEFRY2_64_20, false, ROCRAND_NORMAL_METHOD_BOX_MULLER },
+    { ROCRAND_RNG_PSEUDO_MTGP32, false, ROCRAND_NORMAL_METHOD_BOX_MULLER }
+};
+
+class rocrand_generate_2d_tests : public ::testing::TestWithParam<generate_2d_test_params> { };
+
+void create_generator(const generate_2d_test_params& params, rocrand_generator& generator)
+{
+    ROCRAND_CHECK(rocrand_create_generator(&generator, params.rng_type));
+    if(params.stateless)
+    {
+        ROCRAND_CHECK(rocrand_set_stateless(generator, 1));
+    }
+    if(params.normal_method != ROCRAND_NORMAL_METHOD_BOX_MULLER)
+    {
+        ROCRAND_CHECK(rocrand_set_normal_method(generator, params.normal_method));
+    }
+    ROCRAND_CHECK(rocrand_set_seed(generator, 13579ULL));
+}
+
+// Rows get the same values as consecutive calls of the 1D function,
+// padding is not modified
+template<class T, class Generate2D, class Generate>
+void test_2d(const generate_2d_test_params& params,
+             const size_t width, const size_t height, const size_t pitch,
+             Generate2D generate_2d, Generate generate)
+{
+    const size_t size = pitch * height;
+    T * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(T)));
+
+    rocrand_generator generator;
+    create_generator(params, generator);
+    HIP_CHECK(hipMemset(data, 0, size * sizeof(T)));
+    ROCRAND_CHECK(generate_2d(generator, data, pitch * sizeof(T), width, height));
+    HIP_CHECK(hipDeviceSynchronize());
+    std::vector<T> output(size);
+    HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(T), hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    create_generator(params, generator);
+    HIP_CHECK(hipMemset(data, 0, size * sizeof(T)));
+    for(size_t row = 0; row < height; row++)
+    {
+        ROCRAND_CHECK(generate(generator, data + row * pitch, width));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+    std::vector<T> expected(size);
+    HIP_CHECK(hipMemcpy(expected.data(), data, size * sizeof(T), hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(data));
+
+    ASSERT_EQ(output, expected);
+}
+
+// Aligned pitch (hipMallocPitch()), pitch with misaligned rows and a pitch
+// equal to the width
+const size_t sizes_2d[][3] = {
+    { 1000, 37, 1024 },
+    { 333, 100, 335 },
+    { 5, 21, 5 }
+};
+
+TEST_P(rocrand_generate_2d_tests, uniform_float_test)
+{
+    for(const auto& s : sizes_2d)
+    {
+        test_2d<float>(
+            GetParam(), s[0], s[1], s[2],
+            rocrand_generate_uniform_2d, rocrand_generate_uniform
+        );
+    }
+}
+
+TEST_P(rocrand_generate_2d_tests, uniform_double_test)
+{
+    for(const auto& s : sizes_2d)
+    {
+        test_2d<double>(
+            GetParam(), s[0], s[1], s[2],
+            rocrand_generate_uniform_double_2d, rocrand_generate_uniform_double
+        );
+    }
+}
+
+TEST_P(rocrand_generate_2d_tests, normal_float_test)
+{
+    for(const auto& s : sizes_2d)
+    {
+        test_2d<float>(
+            GetParam(), s[0], s[1], s[2],
+            [](rocrand_generator g, float * d, size_t pitch, size_t width, size_t height)
+            {
+                return rocrand_generate_normal_2d(g, d, pitch, width, height, 2.0f, 3.0f);
+            },
+            [](rocrand_generator g, float * d, size_t n)
+            {
+                return rocrand_generate_normal(g, d, n, 2.0f, 3.0f);
+            }
+        );
+    }
+}
+
+TEST_P(rocrand_generate_2d_tests, normal_double_test)
+{
+    for(const auto& s : sizes_2d)
+    {
+        test_2d<double>(
+            GetParam(), s[0], s[1], s[2],
+            [](rocrand_generator g, double * d, size_t pitch, size_t width, size_t height)
+            {
+                return rocrand_generate_normal_double_2d(g, d, pitch, width, height, 2.0, 3.0);
+            },
+            [](rocrand_generator g, double * d, size_t n)
+            {
+                return rocrand_generate_normal_double(g, d, n, 2.0, 3.0);
+            }
+        );
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_2d_tests,
+                        rocrand_generate_2d_tests,
+                        ::testing::ValuesIn(generate_2d_params));
+
+TEST(rocrand_generate_2d_neg_tests, neg_test)
+{
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, 100 * sizeof(float)));
+
+    EXPECT_EQ(
+        rocrand_generate_uniform_2d(NULL, data, 40, 10, 10),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    // Rows overlap
+    EXPECT_EQ(
+        rocrand_generate_uniform_2d(generator, data, 36, 10, 10),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    // Rows are not aligned
+    EXPECT_EQ(
+        rocrand_generate_normal_2d(generator, data, 42, 10, 2, 0.0f, 1.0f),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_generate_uniform_2d(generator, data, 40, 10, 0));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(data));
+}
@@ -0,0 +1,240 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+#include <hip/hip_runtime.h>
+#include <rocrand_kernel.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+// The i-th output is the first value of the subsequence keys[i]
+template<class GeneratorState>
+__global__
+void rocrand_at_kernel(const unsigned long long * keys,
+                       unsigned int * output,
+                       const size_t n,
+                       const unsigned long long seed)
+{
+    const unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(index < n)
+    {
+        GeneratorState state;
+        rocrand_init(seed, keys[index], 0, &state);
+        output[index] = rocrand(&state);
+    }
+}
+
+std::vector<unsigned long long> test_keys(const size_t n)
+{
+    std::vector<unsigned long long> keys(n);
+    for(size_t i = 0; i < n; i++)
+    {
+        // Particle i * 7 at time step i % 13, and some very large keys
+        keys[i] = (i % 100 == 99)
+            ? ~0ULL - i
+            : ((i * 7) << 20) | (i % 13);
+    }
+    return keys;
+}
+
+template<class T>
+void generate_at(rocrand_generator generator,
+                 const std::vector<unsigned long long>& keys,
+                 std::vector<T>& output,
+                 rocrand_status (*generate)(rocrand_generator, const unsigned long long *, T *, size_t))
+{
+    const size_t n = keys.size();
+    unsigned long long * d_keys;
+    T * d_output;
+    HIP_CHECK(hipMalloc((void **)&d_keys, n * sizeof(unsigned long long)));
+    HIP_CHECK(hipMalloc((void **)&d_output, n * sizeof(T)));
+    HIP_CHECK(hipMemcpy(d_keys, keys.data(), n * sizeof(unsigned long long), hipMemcpyHostToDevice));
+    ROCRAND_CHECK(generate(generator, d_keys, d_output, n));
+    HIP_CHECK(hipDeviceSynchronize());
+    output.resize(n);
+    HIP_CHECK(hipMemcpy(output.data(), d_output, n * sizeof(T), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(d_keys));
+    HIP_CHECK(hipFree(d_output));
+}
+
+// Values are equal to the values of device states initialized with
+// rocrand_init(seed, keys[i], 0) and do not depend on the offset or previous
+// generation, host generators give the same values
+template<class GeneratorState>
+void generate_at_test(const rocrand_rng_type rng_type)
+{
+    const unsigned long long seed = 0xdeadbeefbeefdeadULL;
+    const size_t n = 12345;
+    const std::vector<unsigned long long> keys = test_keys(n);
+
+    unsigned long long * d_keys;
+    unsigned int * d_expected;
+    HIP_CHECK(hipMalloc((void **)&d_keys, n * sizeof(unsigned long long)));
+    HIP_CHECK(hipMalloc((void **)&d_expected, n * sizeof(unsigned int)));
+    HIP_CHECK(hipMemcpy(d_keys, keys.data(), n * sizeof(unsigned long long), hipMemcpyHostToDevice));
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_at_kernel<GeneratorState>),
+        dim3((n + 255) / 256), dim3(256), 0, 0,
+        d_keys, d_expected, n, seed
+    );
+    HIP_CHECK(hipPeekAtLastError());
+    HIP_CHECK(hipDeviceSynchronize());
+    std::vector<unsigned int> expected(n);
+    HIP_CHECK(hipMemcpy(expected.data(), d_expected, n * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(d_keys));
+    HIP_CHECK(hipFree(d_expected));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_seed(generator, seed));
+    ROCRAND_CHECK(rocrand_set_offset(generator, 1000ULL));
+    std::vector<unsigned int> output;
+    generate_at(generator, keys, output, rocrand_generate_at);
+    ASSERT_EQ(output, expected);
+
+    // Generation does not change the following values
+    generate_at(generator, keys, output, rocrand_generate_at);
+    ASSERT_EQ(output, expected);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    std::vector<unsigned int> host_output(n);
+    ROCRAND_CHECK(rocrand_create_generator_host(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_seed(generator, seed));
+    ROCRAND_CHECK(rocrand_generate_at(generator, keys.data(), host_output.data(), n));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    ASSERT_EQ(host_output, expected);
+}
+
+TEST(rocrand_generate_at_tests, philox4x32_10_test)
+{
+    generate_at_test<rocrand_state_philox4x32_10>(ROCRAND_RNG_PSEUDO_PHILOX4_32_10);
+}
+
+TEST(rocrand_generate_at_tests, philox4x32_7_test)
+{
+    generate_at_test<rocrand_state_philox4x32_7>(ROCRAND_RNG_PSEUDO_PHILOX4_32_7);
+}
+
+TEST(rocrand_generate_at_tests, philox4x64_10_test)
+{
+    generate_at_test<rocrand_state_philox4x64_10>(ROCRAND_RNG_PSEUDO_PHILOX4_64_10);
+}
+
+TEST(rocrand_generate_at_tests, threefry2x64_20_test)
+{
+    generate_at_test<rocrand_state_threefry2x64_20>(ROCRAND_RNG_PSEUDO_THREEFRY2_64_20);
+}
+
+TEST(rocrand_generate_at_tests, threefry4x64_20_test)
+{
+    generate_at_test<rocrand_state_threefry4x64_20>(ROCRAND_RNG_PSEUDO_THREEFRY4_64_20);
+}
+
+// Reordering keys reorders values in the same way
+TEST(rocrand_generate_at_tests, order_test)
+{
+    const size_t n = 4096;
+    const std::vector<unsigned long long> keys = test_keys(n);
+    std::vector<unsigned long long> reversed(keys.rbegin(), keys.rend());
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_THREEFRY2_64_20));
+    std::vector<double> output;
+    std::vector<double> reversed_output;
+    generate_at(generator, keys, output, rocrand_generate_uniform_double_at);
+    generate_at(generator, reversed, reversed_output, rocrand_generate_uniform_double_at);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    std::reverse(reversed_output.begin(), reversed_output.end());
+    ASSERT_EQ(output, reversed_output);
+    for(size_t i = 0; i < n; i++)
+    {
+        ASSERT_GT(output[i], 0.0);
+        ASSERT_LE(output[i], 1.0);
+    }
+}
+
+TEST(rocrand_generate_at_tests, normal_test)
+{
+    const size_t n = 1 << 16;
+    std::vector<unsigned long long> keys(n);
+    for(size_t i = 0; i < n; i++)
+    {
+        keys[i] = i * 1000003ULL;
+    }
+
+    unsigned long long * d_keys;
+    float * d_output;
+    HIP_CHECK(hipMalloc((void **)&d_keys, n * sizeof(unsigned long long)));
+    HIP_CHECK(hipMalloc((void **)&d_output, n * sizeof(float)));
+    HIP_CHECK(hipMemcpy(d_keys, keys.data(), n * sizeof(unsigned long long), hipMemcpyHostToDevice));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_generate_normal_at(generator, d_keys, d_output, n, 2.0f, 5.0f));
+    HIP_CHECK(hipDeviceSynchronize());
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    std::vector<float> output(n);
+    HIP_CHECK(hipMemcpy(output.data(), d_output, n * sizeof(float), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(d_keys));
+    HIP_CHECK(hipFree(d_output));
+
+    double mean = 0.0;
+    for(auto v : output)
+    {
+        mean += v;
+    }
+    mean = mean / n;
+    double stddev = 0.0;
+    for(auto v : output)
+    {
+        stddev += (v - mean) * (v - mean);
+    }
+    stddev = std::sqrt(stddev / n);
+    EXPECT_NEAR(mean, 2.0, 0.1);
+    EXPECT_NEAR(stddev, 5.0, 0.1);
+}
+
+TEST(rocrand_generate_at_tests, invalid_test)
+{
+    const unsigned long long key = 5;
+    unsigned int output;
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator_host(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(rocrand_generate_at(generator, NULL, &output, 1), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_generate_at(generator, NULL, NULL, 0));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator_host(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(rocrand_generate_at(generator, &key, &output, 1), ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    EXPECT_EQ(rocrand_generate_at(NULL, &key, &output, 1), ROCRAND_STATUS_NOT_CREATED);
+}
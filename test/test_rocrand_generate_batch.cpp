@@ -0,0 +1,185 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <cstring>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+struct batch_test_params
+{
+    rocrand_rng_type rng_type;
+    rocrand_normal_method normal_method;
+};
+
+const batch_test_params batch_params[] = {
+    { ROCRAND_RNG_PSEUDO_XORWOW, ROCRAND_NORMAL_METHOD_BOX_MULLER },
+    { ROCRAND_RNG_PSEUDO_XORWOW, ROCRAND_NORMAL_METHOD_ZIGGURAT },
+    { ROCRAND_RNG_PSEUDO_MRG32K3A, ROCRAND_NORMAL_METHOD_BOX_MULLER },
+    { ROCRAND_RNG_PSEUDO_MRG32K3A, ROCRAND_NORMAL_METHOD_ZIGGURAT }
+};
+
+class rocrand_generate_batch_tests : public ::testing::TestWithParam<batch_test_params> { };
+
+// Requests of 60 buffers of different distributions, sizes and alignments
+// (more than one launch): the batch generates the same values as
+// consecutive calls, and the next values are the same too
+TEST_P(rocrand_generate_batch_tests, sequential_test)
+{
+    const batch_test_params params = GetParam();
+    const size_t requests_count = 60;
+
+    std::vector<rocrand_batch_request> requests(requests_count);
+    std::vector<size_t> offsets(requests_count + 1, 0);
+    for(size_t i = 0; i < requests_count; i++)
+    {
+        rocrand_batch_request& request = requests[i];
+        request.distribution = static_cast<rocrand_batch_distribution>(i % 5);
+        request.n = 100 + 37 * i;
+        request.parameters[0] = request.distribution == ROCRAND_BATCH_POISSON
+            ? (i % 2 == 0 ? 5000.0 : 1.0 + i)
+            : 0.5 * i;
+        request.parameters[1] = 1.0 + 0.25 * i;
+        // Odd offsets of 8-byte values make outputs misaligned
+        offsets[i + 1] = offsets[i] + request.n + 1;
+    }
+
+    double * data;
+    HIP_CHECK(hipMalloc((void **)&data, offsets[requests_count] * sizeof(double)));
+    for(size_t i = 0; i < requests_count; i++)
+    {
+        requests[i].output_data = data + offsets[i] + i % 2;
+    }
+
+    std::vector<std::vector<char> > outputs(2);
+    for(int batch = 0; batch < 2; batch++)
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, params.rng_type));
+        ROCRAND_CHECK(rocrand_set_normal_method(generator, params.normal_method));
+        ROCRAND_CHECK(rocrand_set_seed(generator, 1234ULL));
+        HIP_CHECK(hipMemset(data, 0, offsets[requests_count] * sizeof(double)));
+
+        if(batch == 1)
+        {
+            ROCRAND_CHECK(rocrand_generate_batch(generator, requests.data(), requests_count));
+        }
+        else
+        {
+            for(const rocrand_batch_request& request : requests)
+            {
+                const double mean = request.parameters[0];
+                const double stddev = request.parameters[1];
+                switch(request.distribution)
+                {
+                    case ROCRAND_BATCH_UNIFORM:
+                        ROCRAND_CHECK(rocrand_generate_uniform(
+                            generator, static_cast<float *>(request.output_data), request.n
+                        ));
+                        break;
+                    case ROCRAND_BATCH_UNIFORM_DOUBLE:
+                        ROCRAND_CHECK(rocrand_generate_uniform_double(
+                            generator, static_cast<double *>(request.output_data), request.n
+                        ));
+                        break;
+                    case ROCRAND_BATCH_NORMAL:
+                        ROCRAND_CHECK(rocrand_generate_normal(
+                            generator, static_cast<float *>(request.output_data), request.n,
+                            static_cast<float>(mean), static_cast<float>(stddev)
+                        ));
+                        break;
+                    case ROCRAND_BATCH_NORMAL_DOUBLE:
+                        ROCRAND_CHECK(rocrand_generate_normal_double(
+                            generator, static_cast<double *>(request.output_data), request.n,
+                            mean, stddev
+                        ));
+                        break;
+                    case ROCRAND_BATCH_POISSON:
+                        ROCRAND_CHECK(rocrand_generate_poisson(
+                            generator, static_cast<unsigned int *>(request.output_data), request.n,
+                            request.parameters[0]
+                        ));
+                        break;
+                }
+            }
+        }
+        // Engines are in the same states
+        ROCRAND_CHECK(rocrand_generate_uniform_double(generator, data, 1000));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        outputs[batch].resize(offsets[requests_count] * sizeof(double));
+        HIP_CHECK(
+            hipMemcpy(
+                outputs[batch].data(), data,
+                outputs[batch].size(),
+                hipMemcpyDeviceToHost
+            )
+        );
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+    HIP_CHECK(hipFree(data));
+
+    ASSERT_TRUE(outputs[0] == outputs[1]);
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_batch_tests,
+                        rocrand_generate_batch_tests,
+                        ::testing::ValuesIn(batch_params));
+
+TEST(rocrand_generate_batch_neg_tests, neg_test)
+{
+    rocrand_batch_request request;
+    request.distribution = ROCRAND_BATCH_POISSON;
+    request.output_data = NULL;
+    request.n = 0;
+    request.parameters[0] = 10.0;
+    request.parameters[1] = 0.0;
+
+    EXPECT_EQ(rocrand_generate_batch(NULL, &request, 1), ROCRAND_STATUS_NOT_CREATED);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(rocrand_generate_batch(generator, NULL, 1), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_generate_batch(generator, &request, 1), ROCRAND_STATUS_SUCCESS);
+
+    request.n = 10;
+    EXPECT_EQ(rocrand_generate_batch(generator, &request, 1), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, 10 * sizeof(unsigned int)));
+    request.output_data = data;
+    request.parameters[0] = 0.0;
+    EXPECT_EQ(rocrand_generate_batch(generator, &request, 1), ROCRAND_STATUS_OUT_OF_RANGE);
+    request.parameters[0] = 10.0;
+    request.distribution = static_cast<rocrand_batch_distribution>(100);
+    EXPECT_EQ(rocrand_generate_batch(generator, &request, 1), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    request.distribution = ROCRAND_BATCH_UNIFORM;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(rocrand_generate_batch(generator, &request, 1), ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(data));
+}
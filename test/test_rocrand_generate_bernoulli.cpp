@@ -0,0 +1,163 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <vector>
+#include <cmath>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+const rocrand_rng_type bernoulli_rng_types[] = {
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
+    ROCRAND_RNG_PSEUDO_THREEFRY2_64_20,
+    ROCRAND_RNG_PSEUDO_THREEFRY4_64_20,
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_7,
+    ROCRAND_RNG_PSEUDO_MRG32K3A,
+    ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_XOSHIRO128PP,
+    ROCRAND_RNG_PSEUDO_PCG32,
+    ROCRAND_RNG_PSEUDO_MTGP32
+};
+
+class rocrand_generate_bernoulli_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+rocrand_status generate_bernoulli(rocrand_generator generator, unsigned int * data, size_t n,
+                                  double p)
+{
+    return rocrand_generate_bernoulli(generator, data, n, p);
+}
+
+rocrand_status generate_bernoulli(rocrand_generator generator, unsigned char * data, size_t n,
+                                  double p)
+{
+    return rocrand_generate_bernoulli_char(generator, data, n, p);
+}
+
+template<class T>
+void generate(const rocrand_rng_type rng_type, const double p, std::vector<T>& output)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t size = output.size();
+    T * data;
+    HIP_CHECK(hipMalloc((void **)&data, (size + 1) * sizeof(T)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Any sizes and alignment
+    ROCRAND_CHECK(generate_bernoulli(generator, data, 3, p));
+    ROCRAND_CHECK(generate_bernoulli(generator, data + 1, size, p));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    HIP_CHECK(
+        hipMemcpy(
+            output.data(), data + 1,
+            size * sizeof(T),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+// p is rounded to a multiple of 1/256
+const double ps[] = { 0.0, 0.1, 0.5, 0.75, 1.0 };
+
+TEST_P(rocrand_generate_bernoulli_tests, bits_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    for(const double p : ps)
+    {
+        SCOPED_TRACE(testing::Message() << "with p = " << p);
+        std::vector<unsigned int> output(12345);
+        generate(rng_type, p, output);
+
+        const double expected = std::round(p * 256.0) / 256.0;
+        // Every bit position has the same probability
+        for(unsigned int k = 0; k < 32; k++)
+        {
+            double ones = 0;
+            for(auto v : output)
+            {
+                ones += (v >> k) & 1;
+            }
+            EXPECT_NEAR(ones / output.size(), expected, 0.025);
+        }
+    }
+}
+
+TEST_P(rocrand_generate_bernoulli_tests, bytes_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    for(const double p : ps)
+    {
+        SCOPED_TRACE(testing::Message() << "with p = " << p);
+        std::vector<unsigned char> output(123457);
+        generate(rng_type, p, output);
+
+        double ones = 0;
+        for(auto v : output)
+        {
+            ASSERT_LE(v, 1);
+            ones += v;
+        }
+        EXPECT_NEAR(ones / output.size(), std::round(p * 256.0) / 256.0, 0.01);
+    }
+}
+
+TEST(rocrand_generate_bernoulli_tests, neg_test)
+{
+    const size_t size = 256;
+    unsigned int * data = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_bernoulli(generator, data, size, 0.5),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(
+        rocrand_generate_bernoulli(generator, data, size, -0.5),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_bernoulli_char(generator, NULL, size, 1.5),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL32));
+    EXPECT_EQ(
+        rocrand_generate_bernoulli(generator, data, size, 0.5),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_bernoulli_tests,
+                        rocrand_generate_bernoulli_tests,
+                        ::testing::ValuesIn(bernoulli_rng_types));
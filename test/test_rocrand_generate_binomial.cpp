@@ -0,0 +1,236 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+class rocrand_generate_binomial_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+// Binomial and multinomial distributions are implemented by generators
+// with rejection kernels
+bool supports_binomial(const rocrand_rng_type rng_type)
+{
+    return rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        || rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10
+        || rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20
+        || rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20
+        || rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7
+        || rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A
+        || rng_type == ROCRAND_RNG_PSEUDO_XORWOW
+        || rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP
+        || rng_type == ROCRAND_RNG_PSEUDO_PCG32;
+}
+
+TEST_P(rocrand_generate_binomial_tests, uint_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t size = 1 << 18;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    if(!supports_binomial(rng_type))
+    {
+        EXPECT_EQ(
+            rocrand_generate_binomial(generator, data, size, 10, 0.5),
+            ROCRAND_STATUS_TYPE_ERROR
+        );
+        HIP_CHECK(hipFree(data));
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+        return;
+    }
+
+    // Small n * p use inversion, large ones BTRS
+    const unsigned int trials[] = { 10, 100, 1000, 123456 };
+    const double ps[] = { 0.3, 0.05, 0.9, 0.5 };
+    for(size_t t = 0; t < 4; t++)
+    {
+        const unsigned int n = trials[t];
+        const double p = ps[t];
+        SCOPED_TRACE(testing::Message() << "with n = " << n << ", p = " << p);
+
+        ROCRAND_CHECK(rocrand_generate_binomial(generator, data, size, n, p));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<unsigned int> output(size);
+        HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+
+        double mean = 0.0;
+        for(auto v : output)
+        {
+            ASSERT_LE(v, n);
+            mean += static_cast<double>(v);
+        }
+        mean = mean / size;
+
+        double variance = 0.0;
+        for(auto v : output)
+        {
+            variance += std::pow(static_cast<double>(v) - mean, 2);
+        }
+        variance = variance / size;
+
+        EXPECT_NEAR(mean, n * p, std::max(0.01, n * p * 1e-2));
+        EXPECT_NEAR(variance, n * p * (1.0 - p), n * p * (1.0 - p) * 5e-2);
+    }
+
+    EXPECT_EQ(
+        rocrand_generate_binomial(generator, data, size, 10, 1.5),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generate_binomial_tests, array_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    if(!supports_binomial(rng_type))
+    {
+        return;
+    }
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const unsigned int trial_values[] = { 0, 7, 50, 2000 };
+    const double p_values[] = { 0.5, 0.99, 0.25, 0.01 };
+    const size_t params_count = 4;
+    const size_t size = params_count * 40000;
+    std::vector<unsigned int> trials_host(size);
+    std::vector<double> ps_host(size);
+    for(size_t i = 0; i < size; i++)
+    {
+        trials_host[i] = trial_values[i % params_count];
+        ps_host[i] = p_values[i % params_count];
+    }
+
+    unsigned int * data;
+    unsigned int * trials;
+    double * ps;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&trials, size * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&ps, size * sizeof(double)));
+    HIP_CHECK(hipMemcpy(trials, trials_host.data(), size * sizeof(unsigned int), hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemcpy(ps, ps_host.data(), size * sizeof(double), hipMemcpyHostToDevice));
+
+    ROCRAND_CHECK(rocrand_generate_binomial_array(generator, data, trials, ps, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> output(size);
+    HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+
+    for(size_t t = 0; t < params_count; t++)
+    {
+        const double np = trial_values[t] * p_values[t];
+        SCOPED_TRACE(testing::Message() << "with n * p = " << np);
+
+        double mean = 0.0;
+        for(size_t i = t; i < size; i += params_count)
+        {
+            ASSERT_LE(output[i], trial_values[t]);
+            mean += static_cast<double>(output[i]);
+        }
+        mean = mean / (size / params_count);
+        EXPECT_NEAR(mean, np, std::max(0.05, np * 1e-2));
+    }
+
+    EXPECT_EQ(
+        rocrand_generate_binomial_array(generator, data, NULL, ps, size),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(trials));
+    HIP_CHECK(hipFree(ps));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+// Counts of every vector sum to the number of trials
+TEST_P(rocrand_generate_binomial_tests, multinomial_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    if(!supports_binomial(rng_type))
+    {
+        return;
+    }
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const unsigned int n = 500;
+    const double weights_host[] = { 2.0, 0.5, 0.0, 7.5 };
+    const unsigned int categories = 4;
+    const size_t size = 50000;
+
+    unsigned int * data;
+    double * weights;
+    HIP_CHECK(hipMalloc((void **)&data, size * categories * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&weights, categories * sizeof(double)));
+    HIP_CHECK(hipMemcpy(weights, weights_host, categories * sizeof(double), hipMemcpyHostToDevice));
+
+    ROCRAND_CHECK(rocrand_generate_multinomial(generator, data, size, n, weights, categories));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> output(size * categories);
+    HIP_CHECK(hipMemcpy(output.data(), data, output.size() * sizeof(unsigned int), hipMemcpyDeviceToHost));
+
+    std::vector<double> means(categories, 0.0);
+    for(size_t i = 0; i < size; i++)
+    {
+        unsigned int sum = 0;
+        for(unsigned int c = 0; c < categories; c++)
+        {
+            sum += output[c * size + i];
+            means[c] += output[c * size + i];
+        }
+        ASSERT_EQ(sum, n);
+    }
+    for(unsigned int c = 0; c < categories; c++)
+    {
+        EXPECT_NEAR(means[c] / size, n * weights_host[c] / 10.0, 0.5);
+    }
+
+    EXPECT_EQ(
+        rocrand_generate_multinomial(generator, data, size, n, weights, 0),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(weights));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_binomial_tests,
+                        rocrand_generate_binomial_tests,
+                        ::testing::ValuesIn(rng_types));
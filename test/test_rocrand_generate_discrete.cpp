@@ -0,0 +1,330 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <vector>
+#include <cmath>
+#include <limits>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+class rocrand_generate_discrete_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+// Probabilities of values are proportional to ((value - offset) % 10)
+void create_distribution(rocrand_discrete_distribution * discrete_distribution,
+                         const unsigned int size, const unsigned int offset)
+{
+    std::vector<double> probabilities(size);
+    for(unsigned int i = 0; i < size; i++)
+    {
+        probabilities[i] = (i % 10) * 0.25;
+    }
+    ROCRAND_CHECK(
+        rocrand_create_discrete_distribution(
+            probabilities.data(), size, offset, discrete_distribution
+        )
+    );
+}
+
+void check_histogram(const std::vector<unsigned int>& output,
+                     const unsigned int size, const unsigned int offset)
+{
+    std::vector<double> histogram(10, 0.0);
+    for(auto v : output)
+    {
+        ASSERT_GE(v, offset);
+        ASSERT_LT(v, offset + size);
+        histogram[(v - offset) % 10] += 1.0;
+    }
+    for(unsigned int r = 0; r < 10; r++)
+    {
+        EXPECT_NEAR(histogram[r] / output.size(), r / 45.0, 0.01);
+    }
+}
+
+void generate_discrete(const rocrand_rng_type rng_type,
+                       const unsigned int distribution_size,
+                       const unsigned int offset)
+{
+    rocrand_discrete_distribution discrete_distribution;
+    create_distribution(&discrete_distribution, distribution_size, offset);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            rng_type
+        )
+    );
+
+    const size_t size = 1 << 18;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_discrete(generator, data, size, discrete_distribution)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> output(size);
+    HIP_CHECK(
+        hipMemcpy(
+            output.data(), data,
+            size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    ROCRAND_CHECK(rocrand_destroy_discrete_distribution(discrete_distribution));
+
+    check_histogram(output, distribution_size, offset);
+}
+
+// Small tables are loaded to shared memory by pseudo-random generators
+TEST_P(rocrand_generate_discrete_tests, uint_test)
+{
+    generate_discrete(GetParam(), 1000, 10);
+}
+
+TEST_P(rocrand_generate_discrete_tests, large_table_test)
+{
+    generate_discrete(GetParam(), 123450, 0);
+}
+
+// Most values are almost impossible, so many CDF values are in one interval
+// of the guide table used by quasi-random generators
+TEST_P(rocrand_generate_discrete_tests, skewed_table_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    const unsigned int distribution_size = 5000;
+    const unsigned int offset = 7;
+    std::vector<double> probabilities(distribution_size, 1e-9);
+    for(unsigned int i = 0; i < 10; i++)
+    {
+        probabilities[i * 499] = 1.0;
+    }
+    rocrand_discrete_distribution discrete_distribution;
+    ROCRAND_CHECK(
+        rocrand_create_discrete_distribution(
+            probabilities.data(), distribution_size, offset, &discrete_distribution
+        )
+    );
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t size = 1 << 18;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    ROCRAND_CHECK(
+        rocrand_generate_discrete(generator, data, size, discrete_distribution)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> output(size);
+    HIP_CHECK(
+        hipMemcpy(
+            output.data(), data,
+            size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    ROCRAND_CHECK(rocrand_destroy_discrete_distribution(discrete_distribution));
+
+    std::vector<double> histogram(10, 0.0);
+    size_t others = 0;
+    for(auto v : output)
+    {
+        ASSERT_GE(v, offset);
+        ASSERT_LT(v, offset + distribution_size);
+        if((v - offset) % 499 == 0 && (v - offset) / 499 < 10)
+        {
+            histogram[(v - offset) / 499] += 1.0;
+        }
+        else
+        {
+            others++;
+        }
+    }
+    EXPECT_LE(others, 2U);
+    for(unsigned int i = 0; i < 10; i++)
+    {
+        EXPECT_NEAR(histogram[i] / size, 0.1, 0.01);
+    }
+}
+
+TEST_P(rocrand_generate_discrete_tests, host_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    const unsigned int distribution_size = 1000;
+    const unsigned int offset = 10;
+    rocrand_discrete_distribution discrete_distribution;
+    create_distribution(&discrete_distribution, distribution_size, offset);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator_host(
+            &generator,
+            rng_type
+        )
+    );
+
+    const size_t size = 1 << 18;
+    std::vector<unsigned int> output(size);
+    ROCRAND_CHECK(
+        rocrand_generate_discrete(generator, output.data(), size, discrete_distribution)
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    ROCRAND_CHECK(rocrand_destroy_discrete_distribution(discrete_distribution));
+
+    check_histogram(output, distribution_size, offset);
+}
+
+// Poisson histograms can also be used
+TEST_P(rocrand_generate_discrete_tests, poisson_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    const double lambda = 25.0;
+    rocrand_discrete_distribution discrete_distribution;
+    ROCRAND_CHECK(rocrand_create_poisson_distribution(lambda, &discrete_distribution));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            rng_type
+        )
+    );
+
+    const size_t size = 1 << 18;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_discrete(generator, data, size, discrete_distribution)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> output(size);
+    HIP_CHECK(
+        hipMemcpy(
+            output.data(), data,
+            size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    ROCRAND_CHECK(rocrand_destroy_discrete_distribution(discrete_distribution));
+
+    double mean = 0.0;
+    for(auto v : output)
+    {
+        mean += static_cast<double>(v);
+    }
+    mean = mean / size;
+
+    double variance = 0.0;
+    for(auto v : output)
+    {
+        variance += std::pow(static_cast<double>(v) - mean, 2);
+    }
+    variance = variance / size;
+
+    EXPECT_NEAR(mean, lambda, lambda * 1e-2);
+    EXPECT_NEAR(variance, lambda, lambda * 5e-2);
+}
+
+TEST_P(rocrand_generate_discrete_tests, neg_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            rng_type
+        )
+    );
+
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, 128 * sizeof(unsigned int)));
+
+    EXPECT_EQ(
+        rocrand_generate_discrete(generator, data, 128, NULL),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_discrete_tests,
+                        rocrand_generate_discrete_tests,
+                        ::testing::ValuesIn(rng_types));
+
+TEST(rocrand_discrete_distribution_neg_tests, probabilities_test)
+{
+    const std::vector<std::vector<double>> invalid_probabilities = {
+        { 0.5, -0.1, 0.6 },
+        { 0.0, 0.0, 0.0, 0.0 },
+        { 1.0, std::numeric_limits<double>::quiet_NaN(), 1.0 }
+    };
+
+    for(const std::vector<double>& probabilities : invalid_probabilities)
+    {
+        const unsigned int size = static_cast<unsigned int>(probabilities.size());
+        rocrand_discrete_distribution discrete_distribution;
+        EXPECT_EQ(
+            rocrand_create_discrete_distribution(
+                probabilities.data(), size, 0, &discrete_distribution
+            ),
+            ROCRAND_STATUS_OUT_OF_RANGE
+        );
+
+        double * d_probabilities;
+        HIP_CHECK(hipMalloc((void **)&d_probabilities, size * sizeof(double)));
+        HIP_CHECK(
+            hipMemcpy(
+                d_probabilities, probabilities.data(),
+                size * sizeof(double),
+                hipMemcpyHostToDevice
+            )
+        );
+        EXPECT_EQ(
+            rocrand_create_discrete_distribution_device(
+                d_probabilities, size, 0, &discrete_distribution
+            ),
+            ROCRAND_STATUS_OUT_OF_RANGE
+        );
+        HIP_CHECK(hipFree(d_probabilities));
+    }
+}
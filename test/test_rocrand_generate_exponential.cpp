@@ -0,0 +1,127 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+class rocrand_generate_exponential_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+rocrand_status generate_exponential(rocrand_generator generator, float * data, size_t n,
+                                    float lambda)
+{
+    return rocrand_generate_exponential(generator, data, n, lambda);
+}
+
+rocrand_status generate_exponential(rocrand_generator generator, double * data, size_t n,
+                                    double lambda)
+{
+    return rocrand_generate_exponential_double(generator, data, n, lambda);
+}
+
+template<class T>
+void exponential_test(const rocrand_rng_type rng_type)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t size = 1 << 18;
+    const T lambda = 4;
+    T * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(T)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Any sizes and alignment
+    ROCRAND_CHECK(generate_exponential(generator, data, 1, lambda));
+    ROCRAND_CHECK(generate_exponential(generator, data + 1, 2, lambda));
+    ROCRAND_CHECK(generate_exponential(generator, data, size, lambda));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<T> output(size);
+    HIP_CHECK(
+        hipMemcpy(
+            output.data(), data,
+            size * sizeof(T),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    double mean = 0;
+    for(auto v : output)
+    {
+        ASSERT_GE(v, T(0));
+        mean += static_cast<double>(v);
+    }
+    mean = mean / size;
+
+    double variance = 0;
+    for(auto v : output)
+    {
+        const double d = static_cast<double>(v) - mean;
+        variance += d * d;
+    }
+    variance = variance / size;
+
+    EXPECT_NEAR(mean, 1.0 / lambda, 0.01 / lambda);
+    EXPECT_NEAR(variance, 1.0 / (lambda * lambda), 0.05 / (lambda * lambda));
+}
+
+TEST_P(rocrand_generate_exponential_tests, float_test)
+{
+    exponential_test<float>(GetParam());
+}
+
+TEST_P(rocrand_generate_exponential_tests, double_test)
+{
+    exponential_test<double>(GetParam());
+}
+
+TEST(rocrand_generate_exponential_tests, neg_test)
+{
+    const size_t size = 256;
+    float * data = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_exponential(generator, data, size, 1.0f),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(
+        rocrand_generate_exponential(generator, data, size, 0.0f),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_exponential_double(generator, NULL, size, -1.0),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_exponential_tests,
+                        rocrand_generate_exponential_tests,
+                        ::testing::ValuesIn(rng_types));
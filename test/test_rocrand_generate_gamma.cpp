@@ -0,0 +1,239 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+// Gamma and beta distributions are sampled with rejection methods
+const rocrand_rng_type gamma_rng_types[] = {
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
+    ROCRAND_RNG_PSEUDO_THREEFRY2_64_20,
+    ROCRAND_RNG_PSEUDO_THREEFRY4_64_20,
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_7,
+    ROCRAND_RNG_PSEUDO_MRG32K3A,
+    ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_XOSHIRO128PP,
+    ROCRAND_RNG_PSEUDO_PCG32
+};
+
+class rocrand_generate_gamma_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+rocrand_status generate_gamma(rocrand_generator generator, float * data, size_t n,
+                              float shape, float scale)
+{
+    return rocrand_generate_gamma(generator, data, n, shape, scale);
+}
+
+rocrand_status generate_gamma(rocrand_generator generator, double * data, size_t n,
+                              double shape, double scale)
+{
+    return rocrand_generate_gamma_double(generator, data, n, shape, scale);
+}
+
+rocrand_status generate_beta(rocrand_generator generator, float * data, size_t n,
+                             float alpha, float beta)
+{
+    return rocrand_generate_beta(generator, data, n, alpha, beta);
+}
+
+rocrand_status generate_beta(rocrand_generator generator, double * data, size_t n,
+                             double alpha, double beta)
+{
+    return rocrand_generate_beta_double(generator, data, n, alpha, beta);
+}
+
+template<class T>
+void check_moments(const std::vector<T>& output, const double mean, const double variance)
+{
+    double actual_mean = 0;
+    for(auto v : output)
+    {
+        ASSERT_GE(v, T(0));
+        actual_mean += static_cast<double>(v);
+    }
+    actual_mean = actual_mean / output.size();
+
+    double actual_variance = 0;
+    for(auto v : output)
+    {
+        const double d = static_cast<double>(v) - actual_mean;
+        actual_variance += d * d;
+    }
+    actual_variance = actual_variance / output.size();
+
+    EXPECT_NEAR(mean, actual_mean, mean * 0.02);
+    EXPECT_NEAR(variance, actual_variance, variance * 0.05);
+}
+
+// Fills output with values generated by generate_function(generator, data, n)
+template<class T, class Generate>
+void generate(const rocrand_rng_type rng_type, Generate generate_function,
+              std::vector<T>& output)
+{
+    const size_t size = output.size();
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    T * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(T)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Any sizes and alignment
+    ROCRAND_CHECK(generate_function(generator, data + 1, 2));
+    ROCRAND_CHECK(generate_function(generator, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    HIP_CHECK(
+        hipMemcpy(
+            output.data(), data,
+            size * sizeof(T),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+template<class T>
+void gamma_test(const rocrand_rng_type rng_type)
+{
+    std::vector<T> output(1 << 18);
+    const T scale = 2;
+    // Shapes < 1 use a different path
+    for(const T shape : { T(0.3), T(1), T(4.5), T(80) })
+    {
+        SCOPED_TRACE(testing::Message() << "with shape = " << shape);
+        generate(
+            rng_type,
+            [=](rocrand_generator generator, T * data, size_t n)
+            {
+                return generate_gamma(generator, data, n, shape, scale);
+            },
+            output
+        );
+        check_moments(output, shape * scale, shape * scale * scale);
+    }
+}
+
+template<class T>
+void beta_test(const rocrand_rng_type rng_type)
+{
+    std::vector<T> output(1 << 18);
+    const T params[][2] = { { T(0.5), T(3) }, { T(2), T(2) }, { T(7), T(1.5) } };
+    for(const auto& p : params)
+    {
+        const double a = p[0];
+        const double b = p[1];
+        SCOPED_TRACE(testing::Message() << "with alpha = " << a << ", beta = " << b);
+        generate(
+            rng_type,
+            [=](rocrand_generator generator, T * data, size_t n)
+            {
+                return generate_beta(generator, data, n, p[0], p[1]);
+            },
+            output
+        );
+        for(auto v : output)
+        {
+            ASSERT_LE(v, T(1));
+        }
+        check_moments(output, a / (a + b), a * b / ((a + b) * (a + b) * (a + b + 1)));
+    }
+}
+
+TEST_P(rocrand_generate_gamma_tests, gamma_float_test)
+{
+    gamma_test<float>(GetParam());
+}
+
+TEST_P(rocrand_generate_gamma_tests, gamma_double_test)
+{
+    gamma_test<double>(GetParam());
+}
+
+TEST_P(rocrand_generate_gamma_tests, beta_float_test)
+{
+    beta_test<float>(GetParam());
+}
+
+TEST_P(rocrand_generate_gamma_tests, beta_double_test)
+{
+    beta_test<double>(GetParam());
+}
+
+TEST(rocrand_generate_gamma_tests, neg_test)
+{
+    const size_t size = 256;
+    float * data = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_gamma(generator, data, size, 1.0f, 1.0f),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+    EXPECT_EQ(
+        rocrand_generate_beta(generator, data, size, 1.0f, 1.0f),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(
+        rocrand_generate_gamma(generator, data, size, 0.0f, 1.0f),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_gamma_double(generator, NULL, size, 1.0, -1.0),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_beta(generator, data, size, 1.0f, 0.0f),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    // Generators without rejection kernels
+    const rocrand_rng_type unsupported_rng_types[] = {
+        ROCRAND_RNG_PSEUDO_MTGP32,
+        ROCRAND_RNG_QUASI_SOBOL32
+    };
+    for(auto rng_type : unsupported_rng_types)
+    {
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+        EXPECT_EQ(
+            rocrand_generate_gamma(generator, data, size, 1.0f, 1.0f),
+            ROCRAND_STATUS_TYPE_ERROR
+        );
+        EXPECT_EQ(
+            rocrand_generate_beta_double(generator, NULL, size, 1.0, 1.0),
+            ROCRAND_STATUS_TYPE_ERROR
+        );
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_gamma_tests,
+                        rocrand_generate_gamma_tests,
+                        ::testing::ValuesIn(gamma_rng_types));
@@ -0,0 +1,166 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+class rocrand_generate_host_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+template<class T, class GenerateFunction>
+void compare_host_device(const rocrand_rng_type rng_type,
+                         const size_t offset, const size_t size,
+                         GenerateFunction generate)
+{
+    rocrand_generator generator;
+    rocrand_generator host_generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_create_generator_host(&host_generator, rng_type));
+
+    T * data;
+    HIP_CHECK(hipMalloc((void **)&data, (offset + size) * sizeof(T)));
+    std::vector<T> host_data(offset + size);
+    std::vector<T> device_data(offset + size);
+
+    // Several calls check that engines are saved with the same states
+    for(int i = 0; i < 3; i++)
+    {
+        ROCRAND_CHECK(generate(generator, data + offset, size));
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(
+            hipMemcpy(
+                device_data.data(), data,
+                (offset + size) * sizeof(T),
+                hipMemcpyDeviceToHost
+            )
+        );
+
+        ROCRAND_CHECK(generate(host_generator, host_data.data() + offset, size));
+
+        for(size_t j = 0; j < size; j++)
+        {
+            ASSERT_EQ(host_data[offset + j], device_data[offset + j]);
+        }
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    ROCRAND_CHECK(rocrand_destroy_generator(host_generator));
+}
+
+TEST_P(rocrand_generate_host_tests, int_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    compare_host_device<unsigned int>(rng_type, 0, 12563, rocrand_generate);
+}
+
+TEST_P(rocrand_generate_host_tests, short_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    // Unaligned output checks saving of head and tail
+    compare_host_device<unsigned short>(rng_type, 1, 12563, rocrand_generate_short);
+}
+
+TEST_P(rocrand_generate_host_tests, long_long_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    // Unaligned output checks saving of head and tail
+    compare_host_device<unsigned long long>(rng_type, 1, 12563, rocrand_generate_long_long);
+}
+
+TEST_P(rocrand_generate_host_tests, char_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    compare_host_device<unsigned char>(rng_type, 3, 12563, rocrand_generate_char);
+}
+
+TEST_P(rocrand_generate_host_tests, uniform_float_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    compare_host_device<float>(rng_type, 0, 1234567, rocrand_generate_uniform);
+}
+
+TEST_P(rocrand_generate_host_tests, poisson_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    compare_host_device<unsigned int>(
+        rng_type, 0, 12563,
+        [](rocrand_generator generator, unsigned int * data, size_t size)
+        {
+            return rocrand_generate_poisson(generator, data, size, 100.0);
+        }
+    );
+}
+
+TEST_P(rocrand_generate_host_tests, normal_float_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    rocrand_generator host_generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_create_generator_host(&host_generator, rng_type));
+
+    const size_t size = 12564;
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(float)));
+    std::vector<float> host_data(size);
+    std::vector<float> device_data(size);
+
+    ROCRAND_CHECK(rocrand_generate_normal(generator, data, size, 5.0f, 2.0f));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipMemcpy(device_data.data(), data, size * sizeof(float), hipMemcpyDeviceToHost));
+
+    ROCRAND_CHECK(rocrand_generate_normal(host_generator, host_data.data(), size, 5.0f, 2.0f));
+
+    // Host and device math functions may have different precision
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_NEAR(host_data[i], device_data[i], 1e-4f * std::abs(device_data[i]) + 1e-4f);
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    ROCRAND_CHECK(rocrand_destroy_generator(host_generator));
+}
+
+TEST(rocrand_generate_host_tests, neg_test)
+{
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_create_generator_host(&generator, static_cast<rocrand_rng_type>(0)),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_host_tests,
+                        rocrand_generate_host_tests,
+                        ::testing::ValuesIn(rng_types));
@@ -0,0 +1,278 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <cmath>
+
+#include <hip/hip_runtime.h>
+#include <rocrand_kernel.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+const unsigned long long seed = 0xdeadbeefbeefdeadULL;
+const unsigned long long matrix_id = 7;
+
+typedef rocrand_status (*generate_matrix_type)(rocrand_generator, unsigned long long,
+                                               float *, size_t,
+                                               unsigned long long, unsigned long long,
+                                               size_t, size_t);
+
+rocrand_status generate_matrix_normal(rocrand_generator generator,
+                                      unsigned long long id,
+                                      float * output_data, size_t pitch,
+                                      unsigned long long row, unsigned long long col,
+                                      size_t width, size_t height)
+{
+    return rocrand_generate_matrix_normal(
+        generator, id, output_data, pitch, row, col, width, height, 0.0f, 1.0f
+    );
+}
+
+// Every thread computes a tile of Rows x Cols entries with the device API,
+// tiles of threads cover height x width entries at (row, col)
+template<unsigned int Rows, unsigned int Cols, unsigned int Distribution>
+__global__
+void matrix_tile_kernel(float * output,
+                        const unsigned int row, const unsigned long long col,
+                        const unsigned int width, const unsigned int height)
+{
+    const unsigned int tiles_per_row = width / Cols;
+    const unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(index >= tiles_per_row * (height / Rows))
+        return;
+    const unsigned int tile_row = index / tiles_per_row * Rows;
+    const unsigned int tile_col = index % tiles_per_row * Cols;
+
+    rocrand_matrix_philox4x32_10 matrix;
+    rocrand_matrix_init(seed, matrix_id, &matrix);
+    float tile[Rows][Cols];
+    if(Distribution == 0)
+        rocrand_matrix_tile_uniform(&matrix, row + tile_row, col + tile_col, tile);
+    else if(Distribution == 1)
+        rocrand_matrix_tile_normal(&matrix, row + tile_row, col + tile_col, tile);
+    else
+        rocrand_matrix_tile_rademacher(&matrix, row + tile_row, col + tile_col, tile);
+    for(unsigned int r = 0; r < Rows; r++)
+    {
+        for(unsigned int c = 0; c < Cols; c++)
+        {
+            output[(tile_row + r) * width + tile_col + c] = tile[r][c];
+        }
+    }
+}
+
+template<unsigned int Distribution>
+void device_tile(const unsigned int row, const unsigned long long col,
+                 const unsigned int width, const unsigned int height,
+                 std::vector<float>& output)
+{
+    constexpr unsigned int rows = 2;
+    constexpr unsigned int cols = 5;
+    const unsigned int tiles = (width / cols) * (height / rows);
+    float * d_output;
+    HIP_CHECK(hipMalloc((void **)&d_output, width * height * sizeof(float)));
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(matrix_tile_kernel<rows, cols, Distribution>),
+        dim3((tiles + 255) / 256), dim3(256), 0, 0,
+        d_output, row, col, width, height
+    );
+    HIP_CHECK(hipPeekAtLastError());
+    output.resize(width * height);
+    HIP_CHECK(hipMemcpy(output.data(), d_output, output.size() * sizeof(float), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(d_output));
+}
+
+// Generates the tile to a pitched buffer and returns it without padding
+void host_api_tile(rocrand_generator generator,
+                   generate_matrix_type generate,
+                   const unsigned long long row, const unsigned long long col,
+                   const size_t width, const size_t height,
+                   std::vector<float>& output,
+                   const bool host_generator = false)
+{
+    const size_t pitch_values = width + 3;
+    std::vector<float> padded(pitch_values * height, -100.0f);
+    float * data = padded.data();
+    if(!host_generator)
+    {
+        HIP_CHECK(hipMalloc((void **)&data, padded.size() * sizeof(float)));
+        HIP_CHECK(hipMemcpy(data, padded.data(), padded.size() * sizeof(float), hipMemcpyHostToDevice));
+    }
+    ROCRAND_CHECK(
+        generate(generator, matrix_id, data, pitch_values * sizeof(float), row, col, width, height)
+    );
+    if(!host_generator)
+    {
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(hipMemcpy(padded.data(), data, padded.size() * sizeof(float), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipFree(data));
+    }
+    output.resize(width * height);
+    for(size_t r = 0; r < height; r++)
+    {
+        for(size_t c = 0; c < pitch_values; c++)
+        {
+            if(c < width)
+                output[r * width + c] = padded[r * pitch_values + c];
+            else
+                EXPECT_EQ(padded[r * pitch_values + c], -100.0f);
+        }
+    }
+}
+
+// Tiles of the host API are equal to entries computed by the device API,
+// and do not depend on the tile position, the offset or previous generation
+template<unsigned int Distribution>
+void tile_test(generate_matrix_type generate)
+{
+    const unsigned int row = 1000;
+    const unsigned long long col = (1ULL << 33) + 1;
+    const unsigned int width = 130;
+    const unsigned int height = 40;
+    std::vector<float> expected;
+    device_tile<Distribution>(row, col, width, height, expected);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(generator, seed));
+    ROCRAND_CHECK(rocrand_set_offset(generator, 12345ULL));
+    std::vector<float> output;
+    host_api_tile(generator, generate, row, col, width, height, output);
+    ASSERT_EQ(output, expected);
+
+    // A sub-tile of unaligned columns
+    std::vector<float> sub_output;
+    host_api_tile(generator, generate, row + 3, col + 6, 17, 5, sub_output);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    for(size_t r = 0; r < 5; r++)
+    {
+        for(size_t c = 0; c < 17; c++)
+        {
+            ASSERT_EQ(sub_output[r * 17 + c], expected[(r + 3) * width + c + 6]);
+        }
+    }
+
+    ROCRAND_CHECK(rocrand_create_generator_host(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(generator, seed));
+    std::vector<float> host_output;
+    host_api_tile(generator, generate, row, col, width, height, host_output, true);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    for(size_t i = 0; i < expected.size(); i++)
+    {
+        ASSERT_NEAR(host_output[i], expected[i], 1e-5f);
+    }
+}
+
+TEST(rocrand_generate_matrix_tests, uniform_test)
+{
+    tile_test<0>(rocrand_generate_matrix_uniform);
+}
+
+TEST(rocrand_generate_matrix_tests, normal_test)
+{
+    tile_test<1>(generate_matrix_normal);
+}
+
+TEST(rocrand_generate_matrix_tests, rademacher_test)
+{
+    tile_test<2>(rocrand_generate_matrix_rademacher);
+}
+
+TEST(rocrand_generate_matrix_tests, distribution_test)
+{
+    const size_t width = 1024;
+    const size_t height = 1024;
+    float * d_output;
+    HIP_CHECK(hipMalloc((void **)&d_output, width * height * sizeof(float)));
+    std::vector<float> output(width * height);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+
+    ROCRAND_CHECK(rocrand_generate_matrix_normal(
+        generator, 0, d_output, width * sizeof(float), 0, 0, width, height, 2.0f, 5.0f
+    ));
+    HIP_CHECK(hipMemcpy(output.data(), d_output, output.size() * sizeof(float), hipMemcpyDeviceToHost));
+    double mean = 0.0;
+    for(float v : output)
+        mean += v;
+    mean /= output.size();
+    double stddev = 0.0;
+    for(float v : output)
+        stddev += (v - mean) * (v - mean);
+    stddev = std::sqrt(stddev / output.size());
+    EXPECT_NEAR(mean, 2.0, 0.05);
+    EXPECT_NEAR(stddev, 5.0, 0.05);
+
+    ROCRAND_CHECK(rocrand_generate_matrix_rademacher(
+        generator, 1, d_output, width * sizeof(float), 0, 0, width, height
+    ));
+    HIP_CHECK(hipMemcpy(output.data(), d_output, output.size() * sizeof(float), hipMemcpyDeviceToHost));
+    mean = 0.0;
+    for(float v : output)
+    {
+        ASSERT_TRUE(v == 1.0f || v == -1.0f);
+        mean += v;
+    }
+    EXPECT_NEAR(mean / output.size(), 0.0, 0.01);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(d_output));
+}
+
+TEST(rocrand_generate_matrix_tests, neg_test)
+{
+    float * d_output;
+    HIP_CHECK(hipMalloc((void **)&d_output, 64 * sizeof(float)));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    // Pitch less than width
+    EXPECT_EQ(
+        rocrand_generate_matrix_uniform(generator, 0, d_output, 4 * sizeof(float), 0, 0, 8, 2),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    // Tiles outside of the matrix
+    EXPECT_EQ(
+        rocrand_generate_matrix_uniform(generator, 0, d_output, 8 * sizeof(float), (1ULL << 32) - 1, 0, 8, 2),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_matrix_uniform(generator, 0, d_output, 8 * sizeof(float), 0, (1ULL << 34) - 4, 8, 2),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_matrix_uniform(generator, 0, d_output, 8 * sizeof(float), 0, (1ULL << 34) - 8, 8, 2),
+        ROCRAND_STATUS_SUCCESS
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(
+        rocrand_generate_matrix_uniform(generator, 0, d_output, 8 * sizeof(float), 0, 0, 8, 2),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(d_output));
+}
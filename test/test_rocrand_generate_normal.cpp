@@ -20,6 +20,9 @@
 
 #include <stdio.h>
 #include <gtest/gtest.h>
+#include <cmath>
+#include <cstring>
+#include <vector>
 
 #include <hip/hip_runtime.h>
 #include <rocrand.h>
@@ -148,6 +151,122 @@ TEST_P(rocrand_generate_normal_tests, half_test)
     ROCRAND_CHECK(rocrand_destroy_generator(generator));
 }
 
+TEST_P(rocrand_generate_normal_tests, bfloat16_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t size = 12563;
+    const bfloat16 mean(5.0f);
+    const bfloat16 stddev(2.0f);
+    bfloat16 * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(bfloat16)));
+
+    // Any sizes and alignments
+    ROCRAND_CHECK(rocrand_generate_normal_bfloat16(generator, data, 1, mean, stddev));
+    ROCRAND_CHECK(rocrand_generate_normal_bfloat16(generator, data + 1, 2, mean, stddev));
+    ROCRAND_CHECK(rocrand_generate_normal_bfloat16(generator, data + 3, size - 3, mean, stddev));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned short> output(size);
+    HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(bfloat16), hipMemcpyDeviceToHost));
+    double sum = 0.0;
+    double sum2 = 0.0;
+    for(size_t i = 3; i < size; i++)
+    {
+        const unsigned int bits = static_cast<unsigned int>(output[i]) << 16;
+        float v;
+        std::memcpy(&v, &bits, sizeof(float));
+        sum += v;
+        sum2 += static_cast<double>(v) * v;
+    }
+    const double n = static_cast<double>(size - 3);
+    const double m = sum / n;
+    EXPECT_NEAR(m, 5.0, 0.1);
+    EXPECT_NEAR(std::sqrt(sum2 / n - m * m), 2.0, 0.1);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+// Value of bits of an FP8 value with ExponentBits and MantissaBits (OCP E4M3 or E5M2)
+template<int ExponentBits, int MantissaBits>
+float fp8_to_float(const unsigned char bits)
+{
+    const int bias = (1 << (ExponentBits - 1)) - 1;
+    const int exponent = (bits >> MantissaBits) & ((1 << ExponentBits) - 1);
+    const int mantissa = bits & ((1 << MantissaBits) - 1);
+    const float v = exponent == 0
+        ? std::ldexp(static_cast<float>(mantissa), 1 - bias - MantissaBits)
+        : std::ldexp(1.0f + static_cast<float>(mantissa) / (1 << MantissaBits), exponent - bias);
+    return (bits & 0x80) != 0 ? -v : v;
+}
+
+// Mean and standard deviation of 8-bit values generated by unaligned calls
+// (pseudo-random generators store 16 values at once)
+template<class T, class F>
+void normal_8bit_test(const rocrand_rng_type rng_type,
+                      rocrand_status (*generate)(rocrand_generator, T *, size_t, float, float),
+                      const float mean, const float stddev, F to_float)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t size = 1313;
+    T * data;
+    HIP_CHECK(hipMalloc((void **)&data, (size + 16) * sizeof(T)));
+    HIP_CHECK(hipMemset(data, 0xff, (size + 16) * sizeof(T)));
+    ROCRAND_CHECK(generate(generator, data + 1, 1, mean, stddev));
+    ROCRAND_CHECK(generate(generator, data + 2, 2, mean, stddev));
+    ROCRAND_CHECK(generate(generator, data + 4, size - 4, mean, stddev));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned char> output(size + 16);
+    HIP_CHECK(hipMemcpy(output.data(), data, (size + 16) * sizeof(T), hipMemcpyDeviceToHost));
+    ASSERT_EQ(output[0], 0xff);
+    ASSERT_EQ(output[size], 0xff);
+
+    double sum = 0.0;
+    double sum2 = 0.0;
+    for(size_t i = 1; i < size; i++)
+    {
+        const double v = to_float(output[i]);
+        sum += v;
+        sum2 += v * v;
+    }
+    const double n = static_cast<double>(size - 1);
+    const double m = sum / n;
+    EXPECT_NEAR(m, mean, stddev * 0.1);
+    EXPECT_NEAR(std::sqrt(sum2 / n - m * m), stddev, stddev * 0.1);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generate_normal_tests, int8_test)
+{
+    normal_8bit_test<signed char>(
+        GetParam(), rocrand_generate_normal_int8, 5.0f, 20.0f,
+        [](unsigned char bits) { return static_cast<float>(static_cast<signed char>(bits)); }
+    );
+}
+
+TEST_P(rocrand_generate_normal_tests, fp8_e4m3_test)
+{
+    normal_8bit_test<rocrand_fp8_e4m3>(
+        GetParam(), rocrand_generate_normal_fp8_e4m3, 5.0f, 2.0f, fp8_to_float<4, 3>
+    );
+}
+
+TEST_P(rocrand_generate_normal_tests, fp8_e5m2_test)
+{
+    normal_8bit_test<rocrand_fp8_e5m2>(
+        GetParam(), rocrand_generate_normal_fp8_e5m2, 5.0f, 2.0f, fp8_to_float<5, 2>
+    );
+}
+
 TEST(rocrand_generate_normal_tests, neg_test)
 {
     const size_t size = 256;
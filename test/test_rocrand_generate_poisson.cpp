@@ -20,6 +20,9 @@
 
 #include <stdio.h>
 #include <gtest/gtest.h>
+#include <vector>
+#include <cmath>
+#include <algorithm>
 
 #include <hip/hip_runtime.h>
 #include <rocrand.h>
@@ -54,6 +57,215 @@ TEST_P(rocrand_generate_poisson_tests, uint_test)
     ROCRAND_CHECK(rocrand_destroy_generator(generator));
 }
 
+// Large lambdas use table-free rejection sampling in pseudo-random generators
+TEST_P(rocrand_generate_poisson_tests, large_lambda_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            rng_type
+        )
+    );
+
+    const size_t size = 1 << 18;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    const double lambdas[] = { 5000.0, 123456.7, 4e6 };
+    for(double lambda : lambdas)
+    {
+        SCOPED_TRACE(testing::Message() << "with lambda = " << lambda);
+
+        ROCRAND_CHECK(
+            rocrand_generate_poisson(generator, data, size, lambda)
+        );
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<unsigned int> output(size);
+        HIP_CHECK(
+            hipMemcpy(
+                output.data(), data,
+                size * sizeof(unsigned int),
+                hipMemcpyDeviceToHost
+            )
+        );
+
+        double mean = 0.0;
+        for(auto v : output)
+        {
+            mean += static_cast<double>(v);
+        }
+        mean = mean / size;
+
+        double variance = 0.0;
+        for(auto v : output)
+        {
+            variance += std::pow(static_cast<double>(v) - mean, 2);
+        }
+        variance = variance / size;
+
+        EXPECT_NEAR(mean, lambda, lambda * 1e-3);
+        EXPECT_NEAR(variance, lambda, lambda * 2e-2);
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generate_poisson_tests, array_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            rng_type
+        )
+    );
+
+    // Small lambdas use inversion, large ones rejection
+    const double lambda_values[] = { 0.5, 7.0, 63.5, 64.0, 1000.0, 123456.7 };
+    const size_t lambdas_count = sizeof(lambda_values) / sizeof(lambda_values[0]);
+    const size_t size = lambdas_count * 40000;
+    std::vector<double> lambdas_host(size);
+    for(size_t i = 0; i < size; i++)
+    {
+        lambdas_host[i] = lambda_values[i % lambdas_count];
+    }
+
+    unsigned int * data;
+    double * lambdas;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&lambdas, size * sizeof(double)));
+    HIP_CHECK(
+        hipMemcpy(
+            lambdas, lambdas_host.data(),
+            size * sizeof(double),
+            hipMemcpyHostToDevice
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    if(rng_type != ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        && rng_type != ROCRAND_RNG_PSEUDO_PHILOX4_64_10
+        && rng_type != ROCRAND_RNG_PSEUDO_THREEFRY2_64_20
+        && rng_type != ROCRAND_RNG_PSEUDO_THREEFRY4_64_20
+        && rng_type != ROCRAND_RNG_PSEUDO_PHILOX4_32_7
+        && rng_type != ROCRAND_RNG_PSEUDO_MRG32K3A
+        && rng_type != ROCRAND_RNG_PSEUDO_XORWOW
+        && rng_type != ROCRAND_RNG_PSEUDO_XOSHIRO128PP
+        && rng_type != ROCRAND_RNG_PSEUDO_PCG32)
+    {
+        EXPECT_EQ(
+            rocrand_generate_poisson_array(generator, data, lambdas, size),
+            ROCRAND_STATUS_TYPE_ERROR
+        );
+    }
+    else
+    {
+        ROCRAND_CHECK(
+            rocrand_generate_poisson_array(generator, data, lambdas, size)
+        );
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<unsigned int> output(size);
+        HIP_CHECK(
+            hipMemcpy(
+                output.data(), data,
+                size * sizeof(unsigned int),
+                hipMemcpyDeviceToHost
+            )
+        );
+
+        for(size_t l = 0; l < lambdas_count; l++)
+        {
+            const double lambda = lambda_values[l];
+            SCOPED_TRACE(testing::Message() << "with lambda = " << lambda);
+
+            double mean = 0.0;
+            for(size_t i = l; i < size; i += lambdas_count)
+            {
+                mean += static_cast<double>(output[i]);
+            }
+            mean = mean / (size / lambdas_count);
+
+            double variance = 0.0;
+            for(size_t i = l; i < size; i += lambdas_count)
+            {
+                variance += std::pow(static_cast<double>(output[i]) - mean, 2);
+            }
+            variance = variance / (size / lambdas_count);
+
+            EXPECT_NEAR(mean, lambda, std::max(0.05, lambda * 5e-3));
+            EXPECT_NEAR(variance, lambda, std::max(0.05, lambda * 5e-2));
+        }
+    }
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(lambdas));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+// Cached distributions produce the same values as recomputed ones
+TEST_P(rocrand_generate_poisson_tests, cache_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    rocrand_generator cached_generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_create_generator(&cached_generator, rng_type));
+
+    const double lambdas[] = { 0.5, 12.0, 100.0, 2345.6 };
+    const size_t lambdas_count = sizeof(lambdas) / sizeof(lambdas[0]);
+    ROCRAND_CHECK(rocrand_set_poisson_cache_capacity(cached_generator, lambdas_count));
+    ROCRAND_CHECK(rocrand_prepare_poisson(cached_generator, lambdas, lambdas_count));
+
+    const size_t size = 12800;
+    unsigned int * data;
+    unsigned int * cached_data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&cached_data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> output(size);
+    std::vector<unsigned int> cached_output(size);
+    for(size_t i = 0; i < 3 * lambdas_count; i++)
+    {
+        const double lambda = lambdas[i % lambdas_count];
+        ROCRAND_CHECK(rocrand_generate_poisson(generator, data, size, lambda));
+        ROCRAND_CHECK(rocrand_generate_poisson(cached_generator, cached_data, size, lambda));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(cached_output.data(), cached_data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+        for(size_t j = 0; j < size; j++)
+        {
+            ASSERT_EQ(output[j], cached_output[j]);
+        }
+    }
+
+    EXPECT_EQ(
+        rocrand_set_poisson_cache_capacity(cached_generator, 0),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    const double bad_lambdas[] = { 1.0, 0.0 };
+    EXPECT_EQ(
+        rocrand_prepare_poisson(cached_generator, bad_lambdas, 2),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(cached_data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    ROCRAND_CHECK(rocrand_destroy_generator(cached_generator));
+}
+
 TEST(rocrand_generate_poisson_tests, neg_test)
 {
     const size_t size = 256;
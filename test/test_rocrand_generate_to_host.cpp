@@ -0,0 +1,180 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <cstring>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+struct to_host_test_params
+{
+    rocrand_rng_type rng_type;
+    unsigned int dimensions;
+    rocrand_ordering ordering;
+};
+
+// Generators whose values do not depend on sizes of calls
+const to_host_test_params to_host_params[] = {
+    { ROCRAND_RNG_PSEUDO_PHILOX4_32_10, 1, ROCRAND_ORDERING_QUASI_DEFAULT },
+    { ROCRAND_RNG_PSEUDO_PHILOX4_64_10, 1, ROCRAND_ORDERING_QUASI_DEFAULT },
+    { ROCRAND_RNG_PSEUDO_THREEFRY2_64_20, 1, ROCRAND_ORDERING_QUASI_DEFAULT },
+    { ROCRAND_RNG_QUASI_SOBOL32, 1, ROCRAND_ORDERING_QUASI_DEFAULT },
+    { ROCRAND_RNG_QUASI_SOBOL32, 3, ROCRAND_ORDERING_QUASI_DEFAULT },
+    { ROCRAND_RNG_QUASI_SOBOL32, 3, ROCRAND_ORDERING_QUASI_INTERLEAVED },
+    { ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64, 5, ROCRAND_ORDERING_QUASI_DEFAULT }
+};
+
+class rocrand_generate_to_host_tests : public ::testing::TestWithParam<to_host_test_params> { };
+
+void create_to_host_generator(rocrand_generator& generator, const to_host_test_params& params)
+{
+    ROCRAND_CHECK(rocrand_create_generator(&generator, params.rng_type));
+    if(params.dimensions > 1)
+    {
+        ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(generator, params.dimensions));
+    }
+    if(params.ordering == ROCRAND_ORDERING_QUASI_INTERLEAVED)
+    {
+        ROCRAND_CHECK(rocrand_set_ordering(generator, params.ordering));
+    }
+}
+
+// Values of several chunks (and of the next call) are the same as values
+// generated to device memory
+TEST_P(rocrand_generate_to_host_tests, uniform_double_test)
+{
+    const to_host_test_params params = GetParam();
+    const size_t size = (1234567 + 2 * params.dimensions) / params.dimensions * params.dimensions;
+
+    double * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(double)));
+    std::vector<double> expected(size * 2);
+    rocrand_generator generator;
+    create_to_host_generator(generator, params);
+    for(int i = 0; i < 2; i++)
+    {
+        ROCRAND_CHECK(rocrand_generate_uniform_double(generator, data, size));
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(
+            hipMemcpy(
+                expected.data() + i * size, data,
+                size * sizeof(double),
+                hipMemcpyDeviceToHost
+            )
+        );
+    }
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(data));
+
+    double * output;
+    HIP_CHECK(hipHostMalloc((void **)&output, size * 2 * sizeof(double), 0));
+    create_to_host_generator(generator, params);
+    ROCRAND_CHECK(rocrand_generate_uniform_double_to_host(generator, output, size));
+    ROCRAND_CHECK(rocrand_generate_uniform_double_to_host(generator, output + size, size));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    for(size_t i = 0; i < size * 2; i++)
+    {
+        ASSERT_EQ(output[i], expected[i]) << "at " << i;
+    }
+    HIP_CHECK(hipHostFree(output));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_to_host_tests,
+                        rocrand_generate_to_host_tests,
+                        ::testing::ValuesIn(to_host_params));
+
+// Generators whose values depend on sizes of calls generate values
+// of the distributions to pageable memory too
+TEST(rocrand_generate_to_host_distribution_tests, distribution_test)
+{
+    const rocrand_rng_type size_dependent_types[] = {
+        ROCRAND_RNG_PSEUDO_XORWOW,
+        ROCRAND_RNG_PSEUDO_MRG32K3A,
+        ROCRAND_RNG_PSEUDO_MTGP32
+    };
+    const size_t size = 3456789;
+    std::vector<float> normal(size);
+    std::vector<unsigned int> poisson(size);
+    for(rocrand_rng_type rng_type : size_dependent_types)
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+        ROCRAND_CHECK(rocrand_generate_normal_to_host(generator, normal.data(), size, 3.0f, 2.0f));
+        ROCRAND_CHECK(rocrand_generate_poisson_to_host(generator, poisson.data(), size, 10.0));
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+        double normal_mean = 0.0;
+        double poisson_mean = 0.0;
+        for(size_t i = 0; i < size; i++)
+        {
+            normal_mean += normal[i];
+            poisson_mean += poisson[i];
+        }
+        EXPECT_NEAR(normal_mean / size, 3.0, 0.05);
+        EXPECT_NEAR(poisson_mean / size, 10.0, 0.05);
+    }
+}
+
+TEST(rocrand_generate_to_host_neg_tests, neg_test)
+{
+    std::vector<unsigned int> output(10);
+    EXPECT_EQ(rocrand_generate_to_host(NULL, output.data(), output.size()), ROCRAND_STATUS_NOT_CREATED);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL32));
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(generator, 3));
+    EXPECT_EQ(
+        rocrand_generate_to_host(generator, output.data(), output.size()),
+        ROCRAND_STATUS_LENGTH_NOT_MULTIPLE
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(
+        rocrand_generate_poisson_to_host(generator, output.data(), output.size(), 0.0),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+// Host generators write to host memory directly
+TEST(rocrand_generate_to_host_host_generator_tests, host_generator_test)
+{
+    const size_t size = 12345;
+    std::vector<unsigned int> expected(size);
+    std::vector<unsigned int> output(size);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator_host(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    ROCRAND_CHECK(rocrand_generate(generator, expected.data(), size));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator_host(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    ROCRAND_CHECK(rocrand_generate_to_host(generator, output.data(), size));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ASSERT_EQ(output, expected);
+}
@@ -0,0 +1,189 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+const rocrand_rng_type truncated_normal_rng_types[] = {
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
+    ROCRAND_RNG_PSEUDO_THREEFRY2_64_20,
+    ROCRAND_RNG_PSEUDO_THREEFRY4_64_20,
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_7,
+    ROCRAND_RNG_PSEUDO_MRG32K3A,
+    ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_XOSHIRO128PP,
+    ROCRAND_RNG_PSEUDO_PCG32
+};
+
+class rocrand_generate_truncated_normal_tests
+    : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+rocrand_status generate_truncated_normal(rocrand_generator generator, float * data, size_t n,
+                                         float mean, float stddev, float lo, float hi)
+{
+    return rocrand_generate_truncated_normal(generator, data, n, mean, stddev, lo, hi);
+}
+
+rocrand_status generate_truncated_normal(rocrand_generator generator, double * data, size_t n,
+                                         double mean, double stddev, double lo, double hi)
+{
+    return rocrand_generate_truncated_normal_double(generator, data, n, mean, stddev, lo, hi);
+}
+
+double normal_pdf(double x)
+{
+    return std::isinf(x) ? 0.0 : std::exp(-0.5 * x * x) / std::sqrt(2.0 * M_PI);
+}
+
+// Intervals containing the mean, narrow intervals and both tails use
+// different methods
+template<class T>
+void truncated_normal_test(const rocrand_rng_type rng_type)
+{
+    const size_t size = 1 << 18;
+    const T mean = 1;
+    const T stddev = 2;
+    const T inf = std::numeric_limits<T>::infinity();
+    const T intervals[][2] = {
+        { -inf, inf }, { -1, 2 }, { 0.5, 0.6 }, { 1, 1.5 },
+        { 7, inf }, { 0.9, 20 }, { 11, 11.02 }, { -inf, -5 }, { -19, -17 }
+    };
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    T * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(T)));
+    std::vector<T> output(size);
+
+    for(const auto& interval : intervals)
+    {
+        const T lo = interval[0];
+        const T hi = interval[1];
+        SCOPED_TRACE(testing::Message() << "with interval = [" << lo << ", " << hi << "]");
+
+        // Any sizes and alignment
+        ROCRAND_CHECK(generate_truncated_normal(generator, data + 1, 2, mean, stddev, lo, hi));
+        ROCRAND_CHECK(generate_truncated_normal(generator, data, size, mean, stddev, lo, hi));
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(T), hipMemcpyDeviceToHost));
+
+        // Moments of the standardized truncated distribution, probabilities
+        // of upper tails are used for accuracy
+        const double a = (lo - mean) / stddev;
+        const double b = (hi - mean) / stddev;
+        const double z = a > 0.0
+            ? 0.5 * (std::erfc(a / std::sqrt(2.0)) - std::erfc(b / std::sqrt(2.0)))
+            : 0.5 * (std::erfc(-b / std::sqrt(2.0)) - std::erfc(-a / std::sqrt(2.0)));
+        const double d = (normal_pdf(a) - normal_pdf(b)) / z;
+        const double expected_mean = mean + stddev * d;
+        const double expected_variance = stddev * stddev * (
+            1.0 + ((std::isinf(a) ? 0.0 : a * normal_pdf(a))
+                - (std::isinf(b) ? 0.0 : b * normal_pdf(b))) / z - d * d
+        );
+
+        double actual_mean = 0;
+        for(T v : output)
+        {
+            ASSERT_GE(v, lo);
+            ASSERT_LE(v, hi);
+            actual_mean += static_cast<double>(v);
+        }
+        actual_mean = actual_mean / size;
+        double actual_variance = 0;
+        for(T v : output)
+        {
+            const double dv = static_cast<double>(v) - actual_mean;
+            actual_variance += dv * dv;
+        }
+        actual_variance = actual_variance / size;
+
+        EXPECT_NEAR(expected_mean, actual_mean, 5.0 * std::sqrt(expected_variance / size) + 1e-5);
+        EXPECT_NEAR(expected_variance, actual_variance, expected_variance * 0.05);
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generate_truncated_normal_tests, float_test)
+{
+    truncated_normal_test<float>(GetParam());
+}
+
+TEST_P(rocrand_generate_truncated_normal_tests, double_test)
+{
+    truncated_normal_test<double>(GetParam());
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_truncated_normal_tests,
+                        rocrand_generate_truncated_normal_tests,
+                        ::testing::ValuesIn(truncated_normal_rng_types));
+
+TEST(rocrand_generate_truncated_normal_tests, neg_test)
+{
+    const size_t size = 256;
+    float * data = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_truncated_normal(generator, data, size, 0.0f, 1.0f, 0.0f, 1.0f),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(
+        rocrand_generate_truncated_normal(generator, data, size, 0.0f, 0.0f, 0.0f, 1.0f),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_truncated_normal(generator, data, size, 0.0f, 1.0f, 1.0f, 1.0f),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_truncated_normal_double(generator, NULL, size, 0.0, 1.0, NAN, 1.0),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    // (lo - mean) / stddev is 1e30, its square overflows
+    EXPECT_EQ(
+        rocrand_generate_truncated_normal(generator, data, size, 0.0f, 1e-30f, 1.0f, 2.0f),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_truncated_normal(generator, data, size, 0.0f, 1e-30f, -2.0f, -1.0f),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL32));
+    EXPECT_EQ(
+        rocrand_generate_truncated_normal(generator, data, size, 0.0f, 1.0f, 0.0f, 1.0f),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
@@ -20,6 +20,9 @@
 
 #include <stdio.h>
 #include <gtest/gtest.h>
+#include <cmath>
+#include <cstring>
+#include <vector>
 
 #include <hip/hip_runtime.h>
 #include <rocrand.h>
@@ -142,6 +145,262 @@ TEST_P(rocrand_generate_uniform_tests, half_test)
     ROCRAND_CHECK(rocrand_destroy_generator(generator));
 }
 
+// Values are in (0, 1] for all alignments and sizes (pseudo-random generators
+// store 8 values at once), values outside of the output are not changed
+TEST_P(rocrand_generate_uniform_tests, bfloat16_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t size = 12563;
+    bfloat16 * data;
+    HIP_CHECK(hipMalloc((void **)&data, (size + 16) * sizeof(bfloat16)));
+
+    for(size_t offset = 0; offset < 8; offset++)
+    {
+        HIP_CHECK(hipMemset(data, 0xff, (size + 16) * sizeof(bfloat16)));
+        ROCRAND_CHECK(rocrand_generate_uniform_bfloat16(generator, data + offset, size - offset));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<unsigned short> output(size + 16);
+        HIP_CHECK(
+            hipMemcpy(
+                output.data(), data,
+                (size + 16) * sizeof(bfloat16),
+                hipMemcpyDeviceToHost
+            )
+        );
+        double mean = 0.0;
+        for(size_t i = 0; i < size + 16; i++)
+        {
+            if(i < offset || i >= size)
+            {
+                ASSERT_EQ(output[i], 0xffff);
+                continue;
+            }
+            const unsigned int bits = static_cast<unsigned int>(output[i]) << 16;
+            float v;
+            std::memcpy(&v, &bits, sizeof(float));
+            ASSERT_GT(v, 0.0f);
+            ASSERT_LE(v, 1.0f);
+            mean += v;
+        }
+        mean /= size - offset;
+        EXPECT_NEAR(mean, 0.5, 0.02);
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+// Value of bits of an FP8 value with ExponentBits and MantissaBits (OCP E4M3 or E5M2)
+template<int ExponentBits, int MantissaBits>
+float fp8_to_float(const unsigned char bits)
+{
+    const int bias = (1 << (ExponentBits - 1)) - 1;
+    const int exponent = (bits >> MantissaBits) & ((1 << ExponentBits) - 1);
+    const int mantissa = bits & ((1 << MantissaBits) - 1);
+    const float v = exponent == 0
+        ? std::ldexp(static_cast<float>(mantissa), 1 - bias - MantissaBits)
+        : std::ldexp(1.0f + static_cast<float>(mantissa) / (1 << MantissaBits), exponent - bias);
+    return (bits & 0x80) != 0 ? -v : v;
+}
+
+// Generates size - offset 8-bit values to data + offset of size + 32 bytes
+// set to 0xff before, returns all bytes
+template<class T>
+void generate_8bit(rocrand_generator generator,
+                   rocrand_status (*generate)(rocrand_generator, T *, size_t),
+                   const size_t size, const size_t offset,
+                   std::vector<unsigned char>& output)
+{
+    T * data;
+    HIP_CHECK(hipMalloc((void **)&data, (size + 32) * sizeof(T)));
+    HIP_CHECK(hipMemset(data, 0xff, (size + 32) * sizeof(T)));
+    ROCRAND_CHECK(generate(generator, data + offset, size - offset));
+    HIP_CHECK(hipDeviceSynchronize());
+    output.resize(size + 32);
+    HIP_CHECK(hipMemcpy(output.data(), data, (size + 32) * sizeof(T), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+}
+
+// Values are in (0, 1] for all alignments and sizes (pseudo-random generators
+// store 16 values at once), values outside of the output are not changed
+template<class T, int ExponentBits, int MantissaBits>
+void fp8_test(const rocrand_rng_type rng_type,
+              rocrand_status (*generate)(rocrand_generator, T *, size_t))
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t size = 12563;
+    for(size_t offset = 0; offset < 16; offset++)
+    {
+        std::vector<unsigned char> output;
+        generate_8bit(generator, generate, size, offset, output);
+        double mean = 0.0;
+        for(size_t i = 0; i < size + 32; i++)
+        {
+            if(i < offset || i >= size)
+            {
+                ASSERT_EQ(output[i], 0xff);
+                continue;
+            }
+            const float v = fp8_to_float<ExponentBits, MantissaBits>(output[i]);
+            ASSERT_GT(v, 0.0f);
+            ASSERT_LE(v, 1.0f);
+            mean += v;
+        }
+        mean /= size - offset;
+        EXPECT_NEAR(mean, 0.5, 0.02);
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generate_uniform_tests, fp8_e4m3_test)
+{
+    fp8_test<rocrand_fp8_e4m3, 4, 3>(GetParam(), rocrand_generate_uniform_fp8_e4m3);
+}
+
+TEST_P(rocrand_generate_uniform_tests, fp8_e5m2_test)
+{
+    fp8_test<rocrand_fp8_e5m2, 5, 2>(GetParam(), rocrand_generate_uniform_fp8_e5m2);
+}
+
+TEST_P(rocrand_generate_uniform_tests, int8_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, GetParam()));
+
+    const size_t size = 1 << 16;
+    for(size_t offset = 0; offset < 16; offset += 5)
+    {
+        std::vector<unsigned char> output;
+        generate_8bit(generator, rocrand_generate_uniform_int8, size, offset, output);
+        double mean = 0.0;
+        std::vector<size_t> histogram(256, 0);
+        for(size_t i = offset; i < size; i++)
+        {
+            mean += static_cast<signed char>(output[i]);
+            histogram[output[i]]++;
+        }
+        ASSERT_EQ(output[size], 0xff);
+        mean /= size - offset;
+        EXPECT_NEAR(mean, -0.5, 1.0);
+        for(size_t count : histogram)
+        {
+            EXPECT_GT(count, 0U);
+        }
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+rocrand_status generate_range(rocrand_generator generator, unsigned int * data, size_t n,
+                              unsigned int lo, unsigned int hi)
+{
+    return rocrand_generate_uniform_uint_range(generator, data, n, lo, hi);
+}
+
+rocrand_status generate_range(rocrand_generator generator, unsigned long long * data, size_t n,
+                              unsigned long long lo, unsigned long long hi)
+{
+    return rocrand_generate_uniform_ulonglong_range(generator, data, n, lo, hi);
+}
+
+template<class T>
+void test_range(const rocrand_rng_type rng_type, const T lo, const T hi)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            rng_type
+        )
+    );
+
+    const size_t size = 1 << 18;
+    T * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(T)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Any alignment
+    ROCRAND_CHECK(generate_range(generator, data + 1, 3, lo, hi));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(generate_range(generator, data, size, lo, hi));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<T> output(size);
+    HIP_CHECK(
+        hipMemcpy(
+            output.data(), data,
+            size * sizeof(T),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    const double range = static_cast<double>(hi - lo);
+    std::vector<double> histogram(10, 0.0);
+    for(auto v : output)
+    {
+        ASSERT_GE(v, lo);
+        ASSERT_LT(v, hi);
+        histogram[static_cast<size_t>(static_cast<double>(v - lo) / range * 10.0)] += 1.0;
+    }
+    for(auto h : histogram)
+    {
+        EXPECT_NEAR(h / size, 0.1, 0.01);
+    }
+}
+
+TEST_P(rocrand_generate_uniform_tests, uint_range_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    test_range<unsigned int>(rng_type, 5, 15);
+    test_range<unsigned int>(rng_type, 12345, 3000000000U);
+}
+
+TEST_P(rocrand_generate_uniform_tests, ulonglong_range_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    test_range<unsigned long long>(rng_type, 5, 15);
+    test_range<unsigned long long>(rng_type, 12345, (1ULL << 63) + 123456789ULL);
+}
+
+TEST(rocrand_generate_uniform_tests, range_neg_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, 256 * sizeof(unsigned int)));
+    EXPECT_EQ(
+        rocrand_generate_uniform_uint_range(generator, data, 256, 10, 10),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_uniform_ulonglong_range(
+            generator, reinterpret_cast<unsigned long long *>(data), 128, 20, 10
+        ),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    EXPECT_EQ(
+        rocrand_generate_uniform_uint_range(NULL, data, 256, 0, 10),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
+
 TEST(rocrand_generate_uniform_tests, neg_test)
 {
     const size_t size = 256;
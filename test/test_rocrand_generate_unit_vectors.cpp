@@ -0,0 +1,177 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+const rocrand_rng_type unit_vectors_rng_types[] = {
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
+    ROCRAND_RNG_PSEUDO_THREEFRY2_64_20,
+    ROCRAND_RNG_PSEUDO_THREEFRY4_64_20,
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_7,
+    ROCRAND_RNG_PSEUDO_MRG32K3A,
+    ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_XOSHIRO128PP,
+    ROCRAND_RNG_PSEUDO_PCG32,
+    ROCRAND_RNG_PSEUDO_MTGP32
+};
+
+class rocrand_generate_unit_vectors_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+// Vectors of 1 to 4 values are fused for generators with rejection kernels,
+// 7 values are normalized normal vectors for all generators
+TEST_P(rocrand_generate_unit_vectors_tests, float_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t n = 1 << 16;
+    const unsigned int dims[] = { 1, 2, 3, 4, 7 };
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, n * 7 * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(const unsigned int dim : dims)
+    {
+        SCOPED_TRACE(testing::Message() << "with dim = " << dim);
+
+        ROCRAND_CHECK(rocrand_generate_unit_vectors(generator, data, n, dim));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<float> output(n * dim);
+        HIP_CHECK(hipMemcpy(output.data(), data, n * dim * sizeof(float), hipMemcpyDeviceToHost));
+
+        std::vector<double> means(dim, 0.0);
+        std::vector<double> squares(dim, 0.0);
+        for(size_t v = 0; v < n; v++)
+        {
+            double length = 0.0;
+            for(unsigned int i = 0; i < dim; i++)
+            {
+                const double x = output[v * dim + i];
+                length += x * x;
+                means[i] += x;
+                squares[i] += x * x;
+            }
+            ASSERT_NEAR(length, 1.0, 1e-5);
+        }
+        // Coordinates of uniformly distributed unit vectors have mean 0
+        // and variance 1 / dim
+        for(unsigned int i = 0; i < dim; i++)
+        {
+            EXPECT_NEAR(means[i] / n, 0.0, 0.02);
+            EXPECT_NEAR(squares[i] / n, 1.0 / dim, 0.02);
+        }
+    }
+
+    EXPECT_EQ(
+        rocrand_generate_unit_vectors(generator, data, n, 0),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_unit_vectors(generator, NULL, n, 3),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+// Angles of 2D vectors are uniformly distributed in [-pi, pi]: chi-squared test
+// of their histogram. Vectors of 2 values (fused) and of 7 values (the first
+// 2 values of normalized normal vectors, their angles are uniform too).
+TEST_P(rocrand_generate_unit_vectors_tests, angle_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t n = 1 << 18;
+    const unsigned int dims[] = { 2, 7 };
+    const size_t bins = 64;
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, n * 7 * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(const unsigned int dim : dims)
+    {
+        SCOPED_TRACE(testing::Message() << "with dim = " << dim);
+
+        ROCRAND_CHECK(rocrand_generate_unit_vectors(generator, data, n, dim));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<float> output(n * dim);
+        HIP_CHECK(hipMemcpy(output.data(), data, n * dim * sizeof(float), hipMemcpyDeviceToHost));
+
+        std::vector<size_t> histogram(bins, 0);
+        for(size_t v = 0; v < n; v++)
+        {
+            const double angle = std::atan2(output[v * dim + 1], output[v * dim]);
+            const size_t bin = static_cast<size_t>((angle + M_PI) / (2.0 * M_PI) * bins);
+            histogram[std::min(bin, bins - 1)]++;
+        }
+        const double expected = static_cast<double>(n) / bins;
+        double chi_squared = 0.0;
+        for(size_t b = 0; b < bins; b++)
+        {
+            const double d = histogram[b] - expected;
+            chi_squared += d * d / expected;
+        }
+        // 63 degrees of freedom, the probability of larger values is below 1e-6
+        EXPECT_LT(chi_squared, 135.0);
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_unit_vectors_tests,
+                        rocrand_generate_unit_vectors_tests,
+                        ::testing::ValuesIn(unit_vectors_rng_types));
+
+// Consecutive values of quasi-random generators are points of one dimension
+TEST(rocrand_generate_unit_vectors_tests, quasi_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL32));
+
+    const size_t n = 256;
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, n * 2 * sizeof(float)));
+    EXPECT_EQ(
+        rocrand_generate_unit_vectors(generator, data, n, 2),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
@@ -0,0 +1,199 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+struct group_test_params
+{
+    rocrand_rng_type rng_type;
+    unsigned int engines_count;
+    // Launch configuration of an equivalent generator
+    unsigned int blocks;
+    unsigned int threads;
+};
+
+const group_test_params group_params[] = {
+    { ROCRAND_RNG_PSEUDO_XORWOW, 1000, 4, 256 },
+    { ROCRAND_RNG_PSEUDO_XORWOW, 100, 1, 100 },
+    { ROCRAND_RNG_PSEUDO_MRG32K3A, 2048, 8, 256 },
+    { ROCRAND_RNG_PSEUDO_MTGP32, 8, 8, 256 }
+};
+
+class rocrand_generator_group_tests : public ::testing::TestWithParam<group_test_params> { };
+
+void generate_values(rocrand_generator generator, size_t size, std::vector<unsigned int>& output)
+{
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    ROCRAND_CHECK(rocrand_generate(generator, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+    output.resize(size);
+    HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+}
+
+// Generators with engines_count engines generate the same values as generators
+// with the equivalent launch configuration
+TEST_P(rocrand_generator_group_tests, engines_count_test)
+{
+    const group_test_params params = GetParam();
+    const size_t size = 123456;
+
+    rocrand_generator_group group;
+    ROCRAND_CHECK(rocrand_create_generator_group(&group));
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator_in_group(
+        &generator, params.rng_type, group, params.engines_count
+    ));
+    unsigned int blocks, threads;
+    ROCRAND_CHECK(rocrand_get_launch_config(generator, &blocks, &threads));
+    EXPECT_EQ(blocks, params.blocks);
+    EXPECT_EQ(threads, params.threads);
+    ROCRAND_CHECK(rocrand_set_seed(generator, 98765ULL));
+    std::vector<unsigned int> output;
+    generate_values(generator, size, output);
+
+    size_t bytes;
+    ROCRAND_CHECK(rocrand_get_generator_group_size(group, &bytes));
+    EXPECT_GT(bytes, 0U);
+    // The generator keeps the arena
+    ROCRAND_CHECK(rocrand_destroy_generator_group(group));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, params.rng_type));
+    ROCRAND_CHECK(rocrand_set_launch_config(generator, params.blocks, params.threads));
+    ROCRAND_CHECK(rocrand_set_seed(generator, 98765ULL));
+    std::vector<unsigned int> expected;
+    generate_values(generator, size, expected);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ASSERT_EQ(output, expected);
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generator_group_tests,
+                        rocrand_generator_group_tests,
+                        ::testing::ValuesIn(group_params));
+
+// Many generators share chunks of the arena, which is released when they are destroyed
+TEST(rocrand_generator_group_arena_tests, arena_test)
+{
+    const size_t generators_count = 200;
+    const size_t size = 4096;
+
+    rocrand_generator_group group;
+    ROCRAND_CHECK(rocrand_create_generator_group(&group));
+    std::vector<rocrand_generator> generators(generators_count);
+    for(size_t i = 0; i < generators_count; i++)
+    {
+        ROCRAND_CHECK(rocrand_create_generator_in_group(
+            &generators[i], i % 2 == 0 ? ROCRAND_RNG_PSEUDO_XORWOW : ROCRAND_RNG_PSEUDO_MRG32K3A,
+            group, 1024
+        ));
+    }
+
+    size_t bytes;
+    ROCRAND_CHECK(rocrand_get_generator_group_size(group, &bytes));
+    // Much less than default engines of the generators (131072 engines each)
+    EXPECT_GT(bytes, 0U);
+    EXPECT_LT(bytes, generators_count * 1024 * 256);
+
+    // Engines of different generators do not overlap: all generators are
+    // initialized with different seeds before they generate again
+    std::vector<unsigned int> output;
+    std::vector<unsigned int> expected;
+    for(size_t i = 0; i < generators_count; i++)
+    {
+        ROCRAND_CHECK(rocrand_set_seed(generators[i], 1000ULL + i));
+        generate_values(generators[i], size, output);
+    }
+    for(size_t i = 0; i < generators_count; i += 17)
+    {
+        generate_values(generators[i], size, output);
+
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(
+            &generator, i % 2 == 0 ? ROCRAND_RNG_PSEUDO_XORWOW : ROCRAND_RNG_PSEUDO_MRG32K3A
+        ));
+        ROCRAND_CHECK(rocrand_set_launch_config(generator, 4, 256));
+        ROCRAND_CHECK(rocrand_set_seed(generator, 1000ULL + i));
+        generate_values(generator, size, expected);
+        generate_values(generator, size, expected);
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+        ASSERT_EQ(output, expected);
+    }
+
+    // Free ranges are reused
+    ROCRAND_CHECK(rocrand_destroy_generator(generators[10]));
+    ROCRAND_CHECK(rocrand_create_generator_in_group(
+        &generators[10], ROCRAND_RNG_PSEUDO_XORWOW, group, 1024
+    ));
+    size_t new_bytes;
+    ROCRAND_CHECK(rocrand_get_generator_group_size(group, &new_bytes));
+    EXPECT_EQ(new_bytes, bytes);
+
+    for(rocrand_generator generator : generators)
+    {
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+    ROCRAND_CHECK(rocrand_get_generator_group_size(group, &bytes));
+    EXPECT_EQ(bytes, 0U);
+    ROCRAND_CHECK(rocrand_destroy_generator_group(group));
+}
+
+TEST(rocrand_generator_group_neg_tests, neg_test)
+{
+    rocrand_generator generator;
+    size_t bytes;
+    EXPECT_EQ(rocrand_create_generator_group(NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_destroy_generator_group(NULL), ROCRAND_STATUS_NOT_CREATED);
+    EXPECT_EQ(rocrand_get_generator_group_size(NULL, &bytes), ROCRAND_STATUS_NOT_CREATED);
+    EXPECT_EQ(
+        rocrand_create_generator_in_group(&generator, ROCRAND_RNG_PSEUDO_XORWOW, NULL, 0),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    rocrand_generator_group group;
+    ROCRAND_CHECK(rocrand_create_generator_group(&group));
+    EXPECT_EQ(rocrand_get_generator_group_size(group, NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(
+        rocrand_create_generator_in_group(&generator, ROCRAND_RNG_PSEUDO_MTGP32, group, 5000),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_create_generator_in_group(&generator, static_cast<rocrand_rng_type>(0), group, 0),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+
+    // Generators without engines are created as usual
+    ROCRAND_CHECK(rocrand_create_generator_in_group(
+        &generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10, group, 1024
+    ));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    ROCRAND_CHECK(rocrand_get_generator_group_size(group, &bytes));
+    EXPECT_EQ(bytes, 0U);
+    ROCRAND_CHECK(rocrand_destroy_generator_group(group));
+}
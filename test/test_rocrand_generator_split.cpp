@@ -0,0 +1,234 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+void generate_values(rocrand_generator generator, size_t size, std::vector<unsigned int>& output)
+{
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    ROCRAND_CHECK(rocrand_generate(generator, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+    output.resize(size);
+    HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+}
+
+class rocrand_generator_split_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+// The i-th engine of the c-th child is the i-th engine of the parent skipped
+// ahead by (c + 1) * engines subsequences, so children generate values of
+// engines of a generator with more engines, the parent skips ahead past them
+TEST_P(rocrand_generator_split_tests, skipahead_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    const unsigned int blocks = 4;
+    const unsigned int threads = 64;
+    const size_t engines = blocks * threads;
+    const unsigned int count = 3;
+    // Rounds of values (one value of every engine) before and after the split
+    const size_t rounds_before = 5;
+    const size_t rounds_after = 3;
+
+    rocrand_generator parent;
+    ROCRAND_CHECK(rocrand_create_generator(&parent, rng_type));
+    ROCRAND_CHECK(rocrand_set_launch_config(parent, blocks, threads));
+    ROCRAND_CHECK(rocrand_set_seed(parent, 24680ULL));
+    std::vector<unsigned int> output;
+    generate_values(parent, rounds_before * engines, output);
+
+    std::vector<rocrand_generator> children(count);
+    ROCRAND_CHECK(rocrand_generator_split(parent, count, children.data()));
+
+    for(unsigned int c = 0; c <= count; c++)
+    {
+        rocrand_generator generator = c < count ? children[c] : parent;
+        unsigned int generator_blocks, generator_threads;
+        ROCRAND_CHECK(rocrand_get_launch_config(generator, &generator_blocks, &generator_threads));
+        EXPECT_EQ(generator_blocks, blocks);
+        EXPECT_EQ(generator_threads, threads);
+        generate_values(generator, rounds_after * engines, output);
+
+        rocrand_generator expected_generator;
+        ROCRAND_CHECK(rocrand_create_generator(&expected_generator, rng_type));
+        ROCRAND_CHECK(rocrand_set_launch_config(expected_generator, blocks * (c + 2), threads));
+        ROCRAND_CHECK(rocrand_set_seed(expected_generator, 24680ULL));
+        const size_t expected_engines = engines * (c + 2);
+        std::vector<unsigned int> expected;
+        generate_values(
+            expected_generator, (rounds_before + rounds_after) * expected_engines, expected
+        );
+        ROCRAND_CHECK(rocrand_destroy_generator(expected_generator));
+
+        for(size_t r = 0; r < rounds_after; r++)
+        {
+            for(size_t i = 0; i < engines; i++)
+            {
+                ASSERT_EQ(
+                    output[r * engines + i],
+                    expected[(rounds_before + r) * expected_engines + (c + 1) * engines + i]
+                );
+            }
+        }
+    }
+
+    for(rocrand_generator child : children)
+    {
+        ROCRAND_CHECK(rocrand_destroy_generator(child));
+    }
+    ROCRAND_CHECK(rocrand_destroy_generator(parent));
+}
+
+// Children generating in other streams wait for split_engines_kernel
+// launched in the stream of the parent. More children than pointers stored
+// by one store_pointers_kernel are created.
+TEST_P(rocrand_generator_split_tests, streams_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    const size_t size = 4321;
+    const unsigned int count = 40;
+
+    hipStream_t parent_stream, children_stream;
+    HIP_CHECK(hipStreamCreateWithFlags(&parent_stream, hipStreamNonBlocking));
+    HIP_CHECK(hipStreamCreateWithFlags(&children_stream, hipStreamNonBlocking));
+
+    rocrand_generator parents[2];
+    std::vector<rocrand_generator> children[2];
+    for(int p = 0; p < 2; p++)
+    {
+        ROCRAND_CHECK(rocrand_create_generator(&parents[p], rng_type));
+        ROCRAND_CHECK(rocrand_set_launch_config(parents[p], 4, 64));
+        ROCRAND_CHECK(rocrand_set_seed(parents[p], 97531ULL));
+        children[p].resize(count);
+    }
+    ROCRAND_CHECK(rocrand_set_stream(parents[0], parent_stream));
+    ROCRAND_CHECK(rocrand_generator_split(parents[0], count, children[0].data()));
+    ROCRAND_CHECK(rocrand_generator_split(parents[1], count, children[1].data()));
+
+    std::vector<unsigned int> output;
+    std::vector<unsigned int> expected;
+    for(unsigned int c = 0; c < count; c++)
+    {
+        ROCRAND_CHECK(rocrand_set_stream(children[0][c], children_stream));
+        generate_values(children[0][c], size, output);
+        generate_values(children[1][c], size, expected);
+        ASSERT_EQ(output, expected);
+    }
+
+    for(int p = 0; p < 2; p++)
+    {
+        for(rocrand_generator child : children[p])
+        {
+            ROCRAND_CHECK(rocrand_destroy_generator(child));
+        }
+        ROCRAND_CHECK(rocrand_destroy_generator(parents[p]));
+    }
+    HIP_CHECK(hipStreamDestroy(parent_stream));
+    HIP_CHECK(hipStreamDestroy(children_stream));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generator_split_tests,
+                        rocrand_generator_split_tests,
+                        ::testing::Values(ROCRAND_RNG_PSEUDO_XORWOW, ROCRAND_RNG_PSEUDO_MRG32K3A,
+                                          ROCRAND_RNG_PSEUDO_XOSHIRO128PP, ROCRAND_RNG_PSEUDO_PCG32));
+
+// Keys of Philox children depend on the seed and the number of children
+// created before, the parent is not changed
+TEST(rocrand_generator_split_philox_tests, keys_test)
+{
+    const size_t size = 12345;
+
+    rocrand_generator parents[2];
+    std::vector<rocrand_generator> children[2];
+    for(int p = 0; p < 2; p++)
+    {
+        ROCRAND_CHECK(rocrand_create_generator(&parents[p], ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+        ROCRAND_CHECK(rocrand_set_launch_config(parents[p], 8, 128));
+        ROCRAND_CHECK(rocrand_set_seed(parents[p], 13579ULL));
+        children[p].resize(3);
+    }
+    ROCRAND_CHECK(rocrand_generator_split(parents[0], 2, children[0].data()));
+    ROCRAND_CHECK(rocrand_generator_split(parents[0], 1, children[0].data() + 2));
+    ROCRAND_CHECK(rocrand_generator_split(parents[1], 3, children[1].data()));
+
+    std::vector<unsigned int> output;
+    std::vector<unsigned int> expected;
+    std::vector<std::vector<unsigned int> > outputs;
+    for(int c = 0; c < 3; c++)
+    {
+        unsigned int blocks, threads;
+        ROCRAND_CHECK(rocrand_get_launch_config(children[0][c], &blocks, &threads));
+        EXPECT_EQ(blocks, 8U);
+        EXPECT_EQ(threads, 128U);
+        generate_values(children[0][c], size, output);
+        generate_values(children[1][c], size, expected);
+        ASSERT_EQ(output, expected);
+        outputs.push_back(output);
+    }
+    generate_values(parents[0], size, output);
+    outputs.push_back(output);
+    for(size_t i = 0; i < outputs.size(); i++)
+    {
+        for(size_t j = 0; j < i; j++)
+        {
+            ASSERT_NE(outputs[i], outputs[j]);
+        }
+    }
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_launch_config(generator, 8, 128));
+    ROCRAND_CHECK(rocrand_set_seed(generator, 13579ULL));
+    generate_values(generator, size, expected);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    ASSERT_EQ(outputs.back(), expected);
+
+    for(int p = 0; p < 2; p++)
+    {
+        for(rocrand_generator child : children[p])
+        {
+            ROCRAND_CHECK(rocrand_destroy_generator(child));
+        }
+        ROCRAND_CHECK(rocrand_destroy_generator(parents[p]));
+    }
+}
+
+TEST(rocrand_generator_split_neg_tests, neg_test)
+{
+    rocrand_generator children[2];
+    EXPECT_EQ(rocrand_generator_split(NULL, 2, children), ROCRAND_STATUS_NOT_CREATED);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(rocrand_generator_split(generator, 2, NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_generator_split(generator, 0, NULL));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL32));
+    EXPECT_EQ(rocrand_generator_split(generator, 2, children), ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
@@ -0,0 +1,126 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+
+const rocrand_rng_type stats_rng_types[] = {
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
+    ROCRAND_RNG_PSEUDO_THREEFRY2_64_20,
+    ROCRAND_RNG_PSEUDO_THREEFRY4_64_20,
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_7,
+    ROCRAND_RNG_PSEUDO_MRG32K3A,
+    ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_XOSHIRO128PP,
+    ROCRAND_RNG_PSEUDO_PCG32,
+    ROCRAND_RNG_PSEUDO_MTGP32,
+    ROCRAND_RNG_QUASI_SOBOL32,
+    ROCRAND_RNG_QUASI_SOBOL64
+};
+
+class rocrand_generator_stats_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+TEST_P(rocrand_generator_stats_tests, counters_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    const size_t size = 12345;
+
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    rocrand_generator_stats stats;
+    ROCRAND_CHECK(rocrand_get_generator_stats(generator, &stats));
+    EXPECT_EQ(stats.values_generated, 0ULL);
+    EXPECT_EQ(stats.initializations, 0ULL);
+
+    ROCRAND_CHECK(rocrand_generate(generator, data, size));
+    ROCRAND_CHECK(rocrand_generate_poisson(generator, data, size, 10.0));
+    ROCRAND_CHECK(rocrand_generate_poisson(generator, data, size, 10.0));
+    ROCRAND_CHECK(rocrand_generate_poisson(generator, data, size, 20.0));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_get_generator_stats(generator, &stats));
+    EXPECT_EQ(stats.values_generated, 4 * size);
+    EXPECT_EQ(stats.initializations, 1ULL);
+    EXPECT_GE(stats.kernel_launches, 4ULL);
+    // 20.0 evicts 10.0 from the cache of one lambda
+    EXPECT_EQ(stats.poisson_table_builds, 2ULL);
+    EXPECT_GT(stats.device_bytes_allocated, 0ULL);
+
+    // Reseeding (or changing the offset) initializes engines again
+    const rocrand_status status = rocrand_set_seed(generator, 1234ULL);
+    if(status == ROCRAND_STATUS_TYPE_ERROR)
+    {
+        ROCRAND_CHECK(rocrand_set_offset(generator, 1234ULL));
+    }
+    else
+    {
+        ROCRAND_CHECK(status);
+    }
+    ROCRAND_CHECK(rocrand_generate(generator, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    rocrand_generator_stats next_stats;
+    ROCRAND_CHECK(rocrand_get_generator_stats(generator, &next_stats));
+    EXPECT_EQ(next_stats.values_generated, 5 * size);
+    EXPECT_EQ(next_stats.initializations, 2ULL);
+    EXPECT_GT(next_stats.kernel_launches, stats.kernel_launches);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(data));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generator_stats_tests,
+                        rocrand_generator_stats_tests,
+                        ::testing::ValuesIn(stats_rng_types));
+
+// Host generators count values, but do not launch kernels
+TEST(rocrand_generator_stats_host_tests, host_generator_test)
+{
+    const size_t size = 1000;
+    std::vector<float> data(size);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator_host(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    ROCRAND_CHECK(rocrand_generate_uniform(generator, data.data(), size));
+
+    rocrand_generator_stats stats;
+    ROCRAND_CHECK(rocrand_get_generator_stats(generator, &stats));
+    EXPECT_EQ(stats.values_generated, size);
+    EXPECT_EQ(stats.initializations, 1ULL);
+    EXPECT_EQ(stats.kernel_launches, 0ULL);
+    EXPECT_EQ(stats.device_bytes_allocated, 0ULL);
+
+    EXPECT_EQ(rocrand_get_generator_stats(generator, NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    EXPECT_EQ(rocrand_get_generator_stats(NULL, &stats), ROCRAND_STATUS_NOT_CREATED);
+}
@@ -0,0 +1,235 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+class rocrand_generator_trim_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+void generate_and_copy(rocrand_generator generator,
+                       unsigned int * data,
+                       std::vector<unsigned int>& output,
+                       bool poisson = false)
+{
+    if(poisson)
+        ROCRAND_CHECK(rocrand_generate_poisson(generator, data, output.size(), 10.0));
+    else
+        ROCRAND_CHECK(rocrand_generate(generator, data, output.size()));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(
+        hipMemcpy(
+            output.data(), data,
+            output.size() * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+}
+
+TEST(rocrand_generator_trim_tests, invalid_arguments_test)
+{
+    size_t bytes;
+    EXPECT_EQ(rocrand_get_memory_usage(NULL, &bytes), ROCRAND_STATUS_NOT_CREATED);
+    EXPECT_EQ(rocrand_generator_trim(NULL), ROCRAND_STATUS_NOT_CREATED);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(rocrand_get_memory_usage(generator, NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generator_trim_tests, trim_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    const size_t size = 12345;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    std::vector<std::vector<unsigned int>> expected(4, std::vector<unsigned int>(size));
+    std::vector<unsigned int> output(size);
+
+    // Uniform and Poisson values of a generator which is not trimmed
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    for(size_t i = 0; i < expected.size(); i++)
+    {
+        generate_and_copy(generator, data, expected[i], i % 2 == 1);
+    }
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    // Trimming before initialization is allowed
+    ROCRAND_CHECK(rocrand_generator_trim(generator));
+    for(size_t i = 0; i < expected.size(); i++)
+    {
+        generate_and_copy(generator, data, output, i % 2 == 1);
+        ASSERT_EQ(output, expected[i]) << i;
+
+        size_t bytes = 0;
+        ROCRAND_CHECK(rocrand_get_memory_usage(generator, &bytes));
+        if(rng_type != ROCRAND_RNG_QUASI_SOBOL32)
+        {
+            // Engines and the Poisson table
+            EXPECT_GT(bytes, 0U);
+        }
+
+        ROCRAND_CHECK(rocrand_generator_trim(generator));
+        ROCRAND_CHECK(rocrand_get_memory_usage(generator, &bytes));
+        EXPECT_EQ(bytes, 0U);
+    }
+
+    // State of a trimmed generator is its state before trimming
+    size_t state_size = 0;
+    if(rocrand_get_state(generator, NULL, &state_size) == ROCRAND_STATUS_SUCCESS)
+    {
+        std::vector<char> state(state_size);
+        ROCRAND_CHECK(rocrand_get_state(generator, state.data(), &state_size));
+        generate_and_copy(generator, data, expected[0]);
+        ROCRAND_CHECK(rocrand_generator_trim(generator));
+        ROCRAND_CHECK(rocrand_set_state(generator, state.data(), state_size));
+        generate_and_copy(generator, data, output);
+        ASSERT_EQ(output, expected[0]);
+    }
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST_P(rocrand_generator_trim_tests, reset_after_trim_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    if(rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+        return;
+
+    const size_t size = 12345;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    std::vector<unsigned int> expected(size);
+    std::vector<unsigned int> output(size);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_seed(generator, 5ULL));
+    generate_and_copy(generator, data, expected);
+
+    // Changing the seed of a trimmed generator discards its engines
+    ROCRAND_CHECK(rocrand_set_seed(generator, 1ULL));
+    generate_and_copy(generator, data, output);
+    ROCRAND_CHECK(rocrand_generator_trim(generator));
+    ROCRAND_CHECK(rocrand_set_seed(generator, 5ULL));
+    generate_and_copy(generator, data, output);
+    ASSERT_EQ(output, expected);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    HIP_CHECK(hipFree(data));
+}
+
+// Engines of previous seeds are cached in at most 16 MiB
+TEST_P(rocrand_generator_trim_tests, engines_cache_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    if(rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+        return;
+
+    const size_t size = 12345;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    std::vector<unsigned int> output(size);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    generate_and_copy(generator, data, output);
+    size_t initial_bytes = 0;
+    ROCRAND_CHECK(rocrand_get_memory_usage(generator, &initial_bytes));
+    for(unsigned long long seed = 1; seed <= 8; seed++)
+    {
+        ROCRAND_CHECK(rocrand_set_seed(generator, seed));
+        generate_and_copy(generator, data, output);
+        size_t bytes = 0;
+        ROCRAND_CHECK(rocrand_get_memory_usage(generator, &bytes));
+        EXPECT_LE(bytes, initial_bytes + (16 << 20)) << seed;
+    }
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    HIP_CHECK(hipFree(data));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_generator_trim_tests,
+                        rocrand_generator_trim_tests,
+                        ::testing::ValuesIn(rng_types));
+
+TEST(rocrand_generator_trim_tests, stateless_test)
+{
+    const size_t size = 12345;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    std::vector<unsigned int> expected(size);
+    std::vector<unsigned int> output(size);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_stateless(generator, 1));
+    generate_and_copy(generator, data, output);
+    generate_and_copy(generator, data, expected);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    // Stateless generators keep only their position, they have no engines
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_stateless(generator, 1));
+    generate_and_copy(generator, data, output);
+    size_t bytes = 1;
+    ROCRAND_CHECK(rocrand_get_memory_usage(generator, &bytes));
+    EXPECT_EQ(bytes, 0U);
+    ROCRAND_CHECK(rocrand_generator_trim(generator));
+    generate_and_copy(generator, data, output);
+    ASSERT_EQ(output, expected);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_generator_trim_tests, host_generator_test)
+{
+    const size_t size = 1234;
+    std::vector<unsigned int> expected(size);
+    std::vector<unsigned int> output(size);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator_host(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    ROCRAND_CHECK(rocrand_generate(generator, output.data(), size));
+    ROCRAND_CHECK(rocrand_generate(generator, expected.data(), size));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    // Host generators use no device memory and are not changed by trimming
+    ROCRAND_CHECK(rocrand_create_generator_host(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    ROCRAND_CHECK(rocrand_generate(generator, output.data(), size));
+    size_t bytes = 1;
+    ROCRAND_CHECK(rocrand_get_memory_usage(generator, &bytes));
+    EXPECT_EQ(bytes, 0U);
+    ROCRAND_CHECK(rocrand_generator_trim(generator));
+    ROCRAND_CHECK(rocrand_generate(generator, output.data(), size));
+    ASSERT_EQ(output, expected);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
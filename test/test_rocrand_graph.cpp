@@ -0,0 +1,208 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+const rocrand_rng_type graph_rng_types[] = {
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
+    ROCRAND_RNG_PSEUDO_THREEFRY2_64_20,
+    ROCRAND_RNG_PSEUDO_THREEFRY4_64_20,
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_7,
+    ROCRAND_RNG_PSEUDO_MRG32K3A,
+    ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_XOSHIRO128PP,
+    ROCRAND_RNG_PSEUDO_PCG32,
+    ROCRAND_RNG_PSEUDO_MTGP32
+};
+
+class rocrand_graph_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+// Every launch of the graph generates the same values as the next
+// rocrand_generate() call
+TEST_P(rocrand_graph_tests, graph_node_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    const size_t size = 12345;
+    const unsigned int launches = 3;
+
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+
+    std::vector<unsigned int> expected(size * launches);
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    for(unsigned int i = 0; i < launches; i++)
+    {
+        ROCRAND_CHECK(rocrand_generate(generator, data, size));
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(
+            hipMemcpy(
+                expected.data() + i * size, data,
+                size * sizeof(unsigned int),
+                hipMemcpyDeviceToHost
+            )
+        );
+    }
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    hipGraph_t graph;
+    HIP_CHECK(hipGraphCreate(&graph, 0));
+    hipGraphNode_t node;
+    ROCRAND_CHECK(rocrand_generate_graph_node(generator, graph, &node, NULL, 0, data, size));
+    hipGraphExec_t graph_exec;
+    HIP_CHECK(hipGraphInstantiate(&graph_exec, graph, NULL, NULL, 0));
+
+    std::vector<unsigned int> output(size * launches);
+    for(unsigned int i = 0; i < launches; i++)
+    {
+        HIP_CHECK(hipGraphLaunch(graph_exec, 0));
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(
+            hipMemcpy(
+                output.data() + i * size, data,
+                size * sizeof(unsigned int),
+                hipMemcpyDeviceToHost
+            )
+        );
+    }
+    HIP_CHECK(hipGraphExecDestroy(graph_exec));
+    HIP_CHECK(hipGraphDestroy(graph));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(data));
+
+    ASSERT_EQ(output, expected);
+}
+
+// Generation functions can be captured after the generator is initialized
+TEST_P(rocrand_graph_tests, stream_capture_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    const size_t size = 12345;
+    const double lambda = 10.0;
+
+    float * data;
+    unsigned int * poisson_data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&poisson_data, size * sizeof(unsigned int)));
+
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_stream(generator, stream));
+
+    // Not initialized
+    hipGraph_t graph;
+    HIP_CHECK(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+    EXPECT_EQ(rocrand_generate_normal(generator, data, size, 0.0f, 1.0f), ROCRAND_STATUS_ALLOCATION_FAILED);
+    HIP_CHECK(hipStreamEndCapture(stream, &graph));
+    HIP_CHECK(hipGraphDestroy(graph));
+
+    ROCRAND_CHECK(rocrand_initialize_generator(generator));
+    HIP_CHECK(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+    ROCRAND_CHECK(rocrand_generate_normal(generator, data, size, 0.0f, 1.0f));
+    // Not prepared
+    EXPECT_EQ(rocrand_generate_poisson(generator, poisson_data, size, lambda), ROCRAND_STATUS_ALLOCATION_FAILED);
+    HIP_CHECK(hipStreamEndCapture(stream, &graph));
+    HIP_CHECK(hipGraphDestroy(graph));
+
+    ROCRAND_CHECK(rocrand_prepare_poisson(generator, &lambda, 1));
+    HIP_CHECK(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+    ROCRAND_CHECK(rocrand_generate_poisson(generator, poisson_data, size, lambda));
+    HIP_CHECK(hipStreamEndCapture(stream, &graph));
+    hipGraphExec_t graph_exec;
+    HIP_CHECK(hipGraphInstantiate(&graph_exec, graph, NULL, NULL, 0));
+    HIP_CHECK(hipGraphLaunch(graph_exec, stream));
+    HIP_CHECK(hipStreamSynchronize(stream));
+
+    std::vector<unsigned int> output(size);
+    HIP_CHECK(
+        hipMemcpy(
+            output.data(), poisson_data,
+            size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    double mean = 0;
+    for(auto v : output)
+    {
+        mean += static_cast<double>(v);
+    }
+    mean = mean / size;
+    EXPECT_NEAR(mean, lambda, lambda * 5e-2);
+
+    HIP_CHECK(hipGraphExecDestroy(graph_exec));
+    HIP_CHECK(hipGraphDestroy(graph));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipStreamDestroy(stream));
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(poisson_data));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_graph_tests,
+                        rocrand_graph_tests,
+                        ::testing::ValuesIn(graph_rng_types));
+
+TEST(rocrand_graph_neg_tests, neg_test)
+{
+    float * data = NULL;
+    hipGraph_t graph;
+    HIP_CHECK(hipGraphCreate(&graph, 0));
+    hipGraphNode_t node;
+
+    EXPECT_EQ(
+        rocrand_generate_uniform_graph_node(NULL, graph, &node, NULL, 0, data, 0),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL32));
+    EXPECT_EQ(
+        rocrand_generate_uniform_graph_node(generator, graph, &node, NULL, 0, data, 0),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_stateless(generator, 1));
+    EXPECT_EQ(
+        rocrand_generate_uniform_graph_node(generator, graph, &node, NULL, 0, data, 0),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator_host(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(
+        rocrand_generate_uniform_graph_node(generator, graph, &node, NULL, 0, data, 0),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    HIP_CHECK(hipGraphDestroy(graph));
+}
@@ -0,0 +1,215 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+#include <climits>
+#include <cmath>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include <rng/generator_type.hpp>
+#include <rng/generators.hpp>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+template<class Generator>
+void generate_to_host(Generator& g, std::vector<unsigned int>& host_data)
+{
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * host_data.size()));
+    ROCRAND_CHECK(g.generate(data, host_data.size()));
+    HIP_CHECK(hipMemcpy(host_data.data(), data, sizeof(unsigned int) * host_data.size(), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_halton32_qrng_tests, uniform_uint_test)
+{
+    const size_t size = 1313;
+    std::vector<unsigned int> host_data(size);
+
+    rocrand_halton32 g;
+    generate_to_host(g, host_data);
+
+    unsigned long long sum = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        sum += host_data[i];
+    }
+    const unsigned int mean = sum / size;
+    ASSERT_NEAR(mean, UINT_MAX / 2, UINT_MAX / 20);
+}
+
+TEST(rocrand_halton32_qrng_tests, normal_float_test)
+{
+    const size_t size = 1313;
+    float * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(float) * size));
+
+    rocrand_scrambled_halton32 g;
+    ROCRAND_CHECK(g.generate_normal(data, size, 2.0f, 5.0f));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    float host_data[size];
+    HIP_CHECK(hipMemcpy(host_data, data, sizeof(float) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    float mean = 0.0f;
+    for(size_t i = 0; i < size; i++)
+    {
+        mean += host_data[i];
+    }
+    mean = mean / size;
+
+    float std = 0.0f;
+    for(size_t i = 0; i < size; i++)
+    {
+        std += std::pow(host_data[i] - mean, 2);
+    }
+    std = sqrt(std / size);
+
+    EXPECT_NEAR(2.0f, mean, 0.4f); // 20%
+    EXPECT_NEAR(5.0f, std, 1.0f); // 20%
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_halton32_qrng_tests, dimensions_test)
+{
+    rocrand_halton32 g;
+    EXPECT_EQ(g.set_dimensions(0), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(g.set_dimensions(65537), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(g.set_dimensions(65536));
+
+    std::vector<unsigned int> host_data(65536 * 2);
+    generate_to_host(g, host_data);
+    // The second point of the last dimension (base 821641)
+    EXPECT_EQ(host_data[65535 * 2 + 1], static_cast<unsigned int>(1.0 / 821641 * 4294967296.0));
+}
+
+// Van der Corput sequences in bases 2, 3 and 5
+TEST(rocrand_halton32_qrng_tests, known_values_test)
+{
+    const unsigned int dimensions = 3;
+    const size_t points = 5;
+    std::vector<unsigned int> host_data(points * dimensions);
+
+    rocrand_halton32 g;
+    ROCRAND_CHECK(g.set_dimensions(dimensions));
+    ROCRAND_CHECK(g.set_ordering(ROCRAND_ORDERING_QUASI_INTERLEAVED));
+    generate_to_host(g, host_data);
+
+    const double expected[points][dimensions] = {
+        { 0.0,   0.0,     0.0  },
+        { 0.5,   1.0 / 3, 0.2  },
+        { 0.25,  2.0 / 3, 0.4  },
+        { 0.75,  1.0 / 9, 0.6  },
+        { 0.125, 4.0 / 9, 0.8  },
+    };
+    for(size_t i = 0; i < points; i++)
+    {
+        for(unsigned int d = 0; d < dimensions; d++)
+        {
+            EXPECT_EQ(host_data[i * dimensions + d],
+                      static_cast<unsigned int>(expected[i][d] * 4294967296.0)) << i << " " << d;
+        }
+    }
+}
+
+// Scrambling permutes digits of every dimension except the base-2 one,
+// so scrambled points of a full cycle of the base are the same set
+TEST(rocrand_halton32_qrng_tests, scrambled_test)
+{
+    const unsigned int dimensions = 4;
+    const size_t points = 7;
+    std::vector<unsigned int> halton(points * dimensions);
+    std::vector<unsigned int> scrambled(points * dimensions);
+
+    rocrand_halton32 g0;
+    ROCRAND_CHECK(g0.set_dimensions(dimensions));
+    generate_to_host(g0, halton);
+    rocrand_scrambled_halton32 g1;
+    ROCRAND_CHECK(g1.set_dimensions(dimensions));
+    generate_to_host(g1, scrambled);
+
+    for(size_t i = 0; i < points; i++)
+    {
+        EXPECT_EQ(halton[i], scrambled[i]) << i;
+    }
+    for(unsigned int d = 1; d < dimensions; d++)
+    {
+        const size_t base = (d == 1) ? 3 : (d == 2) ? 5 : 7;
+        std::vector<unsigned int> h(halton.begin() + d * points, halton.begin() + d * points + base);
+        std::vector<unsigned int> s(scrambled.begin() + d * points, scrambled.begin() + d * points + base);
+        EXPECT_NE(h, s) << d;
+        std::sort(h.begin(), h.end());
+        std::sort(s.begin(), s.end());
+        EXPECT_EQ(h, s) << d;
+    }
+}
+
+// Continuing generation from the previous point must equal generation
+// with the corresponding offset, for any launch configuration
+TEST(rocrand_halton32_qrng_tests, state_progress_test)
+{
+    const unsigned int dimensions = 6;
+    const size_t points = 1111;
+    std::vector<unsigned int> data0(points * dimensions);
+    std::vector<unsigned int> data1(points * dimensions);
+
+    rocrand_scrambled_halton32 g0;
+    ROCRAND_CHECK(g0.set_dimensions(dimensions));
+    generate_to_host(g0, data0);
+    generate_to_host(g0, data0);
+
+    rocrand_scrambled_halton32 g1;
+    ROCRAND_CHECK(g1.set_dimensions(dimensions));
+    ROCRAND_CHECK(g1.set_launch_config(5, 64));
+    g1.set_offset(points);
+    generate_to_host(g1, data1);
+
+    EXPECT_EQ(data0, data1);
+}
+
+TEST(rocrand_halton32_qrng_tests, host_generator_test)
+{
+    const unsigned int dimensions = 11;
+    const size_t size = 1500 * dimensions;
+
+    std::vector<unsigned int> device_data(size);
+    rocrand_scrambled_halton32 g;
+    ROCRAND_CHECK(g.set_dimensions(dimensions));
+    ROCRAND_CHECK(g.set_ordering(ROCRAND_ORDERING_QUASI_INTERLEAVED));
+    generate_to_host(g, device_data);
+
+    std::vector<unsigned int> host_data(size);
+    rocrand_scrambled_halton32 h(0, 0, true);
+    ROCRAND_CHECK(h.set_dimensions(dimensions));
+    ROCRAND_CHECK(h.set_ordering(ROCRAND_ORDERING_QUASI_INTERLEAVED));
+    ROCRAND_CHECK(h.generate(host_data.data(), size));
+
+    EXPECT_EQ(device_data, host_data);
+}
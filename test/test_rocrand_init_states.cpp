@@ -0,0 +1,170 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <hip/hip_runtime.h>
+
+#define FQUALIFIERS __forceinline__ __host__ __device__
+#include <rocrand_kernel.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+template <class GeneratorState>
+__global__
+void rocrand_init_kernel(GeneratorState * states,
+                         const size_t states_size,
+                         unsigned long long seed,
+                         unsigned long long offset)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(state_id < states_size)
+    {
+        GeneratorState state;
+        rocrand_init(seed, state_id, offset, &state);
+        states[state_id] = state;
+    }
+}
+
+template<class GeneratorState>
+float normal_value(GeneratorState * state)
+{
+    return rocrand_normal(state);
+}
+
+// Small states have no saved normal values, they generate pairs
+float normal_value(rocrand_state_xoshiro128pp * state)
+{
+    return rocrand_normal2(state).x;
+}
+
+float normal_value(rocrand_state_pcg32 * state)
+{
+    return rocrand_normal2(state).x;
+}
+
+// States initialized by rocrand_init_states() generate the same values as
+// states initialized by rocrand_init() in every thread
+template<class GeneratorState>
+void init_states_test(const rocrand_rng_type rng_type)
+{
+    typedef GeneratorState state_type;
+
+    const unsigned long long seed = 0xdeadbeefbeefdeadULL;
+    const unsigned long long offset = 1234567ULL;
+    // Not a multiple of the block size
+    const size_t states_size = 3 * 256 + 77;
+
+    state_type * states;
+    HIP_CHECK(hipMalloc((void **)&states, states_size * sizeof(state_type)));
+    ROCRAND_CHECK(rocrand_init_states(states, states_size, seed, offset, rng_type, 0));
+    HIP_CHECK(hipDeviceSynchronize());
+    std::vector<state_type> output(states_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output.data(), states,
+            states_size * sizeof(state_type),
+            hipMemcpyDeviceToHost
+        )
+    );
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_init_kernel),
+        dim3(4), dim3(256), 0, 0,
+        states, states_size,
+        seed, offset
+    );
+    HIP_CHECK(hipPeekAtLastError());
+    HIP_CHECK(hipDeviceSynchronize());
+    std::vector<state_type> expected(states_size);
+    HIP_CHECK(
+        hipMemcpy(
+            expected.data(), states,
+            states_size * sizeof(state_type),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipFree(states));
+
+    for(size_t i = 0; i < states_size; i++)
+    {
+        for(unsigned int j = 0; j < 16; j++)
+        {
+            ASSERT_EQ(rocrand(&output[i]), rocrand(&expected[i]));
+        }
+        ASSERT_EQ(normal_value(&output[i]), normal_value(&expected[i]));
+    }
+}
+
+TEST(rocrand_init_states_tests, xorwow_test)
+{
+    init_states_test<rocrand_state_xorwow>(ROCRAND_RNG_PSEUDO_XORWOW);
+}
+
+TEST(rocrand_init_states_tests, mrg32k3a_test)
+{
+    init_states_test<rocrand_state_mrg32k3a>(ROCRAND_RNG_PSEUDO_MRG32K3A);
+}
+
+TEST(rocrand_init_states_tests, xoshiro128pp_test)
+{
+    init_states_test<rocrand_state_xoshiro128pp>(ROCRAND_RNG_PSEUDO_XOSHIRO128PP);
+}
+
+TEST(rocrand_init_states_tests, pcg32_test)
+{
+    init_states_test<rocrand_state_pcg32>(ROCRAND_RNG_PSEUDO_PCG32);
+}
+
+TEST(rocrand_init_states_tests, philox4x32_10_test)
+{
+    init_states_test<rocrand_state_philox4x32_10>(ROCRAND_RNG_PSEUDO_PHILOX4_32_10);
+}
+
+TEST(rocrand_init_states_tests, philox4x32_7_test)
+{
+    init_states_test<rocrand_state_philox4x32_7>(ROCRAND_RNG_PSEUDO_PHILOX4_32_7);
+}
+
+TEST(rocrand_init_states_tests, neg_test)
+{
+    rocrand_state_xorwow * states = NULL;
+    EXPECT_EQ(
+        rocrand_init_states(states, 10, 0, 0, ROCRAND_RNG_PSEUDO_XORWOW, 0),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_init_states(states, 0, 0, 0, ROCRAND_RNG_PSEUDO_XORWOW, 0),
+        ROCRAND_STATUS_SUCCESS
+    );
+    EXPECT_EQ(
+        rocrand_init_states(states, 0, 0, 0, ROCRAND_RNG_PSEUDO_MTGP32, 0),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    EXPECT_EQ(
+        rocrand_init_states(states, 0, 0, 0, ROCRAND_RNG_QUASI_SOBOL32, 0),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+}
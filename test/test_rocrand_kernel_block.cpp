@@ -0,0 +1,211 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <cmath>
+
+#include <hip/hip_runtime.h>
+
+#define FQUALIFIERS __forceinline__ __host__ __device__
+#include <rocrand_kernel.h>
+#include <rocrand_block.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+
+const unsigned long long seed = 12345ULL;
+const unsigned long long offset = 1000ULL;
+const unsigned int blocks = 3;
+const unsigned int block_size = 256;
+
+// Two consecutive fills of a shared tile of every block are copied to output
+template<unsigned int Size, unsigned int Distribution>
+__global__
+void block_fill_kernel(void * output)
+{
+    typedef typename std::conditional<
+        Distribution == 0, unsigned int,
+        typename std::conditional<Distribution == 3, double, float>::type
+    >::type T;
+    __shared__ T tile[Size];
+
+    rocrand_block_state_philox4x32_10 state;
+    rocrand_block_init(seed, hipBlockIdx_x, offset, &state);
+    T * block_output = static_cast<T *>(output) + hipBlockIdx_x * 2 * Size;
+    for(unsigned int f = 0; f < 2; f++)
+    {
+        if(Distribution == 0)
+            rocrand_block_fill<block_size, Size>(reinterpret_cast<unsigned int *>(tile), &state);
+        else if(Distribution == 1)
+            rocrand_block_fill_uniform<block_size, Size>(reinterpret_cast<float *>(tile), &state);
+        else if(Distribution == 2)
+            rocrand_block_fill_normal<block_size, Size>(reinterpret_cast<float *>(tile), &state);
+        else
+            rocrand_block_fill_uniform_double<block_size, Size>(reinterpret_cast<double *>(tile), &state);
+        __syncthreads();
+        for(unsigned int i = hipThreadIdx_x; i < Size; i += block_size)
+            block_output[f * Size + i] = tile[i];
+        __syncthreads();
+    }
+}
+
+template<unsigned int ItemsPerThread>
+__global__
+void block_generate_kernel(unsigned int * output)
+{
+    rocrand_block_state_philox4x32_10 state;
+    rocrand_block_init(seed, hipBlockIdx_x, offset, &state);
+    constexpr unsigned int size = block_size * ItemsPerThread;
+    unsigned int * block_output = output + hipBlockIdx_x * 2 * size;
+    for(unsigned int f = 0; f < 2; f++)
+    {
+        unsigned int items[ItemsPerThread];
+        rocrand_block_generate<block_size>(items, &state);
+        for(unsigned int i = 0; i < ItemsPerThread; i++)
+            block_output[f * size + hipThreadIdx_x * ItemsPerThread + i] = items[i];
+    }
+}
+
+// Values of two fills of size values of the block's sequence (rocrand_init()),
+// every fill starts at a multiple of values_per_output values
+std::vector<unsigned int> expected_values(unsigned int block, size_t size,
+                                          size_t values_per_output)
+{
+    rocrand_state_philox4x32_10 state;
+    rocrand_init(seed, block, offset, &state);
+    const size_t fill_size = (size * 4 / values_per_output + 3) / 4 * 4;
+    std::vector<unsigned int> values(2 * fill_size);
+    for(unsigned int & v : values)
+        v = rocrand(&state);
+    return values;
+}
+
+template<unsigned int Size, unsigned int Distribution, class T>
+void run_fill(std::vector<T>& output)
+{
+    output.resize(blocks * 2 * Size);
+    T * data;
+    HIP_CHECK(hipMalloc((void **)&data, output.size() * sizeof(T)));
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(block_fill_kernel<Size, Distribution>),
+        dim3(blocks), dim3(block_size), 0, 0,
+        data
+    );
+    HIP_CHECK(hipPeekAtLastError());
+    HIP_CHECK(hipMemcpy(output.data(), data, output.size() * sizeof(T), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+}
+
+template<unsigned int Size>
+void test_fill()
+{
+    std::vector<unsigned int> output;
+    run_fill<Size, 0>(output);
+    std::vector<float> uniform;
+    run_fill<Size, 1>(uniform);
+    std::vector<float> normal;
+    run_fill<Size, 2>(normal);
+
+    for(unsigned int b = 0; b < blocks; b++)
+    {
+        const std::vector<unsigned int> expected = expected_values(b, Size, 4);
+        const size_t fill_size = expected.size() / 2;
+        for(unsigned int f = 0; f < 2; f++)
+        {
+            for(unsigned int i = 0; i < Size; i++)
+            {
+                const size_t o = (b * 2 + f) * Size + i;
+                const unsigned int v = expected[f * fill_size + i];
+                ASSERT_EQ(output[o], v) << b << " " << f << " " << i;
+                ASSERT_EQ(uniform[o], rocrand_device::detail::uniform_distribution(v));
+                // Box-Muller pairs are values 2j and 2j + 1
+                const unsigned int p = f * fill_size + i / 2 * 2;
+                const float2 n = rocrand_device::detail::box_muller(expected[p], expected[p + 1]);
+                ASSERT_NEAR(normal[o], i % 2 == 0 ? n.x : n.y, 1e-4f);
+            }
+        }
+    }
+}
+
+TEST(rocrand_kernel_block, fill_test)
+{
+    // Vectorized stores
+    test_fill<block_size * 4>();
+    // Sizes not multiple of 4 and fewer values than threads
+    test_fill<1003>();
+    test_fill<10>();
+}
+
+TEST(rocrand_kernel_block, fill_double_test)
+{
+    constexpr unsigned int size = 777;
+    std::vector<double> output;
+    run_fill<size, 3>(output);
+
+    for(unsigned int b = 0; b < blocks; b++)
+    {
+        const std::vector<unsigned int> expected = expected_values(b, size, 2);
+        const size_t fill_size = expected.size() / 2;
+        for(unsigned int f = 0; f < 2; f++)
+        {
+            for(unsigned int i = 0; i < size; i++)
+            {
+                const size_t p = f * fill_size + i * 2;
+                ASSERT_EQ(
+                    output[(b * 2 + f) * size + i],
+                    rocrand_device::detail::uniform_distribution_double(expected[p], expected[p + 1])
+                ) << b << " " << f << " " << i;
+            }
+        }
+    }
+}
+
+// Registers of threads hold the values of the tile in blocked arrangement
+template<unsigned int ItemsPerThread>
+void test_generate()
+{
+    constexpr unsigned int size = block_size * ItemsPerThread;
+    std::vector<unsigned int> expected;
+    run_fill<size, 0>(expected);
+
+    std::vector<unsigned int> output(expected.size());
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, output.size() * sizeof(unsigned int)));
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(block_generate_kernel<ItemsPerThread>),
+        dim3(blocks), dim3(block_size), 0, 0,
+        data
+    );
+    HIP_CHECK(hipPeekAtLastError());
+    HIP_CHECK(hipMemcpy(output.data(), data, output.size() * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+
+    ASSERT_TRUE(output == expected);
+}
+
+TEST(rocrand_kernel_block, generate_test)
+{
+    test_generate<1>();
+    test_generate<3>();
+    test_generate<8>();
+}
@@ -0,0 +1,114 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <cmath>
+
+#include <hip/hip_runtime.h>
+
+// This translation unit is the one that defines the device tables
+#define ROCRAND_EXTERN_DEVICE_TABLES
+#define ROCRAND_DEFINE_DEVICE_TABLES
+#define FQUALIFIERS __forceinline__ __host__ __device__
+#include <rocrand_kernel.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+
+struct device_tables_result
+{
+    unsigned int xorwow;
+    unsigned int mrg32k3a;
+    float normal_ziggurat;
+    double normal_double_ziggurat;
+};
+
+// Jumps of XORWOW and MRG32k3a use precomputed matrices, the ziggurat method
+// uses precomputed layers
+FQUALIFIERS
+device_tables_result device_tables_values(const unsigned int state_id)
+{
+    const unsigned long long seed = 0xdeadbeefbeefdeadULL;
+    const unsigned long long subsequence = state_id * 7919ULL;
+    const unsigned long long offset = (state_id % 5) * 1234567891ULL + state_id;
+
+    device_tables_result result;
+
+    rocrand_state_xorwow xorwow_state;
+    rocrand_init(seed, subsequence, offset, &xorwow_state);
+    result.xorwow = rocrand(&xorwow_state);
+    result.normal_ziggurat = rocrand_normal_ziggurat(&xorwow_state);
+    result.normal_double_ziggurat = rocrand_normal_double_ziggurat(&xorwow_state);
+
+    rocrand_state_mrg32k3a mrg32k3a_state;
+    rocrand_init(seed, subsequence, offset, &mrg32k3a_state);
+    result.mrg32k3a = rocrand(&mrg32k3a_state);
+
+    return result;
+}
+
+__global__
+void device_tables_kernel(device_tables_result * output, const size_t size)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(state_id < size)
+    {
+        output[state_id] = device_tables_values(state_id);
+    }
+}
+
+// Device results (d_* tables) must match host results (h_* tables)
+TEST(rocrand_kernel_device_tables, extern_device_tables)
+{
+    const size_t output_size = 1024;
+    device_tables_result * output;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(device_tables_result)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(device_tables_kernel),
+        dim3(4), dim3(256), 0, 0,
+        output, output_size
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<device_tables_result> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(device_tables_result),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    for(unsigned int i = 0; i < output_size; i++)
+    {
+        const device_tables_result expected = device_tables_values(i);
+        ASSERT_EQ(output_host[i].xorwow, expected.xorwow) << i;
+        ASSERT_EQ(output_host[i].mrg32k3a, expected.mrg32k3a) << i;
+        ASSERT_NEAR(output_host[i].normal_ziggurat, expected.normal_ziggurat, 1e-5f) << i;
+        ASSERT_NEAR(output_host[i].normal_double_ziggurat, expected.normal_double_ziggurat, 1e-10) << i;
+    }
+}
@@ -110,6 +110,28 @@ void rocrand_normal_kernel(float * output, const size_t size)
     }
 }
 
+template <class GeneratorState>
+__global__
+void rocrand_normal_ziggurat_kernel(float * output, const size_t size)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int global_size = hipGridDim_x * hipBlockDim_x;
+
+    GeneratorState state;
+    const unsigned int subsequence = state_id;
+    rocrand_init(0, subsequence, 345ULL, &state);
+
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        if(index % 2 == 0)
+            output[index] = rocrand_normal_ziggurat(&state);
+        else
+            output[index] = static_cast<float>(rocrand_normal_double_ziggurat(&state));
+        index += global_size;
+    }
+}
+
 template <class GeneratorState>
 __global__
 void rocrand_log_normal_kernel(float * output, const size_t size)
@@ -132,6 +154,60 @@ void rocrand_log_normal_kernel(float * output, const size_t size)
     }
 }
 
+// output[8 * i] to output[8 * i + 3] are generated by rocrand_uniform4(),
+// rocrand_normal4() or rocrand_log_normal4(), output[8 * i + 4] to
+// output[8 * i + 7] by the equivalent functions returning fewer values
+template <class GeneratorState>
+__global__
+void rocrand_multi_value_kernel(float * output, const size_t size)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int global_size = hipGridDim_x * hipBlockDim_x;
+
+    GeneratorState state;
+    const unsigned int subsequence = state_id;
+    rocrand_init(0, subsequence, 567ULL, &state);
+    GeneratorState expected_state = state;
+
+    unsigned int index = state_id;
+    while(index < size / 8)
+    {
+        float4 r;
+        float4 e;
+        if(index % 3 == 0)
+        {
+            r = rocrand_uniform4(&state);
+            e.x = rocrand_uniform(&expected_state);
+            e.y = rocrand_uniform(&expected_state);
+            e.z = rocrand_uniform(&expected_state);
+            e.w = rocrand_uniform(&expected_state);
+        }
+        else if(index % 3 == 1)
+        {
+            r = rocrand_normal4(&state);
+            const float2 e1 = rocrand_normal2(&expected_state);
+            const float2 e2 = rocrand_normal2(&expected_state);
+            e = float4 { e1.x, e1.y, e2.x, e2.y };
+        }
+        else
+        {
+            r = rocrand_log_normal4(&state, 1.6f, 0.25f);
+            const float2 e1 = rocrand_log_normal2(&expected_state, 1.6f, 0.25f);
+            const float2 e2 = rocrand_log_normal2(&expected_state, 1.6f, 0.25f);
+            e = float4 { e1.x, e1.y, e2.x, e2.y };
+        }
+        output[8 * index] = r.x;
+        output[8 * index + 1] = r.y;
+        output[8 * index + 2] = r.z;
+        output[8 * index + 3] = r.w;
+        output[8 * index + 4] = e.x;
+        output[8 * index + 5] = e.y;
+        output[8 * index + 6] = e.z;
+        output[8 * index + 7] = e.w;
+        index += global_size;
+    }
+}
+
 template <class GeneratorState>
 __global__
 void rocrand_poisson_kernel(unsigned int * output, const size_t size, double lambda)
@@ -292,6 +368,50 @@ TEST(rocrand_kernel_mrg32k3a, rocrand_normal)
     EXPECT_NEAR(stddev, 1.0, 0.2);
 }
 
+TEST(rocrand_kernel_mrg32k3a, rocrand_normal_ziggurat)
+{
+    typedef rocrand_state_mrg32k3a state_type;
+
+    const size_t output_size = 8192;
+    float * output;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_normal_ziggurat_kernel<state_type>),
+        dim3(8), dim3(32), 0, 0,
+        output, output_size
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<float> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(float),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    double mean = 0;
+    for(auto v : output_host)
+    {
+        mean += static_cast<double>(v);
+    }
+    mean = mean / output_size;
+    EXPECT_NEAR(mean, 0.0, 0.2);
+
+    double stddev = 0;
+    for(auto v : output_host)
+    {
+        stddev += std::pow(static_cast<double>(v) - mean, 2);
+    }
+    stddev = stddev / output_size;
+    EXPECT_NEAR(stddev, 1.0, 0.2);
+}
+
 TEST(rocrand_kernel_mrg32k3a, rocrand_log_normal)
 {
     typedef rocrand_state_mrg32k3a state_type;
@@ -340,6 +460,44 @@ TEST(rocrand_kernel_mrg32k3a, rocrand_log_normal)
     EXPECT_NEAR(0.25, logstd, 0.25 * 0.2);
 }
 
+// Functions returning four values generate the same values as the functions
+// returning one or two values
+TEST(rocrand_kernel_mrg32k3a, rocrand_multi_value)
+{
+    typedef rocrand_state_mrg32k3a state_type;
+
+    const size_t output_size = 8 * 8192;
+    float * output;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_multi_value_kernel<state_type>),
+        dim3(4), dim3(64), 0, 0,
+        output, output_size
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<float> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(float),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    for(size_t i = 0; i < output_size; i += 8)
+    {
+        for(size_t j = 0; j < 4; j++)
+        {
+            ASSERT_EQ(output_host[i + j], output_host[i + 4 + j]);
+        }
+    }
+}
+
 class rocrand_kernel_mrg32k3a_poisson : public ::testing::TestWithParam<double> { };
 
 TEST_P(rocrand_kernel_mrg32k3a_poisson, rocrand_poisson)
@@ -59,6 +59,27 @@ void rocrand_kernel(GeneratorState * states, unsigned int * output, const size_t
     rocrand_mtgp32_block_copy(&state, &states[state_id]);
 }
 
+template <class GeneratorState>
+__global__
+void rocrand_copy_state_kernel(GeneratorState * states, unsigned int * output, const size_t size)
+{
+    const unsigned int state_id = hipBlockIdx_x;
+    unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+    __shared__ GeneratorState state;
+    rocrand_mtgp32_block_copy(&states[state_id], &state);
+
+    while(index < size)
+    {
+        output[index] = rocrand(&state);
+        index += stride;
+    }
+
+    // Parameters of states[state_id] remain valid
+    rocrand_mtgp32_block_copy_state(&state, &states[state_id]);
+}
+
 template <class GeneratorState>
 __global__
 void rocrand_uniform_kernel(GeneratorState * states, float * output, const size_t size)
@@ -149,6 +170,69 @@ void rocrand_log_normal_kernel(GeneratorState * states, float * output, const si
         states[state_id] = state;
 }
 
+// output[8 * i] to output[8 * i + 3] are generated by rocrand_uniform4(),
+// rocrand_normal4() or rocrand_log_normal4(), output[8 * i + 4] to
+// output[8 * i + 7] by the equivalent functions returning one value,
+// size / 8 must be a multiple of the number of threads
+template <class GeneratorState>
+__global__
+void rocrand_multi_value_kernel(GeneratorState * states, float * output, const size_t size)
+{
+    const unsigned int state_id = hipBlockIdx_x;
+    const unsigned int thread_id = hipThreadIdx_x;
+    unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+    __shared__ GeneratorState state;
+    __shared__ GeneratorState expected_state;
+    if (thread_id == 0)
+    {
+        state = states[state_id];
+        expected_state = states[state_id];
+    }
+    __syncthreads();
+
+    // All threads of the block call the same functions
+    for(unsigned int i = 0; index < size / 8; i++)
+    {
+        float4 r;
+        float4 e;
+        if(i % 3 == 0)
+        {
+            r = rocrand_uniform4(&state);
+            e.x = rocrand_uniform(&expected_state);
+            e.y = rocrand_uniform(&expected_state);
+            e.z = rocrand_uniform(&expected_state);
+            e.w = rocrand_uniform(&expected_state);
+        }
+        else if(i % 3 == 1)
+        {
+            r = rocrand_normal4(&state);
+            e.x = rocrand_normal(&expected_state);
+            e.y = rocrand_normal(&expected_state);
+            e.z = rocrand_normal(&expected_state);
+            e.w = rocrand_normal(&expected_state);
+        }
+        else
+        {
+            r = rocrand_log_normal4(&state, 1.6f, 0.25f);
+            e.x = rocrand_log_normal(&expected_state, 1.6f, 0.25f);
+            e.y = rocrand_log_normal(&expected_state, 1.6f, 0.25f);
+            e.z = rocrand_log_normal(&expected_state, 1.6f, 0.25f);
+            e.w = rocrand_log_normal(&expected_state, 1.6f, 0.25f);
+        }
+        output[8 * index] = r.x;
+        output[8 * index + 1] = r.y;
+        output[8 * index + 2] = r.z;
+        output[8 * index + 3] = r.w;
+        output[8 * index + 4] = e.x;
+        output[8 * index + 5] = e.y;
+        output[8 * index + 6] = e.z;
+        output[8 * index + 7] = e.w;
+        index += stride;
+    }
+}
+
 template <class GeneratorState>
 __global__
 void rocrand_poisson_kernel(GeneratorState * states, unsigned int * output, const size_t size, double lambda)
@@ -227,6 +311,62 @@ TEST(rocrand_kernel_mtgp32, rocrand)
     EXPECT_NEAR(mean, 0.5, 0.1);
 }
 
+// Saving only states produces the same values as saving whole engines
+TEST(rocrand_kernel_mtgp32, rocrand_mtgp32_block_copy_state)
+{
+    typedef rocrand_state_mtgp32 state_type;
+
+    const size_t output_size = 8 * 256 * 10;
+    unsigned int * output;
+    HIP_CHECK(hipMalloc((void **)&output, 2 * output_size * sizeof(unsigned int)));
+    state_type * states;
+    HIP_CHECK(hipMalloc(&states, sizeof(state_type) * 8));
+
+    std::vector<unsigned int> expected(2 * output_size);
+    ROCRAND_CHECK(rocrand_make_state_mtgp32(states, mtgp32dc_params_fast_11213, 8, 0));
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_kernel<state_type>),
+        dim3(8), dim3(256), 0, 0,
+        states, output, 2 * output_size
+    );
+    HIP_CHECK(hipPeekAtLastError());
+    HIP_CHECK(
+        hipMemcpy(
+            expected.data(), output,
+            2 * output_size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+
+    std::vector<unsigned int> output_host(2 * output_size);
+    ROCRAND_CHECK(rocrand_make_state_mtgp32(states, mtgp32dc_params_fast_11213, 8, 0));
+    for(size_t call = 0; call < 2; call++)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_copy_state_kernel<state_type>),
+            dim3(8), dim3(256), 0, 0,
+            states, output + call * output_size, output_size
+        );
+        HIP_CHECK(hipPeekAtLastError());
+    }
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            2 * output_size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+    HIP_CHECK(hipFree(states));
+
+    // Both kernels generate blocks of 8 * 256 values in the same order
+    for(size_t i = 0; i < 2 * output_size; i++)
+    {
+        ASSERT_EQ(output_host[i], expected[i]);
+    }
+}
+
 TEST(rocrand_kernel_mtgp32, rocrand_uniform)
 {
     typedef rocrand_state_mtgp32 state_type;
@@ -373,6 +513,50 @@ TEST(rocrand_kernel_mtgp32, rocrand_log_normal)
     EXPECT_NEAR(0.25, logstd, 0.25 * 0.2);
 }
 
+// Functions returning four values generate the same values as four calls
+// of the functions returning one value
+TEST(rocrand_kernel_mtgp32, rocrand_multi_value)
+{
+    typedef rocrand_state_mtgp32 state_type;
+
+    state_type * states;
+    hipMalloc(&states, sizeof(state_type) * 8);
+
+    ROCRAND_CHECK(rocrand_make_state_mtgp32(states, mtgp32dc_params_fast_11213, 8, 0));
+
+    const size_t output_size = 8 * 8192;
+    float * output;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_multi_value_kernel<state_type>),
+        dim3(8), dim3(256), 0, 0,
+        states, output, output_size
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<float> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(float),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+    HIP_CHECK(hipFree(states));
+
+    for(size_t i = 0; i < output_size; i += 8)
+    {
+        for(size_t j = 0; j < 4; j++)
+        {
+            ASSERT_EQ(output_host[i + j], output_host[i + 4 + j]);
+        }
+    }
+}
+
 class rocrand_kernel_mtgp32_poisson : public ::testing::TestWithParam<double> { };
 
 TEST_P(rocrand_kernel_mtgp32_poisson, rocrand_poisson)
@@ -0,0 +1,436 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <climits>
+#include <vector>
+#include <cmath>
+
+#include <hip/hip_runtime.h>
+
+#define FQUALIFIERS __forceinline__ __host__ __device__
+#include <rocrand_kernel.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+template <class GeneratorState>
+__global__
+void rocrand_kernel(unsigned int * output, const size_t size)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int global_size = hipGridDim_x * hipBlockDim_x;
+
+    GeneratorState state;
+    const unsigned int subsequence = state_id;
+    rocrand_init(0, subsequence, 123ULL, &state);
+
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        output[index] = rocrand(&state);
+        index += global_size;
+    }
+}
+
+template <class GeneratorState>
+__global__
+void rocrand_uniform_kernel(float * output, const size_t size)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int global_size = hipGridDim_x * hipBlockDim_x;
+
+    GeneratorState state;
+    const unsigned int subsequence = state_id;
+    rocrand_init(0, subsequence, 234ULL, &state);
+
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        output[index] = rocrand_uniform(&state);
+        index += global_size;
+    }
+}
+
+template <class GeneratorState>
+__global__
+void rocrand_normal2_kernel(float * output, const size_t size)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int global_size = hipGridDim_x * hipBlockDim_x;
+
+    GeneratorState state;
+    const unsigned int subsequence = state_id;
+    rocrand_init(0, subsequence, 345ULL, &state);
+
+    unsigned int index = state_id;
+    while(index < size / 2)
+    {
+        float2 r = rocrand_normal2(&state);
+        output[2 * index] = r.x;
+        output[2 * index + 1] = r.y;
+        index += global_size;
+    }
+}
+
+template <class GeneratorState>
+__global__
+void rocrand_discrete_kernel(unsigned int * output, const size_t size, rocrand_discrete_distribution discrete_distribution)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int global_size = hipGridDim_x * hipBlockDim_x;
+
+    GeneratorState state;
+    const unsigned int subsequence = state_id;
+    rocrand_init(0, subsequence, 456ULL, &state);
+
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        output[index] = rocrand_discrete(&state, discrete_distribution);
+        index += global_size;
+    }
+}
+
+// Every thread skips ahead its own state, output[2 * i] is generated by the
+// state of rocrand_init() with the subsequence and offset, output[2 * i + 1]
+// by the state skipped ahead from subsequence 0 and offset 0
+template <class GeneratorState>
+__global__
+void rocrand_skipahead_kernel(unsigned int * output, unsigned long long seed)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned long long subsequence = state_id * 7919ULL;
+    const unsigned long long offset = (state_id % 3) * 123456789ULL + state_id;
+
+    GeneratorState state;
+    rocrand_init(seed, subsequence, offset, &state);
+    output[2 * state_id] = rocrand(&state);
+    rocrand_init(seed, 0, 0, &state);
+    skipahead(offset, &state);
+    skipahead_subsequence(subsequence, &state);
+    output[2 * state_id + 1] = rocrand(&state);
+}
+
+TEST(rocrand_kernel_pcg32, rocrand_state_pcg32_type)
+{
+    EXPECT_EQ(sizeof(rocrand_state_pcg32), 2 * sizeof(unsigned long long));
+    EXPECT_EQ(sizeof(rocrand_state_pcg32[32]), 32 * sizeof(rocrand_state_pcg32));
+}
+
+// Known answers of pcg32_srandom_r(42, 0) of the reference implementation
+TEST(rocrand_kernel_pcg32, known_answer)
+{
+    rocrand_state_pcg32 state;
+    rocrand_init(42ULL, 0, 0, &state);
+    EXPECT_EQ(rocrand(&state), 0x21b756eeU);
+    EXPECT_EQ(rocrand(&state), 0xc15ef750U);
+    EXPECT_EQ(rocrand(&state), 0x9548a9bdU);
+    EXPECT_EQ(rocrand(&state), 0x35db428dU);
+    EXPECT_EQ(rocrand(&state), 0xf0071649U);
+    EXPECT_EQ(rocrand(&state), 0xa243807fU);
+}
+
+// Skipping ahead by subsequences moves the state to another stream at the same
+// position, in any order with skipping ahead by offsets
+TEST(rocrand_kernel_pcg32, skipahead_subsequence_host)
+{
+    const unsigned long long subsequences[] = { 1, 2, 1000, 123456789 };
+    for(unsigned long long subsequence : subsequences)
+    {
+        rocrand_state_pcg32 expected;
+        rocrand_init(12345ULL, subsequence + 5, 678, &expected);
+        rocrand_state_pcg32 state;
+        rocrand_init(12345ULL, 5, 0, &state);
+        skipahead_subsequence(subsequence, &state);
+        skipahead(678, &state);
+        for(unsigned int i = 0; i < 16; i++)
+        {
+            ASSERT_EQ(rocrand(&state), rocrand(&expected)) << subsequence;
+        }
+    }
+}
+
+// Streams are not multiples of one sequence at the same position: values of
+// streams of adjacent engines (0 and 1) and of increments 1 and 2^63 + 1 are
+// uncorrelated
+TEST(rocrand_kernel_pcg32, streams_correlation_host)
+{
+    const size_t size = 400000;
+    const unsigned long long stream_pairs[][2] = {
+        { 0, 1 }, { 0, 1ULL << 62 }, { 5, 6 }
+    };
+    for(const auto& streams : stream_pairs)
+    {
+        rocrand_state_pcg32 state0;
+        rocrand_state_pcg32 state1;
+        rocrand_init(0xdeadbeefULL, streams[0], 0, &state0);
+        rocrand_init(0xdeadbeefULL, streams[1], 0, &state1);
+
+        double sum0 = 0, sum1 = 0, sum01 = 0, sum00 = 0, sum11 = 0;
+        for(size_t i = 0; i < size; i++)
+        {
+            const double x0 = rocrand_uniform_double(&state0);
+            const double x1 = rocrand_uniform_double(&state1);
+            sum0 += x0;
+            sum1 += x1;
+            sum01 += x0 * x1;
+            sum00 += x0 * x0;
+            sum11 += x1 * x1;
+        }
+        const double mean0 = sum0 / size;
+        const double mean1 = sum1 / size;
+        const double correlation = (sum01 / size - mean0 * mean1)
+            / std::sqrt((sum00 / size - mean0 * mean0) * (sum11 / size - mean1 * mean1));
+        // 5 standard deviations of the sample correlation of independent values
+        EXPECT_LT(std::abs(correlation), 5.0 / std::sqrt(static_cast<double>(size)))
+            << streams[0] << " " << streams[1];
+    }
+}
+
+TEST(rocrand_kernel_pcg32, rocrand_init_skipahead)
+{
+    const size_t states_size = 4 * 96;
+    unsigned int * output;
+    HIP_CHECK(hipMalloc((void **)&output, 2 * states_size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_skipahead_kernel<rocrand_state_pcg32>),
+        dim3(4), dim3(96), 0, 0,
+        output, 0xdeadbeefbeefdeadULL
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<unsigned int> output_host(2 * states_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            2 * states_size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    for(size_t si = 0; si < states_size; si++)
+    {
+        ASSERT_EQ(output_host[2 * si], output_host[2 * si + 1]);
+    }
+}
+
+// Skipping ahead by offsets with jumps is the same as generating values
+TEST(rocrand_kernel_pcg32, skipahead_host)
+{
+    const unsigned long long offsets[] = { 1, 127, 128, 129, 1000, 33333 };
+    for(unsigned long long offset : offsets)
+    {
+        rocrand_state_pcg32 state;
+        rocrand_init(12345ULL, 3, 0, &state);
+        rocrand_state_pcg32 skipped = state;
+        skipahead(offset, &skipped);
+        for(unsigned long long i = 0; i < offset; i++)
+        {
+            rocrand(&state);
+        }
+        for(unsigned int i = 0; i < 16; i++)
+        {
+            ASSERT_EQ(rocrand(&state), rocrand(&skipped)) << offset;
+        }
+    }
+}
+
+TEST(rocrand_kernel_pcg32, rocrand)
+{
+    typedef rocrand_state_pcg32 state_type;
+
+    const size_t output_size = 8192;
+    unsigned int * output;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_kernel<state_type>),
+        dim3(4), dim3(64), 0, 0,
+        output, output_size
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<unsigned int> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    double mean = 0;
+    for(auto v : output_host)
+    {
+        mean += static_cast<double>(v) / UINT_MAX;
+    }
+    mean = mean / output_size;
+    EXPECT_NEAR(mean, 0.5, 0.1);
+}
+
+TEST(rocrand_kernel_pcg32, rocrand_uniform)
+{
+    typedef rocrand_state_pcg32 state_type;
+
+    const size_t output_size = 8192;
+    float * output;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_uniform_kernel<state_type>),
+        dim3(4), dim3(64), 0, 0,
+        output, output_size
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<float> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(float),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    double mean = 0;
+    for(auto v : output_host)
+    {
+        mean += static_cast<double>(v);
+    }
+    mean = mean / output_size;
+    EXPECT_NEAR(mean, 0.5, 0.1);
+}
+
+TEST(rocrand_kernel_pcg32, rocrand_normal2)
+{
+    typedef rocrand_state_pcg32 state_type;
+
+    const size_t output_size = 8192;
+    float * output;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_normal2_kernel<state_type>),
+        dim3(4), dim3(64), 0, 0,
+        output, output_size
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<float> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(float),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    double mean = 0;
+    for(auto v : output_host)
+    {
+        mean += static_cast<double>(v);
+    }
+    mean = mean / output_size;
+    EXPECT_NEAR(mean, 0.0, 0.2);
+
+    double stddev = 0;
+    for(auto v : output_host)
+    {
+        stddev += std::pow(static_cast<double>(v) - mean, 2);
+    }
+    stddev = stddev / output_size;
+    EXPECT_NEAR(stddev, 1.0, 0.2);
+}
+
+class rocrand_kernel_pcg32_poisson : public ::testing::TestWithParam<double> { };
+
+TEST_P(rocrand_kernel_pcg32_poisson, rocrand_discrete)
+{
+    typedef rocrand_state_pcg32 state_type;
+
+    const double lambda = GetParam();
+
+    const size_t output_size = 8192;
+    unsigned int * output;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    rocrand_discrete_distribution discrete_distribution;
+    ROCRAND_CHECK(rocrand_create_poisson_distribution(lambda, &discrete_distribution));
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_discrete_kernel<state_type>),
+        dim3(4), dim3(64), 0, 0,
+        output, output_size, discrete_distribution
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<unsigned int> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+    ROCRAND_CHECK(rocrand_destroy_discrete_distribution(discrete_distribution));
+
+    double mean = 0;
+    for(auto v : output_host)
+    {
+        mean += static_cast<double>(v);
+    }
+    mean = mean / output_size;
+
+    double variance = 0;
+    for(auto v : output_host)
+    {
+        variance += std::pow(v - mean, 2);
+    }
+    variance = variance / output_size;
+
+    EXPECT_NEAR(mean, lambda, std::max(1.0, lambda * 1e-1));
+    EXPECT_NEAR(variance, lambda, std::max(1.0, lambda * 1e-1));
+}
+
+const double lambdas[] = { 1.0, 5.5, 20.0, 100.0, 1234.5, 5000.0 };
+
+INSTANTIATE_TEST_CASE_P(rocrand_kernel_pcg32_poisson,
+                        rocrand_kernel_pcg32_poisson,
+                        ::testing::ValuesIn(lambdas));
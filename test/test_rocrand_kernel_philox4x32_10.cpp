@@ -23,6 +23,7 @@
 
 #include <vector>
 #include <cmath>
+#include <cstddef>
 
 #include <hip/hip_runtime.h>
 
@@ -117,6 +118,28 @@ void rocrand_normal_kernel(float * output, const size_t size)
     }
 }
 
+template <class GeneratorState>
+__global__
+void rocrand_normal_ziggurat_kernel(float * output, const size_t size)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int global_size = hipGridDim_x * hipBlockDim_x;
+
+    GeneratorState state;
+    const unsigned int subsequence = state_id;
+    rocrand_init(0, subsequence, 345ULL, &state);
+
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        if(index % 2 == 0)
+            output[index] = rocrand_normal_ziggurat(&state);
+        else
+            output[index] = static_cast<float>(rocrand_normal_double_ziggurat(&state));
+        index += global_size;
+    }
+}
+
 template <class GeneratorState>
 __global__
 void rocrand_log_normal_kernel(float * output, const size_t size)
@@ -373,6 +396,50 @@ TEST(rocrand_kernel_philox4x32_10, rocrand_normal)
     EXPECT_NEAR(stddev, 1.0, 0.2);
 }
 
+TEST(rocrand_kernel_philox4x32_10, rocrand_normal_ziggurat)
+{
+    typedef rocrand_state_philox4x32_10 state_type;
+
+    const size_t output_size = 8192;
+    float * output;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_normal_ziggurat_kernel<state_type>),
+        dim3(8), dim3(32), 0, 0,
+        output, output_size
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<float> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(float),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    double mean = 0;
+    for(auto v : output_host)
+    {
+        mean += static_cast<double>(v);
+    }
+    mean = mean / output_size;
+    EXPECT_NEAR(mean, 0.0, 0.2);
+
+    double stddev = 0;
+    for(auto v : output_host)
+    {
+        stddev += std::pow(static_cast<double>(v) - mean, 2);
+    }
+    stddev = stddev / output_size;
+    EXPECT_NEAR(stddev, 1.0, 0.2);
+}
+
 TEST(rocrand_kernel_philox4x32_10, rocrand_log_normal)
 {
     typedef rocrand_state_philox4x32_10 state_type;
@@ -526,3 +593,39 @@ const double lambdas[] = { 1.0, 5.5, 20.0, 100.0, 1234.5, 5000.0 };
 INSTANTIATE_TEST_CASE_P(rocrand_kernel_philox4x32_10_poisson,
                         rocrand_kernel_philox4x32_10_poisson,
                         ::testing::ValuesIn(lambdas));
+
+TEST(rocrand_kernel_philox4x32_10, rocrand_discrete_layout)
+{
+    // Fields of the original structure keep their offsets
+    EXPECT_EQ(offsetof(rocrand_discrete_distribution_st, alias), 8U);
+    EXPECT_EQ(offsetof(rocrand_discrete_distribution_st, probability), 8U + sizeof(void *));
+    EXPECT_EQ(offsetof(rocrand_discrete_distribution_st, cdf), 8U + 2 * sizeof(void *));
+    // New fields are appended after them
+    const size_t original_size = 8U + 3 * sizeof(void *);
+    EXPECT_GE(offsetof(rocrand_discrete_distribution_st, alias_table), original_size);
+    EXPECT_GE(offsetof(rocrand_discrete_distribution_st, guide), original_size);
+    EXPECT_GE(offsetof(rocrand_discrete_distribution_st, guide_bits), original_size);
+}
+
+TEST(rocrand_kernel_philox4x32_10, rocrand_discrete_without_packed_table)
+{
+    // Distributions built by hand have no packed alias table and no guide
+    unsigned int alias[4] = { 1, 0, 1, 2 };
+    double probability[4] = { 0.5, 1.0, 0.25, 0.75 };
+    rocrand_discrete_distribution_st dis = {};
+    dis.size = 4;
+    dis.offset = 10;
+    dis.alias = alias;
+    dis.probability = probability;
+
+    rocrand_state_philox4x32_10 state;
+    rocrand_init(5ULL, 0, 0, &state);
+    for(unsigned int i = 0; i < 10000; i++)
+    {
+        const unsigned int r = rocrand(&state);
+        ASSERT_EQ(
+            rocrand_device::detail::discrete_alias(r, dis),
+            rocrand_device::detail::discrete_alias(r * ROCRAND_2POW32_INV_DOUBLE, dis)
+        );
+    }
+}
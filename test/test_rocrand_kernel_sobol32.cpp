@@ -134,6 +134,25 @@ void rocrand_poisson_kernel(unsigned int * output, unsigned int * vectors, const
     }
 }
 
+// Every block generates values of dimension hipBlockIdx_y, threads leap frog
+// through the points of the dimension
+__global__
+void rocrand_block_kernel(unsigned int * output, const unsigned int * vectors,
+                          const unsigned int offset, const size_t size)
+{
+    __shared__ unsigned int shared[32];
+    const unsigned int dimension = hipBlockIdx_y;
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+    rocrand_state_sobol32_block state;
+    rocrand_init_block(vectors + dimension * 32, offset + state_id, &state, shared);
+    for(unsigned int i = state_id; i < size; i += stride)
+    {
+        output[dimension * size + i] = rocrand_strided(&state, stride);
+    }
+}
+
 TEST(rocrand_kernel_sobol32, rocrand_state_sobol32_type)
 {
     EXPECT_EQ(sizeof(rocrand_state_sobol32), 34 * sizeof(unsigned int));
@@ -388,3 +407,54 @@ const double lambdas[] = { 1.0, 5.5, 20.0, 100.0, 1234.5, 5000.0 };
 INSTANTIATE_TEST_CASE_P(rocrand_kernel_sobol32_poisson,
                         rocrand_kernel_sobol32_poisson,
                         ::testing::ValuesIn(lambdas));
+
+TEST(rocrand_kernel_sobol32, rocrand_init_block)
+{
+    const unsigned int dimensions = 8;
+    const size_t size = 10000;
+    const unsigned int offset = 1234;
+    const size_t output_size = dimensions * size;
+    unsigned int * output;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(unsigned int)));
+
+    unsigned int * m_vector;
+    HIP_CHECK(hipMalloc(&m_vector, sizeof(unsigned int) * dimensions * 32));
+    HIP_CHECK(hipMemcpy(m_vector, h_sobol32_direction_vectors, sizeof(unsigned int) * dimensions * 32, hipMemcpyHostToDevice));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Power-of-2 and arbitrary strides
+    const unsigned int configs[][2] = { { 4, 64 }, { 3, 96 }, { 1, 1 } };
+    for(auto config : configs)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_block_kernel),
+            dim3(config[0], dimensions), dim3(config[1]), 0, 0,
+            output, m_vector, offset, size
+        );
+        HIP_CHECK(hipPeekAtLastError());
+
+        std::vector<unsigned int> output_host(output_size);
+        HIP_CHECK(
+            hipMemcpy(
+                output_host.data(), output,
+                output_size * sizeof(unsigned int),
+                hipMemcpyDeviceToHost
+            )
+        );
+        HIP_CHECK(hipDeviceSynchronize());
+
+        for(unsigned int d = 0; d < dimensions; d++)
+        {
+            rocrand_state_sobol32 state;
+            rocrand_init(h_sobol32_direction_vectors + d * 32, offset, &state);
+            for(size_t i = 0; i < size; i++)
+            {
+                ASSERT_EQ(output_host[d * size + i], rocrand(&state))
+                    << config[0] << "x" << config[1] << " " << d << " " << i;
+            }
+        }
+    }
+
+    HIP_CHECK(hipFree(output));
+    HIP_CHECK(hipFree(m_vector));
+}
@@ -50,6 +50,24 @@ void rocrand_init_kernel(GeneratorState * states,
     }
 }
 
+// Every thread of the block has its own subsequence and offset, output[2 * i]
+// is generated by the state of rocrand_init(), output[2 * i + 1] by the state
+// of rocrand_init_block()
+__global__
+void rocrand_init_block_kernel(unsigned int * output, unsigned long long seed)
+{
+    __shared__ unsigned int shared[XORWOW_SIZE];
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned long long subsequence = state_id * 7919ULL;
+    const unsigned long long offset = (state_id % 3) * 123456789ULL + state_id;
+
+    rocrand_state_xorwow state;
+    rocrand_init(seed, subsequence, offset, &state);
+    output[2 * state_id] = rocrand(&state);
+    rocrand_init_block(seed, subsequence, offset, &state, shared);
+    output[2 * state_id + 1] = rocrand(&state);
+}
+
 template <class GeneratorState>
 __global__
 void rocrand_kernel(unsigned int * output, const size_t size)
@@ -112,6 +130,28 @@ void rocrand_normal_kernel(float * output, const size_t size)
     }
 }
 
+template <class GeneratorState>
+__global__
+void rocrand_normal_ziggurat_kernel(float * output, const size_t size)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int global_size = hipGridDim_x * hipBlockDim_x;
+
+    GeneratorState state;
+    const unsigned int subsequence = state_id;
+    rocrand_init(0, subsequence, 345ULL, &state);
+
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        if(index % 2 == 0)
+            output[index] = rocrand_normal_ziggurat(&state);
+        else
+            output[index] = static_cast<float>(rocrand_normal_double_ziggurat(&state));
+        index += global_size;
+    }
+}
+
 template <class GeneratorState>
 __global__
 void rocrand_log_normal_kernel(float * output, const size_t size)
@@ -136,6 +176,60 @@ void rocrand_log_normal_kernel(float * output, const size_t size)
     }
 }
 
+// output[8 * i] to output[8 * i + 3] are generated by rocrand_uniform4(),
+// rocrand_normal4() or rocrand_log_normal4(), output[8 * i + 4] to
+// output[8 * i + 7] by the equivalent functions returning fewer values
+template <class GeneratorState>
+__global__
+void rocrand_multi_value_kernel(float * output, const size_t size)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int global_size = hipGridDim_x * hipBlockDim_x;
+
+    GeneratorState state;
+    const unsigned int subsequence = state_id;
+    rocrand_init(0, subsequence, 567ULL, &state);
+    GeneratorState expected_state = state;
+
+    unsigned int index = state_id;
+    while(index < size / 8)
+    {
+        float4 r;
+        float4 e;
+        if(index % 3 == 0)
+        {
+            r = rocrand_uniform4(&state);
+            e.x = rocrand_uniform(&expected_state);
+            e.y = rocrand_uniform(&expected_state);
+            e.z = rocrand_uniform(&expected_state);
+            e.w = rocrand_uniform(&expected_state);
+        }
+        else if(index % 3 == 1)
+        {
+            r = rocrand_normal4(&state);
+            const float2 e1 = rocrand_normal2(&expected_state);
+            const float2 e2 = rocrand_normal2(&expected_state);
+            e = float4 { e1.x, e1.y, e2.x, e2.y };
+        }
+        else
+        {
+            r = rocrand_log_normal4(&state, 1.6f, 0.25f);
+            const float2 e1 = rocrand_log_normal2(&expected_state, 1.6f, 0.25f);
+            const float2 e2 = rocrand_log_normal2(&expected_state, 1.6f, 0.25f);
+            e = float4 { e1.x, e1.y, e2.x, e2.y };
+        }
+        output[8 * index] = r.x;
+        output[8 * index + 1] = r.y;
+        output[8 * index + 2] = r.z;
+        output[8 * index + 3] = r.w;
+        output[8 * index + 4] = e.x;
+        output[8 * index + 5] = e.y;
+        output[8 * index + 6] = e.z;
+        output[8 * index + 7] = e.w;
+        index += global_size;
+    }
+}
+
 template <class GeneratorState>
 __global__
 void rocrand_poisson_kernel(unsigned int * output, const size_t size, double lambda)
@@ -174,12 +268,39 @@ void rocrand_discrete_kernel(unsigned int * output, const size_t size, rocrand_d
     }
 }
 
+template <class GeneratorState>
+__global__
+void rocrand_normal2_kernel(float * output, const size_t size)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int global_size = hipGridDim_x * hipBlockDim_x;
+
+    GeneratorState state;
+    const unsigned int subsequence = state_id;
+    rocrand_init(0, subsequence, 123ULL, &state);
+
+    unsigned int index = state_id;
+    while(index < size / 2)
+    {
+        float2 r = rocrand_normal2(&state);
+        output[2 * index] = r.x;
+        output[2 * index + 1] = r.y;
+        index += global_size;
+    }
+}
+
 TEST(rocrand_kernel_xorwow, rocrand_state_xorwow_type)
 {
     EXPECT_EQ(sizeof(rocrand_state_xorwow), 12 * sizeof(unsigned int));
     EXPECT_EQ(sizeof(rocrand_state_xorwow[32]), 32 * sizeof(rocrand_state_xorwow));
 }
 
+TEST(rocrand_kernel_xorwow, rocrand_state_xorwow_compact_type)
+{
+    EXPECT_EQ(sizeof(rocrand_state_xorwow_compact), 6 * sizeof(unsigned int));
+    EXPECT_EQ(sizeof(rocrand_state_xorwow_compact[32]), 32 * sizeof(rocrand_state_xorwow_compact));
+}
+
 TEST(rocrand_kernel_xorwow, rocrand_init)
 {
     // Just get access to internal state
@@ -242,6 +363,37 @@ TEST(rocrand_kernel_xorwow, rocrand_init)
     }
 }
 
+TEST(rocrand_kernel_xorwow, rocrand_init_block)
+{
+    const size_t states_size = 4 * 96;
+    unsigned int * output;
+    HIP_CHECK(hipMalloc((void **)&output, 2 * states_size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_init_block_kernel),
+        dim3(4), dim3(96), 0, 0,
+        output, 0xdeadbeefbeefdeadULL
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<unsigned int> output_host(2 * states_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            2 * states_size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    for(size_t si = 0; si < states_size; si++)
+    {
+        ASSERT_EQ(output_host[2 * si], output_host[2 * si + 1]);
+    }
+}
+
 TEST(rocrand_kernel_xorwow, rocrand)
 {
     typedef rocrand_state_xorwow state_type;
@@ -358,6 +510,50 @@ TEST(rocrand_kernel_xorwow, rocrand_normal)
     EXPECT_NEAR(stddev, 1.0, 0.2);
 }
 
+TEST(rocrand_kernel_xorwow, rocrand_normal_ziggurat)
+{
+    typedef rocrand_state_xorwow state_type;
+
+    const size_t output_size = 8192;
+    float * output;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_normal_ziggurat_kernel<state_type>),
+        dim3(4), dim3(64), 0, 0,
+        output, output_size
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<float> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(float),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    double mean = 0;
+    for(auto v : output_host)
+    {
+        mean += static_cast<double>(v);
+    }
+    mean = mean / output_size;
+    EXPECT_NEAR(mean, 0.0, 0.2);
+
+    double stddev = 0;
+    for(auto v : output_host)
+    {
+        stddev += std::pow(static_cast<double>(v) - mean, 2);
+    }
+    stddev = stddev / output_size;
+    EXPECT_NEAR(stddev, 1.0, 0.2);
+}
+
 TEST(rocrand_kernel_xorwow, rocrand_log_normal)
 {
     typedef rocrand_state_xorwow state_type;
@@ -406,6 +602,44 @@ TEST(rocrand_kernel_xorwow, rocrand_log_normal)
     EXPECT_NEAR(0.25, logstd, 0.25 * 0.2);
 }
 
+// Functions returning four values generate the same values as the functions
+// returning one or two values
+TEST(rocrand_kernel_xorwow, rocrand_multi_value)
+{
+    typedef rocrand_state_xorwow state_type;
+
+    const size_t output_size = 8 * 8192;
+    float * output;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_multi_value_kernel<state_type>),
+        dim3(4), dim3(64), 0, 0,
+        output, output_size
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<float> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(float),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    for(size_t i = 0; i < output_size; i += 8)
+    {
+        for(size_t j = 0; j < 4; j++)
+        {
+            ASSERT_EQ(output_host[i + j], output_host[i + 4 + j]);
+        }
+    }
+}
+
 class rocrand_kernel_xorwow_poisson : public ::testing::TestWithParam<double> { };
 
 TEST_P(rocrand_kernel_xorwow_poisson, rocrand_poisson)
@@ -506,7 +740,141 @@ TEST_P(rocrand_kernel_xorwow_poisson, rocrand_discrete)
     EXPECT_NEAR(variance, lambda, std::max(1.0, lambda * 1e-1));
 }
 
-const double lambdas[] = { 1.0, 5.5, 20.0, 100.0, 1234.5, 5000.0 };
+TEST(rocrand_kernel_xorwow, rocrand_discrete_device)
+{
+    typedef rocrand_state_xorwow state_type;
+
+    // Probabilities of values are proportional to (value % 10), more than
+    // one block of values is required for tables construction
+    const unsigned int size = 1000;
+    const unsigned int offset = 10;
+    std::vector<double> probabilities(size);
+    for(unsigned int i = 0; i < size; i++)
+    {
+        probabilities[i] = (i % 10) * 0.25;
+    }
+    double * d_probabilities;
+    HIP_CHECK(hipMalloc((void **)&d_probabilities, size * sizeof(double)));
+    HIP_CHECK(
+        hipMemcpy(
+            d_probabilities, probabilities.data(),
+            size * sizeof(double),
+            hipMemcpyHostToDevice
+        )
+    );
+
+    rocrand_discrete_distribution discrete_distribution;
+    ROCRAND_CHECK(
+        rocrand_create_discrete_distribution_device(
+            d_probabilities, size, offset, &discrete_distribution
+        )
+    );
+    HIP_CHECK(hipFree(d_probabilities));
+
+    const size_t output_size = 1 << 18;
+    unsigned int * output;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_discrete_kernel<state_type>),
+        dim3(4), dim3(64), 0, 0,
+        output, output_size, discrete_distribution
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<unsigned int> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+    ROCRAND_CHECK(rocrand_destroy_discrete_distribution(discrete_distribution));
+
+    std::vector<double> histogram(10, 0.0);
+    for(auto v : output_host)
+    {
+        ASSERT_GE(v, offset);
+        ASSERT_LT(v, offset + size);
+        histogram[(v - offset) % 10] += 1.0;
+    }
+    for(unsigned int r = 0; r < 10; r++)
+    {
+        EXPECT_NEAR(histogram[r] / output_size, r / 45.0, 0.01);
+    }
+    // Values with zero probability are never generated
+    EXPECT_EQ(histogram[0], 0.0);
+}
+
+template<class T>
+void compact_state_test(void (*full_kernel)(T *, const size_t),
+                        void (*compact_kernel)(T *, const size_t))
+{
+    const size_t output_size = 8192;
+    T * output;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(T)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<T> expected(output_size);
+    hipLaunchKernelGGL(
+        full_kernel,
+        dim3(4), dim3(64), 0, 0,
+        output, output_size
+    );
+    HIP_CHECK(hipPeekAtLastError());
+    HIP_CHECK(
+        hipMemcpy(
+            expected.data(), output,
+            output_size * sizeof(T),
+            hipMemcpyDeviceToHost
+        )
+    );
+
+    std::vector<T> output_host(output_size);
+    hipLaunchKernelGGL(
+        compact_kernel,
+        dim3(4), dim3(64), 0, 0,
+        output, output_size
+    );
+    HIP_CHECK(hipPeekAtLastError());
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(T),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    for(size_t i = 0; i < output_size; i++)
+    {
+        ASSERT_EQ(output_host[i], expected[i]);
+    }
+}
+
+// The compact state generates the same sequences as the full state
+TEST(rocrand_kernel_xorwow, rocrand_state_xorwow_compact)
+{
+    compact_state_test<unsigned int>(
+        rocrand_kernel<rocrand_state_xorwow>,
+        rocrand_kernel<rocrand_state_xorwow_compact>
+    );
+    compact_state_test<float>(
+        rocrand_uniform_kernel<rocrand_state_xorwow>,
+        rocrand_uniform_kernel<rocrand_state_xorwow_compact>
+    );
+    compact_state_test<float>(
+        rocrand_normal2_kernel<rocrand_state_xorwow>,
+        rocrand_normal2_kernel<rocrand_state_xorwow_compact>
+    );
+}
+
+const double lambdas[] = { 1.0, 5.5, 10.0, 20.0, 63.5, 100.0, 1234.5, 5000.0 };
 
 INSTANTIATE_TEST_CASE_P(rocrand_kernel_xorwow_poisson,
                         rocrand_kernel_xorwow_poisson,
@@ -0,0 +1,406 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <climits>
+#include <vector>
+#include <cmath>
+
+#include <hip/hip_runtime.h>
+
+#define FQUALIFIERS __forceinline__ __host__ __device__
+#include <rocrand_kernel.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+template <class GeneratorState>
+__global__
+void rocrand_kernel(unsigned int * output, const size_t size)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int global_size = hipGridDim_x * hipBlockDim_x;
+
+    GeneratorState state;
+    const unsigned int subsequence = state_id;
+    rocrand_init(0, subsequence, 123ULL, &state);
+
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        output[index] = rocrand(&state);
+        index += global_size;
+    }
+}
+
+template <class GeneratorState>
+__global__
+void rocrand_uniform_kernel(float * output, const size_t size)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int global_size = hipGridDim_x * hipBlockDim_x;
+
+    GeneratorState state;
+    const unsigned int subsequence = state_id;
+    rocrand_init(0, subsequence, 234ULL, &state);
+
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        output[index] = rocrand_uniform(&state);
+        index += global_size;
+    }
+}
+
+template <class GeneratorState>
+__global__
+void rocrand_normal2_kernel(float * output, const size_t size)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int global_size = hipGridDim_x * hipBlockDim_x;
+
+    GeneratorState state;
+    const unsigned int subsequence = state_id;
+    rocrand_init(0, subsequence, 345ULL, &state);
+
+    unsigned int index = state_id;
+    while(index < size / 2)
+    {
+        float2 r = rocrand_normal2(&state);
+        output[2 * index] = r.x;
+        output[2 * index + 1] = r.y;
+        index += global_size;
+    }
+}
+
+template <class GeneratorState>
+__global__
+void rocrand_discrete_kernel(unsigned int * output, const size_t size, rocrand_discrete_distribution discrete_distribution)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int global_size = hipGridDim_x * hipBlockDim_x;
+
+    GeneratorState state;
+    const unsigned int subsequence = state_id;
+    rocrand_init(0, subsequence, 456ULL, &state);
+
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        output[index] = rocrand_discrete(&state, discrete_distribution);
+        index += global_size;
+    }
+}
+
+// Every thread skips ahead its own state, output[2 * i] is generated by the
+// state of rocrand_init() with the subsequence and offset, output[2 * i + 1]
+// by the state skipped ahead from subsequence 0 and offset 0
+template <class GeneratorState>
+__global__
+void rocrand_skipahead_kernel(unsigned int * output, unsigned long long seed)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned long long subsequence = state_id * 7919ULL;
+    const unsigned long long offset = (state_id % 3) * 123456789ULL + state_id;
+
+    GeneratorState state;
+    rocrand_init(seed, subsequence, offset, &state);
+    output[2 * state_id] = rocrand(&state);
+    rocrand_init(seed, 0, 0, &state);
+    skipahead(offset, &state);
+    skipahead_subsequence(subsequence, &state);
+    output[2 * state_id + 1] = rocrand(&state);
+}
+
+TEST(rocrand_kernel_xoshiro128pp, rocrand_state_xoshiro128pp_type)
+{
+    EXPECT_EQ(sizeof(rocrand_state_xoshiro128pp), 4 * sizeof(unsigned int));
+    EXPECT_EQ(sizeof(rocrand_state_xoshiro128pp[32]), 32 * sizeof(rocrand_state_xoshiro128pp));
+}
+
+// Just get access to internal state
+class rocrand_state_xoshiro128pp_test : public rocrand_state_xoshiro128pp
+{
+public:
+    __host__ rocrand_state_xoshiro128pp_test(const unsigned int (&s)[4])
+    {
+        for(unsigned int i = 0; i < 4; i++)
+        {
+            m_state.s[i] = s[i];
+        }
+    }
+};
+
+// Known answers of the reference implementation for the state {1, 2, 3, 4},
+// after jump() (2^64 values, one subsequence) and long_jump() (2^96 values)
+TEST(rocrand_kernel_xoshiro128pp, known_answer)
+{
+    const unsigned int s[4] = { 1, 2, 3, 4 };
+
+    rocrand_state_xoshiro128pp_test state(s);
+    EXPECT_EQ(rocrand(&state), 0x00000281U);
+    EXPECT_EQ(rocrand(&state), 0x00180387U);
+    EXPECT_EQ(rocrand(&state), 0xc0183387U);
+    EXPECT_EQ(rocrand(&state), 0xd1ae3b02U);
+
+    rocrand_state_xoshiro128pp_test jumped(s);
+    skipahead_subsequence(1, &jumped);
+    EXPECT_EQ(rocrand(&jumped), 0xba8c0ddcU);
+    EXPECT_EQ(rocrand(&jumped), 0x06a228ceU);
+    EXPECT_EQ(rocrand(&jumped), 0x4506c342U);
+    EXPECT_EQ(rocrand(&jumped), 0x6d64b9f6U);
+
+    rocrand_state_xoshiro128pp_test long_jumped(s);
+    skipahead_subsequence(1ULL << 32, &long_jumped);
+    EXPECT_EQ(rocrand(&long_jumped), 0x99cc2935U);
+    EXPECT_EQ(rocrand(&long_jumped), 0x7f4f19b6U);
+    EXPECT_EQ(rocrand(&long_jumped), 0x09b914e1U);
+    EXPECT_EQ(rocrand(&long_jumped), 0x6de722e8U);
+}
+
+TEST(rocrand_kernel_xoshiro128pp, rocrand_init_skipahead)
+{
+    const size_t states_size = 4 * 96;
+    unsigned int * output;
+    HIP_CHECK(hipMalloc((void **)&output, 2 * states_size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_skipahead_kernel<rocrand_state_xoshiro128pp>),
+        dim3(4), dim3(96), 0, 0,
+        output, 0xdeadbeefbeefdeadULL
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<unsigned int> output_host(2 * states_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            2 * states_size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    for(size_t si = 0; si < states_size; si++)
+    {
+        ASSERT_EQ(output_host[2 * si], output_host[2 * si + 1]);
+    }
+}
+
+// Skipping ahead by offsets with jumps is the same as generating values
+TEST(rocrand_kernel_xoshiro128pp, skipahead_host)
+{
+    const unsigned long long offsets[] = { 1, 127, 128, 129, 1000, 33333 };
+    for(unsigned long long offset : offsets)
+    {
+        rocrand_state_xoshiro128pp state;
+        rocrand_init(12345ULL, 3, 0, &state);
+        rocrand_state_xoshiro128pp skipped = state;
+        skipahead(offset, &skipped);
+        for(unsigned long long i = 0; i < offset; i++)
+        {
+            rocrand(&state);
+        }
+        for(unsigned int i = 0; i < 16; i++)
+        {
+            ASSERT_EQ(rocrand(&state), rocrand(&skipped)) << offset;
+        }
+    }
+}
+
+TEST(rocrand_kernel_xoshiro128pp, rocrand)
+{
+    typedef rocrand_state_xoshiro128pp state_type;
+
+    const size_t output_size = 8192;
+    unsigned int * output;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_kernel<state_type>),
+        dim3(4), dim3(64), 0, 0,
+        output, output_size
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<unsigned int> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    double mean = 0;
+    for(auto v : output_host)
+    {
+        mean += static_cast<double>(v) / UINT_MAX;
+    }
+    mean = mean / output_size;
+    EXPECT_NEAR(mean, 0.5, 0.1);
+}
+
+TEST(rocrand_kernel_xoshiro128pp, rocrand_uniform)
+{
+    typedef rocrand_state_xoshiro128pp state_type;
+
+    const size_t output_size = 8192;
+    float * output;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_uniform_kernel<state_type>),
+        dim3(4), dim3(64), 0, 0,
+        output, output_size
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<float> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(float),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    double mean = 0;
+    for(auto v : output_host)
+    {
+        mean += static_cast<double>(v);
+    }
+    mean = mean / output_size;
+    EXPECT_NEAR(mean, 0.5, 0.1);
+}
+
+TEST(rocrand_kernel_xoshiro128pp, rocrand_normal2)
+{
+    typedef rocrand_state_xoshiro128pp state_type;
+
+    const size_t output_size = 8192;
+    float * output;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_normal2_kernel<state_type>),
+        dim3(4), dim3(64), 0, 0,
+        output, output_size
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<float> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(float),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    double mean = 0;
+    for(auto v : output_host)
+    {
+        mean += static_cast<double>(v);
+    }
+    mean = mean / output_size;
+    EXPECT_NEAR(mean, 0.0, 0.2);
+
+    double stddev = 0;
+    for(auto v : output_host)
+    {
+        stddev += std::pow(static_cast<double>(v) - mean, 2);
+    }
+    stddev = stddev / output_size;
+    EXPECT_NEAR(stddev, 1.0, 0.2);
+}
+
+class rocrand_kernel_xoshiro128pp_poisson : public ::testing::TestWithParam<double> { };
+
+TEST_P(rocrand_kernel_xoshiro128pp_poisson, rocrand_discrete)
+{
+    typedef rocrand_state_xoshiro128pp state_type;
+
+    const double lambda = GetParam();
+
+    const size_t output_size = 8192;
+    unsigned int * output;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    rocrand_discrete_distribution discrete_distribution;
+    ROCRAND_CHECK(rocrand_create_poisson_distribution(lambda, &discrete_distribution));
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_discrete_kernel<state_type>),
+        dim3(4), dim3(64), 0, 0,
+        output, output_size, discrete_distribution
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<unsigned int> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+    ROCRAND_CHECK(rocrand_destroy_discrete_distribution(discrete_distribution));
+
+    double mean = 0;
+    for(auto v : output_host)
+    {
+        mean += static_cast<double>(v);
+    }
+    mean = mean / output_size;
+
+    double variance = 0;
+    for(auto v : output_host)
+    {
+        variance += std::pow(v - mean, 2);
+    }
+    variance = variance / output_size;
+
+    EXPECT_NEAR(mean, lambda, std::max(1.0, lambda * 1e-1));
+    EXPECT_NEAR(variance, lambda, std::max(1.0, lambda * 1e-1));
+}
+
+const double lambdas[] = { 1.0, 5.5, 20.0, 100.0, 1234.5, 5000.0 };
+
+INSTANTIATE_TEST_CASE_P(rocrand_kernel_xoshiro128pp_poisson,
+                        rocrand_kernel_xoshiro128pp_poisson,
+                        ::testing::ValuesIn(lambdas));
@@ -0,0 +1,165 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+class rocrand_latin_hypercube_tests : public ::testing::TestWithParam<size_t> { };
+
+const unsigned int dims = 3;
+
+void generate_stratified(rocrand_generator generator, size_t n_points, unsigned int strata,
+                         rocrand_ordering ordering, std::vector<float>& output)
+{
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, n_points * dims * sizeof(float)));
+    if(strata == 0)
+        ROCRAND_CHECK(rocrand_generate_latin_hypercube(generator, data, n_points, dims, ordering));
+    else
+        ROCRAND_CHECK(rocrand_generate_stratified_uniform(generator, data, n_points, dims, strata, ordering));
+    HIP_CHECK(hipDeviceSynchronize());
+    output.resize(n_points * dims);
+    HIP_CHECK(hipMemcpy(output.data(), data, output.size() * sizeof(float), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+}
+
+// Every stratum of every dimension contains one point (the k-th smallest value
+// is in the k-th stratum), point-major values are dimension-major values transposed
+TEST_P(rocrand_latin_hypercube_tests, latin_hypercube_test)
+{
+    const size_t n = GetParam();
+
+    for(int stateless = 0; stateless < 2; stateless++)
+    {
+        std::vector<float> outputs[2];
+        const rocrand_ordering orderings[2] = {
+            ROCRAND_ORDERING_QUASI_DEFAULT, ROCRAND_ORDERING_QUASI_INTERLEAVED
+        };
+        for(int o = 0; o < 2; o++)
+        {
+            rocrand_generator generator;
+            ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+            ROCRAND_CHECK(rocrand_set_stateless(generator, stateless));
+            ROCRAND_CHECK(rocrand_set_seed(generator, 12345ULL));
+            generate_stratified(generator, n, 0, orderings[o], outputs[o]);
+            ROCRAND_CHECK(rocrand_destroy_generator(generator));
+        }
+
+        for(unsigned int d = 0; d < dims; d++)
+        {
+            std::vector<float> values(outputs[0].begin() + d * n, outputs[0].begin() + (d + 1) * n);
+            for(size_t i = 0; i < n; i++)
+            {
+                ASSERT_EQ(values[i], outputs[1][i * dims + d]);
+            }
+            std::sort(values.begin(), values.end());
+            for(size_t k = 0; k < n; k++)
+            {
+                ASSERT_GE(values[k], static_cast<double>(k) / n - 1e-6) << d << " " << k;
+                ASSERT_LE(values[k], static_cast<double>(k + 1) / n + 1e-6) << d << " " << k;
+            }
+        }
+        if(n > 1000)
+        {
+            // Dimensions are permuted independently
+            size_t same = 0;
+            for(size_t i = 0; i < n; i++)
+            {
+                same += static_cast<size_t>(outputs[0][i] * n) == static_cast<size_t>(outputs[0][n + i] * n);
+            }
+            EXPECT_LT(same, n / 100);
+        }
+    }
+}
+
+// Point i is in the cell of digits of i in base strata
+TEST_P(rocrand_latin_hypercube_tests, stratified_uniform_test)
+{
+    const size_t n = GetParam();
+    const unsigned int strata = 4;
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    std::vector<float> output;
+    generate_stratified(generator, n, strata, ROCRAND_ORDERING_QUASI_INTERLEAVED, output);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    double mean = 0.0;
+    for(size_t i = 0; i < n; i++)
+    {
+        size_t cell = i;
+        for(unsigned int d = 0; d < dims; d++)
+        {
+            const double digit = static_cast<double>(cell % strata);
+            cell /= strata;
+            const float v = output[i * dims + d];
+            ASSERT_GE(v, digit / strata - 1e-6) << i << " " << d;
+            ASSERT_LE(v, (digit + 1) / strata + 1e-6) << i << " " << d;
+            mean += v;
+        }
+    }
+    if(n > 1000)
+    {
+        EXPECT_NEAR(mean / (n * dims), 0.5, 0.01);
+    }
+}
+
+const size_t latin_hypercube_sizes[] = { 1, 2, 100, 65537 };
+
+INSTANTIATE_TEST_CASE_P(rocrand_latin_hypercube_tests,
+                        rocrand_latin_hypercube_tests,
+                        ::testing::ValuesIn(latin_hypercube_sizes));
+
+TEST(rocrand_latin_hypercube_tests, errors_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, 100 * sizeof(float)));
+
+    EXPECT_EQ(
+        rocrand_generate_latin_hypercube(generator, data, 10, 0, ROCRAND_ORDERING_QUASI_DEFAULT),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_latin_hypercube(generator, data, 10, 2, ROCRAND_ORDERING_PSEUDO_DEFAULT),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_stratified_uniform(generator, data, 10, 2, 0, ROCRAND_ORDERING_QUASI_DEFAULT),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(
+        rocrand_generate_latin_hypercube(generator, data, 10, 2, ROCRAND_ORDERING_QUASI_DEFAULT),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(data));
+}
@@ -0,0 +1,265 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <climits>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include <rng/generator_type.hpp>
+#include <rng/generators.hpp>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+// Point index of dimension d of the lattice sequence with generating vector z
+unsigned int lattice_reference(const std::vector<unsigned int>& z, unsigned int d, unsigned int index)
+{
+    unsigned int reversed = 0;
+    for(unsigned int b = 0; b < 32; b++)
+    {
+        reversed |= ((index >> b) & 1U) << (31 - b);
+    }
+    return reversed * z[d];
+}
+
+std::vector<unsigned int> korobov_vector(unsigned int dimensions)
+{
+    std::vector<unsigned int> z(dimensions);
+    unsigned int a = 1;
+    for(unsigned int d = 0; d < dimensions; d++)
+    {
+        z[d] = a;
+        a *= 0xC3568CE3U;
+    }
+    return z;
+}
+
+TEST(rocrand_lattice32_qrng_tests, uniform_uint_test)
+{
+    const size_t size = 1313;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size));
+
+    rocrand_lattice32 g;
+    ROCRAND_CHECK(g.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int host_data[size];
+    HIP_CHECK(hipMemcpy(host_data, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned long long sum = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        sum += host_data[i];
+    }
+    const unsigned int mean = sum / size;
+    ASSERT_NEAR(mean, UINT_MAX / 2, UINT_MAX / 20);
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_lattice32_qrng_tests, uniform_float_test)
+{
+    const size_t size = 1313;
+    float * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(float) * size));
+
+    rocrand_lattice32 g;
+    ROCRAND_CHECK(g.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    float host_data[size];
+    HIP_CHECK(hipMemcpy(host_data, data, sizeof(float) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double sum = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_GT(host_data[i], 0.0f);
+        ASSERT_LE(host_data[i], 1.0f);
+        sum += host_data[i];
+    }
+    const float mean = sum / size;
+    ASSERT_NEAR(mean, 0.5f, 0.05f);
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_lattice32_qrng_tests, dimensions_test)
+{
+    rocrand_lattice32 g;
+    EXPECT_EQ(g.set_dimensions(0), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(g.set_dimensions(1048577), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(g.set_dimensions(1048576));
+
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * 1000));
+    ROCRAND_CHECK(g.set_dimensions(10));
+    EXPECT_EQ(g.generate(data, 1001), ROCRAND_STATUS_LENGTH_NOT_MULTIPLE);
+    ROCRAND_CHECK(g.generate(data, 1000));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(data));
+}
+
+// Values must be the lattice sequence for all orderings, launch configurations
+// and offsets
+TEST(rocrand_lattice32_qrng_tests, known_values_test)
+{
+    const unsigned int dimensions = 7;
+    const size_t points = 1000;
+    const size_t size = points * dimensions;
+    const unsigned int offset = 12345;
+    const std::vector<unsigned int> z = korobov_vector(dimensions);
+
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size));
+    std::vector<unsigned int> host_data(size);
+
+    for(int interleaved = 0; interleaved < 2; interleaved++)
+    {
+        for(unsigned int blocks : { 0U, 1U, 3U })
+        {
+            rocrand_lattice32 g(offset);
+            ROCRAND_CHECK(g.set_dimensions(dimensions));
+            if(interleaved)
+            {
+                ROCRAND_CHECK(g.set_ordering(ROCRAND_ORDERING_QUASI_INTERLEAVED));
+            }
+            if(blocks != 0)
+            {
+                ROCRAND_CHECK(g.set_launch_config(blocks, 96));
+            }
+            ROCRAND_CHECK(g.generate(data, size));
+            HIP_CHECK(hipMemcpy(host_data.data(), data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+            HIP_CHECK(hipDeviceSynchronize());
+
+            for(size_t i = 0; i < points; i++)
+            {
+                for(unsigned int d = 0; d < dimensions; d++)
+                {
+                    const size_t j = interleaved ? i * dimensions + d : d * points + i;
+                    ASSERT_EQ(host_data[j], lattice_reference(z, d, offset + i))
+                        << interleaved << " " << blocks << " " << i << " " << d;
+                }
+            }
+        }
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_lattice32_qrng_tests, generating_vector_test)
+{
+    const unsigned int dimensions = 3;
+    const size_t points = 64;
+    const size_t size = points * dimensions;
+    const std::vector<unsigned int> z = { 1U, 39U, 7U };
+
+    rocrand_lattice32 g;
+    EXPECT_EQ(g.set_generating_vector(NULL, dimensions), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(g.set_generating_vector(z.data(), dimensions));
+    EXPECT_EQ(g.get_dimensions(), dimensions);
+    EXPECT_EQ(g.set_dimensions(dimensions + 1), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size));
+    ROCRAND_CHECK(g.generate(data, size));
+    std::vector<unsigned int> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(data));
+
+    for(size_t i = 0; i < points; i++)
+    {
+        for(unsigned int d = 0; d < dimensions; d++)
+        {
+            ASSERT_EQ(host_data[d * points + i], lattice_reference(z, d, i)) << i << " " << d;
+            // The first 64 points are the lattice rule of 64 points: k * z[d] / 64
+            ASSERT_EQ(host_data[d * points + i] & ((1U << 26) - 1), 0U);
+        }
+    }
+
+    rocrand_halton32 h;
+    EXPECT_EQ(h.set_generating_vector(z.data(), dimensions), ROCRAND_STATUS_TYPE_ERROR);
+}
+
+// Continuing generation from the previous point must equal generation of
+// all points at once
+TEST(rocrand_lattice32_qrng_tests, state_progress_test)
+{
+    const unsigned int dimensions = 5;
+    const size_t points = 1111;
+    const size_t size = points * dimensions;
+
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size * 3));
+
+    rocrand_lattice32 g0;
+    ROCRAND_CHECK(g0.set_dimensions(dimensions));
+    ROCRAND_CHECK(g0.generate(data, size));
+    ROCRAND_CHECK(g0.generate(data + size, size));
+
+    rocrand_lattice32 g1;
+    ROCRAND_CHECK(g1.set_dimensions(dimensions));
+    g1.set_offset(points);
+    ROCRAND_CHECK(g1.generate(data + 2 * size, size));
+
+    std::vector<unsigned int> host_data(size * 3);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, sizeof(unsigned int) * size * 3, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(data));
+
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_data[size + i], host_data[2 * size + i]) << i;
+    }
+}
+
+TEST(rocrand_lattice32_qrng_tests, host_generator_test)
+{
+    const unsigned int dimensions = 9;
+    const size_t size = 2000 * dimensions;
+
+    float * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(float) * size));
+    rocrand_lattice32 g;
+    ROCRAND_CHECK(g.set_dimensions(dimensions));
+    ROCRAND_CHECK(g.generate_normal(data, size, 1.0f, 2.0f));
+    std::vector<float> device_data(size);
+    HIP_CHECK(hipMemcpy(device_data.data(), data, sizeof(float) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(data));
+
+    std::vector<float> host_data(size);
+    rocrand_lattice32 h(0, 0, true);
+    ROCRAND_CHECK(h.set_dimensions(dimensions));
+    ROCRAND_CHECK(h.generate_normal(host_data.data(), size, 1.0f, 2.0f));
+
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_NEAR(host_data[i], device_data[i], 1e-5f) << i;
+    }
+}
@@ -0,0 +1,170 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+class rocrand_launch_config_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+void generate_with_config(const rocrand_rng_type rng_type,
+                          const unsigned int blocks,
+                          const unsigned int threads,
+                          const bool host_side,
+                          std::vector<unsigned int>& output)
+{
+    const size_t size = 123457;
+    output.resize(size);
+
+    rocrand_generator generator;
+    if(host_side)
+    {
+        ROCRAND_CHECK(rocrand_create_generator_host(&generator, rng_type));
+    }
+    else
+    {
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    }
+    if(blocks != 0 || threads != 0)
+    {
+        ROCRAND_CHECK(rocrand_set_launch_config(generator, blocks, threads));
+    }
+
+    if(host_side)
+    {
+        ROCRAND_CHECK(rocrand_generate(generator, output.data(), size));
+    }
+    else
+    {
+        unsigned int * data;
+        HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+        ROCRAND_CHECK(rocrand_generate(generator, data, size));
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(
+            hipMemcpy(
+                output.data(), data,
+                size * sizeof(unsigned int),
+                hipMemcpyDeviceToHost
+            )
+        );
+        HIP_CHECK(hipFree(data));
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_launch_config_tests, default_config_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    unsigned int blocks, threads;
+    ROCRAND_CHECK(rocrand_get_launch_config(generator, &blocks, &threads));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    // Setting the default configuration explicitly must not change sequences
+    std::vector<unsigned int> expected;
+    generate_with_config(rng_type, 0, 0, false, expected);
+    std::vector<unsigned int> output;
+    generate_with_config(rng_type, blocks, threads, false, output);
+    for(size_t i = 0; i < output.size(); i++)
+    {
+        ASSERT_EQ(output[i], expected[i]);
+    }
+}
+
+TEST_P(rocrand_launch_config_tests, auto_config_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_launch_config(generator, 0, 0));
+    unsigned int blocks, threads;
+    ROCRAND_CHECK(rocrand_get_launch_config(generator, &blocks, &threads));
+    EXPECT_GT(blocks, 0U);
+    EXPECT_GT(threads, 0U);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    // The chosen configuration defines sequences, host-side generator
+    // with the same configuration must produce the same values
+    std::vector<unsigned int> expected;
+    generate_with_config(rng_type, blocks, threads, true, expected);
+    std::vector<unsigned int> output;
+    generate_with_config(rng_type, blocks, threads, false, output);
+    for(size_t i = 0; i < output.size(); i++)
+    {
+        ASSERT_EQ(output[i], expected[i]);
+    }
+}
+
+TEST_P(rocrand_launch_config_tests, custom_config_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    std::vector<unsigned int> expected;
+    generate_with_config(rng_type, 100, 256, true, expected);
+    std::vector<unsigned int> output1;
+    generate_with_config(rng_type, 100, 256, false, output1);
+    std::vector<unsigned int> output2;
+    generate_with_config(rng_type, 100, 256, false, output2);
+    for(size_t i = 0; i < expected.size(); i++)
+    {
+        ASSERT_EQ(output1[i], expected[i]);
+        ASSERT_EQ(output2[i], expected[i]);
+    }
+
+    if(rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        // Quasi-random sequences do not depend on launch configuration
+        std::vector<unsigned int> output3;
+        generate_with_config(rng_type, 0, 0, false, output3);
+        for(size_t i = 0; i < expected.size(); i++)
+        {
+            ASSERT_EQ(output3[i], expected[i]);
+        }
+    }
+}
+
+TEST_P(rocrand_launch_config_tests, neg_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    EXPECT_EQ(rocrand_set_launch_config(generator, 0, 256), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_set_launch_config(generator, 100, 0), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_set_launch_config(generator, 100, 2048), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_get_launch_config(generator, NULL, NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    EXPECT_EQ(rocrand_set_launch_config(NULL, 0, 0), ROCRAND_STATUS_NOT_CREATED);
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_launch_config_tests,
+                        rocrand_launch_config_tests,
+                        ::testing::ValuesIn(rng_types));
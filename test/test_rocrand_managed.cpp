@@ -0,0 +1,102 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+class rocrand_managed_tests : public ::testing::TestWithParam<rocrand_managed_policy> { };
+
+void generate_normal_values(rocrand_generator generator, float * data, size_t size)
+{
+    ROCRAND_CHECK(rocrand_set_seed(generator, 24680ULL));
+    ROCRAND_CHECK(rocrand_generate_normal(generator, data, size, 1.0f, 2.0f));
+    ROCRAND_CHECK(rocrand_generate_uniform(generator, data + size, size));
+    HIP_CHECK(hipDeviceSynchronize());
+}
+
+// Policies produce the same values in managed memory as in device memory,
+// values are read by the host from the managed buffer
+TEST_P(rocrand_managed_tests, managed_output_test)
+{
+    const size_t size = 1234567;
+
+    float * managed;
+    if(hipMallocManaged((void **)&managed, 2 * size * sizeof(float)) != hipSuccess)
+    {
+        (void)hipGetLastError();
+        printf("Managed memory is not supported, skipping\n");
+        return;
+    }
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, 2 * size * sizeof(float)));
+
+    const rocrand_rng_type rng_types[] = {
+        ROCRAND_RNG_PSEUDO_PHILOX4_32_10, ROCRAND_RNG_PSEUDO_XORWOW, ROCRAND_RNG_QUASI_SOBOL32
+    };
+    for(rocrand_rng_type rng_type : rng_types)
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+        ROCRAND_CHECK(rocrand_set_managed_policy(generator, GetParam()));
+        generate_normal_values(generator, managed, size);
+        generate_normal_values(generator, data, size);
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+        std::vector<float> expected(2 * size);
+        HIP_CHECK(hipMemcpy(
+            expected.data(), data, 2 * size * sizeof(float), hipMemcpyDeviceToHost
+        ));
+        for(size_t i = 0; i < 2 * size; i++)
+        {
+            ASSERT_EQ(managed[i], expected[i]);
+        }
+    }
+
+    HIP_CHECK(hipFree(managed));
+    HIP_CHECK(hipFree(data));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_managed_tests,
+                        rocrand_managed_tests,
+                        ::testing::Values(ROCRAND_MANAGED_POLICY_DEFAULT,
+                                          ROCRAND_MANAGED_POLICY_NONE,
+                                          ROCRAND_MANAGED_POLICY_PREFETCH_HOST));
+
+TEST(rocrand_managed_neg_tests, neg_test)
+{
+    EXPECT_EQ(
+        rocrand_set_managed_policy(NULL, ROCRAND_MANAGED_POLICY_NONE),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(
+        rocrand_set_managed_policy(generator, static_cast<rocrand_managed_policy>(3)),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
@@ -20,6 +20,7 @@
 
 #include <stdio.h>
 #include <gtest/gtest.h>
+#include <vector>
 
 #include <hip/hip_runtime.h>
 #include <rocrand.h>
@@ -432,3 +433,55 @@ TEST(rocrand_mrg32k3a_prng_tests, discard_subsequence_test)
 
     EXPECT_EQ(engine1(), engine2());
 }
+
+// Requests smaller than the number of engines launch only engines that
+// generate values, values and states must be the same as for host-side
+// generators that process all engines
+TEST(rocrand_mrg32k3a_prng_tests, small_request_test)
+{
+    const size_t sizes[] = { 1, 2, 3, 100, 255, 256, 257, 1000, 5 };
+    const size_t max_size = 1000;
+    float * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(float) * (max_size + 1)));
+
+    rocrand_mrg32k3a g(12ULL);
+    ROCRAND_CHECK(g.set_launch_config(4, 64));
+    rocrand_mrg32k3a h(12ULL, 0, 0, true);
+    ROCRAND_CHECK(h.set_launch_config(4, 64));
+
+    std::vector<float> device_data(max_size + 1);
+    std::vector<float> host_data(max_size + 1);
+    for(size_t size : sizes)
+    {
+        // Values of 1 and 2 per call, misaligned output
+        for(int normal = 0; normal < 2; normal++)
+        {
+            if(normal)
+            {
+                ROCRAND_CHECK(g.generate_normal(data + 1, size, 0.0f, 1.0f));
+                ROCRAND_CHECK(h.generate_normal(host_data.data() + 1, size, 0.0f, 1.0f));
+            }
+            else
+            {
+                ROCRAND_CHECK(g.generate(reinterpret_cast<unsigned int *>(data) + 1, size));
+                ROCRAND_CHECK(h.generate(reinterpret_cast<unsigned int *>(host_data.data()) + 1, size));
+            }
+            HIP_CHECK(hipMemcpy(device_data.data(), data, sizeof(float) * (size + 1), hipMemcpyDeviceToHost));
+            HIP_CHECK(hipDeviceSynchronize());
+            for(size_t i = 1; i <= size; i++)
+            {
+                if(normal)
+                {
+                    ASSERT_NEAR(device_data[i], host_data[i], 1e-4f) << size << " " << i;
+                }
+                else
+                {
+                    ASSERT_EQ(reinterpret_cast<unsigned int *>(device_data.data())[i],
+                              reinterpret_cast<unsigned int *>(host_data.data())[i]) << size << " " << i;
+                }
+            }
+        }
+    }
+
+    HIP_CHECK(hipFree(data));
+}
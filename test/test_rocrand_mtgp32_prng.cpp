@@ -21,6 +21,8 @@
 
 #include <stdio.h>
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
 
 #include <hip/hip_runtime.h>
 #include <rocrand.h>
@@ -281,3 +283,127 @@ TEST(rocrand_mtgp32_prng_tests, different_seed_test)
 
     HIP_CHECK(hipFree(data));
 }
+
+// Generators can have more engines than parameter sets, engines share
+// parameter sets but not sequences
+TEST(rocrand_mtgp32_prng_tests, many_engines_test)
+{
+    const unsigned int blocks = 2048;
+    const size_t size = blocks * 256 * 4;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size));
+
+    rocrand_mtgp32 g;
+    EXPECT_EQ(g.set_launch_config(1000000, 256), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(g.set_launch_config(blocks, 256));
+    ROCRAND_CHECK(g.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(data));
+
+    // Host-side generators produce the same values
+    rocrand_mtgp32 h(0, 0, 0, true);
+    ROCRAND_CHECK(h.set_launch_config(blocks, 256));
+    std::vector<unsigned int> expected(size);
+    ROCRAND_CHECK(h.generate(expected.data(), size));
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_data[i], expected[i]);
+    }
+
+    // Engine 512 uses the same parameter set as engine 0
+    std::vector<char> state(g.get_state_size());
+    ROCRAND_CHECK(g.get_state(state.data()));
+    const rocrand_mtgp32::engine_type * engines =
+        reinterpret_cast<const rocrand_mtgp32::engine_type *>(state.data());
+    EXPECT_EQ(engines[0].pos_tbl, engines[512].pos_tbl);
+    size_t same = 0;
+    for(unsigned int j = 0; j < MTGP_N; j++)
+    {
+        if(engines[0].m_state.status[j] == engines[512].m_state.status[j]) same++;
+    }
+    EXPECT_LT(same, 10U);
+
+    unsigned long long sum = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        sum += host_data[i];
+    }
+    const unsigned int mean = sum / size;
+    ASSERT_NEAR(mean, UINT_MAX / 2, UINT_MAX / 20);
+}
+
+// Every engine skips offset values of its sequence, for short offsets
+// (stepped) and long ones (jumps with the characteristic polynomial)
+TEST(rocrand_mtgp32_prng_tests, offset_test)
+{
+    const size_t reference_size = 256 * 64;
+    const size_t size = 256 * 8;
+
+    rocrand_mtgp32 r(123ULL, 0, 0, true);
+    ROCRAND_CHECK(r.set_launch_config(1, 256));
+    std::vector<unsigned int> reference(reference_size);
+    ROCRAND_CHECK(r.generate(reference.data(), reference_size));
+
+    for(unsigned long long offset : { 1ULL, 100ULL, 256ULL, 257ULL, 1000ULL, 12345ULL })
+    {
+        rocrand_mtgp32 h(123ULL, offset, 0, true);
+        ROCRAND_CHECK(h.set_launch_config(1, 256));
+        std::vector<unsigned int> host_data(size);
+        ROCRAND_CHECK(h.generate(host_data.data(), size));
+        for(size_t i = 0; i < size; i++)
+        {
+            ASSERT_EQ(host_data[i], reference[offset + i]) << offset << " " << i;
+        }
+    }
+
+    // Device-side generators with many engines produce the same values
+    const unsigned int blocks = 600;
+    const size_t device_size = blocks * 256 * 2;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * device_size));
+    rocrand_mtgp32 g(123ULL, 1000ULL);
+    ROCRAND_CHECK(g.set_launch_config(blocks, 256));
+    ROCRAND_CHECK(g.generate(data, device_size));
+    std::vector<unsigned int> device_data(device_size);
+    HIP_CHECK(hipMemcpy(device_data.data(), data, sizeof(unsigned int) * device_size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(data));
+
+    rocrand_mtgp32 h(123ULL, 1000ULL, 0, true);
+    ROCRAND_CHECK(h.set_launch_config(blocks, 256));
+    std::vector<unsigned int> expected(device_size);
+    ROCRAND_CHECK(h.generate(expected.data(), device_size));
+    for(size_t i = 0; i < device_size; i++)
+    {
+        ASSERT_EQ(device_data[i], expected[i]) << i;
+    }
+}
+
+// A long offset followed by generation equals the sum of both as offset
+// (every generate() call advances all engines by whole blocks of 256 values)
+TEST(rocrand_mtgp32_prng_tests, long_offset_test)
+{
+    const unsigned long long offset = (1ULL << 40) + 17;
+    const size_t skipped = 256 * 3;
+    const size_t size = 256 * 4;
+
+    rocrand_mtgp32 h0(5ULL, offset, 0, true);
+    ROCRAND_CHECK(h0.set_launch_config(3, 256));
+    std::vector<unsigned int> data0(3 * std::max(skipped, size));
+    ROCRAND_CHECK(h0.generate(data0.data(), 3 * skipped));
+    ROCRAND_CHECK(h0.generate(data0.data(), 3 * size));
+
+    rocrand_mtgp32 h1(5ULL, offset + skipped, 0, true);
+    ROCRAND_CHECK(h1.set_launch_config(3, 256));
+    std::vector<unsigned int> data1(3 * size);
+    ROCRAND_CHECK(h1.generate(data1.data(), 3 * size));
+
+    for(size_t i = 0; i < 3 * size; i++)
+    {
+        ASSERT_EQ(data0[i], data1[i]) << i;
+    }
+}
@@ -0,0 +1,318 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+class rocrand_multi_device_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+bool is_multi_device_supported(const rocrand_rng_type rng_type)
+{
+    return rng_type == ROCRAND_RNG_PSEUDO_XORWOW
+        || rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A
+        || rng_type == ROCRAND_RNG_PSEUDO_XOSHIRO128PP
+        || rng_type == ROCRAND_RNG_PSEUDO_PCG32
+        || rng_type == ROCRAND_RNG_QUASI_SOBOL32;
+}
+
+void get_test_devices(std::vector<int>& devices)
+{
+    int device_count;
+    HIP_CHECK(hipGetDeviceCount(&device_count));
+    // Use the same device several times if there is only one
+    devices.clear();
+    for(int i = 0; i < 3; i++)
+    {
+        devices.push_back(i % device_count);
+    }
+}
+
+template<class T, class Generate, class GenerateMultiDevice>
+void compare_with_single_device(const rocrand_rng_type rng_type,
+                                const size_t size,
+                                Generate generate,
+                                GenerateMultiDevice generate_multi_device)
+{
+    const unsigned int dimensions = rng_type == ROCRAND_RNG_QUASI_SOBOL32 ? 3 : 1;
+    std::vector<int> devices;
+    get_test_devices(devices);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    rocrand_multi_device_generator multi_generator;
+    ROCRAND_CHECK(
+        rocrand_create_multi_device_generator(
+            &multi_generator, rng_type, devices.data(), devices.size()
+        )
+    );
+    if(rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(generator, dimensions));
+        ROCRAND_CHECK(rocrand_multi_device_set_quasi_random_generator_dimensions(multi_generator, dimensions));
+    }
+    else
+    {
+        ROCRAND_CHECK(rocrand_set_seed(generator, 12ULL));
+        ROCRAND_CHECK(rocrand_multi_device_set_seed(multi_generator, 12ULL));
+    }
+    ROCRAND_CHECK(rocrand_set_offset(generator, 345ULL));
+    ROCRAND_CHECK(rocrand_multi_device_set_offset(multi_generator, 345ULL));
+
+    T * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(T)));
+    std::vector<T> expected(size);
+
+    std::vector<T *> outputs(devices.size());
+    std::vector<size_t> offsets(devices.size());
+    std::vector<size_t> sizes(devices.size());
+    size_t total_size = 0;
+    for(size_t d = 0; d < devices.size(); d++)
+    {
+        ROCRAND_CHECK(rocrand_multi_device_get_slice(multi_generator, size, d, &offsets[d], &sizes[d]));
+        EXPECT_EQ(offsets[d] * dimensions, total_size);
+        total_size += sizes[d];
+        HIP_CHECK(hipSetDevice(devices[d]));
+        HIP_CHECK(hipMalloc((void **)&outputs[d], (sizes[d] + 1) * sizeof(T)));
+    }
+    HIP_CHECK(hipSetDevice(devices[0]));
+    EXPECT_EQ(total_size, size);
+
+    // Several calls check that engines of all devices stay in the same state
+    for(int i = 0; i < 3; i++)
+    {
+        ROCRAND_CHECK(generate(generator, data, size));
+        HIP_CHECK(hipMemcpy(expected.data(), data, size * sizeof(T), hipMemcpyDeviceToHost));
+
+        ROCRAND_CHECK(generate_multi_device(multi_generator, outputs.data(), size));
+        const size_t points = size / dimensions;
+        for(size_t d = 0; d < devices.size(); d++)
+        {
+            std::vector<T> output(sizes[d]);
+            HIP_CHECK(hipSetDevice(devices[d]));
+            HIP_CHECK(hipDeviceSynchronize());
+            HIP_CHECK(hipMemcpy(output.data(), outputs[d], sizes[d] * sizeof(T), hipMemcpyDeviceToHost));
+            const size_t slice_points = sizes[d] / dimensions;
+            for(unsigned int dim = 0; dim < dimensions; dim++)
+            {
+                for(size_t j = 0; j < slice_points; j++)
+                {
+                    ASSERT_EQ(
+                        output[dim * slice_points + j],
+                        expected[dim * points + offsets[d] + j]
+                    );
+                }
+            }
+        }
+        HIP_CHECK(hipSetDevice(devices[0]));
+    }
+
+    for(size_t d = 0; d < devices.size(); d++)
+    {
+        HIP_CHECK(hipSetDevice(devices[d]));
+        HIP_CHECK(hipFree(outputs[d]));
+    }
+    HIP_CHECK(hipSetDevice(devices[0]));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    ROCRAND_CHECK(rocrand_destroy_multi_device_generator(multi_generator));
+}
+
+TEST_P(rocrand_multi_device_tests, int_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    if(!is_multi_device_supported(rng_type))
+        return;
+
+    compare_with_single_device<unsigned int>(
+        rng_type, 123456 * 3 + 3,
+        rocrand_generate, rocrand_multi_device_generate
+    );
+}
+
+TEST_P(rocrand_multi_device_tests, uniform_float_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    if(!is_multi_device_supported(rng_type))
+        return;
+
+    compare_with_single_device<float>(
+        rng_type, 123456 * 3 + 3,
+        rocrand_generate_uniform, rocrand_multi_device_generate_uniform
+    );
+}
+
+TEST_P(rocrand_multi_device_tests, normal_float_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    if(!is_multi_device_supported(rng_type))
+        return;
+
+    compare_with_single_device<float>(
+        rng_type, 123456 * 3 + 3,
+        [](rocrand_generator g, float * data, size_t n)
+        {
+            return rocrand_generate_normal(g, data, n, 1.0f, 2.0f);
+        },
+        [](rocrand_multi_device_generator g, float * const * outputs, size_t n)
+        {
+            return rocrand_multi_device_generate_normal(g, outputs, n, 1.0f, 2.0f);
+        }
+    );
+}
+
+// Slices of generators of all ranks of a distributed run give together
+// the output of a single-device generator
+TEST_P(rocrand_multi_device_tests, distributed_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    if(!is_multi_device_supported(rng_type))
+        return;
+
+    const unsigned int world_size = 5;
+    const unsigned int dimensions = rng_type == ROCRAND_RNG_QUASI_SOBOL32 ? 3 : 1;
+    const size_t size = 12345 * 3;
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    if(rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(generator, dimensions));
+    }
+    else
+    {
+        ROCRAND_CHECK(rocrand_set_seed(generator, 12ULL));
+    }
+    ROCRAND_CHECK(rocrand_set_offset(generator, 345ULL));
+
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(float)));
+    std::vector<float> expected(2 * size);
+    for(int i = 0; i < 2; i++)
+    {
+        ROCRAND_CHECK(rocrand_generate_uniform(generator, data, size));
+        HIP_CHECK(hipMemcpy(expected.data() + i * size, data, size * sizeof(float), hipMemcpyDeviceToHost));
+    }
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    const size_t points = size / dimensions;
+    size_t total_size = 0;
+    for(unsigned int rank = 0; rank < world_size; rank++)
+    {
+        rocrand_multi_device_generator rank_generator;
+        ROCRAND_CHECK(rocrand_create_distributed_generator(&rank_generator, rng_type, rank, world_size));
+        if(rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+        {
+            ROCRAND_CHECK(rocrand_multi_device_set_quasi_random_generator_dimensions(rank_generator, dimensions));
+        }
+        else
+        {
+            ROCRAND_CHECK(rocrand_multi_device_set_seed(rank_generator, 12ULL));
+        }
+        ROCRAND_CHECK(rocrand_multi_device_set_offset(rank_generator, 345ULL));
+
+        // The generator has one device
+        size_t offset, slice_size;
+        EXPECT_EQ(
+            rocrand_multi_device_get_slice(rank_generator, size, 1, &offset, &slice_size),
+            ROCRAND_STATUS_OUT_OF_RANGE
+        );
+        ROCRAND_CHECK(rocrand_multi_device_get_slice(rank_generator, size, 0, &offset, &slice_size));
+        EXPECT_EQ(offset * dimensions, total_size);
+        total_size += slice_size;
+
+        // The second call checks that engines skip values of other ranks
+        std::vector<float> output(slice_size);
+        const size_t slice_points = slice_size / dimensions;
+        for(int i = 0; i < 2; i++)
+        {
+            ROCRAND_CHECK(rocrand_multi_device_generate_uniform(rank_generator, &data, size));
+            HIP_CHECK(hipDeviceSynchronize());
+            HIP_CHECK(hipMemcpy(output.data(), data, slice_size * sizeof(float), hipMemcpyDeviceToHost));
+            for(unsigned int dim = 0; dim < dimensions; dim++)
+            {
+                for(size_t j = 0; j < slice_points; j++)
+                {
+                    ASSERT_EQ(
+                        output[dim * slice_points + j],
+                        expected[i * size + dim * points + offset + j]
+                    );
+                }
+            }
+        }
+        ROCRAND_CHECK(rocrand_destroy_multi_device_generator(rank_generator));
+    }
+    EXPECT_EQ(total_size, size);
+    HIP_CHECK(hipFree(data));
+
+    rocrand_multi_device_generator rank_generator;
+    EXPECT_EQ(
+        rocrand_create_distributed_generator(&rank_generator, rng_type, world_size, world_size),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_create_distributed_generator(&rank_generator, rng_type, 0, 0),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+}
+
+TEST_P(rocrand_multi_device_tests, neg_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    std::vector<int> devices;
+    get_test_devices(devices);
+
+    rocrand_multi_device_generator generator;
+    if(!is_multi_device_supported(rng_type))
+    {
+        EXPECT_EQ(
+            rocrand_create_multi_device_generator(&generator, rng_type, devices.data(), devices.size()),
+            ROCRAND_STATUS_TYPE_ERROR
+        );
+        return;
+    }
+
+    EXPECT_EQ(
+        rocrand_create_multi_device_generator(&generator, rng_type, NULL, 1),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_create_multi_device_generator(&generator, rng_type, devices.data(), 0),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(
+        rocrand_create_multi_device_generator(&generator, rng_type, devices.data(), devices.size())
+    );
+    size_t offset, size;
+    EXPECT_EQ(
+        rocrand_multi_device_get_slice(generator, 1000, devices.size(), &offset, &size),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(rocrand_multi_device_generate(generator, NULL, 1000), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_destroy_multi_device_generator(generator));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_multi_device_tests,
+                        rocrand_multi_device_tests,
+                        ::testing::ValuesIn(rng_types));
@@ -0,0 +1,167 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+struct multivariate_normal_test_params
+{
+    rocrand_rng_type rng_type;
+    bool stateless;
+    unsigned int dim;
+};
+
+const multivariate_normal_test_params multivariate_normal_params[] = {
+    { ROCRAND_RNG_PSEUDO_PHILOX4_32_10, true, 1 },
+    { ROCRAND_RNG_PSEUDO_PHILOX4_32_10, true, 50 },
+    { ROCRAND_RNG_PSEUDO_PHILOX4_32_10, true, 333 },
+    { ROCRAND_RNG_PSEUDO_PHILOX4_32_10, false, 50 },
+    { ROCRAND_RNG_PSEUDO_XORWOW, false, 50 },
+    { ROCRAND_RNG_PSEUDO_MRG32K3A, false, 500 }
+};
+
+class rocrand_multivariate_normal_tests
+    : public ::testing::TestWithParam<multivariate_normal_test_params> { };
+
+void create_generator(const multivariate_normal_test_params& params,
+                      rocrand_generator& generator)
+{
+    ROCRAND_CHECK(rocrand_create_generator(&generator, params.rng_type));
+    if(params.stateless)
+    {
+        ROCRAND_CHECK(rocrand_set_stateless(generator, 1));
+    }
+    ROCRAND_CHECK(rocrand_set_seed(generator, 2468ULL));
+}
+
+// Vectors are mean + L z, where z are values of rocrand_generate_normal(),
+// the next calls use the next values
+TEST_P(rocrand_multivariate_normal_tests, factor_test)
+{
+    const multivariate_normal_test_params params = GetParam();
+    const unsigned int dim = params.dim;
+    const size_t n_vectors = 1001;
+    const size_t size = n_vectors * dim;
+
+    std::vector<float> factor(dim * dim);
+    std::vector<float> mean(dim);
+    for(unsigned int i = 0; i < dim; i++)
+    {
+        for(unsigned int j = 0; j < dim; j++)
+        {
+            // Values above the diagonal are not used
+            factor[i * dim + j] = j <= i ? 1.0f / (1.0f + i + 2.0f * j) : 1000.0f;
+        }
+        mean[i] = 0.5f * i;
+    }
+
+    float * d_factor;
+    float * d_mean;
+    float * d_output;
+    HIP_CHECK(hipMalloc((void **)&d_factor, dim * dim * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&d_mean, dim * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&d_output, size * sizeof(float)));
+    HIP_CHECK(hipMemcpy(d_factor, factor.data(), dim * dim * sizeof(float), hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemcpy(d_mean, mean.data(), dim * sizeof(float), hipMemcpyHostToDevice));
+
+    rocrand_generator generator;
+    create_generator(params, generator);
+    std::vector<std::vector<float> > outputs(2, std::vector<float>(size));
+    for(size_t call = 0; call < 2; call++)
+    {
+        ROCRAND_CHECK(rocrand_generate_multivariate_normal(
+            generator, d_output, n_vectors, dim, d_factor, call == 0 ? d_mean : NULL
+        ));
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(hipMemcpy(
+            outputs[call].data(), d_output, size * sizeof(float), hipMemcpyDeviceToHost
+        ));
+    }
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    create_generator(params, generator);
+    std::vector<float> normals(size);
+    for(size_t call = 0; call < 2; call++)
+    {
+        ROCRAND_CHECK(rocrand_generate_normal(generator, d_output, size, 0.0f, 1.0f));
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(hipMemcpy(normals.data(), d_output, size * sizeof(float), hipMemcpyDeviceToHost));
+
+        for(size_t v = 0; v < n_vectors; v++)
+        {
+            for(unsigned int i = 0; i < dim; i++)
+            {
+                double expected = call == 0 ? mean[i] : 0.0;
+                double magnitude = 1.0;
+                for(unsigned int j = 0; j <= i; j++)
+                {
+                    expected += factor[i * dim + j] * normals[v * dim + j];
+                    magnitude += std::abs(factor[i * dim + j] * normals[v * dim + j]);
+                }
+                ASSERT_NEAR(outputs[call][v * dim + i], expected, 1e-5 * magnitude);
+            }
+        }
+    }
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    HIP_CHECK(hipFree(d_factor));
+    HIP_CHECK(hipFree(d_mean));
+    HIP_CHECK(hipFree(d_output));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_multivariate_normal_tests,
+                        rocrand_multivariate_normal_tests,
+                        ::testing::ValuesIn(multivariate_normal_params));
+
+TEST(rocrand_multivariate_normal_neg_tests, neg_test)
+{
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, 100 * sizeof(float)));
+
+    EXPECT_EQ(
+        rocrand_generate_multivariate_normal(NULL, data, 10, 10, data, NULL),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(
+        rocrand_generate_multivariate_normal(generator, data, 10, 10, NULL, NULL),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_multivariate_normal(generator, NULL, 10, 10, data, NULL),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_multivariate_normal(generator, data, 1, 10000, data, NULL),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_generate_multivariate_normal(generator, data, 0, 10, data, NULL));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(data));
+}
@@ -0,0 +1,222 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <vector>
+#include <cmath>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+const rocrand_rng_type normal_method_rng_types[] = {
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
+    ROCRAND_RNG_PSEUDO_THREEFRY2_64_20,
+    ROCRAND_RNG_PSEUDO_THREEFRY4_64_20,
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_7,
+    ROCRAND_RNG_PSEUDO_MRG32K3A,
+    ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_XOSHIRO128PP,
+    ROCRAND_RNG_PSEUDO_PCG32
+};
+
+class rocrand_normal_method_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+rocrand_status generate_normal(rocrand_generator generator, float * data, size_t n,
+                               float mean, float stddev)
+{
+    return rocrand_generate_normal(generator, data, n, mean, stddev);
+}
+
+rocrand_status generate_normal(rocrand_generator generator, double * data, size_t n,
+                               double mean, double stddev)
+{
+    return rocrand_generate_normal_double(generator, data, n, mean, stddev);
+}
+
+template<class T>
+void generate_ziggurat(const rocrand_rng_type rng_type,
+                       const bool host_side,
+                       const T mean, const T stddev,
+                       std::vector<T>& output)
+{
+    rocrand_generator generator;
+    if(host_side)
+    {
+        ROCRAND_CHECK(rocrand_create_generator_host(&generator, rng_type));
+    }
+    else
+    {
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    }
+    ROCRAND_CHECK(rocrand_set_normal_method(generator, ROCRAND_NORMAL_METHOD_ZIGGURAT));
+
+    const size_t size = output.size();
+    T * data = output.data();
+    if(!host_side)
+    {
+        HIP_CHECK(hipMalloc((void **)&data, size * sizeof(T)));
+    }
+
+    // Any sizes and alignment
+    ROCRAND_CHECK(generate_normal(generator, data + 1, 3, mean, stddev));
+    ROCRAND_CHECK(generate_normal(generator, data, size, mean, stddev));
+
+    if(!host_side)
+    {
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(
+            hipMemcpy(
+                output.data(), data,
+                size * sizeof(T),
+                hipMemcpyDeviceToHost
+            )
+        );
+        HIP_CHECK(hipFree(data));
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+template<class T>
+void check_moments(const std::vector<T>& output, const double mean, const double stddev)
+{
+    double actual_mean = 0;
+    for(auto v : output)
+    {
+        actual_mean += static_cast<double>(v);
+    }
+    actual_mean = actual_mean / output.size();
+
+    double actual_stddev = 0;
+    double actual_kurtosis = 0;
+    for(auto v : output)
+    {
+        const double d = static_cast<double>(v) - actual_mean;
+        actual_stddev += d * d;
+        actual_kurtosis += d * d * d * d;
+    }
+    actual_stddev = actual_stddev / output.size();
+    actual_kurtosis = actual_kurtosis / output.size() / (actual_stddev * actual_stddev);
+    actual_stddev = std::sqrt(actual_stddev);
+
+    EXPECT_NEAR(mean, actual_mean, mean * 0.01);
+    EXPECT_NEAR(stddev, actual_stddev, stddev * 0.01);
+    // Checks that the tail and wedges are sampled
+    EXPECT_NEAR(3.0, actual_kurtosis, 0.05);
+}
+
+TEST_P(rocrand_normal_method_tests, float_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    std::vector<float> output(1 << 20);
+    generate_ziggurat(rng_type, false, 5.0f, 2.0f, output);
+    check_moments(output, 5.0, 2.0);
+
+    std::vector<float> host_output(1 << 20);
+    generate_ziggurat(rng_type, true, 5.0f, 2.0f, host_output);
+    check_moments(host_output, 5.0, 2.0);
+}
+
+TEST_P(rocrand_normal_method_tests, double_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    std::vector<double> output(1 << 20);
+    generate_ziggurat(rng_type, false, 5.0, 2.0, output);
+    check_moments(output, 5.0, 2.0);
+
+    std::vector<double> host_output(1 << 20);
+    generate_ziggurat(rng_type, true, 5.0, 2.0, host_output);
+    check_moments(host_output, 5.0, 2.0);
+}
+
+// Consecutive calls continue the sequence
+TEST_P(rocrand_normal_method_tests, continuity_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    const size_t size = 12345;
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_normal_method(generator, ROCRAND_NORMAL_METHOD_ZIGGURAT));
+
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * 2 * sizeof(float)));
+    ROCRAND_CHECK(rocrand_generate_normal(generator, data, size, 0.0f, 1.0f));
+    ROCRAND_CHECK(rocrand_generate_normal(generator, data + size, size, 0.0f, 1.0f));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> output(size * 2);
+    HIP_CHECK(
+        hipMemcpy(
+            output.data(), data,
+            size * 2 * sizeof(float),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    size_t same = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        same += output[i] == output[size + i] ? 1 : 0;
+    }
+    EXPECT_LT(same, 10U);
+}
+
+TEST_P(rocrand_normal_method_tests, neg_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    EXPECT_EQ(
+        rocrand_set_normal_method(generator, static_cast<rocrand_normal_method>(7)),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_set_normal_method(generator, ROCRAND_NORMAL_METHOD_BOX_MULLER),
+        ROCRAND_STATUS_SUCCESS
+    );
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL32));
+    EXPECT_EQ(
+        rocrand_set_normal_method(generator, ROCRAND_NORMAL_METHOD_ZIGGURAT),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    EXPECT_EQ(
+        rocrand_set_normal_method(NULL, ROCRAND_NORMAL_METHOD_ZIGGURAT),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_normal_method_tests,
+                        rocrand_normal_method_tests,
+                        ::testing::ValuesIn(normal_method_rng_types));
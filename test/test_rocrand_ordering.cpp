@@ -0,0 +1,477 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <vector>
+#include <utility>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+const rocrand_rng_type quasi_rng_types[] = {
+    ROCRAND_RNG_QUASI_SOBOL32,
+    ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32,
+    ROCRAND_RNG_QUASI_SOBOL64,
+    ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64
+};
+
+class rocrand_ordering_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+void generate_with_ordering(const rocrand_rng_type rng_type,
+                            const rocrand_ordering ordering,
+                            const unsigned int dimensions,
+                            const size_t points,
+                            const bool host_side,
+                            std::vector<unsigned int>& output)
+{
+    const size_t size = dimensions * points;
+    output.resize(size);
+
+    rocrand_generator generator;
+    if(host_side)
+    {
+        ROCRAND_CHECK(rocrand_create_generator_host(&generator, rng_type));
+    }
+    else
+    {
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    }
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(generator, dimensions));
+    ROCRAND_CHECK(rocrand_set_ordering(generator, ordering));
+
+    if(host_side)
+    {
+        ROCRAND_CHECK(rocrand_generate(generator, output.data(), size));
+    }
+    else
+    {
+        unsigned int * data;
+        HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+        ROCRAND_CHECK(rocrand_generate(generator, data, size));
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(
+            hipMemcpy(
+                output.data(), data,
+                size * sizeof(unsigned int),
+                hipMemcpyDeviceToHost
+            )
+        );
+        HIP_CHECK(hipFree(data));
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+// Interleaved output is the transposed dimension-major output
+TEST_P(rocrand_ordering_tests, interleaved_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    const unsigned int dimensionss[] = { 1, 3, 32, 1111 };
+    for(auto dimensions : dimensionss)
+    {
+        SCOPED_TRACE(testing::Message() << "with dimensions = " << dimensions);
+
+        const size_t points = 1025;
+        std::vector<unsigned int> expected;
+        generate_with_ordering(rng_type, ROCRAND_ORDERING_QUASI_DEFAULT, dimensions, points, false, expected);
+        std::vector<unsigned int> output;
+        generate_with_ordering(rng_type, ROCRAND_ORDERING_QUASI_INTERLEAVED, dimensions, points, false, output);
+        std::vector<unsigned int> host_output;
+        generate_with_ordering(rng_type, ROCRAND_ORDERING_QUASI_INTERLEAVED, dimensions, points, true, host_output);
+
+        for(unsigned int d = 0; d < dimensions; d++)
+        {
+            for(size_t i = 0; i < points; i++)
+            {
+                ASSERT_EQ(output[i * dimensions + d], expected[d * points + i]);
+                ASSERT_EQ(host_output[i * dimensions + d], expected[d * points + i]);
+            }
+        }
+    }
+}
+
+// Many dimensions with few points per dimension (several dimensions per block)
+// must produce the first points of the sequences of a large generate call
+TEST_P(rocrand_ordering_tests, high_dimensional_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    const unsigned int dimensions = 5000;
+    const size_t points = 513;
+    std::vector<unsigned int> expected;
+    generate_with_ordering(rng_type, ROCRAND_ORDERING_QUASI_DEFAULT, dimensions, points, false, expected);
+
+    const size_t pointss[] = { 1, 7, 64 };
+    for(auto few_points : pointss)
+    {
+        SCOPED_TRACE(testing::Message() << "with points = " << few_points);
+
+        std::vector<unsigned int> output;
+        generate_with_ordering(rng_type, ROCRAND_ORDERING_QUASI_DEFAULT, dimensions, few_points, false, output);
+        std::vector<unsigned int> host_output;
+        generate_with_ordering(rng_type, ROCRAND_ORDERING_QUASI_DEFAULT, dimensions, few_points, true, host_output);
+
+        for(unsigned int d = 0; d < dimensions; d++)
+        {
+            for(size_t i = 0; i < few_points; i++)
+            {
+                ASSERT_EQ(output[d * few_points + i], expected[d * points + i]);
+                ASSERT_EQ(host_output[d * few_points + i], expected[d * points + i]);
+            }
+        }
+    }
+}
+
+TEST_P(rocrand_ordering_tests, neg_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    EXPECT_EQ(
+        rocrand_set_ordering(generator, static_cast<rocrand_ordering>(0)),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(
+        rocrand_set_ordering(generator, ROCRAND_ORDERING_QUASI_INTERLEAVED),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    EXPECT_EQ(
+        rocrand_set_ordering(NULL, ROCRAND_ORDERING_QUASI_DEFAULT),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_ordering_tests,
+                        rocrand_ordering_tests,
+                        ::testing::ValuesIn(quasi_rng_types));
+
+const rocrand_rng_type seeded_rng_types[] = {
+    ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_MRG32K3A,
+    ROCRAND_RNG_PSEUDO_XOSHIRO128PP,
+    ROCRAND_RNG_PSEUDO_PCG32
+};
+
+class rocrand_seeded_ordering_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+void generate_pseudo_with_ordering(const rocrand_rng_type rng_type,
+                                   const rocrand_ordering ordering,
+                                   const unsigned long long seed,
+                                   const size_t size,
+                                   const bool host_side,
+                                   std::vector<unsigned int>& output)
+{
+    output.resize(size);
+
+    rocrand_generator generator;
+    if(host_side)
+    {
+        ROCRAND_CHECK(rocrand_create_generator_host(&generator, rng_type));
+    }
+    else
+    {
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    }
+    ROCRAND_CHECK(rocrand_set_ordering(generator, ordering));
+    ROCRAND_CHECK(rocrand_set_seed(generator, seed));
+
+    if(host_side)
+    {
+        ROCRAND_CHECK(rocrand_generate(generator, output.data(), size));
+    }
+    else
+    {
+        unsigned int * data;
+        HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+        ROCRAND_CHECK(rocrand_generate(generator, data, size));
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(
+            hipMemcpy(
+                output.data(), data,
+                size * sizeof(unsigned int),
+                hipMemcpyDeviceToHost
+            )
+        );
+        HIP_CHECK(hipFree(data));
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+// Seeded engines produce other sequences than the default ordering,
+// they are the same for device and host generators
+TEST_P(rocrand_seeded_ordering_tests, seeded_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    const size_t size = 1 << 20;
+
+    std::vector<unsigned int> expected;
+    generate_pseudo_with_ordering(rng_type, ROCRAND_ORDERING_PSEUDO_DEFAULT, 1234ULL, size, false, expected);
+    std::vector<unsigned int> output;
+    generate_pseudo_with_ordering(rng_type, ROCRAND_ORDERING_PSEUDO_SEEDED, 1234ULL, size, false, output);
+    std::vector<unsigned int> host_output;
+    generate_pseudo_with_ordering(rng_type, ROCRAND_ORDERING_PSEUDO_SEEDED, 1234ULL, size, true, host_output);
+    std::vector<unsigned int> other_output;
+    generate_pseudo_with_ordering(rng_type, ROCRAND_ORDERING_PSEUDO_SEEDED, 4321ULL, size, false, other_output);
+
+    ASSERT_TRUE(output == host_output);
+    size_t same = 0;
+    size_t same_seed = 0;
+    double mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        same += output[i] == expected[i] ? 1 : 0;
+        same_seed += output[i] == other_output[i] ? 1 : 0;
+        mean += output[i] / 4294967296.0;
+    }
+    EXPECT_LT(same, 10U);
+    EXPECT_LT(same_seed, 10U);
+    EXPECT_NEAR(mean / size, 0.5, 0.01);
+}
+
+// Changing the ordering resets the state, the default ordering is restored
+TEST_P(rocrand_seeded_ordering_tests, reset_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    const size_t size = 12345;
+
+    std::vector<unsigned int> expected;
+    generate_pseudo_with_ordering(rng_type, ROCRAND_ORDERING_PSEUDO_DEFAULT, 5ULL, size, false, expected);
+    std::vector<unsigned int> seeded;
+    generate_pseudo_with_ordering(rng_type, ROCRAND_ORDERING_PSEUDO_SEEDED, 5ULL, size, false, seeded);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_seed(generator, 5ULL));
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    std::vector<unsigned int> output(size);
+
+    ROCRAND_CHECK(rocrand_set_ordering(generator, ROCRAND_ORDERING_PSEUDO_SEEDED));
+    ROCRAND_CHECK(rocrand_generate(generator, data, size));
+    HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    ASSERT_TRUE(output == seeded);
+
+    ROCRAND_CHECK(rocrand_set_ordering(generator, ROCRAND_ORDERING_PSEUDO_DEFAULT));
+    ROCRAND_CHECK(rocrand_generate(generator, data, size));
+    HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    ASSERT_TRUE(output == expected);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_seeded_ordering_tests, neg_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    EXPECT_EQ(
+        rocrand_set_ordering(generator, static_cast<rocrand_ordering>(0)),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_set_ordering(generator, ROCRAND_ORDERING_QUASI_DEFAULT),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL32));
+    EXPECT_EQ(
+        rocrand_set_ordering(generator, ROCRAND_ORDERING_PSEUDO_SEEDED),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(
+        rocrand_set_ordering(generator, ROCRAND_ORDERING_PSEUDO_SEEDED),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_seeded_ordering_tests,
+                        rocrand_seeded_ordering_tests,
+                        ::testing::ValuesIn(seeded_rng_types));
+
+const rocrand_rng_type dynamic_rng_types[] = {
+    ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_MRG32K3A,
+    ROCRAND_RNG_PSEUDO_XOSHIRO128PP,
+    ROCRAND_RNG_PSEUDO_PCG32,
+    ROCRAND_RNG_PSEUDO_MTGP32
+};
+
+class rocrand_dynamic_ordering_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+// Generates size values by two calls, the second one with another launch
+// configuration (0 blocks keep the configuration chosen by the library)
+void generate_pseudo_two_calls(const rocrand_rng_type rng_type,
+                               const rocrand_ordering ordering,
+                               const std::pair<unsigned int, unsigned int> first,
+                               const std::pair<unsigned int, unsigned int> second,
+                               const size_t size,
+                               const bool host_side,
+                               std::vector<unsigned int>& output)
+{
+    output.resize(size);
+    const size_t first_size = size / 3;
+
+    rocrand_generator generator;
+    if(host_side)
+    {
+        ROCRAND_CHECK(rocrand_create_generator_host(&generator, rng_type));
+    }
+    else
+    {
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    }
+    ROCRAND_CHECK(rocrand_set_ordering(generator, ordering));
+    ROCRAND_CHECK(rocrand_set_seed(generator, 1234ULL));
+
+    unsigned int * data = output.data();
+    if(!host_side)
+    {
+        HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    }
+    if(first.first != 0)
+    {
+        ROCRAND_CHECK(rocrand_set_launch_config(generator, first.first, first.second));
+    }
+    ROCRAND_CHECK(rocrand_generate(generator, data, first_size));
+    if(second.first != 0)
+    {
+        ROCRAND_CHECK(rocrand_set_launch_config(generator, second.first, second.second));
+    }
+    ROCRAND_CHECK(rocrand_generate(generator, data + first_size, size - first_size));
+    if(!host_side)
+    {
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(
+            hipMemcpy(
+                output.data(), data,
+                size * sizeof(unsigned int),
+                hipMemcpyDeviceToHost
+            )
+        );
+        HIP_CHECK(hipFree(data));
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+// Results of the dynamic ordering do not depend on the launch configuration,
+// even if it changes between generate calls (the state is kept), and they equal
+// results of the default ordering with the default launch configuration
+TEST_P(rocrand_dynamic_ordering_tests, dynamic_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    const size_t size = (3 << 20) + 5;
+
+    std::vector<std::pair<unsigned int, unsigned int>> configs;
+    if(rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        configs = { { 0, 0 }, { 1, 256 }, { 100, 256 }, { 512, 256 } };
+    }
+    else
+    {
+        // Grids smaller than the number of engines run several engines per thread
+        configs = { { 0, 0 }, { 1024, 128 }, { 256, 512 }, { 4096, 32 }, { 512, 256 },
+                    { 100, 256 }, { 1, 1024 }, { 7, 64 } };
+    }
+
+    std::vector<unsigned int> expected;
+    generate_pseudo_two_calls(
+        rng_type, ROCRAND_ORDERING_PSEUDO_DEFAULT, configs[0], configs[0], size, false, expected
+    );
+    for(size_t c = 0; c < configs.size(); c++)
+    {
+        const std::pair<unsigned int, unsigned int> first = configs[c];
+        const std::pair<unsigned int, unsigned int> second = configs[(c + 1) % configs.size()];
+        SCOPED_TRACE(testing::Message() << "with launch configs = " << first.first << "x"
+                                        << first.second << ", " << second.first << "x"
+                                        << second.second);
+
+        std::vector<unsigned int> output;
+        generate_pseudo_two_calls(
+            rng_type, ROCRAND_ORDERING_PSEUDO_DYNAMIC, first, second, size, false, output
+        );
+        ASSERT_TRUE(output == expected);
+    }
+
+    std::vector<unsigned int> host_output;
+    generate_pseudo_two_calls(
+        rng_type, ROCRAND_ORDERING_PSEUDO_DYNAMIC, configs[0], configs[0], size, true, host_output
+    );
+    ASSERT_TRUE(host_output == expected);
+}
+
+TEST_P(rocrand_dynamic_ordering_tests, neg_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_ordering(generator, ROCRAND_ORDERING_PSEUDO_DYNAMIC));
+    // The number of engines is fixed
+    if(rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        EXPECT_EQ(rocrand_set_launch_config(generator, 513, 256), ROCRAND_STATUS_OUT_OF_RANGE);
+        EXPECT_EQ(
+            rocrand_set_ordering(generator, ROCRAND_ORDERING_PSEUDO_SEEDED),
+            ROCRAND_STATUS_OUT_OF_RANGE
+        );
+    }
+    else
+    {
+        // More threads than engines, or a block size not dividing them
+        EXPECT_EQ(rocrand_set_launch_config(generator, 513, 256), ROCRAND_STATUS_OUT_OF_RANGE);
+        EXPECT_EQ(rocrand_set_launch_config(generator, 100, 384), ROCRAND_STATUS_OUT_OF_RANGE);
+    }
+    EXPECT_EQ(
+        rocrand_set_ordering(generator, ROCRAND_ORDERING_QUASI_DEFAULT),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL32));
+    EXPECT_EQ(
+        rocrand_set_ordering(generator, ROCRAND_ORDERING_PSEUDO_DYNAMIC),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_dynamic_ordering_tests,
+                        rocrand_dynamic_ordering_tests,
+                        ::testing::ValuesIn(dynamic_rng_types));
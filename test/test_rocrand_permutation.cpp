@@ -0,0 +1,156 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+class rocrand_permutation_tests : public ::testing::TestWithParam<size_t> { };
+
+void generate_permutation(rocrand_generator generator, size_t n, std::vector<unsigned int>& output)
+{
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, n * sizeof(unsigned int)));
+    ROCRAND_CHECK(rocrand_generate_permutation(generator, data, n));
+    HIP_CHECK(hipDeviceSynchronize());
+    output.resize(n);
+    HIP_CHECK(hipMemcpy(output.data(), data, n * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+}
+
+// Every index appears once, following permutations are different
+TEST_P(rocrand_permutation_tests, permutation_test)
+{
+    const size_t n = GetParam();
+
+    for(int stateless = 0; stateless < 2; stateless++)
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+        ROCRAND_CHECK(rocrand_set_stateless(generator, stateless));
+        ROCRAND_CHECK(rocrand_set_seed(generator, 12345ULL));
+
+        std::vector<unsigned int> output1;
+        generate_permutation(generator, n, output1);
+        std::vector<unsigned int> output2;
+        generate_permutation(generator, n, output2);
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+        std::vector<char> seen(n, 0);
+        size_t same = 0;
+        for(size_t i = 0; i < n; i++)
+        {
+            ASSERT_LT(output1[i], n);
+            ASSERT_EQ(seen[output1[i]], 0);
+            seen[output1[i]] = 1;
+            same += output1[i] == output2[i] ? 1 : 0;
+        }
+        if(n > 1000)
+        {
+            EXPECT_LT(same, n / 100);
+        }
+    }
+}
+
+const size_t permutation_sizes[] = { 1, 2, 3, 100, 65536, 65537, 1234567 };
+
+INSTANTIATE_TEST_CASE_P(rocrand_permutation_tests,
+                        rocrand_permutation_tests,
+                        ::testing::ValuesIn(permutation_sizes));
+
+struct shuffle_element
+{
+    unsigned int index;
+    unsigned int values[2];
+};
+
+// Elements are moved as a whole, shuffles with the same seed are the same
+// as permutations
+TEST(rocrand_shuffle_tests, shuffle_test)
+{
+    const size_t n = 123457;
+    std::vector<shuffle_element> input(n);
+    for(unsigned int i = 0; i < n; i++)
+    {
+        input[i] = shuffle_element { i, { 3U * i, 7U * i } };
+    }
+
+    shuffle_element * data;
+    HIP_CHECK(hipMalloc((void **)&data, n * sizeof(shuffle_element)));
+    HIP_CHECK(hipMemcpy(data, input.data(), n * sizeof(shuffle_element), hipMemcpyHostToDevice));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(generator, 54321ULL));
+    ROCRAND_CHECK(rocrand_shuffle(generator, data, n, sizeof(shuffle_element)));
+    HIP_CHECK(hipDeviceSynchronize());
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    std::vector<shuffle_element> output(n);
+    HIP_CHECK(hipMemcpy(output.data(), data, n * sizeof(shuffle_element), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(generator, 54321ULL));
+    std::vector<unsigned int> permutation;
+    generate_permutation(generator, n, permutation);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    for(size_t i = 0; i < n; i++)
+    {
+        const shuffle_element& e = output[i];
+        ASSERT_EQ(e.index, permutation[i]);
+        ASSERT_EQ(e.values[0], 3U * e.index);
+        ASSERT_EQ(e.values[1], 7U * e.index);
+    }
+}
+
+TEST(rocrand_permutation_neg_tests, neg_test)
+{
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, 100 * sizeof(unsigned int)));
+
+    EXPECT_EQ(rocrand_generate_permutation(NULL, data, 100), ROCRAND_STATUS_NOT_CREATED);
+    EXPECT_EQ(rocrand_shuffle(NULL, data, 100, 4), ROCRAND_STATUS_NOT_CREATED);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(rocrand_generate_permutation(generator, data, 100), ROCRAND_STATUS_TYPE_ERROR);
+    EXPECT_EQ(rocrand_shuffle(generator, data, 100, 4), ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(rocrand_generate_permutation(generator, NULL, 100), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(
+        rocrand_generate_permutation(generator, data, (1ULL << 32) + 1),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(rocrand_shuffle(generator, data, 100, 0), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_shuffle(generator, NULL, 100, 4), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_generate_permutation(generator, data, 0));
+    ROCRAND_CHECK(rocrand_shuffle(generator, data, 0, 4));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(data));
+}
@@ -0,0 +1,181 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+const rocrand_rng_type precision_rng_types[] = {
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
+    ROCRAND_RNG_PSEUDO_THREEFRY2_64_20,
+    ROCRAND_RNG_PSEUDO_THREEFRY4_64_20,
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_7,
+    ROCRAND_RNG_PSEUDO_MRG32K3A,
+    ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_XOSHIRO128PP,
+    ROCRAND_RNG_PSEUDO_PCG32,
+    ROCRAND_RNG_PSEUDO_MTGP32,
+    ROCRAND_RNG_QUASI_SOBOL32,
+    ROCRAND_RNG_QUASI_SOBOL64
+};
+
+class rocrand_precision_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+void generate_with_precision(const rocrand_rng_type rng_type,
+                             const rocrand_precision precision,
+                             const bool log_normal,
+                             std::vector<float>& output)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_precision(generator, precision));
+
+    const size_t size = output.size();
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(float)));
+    if(log_normal)
+    {
+        ROCRAND_CHECK(rocrand_generate_log_normal(generator, data, size, 0.5f, 0.75f));
+    }
+    else
+    {
+        ROCRAND_CHECK(rocrand_generate_normal(generator, data, size, 0.5f, 2.0f));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(
+        hipMemcpy(
+            output.data(), data,
+            size * sizeof(float),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+// Fast precision consumes the same engine values, so values are close to
+// values of the default precision
+TEST_P(rocrand_precision_tests, fast_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    const size_t size = 1 << 20;
+
+    for(int log_normal = 0; log_normal < 2; log_normal++)
+    {
+        SCOPED_TRACE(testing::Message() << "log_normal = " << log_normal);
+
+        std::vector<float> expected(size);
+        generate_with_precision(rng_type, ROCRAND_PRECISION_DEFAULT, log_normal == 1, expected);
+        std::vector<float> output(size);
+        generate_with_precision(rng_type, ROCRAND_PRECISION_FAST, log_normal == 1, output);
+
+        double mean = 0.0;
+        size_t different = 0;
+        for(size_t i = 0; i < size; i++)
+        {
+            ASSERT_NEAR(output[i], expected[i], 2e-3 * std::max(1.0f, std::abs(expected[i])));
+            different += output[i] != expected[i] ? 1 : 0;
+            mean += output[i];
+        }
+        mean /= size;
+        // Intrinsics change the last bits of some values
+        EXPECT_GT(different, 0U);
+
+        double std = 0.0;
+        for(size_t i = 0; i < size; i++)
+        {
+            std += std::pow(output[i] - mean, 2);
+        }
+        std = std::sqrt(std / size);
+
+        const double expected_mean = log_normal == 1
+            ? std::exp(0.5 + 0.75 * 0.75 / 2.0)
+            : 0.5;
+        const double expected_std = log_normal == 1
+            ? std::sqrt((std::exp(0.75 * 0.75) - 1.0) * std::exp(2.0 * 0.5 + 0.75 * 0.75))
+            : 2.0;
+        EXPECT_NEAR(mean, expected_mean, expected_mean * 0.01);
+        EXPECT_NEAR(std, expected_std, expected_std * 0.01);
+    }
+}
+
+// Host-side generators always use full-precision functions
+TEST_P(rocrand_precision_tests, host_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    const size_t size = 12345;
+
+    rocrand_generator generator;
+    if(rocrand_create_generator_host(&generator, rng_type) != ROCRAND_STATUS_SUCCESS)
+        return;
+    for(int log_normal = 0; log_normal < 2; log_normal++)
+    {
+        SCOPED_TRACE(testing::Message() << "log_normal = " << log_normal);
+
+        std::vector<float> values[2] = { std::vector<float>(size), std::vector<float>(size) };
+        const rocrand_precision precisions[2] = { ROCRAND_PRECISION_DEFAULT, ROCRAND_PRECISION_FAST };
+        for(int p = 0; p < 2; p++)
+        {
+            ROCRAND_CHECK(rocrand_set_precision(generator, precisions[p]));
+            ROCRAND_CHECK(rocrand_set_offset(generator, 0ULL));
+            if(log_normal == 1)
+            {
+                ROCRAND_CHECK(
+                    rocrand_generate_log_normal(generator, values[p].data(), size, 0.5f, 0.75f)
+                );
+            }
+            else
+            {
+                ROCRAND_CHECK(
+                    rocrand_generate_normal(generator, values[p].data(), size, 0.5f, 2.0f)
+                );
+            }
+        }
+        ASSERT_EQ(values[1], values[0]);
+    }
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_precision_tests,
+                        rocrand_precision_tests,
+                        ::testing::ValuesIn(precision_rng_types));
+
+TEST(rocrand_precision_neg_tests, neg_test)
+{
+    EXPECT_EQ(
+        rocrand_set_precision(NULL, ROCRAND_PRECISION_FAST),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(
+        rocrand_set_precision(generator, static_cast<rocrand_precision>(5)),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
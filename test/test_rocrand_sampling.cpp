@@ -0,0 +1,205 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+class rocrand_sampling_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+const rocrand_rng_type sampling_rng_types[] = {
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_MRG32K3A,
+    ROCRAND_RNG_QUASI_SOBOL32
+};
+
+// Indices are distinct, candidates with zero weights are not selected while
+// there are enough other candidates, and frequencies of candidates selected
+// with k = 1 are proportional to weights
+TEST_P(rocrand_sampling_tests, sample_test)
+{
+    const size_t n = 100000;
+    std::vector<float> weights(n);
+    for(size_t i = 0; i < n; i++)
+    {
+        weights[i] = i % 10 == 0 ? 0.0f : static_cast<float>(i % 7 + 1);
+    }
+
+    float * d_weights;
+    unsigned int * d_output;
+    HIP_CHECK(hipMalloc((void **)&d_weights, n * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&d_output, n * sizeof(unsigned int)));
+    HIP_CHECK(hipMemcpy(d_weights, weights.data(), n * sizeof(float), hipMemcpyHostToDevice));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, GetParam()));
+
+    const size_t sizes[] = { 1, 1000, 65536, 90000, 95000, n };
+    for(size_t k : sizes)
+    {
+        ROCRAND_CHECK(rocrand_sample_without_replacement(generator, d_weights, n, k, d_output));
+        HIP_CHECK(hipDeviceSynchronize());
+        std::vector<unsigned int> output(k);
+        HIP_CHECK(hipMemcpy(output.data(), d_output, k * sizeof(unsigned int), hipMemcpyDeviceToHost));
+
+        std::vector<char> seen(n, 0);
+        size_t zero_weights = 0;
+        for(unsigned int index : output)
+        {
+            ASSERT_LT(index, n);
+            ASSERT_EQ(seen[index], 0);
+            seen[index] = 1;
+            zero_weights += weights[index] == 0.0f ? 1 : 0;
+        }
+        EXPECT_EQ(zero_weights, k > 90000 ? k - 90000 : 0);
+    }
+
+    // 4 candidates with weights 2, 3, 4, 5
+    const size_t trials = 20000;
+    std::vector<size_t> counts(4, 0);
+    for(size_t trial = 0; trial < trials; trial++)
+    {
+        ROCRAND_CHECK(rocrand_sample_without_replacement(generator, d_weights + 1, 4, 1, d_output));
+        unsigned int index;
+        HIP_CHECK(hipMemcpy(&index, d_output, sizeof(unsigned int), hipMemcpyDeviceToHost));
+        ASSERT_LT(index, 4U);
+        counts[index]++;
+    }
+    for(size_t i = 0; i < 4; i++)
+    {
+        const double expected = trials * weights[i + 1] / 14.0;
+        EXPECT_NEAR(counts[i], expected, 0.1 * expected);
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(d_weights));
+    HIP_CHECK(hipFree(d_output));
+}
+
+// Every row selects distinct edges of the row, rows with fewer than k edges
+// select all of them
+TEST_P(rocrand_sampling_tests, sample_csr_test)
+{
+    const size_t rows = 1000;
+    const unsigned int k = 25;
+    std::vector<unsigned int> row_offsets(rows + 1, 0);
+    for(size_t row = 0; row < rows; row++)
+    {
+        row_offsets[row + 1] = row_offsets[row] + static_cast<unsigned int>((row * 37) % 300);
+    }
+    const size_t nnz = row_offsets[rows];
+    std::vector<float> weights(nnz);
+    for(size_t i = 0; i < nnz; i++)
+    {
+        weights[i] = static_cast<float>(i % 5 + 1);
+    }
+
+    unsigned int * d_row_offsets;
+    float * d_weights;
+    unsigned int * d_output;
+    HIP_CHECK(hipMalloc((void **)&d_row_offsets, (rows + 1) * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&d_weights, nnz * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&d_output, rows * k * sizeof(unsigned int)));
+    HIP_CHECK(hipMemcpy(
+        d_row_offsets, row_offsets.data(), (rows + 1) * sizeof(unsigned int), hipMemcpyHostToDevice
+    ));
+    HIP_CHECK(hipMemcpy(d_weights, weights.data(), nnz * sizeof(float), hipMemcpyHostToDevice));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, GetParam()));
+    ROCRAND_CHECK(rocrand_sample_without_replacement_csr(
+        generator, d_row_offsets, rows, d_weights, nnz, k, d_output
+    ));
+    HIP_CHECK(hipDeviceSynchronize());
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    std::vector<unsigned int> output(rows * k);
+    HIP_CHECK(hipMemcpy(
+        output.data(), d_output, rows * k * sizeof(unsigned int), hipMemcpyDeviceToHost
+    ));
+    HIP_CHECK(hipFree(d_row_offsets));
+    HIP_CHECK(hipFree(d_weights));
+    HIP_CHECK(hipFree(d_output));
+
+    std::vector<char> seen(nnz, 0);
+    for(size_t row = 0; row < rows; row++)
+    {
+        const unsigned int size = row_offsets[row + 1] - row_offsets[row];
+        for(unsigned int i = 0; i < k; i++)
+        {
+            const unsigned int index = output[row * k + i];
+            if(i >= size)
+            {
+                ASSERT_EQ(index, 0xFFFFFFFFU);
+                continue;
+            }
+            ASSERT_GE(index, row_offsets[row]);
+            ASSERT_LT(index, row_offsets[row + 1]);
+            ASSERT_EQ(seen[index], 0);
+            seen[index] = 1;
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_sampling_tests,
+                        rocrand_sampling_tests,
+                        ::testing::ValuesIn(sampling_rng_types));
+
+TEST(rocrand_sampling_neg_tests, neg_test)
+{
+    float * weights;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&weights, 100 * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&data, 100 * sizeof(unsigned int)));
+
+    EXPECT_EQ(
+        rocrand_sample_without_replacement(NULL, weights, 100, 10, data),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+    EXPECT_EQ(
+        rocrand_sample_without_replacement_csr(NULL, data, 10, weights, 100, 10, data),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(
+        rocrand_sample_without_replacement(generator, weights, 100, 101, data),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_sample_without_replacement(generator, NULL, 100, 10, data),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_sample_without_replacement_csr(generator, NULL, 10, weights, 100, 10, data),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_sample_without_replacement(generator, weights, 100, 0, data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(weights));
+    HIP_CHECK(hipFree(data));
+}
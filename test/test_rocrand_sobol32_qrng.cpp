@@ -20,6 +20,7 @@
 
 #include <stdio.h>
 #include <gtest/gtest.h>
+#include <vector>
 
 #include <hip/hip_runtime.h>
 #include <rocrand.h>
@@ -264,3 +265,58 @@ TEST(rocrand_sobol32_qrng_tests, discard_stride_test)
         EXPECT_EQ(engine1(), engine2());
     }
 }
+
+TEST(rocrand_sobol32_qrng_tests, discard_arbitrary_stride_test)
+{
+    rocrand_sobol32::engine_type engine1(&h_sobol32_direction_vectors[64], 123);
+    rocrand_sobol32::engine_type engine2(&h_sobol32_direction_vectors[64], 123);
+
+    EXPECT_EQ(engine1(), engine2());
+
+    const unsigned int ds[] = {
+        3, 6, 100, 768, 1000, 65535, 81920, 3000000
+    };
+
+    for (auto d : ds)
+    {
+        engine1.discard(d);
+        engine2.discard_stride(d);
+
+        EXPECT_EQ(engine1(), engine2());
+    }
+}
+
+// Direction vectors are shared by generators of the device: only the first
+// generator copies them, they stay valid until the last generator is destroyed
+TEST(rocrand_sobol32_qrng_tests, shared_tables_test)
+{
+    const size_t size = 4 * 1313;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size));
+
+    std::vector<unsigned int> expected(size);
+    {
+        rocrand_sobol32 g0;
+        ROCRAND_CHECK(g0.set_dimensions(4));
+        ROCRAND_CHECK(g0.generate(data, size));
+        HIP_CHECK(hipMemcpy(expected.data(), data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    }
+
+    rocrand_sobol32 * g1 = new rocrand_sobol32();
+    rocrand_sobol32 g2;
+    const unsigned long long table_bytes = sizeof(unsigned int) * SOBOL_DIM * 32;
+    EXPECT_GE(g1->get_stats().device_bytes_allocated, table_bytes);
+    EXPECT_LT(g2.get_stats().device_bytes_allocated, table_bytes);
+
+    ROCRAND_CHECK(g1->generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+    delete g1;
+
+    ROCRAND_CHECK(g2.set_dimensions(4));
+    ROCRAND_CHECK(g2.generate(data, size));
+    std::vector<unsigned int> output(size);
+    HIP_CHECK(hipMemcpy(output.data(), data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    EXPECT_EQ(output, expected);
+
+    HIP_CHECK(hipFree(data));
+}
@@ -0,0 +1,274 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+#include <rocrand_sobol_precomputed.h>
+#include <rocrand_sobol64_precomputed.h>
+#include <rocrand_scrambled_sobol_precomputed.h>
+
+#include <rng/generator_type.hpp>
+#include <rng/generators.hpp>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+template<class Generator, class T>
+void generate_to_host(Generator& g, std::vector<T>& host_data)
+{
+    T * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(T) * host_data.size()));
+
+    ROCRAND_CHECK(g.generate(data, host_data.size()));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    HIP_CHECK(hipMemcpy(host_data.data(), data, sizeof(T) * host_data.size(), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_sobol64_qrng_tests, uniform_ulonglong_test)
+{
+    const size_t size = 1313;
+    std::vector<unsigned long long> host_data(size);
+
+    rocrand_sobol64 g;
+    generate_to_host(g, host_data);
+
+    double sum = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        sum += host_data[i];
+    }
+    const double mean = sum / size;
+    ASSERT_NEAR(mean, ULLONG_MAX / 2.0, ULLONG_MAX / 20.0);
+}
+
+TEST(rocrand_sobol64_qrng_tests, uniform_double_test)
+{
+    const size_t size = 1313;
+    std::vector<double> host_data(size);
+
+    rocrand_sobol64 g;
+    generate_to_host(g, host_data);
+
+    double sum = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_GT(host_data[i], 0.0);
+        ASSERT_LE(host_data[i], 1.0);
+        sum += host_data[i];
+    }
+    const double mean = sum / size;
+    ASSERT_NEAR(mean, 0.5, 0.05);
+}
+
+TEST(rocrand_sobol64_qrng_tests, normal_double_test)
+{
+    const size_t size = 1313;
+    double * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(double) * size));
+
+    rocrand_scrambled_sobol64 g;
+    ROCRAND_CHECK(g.generate_normal(data, size, 2.0, 5.0));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double host_data[size];
+    HIP_CHECK(hipMemcpy(host_data, data, sizeof(double) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        mean += host_data[i];
+    }
+    mean = mean / size;
+
+    double std = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        std += std::pow(host_data[i] - mean, 2);
+    }
+    std = sqrt(std / size);
+
+    EXPECT_NEAR(2.0, mean, 0.4); // 20%
+    EXPECT_NEAR(5.0, std, 1.0); // 20%
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_sobol64_qrng_tests, dimesions_test)
+{
+    const size_t size = 12345;
+    unsigned long long * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned long long) * size));
+
+    rocrand_sobol64 g;
+
+    ROCRAND_CHECK(g.generate(data, size));
+
+    ROCRAND_CHECK(g.set_dimensions(4));
+    EXPECT_EQ(g.generate(data, size), ROCRAND_STATUS_LENGTH_NOT_MULTIPLE);
+
+    ROCRAND_CHECK(g.set_dimensions(15));
+    ROCRAND_CHECK(g.generate(data, size));
+
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(data));
+}
+
+// The upper 32 bits of Sobol64 direction numbers are the Sobol32 ones, so the
+// first 2^32 points of both sequences agree in their upper 32 bits
+TEST(rocrand_sobol64_qrng_tests, sobol32_compatibility_test)
+{
+    const unsigned int dimensions = 7;
+    const size_t size = dimensions * 1001;
+    const unsigned long long offset = 1234;
+
+    rocrand_sobol32 g32(offset);
+    ROCRAND_CHECK(g32.set_dimensions(dimensions));
+    std::vector<unsigned int> host_data32(size);
+    generate_to_host(g32, host_data32);
+
+    rocrand_sobol64 g64(offset);
+    ROCRAND_CHECK(g64.set_dimensions(dimensions));
+    std::vector<unsigned long long> host_data64(size);
+    generate_to_host(g64, host_data64);
+
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_data32[i], static_cast<unsigned int>(host_data64[i] >> 32));
+    }
+}
+
+// Scrambled sequences are the plain ones shifted by one constant per dimension
+TEST(rocrand_sobol64_qrng_tests, scrambled_test)
+{
+    const unsigned int dimensions = 5;
+    const size_t n = 1001;
+    const size_t size = dimensions * n;
+
+    rocrand_sobol32 g32;
+    rocrand_scrambled_sobol32 gs32;
+    rocrand_sobol64 g64;
+    rocrand_scrambled_sobol64 gs64;
+    ROCRAND_CHECK(g32.set_dimensions(dimensions));
+    ROCRAND_CHECK(gs32.set_dimensions(dimensions));
+    ROCRAND_CHECK(g64.set_dimensions(dimensions));
+    ROCRAND_CHECK(gs64.set_dimensions(dimensions));
+
+    std::vector<unsigned int> host_data32(size);
+    std::vector<unsigned int> host_data_s32(size);
+    std::vector<unsigned long long> host_data64(size);
+    std::vector<unsigned long long> host_data_s64(size);
+    generate_to_host(g32, host_data32);
+    generate_to_host(gs32, host_data_s32);
+    generate_to_host(g64, host_data64);
+    generate_to_host(gs64, host_data_s64);
+
+    for(unsigned int d = 0; d < dimensions; d++)
+    {
+        for(size_t i = 0; i < n; i++)
+        {
+            const size_t j = d * n + i;
+            ASSERT_EQ(host_data_s32[j], host_data32[j] ^ h_scrambled_sobol32_constants[d]);
+            ASSERT_EQ(host_data_s64[j], host_data64[j] ^ h_scrambled_sobol64_constants[d]);
+        }
+    }
+}
+
+TEST(rocrand_sobol64_qrng_tests, discard_test)
+{
+    rocrand_sobol64::engine_type engine1(&h_sobol64_direction_vectors[64], 678);
+    rocrand_sobol64::engine_type engine2(&h_sobol64_direction_vectors[64], 676);
+
+    EXPECT_NE(engine1(), engine2());
+
+    engine2.discard();
+
+    EXPECT_NE(engine1(), engine2());
+
+    engine2.discard();
+
+    EXPECT_EQ(engine1(), engine2());
+    EXPECT_EQ(engine1(), engine2());
+
+    const unsigned int ds[] = {
+        0, 1, 4, 37, 583, 7452,
+        21032, 35678, 66778, 10313475, 82120230
+    };
+
+    for (auto d : ds)
+    {
+        for (unsigned int i = 0; i < d; i++)
+        {
+            engine1.discard();
+        }
+        engine2.discard(d);
+
+        EXPECT_EQ(engine1(), engine2());
+    }
+}
+
+TEST(rocrand_sobol64_qrng_tests, discard_stride_test)
+{
+    rocrand_sobol64::engine_type engine1(&h_sobol64_direction_vectors[128], 123);
+    rocrand_sobol64::engine_type engine2(&h_sobol64_direction_vectors[128], 123);
+
+    EXPECT_EQ(engine1(), engine2());
+
+    const unsigned int ds[] = {
+        1, 10, 12, 20, 4, 5, 30
+    };
+
+    for (auto d : ds)
+    {
+        engine1.discard(1 << d);
+        engine2.discard_stride(1 << d);
+
+        EXPECT_EQ(engine1(), engine2());
+    }
+}
+
+TEST(rocrand_sobol64_qrng_tests, discard_arbitrary_stride_test)
+{
+    rocrand_sobol64::engine_type engine1(&h_sobol64_direction_vectors[128], 123);
+    rocrand_sobol64::engine_type engine2(&h_sobol64_direction_vectors[128], 123);
+
+    EXPECT_EQ(engine1(), engine2());
+
+    const unsigned int ds[] = {
+        3, 6, 100, 768, 1000, 65535, 81920, 3000000
+    };
+
+    for (auto d : ds)
+    {
+        engine1.discard(d);
+        engine2.discard_stride(d);
+
+        EXPECT_EQ(engine1(), engine2());
+    }
+}
@@ -0,0 +1,212 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#include <stdio.h>
+#include <stdlib.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+class rocrand_state_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+void generate_and_copy(rocrand_generator generator,
+                       unsigned int * data,
+                       std::vector<unsigned int>& output)
+{
+    ROCRAND_CHECK(rocrand_generate(generator, data, output.size()));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(
+        hipMemcpy(
+            output.data(), data,
+            output.size() * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+}
+
+TEST_P(rocrand_state_tests, get_set_state_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    const size_t size = 12345;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    std::vector<unsigned int> output(size);
+    std::vector<unsigned int> expected(size);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    size_t state_size = 0;
+    if(rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        EXPECT_EQ(rocrand_get_state(generator, NULL, &state_size), ROCRAND_STATUS_TYPE_ERROR);
+        EXPECT_EQ(rocrand_set_state(generator, NULL, 0), ROCRAND_STATUS_TYPE_ERROR);
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+        HIP_CHECK(hipFree(data));
+        return;
+    }
+
+    ROCRAND_CHECK(rocrand_set_seed(generator, 5ULL));
+    ROCRAND_CHECK(rocrand_get_state(generator, NULL, &state_size));
+    ASSERT_GT(state_size, 0U);
+    std::vector<char> state(state_size);
+
+    size_t small_size = state_size - 1;
+    EXPECT_EQ(rocrand_get_state(generator, state.data(), &small_size), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(small_size, state_size);
+    EXPECT_EQ(rocrand_get_state(generator, state.data(), NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    // Save state after some generation
+    generate_and_copy(generator, data, output);
+    ROCRAND_CHECK(rocrand_get_state(generator, state.data(), &state_size));
+    generate_and_copy(generator, data, expected);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    rocrand_generator generator2;
+    ROCRAND_CHECK(rocrand_create_generator(&generator2, rng_type));
+    EXPECT_EQ(rocrand_set_state(generator2, state.data(), state_size - 1), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_set_state(generator2, NULL, state_size), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_set_state(generator2, state.data(), state_size));
+    generate_and_copy(generator2, data, output);
+    ASSERT_EQ(output, expected);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator2));
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST_P(rocrand_state_tests, state_cache_dir_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    if(rng_type == ROCRAND_RNG_QUASI_SOBOL32
+        || rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        || rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_64_10
+        || rng_type == ROCRAND_RNG_PSEUDO_THREEFRY2_64_20
+        || rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_64_20
+        || rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        // States are not cached
+        return;
+    }
+
+    const unsigned long long seed = 1234ULL;
+    const size_t size = 12345;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    std::vector<unsigned int> expected(size);
+    std::vector<unsigned int> output(size);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_seed(generator, seed));
+    generate_and_copy(generator, data, expected);
+    unsigned int blocks, threads;
+    ROCRAND_CHECK(rocrand_get_launch_config(generator, &blocks, &threads));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    char dir[] = "/tmp/rocrand_state_XXXXXX";
+    ASSERT_NE(mkdtemp(dir), nullptr);
+    ASSERT_EQ(setenv("ROCRAND_STATE_CACHE_DIR", dir, 1), 0);
+
+    // The first generator stores the state (initialized asynchronously,
+    // it is stored by the generation), the second one loads it
+    for(int i = 0; i < 2; i++)
+    {
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+        ROCRAND_CHECK(rocrand_set_seed(generator, seed));
+        if(i == 0)
+        {
+            ROCRAND_CHECK(rocrand_initialize_generator_async(generator));
+        }
+        generate_and_copy(generator, data, output);
+        ASSERT_EQ(output, expected);
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+
+    unsetenv("ROCRAND_STATE_CACHE_DIR");
+    const std::string path = std::string(dir) + "/rocrand_"
+        + std::to_string(static_cast<unsigned int>(rng_type)) + "_"
+        + std::to_string(seed) + "_0_"
+        + std::to_string(blocks) + "x" + std::to_string(threads) + ".state";
+    EXPECT_EQ(remove(path.c_str()), 0);
+    EXPECT_EQ(remove(dir), 0);
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST_P(rocrand_state_tests, save_load_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    const size_t size = 12345 * 3;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    std::vector<unsigned int> output(size);
+    std::vector<unsigned int> expected(size);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    if(rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    {
+        ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(generator, 3));
+    }
+    else
+    {
+        ROCRAND_CHECK(rocrand_set_seed(generator, 7ULL));
+    }
+    ROCRAND_CHECK(rocrand_set_offset(generator, 1000ULL));
+
+    size_t blob_size = 0;
+    EXPECT_EQ(rocrand_generator_save(generator, NULL, NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_generator_save(generator, NULL, &blob_size));
+    std::vector<char> blob(blob_size);
+
+    // Save after some generation
+    generate_and_copy(generator, data, output);
+    ROCRAND_CHECK(rocrand_generator_save(generator, blob.data(), &blob_size));
+    generate_and_copy(generator, data, expected);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    // Load to a generator with default settings
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    EXPECT_EQ(rocrand_generator_load(generator, blob.data(), blob_size - 1), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_generator_load(generator, NULL, blob_size), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_generator_load(generator, blob.data(), blob_size));
+    generate_and_copy(generator, data, output);
+    ASSERT_EQ(output, expected);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    // Blobs can't be loaded by generators of other types
+    const rocrand_rng_type other_type =
+        rng_type == ROCRAND_RNG_PSEUDO_XORWOW ? ROCRAND_RNG_PSEUDO_PHILOX4_32_10 : ROCRAND_RNG_PSEUDO_XORWOW;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, other_type));
+    EXPECT_EQ(rocrand_generator_load(generator, blob.data(), blob_size), ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    HIP_CHECK(hipFree(data));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_state_tests,
+                        rocrand_state_tests,
+                        ::testing::ValuesIn(rng_types));
@@ -0,0 +1,138 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <hip/hip_runtime.h>
+
+#define FQUALIFIERS __forceinline__ __host__ __device__
+#include <rocrand_kernel.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+
+template <class GeneratorState>
+__global__
+void rocrand_init_soa_kernel(void * states, const size_t states_size)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(state_id < states_size)
+    {
+        GeneratorState state;
+        rocrand_init(1234ULL, state_id, 5ULL, &state);
+        rocrand_store_state_soa(states, states_size, state_id, &state);
+    }
+}
+
+template <class GeneratorState>
+__global__
+void rocrand_soa_kernel(void * states, const size_t states_size,
+                        unsigned int * output, const unsigned int values_per_state)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(state_id < states_size)
+    {
+        GeneratorState state;
+        rocrand_load_state_soa(states, states_size, state_id, &state);
+        for(unsigned int i = 0; i < values_per_state; i++)
+        {
+            output[i * states_size + state_id] = rocrand(&state);
+        }
+        rocrand_store_state_soa(states, states_size, state_id, &state);
+    }
+}
+
+// States stored as structures of arrays generate the same values as states
+// initialized in every thread, also after they are stored and loaded again
+template<class GeneratorState>
+void state_soa_test()
+{
+    typedef GeneratorState state_type;
+
+    const size_t states_size = 300;
+    const unsigned int values_per_state = 8;
+    const size_t output_size = 2 * states_size * values_per_state;
+
+    void * states;
+    HIP_CHECK(hipMalloc(&states, states_size * sizeof(state_type)));
+    unsigned int * output;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(unsigned int)));
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_init_soa_kernel<state_type>),
+        dim3(3), dim3(128), 0, 0,
+        states, states_size
+    );
+    HIP_CHECK(hipPeekAtLastError());
+    for(unsigned int call = 0; call < 2; call++)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_soa_kernel<state_type>),
+            dim3(3), dim3(128), 0, 0,
+            states, states_size,
+            output + call * states_size * values_per_state, values_per_state
+        );
+        HIP_CHECK(hipPeekAtLastError());
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipFree(output));
+    HIP_CHECK(hipFree(states));
+
+    for(size_t si = 0; si < states_size; si++)
+    {
+        state_type state;
+        rocrand_init(1234ULL, si, 5ULL, &state);
+        for(unsigned int i = 0; i < 2 * values_per_state; i++)
+        {
+            ASSERT_EQ(output_host[i * states_size + si], rocrand(&state));
+        }
+    }
+}
+
+TEST(rocrand_state_soa_tests, xorwow_test)
+{
+    state_soa_test<rocrand_state_xorwow>();
+}
+
+TEST(rocrand_state_soa_tests, xorwow_compact_test)
+{
+    state_soa_test<rocrand_state_xorwow_compact>();
+}
+
+TEST(rocrand_state_soa_tests, mrg32k3a_test)
+{
+    state_soa_test<rocrand_state_mrg32k3a>();
+}
+
+TEST(rocrand_state_soa_tests, philox4x32_10_test)
+{
+    state_soa_test<rocrand_state_philox4x32_10>();
+}
@@ -0,0 +1,285 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+void generate_stateless(const bool host_side,
+                        const unsigned int blocks,
+                        const unsigned int threads,
+                        const size_t first_size,
+                        std::vector<unsigned int>& output)
+{
+    rocrand_generator generator;
+    if(host_side)
+    {
+        ROCRAND_CHECK(rocrand_create_generator_host(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    }
+    else
+    {
+        ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    }
+    ROCRAND_CHECK(rocrand_set_stateless(generator, 1));
+    ROCRAND_CHECK(rocrand_set_launch_config(generator, blocks, threads));
+    ROCRAND_CHECK(rocrand_set_seed(generator, 1234ULL));
+    ROCRAND_CHECK(rocrand_set_offset(generator, 100ULL));
+
+    const size_t size = output.size();
+    unsigned int * data = output.data();
+    if(!host_side)
+    {
+        HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    }
+
+    ROCRAND_CHECK(rocrand_generate(generator, data, first_size));
+    ROCRAND_CHECK(rocrand_generate(generator, data + first_size, size - first_size));
+
+    if(!host_side)
+    {
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(
+            hipMemcpy(
+                output.data(), data,
+                size * sizeof(unsigned int),
+                hipMemcpyDeviceToHost
+            )
+        );
+        HIP_CHECK(hipFree(data));
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+// Values depend only on the seed, the offset and their positions: neither
+// the launch configuration nor splitting into several calls changes them
+TEST(rocrand_stateless_tests, sequence_test)
+{
+    const size_t size = 123456;
+
+    std::vector<unsigned int> expected(size);
+    generate_stateless(false, 1024, 256, 0, expected);
+
+    std::vector<unsigned int> output1(size);
+    generate_stateless(false, 3, 64, 1000, output1);
+    ASSERT_EQ(output1, expected);
+
+    std::vector<unsigned int> output2(size);
+    generate_stateless(true, 16, 256, 4444, output2);
+    ASSERT_EQ(output2, expected);
+
+    double mean = 0;
+    for(auto v : expected)
+    {
+        mean += static_cast<double>(v) / UINT_MAX;
+    }
+    mean = mean / size;
+    EXPECT_NEAR(mean, 0.5, 0.01);
+}
+
+// Generates normal values of calls of sizes (in total size values) at the offset
+// to the buffer shifted by shift values
+void generate_stateless_split(const bool host_side,
+                              const unsigned long long offset,
+                              const std::vector<size_t>& sizes,
+                              const size_t shift,
+                              std::vector<float>& output)
+{
+    rocrand_generator generator;
+    if(host_side)
+    {
+        ROCRAND_CHECK(rocrand_create_generator_host(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    }
+    else
+    {
+        ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    }
+    ROCRAND_CHECK(rocrand_set_stateless(generator, 1));
+    ROCRAND_CHECK(rocrand_set_seed(generator, 1234ULL));
+    ROCRAND_CHECK(rocrand_set_offset(generator, offset));
+
+    const size_t size = output.size();
+    std::vector<float> buffer(size + shift);
+    float * data = buffer.data();
+    if(!host_side)
+    {
+        HIP_CHECK(hipMalloc((void **)&data, (size + shift) * sizeof(float)));
+    }
+
+    size_t position = 0;
+    for(size_t call_size : sizes)
+    {
+        ROCRAND_CHECK(
+            rocrand_generate_normal(generator, data + shift + position, call_size, 0.0f, 1.0f)
+        );
+        position += call_size;
+    }
+
+    if(!host_side)
+    {
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(
+            hipMemcpy(
+                buffer.data(), data,
+                (size + shift) * sizeof(float),
+                hipMemcpyDeviceToHost
+            )
+        );
+        HIP_CHECK(hipFree(data));
+    }
+    std::copy(buffer.begin() + shift, buffer.end(), output.begin());
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+// Splits and buffers do not need to be aligned to groups of values of one
+// state: values of calls of 7 and 9 values (also at offsets and to buffers
+// not aligned to 4 values) are the values of one call of 16 values
+TEST(rocrand_stateless_tests, misaligned_split_test)
+{
+    const bool host_sides[] = { false, true };
+    const unsigned long long offsets[] = { 0, 1, 102 };
+    for(const bool host_side : host_sides)
+    {
+        for(const unsigned long long offset : offsets)
+        {
+            SCOPED_TRACE(testing::Message() << "with host_side = " << host_side
+                                            << ", offset = " << offset);
+
+            std::vector<float> expected(16);
+            generate_stateless_split(host_side, offset, { 16 }, 0, expected);
+
+            std::vector<float> output(16);
+            generate_stateless_split(host_side, offset, { 7, 9 }, 0, output);
+            EXPECT_EQ(output, expected);
+            generate_stateless_split(host_side, offset, { 16 }, 3, output);
+            EXPECT_EQ(output, expected);
+            generate_stateless_split(host_side, offset, { 1, 2, 5, 8 }, 1, output);
+            EXPECT_EQ(output, expected);
+            // Different calls of the host-side and device generators of
+            // the same offset give the same values (up to host math functions)
+            std::vector<float> other(16);
+            generate_stateless_split(!host_side, offset, { 9, 7 }, 2, other);
+            for(size_t i = 0; i < 16; i++)
+            {
+                EXPECT_NEAR(other[i], expected[i], 1e-5f) << i;
+            }
+        }
+    }
+
+    // Values of consecutive offsets are shifted by one value
+    std::vector<float> expected(16);
+    generate_stateless_split(false, 0, { 16 }, 0, expected);
+    std::vector<float> output(16);
+    generate_stateless_split(false, 1, { 15, 1 }, 0, output);
+    for(size_t i = 0; i < 15; i++)
+    {
+        EXPECT_EQ(output[i], expected[i + 1]) << i;
+    }
+}
+
+TEST(rocrand_stateless_tests, rejection_test)
+{
+    const size_t size = 1 << 20;
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_stateless(generator, 1));
+
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    ROCRAND_CHECK(rocrand_generate_poisson(generator, data, size, 5000.0));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> output(size);
+    HIP_CHECK(
+        hipMemcpy(
+            output.data(), data,
+            size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    double mean = 0;
+    for(auto v : output)
+    {
+        mean += static_cast<double>(v);
+    }
+    mean = mean / size;
+    double variance = 0;
+    for(auto v : output)
+    {
+        variance += std::pow(v - mean, 2);
+    }
+    variance = variance / size;
+
+    EXPECT_NEAR(mean, 5000.0, 5000.0 * 1e-2);
+    EXPECT_NEAR(variance, 5000.0, 5000.0 * 1e-1);
+}
+
+// The state of a stateless generator is its position
+TEST(rocrand_stateless_tests, state_test)
+{
+    const size_t size = 12345;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_stateless(generator, 1));
+    ROCRAND_CHECK(rocrand_set_offset(generator, 7ULL));
+
+    size_t state_size = 0;
+    ROCRAND_CHECK(rocrand_get_state(generator, NULL, &state_size));
+    ASSERT_EQ(state_size, sizeof(unsigned long long));
+
+    unsigned long long position = 0;
+    ROCRAND_CHECK(rocrand_get_state(generator, &position, &state_size));
+    EXPECT_EQ(position, 7ULL);
+    ROCRAND_CHECK(rocrand_generate(generator, data, size));
+    ROCRAND_CHECK(rocrand_get_state(generator, &position, &state_size));
+    EXPECT_EQ(position, 7ULL + size);
+
+    // Disabling stateless mode resets the generator
+    ROCRAND_CHECK(rocrand_set_stateless(generator, 0));
+    ROCRAND_CHECK(rocrand_get_state(generator, NULL, &state_size));
+    EXPECT_GT(state_size, sizeof(unsigned long long));
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_stateless_tests, neg_test)
+{
+    EXPECT_EQ(rocrand_set_stateless(NULL, 1), ROCRAND_STATUS_NOT_CREATED);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(rocrand_set_stateless(generator, 1), ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
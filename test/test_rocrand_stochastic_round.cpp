@@ -0,0 +1,185 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include <rng/distribution/stochastic_round.hpp>
+
+#include "test_common.hpp"
+
+using rocrand_host::detail::float_to_bits_stochastic;
+
+// Values of the formats are not changed by any random bits
+TEST(rocrand_stochastic_round_tests, exact_values_test)
+{
+    for(unsigned int r = 0; r < (1U << 16); r += 255)
+    {
+        ASSERT_EQ((float_to_bits_stochastic<8, 7, 16, false>(1.0f, r)), 0x3F80U);
+        ASSERT_EQ((float_to_bits_stochastic<8, 7, 16, false>(-3.0f, r)), 0xC040U);
+        ASSERT_EQ((float_to_bits_stochastic<5, 10, 16, false>(1.0f, r)), 0x3C00U);
+        ASSERT_EQ((float_to_bits_stochastic<5, 10, 16, false>(65504.0f, r)), 0x7BFFU);
+        // The smallest half subnormal value
+        ASSERT_EQ((float_to_bits_stochastic<5, 10, 16, false>(std::ldexp(1.0f, -24), r)), 0x0001U);
+        ASSERT_EQ((float_to_bits_stochastic<5, 10, 16, false>(0.0f, r)), 0x0000U);
+        ASSERT_EQ((float_to_bits_stochastic<5, 10, 16, false>(-0.0f, r)), 0x8000U);
+    }
+    for(unsigned int r = 0; r < (1U << 8); r++)
+    {
+        ASSERT_EQ((float_to_bits_stochastic<4, 3, 8, true>(448.0f, r)), 0x7EU);
+        ASSERT_EQ((float_to_bits_stochastic<4, 3, 8, true>(std::ldexp(1.0f, -9), r)), 0x01U);
+        ASSERT_EQ((float_to_bits_stochastic<5, 2, 8, true>(-1.5f, r)), 0xBEU);
+    }
+}
+
+TEST(rocrand_stochastic_round_tests, special_values_test)
+{
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const float inf = std::numeric_limits<float>::infinity();
+    EXPECT_EQ((float_to_bits_stochastic<8, 7, 16, false>(nan, 0)), 0x7FFFU);
+    EXPECT_EQ((float_to_bits_stochastic<8, 7, 16, false>(-inf, 0)), 0xFF80U);
+    EXPECT_EQ((float_to_bits_stochastic<5, 10, 16, false>(inf, 0)), 0x7C00U);
+    EXPECT_EQ((float_to_bits_stochastic<5, 10, 16, false>(1e6f, 0)), 0x7C00U);
+    EXPECT_EQ((float_to_bits_stochastic<4, 3, 8, true>(nan, 0)), 0x7FU);
+    EXPECT_EQ((float_to_bits_stochastic<4, 3, 8, true>(-1e6f, 0)), 0xFEU);
+    EXPECT_EQ((float_to_bits_stochastic<5, 2, 8, true>(inf, 0)), 0x7BU);
+}
+
+// Over all random bits, values are rounded up as many times as the distance
+// from the lower neighbour in units of the spacing (normal and subnormal values)
+TEST(rocrand_stochastic_round_tests, probability_test)
+{
+    struct test_case { float v; unsigned int lower; double fraction; };
+    const test_case half_cases[] = {
+        { 1.0f + 0.25f * std::ldexp(1.0f, -10), 0x3C00U, 0.25 },
+        { -(2.0f + 0.75f * std::ldexp(1.0f, -9)), 0xC000U, 0.75 },
+        { 0.5f * std::ldexp(1.0f, -24), 0x0000U, 0.5 },
+        { 3.375f * std::ldexp(1.0f, -24), 0x0003U, 0.375 },
+    };
+    for(const test_case& c : half_cases)
+    {
+        unsigned int ups = 0;
+        for(unsigned int r = 0; r < (1U << 16); r++)
+        {
+            const unsigned int code = float_to_bits_stochastic<5, 10, 16, false>(c.v, r);
+            ASSERT_TRUE(code == c.lower || code == c.lower + 1) << c.v << " " << code;
+            ups += code == c.lower + 1 ? 1 : 0;
+        }
+        EXPECT_NEAR(ups / 65536.0, c.fraction, 1.0 / 65536.0) << c.v;
+    }
+
+    const test_case fp8_cases[] = {
+        { 1.0f + 0.5f * 0.125f, 0x38U, 0.5 },
+        { 0.25f * std::ldexp(1.0f, -9), 0x00U, 0.25 },
+    };
+    for(const test_case& c : fp8_cases)
+    {
+        unsigned int ups = 0;
+        for(unsigned int r = 0; r < (1U << 8); r++)
+        {
+            const unsigned int code = float_to_bits_stochastic<4, 3, 8, true>(c.v, r);
+            ASSERT_TRUE(code == c.lower || code == c.lower + 1) << c.v << " " << code;
+            ups += code == c.lower + 1 ? 1 : 0;
+        }
+        EXPECT_NEAR(ups / 256.0, c.fraction, 1.0 / 256.0) << c.v;
+    }
+}
+
+class rocrand_stochastic_round_generator_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+// Inputs between two neighbours of every format (1.0 and 1.0 + spacing) are
+// rounded up with the probability 0.3, n is not a multiple of values of
+// an engine value
+TEST_P(rocrand_stochastic_round_generator_tests, generate_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    struct format_case { rocrand_round_format format; float spacing; unsigned int one; size_t size; };
+    const format_case cases[] = {
+        { ROCRAND_ROUND_FORMAT_BFLOAT16, std::ldexp(1.0f, -7), 0x3F80U, 2 },
+        { ROCRAND_ROUND_FORMAT_HALF, std::ldexp(1.0f, -10), 0x3C00U, 2 },
+        { ROCRAND_ROUND_FORMAT_FP8_E4M3, std::ldexp(1.0f, -3), 0x38U, 1 },
+        { ROCRAND_ROUND_FORMAT_FP8_E5M2, std::ldexp(1.0f, -2), 0x3CU, 1 },
+    };
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t n = 100003;
+    float * input;
+    unsigned char * output;
+    HIP_CHECK(hipMalloc((void **)&input, n * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&output, n * 2));
+
+    for(const format_case& c : cases)
+    {
+        SCOPED_TRACE(testing::Message() << "with format = " << c.format);
+
+        const std::vector<float> values(n, 1.0f + 0.3f * c.spacing);
+        HIP_CHECK(hipMemcpy(input, values.data(), n * sizeof(float), hipMemcpyHostToDevice));
+
+        const rocrand_status status = rocrand_stochastic_round(generator, input, output, n, c.format);
+        if(rng_type == ROCRAND_RNG_PSEUDO_MTGP32 || rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+        {
+            EXPECT_EQ(status, ROCRAND_STATUS_TYPE_ERROR);
+            continue;
+        }
+        ROCRAND_CHECK(status);
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<unsigned char> bytes(n * c.size);
+        HIP_CHECK(hipMemcpy(bytes.data(), output, n * c.size, hipMemcpyDeviceToHost));
+
+        size_t ups = 0;
+        for(size_t i = 0; i < n; i++)
+        {
+            const unsigned int code = c.size == 2
+                ? bytes[2 * i] | (bytes[2 * i + 1] << 8)
+                : bytes[i];
+            ASSERT_TRUE(code == c.one || code == c.one + 1) << i << " " << code;
+            ups += code == c.one + 1 ? 1 : 0;
+        }
+        EXPECT_NEAR(static_cast<double>(ups) / n, 0.3, 0.01);
+    }
+
+    EXPECT_EQ(
+        rocrand_stochastic_round(generator, NULL, output, n, ROCRAND_ROUND_FORMAT_HALF),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_stochastic_round(generator, input, output, n, static_cast<rocrand_round_format>(4)),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+
+    HIP_CHECK(hipFree(input));
+    HIP_CHECK(hipFree(output));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_stochastic_round_generator_tests,
+                        rocrand_stochastic_round_generator_tests,
+                        ::testing::ValuesIn(rng_types));
@@ -0,0 +1,109 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+const rocrand_rng_type store_policy_rng_types[] = {
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
+    ROCRAND_RNG_PSEUDO_THREEFRY2_64_20,
+    ROCRAND_RNG_PSEUDO_THREEFRY4_64_20,
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_7,
+    ROCRAND_RNG_PSEUDO_MRG32K3A,
+    ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_XOSHIRO128PP,
+    ROCRAND_RNG_PSEUDO_PCG32,
+    ROCRAND_RNG_PSEUDO_MTGP32,
+    ROCRAND_RNG_QUASI_SOBOL32,
+    ROCRAND_RNG_QUASI_SOBOL64
+};
+
+class rocrand_store_policy_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+void generate_with_policy(const rocrand_rng_type rng_type,
+                          const rocrand_store_policy policy,
+                          std::vector<float>& output)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_store_policy(generator, policy));
+
+    const size_t size = output.size();
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(float)));
+    // Misaligned data and sizes that are not multiples of vectors
+    ROCRAND_CHECK(rocrand_generate_uniform(generator, data + 1, size - 1));
+    ROCRAND_CHECK(rocrand_generate_normal(generator, data, size / 2, 0.0f, 1.0f));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(
+        hipMemcpy(
+            output.data(), data,
+            size * sizeof(float),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+// Streaming stores produce the same values as regular stores
+TEST_P(rocrand_store_policy_tests, streaming_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    std::vector<float> expected(1234567);
+    generate_with_policy(rng_type, ROCRAND_STORE_POLICY_DEFAULT, expected);
+    std::vector<float> output(1234567);
+    generate_with_policy(rng_type, ROCRAND_STORE_POLICY_STREAMING, output);
+    ASSERT_EQ(output, expected);
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_store_policy_tests,
+                        rocrand_store_policy_tests,
+                        ::testing::ValuesIn(store_policy_rng_types));
+
+TEST(rocrand_store_policy_neg_tests, neg_test)
+{
+    EXPECT_EQ(
+        rocrand_set_store_policy(NULL, ROCRAND_STORE_POLICY_STREAMING),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(
+        rocrand_set_store_policy(generator, static_cast<rocrand_store_policy>(5)),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    // Host-side generators use regular stores
+    ROCRAND_CHECK(rocrand_create_generator_host(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    std::vector<unsigned int> output(1000);
+    ROCRAND_CHECK(rocrand_set_store_policy(generator, ROCRAND_STORE_POLICY_STREAMING));
+    ROCRAND_CHECK(rocrand_generate(generator, output.data(), output.size()));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
@@ -0,0 +1,164 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+class rocrand_stream_producer_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+// Waits for n values, copies them to output and releases them
+__global__
+void consume_kernel(rocrand_ring_buffer buffer, unsigned int * output, const size_t n)
+{
+    __shared__ unsigned long long begin;
+    if(hipThreadIdx_x == 0)
+    {
+        volatile unsigned long long * head = buffer.head;
+        begin = *buffer.tail;
+        while(*head - begin < n) { }
+    }
+    __syncthreads();
+    __threadfence();
+
+    for(size_t i = hipThreadIdx_x; i < n; i += hipBlockDim_x)
+    {
+        output[i] = buffer.data[(begin + i) % buffer.capacity];
+    }
+
+    __syncthreads();
+    if(hipThreadIdx_x == 0)
+    {
+        atomicExch(buffer.tail, begin + n);
+    }
+}
+
+// Consumes chunks * chunk_size values (several times the capacity)
+void consume(const rocrand_rng_type rng_type, std::vector<unsigned int>& output)
+{
+    const size_t capacity = 1 << 18;
+    const size_t chunk_size = capacity / 4;
+    const size_t chunks = 16;
+
+    // hipFree() can wait for the device, so memory is released after
+    // the producer is destroyed
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, chunks * chunk_size * sizeof(unsigned int)));
+
+    rocrand_stream_producer producer;
+    ROCRAND_CHECK(rocrand_create_stream_producer(&producer, rng_type, 1234ULL, capacity));
+    rocrand_ring_buffer buffer;
+    ROCRAND_CHECK(rocrand_stream_producer_get_buffer(producer, &buffer));
+    ASSERT_EQ(buffer.capacity, capacity);
+
+    for(size_t c = 0; c < chunks; c++)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(consume_kernel),
+            dim3(1), dim3(256), 0, stream,
+            buffer, data + c * chunk_size, chunk_size
+        );
+        HIP_CHECK(hipPeekAtLastError());
+    }
+    HIP_CHECK(hipStreamSynchronize(stream));
+
+    output.resize(chunks * chunk_size);
+    HIP_CHECK(
+        hipMemcpyAsync(
+            output.data(), data,
+            output.size() * sizeof(unsigned int),
+            hipMemcpyDeviceToHost, stream
+        )
+    );
+    HIP_CHECK(hipStreamSynchronize(stream));
+
+    ROCRAND_CHECK(rocrand_destroy_stream_producer(producer));
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipStreamDestroy(stream));
+}
+
+TEST_P(rocrand_stream_producer_tests, consume_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    std::vector<unsigned int> output;
+    consume(rng_type, output);
+
+    double mean = 0;
+    for(auto v : output)
+    {
+        mean += static_cast<double>(v) / UINT_MAX;
+    }
+    mean = mean / output.size();
+    EXPECT_NEAR(mean, 0.5, 0.01);
+
+    // Values are not read twice
+    const size_t quarter = output.size() / 4;
+    size_t same = 0;
+    for(size_t i = 0; i < quarter; i++)
+    {
+        if(output[i] == output[i + quarter]) same++;
+    }
+    EXPECT_LT(same, quarter / 1000);
+
+    // Streams with the same seed are the same on the same device
+    std::vector<unsigned int> expected;
+    consume(rng_type, expected);
+    ASSERT_EQ(output, expected);
+}
+
+TEST(rocrand_stream_producer_tests, neg_test)
+{
+    rocrand_stream_producer producer;
+    EXPECT_EQ(
+        rocrand_create_stream_producer(NULL, ROCRAND_RNG_PSEUDO_XORWOW, 0, 512),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_create_stream_producer(&producer, ROCRAND_RNG_QUASI_SOBOL32, 0, 1 << 20),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    EXPECT_EQ(
+        rocrand_create_stream_producer(&producer, ROCRAND_RNG_PSEUDO_XORWOW, 0, 511),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(rocrand_stream_producer_get_buffer(NULL, NULL), ROCRAND_STATUS_NOT_CREATED);
+    EXPECT_EQ(rocrand_destroy_stream_producer(NULL), ROCRAND_STATUS_NOT_CREATED);
+
+    ROCRAND_CHECK(rocrand_create_stream_producer(&producer, ROCRAND_RNG_PSEUDO_XORWOW, 0, 512));
+    EXPECT_EQ(rocrand_stream_producer_get_buffer(producer, NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_destroy_stream_producer(producer));
+}
+
+const rocrand_rng_type stream_producer_rng_types[] = {
+    ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+};
+
+INSTANTIATE_TEST_CASE_P(rocrand_stream_producer_tests,
+                        rocrand_stream_producer_tests,
+                        ::testing::ValuesIn(stream_producer_rng_types));
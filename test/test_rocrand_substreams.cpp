@@ -0,0 +1,186 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include "test_common.hpp"
+
+class rocrand_substreams_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+// The first substream of a generator with 2 substreams generates the same
+// values as a generator with half of its engines
+TEST_P(rocrand_substreams_tests, first_substream_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    const size_t size = 123457;
+
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(float)));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_launch_config(generator, 8, 256));
+    ROCRAND_CHECK(rocrand_set_seed(generator, 1357ULL));
+    ROCRAND_CHECK(rocrand_set_substreams(generator, 2, NULL));
+    std::vector<float> output(2 * size);
+    ROCRAND_CHECK(rocrand_generate_uniform_on(generator, 0, data, size));
+    HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(float), hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_generate_normal_on(generator, 0, data, size, 1.0f, 2.0f));
+    HIP_CHECK(hipMemcpy(
+        output.data() + size, data, size * sizeof(float), hipMemcpyDeviceToHost
+    ));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_launch_config(generator, 4, 256));
+    ROCRAND_CHECK(rocrand_set_seed(generator, 1357ULL));
+    std::vector<float> expected(2 * size);
+    ROCRAND_CHECK(rocrand_generate_uniform(generator, data, size));
+    HIP_CHECK(hipMemcpy(expected.data(), data, size * sizeof(float), hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_generate_normal(generator, data, size, 1.0f, 2.0f));
+    HIP_CHECK(hipMemcpy(
+        expected.data() + size, data, size * sizeof(float), hipMemcpyDeviceToHost
+    ));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(data));
+
+    ASSERT_EQ(output, expected);
+}
+
+// Host threads generate with different substreams in their own streams
+// at the same time, the values do not depend on the order of calls
+TEST_P(rocrand_substreams_tests, concurrent_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    const unsigned int count = 4;
+    const unsigned int calls = 10;
+    const size_t size = 40000;
+
+    std::vector<hipStream_t> streams(count);
+    std::vector<unsigned int *> data(count);
+    for(unsigned int i = 0; i < count; i++)
+    {
+        HIP_CHECK(hipStreamCreate(&streams[i]));
+        HIP_CHECK(hipMalloc((void **)&data[i], calls * size * sizeof(unsigned int)));
+    }
+
+    std::vector<std::vector<unsigned int> > outputs[2];
+    for(int run = 0; run < 2; run++)
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+        ROCRAND_CHECK(rocrand_set_launch_config(generator, 8, 256));
+        ROCRAND_CHECK(rocrand_set_substreams(generator, count, streams.data()));
+
+        std::vector<std::thread> threads;
+        std::vector<rocrand_status> statuses(count, ROCRAND_STATUS_SUCCESS);
+        for(unsigned int i = 0; i < count; i++)
+        {
+            // The second run generates by substreams in the reverse order
+            const unsigned int substream = run == 0 ? i : count - 1 - i;
+            threads.emplace_back(
+                [&, substream]()
+                {
+                    for(unsigned int c = 0; c < calls; c++)
+                    {
+                        const rocrand_status status = rocrand_generate_on(
+                            generator, substream, data[substream] + c * size, size
+                        );
+                        if(status != ROCRAND_STATUS_SUCCESS)
+                            statuses[substream] = status;
+                    }
+                }
+            );
+        }
+        for(std::thread& thread : threads)
+        {
+            thread.join();
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+        for(unsigned int i = 0; i < count; i++)
+        {
+            ASSERT_EQ(statuses[i], ROCRAND_STATUS_SUCCESS);
+        }
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+        outputs[run].resize(count, std::vector<unsigned int>(calls * size));
+        for(unsigned int i = 0; i < count; i++)
+        {
+            HIP_CHECK(hipMemcpy(
+                outputs[run][i].data(), data[i], calls * size * sizeof(unsigned int),
+                hipMemcpyDeviceToHost
+            ));
+        }
+    }
+
+    for(unsigned int i = 0; i < count; i++)
+    {
+        ASSERT_EQ(outputs[0][i], outputs[1][i]);
+        if(i > 0)
+        {
+            // Substreams use different engines
+            ASSERT_NE(outputs[0][i], outputs[0][0]);
+        }
+        HIP_CHECK(hipFree(data[i]));
+        HIP_CHECK(hipStreamDestroy(streams[i]));
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(rocrand_substreams_tests,
+                        rocrand_substreams_tests,
+                        ::testing::Values(ROCRAND_RNG_PSEUDO_XORWOW, ROCRAND_RNG_PSEUDO_MRG32K3A,
+                                          ROCRAND_RNG_PSEUDO_XOSHIRO128PP, ROCRAND_RNG_PSEUDO_PCG32));
+
+TEST(rocrand_substreams_neg_tests, neg_test)
+{
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, 100 * sizeof(unsigned int)));
+
+    EXPECT_EQ(rocrand_set_substreams(NULL, 2, NULL), ROCRAND_STATUS_NOT_CREATED);
+    EXPECT_EQ(rocrand_generate_on(NULL, 0, data, 100), ROCRAND_STATUS_NOT_CREATED);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    EXPECT_EQ(rocrand_set_substreams(generator, 2, NULL), ROCRAND_STATUS_TYPE_ERROR);
+    EXPECT_EQ(rocrand_generate_on(generator, 0, data, 100), ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+    ROCRAND_CHECK(rocrand_set_launch_config(generator, 8, 256));
+    EXPECT_EQ(rocrand_generate_on(generator, 0, data, 100), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_set_substreams(generator, 3, NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_set_substreams(generator, 2, NULL));
+    EXPECT_EQ(rocrand_generate_on(generator, 2, data, 100), ROCRAND_STATUS_OUT_OF_RANGE);
+    // Engines are reset, substreams must be set again
+    ROCRAND_CHECK(rocrand_set_seed(generator, 1ULL));
+    EXPECT_EQ(rocrand_generate_on(generator, 0, data, 100), ROCRAND_STATUS_NOT_CREATED);
+    ROCRAND_CHECK(rocrand_set_substreams(generator, 2, NULL));
+    ROCRAND_CHECK(rocrand_generate_on(generator, 1, data, 100));
+    ROCRAND_CHECK(rocrand_set_substreams(generator, 0, NULL));
+    EXPECT_EQ(rocrand_generate_on(generator, 0, data, 100), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(data));
+}
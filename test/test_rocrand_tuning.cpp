@@ -0,0 +1,145 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include <rng/tuning.hpp>
+
+#include "test_common.hpp"
+
+using rocrand_host::detail::tuning_database;
+using rocrand_host::detail::tuning_entry;
+
+TEST(rocrand_tuning_tests, bucket_test)
+{
+    EXPECT_EQ(rocrand_host::detail::tuning_bucket(1), 0U);
+    EXPECT_EQ(rocrand_host::detail::tuning_bucket(1023), 9U);
+    EXPECT_EQ(rocrand_host::detail::tuning_bucket(1024), 10U);
+    EXPECT_EQ(rocrand_host::detail::tuning_bucket(1ULL << 40), 40U);
+}
+
+void generate_with_config(const rocrand_rng_type rng_type,
+                          const bool dynamic,
+                          const size_t size,
+                          std::vector<unsigned int>& output,
+                          unsigned int& blocks,
+                          unsigned int& threads)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    if(dynamic)
+    {
+        ROCRAND_CHECK(rocrand_set_ordering(generator, ROCRAND_ORDERING_PSEUDO_DYNAMIC));
+    }
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    ROCRAND_CHECK(rocrand_generate(generator, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+    output.resize(size);
+    HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_get_launch_config(generator, &blocks, &threads));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+// Generators whose results do not depend on the launch configuration use
+// tuned configurations of the nearest size bucket, results do not change
+TEST(rocrand_tuning_tests, database_test)
+{
+    struct tuning_case
+    {
+        rocrand_rng_type rng_type;
+        bool dynamic;
+        unsigned int blocks;
+        unsigned int threads;
+    };
+    const tuning_case cases[] = {
+        { ROCRAND_RNG_QUASI_SOBOL32, false, 64, 128 },
+        { ROCRAND_RNG_PSEUDO_XORWOW, true, 2048, 64 },
+        { ROCRAND_RNG_PSEUDO_MRG32K3A, true, 128, 1024 },
+        { ROCRAND_RNG_PSEUDO_MTGP32, true, 100, 256 },
+    };
+    const size_t size = (1 << 20) + 11;
+
+    std::vector<std::vector<unsigned int>> expected;
+    for(const tuning_case& c : cases)
+    {
+        unsigned int blocks, threads;
+        expected.push_back(std::vector<unsigned int>());
+        generate_with_config(c.rng_type, c.dynamic, size, expected.back(), blocks, threads);
+    }
+
+    char dir[] = "/tmp/rocrand_tuning_XXXXXX";
+    ASSERT_NE(mkdtemp(dir), nullptr);
+    ASSERT_EQ(setenv("ROCRAND_TUNING_DIR", dir, 1), 0);
+    int device;
+    HIP_CHECK(hipGetDevice(&device));
+    const std::string path = tuning_database::path(device);
+    ASSERT_FALSE(path.empty());
+
+    std::vector<tuning_entry> entries;
+    for(const tuning_case& c : cases)
+    {
+        // Only the entry of the nearest bucket is used
+        entries.push_back({ static_cast<unsigned int>(c.rng_type), 4, 21, c.blocks, c.threads });
+        entries.push_back({ static_cast<unsigned int>(c.rng_type), 4, 10, 1, 1024 });
+        entries.push_back({ static_cast<unsigned int>(c.rng_type), 8, 20, 1, 1024 });
+    }
+    ASSERT_TRUE(tuning_database::write(path, entries));
+    ASSERT_EQ(tuning_database::read(path).size(), entries.size());
+
+    for(size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        const tuning_case& c = cases[i];
+        SCOPED_TRACE(testing::Message() << "with rng_type = " << c.rng_type);
+
+        std::vector<unsigned int> output;
+        unsigned int blocks, threads;
+        generate_with_config(c.rng_type, c.dynamic, size, output, blocks, threads);
+        EXPECT_EQ(blocks, c.blocks);
+        EXPECT_EQ(threads, c.threads);
+        ASSERT_TRUE(output == expected[i]);
+    }
+
+    // Explicit launch configurations are not tuned
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL32));
+    ROCRAND_CHECK(rocrand_set_launch_config(generator, 16, 256));
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    ROCRAND_CHECK(rocrand_generate(generator, data, size));
+    HIP_CHECK(hipFree(data));
+    unsigned int blocks, threads;
+    ROCRAND_CHECK(rocrand_get_launch_config(generator, &blocks, &threads));
+    EXPECT_EQ(blocks, 16U);
+    EXPECT_EQ(threads, 256U);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    unsetenv("ROCRAND_TUNING_DIR");
+    EXPECT_EQ(remove(path.c_str()), 0);
+    EXPECT_EQ(remove(dir), 0);
+}
@@ -2,6 +2,7 @@
 #include <fstream>
 #include <string>
 #include <iomanip>
+#include <cstdlib>
 #include <cstring>
 
 using namespace std;
@@ -80,25 +81,57 @@ void mod_mat_sq(unsigned long long * A,
 }
 
 
-void init_matrices(unsigned long long * matrix, unsigned long long * A, int n, unsigned long long m)
+// c = a * b mod m
+void mod_mat_mul(unsigned long long * c,
+                 const unsigned long long * a,
+                 const unsigned long long * b,
+                 unsigned long long m)
 {
+    unsigned long long x[9];
+    for (size_t i = 0; i < 3; i++) {
+        for (size_t j = 0; j < 3; j++) {
+            unsigned long long s = 0;
+            for (size_t k = 0; k < 3; k++) {
+                s += (a[i + 3 * k] * b[k + 3 * j]) % m;
+            }
+            x[i + 3 * j] = s % m;
+        }
+    }
+    for (size_t i = 0; i < 9; i++)
+        c[i] = x[i];
+}
+
+// Jumps are done digit by digit in radix 2^log2: matrix contains A^(d * radix^k)
+// for all positions k < n and digits d in [1, radix)
+void init_matrices(unsigned long long * matrix, unsigned long long * A, int n, int log2, unsigned long long m)
+{
+    const int digits = (1 << log2) - 1;
     unsigned long long x[9];
     for (int i = 0; i < 9; i++)
         x[i] = A[i];
 
     for (int i = 0 ; i < n ; i++) {
         if (i > 0) {
-            mod_mat_sq(x, m);
+            for (int b = 0; b < log2; b++)
+                mod_mat_sq(x, m);
         }
+        unsigned long long * position = matrix + i * digits * 9;
         for (int j = 0; j < 9; j++)
-            matrix[j + (i * 9)] = x[j];
+            position[j] = x[j];
+        for (int d = 1; d < digits; d++)
+            mod_mat_mul(position + d * 9, position + (d - 1) * 9, x, m);
     }
 }
 
 void write_matrices(std::ofstream& fout, const std::string name, unsigned long long * a, int n, int bits, bool is_device)
 {
-    fout << "static const ";
-    fout << (is_device ? "__device__ " : "") << "unsigned long long " << name << "[MRG323A_N] = " << std::endl;
+    fout << (is_device ? "ROCRAND_DEVICE_TABLE const __device__ " : "static const ");
+    fout << "unsigned long long " << name << "[MRG323A_N]" << (is_device ? "" : " = ") << std::endl;
+    if (is_device)
+    {
+        fout << "#if defined(ROCRAND_DEVICE_TABLE_DEFINITIONS)" << std::endl;
+        fout << "    =" << std::endl;
+    }
     fout << "    {" << std::endl;
     fout << "        ";
     for (int k = 0; k < n; k++)
@@ -108,21 +141,44 @@ void write_matrices(std::ofstream& fout, const std::string name, unsigned long l
             fout  << std::endl << "        ";
     }
     fout << std::endl;
-    fout << "    };" << std::endl;
+    if (is_device)
+    {
+        fout << "    }" << std::endl;
+        fout << "#endif" << std::endl;
+        fout << "    ;" << std::endl;
+    }
+    else
+    {
+        fout << "    };" << std::endl;
+    }
     fout << std::endl;
 }
 
 int main(int argc, char const *argv[])
 {
-    if (argc != 2 || std::string(argv[1]) == "--help")
+    int MRG32K3A_JUMP_LOG2 = 1;
+    bool valid = argc >= 2 && std::string(argv[1]) != "--help";
+    if (valid && argc > 2)
+    {
+        valid = argc == 4 && std::string(argv[2]) == "--radix-log2";
+        if (valid)
+        {
+            MRG32K3A_JUMP_LOG2 = std::atoi(argv[3]);
+            valid = MRG32K3A_JUMP_LOG2 >= 1 && MRG32K3A_JUMP_LOG2 <= 8;
+        }
+    }
+    if (!valid)
     {
         std::cout << "Usage:" << std::endl;
-        std::cout << "  ./mrg32k3a_precomputed_generator ../../library/include/rocrand_mrg32k3a_precomputed.h" << std::endl;
+        std::cout << "  ./mrg32k3a_precomputed_generator ../../library/include/rocrand_mrg32k3a_precomputed.h [--radix-log2 <1..8>]" << std::endl;
+        std::cout << "Default: radix 2 (jumps by 16^k with --radix-log2 4 need at most 16 matrix-vector" << std::endl;
+        std::cout << "products instead of 64, the tables are 3.75 times larger)" << std::endl;
         return -1;
     }
 
-    unsigned int MRG323A_DIM = 64;
-    unsigned int MRG323A_N = MRG323A_DIM * 9;
+    // Number of digit positions of 64-bit jumps
+    unsigned int MRG323A_DIM = (64 + MRG32K3A_JUMP_LOG2 - 1) / MRG32K3A_JUMP_LOG2;
+    unsigned int MRG323A_N = MRG323A_DIM * ((1 << MRG32K3A_JUMP_LOG2) - 1) * 9;
     unsigned long long * A1 = new unsigned long long[MRG323A_N];
     unsigned long long * A2 = new unsigned long long[MRG323A_N];
     unsigned long long * A1P67 = new unsigned long long[MRG323A_N];
@@ -130,12 +186,12 @@ int main(int argc, char const *argv[])
     unsigned long long * A1P127 = new unsigned long long[MRG323A_N];
     unsigned long long * A2P127 = new unsigned long long[MRG323A_N];
 
-    init_matrices(A1, A1_, MRG323A_DIM, ROCRAND_MRG32K3A_M1);
-    init_matrices(A2, A2_, MRG323A_DIM, ROCRAND_MRG32K3A_M2);
-    init_matrices(A1P67, A1p67, MRG323A_DIM, ROCRAND_MRG32K3A_M1);
-    init_matrices(A2P67, A2p67, MRG323A_DIM, ROCRAND_MRG32K3A_M2);
-    init_matrices(A1P127, A1p127, MRG323A_DIM, ROCRAND_MRG32K3A_M1);
-    init_matrices(A2P127, A2p127, MRG323A_DIM, ROCRAND_MRG32K3A_M2);
+    init_matrices(A1, A1_, MRG323A_DIM, MRG32K3A_JUMP_LOG2, ROCRAND_MRG32K3A_M1);
+    init_matrices(A2, A2_, MRG323A_DIM, MRG32K3A_JUMP_LOG2, ROCRAND_MRG32K3A_M2);
+    init_matrices(A1P67, A1p67, MRG323A_DIM, MRG32K3A_JUMP_LOG2, ROCRAND_MRG32K3A_M1);
+    init_matrices(A2P67, A2p67, MRG323A_DIM, MRG32K3A_JUMP_LOG2, ROCRAND_MRG32K3A_M2);
+    init_matrices(A1P127, A1p127, MRG323A_DIM, MRG32K3A_JUMP_LOG2, ROCRAND_MRG32K3A_M1);
+    init_matrices(A2P127, A2p127, MRG323A_DIM, MRG32K3A_JUMP_LOG2, ROCRAND_MRG32K3A_M2);
     const std::string file_path(argv[1]);
     std::ofstream fout(file_path, std::ios_base::out | std::ios_base::trunc);
     fout << R"(// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
@@ -168,6 +224,7 @@ int main(int argc, char const *argv[])
 
     fout << "#define MRG323A_DIM " << MRG323A_DIM << std::endl;
     fout << "#define MRG323A_N " << MRG323A_N << std::endl;
+    fout << "#define MRG32K3A_JUMP_LOG2 " << MRG32K3A_JUMP_LOG2 << std::endl;
     fout << std::endl;
 
     write_matrices(fout, "d_A1", A1, MRG323A_N, 9, true);
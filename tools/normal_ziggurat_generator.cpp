@@ -0,0 +1,164 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <iomanip>
+#include <cmath>
+
+// Marsaglia and Tsang, "The Ziggurat Method for Generating Random Variables"
+#define ZIGGURAT_LAYERS 128
+// Start of the tail
+#define ZIGGURAT_R 3.442619855899L
+// Area of every layer
+#define ZIGGURAT_V 9.91256303526217e-3L
+
+// Computes tables for layers scaled by m: k[i] is the ratio x[i-1]/x[i]
+// multiplied by m, w[i] = x[i]/m and f[i] = exp(-x[i]^2/2).
+void generate_tables(long double * k, long double * w, long double * f, long double m)
+{
+    long double dn = ZIGGURAT_R;
+    long double tn = dn;
+    const long double q = ZIGGURAT_V / std::exp(-0.5L * dn * dn);
+
+    k[0] = (dn / q) * m;
+    k[1] = 0;
+    w[0] = q / m;
+    w[ZIGGURAT_LAYERS - 1] = dn / m;
+    f[0] = 1.0L;
+    f[ZIGGURAT_LAYERS - 1] = std::exp(-0.5L * dn * dn);
+
+    for(int i = ZIGGURAT_LAYERS - 2; i >= 1; i--)
+    {
+        dn = std::sqrt(-2.0L * std::log(ZIGGURAT_V / dn + std::exp(-0.5L * dn * dn)));
+        k[i + 1] = (dn / tn) * m;
+        tn = dn;
+        f[i] = std::exp(-0.5L * dn * dn);
+        w[i] = dn / m;
+    }
+}
+
+void write_table(std::ofstream& fout, const std::string name, const std::string type,
+                 const long double * a, bool is_integer, int digits, bool is_device)
+{
+    fout << (is_device ? "ROCRAND_DEVICE_TABLE const __constant__ " : "static const ") << type << " " << name
+         << "[ROCRAND_ZIGGURAT_LAYERS]" << (is_device ? "" : " =") << std::endl;
+    if(is_device)
+    {
+        fout << "#if defined(ROCRAND_DEVICE_TABLE_DEFINITIONS)" << std::endl;
+        fout << "    =" << std::endl;
+    }
+    fout << "    {" << std::endl;
+    fout << std::setprecision(digits);
+    for(int i = 0; i < ZIGGURAT_LAYERS; i++)
+    {
+        if(i % 4 == 0)
+            fout << "        ";
+        if(is_integer)
+        {
+            fout << static_cast<unsigned long long>(a[i]) << (type == "unsigned int" ? "U" : "ULL");
+        }
+        else
+        {
+            fout << std::scientific << a[i] << (type == "float" ? "f" : "");
+        }
+        fout << ((i + 1) % 4 == 0 ? ",\n" : ", ");
+    }
+    if(is_device)
+    {
+        fout << "    }" << std::endl;
+        fout << "#endif" << std::endl;
+        fout << "    ;" << std::endl;
+    }
+    else
+    {
+        fout << "    };" << std::endl;
+    }
+    fout << std::endl;
+}
+
+int main(int argc, char const *argv[])
+{
+    if (argc != 2 || std::string(argv[1]) == "--help")
+    {
+        std::cout << "Usage:" << std::endl;
+        std::cout << "  ./normal_ziggurat_generator ../../library/include/rocrand_normal_ziggurat_precomputed.h" << std::endl;
+        return -1;
+    }
+
+    long double k32[ZIGGURAT_LAYERS], w32[ZIGGURAT_LAYERS], f32[ZIGGURAT_LAYERS];
+    long double k64[ZIGGURAT_LAYERS], w64[ZIGGURAT_LAYERS], f64[ZIGGURAT_LAYERS];
+    // 24 bits of a 32-bit value are used for x, 53 bits of a 64-bit value
+    generate_tables(k32, w32, f32, 16777216.0L);
+    generate_tables(k64, w64, f64, 9007199254740992.0L);
+
+    const std::string file_path(argv[1]);
+    std::ofstream fout(file_path, std::ios_base::out | std::ios_base::trunc);
+    fout << R"(// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_NORMAL_ZIGGURAT_PRECOMPUTED_H_
+#define ROCRAND_NORMAL_ZIGGURAT_PRECOMPUTED_H_
+
+// Auto-generated file. Do not edit!
+// Generated by tools/normal_ziggurat_generator
+
+)";
+
+    fout << "#define ROCRAND_ZIGGURAT_LAYERS " << ZIGGURAT_LAYERS << std::endl;
+    fout << "#define ROCRAND_ZIGGURAT_R " << std::setprecision(13) << ZIGGURAT_R << std::endl;
+    fout << std::endl;
+
+    write_table(fout, "d_ziggurat_k32", "unsigned int", k32, true, 0, true);
+    write_table(fout, "h_ziggurat_k32", "unsigned int", k32, true, 0, false);
+    write_table(fout, "d_ziggurat_w32", "float", w32, false, 8, true);
+    write_table(fout, "h_ziggurat_w32", "float", w32, false, 8, false);
+    write_table(fout, "d_ziggurat_f32", "float", f32, false, 8, true);
+    write_table(fout, "h_ziggurat_f32", "float", f32, false, 8, false);
+    write_table(fout, "d_ziggurat_k64", "unsigned long long", k64, true, 0, true);
+    write_table(fout, "h_ziggurat_k64", "unsigned long long", k64, true, 0, false);
+    write_table(fout, "d_ziggurat_w64", "double", w64, false, 16, true);
+    write_table(fout, "h_ziggurat_w64", "double", w64, false, 16, false);
+    write_table(fout, "d_ziggurat_f64", "double", f64, false, 16, true);
+    write_table(fout, "h_ziggurat_f64", "double", f64, false, 16, false);
+
+    fout << R"(#endif // ROCRAND_NORMAL_ZIGGURAT_PRECOMPUTED_H_
+)";
+
+    return 0;
+}
@@ -0,0 +1,236 @@
+// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Benchmarks launch configurations of generators whose results do not depend
+// on them (Sobol generators and XORWOW, MRG32k3a and MTGP32 with
+// ROCRAND_ORDERING_PSEUDO_DYNAMIC) and stores the fastest ones in the tuning
+// database of the current device (see library/src/rng/tuning.hpp), which
+// is used by the library when ROCRAND_TUNING_DIR is set to the same directory.
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include <rng/tuning.hpp>
+
+using rocrand_host::detail::tuning_database;
+using rocrand_host::detail::tuning_entry;
+
+struct tuning_case
+{
+    const char * name;
+    rocrand_rng_type rng_type;
+    bool dynamic;
+    std::vector<std::pair<unsigned int, unsigned int>> configs;
+};
+
+std::vector<tuning_case> get_cases()
+{
+    // XORWOW and MRG32k3a have 131072 engines, MTGP32 512 engines
+    std::vector<std::pair<unsigned int, unsigned int>> engines_configs;
+    for(unsigned int threads = 64; threads <= 1024; threads *= 2)
+        engines_configs.push_back(std::make_pair(131072 / threads, threads));
+    std::vector<std::pair<unsigned int, unsigned int>> mtgp32_configs;
+    for(unsigned int blocks = 64; blocks <= 512; blocks *= 2)
+        mtgp32_configs.push_back(std::make_pair(blocks, 256U));
+    // Sobol threads are powers of 2 not less than the number of bits
+    std::vector<std::pair<unsigned int, unsigned int>> sobol32_configs;
+    std::vector<std::pair<unsigned int, unsigned int>> sobol64_configs;
+    for(unsigned int blocks = 1024; blocks <= 16384; blocks *= 4)
+    {
+        for(unsigned int threads = 32; threads <= 1024; threads *= 2)
+        {
+            sobol32_configs.push_back(std::make_pair(blocks, threads));
+            if(threads >= 64)
+                sobol64_configs.push_back(std::make_pair(blocks, threads));
+        }
+    }
+    return {
+        { "xorwow", ROCRAND_RNG_PSEUDO_XORWOW, true, engines_configs },
+        { "mrg32k3a", ROCRAND_RNG_PSEUDO_MRG32K3A, true, engines_configs },
+        { "mtgp32", ROCRAND_RNG_PSEUDO_MTGP32, true, mtgp32_configs },
+        { "sobol32", ROCRAND_RNG_QUASI_SOBOL32, false, sobol32_configs },
+        { "scrambled_sobol32", ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32, false, sobol32_configs },
+        { "sobol64", ROCRAND_RNG_QUASI_SOBOL64, false, sobol64_configs },
+        { "scrambled_sobol64", ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64, false, sobol64_configs },
+    };
+}
+
+// Average time in milliseconds of generating size values of value_size bytes
+// with the launch configuration, negative if the configuration is not supported
+double measure(const tuning_case& c,
+               const std::pair<unsigned int, unsigned int> config,
+               const unsigned int value_size,
+               const size_t size,
+               const unsigned int trials,
+               void * data)
+{
+    rocrand_generator generator;
+    if(rocrand_create_generator(&generator, c.rng_type) != ROCRAND_STATUS_SUCCESS)
+        return -1.0;
+    double time = -1.0;
+    if((!c.dynamic || rocrand_set_ordering(generator, ROCRAND_ORDERING_PSEUDO_DYNAMIC) == ROCRAND_STATUS_SUCCESS)
+        && rocrand_set_launch_config(generator, config.first, config.second) == ROCRAND_STATUS_SUCCESS)
+    {
+        auto generate = [&]()
+        {
+            return value_size == sizeof(float)
+                ? rocrand_generate_uniform(generator, static_cast<float *>(data), size)
+                : rocrand_generate_uniform_double(generator, static_cast<double *>(data), size);
+        };
+        hipEvent_t start, stop;
+        hipEventCreate(&start);
+        hipEventCreate(&stop);
+        // Warm-up call initializes the generator
+        if(generate() == ROCRAND_STATUS_SUCCESS && hipDeviceSynchronize() == hipSuccess)
+        {
+            hipEventRecord(start, 0);
+            bool ok = true;
+            for(unsigned int i = 0; i < trials && ok; i++)
+                ok = generate() == ROCRAND_STATUS_SUCCESS;
+            hipEventRecord(stop, 0);
+            hipEventSynchronize(stop);
+            float elapsed;
+            if(ok && hipEventElapsedTime(&elapsed, start, stop) == hipSuccess)
+                time = elapsed / trials;
+        }
+        hipEventDestroy(start);
+        hipEventDestroy(stop);
+    }
+    rocrand_destroy_generator(generator);
+    return time;
+}
+
+int main(int argc, char const *argv[])
+{
+    const char * env_dir = std::getenv("ROCRAND_TUNING_DIR");
+    std::string dir = env_dir != NULL ? env_dir : "";
+    unsigned int trials = 20;
+    std::vector<size_t> sizes;
+    bool valid = true;
+    for(int i = 1; i < argc && valid; i++)
+    {
+        const std::string arg(argv[i]);
+        if(arg == "--trials" && i + 1 < argc)
+        {
+            trials = std::max(1, std::atoi(argv[++i]));
+        }
+        else if(arg == "--size" && i + 1 < argc)
+        {
+            sizes.push_back(std::strtoull(argv[++i], NULL, 10));
+        }
+        else if(arg[0] != '-')
+        {
+            dir = arg;
+        }
+        else
+        {
+            valid = false;
+        }
+    }
+    if(!valid || dir.empty())
+    {
+        std::cout << "Usage:" << std::endl;
+        std::cout << "  ./rocrand-tune [--trials <n>] [--size <n>]... <directory>" << std::endl;
+        std::cout << "The directory defaults to ROCRAND_TUNING_DIR, the database of the current" << std::endl;
+        std::cout << "device is updated with the fastest launch configurations." << std::endl;
+        return -1;
+    }
+
+    if(sizes.empty())
+        sizes = { 1 << 16, 1 << 20, 1 << 24 };
+
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+    {
+        std::cout << "No device" << std::endl;
+        return -1;
+    }
+    // The library uses the path of the same directory
+    setenv("ROCRAND_TUNING_DIR", dir.c_str(), 1);
+    const std::string path = tuning_database::path(device);
+
+    const size_t max_size = *std::max_element(sizes.begin(), sizes.end());
+    void * data;
+    if(hipMalloc(&data, max_size * sizeof(double)) != hipSuccess)
+    {
+        std::cout << "Could not allocate " << max_size * sizeof(double) << " bytes" << std::endl;
+        return -1;
+    }
+
+    std::vector<tuning_entry> entries = tuning_database::read(path);
+    for(const tuning_case& c : get_cases())
+    {
+        for(unsigned int value_size : { 4U, 8U })
+        {
+            for(size_t size : sizes)
+            {
+                const unsigned int bucket = rocrand_host::detail::tuning_bucket(size);
+                std::pair<unsigned int, unsigned int> best(0, 0);
+                double best_time = 0.0;
+                for(auto config : c.configs)
+                {
+                    const double time = measure(c, config, value_size, size, trials, data);
+                    if(time >= 0.0 && (best.first == 0 || time < best_time))
+                    {
+                        best = config;
+                        best_time = time;
+                    }
+                }
+                if(best.first == 0)
+                    continue;
+                std::cout << c.name << " " << value_size << "-byte values, " << size << " values: "
+                          << best.first << "x" << best.second << " "
+                          << best_time << " ms" << std::endl;
+
+                entries.erase(
+                    std::remove_if(entries.begin(), entries.end(), [&](const tuning_entry& e)
+                    {
+                        return e.rng_type == static_cast<unsigned int>(c.rng_type)
+                            && e.value_size == value_size && e.bucket == bucket;
+                    }),
+                    entries.end()
+                );
+                tuning_entry e;
+                e.rng_type = static_cast<unsigned int>(c.rng_type);
+                e.value_size = value_size;
+                e.bucket = bucket;
+                e.blocks = best.first;
+                e.threads = best.second;
+                entries.push_back(e);
+            }
+        }
+    }
+    hipFree(data);
+
+    if(!tuning_database::write(path, entries))
+    {
+        std::cout << "Could not write " << path << std::endl;
+        return -1;
+    }
+    std::cout << "Written " << path << std::endl;
+    return 0;
+}
@@ -6,6 +6,7 @@
 #include <fstream>
 #include <string>
 #include <iomanip>
+#include <random>
 
 using namespace std;
 
@@ -36,18 +37,20 @@ bool read_sobol_set(struct sobol_set * inputs, int N, const std::string name)
     return true;
 }
 
-void init_direction_vectors(struct sobol_set * inputs, unsigned int * directions, int n_directions, int n)
+template<class DirectionVectorType>
+void init_direction_vectors(struct sobol_set * inputs, DirectionVectorType * directions, int n_directions, int n)
 {
+    constexpr int bits = sizeof(DirectionVectorType) * 8;
     for (int i = 0 ; i < n ; i++) {
         if (i == 0)
             for (int j = 0 ; j < n_directions ; j++)
-                directions[j] = 1 << (31 - j);
+                directions[j] = DirectionVectorType(1) << (bits - 1 - j);
         else
         {
             int ix = i - 1;
             int s = inputs[ix].s;
             for (int j = 0 ; j < s ; j++)
-                directions[j] = inputs[ix].m[j] << (31 - j);
+                directions[j] = DirectionVectorType(inputs[ix].m[j]) << (bits - 1 - j);
             for (int j = s ; j < n_directions ; j++)
             {
                 directions[j] = directions[j - s] ^ (directions[j - s] >> s);
@@ -59,47 +62,42 @@ void init_direction_vectors(struct sobol_set * inputs, unsigned int * directions
     }
 }
 
-void write_matrices(std::ofstream& fout, const std::string name, unsigned int * a, int n, int bits, bool is_device)
+// Scramble constants (digital shifts) of scrambled Sobol generators, one per dimension.
+// Both engines are fully specified by the standard, so the constants do not depend on
+// the standard library used to build the tool.
+template<class Engine, class ScrambleConstantType>
+void init_scramble_constants(ScrambleConstantType * constants, int n, typename Engine::result_type seed)
+{
+    Engine engine(seed);
+    for (int i = 0; i < n; i++)
+        constants[i] = static_cast<ScrambleConstantType>(engine());
+}
+
+const char * type_name(unsigned int *) { return "unsigned int"; }
+const char * type_name(unsigned long long *) { return "unsigned long long"; }
+
+template<class T>
+void write_matrices(std::ofstream& fout, const std::string name, const std::string size_name,
+                    T * a, int n, int bits, bool is_device)
 {
     fout << "static const ";
-    fout << (is_device ? "__device__ " : "") << "unsigned int " << name << "[SOBOL_N] = " << std::endl;
+    fout << (is_device ? "__device__ " : "") << type_name(a) << " " << name << "[" << size_name << "] = " << std::endl;
     fout << "    {" << std::endl;
     fout << "        ";
     for (int k = 0; k < n; k++)
     {
         fout << "0x";
-        fout << hex << setw(8) << setfill('0') << a[k] << ", ";
+        fout << hex << setw(sizeof(T) * 2) << setfill('0') << a[k];
+        fout << (sizeof(T) == 8 ? "ULL, " : ", ");
         if ((k + 1) % bits == 0 && k != 1)
             fout  << std::endl << "        ";
     }
-    fout << std::endl;
+    fout << dec << std::endl;
     fout << "    };" << std::endl;
     fout << std::endl;
 }
 
-int main(int argc, char const *argv[])
-{
-    if (argc != 3 || std::string(argv[1]) == "--help")
-    {
-        std::cout << "Usage:" << std::endl;
-        std::cout << "  ./sobol_direction_vector_generator new-joe-kuo-6.21201 ../../library/include/rocrand_sobol_precomputed.h" << std::endl;
-        std::cout << "  (the source file can be downloaded here: http://web.maths.unsw.edu.au/~fkuo/sobol/)" << std::endl;
-        return -1;
-    }
-
-    const std::string vector_file(argv[1]);
-    unsigned int SOBOL_DIM = 20000;
-    unsigned int SOBOL_N = SOBOL_DIM * 32;
-    struct sobol_set * inputs = new struct sobol_set[SOBOL_DIM];
-    unsigned int * directions = new unsigned int[SOBOL_N];
-    bool read = read_sobol_set(inputs, SOBOL_DIM, vector_file);
-
-    if (read)
-    {
-        init_direction_vectors(inputs, directions, 32, SOBOL_DIM);
-        const std::string file_path(argv[2]);
-        std::ofstream fout(file_path, std::ios_base::out | std::ios_base::trunc);
-        fout << R"(// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+const char * license_header = R"(// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
 //
 // Permission is hereby granted, free of charge, to any person obtaining a copy
 // of this software and associated documentation files (the "Software"), to deal
@@ -119,28 +117,96 @@ int main(int argc, char const *argv[])
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
-#ifndef ROCRAND_SOBOL_PRECOMPUTED_H_
-#define ROCRAND_SOBOL_PRECOMPUTED_H_
+)";
 
+void write_header_begin(std::ofstream& fout, const std::string guard)
+{
+    fout << license_header;
+    fout << "#ifndef " << guard << std::endl;
+    fout << "#define " << guard << std::endl;
+    fout << R"(
 // Auto-generated file. Do not edit!
 // Generated by tools/sobol_direction_vector_generator
 
 )";
+}
+
+void write_header_end(std::ofstream& fout, const std::string guard)
+{
+    fout << std::endl << "#endif // " << guard << std::endl;
+}
 
-        fout << "#define SOBOL_DIM " << SOBOL_DIM << std::endl;
-        fout << "#define SOBOL_N " << SOBOL_N << std::endl;
-        fout << std::endl;
+int main(int argc, char const *argv[])
+{
+    if (argc != 3 || std::string(argv[1]) == "--help")
+    {
+        std::cout << "Usage:" << std::endl;
+        std::cout << "  ./sobol_direction_vector_generator new-joe-kuo-6.21201 ../../library/include/" << std::endl;
+        std::cout << "  (the source file can be downloaded here: http://web.maths.unsw.edu.au/~fkuo/sobol/)" << std::endl;
+        std::cout << "  Writes rocrand_sobol_precomputed.h, rocrand_sobol64_precomputed.h and" << std::endl;
+        std::cout << "  rocrand_scrambled_sobol_precomputed.h to the given directory." << std::endl;
+        return -1;
+    }
 
-        write_matrices(fout, "h_sobol32_direction_vectors", directions, SOBOL_N,
-        32, false);
+    const std::string vector_file(argv[1]);
+    std::string output_dir(argv[2]);
+    if (!output_dir.empty() && output_dir.back() != '/')
+        output_dir += '/';
 
-        fout << R"(
-#endif // ROCRAND_SOBOL_PRECOMPUTED_H_
-)";
+    unsigned int SOBOL_DIM = 20000;
+    unsigned int SOBOL_N = SOBOL_DIM * 32;
+    unsigned int SOBOL64_N = SOBOL_DIM * 64;
+    struct sobol_set * inputs = new struct sobol_set[SOBOL_DIM];
+    unsigned int * directions = new unsigned int[SOBOL_N];
+    unsigned long long * directions64 = new unsigned long long[SOBOL64_N];
+    unsigned int * scramble_constants = new unsigned int[SOBOL_DIM];
+    unsigned long long * scramble_constants64 = new unsigned long long[SOBOL_DIM];
+    bool read = read_sobol_set(inputs, SOBOL_DIM, vector_file);
+
+    if (read)
+    {
+        init_direction_vectors(inputs, directions, 32, SOBOL_DIM);
+        init_direction_vectors(inputs, directions64, 64, SOBOL_DIM);
+        init_scramble_constants<std::mt19937>(scramble_constants, SOBOL_DIM, 5489U);
+        init_scramble_constants<std::mt19937_64>(scramble_constants64, SOBOL_DIM, 5489ULL);
+
+        {
+            const std::string guard("ROCRAND_SOBOL_PRECOMPUTED_H_");
+            std::ofstream fout(output_dir + "rocrand_sobol_precomputed.h", std::ios_base::out | std::ios_base::trunc);
+            write_header_begin(fout, guard);
+            fout << "#define SOBOL_DIM " << SOBOL_DIM << std::endl;
+            fout << "#define SOBOL_N " << SOBOL_N << std::endl;
+            fout << std::endl;
+            write_matrices(fout, "h_sobol32_direction_vectors", "SOBOL_N", directions, SOBOL_N, 32, false);
+            write_header_end(fout, guard);
+        }
+        {
+            const std::string guard("ROCRAND_SOBOL64_PRECOMPUTED_H_");
+            std::ofstream fout(output_dir + "rocrand_sobol64_precomputed.h", std::ios_base::out | std::ios_base::trunc);
+            write_header_begin(fout, guard);
+            fout << "#define SOBOL64_DIM " << SOBOL_DIM << std::endl;
+            fout << "#define SOBOL64_N " << SOBOL64_N << std::endl;
+            fout << std::endl;
+            write_matrices(fout, "h_sobol64_direction_vectors", "SOBOL64_N", directions64, SOBOL64_N, 64, false);
+            write_header_end(fout, guard);
+        }
+        {
+            const std::string guard("ROCRAND_SCRAMBLED_SOBOL_PRECOMPUTED_H_");
+            std::ofstream fout(output_dir + "rocrand_scrambled_sobol_precomputed.h", std::ios_base::out | std::ios_base::trunc);
+            write_header_begin(fout, guard);
+            fout << "#define SCRAMBLED_SOBOL_DIM " << SOBOL_DIM << std::endl;
+            fout << std::endl;
+            write_matrices(fout, "h_scrambled_sobol32_constants", "SCRAMBLED_SOBOL_DIM", scramble_constants, SOBOL_DIM, 32, false);
+            write_matrices(fout, "h_scrambled_sobol64_constants", "SCRAMBLED_SOBOL_DIM", scramble_constants64, SOBOL_DIM, 32, false);
+            write_header_end(fout, guard);
+        }
     }
 
     delete[] inputs;
     delete[] directions;
+    delete[] directions64;
+    delete[] scramble_constants;
+    delete[] scramble_constants64;
 
     return 0;
 }
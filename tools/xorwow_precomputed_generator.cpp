@@ -1,7 +1,9 @@
+#include <cstdlib>
 #include <iostream>
 #include <fstream>
 #include <string>
 #include <iomanip>
+#include <vector>
 
 
 const int XORWOW_N = 5;  // 5 values
@@ -9,13 +11,18 @@ const int XORWOW_M = 32; // 32-bit each
 
 const int XORWOW_SIZE = XORWOW_M * XORWOW_N * XORWOW_N;
 
-const int XORWOW_JUMP_MATRICES = 32;
-const int XORWOW_JUMP_LOG2 = 2;
+// Jumps are done digit by digit in radix 2^XORWOW_JUMP_LOG2. Without digit tables
+// the k-th matrix is A^(radix^k) and it is applied digit times, with digit tables
+// there are radix - 1 matrices A^(d * radix^k) for every k, so a jump needs at most
+// one matrix-vector product per digit (--radix-log2 and --digit-tables options)
+static int XORWOW_JUMP_LOG2 = 2;
+static int XORWOW_JUMP_MATRICES = 32;
+static int XORWOW_JUMP_DIGITS = 1;
 
 const int XORWOW_SEQUENCE_JUMP_LOG2 = 67;
 
-static unsigned int jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SIZE];
-static unsigned int sequence_jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SIZE];
+static std::vector<unsigned int> jump_matrices;
+static std::vector<unsigned int> sequence_jump_matrices;
 
 
 void copy_mat(unsigned int * dst, const unsigned int * src)
@@ -112,6 +119,29 @@ struct rocrand_xorwow_state
     }
 };
 
+// Saves matrices of all digits of all positions for a jump by one step
+// with matrix a (d * radix^k steps are a^(d * radix^k))
+void generate_digit_matrices(unsigned int * a, unsigned int * matrices)
+{
+    unsigned int b[XORWOW_SIZE];
+    for (int k = 0; k < XORWOW_JUMP_MATRICES; k++)
+    {
+        if (k > 0)
+        {
+            copy_mat(b, a);
+            mat_pow(a, b, (1 << XORWOW_JUMP_LOG2));
+        }
+        // matrices[k * digits + d - 1] = a^d
+        unsigned int * digits = matrices + k * XORWOW_JUMP_DIGITS * XORWOW_SIZE;
+        copy_mat(digits, a);
+        for (int d = 1; d < XORWOW_JUMP_DIGITS; d++)
+        {
+            copy_mat(digits + d * XORWOW_SIZE, digits + (d - 1) * XORWOW_SIZE);
+            mul_mat_mat_inplace(digits + d * XORWOW_SIZE, a);
+        }
+    }
+}
+
 void generate_matrices()
 {
     unsigned int one_step[XORWOW_SIZE];
@@ -137,18 +167,13 @@ void generate_matrices()
         }
     }
 
+    jump_matrices.resize(XORWOW_JUMP_MATRICES * XORWOW_JUMP_DIGITS * XORWOW_SIZE);
+    sequence_jump_matrices.resize(XORWOW_JUMP_MATRICES * XORWOW_JUMP_DIGITS * XORWOW_SIZE);
+
     {
         unsigned int a[XORWOW_SIZE];
-        unsigned int b[XORWOW_SIZE];
         copy_mat(a, one_step);
-
-        copy_mat(jump_matrices[0], a);
-        for (int k = 1; k < XORWOW_JUMP_MATRICES; k++)
-        {
-            copy_mat(b, a);
-            mat_pow(a, b, (1 << XORWOW_JUMP_LOG2));
-            copy_mat(jump_matrices[k], a);
-        }
+        generate_digit_matrices(a, jump_matrices.data());
     }
 
     {
@@ -161,20 +186,22 @@ void generate_matrices()
         // For 67: (A^(2^33))^(2^34) = A^(2^67)
         mat_pow(a, b, 1ULL << (XORWOW_SEQUENCE_JUMP_LOG2 - XORWOW_SEQUENCE_JUMP_LOG2 / 2));
 
-        copy_mat(sequence_jump_matrices[0], a);
-        for (int k = 1; k < XORWOW_JUMP_MATRICES; k++)
-        {
-            copy_mat(b, a);
-            mat_pow(a, b, (1 << XORWOW_JUMP_LOG2));
-            copy_mat(sequence_jump_matrices[k], a);
-        }
+        generate_digit_matrices(a, sequence_jump_matrices.data());
     }
 }
 
 void write_matrices(std::ofstream& fout, const std::string name, unsigned int * a, bool is_device)
 {
-    fout << "static const " << (is_device ? "__device__ " : "") << "unsigned int " << name << "[XORWOW_JUMP_MATRICES][XORWOW_SIZE] = {" << std::endl;
-    for (int k = 0; k < XORWOW_JUMP_MATRICES; k++)
+    fout << (is_device ? "ROCRAND_DEVICE_TABLE const __device__ " : "static const ") << "unsigned int " << name << "[XORWOW_JUMP_MATRICES * XORWOW_JUMP_DIGITS][XORWOW_SIZE]";
+    if (is_device)
+    {
+        fout << std::endl << "#if defined(ROCRAND_DEVICE_TABLE_DEFINITIONS)" << std::endl << "= {" << std::endl;
+    }
+    else
+    {
+        fout << " = {" << std::endl;
+    }
+    for (int k = 0; k < XORWOW_JUMP_MATRICES * XORWOW_JUMP_DIGITS; k++)
     {
         fout << "    {" << std::endl;
         for (int i = 0; i < XORWOW_M; i++)
@@ -188,18 +215,48 @@ void write_matrices(std::ofstream& fout, const std::string name, unsigned int *
         }
         fout << "    }," << std::endl;
     }
-    fout << "};" << std::endl;
+    if (is_device)
+    {
+        fout << "}" << std::endl << "#endif" << std::endl << ";" << std::endl;
+    }
+    else
+    {
+        fout << "};" << std::endl;
+    }
     fout << std::endl;
 }
 
 
 int main(int argc, char const *argv[]) {
-    if (argc != 2 || std::string(argv[1]) == "--help")
+    bool digit_tables = false;
+    bool valid = argc >= 2 && std::string(argv[1]) != "--help";
+    for (int i = 2; valid && i < argc; i++)
+    {
+        const std::string arg(argv[i]);
+        if (arg == "--radix-log2" && i + 1 < argc)
+        {
+            XORWOW_JUMP_LOG2 = std::atoi(argv[++i]);
+            valid = XORWOW_JUMP_LOG2 >= 1 && XORWOW_JUMP_LOG2 <= 8;
+        }
+        else if (arg == "--digit-tables")
+        {
+            digit_tables = true;
+        }
+        else
+        {
+            valid = false;
+        }
+    }
+    if (!valid)
     {
         std::cout << "Usage:" << std::endl;
-        std::cout << "  ./xorwow_precomputed_generator ../../library/include/rocrand_xorwow_precomputed.h" << std::endl;
+        std::cout << "  ./xorwow_precomputed_generator ../../library/include/rocrand_xorwow_precomputed.h [--radix-log2 <1..8>] [--digit-tables]" << std::endl;
+        std::cout << "Defaults: radix 2^2 without digit tables (jumps by 16^k with --radix-log2 4 --digit-tables" << std::endl;
+        std::cout << "need at most 16 matrix-vector products instead of 96, the tables are 7.5 times larger)" << std::endl;
         return -1;
     }
+    XORWOW_JUMP_MATRICES = (64 + XORWOW_JUMP_LOG2 - 1) / XORWOW_JUMP_LOG2;
+    XORWOW_JUMP_DIGITS = digit_tables ? (1 << XORWOW_JUMP_LOG2) - 1 : 1;
 
     generate_matrices();
 
@@ -238,17 +295,18 @@ int main(int argc, char const *argv[]) {
     fout << "#define XORWOW_SIZE (XORWOW_M * XORWOW_N * XORWOW_N)" << std::endl;
     fout << "#define XORWOW_JUMP_MATRICES " << XORWOW_JUMP_MATRICES << std::endl;
     fout << "#define XORWOW_JUMP_LOG2 " << XORWOW_JUMP_LOG2 << std::endl;
+    fout << "#define XORWOW_JUMP_DIGITS " << XORWOW_JUMP_DIGITS << std::endl;
     fout << std::endl;
 
     write_matrices(fout, "d_xorwow_jump_matrices",
-        static_cast<unsigned int *>(&jump_matrices[0][0]), true);
+        jump_matrices.data(), true);
     write_matrices(fout, "h_xorwow_jump_matrices",
-        static_cast<unsigned int *>(&jump_matrices[0][0]), false);
+        jump_matrices.data(), false);
 
     write_matrices(fout, "d_xorwow_sequence_jump_matrices",
-        static_cast<unsigned int *>(&sequence_jump_matrices[0][0]), true);
+        sequence_jump_matrices.data(), true);
     write_matrices(fout, "h_xorwow_sequence_jump_matrices",
-        static_cast<unsigned int *>(&sequence_jump_matrices[0][0]), false);
+        sequence_jump_matrices.data(), false);
 
     fout << R"(
 #endif // ROCRAND_XORWOW_PRECOMPUTED_H_
@@ -0,0 +1,248 @@
+#include <cstdlib>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <iomanip>
+#include <vector>
+
+
+// xoshiro128 (the linear engine of xoshiro128++) is a linear map A on 128-bit
+// states, its characteristic polynomial P has degree 128. A jump by J steps is
+// the polynomial x^J mod P(x) = c_0 + c_1 x + ... + c_127 x^127 evaluated at A:
+// the state after the jump is the sum (xor) of states after k steps for all
+// nonzero c_k, so for every power 2^e only 128 bits are stored.
+const int XOSHIRO128_DEGREE = 128;
+const int XOSHIRO128_N = 4; // 4 32-bit words of a polynomial
+
+// Jumps by 2^e for e = 0 .. 127 (2^64 * 2^e for e = 64 .. 127 are subsequences)
+const int XOSHIRO128_JUMP_POLYNOMIALS = 128;
+
+typedef std::vector<unsigned int> poly; // bit k of word k / 32 is the coefficient of x^k
+
+struct xoshiro128_state
+{
+    unsigned int s[4];
+
+    void discard()
+    {
+        const unsigned int t = s[1] << 9;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = (s[3] << 11) | (s[3] >> 21);
+    }
+};
+
+bool get_bit(const poly& p, int k)
+{
+    return (p[k / 32] >> (k % 32)) & 1;
+}
+
+void flip_bit(poly& p, int k)
+{
+    p[k / 32] ^= 1U << (k % 32);
+}
+
+// Characteristic polynomial of A (minimal polynomial of the sequence of the lowest
+// bit of s[0], Berlekamp-Massey), the full period means it is primitive
+poly characteristic_polynomial()
+{
+    const int length = 2 * XOSHIRO128_DEGREE;
+    std::vector<int> bits(length);
+    xoshiro128_state state = { { 0x12345678U, 0x9abcdef0U, 0x0fedcba9U, 0x87654321U } };
+    for (int i = 0; i < length; i++)
+    {
+        bits[i] = state.s[0] & 1;
+        state.discard();
+    }
+
+    std::vector<int> c(length + 1, 0);
+    std::vector<int> b(length + 1, 0);
+    c[0] = b[0] = 1;
+    int l = 0;
+    int m = -1;
+    for (int n = 0; n < length; n++)
+    {
+        int d = bits[n];
+        for (int i = 1; i <= l; i++)
+        {
+            d ^= c[i] & bits[n - i];
+        }
+        if (d == 0)
+        {
+            continue;
+        }
+        const std::vector<int> t = c;
+        for (int i = 0; i + n - m <= length; i++)
+        {
+            c[i + n - m] ^= b[i];
+        }
+        if (2 * l <= n)
+        {
+            l = n + 1 - l;
+            m = n;
+            b = t;
+        }
+    }
+    if (l != XOSHIRO128_DEGREE)
+    {
+        std::cerr << "Unexpected degree " << l << std::endl;
+        std::exit(-1);
+    }
+
+    // Connection polynomial c(x) is the reciprocal of P(x), the monic x^128
+    // is implicit
+    poly p(XOSHIRO128_N, 0);
+    for (int k = 0; k < XOSHIRO128_DEGREE; k++)
+    {
+        if (c[XOSHIRO128_DEGREE - k])
+        {
+            flip_bit(p, k);
+        }
+    }
+    return p;
+}
+
+// a * b mod P
+poly mul_mod(const poly& a, const poly& b, const poly& p)
+{
+    poly r(XOSHIRO128_N, 0);
+    for (int k = XOSHIRO128_DEGREE - 1; k >= 0; k--)
+    {
+        // r = r * x mod P
+        const bool carry = get_bit(r, XOSHIRO128_DEGREE - 1);
+        for (int i = XOSHIRO128_N - 1; i > 0; i--)
+        {
+            r[i] = (r[i] << 1) | (r[i - 1] >> 31);
+        }
+        r[0] <<= 1;
+        if (carry)
+        {
+            for (int i = 0; i < XOSHIRO128_N; i++)
+            {
+                r[i] ^= p[i];
+            }
+        }
+        if (get_bit(b, k))
+        {
+            for (int i = 0; i < XOSHIRO128_N; i++)
+            {
+                r[i] ^= a[i];
+            }
+        }
+    }
+    return r;
+}
+
+void write_polynomials(std::ofstream& fout, const std::string name,
+                       const std::vector<poly>& polynomials, bool is_device)
+{
+    fout << (is_device ? "ROCRAND_DEVICE_TABLE const __device__ " : "static const ") << "unsigned int " << name << "[XOSHIRO128_JUMP_POLYNOMIALS][XOSHIRO128_N]";
+    if (is_device)
+    {
+        fout << std::endl << "#if defined(ROCRAND_DEVICE_TABLE_DEFINITIONS)" << std::endl << "= {" << std::endl;
+    }
+    else
+    {
+        fout << " = {" << std::endl;
+    }
+    for (size_t e = 0; e < polynomials.size(); e++)
+    {
+        fout << "    { ";
+        for (int i = 0; i < XOSHIRO128_N; i++)
+        {
+            fout << "0x" << std::hex << std::setw(8) << std::setfill('0')
+                 << polynomials[e][i] << std::dec << "U, ";
+        }
+        fout << "}, // 2^" << e << std::endl;
+    }
+    if (is_device)
+    {
+        fout << "}" << std::endl << "#endif" << std::endl << ";" << std::endl;
+    }
+    else
+    {
+        fout << "};" << std::endl;
+    }
+    fout << std::endl;
+}
+
+
+int main(int argc, char const *argv[]) {
+    if (argc != 2 || std::string(argv[1]) == "--help")
+    {
+        std::cout << "Usage:" << std::endl;
+        std::cout << "  ./xoshiro128_precomputed_generator ../../library/include/rocrand_xoshiro128_precomputed.h" << std::endl;
+        return -1;
+    }
+
+    const poly p = characteristic_polynomial();
+
+    // x^(2^e) mod P by repeated squaring
+    std::vector<poly> polynomials(XOSHIRO128_JUMP_POLYNOMIALS);
+    poly x(XOSHIRO128_N, 0);
+    flip_bit(x, 1);
+    for (int e = 0; e < XOSHIRO128_JUMP_POLYNOMIALS; e++)
+    {
+        polynomials[e] = x;
+        x = mul_mod(x, x, p);
+    }
+
+    // The reference jump() and long_jump() of xoshiro128++
+    const unsigned int jump[XOSHIRO128_N] = { 0x8764000bU, 0xf542d2d3U, 0x6fa035c3U, 0x77f2db5bU };
+    const unsigned int long_jump[XOSHIRO128_N] = { 0xb523952eU, 0x0b6f099fU, 0xccf5a0efU, 0x1c580662U };
+    for (int i = 0; i < XOSHIRO128_N; i++)
+    {
+        if (polynomials[64][i] != jump[i] || polynomials[96][i] != long_jump[i])
+        {
+            std::cerr << "Polynomials differ from the reference jumps" << std::endl;
+            return -1;
+        }
+    }
+
+    const std::string file_path(argv[1]);
+    std::ofstream fout(file_path, std::ios_base::out | std::ios_base::trunc);
+    fout << R"(// Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_XOSHIRO128_PRECOMPUTED_H_
+#define ROCRAND_XOSHIRO128_PRECOMPUTED_H_
+
+// Auto-generated file. Do not edit!
+// Generated by tools/xoshiro128_precomputed_generator
+
+)";
+
+    fout << "#define XOSHIRO128_N " << XOSHIRO128_N << std::endl;
+    fout << "#define XOSHIRO128_DEGREE " << XOSHIRO128_DEGREE << std::endl;
+    fout << "#define XOSHIRO128_JUMP_POLYNOMIALS " << XOSHIRO128_JUMP_POLYNOMIALS << std::endl;
+    fout << std::endl;
+
+    write_polynomials(fout, "d_xoshiro128_jump_polynomials", polynomials, true);
+    write_polynomials(fout, "h_xoshiro128_jump_polynomials", polynomials, false);
+
+    fout << R"(
+#endif // ROCRAND_XOSHIRO128_PRECOMPUTED_H_
+)";
+
+    return 0;
+}